@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zdesc2ge.c, normal z -> c, Mon Feb  6 14:06:27 2017
+ * @generated from compute/zdesc2ge.c, normal z -> c, Thu Oct 15 04:41:24 2026
  *
  **/
 
@@ -21,7 +21,7 @@
     @ingroup plasma_ccrb2cm
 
     Convert tiled (CCRB) to column-major (CM) matrix layout.
-    Out-of-place.
+    Out-of-place. Unpacks the tiles of a packed A.
 */
 void plasma_omp_cdesc2ge(plasma_desc_t A,
                          plasma_complex32_t *pA, int lda,
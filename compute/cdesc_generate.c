@@ -0,0 +1,205 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zdesc_generate.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_descriptor
+ *
+ *  Creates an m-by-n matrix in tile layout, with the tile size of the
+ *  context, and fills it by a user generator called for each tile in
+ *  parallel, so that the matrix is assembled in tile layout directly.
+ *  The matrix is freed by plasma_desc_destroy.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] generator
+ *          Called as generator(i, j, mb, nb, T, ldt, args) to fill the
+ *          mb-by-nb block T, with leading dimension ldt, whose first element
+ *          is the element (i, j) of A. Called from several threads at once.
+ *          If NULL, the matrix is not initialized.
+ *
+ * @param[in] args
+ *          Passed to the generator.
+ *
+ * @param[out] A
+ *          Descriptor of the matrix A in tile layout.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cdesc_generate
+ * @sa plasma_desc_destroy
+ *
+ ******************************************************************************/
+int plasma_cdesc_create(int m, int n,
+                        plasma_cgenerator_t generator, void *args,
+                        plasma_desc_t *A)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (A == NULL) {
+        plasma_error("NULL A");
+        return -5;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // quick return
+    if (generator == NULL || imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_cdesc_generate(generator, args, *A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    if (status != PlasmaSuccess)
+        plasma_desc_destroy(A);
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_descriptor
+ *
+ *  Fills a general matrix A in tile layout by a user generator, one task
+ *  per tile. Non-blocking version of the generation in plasma_cdesc_create.
+ *  Each task has an output dependency on its tile, as the tasks of
+ *  plasma_omp_cge2desc.
+ *
+ *******************************************************************************
+ *
+ * @param[in] generator
+ *          Called as generator(i, j, mb, nb, T, ldt, args) to fill the
+ *          mb-by-nb block T, with leading dimension ldt, whose first element
+ *          is the element (i, j) of A.
+ *
+ * @param[in] args
+ *          Passed to the generator.
+ *
+ * @param[out] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cdesc_create
+ *
+ ******************************************************************************/
+void plasma_omp_cdesc_generate(plasma_cgenerator_t generator, void *args,
+                               plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (generator == NULL) {
+        plasma_error("NULL generator");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.type != PlasmaGeneral || plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pcdesc_generate(generator, args, A, sequence, request);
+}
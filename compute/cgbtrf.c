@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgbtrf.c, normal z -> c, Mon Feb  6 14:06:28 2017
+ * @generated from compute/zgbtrf.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -108,44 +108,41 @@ int plasma_cgbtrf(int m, int n, int kl, int ku,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cpb2desc(pAB, ldab, AB, sequence, &request);
+        plasma_omp_cpb2desc(pAB, ldab, AB, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Call the tile async function.
-        plasma_omp_cgbtrf(AB, ipiv, sequence, &request);
+        plasma_omp_cgbtrf(AB, ipiv, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2pb(AB, pAB, ldab, sequence, &request);
+        plasma_omp_cdesc2pb(AB, pAB, ldab, &sequence, &request);
     }
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&AB);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -0,0 +1,341 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgehrd.c, normal z -> c, Thu Oct 15 08:59:52 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gehrd
+ *
+ *  Reduces a general n-by-n matrix A to upper Hessenberg form H by a
+ *  unitary similarity transformation, A = Q H Q^H, in two stages.
+ *
+ *  The first stage reduces A to a block upper Hessenberg matrix B of lower
+ *  bandwidth nb, A = Q1 B Q1^H, by tile QR factorizations of the panels
+ *  applied from both sides (plasma_omp_cge2hb). It runs in parallel over
+ *  the tiles, and holds most of the flops, in BLAS-3 kernels. The second
+ *  stage chases the bulges of B down to Hessenberg form, B = Q2 H Q2^H,
+ *  on a team of PlasmaNumPanelThreads threads, by BLAS-2 operations on
+ *  the upper triangle and n*nb elements below it.
+ *
+ *  Q = Q1 Q2 is formed, optionally, by applying the reflectors of Q2 to the
+ *  identity by independent blocks of nb columns, and then Q1 from the left
+ *  by the tile kernels of plasma_cunmqr.
+ *
+ *******************************************************************************
+ *
+ * @param[in] jobq
+ *          - PlasmaNoVec: computes H only;
+ *          - PlasmaVec:   computes H and Q.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the n-by-n general matrix A.
+ *          On exit, the upper Hessenberg matrix H, with zeros below the
+ *          first subdiagonal.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] pQ
+ *          If jobq = PlasmaVec, on exit, the n-by-n unitary matrix Q.
+ *          Not referenced if jobq = PlasmaNoVec.
+ *
+ * @param[in] ldq
+ *          The leading dimension of the array Q.
+ *          ldq >= max(1,n) if jobq = PlasmaVec, ldq >= 1 otherwise.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cge2hb
+ * @sa plasma_cgehrd
+ * @sa plasma_dgehrd
+ * @sa plasma_sgehrd
+ *
+ ******************************************************************************/
+int plasma_cgehrd(plasma_enum_t jobq, int n,
+                  plasma_complex32_t *pA, int lda,
+                  plasma_complex32_t *pQ, int ldq)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((jobq != PlasmaNoVec) &&
+        (jobq != PlasmaVec)) {
+        plasma_error("illegal value of jobq");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (jobq == PlasmaVec && pQ == NULL) {
+        plasma_error("NULL Q");
+        return -5;
+    }
+    if (ldq < 1 || (jobq == PlasmaVec && ldq < imax(1, n))) {
+        plasma_error("illegal value of ldq");
+        return -6;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t T;
+    plasma_desc_t Q;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_descT_create(A, ib, PlasmaFlatHouseholder, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    if (jobq == PlasmaVec) {
+        retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                            n, n, 0, 0, n, n, &Q);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&T);
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+    }
+
+    // Allocate the reflectors of the second stage, ns per sweep.
+    int kd = imin(nb, n-1);
+    int ns = n > 2 ? (n-2+kd-1)/kd : 0;
+    size_t ntau = (size_t)imax(1, n-2)*imax(1, ns);
+    plasma_complex32_t *V = (plasma_complex32_t*)malloc(
+        ntau*kd*sizeof(plasma_complex32_t));
+    plasma_complex32_t *tau = (plasma_complex32_t*)malloc(
+        ntau*sizeof(plasma_complex32_t));
+    if (V == NULL || tau == NULL) {
+        plasma_error("malloc() failed");
+        free(V);
+        free(tau);
+        if (jobq == PlasmaVec)
+            plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        free(V);
+        free(tau);
+        if (jobq == PlasmaVec)
+            plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+
+        // Reduce to block Hessenberg, and back to LAPACK layout.
+        plasma_omp_cge2hb(A, T, work, &sequence, &request);
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+
+        // Reduce to Hessenberg.
+        plasma_pcgbhrd(n, kd, pA, lda, V, tau, &sequence, &request);
+
+        if (jobq == PlasmaVec) {
+            // Q2, by blocks of columns
+            plasma_pcgbhrd_q(n, kd, V, tau, pQ, ldq, work,
+                             &sequence, &request);
+
+            // The tasks of Q2 are keyed on its blocks of columns in LAPACK
+            // layout, not on the tiles translated from them.
+            #pragma omp taskwait
+            plasma_omp_cge2desc(pQ, ldq, Q, &sequence, &request);
+
+            // Q = Q1 Q2, where Q1 is the Q of the QR factorization of
+            // A(nb:n-1, 0:n-nb-1).
+            if (n > nb) {
+                plasma_desc_t AV = plasma_desc_view(A, nb, 0, n-nb, n-nb);
+                plasma_desc_t TV = plasma_desc_view(T, ib, 0, T.m-ib, T.n);
+                plasma_desc_t QV = plasma_desc_view(Q, nb, 0, n-nb, n);
+                plasma_pcunmqr(PlasmaLeft, PlasmaNoTrans, AV, TV, QV,
+                               work, &sequence, &request);
+            }
+            plasma_omp_cdesc2ge(Q, pQ, ldq, &sequence, &request);
+        }
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrices.
+    free(V);
+    free(tau);
+    if (jobq == PlasmaVec)
+        plasma_desc_destroy(&Q);
+    plasma_desc_destroy(&T);
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gehrd
+ *
+ *  Reduces a general matrix A to block upper Hessenberg form B of lower
+ *  bandwidth nb, A = Q B Q^H, the first stage of plasma_cgehrd.
+ *  Non-blocking tile version.
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of the n-by-n matrix A, with square tiles.
+ *          On exit, the block upper Hessenberg matrix B, in the upper
+ *          triangle of the tiles of the block subdiagonal and above.
+ *          The tiles below hold the reflectors of Q, which is the Q of the
+ *          QR factorization of A(nb:n-1, 0:n-nb-1).
+ *
+ * @param[out] T
+ *          Descriptor of matrix T, created by plasma_descT_create for A
+ *          in the flat Householder mode.
+ *          On exit, auxiliary data of Q from its second tile row on.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          Contains preallocated space for tau and work arrays.
+ *          Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cgehrd
+ * @sa plasma_omp_cge2hb
+ * @sa plasma_omp_dge2hb
+ * @sa plasma_omp_sge2hb
+ *
+ ******************************************************************************/
+void plasma_omp_cge2hb(plasma_desc_t A, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m != A.n || A.mb != A.nb) {
+        plasma_error("A not square or tiles not square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pcge2hb(A, T, work, sequence, request);
+}
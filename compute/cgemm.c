@@ -6,17 +6,184 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgemm.c, normal z -> c, Mon Feb  6 14:06:30 2017
+ * @generated from compute/zgemm.c, normal z -> c, Thu Oct 15 09:23:21 2026
  *
  **/
 
 #include "plasma.h"
 #include "plasma_async.h"
+#include "plasma_blas_threads.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "core_blas.h"
+
+/******************************************************************************/
+// Frees the workspaces of plasma_pcgemm_strassen.
+static void plasma_cgemm_strassen_destroy(int levels, plasma_desc_t *W)
+{
+    for (int i = 0; i < 4*levels; i++) {
+        if (W[i].matrix != NULL)
+            plasma_desc_destroy(&W[i]);
+    }
+}
+
+/******************************************************************************/
+// Creates the workspaces of plasma_pcgemm_strassen for the given levels.
+// The product workspace of the first level is only needed for beta != 0.
+static int plasma_cgemm_strassen_create(int m, int n, int k, int nb,
+                                        plasma_complex32_t beta, int levels,
+                                        plasma_desc_t *W)
+{
+    for (int i = 0; i < 4*levels; i++)
+        W[i].matrix = NULL;
+
+    for (int d = 0; d < levels; d++) {
+        int me = m/(2*nb)*2*nb;
+        int ne = n/(2*nb)*2*nb;
+        int ke = k/(2*nb)*2*nb;
+        m = me/2;
+        n = ne/2;
+        k = ke/2;
+
+        int dims[4][2] = {{m, k}, {k, n}, {m, n}, {me, ne}};
+        for (int i = 0; i < 4; i++) {
+            if (i == 3 && d == 0 && beta == 0.0)
+                continue;
+
+            int retval = plasma_desc_general_zero_create(
+                PlasmaComplexFloat, nb, nb,
+                dims[i][0], dims[i][1], 0, 0, dims[i][0], dims[i][1],
+                &W[4*d+i]);
+            if (retval != PlasmaSuccess) {
+                W[4*d+i].matrix = NULL;
+                plasma_cgemm_strassen_destroy(levels, W);
+                return retval;
+            }
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Returns the transposition of the product op( A ) op( B ) as a rank-k
+// update, PlasmaConjTrans when op( B ) = op( A )^H, PlasmaTrans when
+// op( B ) = op( A )^T, or PlasmaNoTrans when the product is left to the
+// general algorithm. Without the PlasmaGemmHint PlasmaGemmHintRankK,
+// B must be the same array as A, and beta zero, C being overwritten.
+static plasma_enum_t plasma_cgemm_rank_k(plasma_context_t *plasma,
+                                         plasma_enum_t transa,
+                                         plasma_enum_t transb,
+                                         int m, int n,
+                                         plasma_complex32_t alpha,
+                                         const plasma_complex32_t *pA, int lda,
+                                         const plasma_complex32_t *pB, int ldb,
+                                         plasma_complex32_t beta)
+{
+    if (plasma->gemm_hint == PlasmaGemmHintNone ||
+        plasma_gemm_ozaki(plasma) > 0 || m != n ||
+        (transa == PlasmaNoTrans) == (transb == PlasmaNoTrans))
+        return PlasmaNoTrans;
+
+    if (plasma->gemm_hint == PlasmaGemmHintAuto &&
+        (pA != pB || lda != ldb || beta != 0.0))
+        return PlasmaNoTrans;
+
+    // The Hermitian update takes real scalars.
+    plasma_enum_t trans = transa == PlasmaNoTrans ? transb : transa;
+    if (trans == PlasmaConjTrans &&
+        (alpha != creal(alpha) || beta != creal(beta)))
+        return PlasmaNoTrans;
+
+    return trans;
+}
+
+/******************************************************************************/
+// Computes C = alpha op( A ) op( A )^H + beta C by the Hermitian
+// (trans = PlasmaConjTrans) or symmetric (trans = PlasmaTrans) rank-k
+// update of the lower triangle of C, with half the flops of the product,
+// and the expansion of the triangle to the full C.
+static int plasma_cgemm_rank_k_run(plasma_context_t *plasma,
+                                   plasma_enum_t transa, plasma_enum_t trans,
+                                   int n, int k,
+                                   plasma_complex32_t alpha,
+                                   plasma_complex32_t *pA, int lda,
+                                   plasma_complex32_t beta,
+                                   plasma_complex32_t *pC, int ldc)
+{
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices, with square tiles for the triangle of C.
+    int am = transa == PlasmaNoTrans ? n : k;
+    int an = transa == PlasmaNoTrans ? k : n;
+    plasma_desc_t A;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_lapack_view_create(PlasmaComplexFloat, pA, lda,
+                                            nb, nb, am, an, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_lapack_view_create(PlasmaComplexFloat, pC, ldc,
+                                            nb, nb, n, n, &C);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pC, ldc, C, &sequence, &request);
+
+        // Update the lower triangle, and expand it.
+        if (trans == PlasmaConjTrans) {
+            plasma_omp_cherk(PlasmaLower,
+                             transa == PlasmaNoTrans ? PlasmaNoTrans
+                                                     : Plasma_ConjTrans,
+                             creal(alpha), A,
+                             creal(beta),  C,
+                             &sequence, &request);
+        }
+        else {
+            plasma_omp_csyrk(PlasmaLower,
+                             transa == PlasmaNoTrans ? PlasmaNoTrans
+                                                     : PlasmaTrans,
+                             alpha, A,
+                             beta,  C,
+                             &sequence, &request);
+        }
+        plasma_pclacpy_sym(PlasmaLower, trans, C, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(C, pC, ldc, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&C);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
 
 /***************************************************************************//**
  *
@@ -34,6 +201,63 @@
  *  alpha and beta are scalars, and A, B and C are matrices, with op( A )
  *  an m-by-k matrix, op( B ) a k-by-n matrix and C an m-by-n matrix.
  *
+ *  With the PlasmaGemmVariant PlasmaStrassenGemm, products with m, n and k
+ *  of at least PlasmaStrassenThreshold tiles use up to PlasmaStrassenLevels
+ *  levels of the Strassen-Winograd algorithm, which saves an eighth of the
+ *  flops at each level, at the price of workspace and of a weaker
+ *  normwise error bound.
+ *
+ *  With the classic algorithm, when C has fewer tiles than threads, the
+ *  inner dimension is split into up to PlasmaGemmMaxSplits parts, each
+ *  computed into its own copy of C, and the copies are added into C.
+ *
+ *  With the PlasmaGemmVariant PlasmaPackedGemm, each tile of A and B is
+ *  packed once into the format of the BLAS micro-kernels, and the packed
+ *  tiles are shared by the tile products. This requires the packed gemm
+ *  of MKL, in the real precisions; otherwise the classic algorithm is used.
+ *
+ *  With the PlasmaGemmVariant PlasmaGemm3m, in the complex precisions, each
+ *  tile of op( A ) and op( B ) is split once into its real part, its
+ *  imaginary part and their sum, and each tile product takes three real
+ *  products instead of four, at the price of a normwise, rather than
+ *  componentwise, error bound on the imaginary part. The same variant
+ *  serves the off-diagonal tiles of plasma_cherk and the trailing updates
+ *  of plasma_cpotrf and plasma_cgetrf.
+ *
+ *  With the PlasmaGemmVariant PlasmaOzakiGemm, the product is emulated by
+ *  the Ozaki scheme: each tile of op( A ) and op( B ) is split once into
+ *  PlasmaOzakiSlices slices of 8-bit integers, 7 bits of the elements
+ *  each, and the tile products are sums of integer products of slices,
+ *  exact, for the integer matrix units. 8 slices, the default, give the
+ *  accuracy of the float precision, normwise by the rows of op( A ) and
+ *  the columns of op( B ). The same variant serves the trailing updates
+ *  of plasma_cpotrf and plasma_cgetrf, splitting the tiles in each update.
+ *
+ *  With PlasmaTileStructure on, in the classic algorithm, the tiles of A
+ *  and B are tagged zero, identity or dense after their translation, and
+ *  the products by zero tiles are skipped, while those by identity tiles
+ *  are additions, for block-diagonal or otherwise sparse operands.
+ *
+ *  With PlasmaInplaceOutplace set to PlasmaNoTranslation, the tiles of A,
+ *  B and C are views of the arrays pA, pB and pC, with their leading
+ *  dimensions, and are not translated to and from the tile layout, which
+ *  saves the translations when they cost more than the tile layout saves.
+ *
+ *  With the PlasmaGemmHint PlasmaGemmHintAuto, the default, a product of
+ *  A by itself, with pB = pA, ldb = lda, m = n, op( B ) = op( A )^H or
+ *  op( A )^T, and beta = 0, is computed by plasma_cherk or plasma_csyrk on
+ *  the lower triangle of C, with half the flops, and the triangle is
+ *  copied to the upper one. With PlasmaGemmHintRankK, the caller
+ *  asserts op( B ) = op( A )^H (op( A )^T with PlasmaTrans), whatever the
+ *  array pB, which is not referenced, and, for beta != 0, C Hermitian
+ *  (symmetric) on entry. The Hermitian update needs real alpha and beta.
+ *  PlasmaGemmHintNone always takes the general algorithm. Triangular or
+ *  otherwise sparse operands are covered by PlasmaTileStructure.
+ *
+ *  With PlasmaSmallPath on, the default, a product whose m, n and k are all
+ *  at most nb is computed by a single call of the BLAS on pA, pB and pC,
+ *  without tiles or tasks, unless the Ozaki variant is selected.
+ *
  *******************************************************************************
  *
  * @param[in] transa
@@ -176,65 +400,189 @@ int plasma_cgemm(plasma_enum_t transa, plasma_enum_t transb,
     if (m == 0 || n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "cgemm", imax(imax(m, n), k), &tuning);
+
+    // Call the kernel directly for a problem of a single tile.
+    if (plasma_small_path(plasma, imax(imax(m, n), k)) &&
+        plasma_gemm_ozaki(plasma) == 0) {
+        int blas_threads =
+            plasma_blas_threads_local(plasma_num_threads(plasma));
+        core_cgemm(transa, transb,
+                   m, n, k,
+                   alpha, pA, lda,
+                          pB, ldb,
+                   beta,  pC, ldc);
+        plasma_blas_threads_local(blas_threads);
+        plasma_tuning_restore(plasma, &tuning);
+        return PlasmaSuccess;
+    }
+
+    // Route op( A ) op( A )^H to the rank-k update.
+    plasma_enum_t rank_k = plasma_cgemm_rank_k(plasma, transa, transb, m, n,
+                                               alpha, pA, lda, pB, ldb, beta);
+    if (rank_k != PlasmaNoTrans) {
+        int status = plasma_cgemm_rank_k_run(plasma, transa, rank_k, n, k,
+                                             alpha, pA, lda,
+                                             beta,  pC, ldc);
+        plasma_tuning_restore(plasma, &tuning);
+        return status;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
+    // Strassen-Winograd levels, 0 for the classic algorithm.
+    int levels = 0;
+    if (alpha != 0.0)
+        levels = plasma_strassen_levels(plasma, m, n, k, nb);
+
+    // Tile height of C and op( A ), nb unless PlasmaMb is set,
+    // in the classic algorithm only.
+    int mb = levels == 0 ? plasma_tile_mb(plasma, nb) : nb;
+
+    // Parts of the inner dimension, 1 for no split.
+    int splits = 1;
+    if (alpha != 0.0 && k > 0 && levels == 0)
+        splits = plasma_gemm_splits(plasma, (m+mb-1)/mb, (n+nb-1)/nb,
+                                    (k+nb-1)/nb);
+
     // Create tile matrices.
     plasma_desc_t A;
     plasma_desc_t B;
     plasma_desc_t C;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    retval = plasma_desc_lapack_view_create(PlasmaComplexFloat, pA, lda,
+                                            transa == PlasmaNoTrans ? mb : nb,
+                                            transa == PlasmaNoTrans ? nb : mb,
+                                            am, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    retval = plasma_desc_lapack_view_create(PlasmaComplexFloat, pB, ldb,
+                                            nb, nb, bm, bn, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_view_create() failed");
         plasma_desc_destroy(&A);
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
+    retval = plasma_desc_lapack_view_create(PlasmaComplexFloat, pC, ldc,
+                                            mb, nb, m, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_view_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
+    // Tag the zero and identity tiles of A and B, whose products are
+    // skipped, in the classic algorithm only.
+    int structure = plasma->tile_structure == PlasmaTileStructureOn &&
+                    levels == 0 && splits == 1;
+    if (structure) {
+        retval = plasma_desc_tile_structure_create(&A);
+        if (retval == PlasmaSuccess)
+            retval = plasma_desc_tile_structure_create(&B);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_tile_structure_create() failed");
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&B);
+            plasma_desc_destroy(&C);
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+    }
+
+    // Create the Strassen-Winograd workspaces.
+    plasma_desc_t W[4*PlasmaStrassenMaxLevels];
+    retval = plasma_cgemm_strassen_create(m, n, k, nb, beta, levels, W);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
+        plasma_error("plasma_cgemm_strassen_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&C);
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
+    // Create the copies of C of the split inner dimension.
+    plasma_desc_t Wk[PlasmaGemmMaxSplits];
+    for (int g = 0; g < splits-1; g++) {
+        retval = plasma_desc_general_create(PlasmaComplexFloat, mb, nb,
+                                            m, n, 0, 0, m, n, &Wk[g]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            for (int i = 0; i < g; i++)
+                plasma_desc_destroy(&Wk[i]);
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&B);
+            plasma_desc_destroy(&C);
+            plasma_cgemm_strassen_destroy(levels, W);
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_cge2desc(pB, ldb, B, sequence, &request);
-        plasma_omp_cge2desc(pC, ldc, C, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_cge2desc(pC, ldc, C, &sequence, &request);
+
+        // The tags are read as the tasks are submitted.
+        if (structure) {
+            plasma_pctile_structure(A, &sequence, &request);
+            plasma_pctile_structure(B, &sequence, &request);
+            #pragma omp taskwait
+        }
 
         // Call the tile async function.
-        plasma_omp_cgemm(transa, transb,
-                         alpha, A,
-                                B,
-                         beta,  C,
-                         sequence, &request);
+        if (levels > 0) {
+            for (int i = 0; i < 4*levels; i++) {
+                if (W[i].matrix != NULL)
+                    plasma_pclaset(PlasmaGeneral, 0.0, 0.0, W[i],
+                                   &sequence, &request);
+            }
+            plasma_pcgemm_strassen(transa, transb,
+                                   alpha, A,
+                                          B,
+                                   beta,  C,
+                                   W, levels,
+                                   &sequence, &request);
+        }
+        else if (splits > 1) {
+            plasma_pcgemm_splitk(transa, transb,
+                                 alpha, A,
+                                        B,
+                                 beta,  C,
+                                 Wk, splits,
+                                 &sequence, &request);
+        }
+        else {
+            plasma_omp_cgemm(transa, transb,
+                             alpha, A,
+                                    B,
+                             beta,  C,
+                             &sequence, &request);
+        }
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(C, pC, ldc, sequence, &request);
+        plasma_omp_cdesc2ge(C, pC, ldc, &sequence, &request);
     }
     // implicit synchronization
 
@@ -242,13 +590,60 @@ int plasma_cgemm(plasma_enum_t transa, plasma_enum_t transb,
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
     plasma_desc_destroy(&C);
+    plasma_cgemm_strassen_destroy(levels, W);
+    for (int g = 0; g < splits-1; g++)
+        plasma_desc_destroy(&Wk[g]);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
+    plasma_tuning_restore(plasma, &tuning);
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Same as plasma_cgemm(), with the parameters of the context overridden by
+ *  options for this call only.
+ *
+ *******************************************************************************
+ *
+ * @param[in] options
+ *          The options of the call, initialized by plasma_options_init().
+ *          If NULL, the parameters of the context are used.
+ *
+ ******************************************************************************/
+int plasma_cgemm_opts(plasma_enum_t transa, plasma_enum_t transb,
+                      int m, int n, int k,
+                      plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
+                                                plasma_complex32_t *pB, int ldb,
+                      plasma_complex32_t beta,  plasma_complex32_t *pC, int ldc,
+                      const plasma_options_t *options)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Override the parameters for the call.
+    plasma_options_t saved;
+    int retval = plasma_options_apply(options, &saved);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_cgemm(transa, transb,
+                          m, n, k,
+                          alpha, pA, lda,
+                                 pB, ldb,
+                          beta,  pC, ldc);
+
+    plasma_options_restore(&saved);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_gemm
@@ -286,7 +681,8 @@ int plasma_cgemm(plasma_enum_t transa, plasma_enum_t transb,
  *          The scalar beta.
  *
  * @param[in,out] C
- *          Descriptor of matrix C.
+ *          Descriptor of matrix C. If C is block-sparse, its pattern
+ *          holds the tiles of op(A)*op(B), see plasma_desc_sparse_create.
  *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
@@ -355,6 +751,12 @@ void plasma_omp_cgemm(plasma_enum_t transa, plasma_enum_t transb,
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
         return;
     }
+    if (C.layout == PlasmaSparseLayout &&
+        !plasma_desc_sparse_product(transa, transb, A, B, C)) {
+        plasma_error("pattern of C without the tiles of the product");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
     if (sequence == NULL) {
         plasma_error("NULL sequence");
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
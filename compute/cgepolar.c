@@ -0,0 +1,443 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgepolar.c, normal z -> c, Thu Oct 15 11:00:48 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// the maximum number of iterations, 6 at most in exact arithmetic
+// for a lower bound of the smallest singular value of at least 1e-16
+#define PLASMA_GEPOLAR_MAXITER 20
+
+// the weight c from which an iteration is computed by QR,
+// below which the Cholesky factor of I + c X^H X is safe
+#define PLASMA_GEPOLAR_QR_WEIGHT 100.0
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesvd
+ *
+ *  Computes the polar decomposition of a complex m-by-n matrix A, m >= n,
+ *  of full column rank,
+ *    \f[ A = U_p H, \f]
+ *  where U_p has n orthonormal columns and H is n-by-n Hermitian positive
+ *  definite, by the QR-based dynamically weighted Halley iteration (QDWH)
+ *  of Nakatsukasa, Bai and Gygi.
+ *
+ *  From X_0 = A/alpha, with alpha = ||A||_F, and a lower bound l_0 of the
+ *  smallest singular value of X_0, the iteration
+ *    \f[ X_{k+1} = \frac{b_k}{c_k} X_k
+ *                + \left( a_k - \frac{b_k}{c_k} \right)
+ *                  X_k (I + c_k X_k^H X_k)^{-1}, \f]
+ *  with the weights a_k, b_k, c_k maximizing the smallest singular value
+ *  l_{k+1} of X_{k+1}, converges to U_p in at most 6 iterations. While
+ *  c_k > 100, the inverse is applied by the QR factorization of
+ *  [sqrtf(c_k) X_k; I], the rest of the iterations, the well conditioned
+ *  ones, by the Cholesky factor of I + c_k X_k^H X_k, at a third of the
+ *  flops. Either way, an iteration is made of the geqrf, ungqr, gemm or
+ *  herk, potrf and trsm tile routines. l_0 is 1/||R^{-1}||_F, for R the
+ *  triangular factor of X_0. Then H = U_p^H A, made Hermitian.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. 0 <= n <= m.
+ *
+ * @param[in,out] pA
+ *          On entry, the m-by-n matrix A.
+ *          On exit, the m-by-n polar factor U_p.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] pH
+ *          On exit, the n-by-n Hermitian factor H.
+ *
+ * @param[in] ldh
+ *          The leading dimension of the array H. ldh >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if the iteration failed to converge
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cgesvd
+ * @sa plasma_cheev
+ * @sa plasma_cgepolar
+ * @sa plasma_dgepolar
+ * @sa plasma_sgepolar
+ *
+ ******************************************************************************/
+int plasma_cgepolar(int m, int n,
+                    plasma_complex32_t *pA, int lda,
+                    plasma_complex32_t *pH, int ldh)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0 || n > m) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldh < imax(1, n)) {
+        plasma_error("illegal value of ldh");
+        return -6;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // [sqrtf(c) X; 0; I] is factored with its identity block starting
+    // on a tile boundary.
+    int mpad = ((m+nb-1)/nb)*nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t X;
+    plasma_desc_t Xold;
+    plasma_desc_t W;
+    plasma_desc_t Q;
+    plasma_desc_t Z;
+    plasma_desc_t H;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        m, n, 0, 0, m, n, &X);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        m, n, 0, 0, m, n, &Xold);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        mpad+n, n, 0, 0, mpad+n, n, &W);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        mpad+n, n, 0, 0, mpad+n, n, &Q);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &Z);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        plasma_desc_destroy(&Q);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &H);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&Z);
+        return retval;
+    }
+
+    // the blocks of [sqrtf(c) X; 0; I] and of its Q factor [Q1; 0; Q2]
+    plasma_desc_t Wx = plasma_desc_view(W, 0, 0, m, n);
+    plasma_desc_t Wi = plasma_desc_view(W, mpad, 0, n, n);
+    plasma_desc_t Wr = plasma_desc_view(W, 0, 0, n, n);
+    plasma_desc_t Q1 = plasma_desc_view(Q, 0, 0, m, n);
+    plasma_desc_t Q2 = plasma_desc_view(Q, mpad, 0, n, n);
+
+    // Prepare descriptor T.
+    plasma_desc_t T;
+    int householder_mode = plasma_householder_mode(plasma, W.mt, W.nt);
+    retval = plasma_descT_compact_create(W, ib, householder_mode,
+                                         PlasmaColumnwise, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&Z);
+        plasma_desc_destroy(&H);
+        return retval;
+    }
+
+    // Allocate workspaces.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work, unmqr: work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&Z);
+        plasma_desc_destroy(&H);
+        plasma_desc_destroy(&T);
+        return retval;
+    }
+    float *lwork_ge =
+        (float*)malloc(((size_t)2*X.mt*X.nt)*sizeof(float));
+    float *lwork_tr = (float*)calloc((size_t)2*Z.mt*Z.nt, sizeof(float));
+    if (lwork_ge == NULL || lwork_tr == NULL) {
+        plasma_error("malloc() failed");
+        free(lwork_ge);
+        free(lwork_tr);
+        plasma_workspace_destroy(&work);
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Xold);
+        plasma_desc_destroy(&W);
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&Z);
+        plasma_desc_destroy(&H);
+        plasma_desc_destroy(&T);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequences.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+    plasma_sequence_t estimate = PlasmaSequenceInitializer;
+
+    // Initialize requests.
+    plasma_request_t request = PlasmaRequestInitializer;
+    plasma_request_t estimate_request = PlasmaRequestInitializer;
+
+    float alpha = 0.0;
+    float rinv = 0.0;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // alpha = ||A||_F
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_clange(PlasmaFrobeniusNorm, A, lwork_ge, &alpha,
+                          &sequence, &request);
+    }
+    // implicit synchronization
+
+    float eps = LAPACKE_slamch_work('e');
+    float l = eps;
+    if (sequence.status == PlasmaSuccess && alpha > 0.0) {
+        // asynchronous block
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            // X_0 = A/alpha, and its R factor
+            plasma_omp_clacpy(PlasmaGeneral, A, X, &sequence, &request);
+            plasma_omp_clascl(PlasmaGeneral, alpha, 1.0, X,
+                              &sequence, &request);
+            plasma_omp_claset(PlasmaGeneral, 0.0, 0.0, W,
+                              &sequence, &request);
+            plasma_omp_clacpy(PlasmaGeneral, X, Wx, &sequence, &request);
+            plasma_omp_cgeqrf(W, T, work, &sequence, &request);
+
+            // ||R^{-1}||_F, in a sequence of its own, as R is singular
+            // for A rank deficient.
+            plasma_omp_clacpy(PlasmaUpper, Wr, Z,
+                              &estimate, &estimate_request);
+            plasma_omp_ctrtri(PlasmaUpper, PlasmaNonUnit, Z,
+                              &estimate, &estimate_request);
+            plasma_omp_clantr(PlasmaFrobeniusNorm, PlasmaUpper,
+                              PlasmaNonUnit, Z, lwork_tr, &rinv,
+                              &estimate, &estimate_request);
+        }
+        // implicit synchronization
+
+        // l_0 = 1/||R^{-1}||_F <= 1/||R^{-1}||_2, the smallest singular
+        // value of X_0, else the smallest sensible bound.
+        if (estimate.status == PlasmaSuccess && rinv > 0.0)
+            l = fmin(1.0, fmax(eps, 1.0/rinv));
+    }
+    else if (sequence.status == PlasmaSuccess) {
+        // A = 0 = U_p 0, with U_p the first n columns of the identity.
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_claset(PlasmaGeneral, 0.0, 1.0, X,
+                              &sequence, &request);
+        }
+        // implicit synchronization
+    }
+
+    // dynamically weighted Halley iterations
+    float tol = cbrt(5.0*eps);
+    float diff = 2.0*tol;
+    int iter = 0;
+    while (sequence.status == PlasmaSuccess && alpha > 0.0 &&
+           (diff > tol || fabsf(1.0-l) > 5.0*eps)) {
+        if (iter == PLASMA_GEPOLAR_MAXITER) {
+            plasma_request_fail(&sequence, &request, 1);
+            break;
+        }
+
+        // weights of the iteration, and the bound of its
+        // smallest singular value
+        float l2 = l*l;
+        float d = cbrt(4.0*(1.0-l2)/(l2*l2));
+        float sqd = sqrtf(1.0+d);
+        float a = sqd + 0.5*sqrtf(8.0 - 4.0*d + 8.0*(2.0-l2)/(l2*sqd));
+        float b = (a-1.0)*(a-1.0)/4.0;
+        float c = a+b-1.0;
+        l = fmin(1.0, l*(a+b*l2)/(1.0+c*l2));
+
+        // asynchronous block
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_clacpy(PlasmaGeneral, X, Xold, &sequence, &request);
+            if (c > PLASMA_GEPOLAR_QR_WEIGHT) {
+                // [sqrtf(c) X; I] = [Q1; Q2] R,
+                // X = b/c X + 1/sqrtf(c) (a - b/c) Q1 Q2^H
+                plasma_omp_claset(PlasmaGeneral, 0.0, 0.0, W,
+                                  &sequence, &request);
+                plasma_omp_clacpy(PlasmaGeneral, X, Wx, &sequence, &request);
+                plasma_omp_clascl(PlasmaGeneral, 1.0, sqrtf(c), Wx,
+                                  &sequence, &request);
+                plasma_omp_claset(PlasmaGeneral, 0.0, 1.0, Wi,
+                                  &sequence, &request);
+                plasma_omp_cgeqrf(W, T, work, &sequence, &request);
+                plasma_omp_cungqr(W, T, Q, work, &sequence, &request);
+                plasma_omp_cgemm(PlasmaNoTrans, Plasma_ConjTrans,
+                                 (a-b/c)/sqrtf(c), Q1, Q2, b/c, X,
+                                 &sequence, &request);
+            }
+            else {
+                // Z = I + c X^H X = R^H R,
+                // X = b/c X + (a - b/c) X R^{-1} R^{-H}, in Q1
+                plasma_omp_claset(PlasmaGeneral, 0.0, 1.0, Z,
+                                  &sequence, &request);
+                plasma_omp_cherk(PlasmaUpper, Plasma_ConjTrans,
+                                 c, X, 1.0, Z, &sequence, &request);
+                plasma_omp_cpotrf(PlasmaUpper, Z, &sequence, &request);
+                plasma_omp_clacpy(PlasmaGeneral, X, Q1, &sequence, &request);
+                plasma_omp_ctrsm(PlasmaRight, PlasmaUpper,
+                                 PlasmaNoTrans, PlasmaNonUnit,
+                                 1.0, Z, Q1, &sequence, &request);
+                plasma_omp_ctrsm(PlasmaRight, PlasmaUpper,
+                                 Plasma_ConjTrans, PlasmaNonUnit,
+                                 1.0, Z, Q1, &sequence, &request);
+                plasma_omp_cgeadd(PlasmaNoTrans, a-b/c, Q1, b/c, X,
+                                  &sequence, &request);
+            }
+
+            // ||X_{k+1} - X_k||_F
+            plasma_omp_cgeadd(PlasmaNoTrans, -1.0, X, 1.0, Xold,
+                              &sequence, &request);
+            plasma_omp_clange(PlasmaFrobeniusNorm, Xold, lwork_ge, &diff,
+                              &sequence, &request);
+        }
+        // implicit synchronization
+
+        iter++;
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // H = (U_p^H A + A^H U_p)/2
+        plasma_omp_cgemm(Plasma_ConjTrans, PlasmaNoTrans,
+                         1.0, X, A, 0.0, Z, &sequence, &request);
+        plasma_omp_clacpy(PlasmaGeneral, Z, H, &sequence, &request);
+        plasma_omp_cgeadd(Plasma_ConjTrans, 0.5, Z, 0.5, H,
+                          &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(X, pA, lda, &sequence, &request);
+        plasma_omp_cdesc2ge(H, pH, ldh, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices and workspaces.
+    free(lwork_ge);
+    free(lwork_tr);
+    plasma_workspace_destroy(&work);
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&X);
+    plasma_desc_destroy(&Xold);
+    plasma_desc_destroy(&W);
+    plasma_desc_destroy(&Q);
+    plasma_desc_destroy(&Z);
+    plasma_desc_destroy(&H);
+    plasma_desc_destroy(&T);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
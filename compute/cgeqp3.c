@@ -0,0 +1,280 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgeqp3.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqp3
+ *
+ *  Computes a tile QR factorization with column pivoting of a real or
+ *  complex m-by-n matrix A,
+ *    \f[ A P = Q \times R, \f]
+ *  where P is a permutation matrix, Q is a matrix with orthonormal columns
+ *  and R is upper triangular.
+ *
+ *  The pivots of each panel of nb columns are chosen by tournament pivoting:
+ *  the candidates of the tile columns are reduced pairwise by the column
+ *  pivoted QR of LAPACK on 2*nb columns, along the tile QR reduction tree.
+ *  The factorization then proceeds by the tile QR kernels, so that it is
+ *  rank revealing like LAPACK cgeqp3, with most of its flops in BLAS-3
+ *  tile tasks.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, pointer to the m-by-n matrix A.
+ *          On exit, the elements on and above the diagonal of the array contain
+ *          the min(m,n)-by-n upper trapezoidal matrix R; the elements below
+ *          the diagonal represent the unitary matrix Q as a product of
+ *          elementary reflectors stored by tiles.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] jpvt
+ *          The permutation P, of size n: on exit, the column j of A P was
+ *          the column jpvt(j) of A, for 1 <= j <= n. Unlike LAPACK, it is not
+ *          read on entry, and all columns are free.
+ *
+ * @param[out] T
+ *          On exit, auxiliary factorization data of the flat tile QR
+ *          factorization, to apply Q by plasma_cunmqr or to generate it by
+ *          plasma_cungqr in the PlasmaFlatHouseholder mode.
+ *          Matrix in T is allocated inside this function and needs to be
+ *          destroyed by plasma_desc_destroy.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cgeqp3
+ * @sa plasma_cgeqp3
+ * @sa plasma_dgeqp3
+ * @sa plasma_sgeqp3
+ * @sa plasma_cgeqrf
+ *
+ ******************************************************************************/
+int plasma_cgeqp3(int m, int n,
+                  plasma_complex32_t *pA, int lda, int *jpvt,
+                  plasma_desc_t *T)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (jpvt == NULL && n > 0) {
+        plasma_error("NULL jpvt");
+        return -5;
+    }
+
+    // quick return
+    if (imin(m, n) == 0) {
+        for (int j = 0; j < n; j++)
+            jpvt[j] = j+1;
+        return PlasmaSuccess;
+    }
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Prepare descriptor T.
+    retval = plasma_descT_compact_create(A, ib, PlasmaFlatHouseholder,
+                                         PlasmaColumnwise, T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cgeqp3(A, jpvt, *T, work, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqp3
+ *
+ *  Computes a tile QR factorization with column pivoting of a matrix.
+ *  Non-blocking tile version of plasma_cgeqp3().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A.
+ *          A is stored in the tile layout.
+ *
+ * @param[out] jpvt
+ *          The permutation P, of size A.n, as in plasma_cgeqp3.
+ *
+ * @param[out] T
+ *          Descriptor of matrix T, created for the PlasmaFlatHouseholder
+ *          mode. On exit, auxiliary factorization data.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          For QR factorization, contains preallocated space for tau and work
+ *          arrays. Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cgeqp3
+ * @sa plasma_omp_cgeqp3
+ * @sa plasma_omp_dgeqp3
+ * @sa plasma_omp_sgeqp3
+ *
+ ******************************************************************************/
+void plasma_omp_cgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (jpvt == NULL) {
+        plasma_error("NULL jpvt");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(A.m, A.n) == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pcgeqp3(A, jpvt, T, work, sequence, request);
+}
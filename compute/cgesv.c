@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgesv.c, normal z -> c, Mon Feb  6 14:06:31 2017
+ * @generated from compute/zgesv.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -57,6 +57,7 @@ int plasma_cgesv(int n, int nrhs,
 
     // Set tiling parameters.
     int nb = plasma->nb;
+    int nbrhs = plasma_tile_rhs_nb(plasma, nb, nrhs);
 
     // Initialize barrier.
     int num_panel_threads = plasma->num_panel_threads;
@@ -66,60 +67,56 @@ int plasma_cgesv(int n, int nrhs,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_lapack_create(PlasmaComplexFloat, pA, lda, nb, nb,
+                                       n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_lapack_create(PlasmaComplexFloat, pB, ldb, nb, nbrhs,
+                                       n, nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
-    #pragma omp parallel
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
-        // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_cge2desc(pB, ldb, B, sequence, &request);
-    }
+        // Translate to tile layout by tile columns,
+        // so that the factorization starts as soon as the first column is in.
+        plasma_pcge2desc_colwise(pA, lda, A, &sequence, &request);
+        plasma_pcge2desc_colwise(pB, ldb, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function.
-        plasma_omp_cgesv(A, ipiv, B, sequence, &request);
-    }
+        // Factor A.
+        plasma_omp_cgetrf(A, ipiv, &sequence, &request);
+
+        // The solve depends on all the pivots and the left pivoting of L.
+        #pragma omp taskwait
+
+        // Solve for B.
+        plasma_omp_cgetrs(A, ipiv, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_cdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
     }
+    // implicit synchronization
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -164,18 +161,6 @@ void plasma_omp_cgesv(plasma_desc_t A, int *ipiv,
     if (A.n == 0 || B.n == 0)
         return;
 
-    // Call the parallel functions.
-    plasma_pcgetrf(A, ipiv, sequence, request);
-
-    plasma_pclaswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
-
-    plasma_pctrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
-                  1.0, A,
-                       B,
-                  sequence, request);
-
-    plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
-                  1.0, A,
-                       B,
-                  sequence, request);
+    // Call the parallel function.
+    plasma_pcgesv(A, ipiv, B, sequence, request);
 }
@@ -0,0 +1,268 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrs_incpiv.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs_incpiv
+ *
+ *  Solves a system of linear equations A * X = B with the tile LU
+ *  factorization with incremental pivoting of the n-by-n matrix A,
+ *  computed by plasma_cgetrf_incpiv.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of
+ *          columns of the matrix B. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          The factors of A computed by plasma_cgetrf_incpiv.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] L
+ *          The blocks of the factors L computed by plasma_cgetrf_incpiv.
+ *
+ * @param[in] ipiv
+ *          The pivot indices computed by plasma_cgetrf_incpiv.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cgetrs_incpiv
+ * @sa plasma_cgetrs_incpiv
+ * @sa plasma_dgetrs_incpiv
+ * @sa plasma_sgetrs_incpiv
+ * @sa plasma_cgetrf_incpiv
+ *
+ ******************************************************************************/
+int plasma_cgetrs_incpiv(int n, int nrhs,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        return -6;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -8;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters, which must be those of the factorization.
+    int nb = L.nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cgetrs_incpiv(A, L, ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs_incpiv
+ *
+ *  Solves a system of linear equations with the tile LU factorization
+ *  with incremental pivoting.
+ *  Non-blocking tile version of plasma_cgetrs_incpiv().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *          Descriptor of the factors computed by plasma_omp_cgetrf_incpiv.
+ *
+ * @param[in] L
+ *          Descriptor of the blocks of the factors L.
+ *
+ * @param[in] ipiv
+ *          The pivot indices computed by plasma_omp_cgetrf_incpiv.
+ *
+ * @param[in,out] B
+ *          Descriptor of the right hand sides B, overwritten by
+ *          the solution X.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cgetrs_incpiv
+ * @sa plasma_omp_cgetrs_incpiv
+ * @sa plasma_omp_dgetrs_incpiv
+ * @sa plasma_omp_sgetrs_incpiv
+ * @sa plasma_omp_cgetrf_incpiv
+ *
+ ******************************************************************************/
+void plasma_omp_cgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(L) != PlasmaSuccess) {
+        plasma_error("invalid L");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Call the parallel functions.
+    plasma_pctrsmpl(A, L, ipiv, B, sequence, request);
+
+    plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zherk.c, normal z -> c, Mon Feb  6 14:06:34 2017
+ * @generated from compute/zherk.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -151,41 +151,37 @@ int plasma_cherk(plasma_enum_t uplo, plasma_enum_t trans,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        n, n, 0, 0, n, n, &C);
+    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_triangular_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_cge2desc(pC, ldc, C, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pC, ldc, C, &sequence, &request);
 
         // Call the tile async function.
         plasma_omp_cherk(uplo, trans,
                          alpha, A,
                          beta,  C,
-                         sequence, &request);
+                         &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(C, pC, ldc, sequence, &request);
+        plasma_omp_cdesc2ge(C, pC, ldc, &sequence, &request);
     }
     // implicit synchronization
 
@@ -194,8 +190,7 @@ int plasma_cherk(plasma_enum_t uplo, plasma_enum_t trans,
     plasma_desc_destroy(&C);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
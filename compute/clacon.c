@@ -0,0 +1,294 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zlacon.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+static plasma_complex32_t plasma_clacon_sign(plasma_complex32_t z)
+{
+    float a = cabsf(z);
+    return a == 0.0 ? 1.0 : z/a;
+}
+
+/***************************************************************************//**
+ *  Solves op(A) X = X in place, by the tile triangular solves with the
+ *  factors of A, where X is in LAPACK layout with leading dimension A.n.
+ **/
+static void plasma_clacon_solve(plasma_enum_t uplo, plasma_enum_t trans,
+                                plasma_desc_t A,
+                                plasma_complex32_t *pX, plasma_desc_t X,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_cge2desc(pX, A.n, X, sequence, request);
+
+        if (uplo == PlasmaGeneral) {
+            // A = P L U, and P does not change the one norm of A^{-1}.
+            if (trans == PlasmaNoTrans) {
+                plasma_pctrsm(PlasmaLeft, PlasmaLower,
+                              PlasmaNoTrans, PlasmaUnit,
+                              1.0, A, X, sequence, request);
+                plasma_pctrsm(PlasmaLeft, PlasmaUpper,
+                              PlasmaNoTrans, PlasmaNonUnit,
+                              1.0, A, X, sequence, request);
+            }
+            else {
+                plasma_pctrsm(PlasmaLeft, PlasmaUpper,
+                              Plasma_ConjTrans, PlasmaNonUnit,
+                              1.0, A, X, sequence, request);
+                plasma_pctrsm(PlasmaLeft, PlasmaLower,
+                              Plasma_ConjTrans, PlasmaUnit,
+                              1.0, A, X, sequence, request);
+            }
+        }
+        else if (uplo == PlasmaLower) {
+            // A = L L^H
+            plasma_pctrsm(PlasmaLeft, PlasmaLower,
+                          PlasmaNoTrans, PlasmaNonUnit,
+                          1.0, A, X, sequence, request);
+            plasma_pctrsm(PlasmaLeft, PlasmaLower,
+                          Plasma_ConjTrans, PlasmaNonUnit,
+                          1.0, A, X, sequence, request);
+        }
+        else {
+            // A = U^H U
+            plasma_pctrsm(PlasmaLeft, PlasmaUpper,
+                          Plasma_ConjTrans, PlasmaNonUnit,
+                          1.0, A, X, sequence, request);
+            plasma_pctrsm(PlasmaLeft, PlasmaUpper,
+                          PlasmaNoTrans, PlasmaNonUnit,
+                          1.0, A, X, sequence, request);
+        }
+
+        plasma_omp_cdesc2ge(X, pX, A.n, sequence, request);
+    }
+    // implicit synchronization
+}
+
+/***************************************************************************//**
+ *  Estimates the one norm of op(A)^{-1} from the factors of A in tile
+ *  layout, by the block estimator of Higham and Tisseur: a block of t
+ *  vectors is iterated by the tile triangular solves, so each step is
+ *  a matrix solve rather than the vector solves of LAPACK zlacn2. As
+ *  cgecon, the estimate is the larger of that and the norm from a vector
+ *  of alternating signs.
+ *
+ * @param[in] uplo
+ *          - PlasmaGeneral: A holds the LU factors of plasma_cgetrf.
+ *          - PlasmaLower:   A holds the Cholesky factor L of plasma_cpotrf.
+ *          - PlasmaUpper:   A holds the Cholesky factor U of plasma_cpotrf.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:   estimate the one norm of A^{-1},
+ *          - Plasma_ConjTrans: estimate the one norm of A^{-H}, that is,
+ *                             the infinity norm of A^{-1}.
+ *
+ * @param[in] A
+ *          Descriptor of the factors of A.
+ *
+ * @param[out] est
+ *          The estimate, a lower bound of the norm.
+ *
+ * @retval PlasmaSuccess successful exit
+ ******************************************************************************/
+int plasma_clacon(plasma_enum_t uplo, plasma_enum_t trans,
+                  plasma_desc_t A, float *est)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    int n = A.n;
+    *est = 0.0;
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // A few vectors are enough for estimates mostly within a factor of 3,
+    // and the number of steps is limited as in LAPACK.
+    int t = imin(4, n);
+    int itmax = 5;
+
+    plasma_enum_t transh =
+        trans == PlasmaNoTrans ? Plasma_ConjTrans : PlasmaNoTrans;
+
+    // Create the block of vectors in tile layout.
+    plasma_desc_t X;
+    plasma_desc_t X1;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, A.mb, A.nb,
+                                        n, t, 0, 0, n, t, &X);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, A.mb, A.nb,
+                                        n, 1, 0, 0, n, 1, &X1);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Allocate the vectors in LAPACK layout and the index workspaces.
+    plasma_complex32_t *pX = (plasma_complex32_t*)malloc(
+        (size_t)n*t*sizeof(plasma_complex32_t));
+    float *h = (float*)malloc((size_t)2*n*sizeof(float));
+    int *hist = (int*)calloc((size_t)n, sizeof(int));
+    int *ind = (int*)malloc((size_t)t*sizeof(int));
+    if (pX == NULL || h == NULL || hist == NULL || ind == NULL) {
+        plasma_error("malloc() failed");
+        free(pX);
+        free(h);
+        free(hist);
+        free(ind);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&X1);
+        return PlasmaErrorOutOfMemory;
+    }
+    float *w = &h[n];
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // X = [ones, random signs] / n
+    for (int i = 0; i < n; i++)
+        pX[i] = 1.0/n;
+    if (t > 1) {
+        int seed[] = {0, 0, 0, 1};
+        LAPACKE_clarnv_work(2, seed, (size_t)n*(t-1), &pX[n]);
+        for (int i = n; i < n*t; i++)
+            pX[i] = plasma_clacon_sign(pX[i])/n;
+    }
+    for (int j = 0; j < t; j++)
+        ind[j] = -1;
+
+    float est_old = 0.0;
+    int ind_best = -1;
+    for (int k = 0; k < itmax; k++) {
+        // Y = op(A)^{-1} X, and the largest column norm of Y.
+        plasma_clacon_solve(uplo, trans, A, pX, X, &sequence, &request);
+        if (sequence.status != PlasmaSuccess)
+            break;
+
+        int jbest = 0;
+        float est_k = 0.0;
+        for (int j = 0; j < t; j++) {
+            float s = 0.0;
+            for (int i = 0; i < n; i++)
+                s += cabsf(pX[i + (size_t)j*n]);
+            if (s > est_k) {
+                est_k = s;
+                jbest = j;
+            }
+        }
+        if (k > 0 && est_k <= est_old)
+            break;
+        est_old = est_k;
+        if (k > 0)
+            ind_best = ind[jbest];
+        if (k == itmax-1)
+            break;
+
+        // Z = op(A)^{-H} sign(Y), and the largest entry of each row of Z.
+        for (int i = 0; i < n*t; i++)
+            pX[i] = plasma_clacon_sign(pX[i]);
+        plasma_clacon_solve(uplo, transh, A, pX, X, &sequence, &request);
+        if (sequence.status != PlasmaSuccess)
+            break;
+
+        float hmax = 0.0;
+        for (int i = 0; i < n; i++) {
+            h[i] = 0.0;
+            for (int j = 0; j < t; j++)
+                h[i] = fmax(h[i], cabsf(pX[i + (size_t)j*n]));
+            hmax = fmax(hmax, h[i]);
+        }
+        if (ind_best >= 0 && hmax == h[ind_best])
+            break;
+
+        // Stop if the t largest entries of h were all visited.
+        int visited = 1;
+        for (int i = 0; i < n; i++)
+            w[i] = h[i];
+        for (int j = 0; j < t; j++) {
+            int imax = 0;
+            for (int i = 1; i < n; i++)
+                if (w[i] > w[imax])
+                    imax = i;
+            visited = visited && hist[imax];
+            w[imax] = -1.0;
+        }
+        if (visited)
+            break;
+
+        // X = unit vectors of the t largest entries of h not visited.
+        for (int i = 0; i < n*t; i++)
+            pX[i] = 0.0;
+        for (int j = 0; j < t; j++) {
+            int imax = -1;
+            for (int i = 0; i < n; i++)
+                if (!hist[i] && (imax < 0 || h[i] > h[imax]))
+                    imax = i;
+            ind[j] = imax;
+            if (imax < 0)
+                continue;
+            hist[imax] = 1;
+            pX[imax + (size_t)j*n] = 1.0;
+        }
+    }
+
+    // x(i) = (-1)^i (1 + i/(n-1)), and 2*||op(A)^{-1} x||_1 / (3*n).
+    if (sequence.status == PlasmaSuccess) {
+        for (int i = 0; i < n; i++)
+            pX[i] = (i%2 == 0 ? 1.0 : -1.0) *
+                    (n > 1 ? 1.0 + (float)i/(n-1) : 1.0);
+        plasma_clacon_solve(uplo, trans, A, pX, X1, &sequence, &request);
+
+        float s = 0.0;
+        for (int i = 0; i < n; i++)
+            s += cabsf(pX[i]);
+        *est = fmax(est_old, 2.0*s/(3.0*n));
+    }
+
+    // Free matrices.
+    free(pX);
+    free(h);
+    free(hist);
+    free(ind);
+    plasma_desc_destroy(&X);
+    plasma_desc_destroy(&X1);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -109,31 +109,27 @@ int plasma_clag2z(int m, int n,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pAs, ldas, As, sequence, &request);
-        plasma_omp_zge2desc(pA,  lda,  A,  sequence, &request);
+        plasma_omp_cge2desc(pAs, ldas, As, &sequence, &request);
+        plasma_omp_zge2desc(pA,  lda,  A,  &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_clag2z(As, A, sequence, &request);
+        plasma_omp_clag2z(As, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(As, pAs, ldas, sequence, &request);
-        plasma_omp_zdesc2ge(A,  pA,  lda,  sequence, &request);
+        plasma_omp_cdesc2ge(As, pAs, ldas, &sequence, &request);
+        plasma_omp_zdesc2ge(A,  pA,  lda,  &sequence, &request);
     }
     // implicit synchronization
 
@@ -142,8 +138,7 @@ int plasma_clag2z(int m, int n,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
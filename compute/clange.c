@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlange.c, normal z -> c, Mon Feb  6 14:06:34 2017
+ * @generated from compute/zlange.c, normal z -> c, Thu Oct 15 11:00:48 2026
  *
  **/
 
@@ -124,7 +124,7 @@ float plasma_clange(plasma_enum_t norm,
     float *work = NULL;
     switch (norm) {
     case PlasmaMaxNorm:
-        work = (float*)malloc((size_t)A.mt*A.nt*sizeof(float));
+        work = (float*)malloc(((size_t)A.mt*A.nt)*sizeof(float));
         break;
     case PlasmaOneNorm:
         work = (float*)malloc(((size_t)A.mt*A.n+A.n)*sizeof(float));
@@ -133,7 +133,7 @@ float plasma_clange(plasma_enum_t norm,
         work = (float*)malloc(((size_t)A.nt*A.m+A.m)*sizeof(float));
         break;
     case PlasmaFrobeniusNorm:
-        work = (float*)malloc((size_t)2*A.mt*A.nt*sizeof(float));
+        work = (float*)malloc(((size_t)2*A.mt*A.nt)*sizeof(float));
         break;
     }
     if (work == NULL) {
@@ -141,13 +141,8 @@ float plasma_clange(plasma_enum_t norm,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
@@ -155,14 +150,15 @@ float plasma_clange(plasma_enum_t norm,
     float value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_clange(norm, A, work, &value, sequence, &request);
+        plasma_omp_clange(norm, A, work, &value, &sequence, &request);
     }
     // implicit synchronization
 
@@ -171,9 +167,6 @@ float plasma_clange(plasma_enum_t norm,
     // Free matrix in tile layout.
     plasma_desc_destroy(&A);
 
-    // Destroy sequence.
-    plasma_sequence_destroy(sequence);
-
     // Return the norm.
     return value;
 }
@@ -197,7 +190,8 @@ float plasma_clange(plasma_enum_t norm,
  *          - PlasmaFrobeniusNorm: Frobenius norm
  *
  * @param[in] A
- *          The descriptor of matrix A.
+ *          The descriptor of matrix A, whose tiles may be packed
+ *          (plasma_desc_general_packed_create).
  *
  * @param[out] work
  *          Workspace of size:
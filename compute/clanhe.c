@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlanhe.c, normal z -> c, Mon Feb  6 14:06:34 2017
+ * @generated from compute/zlanhe.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -142,13 +142,8 @@ float plasma_clanhe(plasma_enum_t norm, plasma_enum_t uplo,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
@@ -156,14 +151,15 @@ float plasma_clanhe(plasma_enum_t norm, plasma_enum_t uplo,
     float value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_clanhe(norm, uplo, A, work, &value, sequence, &request);
+        plasma_omp_clanhe(norm, uplo, A, work, &value, &sequence, &request);
     }
     // implicit synchronization
 
@@ -172,9 +168,6 @@ float plasma_clanhe(plasma_enum_t norm, plasma_enum_t uplo,
     // Free matrix in tile layout.
     plasma_desc_destroy(&A);
 
-    // Destroy sequence.
-    plasma_sequence_destroy(sequence);
-
     // Return the norm.
     return value;
 }
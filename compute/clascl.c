@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlascl.c, normal z -> c, Mon Feb  6 14:06:36 2017
+ * @generated from compute/zlascl.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -77,29 +77,25 @@ int plasma_clascl(plasma_enum_t uplo,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_clascl(uplo, cfrom, cto, A, sequence, &request);
+        plasma_omp_clascl(uplo, cfrom, cto, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
@@ -107,8 +103,7 @@ int plasma_clascl(plasma_enum_t uplo,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlauum.c, normal z -> c, Mon Feb  6 14:06:37 2017
+ * @generated from compute/zlauum.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -96,35 +96,31 @@ int plasma_clauum(plasma_enum_t uplo, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
-    }
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
+        plasma_error("plasma_desc_triangular_create() failed");
         return retval;
     }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block.
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_clauum(uplo, A, sequence, &request);
+        plasma_omp_clauum(uplo, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
     }
         // Implicit synchronization.
 
@@ -132,8 +128,7 @@ int plasma_clauum(plasma_enum_t uplo, int n,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -0,0 +1,332 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zlrpotrf.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <math.h>
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the tile low-rank Cholesky factorization of a Hermitian positive
+ *  definite matrix A,
+ *
+ *    \f[ A = L \times L^H, \f]
+ *
+ *  where L is a lower triangular matrix, from the lower triangle of A.
+ *
+ *  Each off-diagonal tile A_ij is compressed as U*V^H, of the singular
+ *  values of A_ij above
+ *
+ *    \f[ tol \times \|A\|_F / nt, \f]
+ *
+ *  where nt is the number of tile columns, and stays compressed through
+ *  the updates of the factorization, which recompress it at the same
+ *  tolerance. The factors of a tile of rank k take k*(mb+nb) elements of
+ *  its storage, in place of mb*nb, and its updates cost flops in
+ *  proportion to the ranks. A tile of too large a rank stays dense. For
+ *  data-sparse matrices, such as the covariance matrices of spatial
+ *  statistics, most of the far tiles are of small ranks.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the Hermitian positive definite matrix A, of which
+ *          the leading n-by-n lower triangular part is referenced.
+ *          On exit, if return value = 0, the factor L from the Cholesky
+ *          factorization A = L*L^H, within the tolerance.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] tol
+ *          The accuracy of the compression, relative to the norm of A.
+ *          tol >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite, so the factorization could not
+ *          be completed, and the solution has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_clrpotrf
+ * @sa plasma_zcpotrf
+ * @sa plasma_cpotrf
+ *
+ ******************************************************************************/
+int plasma_clrpotrf(int n, plasma_complex32_t *pA, int lda, float tol)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -3;
+    }
+    if (tol < 0.0) {
+        plasma_error("illegal value of tol");
+        return -4;
+    }
+
+    // quick return
+    if (imax(n, 0) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix with the ranks of its tiles.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_tile_lrank_create(&A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_tile_lrank_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Allocate workspaces.
+    plasma_workspace_t work;
+    retval = plasma_workspace_create(&work, (size_t)9*nb*nb + 3*nb,
+                                     PlasmaComplexFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    float *norms = (float*)malloc((size_t)A.mt*A.nt*sizeof(float));
+    if (norms == NULL) {
+        plasma_error("malloc() failed");
+        plasma_workspace_destroy(&work);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_clrpotrf(A, tol, work, norms, &sequence, &request);
+
+        // Expand the compressed tiles.
+        for (int j = 0; j < A.nt; j++) {
+            int nvaj = plasma_tile_nview(A, j);
+            for (int i = j+1; i < A.mt; i++) {
+                core_omp_clrdecompress(
+                    plasma_tile_mview(A, i), nvaj,
+                    A(i, j), plasma_tile_mmain(A, i),
+                    plasma_tile_lrank(A, i, j),
+                    work,
+                    &sequence, &request);
+            }
+        }
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout and the workspaces.
+    plasma_desc_destroy(&A);
+    plasma_workspace_destroy(&work);
+    free(norms);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the tile low-rank Cholesky factorization of a Hermitian positive
+ *  definite matrix.
+ *  Non-blocking tile version of plasma_clrpotrf().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  Compresses the off-diagonal tiles of the lower triangle in place and
+ *  factors A. The factor is left compressed, as tagged in A.tile_lrank;
+ *  core_omp_clrdecompress expands its tiles.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          On entry, the Hermitian positive definite matrix A, of which
+ *          the lower triangle is referenced, dense, with the ranks of its
+ *          tiles allocated by plasma_desc_tile_lrank_create.
+ *          On exit, if return value = 0, the factor L from the Cholesky
+ *          factorization A = L*L^H, with each off-diagonal tile dense or
+ *          compressed, as tagged in A.tile_lrank.
+ *
+ * @param[in] tol
+ *          The accuracy of the compression, relative to the norm of A.
+ *          tol >= 0.
+ *
+ * @param[in] work
+ *          Workspace of the tile low-rank kernels,
+ *          of size 9*nb*nb + 3*nb per thread.
+ *
+ * @param[out] norms
+ *          Workspace of size mt*nt for the norms of the tiles.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_clrpotrf
+ * @sa plasma_omp_zcpotrf
+ * @sa plasma_omp_cpotrf
+ *
+ ******************************************************************************/
+void plasma_omp_clrpotrf(plasma_desc_t A, float tol,
+                         plasma_workspace_t work, float *norms,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess ||
+        A.tile_lrank == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (tol < 0.0) {
+        plasma_error("illegal value of tol");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0)
+        return;
+
+    // Compute the norms of the tiles of the lower triangle.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        for (int m = n; m < A.mt; m++) {
+            core_omp_clange(PlasmaFrobeniusNorm,
+                            plasma_tile_mview(A, m), nvan,
+                            A(m, n), plasma_tile_mmain(A, m),
+                            NULL, &norms[m+(size_t)A.mt*n],
+                            sequence, request);
+        }
+    }
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // The off-diagonal tiles count twice in the norm of A.
+    float sumsq = 0.0;
+    for (int n = 0; n < A.nt; n++) {
+        for (int m = n; m < A.mt; m++) {
+            float norm = norms[m+(size_t)A.mt*n];
+            sumsq += m == n ? norm*norm : 2.0*norm*norm;
+        }
+    }
+    float atol = tol*sqrtf(sumsq)/A.nt;
+
+    // Compress the off-diagonal tiles.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        *plasma_tile_lrank(A, n, n) = -1;
+        for (int m = n+1; m < A.mt; m++) {
+            core_omp_clrcompress(
+                plasma_tile_mview(A, m), nvan, atol,
+                A(m, n), plasma_tile_mmain(A, m),
+                plasma_tile_lrank(A, m, n),
+                work,
+                sequence, request);
+        }
+    }
+
+    // Call the parallel function.
+    plasma_pclrpotrf(A, atol, work, sequence, request);
+}
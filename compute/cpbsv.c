@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zpbsv.c, normal z -> c, Mon Feb  6 14:06:37 2017
+ * @generated from compute/zpbsv.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -153,31 +153,27 @@ int plasma_cpbsv(plasma_enum_t uplo,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cpb2desc(pAB, ldab, AB, sequence, &request);
-        plasma_omp_cge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_cpb2desc(pAB, ldab, AB, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_cpbsv(uplo, AB, B, sequence, &request);
+        plasma_omp_cpbsv(uplo, AB, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2pb(AB, pAB, ldab, sequence, &request);
-        plasma_omp_cdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_cdesc2pb(AB, pAB, ldab, &sequence, &request);
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -186,8 +182,7 @@ int plasma_cpbsv(plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zpotri.c, normal z -> c, Mon Feb  6 14:06:39 2017
+ * @generated from compute/zpotri.c, normal z -> c, Thu Oct 15 08:42:01 2026
  *
  **/
 
@@ -28,6 +28,10 @@
  *  or
  *  \f[ A = L \times L^H. \f]
  *
+ *  The inversion of the factor and the product of the inverses are fused
+ *  in one sweep over the tiles, the Hermitian form of the Gauss-Jordan
+ *  sweep of plasma_cgetri, so PlasmaGetriVariant does not apply.
+ *
  *******************************************************************************
  *
  * @param[in] uplo
@@ -95,36 +99,32 @@ int plasma_cpotri(plasma_enum_t uplo,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_triangular_create() failed");
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block.
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
 
         // Perform computation.
-        plasma_omp_cpotri(uplo, A, sequence, &request);
+        plasma_omp_cpotri(uplo, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
     }
     // Implicit synchronization.
 
@@ -132,8 +132,7 @@ int plasma_cpotri(plasma_enum_t uplo,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -221,9 +220,7 @@ void plasma_omp_cpotri(plasma_enum_t uplo, plasma_desc_t A,
         return;
     }
 
-    // Invert triangular part.
-    plasma_pctrtri(uplo, PlasmaNonUnit, A, sequence, request);
-
-    // Compute product of upper and lower triangle.
-    plasma_pclauum(uplo, A, sequence, request);
+    // Invert the triangular factor and compute the product of the upper
+    // and lower triangles, step by step.
+    plasma_pcpotri(uplo, A, sequence, request);
 }
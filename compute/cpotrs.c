@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zpotrs.c, normal z -> c, Mon Feb  6 14:06:39 2017
+ * @generated from compute/zpotrs.c, normal z -> c, Thu Oct 15 07:33:55 2026
  *
  **/
 
@@ -114,6 +114,7 @@ int plasma_cpotrs(plasma_enum_t uplo,
 
     // Set tiling parameters.
     int nb = plasma->nb;
+    int nbrhs = plasma_tile_rhs_nb(plasma, nb, nrhs);
 
     // Initialize tile matrix descriptors.
     plasma_desc_t A;
@@ -125,7 +126,7 @@ int plasma_cpotrs(plasma_enum_t uplo,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nbrhs,
                                         n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
@@ -133,30 +134,26 @@ int plasma_cpotrs(plasma_enum_t uplo,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_cge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_cpotrs(uplo, A, B, sequence, &request);
+        plasma_omp_cpotrs(uplo, A, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -165,8 +162,7 @@ int plasma_cpotrs(plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -0,0 +1,132 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zptsv_batched.c, normal z -> c, Thu Oct 15 07:31:12 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_ptsv
+ *
+ *  Solves a batch of independent Hermitian positive definite tridiagonal
+ *  systems A_i X_i = B_i of the same order, where X_i and B_i are n-by-nrhs
+ *  matrices, with the factorizations A_i = L_i D_i L_i^H.
+ *  The batch is stored interleaved: the element j of the system i is at
+ *  j*batch_count + i, so that core_cptsv_interleaved runs the recurrences
+ *  across PLASMA_BATCH_LANES consecutive systems at a time, one per vector
+ *  lane, and the groups of systems are spread across the threads.
+ *  Intended for many small systems, such as the lines of ADI schemes.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_i. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrices B_i. nrhs >= 0.
+ *
+ * @param[in,out] d
+ *          Array of n*batch_count elements.
+ *          On entry, the diagonals of A_i.
+ *          On exit, the diagonals of D_i.
+ *
+ * @param[in,out] e
+ *          Array of (n-1)*batch_count elements.
+ *          On entry, the subdiagonals of A_i.
+ *          On exit, the subdiagonals of the unit bidiagonal factors L_i.
+ *
+ * @param[in,out] pB
+ *          Array of n*nrhs*batch_count elements, the element (j, k) of B_i
+ *          at (k*n + j)*batch_count + i.
+ *          On entry, the right hand sides B_i.
+ *          On exit, the solutions X_i for info[i] = 0.
+ *
+ * @param[in] batch_count
+ *          The number of systems in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, or j > 0
+ *          if the leading minor of order j of A_i is not positive definite,
+ *          and X_i has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cptsv
+ * @sa plasma_cptsv_batched
+ * @sa plasma_dptsv_batched
+ * @sa plasma_sptsv_batched
+ *
+ ******************************************************************************/
+int plasma_cptsv_batched(int n, int nrhs,
+                         float *d, plasma_complex32_t *e,
+                         plasma_complex32_t *pB,
+                         int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (d == NULL && n > 0 && batch_count > 0) {
+        plasma_error("NULL d");
+        return -3;
+    }
+    if (e == NULL && n > 1 && batch_count > 0) {
+        plasma_error("NULL e");
+        return -4;
+    }
+    if (pB == NULL && n > 0 && nrhs > 0 && batch_count > 0) {
+        plasma_error("NULL B");
+        return -5;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -7;
+    }
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i += PLASMA_BATCH_LANES) {
+        core_cptsv_interleaved(n, nrhs,
+                               imin(PLASMA_BATCH_LANES, batch_count-i),
+                               batch_count,
+                               d+i, e+i, pB+i, &info[i]);
+    }
+
+    return PlasmaSuccess;
+}
@@ -0,0 +1,253 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/ztranspose.c, normal z -> c, Thu Oct 15 07:33:55 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_transpose
+ *
+ *  Copies the transpose or the conjugate transpose of the m-by-n matrix A
+ *  to the n-by-m matrix B, B = op( A ), out of place.
+ *
+ *  The arrays are taken as tiles of the column-major arrays pA and pB
+ *  themselves, with their leading dimensions, so that each element is read
+ *  and written once, by a tile transposed by blocks in the caches. The
+ *  arrays are column-major whatever PlasmaArrayLayout; the transpose of the
+ *  row-major m-by-n array pA is the row-major n-by-m array pB of
+ *  plasma_ctranspose(trans, n, m, pA, lda, pB, ldb).
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaTrans:     op( A ) = A^T,
+ *          - PlasmaConjTrans: op( A ) = A^H.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The m-by-n matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] pB
+ *          On exit, the n-by-m matrix op( A ). pB must not overlap pA.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_ctranspose
+ * @sa plasma_ctranspose
+ * @sa plasma_dtranspose
+ * @sa plasma_stranspose
+ *
+ ******************************************************************************/
+int plasma_ctranspose(plasma_enum_t trans,
+                      int m, int n,
+                      plasma_complex32_t *pA, int lda,
+                      plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        return -1;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -2;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imin(n, m) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices, views of the arrays.
+    plasma_desc_t A, B;
+    int retval;
+    retval = plasma_desc_lapack_view_init(PlasmaComplexFloat, pA, lda,
+                                          nb, nb, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_init() failed");
+        return retval;
+    }
+    retval = plasma_desc_lapack_view_init(PlasmaComplexFloat, pB, ldb,
+                                          nb, nb, n, m, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_init() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Call tile async function.
+        plasma_omp_ctranspose(trans, A, B, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_transpose
+ *
+ *  Copies the transpose or the conjugate transpose of the m-by-n matrix A
+ *  to the n-by-m matrix B, B = op( A ). Non-blocking tile version of
+ *  plasma_ctranspose(). May return before the computation is finished.
+ *  Operates on matrices stored by tiles. All matrices are passed through
+ *  descriptors. All dimensions are taken from the descriptors. Allows for
+ *  pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaTrans:     op( A ) = A^T,
+ *          - PlasmaConjTrans: op( A ) = A^H.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[out] B
+ *          Descriptor of matrix B, with the transposed tiles of A:
+ *          B.mb = A.nb and B.nb = A.mb.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes). Check the
+ *          sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values. The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ctranspose
+ * @sa plasma_omp_ctranspose
+ * @sa plasma_omp_dtranspose
+ * @sa plasma_omp_stranspose
+ *
+ ******************************************************************************/
+void plasma_omp_ctranspose(plasma_enum_t trans, plasma_desc_t A,
+                           plasma_desc_t B,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.rate > 0 || B.rate > 0) {
+        plasma_error("packed tiles not supported");
+        plasma_request_fail(sequence, request, PlasmaErrorNotSupported);
+        return;
+    }
+    if (B.m != A.n || B.n != A.m || B.mb != A.nb || B.nb != A.mb) {
+        plasma_error("B does not match the transpose of A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(A.m, A.n) == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pctranspose(trans, A, B, sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgbtrs.c, normal z -> d, Mon Feb  6 14:06:28 2017
+ * @generated from compute/zgbtrs.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -152,30 +152,26 @@ int plasma_dgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dpb2desc(pAB, ldab, AB, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dpb2desc(pAB, ldab, AB, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_dgbtrs(trans, AB, ipiv, B, sequence, &request);
+        plasma_omp_dgbtrs(trans, AB, ipiv, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -184,8 +180,7 @@ int plasma_dgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
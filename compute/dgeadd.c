@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgeadd.c, normal z -> d, Mon Feb  6 14:06:29 2017
+ * @generated from compute/zgeadd.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -168,34 +168,30 @@ int plasma_dgeadd(plasma_enum_t transa,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call tile async function.
         plasma_omp_dgeadd(transa,
                           alpha,     A,
                           beta,      B,
-                          sequence, &request);
+                          &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -204,8 +200,7 @@ int plasma_dgeadd(plasma_enum_t transa,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -233,13 +228,14 @@ int plasma_dgeadd(plasma_enum_t transa,
  *          The scalar alpha.
  *
  * @param[in] A
- *          Descriptor of matrix A.
+ *          Descriptor of matrix A, whose tiles may be packed
+ *          (plasma_desc_general_packed_create).
  *
  * @param[in] beta
  *          The scalar beta.
  *
  * @param[in,out] B
- *          Descriptor of matrix B.
+ *          Descriptor of matrix B, whose tiles may be packed.
  *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
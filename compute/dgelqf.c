@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgelqf.c, normal z -> d, Mon Feb  6 14:06:29 2017
+ * @generated from compute/zgelqf.c, normal z -> d, Thu Oct 15 10:29:07 2026
  *
  **/
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -99,22 +100,23 @@ int plasma_dgelqf(int m, int n,
     // Set tiling parameters.
     int ib = plasma->ib;
     int nb = plasma->nb;
-    int householder_mode = plasma->householder_mode;
 
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pA, lda, nb, nb,
+                                       m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
         return retval;
     }
 
     // Prepare descriptor T.
-    retval = plasma_descT_create(A, ib, householder_mode, T);
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                         PlasmaRowwise, T);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_descT_create() failed");
+        plasma_error("plasma_descT_compact_create() failed");
         return retval;
     }
 
@@ -127,29 +129,25 @@ int plasma_dgelqf(int m, int n,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_dgelqf(A, *T, work, sequence, &request);
+        plasma_omp_dgelqf(A, *T, work, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
@@ -159,8 +157,7 @@ int plasma_dgelqf(int m, int n,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -183,6 +180,10 @@ int plasma_dgelqf(int m, int n,
  *          Descriptor of matrix T.
  *          On exit, auxiliary factorization data, required by plasma_dgelqs to
  *          solve the system of equations.
+ *          Created for A by plasma_descT_compact_create, with
+ *          PlasmaAutoHouseholder, or the Householder mode the routine
+ *          resolves; the tree mode fails the sequence on a T created for
+ *          the flat mode.
  *
  * @param[in] work
  *          Workspace for the auxiliary arrays needed by some coreblas kernels.
@@ -250,8 +251,16 @@ void plasma_omp_dgelqf(plasma_desc_t A, plasma_desc_t T,
     if (imin(A.m, A.n) == 0)
         return;
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    if (plasma_descT_check(A, T, householder_mode,
+                           PlasmaRowwise) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     // Call the parallel function.
-    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+    if (householder_mode == PlasmaTreeHouseholder) {
         plasma_pdgelqfrh(A, T, work, sequence, request);
     }
     else {
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgels.c, normal z -> d, Mon Feb  6 14:06:30 2017
+ * @generated from compute/zgels.c, normal z -> d, Thu Oct 15 10:29:07 2026
  *
  **/
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -149,7 +150,6 @@ int plasma_dgels(plasma_enum_t trans,
     // Set tiling parameters.
     int ib = plasma->ib;
     int nb = plasma->nb;
-    int householder_mode = plasma->householder_mode;
 
     // Create tile matrices.
     plasma_desc_t A;
@@ -172,9 +172,12 @@ int plasma_dgels(plasma_enum_t trans,
     }
 
     // Prepare descriptor T.
-    retval = plasma_descT_create(A, ib, householder_mode, T);
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                         A.m >= A.n ? PlasmaColumnwise
+                                                    : PlasmaRowwise, T);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_descT_create() failed");
+        plasma_error("plasma_descT_compact_create() failed");
         return retval;
     }
 
@@ -187,34 +190,30 @@ int plasma_dgels(plasma_enum_t trans,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
         plasma_omp_dgels(PlasmaNoTrans,
                          A, *T,
                          B, work,
-                         sequence, &request);
+                         &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -225,8 +224,7 @@ int plasma_dgels(plasma_enum_t trans,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -343,23 +341,30 @@ void plasma_omp_dgels(plasma_enum_t trans,
         return;
     }
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    plasma_enum_t storev = A.m >= A.n ? PlasmaColumnwise : PlasmaRowwise;
+    if (plasma_descT_check(A, T, householder_mode, storev) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     //===============================
     // Solve using QR factorization.
     //===============================
     if (A.m >= A.n) {
-        if (plasma->householder_mode == PlasmaTreeHouseholder) {
+        if (householder_mode == PlasmaTreeHouseholder) {
             plasma_pdgeqrfrh(A, T, work, sequence, request);
-        }
-        else {
-            plasma_pdgeqrf(A, T, work, sequence, request);
-        }
-
-        if (plasma->householder_mode == PlasmaTreeHouseholder) {
             plasma_pdormqrrh(PlasmaLeft, PlasmaTrans,
                              A, T, B,
                              work, sequence, request);
         }
+        else if (plasma->gels_variant == PlasmaFusedGels) {
+            // Apply Q^T to B as each panel completes.
+            plasma_pdgeqrf_rhs(A, T, B, work, sequence, request);
+        }
         else {
+            plasma_pdgeqrf(A, T, work, sequence, request);
             plasma_pdormqr(PlasmaLeft, PlasmaTrans,
                            A, T, B,
                            work, sequence, request);
@@ -376,7 +381,7 @@ void plasma_omp_dgels(plasma_enum_t trans,
     // Solve using LQ factorization.
     //===============================
     else {
-        if (plasma->householder_mode == PlasmaTreeHouseholder) {
+        if (householder_mode == PlasmaTreeHouseholder) {
             plasma_pdgelqfrh(A, T, work, sequence, request);
         }
         else {
@@ -397,7 +402,7 @@ void plasma_omp_dgels(plasma_enum_t trans,
             sequence, request);
 
         // Find X = Q^T * Y.
-        if (plasma->householder_mode == PlasmaTreeHouseholder) {
+        if (householder_mode == PlasmaTreeHouseholder) {
             plasma_pdormlqrh(PlasmaLeft, PlasmaTrans,
                              A, T, B,
                              work, sequence, request);
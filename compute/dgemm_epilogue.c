@@ -0,0 +1,417 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgemm_epilogue.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operation of plasma_dgemm, followed by an
+ *  element-wise epilogue,
+ *
+ *    \f[ C = f( \alpha [op( A )\times op( B )] + \beta C ), \f]
+ *
+ *  where f scales the rows and columns of C, adds a bias to them, applies
+ *  an activation and calls a user function, as set by the epilogue.
+ *  The epilogue of each tile of C runs in the task of its last product,
+ *  while the tile is still in the cache, which saves the pass over C of
+ *  an epilogue applied after plasma_dgemm. The epilogue may also convert
+ *  the tiles, e.g., to a lower precision, in its function.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( A ) and of the matrix C.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix op( B ) and of the matrix C.
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A ) and the number of rows
+ *          of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          An lda-by-ka matrix, where ka is k when transa = PlasmaNoTrans,
+ *          and is m otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          When transa = PlasmaNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] pB
+ *          An ldb-by-kb matrix, where kb is n when transb = PlasmaNoTrans,
+ *          and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          An ldc-by-n matrix. On exit, the array is overwritten by the m-by-n
+ *          matrix f( alpha*op( A )*op( B ) + beta*C ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param[in] epilogue
+ *          The epilogue f, whose vectors are indexed by the rows and columns
+ *          of C, and whose function is called on blocks of C in the array
+ *          pC, or in tile layout. If NULL, f is the identity.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dgemm_epilogue
+ * @sa plasma_cgemm_epilogue
+ * @sa plasma_dgemm_epilogue
+ * @sa plasma_sgemm_epilogue
+ * @sa plasma_dgemm
+ *
+ ******************************************************************************/
+int plasma_dgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                          int m, int n, int k,
+                          double alpha,
+                          double *pA, int lda,
+                          double *pB, int ldb,
+                          double beta,
+                          double *pC, int ldc,
+                          const plasma_depilogue_t *epilogue)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -5;
+    }
+
+    int am, an;
+    int bm, bn;
+    if (transa == PlasmaNoTrans) {
+        am = m;
+        an = k;
+    }
+    else {
+        am = k;
+        an = m;
+    }
+    if (transb == PlasmaNoTrans) {
+        bm = k;
+        bn = n;
+    }
+    else {
+        bm = n;
+        bn = k;
+    }
+
+    if (lda < imax(1, am)) {
+        plasma_error("illegal value of lda");
+        return -8;
+    }
+    if (ldb < imax(1, bm)) {
+        plasma_error("illegal value of ldb");
+        return -10;
+    }
+    if (ldc < imax(1, m)) {
+        plasma_error("illegal value of ldc");
+        return -13;
+    }
+    if (epilogue != NULL &&
+        (epilogue->activation != PlasmaActivationNone) &&
+        (epilogue->activation != PlasmaActivationRelu) &&
+        (epilogue->activation != PlasmaActivationTanh)) {
+        plasma_error("illegal value of epilogue");
+        return -14;
+    }
+
+    // quick return
+    if (m == 0 || n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_lapack_view_create(PlasmaRealDouble, pA, lda,
+                                            nb, nb, am, an, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_lapack_view_create(PlasmaRealDouble, pB, ldb,
+                                            nb, nb, bm, bn, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_lapack_view_create(PlasmaRealDouble, pC, ldc,
+                                            nb, nb, m, n, &C);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_view_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_dge2desc(pC, ldc, C, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dgemm_epilogue(transa, transb,
+                                  alpha, A,
+                                         B,
+                                  beta,  C,
+                                  epilogue,
+                                  &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(C, pC, ldc, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&C);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs matrix multiplication followed by an element-wise epilogue.
+ *  Non-blocking tile version of plasma_dgemm_epilogue().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  The epilogue is copied by the tasks as they are submitted, but its
+ *  vectors are read, and its function called, as the tasks run.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          Descriptor of matrix C, of a single process, in the general
+ *          layout.
+ *
+ * @param[in] epilogue
+ *          The epilogue f, whose vectors are indexed by the rows and columns
+ *          of C. If NULL, f is the identity.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgemm_epilogue
+ * @sa plasma_omp_cgemm_epilogue
+ * @sa plasma_omp_dgemm_epilogue
+ * @sa plasma_omp_sgemm_epilogue
+ * @sa plasma_omp_dgemm
+ *
+ ******************************************************************************/
+void plasma_omp_dgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                               double alpha, plasma_desc_t A,
+                                                         plasma_desc_t B,
+                               double beta,  plasma_desc_t C,
+                               const plasma_depilogue_t *epilogue,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(C) != PlasmaSuccess) {
+        plasma_error("invalid C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (C.layout == PlasmaSparseLayout || C.p*C.q > 1) {
+        plasma_error("C not of a single process in the general layout");
+        plasma_request_fail(sequence, request, PlasmaErrorNotSupported);
+        return;
+    }
+    if (epilogue != NULL &&
+        (epilogue->activation != PlasmaActivationNone) &&
+        (epilogue->activation != PlasmaActivationRelu) &&
+        (epilogue->activation != PlasmaActivationTanh)) {
+        plasma_error("illegal value of epilogue");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (C.m == 0 || C.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdgemm_epilogue(transa, transb,
+                           alpha, A,
+                                  B,
+                           beta,  C,
+                           epilogue,
+                           sequence, request);
+}
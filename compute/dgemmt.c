@@ -0,0 +1,395 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgemmt.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemmt
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *          \f[ C = \alpha [op( A )\times op( B )] + \beta C, \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *    \f[ op( X ) = X^T, \f]
+ *
+ *  alpha and beta are scalars, op( A ) is an n-by-k matrix, op( B ) is
+ *  a k-by-n matrix and only the uplo triangle of the n-by-n matrix C
+ *  is computed, for about half the flops of plasma_dgemm.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: the upper triangle of C is computed;
+ *          - PlasmaLower: the lower triangle of C is computed.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] n
+ *          The order of the matrix C. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A ) and the number of rows
+ *          of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          An lda-by-ka matrix, where ka is k when transa = PlasmaNoTrans,
+ *          and is n otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          When transa = PlasmaNoTrans, lda >= max(1,n),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] pB
+ *          An ldb-by-kb matrix, where kb is n when transb = PlasmaNoTrans,
+ *          and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          An ldc-by-n matrix. On exit, the uplo triangle is overwritten by
+ *          the uplo triangle of ( alpha*op( A )*op( B ) + beta*C ).
+ *          The other triangle is not modified.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dgemmt
+ * @sa plasma_cgemmt
+ * @sa plasma_dgemmt
+ * @sa plasma_sgemmt
+ * @sa plasma_dgemm
+ *
+ ******************************************************************************/
+int plasma_dgemmt(plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t transb,
+                  int n, int k,
+                  double alpha, double *pA, int lda,
+                                            double *pB, int ldb,
+                  double beta,  double *pC, int ldc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -2;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -3;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -5;
+    }
+
+    int am, an;
+    int bm, bn;
+    if (transa == PlasmaNoTrans) {
+        am = n;
+        an = k;
+    }
+    else {
+        am = k;
+        an = n;
+    }
+    if (transb == PlasmaNoTrans) {
+        bm = k;
+        bn = n;
+    }
+    else {
+        bm = n;
+        bn = k;
+    }
+
+    if (lda < imax(1, am)) {
+        plasma_error("illegal value of lda");
+        return -8;
+    }
+    if (ldb < imax(1, bm)) {
+        plasma_error("illegal value of ldb");
+        return -10;
+    }
+    if (ldc < imax(1, n)) {
+        plasma_error("illegal value of ldc");
+        return -13;
+    }
+
+    // quick return
+    if (n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        am, an, 0, 0, am, an, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        bm, bn, 0, 0, bm, bn, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &C);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_dge2desc(pC, ldc, C, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dgemmt(uplo, transa, transb,
+                          alpha, A,
+                                 B,
+                          beta,  C,
+                          &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(C, pC, ldc, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&C);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemmt
+ *
+ *  Performs matrix multiplication updating one triangle of C.
+ *  Non-blocking tile version of plasma_dgemmt().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: the upper triangle of C is computed;
+ *          - PlasmaLower: the lower triangle of C is computed.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          Descriptor of matrix C.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgemmt
+ * @sa plasma_omp_cgemmt
+ * @sa plasma_omp_dgemmt
+ * @sa plasma_omp_sgemmt
+ *
+ ******************************************************************************/
+void plasma_omp_dgemmt(plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t transb,
+                       double alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                       double beta,  plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(C) != PlasmaSuccess) {
+        plasma_error("invalid C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (C.m != C.n) {
+        plasma_error("C must be square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    int k = transa == PlasmaNoTrans ? A.n : A.m;
+    if (C.n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
+        return;
+
+    // Call the parallel function.
+    plasma_pdgemmt(uplo, transa, transb,
+                   alpha, A,
+                          B,
+                   beta,  C,
+                   sequence, request);
+}
@@ -0,0 +1,549 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgesvd.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *  Conjugate transpose of the m-by-n matrix A into B, for the matrices
+ *  with more columns than rows.
+ **/
+static void plasma_dgesvd_conj_transpose(int m, int n,
+                                         const double *A, int lda,
+                                         double *B, int ldb)
+{
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            B[j + i*ldb] = (A[i + j*lda]);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesvd
+ *
+ *  Computes the singular value decomposition of a complex m-by-n matrix A,
+ *  optionally with the left and/or right singular vectors:
+ *    \f[ A = U \Sigma V^T, \f]
+ *  where Sigma is the min(m,n) diagonal matrix of the singular values, and
+ *  U and V have min(m,n) orthonormal columns.
+ *
+ *  The reduction to bidiagonal form takes two stages. The first reduces A
+ *  to an upper band B of bandwidth nb by alternating tile QR and LQ steps
+ *  (plasma_omp_dge2gb). It runs in parallel over the tiles, and holds most
+ *  of the flops. If m is much larger than n, A is first factored by tile
+ *  QR, and R is reduced instead. The band is then reduced to bidiagonal
+ *  form by LAPACK dgbbrd, on n*nb elements, and the bidiagonal is solved
+ *  by dbdsqr. The singular vectors of B are transformed back by the
+ *  reflectors of the first stage.
+ *  If m < n, the decomposition of A^T is computed.
+ *
+ *******************************************************************************
+ *
+ * @param[in] jobu
+ *          - PlasmaNoVec: no left singular vectors are computed;
+ *          - PlasmaVec:   the min(m,n) left singular vectors are computed.
+ *
+ * @param[in] jobvt
+ *          - PlasmaNoVec: no right singular vectors are computed;
+ *          - PlasmaVec:   the min(m,n) right singular vectors are computed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the m-by-n matrix A.
+ *          On exit, A is destroyed if m >= n, and unchanged otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] S
+ *          On exit, the singular values in decreasing order,
+ *          of size min(m,n).
+ *
+ * @param[out] pU
+ *          If jobu = PlasmaVec, on exit, the m-by-min(m,n) matrix U.
+ *          Not referenced otherwise.
+ *
+ * @param[in] ldu
+ *          The leading dimension of the array U.
+ *          ldu >= max(1,m) if jobu = PlasmaVec, ldu >= 1 otherwise.
+ *
+ * @param[out] pVT
+ *          If jobvt = PlasmaVec, on exit, the min(m,n)-by-n matrix V^T.
+ *          Not referenced otherwise.
+ *
+ * @param[in] ldvt
+ *          The leading dimension of the array VT.
+ *          ldvt >= max(1,min(m,n)) if jobvt = PlasmaVec, ldvt >= 1 otherwise.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the bidiagonal solver failed to converge
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dge2gb
+ * @sa plasma_cgesvd
+ * @sa plasma_dgesvd
+ * @sa plasma_sgesvd
+ *
+ ******************************************************************************/
+int plasma_dgesvd(plasma_enum_t jobu, plasma_enum_t jobvt, int m, int n,
+                  double *pA, int lda, double *S,
+                  double *pU, int ldu,
+                  double *pVT, int ldvt)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((jobu != PlasmaNoVec) &&
+        (jobu != PlasmaVec)) {
+        plasma_error("illegal value of jobu");
+        return -1;
+    }
+    if ((jobvt != PlasmaNoVec) &&
+        (jobvt != PlasmaVec)) {
+        plasma_error("illegal value of jobvt");
+        return -2;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -4;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -6;
+    }
+    if (S == NULL) {
+        plasma_error("NULL S");
+        return -7;
+    }
+    if (ldu < 1 || (jobu == PlasmaVec && ldu < m)) {
+        plasma_error("illegal value of ldu");
+        return -9;
+    }
+    if (ldvt < 1 || (jobvt == PlasmaVec && ldvt < imin(m, n))) {
+        plasma_error("illegal value of ldvt");
+        return -11;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Decompose A^T = V S U^T, and transpose the vectors back.
+    if (m < n) {
+        double *At = (double*)malloc(
+            (size_t)n*m*sizeof(double));
+        double *Ut = NULL;
+        double *VTt = NULL;
+        if (jobvt == PlasmaVec)
+            Ut = (double*)malloc(
+                (size_t)n*m*sizeof(double));
+        if (jobu == PlasmaVec)
+            VTt = (double*)malloc(
+                (size_t)m*m*sizeof(double));
+        if (At == NULL ||
+            (jobvt == PlasmaVec && Ut == NULL) ||
+            (jobu == PlasmaVec && VTt == NULL)) {
+            plasma_error("malloc() failed");
+            free(At);
+            free(Ut);
+            free(VTt);
+            return PlasmaErrorOutOfMemory;
+        }
+        plasma_dgesvd_conj_transpose(m, n, pA, lda, At, n);
+
+        int retval = plasma_dgesvd(jobvt, jobu, n, m, At, n, S,
+                                   Ut, n, VTt, m);
+        if (retval == PlasmaSuccess) {
+            if (jobu == PlasmaVec)
+                plasma_dgesvd_conj_transpose(m, m, VTt, m, pU, ldu);
+            if (jobvt == PlasmaVec)
+                plasma_dgesvd_conj_transpose(n, m, Ut, n, pVT, ldvt);
+        }
+        free(At);
+        free(Ut);
+        free(VTt);
+        return retval;
+    }
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Factor A by QR first if it is tall enough that the LQ steps on the
+    // rows below R cost more than the QR factorization.
+    int qr_first = 5*m >= 8*n && m-n >= nb;
+
+    // Create tile matrices. B is A, or R from the QR factorization.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t TQ;
+    plasma_desc_t TU;
+    plasma_desc_t TV;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    B = A;
+    if (qr_first) {
+        retval = plasma_descT_create(A, ib, PlasmaFlatHouseholder, &TQ);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_descT_create() failed");
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+        retval = plasma_desc_general_zero_create(PlasmaRealDouble, nb, nb,
+                                                 n, n, 0, 0, n, n, &B);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_zero_create() failed");
+            plasma_desc_destroy(&TQ);
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+    }
+    retval = plasma_descT_create(B, ib, PlasmaFlatHouseholder, &TU);
+    if (retval == PlasmaSuccess) {
+        retval = plasma_descT_create(B, ib, PlasmaFlatHouseholder, &TV);
+        if (retval != PlasmaSuccess)
+            plasma_desc_destroy(&TU);
+    }
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_create() failed");
+        if (qr_first) {
+            plasma_desc_destroy(&B);
+            plasma_desc_destroy(&TQ);
+        }
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Allocate the band, its superdiagonal and its singular vectors.
+    int kd = imin(nb, n-1);
+    int ldab = kd+1;
+    double *AB = (double*)malloc(
+        (size_t)ldab*n*sizeof(double));
+    double *E = (double*)malloc((size_t)n*sizeof(double));
+    double *Q = NULL;
+    double *PT = NULL;
+    if (jobu == PlasmaVec)
+        Q = (double*)malloc(
+            (size_t)n*n*sizeof(double));
+    if (jobvt == PlasmaVec)
+        PT = (double*)malloc(
+            (size_t)n*n*sizeof(double));
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaRealDouble);
+    if (retval != PlasmaSuccess || AB == NULL || E == NULL ||
+        (jobu == PlasmaVec && Q == NULL) ||
+        (jobvt == PlasmaVec && PT == NULL)) {
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_workspace_create() failed");
+        }
+        else {
+            plasma_error("malloc() failed");
+            plasma_workspace_destroy(&work);
+            retval = PlasmaErrorOutOfMemory;
+        }
+        free(AB);
+        free(E);
+        free(Q);
+        free(PT);
+        plasma_desc_destroy(&TV);
+        plasma_desc_destroy(&TU);
+        if (qr_first) {
+            plasma_desc_destroy(&B);
+            plasma_desc_destroy(&TQ);
+        }
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+
+        // Factor A by QR and extract R.
+        if (qr_first) {
+            plasma_pdgeqrf(A, TQ, work, &sequence, &request);
+            plasma_pdlaset(PlasmaGeneral, 0.0, 0.0, B, &sequence, &request);
+            plasma_pdlacpy(PlasmaUpper, plasma_desc_view(A, 0, 0, n, n), B,
+                           &sequence, &request);
+        }
+
+        // Reduce to band.
+        plasma_omp_dge2gb(B, TU, TV, AB, ldab, work, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Reduce the band to bidiagonal and solve.
+    if (sequence.status == PlasmaSuccess) {
+        char vect = jobu == PlasmaVec ? (jobvt == PlasmaVec ? 'B' : 'Q')
+                                      : (jobvt == PlasmaVec ? 'P' : 'N');
+        int info = LAPACKE_dgbbrd(LAPACK_COL_MAJOR, vect, n, n, 0, 0, kd,
+                                  AB, ldab, S, E, Q, n, PT, n, NULL, 1);
+        if (info == 0)
+            info = LAPACKE_dbdsqr(LAPACK_COL_MAJOR, 'U', n,
+                                  jobvt == PlasmaVec ? n : 0,
+                                  jobu == PlasmaVec ? n : 0, 0,
+                                  S, E, PT, n, Q, n, NULL, 1);
+        if (info != 0)
+            plasma_request_fail(&sequence, &request,
+                                info > 0 ? info : PlasmaErrorInternal);
+    }
+
+    // Transform the singular vectors of the band back.
+    if ((jobu == PlasmaVec || jobvt == PlasmaVec) &&
+        sequence.status == PlasmaSuccess) {
+
+        plasma_desc_t U;
+        plasma_desc_t VT;
+        if (jobu == PlasmaVec) {
+            // U = [Q; 0]
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'g', m, n,
+                                0.0, 0.0, pU, ldu);
+            LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'g', n, n, Q, n, pU, ldu);
+            retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                                m, n, 0, 0, m, n, &U);
+            if (retval != PlasmaSuccess)
+                plasma_request_fail(&sequence, &request, retval);
+        }
+        if (jobvt == PlasmaVec) {
+            LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'g', n, n, PT, n,
+                                pVT, ldvt);
+            retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                                n, n, 0, 0, n, n, &VT);
+            if (retval != PlasmaSuccess)
+                plasma_request_fail(&sequence, &request, retval);
+        }
+
+        if (sequence.status == PlasmaSuccess) {
+            #pragma omp parallel num_threads(plasma_num_threads(plasma))
+            #pragma omp master
+            #pragma omp taskgroup
+            {
+                if (jobu == PlasmaVec) {
+                    // U = Q_A Q_B [Q; 0]
+                    plasma_omp_dge2desc(pU, ldu, U, &sequence, &request);
+                    plasma_pdormqr(PlasmaLeft, PlasmaNoTrans, B, TU,
+                                   plasma_desc_view(U, 0, 0, B.m, n),
+                                   work, &sequence, &request);
+                    if (qr_first)
+                        plasma_pdormqr(PlasmaLeft, PlasmaNoTrans, A, TQ, U,
+                                       work, &sequence, &request);
+                    plasma_omp_ddesc2ge(U, pU, ldu, &sequence, &request);
+                }
+                if (jobvt == PlasmaVec) {
+                    // V^T = P^T P_B^T, by the LQ reflectors of
+                    // B(0:n-nb-1, nb:n-1).
+                    plasma_omp_dge2desc(pVT, ldvt, VT, &sequence, &request);
+                    if (n > nb)
+                        plasma_pdormlq(
+                            PlasmaRight, PlasmaNoTrans,
+                            plasma_desc_view(B, 0, nb, n-nb, n-nb),
+                            plasma_desc_view(TV, 0, nb, TV.m, TV.n-nb),
+                            plasma_desc_view(VT, 0, nb, n, n-nb),
+                            work, &sequence, &request);
+                    plasma_omp_ddesc2ge(VT, pVT, ldvt, &sequence, &request);
+                }
+            }
+            // implicit synchronization
+        }
+        if (jobu == PlasmaVec)
+            plasma_desc_destroy(&U);
+        if (jobvt == PlasmaVec)
+            plasma_desc_destroy(&VT);
+    }
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrices.
+    free(AB);
+    free(E);
+    free(Q);
+    free(PT);
+    plasma_desc_destroy(&TU);
+    plasma_desc_destroy(&TV);
+    if (qr_first) {
+        plasma_desc_destroy(&TQ);
+        plasma_desc_destroy(&B);
+    }
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesvd
+ *
+ *  Reduces a complex m-by-n matrix A, m >= n, to upper band form B of
+ *  bandwidth nb, A = Q B P^T, the first stage of plasma_dgesvd.
+ *  Non-blocking tile version.
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of the m-by-n matrix A, m >= n, with square tiles.
+ *          On exit, the reflectors of Q, stored as by plasma_omp_dgeqrf,
+ *          and those of P, stored as by plasma_omp_dgelqf on
+ *          A(0:n-nb-1, nb:n-1). The band is destroyed.
+ *
+ * @param[out] TU
+ *          Descriptor of matrix T of Q, created by plasma_descT_create for A
+ *          in the flat Householder mode.
+ *
+ * @param[out] TV
+ *          Descriptor of matrix T of P, created as TU.
+ *          On exit, auxiliary data of P from its second tile column on.
+ *
+ * @param[out] AB
+ *          On exit, the upper band B in LAPACK band storage,
+ *          with kd = min(nb, n-1) superdiagonals.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the array AB. ldab >= kd+1.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          Contains preallocated space for tau and work arrays.
+ *          Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgesvd
+ * @sa plasma_omp_cge2gb
+ * @sa plasma_omp_dge2gb
+ * @sa plasma_omp_sge2gb
+ *
+ ******************************************************************************/
+void plasma_omp_dge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                       double *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m < A.n || A.mb != A.nb) {
+        plasma_error("A wide or tiles not square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(TU) != PlasmaSuccess) {
+        plasma_error("invalid TU");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(TV) != PlasmaSuccess) {
+        plasma_error("invalid TV");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (AB == NULL) {
+        plasma_error("NULL AB");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ldab < imin(A.nb, A.n-1)+1) {
+        plasma_error("illegal value of ldab");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdge2gb(A, TU, TV, AB, ldab, work, sequence, request);
+}
@@ -0,0 +1,255 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgesvd_randomized.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesvd
+ *
+ *  Computes a rank-k approximation of a complex m-by-n matrix A by the
+ *  randomized SVD,
+ *    \f[ A \approx U \Sigma V^T, \f]
+ *  where Sigma is the k-by-k diagonal matrix of the leading singular values,
+ *  and U and V have k orthonormal columns.
+ *
+ *  The low-rank factorization A = Q B of plasma_dgeqrf_lowrank, with l =
+ *  min(k+p, m, n) columns in Q, is computed by tile products and QR
+ *  factorizations. The SVD of the small l-by-n matrix B = Ub S V^T is then
+ *  computed by LAPACK, and U = Q Ub by a tile product. The error is close
+ *  to the (k+1)-th singular value of A when the spectrum decays; power
+ *  iterations make up for a slow decay.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The rank of the approximation. 0 <= k <= min(m,n).
+ *
+ * @param[in] p
+ *          The oversampling, columns sampled beyond k. p >= 0.
+ *          A few, typically 5 to 10, make the approximation reliable.
+ *
+ * @param[in] niter
+ *          The number of power iterations. niter >= 0.
+ *
+ * @param[in] pA
+ *          The m-by-n matrix A. Not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] S
+ *          On exit, the k leading singular values in decreasing order.
+ *
+ * @param[out] pU
+ *          On exit, the m-by-k matrix U.
+ *
+ * @param[in] ldu
+ *          The leading dimension of the array U. ldu >= max(1,m).
+ *
+ * @param[out] pVT
+ *          On exit, the k-by-n matrix V^T.
+ *
+ * @param[in] ldvt
+ *          The leading dimension of the array VT. ldvt >= max(1,k).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the SVD of B failed to converge
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgeqrf_lowrank
+ * @sa plasma_dgesvd
+ * @sa plasma_cgesvd_randomized
+ * @sa plasma_dgesvd_randomized
+ * @sa plasma_sgesvd_randomized
+ *
+ ******************************************************************************/
+int plasma_dgesvd_randomized(int m, int n, int k, int p, int niter,
+                             double *pA, int lda, double *S,
+                             double *pU, int ldu,
+                             double *pVT, int ldvt)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0 || k > imin(m, n)) {
+        plasma_error("illegal value of k");
+        return -3;
+    }
+    if (p < 0) {
+        plasma_error("illegal value of p");
+        return -4;
+    }
+    if (niter < 0) {
+        plasma_error("illegal value of niter");
+        return -5;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -7;
+    }
+    if (S == NULL) {
+        plasma_error("NULL S");
+        return -8;
+    }
+    if (ldu < imax(1, m)) {
+        plasma_error("illegal value of ldu");
+        return -10;
+    }
+    if (ldvt < imax(1, k)) {
+        plasma_error("illegal value of ldvt");
+        return -12;
+    }
+
+    // quick return
+    if (k == 0)
+        return PlasmaSuccess;
+
+    // Factor A = Q B.
+    plasma_desc_t Q;
+    plasma_desc_t B;
+    int retval = plasma_dgeqrf_lowrank(m, n, k, p, niter, pA, lda, &Q, &B);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    int l = Q.n;
+    int nb = plasma->nb;
+
+    // Allocate B and its SVD in LAPACK layout.
+    double *pB = (double*)malloc(
+        (size_t)l*n*sizeof(double));
+    double *Ub = (double*)malloc(
+        (size_t)l*l*sizeof(double));
+    double *VTb = (double*)malloc(
+        (size_t)l*n*sizeof(double));
+    double *Sb = (double*)malloc((size_t)l*sizeof(double));
+    double *superb = (double*)malloc((size_t)l*sizeof(double));
+    if (pB == NULL || Ub == NULL || VTb == NULL || Sb == NULL ||
+        superb == NULL) {
+        plasma_error("malloc() failed");
+        free(pB);
+        free(Ub);
+        free(VTb);
+        free(Sb);
+        free(superb);
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&B);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Create tile matrices of the leading vectors.
+    plasma_desc_t U;
+    plasma_desc_t Uk;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, k, 0, 0, m, k, &U);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        l, k, 0, 0, l, k, &Uk);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_ddesc2ge(B, pB, l, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // B = Ub S V^T
+    if (sequence.status == PlasmaSuccess) {
+        int info = LAPACKE_dgesvd(LAPACK_COL_MAJOR, 'S', 'S', l, n,
+                                  pB, l, Sb, Ub, l, VTb, l, superb);
+        if (info != 0)
+            plasma_request_fail(&sequence, &request,
+                                info > 0 ? info : PlasmaErrorInternal);
+    }
+
+    if (sequence.status == PlasmaSuccess) {
+        for (int i = 0; i < k; i++)
+            S[i] = Sb[i];
+        LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'g', k, n, VTb, l,
+                            pVT, ldvt);
+
+        // asynchronous block
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            // U = Q Ub(:, 0:k-1)
+            plasma_omp_dge2desc(Ub, l, Uk, &sequence, &request);
+            plasma_omp_dgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, Q, Uk, 0.0, U,
+                             &sequence, &request);
+            plasma_omp_ddesc2ge(U, pU, ldu, &sequence, &request);
+        }
+        // implicit synchronization
+    }
+
+    // Free matrices.
+    free(pB);
+    free(Ub);
+    free(VTb);
+    free(Sb);
+    free(superb);
+    plasma_desc_destroy(&Q);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&U);
+    plasma_desc_destroy(&Uk);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -6,21 +6,25 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgetrf.c, normal z -> d, Mon Feb  6 14:06:32 2017
+ * @generated from compute/zgetrf.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
 #include "plasma.h"
 #include "plasma_async.h"
+#include "plasma_blas_threads.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_predict.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "core_lapack.h"
 
-#include <omp.h>
 #include "mkl_lapacke.h"
-double _dgetrf_time;
+
+#include <stdlib.h>
 
 /***************************************************************************//**
  *
@@ -52,6 +56,21 @@ int plasma_dgetrf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "dgetrf", imax(m, n), &tuning);
+
+    // Call LAPACK directly for a problem of a single tile.
+    if (plasma_small_path(plasma, imax(m, n))) {
+        int blas_threads =
+            plasma_blas_threads_local(plasma_num_threads(plasma));
+        int info = LAPACKE_dgetrf_work(LAPACK_COL_MAJOR, m, n,
+                                       pA, lda, ipiv);
+        plasma_blas_threads_local(blas_threads);
+        plasma_tuning_restore(plasma, &tuning);
+        return info;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -62,57 +81,83 @@ int plasma_dgetrf(int m, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pA, lda, nb, nb,
+                                       m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
-    #pragma omp parallel
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
-        // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-    }
+        // Translate to tile layout by tile columns,
+        // so that the factorization starts as soon as the first column is in.
+        plasma_pdge2desc_colwise(pA, lda, A, &sequence, &request);
 
-    double start = omp_get_wtime();
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
-        plasma_omp_dgetrf(A, ipiv, sequence, &request);
-    }
-    double stop = omp_get_wtime();
-    _dgetrf_time = stop-start;
+        plasma_omp_dgetrf(A, ipiv, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
+        // Translate back to LAPACK layout as columns are finished.
+        plasma_pddesc2ge_getrf(A, pA, lda, &sequence, &request);
     }
+    // implicit synchronization
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
+    plasma_tuning_restore(plasma, &tuning);
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Same as plasma_dgetrf(), with the parameters of the context overridden by
+ *  options for this call only.
+ *
+ *******************************************************************************
+ *
+ * @param[in] options
+ *          The options of the call, initialized by plasma_options_init().
+ *          If NULL, the parameters of the context are used.
+ *
+ ******************************************************************************/
+int plasma_dgetrf_opts(int m, int n,
+                       double *pA, int lda, int *ipiv,
+                       const plasma_options_t *options)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Override the parameters for the call.
+    plasma_options_t saved;
+    int retval = plasma_options_apply(options, &saved);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_dgetrf(m, n, pA, lda, ipiv);
+
+    plasma_options_restore(&saved);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  ******************************************************************************/
@@ -151,3 +196,179 @@ void plasma_omp_dgetrf(plasma_desc_t A, int *ipiv,
     // Call the parallel function.
     plasma_pdgetrf(A, ipiv, sequence, request);
 }
+
+/******************************************************************************/
+// Runs plasma_omp_dgetrf() on A for plasma_predict_dgetrf(): on a random
+// matrix with the task counters on, to calibrate the model, or else in a dry
+// run, predicting *time.
+static int plasma_dgetrf_predict_run(plasma_context_t *plasma,
+                                     plasma_desc_t A,
+                                     int calibrate, plasma_time_t *time)
+{
+    plasma_enum_t stats;
+    plasma_enum_t dry_run;
+    int retval = calibrate ? plasma_predict_calibrate_begin(&stats)
+                           : plasma_predict_run_begin(&dry_run);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->num_panel_threads);
+
+    int *ipiv = (int*)malloc((size_t)imin(A.m, A.n)*sizeof(int));
+    if (ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_set(calibrate ? PlasmaStats : PlasmaDryRun,
+                   calibrate ? stats : dry_run);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    if (calibrate) {
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_dplrnt(3172, A, &sequence, &request);
+        }
+
+        // Count the factorization only.
+        plasma_stats_reset();
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_dgetrf(A, ipiv, &sequence, &request);
+    }
+    // implicit synchronization
+
+    free(ipiv);
+
+    retval = sequence.status;
+    if (calibrate) {
+        if (retval == PlasmaSuccess)
+            return plasma_predict_calibrate_end("dgetrf", stats);
+        plasma_set(PlasmaStats, stats);
+    }
+    else {
+        int status = plasma_predict_run_end(dry_run, time);
+        if (retval == PlasmaSuccess)
+            retval = status;
+    }
+    return retval;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_predict
+ *
+ *  Predicts the time of plasma_dgetrf() for an m-by-n matrix, with the
+ *  parameters the call would use, by the performance model of
+ *  plasma_predict.h. On the first prediction at a tile size, calibrates the
+ *  model by factoring a random matrix of at most
+ *  PlasmaPredictCalibrationTiles tiles per dimension. Does not allocate any
+ *  m-by-n matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[out] time
+ *          The predicted time of the call in seconds.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval PlasmaErrorNotSupported if PLASMA was built without
+ *         -DPLASMA_WITH_TRACE
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgetrf
+ * @sa plasma_predict_cgetrf
+ * @sa plasma_predict_dgetrf
+ * @sa plasma_predict_sgetrf
+ *
+ ******************************************************************************/
+int plasma_predict_dgetrf(int m, int n, plasma_time_t *time)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (time == NULL) {
+        plasma_error("NULL time");
+        return -3;
+    }
+
+    // quick return
+    *time = 0.0;
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "dgetrf", imax(m, n), &tuning);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Calibrate the model on a random matrix of a few tiles.
+    plasma_desc_t A;
+    int retval;
+    if (!plasma_predict_calibrated("dgetrf")) {
+        int mc = imin(m, PlasmaPredictCalibrationTiles*nb);
+        int nc = imin(n, PlasmaPredictCalibrationTiles*nb);
+        retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            mc, nc, 0, 0, mc, nc, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+        retval = plasma_dgetrf_predict_run(plasma, A, 1, time);
+        plasma_desc_destroy(&A);
+        if (retval != PlasmaSuccess) {
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+    }
+
+    // Record and cost the task graph of the call.
+    retval = plasma_predict_desc_create(PlasmaRealDouble, nb, nb,
+                                        m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+    retval = plasma_dgetrf_predict_run(plasma, A, 0, time);
+    plasma_predict_desc_destroy(&A);
+
+    plasma_tuning_restore(plasma, &tuning);
+    return retval;
+}
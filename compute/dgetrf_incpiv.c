@@ -0,0 +1,310 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrf_incpiv.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf_incpiv
+ *
+ *  Computes a tile LU factorization of a real or complex m-by-n matrix A
+ *  with incremental pivoting: each tile below the diagonal is factored
+ *  together with the upper triangle of the diagonal tile, with partial
+ *  pivoting between the two tiles only. The pivoting is therefore local
+ *  to pairs of tiles, which exposes the parallelism of the tile QR
+ *  factorization, at the price of a weaker stability than the partial
+ *  pivoting of plasma_dgetrf.
+ *
+ *  The factor L is not stored as a triangular matrix, and the factorization
+ *  can only be used through plasma_dgetrs_incpiv.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, pointer to the m-by-n matrix A.
+ *          On exit, the upper trapezoidal factor U on and above the diagonal,
+ *          and the factors of the tiles below the diagonal.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] L
+ *          On exit, the blocks of the factors L of the pairs of tiles,
+ *          required by plasma_dgetrs_incpiv.
+ *          Matrix in L is allocated inside this function and needs to be
+ *          destroyed by plasma_desc_destroy.
+ *
+ * @param[out] ipiv
+ *          On exit, the pivot indices of the pairs of tiles, required by
+ *          plasma_dgetrs_incpiv.
+ *          The array is allocated inside this function and needs to be
+ *          freed by free.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U(i,i) is exactly zero. The factorization has been
+ *         completed, but the factor U is exactly singular, and division
+ *         by zero will occur if it is used to solve a system of equations.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dgetrf_incpiv
+ * @sa plasma_cgetrf_incpiv
+ * @sa plasma_dgetrf_incpiv
+ * @sa plasma_sgetrf_incpiv
+ * @sa plasma_dgetrs_incpiv
+ *
+ ******************************************************************************/
+int plasma_dgetrf_incpiv(int m, int n,
+                         double *pA, int lda,
+                         plasma_desc_t *L, int **ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (L == NULL) {
+        plasma_error("NULL L");
+        return -5;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        return -6;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "dgetrf_incpiv", imax(m, n), &tuning);
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pA, lda, nb, nb,
+                                       m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+
+    // Prepare descriptor L, with the tiles of the T of a QR factorization.
+    retval = plasma_descT_compact_create(A, ib, PlasmaFlatHouseholder,
+                                         PlasmaColumnwise, L);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+
+    // Allocate the pivots, nb per tile of the lower trapezoid.
+    int kt = imin(A.mt, A.nt);
+    *ipiv = (int*)malloc((size_t)A.mt*kt*nb*sizeof(int));
+    if (*ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(L);
+        plasma_desc_destroy(&A);
+        plasma_tuning_restore(plasma, &tuning);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = (size_t)(ib+nb)*ib;  // tstrf: coupled blocks
+    retval = plasma_workspace_create(&work, lwork, PlasmaRealDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dgetrf_incpiv(A, *L, *ipiv, work, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    plasma_tuning_restore(plasma, &tuning);
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf_incpiv
+ *
+ *  Computes a tile LU factorization of a matrix with incremental pivoting.
+ *  Non-blocking tile version of plasma_dgetrf_incpiv().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A, of square tiles.
+ *          A is stored in the tile layout.
+ *
+ * @param[out] L
+ *          Descriptor of matrix L, of ib-by-nb tiles, created by
+ *          plasma_descT_compact_create for the columnwise storage.
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of size A.mt*min(A.mt,A.nt)*A.nb.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          For the incremental pivoting, contains (ib+nb)*ib elements per
+ *          thread. Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgetrf_incpiv
+ * @sa plasma_omp_cgetrf_incpiv
+ * @sa plasma_omp_dgetrf_incpiv
+ * @sa plasma_omp_sgetrf_incpiv
+ * @sa plasma_omp_dgetrs_incpiv
+ *
+ ******************************************************************************/
+void plasma_omp_dgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.mb != A.nb) {
+        plasma_error("A tiles not square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(L) != PlasmaSuccess) {
+        plasma_error("invalid L");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(A.m, A.n) == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdgetrf_incpiv(A, L, ipiv, work, sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlacpy.c, normal z -> d, Mon Feb  6 14:06:34 2017
+ * @generated from compute/zlacpy.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -125,31 +125,27 @@ int plasma_dlacpy(plasma_enum_t uplo,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_dlacpy(uplo, A, B, sequence, &request);
+        plasma_omp_dlacpy(uplo, A, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -158,8 +154,7 @@ int plasma_dlacpy(plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -183,10 +178,12 @@ int plasma_dlacpy(plasma_enum_t uplo,
  *            - PlasmaLower:   Lower triangular part of A
  *
  * @param[in] A
- *          Descriptor of matrix A.
+ *          Descriptor of matrix A, whose tiles may be packed
+ *          (plasma_desc_general_packed_create).
  *
  * @param[out] B
- *          Descriptor of matrix B.
+ *          Descriptor of matrix B, whose tiles may be packed,
+ *          at the rate of A or another one.
  *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlag2c.c, mixed zc -> ds, Mon Feb  6 14:06:34 2017
+ * @generated from compute/zlag2c.c, mixed zc -> ds, Thu Oct 15 07:33:58 2026
  *
  **/
 
@@ -109,31 +109,27 @@ int plasma_dlag2s(int m, int n,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA,  lda,  A,  sequence, &request);
-        plasma_omp_sge2desc(pAs, ldas, As, sequence, &request);
+        plasma_omp_dge2desc(pA,  lda,  A,  &sequence, &request);
+        plasma_omp_sge2desc(pAs, ldas, As, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_dlag2s(A, As, sequence, &request);
+        plasma_omp_dlag2s(A, As, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A,  pA,  lda,  sequence, &request);
-        plasma_omp_sdesc2ge(As, pAs, ldas, sequence, &request);
+        plasma_omp_ddesc2ge(A,  pA,  lda,  &sequence, &request);
+        plasma_omp_sdesc2ge(As, pAs, ldas, &sequence, &request);
     }
     // implicit synchronization
 
@@ -142,8 +138,7 @@ int plasma_dlag2s(int m, int n,
     plasma_desc_destroy(&As);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
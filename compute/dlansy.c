@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zlansy.c, normal z -> d, Mon Feb  6 14:06:35 2017
+ * @generated from compute/zlansy.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -144,13 +144,8 @@ double plasma_dlansy(plasma_enum_t norm, plasma_enum_t uplo,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
@@ -158,14 +153,15 @@ double plasma_dlansy(plasma_enum_t norm, plasma_enum_t uplo,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_dlansy(norm, uplo, A, work, &value, sequence, &request);
+        plasma_omp_dlansy(norm, uplo, A, work, &value, &sequence, &request);
     }
     // implicit synchronization
 
@@ -174,9 +170,6 @@ double plasma_dlansy(plasma_enum_t norm, plasma_enum_t uplo,
     // Free matrix in tile layout.
     plasma_desc_destroy(&A);
 
-    // Destroy sequence.
-    plasma_sequence_destroy(sequence);
-
     // Return the norm.
     return value;
 }
@@ -0,0 +1,684 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpipeline.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <math.h>
+
+/******************************************************************************/
+static void plasma_dpipeline_lascl_kernel(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb)
+{
+    core_dlascl(uplo, op->cfrom, op->cto, m, n, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_dpipeline_laset_kernel(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb)
+{
+    core_dlaset(uplo, m, n, op->alpha, diag ? op->beta : op->alpha, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_dpipeline_geadd_kernel(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb)
+{
+    core_dgeadd(op->transa, m, n, op->alpha, A, lda, op->beta, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_dpipeline_tradd_kernel(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb)
+{
+    core_dtradd(uplo, op->transa, m, n, op->alpha, A, lda, op->beta, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_dpipeline_lacpy_kernel(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb)
+{
+    core_dlacpy(uplo, m, n, A, lda, B, ldb);
+}
+
+/***************************************************************************//**
+ *  Returns the operand of the pipeline that is the matrix C, or
+ *  pipeline->num_operands if C is new, or -1 if C is another view of
+ *  the matrix of an operand, whose tiles would not match.
+ **/
+static int plasma_dpipeline_operand(plasma_dpipeline_t *pipeline,
+                                    plasma_desc_t C)
+{
+    for (int k = 0; k < pipeline->num_operands; k++) {
+        plasma_desc_t D = pipeline->operands[k];
+        if (D.matrix == C.matrix) {
+            if (D.i == C.i && D.j == C.j && D.m == C.m && D.n == C.n)
+                return k;
+            else
+                return -1;
+        }
+    }
+    return pipeline->num_operands;
+}
+
+/***************************************************************************//**
+ *  Appends the operation op of B, with the source A if not NULL, to the
+ *  pipeline. Each task of the pipeline updates the tile (m, n) of all the
+ *  updated matrices, so all of them have the tiles of B, and a source read
+ *  transposed, at the tile (n, m), is not updated by the pipeline.
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorIllegalValue if the matrices do not match
+ * @retval PlasmaErrorNotSupported if the pipeline is full
+ **/
+int plasma_dpipeline_append(plasma_dpipeline_t *pipeline,
+                            plasma_dpipeline_op_t op,
+                            const plasma_desc_t *A, plasma_desc_t B)
+{
+    if (pipeline->num_ops == PlasmaPipelineMaxOps) {
+        plasma_error("too many operations in the pipeline");
+        return PlasmaErrorNotSupported;
+    }
+
+    // The tiles of the updated matrices.
+    if (pipeline->num_ops > 0) {
+        plasma_desc_t C = pipeline->operands[pipeline->ops[0].b];
+        if (B.m != C.m || B.n != C.n || B.mb != C.mb || B.nb != C.nb) {
+            plasma_error("tiles of B do not match the pipeline");
+            return PlasmaErrorIllegalValue;
+        }
+    }
+    int trans = A != NULL && op.transa != PlasmaNoTrans;
+    if (A != NULL) {
+        if (( trans && (A->m != B.n || A->n != B.m ||
+                        A->mb != B.nb || A->nb != B.mb)) ||
+            (!trans && (A->m != B.m || A->n != B.n ||
+                        A->mb != B.mb || A->nb != B.nb))) {
+            plasma_error("tiles of A do not match B");
+            return PlasmaErrorIllegalValue;
+        }
+    }
+
+    // Find the operands, without adding them yet.
+    int num_operands = pipeline->num_operands;
+    int a = -1;
+    if (A != NULL) {
+        a = plasma_dpipeline_operand(pipeline, *A);
+        if (a == pipeline->num_operands)
+            num_operands++;
+    }
+    int b = plasma_dpipeline_operand(pipeline, B);
+    if (b == pipeline->num_operands) {
+        if (a == pipeline->num_operands && A->matrix == B.matrix) {
+            if (A->i == B.i && A->j == B.j && A->m == B.m && A->n == B.n)
+                b = a;
+            else
+                b = -1;
+        }
+        else {
+            b = num_operands++;
+        }
+    }
+    if ((A != NULL && a == -1) || b == -1) {
+        plasma_error("overlapping views in the pipeline");
+        return PlasmaErrorIllegalValue;
+    }
+    if (num_operands > PlasmaPipelineMaxOperands) {
+        plasma_error("too many matrices in the pipeline");
+        return PlasmaErrorNotSupported;
+    }
+
+    // A matrix is read either at the tile (m, n) or at the tile (n, m),
+    // and only in the first case updated.
+    int new_a = a >= pipeline->num_operands;
+    int new_b = b >= pipeline->num_operands;
+    if (A != NULL && (a == b ? trans
+                             : !new_a && pipeline->read_trans[a] != trans)) {
+        plasma_error("A is read both transposed and not");
+        return PlasmaErrorIllegalValue;
+    }
+    if (!new_b && pipeline->read_trans[b]) {
+        plasma_error("B is read transposed in the pipeline");
+        return PlasmaErrorIllegalValue;
+    }
+
+    // Add the operands and the operation.
+    if (new_a) {
+        pipeline->operands[a] = *A;
+        pipeline->written[a] = 0;
+        pipeline->read_trans[a] = trans;
+    }
+    if (new_b) {
+        pipeline->operands[b] = B;
+        pipeline->written[b] = 0;
+        pipeline->read_trans[b] = 0;
+    }
+    pipeline->written[b] = 1;
+    pipeline->num_operands = num_operands;
+
+    op.a = a;
+    op.b = b;
+    pipeline->ops[pipeline->num_ops++] = op;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Initializes an empty pipeline of element-wise tile operations.
+ *  The operations recorded by plasma_dpipeline_lascl, plasma_dpipeline_laset,
+ *  plasma_dpipeline_geadd, plasma_dpipeline_tradd, plasma_dpipeline_lacpy,
+ *  plasma_dpipeline_dlag2s and plasma_dpipeline_clag2z are run in order by
+ *  plasma_dpipeline_run, as one task per tile instead of one sweep over the
+ *  matrices per operation. At most PlasmaPipelineMaxOps operations of at
+ *  most PlasmaPipelineMaxOperands matrices are recorded.
+ *
+ *******************************************************************************
+ *
+ * @param[out] pipeline
+ *          The pipeline.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpipeline_run
+ * @sa plasma_cpipeline_init
+ * @sa plasma_dpipeline_init
+ * @sa plasma_spipeline_init
+ *
+ ******************************************************************************/
+void plasma_dpipeline_init(plasma_dpipeline_t *pipeline)
+{
+    pipeline->num_ops = 0;
+    pipeline->num_operands = 0;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records A = (cto/cfrom) A in the uplo part of A, as plasma_omp_dlascl.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline.
+ *
+ * @param[in] uplo
+ *          - PlasmaGeneral: A is a general matrix.
+ *          - PlasmaUpper:   A is an upper triangular matrix.
+ *          - PlasmaLower:   A is a lower triangular matrix.
+ *
+ * @param[in] cfrom
+ *          The matrix A is multiplied by cto/cfrom. cfrom must be nonzero.
+ *
+ * @param[in] cto
+ *          The matrix A is multiplied by cto/cfrom.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int plasma_dpipeline_lascl(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           double cfrom, double cto, plasma_desc_t A)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if ((uplo != PlasmaGeneral) &&
+        (uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (cfrom == 0.0 || isnan(cfrom)) {
+        plasma_error("illegal value of cfrom");
+        return -3;
+    }
+    if (isnan(cto)) {
+        plasma_error("illegal value of cto");
+        return -4;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -5;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_lascl_kernel,
+        .uplo = uplo, .transa = PlasmaNoTrans,
+        .cfrom = cfrom, .cto = cto
+    };
+    return plasma_dpipeline_append(pipeline, op, NULL, A);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records setting the uplo part of A to beta on the diagonal and alpha
+ *  off the diagonal, as plasma_omp_dlaset.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline.
+ *
+ * @param[in] uplo
+ *          - PlasmaGeneral: All of A is set.
+ *          - PlasmaUpper:   The upper triangle of A is set.
+ *          - PlasmaLower:   The lower triangle of A is set.
+ *
+ * @param[in] alpha
+ *          The value of the off-diagonal elements.
+ *
+ * @param[in] beta
+ *          The value of the diagonal elements.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int plasma_dpipeline_laset(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           double alpha, double beta,
+                           plasma_desc_t A)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if ((uplo != PlasmaGeneral) &&
+        (uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -5;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_laset_kernel,
+        .uplo = uplo, .transa = PlasmaNoTrans,
+        .alpha = alpha, .beta = beta
+    };
+    return plasma_dpipeline_append(pipeline, op, NULL, A);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records B = alpha op(A) + beta B, as plasma_omp_dgeadd.
+ *  A matrix read transposed cannot be updated in the pipeline.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   op(A) = A
+ *          - PlasmaTrans:     op(A) = A^T
+ *          - PlasmaConjTrans: op(A) = A^T
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int plasma_dpipeline_geadd(plasma_dpipeline_t *pipeline, plasma_enum_t transa,
+                           double alpha, plasma_desc_t A,
+                           double beta,  plasma_desc_t B)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -2;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -4;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        return -6;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_geadd_kernel,
+        .uplo = PlasmaGeneral, .transa = transa,
+        .alpha = alpha, .beta = beta
+    };
+    return plasma_dpipeline_append(pipeline, op, &A, B);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records B = alpha op(A) + beta B in the uplo triangle of B,
+ *  as plasma_omp_dtradd.
+ *  A matrix read transposed cannot be updated in the pipeline.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangular matrices.
+ *          - PlasmaLower: Lower triangular matrices.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   op(A) = A
+ *          - PlasmaTrans:     op(A) = A^T
+ *          - PlasmaConjTrans: op(A) = A^T
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int plasma_dpipeline_tradd(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_enum_t transa,
+                           double alpha, plasma_desc_t A,
+                           double beta,  plasma_desc_t B)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -3;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -5;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        return -7;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_tradd_kernel,
+        .uplo = uplo, .transa = transa,
+        .alpha = alpha, .beta = beta
+    };
+    return plasma_dpipeline_append(pipeline, op, &A, B);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records copying the uplo part of A to B, as plasma_omp_dlacpy.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline.
+ *
+ * @param[in] uplo
+ *          - PlasmaGeneral: All of A is copied.
+ *          - PlasmaUpper:   The upper triangle of A is copied.
+ *          - PlasmaLower:   The lower triangle of A is copied.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int plasma_dpipeline_lacpy(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_desc_t A, plasma_desc_t B)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if ((uplo != PlasmaGeneral) &&
+        (uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -3;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        return -4;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_lacpy_kernel,
+        .uplo = uplo, .transa = PlasmaNoTrans
+    };
+    return plasma_dpipeline_append(pipeline, op, &A, B);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Runs the operations of a pipeline in order, as one task per tile.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pipeline
+ *          The pipeline, recorded on matrices in tile layout.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dpipeline_run
+ * @sa plasma_dpipeline_init
+ *
+ ******************************************************************************/
+int plasma_dpipeline_run(plasma_dpipeline_t *pipeline)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+
+    // quick return
+    if (pipeline->num_ops == 0)
+        return PlasmaSuccess;
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_dpipeline_run(pipeline, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Runs the operations of a pipeline in order, as one task per tile.
+ *  Non-blocking tile version of plasma_dpipeline_run().
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *  The pipeline is copied, so it can be changed on return.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pipeline
+ *          The pipeline, recorded on matrices in tile layout.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpipeline_run
+ *
+ ******************************************************************************/
+void plasma_omp_dpipeline_run(plasma_dpipeline_t *pipeline,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (pipeline->num_ops == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdpipeline(*pipeline, sequence, request);
+}
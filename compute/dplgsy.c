@@ -0,0 +1,209 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zplgsy.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_plrnt
+ *
+ *  Generates an n-by-n random symmetric matrix A, with bump added to its
+ *  diagonal. The lower triangle is that of plasma_dplrnt, and the upper
+ *  triangle its transpose. With |bump| >= n, A is diagonally dominant.
+ *  The tiles are generated in parallel, and A depends only on n and on the
+ *  seed, not on the tile size nor on the number of threads.
+ *
+ *******************************************************************************
+ *
+ * @param[in] bump
+ *          The scalar added to the diagonal.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[out] pA
+ *          The n-by-n matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] seed
+ *          The seed of the random numbers.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dplgsy
+ * @sa plasma_cplgsy
+ * @sa plasma_dplgsy
+ * @sa plasma_splgsy
+ * @sa plasma_dplrnt
+ *
+ ******************************************************************************/
+int plasma_dplgsy(double bump, int n,
+                  double *pA, int lda,
+                  unsigned long long seed)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix, the array pA itself when translated in place.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pA, lda, nb, nb,
+                                       n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Call the tile async function.
+        plasma_omp_dplgsy(bump, seed, A, &sequence, &request);
+
+        // Translate to LAPACK layout, with no translation from it,
+        // since every tile is overwritten.
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_plrnt
+ *
+ *  Generates a random symmetric matrix A, one task per tile.
+ *  Non-blocking tile version of plasma_dplgsy().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] bump
+ *          The scalar added to the diagonal.
+ *
+ * @param[in] seed
+ *          The seed of the random numbers.
+ *
+ * @param[out] A
+ *          Descriptor of the square matrix A.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dplgsy
+ * @sa plasma_omp_cplgsy
+ * @sa plasma_omp_dplgsy
+ * @sa plasma_omp_splgsy
+ *
+ ******************************************************************************/
+void plasma_omp_dplgsy(double bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (A.type != PlasmaGeneral || plasma_desc_check(A) != PlasmaSuccess ||
+        A.m != A.n) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdplgsy(bump, seed, A, sequence, request);
+}
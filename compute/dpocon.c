@@ -0,0 +1,139 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpocon.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pocon
+ *
+ *  Estimates the reciprocal of the condition number of a symmetric
+ *  positive definite matrix A, in the one norm, from its Cholesky
+ *  factorization by plasma_dpotrf,
+ *    \f[ rcond = \frac{1}{\|A\| \|A^{-1}\|}. \f]
+ *
+ *  The norm of A^{-1} is estimated by the block estimator of Higham and
+ *  Tisseur, with the tile triangular solves with the factors on a block
+ *  of vectors, see plasma_dpocon_tile.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A = U^T U, with U in the upper triangle;
+ *          - PlasmaLower: A = L L^T, with L in the lower triangle.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The Cholesky factor of A, as computed by plasma_dpotrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] Anorm
+ *          The one norm of the original matrix A.
+ *
+ * @param[out] rcond
+ *          The reciprocal of the condition number estimate.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpocon_tile
+ * @sa plasma_dpotrf
+ * @sa plasma_cpocon
+ * @sa plasma_dpocon
+ * @sa plasma_spocon
+ *
+ ******************************************************************************/
+int plasma_dpocon(plasma_enum_t uplo, int n,
+                  double *pA, int lda,
+                  double Anorm, double *rcond)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (Anorm < 0.0) {
+        plasma_error("illegal value of Anorm");
+        return -5;
+    }
+    if (rcond == NULL) {
+        plasma_error("NULL rcond");
+        return -6;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    int status = sequence.status;
+    if (status == PlasmaSuccess)
+        status = plasma_dpocon_tile(uplo, A, Anorm, rcond);
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    return status;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zposv.c, normal z -> d, Mon Feb  6 14:06:38 2017
+ * @generated from compute/zposv.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -127,50 +127,47 @@ int plasma_dposv(plasma_enum_t uplo,
 
     // Set tiling parameters.
     int nb = plasma->nb;
+    int nbrhs = plasma_tile_rhs_nb(plasma, nb, nrhs);
 
     // Create tile matrices.
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pA, lda, nb, nb,
+                                       n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_lapack_create(PlasmaRealDouble, pB, ldb, nb, nbrhs,
+                                       n, nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_dposv(uplo, A, B, sequence, &request);
+        plasma_omp_dposv(uplo, A, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -179,8 +176,7 @@ int plasma_dposv(plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -282,19 +278,6 @@ void plasma_omp_dposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
     if (A.n == 0 || B.n == 0)
         return;
 
-    // Call the parallel functions.
-    plasma_pdpotrf(uplo, A, sequence, request);
-
-    plasma_enum_t trans;
-    trans = uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
-    plasma_pdtrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
-                  1.0, A,
-                       B,
-                  sequence, request);
-
-    trans = uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans;
-    plasma_pdtrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
-                  1.0, A,
-                       B,
-                  sequence, request);
+    // Call the parallel function.
+    plasma_pdposv(uplo, A, B, sequence, request);
 }
@@ -6,19 +6,21 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zpotrf.c, normal z -> d, Mon Feb  6 14:06:38 2017
+ * @generated from compute/zpotrf.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
 #include "plasma.h"
 #include "plasma_async.h"
+#include "plasma_blas_threads.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_predict.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
-
-#include <omp.h>
+#include "core_blas.h"
 
 /***************************************************************************//**
  *
@@ -33,6 +35,9 @@
  *
  *  where U is an upper triangular matrix and L is a lower triangular matrix.
  *
+ *  With PlasmaSmallPath on, the default, a matrix of order at most nb is
+ *  factored by a single call of LAPACK on pA, without tiles or tasks.
+ *
  *******************************************************************************
  *
  * @param[in] uplo
@@ -72,9 +77,6 @@
  * @sa plasma_spotrf
  *
  ******************************************************************************/
-
-double _dpotrf_time;
-
 int plasma_dpotrf(plasma_enum_t uplo,
                   int n,
                   double *pA, int lda)
@@ -105,53 +107,53 @@ int plasma_dpotrf(plasma_enum_t uplo,
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "dpotrf", n, &tuning);
+
+    // Call the kernel directly for a problem of a single tile.
+    if (plasma_small_path(plasma, n)) {
+        int blas_threads =
+            plasma_blas_threads_local(plasma_num_threads(plasma));
+        int info = core_dpotrf(uplo, n, pA, lda);
+        plasma_blas_threads_local(blas_threads);
+        plasma_tuning_restore(plasma, &tuning);
+        return info;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_lapack_triangular_create(PlasmaRealDouble, uplo,
+                                                  pA, lda, nb, nb, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_triangular_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-    }
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
 
-    double start = omp_get_wtime();
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
-        plasma_omp_dpotrf(uplo, A, sequence, &request);
-    }
-    double stop = omp_get_wtime();
-    _dpotrf_time = stop-start;
+        plasma_omp_dpotrf(uplo, A, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
@@ -159,11 +161,49 @@ int plasma_dpotrf(plasma_enum_t uplo,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
+    plasma_tuning_restore(plasma, &tuning);
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Same as plasma_dpotrf(), with the parameters of the context overridden by
+ *  options for this call only.
+ *
+ *******************************************************************************
+ *
+ * @param[in] options
+ *          The options of the call, initialized by plasma_options_init().
+ *          If NULL, the parameters of the context are used.
+ *
+ ******************************************************************************/
+int plasma_dpotrf_opts(plasma_enum_t uplo,
+                       int n,
+                       double *pA, int lda,
+                       const plasma_options_t *options)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Override the parameters for the call.
+    plasma_options_t saved;
+    int retval = plasma_options_apply(options, &saved);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_dpotrf(uplo, n, pA, lda);
+
+    plasma_options_restore(&saved);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_potrf
@@ -193,6 +233,9 @@ int plasma_dpotrf(plasma_enum_t uplo,
  *          upper triangular part of A is not referenced.
  *          On exit, if return value = 0, the factor U or L from the Cholesky
  *          factorization A = U^T*U or A = L*L^T.
+ *          If A is block-sparse, its pattern holds the fill-in of the
+ *          factorization, see plasma_desc_sparse_fill, and only the tiles
+ *          stored are factored.
  *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
@@ -241,6 +284,12 @@ void plasma_omp_dpotrf(plasma_enum_t uplo, plasma_desc_t A,
         plasma_error("invalid A");
         return;
     }
+    if (A.layout == PlasmaSparseLayout &&
+        !plasma_desc_sparse_filled(uplo, A)) {
+        plasma_error("pattern of A without the fill-in of the factorization");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
     if (sequence == NULL) {
         plasma_fatal_error("NULL sequence");
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
@@ -259,3 +308,166 @@ void plasma_omp_dpotrf(plasma_enum_t uplo, plasma_desc_t A,
     // Call the parallel function.
     plasma_pdpotrf(uplo, A, sequence, request);
 }
+
+/******************************************************************************/
+// Runs plasma_omp_dpotrf() on A for plasma_predict_dpotrf(): on a random
+// matrix with the task counters on, to calibrate the model, or else in a dry
+// run, predicting *time.
+static int plasma_dpotrf_predict_run(plasma_context_t *plasma,
+                                     plasma_enum_t uplo, plasma_desc_t A,
+                                     int calibrate, plasma_time_t *time)
+{
+    plasma_enum_t stats;
+    plasma_enum_t dry_run;
+    int retval = calibrate ? plasma_predict_calibrate_begin(&stats)
+                           : plasma_predict_run_begin(&dry_run);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    if (calibrate) {
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_dplgsy((double)A.m, 3172, A, &sequence, &request);
+        }
+
+        // Count the factorization only.
+        plasma_stats_reset();
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_dpotrf(uplo, A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    retval = sequence.status;
+    if (calibrate) {
+        if (retval == PlasmaSuccess)
+            return plasma_predict_calibrate_end("dpotrf", stats);
+        plasma_set(PlasmaStats, stats);
+    }
+    else {
+        int status = plasma_predict_run_end(dry_run, time);
+        if (retval == PlasmaSuccess)
+            retval = status;
+    }
+    return retval;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_predict
+ *
+ *  Predicts the time of plasma_dpotrf() for a matrix of order n, with the
+ *  parameters the call would use, by the performance model of
+ *  plasma_predict.h. On the first prediction at a tile size, calibrates the
+ *  model by factoring a random matrix of order at most
+ *  PlasmaPredictCalibrationTiles*nb. Does not allocate any matrix of order n.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[out] time
+ *          The predicted time of the call in seconds.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval PlasmaErrorNotSupported if PLASMA was built without
+ *         -DPLASMA_WITH_TRACE
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf
+ * @sa plasma_predict_cpotrf
+ * @sa plasma_predict_dpotrf
+ * @sa plasma_predict_spotrf
+ *
+ ******************************************************************************/
+int plasma_predict_dpotrf(plasma_enum_t uplo, int n, plasma_time_t *time)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (time == NULL) {
+        plasma_error("NULL time");
+        return -3;
+    }
+
+    // quick return
+    *time = 0.0;
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "dpotrf", n, &tuning);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Calibrate the model on a random matrix of a few tiles.
+    plasma_desc_t A;
+    int retval;
+    if (!plasma_predict_calibrated("dpotrf")) {
+        int nc = imin(n, PlasmaPredictCalibrationTiles*nb);
+        retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            nc, nc, 0, 0, nc, nc, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+        retval = plasma_dpotrf_predict_run(plasma, uplo, A, 1, time);
+        plasma_desc_destroy(&A);
+        if (retval != PlasmaSuccess) {
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+    }
+
+    // Record and cost the task graph of the call.
+    retval = plasma_predict_desc_create(PlasmaRealDouble, nb, nb,
+                                        n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+    retval = plasma_dpotrf_predict_run(plasma, uplo, A, 0, time);
+    plasma_predict_desc_destroy(&A);
+
+    plasma_tuning_restore(plasma, &tuning);
+    return retval;
+}
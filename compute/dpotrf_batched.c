@@ -0,0 +1,298 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_batched.c, normal z -> d, Thu Oct 15 07:38:56 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a batch of independent symmetric
+ *  positive definite matrices A_i of the same size.
+ *  Each factorization runs sequentially in core_dpotrf, and the batch is
+ *  spread across the threads in a single parallel region, without tile
+ *  layout. Intended for many small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangles of A_i are stored;
+ *          - PlasmaLower: Lower triangles of A_i are stored.
+ *
+ * @param[in] n
+ *          The order of the matrices A_i. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the n-by-n matrices A_i.
+ *          On exit, the factors U or L of A_i, as in plasma_dpotrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,n).
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, or j > 0
+ *          if the leading minor of order j of A_i is not positive definite.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf
+ * @sa plasma_cpotrf_batched
+ * @sa plasma_dpotrf_batched
+ * @sa plasma_spotrf_batched
+ *
+ ******************************************************************************/
+int plasma_dpotrf_batched(plasma_enum_t uplo, int n,
+                          double **pA, int lda,
+                          int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -5;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -6;
+    }
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i++)
+        info[i] = core_dpotrf(uplo, n, pA[i], lda);
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a batch of independent symmetric
+ *  positive definite matrices A_i of sizes of their own, in a single
+ *  parallel region. The matrices larger than the tile size are factored
+ *  by the tile algorithm across the threads, the largest first, and the
+ *  others sequentially in core_dpotrf, packed many per task by decreasing
+ *  cost, so that the small matrices fill the threads left idle by the
+ *  large ones.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangles of A_i are stored;
+ *          - PlasmaLower: Lower triangles of A_i are stored.
+ *
+ * @param[in] n
+ *          Array of batch_count orders of the matrices A_i. n[i] >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the n[i]-by-n[i] matrices A_i.
+ *          On exit, the factors U or L of A_i, as in plasma_dpotrf.
+ *
+ * @param[in] lda
+ *          Array of batch_count leading dimensions of the arrays A_i.
+ *          lda[i] >= max(1,n[i]).
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, j > 0
+ *          if the leading minor of order j of A_i is not positive definite,
+ *          or < 0 if the tile algorithm failed on A_i.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf_batched
+ * @sa plasma_cpotrf_vbatched
+ * @sa plasma_dpotrf_vbatched
+ * @sa plasma_spotrf_vbatched
+ *
+ ******************************************************************************/
+int plasma_dpotrf_vbatched(plasma_enum_t uplo, const int *n,
+                           double **pA, const int *lda,
+                           int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n == NULL && batch_count > 0) {
+        plasma_error("NULL n");
+        return -2;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -3;
+    }
+    if (lda == NULL && batch_count > 0) {
+        plasma_error("NULL lda");
+        return -4;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -5;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -6;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, n[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Schedule the matrices by their sizes.
+    plasma_batch_item_t *items = (plasma_batch_item_t*)malloc(
+        batch_count*sizeof(plasma_batch_item_t));
+    int *chunk = (int*)malloc((batch_count+1)*sizeof(int));
+    if (items == NULL || chunk == NULL) {
+        free(items);
+        free(chunk);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        items[i].cost = (double)n[i]*n[i]*n[i]/3.0;
+        items[i].index = i;
+        items[i].large = n[i] > nb;
+    }
+    int num_chunks = plasma_batch_schedule(items, batch_count, nb,
+                                           plasma_num_threads(plasma), chunk);
+    int num_large = chunk[0];
+
+    // Create the tile matrices and the sequences of the large matrices.
+    for (int l = 0; l < num_large; l++) {
+        int i = items[l].index;
+        int retval = plasma_desc_lapack_triangular_create(
+            PlasmaRealDouble, uplo, pA[i], lda[i], nb, nb, n[i],
+            &items[l].desc[0]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_lapack_triangular_create() failed");
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].num_descs = 1;
+        retval = plasma_sequence_create(&items[l].sequence);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_sequence_create() failed");
+            plasma_desc_destroy(&items[l].desc[0]);
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].request = PlasmaRequestInitializer;
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // the large matrices, by the tile algorithm
+        for (int l = 0; l < num_large; l++) {
+            int i = items[l].index;
+            plasma_desc_t A = items[l].desc[0];
+            plasma_omp_dge2desc(pA[i], lda[i], A,
+                                items[l].sequence, &items[l].request);
+            plasma_omp_dpotrf(uplo, A,
+                              items[l].sequence, &items[l].request);
+            plasma_omp_ddesc2ge(A, pA[i], lda[i],
+                                items[l].sequence, &items[l].request);
+        }
+        // the small matrices, many per task
+        for (int j = 0; j < num_chunks; j++) {
+            #pragma omp task firstprivate(j)
+            {
+                for (int l = chunk[j]; l < chunk[j+1]; l++) {
+                    int i = items[l].index;
+                    info[i] = core_dpotrf(uplo, n[i], pA[i], lda[i]);
+                }
+            }
+        }
+    }
+    // implicit synchronization
+
+    for (int l = 0; l < num_large; l++)
+        info[items[l].index] = items[l].sequence->status;
+
+    plasma_batch_destroy(items, num_large);
+    free(chunk);
+    return PlasmaSuccess;
+}
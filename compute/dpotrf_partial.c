@@ -0,0 +1,284 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_partial.c, normal z -> d, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the partial Cholesky factorization of a symmetric positive
+ *  definite matrix A, as the frontal matrices of the sparse direct solvers,
+ *
+ *    \f[ A = \begin{pmatrix} A_{11} & A_{21}^T \\ A_{21} & A_{22}
+ *        \end{pmatrix} = \begin{pmatrix} L_{11} & 0 \\ L_{21} & I
+ *        \end{pmatrix} \begin{pmatrix} I & 0 \\ 0 & S \end{pmatrix}
+ *        \begin{pmatrix} L_{11} & 0 \\ L_{21} & I \end{pmatrix}^T, \f]
+ *
+ *  or its upper counterpart, where A_11 is the leading k-by-k block.
+ *  A_11 is factored and A_22 replaced by its Schur complement
+ *  S = A_22 - L_21 L_21^T, which is not factored.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The order of the block A_11 factored, a multiple of the tile
+ *          size, or n. 0 <= k <= n.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric matrix A, of which A_11 is positive
+ *          definite, and the strictly other triangle is not referenced.
+ *          On exit, if return value = 0, the factors L_11 and L_21, or U_11
+ *          and U_12, and the uplo triangle of the Schur complement S.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A_11 is not
+ *          positive definite, so the factorization could not
+ *          be completed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dpotrf_partial
+ * @sa plasma_cpotrf_partial
+ * @sa plasma_dpotrf_partial
+ * @sa plasma_spotrf_partial
+ * @sa plasma_dpotrf
+ *
+ ******************************************************************************/
+int plasma_dpotrf_partial(plasma_enum_t uplo, int n, int k,
+                          double *pA, int lda)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0 || k > n || (k%nb != 0 && k != n)) {
+        plasma_error("illegal value of k");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+
+    // quick return
+    if (k == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_lapack_triangular_create(PlasmaRealDouble, uplo,
+                                                  pA, lda, nb, nb, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_triangular_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dpotrf_partial(uplo, k, A, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the partial Cholesky factorization of a symmetric positive
+ *  definite matrix.
+ *  Non-blocking tile version of plasma_dpotrf_partial().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  The factorization of A_11, the solve for L_21 and the update of the
+ *  Schur complement are submitted as the tasks of one graph, so that a
+ *  frontal matrix assembled in tile layout is factored, and its Schur
+ *  complement passed on in tile layout, without translations.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] k
+ *          The order of the block A_11 factored, a multiple of the tile
+ *          size, or A.n. 0 <= k <= A.n.
+ *
+ * @param[in,out] A
+ *          On entry, the symmetric matrix A, of which A_11 is positive
+ *          definite.
+ *          On exit, if return value = 0, the factors L_11 and L_21, or U_11
+ *          and U_12, and the uplo triangle of the Schur complement S.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf_partial
+ * @sa plasma_omp_cpotrf_partial
+ * @sa plasma_omp_dpotrf_partial
+ * @sa plasma_omp_spotrf_partial
+ * @sa plasma_omp_dpotrf
+ *
+ ******************************************************************************/
+void plasma_omp_dpotrf_partial(plasma_enum_t uplo, int k, plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (k < 0 || k > A.n || (k%A.nb != 0 && k != A.n)) {
+        plasma_error("illegal value of k");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (k == 0)
+        return;
+
+    // Call the parallel functions.
+    plasma_desc_t A11 = plasma_desc_view(A, 0, 0, k, k);
+    plasma_pdpotrf(uplo, A11, sequence, request);
+    if (k == A.n)
+        return;
+
+    plasma_desc_t A22 = plasma_desc_view(A, k, k, A.n-k, A.n-k);
+    if (uplo == PlasmaLower) {
+        plasma_desc_t A21 = plasma_desc_view(A, k, 0, A.n-k, k);
+        plasma_pdtrsm(PlasmaRight, PlasmaLower,
+                      PlasmaConjTrans, PlasmaNonUnit,
+                      1.0, A11,
+                           A21,
+                      sequence, request);
+        plasma_pdsyrk(PlasmaLower, PlasmaNoTrans,
+                      -1.0, A21,
+                       1.0, A22,
+                      sequence, request);
+    }
+    else {
+        plasma_desc_t A12 = plasma_desc_view(A, 0, k, k, A.n-k);
+        plasma_pdtrsm(PlasmaLeft, PlasmaUpper,
+                      PlasmaConjTrans, PlasmaNonUnit,
+                      1.0, A11,
+                           A12,
+                      sequence, request);
+        plasma_pdsyrk(PlasmaUpper, PlasmaConjTrans,
+                      -1.0, A12,
+                       1.0, A22,
+                      sequence, request);
+    }
+}
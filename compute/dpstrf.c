@@ -0,0 +1,264 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpstrf.c, normal z -> d, Thu Oct 15 08:37:15 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pstrf
+ *
+ *  Performs the Cholesky factorization with complete pivoting of a
+ *  symmetric positive semidefinite matrix A,
+ *
+ *    \f[ P^T A P = L \times L^T, \f]
+ *
+ *  where P is a permutation matrix and L is a lower triangular matrix,
+ *  from the lower triangle of A. The factorization stops once the largest
+ *  remaining diagonal element falls to the tolerance, which gives the rank
+ *  r of A and its first r columns of L. Only these are computed: the
+ *  trailing matrix is never updated, so that a factorization of rank r
+ *  costs O(n r^2) flops, in place of the O(n^3) of plasma_dpotrf(), for
+ *  the low-rank approximation of a kernel matrix, for instance.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric positive semidefinite matrix A, of which
+ *          the leading n-by-n lower triangular part is referenced.
+ *          On exit, the columns 0 to rank-1 of the lower triangle hold the
+ *          factor L. The trailing n-rank by n-rank block holds the entries
+ *          of P^T A P, not updated.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] piv
+ *          The permutation P, 1-based: row k of P^T A P is row piv[k]
+ *          of A. Of size n.
+ *
+ * @param[out] rank
+ *          The rank of A within the tolerance, the number of columns of L.
+ *
+ * @param[in] tol
+ *          The factorization stops at the first pivot, the largest
+ *          remaining diagonal element, lower than or equal to tol.
+ *          If tol < 0, n*eps*max(diag(A)) is used, as in LAPACK dpstrf.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dpstrf
+ * @sa plasma_cpstrf
+ * @sa plasma_dpstrf
+ * @sa plasma_spstrf
+ * @sa plasma_dpotrf
+ *
+ ******************************************************************************/
+int plasma_dpstrf(int n, double *pA, int lda,
+                  int *piv, int *rank, double tol)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -3;
+    }
+    if (piv == NULL) {
+        plasma_error("NULL piv");
+        return -4;
+    }
+    if (rank == NULL) {
+        plasma_error("NULL rank");
+        return -5;
+    }
+
+    // quick return
+    *rank = 0;
+    if (imax(n, 0) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_triangular_create(PlasmaRealDouble, PlasmaLower,
+                                           nb, nb, n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_triangular_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dpstrf(A, piv, rank, tol, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pstrf
+ *
+ *  Performs the Cholesky factorization with complete pivoting of a
+ *  symmetric positive semidefinite matrix.
+ *  Non-blocking tile version of plasma_dpstrf().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  As the pivot search reads the whole remaining diagonal, the
+ *  factorization waits for the tasks submitted before it, and piv and rank
+ *  are set on return.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          On entry, the symmetric positive semidefinite matrix A, of which
+ *          the lower triangle is referenced.
+ *          On exit, the columns 0 to rank-1 of the lower triangle hold the
+ *          factor L.
+ *
+ * @param[out] piv
+ *          The permutation P, 1-based: row k of P^T A P is row piv[k]
+ *          of A. Of size A.n.
+ *
+ * @param[out] rank
+ *          The rank of A within the tolerance, the number of columns of L.
+ *
+ * @param[in] tol
+ *          The factorization stops at the first pivot lower than or equal
+ *          to tol. If tol < 0, n*eps*max(diag(A)) is used.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpstrf
+ * @sa plasma_omp_cpstrf
+ * @sa plasma_omp_dpstrf
+ * @sa plasma_omp_spstrf
+ *
+ ******************************************************************************/
+void plasma_omp_dpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m != A.n || A.mb != A.nb) {
+        plasma_error("A not square or of square tiles");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (piv == NULL) {
+        plasma_error("NULL piv");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (rank == NULL) {
+        plasma_error("NULL rank");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    *rank = 0;
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdpstrf(A, piv, rank, tol, sequence, request);
+}
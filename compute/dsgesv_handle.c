@@ -0,0 +1,375 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zcgesv_handle.c, mixed zc -> ds, Thu Oct 15 11:00:48 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Computes the LU factorization of an n-by-n matrix A in single precision,
+ *  as plasma_dsgesv, and keeps it in tile layout with A and its infinity
+ *  norm, so that plasma_dsgetrs_handle solves systems with A by iterative
+ *  refinement without translating, factoring or reading A for its norm
+ *  again.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The n-by-n matrix A. Not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] handle
+ *          On exit, A, its factors in single precision and the pivot indices.
+ *          Must be freed by plasma_getrf_mixed_handle_destroy, also if the
+ *          factorization fails.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if U(i,i) is exactly zero in single precision.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dsgetrs_handle
+ * @sa plasma_getrf_mixed_handle_destroy
+ * @sa plasma_dsgesv
+ *
+ ******************************************************************************/
+int plasma_dsgetrf_handle_create(int n, double *pA, int lda,
+                                 plasma_getrf_mixed_handle_t *handle)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -3;
+    }
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return -4;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // The bfloat16 factorization is real only.
+    handle->bf16 = 0;
+#if defined(REAL)
+    handle->bf16 = plasma->factor_precision == PlasmaBfloat16Factor;
+#endif
+    handle->Anorm = 0.0;
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Create tile matrices.
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &handle->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &handle->As);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&handle->A);
+        return retval;
+    }
+    handle->ipiv = (int*)malloc((size_t)imax(1, n)*sizeof(int));
+    if (handle->ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(&handle->A);
+        plasma_desc_destroy(&handle->As);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    plasma_desc_t A = handle->A;
+    plasma_desc_t As = handle->As;
+
+    // Allocate workspace for the infinity norm.
+    double *work =
+        (double*)malloc(((size_t)A.nt*A.n+A.n)*sizeof(double));
+    if (work == NULL) {
+        plasma_error("malloc() failed");
+        plasma_getrf_mixed_handle_destroy(handle);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout, converting to single precision.
+        plasma_pdge2desc_lag2c(pA, lda, A, As, &sequence, &request);
+
+        // Factor As and compute the norm of A.
+        plasma_pdsgetrf(A, As, handle->ipiv, handle->bf16,
+                        work, &handle->Anorm, &sequence, &request);
+    }
+    // implicit synchronization
+
+    free(work);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Solves a system of linear equations A * X = B with the factorization kept
+ *  by plasma_dsgetrf_handle_create, by iterative refinement, as
+ *  plasma_dsgesv. Only B and X are translated, and the norm of A is the one
+ *  kept by the handle. If the refinement does not converge, the system is
+ *  solved by plasma_dgesv on a copy of A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] handle
+ *          The factorization of A.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns of B.
+ *          nrhs >= 0.
+ *
+ * @param[in] pB
+ *          The n-by-nrhs right hand side matrix B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[out] pX
+ *          If return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldx
+ *          The leading dimension of the array X. ldx >= max(1,n).
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax), where itermax = 30.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if the refinement failed and U(i,i) of the double precision
+ *         factorization is exactly zero.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dsgetrf_handle_create
+ * @sa plasma_dsgesv
+ *
+ ******************************************************************************/
+int plasma_dsgetrs_handle(plasma_getrf_mixed_handle_t handle, int nrhs,
+                          double *pB, int ldb,
+                          double *pX, int ldx, int *iter)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    plasma_desc_t A = handle.A;
+    plasma_desc_t As = handle.As;
+    int n = A.n;
+
+    if (A.precision != PlasmaRealDouble ||
+        As.precision != PlasmaRealFloat || handle.ipiv == NULL) {
+        plasma_error("invalid handle");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -4;
+    }
+    if (ldx < imax(1, n)) {
+        plasma_error("illegal value of ldx");
+        return -6;
+    }
+    if (iter == NULL) {
+        plasma_error("NULL iter");
+        return -7;
+    }
+
+    // quick return
+    *iter = 0;
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrices with the tiling of the factors.
+    plasma_desc_t B;
+    plasma_desc_t X;
+    plasma_desc_t R;
+    plasma_desc_t Xs;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, A.mb, A.nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, A.mb, A.nb,
+                                        n, nrhs, 0, 0, n, nrhs, &X);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, A.mb, A.nb,
+                                        n, nrhs, 0, 0, n, nrhs, &R);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, A.mb, A.nb,
+                                        n, nrhs, 0, 0, n, nrhs, &Xs);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&R);
+        return retval;
+    }
+
+    // Allocate workspaces for the norms of the residuals and the iterates.
+    double *work =
+        (double*)malloc(((size_t)X.mt*X.n+(size_t)R.mt*R.n)*sizeof(double));
+    double *Rnorm = (double*)malloc((size_t)R.n*sizeof(double));
+    double *Xnorm = (double*)malloc((size_t)X.n*sizeof(double));
+    if (work == NULL || Rnorm == NULL || Xnorm == NULL) {
+        plasma_error("malloc() failed");
+        retval = PlasmaErrorOutOfMemory;
+    }
+
+    if (retval != PlasmaSuccess) {
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&R);
+        plasma_desc_destroy(&Xs);
+        free(work);
+        free(Rnorm);
+        free(Xnorm);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout, converting B to single precision.
+        plasma_pdge2desc_lag2c(pB, ldb, B, Xs, &sequence, &request);
+
+        // Solve and refine.
+        plasma_pdsgesv_refine(A, As, handle.ipiv, handle.bf16, &handle.Anorm,
+                              B, X, Xs, R, work, Rnorm, Xnorm, iter,
+                              &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        if (*iter >= 0)
+            plasma_omp_ddesc2ge(X, pX, ldx, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&X);
+    plasma_desc_destroy(&R);
+    plasma_desc_destroy(&Xs);
+    free(work);
+    free(Rnorm);
+    free(Xnorm);
+
+    int status = sequence.status;
+    if (status != PlasmaSuccess || *iter >= 0)
+        return status;
+
+    // The refinement did not converge, solve in double precision
+    // on a copy of A, keeping the handle for the next solves.
+    double *pA =
+        (double*)malloc((size_t)n*n*sizeof(double));
+    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    if (pA == NULL || ipiv == NULL) {
+        plasma_error("malloc() failed");
+        free(pA);
+        free(ipiv);
+        return PlasmaErrorOutOfMemory;
+    }
+    status = plasma_ddesc2ge_sub(A, 0, 0, n, n, pA, n);
+    if (status == PlasmaSuccess) {
+        LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'F', n, nrhs, pB, ldb, pX, ldx);
+        status = plasma_dgesv(n, nrhs, pA, n, ipiv, pX, ldx);
+    }
+    free(pA);
+    free(ipiv);
+    return status;
+}
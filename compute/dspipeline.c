@@ -0,0 +1,145 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zcpipeline.c, mixed zc -> ds, Thu Oct 15 03:04:42 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/******************************************************************************/
+static void plasma_dpipeline_dlag2s_kernel(const plasma_dpipeline_op_t *op,
+                                           plasma_enum_t uplo, int diag,
+                                           int m, int n,
+                                           void *A, int lda,
+                                           void *B, int ldb)
+{
+    core_dlag2s(m, n, A, lda, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_dpipeline_slag2d_kernel(const plasma_dpipeline_op_t *op,
+                                           plasma_enum_t uplo, int diag,
+                                           int m, int n,
+                                           void *A, int lda,
+                                           void *B, int ldb)
+{
+    core_slag2d(m, n, A, lda, B, ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records the conversion of A from complex double to complex single
+ *  precision into As, as plasma_omp_dlag2s.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline, see plasma_dpipeline_init.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A, in complex double precision.
+ *
+ * @param[in] As
+ *          Descriptor of matrix As, in complex single precision.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpipeline_slag2d
+ * @sa plasma_dpipeline_dlag2s
+ *
+ ******************************************************************************/
+int plasma_dpipeline_dlag2s(plasma_dpipeline_t *pipeline,
+                            plasma_desc_t A, plasma_desc_t As)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    if (plasma_desc_check(As) != PlasmaSuccess) {
+        plasma_error("invalid As");
+        return -3;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_dlag2s_kernel,
+        .uplo = PlasmaGeneral, .transa = PlasmaNoTrans
+    };
+    return plasma_dpipeline_append(pipeline, op, &A, As);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records the conversion of As from complex single to complex double
+ *  precision into A, as plasma_omp_slag2d.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline, see plasma_dpipeline_init.
+ *
+ * @param[in] As
+ *          Descriptor of matrix As, in complex single precision.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A, in complex double precision.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpipeline_dlag2s
+ * @sa plasma_dpipeline_slag2d
+ *
+ ******************************************************************************/
+int plasma_dpipeline_slag2d(plasma_dpipeline_t *pipeline,
+                            plasma_desc_t As, plasma_desc_t A)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if (plasma_desc_check(As) != PlasmaSuccess) {
+        plasma_error("invalid As");
+        return -2;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -3;
+    }
+
+    plasma_dpipeline_op_t op = {
+        .kernel = plasma_dpipeline_slag2d_kernel,
+        .uplo = PlasmaGeneral, .transa = PlasmaNoTrans
+    };
+    return plasma_dpipeline_append(pipeline, op, &As, A);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zcposv.c, mixed zc -> ds, Mon Feb  6 14:06:26 2017
+ * @generated from compute/zcposv.c, mixed zc -> ds, Thu Oct 15 10:26:14 2026
  *
  **/
 
@@ -21,6 +21,161 @@
 #include <math.h>
 #include <omp.h>
 
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/******************************************************************************/
+// Solves A * X = B by the Cholesky factorization of As, the single
+// precision copy of A, with Xs holding B in single precision, and
+// iterative refinement in double precision, as plasma_omp_dsposv.
+static void plasma_dsposv_refine(plasma_enum_t uplo,
+                                 plasma_desc_t A,  plasma_desc_t B,
+                                 plasma_desc_t X,
+                                 plasma_desc_t As, plasma_desc_t Xs,
+                                 plasma_desc_t R,
+                                 double *work, double *Rnorm, double *Xnorm,
+                                 int *iter,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t  *request)
+{
+    const int    itermax = 30;
+    const double bwdmax  = 1.0;
+    const double zone  =  1.0;
+    *iter = 0;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // The bfloat16 factorization is real only
+    // and always refined by GMRES.
+    int bf16 = 0;
+#if defined(REAL)
+    bf16 = plasma->factor_precision == PlasmaBfloat16Factor;
+#endif
+
+    // Workspace for damax
+    double *workX = work;
+    double *workR = &work[X.mt*X.n];
+
+    // Compute some constants.
+    double cte;
+    double eps = LAPACKE_dlamch_work('E');
+    double Anorm;
+    plasma_pdlansy(PlasmaInfNorm, uplo, A, work, &Anorm, sequence, request);
+
+    // Compute the Cholesky factorization of As.
+    if (bf16)
+        plasma_psbpotrf(uplo, As, sequence, request);
+    else
+        plasma_pspotrf(uplo, As, sequence, request);
+
+    // Solve the system As * Xs = Bs.
+    plasma_pstrsm(PlasmaLeft, uplo,
+                  uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
+                  PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+    plasma_pstrsm(PlasmaLeft, uplo,
+                  uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
+                  PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+
+    // Convert Xs to double precision.
+    plasma_pslag2d(Xs, X, sequence, request);
+
+    // Compute R = B - A * X and its norm.
+    plasma_pdsyresid(uplo, A, X, B, R, workR, Rnorm, sequence, request);
+
+    // Check whether the nrhs normwise backward error satisfies the
+    // stopping criterion. If yes, set iter=0 and return.
+    plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+    #pragma omp taskwait
+    {
+        cte = Anorm * eps * sqrt((double)A.n) * bwdmax;
+        int flag = 1;
+        for (int n = 0; n < R.n && flag == 1; n++) {
+            if (Rnorm[n] > Xnorm[n] * cte) {
+                flag = 0;
+            }
+        }
+        if (flag == 1) {
+            *iter = 0;
+            return;
+        }
+    }
+
+    // The update of the iterate by the correction in Xs, R = Xs in double
+    // precision and X = X + R, in one pass over the tiles.
+    plasma_dpipeline_t update;
+    plasma_dpipeline_init(&update);
+    if (plasma_dpipeline_slag2d(&update, Xs, R) != PlasmaSuccess ||
+        plasma_dpipeline_geadd(&update, PlasmaNoTrans,
+                               zone, R, zone, X) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Iterative refinement
+    for (int iiter = 0; iiter < itermax; iiter++) {
+        if (plasma->refinement_mode == PlasmaGmresRefinement || bf16) {
+            // Solve the system A * D = R by GMRES preconditioned
+            // by the factor of As and update the current iterate.
+            plasma_pdsgmres(uplo, A, As, NULL, R, X, Xs,
+                            plasma->gmres_restart, sequence, request);
+        }
+        else {
+            // Convert R from double to single precision, store result in Xs.
+            plasma_pdlag2s(R, Xs, sequence, request);
+
+            // Solve the system As * Xs = Rs.
+            plasma_pstrsm(PlasmaLeft, uplo,
+                          uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
+                          PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+            plasma_pstrsm(PlasmaLeft, uplo,
+                          uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
+                          PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+
+            // Convert Xs back to double precision
+            // and update the current iterate.
+            plasma_pdpipeline(update, sequence, request);
+        }
+
+        // Compute R = B - A * X and its norm.
+        plasma_pdsyresid(uplo, A, X, B, R, workR, Rnorm, sequence, request);
+
+        // Check whether nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter = iiter > 0 and return.
+        plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        #pragma omp taskwait
+        {
+            int flag = 1;
+            for (int n = 0; n < R.n && flag == 1; n++) {
+                if (Rnorm[n] > Xnorm[n] * cte) {
+                    flag = 0;
+                }
+            }
+            if (flag == 1) {
+                *iter = iiter+1;
+                return;
+            }
+        }
+    }
+
+    // If we are at this place of the code, this is because we have performed
+    // iter = itermax iterations and never satisfied the stopping criterion,
+    // set up the iter flag accordingly and follow up with double precision routine.
+    *iter = -itermax - 1;
+
+    // Compute Cholesky factorization of A.
+    plasma_pdpotrf(uplo, A, sequence, request);
+
+    // Solve the system A * X = B.
+    plasma_pdlacpy(PlasmaGeneral, B, X, sequence, request);
+    plasma_pdtrsm(PlasmaLeft, uplo,
+                  uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
+                  PlasmaNonUnit, 1.0, A, X, sequence, request);
+    plasma_pdtrsm(PlasmaLeft, uplo,
+                  uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
+                  PlasmaNonUnit, 1.0, A, X, sequence, request);
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
@@ -41,6 +196,17 @@
  *  with a call to ILAENV in the future. Up to now, we always try
  *  iterative refinement.
  *
+ *  With PlasmaRefinementMode set to PlasmaGmresRefinement, each step of the
+ *  refinement solves for the correction by GMRES preconditioned by the
+ *  COMPLEX factors, with at most PlasmaGmresRestart iterations, which keeps
+ *  the COMPLEX factorization useful for much worse conditioned matrices.
+ *
+ *  In real arithmetic, PlasmaFactorPrecision set to PlasmaBfloat16Factor
+ *  computes the Cholesky factorization with its trailing updates in bfloat16,
+ *  accumulating in single precision, and always refines it by GMRES.
+ *  It needs the bfloat16 gemm of the BLAS, enabled by PLASMA_WITH_BF16,
+ *  to be faster than the single precision factorization.
+ *
  *  The iterative refinement process is stopped if iter > itermax or
  *  for all the RHS we have: Rnorm < sqrt(n)*Xnorm*Anorm*eps*BWDmax
  *  where:
@@ -219,35 +385,35 @@ int plasma_dsposv(plasma_enum_t uplo, int n, int nrhs,
     }
 
     // Allocate tiled workspace for Infinity norm calculations
-    size_t lwork = imax((size_t)A.nt*A.n+A.n, (size_t)X.mt*X.n+(size_t)R.mt*R.n);
+    size_t lwork = szmax((size_t)A.nt*A.n+A.n,
+                         (size_t)X.mt*X.n+(size_t)R.mt*R.n);
     double *work  = (double*)malloc(((size_t)lwork)*sizeof(double));
     double *Rnorm = (double*)malloc(((size_t)R.n)*sizeof(double));
     double *Xnorm = (double*)malloc(((size_t)X.n)*sizeof(double));
 
-    // Create sequence
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
-        // Translate matrices to tile layout
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        // Translate matrices to tile layout, converting A and B
+        // to single precision in As and Xs in the same pass.
+        plasma_pdge2desc_lag2c(pA, lda, A, As, &sequence, &request);
+        plasma_pdge2desc_lag2c(pB, ldb, B, Xs, &sequence, &request);
 
-        // Call tile async function
-        plasma_omp_dsposv(uplo, A, B, X, As, Xs, R, work, Rnorm, Xnorm, iter, sequence, &request);
+        // Solve with the converted matrices.
+        plasma_dsposv_refine(uplo, A, B, X, As, Xs, R,
+                             work, Rnorm, Xnorm, iter,
+                             &sequence, &request);
 
         // Translate back to LAPACK layout
-        plasma_omp_ddesc2ge(X, pX, ldx, sequence, &request);
+        plasma_omp_ddesc2ge(X, pX, ldx, &sequence, &request);
     }
     // Implicit synchronization
 
@@ -263,8 +429,7 @@ int plasma_dsposv(plasma_enum_t uplo, int n, int nrhs,
     free(Xnorm);
 
     // Return status
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -348,10 +513,6 @@ void plasma_omp_dsposv(plasma_enum_t uplo,
                        plasma_sequence_t *sequence,
                        plasma_request_t  *request)
 {
-    const int    itermax = 30;
-    const double bwdmax  = 1.0;
-    const double zmone = -1.0;
-    const double zone  =  1.0;
     *iter = 0;
 
     // Get PLASMA context
@@ -413,16 +574,6 @@ void plasma_omp_dsposv(plasma_enum_t uplo,
     if (A.n == 0 || B.n == 0)
         return;
 
-    // Workspace for damax
-    double *workX = work;
-    double *workR = &work[X.mt*X.n];
-
-    // Compute some constants.
-    double cte;
-    double eps = LAPACKE_dlamch_work('E');
-    double Anorm;
-    plasma_pdlansy(PlasmaInfNorm, uplo, A, work, &Anorm, sequence, request);
-
     // Convert B from double to single precision, store result in Xs.
     plasma_pdlag2s(B, Xs, sequence, request);
 
@@ -430,98 +581,8 @@ void plasma_omp_dsposv(plasma_enum_t uplo,
     // TODO: need dlat2s
     plasma_pdlag2s(A, As, sequence, request);
 
-    // Compute the Cholesky factorization of As.
-    plasma_pspotrf(uplo, As, sequence, request);
-
-    // Solve the system As * Xs = Bs.
-    plasma_pstrsm(PlasmaLeft, uplo,
-                  uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
-                  PlasmaNonUnit, 1.0, As, Xs, sequence, request);
-    plasma_pstrsm(PlasmaLeft, uplo,
-                  uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
-                  PlasmaNonUnit, 1.0, As, Xs, sequence, request);
-
-    // Convert Xs to double precision.
-    plasma_pslag2d(Xs, X, sequence, request);
-
-    // Compute R = B - A * X.
-    plasma_pdlacpy(PlasmaGeneral, B, R, sequence, request);
-    plasma_pdsymm(PlasmaLeft, uplo, zmone, A, X, zone, R, sequence, request);
-
-    // Check whether the nrhs normwise backward error satisfies the
-    // stopping criterion. If yes, set iter=0 and return.
-    plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
-    plasma_pdamax(PlasmaColumnwise, R, workR, Rnorm, sequence, request);
-    #pragma omp taskwait
-    {
-        cte = Anorm * eps * sqrt((double)A.n) * bwdmax;
-        int flag = 1;
-        for (int n = 0; n < R.n && flag == 1; n++) {
-            if (Rnorm[n] > Xnorm[n] * cte) {
-                flag = 0;
-            }
-        }
-        if (flag == 1) {
-            *iter = 0;
-            return;
-        }
-    }
-
-    // Iterative refinement
-    for (int iiter = 0; iiter < itermax; iiter++) {
-        // Convert R from double to single precision, store result in Xs.
-        plasma_pdlag2s(R, Xs, sequence, request);
-
-        // Solve the system As * Xs = Rs.
-        plasma_pstrsm(PlasmaLeft, uplo,
-                      uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
-                      PlasmaNonUnit, 1.0, As, Xs, sequence, request);
-        plasma_pstrsm(PlasmaLeft, uplo,
-                      uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
-                      PlasmaNonUnit, 1.0, As, Xs, sequence, request);
-
-        // Convert Xs back to double precision and update the current iterate.
-        plasma_pslag2d(Xs, R, sequence, request);
-        plasma_pdgeadd(PlasmaNoTrans, zone, R, zone, X, sequence, request);
-
-        // Compute R = B - A * X
-        plasma_pdlacpy(PlasmaGeneral, B, R, sequence, request);
-        plasma_pdsymm(PlasmaLeft, uplo, zmone, A, X, zone, R,
-                      sequence, request);
-
-        // Check whether nrhs normwise backward error satisfies the
-        // stopping criterion. If yes, set iter = iiter > 0 and return.
-        plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
-        plasma_pdamax(PlasmaColumnwise, R, workR, Rnorm, sequence, request);
-        #pragma omp taskwait
-        {
-            int flag = 1;
-            for (int n = 0; n < R.n && flag == 1; n++) {
-                if (Rnorm[n] > Xnorm[n] * cte) {
-                    flag = 0;
-                }
-            }
-            if (flag == 1) {
-                *iter = iiter+1;
-                return;
-            }
-        }
-    }
-
-    // If we are at this place of the code, this is because we have performed
-    // iter = itermax iterations and never satisfied the stopping criterion,
-    // set up the iter flag accordingly and follow up with double precision routine.
-    *iter = -itermax - 1;
-
-    // Compute Cholesky factorization of A.
-    plasma_pdpotrf(uplo, A, sequence, request);
-
-    // Solve the system A * X = B.
-    plasma_pdlacpy(PlasmaGeneral, B, X, sequence, request);
-    plasma_pdtrsm(PlasmaLeft, uplo,
-                  uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
-                  PlasmaNonUnit, 1.0, A, X, sequence, request);
-    plasma_pdtrsm(PlasmaLeft, uplo,
-                  uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
-                  PlasmaNonUnit, 1.0, A, X, sequence, request);
+    // Factor As and refine X in double precision.
+    plasma_dsposv_refine(uplo, A, B, X, As, Xs, R,
+                         work, Rnorm, Xnorm, iter,
+                         sequence, request);
 }
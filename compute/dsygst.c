@@ -0,0 +1,280 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zhegst.c, normal z -> d, Thu Oct 15 08:31:46 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hegst
+ *
+ *  Reduces a symmetric-definite generalized eigenproblem to standard form.
+ *
+ *  If itype = 1, the problem is A*x = lambda*B*x,
+ *  and A is overwritten by inv(U^T)*A*inv(U) or inv(L)*A*inv(L^T).
+ *
+ *  If itype = 2 or 3, the problem is A*B*x = lambda*x or
+ *  B*A*x = lambda*x, and A is overwritten by U*A*U^T or L^T*A*L.
+ *
+ *  B must have been previously factorized as U^T*U or L*L^T by
+ *  plasma_dpotrf().
+ *
+ *******************************************************************************
+ *
+ * @param[in] itype
+ *          - 1: compute inv(U^T)*A*inv(U) or inv(L)*A*inv(L^T);
+ *          - 2 or 3: compute U*A*U^T or L^T*A*L.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored and B is factored
+ *                         as U^T*U;
+ *          - PlasmaLower: Lower triangle of A is stored and B is factored
+ *                         as L*L^T.
+ *
+ * @param[in] n
+ *          The order of the matrices A and B. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric matrix A. If uplo = PlasmaUpper, the
+ *          leading n-by-n upper triangular part of A contains the upper
+ *          triangular part of the matrix A, and the strictly lower triangular
+ *          part of A is not referenced. If uplo = PlasmaLower, the leading
+ *          n-by-n lower triangular part of A contains the lower triangular
+ *          part of the matrix A, and the strictly upper triangular part of A
+ *          is not referenced.
+ *          On exit, the transformed matrix, stored in the same format as A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] pB
+ *          The triangular factor from the Cholesky factorization of B,
+ *          as returned by plasma_dpotrf().
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dsygst
+ * @sa plasma_chegst
+ * @sa plasma_dsygst
+ * @sa plasma_ssygst
+ *
+ ******************************************************************************/
+int plasma_dsygst(int itype, plasma_enum_t uplo,
+                  int n,
+                  double *pA, int lda,
+                  double *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (itype < 1 || itype > 3) {
+        plasma_error("illegal value of itype");
+        return -1;
+    }
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imax(n, 0) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_triangular_create(PlasmaRealDouble, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_triangular_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_triangular_create(PlasmaRealDouble, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_triangular_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // Asynchronous block.
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_dsygst(itype, uplo, A, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // Implicit synchronization.
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hegst
+ *
+ *  Reduces a symmetric-definite generalized eigenproblem to standard form.
+ *  Non-blocking tile version of plasma_dsygst(). May return before the
+ *  computation is finished. Operates on matrices stored by tiles. All
+ *  matrices are passed through descriptors. All dimensions are taken from
+ *  the descriptors. Allows for pipelining of operations at runtime.
+ *
+ *  Called after plasma_omp_dpotrf() on B in the same parallel region, the
+ *  reduction runs in the same task graph as the factorization, each of its
+ *  tasks waiting only for the tiles of the factor that it reads.
+ *
+ *******************************************************************************
+ *
+ * @param[in] itype
+ *          - 1: compute inv(U^T)*A*inv(U) or inv(L)*A*inv(L^T);
+ *          - 2 or 3: compute U*A*U^T or L^T*A*L.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored and B is factored
+ *                         as U^T*U;
+ *          - PlasmaLower: Lower triangle of A is stored and B is factored
+ *                         as L*L^T.
+ *
+ * @param[in,out] A
+ *          Descriptor of the symmetric matrix A.
+ *          On exit, the transformed matrix.
+ *
+ * @param[in] B
+ *          Descriptor of the triangular factor of B from plasma_omp_dpotrf().
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dsygst
+ * @sa plasma_omp_chegst
+ * @sa plasma_omp_dsygst
+ * @sa plasma_omp_ssygst
+ *
+ ******************************************************************************/
+void plasma_omp_dsygst(int itype, plasma_enum_t uplo,
+                       plasma_desc_t A, plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (itype < 1 || itype > 3) {
+        plasma_error("illegal value of itype");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdsygst(itype, uplo, A, B, sequence, request);
+}
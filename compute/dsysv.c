@@ -0,0 +1,106 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zhesv.c, normal z -> d, Thu Oct 15 02:51:25 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hesv
+ *
+ *  Solves a system of linear equations A X = B with a symmetric indefinite
+ *  matrix A by Aasen's algorithm, P A P^T = L T L^T, of plasma_dsytrf,
+ *  followed by the solves of plasma_dsytrs.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrix B. nrhs >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric matrix A.
+ *          On exit, the factor L, as by plasma_dsytrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] ipiv
+ *          The pivot indices of P, of size n.
+ *
+ * @param[out] pT
+ *          On exit, the LU factorization of T in band storage.
+ *
+ * @param[in] ldt
+ *          The leading dimension of the array T. ldt >= 3*nb+1.
+ *
+ * @param[out] ipiv2
+ *          The pivot indices of the band LU factorization of T, of size n.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, T is exactly singular, so the solution could not be
+ *         computed
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dsytrf
+ * @sa plasma_dsytrs
+ * @sa plasma_chesv
+ * @sa plasma_dsysv
+ * @sa plasma_ssysv
+ *
+ ******************************************************************************/
+int plasma_dsysv(plasma_enum_t uplo, int n, int nrhs,
+                 double *pA, int lda, int *ipiv,
+                 double *pT, int ldt, int *ipiv2,
+                 double *pB, int ldb)
+{
+    // Check the arguments not checked by plasma_dsytrf.
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -11;
+    }
+
+    int retval = plasma_dsytrf(uplo, n, pA, lda, ipiv, pT, ldt, ipiv2);
+    if (retval != PlasmaSuccess) {
+        // Shift the argument positions past nrhs.
+        return retval < -2 ? retval-1 : retval;
+    }
+
+    return plasma_dsytrs(uplo, n, nrhs, pA, lda, ipiv, pT, ldt, ipiv2,
+                         pB, ldb);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/ztradd.c, normal z -> d, Mon Feb  6 14:06:41 2017
+ * @generated from compute/ztradd.c, normal z -> d, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -178,34 +178,30 @@ int plasma_dtradd(plasma_enum_t uplo, plasma_enum_t transa,
         return retval;
     }
 
-    // Create sequence
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
 
         // Call tile async function
         plasma_omp_dtradd(uplo, transa,
                           alpha,     A,
                           beta,      B,
-                          sequence, &request);
+                          &sequence, &request);
 
         // Translate back to LAPACK layout
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
     }
     // Implicit synchronization
 
@@ -214,8 +210,7 @@ int plasma_dtradd(plasma_enum_t uplo, plasma_enum_t transa,
     plasma_desc_destroy(&B);
 
     // Return status
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
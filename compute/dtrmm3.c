@@ -0,0 +1,405 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/ztrmm3.c, normal z -> d, Thu Oct 15 08:27:26 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trmm
+ *
+ *  Performs an out-of-place triangular matrix-matrix multiply of the form
+ *
+ *          \f[C = \alpha [op(A) \times B] \f], if side = PlasmaLeft  or
+ *          \f[C = \alpha [B \times op(A)] \f], if side = PlasmaRight
+ *
+ *  where op( X ) is one of:
+ *
+ *          - op(A) = A   or
+ *          - op(A) = A^T or
+ *          - op(A) = A^T
+ *
+ *  alpha is a scalar, B and C are m-by-n matrices and A is a unit or non-unit,
+ *  upper or lower triangular matrix. Unlike plasma_dtrmm(), B is left
+ *  unchanged, so that the tiles of C are computed independently of each
+ *  other, as in plasma_dgemm(), instead of in the order in which the tiles
+ *  of B are overwritten.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          Specifies whether op( A ) appears on the left or on the right of B:
+ *          - PlasmaLeft:  alpha*op( A )*B
+ *          - PlasmaRight: alpha*B*op( A )
+ *
+ * @param[in] uplo
+ *          Specifies whether the matrix A is upper triangular or lower
+ *          triangular:
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] transa
+ *          Specifies whether the matrix A is transposed, not transposed or
+ *          conjugate transposed:
+ *          - PlasmaNoTrans:   A is transposed;
+ *          - PlasmaTrans:     A is not transposed;
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] diag
+ *          Specifies whether or not A is unit triangular:
+ *          - PlasmaNonUnit: A is non-unit triangular;
+ *          - PlasmaUnit:    A is unit triangular.
+ *
+ * @param[in] m
+ *          The number of rows of matrix B.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of matrix B.
+ *          n >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          The triangular matrix A of dimension lda-by-k, where k is m when
+ *          side='L' or 'l' and k is n when when side='R' or 'r'. If uplo =
+ *          PlasmaUpper, the leading k-by-k upper triangular part of the array
+ *          A contains the upper triangular matrix, and the strictly lower
+ *          triangular part of A is not referenced. If uplo = PlasmaLower, the
+ *          leading k-by-k lower triangular part of the array A contains the
+ *          lower triangular matrix, and the strictly upper triangular part of
+ *          A is not referenced. If diag = PlasmaUnit, the diagonal elements of
+ *          A are also not referenced and are assumed to be 1.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. When side='L' or 'l',
+ *          lda >= max(1,m), when side='R' or 'r' then lda >= max(1,n).
+ *
+ * @param[in] pB
+ *          The matrix B of dimension ldb-by-n.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,m).
+ *
+ * @param[out] pC
+ *          On exit, the matrix C of dimension ldc-by-n, the result of
+ *          a triangular matrix-matrix multiply ( alpha*op(A)*B ) or
+ *          ( alpha*B*op(A) ). C must not overlap A or B.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_dtrmm3
+ * @sa plasma_dtrmm
+ * @sa plasma_ctrmm3
+ * @sa plasma_dtrmm3
+ * @sa plasma_strmm3
+ *
+ ******************************************************************************/
+int plasma_dtrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t diag,
+                  int m, int n,
+                  double alpha, double *pA, int lda,
+                                            double *pB, int ldb,
+                                            double *pC, int ldc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (side != PlasmaLeft && side != PlasmaRight) {
+        plasma_error("illegal value of side");
+        return -1;
+    }
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (transa != PlasmaConjTrans &&
+        transa != PlasmaNoTrans   &&
+        transa != PlasmaTrans )
+    {
+        plasma_error("illegal value of transa");
+        return -3;
+    }
+    if (diag != PlasmaUnit && diag != PlasmaNonUnit) {
+        plasma_error("illegal value of diag");
+        return -4;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -5;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -6;
+    }
+
+    int na;
+    if (side == PlasmaLeft)
+        na = m;
+    else
+        na = n;
+
+    if (lda < imax(1, na)) {
+        plasma_error("illegal value of lda");
+        return -8;
+    }
+    if (ldb < imax(1, m)) {
+        plasma_error("illegal value of ldb");
+        return -10;
+    }
+    if (ldc < imax(1, m)) {
+        plasma_error("illegal value of ldc");
+        return -12;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        na, na, 0, 0, na, na, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m,  n,  0, 0, m,  n, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m,  n,  0, 0, m,  n, &C);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate matrices to tile layout.
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call tile async interface.
+        plasma_omp_dtrmm3(side, uplo, transa, diag,
+                          alpha, A,
+                                 B,
+                                 C,
+                          &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_ddesc2ge(C, pC, ldc, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&C);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trmm
+ *
+ *  Performs out-of-place triangular matrix multiplication. Non-blocking tile
+ *  version of plasma_dtrmm3(). May return before the computation is
+ *  finished. Operates on matrices stored by tiles. All matrices are passed
+ *  through descriptors. All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          Specifies whether op( A ) appears on the left or on the right of B:
+ *          - PlasmaLeft:  alpha*op( A )*B
+ *          - PlasmaRight: alpha*B*op( A )
+ *
+ * @param[in] uplo
+ *          Specifies whether the matrix A is upper triangular or lower
+ *          triangular:
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] transa
+ *          Specifies whether the matrix A is transposed, not transposed or
+ *          conjugate transposed:
+ *          - PlasmaNoTrans:   A is transposed;
+ *          - PlasmaTrans:     A is not transposed;
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] diag
+ *          Specifies whether or not A is unit triangular:
+ *          - PlasmaNonUnit: A is non-unit triangular;
+ *          - PlasmaUnit:    A is unit triangular.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of the triangular matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[out] C
+ *          Descriptor of matrix C, of the dimensions of B.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dtrmm3
+ * @sa plasma_omp_dtrmm
+ * @sa plasma_omp_ctrmm3
+ * @sa plasma_omp_dtrmm3
+ * @sa plasma_omp_strmm3
+ *
+ ******************************************************************************/
+void plasma_omp_dtrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t diag,
+                       double alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                                                 plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorNotInitialized);
+        return;
+    }
+
+    // Check input arguments.
+    if (side != PlasmaLeft && side != PlasmaRight) {
+        plasma_error("illegal value of side");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (transa != PlasmaConjTrans &&
+        transa != PlasmaNoTrans &&
+        transa != PlasmaTrans) {
+        plasma_error("illegal value of transa");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (diag != PlasmaUnit && diag != PlasmaNonUnit) {
+        plasma_error("illegal value of diag");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(C) != PlasmaSuccess) {
+        plasma_error("invalid C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (C.m != B.m || C.n != B.n) {
+        plasma_error("illegal dimensions of C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (B.m == 0 || B.n == 0)
+        return;
+
+    if (alpha == 0.0) {
+        plasma_pdlaset(PlasmaGeneral, 0.0, 0.0, C, sequence, request);
+        return;
+    }
+
+    // Call parallel function.
+    plasma_pdtrmm3(side, uplo, transa, diag, alpha,
+                   A, B, C,
+                   sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/ztrtri.c, normal z -> d, Mon Feb  6 14:06:42 2017
+ * @generated from compute/ztrtri.c, normal z -> d, Thu Oct 15 08:27:15 2026
  *
  **/
 
@@ -108,38 +108,58 @@ int plasma_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
+
+    // Create the workspace of the out-of-place triangular products,
+    // of the dimensions of the off-diagonal block of the halves of A.
+    plasma_desc_t W;
+    W.matrix = NULL;
+    int nt = (n+nb-1)/nb;
+    if (nt > 1) {
+        int n1 = (nt/2)*nb;
+        int wm = uplo == PlasmaLower ? n-n1 : n1;
+        int wn = uplo == PlasmaLower ? n1 : n-n1;
+        retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            wm, wn, 0, 0, wm, wn, &W);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&A);
+            return retval;
+        }
     }
 
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block.
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_dge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_dge2desc(pA, lda, A, &sequence, &request);
 
-        // Call the tile async function.
-        plasma_omp_dtrtri(uplo, diag, A, sequence, &request);
+        // Call the tile async function, or the parallel function
+        // with the workspace.
+        if (W.matrix != NULL)
+            plasma_pdtrtri_work(uplo, diag, A, W, &sequence, &request);
+        else
+            plasma_omp_dtrtri(uplo, diag, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_ddesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_ddesc2ge(A, pA, lda, &sequence, &request);
     }
     // Implicit synchronization.
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
+    if (W.matrix != NULL)
+        plasma_desc_destroy(&W);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
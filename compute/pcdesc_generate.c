@@ -0,0 +1,60 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzdesc_generate.c, normal z -> c, Thu Oct 15 07:38:19 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_c.h"
+
+/***************************************************************************//**
+ *  Fills the tiles of A by the user generator, one task per tile.
+ *  Each task declares an output dependency on its tile, as the tasks of
+ *  plasma_pcge2desc.
+ * @see plasma_omp_cdesc_generate
+ ******************************************************************************/
+void plasma_pcdesc_generate(plasma_cgenerator_t generator, void *args,
+                            plasma_desc_t A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int m = 0; m < A.mt; m++) {
+        int ldt = plasma_tile_mmain(A, m);
+        int y1 = m == 0 ? A.i%A.mb : 0;
+        int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+        // first row of the tile in A
+        int i = m == 0 ? 0 : m*A.mb - A.i%A.mb;
+        for (int n = 0; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int j = n == 0 ? 0 : n*A.nb - A.j%A.nb;
+
+            plasma_complex32_t *a = (plasma_complex32_t*)
+                plasma_tile_addr(A, m, n);
+
+            plasma_tile_affinity(A, m, n);
+            #pragma omp task depend(out:a[0:ldt*nvan]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                if (sequence->status == PlasmaSuccess)
+                    generator(i, j, y2-y1, x2-x1,
+                              &a[x1*ldt+y1], ldt, args);
+            }
+        }
+    }
+}
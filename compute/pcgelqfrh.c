@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgelqfrh.c, normal z -> c, Mon Feb  6 14:06:14 2017
+ * @generated from compute/pzgelqfrh.c, normal z -> c, Thu Oct 15 05:36:31 2026
  *
  **/
 
@@ -35,10 +35,12 @@ void plasma_pcgelqfrh(plasma_desc_t A, plasma_desc_t T,
 
     // Precompute order of LQ operations - compute it as for QR
     // and transpose it.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
     // Transpose m and n to reuse the QR tree.
-    plasma_rh_tree_operations(A.nt, A.mt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.nt, A.mt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -59,7 +61,7 @@ void plasma_pcgelqfrh(plasma_desc_t A, plasma_desc_t T,
                 mvaj, nvak, ib,
                 A(j, k), ldaj,
                 T(j, k), T.mb,
-                work,
+                work, plasma->panel_blas_threads,
                 sequence, request);
 
             for (int jj = j + 1; jj < A.mt; jj++) {
@@ -136,5 +138,5 @@ void plasma_pcgelqfrh(plasma_desc_t A, plasma_desc_t T,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgemm.c, normal z -> c, Mon Feb  6 14:06:14 2017
+ * @generated from compute/pzgemm.c, normal z -> c, Thu Oct 15 09:29:52 2026
  *
  **/
 
@@ -14,121 +14,809 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_mpi.h"
+#include "plasma_starpu.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <omp.h>
+
+#define COMPLEX
+
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 #define B(m, n) (plasma_complex32_t*)plasma_tile_addr(B, m, n)
 #define C(m, n) (plasma_complex32_t*)plasma_tile_addr(C, m, n)
 
+#if defined(PLASMA_WITH_STARPU)
 /***************************************************************************//**
- * Parallel tile matrix-matrix multiplication.
- * @see plasma_omp_cgemm
+ * Parallel tile matrix-matrix multiplication on the StarPU runtime.
+ * Waits for the tasks submitted before, which produce A, B and C, as
+ * the OpenMP tasks and the StarPU tasks do not share dependencies,
+ * and for its own tasks, when unregistering the tiles.
  ******************************************************************************/
-void plasma_pcgemm(plasma_enum_t transa, plasma_enum_t transb,
-                   plasma_complex32_t alpha, plasma_desc_t A,
-                                             plasma_desc_t B,
-                   plasma_complex32_t beta,  plasma_desc_t C,
-                   plasma_sequence_t *sequence, plasma_request_t *request)
+static void plasma_pcgemm_starpu(plasma_enum_t transa, plasma_enum_t transb,
+                                 plasma_complex32_t alpha, plasma_desc_t A,
+                                                           plasma_desc_t B,
+                                 plasma_complex32_t beta,  plasma_desc_t C,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
+    #pragma omp taskwait
+
+    starpu_data_handle_t *hA = plasma_starpu_register(A);
+    starpu_data_handle_t *hB = plasma_starpu_register(B);
+    starpu_data_handle_t *hC = plasma_starpu_register(C);
+    if (hA == NULL || hB == NULL || hC == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        if (hA != NULL)
+            plasma_starpu_unregister(A, hA);
+        if (hB != NULL)
+            plasma_starpu_unregister(B, hB);
+        if (hC != NULL)
+            plasma_starpu_unregister(C, hC);
         return;
+    }
 
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
     for (int m = 0; m < C.mt; m++) {
         int mvcm = plasma_tile_mview(C, m);
-        int ldcm = plasma_tile_mmain(C, m);
         for (int n = 0; n < C.nt; n++) {
             int nvcn = plasma_tile_nview(C, n);
-            //=========================================
-            // alpha*A*B does not contribute; scale C
-            //=========================================
-            int inner_k = transa == PlasmaNoTrans ? A.n : A.m;
-            if (alpha == 0.0 || inner_k == 0) {
-                int ldam = imax(1, plasma_tile_mmain(A, 0));
-                int ldbk = imax(1, plasma_tile_mmain(B, 0));
-                core_omp_cgemm(
+            for (int k = 0; k < kt; k++) {
+                int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                                   : plasma_tile_mview(A, k);
+                starpu_data_handle_t a = transa == PlasmaNoTrans
+                    ? PLASMA_STARPU_TILE(hA, A, m, k)
+                    : PLASMA_STARPU_TILE(hA, A, k, m);
+                starpu_data_handle_t b = transb == PlasmaNoTrans
+                    ? PLASMA_STARPU_TILE(hB, B, k, n)
+                    : PLASMA_STARPU_TILE(hB, B, n, k);
+                plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                core_starpu_cgemm(
                     transa, transb,
-                    mvcm, nvcn, 0,
-                    alpha, A(0, 0), ldam,
-                           B(0, 0), ldbk,
-                    beta,  C(m, n), ldcm,
+                    mvcm, nvcn, kvak,
+                    alpha, a,
+                           b,
+                    zbeta, PLASMA_STARPU_TILE(hC, C, m, n),
                     sequence, request);
             }
-            else if (transa == PlasmaNoTrans) {
-                int ldam = plasma_tile_mmain(A, m);
-                //================================
-                // PlasmaNoTrans / PlasmaNoTrans
-                //================================
-                if (transb == PlasmaNoTrans) {
-                    for (int k = 0; k < A.nt; k++) {
-                        int nvak = plasma_tile_nview(A, k);
-                        int ldbk = plasma_tile_mmain(B, k);
-                        plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+        }
+    }
+    plasma_starpu_unregister(A, hA);
+    plasma_starpu_unregister(B, hB);
+    plasma_starpu_unregister(C, hC);
+}
+#endif
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication with packed tiles.
+ * Each tile of op( A ), scaled by alpha, and of op( B ) is packed once by
+ * its own task, instead of once per tile product inside the BLAS, and the
+ * products read the packed tiles. The packed tiles are freed after a
+ * taskwait, so the call returns with its tasks, and those before, complete.
+ ******************************************************************************/
+static void plasma_pcgemm_packed(plasma_enum_t transa, plasma_enum_t transb,
+                                 plasma_complex32_t alpha, plasma_desc_t A,
+                                                           plasma_desc_t B,
+                                 plasma_complex32_t beta,  plasma_desc_t C,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    void **Ap = (void**)calloc((size_t)C.mt*kt, sizeof(void*));
+    void **Bp = (void**)calloc((size_t)kt*C.nt, sizeof(void*));
+    if (Ap == NULL || Bp == NULL) {
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        free(Ap);
+        free(Bp);
+        return;
+    }
+
+    // Pack the tiles of op( A ), for products of any width.
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        for (int k = 0; k < kt; k++) {
+            int am = transa == PlasmaNoTrans ? m : k;
+            int an = transa == PlasmaNoTrans ? k : m;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm_pack(
+                PlasmaLeft, transa,
+                mvcm, C.nb, kvak,
+                alpha, A(am, an), plasma_tile_mmain(A, am),
+                &Ap[m*kt+k],
+                sequence, request);
+        }
+    }
+
+    // Pack the tiles of op( B ), for products of any height.
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int bm = transb == PlasmaNoTrans ? k : n;
+            int bn = transb == PlasmaNoTrans ? n : k;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm_pack(
+                PlasmaRight, transb,
+                C.mb, nvcn, kvak,
+                1.0, B(bm, bn), plasma_tile_mmain(B, bm),
+                &Bp[n*kt+k],
+                sequence, request);
+        }
+    }
+
+    int mbits = plasma_morton_bits(C.mt);
+    int nbits = plasma_morton_bits(C.nt);
+    for (int z = 0; z < 1 << (mbits+nbits); z++) {
+        int m, n;
+        plasma_morton_tile(z, mbits, nbits, &m, &n);
+        if (m >= C.mt || n >= C.nt)
+            continue;
+
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+            core_omp_cgemm_packed(
+                mvcm, nvcn, kvak,
+                &Ap[m*kt+k], &Bp[n*kt+k],
+                zbeta, C(m, n), ldcm,
+                sequence, request);
+        }
+    }
+
+    #pragma omp taskwait
+    for (int i = 0; i < C.mt*kt; i++)
+        free(Ap[i]);
+    for (int i = 0; i < kt*C.nt; i++)
+        free(Bp[i]);
+    free(Ap);
+    free(Bp);
+}
+
+#ifdef COMPLEX
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication by the 3M algorithm.
+ * Each tile of op( A ) and op( B ) is split once into its real and
+ * imaginary parts, shared by the tile products reading it.
+ ******************************************************************************/
+static void plasma_pcgemm_3m(plasma_enum_t transa, plasma_enum_t transb,
+                             plasma_complex32_t alpha, plasma_desc_t A,
+                                                       plasma_desc_t B,
+                             plasma_complex32_t beta,  plasma_desc_t C,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    float **As = (float**)calloc((size_t)C.mt*kt, sizeof(float*));
+    float **Bs = (float**)calloc((size_t)kt*C.nt, sizeof(float*));
+    if (As == NULL || Bs == NULL) {
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        free(As);
+        free(Bs);
+        return;
+    }
+
+    // Split the tiles of op( A ).
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        for (int k = 0; k < kt; k++) {
+            int am = transa == PlasmaNoTrans ? m : k;
+            int an = transa == PlasmaNoTrans ? k : m;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm3m_split(
+                transa, mvcm, kvak,
+                A(am, an), plasma_tile_mmain(A, am),
+                &As[m*kt+k],
+                sequence, request);
+        }
+    }
+
+    // Split the tiles of op( B ).
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int bm = transb == PlasmaNoTrans ? k : n;
+            int bn = transb == PlasmaNoTrans ? n : k;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm3m_split(
+                transb, kvak, nvcn,
+                B(bm, bn), plasma_tile_mmain(B, bm),
+                &Bs[n*kt+k],
+                sequence, request);
+        }
+    }
+
+    int mbits = plasma_morton_bits(C.mt);
+    int nbits = plasma_morton_bits(C.nt);
+    for (int z = 0; z < 1 << (mbits+nbits); z++) {
+        int m, n;
+        plasma_morton_tile(z, mbits, nbits, &m, &n);
+        if (m >= C.mt || n >= C.nt)
+            continue;
+
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+            core_omp_cgemm3m(
+                mvcm, nvcn, kvak,
+                alpha, &As[m*kt+k], &Bs[n*kt+k],
+                zbeta, C(m, n), ldcm,
+                sequence, request);
+        }
+    }
+
+    #pragma omp taskwait
+    for (int i = 0; i < C.mt*kt; i++)
+        free(As[i]);
+    for (int i = 0; i < kt*C.nt; i++)
+        free(Bs[i]);
+    free(As);
+    free(Bs);
+}
+#endif
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication emulated by the Ozaki scheme.
+ * Each tile of op( A ) and op( B ) is split once into its slices of
+ * integers, shared by the tile products reading it.
+ ******************************************************************************/
+static void plasma_pcgemm_ozaki(plasma_enum_t transa, plasma_enum_t transb,
+                                plasma_complex32_t alpha, plasma_desc_t A,
+                                                          plasma_desc_t B,
+                                plasma_complex32_t beta,  plasma_desc_t C,
+                                int slices,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    void **As = (void**)calloc((size_t)C.mt*kt, sizeof(void*));
+    void **Bs = (void**)calloc((size_t)kt*C.nt, sizeof(void*));
+    if (As == NULL || Bs == NULL) {
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        free(As);
+        free(Bs);
+        return;
+    }
+
+    // Split the tiles of op( A ).
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        for (int k = 0; k < kt; k++) {
+            int am = transa == PlasmaNoTrans ? m : k;
+            int an = transa == PlasmaNoTrans ? k : m;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm_ozaki_split(
+                PlasmaLeft, transa, mvcm, kvak,
+                A(am, an), plasma_tile_mmain(A, am),
+                slices, &As[m*kt+k],
+                sequence, request);
+        }
+    }
+
+    // Split the tiles of op( B ).
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int bm = transb == PlasmaNoTrans ? k : n;
+            int bn = transb == PlasmaNoTrans ? n : k;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            core_omp_cgemm_ozaki_split(
+                PlasmaRight, transb, kvak, nvcn,
+                B(bm, bn), plasma_tile_mmain(B, bm),
+                slices, &Bs[n*kt+k],
+                sequence, request);
+        }
+    }
+
+    int mbits = plasma_morton_bits(C.mt);
+    int nbits = plasma_morton_bits(C.nt);
+    for (int z = 0; z < 1 << (mbits+nbits); z++) {
+        int m, n;
+        plasma_morton_tile(z, mbits, nbits, &m, &n);
+        if (m >= C.mt || n >= C.nt)
+            continue;
+
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        int nvcn = plasma_tile_nview(C, n);
+        for (int k = 0; k < kt; k++) {
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+            core_omp_cgemm_ozaki(
+                mvcm, nvcn, kvak, slices,
+                alpha, &As[m*kt+k], &Bs[n*kt+k],
+                zbeta, C(m, n), ldcm,
+                sequence, request);
+        }
+    }
+
+    #pragma omp taskwait
+    for (int i = 0; i < C.mt*kt; i++)
+        free(As[i]);
+    for (int i = 0; i < kt*C.nt; i++)
+        free(Bs[i]);
+    free(As);
+    free(Bs);
+}
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication - static scheduling.
+ * The tiles of C are distributed cyclically over the threads of the team,
+ * each running its tiles in a task, after the tasks submitted before.
+ * The tiles being independent, the threads never wait for each other.
+ * The call returns with the tasks complete.
+ ******************************************************************************/
+static void plasma_pcgemm_static(plasma_enum_t transa, plasma_enum_t transb,
+                                 plasma_complex32_t alpha, plasma_desc_t A,
+                                                           plasma_desc_t B,
+                                 plasma_complex32_t beta,  plasma_desc_t C,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+    int kdim = transa == PlasmaNoTrans ? A.n : A.m;
+
+    int size = omp_get_num_threads();
+    #pragma omp taskwait
+    for (int rank = 0; rank < size; rank++) {
+        #pragma omp task priority(plasma_sequence_priority(sequence))
+        {
+            for (int z = rank; z < C.mt*C.nt; z += size) {
+                if (sequence->status != PlasmaSuccess)
+                    break;
+
+                int m = z%C.mt;
+                int n = z/C.mt;
+                int mvcm = plasma_tile_mview(C, m);
+                int ldcm = plasma_tile_mmain(C, m);
+                int nvcn = plasma_tile_nview(C, n);
+                // alpha*A*B does not contribute; scale C
+                if (alpha == 0.0 || kdim == 0) {
+                    int lda0 = imax(1, plasma_tile_mmain(A, 0));
+                    int ldb0 = imax(1, plasma_tile_mmain(B, 0));
+                    core_cgemm(transa, transb,
+                               mvcm, nvcn, 0,
+                               alpha, A(0, 0), lda0,
+                                      B(0, 0), ldb0,
+                               beta,  C(m, n), ldcm);
+                    continue;
+                }
+                for (int k = 0; k < kt; k++) {
+                    int am = transa == PlasmaNoTrans ? m : k;
+                    int an = transa == PlasmaNoTrans ? k : m;
+                    int bm = transb == PlasmaNoTrans ? k : n;
+                    int bn = transb == PlasmaNoTrans ? n : k;
+                    int kvak = transa == PlasmaNoTrans
+                               ? plasma_tile_nview(A, k)
+                               : plasma_tile_mview(A, k);
+                    plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                    core_cgemm(transa, transb,
+                               mvcm, nvcn, kvak,
+                               alpha, A(am, an), plasma_tile_mmain(A, am),
+                                      B(bm, bn), plasma_tile_mmain(B, bm),
+                               zbeta, C(m, n), ldcm);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+}
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication of matrices with structure
+ * tags, or block-sparse. The products by zero tiles are skipped, and those
+ * by identity tiles are additions of the other tile. The tiles of C are
+ * tagged with the structure the products leave them in. The empty tiles of
+ * a block-sparse C are zero and receive no product, so they are left as
+ * they are.
+ ******************************************************************************/
+static void plasma_pcgemm_structured(plasma_enum_t transa,
+                                     plasma_enum_t transb,
+                                     plasma_complex32_t alpha, plasma_desc_t A,
+                                                               plasma_desc_t B,
+                                     plasma_complex32_t beta,  plasma_desc_t C,
+                                     plasma_sequence_t *sequence,
+                                     plasma_request_t *request)
+{
+    int kt = alpha == 0.0 ? 0 : transa == PlasmaNoTrans ? A.nt : A.mt;
+    int lda0 = imax(1, plasma_tile_mmain(A, 0));
+    int ldb0 = imax(1, plasma_tile_mmain(B, 0));
+
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        for (int n = 0; n < C.nt; n++) {
+            int nvcn = plasma_tile_nview(C, n);
+            plasma_complex32_t zbeta = beta;
+            int products = 0;
+            for (int k = 0; k < kt; k++) {
+                int am = transa == PlasmaNoTrans ? m : k;
+                int an = transa == PlasmaNoTrans ? k : m;
+                int bm = transb == PlasmaNoTrans ? k : n;
+                int bn = transb == PlasmaNoTrans ? n : k;
+                plasma_enum_t sa = plasma_tile_structure(A, am, an);
+                plasma_enum_t sb = plasma_tile_structure(B, bm, bn);
+                if (sa == PlasmaTileZero || sb == PlasmaTileZero)
+                    continue;
+
+                if (sa == PlasmaTileIdentity || sb == PlasmaTileIdentity) {
+                    // C = zbeta C + alpha op(X), X the other tile
+                    if (zbeta == 0.0) {
                         core_omp_cgemm(
                             transa, transb,
-                            mvcm, nvcn, nvak,
-                            alpha, A(m, k), ldam,
-                                   B(k, n), ldbk,
-                            zbeta, C(m, n), ldcm,
+                            mvcm, nvcn, 0,
+                            alpha, A(0, 0), lda0,
+                                   B(0, 0), ldb0,
+                            0.0,   C(m, n), ldcm,
                             sequence, request);
+                        zbeta = 1.0;
                     }
-                }
-                //=====================================
-                // PlasmaNoTrans / Plasma[_Conj]Trans
-                //=====================================
-                else {
-                    int ldbn = plasma_tile_mmain(B, n);
-                    for (int k = 0; k < A.nt; k++) {
-                        int nvak = plasma_tile_nview(A, k);
-                        plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
-                            transa, transb,
-                            mvcm, nvcn, nvak,
-                            alpha, A(m, k), ldam,
-                                   B(n, k), ldbn,
+                    if (sa == PlasmaTileIdentity)
+                        core_omp_cgeadd(
+                            transb, mvcm, nvcn,
+                            alpha, B(bm, bn), plasma_tile_mmain(B, bm),
                             zbeta, C(m, n), ldcm,
                             sequence, request);
-                    }
-                }
-            }
-            else {
-                //=====================================
-                // Plasma[_Conj]Trans / PlasmaNoTrans
-                //=====================================
-                if (transb == PlasmaNoTrans) {
-                    for (int k = 0; k < A.mt; k++) {
-                        int mvak = plasma_tile_mview(A, k);
-                        int ldak = plasma_tile_mmain(A, k);
-                        int ldbk = plasma_tile_mmain(B, k);
-                        plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
-                            transa, transb,
-                            mvcm, nvcn, mvak,
-                            alpha, A(k, m), ldak,
-                                   B(k, n), ldbk,
+                    else
+                        core_omp_cgeadd(
+                            transa, mvcm, nvcn,
+                            alpha, A(am, an), plasma_tile_mmain(A, am),
                             zbeta, C(m, n), ldcm,
                             sequence, request);
-                    }
                 }
-                //==========================================
-                // Plasma[_Conj]Trans / Plasma[_Conj]Trans
-                //==========================================
                 else {
-                    int ldbn = plasma_tile_mmain(B, n);
-                    for (int k = 0; k < A.mt; k++) {
-                        int mvak = plasma_tile_mview(A, k);
-                        int ldak = plasma_tile_mmain(A, k);
-                        plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
-                            transa, transb,
-                            mvcm, nvcn, mvak,
-                            alpha, A(k, m), ldak,
-                                   B(n, k), ldbn,
-                            zbeta, C(m, n), ldcm,
+                    int kvak = transa == PlasmaNoTrans
+                               ? plasma_tile_nview(A, k)
+                               : plasma_tile_mview(A, k);
+                    core_omp_cgemm(
+                        transa, transb,
+                        mvcm, nvcn, kvak,
+                        alpha, A(am, an), plasma_tile_mmain(A, am),
+                               B(bm, bn), plasma_tile_mmain(B, bm),
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                }
+                zbeta = 1.0;
+                products++;
+            }
+            if (products > 0) {
+                plasma_tile_structure_set(C, m, n, PlasmaTileDense);
+            }
+            else if (beta != 1.0 &&
+                     plasma_tile_structure(C, m, n) != PlasmaTileZero) {
+                // alpha*A*B does not contribute; scale C
+                core_omp_cgemm(
+                    transa, transb,
+                    mvcm, nvcn, 0,
+                    alpha, A(0, 0), lda0,
+                           B(0, 0), ldb0,
+                    beta,  C(m, n), ldcm,
+                    sequence, request);
+                plasma_tile_structure_set(
+                    C, m, n, beta == 0.0 ? PlasmaTileZero : PlasmaTileDense);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication.
+ * With the matrices distributed over MPI processes, each process updates
+ * its tiles of C, receiving the tiles of A and B in their rows and columns.
+ * @see plasma_omp_cgemm
+ ******************************************************************************/
+void plasma_pcgemm(plasma_enum_t transa, plasma_enum_t transb,
+                   plasma_complex32_t alpha, plasma_desc_t A,
+                                             plasma_desc_t B,
+                   plasma_complex32_t beta,  plasma_desc_t C,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int kdim = transa == PlasmaNoTrans ? A.n : A.m;
+
+#if defined(PLASMA_WITH_STARPU)
+    if (alpha != 0.0 && kdim != 0) {
+        plasma_pcgemm_starpu(transa, transb,
+                             alpha, A, B, beta, C,
+                             sequence, request);
+        return;
+    }
+#endif
+
+    // Skip the products by zero tiles, if the matrices have structure tags
+    // or empty tiles.
+    if ((A.tile_structure != NULL || B.tile_structure != NULL ||
+         C.tile_structure != NULL || A.layout == PlasmaSparseLayout ||
+         B.layout == PlasmaSparseLayout || C.layout == PlasmaSparseLayout) &&
+        C.p*C.q <= 1) {
+        plasma_pcgemm_structured(transa, transb,
+                                 alpha, A, B, beta, C,
+                                 sequence, request);
+        return;
+    }
+
+    // Pack the tiles once, if the BLAS has a packed gemm.
+    plasma_context_t *plasma = plasma_context_self();
+
+    // matrices of a single process, statically scheduled
+    if (plasma_static_scheduling(plasma) && C.p*C.q <= 1) {
+        plasma_pcgemm_static(transa, transb,
+                             alpha, A, B, beta, C,
+                             sequence, request);
+        return;
+    }
+
+    if (plasma->gemm_variant == PlasmaPackedGemm &&
+        C.p*C.q <= 1 && alpha != 0.0 && kdim != 0 &&
+        core_cgemm_pack_size(PlasmaLeft, C.mb, C.nb, C.nb) > 0) {
+        plasma_pcgemm_packed(transa, transb,
+                             alpha, A, B, beta, C,
+                             sequence, request);
+        return;
+    }
+
+#ifdef COMPLEX
+    if (plasma_gemm_3m(plasma) &&
+        C.p*C.q <= 1 && alpha != 0.0 && kdim != 0) {
+        plasma_pcgemm_3m(transa, transb,
+                         alpha, A, B, beta, C,
+                         sequence, request);
+        return;
+    }
+#endif
+
+    int slices = plasma_gemm_ozaki(plasma);
+    if (slices > 0 &&
+        C.p*C.q <= 1 && alpha != 0.0 && kdim != 0) {
+        plasma_pcgemm_ozaki(transa, transb,
+                            alpha, A, B, beta, C,
+                            slices,
                             sequence, request);
-                    }
+        return;
+    }
+
+    // Send the tiles of A and B to the processes updating the tiles of C
+    // with them, if the matrices are distributed over MPI processes.
+    if (C.p*C.q > 1 && alpha != 0.0 && kdim != 0) {
+        char *ranks = (char*)calloc(C.p*C.q, 1);
+        if (ranks == NULL) {
+            plasma_error("calloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+        for (int m = 0; m < C.mt; m++) {
+            for (int k = 0; k < kt; k++) {
+                int am = transa == PlasmaNoTrans ? m : k;
+                int an = transa == PlasmaNoTrans ? k : m;
+                plasma_tile_owners(C, m, m, 0, C.nt-1, ranks);
+                plasma_omp_tile_bcast(A, am, an, plasma_tile_rank(A, am, an),
+                                      ranks, sequence, request);
+            }
+        }
+        for (int n = 0; n < C.nt; n++) {
+            for (int k = 0; k < kt; k++) {
+                int bm = transb == PlasmaNoTrans ? k : n;
+                int bn = transb == PlasmaNoTrans ? n : k;
+                plasma_tile_owners(C, 0, C.mt-1, n, n, ranks);
+                plasma_omp_tile_bcast(B, bm, bn, plasma_tile_rank(B, bm, bn),
+                                      ranks, sequence, request);
+            }
+        }
+        free(ranks);
+    }
+
+    // Group the products of small tiles along k into tasks of a few
+    // products, if there are enough tiles of C to keep the threads busy.
+    int group = plasma_coarsen_tiles(plasma, C.mb, C.nb,
+                                     transa == PlasmaNoTrans ? A.nb : A.mb,
+                                     C.mt*C.nt);
+
+    // The products after the one scaling C by beta accumulate into C
+    // in any order with commutative updates.
+    int commute = plasma_commute_updates(plasma);
+
+    // Split the products of large tiles into nested tasks on sub-tiles.
+    int nb_sub = plasma_subtile_nb(plasma, C.mb, C.nb,
+                                   transa == PlasmaNoTrans ? A.nb : A.mb);
+
+    // With prefetch, the products along k go at least by pairs, so that
+    // each task prefetches the tiles of its next product, which the chain
+    // on C serializes anyway.
+    int prefetch = plasma_prefetch(plasma);
+    if (prefetch && group == 1 && !commute && nb_sub == 0)
+        group = 2;
+
+    // Submit the tiles of C in the Morton order, so that the tasks running
+    // together share their tiles of A and B in the caches.
+    int mbits = plasma_morton_bits(C.mt);
+    int nbits = plasma_morton_bits(C.nt);
+    for (int z = 0; z < 1 << (mbits+nbits); z++) {
+        int m, n;
+        plasma_morton_tile(z, mbits, nbits, &m, &n);
+        if (m >= C.mt || n >= C.nt)
+            continue;
+
+        // Each process updates its tiles of C.
+        if (!plasma_tile_local(C, m, n))
+            continue;
+
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        int nvcn = plasma_tile_nview(C, n);
+        //=========================================
+        // alpha*A*B does not contribute; scale C
+        //=========================================
+        int inner_k = transa == PlasmaNoTrans ? A.n : A.m;
+        if (alpha == 0.0 || inner_k == 0) {
+            int ldam = imax(1, plasma_tile_mmain(A, 0));
+            int ldbk = imax(1, plasma_tile_mmain(B, 0));
+            core_omp_cgemm(
+                transa, transb,
+                mvcm, nvcn, 0,
+                alpha, A(0, 0), ldam,
+                       B(0, 0), ldbk,
+                beta,  C(m, n), ldcm,
+                sequence, request);
+        }
+        //=====================================
+        // chains of products grouped by tasks
+        //=====================================
+        else if (group > 1) {
+            int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+            for (int k0 = 0; k0 < kt; k0 += group) {
+                int count = imin(group, kt-k0);
+                int kv[PlasmaCoarsenMaxTiles];
+                plasma_complex32_t *a[PlasmaCoarsenMaxTiles];
+                plasma_complex32_t *b[PlasmaCoarsenMaxTiles];
+                int lda[PlasmaCoarsenMaxTiles], ldb[PlasmaCoarsenMaxTiles];
+                for (int i = 0; i < count; i++) {
+                    int k = k0+i;
+                    int am = transa == PlasmaNoTrans ? m : k;
+                    int an = transa == PlasmaNoTrans ? k : m;
+                    int bm = transb == PlasmaNoTrans ? k : n;
+                    int bn = transb == PlasmaNoTrans ? n : k;
+                    kv[i] = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                                    : plasma_tile_mview(A, k);
+                    a[i] = A(am, an);
+                    lda[i] = plasma_tile_mmain(A, am);
+                    b[i] = B(bm, bn);
+                    ldb[i] = plasma_tile_mmain(B, bm);
+                }
+                plasma_complex32_t zbeta = k0 == 0 ? beta : 1.0;
+                core_omp_cgemm_chain(
+                    transa, transb,
+                    count, mvcm, nvcn, kv,
+                    alpha, a, lda,
+                           b, ldb,
+                    zbeta, C(m, n), ldcm,
+                    prefetch,
+                    sequence, request);
+            }
+        }
+        //=====================================
+        // products split into sub-tile tasks
+        //=====================================
+        else if (nb_sub > 0) {
+            int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+            for (int k = 0; k < kt; k++) {
+                int am = transa == PlasmaNoTrans ? m : k;
+                int an = transa == PlasmaNoTrans ? k : m;
+                int bm = transb == PlasmaNoTrans ? k : n;
+                int bn = transb == PlasmaNoTrans ? n : k;
+                int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                                   : plasma_tile_mview(A, k);
+                plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                core_omp_cgemm_nested(
+                    transa, transb,
+                    mvcm, nvcn, kvak, nb_sub,
+                    alpha, A(am, an), plasma_tile_mmain(A, am),
+                           B(bm, bn), plasma_tile_mmain(B, bm),
+                    zbeta, C(m, n), ldcm,
+                    sequence, request);
+            }
+        }
+        else if (transa == PlasmaNoTrans) {
+            int ldam = plasma_tile_mmain(A, m);
+            //================================
+            // PlasmaNoTrans / PlasmaNoTrans
+            //================================
+            if (transb == PlasmaNoTrans) {
+                for (int k = 0; k < A.nt; k++) {
+                    int nvak = plasma_tile_nview(A, k);
+                    int ldbk = plasma_tile_mmain(B, k);
+                    plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                    (commute && (k > 0 || beta == 1.0) ?
+                     core_omp_cgemm_commute : core_omp_cgemm)(
+                        transa, transb,
+                        mvcm, nvcn, nvak,
+                        alpha, A(m, k), ldam,
+                               B(k, n), ldbk,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                }
+            }
+            //=====================================
+            // PlasmaNoTrans / Plasma[_Conj]Trans
+            //=====================================
+            else {
+                int ldbn = plasma_tile_mmain(B, n);
+                for (int k = 0; k < A.nt; k++) {
+                    int nvak = plasma_tile_nview(A, k);
+                    plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                    (commute && (k > 0 || beta == 1.0) ?
+                     core_omp_cgemm_commute : core_omp_cgemm)(
+                        transa, transb,
+                        mvcm, nvcn, nvak,
+                        alpha, A(m, k), ldam,
+                               B(n, k), ldbn,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                }
+            }
+        }
+        else {
+            //=====================================
+            // Plasma[_Conj]Trans / PlasmaNoTrans
+            //=====================================
+            if (transb == PlasmaNoTrans) {
+                for (int k = 0; k < A.mt; k++) {
+                    int mvak = plasma_tile_mview(A, k);
+                    int ldak = plasma_tile_mmain(A, k);
+                    int ldbk = plasma_tile_mmain(B, k);
+                    plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                    (commute && (k > 0 || beta == 1.0) ?
+                     core_omp_cgemm_commute : core_omp_cgemm)(
+                        transa, transb,
+                        mvcm, nvcn, mvak,
+                        alpha, A(k, m), ldak,
+                               B(k, n), ldbk,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                }
+            }
+            //==========================================
+            // Plasma[_Conj]Trans / Plasma[_Conj]Trans
+            //==========================================
+            else {
+                int ldbn = plasma_tile_mmain(B, n);
+                for (int k = 0; k < A.mt; k++) {
+                    int mvak = plasma_tile_mview(A, k);
+                    int ldak = plasma_tile_mmain(A, k);
+                    plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                    (commute && (k > 0 || beta == 1.0) ?
+                     core_omp_cgemm_commute : core_omp_cgemm)(
+                        transa, transb,
+                        mvcm, nvcn, mvak,
+                        alpha, A(k, m), ldak,
+                               B(n, k), ldbn,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
                 }
             }
         }
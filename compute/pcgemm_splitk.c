@@ -0,0 +1,79 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgemm_splitk.c, normal z -> c, Thu Oct 15 02:08:21 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication with the inner dimension split
+ * into parts of about the same number of tiles. Part 0 updates C, and part
+ * g > 0 computes its product into the workspace W[g-1], of the size of C.
+ * The workspaces are then added into C by a binary tree, whose additions
+ * start as soon as their two operands are complete.
+ * @see plasma_gemm_splits
+ ******************************************************************************/
+void plasma_pcgemm_splitk(plasma_enum_t transa, plasma_enum_t transb,
+                          plasma_complex32_t alpha, plasma_desc_t A,
+                                                    plasma_desc_t B,
+                          plasma_complex32_t beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int kdim = transa == PlasmaNoTrans ? A.n : A.m;
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+    int kb = transa == PlasmaNoTrans ? A.nb : A.mb;
+
+    for (int g = 0; g < splits; g++) {
+        int k1 = g*kt/splits*kb;
+        int k2 = imin((g+1)*kt/splits*kb, kdim);
+
+        plasma_desc_t Ag = transa == PlasmaNoTrans
+            ? plasma_desc_view(A, 0, k1, A.m, k2-k1)
+            : plasma_desc_view(A, k1, 0, k2-k1, A.n);
+        plasma_desc_t Bg = transb == PlasmaNoTrans
+            ? plasma_desc_view(B, k1, 0, k2-k1, B.n)
+            : plasma_desc_view(B, 0, k1, B.m, k2-k1);
+
+        if (g == 0)
+            plasma_pcgemm(transa, transb,
+                          alpha, Ag,
+                                 Bg,
+                          beta,  C,
+                          sequence, request);
+        else
+            plasma_pcgemm(transa, transb,
+                          alpha, Ag,
+                                 Bg,
+                          0.0,   W[g-1],
+                          sequence, request);
+    }
+
+    // Part g accumulates part g+s at the level of stride s.
+    for (int s = 1; s < splits; s *= 2) {
+        for (int g = 0; g+s < splits; g += 2*s) {
+            plasma_desc_t D = g == 0 ? C : W[g-1];
+            plasma_pcgeadd(PlasmaNoTrans,
+                           1.0, W[g+s-1],
+                           1.0, D,
+                           sequence, request);
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgeqrfrh.c, normal z -> c, Mon Feb  6 14:06:15 2017
+ * @generated from compute/pzgeqrfrh.c, normal z -> c, Thu Oct 15 05:36:30 2026
  *
  **/
 
@@ -34,9 +34,11 @@ void plasma_pcgeqrfrh(plasma_desc_t A, plasma_desc_t T,
         return;
 
     // Precompute order of QR operations.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
-    plasma_rh_tree_operations(A.mt, A.nt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.mt, A.nt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -56,7 +58,7 @@ void plasma_pcgeqrfrh(plasma_desc_t A, plasma_desc_t T,
                 mvak, nvaj, ib,
                 A(k, j), ldak,
                 T(k, j), T.mb,
-                work,
+                work, plasma->panel_blas_threads,
                 sequence, request);
 
             for (int jj = j + 1; jj < A.nt; jj++) {
@@ -132,5 +134,5 @@ void plasma_pcgeqrfrh(plasma_desc_t A, plasma_desc_t T,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
@@ -0,0 +1,164 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgerbt.c, normal z -> c, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// Applies the butterflies of one level to the range of rows (side = left)
+// or columns (side = right) i0 to i1-1, split in halves at the next tile
+// boundary past its middle, so that each tile is paired with a single tile.
+// A range within a tile is split in its middle, the butterfly of the range
+// updating that tile only.
+static void plasma_pcgerbt_range(plasma_enum_t side, plasma_enum_t trans,
+                                 const float *u, plasma_desc_t A,
+                                 int i0, int i1,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int nb = side == PlasmaLeft ? A.mb : A.nb;
+    int len = i1-i0;
+    int h = (len+1)/2;
+    if (len > nb)
+        h = (h+nb-1)/nb*nb;
+
+    // tiles of the first half, their partners and their offsets in them
+    int t0 = i0/nb;
+    int t1 = len > nb ? (i0+h)/nb : t0+1;
+    int tp = len > nb ? h/nb : 0;
+    int off = len > nb ? 0 : i0-t0*nb;
+    int nt = side == PlasmaLeft ? A.nt : A.mt;
+
+    for (int t = t0; t < t1; t++) {
+        // rows (columns) of the tile of the first half and of its partner
+        int k1 = len > nb ? nb : h;
+        int k2 = len > nb ? imax(0, imin(nb, i1-(t+tp)*nb)) : len-h;
+        int p = k2 > 0 ? t+tp : t;
+        int off2 = len > nb ? 0 : off+h;
+        const float *u1 = &u[t*nb+off];
+        const float *u2 = &u[p*nb+off2];
+
+        for (int j = 0; j < nt; j++) {
+            plasma_complex32_t *a1, *a2;
+            int lda1, lda2, m1, n1, m2, n2;
+            if (side == PlasmaLeft) {
+                a1 = A(t, j);
+                a2 = A(p, j);
+                lda1 = plasma_tile_mmain(A, t);
+                lda2 = plasma_tile_mmain(A, p);
+                m1 = k1;
+                m2 = k2;
+                n1 = plasma_tile_nview(A, j);
+                n2 = n1;
+            }
+            else {
+                a1 = A(j, t);
+                a2 = A(j, p);
+                lda1 = plasma_tile_mmain(A, j);
+                lda2 = lda1;
+                m1 = plasma_tile_mview(A, j);
+                m2 = m1;
+                n1 = k1;
+                n2 = k2;
+            }
+            size_t ld1 = side == PlasmaLeft ? off : (size_t)lda1*off;
+            size_t ld2 = side == PlasmaLeft ? off2 : (size_t)lda2*off2;
+            int na1 = side == PlasmaLeft ? n1 : plasma_tile_nmain(A, t);
+            int na2 = side == PlasmaLeft ? n2 : plasma_tile_nmain(A, p);
+
+            #pragma omp task depend(inout:a1[0:lda1*na1]) \
+                             depend(inout:a2[0:lda2*na2]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("cgerbt", a1);
+                if (PLASMA_TRACE_RUN(sequence))
+                    core_cgerbt(side, trans,
+                                m1, n1, m2, n2,
+                                &a1[ld1], lda1,
+                                &a2[ld2], lda2,
+                                u1, u2);
+                PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                                   4.0*(m1*n1 + m2*n2),
+                                   2.0*(m1*n1 + m2*n2));
+                PLASMA_TRACE_STOP("cgerbt", 2, a1, a2);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the levels below the range i0 to i1-1 from level, down to last.
+static void plasma_pcgerbt_recurse(plasma_enum_t side, plasma_enum_t trans,
+                                   const float *U, int level, int last,
+                                   plasma_desc_t A, int i0, int i1,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    int n = side == PlasmaLeft ? A.m : A.n;
+    if (level == last) {
+        plasma_pcgerbt_range(side, trans, &U[(size_t)n*level], A, i0, i1,
+                             sequence, request);
+        return;
+    }
+    int nb = side == PlasmaLeft ? A.mb : A.nb;
+    int len = i1-i0;
+    int h = (len+1)/2;
+    if (len > nb)
+        h = (h+nb-1)/nb*nb;
+
+    if (len > 1) {
+        plasma_pcgerbt_recurse(side, trans, U, level+1, last, A, i0, i0+h,
+                               sequence, request);
+        plasma_pcgerbt_recurse(side, trans, U, level+1, last, A, i0+h, i1,
+                               sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel application of a recursive random butterfly transformation
+ *  of the given depth, tile by tile. With the butterfly matrices W_l of the
+ *  levels l, each block diagonal with 2^l butterflies,
+ *
+ *    side = PlasmaLeft,  trans = Plasma_ConjTrans: A = W_d^T...W_1^T * A,
+ *    side = PlasmaLeft,  trans = PlasmaNoTrans:    A = W_1...W_d * A,
+ *    side = PlasmaRight, trans = PlasmaNoTrans:    A = A * W_1...W_d.
+ *
+ *  U contains the random values of the levels, A.m (left) or A.n (right)
+ *  per level. The ranges of a level are split at tile boundaries, which
+ *  requires square tiles.
+ * @see plasma_omp_cgesv_rbt
+ **/
+void plasma_pcgerbt(plasma_enum_t side, plasma_enum_t trans,
+                    const float *U, int depth, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int n = side == PlasmaLeft ? A.m : A.n;
+
+    // The levels of W^T on the left and W on the right go downwards,
+    // those of W on the left upwards.
+    int down = (side == PlasmaLeft) != (trans == PlasmaNoTrans);
+    for (int l = 0; l < depth; l++) {
+        int level = down ? l : depth-1-l;
+        plasma_pcgerbt_recurse(side, trans, U, 0, level, A, 0, n,
+                               sequence, request);
+    }
+}
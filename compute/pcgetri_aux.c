@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgetri_aux.c, normal z -> c, Mon Feb  6 14:06:16 2017
+ * @generated from compute/pzgetri_aux.c, normal z -> c, Thu Oct 15 01:46:29 2026
  *
  **/
 
@@ -15,89 +15,98 @@
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
-#include "plasma_workspace.h"
 #include "core_blas.h"
 
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
-#define W(m)    (plasma_complex32_t*)plasma_tile_addr(W, m, 0)
 
 /***************************************************************************//**
- *  Parallel cgetri auxrialiry routine - dynamic scheduling
+ *  Parallel cgetri auxiliary routine - dynamic scheduling.
+ *  Computes A = U L^{-1} in place, where U is stored in the upper triangle
+ *  and the unit lower triangular L in the strictly lower triangle of A.
+ *  L is inverted in place first, and the triangular factors are then
+ *  multiplied in place, one L-shaped block of tile row k and tile column k
+ *  at a time, for k increasing. Block k only reads the tiles of the blocks
+ *  k and above, so no copy of L is needed.
  **/
-void plasma_pcgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_pcgetri_aux(plasma_desc_t A,
                         plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    plasma_complex32_t zone  = 1.0;
-    plasma_complex32_t zzero = 0.0;
+    plasma_complex32_t zone = 1.0;
 
     if (sequence->status != PlasmaSuccess)
         return;
 
-    for (int k = A.mt-1; k >= 0; k--) {
+    // Invert the unit lower triangle.
+    plasma_pctrtri(PlasmaLower, PlasmaUnit, A, sequence, request);
+
+    for (int k = 0; k < A.mt; k++) {
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
-
         int ldak = plasma_tile_mmain(A, k);
-        int ldakn= plasma_tile_mmain(A, k);
-        int ldwk = plasma_tile_mmain(W, k);
 
-        // copy L(k, k) into W(k)
-        core_omp_clacpy(
-            PlasmaLower, mvak, nvak,
-            A(k, k), ldak, W(k), ldwk,
-            sequence, request );
-        // zero strictly-lower part of U(k, k)
-        core_omp_claset(
-            PlasmaLower,
-            ldak, ldakn, 1, 0,
-            nvak-1, nvak-1,
-            zzero, zzero, A(k, k));
-
-        for (int m = k+1; m < A.mt; m++) {
+        // A(m, k) = U(m, k:nt) L(k:nt, k)
+        for (int m = 0; m < k; m++) {
             int mvam = plasma_tile_mview(A, m);
             int ldam = plasma_tile_mmain(A, m);
-            int ldwm = plasma_tile_mmain(W, m);
-            // copy L(m, k) to W(m)
-            core_omp_clacpy(
-                PlasmaGeneral, mvam, nvak,
-                A(m, k), ldam, W(m), ldwm,
-                sequence, request );
-            // zero U(m, k)
-            core_omp_claset(
-                PlasmaGeneral,
-                ldam, ldakn, 0, 0,
+            core_omp_ctrmm(
+                PlasmaRight, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
                 mvam, nvak,
-                zzero, zzero, A(m, k));
-        }
+                zone, A(k, k), ldak,
+                      A(m, k), ldam,
+                sequence, request);
 
-        // update A(:, k) = A(:, k)-A(:, k+1:nt)*L(k+1:nt, k)
-        for (int m = 0; m < A.mt; m++) {
-            int mvam = plasma_tile_mview(A, m);
-            int ldam = plasma_tile_mmain(A, m);
             for (int n = k+1; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
-                int ldwn = plasma_tile_mmain(W, n);
+                int ldan = plasma_tile_mmain(A, n);
                 core_omp_cgemm(
-                     PlasmaNoTrans, PlasmaNoTrans,
-                     mvam, nvak, nvan,
-                     -zone, A(m, n), ldam,
-                            W( n ),  ldwn,
-                      zone, A(m, k), ldam,
-                      sequence, request);
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvak, nvan,
+                    zone, A(m, n), ldam,
+                          A(n, k), ldan,
+                    zone, A(m, k), ldam,
+                    sequence, request);
             }
         }
 
-        // compute A(:, k) = A(:, k) L(k, k)^{-1}
-        for (int m = 0; m < A.mt; m++) {
-            int mvam = plasma_tile_mview(A, m);
-            int ldam = plasma_tile_mmain(A, m);
-            core_omp_ctrsm(
-                PlasmaRight, PlasmaLower,
-                PlasmaNoTrans, PlasmaUnit,
-                mvam, nvak,
-                zone, W( k ),   ldwk,
-                      A( m, k ),ldam,
-                sequence, request );
+        // A(k, n) = U(k, k:nt) L(k:nt, n)
+        for (int n = 0; n < k; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_ctrmm(
+                PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                mvak, nvan,
+                zone, A(k, k), ldak,
+                      A(k, n), ldak,
+                sequence, request);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_cgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvak, nvan, nvam,
+                    zone, A(k, m), ldak,
+                          A(m, n), ldam,
+                    zone, A(k, n), ldak,
+                    sequence, request);
+            }
+        }
+
+        // A(k, k) = U(k, k:nt) L(k:nt, k)
+        core_omp_clumm(
+            imin(mvak, nvak),
+            A(k, k), ldak,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            int ldan = plasma_tile_mmain(A, n);
+            core_omp_cgemm(
+                PlasmaNoTrans, PlasmaNoTrans,
+                mvak, nvak, nvan,
+                zone, A(k, n), ldak,
+                      A(n, k), ldan,
+                zone, A(k, k), ldak,
+                sequence, request);
         }
     }
 }
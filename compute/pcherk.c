@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzherk.c, normal z -> c, Mon Feb  6 14:06:16 2017
+ * @generated from compute/pzherk.c, normal z -> c, Thu Oct 15 05:03:00 2026
  *
  **/
 
@@ -18,9 +18,111 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <stdlib.h>
+
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 #define C(m, n) (plasma_complex32_t*)plasma_tile_addr(C, m, n)
 
+/***************************************************************************//**
+ * Parallel tile Hermitian rank k update, with the off-diagonal tiles
+ * computed by the 3M algorithm. Each tile of A is split once as the left
+ * operand and once, conjugate transposed, as the right operand.
+ ******************************************************************************/
+static void plasma_pcherk_3m(plasma_enum_t uplo, plasma_enum_t trans,
+                             float alpha, plasma_desc_t A,
+                             float beta,  plasma_desc_t C,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    int kt = trans == PlasmaNoTrans ? A.nt : A.mt;
+    plasma_enum_t transl = trans;
+    plasma_enum_t transr =
+        trans == PlasmaNoTrans ? PlasmaConjTrans : PlasmaNoTrans;
+
+    float **L = (float**)calloc((size_t)C.mt*kt, sizeof(float*));
+    float **R = (float**)calloc((size_t)C.mt*kt, sizeof(float*));
+    if (L == NULL || R == NULL) {
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        free(L);
+        free(R);
+        return;
+    }
+
+    // Split the tiles of the rows of op( A ) multiplying the tiles below
+    // the diagonal of C from the left or from the right.
+    for (int i = 0; i < C.mt; i++) {
+        int mvci = plasma_tile_mview(C, i);
+        int left = uplo == PlasmaLower ? i > 0 : i < C.mt-1;
+        int right = uplo == PlasmaLower ? i < C.mt-1 : i > 0;
+        for (int k = 0; k < kt; k++) {
+            int kvak = trans == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                              : plasma_tile_mview(A, k);
+            int am = trans == PlasmaNoTrans ? i : k;
+            int an = trans == PlasmaNoTrans ? k : i;
+            int ldam = plasma_tile_mmain(A, am);
+            if (left)
+                core_omp_cgemm3m_split(
+                    transl, mvci, kvak,
+                    A(am, an), ldam,
+                    &L[i*kt+k],
+                    sequence, request);
+            if (right)
+                core_omp_cgemm3m_split(
+                    transr, kvak, mvci,
+                    A(am, an), ldam,
+                    &R[i*kt+k],
+                    sequence, request);
+        }
+    }
+
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        int ldcn = plasma_tile_mmain(C, n);
+        for (int k = 0; k < kt; k++) {
+            int kvak = trans == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                              : plasma_tile_mview(A, k);
+            int am = trans == PlasmaNoTrans ? n : k;
+            int an = trans == PlasmaNoTrans ? k : n;
+            core_omp_cherk(
+                uplo, trans,
+                nvcn, kvak,
+                alpha, A(am, an), plasma_tile_mmain(A, am),
+                k == 0 ? beta : 1.0, C(n, n), ldcn,
+                sequence, request);
+        }
+        for (int m = n+1; m < C.mt; m++) {
+            int mvcm = plasma_tile_mview(C, m);
+            int ldcm = plasma_tile_mmain(C, m);
+            for (int k = 0; k < kt; k++) {
+                int kvak = trans == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                                  : plasma_tile_mview(A, k);
+                plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
+                if (uplo == PlasmaLower)
+                    core_omp_cgemm3m(
+                        mvcm, nvcn, kvak,
+                        alpha, &L[m*kt+k], &R[n*kt+k],
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                else
+                    core_omp_cgemm3m(
+                        nvcn, mvcm, kvak,
+                        alpha, &L[n*kt+k], &R[m*kt+k],
+                        zbeta, C(n, m), ldcn,
+                        sequence, request);
+            }
+        }
+    }
+
+    #pragma omp taskwait
+    for (int i = 0; i < C.mt*kt; i++) {
+        free(L[i]);
+        free(R[i]);
+    }
+    free(L);
+    free(R);
+}
+
 /***************************************************************************//**
  * Parallel tile Hermitian rank k update.
  * @see plasma_omp_cherk
@@ -34,6 +136,18 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    int kdim = trans == PlasmaNoTrans ? A.n : A.m;
+    if (plasma_gemm_3m(plasma_context_self()) &&
+        C.mt > 1 && alpha != 0.0 && kdim != 0) {
+        plasma_pcherk_3m(uplo, trans, alpha, A, beta, C,
+                         sequence, request);
+        return;
+    }
+
+    // The updates after the one scaling C by beta accumulate into C
+    // in any order with commutative updates.
+    int commute = plasma_commute_updates(plasma_context_self());
+
     for (int n = 0; n < C.nt; n++) {
         int nvcn = plasma_tile_nview(C, n);
         int ldan = plasma_tile_mmain(A, n);
@@ -45,7 +159,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
             for (int k = 0; k < A.nt; k++) {
                 int nvak = plasma_tile_nview(A, k);
                 float dbeta = k == 0 ? beta : 1.0;
-                core_omp_cherk(
+                (commute && (k > 0 || beta == 1.0) ?
+                 core_omp_cherk_commute : core_omp_cherk)(
                     uplo, trans,
                     nvcn, nvak,
                     alpha, A(n, k), ldan,
@@ -63,7 +178,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                     for (int k = 0; k < A.nt; k++) {
                         int nvak = plasma_tile_nview(A, k);
                         plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_cgemm_commute : core_omp_cgemm)(
                             trans, PlasmaConjTrans,
                             mvcm, nvcn, nvak,
                             alpha, A(m, k), ldam,
@@ -83,7 +199,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                     for (int k = 0; k < A.nt; k++) {
                         int nvak = plasma_tile_nview(A, k);
                         plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_cgemm_commute : core_omp_cgemm)(
                             trans, PlasmaConjTrans,
                             nvcn, mvcm, nvak,
                             alpha, A(n, k), ldan,
@@ -102,7 +219,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                 int mvak = plasma_tile_mview(A, k);
                 int ldak = plasma_tile_mmain(A, k);
                 float dbeta = k == 0 ? beta : 1.0;
-                core_omp_cherk(
+                (commute && (k > 0 || beta == 1.0) ?
+                 core_omp_cherk_commute : core_omp_cherk)(
                     uplo, trans,
                     nvcn, mvak,
                     alpha, A(k, n), ldak,
@@ -120,7 +238,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                         int mvak = plasma_tile_mview(A, k);
                         int ldak = plasma_tile_mmain(A, k);
                         plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_cgemm_commute : core_omp_cgemm)(
                             trans, PlasmaNoTrans,
                             mvcm, nvcn, mvak,
                             alpha, A(k, m), ldak,
@@ -140,7 +259,8 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                         int mvak = plasma_tile_mview(A, k);
                         int ldak = plasma_tile_mmain(A, k);
                         plasma_complex32_t zbeta = k == 0 ? beta : 1.0;
-                        core_omp_cgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_cgemm_commute : core_omp_cgemm)(
                             trans, PlasmaNoTrans,
                             nvcn, mvcm, mvak,
                             alpha, A(k, n), ldak,
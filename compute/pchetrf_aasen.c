@@ -0,0 +1,365 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzhetrf_aasen.c, normal z -> c, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+#define T(m, n) (plasma_complex32_t*)plasma_tile_addr(T, m, n)
+#define H(m, n) (plasma_complex32_t*)plasma_tile_addr(H, m, n)
+
+/***************************************************************************//**
+ *  Copies the conjugate of the strictly lower triangle of a square tile to
+ *  its strictly upper triangle, and zeroes the imaginary part of its
+ *  diagonal, so that the tile holds a Hermitian matrix in full.
+ **/
+static void plasma_pchetrf_aasen_herm(int n, plasma_complex32_t *a, int lda,
+                                      plasma_sequence_t *sequence)
+{
+    #pragma omp task depend(inout:a[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zhe2ge", a);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            for (int j = 0; j < n; j++) {
+                a[j + j*lda] = creal(a[j + j*lda]);
+                for (int i = j+1; i < n; i++)
+                    a[j + i*lda] = conjf(a[i + j*lda]);
+            }
+        }
+        PLASMA_TRACE_STOP("zhe2ge", 1, a);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile factorization of a Hermitian indefinite matrix by Aasen's
+ *  algorithm, P A P^T = L T L^H, where L is unit lower triangular with the
+ *  first tile column of the identity, and T is Hermitian block tridiagonal
+ *  with upper triangular subdiagonal blocks, a band of bandwidth nb.
+ *
+ *  The algorithm is left-looking. Step j computes the tile column j of
+ *  H = T L^H and the diagonal block T(j, j) from the tile row j of L, and
+ *  the panel
+ *      W = A(j+1:nt-1, j) - L(j+1:nt-1, 0:j) H(0:j, j),
+ *  by tile gemms. The panel is then factored by the threaded partial
+ *  pivoting panel of plasma_pcgetrf, W = P L(j+1:nt-1, j+1) U, and
+ *  T(j+1, j) = U L(j, j)^{-H}. The pivots are applied from both sides to
+ *  the trailing matrix, which is kept in full, and to the rows of L.
+ *
+ *  The tile column j+1 of L is stored in the tile column j of A, below the
+ *  diagonal tiles, with U above the unit diagonal of A(j+1, j), so the
+ *  factor solves by plasma_pctrsm on A(nb:n-1, 0:n-nb-1). T(j, j) is in
+ *  T(j, 0) and T(j, j-1) in T(j, 1). H is a workspace of two tile columns.
+ *  ipiv holds the global row interchanges, with none in the first tile.
+ * @see plasma_omp_chetrf
+ **/
+void plasma_pchetrf_aasen(plasma_desc_t A, int *ipiv,
+                          plasma_desc_t T, plasma_desc_t H,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int ib = plasma->ib;
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+    plasma_panel_workspace_t *panel_work = &plasma->panel_work;
+
+    // Store the Hermitian matrix in full, as the pivots are applied
+    // from both sides.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        int ldan = plasma_tile_mmain(A, n);
+        plasma_pchetrf_aasen_herm(nvan, A(n, n), ldan, sequence);
+
+        for (int m = n+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_complex32_t *amn = A(m, n);
+            plasma_complex32_t *anm = A(n, m);
+
+            // A(n, m) = A(m, n)^H
+            #pragma omp task depend(in:amn[0:ldam*nvan]) \
+                             depend(out:anm[0:ldan*mvam]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("zhe2ge", anm);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    for (int j = 0; j < nvan; j++)
+                        for (int i = 0; i < mvam; i++)
+                            anm[j + i*ldan] = conjf(amn[i + j*ldam]);
+                }
+                PLASMA_TRACE_STOP("zhe2ge", 1, anm, amn);
+            }
+        }
+    }
+    plasma_pclaset(PlasmaGeneral, 0.0, 0.0, T, sequence, request);
+    plasma_pclaset(PlasmaGeneral, 0.0, 0.0, H, sequence, request);
+
+    // no interchanges in the first tile
+    for (int i = 0; i < imin(A.mb, A.m); i++)
+        ipiv[i] = i+1;
+
+    for (int j = 0; j < A.nt; j++) {
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvaj = plasma_tile_mview(A, j);
+        int ldaj = plasma_tile_mmain(A, j);
+        int ldtj = plasma_tile_mmain(T, j);
+        int ldhj = plasma_tile_mmain(H, j);
+
+        //==================================================
+        // H(i, j) = T(i, i-1:i+1) L(j, i-1:i+1)^H, i < j
+        // L(j, k) is in A(j, k-1), and L(j, 0) = 0.
+        //==================================================
+        for (int i = 0; i < j; i++) {
+            int mvai = plasma_tile_mview(A, i);
+            int ldti = plasma_tile_mmain(T, i);
+            int ldhi = plasma_tile_mmain(H, i);
+
+            if (i >= 1) {
+                core_omp_cgemm(
+                    PlasmaNoTrans, Plasma_ConjTrans,
+                    mvai, mvaj, mvai,
+                    1.0, T(i, 0), ldti,
+                         A(j, i-1), ldaj,
+                    0.0, H(i, 0), ldhi,
+                    sequence, request);
+            }
+            if (i >= 2) {
+                core_omp_cgemm(
+                    PlasmaNoTrans, Plasma_ConjTrans,
+                    mvai, mvaj, plasma_tile_mview(A, i-1),
+                    1.0, T(i, 1), ldti,
+                         A(j, i-2), ldaj,
+                    1.0, H(i, 0), ldhi,
+                    sequence, request);
+            }
+            if (i+1 < j) {
+                int mvai1 = plasma_tile_mview(A, i+1);
+                int ldti1 = plasma_tile_mmain(T, i+1);
+                core_omp_cgemm(
+                    Plasma_ConjTrans, Plasma_ConjTrans,
+                    mvai, mvaj, mvai1,
+                    1.0, T(i+1, 1), ldti1,
+                         A(j, i), ldaj,
+                    i >= 1 ? 1.0 : 0.0, H(i, 0), ldhi,
+                    sequence, request);
+            }
+            else {
+                // T(j-1, j) L(j, j)^H = (L(j, j) T(j, j-1))^H
+                core_omp_clacpy(
+                    PlasmaGeneral, mvaj, mvai,
+                    T(j, 1), ldtj,
+                    H(j, 1), ldhj,
+                    sequence, request);
+                core_omp_ctrmm(
+                    PlasmaLeft, PlasmaLower,
+                    PlasmaNoTrans, PlasmaUnit,
+                    mvaj, mvai,
+                    1.0, A(j, j-1), ldaj,
+                         H(j, 1), ldhj,
+                    sequence, request);
+                core_omp_cgeadd(
+                    Plasma_ConjTrans, mvai, mvaj,
+                    1.0, H(j, 1), ldhj,
+                    i >= 1 ? 1.0 : 0.0, H(i, 0), ldhi,
+                    sequence, request);
+            }
+        }
+
+        //===========================================================
+        // T(j, j) = L(j, j)^{-1} (A(j, j) - L(j, 0:j-1) H(0:j-1, j)
+        //           - L(j, j) T(j, j-1) L(j, j-1)^H) L(j, j)^{-H}
+        //===========================================================
+        core_omp_clacpy(
+            PlasmaGeneral, mvaj, mvaj,
+            A(j, j), ldaj,
+            T(j, 0), ldtj,
+            sequence, request);
+        for (int k = 1; k < j; k++) {
+            int ldhk = plasma_tile_mmain(H, k);
+            core_omp_cgemm(
+                PlasmaNoTrans, PlasmaNoTrans,
+                mvaj, mvaj, plasma_tile_mview(A, k),
+                -1.0, A(j, k-1), ldaj,
+                      H(k, 0), ldhk,
+                 1.0, T(j, 0), ldtj,
+                sequence, request);
+        }
+        if (j >= 1) {
+            core_omp_ctrsm(
+                PlasmaLeft, PlasmaLower,
+                PlasmaNoTrans, PlasmaUnit,
+                mvaj, mvaj,
+                1.0, A(j, j-1), ldaj,
+                     T(j, 0), ldtj,
+                sequence, request);
+            if (j >= 2) {
+                core_omp_cgemm(
+                    PlasmaNoTrans, Plasma_ConjTrans,
+                    mvaj, mvaj, plasma_tile_mview(A, j-1),
+                    -1.0, T(j, 1), ldtj,
+                          A(j, j-2), ldaj,
+                     1.0, T(j, 0), ldtj,
+                    sequence, request);
+            }
+            core_omp_ctrsm(
+                PlasmaRight, PlasmaLower,
+                Plasma_ConjTrans, PlasmaUnit,
+                mvaj, mvaj,
+                1.0, A(j, j-1), ldaj,
+                     T(j, 0), ldtj,
+                sequence, request);
+        }
+        plasma_pchetrf_aasen_herm(mvaj, T(j, 0), ldtj, sequence);
+
+        if (j == A.nt-1)
+            break;
+
+        //========================================================
+        // H(j, j) = T(j, j-1) L(j, j-1)^H + T(j, j) L(j, j)^H
+        //========================================================
+        core_omp_clacpy(
+            PlasmaGeneral, mvaj, mvaj,
+            T(j, 0), ldtj,
+            H(j, 0), ldhj,
+            sequence, request);
+        if (j >= 1) {
+            core_omp_ctrmm(
+                PlasmaRight, PlasmaLower,
+                Plasma_ConjTrans, PlasmaUnit,
+                mvaj, mvaj,
+                1.0, A(j, j-1), ldaj,
+                     H(j, 0), ldhj,
+                sequence, request);
+        }
+        if (j >= 2) {
+            core_omp_cgemm(
+                PlasmaNoTrans, Plasma_ConjTrans,
+                mvaj, mvaj, plasma_tile_mview(A, j-1),
+                1.0, T(j, 1), ldtj,
+                     A(j, j-2), ldaj,
+                1.0, H(j, 0), ldhj,
+                sequence, request);
+        }
+
+        //=============================================================
+        // W = A(j+1:nt-1, j) - L(j+1:nt-1, 1:j) H(1:j, j), in place
+        //=============================================================
+        for (int i = j+1; i < A.mt; i++) {
+            int mvai = plasma_tile_mview(A, i);
+            int ldai = plasma_tile_mmain(A, i);
+            for (int k = 1; k <= j; k++) {
+                int ldhk = plasma_tile_mmain(H, k);
+                core_omp_cgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvai, mvaj, plasma_tile_mview(A, k),
+                    -1.0, A(i, k-1), ldai,
+                          H(k, 0), ldhk,
+                     1.0, A(i, j), ldai,
+                    sequence, request);
+            }
+        }
+        // The panel spans the tiles of the column.
+        #pragma omp taskwait
+
+        //=====================================
+        // W = P L(j+1:nt-1, j+1) U, threaded
+        //=====================================
+        int m1 = (j+1)*A.mb;
+        plasma_desc_t panel =
+            plasma_desc_view(A, m1, j*A.nb, A.m-m1, mvaj);
+
+        int info = plasma_pcgetrf_panel(panel, &ipiv[m1], ib,
+                                        PlasmaIterativePanel,
+                                        panel_team, panel_bind,
+                                        num_panel_threads, 0, panel_work);
+        if (info != 0)
+            plasma_request_fail(sequence, request, m1+info);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int npiv = imin(A.m-m1, mvaj);
+        for (int i = m1; i < m1+npiv; i++)
+            ipiv[i] += m1;
+
+        //=====================================
+        // T(j+1, j) = U L(j, j)^{-H}
+        //=====================================
+        int mvaj1 = plasma_tile_mview(A, j+1);
+        int ldaj1 = plasma_tile_mmain(A, j+1);
+        int ldtj1 = plasma_tile_mmain(T, j+1);
+        core_omp_clacpy(
+            PlasmaUpper, mvaj1, mvaj,
+            A(j+1, j), ldaj1,
+            T(j+1, 1), ldtj1,
+            sequence, request);
+        if (j >= 1) {
+            core_omp_ctrsm(
+                PlasmaRight, PlasmaLower,
+                Plasma_ConjTrans, PlasmaUnit,
+                mvaj1, mvaj,
+                1.0, A(j, j-1), ldaj,
+                     T(j+1, 1), ldtj1,
+                sequence, request);
+        }
+
+        //==============================================================
+        // symmetric interchanges of the trailing matrix, and the rows
+        // of the tile columns of L before the panel
+        //==============================================================
+        int k1 = m1+1;
+        int k2 = m1+npiv;
+        for (int n = 0; n < A.nt; n++) {
+            if (n == j)
+                continue;
+
+            #pragma omp task priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("claswp", A(0, n));
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int nvan = plasma_tile_nview(A, n);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    core_claswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                }
+                PLASMA_TRACE_STOP("claswp", 1, A(0, n), &ipiv[m1]);
+            }
+        }
+        #pragma omp taskwait
+        for (int m = j+1; m < A.mt; m++) {
+            #pragma omp task priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("claswp", A(m, 0));
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int mvam = plasma_tile_mview(A, m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
+                    core_claswp(PlasmaColumnwise, view, k1, k2, ipiv, 1);
+                }
+                PLASMA_TRACE_STOP("claswp", 1, A(m, 0), &ipiv[m1]);
+            }
+        }
+        #pragma omp taskwait
+    }
+}
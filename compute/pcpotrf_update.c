@@ -0,0 +1,114 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzpotrf_update.c, normal z -> c, Thu Oct 15 04:52:57 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+#define V(m, n) (plasma_complex32_t*)plasma_tile_addr(V, m, n)
+#define G(m, n) (plasma_complex32_t*)plasma_tile_addr(G, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile rank-k update or downdate of a Cholesky factor.
+ *  For each tile column j of the factor, the rotations of the diagonal tile
+ *  with each tile of the tile row j of V are applied to the tiles below, so
+ *  that the tile columns proceed in a wavefront as the tiles of V below the
+ *  diagonal tile are updated.
+ * @see plasma_omp_cpotrf_update
+ **/
+void plasma_pcpotrf_update(plasma_enum_t uplo, int sign,
+                           plasma_desc_t A, plasma_desc_t V, plasma_desc_t G,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (uplo == PlasmaLower) {
+        for (int j = 0; j < A.nt; j++) {
+            plasma_task_window(plasma, j);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int nvaj = plasma_tile_nview(A, j);
+            int ldaj = plasma_tile_mmain(A, j);
+            int ldvj = plasma_tile_mmain(V, j);
+            for (int p = 0; p < V.nt; p++) {
+                int nvvp = plasma_tile_nview(V, p);
+                core_omp_cchud(
+                    uplo, sign, nvaj, nvvp,
+                    A(j, j), ldaj,
+                    V(j, p), ldvj,
+                    G(j, p), G.mb,
+                    A.nb*j,
+                    sequence, request);
+
+                for (int i = j+1; i < A.mt; i++) {
+                    int mvai = plasma_tile_mview(A, i);
+                    int ldai = plasma_tile_mmain(A, i);
+                    int ldvi = plasma_tile_mmain(V, i);
+                    core_omp_cchudm(
+                        uplo, sign, mvai, nvaj, nvvp,
+                        G(j, p), G.mb,
+                        A(i, j), ldai,
+                        V(i, p), ldvi,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int j = 0; j < A.mt; j++) {
+            plasma_task_window(plasma, j);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvaj = plasma_tile_mview(A, j);
+            int ldaj = plasma_tile_mmain(A, j);
+            int ldvj = plasma_tile_mmain(V, j);
+            for (int p = 0; p < V.nt; p++) {
+                int nvvp = plasma_tile_nview(V, p);
+                core_omp_cchud(
+                    uplo, sign, mvaj, nvvp,
+                    A(j, j), ldaj,
+                    V(j, p), ldvj,
+                    G(j, p), G.mb,
+                    A.mb*j,
+                    sequence, request);
+
+                for (int i = j+1; i < A.nt; i++) {
+                    int nvai = plasma_tile_nview(A, i);
+                    int ldvi = plasma_tile_mmain(V, i);
+                    core_omp_cchudm(
+                        uplo, sign, nvai, mvaj, nvvp,
+                        G(j, p), G.mb,
+                        A(j, i), ldaj,
+                        V(i, p), ldvi,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
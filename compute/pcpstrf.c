@@ -0,0 +1,102 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzpstrf.c, normal z -> c, Thu Oct 15 08:37:15 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// arguments of the ranks of the team of the factorization
+typedef struct {
+    plasma_desc_t A;
+    int *piv;
+    float tol;
+    float *diag;
+    plasma_complex32_t *x;
+    plasma_panel_workspace_t *work;
+    int rank;
+} plasma_pcpstrf_team_t;
+
+/******************************************************************************/
+// Runs a rank of the team of the factorization.
+static void plasma_pcpstrf_rank(void *args, int rank, int size,
+                                plasma_barrier_t *barrier)
+{
+    plasma_pcpstrf_team_t *team = (plasma_pcpstrf_team_t*)args;
+
+    int r = core_cpstrf(team->A, team->piv, team->tol,
+                        team->diag, team->x,
+                        rank, size, team->work, barrier);
+
+    // Only rank 0 returns the rank of A.
+    if (rank == 0)
+        team->rank = r;
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization with complete pivoting, stopped at
+ *  the tolerance. The pivot search reads the whole remaining diagonal, so
+ *  the factorization waits for the tasks ahead of it, and then runs on a
+ *  team of PlasmaNumPanelThreads threads, see plasma_team_run(), which
+ *  share the tile rows of each column of L.
+ *  @see plasma_omp_cpstrf
+ ******************************************************************************/
+void plasma_pcpstrf(plasma_desc_t A, int *piv, int *rank, float tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    float *diag = (float*)malloc((size_t)A.n*sizeof(float));
+    plasma_complex32_t *x =
+        (plasma_complex32_t*)malloc((size_t)A.n*sizeof(plasma_complex32_t));
+    if (diag == NULL || x == NULL) {
+        free(diag);
+        free(x);
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    PLASMA_TRACE_START("cpstrf", A(0, 0));
+    plasma_pcpstrf_team_t team = { A, piv, tol, diag, x,
+                                   &plasma->panel_work, 0 };
+    if (PLASMA_TRACE_RUN(sequence))
+        plasma_team_run(plasma->panel_team, plasma->panel_bind,
+                        plasma->num_panel_threads,
+                        plasma_sequence_priority(sequence),
+                        plasma_pcpstrf_rank, &team);
+    *rank = team.rank;
+    PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                       (float)team.rank*team.rank*(A.n-2.0/3.0*team.rank),
+                       (float)A.n*team.rank);
+    PLASMA_TRACE_STOP("cpstrf", 1, A(0, 0));
+
+    free(diag);
+    free(x);
+}
@@ -0,0 +1,57 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzptsv.c, normal z -> c, Wed Oct 14 19:29:17 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define B(m, n) ((plasma_complex32_t*)plasma_tile_addr(B, m, n))
+
+/***************************************************************************//**
+ *  Parallel partitioned solve of a Hermitian positive definite tridiagonal
+ *  system, a SPIKE algorithm. The partitions are the tile rows of B,
+ *  factored and solved independently, the right hand sides by tiles.
+ *  The workspace work is of size 2*B.m + 2*B.mt*(7+B.n),
+ *  iwork of size 2*B.mt.
+ **/
+void plasma_pcptsv(float *d, plasma_complex32_t *e, plasma_desc_t B,
+                   plasma_complex32_t *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_complex32_t *VW = work;
+
+    for (int i = 0; i < B.mt; i++) {
+        int s = i*B.mb;
+        int mvbi = plasma_tile_mview(B, i);
+        int ldbi = plasma_tile_mmain(B, i);
+
+        // The couplings are not overwritten by the factorizations.
+        plasma_complex32_t dl0 = i > 0 ? e[s-1] : 0.0;
+        plasma_complex32_t dun = i < B.mt-1 ? conjf(e[s+mvbi-1]) : 0.0;
+        core_omp_cpttrf_spike(mvbi, &d[s], &e[s], dl0, dun, &VW[2*s],
+                              s, sequence, request);
+
+        for (int j = 0; j < B.nt; j++) {
+            int nvbj = plasma_tile_nview(B, j);
+            core_omp_cpttrs(mvbi, nvbj, &d[s], &e[s], B(i, j), ldbi,
+                            sequence, request);
+        }
+    }
+    plasma_pcgtsv_reduced(B, VW, &work[2*B.m], iwork, sequence, request);
+}
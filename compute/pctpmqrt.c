@@ -0,0 +1,98 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztpmqrt.c, normal z -> c, Thu Oct 15 04:46:20 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define B(m, n) (plasma_complex32_t*)plasma_tile_addr(B, m, n)
+#define T(m, n) (plasma_complex32_t*)plasma_tile_addr(T, m, n)
+#define C(m, n) (plasma_complex32_t*)plasma_tile_addr(C, m, n)
+#define D(m, n) (plasma_complex32_t*)plasma_tile_addr(D, m, n)
+
+/***************************************************************************//**
+ *  Parallel application from the left of Q, of the update of a QR
+ *  factorization by plasma_pctpqrt, to the stacked matrix [C; D].
+ * @see plasma_omp_ctpmqrt
+ **/
+void plasma_pctpmqrt(plasma_enum_t trans,
+                     plasma_desc_t B, plasma_desc_t T,
+                     plasma_desc_t C, plasma_desc_t D,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    //=====================
+    // Plasma_ConjTrans
+    //=====================
+    if (trans == Plasma_ConjTrans) {
+        for (int k = 0; k < B.nt; k++) {
+            int nvbk = plasma_tile_nview(B, k);
+            int mvck = plasma_tile_mview(C, k);
+            int ldck = plasma_tile_mmain(C, k);
+            for (int m = 0; m < B.mt; m++) {
+                int mvdm = plasma_tile_mview(D, m);
+                int ldbm = plasma_tile_mmain(B, m);
+                int lddm = plasma_tile_mmain(D, m);
+                for (int n = 0; n < C.nt; n++) {
+                    int nvcn = plasma_tile_nview(C, n);
+                    core_omp_ctsmqr(
+                        PlasmaLeft, trans,
+                        mvck, nvcn, mvdm, nvcn, nvbk, ib,
+                        C(k, n), ldck,
+                        D(m, n), lddm,
+                        B(m, k), ldbm,
+                        T(m, k), T.mb,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    //==================
+    // PlasmaNoTrans
+    //==================
+    else {
+        for (int k = B.nt-1; k >= 0; k--) {
+            int nvbk = plasma_tile_nview(B, k);
+            int mvck = plasma_tile_mview(C, k);
+            int ldck = plasma_tile_mmain(C, k);
+            for (int m = B.mt-1; m >= 0; m--) {
+                int mvdm = plasma_tile_mview(D, m);
+                int ldbm = plasma_tile_mmain(B, m);
+                int lddm = plasma_tile_mmain(D, m);
+                for (int n = 0; n < C.nt; n++) {
+                    int nvcn = plasma_tile_nview(C, n);
+                    core_omp_ctsmqr(
+                        PlasmaLeft, trans,
+                        mvck, nvcn, mvdm, nvcn, nvbk, ib,
+                        C(k, n), ldck,
+                        D(m, n), lddm,
+                        B(m, k), ldbm,
+                        T(m, k), T.mb,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
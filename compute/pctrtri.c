@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pztrtri.c, normal z -> c, Mon Feb  6 14:06:23 2017
+ * @generated from compute/pztrtri.c, normal z -> c, Thu Oct 15 08:27:15 2026
  *
  **/
 
@@ -20,18 +20,14 @@
 
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 
-/***************************************************************************//**
- * Parallel tile triangular inversion.
- * @see plasma_omp_ctrtri
- ******************************************************************************/
-void plasma_pctrtri(plasma_enum_t uplo, plasma_enum_t diag,
-                    plasma_desc_t A,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+/******************************************************************************/
+// Inverts A by a right-looking sweep over its tile columns, the columns of
+// A starting at column offset of the whole matrix, for the info of trtri.
+static void plasma_pctrtri_sweep(plasma_enum_t uplo, plasma_enum_t diag,
+                                 plasma_desc_t A, int offset,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
-        return;
-
     //==============
     // PlasmaLower
     //==============
@@ -77,7 +73,7 @@ void plasma_pctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                 uplo, diag,
                 nvak,
                 A(k, k), ldak,
-                A.nb*k,
+                offset+A.nb*k,
                 sequence, request);
         }
     }
@@ -122,8 +118,132 @@ void plasma_pctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                 uplo, diag,
                 mvak,
                 A(k, k), ldak,
-                A.nb*k,
+                offset+A.nb*k,
                 sequence, request);
         }
     }
 }
+
+/******************************************************************************/
+// Inverts A recursively, starting at column offset of the whole matrix:
+// for A lower triangular,
+//
+//     | A11     |^{-1}   |  A11^{-1}                          |
+//     | A21 A22 |      = | -A22^{-1} * A21 * A11^{-1}  A22^{-1} |,
+//
+// so that the two halves are inverted concurrently, and A21 is formed by
+// two triangular products once both are done. If W has a matrix, of the
+// dimensions of A21, the products are out of place, through W, and run as
+// parallel as a gemm. The halves then take disjoint corners of W, which
+// fit their own off-diagonal blocks.
+static void plasma_pctrtri_rec(plasma_enum_t uplo, plasma_enum_t diag,
+                               plasma_desc_t A, plasma_desc_t W, int offset,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    if (A.nt <= 1 || A.mb != A.nb) {
+        plasma_pctrtri_sweep(uplo, diag, A, offset, sequence, request);
+        return;
+    }
+
+    int n1 = (A.nt/2)*A.nb;
+    int n2 = A.n-n1;
+    plasma_desc_t A11 = plasma_desc_view(A, 0,  0,  n1, n1);
+    plasma_desc_t A22 = plasma_desc_view(A, n1, n1, n2, n2);
+
+    // Split points of the halves, and the corners of W they take.
+    plasma_desc_t W11 = W;
+    plasma_desc_t W22 = W;
+    int n11 = (A11.nt/2)*A.nb;
+    int n21 = (A22.nt/2)*A.nb;
+    if (W.matrix != NULL && A11.nt > 1) {
+        W11 = uplo == PlasmaLower
+            ? plasma_desc_view(W, 0, 0, n1-n11, n11)
+            : plasma_desc_view(W, 0, 0, n11, n1-n11);
+    }
+    if (W.matrix != NULL && A22.nt > 1) {
+        W22 = uplo == PlasmaLower
+            ? plasma_desc_view(W, n21, n1-n21, n2-n21, n21)
+            : plasma_desc_view(W, n1-n21, n21, n21, n2-n21);
+    }
+
+    plasma_pctrtri_rec(uplo, diag, A11, W11, offset,    sequence, request);
+    plasma_pctrtri_rec(uplo, diag, A22, W22, offset+n1, sequence, request);
+
+    if (uplo == PlasmaLower) {
+        // A21 = -A22^{-1} * A21 * A11^{-1}
+        plasma_desc_t A21 = plasma_desc_view(A, n1, 0, n2, n1);
+        if (W.matrix != NULL) {
+            plasma_pctrmm3(PlasmaRight, uplo, PlasmaNoTrans, diag,
+                           1.0, A11, A21, W,
+                           sequence, request);
+            plasma_pctrmm3(PlasmaLeft, uplo, PlasmaNoTrans, diag,
+                           -1.0, A22, W, A21,
+                           sequence, request);
+            return;
+        }
+        plasma_pctrmm(PlasmaRight, uplo, PlasmaNoTrans, diag,
+                      1.0, A11, A21,
+                      sequence, request);
+        plasma_pctrmm(PlasmaLeft, uplo, PlasmaNoTrans, diag,
+                      -1.0, A22, A21,
+                      sequence, request);
+    }
+    else {
+        // A12 = -A11^{-1} * A12 * A22^{-1}
+        plasma_desc_t A12 = plasma_desc_view(A, 0, n1, n1, n2);
+        if (W.matrix != NULL) {
+            plasma_pctrmm3(PlasmaLeft, uplo, PlasmaNoTrans, diag,
+                           -1.0, A11, A12, W,
+                           sequence, request);
+            plasma_pctrmm3(PlasmaRight, uplo, PlasmaNoTrans, diag,
+                           1.0, A22, W, A12,
+                           sequence, request);
+            return;
+        }
+        plasma_pctrmm(PlasmaLeft, uplo, PlasmaNoTrans, diag,
+                      -1.0, A11, A12,
+                      sequence, request);
+        plasma_pctrmm(PlasmaRight, uplo, PlasmaNoTrans, diag,
+                      1.0, A22, A12,
+                      sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ * Parallel tile triangular inversion, recursive on halves of the matrix.
+ * The diagonal halves are inverted concurrently, so that the critical path
+ * is not a sweep over all the diagonal tiles.
+ * @see plasma_omp_ctrtri
+ ******************************************************************************/
+void plasma_pctrtri(plasma_enum_t uplo, plasma_enum_t diag,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_desc_t W = A;
+    W.matrix = NULL;
+    plasma_pctrtri_rec(uplo, diag, A, W, 0, sequence, request);
+}
+
+/***************************************************************************//**
+ * Parallel tile triangular inversion with a workspace W for out-of-place
+ * triangular products, of the dimensions of the off-diagonal block of the
+ * first split of A into halves, at row and column (A.nt/2)*A.nb, and of
+ * the tile size of A.
+ * @see plasma_ctrtri
+ ******************************************************************************/
+void plasma_pctrtri_work(plasma_enum_t uplo, plasma_enum_t diag,
+                         plasma_desc_t A, plasma_desc_t W,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_pctrtri_rec(uplo, diag, A, W, 0, sequence, request);
+}
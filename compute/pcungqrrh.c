@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzungqrrh.c, normal z -> c, Mon Feb  6 14:06:24 2017
+ * @generated from compute/pzungqrrh.c, normal z -> c, Wed Oct 14 17:34:54 2026
  *
  **/
 
@@ -36,9 +36,11 @@ void plasma_pcungqrrh(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
         return;
 
     // Precompute order of QR operations.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
-    plasma_rh_tree_operations(A.mt, A.nt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.mt, A.nt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -115,5 +117,5 @@ void plasma_pcungqrrh(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzunmlq.c, normal z -> c, Mon Feb  6 14:06:25 2017
+ * @generated from compute/pzunmlq.c, normal z -> c, Thu Oct 15 10:57:57 2026
  *
  **/
 
@@ -18,12 +18,191 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <stdlib.h>
+
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 #define T(m, n) (plasma_complex32_t*)plasma_tile_addr(T, m, n)
 #define B(m, n) (plasma_complex32_t*)plasma_tile_addr(B, m, n)
 
+/******************************************************************************/
+// Applies the reflectors of the diagonal tile of the tile row k of A
+// to the tile row (left) or column (right) k of B.
+static void plasma_pcunmlq_diag(plasma_enum_t side, plasma_enum_t trans,
+                                plasma_desc_t A, plasma_desc_t T,
+                                plasma_desc_t B, int k,
+                                plasma_workspace_t work,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    if (side == PlasmaLeft) {
+        int mvbk = plasma_tile_mview(B, k);
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            core_omp_cunmlq(
+                    side, trans,
+                    mvbk, nvbn, imin(nvak, mvak), ib,
+                    A(k, k), ldak,
+                    T(k, k), T.mb,
+                    B(k, n), ldbk,
+                    work,
+                    sequence, request);
+        }
+    }
+    else {
+        int nvbk = plasma_tile_nview(B, k);
+        for (int m = 0; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            core_omp_cunmlq(
+                    side, trans,
+                    mvbm, nvbk, imin(nvak, mvak), ib,
+                    A(k, k), ldak,
+                    T(k, k), T.mb,
+                    B(m, k), ldbm,
+                    work,
+                    sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the TS reflectors of the tiles n0 to n0+count-1 of the tile row
+// k of A as one block, its T factor merged once into Tg, to each tile
+// column (left) or row (right) of B. As in core_ctsmlq, the block of the
+// reflectors stored by rows is applied with the transpose of trans.
+static void plasma_pcunmlq_block(plasma_enum_t side, plasma_enum_t trans,
+                                 plasma_desc_t A, plasma_desc_t T,
+                                 plasma_desc_t B, int k, int n0, int count,
+                                 plasma_complex32_t *Tg, int ldtg,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int l[PlasmaHouseholderMaxGroup], ldv[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *V[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *Tb[PlasmaHouseholderMaxGroup];
+    for (int i = 0; i < count; i++) {
+        int n = n0+i;
+        l[i] = side == PlasmaLeft ? plasma_tile_mview(B, n)
+                                  : plasma_tile_nview(B, n);
+        ldv[i] = ldak;
+        V[i] = A(k, n);
+        Tb[i] = T(k, n);
+    }
+    core_omp_clarft_group(PlasmaRowwise, count, mvak, T.mb,
+                          l, V, ldv,
+                          Tb, T.mb,
+                          Tg, ldtg,
+                          sequence, request);
+
+    plasma_enum_t transt =
+        trans == PlasmaNoTrans ? Plasma_ConjTrans : PlasmaNoTrans;
+    int lda2[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *A2[PlasmaHouseholderMaxGroup];
+    if (side == PlasmaLeft) {
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            for (int i = 0; i < count; i++) {
+                A2[i] = B(n0+i, n);
+                lda2[i] = plasma_tile_mmain(B, n0+i);
+            }
+            core_omp_cparfb_group(
+                    side, transt, PlasmaRowwise,
+                    count, B.mb, nvbn, l, mvak,
+                    B(k, n), ldbk,
+                    A2, lda2,
+                    V,  ldv,
+                    Tg, ldtg,
+                    sequence, request);
+        }
+    }
+    else {
+        for (int m = 0; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            for (int i = 0; i < count; i++) {
+                A2[i] = B(m, n0+i);
+                lda2[i] = ldbm;
+            }
+            core_omp_cparfb_group(
+                    side, transt, PlasmaRowwise,
+                    count, mvbm, B.nb, l, mvak,
+                    B(m, k), ldbm,
+                    A2, lda2,
+                    V,  ldv,
+                    Tg, ldtg,
+                    sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies Q or Q^H with the TS reflectors of each tile row of A merged in
+// blocks of group tiles, as plasma_pcunmqr_grouped() does for QR.
+// Returns 0, without submitting tasks, if the T factors cannot be
+// allocated.
+static int plasma_pcunmlq_grouped(plasma_enum_t side, plasma_enum_t trans,
+                                  plasma_desc_t A, plasma_desc_t T,
+                                  plasma_desc_t B, int group,
+                                  plasma_workspace_t work,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int tiles = side == PlasmaLeft ? B.mt : B.nt;
+    int blocks = (tiles-1+group-1)/group;
+    if (blocks <= 0)
+        return 0;
+
+    int ldtg = group*A.mb;
+    size_t size = (size_t)ldtg*ldtg;
+    plasma_complex32_t *Tg = (plasma_complex32_t*)malloc(
+        2*blocks*size*sizeof(plasma_complex32_t));
+    if (Tg == NULL)
+        return 0;
+
+    // Q from the left and Q^H from the right start from the first tile.
+    int forward = (side == PlasmaLeft) == (trans == PlasmaNoTrans);
+    int kt = imin(A.mt, A.nt);
+    for (int i = 0; i < kt; i++) {
+        int k = forward ? i : kt-1-i;
+        int nblocks = (tiles-1-k+group-1)/group;
+        plasma_complex32_t *Tk = &Tg[(k%2)*blocks*size];
+        if (forward) {
+            plasma_pcunmlq_diag(side, trans, A, T, B, k, work,
+                                sequence, request);
+        }
+        for (int j = 0; j < nblocks; j++) {
+            int b = forward ? j : nblocks-1-j;
+            int n0 = k+1+b*group;
+            plasma_pcunmlq_block(side, trans, A, T, B,
+                                 k, n0, imin(group, tiles-n0),
+                                 &Tk[b*size], ldtg,
+                                 sequence, request);
+        }
+        if (!forward) {
+            plasma_pcunmlq_diag(side, trans, A, T, B, k, work,
+                                sequence, request);
+        }
+    }
+
+    // Free the merged T factors after their last readers, even if
+    // the sequence cancelled them.
+    #pragma omp taskwait
+    free(Tg);
+    return 1;
+}
+
 /***************************************************************************//**
  *  Parallel application of Q using tile V - LQ factorization
+ *  With PlasmaHouseholderGroup above 1, the TS reflectors are applied in
+ *  blocks of tiles, see plasma_pcunmlq_grouped().
  * @see plasma_omp_cgelqs
  **/
 void plasma_pcunmlq(plasma_enum_t side, plasma_enum_t trans,
@@ -35,6 +214,14 @@ void plasma_pcunmlq(plasma_enum_t side, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Merge the TS reflectors of the tile rows into blocks.
+    plasma_context_t *plasma = plasma_context_self();
+    int group = plasma_householder_group(plasma);
+    if (group > 1 &&
+        plasma_pcunmlq_grouped(side, trans, A, T, B, group, work,
+                               sequence, request))
+        return;
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzdesc2ge.c, normal z -> d, Mon Feb  6 14:06:12 2017
+ * @generated from compute/pzdesc2ge.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -18,16 +18,234 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+/******************************************************************************/
+// Translates to the row-major array pA, transposing each tile while copying
+// it, one task per tile.
+static void plasma_pddesc2ge_rowmajor(plasma_desc_t A,
+                                      double *pA, int lda,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (A.rate > 0) {
+        plasma_error("packed tiles of a row-major array");
+        plasma_request_fail(sequence, request, PlasmaErrorNotSupported);
+        return;
+    }
+    for (int m = 0; m < A.mt; m++) {
+        int ldt = plasma_tile_mmain(A, m);
+        for (int n = 0; n < A.nt; n++) {
+            if (!plasma_tile_stored(A, m, n))
+                continue;
+
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int y1 = m == 0 ? A.i%A.mb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+            double *f77 =
+                &pA[(size_t)A.mb*lda*m + (size_t)A.nb*n];
+            double *bdl =
+                (double*)plasma_tile_addr(A, m, n);
+
+            plasma_tile_affinity(A, m, n);
+            core_omp_dlacpy_trans(PlasmaTrans,
+                                  x2-x1, y2-y1,
+                                  &(bdl[(size_t)x1*ldt+y1]), ldt,
+                                  &(f77[(size_t)y1*lda+x1]), lda,
+                                  sequence, request);
+        }
+    }
+}
+
 /******************************************************************************/
 void plasma_pddesc2ge(plasma_desc_t A,
                       double *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request)
 {
+    // The tiles are the LAPACK array, translated in place.
+    if (A.translation == PlasmaInplace) {
+        plasma_pdesc2ge_inplace(A, sequence, request);
+        return;
+    }
+
+    // The tiles are views of the LAPACK array, not translated.
+    if (A.translation == PlasmaNoTranslation)
+        return;
+
+    // The array is in row-major order.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma->array_layout == PlasmaRowMajor) {
+        plasma_pddesc2ge_rowmajor(A, pA, lda, sequence, request);
+        return;
+    }
+
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Unpack the tiles, one task per tile.
+    if (A.rate > 0) {
+        for (int m = 0; m < A.mt; m++) {
+            int ldt = plasma_tile_mmain(A, m);
+            for (int n = 0; n < A.nt; n++) {
+                int x1 = n == 0 ? A.j%A.nb : 0;
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                double *f77 =
+                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                unsigned char *bdl =
+                    (unsigned char*)plasma_tile_addr(A, m, n);
+
+                core_omp_dunpack(PlasmaGeneral,
+                                 y2-y1, x2-x1,
+                                 &(bdl[((size_t)x1*ldt+y1)*A.eltsize]), ldt,
+                                 A.rate,
+                                 &(f77[x1*lda+y1]), lda,
+                                 sequence, request);
+            }
+        }
+        return;
+    }
+
+    // Stream the matrices larger than the caches, one task per run of up to
+    // PlasmaStreamTiles stored tiles of a tile column, which copies the
+    // columns of the run one after the other, so that the LAPACK array is
+    // accessed sequentially, storing the LAPACK array past the caches.
+    if (plasma_desc_streamed(A)) {
+        double *ftiles[PlasmaStreamTiles];
+        double *btiles[PlasmaStreamTiles];
+        for (int n = 0; n < A.nt; n++) {
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int m0 = 0;
+            while (m0 < A.mt) {
+                // the run of stored tiles m0 to m0+count-1
+                int count = 0;
+                int rows = 0;
+                while (m0+count < A.mt && count < PlasmaStreamTiles &&
+                       plasma_tile_stored(A, m0+count, n)) {
+                    int m = m0+count;
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+                    ftiles[count] = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m +
+                                        (size_t)x1*lda+y1];
+                    btiles[count] =
+                        (double*)plasma_tile_addr(A, m, n);
+                    rows += y2-y1;
+                    count++;
+                }
+                if (count == 0) {
+                    m0++;
+                    continue;
+                }
+
+                #pragma omp task depend(iterator(int t = 0:count), \
+                                        in:btiles[t][0]) \
+                                 depend(iterator(int t = 0:count), \
+                                        out:ftiles[t][0]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("dlacpy_stream", ftiles[0]);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        for (int x = x1; x < x2; x++) {
+                            for (int m = m0; m < m0+count; m++) {
+                                int ldt = plasma_tile_mmain(A, m);
+                                int y1 = m == 0 ? A.i%A.mb : 0;
+                                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1
+                                                     : A.mb;
+                                double *f77 =
+                                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                                double *bdl = (double*)
+                                    plasma_tile_addr(A, m, n);
+                                core_dlacpy_stream(y2-y1, 1,
+                                                   &bdl[(size_t)x*ldt+y1], ldt,
+                                                   &f77[(size_t)x*lda+y1], lda);
+                            }
+                        }
+                        core_stream_fence();
+                    }
+                    PLASMA_TRACE_FLOPS(PlasmaRealDouble, 0.0,
+                                       2.0*rows*(x2-x1));
+                    PLASMA_TRACE_STOP("dlacpy_stream", 1, ftiles[0], btiles[0]);
+                }
+                m0 += count;
+            }
+        }
+        return;
+    }
+
+    // Submit one task per tile column, translating its tiles
+    // in a taskloop, unless the stored tiles of a column have gaps.
+    if (plasma_column_sweep(plasma, A.mt) && A.layout != PlasmaSparseLayout) {
+        double **tiles = (double**)
+            malloc((size_t)2*A.mt*sizeof(double*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        double **ftiles = tiles;
+        double **btiles = tiles+A.mt;
+        for (int n = 0; n < A.nt; n++) {
+            // the stored tiles of the column, m0 to m0+count-1
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int m0 = 0;
+            while (m0 < A.mt && !plasma_tile_stored(A, m0, n))
+                m0++;
+            int count = 0;
+            for (int m = m0; m < A.mt && plasma_tile_stored(A, m, n); m++) {
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                ftiles[count] = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m +
+                                    (size_t)x1*lda+y1];
+                btiles[count] =
+                    (double*)plasma_tile_addr(A, m, n);
+                count++;
+            }
+            if (count == 0)
+                continue;
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:btiles[t][0]) \
+                             depend(iterator(int t = 0:count), \
+                                    out:ftiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int t = 0; t < count; t++) {
+                    int m = m0+t;
+                    int ldt = plasma_tile_mmain(A, m);
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                    double *f77 =
+                        &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                    double *bdl = (double*)
+                        plasma_tile_addr(A, m, n);
+
+                    PLASMA_TRACE_START("dlacpy", &(f77[x1*lda+y1]));
+                    if (PLASMA_TRACE_RUN(sequence))
+                        core_dlacpy(PlasmaGeneral,
+                                    y2-y1, x2-x1,
+                                    &(bdl[x1*ldt+y1]), ldt,
+                                    &(f77[x1*lda+y1]), lda);
+                    PLASMA_TRACE_FLOPS(PlasmaRealDouble, 0.0,
+                                       2.0*(y2-y1)*(x2-x1));
+                    PLASMA_TRACE_STOP("dlacpy", 1, &(f77[x1*lda+y1]), bdl);
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
     double *f77;
     double *bdl;
 
@@ -38,6 +256,9 @@ void plasma_pddesc2ge(plasma_desc_t A,
     for (m = 0; m < A.mt; m++) {
         ldt = plasma_tile_mmain(A, m);
         for (n = 0; n < A.nt; n++) {
+            if (!plasma_tile_stored(A, m, n))
+                continue;
+
             x1 = n == 0 ? A.j%A.nb : 0;
             y1 = m == 0 ? A.i%A.mb : 0;
             x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
@@ -48,9 +269,100 @@ void plasma_pddesc2ge(plasma_desc_t A,
 
             core_omp_dlacpy(PlasmaGeneral,
                             y2-y1, x2-x1,
-                            &(bdl[x1*A.nb+y1]), ldt,
+                            &(bdl[x1*ldt+y1]), ldt,
                             &(f77[x1*lda+y1]), lda,
                             sequence, request);
         }
     }
 }
+
+/***************************************************************************//**
+ *  Translates the result of plasma_pdgetrf back to LAPACK layout
+ *  submitting one task per tile column.
+ *  Each task depends on the last task of plasma_pdgetrf writing its column:
+ *  the left pivoting of the column, or, for the trailing columns and
+ *  without left pivoting, the last panel or update touching the column.
+ *  Therefore, the translation can be submitted in the same parallel region
+ *  as the factorization and columns stream out as they are finished.
+ * @see plasma_pddesc2ge
+ ******************************************************************************/
+void plasma_pddesc2ge_getrf(plasma_desc_t A,
+                            double *pA, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    // The tiles are the LAPACK array, translated in place.
+    if (A.translation == PlasmaInplace) {
+        plasma_pdesc2ge_inplace(A, sequence, request);
+        return;
+    }
+
+    // The tiles are views of the LAPACK array, not translated.
+    if (A.translation == PlasmaNoTranslation)
+        return;
+
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    int left = plasma->left_pivoting == PlasmaLeftPivotingOn;
+    int rowmajor = plasma->array_layout == PlasmaRowMajor;
+
+    int kt = imin(A.mt, A.nt);
+    for (int n = 0; n < A.nt; n++) {
+        double *a0, *a1;
+        int lda0, lda1;
+        if (left && n < kt-1) {
+            // left pivoting of column n is tracked on tile (n+1, n+1)
+            a0 = (double*)plasma_tile_addr(A, n+1, n+1);
+            a1 = a0;
+            lda0 = plasma_tile_mmain(A, n+1);
+            lda1 = lda0;
+        }
+        else {
+            // last panel or update of column n
+            int k = imin(n, kt-1);
+            a0 = (double*)plasma_tile_addr(A, k, n);
+            a1 = (double*)plasma_tile_addr(A, A.mt-1, n);
+            lda0 = plasma_tile_mmain(A, k);
+            lda1 = plasma_tile_mmain(A, A.mt-1);
+        }
+        int nvan = plasma_tile_nview(A, n);
+
+        #pragma omp task depend(in:a0[0:lda0*nvan]) \
+                         depend(in:a1[0:lda1*nvan]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            if (sequence->status == PlasmaSuccess) {
+                for (int m = 0; m < A.mt; m++) {
+                    int ldt = plasma_tile_mmain(A, m);
+                    int x1 = n == 0 ? A.j%A.nb : 0;
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                    double *bdl = (double*)
+                        plasma_tile_addr(A, m, n);
+
+                    if (rowmajor) {
+                        double *f77 =
+                            &pA[(size_t)A.mb*lda*m + (size_t)A.nb*n];
+                        core_dlacpy_trans(PlasmaTrans,
+                                          x2-x1, y2-y1,
+                                          &(bdl[(size_t)x1*ldt+y1]), ldt,
+                                          &(f77[(size_t)y1*lda+x1]), lda);
+                    }
+                    else {
+                        double *f77 =
+                            &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                        core_dlacpy(PlasmaGeneral,
+                                    y2-y1, x2-x1,
+                                    &(bdl[x1*ldt+y1]), ldt,
+                                    &(f77[x1*lda+y1]), lda);
+                    }
+                }
+            }
+        }
+    }
+}
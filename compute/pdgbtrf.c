@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgbtrf.c, normal z -> d, Mon Feb  6 14:06:13 2017
+ * @generated from compute/pzgbtrf.c, normal z -> d, Thu Oct 15 10:22:44 2026
  *
  **/
 
@@ -32,60 +32,90 @@ void plasma_pdgbtrf(plasma_desc_t A, int *ipiv,
     plasma_context_t *plasma = plasma_context_self();
     int ib = plasma->ib;
     int num_panel_threads = plasma->num_panel_threads;
-    plasma_barrier_t *barrier = &plasma->barrier;
+    plasma_enum_t panel_mode = plasma->panel_mode;
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+    plasma_panel_workspace_t *panel_work = &plasma->panel_work;
+
+    // Task priorities: the panel first, then the updates of the next
+    // lookahead columns, then the rest of the trailing matrix, all above
+    // the tasks of the normal sequences if the sequence is urgent.
+    int lookahead = plasma->lookahead;
+    int priority = plasma_sequence_priority(sequence);
+    int panel_priority = priority + (lookahead > 0 ? 2 : 0);
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         // for band matrix, gm is a multiple of mb,
         // and there is no a10 submatrix
 
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain_band(A, k, k);
+        int nak  = plasma_tile_nmain(A, k);
+
+        // Step k touches the tile rows k to k+klk of the columns k to
+        // k+kut-1, including the fills of the pivoting above the band of U.
+        // The tiles of a column in the band are contiguous. The diagonal row
+        // and the rows below are tracked apart, to chain the updates of
+        // a column with the next step and its panel.
+        int klk = imin(k+A.klt, A.mt) - (k+1);
 
         // panel
         int *ipivk = &ipiv[k*A.mb];
         double *a00 = A(k, k);
+        double *a20 = klk > 0 ? A(k+1, k) : a00;
         int mak      = imin(A.m-k*A.mb, mvak+A.kl);
-        int size_a00 = (A.gm-k*A.mb) * plasma_tile_nmain(A, k);
+        int size_a00 = ldak*nak;
+        int size_a20 = klk > 0 ? klk*A.mb*nak : size_a00;
         int size_i   = imin(mvak, nvak);
         #pragma omp task depend(inout:a00[0:size_a00]) \
-                         depend(out:ipivk[0:size_i]) /*\
-                         priority(1) */
+                         depend(inout:a20[0:size_a20]) \
+                         depend(out:ipivk[0:size_i]) \
+                         priority(panel_priority)
         {
+            // The rows below only order the panel in the dependencies.
+            (void)a20;
             if (sequence->status == PlasmaSuccess) {
-                for (int rank = 0; rank < num_panel_threads; rank++) {
-                    #pragma omp task // priority(1)
-                    {
-                        // create a view for panel as a "general" submatrix
-                        plasma_desc_t view = plasma_desc_view(
-                            A, (A.kut-1)*A.mb, k*A.nb, mak, nvak);
-                        view.type = PlasmaGeneral;
-
-                        int info = core_dgetrf(view, &ipiv[k*A.mb], ib, rank,
-                                               num_panel_threads, barrier);
-                        if (info != 0)
-                            plasma_request_fail(sequence, request, k*A.mb+info);
-                    }
-                }
+                // create a view for panel as a "general" submatrix
+                plasma_desc_t view = plasma_desc_view(
+                    A, (A.kut-1)*A.mb, k*A.nb, mak, nvak);
+                view.type = PlasmaGeneral;
+
+                int info = plasma_pdgetrf_panel(view, ipivk, ib,
+                                                panel_mode,
+                                                panel_team, panel_bind,
+                                                num_panel_threads,
+                                                panel_priority, panel_work);
+                if (info != 0)
+                    plasma_request_fail(sequence, request, k*A.mb+info);
             }
-            #pragma omp taskwait
         }
         // update
-        // TODO: fills are not tracked, see the one in fork
+        // The columns only share the panel and the pivots, read by all,
+        // so they are updated concurrently.
         for (int n = k+1; n < imin(A.nt, k+A.kut); n++) {
-            double *a01 = A(k, n);
-            double *a11 = A(k+1, n);
-
             int nvan = plasma_tile_nview(A, n);
-            int size_a01 = ldak*nvan;
-            int size_a11 = (A.gm-(k+1)*A.mb)*nvan;
+            int nan  = plasma_tile_nmain(A, n);
+            int ldakn = plasma_tile_mmain_band(A, k, n);
+
+            double *a01 = A(k, n);
+            double *a11 = klk > 0 ? A(k+1, n) : a01;
+            int size_a01 = ldakn*nan;
+            int size_a11 = klk > 0 ? klk*A.mb*nan : size_a01;
 
             #pragma omp task depend(in:a00[0:size_a00]) \
-                             depend(inout:ipivk[0:size_i]) \
+                             depend(in:a20[0:size_a20]) \
+                             depend(in:ipivk[0:size_i]) \
                              depend(inout:a01[0:size_a01]) \
-                             depend(inout:a11[0:size_a11]) /*\
-                             priority(n == k+1) */
+                             depend(inout:a11[0:size_a11]) \
+                             priority(priority + (n-k <= lookahead))
             {
+                // The rows below only order the updates in the dependencies.
+                (void)a11;
                 if (sequence->status == PlasmaSuccess) {
                     // laswp
                     int k1 = k*A.mb+1;
@@ -96,26 +126,26 @@ void plasma_pdgbtrf(plasma_desc_t A, int *ipiv,
                                          mak, nvan);
                     view.type = PlasmaGeneral;
                     core_dlaswp(
-                        PlasmaRowwise, view, 1, k2-k1+1, &ipiv[k*A.mb], 1);
+                        PlasmaRowwise, view, 1, k2-k1+1, ipivk, 1);
 
                     // trsm
                     core_dtrsm(PlasmaLeft, PlasmaLower,
                                PlasmaNoTrans, PlasmaUnit,
                                mvak, nvan,
                                1.0, A(k, k), ldak,
-                                    A(k, n), plasma_tile_mmain_band(A, k, n));
+                                    A(k, n), ldakn);
 
-                    // gemm
-                    for (int m = imax(k+1,n-A.kut); m < imin(k+A.klt, A.mt); m++) {
+                    // gemm, one task per tile of the band
+                    for (int m = k+1; m <= k+klk; m++) {
                         int mvam = plasma_tile_mview(A, m);
 
-                        #pragma omp task // priority(n == k+1)
+                        #pragma omp task priority(priority + (n-k <= lookahead))
                         {
                             core_dgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 mvam, nvan, A.nb,
                                 -1.0, A(m, k), plasma_tile_mmain_band(A, m, k),
-                                      A(k, n), plasma_tile_mmain_band(A, k, n),
+                                      A(k, n), ldakn,
                                 1.0,  A(m, n), plasma_tile_mmain_band(A, m, n));
                         }
                     }
@@ -123,7 +153,9 @@ void plasma_pdgbtrf(plasma_desc_t A, int *ipiv,
                 }
             }
         }
-        #pragma omp task depend(in:ipivk[0:size_i])
+        // The pivots are made global after the updates of the step read them.
+        #pragma omp task depend(inout:ipivk[0:size_i]) \
+                         priority(plasma_sequence_priority(sequence))
         if (sequence->status == PlasmaSuccess) {
             if (k > 0) {
                 for (int i = 0; i < imin(mak, nvak); i++) {
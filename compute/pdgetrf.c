@@ -6,163 +6,1160 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgetrf.c, normal z -> d, Sat Feb  4 20:58:25 2017
+ * @generated from compute/pzgetrf.c, normal z -> d, Thu Oct 15 11:01:27 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_barrier.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_device.h"
 #include "plasma_internal.h"
+#include "plasma_mpi.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "core_blas.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#define REAL
 
 #define A(m, n) (double*)plasma_tile_addr(A, m, n)
 
 /******************************************************************************/
-void plasma_pdgetrf(plasma_desc_t A, int *ipiv,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+// Arguments of the ranks of a multithreaded panel.
+typedef struct {
+    plasma_desc_t A;
+    int *ipiv;
+    int ib;
+    plasma_enum_t panel_mode;
+    plasma_panel_workspace_t *work;
+    int info;
+} plasma_pdgetrf_panel_t;
+
+/******************************************************************************/
+// Runs a rank of the team of a multithreaded panel.
+static void plasma_pdgetrf_panel_rank(void *args, int rank, int size,
+                                      plasma_barrier_t *barrier)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
+    plasma_pdgetrf_panel_t *panel = (plasma_pdgetrf_panel_t*)args;
+
+    int info;
+    if (panel->panel_mode == PlasmaRecursivePanel)
+        info = core_dgetrf_rec(panel->A, panel->ipiv, panel->ib,
+                               rank, size, panel->work, barrier);
+    else
+        info = core_dgetrf(panel->A, panel->ipiv, panel->ib,
+                           rank, size, panel->work, barrier);
+
+    // Only rank 0 returns errors.
+    if (rank == 0)
+        panel->info = info;
+}
+
+/***************************************************************************//**
+ *  Factors the panel A with partial pivoting, iterative or recursive
+ *  (panel_mode), on a team of up to num_threads threads, see
+ *  plasma_team_run(). The pivots are relative to the first row of A.
+ *  Returns the info of core_dgetrf().
+ **/
+int plasma_pdgetrf_panel(plasma_desc_t A, int *ipiv, int ib,
+                         plasma_enum_t panel_mode,
+                         plasma_enum_t team, plasma_enum_t bind,
+                         int num_threads, int priority,
+                         plasma_panel_workspace_t *work)
+{
+    // The workspace is shared with the panels of the other sequences of
+    // the context running at the same time, if any.
+    plasma_panel_workspace_t *lent = plasma_panel_workspace_acquire(work);
+    plasma_pdgetrf_panel_t panel = { A, ipiv, ib, panel_mode, lent, 0 };
+    plasma_team_run(team, bind, num_threads, priority,
+                    plasma_pdgetrf_panel_rank, &panel);
+    plasma_panel_workspace_release(work, lent);
+    return panel.info;
+}
+
+/***************************************************************************//**
+ *  Factors panel k with tournament pivoting (CALU).
+ *  Each tile of the panel proposes its pivot candidates, the candidates are
+ *  reduced along a tree from plasma_rh_tree_operations, and the panel is then
+ *  factored without pivoting once the winning rows are moved to the top.
+ *  Runs inside the panel task and returns once the panel is factored.
+ **/
+static void plasma_pdgetrf_tntpiv(plasma_context_t *plasma,
+                                  plasma_desc_t A, int k, int *ipiv,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int mt = A.mt-k;
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+
+    // Allocate the candidates of each tile and workspaces for each thread.
+    int nthread = omp_get_num_threads();
+    size_t lcand = (size_t)A.nb*A.nb;
+    size_t lwork = (size_t)imax(A.mb, 4*A.nb)*A.nb;
+    size_t liwork = (size_t)imax(A.mb+A.nb, 5*A.nb);
+    double *C = (double*)malloc(
+        (mt*lcand + nthread*lwork)*sizeof(double));
+    int *rows = (int*)malloc((mt*A.nb + mt + nthread*liwork)*sizeof(int));
+    if (C == NULL || rows == NULL) {
+        free(C);
+        free(rows);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
         return;
+    }
+    double *W = &C[mt*lcand];
+    int *count = &rows[mt*A.nb];
+    int *iwork = &count[mt];
+
+    // Precompute the reduction tree of the panel.
+    int *operations = NULL;
+    int num_operations;
+    plasma_rh_tree_operations(plasma, mt, 1, &operations, &num_operations);
+
+    //========================
+    // tournament of the rows
+    //========================
+    for (int iop = 0; iop < num_operations; iop++) {
+        plasma_enum_t kernel;
+        int j, m, mpiv;
+        plasma_rh_tree_get_operation(operations, iop, &kernel, &j, &m, &mpiv);
+
+        double *cm = &C[m*lcand];
+        double *cp = mpiv >= 0 ? &C[mpiv*lcand] : NULL;
+        int mvam = plasma_tile_mview(A, k+m);
+        int ldam = plasma_tile_mmain(A, k+m);
 
-    // Read parameters from the context.
+        if (kernel == PlasmaGeKernel) {
+            #pragma omp task depend(out:cm[0:lcand]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dgetrf_tntpiv_leaf", cm);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int tid = omp_get_thread_num();
+                    count[m] = core_dgetrf_tntpiv_leaf(
+                        mvam, nvak, A(k+m, k), ldam, m*A.mb,
+                        cm, A.nb, &rows[m*A.nb],
+                        &W[tid*lwork], &iwork[tid*liwork]);
+                }
+                PLASMA_TRACE_STOP("dgetrf_tntpiv_leaf", 1, cm);
+            }
+        }
+        else if (kernel == PlasmaTsKernel) {
+            #pragma omp task depend(out:cm[0:lcand]) \
+                             depend(inout:cp[0:lcand]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dgetrf_tntpiv_leaf", cm);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int tid = omp_get_thread_num();
+                    count[m] = core_dgetrf_tntpiv_leaf(
+                        mvam, nvak, A(k+m, k), ldam, m*A.mb,
+                        cm, A.nb, &rows[m*A.nb],
+                        &W[tid*lwork], &iwork[tid*liwork]);
+                    count[mpiv] = core_dgetrf_tntpiv_merge(
+                        nvak, cp, &rows[mpiv*A.nb], count[mpiv],
+                        cm, &rows[m*A.nb], count[m], A.nb,
+                        &W[tid*lwork], &iwork[tid*liwork]);
+                }
+                PLASMA_TRACE_STOP("dgetrf_tntpiv_leaf", 2, cm, cp);
+            }
+        }
+        else {
+            #pragma omp task depend(in:cm[0:lcand]) \
+                             depend(inout:cp[0:lcand]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dgetrf_tntpiv_merge", cp);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int tid = omp_get_thread_num();
+                    count[mpiv] = core_dgetrf_tntpiv_merge(
+                        nvak, cp, &rows[mpiv*A.nb], count[mpiv],
+                        cm, &rows[m*A.nb], count[m], A.nb,
+                        &W[tid*lwork], &iwork[tid*liwork]);
+                }
+                PLASMA_TRACE_STOP("dgetrf_tntpiv_merge", 1, cp, cm);
+            }
+        }
+    }
+    #pragma omp taskwait
+    plasma_rh_tree_release(plasma, operations);
+
+    if (sequence->status == PlasmaSuccess) {
+        //======================================
+        // winning rows to the top of the panel
+        //======================================
+        int *ipivk = &ipiv[k*A.mb];
+        for (int i = 0; i < count[0]; i++) {
+            // Track the row through the swaps already done.
+            int ip = rows[i];
+            for (int l = 0; l < i; l++) {
+                if (ip == l)
+                    ip = ipivk[l]-1;
+                else if (ip == ipivk[l]-1)
+                    ip = l;
+            }
+            ipivk[i] = ip+1;
+
+            if (ip != i) {
+                int ldai = plasma_tile_mmain(A, k+i/A.mb);
+                int ldap = plasma_tile_mmain(A, k+ip/A.mb);
+                cblas_dswap(nvak,
+                            &(A(k+i/A.mb, k))[i%A.mb], ldai,
+                            &(A(k+ip/A.mb, k))[ip%A.mb], ldap);
+            }
+        }
+
+        //================================
+        // factorization without pivoting
+        //================================
+        int info = core_dgetrf_nopiv(mvak, nvak, A(k, k), ldak);
+        if (info != 0) {
+            plasma_request_fail(sequence, request, k*A.mb+info);
+        }
+        else {
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+
+                #pragma omp task priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("dtrsm", A(m, k));
+                    core_dtrsm(PlasmaRight, PlasmaUpper,
+                               PlasmaNoTrans, PlasmaNonUnit,
+                               mvam, nvak,
+                               1.0, A(k, k), ldak,
+                                    A(m, k), ldam);
+                    PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                       (double)mvam*nvak*nvak,
+                                       0.5*nvak*nvak + 2.0*mvam*nvak);
+                    PLASMA_TRACE_STOP("dtrsm", 1, A(m, k), A(k, k));
+                }
+            }
+            #pragma omp taskwait
+        }
+    }
+    free(C);
+    free(rows);
+}
+
+/***************************************************************************//**
+ *  Updates the trailing matrix after panel k with one task per tile.
+ *  The laswp and trsm of each column and each gemm are separate top-level
+ *  tasks, so the updates of the next step start as soon as their tiles are
+ *  ready. Row k of each column marks the gemms of step k: they all read it,
+ *  and the laswp of step k+1 and the next panel wait for them through it.
+ **/
+static void plasma_pdgetrf_tile_update(plasma_desc_t A, int k, int *ipiv,
+                                       int lookahead,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
     plasma_context_t *plasma = plasma_context_self();
+    int priority = plasma_sequence_priority(sequence);
+
+    double *a00, *a20;
+    a00 = A(k, k);
+    a20 = A(A.mt-1, k);
+
+    size_t ma00k = (size_t)(A.mt-k-1)*A.mb;
+    int na00k = plasma_tile_nmain(A, k);
+    int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+
+    for (int n = k+1; n < A.nt; n++) {
+        double *a10, *a01, *a11, *a21;
+        a10 = k > 0 ? A(k-1, n) : A(k, n);
+        a01 = A(k, n);
+        a11 = A(k+1, n);
+        a21 = A(A.mt-1, n);
+
+        size_t ma11k = (size_t)(A.mt-k-2)*A.mb;
+        int na11n = plasma_tile_nmain(A, n);
+        int lda10 = plasma_tile_mmain(A, imax(k-1, 0));
+        int lda21 = plasma_tile_mmain(A, A.mt-1);
+
+        int nvan = plasma_tile_nview(A, n);
+
+        // laswp
+        #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                         depend(in:a20[0:lda20*nvak]) \
+                         depend(in:ipiv[k*A.mb:mvak]) \
+                         depend(inout:a10[0:lda10*nvan]) \
+                         depend(inout:a01[0:ldak*nvan]) \
+                         depend(inout:a11[0:ma11k*na11n]) \
+                         depend(inout:a21[0:lda21*nvan]) \
+                         priority(priority + (n-k <= lookahead))
+        {
+            PLASMA_TRACE_START("dlaswp", a10);
+            if (PLASMA_TRACE_RUN(sequence)) {
+                int k1 = k*A.mb+1;
+                int k2 = imin(k*A.mb+A.mb, A.m);
+                plasma_desc_t view =
+                    plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            }
+            PLASMA_TRACE_STOP("dlaswp", 4, a10, a01, a11, a21, a00, a20, &ipiv[k*A.mb]);
+        }
+
+        // trsm
+        #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                         depend(inout:a01[0:ldak*nvan]) \
+                         priority(priority + (n-k <= lookahead))
+        {
+            PLASMA_TRACE_START("dtrsm", a01);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_dtrsm(PlasmaLeft, PlasmaLower,
+                           PlasmaNoTrans, PlasmaUnit,
+                           mvak, nvan,
+                           1.0, A(k, k), ldak,
+                                A(k, n), ldak);
+            PLASMA_TRACE_FLOPS(PlasmaRealDouble, (double)mvak*mvak*nvan,
+                               0.5*mvak*mvak + 2.0*mvak*nvan);
+            PLASMA_TRACE_STOP("dtrsm", 1, a01, a00);
+        }
+
+        // gemm
+        for (int m = k+1; m < A.mt; m++) {
+            double *amn = A(m, n);
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+
+            plasma_tile_affinity(A, m, n);
+            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                             depend(in:a20[0:lda20*nvak]) \
+                             depend(in:a01[0:ldak*nvan]) \
+                             depend(inout:amn[0:ldam*nvan]) \
+                             priority(priority + (n-k <= lookahead))
+            {
+                PLASMA_TRACE_START("dgemm", amn);
+                if (PLASMA_TRACE_RUN(sequence))
+                    PLASMA_OFFLOAD(plasma, core_dgemm)(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvam, nvan, A.nb,
+                        -1.0, A(m, k), ldam,
+                              A(k, n), ldak,
+                        1.0,  A(m, n), ldam);
+                PLASMA_TRACE_FLOPS(PlasmaRealDouble, 2.0*mvam*nvan*A.nb,
+                                   (double)mvam*A.nb + (double)A.nb*nvan +
+                                   2.0*mvam*nvan);
+                PLASMA_TRACE_STOP("dgemm", 1, amn, a00, a20, a01);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Sends the tiles of column n of A marked in rows to the process dest,
+ *  from their owners, or back to their owners, from the process src.
+ **/
+static void plasma_pdgetrf_mpi_rows(plasma_desc_t A, int n, const char *rows,
+                                    int src, int dest, char *ranks,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    for (int m = 0; m < A.mt; m++) {
+        if (!rows[m])
+            continue;
+
+        if (src < 0) {
+            ranks[dest] = 1;
+            plasma_omp_tile_bcast(A, m, n, plasma_tile_rank(A, m, n), ranks,
+                                  sequence, request);
+        }
+        else {
+            ranks[plasma_tile_rank(A, m, n)] = 1;
+            plasma_omp_tile_bcast(A, m, n, src, ranks, sequence, request);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization of a matrix distributed over MPI
+ *  processes. The panel is gathered on the process of its diagonal tile
+ *  and factored there, and its pivots are broadcast. The rows of each
+ *  column interchanged by the pivots are gathered on the process of its
+ *  tile in the row of the panel, which applies the pivots and the trsm,
+ *  and sent back. The gemms run on the processes of their tiles. The steps
+ *  are separated by taskwaits, as the pivots decide the tiles to send.
+ **/
+static void plasma_pdgetrf_mpi(plasma_context_t *plasma,
+                               plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    char *ranks = (char*)calloc(A.p*A.q, 1);
+    char *rows = (char*)calloc(A.mt, 1);
+    if (ranks == NULL || rows == NULL) {
+        free(ranks);
+        free(rows);
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int root = plasma_tile_rank(A, k, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int npiv = imin(A.m-k*A.mb, nvak);
+
+        // panel
+        memset(rows, 0, A.mt);
+        for (int m = k; m < A.mt; m++)
+            rows[m] = 1;
+        plasma_pdgetrf_mpi_rows(A, k, rows, -1, root, ranks,
+                                sequence, request);
+        #pragma omp taskwait
+
+        int info = 0;
+        if (A.rank == root) {
+            plasma_desc_t view =
+                plasma_desc_view(A, k*A.mb, k*A.nb, A.m-k*A.mb, nvak);
+            int iinfo = plasma_pdgetrf_panel(view, &ipiv[k*A.mb], plasma->ib,
+                                             PlasmaIterativePanel,
+                                             plasma->panel_team,
+                                             plasma->panel_bind,
+                                             plasma->num_panel_threads, 0,
+                                             &plasma->panel_work);
+            if (iinfo != 0)
+                info = k*A.mb+iinfo;
+            for (int i = k*A.mb; i < k*A.mb+npiv; i++)
+                ipiv[i] += k*A.mb;
+        }
+        plasma_mpi_bcast(A, &ipiv[k*A.mb], npiv, PlasmaInteger, root);
+        plasma_mpi_bcast(A, &info, 1, PlasmaInteger, root);
+        if (info != 0) {
+            plasma_request_fail(sequence, request, info);
+            break;
+        }
+
+        // Send the panel to its processes and to the rows it updates.
+        for (int m = k; m < A.mt; m++) {
+            plasma_tile_owners(A, m, m, k, A.nt-1, ranks);
+            plasma_omp_tile_bcast(A, m, k, root, ranks, sequence, request);
+        }
+
+        // rows interchanged by the pivots
+        memset(rows, 0, A.mt);
+        rows[k] = 1;
+        for (int i = k*A.mb; i < k*A.mb+npiv; i++)
+            rows[(ipiv[i]-1)/A.mb] = 1;
+
+        // laswp and trsm
+        for (int n = k+1; n < A.nt; n++)
+            plasma_pdgetrf_mpi_rows(A, n, rows, -1, plasma_tile_rank(A, k, n),
+                                    ranks, sequence, request);
+        #pragma omp taskwait
+
+        for (int n = k+1; n < A.nt; n++) {
+            if (!plasma_tile_local(A, k, n))
+                continue;
+
+            double *akn = A(k, n);
+            int nvan = plasma_tile_nview(A, n);
+            #pragma omp task depend(inout:akn[0:ldak*nvan]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dgetrf_update", akn);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int k1 = k*A.mb+1;
+                    int k2 = k*A.mb+npiv;
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+                    core_dtrsm(PlasmaLeft, PlasmaLower,
+                               PlasmaNoTrans, PlasmaUnit,
+                               plasma_tile_mview(A, k), nvan,
+                               1.0, A(k, k), ldak,
+                                    A(k, n), ldak);
+                }
+                PLASMA_TRACE_STOP("dgetrf_update", 1, akn);
+            }
+        }
+        #pragma omp taskwait
+
+        rows[k] = 0;
+        for (int n = k+1; n < A.nt; n++) {
+            int src = plasma_tile_rank(A, k, n);
+            plasma_pdgetrf_mpi_rows(A, n, rows, src, -1, ranks,
+                                    sequence, request);
+            // Send row k to the column it updates.
+            plasma_tile_owners(A, k+1, A.mt-1, n, n, ranks);
+            plasma_omp_tile_bcast(A, k, n, src, ranks, sequence, request);
+        }
+
+        // gemm
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            for (int m = k+1; m < A.mt; m++) {
+                if (!plasma_tile_local(A, m, n))
+                    continue;
+
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                plasma_tile_affinity(A, m, n);
+                core_omp_dgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, nvak,
+                    -1.0, A(m, k), ldam,
+                          A(k, n), ldak,
+                     1.0, A(m, n), ldam,
+                    sequence, request);
+            }
+        }
+    }
+
+    // pivoting to the left, one gather per column, after the last panel
+    if (sequence->status == PlasmaSuccess &&
+        plasma->left_pivoting == PlasmaLeftPivotingOn) {
+        #pragma omp taskwait
+        int kt = imin(A.mt, A.nt);
+        int k2 = imin(A.m, A.n);
+        for (int phase = 0; phase < 3; phase++) {
+            for (int n = 0; n < kt-1; n++) {
+                int dest = plasma_tile_rank(A, n+1, n);
+                memset(rows, 0, A.mt);
+                for (int m = n+1; m < kt; m++)
+                    rows[m] = 1;
+                for (int i = (n+1)*A.mb; i < k2; i++)
+                    rows[(ipiv[i]-1)/A.mb] = 1;
+
+                if (phase == 0) {
+                    plasma_pdgetrf_mpi_rows(A, n, rows, -1, dest, ranks,
+                                            sequence, request);
+                }
+                else if (phase == 1 && A.rank == dest) {
+                    double *ann = A(n+1, n);
+                    #pragma omp task depend(inout:ann[0:A.mb*A.nb]) \
+                        priority(plasma_sequence_priority(sequence))
+                    {
+                        // The tile only orders the swaps after the panel.
+                        (void)ann;
+                        plasma_desc_t view =
+                            plasma_desc_view(A, 0, n*A.nb, A.m, A.nb);
+                        core_dlaswp(PlasmaRowwise, view, (n+1)*A.mb+1, k2,
+                                    ipiv, 1);
+                    }
+                }
+                else if (phase == 2) {
+                    plasma_pdgetrf_mpi_rows(A, n, rows, dest, -1, ranks,
+                                            sequence, request);
+                }
+            }
+            if (phase < 2) {
+                #pragma omp taskwait
+            }
+        }
+    }
+    free(ranks);
+    free(rows);
+}
+
+/******************************************************************************/
+// arguments of the ranks of the static LU factorization
+typedef struct {
+    plasma_desc_t A;
+    int *ipiv;
+    int ib;
+    plasma_enum_t panel_mode;
+    plasma_panel_workspace_t *panel_work;
+    plasma_progress_t *progress;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pdgetrf_static_t;
+
+/******************************************************************************/
+// Runs the rank of the static LU factorization: factors the tile columns
+// n = rank, rank+size, ..., left-looking, applying to each the pivots and
+// updates of the panels before it as they complete. The panels are factored
+// one at a time, each after the updates of the previous one, by a single
+// thread, so they share one panel workspace.
+static void plasma_pdgetrf_static_rank(void *args, int rank, int size,
+                                       plasma_barrier_t *barrier)
+{
+    plasma_pdgetrf_static_t *schedule = (plasma_pdgetrf_static_t*)args;
+    plasma_desc_t A = schedule->A;
+    int *ipiv = schedule->ipiv;
+    int ib = schedule->ib;
+    plasma_enum_t panel_mode = schedule->panel_mode;
+    plasma_panel_workspace_t *panel_work = schedule->panel_work;
+    plasma_progress_t *progress = schedule->progress;
+    plasma_sequence_t *sequence = schedule->sequence;
+    plasma_request_t *request = schedule->request;
+    // The ranks synchronize by the progress table instead.
+    (void)barrier;
+
+    int kt = imin(A.mt, A.nt);
+    for (int n = rank; n < A.nt; n += size) {
+        int nvan = plasma_tile_nview(A, n);
+        for (int k = 0; k < imin(kt, n); k++) {
+            plasma_progress_wait(progress, k, 1);
+            if (sequence->status != PlasmaSuccess)
+                continue;
+
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+
+            // laswp
+            int k1 = k*A.mb+1;
+            int k2 = imin(k*A.mb+A.mb, A.m);
+            plasma_desc_t view = plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+            core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+            // trsm
+            core_dtrsm(PlasmaLeft, PlasmaLower,
+                       PlasmaNoTrans, PlasmaUnit,
+                       mvak, nvan,
+                       1.0, A(k, k), ldak,
+                            A(k, n), ldak);
+
+            // gemm
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_dgemm(PlasmaNoTrans, PlasmaNoTrans,
+                           mvam, nvan, A.nb,
+                           -1.0, A(m, k), ldam,
+                                 A(k, n), ldak,
+                           1.0,  A(m, n), ldam);
+            }
+        }
+        if (n >= kt)
+            continue;
+
+        // panel
+        if (sequence->status == PlasmaSuccess) {
+            plasma_barrier_t barrier;
+            plasma_barrier_init(&barrier, 1);
+            plasma_desc_t view =
+                plasma_desc_view(A, n*A.mb, n*A.nb, A.m-n*A.mb, nvan);
+
+            int info;
+            if (panel_mode == PlasmaRecursivePanel)
+                info = core_dgetrf_rec(view, &ipiv[n*A.mb], ib, 0, 1,
+                                       panel_work, &barrier);
+            else
+                info = core_dgetrf(view, &ipiv[n*A.mb], ib, 0, 1,
+                                   panel_work, &barrier);
+            for (int i = n*A.mb+1; i <= imin(A.m, n*A.mb+nvan); i++)
+                ipiv[i-1] += n*A.mb;
+            if (info != 0)
+                plasma_request_fail(sequence, request, n*A.mb+info);
+        }
+        // The other ranks wait for the panel even if the sequence failed.
+        plasma_progress_set(progress, n, 1);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization - static scheduling.
+ *  The schedule is one task, depending on all the tiles of A and the blocks
+ *  of the pivots, whose ranks run on a nested team of as many threads as the
+ *  team of the call, see plasma_team_run(), so that they all run at the
+ *  same time, whatever the other tasks of the team.
+ *  The tournament panel is replaced by the partial pivoting one.
+ **/
+static void plasma_pdgetrf_static(plasma_context_t *plasma,
+                                  plasma_desc_t A, int *ipiv,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int ib = plasma->ib;
+    plasma_enum_t panel_mode = plasma->panel_mode;
+    plasma_panel_workspace_t *panel_work = &plasma->panel_work;
+    int size = omp_get_num_threads();
+    int priority = plasma_sequence_priority(sequence);
+
+    int kt = imin(A.mt, A.nt);
+    int count = A.mt*A.nt;
+    double **tiles = (double**)
+        malloc((size_t)count*sizeof(double*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    for (int n = 0; n < A.nt; n++)
+        for (int m = 0; m < A.mt; m++)
+            tiles[n*A.mt+m] = A(m, n);
+
+    #pragma omp task depend(iterator(int t = 0:count), inout:tiles[t][0]) \
+                     depend(iterator(int t = 0:kt), out:ipiv[t*A.mb]) \
+                     priority(priority)
+    {
+        plasma_progress_t progress;
+        if (plasma_progress_init(&progress, kt) != PlasmaSuccess) {
+            plasma_error("plasma_progress_init() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        }
+        else {
+            // The workspace is shared with the panels of the other
+            // sequences of the context running at the same time, if any.
+            plasma_panel_workspace_t *lent =
+                plasma_panel_workspace_acquire(panel_work);
+            plasma_pdgetrf_static_t schedule = {
+                A, ipiv, ib, panel_mode, lent, &progress, sequence, request
+            };
+            plasma_team_run(PlasmaThreadTeam, PlasmaBindNone, size, priority,
+                            plasma_pdgetrf_static_rank, &schedule);
+            plasma_panel_workspace_release(panel_work, lent);
+            plasma_progress_destroy(&progress);
+        }
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+    free(tiles);
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization of a matrix of a single process,
+ *  dynamically scheduled. With B, the forward substitution of each block
+ *  row of B is submitted right after its panel, in the same task graph.
+ **/
+static void plasma_pdgetrf_dynamic(plasma_context_t *plasma,
+                                   plasma_desc_t A, int *ipiv,
+                                   plasma_desc_t *B,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
     int ib = plasma->ib;
     int num_panel_threads = plasma->num_panel_threads;
-    plasma_barrier_t *barrier = &plasma->barrier;
+    plasma_enum_t panel_mode = plasma->panel_mode;
+    plasma_enum_t update_mode = plasma->update_mode;
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+    plasma_panel_workspace_t *panel_work = &plasma->panel_work;
+
+    // Task priorities: the panel first, then the updates of the next
+    // lookahead columns, then the rest of the trailing matrix, all above
+    // the tasks of the normal sequences if the sequence is urgent.
+    int lookahead = plasma->lookahead;
+    int priority = plasma_sequence_priority(sequence);
+    int panel_priority = priority + (lookahead > 0 ? 2 : 0);
+
+    // the slices of the updates emulated by the Ozaki scheme, if any
+    int slices = plasma_gemm_ozaki(plasma);
+
+    // the split columns of L for the 3M updates, one for each step
+    double **S = NULL;
+#ifdef COMPLEX
+    if (plasma_gemm_3m(plasma) && update_mode != PlasmaTileUpdate &&
+        A.mt > 1 && A.nt > 1) {
+        S = (double**)calloc(imin(A.mt, A.nt), sizeof(double*));
+        if (S == NULL) {
+            plasma_error("calloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+    }
+#endif
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
-        double *a00, *a20;
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        double *a00, *a20, *a10;
         a00 = A(k, k);
         a20 = A(A.mt-1, k);
+        // The tile updates of step k-1 are tracked through row k-1.
+        a10 = k > 0 ? A(k-1, k) : a00;
 
-        int ma00k = (A.mt-k-1)*A.mb;
+        size_t ma00k = (size_t)(A.mt-k-1)*A.mb;
         int na00k = plasma_tile_nmain(A, k);
         int lda20 = plasma_tile_mmain(A, A.mt-1);
+        int lda10 = plasma_tile_mmain(A, imax(k-1, 0));
 
         int nvak = plasma_tile_nview(A, k);
         int mvak = plasma_tile_mview(A, k);
         int ldak = plasma_tile_mmain(A, k);
 
-        // panel
-#if defined(USE_OMPEXT)
-omp_set_task_name("panel");
+#ifdef COMPLEX
+        // The column of L split for the 3M updates of step k, if any.
+        double **Sk = S != NULL && k+1 < A.mt && k+1 < A.nt ? &S[k] : NULL;
 #endif
+
+        // panel, on the place of its diagonal tile, which its team
+        // threads are pinned next to with PlasmaPanelBind
+        plasma_tile_affinity(A, k, k);
         #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
                          depend(inout:a20[0:lda20*nvak]) \
-                         depend(out:ipiv[k*A.mb:mvak]) /*\
-                         priority(1) */
+                         depend(inout:a10[0:lda10*nvak]) \
+                         depend(out:ipiv[k*A.mb:mvak]) \
+                         priority(panel_priority)
         {
-            if (sequence->status == PlasmaSuccess) {
-                for (int rank = 0; rank < num_panel_threads; rank++) {
-#if defined(USE_OMPEXT)
-omp_set_task_name("dgetrf");
-#endif
-                    #pragma omp task // priority(1)
-                    {
-                        plasma_desc_t view =
-                            plasma_desc_view(A,
-                                             k*A.mb, k*A.nb,
-                                             A.m-k*A.mb, nvak);
-
-                        int info = core_dgetrf(view, &ipiv[k*A.mb], ib,
-                                               rank, num_panel_threads,
-                                               barrier);
-                        if (info != 0)
-                            plasma_request_fail(sequence, request, k*A.mb+info);
-                    }
+            PLASMA_TRACE_START("dgetrf_panel", a00);
+            if (PLASMA_TRACE_RUN(sequence)) {
+                if (panel_mode == PlasmaTournamentPanel) {
+                    plasma_pdgetrf_tntpiv(plasma, A, k, ipiv,
+                                          sequence, request);
+                }
+                else {
+                    plasma_desc_t view =
+                        plasma_desc_view(A,
+                                         k*A.mb, k*A.nb,
+                                         A.m-k*A.mb, nvak);
+
+                    int info = plasma_pdgetrf_panel(view, &ipiv[k*A.mb], ib,
+                                                    panel_mode,
+                                                    panel_team, panel_bind,
+                                                    num_panel_threads,
+                                                    panel_priority,
+                                                    panel_work);
+                    if (info != 0)
+                        plasma_request_fail(sequence, request, k*A.mb+info);
                 }
             }
             #pragma omp taskwait
 
             for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
                 ipiv[i-1] += k*A.mb;
+
+#ifdef COMPLEX
+            // Split the column of L below the diagonal tile,
+            // for the updates of step k.
+            if (Sk != NULL && sequence->status == PlasmaSuccess) {
+                size_t size = core_dgemm3m_split_size(A.m-(k+1)*A.mb, nvak);
+                *Sk = (double*)malloc(size);
+                if (*Sk == NULL) {
+                    plasma_error("malloc() failed");
+                    plasma_request_fail(sequence, request,
+                                        PlasmaErrorOutOfMemory);
+                }
+                else {
+                    for (int m = k+1; m < A.mt; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        core_dgemm3m_split(
+                            PlasmaNoTrans, mvam, nvak,
+                            A(m, k), plasma_tile_mmain(A, m),
+                            &(*Sk)[3*(size_t)(m-k-1)*A.mb*nvak]);
+                    }
+                }
+            }
+#endif
+            PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                (A.m-k*A.mb)*(double)nvak*nvak - (double)nvak*nvak*nvak/3.0,
+                2.0*(A.m-k*A.mb)*nvak);
+            PLASMA_TRACE_STOP("dgetrf_panel", 4, a00, a20, a10, &ipiv[k*A.mb]);
+            PLASMA_SEQUENCE_CANCEL(sequence);
         }
+        // Read ahead the next panel of a mapped matrix.
+        plasma_desc_prefetch(A, k, A.mt-1, k+1, k+1, a00);
+
+        // forward substitution of block row k of B
+        if (B != NULL)
+            plasma_pdlaswp_trsm_step(A, ipiv, *B, k, sequence, request);
+
         // update
+        if (update_mode == PlasmaTileUpdate) {
+            plasma_pdgetrf_tile_update(A, k, ipiv, lookahead,
+                                       sequence, request);
+            continue;
+        }
         for (int n = k+1; n < A.nt; n++) {
             double *a01, *a11, *a21;
             a01 = A(k, n);
             a11 = A(k+1, n);
             a21 = A(A.mt-1, n);
 
-            int ma11k = (A.mt-k-2)*A.mb;
+            size_t ma11k = (size_t)(A.mt-k-2)*A.mb;
             int na11n = plasma_tile_nmain(A, n);
             int lda21 = plasma_tile_mmain(A, A.mt-1);
 
             int nvan = plasma_tile_nview(A, n);
 
-#if defined(USE_OMPEXT)
-omp_set_task_name("update");
-#endif
-            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
-                             depend(in:a20[0:lda20*nvak]) \
-                             depend(in:ipiv[k*A.mb:mvak]) \
-                             depend(inout:a01[0:ldak*nvan]) \
-                             depend(inout:a11[0:ma11k*na11n]) \
-                             depend(inout:a21[0:lda21*nvan]) /*\
-                             priority(n == k+1) */
+            // The trsm of the task reads the diagonal tile of column k, and
+            // its nested gemms the tiles below. The range of a00 covers all
+            // of them but the last, which only the gemms read, hence weak.
+            PLASMA_TASK(PLASMA_IN(a00, 0, ma00k*na00k)
+                        PLASMA_WEAK_IN(a20, 0, lda20*nvak)
+                        PLASMA_IN(ipiv, k*A.mb, mvak)
+                        PLASMA_INOUT(a01, 0, ldak*nvan)
+                        PLASMA_INOUT(a11, 0, ma11k*na11n)
+                        PLASMA_INOUT(a21, 0, lda21*nvan)
+                        PLASMA_PRIORITY(priority + (n-k <= lookahead)))
             {
+                PLASMA_TRACE_START("dgetrf_update", a01);
                 if (sequence->status == PlasmaSuccess) {
-                    // laswp
-                    int k1 = k*A.mb+1;
-                    int k2 = imin(k*A.mb+A.mb, A.m);
-                    plasma_desc_t view =
-                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
-                    core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        // laswp
+                        int k1 = k*A.mb+1;
+                        int k2 = imin(k*A.mb+A.mb, A.m);
+                        plasma_desc_t view =
+                            plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                        core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
 
-                    // trsm
-                    core_dtrsm(PlasmaLeft, PlasmaLower,
-                               PlasmaNoTrans, PlasmaUnit,
-                               mvak, nvan,
-                               1.0, A(k, k), ldak,
-                                    A(k, n), ldak);
+                        // trsm
+                        core_dtrsm(PlasmaLeft, PlasmaLower,
+                                   PlasmaNoTrans, PlasmaUnit,
+                                   mvak, nvan,
+                                   1.0, A(k, k), ldak,
+                                        A(k, n), ldak);
+                    }
+
+#ifdef COMPLEX
+                    // Split the tile of U, then run the gemms by the 3M
+                    // algorithm with the split column of L.
+                    if (Sk != NULL) {
+                        double *Bs = (double*)malloc(
+                            core_dgemm3m_split_size(nvak, nvan));
+                        if (Bs == NULL) {
+                            plasma_error("malloc() failed");
+                            plasma_request_fail(sequence, request,
+                                                PlasmaErrorOutOfMemory);
+                        }
+                        else {
+                            core_dgemm3m_split(PlasmaNoTrans, nvak, nvan,
+                                               A(k, n), ldak, Bs);
+                        }
+                        for (int m = k+1; m < A.mt && Bs != NULL; m++) {
+                            int mvam = plasma_tile_mview(A, m);
+                            int ldam = plasma_tile_mmain(A, m);
+                            double *As =
+                                &(*Sk)[3*(size_t)(m-k-1)*A.mb*nvak];
+
+                            double *amk = A(m, k);
+                            double *amn = A(m, n);
 
+                            plasma_tile_affinity(A, m, n);
+                            PLASMA_TASK(PLASMA_IN(amk, 0, ldam*nvak)
+                                        PLASMA_INOUT(amn, 0, ldam*nvan)
+                                        PLASMA_PRIORITY(priority +
+                                                        (n-k <= lookahead)))
+                            {
+                                PLASMA_TRACE_START("dgemm3m", amn);
+                                if (PLASMA_TRACE_RUN(sequence)) {
+                                    double *W = (double*)malloc(
+                                        3*(size_t)mvam*nvan*sizeof(double));
+                                    if (W == NULL) {
+                                        plasma_request_fail(
+                                            sequence, request,
+                                            PlasmaErrorOutOfMemory);
+                                    }
+                                    else {
+                                        core_dgemm3m(mvam, nvan, nvak,
+                                                     -1.0, As, Bs,
+                                                     1.0, amn, ldam,
+                                                     W);
+                                        free(W);
+                                    }
+                                }
+                                PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                                   2.0*mvam*nvan*nvak,
+                                                   (double)mvam*nvak +
+                                                   (double)nvak*nvan +
+                                                   2.0*mvam*nvan);
+                                PLASMA_TRACE_STOP("dgemm3m", 1, amn, amk,
+                                                  A(k, n));
+                            }
+                        }
+                        // The gemms read the split tile of U.
+                        PLASMA_TASKWAIT();
+                        free(Bs);
+                    }
+                    else
+#endif
                     // gemm
                     for (int m = k+1; m < A.mt; m++) {
                         int mvam = plasma_tile_mview(A, m);
                         int ldam = plasma_tile_mmain(A, m);
 
-#if defined(USE_OMPEXT)
-omp_set_task_name("dgemm");
-#endif
-                        #pragma omp task // priority(n == k+1)
+                        double *amk = A(m, k);
+                        double *amn = A(m, n);
+
+                        plasma_tile_affinity(A, m, n);
+                        PLASMA_TASK(PLASMA_IN(amk, 0, ldam*nvak)
+                                    PLASMA_INOUT(amn, 0, ldam*nvan)
+                                    PLASMA_PRIORITY(priority +
+                                                    (n-k <= lookahead)))
                         {
-                            core_dgemm(
-                                PlasmaNoTrans, PlasmaNoTrans,
-                                mvam, nvan, A.nb,
-                                -1.0, A(m, k), ldam,
-                                      A(k, n), ldak,
-                                1.0,  A(m, n), ldam);
+                            PLASMA_TRACE_START("dgemm", amn);
+                            if (PLASMA_TRACE_RUN(sequence)) {
+                                int retval = PlasmaSuccess;
+                                if (slices > 0)
+                                    retval = core_dgemm_emulated(
+                                        PlasmaNoTrans, PlasmaNoTrans,
+                                        mvam, nvan, A.nb, slices,
+                                        -1.0, amk, ldam,
+                                              A(k, n), ldak,
+                                        1.0,  amn, ldam);
+                                else
+                                    PLASMA_OFFLOAD(plasma, core_dgemm)(
+                                        PlasmaNoTrans, PlasmaNoTrans,
+                                        mvam, nvan, A.nb,
+                                        -1.0, amk, ldam,
+                                              A(k, n), ldak,
+                                        1.0,  amn, ldam);
+                                if (retval != PlasmaSuccess)
+                                    plasma_request_fail(sequence, request,
+                                                        retval);
+                            }
+                            PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                               2.0*mvam*nvan*A.nb,
+                                               (double)mvam*A.nb +
+                                               (double)A.nb*nvan + 2.0*mvam*nvan);
+                            PLASMA_TRACE_STOP("dgemm", 1, amn, amk, A(k, n));
                         }
                     }
                 }
-                #pragma omp taskwait
+                PLASMA_TASKWAIT_NESTED();
+                // the trsm, the gemms are nested tasks
+                PLASMA_TRACE_FLOPS(PlasmaRealDouble, (double)mvak*mvak*nvan,
+                                   0.5*mvak*mvak + 2.0*mvak*nvan);
+                PLASMA_TRACE_STOP("dgetrf_update", 3, a01, a11, a21, a00, a20, &ipiv[k*A.mb]);
             }
         }
+#ifdef COMPLEX
+        // Free the split column of L after the updates of step k,
+        // which all read the panel.
+        if (Sk != NULL) {
+            PLASMA_TASK(PLASMA_INOUT(a00, 0, ma00k*na00k)
+                        PLASMA_PRIORITY(plasma_sequence_priority(sequence)))
+            {
+                free(*Sk);
+                *Sk = NULL;
+            }
+        }
+#endif
+    }
+    // pivoting to the left, left to plasma_dgetrs otherwise
+    if (plasma->left_pivoting == PlasmaLeftPivotingOn) {
+        // The solve reads each column of L before the later pivots.
+        if (B != NULL) {
+            #pragma omp taskwait
+        }
+        plasma_pdgetrf_left(A, ipiv, sequence, request);
+    }
+
+#if defined(PLASMA_WITH_CUDA)
+    // The gemms on the device read column k and row k of step k only.
+    if (plasma->offload == PlasmaOffloadOn) {
+        #pragma omp taskwait
+        plasma_device_cache_clear();
+    }
+#endif
+    if (S != NULL) {
+        #pragma omp taskwait
+        // the split columns whose freeing task a cancellation discarded
+        for (int k = 0; k < imin(A.mt, A.nt); k++)
+            free(S[k]);
+        free(S);
+    }
+}
+
+/******************************************************************************/
+void plasma_pdgetrf(plasma_desc_t A, int *ipiv,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // matrix distributed over MPI processes
+    if (A.p*A.q > 1) {
+        plasma_pdgetrf_mpi(plasma, A, ipiv, sequence, request);
+        return;
+    }
+
+    // matrix of a single process, statically scheduled
+    if (plasma_static_scheduling(plasma)) {
+        plasma_pdgetrf_static(plasma, A, ipiv, sequence, request);
+        if (plasma->left_pivoting == PlasmaLeftPivotingOn)
+            plasma_pdgetrf_left(A, ipiv, sequence, request);
+        return;
+    }
+
+    plasma_pdgetrf_dynamic(plasma, A, ipiv, NULL, sequence, request);
+}
+
+/***************************************************************************//**
+ *  Parallel solve of A X = B by the LU factorization with partial pivoting.
+ *  With dynamic scheduling, the forward substitution runs in the task graph
+ *  of the factorization, each block row of B as soon as its panel is done,
+ *  and only the backward substitution is left after it. The statically
+ *  scheduled and distributed factorizations solve in separate phases.
+ * @see plasma_omp_dgesv
+ ******************************************************************************/
+void plasma_pdgesv(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    if (A.p*A.q > 1 || plasma_static_scheduling(plasma)) {
+        plasma_pdgetrf(A, ipiv, sequence, request);
+
+        if (plasma->left_pivoting == PlasmaLeftPivotingOn) {
+            plasma_pdlaswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
+
+            plasma_pdtrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                          1.0, A,
+                               B,
+                          sequence, request);
+        }
+        else {
+            plasma_pdlaswp_trsm(A, ipiv, B, sequence, request);
+        }
     }
-    // pivoting to the left
+    else {
+        plasma_pdgetrf_dynamic(plasma, A, ipiv, &B, sequence, request);
+    }
+
+    plasma_pdtrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+}
+
+/***************************************************************************//**
+ *  Applies the pivots of each panel of plasma_pdgetrf to the columns left
+ *  of it, one task per tile column, after the last panel. With
+ *  PlasmaLeftPivotingOff, plasma_pdgetrf leaves them out, for the solvers
+ *  applying the pivots block by block (plasma_pdlaswp_trsm).
+ ******************************************************************************/
+void plasma_pdgetrf_left(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
     for (int k = 1; k < imin(A.mt, A.nt); k++) {
         double *akk;
         akk = A(k, k);
-        int makk = (A.mt-k-1)*A.mb;
+        size_t makk = (size_t)(A.mt-k-1)*A.mb;
         int nakk = plasma_tile_nmain(A, k);
 
-#if defined(USE_OMPEXT)
-omp_set_task_name("dlaswp");
-#endif
         #pragma omp task depend(in:ipiv[(imin(A.mt, A.nt)-1)*A.mb]) \
-                         depend(inout:akk[0:makk*nakk])
+                         depend(inout:akk[0:makk*nakk]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("dlaswp", akk);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 plasma_desc_t view =
                     plasma_desc_view(A, 0, (k-1)*A.nb, A.m, A.nb);
                 int k1 = k*A.mb+1;
                 int k2 = imin(A.m, A.n);
                 core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
             }
+            PLASMA_TRACE_STOP("dlaswp", 1, akk, &ipiv[(imin(A.mt, A.nt)-1)*A.mb]);
         }
     }
 }
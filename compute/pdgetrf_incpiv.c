@@ -0,0 +1,98 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetrf_incpiv.c, normal z -> d, Thu Oct 15 04:14:01 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define L(m, n) (double*)plasma_tile_addr(L, m, n)
+#define IPIV(m, n) (&ipiv[((size_t)A.mt*(n)+(m))*A.nb])
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with incremental pivoting -
+ *  dynamic scheduling
+ * @see plasma_omp_dgetrf_incpiv
+ **/
+void plasma_pdgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the L tile row-dimension.
+    int ib = L.mb;
+
+    int kt = imin(A.mt, A.nt);
+    for (int k = 0; k < kt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // The zero pivots of a diagonal tile are final only once
+        // the last tile of its column has been coupled with it.
+        core_omp_dgetrf_incpiv(
+            mvak, nvak,
+            A(k, k), ldak, IPIV(k, k),
+            k == A.mt-1 ? A.nb*k : -1,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_dgessm(
+                mvak, nvan, imin(mvak, nvak),
+                IPIV(k, k),
+                A(k, k), ldak,
+                A(k, n), ldak,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dtstrf(
+                mvam, nvak, ib,
+                A(k, k), ldak,
+                A(m, k), ldam,
+                L(m, k), L.mb,
+                IPIV(m, k),
+                work,
+                m == A.mt-1 ? A.nb*k : -1,
+                sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_dssssm(
+                    mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    L(m, k), L.mb,
+                    A(m, k), ldam,
+                    IPIV(m, k),
+                    sequence, request);
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetrf_nopiv.c, normal z -> d, Thu Oct 15 04:20:01 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization without pivoting - dynamic scheduling.
+ *  Each tile is a task, as in the Cholesky factorization, with no panel
+ *  spanning the tile column.
+ * @see plasma_omp_dgesv_rbt
+ **/
+void plasma_pdgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        core_omp_dgetrf_nopiv(
+            mvak, nvak,
+            A(k, k), ldak,
+            A.mb*k,
+            sequence, request);
+
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dtrsm(
+                PlasmaRight, PlasmaUpper,
+                PlasmaNoTrans, PlasmaNonUnit,
+                mvam, nvak,
+                zone, A(k, k), ldak,
+                      A(m, k), ldam,
+                sequence, request);
+        }
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_dtrsm(
+                PlasmaLeft, PlasmaLower,
+                PlasmaNoTrans, PlasmaUnit,
+                mvak, nvan,
+                zone, A(k, k), ldak,
+                      A(k, n), ldak,
+                sequence, request);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_dgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, nvak,
+                    zmone, A(m, k), ldam,
+                           A(k, n), ldak,
+                    zone,  A(m, n), ldam,
+                    sequence, request);
+            }
+        }
+    }
+}
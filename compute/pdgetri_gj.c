@@ -0,0 +1,163 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetri_gj.c, normal z -> d, Thu Oct 15 08:42:01 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile inversion from the LU factors in one Gauss-Jordan sweep -
+ *  dynamic scheduling.
+ *  Computes A = (L U)^{-1} in place, where U is stored in the upper triangle
+ *  and the unit lower triangular L in the strictly lower triangle of A.
+ *
+ *  Step k is step k of the Gauss-Jordan elimination of L U, whose pivot
+ *  tile, column k and row k, the tiles of the Schur complement, are formed
+ *  from the factors: L(k, k) U(k, k), L(m, k) U(k, k) and L(k, k) U(k, n).
+ *  Only the tiles already swept, those of tile rows or tile columns below k,
+ *  are updated; the trailing matrix needs none, as it is already factored.
+ *  The flops are those of trtri of U and L and of their product, but all
+ *  in one pass over k, each step waiting only on the tiles of row k and
+ *  column k.
+ **/
+void plasma_pdgetri_gj(plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    for (int k = 0; k < A.mt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // A(m, k) = -A(m, k) U(k, k)^{-1}, m < k
+        for (int m = 0; m < k; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dtrsm(
+                PlasmaRight, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                mvam, nvak,
+                zmone, A(k, k), ldak,
+                       A(m, k), ldam,
+                sequence, request);
+        }
+
+        // A(m, n) += A(m, k) U(k, n), m < k < n
+        for (int m = 0; m < k; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_dgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, mvak,
+                    zone, A(m, k), ldam,
+                          A(k, n), ldak,
+                    zone, A(m, n), ldam,
+                    sequence, request);
+            }
+        }
+
+        // A(m, k) = A(m, k) L(k, k)^{-1}, m < k,
+        // and A(m, k) = -L(m, k) L(k, k)^{-1}, m > k
+        for (int m = 0; m < A.mt; m++) {
+            if (m == k)
+                continue;
+
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dtrsm(
+                PlasmaRight, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                mvam, nvak,
+                m < k ? zone : zmone, A(k, k), ldak,
+                                      A(m, k), ldam,
+                sequence, request);
+        }
+
+        // A(m, n) += A(m, k) A(k, n), m != k, n < k
+        for (int m = 0; m < A.mt; m++) {
+            if (m == k)
+                continue;
+
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            for (int n = 0; n < k; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_dgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, nvak,
+                    zone, A(m, k), ldam,
+                          A(k, n), ldak,
+                    zone, A(m, n), ldam,
+                    sequence, request);
+            }
+        }
+
+        // A(k, n) = U(k, k)^{-1} L(k, k)^{-1} A(k, n), n < k,
+        // and A(k, n) = U(k, k)^{-1} U(k, n), n > k
+        for (int n = 0; n < A.nt; n++) {
+            if (n == k)
+                continue;
+
+            int nvan = plasma_tile_nview(A, n);
+            if (n < k) {
+                core_omp_dtrsm(
+                    PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                    mvak, nvan,
+                    zone, A(k, k), ldak,
+                          A(k, n), ldak,
+                    sequence, request);
+            }
+            core_omp_dtrsm(
+                PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                mvak, nvan,
+                zone, A(k, k), ldak,
+                      A(k, n), ldak,
+                sequence, request);
+        }
+
+        // A(k, k) = U(k, k)^{-1} L(k, k)^{-1}
+        core_omp_dtrtri(
+            PlasmaUpper, PlasmaNonUnit,
+            mvak,
+            A(k, k), ldak,
+            A.nb*k,
+            sequence, request);
+
+        core_omp_dtrtri(
+            PlasmaLower, PlasmaUnit,
+            mvak,
+            A(k, k), ldak,
+            A.nb*k,
+            sequence, request);
+
+        core_omp_dlumm(
+            imin(mvak, nvak),
+            A(k, k), ldak,
+            sequence, request);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzlange.c, normal z -> d, Mon Feb  6 14:06:17 2017
+ * @generated from compute/pzlange.c, normal z -> d, Thu Oct 15 11:00:48 2026
  *
  **/
 
@@ -18,11 +18,79 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <math.h>
+#include <omp.h>
+
 #define A(m, n) (double*)plasma_tile_addr(A, m, n)
 
+/******************************************************************************/
+// Submits the partial norm of the packed tile (m, n) of A, unpacked into
+// the scratch of the thread: the max norm in value[0], the sums of the
+// columns or of the rows in value for the one or infinity norm, or the
+// scale in value[0] and the sum of squares in sumsq[0] for the Frobenius
+// norm, as the tasks of the tiles which are not packed.
+static void plasma_pdlange_packed(plasma_enum_t norm, plasma_desc_t A,
+                                  int m, int n, plasma_workspace_t scratch,
+                                  double *value, double *sumsq,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int mvam = plasma_tile_mview(A, m);
+    int nvan = plasma_tile_nview(A, n);
+    int ldam = plasma_tile_mmain(A, m);
+    unsigned char *a = (unsigned char*)plasma_tile_addr(A, m, n);
+
+    #pragma omp task depend(in:a[0]) \
+                     depend(out:value[0]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dlange", value);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            double *W =
+                (double*)scratch.spaces[tid];
+            core_dunpack(PlasmaGeneral, mvam, nvan, a, ldam, A.rate,
+                         W, mvam);
+            switch (norm) {
+            case PlasmaMaxNorm:
+                core_dlange(PlasmaMaxNorm, mvam, nvan, W, mvam,
+                            NULL, value);
+                break;
+            case PlasmaOneNorm:
+                for (int j = 0; j < nvan; j++) {
+                    double sum = 0.0;
+                    for (int i = 0; i < mvam; i++)
+                        sum += fabs(W[mvam*j+i]);
+
+                    value[j] = sum;
+                }
+                break;
+            case PlasmaInfNorm:
+                for (int i = 0; i < mvam; i++)
+                    value[i] = 0.0;
+
+                for (int j = 0; j < nvan; j++)
+                    for (int i = 0; i < mvam; i++)
+                        value[i] += fabs(W[mvam*j+i]);
+                break;
+            case PlasmaFrobeniusNorm:
+                *value = 0.0;
+                *sumsq = 1.0;
+                core_dgessq(mvam, nvan, W, mvam, value, sumsq);
+                break;
+            }
+        }
+        PLASMA_TRACE_STOP("dlange", 1, value, a);
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile calculation of max, one, infinity or Frobenius matrix norm
  *  for a general matrix.
+ *  The partial results of the tiles are reduced by tile columns, or by tile
+ *  rows for the infinity norm, in parallel, each into its first partial,
+ *  then across them, within the workspace of plasma_omp_dlange. Packed
+ *  tiles are unpacked into a scratch tile of each thread.
  ******************************************************************************/
 void plasma_pdlange(plasma_enum_t norm,
                     plasma_desc_t A, double *work, double *value,
@@ -32,6 +100,16 @@ void plasma_pdlange(plasma_enum_t norm,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    plasma_workspace_t scratch;
+    if (A.rate > 0) {
+        int retval = plasma_workspace_create(&scratch, (size_t)A.mb*A.nb,
+                                             A.precision);
+        if (retval != PlasmaSuccess) {
+            plasma_request_fail(sequence, request, retval);
+            return;
+        }
+    }
+
     switch (norm) {
     double stub;
     double *workspace;
@@ -46,16 +124,30 @@ void plasma_pdlange(plasma_enum_t norm,
             int ldam = plasma_tile_mmain(A, m);
             for (int n = 0; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
-                core_omp_dlange(PlasmaMaxNorm,
-                                mvam, nvan,
-                                A(m, n), ldam,
-                                &stub, &work[A.mt*n+m],
-                                sequence, request);
+                if (A.rate > 0)
+                    plasma_pdlange_packed(PlasmaMaxNorm, A, m, n, scratch,
+                                          &work[A.mt*n+m], NULL,
+                                          sequence, request);
+                else
+                    core_omp_dlange(PlasmaMaxNorm,
+                                    mvam, nvan,
+                                    A(m, n), ldam,
+                                    &stub, &work[A.mt*n+m],
+                                    sequence, request);
             }
         }
         #pragma omp taskwait
+        // the norm of each tile column in place of its first partial
+        for (int n = 0; n < A.nt; n++) {
+            core_omp_dlange(PlasmaMaxNorm,
+                            A.mt, 1,
+                            &work[A.mt*n], A.mt,
+                            &stub, &work[A.mt*n],
+                            sequence, request);
+        }
+        #pragma omp taskwait
         core_omp_dlange(PlasmaMaxNorm,
-                        A.mt, A.nt,
+                        1, A.nt,
                         work, A.mt,
                         &stub, value,
                         sequence, request);
@@ -69,19 +161,34 @@ void plasma_pdlange(plasma_enum_t norm,
             int ldam = plasma_tile_mmain(A, m);
             for (int n = 0; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
-                core_omp_dlange_aux(PlasmaOneNorm,
-                                    mvam, nvan,
-                                    A(m, n), ldam,
-                                    &work[A.n*m+n*A.nb],
-                                    sequence, request);
+                if (A.rate > 0)
+                    plasma_pdlange_packed(PlasmaOneNorm, A, m, n, scratch,
+                                          &work[A.n*m+n*A.nb], NULL,
+                                          sequence, request);
+                else
+                    core_omp_dlange_aux(PlasmaOneNorm,
+                                        mvam, nvan,
+                                        A(m, n), ldam,
+                                        &work[A.n*m+n*A.nb],
+                                        sequence, request);
             }
         }
         #pragma omp taskwait
         workspace = work + A.mt*A.n;
-        core_omp_dlange(PlasmaInfNorm,
-                        A.n, A.mt,
-                        work, A.n,
-                        workspace, value,
+        // the norm of each tile column in place of its first partial
+        for (int n = 0; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_dlange(PlasmaInfNorm,
+                            nvan, A.mt,
+                            &work[n*A.nb], A.n,
+                            &workspace[n*A.nb], &work[n*A.nb],
+                            sequence, request);
+        }
+        #pragma omp taskwait
+        core_omp_dlange(PlasmaMaxNorm,
+                        1, A.nt,
+                        work, A.nb,
+                        &stub, value,
                         sequence, request);
         break;
     //================
@@ -93,19 +200,34 @@ void plasma_pdlange(plasma_enum_t norm,
             int ldam = plasma_tile_mmain(A, m);
             for (int n = 0; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
-                core_omp_dlange_aux(PlasmaInfNorm,
-                                    mvam, nvan,
-                                    A(m, n), ldam,
-                                    &work[A.m*n+m*A.mb],
-                                    sequence, request);
+                if (A.rate > 0)
+                    plasma_pdlange_packed(PlasmaInfNorm, A, m, n, scratch,
+                                          &work[A.m*n+m*A.mb], NULL,
+                                          sequence, request);
+                else
+                    core_omp_dlange_aux(PlasmaInfNorm,
+                                        mvam, nvan,
+                                        A(m, n), ldam,
+                                        &work[A.m*n+m*A.mb],
+                                        sequence, request);
             }
         }
         #pragma omp taskwait
         workspace = work + A.nt*A.m;
-        core_omp_dlange(PlasmaInfNorm,
-                        A.m, A.nt,
-                        work, A.m,
-                        workspace, value,
+        // the norm of each tile row in place of its first partial
+        for (int m = 0; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            core_omp_dlange(PlasmaInfNorm,
+                            mvam, A.nt,
+                            &work[m*A.mb], A.m,
+                            &workspace[m*A.mb], &work[m*A.mb],
+                            sequence, request);
+        }
+        #pragma omp taskwait
+        core_omp_dlange(PlasmaMaxNorm,
+                        1, A.mt,
+                        work, A.mb,
+                        &stub, value,
                         sequence, request);
         break;
     //======================
@@ -119,17 +241,36 @@ void plasma_pdlange(plasma_enum_t norm,
             int ldam = plasma_tile_mmain(A, m);
             for (int n = 0; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
-                core_omp_dgessq(mvam, nvan,
-                                A(m, n), ldam,
-                                &scale[A.mt*n+m], &sumsq[A.mt*n+m],
-                                sequence, request);
+                if (A.rate > 0)
+                    plasma_pdlange_packed(PlasmaFrobeniusNorm, A, m, n,
+                                          scratch,
+                                          &scale[A.mt*n+m], &sumsq[A.mt*n+m],
+                                          sequence, request);
+                else
+                    core_omp_dgessq(mvam, nvan,
+                                    A(m, n), ldam,
+                                    &scale[A.mt*n+m], &sumsq[A.mt*n+m],
+                                    sequence, request);
             }
         }
         #pragma omp taskwait
-        core_omp_dgessq_aux(A.mt*A.nt,
-                            scale, sumsq,
-                            value,
-                            sequence, request);
+        // the norm of each tile column in place of its first scale
+        for (int n = 0; n < A.nt; n++) {
+            core_omp_dgessq_aux(A.mt,
+                                &scale[A.mt*n], &sumsq[A.mt*n],
+                                &scale[A.mt*n],
+                                sequence, request);
+        }
+        #pragma omp taskwait
+        core_omp_dlange(PlasmaFrobeniusNorm,
+                        1, A.nt,
+                        scale, A.mt,
+                        &stub, value,
+                        sequence, request);
         break;
     }
+
+    // The tasks of the tiles are done, past the first taskwait.
+    if (A.rate > 0)
+        plasma_workspace_destroy(&scratch);
 }
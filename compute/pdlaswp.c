@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzlaswp.c, normal z -> d, Mon Feb  6 14:06:19 2017
+ * @generated from compute/pzlaswp.c, normal z -> d, Thu Oct 15 10:57:57 2026
  *
  **/
 
@@ -16,9 +16,40 @@
 #include "plasma_types.h"
 #include "core_blas.h"
 
+#include <stdlib.h>
+
 #define A(m, n) (double*)plasma_tile_addr(A, m, n)
 
 /******************************************************************************/
+// Lists the cycles of the permutation of ipiv, of the mn rows (columns),
+// and moves the part of view on them through work. Returns the status.
+static int plasma_pdlaswp_view(plasma_enum_t colrow, plasma_desc_t view,
+                               int mn, const int *ipiv, int incx, int lwork)
+{
+    int *cycles = (int*)malloc((size_t)3*mn*sizeof(int));
+    double *work =
+        (double*)malloc((size_t)lwork*sizeof(double));
+    if (cycles == NULL || work == NULL) {
+        free(cycles);
+        free(work);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    int len = core_laswp_cycles(mn, 1, mn, ipiv, incx, &cycles[2*mn], cycles);
+    core_dlaswp_cycles(colrow, view, cycles, len, work);
+    free(cycles);
+    free(work);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Parallel tile row (column) interchanges. Each tile column (row) task
+ *  lists the cycles of the permutation with core_laswp_cycles, in O(mn),
+ *  and moves its own part of the rows (columns) once per cycle entry with
+ *  core_dlaswp_cycles. The tasks share no buffer, so there is nothing to
+ *  free after them, even if the sequence cancels them.
+ * @see plasma_omp_dlaswp
+ ******************************************************************************/
 void plasma_pdlaswp(plasma_enum_t colrow,
                     plasma_desc_t A, int *ipiv, int incx,
                     plasma_sequence_t *sequence, plasma_request_t *request)
@@ -27,33 +58,72 @@ void plasma_pdlaswp(plasma_enum_t colrow,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    int mn = colrow == PlasmaRowwise ? A.m : A.n;
+    // the tiles of one task, declared in its dependences
+    int count = colrow == PlasmaRowwise ? A.mt : A.nt;
+    double **tiles = (double**)
+        malloc((size_t)count*sizeof(double*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    // The permutation follows the blocks of the pivots, as written by the
+    // panels of plasma_pdgetrf.
+    int bs = colrow == PlasmaRowwise ? A.mb : A.nb;
     if (colrow == PlasmaRowwise) {
+        // Each task swaps rows across all the tiles of its tile column.
         for (int n = 0; n < A.nt; n++) {
-            double *a00, *a10;
-
-            a00 = A(0, n);
-            a10 = A(A.mt-1, n);
-
-            int ma00 = (A.mt-1)*A.mb;
-            int na00 = plasma_tile_nmain(A, n);
-
-            int lda10 = plasma_tile_mmain(A, A.mt-1);
-            int nva10 = plasma_tile_nview(A, n);
+            for (int m = 0; m < A.mt; m++)
+                tiles[m] = A(m, n);
 
-            #pragma omp task depend (inout:a00[ma00*na00]) \
-                             depend (inout:a10[lda10*nva10])
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:ipiv[t*bs]) \
+                             depend(iterator(int t = 0:count), \
+                                    inout:tiles[t][0]) \
+                             priority(plasma_sequence_priority(sequence))
             {
-                int nvan = plasma_tile_nview(A, n);
-                plasma_desc_t view = plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
-                core_dlaswp(colrow, view, 1, A.m, ipiv, incx);
+                PLASMA_TRACE_START("dlaswp", A(0, n));
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int nvan = plasma_tile_nview(A, n);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    int retval = plasma_pdlaswp_view(colrow, view, mn,
+                                                     ipiv, incx, A.nb);
+                    if (retval != PlasmaSuccess)
+                        plasma_request_fail(sequence, request, retval);
+                }
+                PLASMA_TRACE_STOP("dlaswp", 1, A(0, n), ipiv);
             }
         }
     }
     else {
+        // Each task swaps columns across all the tiles of its tile row.
         for (int m = 0; m < A.mt; m++) {
-            int mvam = plasma_tile_mview(A, m);
-            plasma_desc_t view = plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
-            core_dlaswp(colrow, view, 1, A.n, ipiv, incx);
+            for (int n = 0; n < A.nt; n++)
+                tiles[n] = A(m, n);
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:ipiv[t*bs]) \
+                             depend(iterator(int t = 0:count), \
+                                    inout:tiles[t][0]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dlaswp", A(m, 0));
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int mvam = plasma_tile_mview(A, m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
+                    int retval = plasma_pdlaswp_view(colrow, view, mn,
+                                                     ipiv, incx, A.mb);
+                    if (retval != PlasmaSuccess)
+                        plasma_request_fail(sequence, request, retval);
+                }
+                PLASMA_TRACE_STOP("dlaswp", 1, A(m, 0), ipiv);
+            }
         }
     }
+    // The dependences are taken when the tasks are created.
+    free(tiles);
 }
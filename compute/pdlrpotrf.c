@@ -0,0 +1,87 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzlrpotrf.c, normal z -> d, Thu Oct 15 04:33:00 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define R(m, n) plasma_tile_lrank(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile low-rank Cholesky factorization of the lower triangle of a
+ *  matrix with its off-diagonal tiles compressed as U*V^T, as tagged by
+ *  plasma_tile_lrank. The tasks are those of the dense right-looking
+ *  factorization, on the same tiles, with the kernels taking the ranks
+ *  of their tiles when they run. The updates of the off-diagonal tiles
+ *  recompress them at the absolute tolerance tol.
+ * @see plasma_omp_dlrpotrf
+ ******************************************************************************/
+void plasma_pdlrpotrf(plasma_desc_t A, double tol,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    for (int k = 0; k < A.mt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        core_omp_dpotrf(
+            PlasmaLower, mvak,
+            A(k, k), ldak,
+            A.nb*k,
+            sequence, request);
+
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dlrtrsm(
+                mvam, A.mb,
+                A(k, k), ldak,
+                A(m, k), ldam, R(m, k),
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dlrsyrk(
+                mvam, A.mb,
+                A(m, k), ldam, R(m, k),
+                A(m, m), ldam,
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < m; n++) {
+                int ldan = plasma_tile_mmain(A, n);
+                core_omp_dlrgemm(
+                    mvam, A.mb, A.mb, tol,
+                    A(m, k), ldam, R(m, k),
+                    A(n, k), ldan, R(n, k),
+                    A(m, n), ldam, R(m, n),
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzungqr.c, normal z -> d, Mon Feb  6 14:06:24 2017
+ * @generated from compute/pzungqr.c, normal z -> d, Thu Oct 15 02:29:48 2026
  *
  **/
 
@@ -24,6 +24,15 @@
 
 /***************************************************************************//**
  *  Parallel construction of Q using tile V (application to identity)
+ *
+ *  Each tile column n of Q is H(0) ... H(kn) applied to the identity, with
+ *  kn = min(n, kt-1), as the reflectors of the steps past n do not touch the
+ *  columns on their left. The columns are independent chains of steps, and
+ *  step k of column n waits only for step k+1 of the same column.
+ *  The steps are submitted by wavefronts of their depth in the chain,
+ *  kn-k, so the first steps of all the columns start at once, instead of
+ *  the short columns waiting for the steps of the long ones to be
+ *  submitted. PlasmaTaskWindow counts the wavefronts.
  **/
 void plasma_pdorgqr(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     plasma_workspace_t work,
@@ -33,21 +42,33 @@ void plasma_pdorgqr(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    plasma_context_t *plasma = plasma_context_self();
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
-    for (int k = imin(A.mt, A.nt)-1; k >= 0; k--) {
-        int mvak  = plasma_tile_mview(A, k);
-        int nvak  = plasma_tile_nview(A, k);
-        int mvqk  = plasma_tile_mview(Q, k);
-        int ldak  = plasma_tile_mmain(A, k);
-        int ldqk  = plasma_tile_mmain(Q, k);
-        for (int m = Q.mt - 1; m > k; m--) {
-            int mvqm = plasma_tile_mview(Q, m);
-            int ldam = plasma_tile_mmain(A, m);
-            int ldqm = plasma_tile_mmain(Q, m);
-            for (int n = k; n < Q.nt; n++) {
-                int nvqn = plasma_tile_nview(Q, n);
+    int kt = imin(A.mt, A.nt);
+    for (int w = 0; w < kt; w++) {
+        plasma_task_window(plasma, w);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        // The long columns first, as they hold the critical path.
+        for (int n = Q.nt-1; n >= 0; n--) {
+            int k = imin(n, kt-1)-w;
+            if (k < 0)
+                continue;
+
+            int mvak = plasma_tile_mview(A, k);
+            int nvak = plasma_tile_nview(A, k);
+            int mvqk = plasma_tile_mview(Q, k);
+            int ldak = plasma_tile_mmain(A, k);
+            int ldqk = plasma_tile_mmain(Q, k);
+            int nvqn = plasma_tile_nview(Q, n);
+            for (int m = Q.mt-1; m > k; m--) {
+                int mvqm = plasma_tile_mview(Q, m);
+                int ldam = plasma_tile_mmain(A, m);
+                int ldqm = plasma_tile_mmain(Q, m);
                 core_omp_dtsmqr(
                     PlasmaLeft, PlasmaNoTrans,
                     Q.mb, nvqn, mvqm, nvqn, nvak, ib,
@@ -58,9 +79,6 @@ void plasma_pdorgqr(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     work,
                     sequence, request);
             }
-        }
-        for (int n = k; n < Q.nt; n++) {
-            int nvqn = plasma_tile_nview(Q, n);
             core_omp_dormqr(
                 PlasmaLeft, PlasmaNoTrans,
                 mvqk, nvqn, imin(nvak, mvak), ib,
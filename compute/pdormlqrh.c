@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzunmlqrh.c, normal z -> d, Mon Feb  6 14:06:25 2017
+ * @generated from compute/pzunmlqrh.c, normal z -> d, Wed Oct 14 17:34:54 2026
  *
  **/
 
@@ -39,10 +39,12 @@ void plasma_pdormlqrh(plasma_enum_t side, plasma_enum_t trans,
 
     // Precompute order of LQ operations - compute it as for QR
     // and transpose it.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
     // Transpose m and n to reuse the QR tree.
-    plasma_rh_tree_operations(A.nt, A.mt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.nt, A.mt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -222,5 +224,5 @@ void plasma_pdormlqrh(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
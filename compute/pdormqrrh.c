@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzunmqrrh.c, normal z -> d, Mon Feb  6 14:06:26 2017
+ * @generated from compute/pzunmqrrh.c, normal z -> d, Wed Oct 14 17:34:54 2026
  *
  **/
 
@@ -38,9 +38,11 @@ void plasma_pdormqrrh(plasma_enum_t side, plasma_enum_t trans,
         return;
 
     // Precompute order of QR operations.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
-    plasma_rh_tree_operations(A.mt, A.nt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.mt, A.nt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -215,5 +217,5 @@ void plasma_pdormqrrh(plasma_enum_t side, plasma_enum_t trans,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
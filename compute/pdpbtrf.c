@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzpbtrf.c, normal z -> d, Mon Feb  6 14:06:20 2017
+ * @generated from compute/pzpbtrf.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -20,6 +20,195 @@
 
 #define A(m, n) ((double*)plasma_tile_addr(A, m, n))
 
+/******************************************************************************/
+// Factors the band with one task per step for the panel, the Cholesky
+// factorization of the diagonal tile and the triangular solves of the band
+// tiles below it (right of it if upper), and one task per step and column
+// for the update of the band tiles of the column, pipelined along the band.
+// The tasks are keyed on the first tile of the tiles they touch, so the
+// tiles are synchronized with the translations by taskwaits.
+static void plasma_pdpbtrf_column(plasma_enum_t uplo, plasma_desc_t A,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    #pragma omp taskwait
+    if (uplo == PlasmaLower) {
+        //==============
+        // PlasmaLower
+        //==============
+        for (int k = 0; k < A.mt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvak  = plasma_tile_mview(A, k);
+            int ldakk = plasma_tile_mmain_band(A, k, k);
+            int klk   = imin(A.nt, k+A.klt) - (k+1);
+            int mvas  = imax(0, imin(A.m, (k+klk+1)*A.mb) - (k+1)*A.mb);
+
+            // panel, a10 is the rest of the band of column k
+            double *a00 = A(k, k);
+            double *a10 = klk > 0 ? A(k+1, k) : a00;
+            int size_a00 = A.mb*A.nb;
+            int size_a10 = klk > 0 ? klk*A.mb*A.nb : size_a00;
+            #pragma omp task depend(inout:a00[0:size_a00]) \
+                             depend(inout:a10[0:size_a10]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dpbtrf_panel", a00);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int info = core_dpotrf(PlasmaLower, mvak, a00, ldakk);
+                    if (info != 0) {
+                        plasma_request_fail(sequence, request, A.nb*k+info);
+                    }
+                    else {
+                        for (int m = k+1; m <= k+klk; m++) {
+                            core_dtrsm(
+                                PlasmaRight, PlasmaLower,
+                                PlasmaConjTrans, PlasmaNonUnit,
+                                plasma_tile_mview(A, m), mvak,
+                                1.0, a00, ldakk,
+                                     A(m, k), plasma_tile_mmain_band(A, m, k));
+                        }
+                    }
+                }
+                PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                   (double)mvak*mvak*mvak/3.0 +
+                                   (double)mvas*mvak*mvak,
+                                   (double)mvak*(mvak+1) + 2.0*mvas*mvak);
+                PLASMA_TRACE_STOP("dpbtrf_panel", 2, a00, a10);
+            }
+            // update of the band of column n, from its diagonal tile down
+            for (int n = k+1; n <= k+klk; n++) {
+                int mvan  = plasma_tile_mview(A, n);
+                int mvar  = imax(0, imin(A.m, (k+klk+1)*A.mb) - (n+1)*A.mb);
+                double *a11 = A(n, n);
+                int size_a11 = (k+klk-n+1)*A.mb*A.nb;
+                #pragma omp task depend(in:a10[0:size_a10]) \
+                                 depend(inout:a11[0:size_a11]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("dpbtrf_update", a11);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        int ldank = plasma_tile_mmain_band(A, n, k);
+                        core_dsyrk(
+                            PlasmaLower, PlasmaNoTrans,
+                            mvan, mvak,
+                            -1.0, A(n, k), ldank,
+                             1.0, a11, plasma_tile_mmain_band(A, n, n));
+                        for (int m = n+1; m <= k+klk; m++) {
+                            core_dgemm(
+                                PlasmaNoTrans, PlasmaConjTrans,
+                                plasma_tile_mview(A, m), mvan, mvak,
+                                -1.0, A(m, k), plasma_tile_mmain_band(A, m, k),
+                                      A(n, k), ldank,
+                                 1.0, A(m, n), plasma_tile_mmain_band(A, m, n));
+                        }
+                    }
+                    PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                       (double)mvan*mvan*mvak +
+                                       2.0*mvar*mvan*mvak,
+                                       (double)(mvan+mvar)*mvak +
+                                       (double)(mvan+2*mvar)*mvan);
+                    PLASMA_TRACE_STOP("dpbtrf_update", 1, a11, a10);
+                }
+            }
+        }
+    }
+    else {
+        //==============
+        // PlasmaUpper
+        //==============
+        // The tiles right of the diagonal tile of row k are in distinct
+        // columns, the tasks are keyed on the first of them, a01 of step k.
+        // The update of column m is keyed on its diagonal tile and, for all
+        // but the first column, reads a01 of step k+1 to keep its panel after.
+        for (int k = 0; k < A.nt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvak  = plasma_tile_mview(A, k);
+            int ldakk = plasma_tile_mmain_band(A, k, k);
+            int kuk   = imin(A.nt, k+A.kut) - (k+1);
+            int nvas  = imax(0, imin(A.n, (k+kuk+1)*A.nb) - (k+1)*A.nb);
+
+            // panel
+            double *a00 = A(k, k);
+            double *a01 = kuk > 0 ? A(k, k+1) : a00;
+            double *a12 = kuk > 1 ? A(k+1, k+2) : a00;
+            int size_a = A.mb*A.nb;
+            #pragma omp task depend(inout:a00[0:size_a]) \
+                             depend(inout:a01[0:size_a]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("dpbtrf_panel", a00);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int info = core_dpotrf(PlasmaUpper, mvak, a00, ldakk);
+                    if (info != 0) {
+                        plasma_request_fail(sequence, request, A.nb*k+info);
+                    }
+                    else {
+                        for (int m = k+1; m <= k+kuk; m++) {
+                            core_dtrsm(
+                                PlasmaLeft, PlasmaUpper,
+                                PlasmaConjTrans, PlasmaNonUnit,
+                                mvak, plasma_tile_nview(A, m),
+                                1.0, a00, ldakk,
+                                     A(k, m), plasma_tile_mmain_band(A, k, m));
+                        }
+                    }
+                }
+                PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                   (double)mvak*mvak*mvak/3.0 +
+                                   (double)nvas*mvak*mvak,
+                                   (double)mvak*(mvak+1) + 2.0*nvas*mvak);
+                PLASMA_TRACE_STOP("dpbtrf_panel", 2, a00, a01);
+            }
+            // update of the band of column m, from row k+1 down to its
+            // diagonal tile
+            for (int m = k+1; m <= k+kuk; m++) {
+                int nvam  = plasma_tile_nview(A, m);
+                int mvar  = (m-k-1)*A.mb;
+                double *a11 = A(m, m);
+                double *a1n = m > k+1 ? a12 : a01;
+                #pragma omp task depend(in:a01[0:size_a]) \
+                                 depend(in:a1n[0:size_a]) \
+                                 depend(inout:a11[0:size_a]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("dpbtrf_update", a11);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        int ldakm = plasma_tile_mmain_band(A, k, m);
+                        core_dsyrk(
+                            PlasmaUpper, PlasmaConjTrans,
+                            nvam, mvak,
+                            -1.0, A(k, m), ldakm,
+                             1.0, a11, plasma_tile_mmain_band(A, m, m));
+                        for (int n = k+1; n < m; n++) {
+                            core_dgemm(
+                                PlasmaConjTrans, PlasmaNoTrans,
+                                A.mb, nvam, mvak,
+                                -1.0, A(k, n), plasma_tile_mmain_band(A, k, n),
+                                      A(k, m), ldakm,
+                                 1.0, A(n, m), plasma_tile_mmain_band(A, n, m));
+                        }
+                    }
+                    PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                                       (double)nvam*nvam*mvak +
+                                       2.0*mvar*nvam*mvak,
+                                       (double)(nvam+mvar)*mvak +
+                                       (double)(nvam+2*mvar)*nvam);
+                    PLASMA_TRACE_STOP("dpbtrf_update", 1, a11, a01, a1n);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+}
+
 /***************************************************************************//**
  *  Parallel tile Cholesky factorization of a band matrix.
  * @see plasma_omp_dgbtrf
@@ -31,11 +220,23 @@ void plasma_pdpbtrf(plasma_enum_t uplo, plasma_desc_t A,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    if (plasma->update_mode == PlasmaColumnUpdate) {
+        plasma_pdpbtrf_column(uplo, A, sequence, request);
+        return;
+    }
+
     if (uplo == PlasmaLower) {
         //==============
         // PlasmaLower
         //==============
         for (int k = 0; k < A.mt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak  = plasma_tile_mview(A, k);
             int ldakk = plasma_tile_mmain_band(A, k, k);
             core_omp_dpotrf(
@@ -80,6 +281,10 @@ void plasma_pdpbtrf(plasma_enum_t uplo, plasma_desc_t A,
         // PlasmaUpper
         //==============
         for (int k = 0; k < A.nt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak  = plasma_tile_mview(A, k);
             int ldakk = plasma_tile_mmain_band(A, k, k);
             core_omp_dpotrf(
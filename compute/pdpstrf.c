@@ -0,0 +1,102 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzpstrf.c, normal z -> d, Thu Oct 15 08:37:15 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// arguments of the ranks of the team of the factorization
+typedef struct {
+    plasma_desc_t A;
+    int *piv;
+    double tol;
+    double *diag;
+    double *x;
+    plasma_panel_workspace_t *work;
+    int rank;
+} plasma_pdpstrf_team_t;
+
+/******************************************************************************/
+// Runs a rank of the team of the factorization.
+static void plasma_pdpstrf_rank(void *args, int rank, int size,
+                                plasma_barrier_t *barrier)
+{
+    plasma_pdpstrf_team_t *team = (plasma_pdpstrf_team_t*)args;
+
+    int r = core_dpstrf(team->A, team->piv, team->tol,
+                        team->diag, team->x,
+                        rank, size, team->work, barrier);
+
+    // Only rank 0 returns the rank of A.
+    if (rank == 0)
+        team->rank = r;
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization with complete pivoting, stopped at
+ *  the tolerance. The pivot search reads the whole remaining diagonal, so
+ *  the factorization waits for the tasks ahead of it, and then runs on a
+ *  team of PlasmaNumPanelThreads threads, see plasma_team_run(), which
+ *  share the tile rows of each column of L.
+ *  @see plasma_omp_dpstrf
+ ******************************************************************************/
+void plasma_pdpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    double *diag = (double*)malloc((size_t)A.n*sizeof(double));
+    double *x =
+        (double*)malloc((size_t)A.n*sizeof(double));
+    if (diag == NULL || x == NULL) {
+        free(diag);
+        free(x);
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    PLASMA_TRACE_START("dpstrf", A(0, 0));
+    plasma_pdpstrf_team_t team = { A, piv, tol, diag, x,
+                                   &plasma->panel_work, 0 };
+    if (PLASMA_TRACE_RUN(sequence))
+        plasma_team_run(plasma->panel_team, plasma->panel_bind,
+                        plasma->num_panel_threads,
+                        plasma_sequence_priority(sequence),
+                        plasma_pdpstrf_rank, &team);
+    *rank = team.rank;
+    PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                       (double)team.rank*team.rank*(A.n-2.0/3.0*team.rank),
+                       (double)A.n*team.rank);
+    PLASMA_TRACE_STOP("dpstrf", 1, A(0, 0));
+
+    free(diag);
+    free(x);
+}
@@ -0,0 +1,177 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzcgesv.c, mixed zc -> ds, Thu Oct 15 05:47:27 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ * Parallel LU factorization of As, the single precision copy of A, for the
+ * mixed precision solvers, in bfloat16 if bf16, with the infinity norm of A,
+ * for their stopping criterion, in Anorm. The factors are pivoted to the
+ * left, as the refinement needs.
+ * @see plasma_omp_dsgesv
+ ******************************************************************************/
+void plasma_pdsgetrf(plasma_desc_t A, plasma_desc_t As, int *ipiv, int bf16,
+                     double *work, double *Anorm,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    plasma_pdlange(PlasmaInfNorm, A, work, Anorm, sequence, request);
+
+    // Compute the LU factorization of As.
+    #pragma omp taskwait
+    if (bf16)
+        plasma_psbgetrf(As, ipiv, sequence, request);
+    else
+        plasma_psgetrf(As, ipiv, sequence, request);
+
+    // The refinement, also by GMRES, uses the factors pivoted to the left.
+    if (!bf16 && plasma->left_pivoting == PlasmaLeftPivotingOff)
+        plasma_psgetrf_left(As, ipiv, sequence, request);
+}
+
+/***************************************************************************//**
+ * Parallel solve of A * X = B by the factors of plasma_pdsgetrf in As and
+ * ipiv and iterative refinement in double precision, with Xs holding B in
+ * single precision on entry and Anorm the infinity norm of A. Sets iter to
+ * the number of iterations, or to -(1+itermax) if the refinement did not
+ * converge, in which case the caller solves again in double precision.
+ * @see plasma_omp_dsgesv
+ ******************************************************************************/
+void plasma_pdsgesv_refine(plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                           int bf16, const double *Anorm,
+                           plasma_desc_t B, plasma_desc_t X,
+                           plasma_desc_t Xs, plasma_desc_t R,
+                           double *work, double *Rnorm, double *Xnorm,
+                           int *iter,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    const int    itermax = 30;
+    const double bwdmax  = 1.0;
+    const double zone  =  1.0;
+    *iter = 0;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Workspaces for damax
+    double *workX = work;
+    double *workR = &work[X.mt*X.n];
+
+    double cte;
+    double eps = LAPACKE_dlamch_work('E');
+
+    // Solve the system As * Xs = Bs.
+    #pragma omp taskwait
+    plasma_pslaswp(PlasmaRowwise, Xs, ipiv, 1, sequence, request);
+
+    plasma_pstrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, As, Xs, sequence, request);
+
+    plasma_pstrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, As, Xs, sequence, request);
+
+    // Convert Xs to double precision.
+    plasma_pslag2d(Xs, X, sequence, request);
+
+    // Compute R = B - A * X and its norm.
+    plasma_pdgeresid(A, X, B, R, workR, Rnorm, sequence, request);
+
+    // Check whether the nrhs normwise backward error satisfies the
+    // stopping criterion. If yes, set iter=0 and return.
+    plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+    #pragma omp taskwait
+    {
+        cte = (*Anorm) * eps * sqrt((double)A.n) * bwdmax;
+        int flag = 1;
+        for (int n = 0; n < R.n && flag == 1; n++) {
+            if (Rnorm[n] > Xnorm[n] * cte) {
+                flag = 0;
+            }
+        }
+        if (flag == 1) {
+            *iter = 0;
+            return;
+        }
+    }
+
+    // The update of the iterate by the correction in Xs, R = Xs in double
+    // precision and X = X + R, in one pass over the tiles.
+    plasma_dpipeline_t update;
+    plasma_dpipeline_init(&update);
+    if (plasma_dpipeline_slag2d(&update, Xs, R) != PlasmaSuccess ||
+        plasma_dpipeline_geadd(&update, PlasmaNoTrans,
+                               zone, R, zone, X) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Iterative refinement
+    for (int iiter = 0; iiter < itermax; iiter++) {
+        if (plasma->refinement_mode == PlasmaGmresRefinement || bf16) {
+            // Solve the system A * D = R by GMRES preconditioned
+            // by the factors of As and update the current iterate.
+            plasma_pdsgmres(PlasmaGeneral, A, As, ipiv, R, X, Xs,
+                            plasma->gmres_restart, sequence, request);
+        }
+        else {
+            // Convert R from double to single precision, store result in Xs.
+            plasma_pdlag2s(R, Xs, sequence, request);
+
+            // Solve the system As * Xs = Rs.
+            #pragma omp taskwait
+            plasma_pslaswp(PlasmaRowwise, Xs, ipiv, 1, sequence, request);
+
+            plasma_pstrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                          1.0, As, Xs, sequence, request);
+
+            plasma_pstrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans,
+                          PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+
+            // Convert Xs back to double precision
+            // and update the current iterate.
+            plasma_pdpipeline(update, sequence, request);
+        }
+
+        // Compute R = B - A * X and its norm.
+        plasma_pdgeresid(A, X, B, R, workR, Rnorm, sequence, request);
+
+        // Check whether nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter = iiter > 0 and return
+        plasma_pdamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        #pragma omp taskwait
+        {
+            int flag = 1;
+            for (int n = 0; n < R.n && flag == 1; n++) {
+                if (Rnorm[n] > Xnorm[n] * cte) {
+                    flag = 0;
+                }
+            }
+            if (flag == 1) {
+                *iter = iiter+1;
+                return;
+            }
+        }
+    }
+
+
+    // The refinement did not converge in itermax iterations.
+    *iter = -itermax - 1;
+}
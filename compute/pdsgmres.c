@@ -0,0 +1,313 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzcgmres.c, mixed zc -> ds, Wed Oct 14 18:15:50 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define V(k) plasma_desc_view(V, 0, (k)*sb, n, s)
+#define Z(k) plasma_desc_view(Z, 0, (k)*sb, n, s)
+#define H(k) plasma_desc_view(H, 0, (k)*sb, s, s)
+
+/******************************************************************************/
+// Returns the address of the element (i, j) of the tile matrix H.
+static double *plasma_dsgmres_elem(plasma_desc_t H, int i, int j)
+{
+    double *h =
+        (double*)plasma_tile_addr(H, i/H.mb, j/H.nb);
+    int ldh = plasma_tile_mmain(H, i/H.mb);
+    return &h[i%H.mb + (size_t)ldh*(j%H.nb)];
+}
+
+/******************************************************************************/
+// Sets the square tile matrix H to the diagonal matrix of the entries of d.
+static void plasma_dsgmres_diag(plasma_desc_t H, const double *d)
+{
+    for (int j = 0; j < H.n; j++)
+        for (int i = 0; i < H.m; i++)
+            *plasma_dsgmres_elem(H, i, j) = i == j ? d[i] : 0.0;
+}
+
+/******************************************************************************/
+// Computes the plane rotation of cosine c and sine s that zeroes b in (a, b)
+// and returns the rotated a.
+static double plasma_dsgmres_rotg(double a,
+                                              double b,
+                                              double *c, double *s)
+{
+    double absa = fabs(a);
+    if (absa == 0.0) {
+        *c = 0.0;
+        *s = 1.0;
+        return b;
+    }
+    double nrm = hypot(absa, fabs(b));
+    double alpha = a/absa;
+    *c = absa/nrm;
+    *s = alpha*(b)/nrm;
+    return alpha*nrm;
+}
+
+/******************************************************************************/
+// Computes Z = M^{-1} V with the single precision factors in As, the LU
+// factors with the pivots ipiv when uplo is PlasmaGeneral, the Cholesky
+// factor in the uplo triangle otherwise. Xs is the workspace.
+static void plasma_pdsgmres_precond(plasma_enum_t uplo,
+                                    plasma_desc_t As, int *ipiv,
+                                    plasma_desc_t V, plasma_desc_t Z,
+                                    plasma_desc_t Xs,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    plasma_pdlag2s(V, Xs, sequence, request);
+    if (uplo == PlasmaGeneral) {
+        #pragma omp taskwait
+        plasma_pslaswp(PlasmaRowwise, Xs, ipiv, 1, sequence, request);
+
+        plasma_pstrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                      1.0, As, Xs, sequence, request);
+
+        plasma_pstrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                      1.0, As, Xs, sequence, request);
+    }
+    else {
+        plasma_pstrsm(PlasmaLeft, uplo,
+                      uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans,
+                      PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+        plasma_pstrsm(PlasmaLeft, uplo,
+                      uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans,
+                      PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+    }
+    plasma_pslag2d(Xs, Z, sequence, request);
+}
+
+/***************************************************************************//**
+ * Parallel tile solution of A * D = R by restarted GMRES, right preconditioned
+ * by the single precision factorization in As, followed by X = X + D.
+ * The iterations use the flexible variant, which keeps the preconditioned
+ * vectors, as the preconditioner is only applied in single precision.
+ * Each column of R has its own Krylov space; the orthogonalization is
+ * classical Gram-Schmidt with reorthogonalization, done for all the columns
+ * at once by products with diagonal matrices. Stops when the residual norm
+ * of every column is reduced by the tolerance, or after restart iterations.
+ * uplo is PlasmaGeneral for the LU factors, otherwise the triangle
+ * of the Cholesky factor, and A is then symmetric. R is overwritten.
+ * @see plasma_omp_dsgesv
+ * @see plasma_omp_dsposv
+ ******************************************************************************/
+void plasma_pdsgmres(plasma_enum_t uplo,
+                     plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                     plasma_desc_t R, plasma_desc_t X, plasma_desc_t Xs,
+                     int restart,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // reduction of the residual norms at which the iterations stop
+    const double tol = 1e-6;
+
+    int n = R.m;
+    int s = R.n;
+    int sb = (s+R.nb-1)/R.nb*R.nb;
+
+    // Allocate the Krylov basis, the preconditioned basis
+    // and the diagonal matrices of the coefficients.
+    plasma_desc_t V;
+    plasma_desc_t Z;
+    plasma_desc_t H;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, R.mb, R.nb,
+                                        n, (restart+1)*sb, 0, 0,
+                                        n, (restart+1)*sb, &V);
+    if (retval != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, R.mb, R.nb,
+                                        n, restart*sb, 0, 0,
+                                        n, restart*sb, &Z);
+    if (retval != PlasmaSuccess) {
+        plasma_desc_destroy(&V);
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+    retval = plasma_desc_general_create(PlasmaRealDouble, R.nb, R.nb,
+                                        s, (restart+1)*sb, 0, 0,
+                                        s, (restart+1)*sb, &H);
+    if (retval != PlasmaSuccess) {
+        plasma_desc_destroy(&V);
+        plasma_desc_destroy(&Z);
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+
+    // Allocate the rotated Hessenberg matrices, the rotations,
+    // the right-hand sides of the least squares problems and their solutions.
+    double *T = (double*)calloc(
+        (size_t)s*restart*restart + (size_t)s*restart +
+        (size_t)s*(restart+1)*2 + (size_t)s*restart + s,
+        sizeof(double));
+    double *work = (double*)malloc(((size_t)s*restart + s)*sizeof(double));
+    int *iwork = (int*)malloc((size_t)2*s*sizeof(int));
+    if (T == NULL || work == NULL || iwork == NULL) {
+        free(T);
+        free(work);
+        free(iwork);
+        plasma_desc_destroy(&V);
+        plasma_desc_destroy(&Z);
+        plasma_desc_destroy(&H);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    double *sn = &T[(size_t)s*restart*restart];
+    double *g  = &sn[(size_t)s*restart];
+    double *h  = &g[(size_t)s*(restart+1)];
+    double *y  = &h[(size_t)s*(restart+1)];
+    double *d  = &y[(size_t)s*restart];
+    double *cs    = work;
+    double *rnorm = &work[(size_t)s*restart];
+    int *steps  = iwork;
+    int *active = &iwork[s];
+
+    // V_0 = R / ||R||
+    plasma_pdgemm(PlasmaConjTrans, PlasmaNoTrans,
+                  1.0, R, R, 0.0, H(0), sequence, request);
+    #pragma omp taskwait
+    int nactive = 0;
+    for (int c = 0; c < s; c++) {
+        rnorm[c] = sqrt(fabs(*plasma_dsgmres_elem(H, c, c)));
+        g[c*(restart+1)] = rnorm[c];
+        steps[c] = 0;
+        active[c] = rnorm[c] > 0.0;
+        nactive += active[c];
+        d[c] = active[c] ? 1.0/rnorm[c] : 0.0;
+    }
+    plasma_dsgmres_diag(H(0), d);
+    plasma_pdgemm(PlasmaNoTrans, PlasmaNoTrans,
+                  1.0, R, H(0), 0.0, V(0), sequence, request);
+
+    for (int k = 0; k < restart && nactive > 0; k++) {
+        // Z_k = M^{-1} V_k, R = A Z_k
+        plasma_pdsgmres_precond(uplo, As, ipiv, V(k), Z(k), Xs,
+                                sequence, request);
+        if (uplo == PlasmaGeneral)
+            plasma_pdgemm(PlasmaNoTrans, PlasmaNoTrans,
+                          1.0, A, Z(k), 0.0, R, sequence, request);
+        else
+            plasma_pdsymm(PlasmaLeft, uplo,
+                          1.0, A, Z(k), 0.0, R, sequence, request);
+
+        // Orthogonalize R against V_0, ..., V_k, twice.
+        for (int i = 0; i < s*(restart+1); i++)
+            h[i] = 0.0;
+        for (int pass = 0; pass < 2; pass++) {
+            for (int i = 0; i <= k; i++)
+                plasma_pdgemm(PlasmaConjTrans, PlasmaNoTrans,
+                              1.0, V(i), R, 0.0, H(i), sequence, request);
+            #pragma omp taskwait
+            for (int i = 0; i <= k; i++) {
+                for (int c = 0; c < s; c++) {
+                    d[c] = *plasma_dsgmres_elem(H(i), c, c);
+                    h[c*(restart+1)+i] += d[c];
+                }
+                plasma_dsgmres_diag(H(i), d);
+                plasma_pdgemm(PlasmaNoTrans, PlasmaNoTrans,
+                              -1.0, V(i), H(i), 1.0, R, sequence, request);
+            }
+        }
+        plasma_pdgemm(PlasmaConjTrans, PlasmaNoTrans,
+                      1.0, R, R, 0.0, H(k+1), sequence, request);
+        #pragma omp taskwait
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        // Update the least squares problems of the active columns.
+        for (int c = 0; c < s; c++) {
+            double hnorm = sqrt(fabs(*plasma_dsgmres_elem(H(k+1), c, c)));
+            d[c] = hnorm > 0.0 ? 1.0/hnorm : 0.0;
+            if (!active[c])
+                continue;
+
+            double *hc = &h[c*(restart+1)];
+            double *gc = &g[c*(restart+1)];
+            hc[k+1] = hnorm;
+            for (int i = 0; i < k; i++) {
+                double ci = cs[c*restart+i];
+                double si = sn[c*restart+i];
+                double t = ci*hc[i] + si*hc[i+1];
+                hc[i+1] = -(si)*hc[i] + ci*hc[i+1];
+                hc[i] = t;
+            }
+            hc[k] = plasma_dsgmres_rotg(hc[k], hc[k+1],
+                                        &cs[c*restart+k], &sn[c*restart+k]);
+            if (hc[k] == 0.0) {
+                // The Krylov space of this column stopped growing.
+                active[c] = 0;
+                nactive--;
+                continue;
+            }
+            gc[k+1] = -(sn[c*restart+k])*gc[k];
+            gc[k] = cs[c*restart+k]*gc[k];
+            for (int i = 0; i <= k; i++)
+                T[(size_t)c*restart*restart + k*restart + i] = hc[i];
+            steps[c] = k+1;
+            if (fabs(gc[k+1]) <= tol*rnorm[c]) {
+                active[c] = 0;
+                nactive--;
+            }
+        }
+
+        // V_{k+1} = R / ||R||
+        if (nactive > 0 && k+1 < restart) {
+            plasma_dsgmres_diag(H(k+1), d);
+            plasma_pdgemm(PlasmaNoTrans, PlasmaNoTrans,
+                          1.0, R, H(k+1), 0.0, V(k+1), sequence, request);
+        }
+    }
+
+    // Solve the triangular systems and update X = X + Z y.
+    int kmax = 0;
+    for (int c = 0; c < s; c++) {
+        double *Tc = &T[(size_t)c*restart*restart];
+        double *yc = &y[c*restart];
+        for (int i = steps[c]-1; i >= 0; i--) {
+            double t = g[c*(restart+1)+i];
+            for (int j = i+1; j < steps[c]; j++)
+                t -= Tc[j*restart+i]*yc[j];
+            yc[i] = t/Tc[i*restart+i];
+        }
+        kmax = imax(kmax, steps[c]);
+    }
+    #pragma omp taskwait
+    for (int i = 0; i < kmax; i++) {
+        for (int c = 0; c < s; c++)
+            d[c] = i < steps[c] ? y[c*restart+i] : 0.0;
+        plasma_dsgmres_diag(H(i), d);
+        plasma_pdgemm(PlasmaNoTrans, PlasmaNoTrans,
+                      1.0, Z(i), H(i), 1.0, X, sequence, request);
+    }
+    #pragma omp taskwait
+
+    free(T);
+    free(work);
+    free(iwork);
+    plasma_desc_destroy(&V);
+    plasma_desc_destroy(&Z);
+    plasma_desc_destroy(&H);
+}
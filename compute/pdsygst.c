@@ -0,0 +1,438 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzhegst.c, normal z -> d, Thu Oct 15 08:31:46 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define B(m, n) (double*)plasma_tile_addr(B, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile reduction of a symmetric-definite generalized eigenproblem
+ *  to standard form, by the blocked algorithm of LAPACK dsygst on tiles.
+ *  Step k only reads the tiles of B of columns (rows) up to k, and for
+ *  itype = 1 the solve with the trailing factor, the tiles beyond, one by
+ *  one, so that the steps start as soon as the tiles of the factor that
+ *  they read are done by a preceding plasma_pdpotrf of B.
+ *  @see plasma_omp_dsygst
+ ******************************************************************************/
+void plasma_pdsygst(int itype, plasma_enum_t uplo,
+                    plasma_desc_t A, plasma_desc_t B,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (itype == 1) {
+        //=========================================
+        // itype 1 / PlasmaLower: inv(L)*A*inv(L^T)
+        //=========================================
+        if (uplo == PlasmaLower) {
+            for (int k = 0; k < A.nt; k++) {
+                int nvak = plasma_tile_nview(A, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldbk = plasma_tile_mmain(B, k);
+                core_omp_dsygst(
+                    itype, uplo,
+                    nvak,
+                    A(k, k), ldak,
+                    B(k, k), ldbk,
+                    sequence, request);
+
+                for (int m = k+1; m < A.mt; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dtrsm(
+                        PlasmaRight, uplo, PlasmaConjTrans, PlasmaNonUnit,
+                        mvam, nvak,
+                        1.0, B(k, k), ldbk,
+                             A(m, k), ldam,
+                        sequence, request);
+                    core_omp_dsymm(
+                        PlasmaRight, uplo,
+                        mvam, nvak,
+                        -0.5, A(k, k), ldak,
+                              B(m, k), ldbm,
+                        1.0,  A(m, k), ldam,
+                        sequence, request);
+                }
+                // A22 -= A21*B21^T + B21*A21^T
+                for (int m = k+1; m < A.mt; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dsyr2k(
+                        uplo, PlasmaNoTrans,
+                        mvam, nvak,
+                        -1.0, A(m, k), ldam,
+                              B(m, k), ldbm,
+                        1.0,  A(m, m), ldam,
+                        sequence, request);
+                    for (int n = k+1; n < m; n++) {
+                        int nvan = plasma_tile_nview(A, n);
+                        int ldan = plasma_tile_mmain(A, n);
+                        int ldbn = plasma_tile_mmain(B, n);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaConjTrans,
+                            mvam, nvan, nvak,
+                            -1.0, A(m, k), ldam,
+                                  B(n, k), ldbn,
+                            1.0,  A(m, n), ldam,
+                            sequence, request);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaConjTrans,
+                            mvam, nvan, nvak,
+                            -1.0, B(m, k), ldbm,
+                                  A(n, k), ldan,
+                            1.0,  A(m, n), ldam,
+                            sequence, request);
+                    }
+                }
+                for (int m = k+1; m < A.mt; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dsymm(
+                        PlasmaRight, uplo,
+                        mvam, nvak,
+                        -0.5, A(k, k), ldak,
+                              B(m, k), ldbm,
+                        1.0,  A(m, k), ldam,
+                        sequence, request);
+                }
+                // A21 = inv(L22)*A21
+                for (int m = k+1; m < A.mt; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dtrsm(
+                        PlasmaLeft, uplo, PlasmaNoTrans, PlasmaNonUnit,
+                        mvam, nvak,
+                        1.0, B(m, m), ldbm,
+                             A(m, k), ldam,
+                        sequence, request);
+                    for (int i = m+1; i < A.mt; i++) {
+                        int mvai = plasma_tile_mview(A, i);
+                        int ldai = plasma_tile_mmain(A, i);
+                        int ldbi = plasma_tile_mmain(B, i);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaNoTrans,
+                            mvai, nvak, mvam,
+                            -1.0, B(i, m), ldbi,
+                                  A(m, k), ldam,
+                            1.0,  A(i, k), ldai,
+                            sequence, request);
+                    }
+                }
+            }
+        }
+        //=========================================
+        // itype 1 / PlasmaUpper: inv(U^T)*A*inv(U)
+        //=========================================
+        else {
+            for (int k = 0; k < A.mt; k++) {
+                int mvak = plasma_tile_mview(A, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldbk = plasma_tile_mmain(B, k);
+                core_omp_dsygst(
+                    itype, uplo,
+                    mvak,
+                    A(k, k), ldak,
+                    B(k, k), ldbk,
+                    sequence, request);
+
+                for (int n = k+1; n < A.nt; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_dtrsm(
+                        PlasmaLeft, uplo, PlasmaConjTrans, PlasmaNonUnit,
+                        mvak, nvan,
+                        1.0, B(k, k), ldbk,
+                             A(k, n), ldak,
+                        sequence, request);
+                    core_omp_dsymm(
+                        PlasmaLeft, uplo,
+                        mvak, nvan,
+                        -0.5, A(k, k), ldak,
+                              B(k, n), ldbk,
+                        1.0,  A(k, n), ldak,
+                        sequence, request);
+                }
+                // A22 -= A12^T*B12 + B12^T*A12
+                for (int n = k+1; n < A.nt; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_dsyr2k(
+                        uplo, PlasmaConjTrans,
+                        nvan, mvak,
+                        -1.0, A(k, n), ldak,
+                              B(k, n), ldbk,
+                        1.0,  A(n, n), ldan,
+                        sequence, request);
+                    for (int m = k+1; m < n; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        int ldam = plasma_tile_mmain(A, m);
+                        core_omp_dgemm(
+                            PlasmaConjTrans, PlasmaNoTrans,
+                            mvam, nvan, mvak,
+                            -1.0, A(k, m), ldak,
+                                  B(k, n), ldbk,
+                            1.0,  A(m, n), ldam,
+                            sequence, request);
+                        core_omp_dgemm(
+                            PlasmaConjTrans, PlasmaNoTrans,
+                            mvam, nvan, mvak,
+                            -1.0, B(k, m), ldbk,
+                                  A(k, n), ldak,
+                            1.0,  A(m, n), ldam,
+                            sequence, request);
+                    }
+                }
+                for (int n = k+1; n < A.nt; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_dsymm(
+                        PlasmaLeft, uplo,
+                        mvak, nvan,
+                        -0.5, A(k, k), ldak,
+                              B(k, n), ldbk,
+                        1.0,  A(k, n), ldak,
+                        sequence, request);
+                }
+                // A12 = A12*inv(U22)
+                for (int n = k+1; n < A.nt; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    int ldbn = plasma_tile_mmain(B, n);
+                    core_omp_dtrsm(
+                        PlasmaRight, uplo, PlasmaNoTrans, PlasmaNonUnit,
+                        mvak, nvan,
+                        1.0, B(n, n), ldbn,
+                             A(k, n), ldak,
+                        sequence, request);
+                    for (int j = n+1; j < A.nt; j++) {
+                        int nvaj = plasma_tile_nview(A, j);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaNoTrans,
+                            mvak, nvaj, nvan,
+                            -1.0, A(k, n), ldak,
+                                  B(n, j), ldbn,
+                            1.0,  A(k, j), ldak,
+                            sequence, request);
+                    }
+                }
+            }
+        }
+    }
+    else {
+        //===================================
+        // itype 2 or 3 / PlasmaLower: L^T*A*L
+        //===================================
+        if (uplo == PlasmaLower) {
+            for (int k = 0; k < A.nt; k++) {
+                int mvak = plasma_tile_mview(A, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldbk = plasma_tile_mmain(B, k);
+
+                // A(k, 0:k-1) = A(k, 0:k-1)*L(0:k-1, 0:k-1)
+                for (int n = 0; n < k; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    int ldbn = plasma_tile_mmain(B, n);
+                    core_omp_dtrmm(
+                        PlasmaRight, uplo, PlasmaNoTrans, PlasmaNonUnit,
+                        mvak, nvan,
+                        1.0, B(n, n), ldbn,
+                             A(k, n), ldak,
+                        sequence, request);
+                    for (int j = n+1; j < k; j++) {
+                        int nvaj = plasma_tile_nview(A, j);
+                        int ldbj = plasma_tile_mmain(B, j);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaNoTrans,
+                            mvak, nvan, nvaj,
+                            1.0, A(k, j), ldak,
+                                 B(j, n), ldbj,
+                            1.0, A(k, n), ldak,
+                            sequence, request);
+                    }
+                }
+                for (int n = 0; n < k; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_dsymm(
+                        PlasmaLeft, uplo,
+                        mvak, nvan,
+                        0.5, A(k, k), ldak,
+                             B(k, n), ldbk,
+                        1.0, A(k, n), ldak,
+                        sequence, request);
+                }
+                // A(0:k-1, 0:k-1) += A(k, 0:k-1)^T*B(k, 0:k-1) + B^T*A
+                for (int m = 0; m < k; m++) {
+                    int nvam = plasma_tile_nview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    core_omp_dsyr2k(
+                        uplo, PlasmaConjTrans,
+                        nvam, mvak,
+                        1.0, A(k, m), ldak,
+                             B(k, m), ldbk,
+                        1.0, A(m, m), ldam,
+                        sequence, request);
+                    for (int n = 0; n < m; n++) {
+                        int nvan = plasma_tile_nview(A, n);
+                        core_omp_dgemm(
+                            PlasmaConjTrans, PlasmaNoTrans,
+                            nvam, nvan, mvak,
+                            1.0, A(k, m), ldak,
+                                 B(k, n), ldbk,
+                            1.0, A(m, n), ldam,
+                            sequence, request);
+                        core_omp_dgemm(
+                            PlasmaConjTrans, PlasmaNoTrans,
+                            nvam, nvan, mvak,
+                            1.0, B(k, m), ldbk,
+                                 A(k, n), ldak,
+                            1.0, A(m, n), ldam,
+                            sequence, request);
+                    }
+                }
+                for (int n = 0; n < k; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_dsymm(
+                        PlasmaLeft, uplo,
+                        mvak, nvan,
+                        0.5, A(k, k), ldak,
+                             B(k, n), ldbk,
+                        1.0, A(k, n), ldak,
+                        sequence, request);
+                    core_omp_dtrmm(
+                        PlasmaLeft, uplo, PlasmaConjTrans, PlasmaNonUnit,
+                        mvak, nvan,
+                        1.0, B(k, k), ldbk,
+                             A(k, n), ldak,
+                        sequence, request);
+                }
+                core_omp_dsygst(
+                    itype, uplo,
+                    mvak,
+                    A(k, k), ldak,
+                    B(k, k), ldbk,
+                    sequence, request);
+            }
+        }
+        //===================================
+        // itype 2 or 3 / PlasmaUpper: U*A*U^T
+        //===================================
+        else {
+            for (int k = 0; k < A.nt; k++) {
+                int nvak = plasma_tile_nview(A, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldbk = plasma_tile_mmain(B, k);
+
+                // A(0:k-1, k) = U(0:k-1, 0:k-1)*A(0:k-1, k)
+                for (int m = 0; m < k; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dtrmm(
+                        PlasmaLeft, uplo, PlasmaNoTrans, PlasmaNonUnit,
+                        mvam, nvak,
+                        1.0, B(m, m), ldbm,
+                             A(m, k), ldam,
+                        sequence, request);
+                    for (int j = m+1; j < k; j++) {
+                        int mvaj = plasma_tile_mview(A, j);
+                        int ldaj = plasma_tile_mmain(A, j);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaNoTrans,
+                            mvam, nvak, mvaj,
+                            1.0, B(m, j), ldbm,
+                                 A(j, k), ldaj,
+                            1.0, A(m, k), ldam,
+                            sequence, request);
+                    }
+                }
+                for (int m = 0; m < k; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dsymm(
+                        PlasmaRight, uplo,
+                        mvam, nvak,
+                        0.5, A(k, k), ldak,
+                             B(m, k), ldbm,
+                        1.0, A(m, k), ldam,
+                        sequence, request);
+                }
+                // A(0:k-1, 0:k-1) += A(0:k-1, k)*B(0:k-1, k)^T + B*A^T
+                for (int n = 0; n < k; n++) {
+                    int mvan = plasma_tile_mview(A, n);
+                    int ldan = plasma_tile_mmain(A, n);
+                    int ldbn = plasma_tile_mmain(B, n);
+                    core_omp_dsyr2k(
+                        uplo, PlasmaNoTrans,
+                        mvan, nvak,
+                        1.0, A(n, k), ldan,
+                             B(n, k), ldbn,
+                        1.0, A(n, n), ldan,
+                        sequence, request);
+                    for (int m = 0; m < n; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        int ldam = plasma_tile_mmain(A, m);
+                        int ldbm = plasma_tile_mmain(B, m);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaConjTrans,
+                            mvam, mvan, nvak,
+                            1.0, A(m, k), ldam,
+                                 B(n, k), ldbn,
+                            1.0, A(m, n), ldam,
+                            sequence, request);
+                        core_omp_dgemm(
+                            PlasmaNoTrans, PlasmaConjTrans,
+                            mvam, mvan, nvak,
+                            1.0, B(m, k), ldbm,
+                                 A(n, k), ldan,
+                            1.0, A(m, n), ldam,
+                            sequence, request);
+                    }
+                }
+                for (int m = 0; m < k; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    int ldbm = plasma_tile_mmain(B, m);
+                    core_omp_dsymm(
+                        PlasmaRight, uplo,
+                        mvam, nvak,
+                        0.5, A(k, k), ldak,
+                             B(m, k), ldbm,
+                        1.0, A(m, k), ldam,
+                        sequence, request);
+                    core_omp_dtrmm(
+                        PlasmaRight, uplo, PlasmaConjTrans, PlasmaNonUnit,
+                        mvam, nvak,
+                        1.0, B(k, k), ldbk,
+                             A(m, k), ldam,
+                        sequence, request);
+                }
+                core_omp_dsygst(
+                    itype, uplo,
+                    nvak,
+                    A(k, k), ldak,
+                    B(k, k), ldbk,
+                    sequence, request);
+            }
+        }
+    }
+}
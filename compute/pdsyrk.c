@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzsyrk.c, normal z -> d, Mon Feb  6 14:06:21 2017
+ * @generated from compute/pzsyrk.c, normal z -> d, Thu Oct 15 03:41:41 2026
  *
  **/
 
@@ -34,6 +34,10 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // The updates after the one scaling C by beta accumulate into C
+    // in any order with commutative updates.
+    int commute = plasma_commute_updates(plasma_context_self());
+
     for (int n = 0; n < C.nt; n++) {
         int nvcn = plasma_tile_nview(C, n);
         int ldan = plasma_tile_mmain(A, n);
@@ -45,7 +49,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
             for (int k = 0; k < A.nt; k++) {
                 int nvak = plasma_tile_nview(A, k);
                 double zbeta = k == 0 ? beta : 1.0;
-                core_omp_dsyrk(
+                (commute && (k > 0 || beta == 1.0) ?
+                 core_omp_dsyrk_commute : core_omp_dsyrk)(
                     uplo, trans,
                     nvcn, nvak,
                     alpha, A(n, k), ldan,
@@ -63,7 +68,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                     for (int k = 0; k < A.nt; k++) {
                         int nvak = plasma_tile_nview(A, k);
                         double zbeta = k == 0 ? beta : 1.0;
-                        core_omp_dgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_dgemm_commute : core_omp_dgemm)(
                             trans, PlasmaTrans,
                             mvcm, nvcn, nvak,
                             alpha, A(m, k), ldam,
@@ -83,7 +89,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                     for (int k = 0; k < A.nt; k++) {
                         int nvak = plasma_tile_nview(A, k);
                         double zbeta = k == 0 ? beta : 1.0;
-                        core_omp_dgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_dgemm_commute : core_omp_dgemm)(
                             trans, PlasmaTrans,
                             nvcn, mvcm, nvak,
                             alpha, A(n, k), ldan,
@@ -102,7 +109,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 int mvak = plasma_tile_mview(A, k);
                 int ldak = plasma_tile_mmain(A, k);
                 double zbeta = k == 0 ? beta : 1.0;
-                core_omp_dsyrk(
+                (commute && (k > 0 || beta == 1.0) ?
+                 core_omp_dsyrk_commute : core_omp_dsyrk)(
                     uplo, trans,
                     nvcn, mvak,
                     alpha, A(k, n), ldak,
@@ -120,7 +128,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                         int mvak = plasma_tile_mview(A, k);
                         int ldak = plasma_tile_mmain(A, k);
                         double zbeta = k == 0 ? beta : 1.0;
-                        core_omp_dgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_dgemm_commute : core_omp_dgemm)(
                             trans, PlasmaNoTrans,
                             mvcm, nvcn, mvak,
                             alpha, A(k, m), ldak,
@@ -140,7 +149,8 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                         int mvak = plasma_tile_mview(A, k);
                         int ldak = plasma_tile_mmain(A, k);
                         double zbeta = k == 0 ? beta : 1.0;
-                        core_omp_dgemm(
+                        (commute && (k > 0 || beta == 1.0) ?
+                         core_omp_dgemm_commute : core_omp_dgemm)(
                             trans, PlasmaNoTrans,
                             nvcn, mvcm, mvak,
                             alpha, A(k, n), ldak,
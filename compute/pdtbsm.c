@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pztbsm.c, normal z -> d, Mon Feb  6 14:06:21 2017
+ * @generated from compute/pztbsm.c, normal z -> d, Thu Oct 15 10:22:55 2026
  *
  **/
 
@@ -21,6 +21,71 @@
 #define A(m,n) (double*)plasma_tile_addr(A, m, n)
 #define B(m,n) (double*)plasma_tile_addr(B, m, n)
 
+/******************************************************************************/
+// Tiles of column n of B touched by step k of a band solve with row swaps:
+// the diagonal row k, the klk rows below but the last one, and the last row,
+// which is not contiguous with the others if it is partial. The tiles not
+// touched alias the diagonal row. The diagonal row and the rows below are
+// tracked apart, to chain the steps on a column.
+static void plasma_pdtbsm_band_tiles(plasma_desc_t B, int k, int klk, int n,
+                                     double **b01, int *size_b01,
+                                     double **b11, int *size_b11,
+                                     double **b21, int *size_b21)
+{
+    int nbn = plasma_tile_nmain(B, n);
+    *b01 = B(k, n);
+    *size_b01 = plasma_tile_mmain(B, k)*nbn;
+    int m11 = imin(k+klk, B.mt-2) - k;
+    *b11 = m11 > 0 ? B(k+1, n) : *b01;
+    *size_b11 = m11 > 0 ? m11*B.mb*nbn : *size_b01;
+    *b21 = k+klk == B.mt-1 && k < B.mt-1 ? B(B.mt-1, n) : *b01;
+    *size_b21 = k+klk == B.mt-1 && k < B.mt-1 ?
+                plasma_tile_mmain(B, B.mt-1)*nbn : *size_b01;
+}
+
+/******************************************************************************/
+// The steps of a band solve with row swaps on column n of B only depend on
+// the first tiles they touch, see plasma_pdtbsm_band_tiles(). Before the
+// forward steps, gathers the tiles of the column on its first tile, so that
+// the first steps follow the tasks writing the tiles they swap.
+static void plasma_pdtbsm_band_gather(plasma_desc_t B, int n)
+{
+    int nbn = plasma_tile_nmain(B, n);
+    double *b0 = B(0, n);
+    int size_b0 = plasma_tile_mmain(B, 0)*nbn;
+    for (int m = 1; m < B.mt; m++) {
+        double *bm = B(m, n);
+        int size_bm = plasma_tile_mmain(B, m)*nbn;
+        #pragma omp task depend(in:bm[0:size_bm]) \
+                         depend(inout:b0[0:size_b0])
+        {
+            (void)b0;
+            (void)bm;
+        }
+    }
+}
+
+/******************************************************************************/
+// After the backward steps, scatters the first tile of column n of B, last
+// written, to the others, so that the tasks reading a tile follow the steps
+// swapping rows of it.
+static void plasma_pdtbsm_band_scatter(plasma_desc_t B, int n)
+{
+    int nbn = plasma_tile_nmain(B, n);
+    double *b0 = B(0, n);
+    int size_b0 = plasma_tile_mmain(B, 0)*nbn;
+    for (int m = 1; m < B.mt; m++) {
+        double *bm = B(m, n);
+        int size_bm = plasma_tile_mmain(B, m)*nbn;
+        #pragma omp task depend(in:b0[0:size_b0]) \
+                         depend(inout:bm[0:size_bm])
+        {
+            (void)b0;
+            (void)bm;
+        }
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile triangular solve - dynamic scheduling
  **/
@@ -35,6 +100,8 @@ void plasma_pdtbsm(plasma_enum_t side, plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    int priority = plasma_sequence_priority(sequence);
+
     if (side == PlasmaLeft) {
         if (uplo == PlasmaUpper) {
             if (trans == PlasmaNoTrans) {
@@ -112,24 +179,78 @@ void plasma_pdtbsm(plasma_enum_t side, plasma_enum_t uplo,
                 // ==========================================
                 // PlasmaLeft / PlasmaLower / PlasmaNoTrans
                 // ==========================================
+                if (ipiv != NULL)
+                    for (int n = 0; n < B.nt; n++)
+                        plasma_pdtbsm_band_gather(B, n);
+
                 for (int k = 0; k < B.mt; k++) {
                     int mvbk = plasma_tile_mview(B, k);
                     int ldak = plasma_tile_mmain_band(A, k, k);
                     int ldbk = plasma_tile_mmain(B, k);
                     double lalpha = k == 0 ? alpha : 1.0;
-                    for (int n = 0; n < B.nt; n++) {
-                        int nvbn = plasma_tile_nview(B, n);
-                        if (ipiv != NULL) {
-                            plasma_desc_t view = plasma_desc_view(B,
-                                                                  0, n*A.nb,
-                                                                  A.m, nvbn);
-                            view.type = PlasmaGeneral;
-                            // TODO: nested parallelization like getrf
-                            #pragma omp taskwait
-                            if (sequence->status == PlasmaSuccess) {
-                                core_dlaswp(PlasmaRowwise, view, k*A.nb+1, k*A.nb+mvbk, ipiv, 1);
+                    if (ipiv != NULL) {
+                        // The row swaps of step k mix the tile rows k to
+                        // k+klt-1, so each column of B is solved by a chain
+                        // of tasks, one per step, with nested updates.
+                        int klk = imin(k+A.klt, A.mt) - (k+1);
+                        int nak = plasma_tile_nmain(A, k);
+                        double *a00 = A(k, k);
+                        double *a20 = klk > 0 ? A(k+1, k) : a00;
+                        int size_a00 = ldak*nak;
+                        int size_a20 = klk > 0 ? klk*A.mb*nak : size_a00;
+                        for (int n = 0; n < B.nt; n++) {
+                            int nvbn = plasma_tile_nview(B, n);
+                            double *b01, *b11, *b21;
+                            int size_b01, size_b11, size_b21;
+                            plasma_pdtbsm_band_tiles(B, k, klk, n,
+                                                    &b01, &size_b01,
+                                                    &b11, &size_b11,
+                                                    &b21, &size_b21);
+                            #pragma omp task depend(in:a00[0:size_a00]) \
+                                             depend(in:a20[0:size_a20]) \
+                                             depend(in:ipiv[k*A.mb:mvbk]) \
+                                             depend(inout:b01[0:size_b01]) \
+                                             depend(inout:b11[0:size_b11]) \
+                                             depend(inout:b21[0:size_b21]) \
+                                             priority(priority)
+                            {
+                                // The panel below only orders the step.
+                                (void)a20;
+                                if (sequence->status == PlasmaSuccess) {
+                                    plasma_desc_t view =
+                                        plasma_desc_view(B, 0, n*B.nb,
+                                                         B.m, nvbn);
+                                    view.type = PlasmaGeneral;
+                                    core_dlaswp(PlasmaRowwise, view,
+                                                k*A.nb+1, k*A.nb+mvbk,
+                                                ipiv, 1);
+                                    core_dtrsm(side, uplo, trans, diag,
+                                               mvbk, nvbn,
+                                               lalpha, A(k, k), ldak,
+                                                       B(k, n), ldbk);
+                                    for (int m = k+1; m <= k+klk; m++) {
+                                        int mvbm = plasma_tile_mview(B, m);
+                                        int ldam =
+                                            plasma_tile_mmain_band(A, m, k);
+                                        int ldbm = plasma_tile_mmain(B, m);
+                                        #pragma omp task priority(priority)
+                                        {
+                                            core_dgemm(
+                                                PlasmaNoTrans, PlasmaNoTrans,
+                                                mvbm, nvbn, B.mb,
+                                                -1.0,   A(m, k), ldam,
+                                                        B(k, n), ldbk,
+                                                lalpha, B(m, n), ldbm);
+                                        }
+                                    }
+                                    #pragma omp taskwait
+                                }
                             }
                         }
+                        continue;
+                    }
+                    for (int n = 0; n < B.nt; n++) {
+                        int nvbn = plasma_tile_nview(B, n);
                         core_omp_dtrsm(
                             side, uplo, trans, diag,
                             mvbk, nvbn,
@@ -163,6 +284,66 @@ void plasma_pdtbsm(plasma_enum_t side, plasma_enum_t uplo,
                     int ldak = plasma_tile_mmain_band(A, B.mt-k-1, B.mt-k-1);
                     int ldbk = plasma_tile_mmain(B, B.mt-k-1);
                     double lalpha = k == 0 ? alpha : 1.0;
+                    if (ipiv != NULL) {
+                        // The row swaps of step kk mix the tile rows kk to
+                        // kk+klt-1, so each column of B is solved by a chain
+                        // of tasks, one per step.
+                        int kk = B.mt-k-1;
+                        int klk = imin(kk+A.klt, A.mt) - (kk+1);
+                        int nak = plasma_tile_nmain(A, kk);
+                        double *a00 = A(kk, kk);
+                        double *a20 = klk > 0 ? A(kk+1, kk) : a00;
+                        int size_a00 = ldak*nak;
+                        int size_a20 = klk > 0 ? klk*A.mb*nak : size_a00;
+                        for (int n = 0; n < B.nt; n++) {
+                            int nvbn = plasma_tile_nview(B, n);
+                            double *b01, *b11, *b21;
+                            int size_b01, size_b11, size_b21;
+                            plasma_pdtbsm_band_tiles(B, kk, klk, n,
+                                                    &b01, &size_b01,
+                                                    &b11, &size_b11,
+                                                    &b21, &size_b21);
+                            #pragma omp task depend(in:a00[0:size_a00]) \
+                                             depend(in:a20[0:size_a20]) \
+                                             depend(in:ipiv[kk*A.mb:mvbk]) \
+                                             depend(inout:b01[0:size_b01]) \
+                                             depend(inout:b11[0:size_b11]) \
+                                             depend(inout:b21[0:size_b21]) \
+                                             priority(priority)
+                            {
+                                // The panel below only orders the step.
+                                (void)a20;
+                                if (sequence->status == PlasmaSuccess) {
+                                    for (int m = kk+1; m <= kk+klk; m++) {
+                                        int mvbm = plasma_tile_mview(B, m);
+                                        core_dgemm(
+                                            trans, PlasmaNoTrans,
+                                            mvbk, nvbn, mvbm,
+                                            -1.0,   A(m, kk),
+                                                    plasma_tile_mmain_band(
+                                                        A, m, kk),
+                                                    B(m, n),
+                                                    plasma_tile_mmain(B, m),
+                                            lalpha, B(kk, n), ldbk);
+                                    }
+                                    core_dtrsm(side, uplo, trans, diag,
+                                               mvbk, nvbn,
+                                               lalpha, A(kk, kk), ldak,
+                                                       B(kk, n), ldbk);
+
+                                    int k1 = 1+kk*A.nb;
+                                    int k2 = k1+mvbk-1;
+                                    plasma_desc_t view =
+                                        plasma_desc_view(B, 0, n*B.nb,
+                                                         B.m, nvbn);
+                                    view.type = PlasmaGeneral;
+                                    core_dlaswp(PlasmaRowwise, view, k1, k2,
+                                                ipiv, -1);
+                                }
+                            }
+                        }
+                        continue;
+                    }
                     for (int m = (B.mt-k-1)+1; m < imin((B.mt-k-1)+A.klt, A.mt); m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldam = plasma_tile_mmain_band(A, m, B.mt-k-1);
@@ -186,20 +367,11 @@ void plasma_pdtbsm(plasma_enum_t side, plasma_enum_t uplo,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1,        n), ldbk,
                             sequence, request);
-                        if (ipiv != NULL) {
-                            int k1 = 1+(B.mt-k-1)*A.nb;
-                            int k2 = k1+mvbk-1;
-                            plasma_desc_t view = plasma_desc_view(B,
-                                                                  0, n*A.nb,
-                                                                  A.m, nvbn);
-                            view.type = PlasmaGeneral;
-                            #pragma omp taskwait
-                            if (sequence->status == PlasmaSuccess) {
-                                core_dlaswp(PlasmaRowwise, view, k1, k2, ipiv, -1);
-                            }
-                        }
                     }
                 }
+                if (ipiv != NULL)
+                    for (int n = 0; n < B.nt; n++)
+                        plasma_pdtbsm_band_scatter(B, n);
             }
         }
     }
@@ -0,0 +1,49 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztranspose.c, normal z -> d, Thu Oct 15 06:03:19 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define B(m, n) (double*)plasma_tile_addr(B, m, n)
+
+/***************************************************************************//**
+ * Parallel tile out-of-place transpose.
+ * @see plasma_omp_dtranspose
+ ******************************************************************************/
+void plasma_pdtranspose(plasma_enum_t trans, plasma_desc_t A, plasma_desc_t B,
+                        plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // B(n, m) = op( A(m, n) ), one task per tile.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        int ldbn = plasma_tile_mmain(B, n);
+        for (int m = 0; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_dlacpy_trans(
+                trans,
+                nvan, mvam,
+                A(m, n), ldam,
+                B(n, m), ldbn,
+                sequence, request);
+        }
+    }
+}
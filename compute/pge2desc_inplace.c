@@ -0,0 +1,236 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************/
+// Parameters of the chunk permutations of the in-place translation.
+//
+// Column-major to tile layout in two steps:
+// 1. Inside each column panel of nb columns, the panel becomes its tiles
+//    one after the other: the lm1 full tiles, then the lm%mb tile,
+//    so that the last panel, A12 followed by A22, is done.
+// 2. The full panels are unit[u] = [u-th column of A11, u-th tile of A21],
+//    which are unshuffled into [all A11, all A21].
+// Both are permutations of chunks of contiguous elements.
+typedef struct {
+    size_t lm;  // number of rows of the panel, in chunks
+    size_t w;   // number of columns of the panel: one chunk per row chunk
+    size_t mb;  // number of rows of a full tile, in chunks
+    size_t r;   // number of rows of the last tile, in chunks
+    size_t lm1; // number of full tiles in the panel
+} panel_perm_t;
+
+typedef struct {
+    size_t p;   // size of the A11 part of a unit, in chunks
+    size_t q;   // size of the A21 part of a unit, in chunks
+    size_t ln1; // number of units
+} unshuffle_perm_t;
+
+/******************************************************************************/
+static size_t panel_dest(size_t s, const void *param)
+{
+    const panel_perm_t *pp = (const panel_perm_t*)param;
+    size_t i = s%pp->lm;
+    size_t j = s/pp->lm;
+    size_t t = i/pp->mb;
+    if (t < pp->lm1)
+        return t*pp->mb*pp->w + i%pp->mb + pp->mb*j;
+    else
+        return pp->lm1*pp->mb*pp->w + (i - pp->lm1*pp->mb) + pp->r*j;
+}
+
+/******************************************************************************/
+static size_t unshuffle_dest(size_t s, const void *param)
+{
+    const unshuffle_perm_t *up = (const unshuffle_perm_t*)param;
+    size_t u = s/(up->p + up->q);
+    size_t t = s%(up->p + up->q);
+    if (t < up->p)
+        return u*up->p + t;
+    else
+        return up->ln1*up->p + u*up->q + (t - up->p);
+}
+
+/******************************************************************************/
+static size_t gcd(size_t a, size_t b)
+{
+    while (b != 0) {
+        size_t t = a%b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/******************************************************************************/
+// Moves chunk s of X to chunk dest(s), for all the nchunk chunks,
+// or chunk dest(s) to chunk s if inverse, following the cycles of dest.
+// A bitmap of nchunk bits marks the chunks in place.
+static int cycle_permute(char *X, size_t nchunk, size_t size,
+                         size_t (*dest)(size_t, const void*),
+                         const void *param, int inverse)
+{
+    uint8_t *done = (uint8_t*)calloc((nchunk+7)/8, 1);
+    char *buf = (char*)malloc(2*size);
+    if (done == NULL || buf == NULL) {
+        free(done);
+        free(buf);
+        return PlasmaErrorOutOfMemory;
+    }
+    char *tmp = buf;
+    char *nxt = buf+size;
+    for (size_t s = 0; s < nchunk; s++) {
+        if (done[s/8] & (1 << s%8))
+            continue;
+        size_t cur = s;
+        memcpy(tmp, &X[s*size], size);
+        if (!inverse) {
+            // Carry the chunk of cur to its destination.
+            do {
+                size_t d = dest(cur, param);
+                done[cur/8] |= 1 << cur%8;
+                if (d != s)
+                    memcpy(nxt, &X[d*size], size);
+                memcpy(&X[d*size], tmp, size);
+                char *t = tmp;
+                tmp = nxt;
+                nxt = t;
+                cur = d;
+            } while (cur != s);
+        }
+        else {
+            // Pull the chunk of dest(cur) into cur.
+            for (;;) {
+                size_t d = dest(cur, param);
+                done[cur/8] |= 1 << cur%8;
+                if (d == s) {
+                    memcpy(&X[cur*size], tmp, size);
+                    break;
+                }
+                memcpy(&X[cur*size], &X[d*size], size);
+                cur = d;
+            }
+        }
+    }
+    free(done);
+    free(buf);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Submits the permutation of each column panel, one task per panel.
+// The inverse runs even in a failed sequence.
+static void panel_permute(plasma_desc_t A, int inverse,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t r = A.gm%A.mb;
+    size_t g = r == 0 ? A.mb : gcd(A.mb, r);
+
+    for (int n = 0; n < A.gnt; n++) {
+        int w = n < A.gn/A.nb ? A.nb : A.gn%A.nb;
+        char *panel = (char*)A.matrix + (size_t)A.nb*A.gm*n*eltsize;
+
+        #pragma omp task
+        {
+            if (inverse || sequence->status == PlasmaSuccess) {
+                panel_perm_t pp = {
+                    .lm  = A.gm/g,
+                    .w   = w,
+                    .mb  = A.mb/g,
+                    .r   = r/g,
+                    .lm1 = A.gm/A.mb
+                };
+                int retval = cycle_permute(panel, pp.lm*pp.w, g*eltsize,
+                                           panel_dest, &pp, inverse);
+                if (retval != PlasmaSuccess)
+                    plasma_request_fail(sequence, request, retval);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Unshuffles the A21 tiles out of the full panels, or back in if inverse.
+// The inverse runs even in a failed sequence.
+static void unshuffle(plasma_desc_t A, int inverse,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t lm1 = A.gm/A.mb;
+    size_t ln1 = A.gn/A.nb;
+    size_t P = lm1*A.mb*A.nb;
+    size_t Q = (size_t)(A.gm%A.mb)*A.nb;
+
+    // Nothing moves unless both parts are present in two panels at least.
+    if (P == 0 || Q == 0 || ln1 < 2)
+        return;
+
+    if (inverse || sequence->status == PlasmaSuccess) {
+        size_t g = gcd(P, Q);
+        unshuffle_perm_t up = {
+            .p   = P/g,
+            .q   = Q/g,
+            .ln1 = ln1
+        };
+        int retval = cycle_permute((char*)A.matrix, ln1*(up.p + up.q),
+                                   g*eltsize, unshuffle_dest, &up, inverse);
+        if (retval != PlasmaSuccess)
+            plasma_request_fail(sequence, request, retval);
+    }
+}
+
+/***************************************************************************//**
+ *  Translates the column-major matrix A.matrix, with leading dimension
+ *  A.gm, to tile layout in place, without a second copy of the matrix.
+ *  The column panels are permuted in parallel, then the tiles of A21 are
+ *  gathered. Returns when the translation is done, so that the tasks
+ *  submitted afterwards may use the tiles.
+ * @see plasma_desc_lapack_create
+ ******************************************************************************/
+void plasma_pge2desc_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    panel_permute(A, 0, sequence, request);
+    #pragma omp taskwait
+    unshuffle(A, 0, sequence, request);
+}
+
+/***************************************************************************//**
+ *  Translates the tile matrix A back to the column-major layout in place,
+ *  reversing plasma_pge2desc_inplace. Waits for the tasks submitted before,
+ *  which may still use the tiles. Runs even in a failed sequence, as the
+ *  matrix is the caller's array, unless the translation itself failed,
+ *  which leaves the array undefined.
+ * @see plasma_pge2desc_inplace
+ ******************************************************************************/
+void plasma_pdesc2ge_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    #pragma omp taskwait
+
+    unshuffle(A, 1, sequence, request);
+    panel_permute(A, 1, sequence, request);
+    #pragma omp taskwait
+}
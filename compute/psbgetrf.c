@@ -0,0 +1,190 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <omp.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define W(m, n) (&W[(float*)plasma_tile_addr(A, m, n)-(float*)A.matrix])
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with the trailing updates in bfloat16.
+ *  The factors are kept in single precision in A. Each tile of L and U is
+ *  rounded to bfloat16 once, when the panel or the trsm producing it is done,
+ *  into a copy W laid out like A, and the gemms multiply the bfloat16 tiles
+ *  accumulating in single precision. Meant as the factorization of a solver
+ *  with refinement, the factors are only as accurate as bfloat16.
+ * @see plasma_omp_dsgesv
+ ******************************************************************************/
+void plasma_psbgetrf(plasma_desc_t A, int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int ib = plasma->ib;
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_enum_t panel_mode = plasma->panel_mode;
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+    plasma_panel_workspace_t *panel_work = &plasma->panel_work;
+
+    // Allocate the bfloat16 copy and the workspaces of the gemms.
+    plasma_workspace_t work;
+    plasma_bfloat16_t *W = (plasma_bfloat16_t*)malloc(
+        (size_t)A.gm*A.gn*sizeof(plasma_bfloat16_t));
+    if (W == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    int retval = plasma_workspace_create(&work, (size_t)2*A.mb*A.nb,
+                                         PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        free(W);
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        float *a00, *a20;
+        a00 = A(k, k);
+        a20 = A(A.mt-1, k);
+
+        int ma00k = (A.mt-k-1)*A.mb;
+        int na00k = plasma_tile_nmain(A, k);
+        int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+        int nvak = plasma_tile_nview(A, k);
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // panel
+        #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                         depend(inout:a20[0:lda20*nvak]) \
+                         depend(out:ipiv[k*A.mb:mvak])
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_desc_t view =
+                    plasma_desc_view(A,
+                                     k*A.mb, k*A.nb,
+                                     A.m-k*A.mb, nvak);
+
+                int info = plasma_psgetrf_panel(view, &ipiv[k*A.mb], ib,
+                                                panel_mode,
+                                                panel_team, panel_bind,
+                                                num_panel_threads, 0,
+                                                panel_work);
+                if (info != 0)
+                    plasma_request_fail(sequence, request, k*A.mb+info);
+            }
+
+            for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+                ipiv[i-1] += k*A.mb;
+
+            // Round the tiles of L to bfloat16.
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_slag2bf(mvam, nvak, A(m, k), ldam, W(m, k), ldam);
+            }
+        }
+        // update
+        for (int n = k+1; n < A.nt; n++) {
+            float *a01, *a11, *a21;
+            a01 = A(k, n);
+            a11 = A(k+1, n);
+            a21 = A(A.mt-1, n);
+
+            int ma11k = (A.mt-k-2)*A.mb;
+            int na11n = plasma_tile_nmain(A, n);
+            int lda21 = plasma_tile_mmain(A, A.mt-1);
+
+            int nvan = plasma_tile_nview(A, n);
+
+            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                             depend(in:a20[0:lda20*nvak]) \
+                             depend(in:ipiv[k*A.mb:mvak]) \
+                             depend(inout:a01[0:ldak*nvan]) \
+                             depend(inout:a11[0:ma11k*na11n]) \
+                             depend(inout:a21[0:lda21*nvan])
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    // laswp
+                    int k1 = k*A.mb+1;
+                    int k2 = imin(k*A.mb+A.mb, A.m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    core_slaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+                    // trsm, then the tile of U to bfloat16
+                    core_strsm(PlasmaLeft, PlasmaLower,
+                               PlasmaNoTrans, PlasmaUnit,
+                               mvak, nvan,
+                               1.0, A(k, k), ldak,
+                                    A(k, n), ldak);
+                    core_slag2bf(mvak, nvan, A(k, n), ldak, W(k, n), ldak);
+
+                    // gemm
+                    for (int m = k+1; m < A.mt; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        int ldam = plasma_tile_mmain(A, m);
+
+                        #pragma omp task
+                        {
+                            float *wtid =
+                                (float*)work.spaces[omp_get_thread_num()];
+                            core_sbgemm(
+                                PlasmaNoTrans, PlasmaNoTrans,
+                                mvam, nvan, nvak,
+                                -1.0, W(m, k), ldam,
+                                      W(k, n), ldak,
+                                1.0,  A(m, n), ldam,
+                                wtid);
+                        }
+                    }
+                }
+                #pragma omp taskwait
+            }
+        }
+    }
+    // pivoting to the left
+    for (int k = 1; k < imin(A.mt, A.nt); k++) {
+        float *akk;
+        akk = A(k, k);
+        int makk = (A.mt-k-1)*A.mb;
+        int nakk = plasma_tile_nmain(A, k);
+
+        #pragma omp task depend(in:ipiv[(imin(A.mt, A.nt)-1)*A.mb]) \
+                         depend(inout:akk[0:makk*nakk])
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_desc_t view =
+                    plasma_desc_view(A, 0, (k-1)*A.nb, A.m, A.nb);
+                int k1 = k*A.mb+1;
+                int k2 = imin(A.m, A.n);
+                core_slaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            }
+        }
+    }
+    // The tasks use W and work.
+    #pragma omp taskwait
+    plasma_workspace_destroy(&work);
+    free(W);
+}
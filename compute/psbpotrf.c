@@ -0,0 +1,162 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define W(m, n) (&W[(float*)plasma_tile_addr(A, m, n)-(float*)A.matrix])
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization with the off-diagonal updates
+ *  in bfloat16. The factor is kept in single precision in A; each of its
+ *  off-diagonal tiles is rounded to bfloat16 after its trsm, into a copy W
+ *  laid out like A, and the gemms multiply the bfloat16 tiles accumulating
+ *  in single precision. The diagonal tiles are updated by ssyrk.
+ * @see plasma_omp_dsposv
+ ******************************************************************************/
+void plasma_psbpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Allocate the bfloat16 copy and the workspaces of the gemms.
+    plasma_workspace_t work;
+    plasma_bfloat16_t *W = (plasma_bfloat16_t*)malloc(
+        (size_t)A.gm*A.gn*sizeof(plasma_bfloat16_t));
+    if (W == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    int retval = plasma_workspace_create(&work, (size_t)2*A.mb*A.nb,
+                                         PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        free(W);
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (uplo == PlasmaLower) {
+        for (int k = 0; k < A.mt; k++) {
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            core_omp_spotrf(
+                PlasmaLower, mvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_strsm(
+                    PlasmaRight, PlasmaLower,
+                    PlasmaTrans, PlasmaNonUnit,
+                    mvam, A.mb,
+                    1.0, A(k, k), ldak,
+                         A(m, k), ldam,
+                    sequence, request);
+                core_omp_slag2bf(
+                    mvam, A.mb,
+                    A(m, k), ldam,
+                    W(m, k), ldam,
+                    sequence, request);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_ssyrk(
+                    PlasmaLower, PlasmaNoTrans,
+                    mvam, A.mb,
+                    -1.0, A(m, k), ldam,
+                     1.0, A(m, m), ldam,
+                    sequence, request);
+
+                for (int n = k+1; n < m; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_sbgemm(
+                        PlasmaNoTrans, PlasmaTrans,
+                        mvam, A.mb, A.mb,
+                        -1.0, W(m, k), ldam,
+                              W(n, k), ldan,
+                         1.0, A(m, n), ldam,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int k = 0; k < A.nt; k++) {
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            core_omp_spotrf(
+                PlasmaUpper, nvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                core_omp_strsm(
+                    PlasmaLeft, PlasmaUpper,
+                    PlasmaTrans, PlasmaNonUnit,
+                    A.nb, nvam,
+                    1.0, A(k, k), ldak,
+                         A(k, m), ldak,
+                    sequence, request);
+                core_omp_slag2bf(
+                    A.nb, nvam,
+                    A(k, m), ldak,
+                    W(k, m), ldak,
+                    sequence, request);
+            }
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_ssyrk(
+                    PlasmaUpper, PlasmaTrans,
+                    nvam, A.mb,
+                    -1.0, A(k, m), ldak,
+                     1.0, A(m, m), ldam,
+                    sequence, request);
+
+                for (int n = k+1; n < m; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_sbgemm(
+                        PlasmaTrans, PlasmaNoTrans,
+                        A.mb, nvam, A.mb,
+                        -1.0, W(k, n), ldak,
+                              W(k, m), ldak,
+                         1.0, A(n, m), ldan,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    // The tasks use W and work.
+    #pragma omp taskwait
+    plasma_workspace_destroy(&work);
+    free(W);
+}
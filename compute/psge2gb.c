@@ -0,0 +1,200 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzge2gb.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define TU(m, n) (float*)plasma_tile_addr(TU, m, n)
+#define TV(m, n) (float*)plasma_tile_addr(TV, m, n)
+
+/***************************************************************************//**
+ *  Copies the upper band of tile column k of A, from the lower triangle of
+ *  the tile above the diagonal and its diagonal tile, to AB in LAPACK band
+ *  storage with kd superdiagonals.
+ **/
+static void plasma_psge2gb_copy(plasma_desc_t A, int k, int kd,
+                                float *AB, int ldab,
+                                plasma_sequence_t *sequence)
+{
+    int k0 = imax(k-1, 0);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldak0 = plasma_tile_mmain(A, k0);
+    float *akk = A(k, k);
+    float *ak0 = A(k0, k);
+    float *abk = &AB[(size_t)k*A.nb*ldab];
+
+    #pragma omp task depend(in:akk[0:ldak*nvak]) \
+                     depend(in:ak0[0:ldak0*nvak]) \
+                     depend(out:abk[0:ldab*nvak]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("slacpy", abk);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            for (int j = 0; j < nvak; j++) {
+                int jg = k*A.nb+j;
+                for (int ig = imax(0, jg-kd); ig <= jg; ig++) {
+                    int i = ig-k*A.mb;
+                    abk[kd+ig-jg + j*ldab] = i >= 0 ? akk[i + j*ldak]
+                                                    : ak0[i+A.mb + j*ldak0];
+                }
+            }
+        }
+        PLASMA_TRACE_STOP("slacpy", 1, abk, akk, ak0);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel reduction of an m-by-n matrix A, m >= n, to upper band form of
+ *  bandwidth nb, Q^T A P = B, the first stage of the two-stage reduction to
+ *  bidiagonal.
+ *
+ *  Step k is a step of plasma_psgeqrf on tile column k, which leaves R in
+ *  the diagonal tile, and then a step of plasma_psgelqf on the tile row k
+ *  right of the diagonal, which leaves L in A(k, k+1). The reflectors of
+ *  the QR steps are stored as by plasma_psgeqrf, with TU, so Q is applied
+ *  by plasma_psormqr with A and TU. Those of the LQ steps are stored as by
+ *  plasma_psgelqf on A(0:n-nb-1, nb:n-1), with the tiles of TV from the
+ *  second tile column on, and P^T is the Q of that LQ factorization.
+ *  The band of B is copied to AB in LAPACK band storage, with
+ *  kd = min(nb, n-1) superdiagonals, as each tile column is done.
+ * @see plasma_omp_sge2gb
+ **/
+void plasma_psge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                    float *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = TU.mb;
+    int kd = imin(A.nb, A.n-1);
+
+    for (int k = 0; k < A.nt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        //================
+        // QR of column k
+        //================
+        core_omp_sgeqrt(
+            mvak, nvak, ib,
+            A(k, k), ldak,
+            TU(k, k), TU.mb,
+            work, plasma->panel_blas_threads,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_sormqr(
+                PlasmaLeft, PlasmaTrans,
+                mvak, nvan, imin(mvak, nvak), ib,
+                A(k, k), ldak,
+                TU(k, k), TU.mb,
+                A(k, n), ldak,
+                work,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_stsqrt(
+                mvam, nvak, ib,
+                A(k, k), ldak,
+                A(m, k), ldam,
+                TU(m, k), TU.mb,
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    TU(m, k), TU.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+        plasma_psge2gb_copy(A, k, kd, AB, ldab, sequence);
+
+        if (k == A.nt-1)
+            break;
+
+        //============================
+        // LQ of row k, from k+1 on
+        //============================
+        int nvak1 = plasma_tile_nview(A, k+1);
+        core_omp_sgelqt(
+            mvak, nvak1, ib,
+            A(k, k+1), ldak,
+            TV(k, k+1), TV.mb,
+            work, plasma->panel_blas_threads,
+            sequence, request);
+
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_sormlq(
+                PlasmaRight, PlasmaTrans,
+                mvam, nvak1, imin(mvak, nvak1), ib,
+                A(k, k+1), ldak,
+                TV(k, k+1), TV.mb,
+                A(m, k+1), ldam,
+                work,
+                sequence, request);
+        }
+        for (int n = k+2; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_stslqt(
+                mvak, nvan, ib,
+                A(k, k+1), ldak,
+                A(k, n), ldak,
+                TV(k, n), TV.mb,
+                work,
+                sequence, request);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_stsmlq(
+                    PlasmaRight, PlasmaTrans,
+                    mvam, A.nb, mvam, nvan, mvak, ib,
+                    A(m, k+1), ldam,
+                    A(m, n), ldam,
+                    A(k, n), ldak,
+                    TV(k, n), TV.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
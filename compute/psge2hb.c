@@ -0,0 +1,132 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzge2hb.c, normal z -> s, Thu Oct 15 08:59:52 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define T(m, n) (float*)plasma_tile_addr(T, m, n)
+
+/***************************************************************************//**
+ *  Parallel reduction of a general matrix A to block upper Hessenberg form
+ *  of lower bandwidth nb, Q^T A Q = B, the first stage of the two-stage
+ *  reduction to Hessenberg form.
+ *
+ *  As in plasma_pssy2sb, step k factors A(k+1:mt-1, k) as plasma_psgeqrf
+ *  factors a panel, and applies each block of reflectors from both sides,
+ *  by the unmqr and tsmqr kernels of the QR factorization, from the left
+ *  to the tile columns right of k, and from the right to the whole tile
+ *  columns, as the upper part of A is full.
+ *
+ *  The reflectors are left below the block subdiagonal, so Q is the Q of
+ *  the QR factorization of A(nb:n-1, 0:n-nb-1), with the tiles of T from
+ *  the second tile row on.
+ * @see plasma_omp_sge2hb
+ **/
+void plasma_psge2hb(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    for (int k = 0; k < A.nt-1; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int nvak = plasma_tile_nview(A, k);
+        int mvak1 = plasma_tile_mview(A, k+1);
+        int ldak1 = plasma_tile_mmain(A, k+1);
+        core_omp_sgeqrt(
+            mvak1, nvak, ib,
+            A(k+1, k), ldak1,
+            T(k+1, k), T.mb,
+            work, plasma->panel_blas_threads,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_sormqr(
+                PlasmaLeft, PlasmaTrans,
+                mvak1, nvan, imin(mvak1, nvak), ib,
+                A(k+1, k), ldak1,
+                T(k+1, k), T.mb,
+                A(k+1, n), ldak1,
+                work,
+                sequence, request);
+        }
+        for (int m = 0; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_sormqr(
+                PlasmaRight, PlasmaNoTrans,
+                mvam, mvak1, imin(mvak1, nvak), ib,
+                A(k+1, k), ldak1,
+                T(k+1, k), T.mb,
+                A(m, k+1), ldam,
+                work,
+                sequence, request);
+        }
+
+        for (int m = k+2; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_stsqrt(
+                mvam, nvak, ib,
+                A(k+1, k), ldak1,
+                A(m, k), ldam,
+                T(m, k), T.mb,
+                work,
+                sequence, request);
+
+            // Tile rows k+1 and m.
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k+1, n), ldak1,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+            // Tile columns k+1 and m.
+            for (int j = 0; j < A.mt; j++) {
+                int mvaj = plasma_tile_mview(A, j);
+                int ldaj = plasma_tile_mmain(A, j);
+                core_omp_stsmqr(
+                    PlasmaRight, PlasmaNoTrans,
+                    mvaj, A.nb, mvaj, mvam, nvak, ib,
+                    A(j, k+1), ldaj,
+                    A(j, m), ldaj,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
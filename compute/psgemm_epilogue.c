@@ -0,0 +1,175 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgemm_epilogue.c, normal z -> s, Thu Oct 15 07:38:18 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_s.h"
+#include "core_blas.h"
+
+#include <complex.h>
+#include <math.h>
+
+#define REAL
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define C(m, n) (float*)plasma_tile_addr(C, m, n)
+
+/******************************************************************************/
+// Applies the epilogue to the m-by-n tile C starting at the element (i, j)
+// of the product.
+static void plasma_sepilogue_tile(const plasma_sepilogue_t *epilogue,
+                                  int i, int j, int m, int n,
+                                  float *C, int ldc)
+{
+    const float *rs = epilogue->row_scale;
+    const float *cs = epilogue->col_scale;
+    const float *rb = epilogue->row_bias;
+    const float *cb = epilogue->col_bias;
+    plasma_enum_t act = epilogue->activation;
+
+    if (rs != NULL || cs != NULL || rb != NULL || cb != NULL ||
+        act != PlasmaActivationNone) {
+        for (int jj = 0; jj < n; jj++) {
+            float scale = cs != NULL ? cs[j+jj] : 1.0;
+            float bias  = cb != NULL ? cb[j+jj] : 0.0;
+            float *c = &C[(size_t)ldc*jj];
+            for (int ii = 0; ii < m; ii++) {
+                float z = c[ii]*scale;
+                if (rs != NULL)
+                    z *= rs[i+ii];
+                z += bias;
+                if (rb != NULL)
+                    z += rb[i+ii];
+#ifdef COMPLEX
+                if (act == PlasmaActivationRelu)
+                    z = fmax(creal(z), 0.0) + fmax(cimag(z), 0.0)*_Complex_I;
+                else if (act == PlasmaActivationTanh)
+                    z = ctanh(z);
+#else
+                if (act == PlasmaActivationRelu)
+                    z = fmax(z, 0.0);
+                else if (act == PlasmaActivationTanh)
+                    z = tanh(z);
+#endif
+                c[ii] = z;
+            }
+        }
+    }
+    if (epilogue->func != NULL)
+        epilogue->func(i, j, m, n, C, ldc, epilogue->args);
+}
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication with an epilogue on the tiles
+ * of C. The products of each tile of C are chained as by plasma_psgemm,
+ * and the task of the last product applies the epilogue to the tile,
+ * while it is still in the cache, instead of a pass over C afterwards.
+ * @see plasma_omp_sgemm_epilogue
+ ******************************************************************************/
+void plasma_psgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            float beta,  plasma_desc_t C,
+                            const plasma_sepilogue_t *epilogue,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (epilogue == NULL) {
+        plasma_psgemm(transa, transb,
+                      alpha, A,
+                             B,
+                      beta,  C,
+                      sequence, request);
+        return;
+    }
+
+    int kdim = transa == PlasmaNoTrans ? A.n : A.m;
+    int kt = alpha == 0.0 || kdim == 0 ? 0 :
+             transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    // Submit the tiles of C in the Morton order, so that the tasks running
+    // together share their tiles of A and B in the caches.
+    int mbits = plasma_morton_bits(C.mt);
+    int nbits = plasma_morton_bits(C.nt);
+    for (int z = 0; z < 1 << (mbits+nbits); z++) {
+        int m, n;
+        plasma_morton_tile(z, mbits, nbits, &m, &n);
+        if (m >= C.mt || n >= C.nt)
+            continue;
+
+        int mvcm = plasma_tile_mview(C, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        int nvcn = plasma_tile_nview(C, n);
+
+        // all products but the last
+        for (int k = 0; k < kt-1; k++) {
+            int am = transa == PlasmaNoTrans ? m : k;
+            int an = transa == PlasmaNoTrans ? k : m;
+            int bm = transb == PlasmaNoTrans ? k : n;
+            int bn = transb == PlasmaNoTrans ? n : k;
+            int kvak = transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                               : plasma_tile_mview(A, k);
+            float zbeta = k == 0 ? beta : 1.0;
+            core_omp_sgemm(
+                transa, transb,
+                mvcm, nvcn, kvak,
+                alpha, A(am, an), plasma_tile_mmain(A, am),
+                       B(bm, bn), plasma_tile_mmain(B, bm),
+                zbeta, C(m, n), ldcm,
+                sequence, request);
+        }
+
+        // the last product, or the scaling of C by beta, and the epilogue
+        int k = imax(kt-1, 0);
+        int am = transa == PlasmaNoTrans ? m : k;
+        int an = transa == PlasmaNoTrans ? k : m;
+        int bm = transb == PlasmaNoTrans ? k : n;
+        int bn = transb == PlasmaNoTrans ? n : k;
+        if (kt == 0)
+            am = an = bm = bn = 0;
+        int kvak = kt == 0 ? 0 :
+                   transa == PlasmaNoTrans ? plasma_tile_nview(A, k)
+                                           : plasma_tile_mview(A, k);
+        int ak = transa == PlasmaNoTrans ? kvak : mvcm;
+        int bk = transb == PlasmaNoTrans ? nvcn : kvak;
+        float zbeta = k == 0 ? beta : 1.0;
+        float *a = A(am, an);
+        float *b = B(bm, bn);
+        float *c = C(m, n);
+        int lda = imax(1, plasma_tile_mmain(A, am));
+        int ldb = imax(1, plasma_tile_mmain(B, bm));
+        plasma_sepilogue_t epi = *epilogue;
+        #pragma omp task depend(in:a[0:lda*ak]) \
+                         depend(in:b[0:ldb*bk]) \
+                         depend(inout:c[0:ldcm*nvcn]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            if (sequence->status == PlasmaSuccess) {
+                core_sgemm(transa, transb,
+                           mvcm, nvcn, kvak,
+                           alpha, a, lda,
+                                  b, ldb,
+                           zbeta, c, ldcm);
+                plasma_sepilogue_tile(&epi, m*C.mb, n*C.nb, mvcm, nvcn,
+                                      c, ldcm);
+            }
+        }
+    }
+}
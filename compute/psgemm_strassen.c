@@ -0,0 +1,229 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgemm_strassen.c, normal z -> s, Wed Oct 14 17:53:14 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+static void plasma_psgemm_strassen_step(
+    plasma_enum_t transa, plasma_enum_t transb,
+    float alpha, plasma_desc_t A,
+                              plasma_desc_t B,
+    float beta,  plasma_desc_t C,
+    plasma_desc_t *W, int depth, int levels,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+/******************************************************************************/
+// Returns the m-by-n block of op(A) starting at row i and column j.
+static plasma_desc_t plasma_zop_view(plasma_desc_t A, plasma_enum_t trans,
+                                     int i, int j, int m, int n)
+{
+    if (trans == PlasmaNoTrans)
+        return plasma_desc_view(A, i, j, m, n);
+    else
+        return plasma_desc_view(A, j, i, n, m);
+}
+
+/******************************************************************************/
+// Computes D = alpha*op(A)*op(B) by one Winograd step over the quadrants,
+// where the dimensions of D and of the inner product are even numbers of
+// tiles. Uses the workspaces X, Y and Z of the given depth.
+static void plasma_psgemm_winograd(
+    plasma_enum_t transa, plasma_enum_t transb,
+    float alpha, plasma_desc_t A,
+                              plasma_desc_t B,
+                              plasma_desc_t D,
+    plasma_desc_t *W, int depth, int levels,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int mh = D.m/2;
+    int nh = D.n/2;
+    int kh = (transa == PlasmaNoTrans ? A.n : A.m)/2;
+
+    plasma_desc_t A11 = plasma_zop_view(A, transa,  0,  0, mh, kh);
+    plasma_desc_t A12 = plasma_zop_view(A, transa,  0, kh, mh, kh);
+    plasma_desc_t A21 = plasma_zop_view(A, transa, mh,  0, mh, kh);
+    plasma_desc_t A22 = plasma_zop_view(A, transa, mh, kh, mh, kh);
+
+    plasma_desc_t B11 = plasma_zop_view(B, transb,  0,  0, kh, nh);
+    plasma_desc_t B12 = plasma_zop_view(B, transb,  0, nh, kh, nh);
+    plasma_desc_t B21 = plasma_zop_view(B, transb, kh,  0, kh, nh);
+    plasma_desc_t B22 = plasma_zop_view(B, transb, kh, nh, kh, nh);
+
+    plasma_desc_t D11 = plasma_desc_view(D,  0,  0, mh, nh);
+    plasma_desc_t D12 = plasma_desc_view(D,  0, nh, mh, nh);
+    plasma_desc_t D21 = plasma_desc_view(D, mh,  0, mh, nh);
+    plasma_desc_t D22 = plasma_desc_view(D, mh, nh, mh, nh);
+
+    plasma_desc_t X = W[4*depth];
+    plasma_desc_t Y = W[4*depth+1];
+    plasma_desc_t Z = W[4*depth+2];
+
+    // X = S1 = A21+A22, Y = T1 = B12-B11, D22 = P5 = S1*T1
+    plasma_psgeadd(transa, 1.0, A21, 0.0, X, sequence, request);
+    plasma_psgeadd(transa, 1.0, A22, 1.0, X, sequence, request);
+    plasma_psgeadd(transb,  1.0, B12, 0.0, Y, sequence, request);
+    plasma_psgeadd(transb, -1.0, B11, 1.0, Y, sequence, request);
+    plasma_psgemm_strassen_step(PlasmaNoTrans, PlasmaNoTrans,
+                                alpha, X, Y, 0.0, D22,
+                                W, depth+1, levels, sequence, request);
+
+    // X = S2 = S1-A11, Y = T2 = B22-T1, D11 = P1 = A11*B11
+    // Z = U2 = P1+S2*T2
+    plasma_psgeadd(transa, -1.0, A11, 1.0, X, sequence, request);
+    plasma_psgeadd(transb, 1.0, B22, -1.0, Y, sequence, request);
+    plasma_psgemm_strassen_step(transa, transb,
+                                alpha, A11, B11, 0.0, D11,
+                                W, depth+1, levels, sequence, request);
+    plasma_pslacpy(PlasmaGeneral, D11, Z, sequence, request);
+    plasma_psgemm_strassen_step(PlasmaNoTrans, PlasmaNoTrans,
+                                alpha, X, Y, 1.0, Z,
+                                W, depth+1, levels, sequence, request);
+
+    // D11 = U1 = P1+A12*B21
+    plasma_psgemm_strassen_step(transa, transb,
+                                alpha, A12, B21, 1.0, D11,
+                                W, depth+1, levels, sequence, request);
+
+    // X = S4 = A12-S2, D12 = U5 = S4*B22+U2+P5
+    plasma_psgeadd(transa, 1.0, A12, -1.0, X, sequence, request);
+    plasma_psgemm_strassen_step(PlasmaNoTrans, transb,
+                                alpha, X, B22, 0.0, D12,
+                                W, depth+1, levels, sequence, request);
+    plasma_psgeadd(PlasmaNoTrans, 1.0, Z, 1.0, D12, sequence, request);
+    plasma_psgeadd(PlasmaNoTrans, 1.0, D22, 1.0, D12, sequence, request);
+
+    // X = S3 = A11-A21, Y = T3 = B22-B12, Z = U3 = U2+S3*T3
+    plasma_psgeadd(transa,  1.0, A11, 0.0, X, sequence, request);
+    plasma_psgeadd(transa, -1.0, A21, 1.0, X, sequence, request);
+    plasma_psgeadd(transb,  1.0, B22, 0.0, Y, sequence, request);
+    plasma_psgeadd(transb, -1.0, B12, 1.0, Y, sequence, request);
+    plasma_psgemm_strassen_step(PlasmaNoTrans, PlasmaNoTrans,
+                                alpha, X, Y, 1.0, Z,
+                                W, depth+1, levels, sequence, request);
+
+    // D22 = U7 = U3+P5
+    plasma_psgeadd(PlasmaNoTrans, 1.0, Z, 1.0, D22, sequence, request);
+
+    // Y = T4 = T3+B11-B21, D21 = U6 = U3-A22*T4
+    plasma_psgeadd(transb,  1.0, B11, 1.0, Y, sequence, request);
+    plasma_psgeadd(transb, -1.0, B21, 1.0, Y, sequence, request);
+    plasma_pslacpy(PlasmaGeneral, Z, D21, sequence, request);
+    plasma_psgemm_strassen_step(transa, PlasmaNoTrans,
+                                -alpha, A22, Y, 1.0, D21,
+                                W, depth+1, levels, sequence, request);
+}
+
+/******************************************************************************/
+// Computes C = alpha*op(A)*op(B) + beta*C with the remaining levels.
+// The largest part of C made of an even number of tiles in each dimension
+// is computed by a Winograd step, the remaining tile rows and columns
+// of C and of the inner dimension by the classic algorithm.
+static void plasma_psgemm_strassen_step(
+    plasma_enum_t transa, plasma_enum_t transb,
+    float alpha, plasma_desc_t A,
+                              plasma_desc_t B,
+    float beta,  plasma_desc_t C,
+    plasma_desc_t *W, int depth, int levels,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (depth == levels) {
+        plasma_psgemm(transa, transb,
+                      alpha, A,
+                             B,
+                      beta,  C,
+                      sequence, request);
+        return;
+    }
+
+    int m = C.m;
+    int n = C.n;
+    int k = transa == PlasmaNoTrans ? A.n : A.m;
+
+    int me = m/(2*C.mb)*2*C.mb;
+    int ne = n/(2*C.nb)*2*C.nb;
+    int ke = k/(2*C.nb)*2*C.nb;
+
+    plasma_desc_t Ae = plasma_zop_view(A, transa, 0, 0, me, ke);
+    plasma_desc_t Be = plasma_zop_view(B, transb, 0, 0, ke, ne);
+    plasma_desc_t Ce = plasma_desc_view(C, 0, 0, me, ne);
+
+    // Accumulate into C through the product workspace of this depth.
+    if (beta == 0.0) {
+        plasma_psgemm_winograd(transa, transb,
+                               alpha, Ae, Be, Ce,
+                               W, depth, levels, sequence, request);
+    }
+    else {
+        plasma_desc_t R = W[4*depth+3];
+        plasma_psgemm_winograd(transa, transb,
+                               alpha, Ae, Be, R,
+                               W, depth, levels, sequence, request);
+        plasma_psgeadd(PlasmaNoTrans, 1.0, R, beta, Ce, sequence, request);
+    }
+
+    // remaining part of the inner dimension
+    if (k > ke) {
+        plasma_psgemm(transa, transb,
+                      alpha, plasma_zop_view(A, transa, 0, ke, me, k-ke),
+                             plasma_zop_view(B, transb, ke, 0, k-ke, ne),
+                      1.0,   Ce,
+                      sequence, request);
+    }
+    // remaining tile rows and columns of C
+    if (m > me) {
+        plasma_psgemm(transa, transb,
+                      alpha, plasma_zop_view(A, transa, me, 0, m-me, k),
+                             B,
+                      beta,  plasma_desc_view(C, me, 0, m-me, n),
+                      sequence, request);
+    }
+    if (n > ne) {
+        plasma_psgemm(transa, transb,
+                      alpha, plasma_zop_view(A, transa, 0, 0, me, k),
+                             plasma_zop_view(B, transb, 0, ne, k, n-ne),
+                      beta,  plasma_desc_view(C, 0, ne, me, n-ne),
+                      sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile matrix-matrix multiplication by the Strassen-Winograd
+ *  algorithm, with the classic tile algorithm below the given levels.
+ *  W holds four workspaces for each level: X and Y, the size of the
+ *  quadrants of op(A) and op(B), Z, the size of a quadrant of C,
+ *  and R, the size of the product of the level, for beta != 0.
+ *  The workspaces must be set to zero.
+ * @see plasma_sgemm
+ ******************************************************************************/
+void plasma_psgemm_strassen(plasma_enum_t transa, plasma_enum_t transb,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            float beta,  plasma_desc_t C,
+                            plasma_desc_t *W, int levels,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_psgemm_strassen_step(transa, transb,
+                                alpha, A,
+                                       B,
+                                beta,  C,
+                                W, 0, levels, sequence, request);
+}
@@ -0,0 +1,119 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgemmt.c, normal z -> s, Wed Oct 14 18:00:35 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define C(m, n) (float*)plasma_tile_addr(C, m, n)
+
+/***************************************************************************//**
+ * Parallel tile matrix-matrix multiplication updating one triangle of C.
+ * The diagonal tiles are updated by gemmt, the others by gemm.
+ * @see plasma_omp_sgemmt
+ ******************************************************************************/
+void plasma_psgemmt(plasma_enum_t uplo,
+                    plasma_enum_t transa, plasma_enum_t transb,
+                    float alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                    float beta,  plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int inner_k = transa == PlasmaNoTrans ? A.n : A.m;
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        int mfirst = uplo == PlasmaLower ? n : 0;
+        int mlast  = uplo == PlasmaLower ? C.mt-1 : n;
+        for (int m = mfirst; m <= mlast; m++) {
+            int mvcm = plasma_tile_mview(C, m);
+            int ldcm = plasma_tile_mmain(C, m);
+            //=========================================
+            // alpha*A*B does not contribute; scale C
+            //=========================================
+            if (alpha == 0.0 || inner_k == 0) {
+                int ldam = imax(1, plasma_tile_mmain(A, 0));
+                int ldbk = imax(1, plasma_tile_mmain(B, 0));
+                if (m == n)
+                    core_omp_sgemmt(
+                        uplo, transa, transb,
+                        nvcn, 0,
+                        alpha, A(0, 0), ldam,
+                               B(0, 0), ldbk,
+                        beta,  C(m, n), ldcm,
+                        sequence, request);
+                else
+                    core_omp_sgemm(
+                        transa, transb,
+                        mvcm, nvcn, 0,
+                        alpha, A(0, 0), ldam,
+                               B(0, 0), ldbk,
+                        beta,  C(m, n), ldcm,
+                        sequence, request);
+                continue;
+            }
+            for (int k = 0; k < kt; k++) {
+                int kvk;
+                int lda;
+                float *pA;
+                if (transa == PlasmaNoTrans) {
+                    kvk = plasma_tile_nview(A, k);
+                    lda = plasma_tile_mmain(A, m);
+                    pA = A(m, k);
+                }
+                else {
+                    kvk = plasma_tile_mview(A, k);
+                    lda = plasma_tile_mmain(A, k);
+                    pA = A(k, m);
+                }
+                int ldb;
+                float *pB;
+                if (transb == PlasmaNoTrans) {
+                    ldb = plasma_tile_mmain(B, k);
+                    pB = B(k, n);
+                }
+                else {
+                    ldb = plasma_tile_mmain(B, n);
+                    pB = B(n, k);
+                }
+                float zbeta = k == 0 ? beta : 1.0;
+                if (m == n)
+                    core_omp_sgemmt(
+                        uplo, transa, transb,
+                        nvcn, kvk,
+                        alpha, pA, lda,
+                               pB, ldb,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+                else
+                    core_omp_sgemm(
+                        transa, transb,
+                        mvcm, nvcn, kvk,
+                        alpha, pA, lda,
+                               pB, ldb,
+                        zbeta, C(m, n), ldcm,
+                        sequence, request);
+            }
+        }
+    }
+}
@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzgeqrf.c, normal z -> s, Mon Feb  6 14:06:15 2017
+ * @generated from compute/pzgeqrf.c, normal z -> s, Thu Oct 15 10:53:20 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_barrier.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
@@ -18,34 +19,328 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <omp.h>
+#include <stdlib.h>
+
 #define A(m, n) (float*)plasma_tile_addr(A, m, n)
 #define T(m, n) (float*)plasma_tile_addr(T, m, n)
+#define B(m, n) (float*)plasma_tile_addr(*B, m, n)
+
+/******************************************************************************/
+// arguments of the ranks of the static QR factorization
+typedef struct {
+    plasma_desc_t A;
+    plasma_desc_t T;
+    plasma_desc_t *B;
+    plasma_workspace_t work;
+    plasma_progress_t *progress;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_psgeqrf_static_t;
+
+/******************************************************************************/
+// Runs the rank of the static QR factorization: factors the tile columns
+// n = rank, rank+size, ..., of A, followed by those of B, if not NULL,
+// left-looking, applying to each the reflectors of the panels before it
+// as they complete.
+static void plasma_psgeqrf_static_rank(void *args, int rank, int size,
+                                       plasma_barrier_t *barrier)
+{
+    plasma_psgeqrf_static_t *schedule = (plasma_psgeqrf_static_t*)args;
+    plasma_desc_t A = schedule->A;
+    plasma_desc_t T = schedule->T;
+    plasma_desc_t *B = schedule->B;
+    plasma_progress_t *progress = schedule->progress;
+    plasma_sequence_t *sequence = schedule->sequence;
+    plasma_request_t *request = schedule->request;
+    // The ranks synchronize by the progress table instead.
+    (void)barrier;
+
+    int ib = T.mb;
+    int kt = imin(A.mt, A.nt);
+    int nt = A.nt + (B != NULL ? B->nt : 0);
+
+    float *W = (float*)schedule->work.spaces[rank];
+
+    for (int j = rank; j < nt; j += size) {
+        // tile column n of C, A or B
+        plasma_desc_t C = j < A.nt ? A : *B;
+        int n = j < A.nt ? j : j-A.nt;
+        int nvcn = plasma_tile_nview(C, n);
+
+        int info = PlasmaSuccess;
+        for (int k = 0; k < imin(kt, j); k++) {
+            plasma_progress_wait(progress, k, 1);
+            if (sequence->status != PlasmaSuccess)
+                continue;
+
+            int mvak = plasma_tile_mview(A, k);
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            int mvck = plasma_tile_mview(C, k);
+            int ldck = plasma_tile_mmain(C, k);
+            info |= core_sormqr(PlasmaLeft, PlasmaTrans,
+                                mvck, nvcn, imin(mvak, nvak), ib,
+                                A(k, k), ldak,
+                                T(k, k), T.mb,
+                                (float*)plasma_tile_addr(C, k, n),
+                                ldck,
+                                W, nvcn);
+            for (int m = k+1; m < A.mt; m++) {
+                int mvcm = plasma_tile_mview(C, m);
+                int ldam = plasma_tile_mmain(A, m);
+                int ldcm = plasma_tile_mmain(C, m);
+                info |= core_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    C.mb, nvcn, mvcm, nvcn, nvak, ib,
+                    (float*)plasma_tile_addr(C, k, n), ldck,
+                    (float*)plasma_tile_addr(C, m, n), ldcm,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    W, ib);
+            }
+        }
+        if (j < kt && sequence->status == PlasmaSuccess) {
+            int mvan = plasma_tile_mview(A, n);
+            int ldan = plasma_tile_mmain(A, n);
+            info |= core_sgeqrt(mvan, nvcn, ib,
+                                A(n, n), ldan,
+                                T(n, n), T.mb,
+                                W, W+nvcn);
+            for (int m = n+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                info |= core_stsqrt(mvam, nvcn, ib,
+                                    A(n, n), ldan,
+                                    A(m, n), ldam,
+                                    T(m, n), T.mb,
+                                    W, W+nvcn);
+            }
+        }
+        if (info != PlasmaSuccess) {
+            plasma_error("tile kernel failed");
+            plasma_request_fail(sequence, request, PlasmaErrorInternal);
+        }
+        // The other ranks wait for the panel even if the sequence failed.
+        if (j < kt)
+            plasma_progress_set(progress, j, 1);
+    }
+}
 
 /***************************************************************************//**
- *  Parallel tile QR factorization - dynamic scheduling
- * @see plasma_omp_sgeqrf
+ *  Parallel tile QR factorization - static scheduling.
+ *  The schedule is one task, depending on all the tiles of A, T and B,
+ *  whose ranks run on a nested team of as many threads as the team of the
+ *  call, at most one per workspace, see plasma_team_run(), so that they
+ *  all run at the same time, whatever the other tasks of the team.
  **/
-void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
-                    plasma_workspace_t work,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+static void plasma_psgeqrf_static(plasma_desc_t A, plasma_desc_t T,
+                                  plasma_desc_t *B,
+                                  plasma_workspace_t work,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int size = imin(omp_get_num_threads(), work.nthread);
+    int priority = plasma_sequence_priority(sequence);
+
+    int kt = imin(A.mt, A.nt);
+    int acount = A.mt*A.nt;
+    int tcount = kt*A.mt - kt*(kt-1)/2;
+    int bcount = B != NULL ? B->mt*B->nt : 0;
+    float **tiles = (float**)
+        malloc(((size_t)acount+tcount+bcount)*sizeof(float*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    float **ttiles = &tiles[acount];
+    float **btiles = &ttiles[tcount];
+    for (int n = 0; n < A.nt; n++)
+        for (int m = 0; m < A.mt; m++)
+            tiles[n*A.mt+m] = A(m, n);
+    int i = 0;
+    for (int k = 0; k < kt; k++)
+        for (int m = k; m < A.mt; m++)
+            ttiles[i++] = T(m, k);
+    if (B != NULL) {
+        for (int n = 0; n < B->nt; n++)
+            for (int m = 0; m < B->mt; m++)
+                btiles[n*B->mt+m] = B(m, n);
+    }
+
+    #pragma omp task depend(iterator(int t = 0:acount), inout:tiles[t][0]) \
+                     depend(iterator(int t = 0:tcount), out:ttiles[t][0]) \
+                     depend(iterator(int t = 0:bcount), inout:btiles[t][0]) \
+                     priority(priority)
+    {
+        plasma_progress_t progress;
+        if (plasma_progress_init(&progress, kt) != PlasmaSuccess) {
+            plasma_error("plasma_progress_init() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        }
+        else {
+            plasma_psgeqrf_static_t schedule = {
+                A, T, B, work, &progress, sequence, request
+            };
+            plasma_team_run(PlasmaThreadTeam, PlasmaBindNone, size, priority,
+                            plasma_psgeqrf_static_rank, &schedule);
+            plasma_progress_destroy(&progress);
+        }
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+    free(tiles);
+}
+
+/******************************************************************************/
+// arguments of the ranks of a multithreaded panel
+typedef struct {
+    plasma_desc_t A;
+    plasma_desc_t T;
+    int ib;
+    float *work;
+    int info;
+} plasma_psgeqrf_panel_t;
+
+/******************************************************************************/
+// Runs a rank of the team of a multithreaded panel.
+static void plasma_psgeqrf_panel_rank(void *args, int rank, int size,
+                                      plasma_barrier_t *barrier)
+{
+    plasma_psgeqrf_panel_t *panel = (plasma_psgeqrf_panel_t*)args;
+
+    int info = core_sgeqrt_panel(panel->A, panel->T, panel->ib,
+                                 rank, size, panel->work, barrier);
+    if (info != PlasmaSuccess)
+        panel->info = info;
+}
+
+/******************************************************************************/
+// Factors the tile column k of A, the geqrt of its diagonal tile and the
+// tsqrt of the tiles below, by one task, depending on all the tiles of the
+// column and of T, which runs core_sgeqrt_panel() on a team of
+// PlasmaNumPanelThreads, see plasma_team_run().
+static void plasma_psgeqrf_panel(plasma_context_t *plasma,
+                                 plasma_desc_t A, plasma_desc_t T, int k,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+
+    int count = A.mt-k;
+    float **tiles = (float**)
+        malloc(2*(size_t)count*sizeof(float*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    float **ttiles = &tiles[count];
+    for (int m = k; m < A.mt; m++) {
+        tiles[m-k] = A(m, k);
+        ttiles[m-k] = T(m, k);
+    }
+
+    #pragma omp task depend(iterator(int t = 0:count), inout:tiles[t][0]) \
+                     depend(iterator(int t = 0:count), out:ttiles[t][0]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("sgeqrf_panel", A(k, k));
+        int nvak = plasma_tile_nview(A, k);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            float *work = (float*)malloc(
+                (size_t)num_panel_threads*(ib+1)*nvak*
+                sizeof(float));
+            if (work == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                plasma_psgeqrf_panel_t panel = {
+                    plasma_desc_view(A, k*A.mb, k*A.nb,
+                                     A.m-k*A.mb, nvak),
+                    plasma_desc_view(T, k*T.mb, k*T.nb,
+                                     count*T.mb, nvak),
+                    ib, work, PlasmaSuccess
+                };
+                plasma_team_run(panel_team, panel_bind, num_panel_threads, 0,
+                                plasma_psgeqrf_panel_rank, &panel);
+                free(work);
+                if (panel.info != PlasmaSuccess) {
+                    plasma_error("core_sgeqrt_panel() failed");
+                    plasma_request_fail(sequence, request,
+                                        PlasmaErrorInternal);
+                }
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat,
+            2.0*(A.m-k*A.mb)*nvak*nvak - 2.0*nvak*nvak*nvak/3.0,
+            2.0*(A.m-k*A.mb)*nvak + (float)ib*nvak*count);
+        PLASMA_TRACE_STOP("sgeqrf_panel", 2, A(k, k), T(k, k));
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+    free(tiles);
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization - dynamic scheduling.
+ *  With PlasmaNumPanelThreads above 1, or the PlasmaPanelBind
+ *  PlasmaBindFast, each panel is factored by a team of threads, see
+ *  plasma_psgeqrf_panel(), instead of the chain of its tiles.
+ *  If B is not NULL, its tile columns are updated as trailing columns of A,
+ *  so that Q^T is applied to B as each panel completes.
+ **/
+static void plasma_psgeqrf_update(plasma_desc_t A, plasma_desc_t T,
+                                  plasma_desc_t *B,
+                                  plasma_workspace_t work,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
 {
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int lookahead = plasma->lookahead;
+    int team_panel = plasma->num_panel_threads > 1 ||
+                     plasma->panel_bind == PlasmaBindFast;
+
+    // matrix of a single process, statically scheduled
+    if (plasma_static_scheduling(plasma) && A.p*A.q <= 1) {
+        plasma_psgeqrf_static(A, T, B, work, sequence, request);
+        return;
+    }
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain(A, k);
-        core_omp_sgeqrt(
-            mvak, nvak, ib,
-            A(k, k), ldak,
-            T(k, k), T.mb,
-            work,
-            sequence, request);
+        if (team_panel) {
+            plasma_psgeqrf_panel(plasma, A, T, k, sequence, request);
+        }
+        else {
+            core_omp_sgeqrt(
+                mvak, nvak, ib,
+                A(k, k), ldak,
+                T(k, k), T.mb,
+                work, plasma->panel_blas_threads,
+                sequence, request);
+        }
+
+        // Read ahead the next panel of a mapped matrix.
+        plasma_desc_prefetch(A, k, A.mt-1, k+1, k+1, A(k, k));
 
         for (int n = k+1; n < A.nt; n++) {
             int nvan = plasma_tile_nview(A, n);
@@ -58,19 +353,57 @@ void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
                 work,
                 sequence, request);
         }
+        if (B != NULL) {
+            int mvbk = plasma_tile_mview(*B, k);
+            int ldbk = plasma_tile_mmain(*B, k);
+            for (int n = 0; n < B->nt; n++) {
+                int nvbn = plasma_tile_nview(*B, n);
+                core_omp_sormqr(
+                    PlasmaLeft, PlasmaTrans,
+                    mvbk, nvbn, imin(mvak, nvak), ib,
+                    A(k, k), ldak,
+                    T(k, k), T.mb,
+                    B(k, n), ldbk,
+                    work,
+                    sequence, request);
+            }
+        }
+        // Update the next lookahead columns along with the panel,
+        // and the rest of the trailing matrix after it.
+        int nla = imin(A.nt, k+1+lookahead);
         for (int m = k+1; m < A.mt; m++) {
             int mvam = plasma_tile_mview(A, m);
             int ldam = plasma_tile_mmain(A, m);
-            core_omp_stsqrt(
-                mvam, nvak, ib,
-                A(k, k), ldak,
-                A(m, k), ldam,
-                T(m, k), T.mb,
-                work,
-                sequence, request);
+            if (!team_panel) {
+                core_omp_stsqrt(
+                    mvam, nvak, ib,
+                    A(k, k), ldak,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
 
-            for (int n = k+1; n < A.nt; n++) {
+            for (int n = k+1; n < nla; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                plasma_tile_affinity(A, m, n);
+                core_omp_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            for (int n = nla; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
+                plasma_tile_affinity(A, m, n);
                 core_omp_stsmqr(
                     PlasmaLeft, PlasmaTrans,
                     A.mb, nvan, mvam, nvan, nvak, ib,
@@ -81,6 +414,49 @@ void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
                     work,
                     sequence, request);
             }
+            if (B != NULL) {
+                int ldbk = plasma_tile_mmain(*B, k);
+                int mvbm = plasma_tile_mview(*B, m);
+                int ldbm = plasma_tile_mmain(*B, m);
+                for (int n = 0; n < B->nt; n++) {
+                    int nvbn = plasma_tile_nview(*B, n);
+                    core_omp_stsmqr(
+                        PlasmaLeft, PlasmaTrans,
+                        B->mb, nvbn, mvbm, nvbn, nvak, ib,
+                        B(k, n), ldbk,
+                        B(m, n), ldbm,
+                        A(m, k), ldam,
+                        T(m, k), T.mb,
+                        work,
+                        sequence, request);
+                }
+            }
         }
     }
 }
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization - dynamic scheduling
+ * @see plasma_omp_sgeqrf
+ **/
+void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_psgeqrf_update(A, T, NULL, work, sequence, request);
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization fused with the application of Q^T to B.
+ *  The tile columns of B are updated as trailing columns of A, after the
+ *  lookahead columns, so that the reflectors of each panel are applied to B
+ *  while they are in cache, instead of in a second pass by plasma_psormqr.
+ *  B has as many tile rows as A.
+ * @see plasma_omp_sgels
+ **/
+void plasma_psgeqrf_rhs(plasma_desc_t A, plasma_desc_t T, plasma_desc_t B,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_psgeqrf_update(A, T, &B, work, sequence, request);
+}
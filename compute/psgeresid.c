@@ -0,0 +1,84 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgeresid.c, normal z -> s, Wed Oct 14 18:07:40 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define X(m, n) (float*)plasma_tile_addr(X, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define R(m, n) (float*)plasma_tile_addr(R, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile residual R = B - A*X of a general system, with the largest
+ *  absolute value of each column of R in values.
+ *  The last update of each tile of R also takes the maxima of its columns,
+ *  so that R is not read again for its norm.
+ *  work is of size R.mt*R.n.
+ ******************************************************************************/
+void plasma_psgeresid(plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, float *work, float *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int m = 0; m < R.mt; m++) {
+        int mvrm = plasma_tile_mview(R, m);
+        int ldam = plasma_tile_mmain(A, m);
+        int ldbm = plasma_tile_mmain(B, m);
+        int ldrm = plasma_tile_mmain(R, m);
+        for (int n = 0; n < R.nt; n++) {
+            int nvrn = plasma_tile_nview(R, n);
+            core_omp_slacpy(PlasmaGeneral,
+                            mvrm, nvrn,
+                            B(m, n), ldbm,
+                            R(m, n), ldrm,
+                            sequence, request);
+            for (int k = 0; k < A.nt; k++) {
+                int nvak = plasma_tile_nview(A, k);
+                int ldxk = plasma_tile_mmain(X, k);
+                if (k < A.nt-1) {
+                    core_omp_sgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvrm, nvrn, nvak,
+                        -1.0, A(m, k), ldam,
+                              X(k, n), ldxk,
+                        1.0,  R(m, n), ldrm,
+                        sequence, request);
+                }
+                else {
+                    core_omp_sgemm_samax(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvrm, nvrn, nvak,
+                        -1.0, A(m, k), ldam,
+                              X(k, n), ldxk,
+                        1.0,  R(m, n), ldrm,
+                        &work[R.n*m+n*R.nb],
+                        sequence, request);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+    core_omp_samax(PlasmaRowwise,
+                   R.n, R.mt,
+                   work, R.n,
+                   values,
+                   sequence, request);
+}
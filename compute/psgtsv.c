@@ -0,0 +1,166 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgtsv.c, normal z -> s, Wed Oct 14 19:29:16 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define B(m, n) ((float*)plasma_tile_addr(B, m, n))
+
+// element (i, j) of the reduced system in LAPACK band storage, kl = ku = 2
+#define R(i, j) R[4+(i)-(j) + 7*(size_t)(j)]
+
+/***************************************************************************//**
+ *  Parallel partitioned solve of a tridiagonal system, after the partitions,
+ *  the tile rows of B, are solved with their spikes VW.
+ *  Solves the reduced system of the first and last unknowns of the
+ *  partitions, of order 2*B.mt, then updates the partitions.
+ *  The workspace work is of size 2*B.mt*(7+B.n), iwork of size 2*B.mt.
+ **/
+void plasma_psgtsv_reduced(plasma_desc_t B, const float *VW,
+                           float *work, int *iwork,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // The reduced system couples all the partitions.
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int nr = 2*B.mt;
+    float *R = work;
+    float *Y = &work[7*nr];
+
+    if (PLASMA_TRACE_RUN(sequence)) {
+        // Unknowns 2*i and 2*i+1 are the first and last ones of partition i,
+        // coupled to the last one of partition i-1 and the first one of
+        // partition i+1 by its spikes.
+        for (size_t i = 0; i < 7*(size_t)nr; i++)
+            R[i] = 0.0;
+        for (int i = 0; i < B.mt; i++) {
+            int mvbi = plasma_tile_mview(B, i);
+            int ldbi = plasma_tile_mmain(B, i);
+            const float *V = &VW[2*i*B.mb];
+            const float *W = &V[mvbi];
+
+            R(2*i, 2*i) = 1.0;
+            R(2*i+1, 2*i+1) = 1.0;
+            if (mvbi > 1) {
+                if (i < B.mt-1) {
+                    R(2*i,   2*i+2) = V[0];
+                    R(2*i+1, 2*i+2) = V[mvbi-1];
+                }
+                if (i > 0) {
+                    R(2*i,   2*i-1) = W[0];
+                    R(2*i+1, 2*i-1) = W[mvbi-1];
+                }
+            }
+            else {
+                // A partition of one row: its last unknown is the first.
+                if (i < B.mt-1)
+                    R(2*i, 2*i+2) = V[0];
+                if (i > 0)
+                    R(2*i, 2*i-1) = W[0];
+                R(2*i+1, 2*i) = -1.0;
+            }
+            for (int j = 0; j < B.nt; j++) {
+                int nvbj = plasma_tile_nview(B, j);
+                float *bij = B(i, j);
+                for (int k = 0; k < nvbj; k++) {
+                    size_t col = (size_t)(j*B.nb+k)*nr;
+                    Y[2*i   + col] = bij[k*ldbi];
+                    Y[2*i+1 + col] = mvbi > 1 ? bij[mvbi-1 + k*ldbi] : 0.0;
+                }
+            }
+        }
+        int info = core_sgbsv(nr, 2, 2, B.n, R, 7, iwork, Y, nr);
+        if (info != 0) {
+            int i = (info-1)/2;
+            int row = i*B.mb + ((info-1)%2 == 0 ? 0 :
+                                plasma_tile_mview(B, i)-1);
+            plasma_request_fail(sequence, request, row+1);
+            return;
+        }
+    }
+
+    // Update the partitions with the unknowns of their neighbours.
+    for (int i = 0; i < B.mt; i++) {
+        int mvbi = plasma_tile_mview(B, i);
+        int ldbi = plasma_tile_mmain(B, i);
+        const float *V = &VW[2*i*B.mb];
+        const float *W = &V[mvbi];
+        for (int j = 0; j < B.nt; j++) {
+            int nvbj = plasma_tile_nview(B, j);
+            size_t col = (size_t)j*B.nb*nr;
+            if (i < B.mt-1)
+                core_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                               mvbi, nvbj, 1,
+                               -1.0, V, mvbi,
+                                     &Y[2*i+2 + col], nr,
+                               1.0,  B(i, j), ldbi,
+                               sequence, request);
+            if (i > 0)
+                core_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                               mvbi, nvbj, 1,
+                               -1.0, W, mvbi,
+                                     &Y[2*i-1 + col], nr,
+                               1.0,  B(i, j), ldbi,
+                               sequence, request);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel partitioned solve of a tridiagonal system, a SPIKE algorithm.
+ *  The partitions are the tile rows of B, factored and solved independently,
+ *  the right hand sides by tiles. The workspace work is of size
+ *  3*B.m + 2*B.mt*(7+B.n), iwork of size B.m + 2*B.mt.
+ **/
+void plasma_psgtsv(float *dl, float *d,
+                   float *du, plasma_desc_t B,
+                   float *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    float *VW  = work;
+    float *du2 = &work[2*B.m];
+    int *ipiv = iwork;
+
+    for (int i = 0; i < B.mt; i++) {
+        int s = i*B.mb;
+        int mvbi = plasma_tile_mview(B, i);
+        int ldbi = plasma_tile_mmain(B, i);
+
+        // The couplings are not overwritten by the factorizations.
+        float dl0 = i > 0 ? dl[s-1] : 0.0;
+        float dun = i < B.mt-1 ? du[s+mvbi-1] : 0.0;
+        core_omp_sgttrf_spike(mvbi, &dl[s], &d[s], &du[s], &du2[s], &ipiv[s],
+                              dl0, dun, &VW[2*s],
+                              s, sequence, request);
+
+        for (int j = 0; j < B.nt; j++) {
+            int nvbj = plasma_tile_nview(B, j);
+            core_omp_sgttrs(mvbi, nvbj,
+                            &dl[s], &d[s], &du[s], &du2[s], &ipiv[s],
+                            B(i, j), ldbi,
+                            sequence, request);
+        }
+    }
+    plasma_psgtsv_reduced(B, VW, &work[3*B.m], &iwork[B.m],
+                          sequence, request);
+}
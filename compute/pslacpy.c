@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzlacpy.c, normal z -> s, Mon Feb  6 14:06:16 2017
+ * @generated from compute/pzlacpy.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
@@ -30,6 +31,93 @@ void plasma_pslacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Pack, unpack or repack the tiles, one task per tile.
+    if (A.rate > 0 || B.rate > 0) {
+        for (int n = 0; n < A.nt; n++) {
+            int m0 = uplo == PlasmaLower ? n : 0;
+            int m1 = uplo == PlasmaUpper ? imin(n+1, A.mt) : A.mt;
+            int nvan = plasma_tile_nview(A, n);
+            for (int m = m0; m < m1; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                int ldbm = plasma_tile_mmain(B, m);
+                plasma_enum_t tuplo = m == n ? uplo : PlasmaGeneral;
+                if (A.rate > 0 && B.rate > 0)
+                    core_omp_srepack(
+                        tuplo, mvam, nvan,
+                        (unsigned char*)plasma_tile_addr(A, m, n), ldam,
+                        A.rate,
+                        (unsigned char*)plasma_tile_addr(B, m, n), ldbm,
+                        B.rate,
+                        sequence, request);
+                else if (A.rate > 0)
+                    core_omp_sunpack(
+                        tuplo, mvam, nvan,
+                        (unsigned char*)plasma_tile_addr(A, m, n), ldam,
+                        A.rate,
+                        B(m, n), ldbm,
+                        sequence, request);
+                else
+                    core_omp_spack(
+                        tuplo, mvam, nvan,
+                        A(m, n), ldam, B.rate,
+                        (unsigned char*)plasma_tile_addr(B, m, n), ldbm,
+                        sequence, request);
+            }
+        }
+        return;
+    }
+
+    // Submit one task per tile column, copying its tiles in a taskloop.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_column_sweep(plasma, A.mt)) {
+        float **tiles = (float**)
+            malloc((size_t)2*A.mt*sizeof(float*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        float **atiles = tiles;
+        float **btiles = tiles+A.mt;
+        for (int n = 0; n < A.nt; n++) {
+            int m0 = uplo == PlasmaLower ? n : 0;
+            int m1 = uplo == PlasmaUpper ? imin(n+1, A.mt) : A.mt;
+            if (m0 >= m1)
+                continue;
+
+            int count = m1-m0;
+            for (int m = m0; m < m1; m++) {
+                atiles[m-m0] = A(m, n);
+                btiles[m-m0] = B(m, n);
+            }
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:atiles[t][0]) \
+                             depend(iterator(int t = 0:count), \
+                                    out:btiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int m = m0; m < m0+count; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int nvan = plasma_tile_nview(A, n);
+                    PLASMA_TRACE_START("slacpy", B(m, n));
+                    if (PLASMA_TRACE_RUN(sequence))
+                        core_slacpy(m == n ? uplo : PlasmaGeneral,
+                                    mvam, nvan,
+                                    A(m, n), plasma_tile_mmain(A, m),
+                                    B(m, n), plasma_tile_mmain(B, m));
+                    PLASMA_TRACE_FLOPS(PlasmaRealFloat, 0.0,
+                                       2.0*mvam*nvan);
+                    PLASMA_TRACE_STOP("slacpy", 1, B(m, n), A(m, n));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
     switch (uplo) {
     //==============
     // PlasmaUpper
@@ -0,0 +1,64 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzlacpy_sym.c, normal z -> s, Thu Oct 15 03:32:30 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile expansion of the symmetric (trans = PlasmaConjTrans) or
+ *  symmetric (trans = PlasmaTrans) matrix A, stored in its uplo triangle,
+ *  to the full matrix. Each tile outside of the triangle is overwritten by
+ *  op( A ) of its transposed tile, and the diagonal tiles are completed,
+ *  so that A can be used by the general routines. A must store all of its
+ *  tiles, as a general tile matrix.
+ ******************************************************************************/
+void plasma_pslacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                        plasma_desc_t A,
+                        plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int n = 0; n < A.nt; n++) {
+        int mvan = plasma_tile_mview(A, n);
+        int ldan = plasma_tile_mmain(A, n);
+        core_omp_slacpy_sym(uplo, trans,
+                            mvan, A(n, n), ldan,
+                            sequence, request);
+
+        for (int m = n+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            if (uplo == PlasmaLower) {
+                core_omp_slacpy_trans(trans,
+                                      mvan, mvam,
+                                      A(m, n), ldam,
+                                      A(n, m), ldan,
+                                      sequence, request);
+            }
+            else {
+                core_omp_slacpy_trans(trans,
+                                      mvam, mvan,
+                                      A(n, m), ldan,
+                                      A(m, n), ldam,
+                                      sequence, request);
+            }
+        }
+    }
+}
@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzlascl.c, normal z -> s, Mon Feb  6 14:06:18 2017
+ * @generated from compute/pzlascl.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
@@ -28,6 +29,47 @@ void plasma_pslascl(plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Submit one task per tile column, scaling its tiles in a taskloop.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_column_sweep(plasma, A.mt)) {
+        float **tiles = (float**)
+            malloc((size_t)A.mt*sizeof(float*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        for (int n = 0; n < A.nt; n++) {
+            int m0 = uplo == PlasmaLower ? n : 0;
+            int m1 = uplo == PlasmaUpper ? imin(n+1, A.mt) : A.mt;
+            if (m0 >= m1)
+                continue;
+
+            int count = m1-m0;
+            for (int m = m0; m < m1; m++)
+                tiles[m-m0] = A(m, n);
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    inout:tiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int m = m0; m < m0+count; m++) {
+                    PLASMA_TRACE_START("slascl", A(m, n));
+                    if (PLASMA_TRACE_RUN(sequence))
+                        core_slascl(m == n ? uplo : PlasmaGeneral,
+                                    cfrom, cto,
+                                    plasma_tile_mview(A, m),
+                                    plasma_tile_nview(A, n),
+                                    A(m, n), plasma_tile_mmain(A, m));
+                    PLASMA_TRACE_STOP("slascl", 1, A(m, n));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
     switch (uplo) {
     //==============
     // PlasmaUpper
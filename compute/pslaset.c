@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzlaset.c, normal z -> s, Mon Feb  6 14:06:18 2017
+ * @generated from compute/pzlaset.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -20,11 +20,65 @@
 
 #define A(m, n) ((float*)plasma_tile_addr(A, m, n))
 
+/******************************************************************************/
+// Returns the number of rows of the submatrix in the tile row i.
+static int plasma_pslaset_rows(plasma_desc_t A, int i)
+{
+    if (i == 0 && i == A.mt-1)
+        return A.m;
+    else if (i == 0)
+        return A.mb-A.i%A.mb;
+    else if (i == A.mt-1)
+        return (A.i+A.m+A.mb-1)%A.mb+1;
+    else
+        return A.mb;
+}
+
+/******************************************************************************/
+// Returns the number of columns of the submatrix in the tile column j.
+static int plasma_pslaset_cols(plasma_desc_t A, int j)
+{
+    if (j == 0 && j == A.nt-1)
+        return A.n;
+    else if (j == 0)
+        return A.nb-A.j%A.nb;
+    else if (j == A.nt-1)
+        return (A.j+A.n+A.nb-1)%A.nb+1;
+    else
+        return A.nb;
+}
+
+/******************************************************************************/
+// Tags the tile (i, j) of the uplo part of A with the structure laset
+// leaves it in.
+static void plasma_pslaset_structure(plasma_enum_t uplo,
+                                     float alpha,
+                                     float beta,
+                                     plasma_desc_t A, int i, int j)
+{
+    // Only the uplo triangle of a diagonal tile is set.
+    plasma_enum_t structure = PlasmaTileDense;
+    if (i != j || uplo == PlasmaGeneral) {
+        if (alpha == 0.0 && (i != j || beta == 0.0))
+            structure = PlasmaTileZero;
+        else if (alpha == 0.0 && beta == 1.0 &&
+                 plasma_tile_mview(A, i) == plasma_tile_nview(A, j))
+            structure = PlasmaTileIdentity;
+    }
+
+    plasma_tile_structure_set(A, i, j, structure);
+}
+
 /***************************************************************************//**
  *  Initializes the matrix A to beta on the diagonal and alpha on the
  *  offdiagonals. Applies alpha correctly for any shape of the submatrix
  *  described by A, but applies beta correctly only for submatrices aligned
  *  with the diagonal of the main matrix (A.i = A.j).
+ *  With PlasmaColumnSweep, submits one task per tile column, setting its
+ *  tiles in a taskloop. With A fresh zero storage and alpha = 0, only the
+ *  diagonal tiles are set, if beta is not 0.
+ *  The tiles of A with structure tags are tagged zero or identity.
+ * @see plasma_desc_general_zero_create
  **/
 void plasma_pslaset(plasma_enum_t uplo,
                     float alpha, float beta,
@@ -35,45 +89,78 @@ void plasma_pslaset(plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
-    int i, j;
-    int m, n;
-
     int lm1 = A.gm/A.mb;
     int ln1 = A.gn/A.nb;
 
-    for (i = 0; i < A.mt; i++) {
-        if (i == 0 && i == A.mt-1)
-            m = A.m;
-        else if (i == 0)
-            m = A.mb-A.i%A.mb;
-        else if (i == A.mt-1)
-            m = (A.i+A.m+A.mb-1)%A.mb+1;
-        else
-            m = A.mb;
+    // The offdiagonal tiles of fresh zero storage are already alpha = 0.
+    int fresh = A.zero && alpha == 0.0;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (!fresh && plasma_column_sweep(plasma, A.mt)) {
+        float **tiles = (float**)
+            malloc((size_t)A.mt*sizeof(float*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        for (int j = 0; j < A.nt; j++) {
+            int i0 = uplo == PlasmaLower ? j : 0;
+            int i1 = uplo == PlasmaUpper ? imin(j+1, A.mt) : A.mt;
+            if (i0 >= i1)
+                continue;
+
+            int count = i1-i0;
+            for (int i = i0; i < i1; i++) {
+                tiles[i-i0] = A(i, j);
+                plasma_pslaset_structure(uplo, alpha, beta, A, i, j);
+            }
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    out:tiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int i = i0; i < i0+count; i++) {
+                    int mb = A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb;
+                    int ioff = i == 0 ? A.i%A.mb : 0;
+                    int joff = j == 0 ? A.j%A.nb : 0;
+                    PLASMA_TRACE_START("slaset", A(i, j));
+                    core_slaset(i == j ? uplo : PlasmaGeneral,
+                                plasma_pslaset_rows(A, i),
+                                plasma_pslaset_cols(A, j),
+                                alpha, i != j ? alpha : beta,
+                                A(i, j)+ioff+joff*mb, mb);
+                    PLASMA_TRACE_STOP("slaset", 1, A(i, j));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
+    for (int i = 0; i < A.mt; i++) {
+        int m = plasma_pslaset_rows(A, i);
+        for (int j = 0; j < A.nt; j++) {
+            int n = plasma_pslaset_cols(A, j);
+            if ((uplo == PlasmaLower && i < j) ||
+                (uplo == PlasmaUpper && i > j))
+                continue;
 
-        for (j = 0; j < A.nt; j++) {
-            if (j == 0 && j == A.nt-1)
-                n = A.n;
-            else if (j == 0)
-                n = A.nb-A.j%A.nb;
-            else if (j == A.nt-1)
-                n = (A.j+A.n+A.nb-1)%A.nb+1;
-            else
-                n = A.nb;
+            plasma_pslaset_structure(uplo, alpha, beta, A, i, j);
+            if (fresh && (i != j || beta == 0.0))
+                continue;
 
-            if (uplo == PlasmaGeneral ||
-                (uplo == PlasmaLower && i >= j) ||
-                (uplo == PlasmaUpper && i <= j))
-                core_omp_slaset(i == j ? uplo : PlasmaGeneral,
-                                A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb,
-                                A.j/A.nb+j == ln1 ? A.gn-ln1*A.nb : A.nb,
-                                i == 0 ? A.i%A.mb : 0,
-                                j == 0 ? A.j%A.nb : 0,
-                                m,
-                                n,
-                                alpha,
-                                i != j ? alpha : beta,
-                                A(i, j));
+            core_omp_slaset(i == j ? uplo : PlasmaGeneral,
+                            A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb,
+                            A.j/A.nb+j == ln1 ? A.gn-ln1*A.nb : A.nb,
+                            i == 0 ? A.i%A.mb : 0,
+                            j == 0 ? A.j%A.nb : 0,
+                            m,
+                            n,
+                            alpha,
+                            i != j ? alpha : beta,
+                            A(i, j));
         }
     }
 }
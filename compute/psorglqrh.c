@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzunglqrh.c, normal z -> s, Mon Feb  6 14:06:24 2017
+ * @generated from compute/pzunglqrh.c, normal z -> s, Wed Oct 14 17:34:53 2026
  *
  **/
 
@@ -37,10 +37,12 @@ void plasma_psorglqrh(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
 
     // Precompute order of LQ operations - compute it as for QR
     // and transpose it.
+    plasma_context_t *plasma = plasma_context_self();
     int *operations = NULL;
     int num_operations;
     // Transpose m and n to reuse the QR tree.
-    plasma_rh_tree_operations(A.nt, A.mt, &operations, &num_operations);
+    plasma_rh_tree_operations(plasma, A.nt, A.mt,
+                              &operations, &num_operations);
 
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
@@ -119,5 +121,5 @@ void plasma_psorglqrh(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
         }
     }
 
-    free(operations);
+    plasma_rh_tree_release(plasma, operations);
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pzunmqr.c, normal z -> s, Mon Feb  6 14:06:25 2017
+ * @generated from compute/pzunmqr.c, normal z -> s, Thu Oct 15 10:57:57 2026
  *
  **/
 
@@ -18,12 +18,189 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <stdlib.h>
+
 #define A(m, n) (float*)plasma_tile_addr(A, m, n)
 #define T(m, n) (float*)plasma_tile_addr(T, m, n)
 #define B(m, n) (float*)plasma_tile_addr(B, m, n)
 
+/******************************************************************************/
+// Applies the reflectors of the diagonal tile of the tile column k of A
+// to the tile row (left) or column (right) k of B.
+static void plasma_psormqr_diag(plasma_enum_t side, plasma_enum_t trans,
+                                plasma_desc_t A, plasma_desc_t T,
+                                plasma_desc_t B, int k,
+                                plasma_workspace_t work,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    if (side == PlasmaLeft) {
+        int mvbk = plasma_tile_mview(B, k);
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            core_omp_sormqr(
+                side, trans,
+                mvbk, nvbn, imin(nvak, mvak), ib,
+                A(k, k), ldak,
+                T(k, k), T.mb,
+                B(k, n), ldbk,
+                work,
+                sequence, request);
+        }
+    }
+    else {
+        int nvbk = plasma_tile_nview(B, k);
+        for (int m = 0; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            core_omp_sormqr(
+                side, trans,
+                mvbm, nvbk, imin(nvak, mvak), ib,
+                A(k, k), ldak,
+                T(k, k), T.mb,
+                B(m, k), ldbm,
+                work,
+                sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the TS reflectors of the tiles m0 to m0+count-1 of the tile
+// column k of A as one block, its T factor merged once into Tg, to each
+// tile column (left) or row (right) of B.
+static void plasma_psormqr_block(plasma_enum_t side, plasma_enum_t trans,
+                                 plasma_desc_t A, plasma_desc_t T,
+                                 plasma_desc_t B, int k, int m0, int count,
+                                 float *Tg, int ldtg,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int nvak = plasma_tile_nview(A, k);
+    int l[PlasmaHouseholderMaxGroup], ldv[PlasmaHouseholderMaxGroup];
+    float *V[PlasmaHouseholderMaxGroup];
+    float *Tb[PlasmaHouseholderMaxGroup];
+    for (int i = 0; i < count; i++) {
+        int m = m0+i;
+        l[i] = side == PlasmaLeft ? plasma_tile_mview(B, m)
+                                  : plasma_tile_nview(B, m);
+        ldv[i] = plasma_tile_mmain(A, m);
+        V[i] = A(m, k);
+        Tb[i] = T(m, k);
+    }
+    core_omp_slarft_group(PlasmaColumnwise, count, nvak, T.mb,
+                          l, V, ldv,
+                          Tb, T.mb,
+                          Tg, ldtg,
+                          sequence, request);
+
+    int lda2[PlasmaHouseholderMaxGroup];
+    float *A2[PlasmaHouseholderMaxGroup];
+    if (side == PlasmaLeft) {
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            for (int i = 0; i < count; i++) {
+                A2[i] = B(m0+i, n);
+                lda2[i] = plasma_tile_mmain(B, m0+i);
+            }
+            core_omp_sparfb_group(
+                side, trans, PlasmaColumnwise,
+                count, B.mb, nvbn, l, nvak,
+                B(k, n), ldbk,
+                A2, lda2,
+                V,  ldv,
+                Tg, ldtg,
+                sequence, request);
+        }
+    }
+    else {
+        for (int m = 0; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            for (int i = 0; i < count; i++) {
+                A2[i] = B(m, m0+i);
+                lda2[i] = ldbm;
+            }
+            core_omp_sparfb_group(
+                side, trans, PlasmaColumnwise,
+                count, mvbm, B.nb, l, nvak,
+                B(m, k), ldbm,
+                A2, lda2,
+                V,  ldv,
+                Tg, ldtg,
+                sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies Q or Q^T with the TS reflectors of each tile column of A merged
+// in blocks of group tiles, see plasma_householder_group(). The merged T
+// factors of the tile columns alternate between two sets, so that those
+// of the tile column k+2 wait for the blocks of k to be applied, freed
+// after a taskwait. Returns 0, without submitting tasks, if the T factors
+// cannot be allocated.
+static int plasma_psormqr_grouped(plasma_enum_t side, plasma_enum_t trans,
+                                  plasma_desc_t A, plasma_desc_t T,
+                                  plasma_desc_t B, int group,
+                                  plasma_workspace_t work,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int tiles = side == PlasmaLeft ? B.mt : B.nt;
+    int blocks = (tiles-1+group-1)/group;
+    if (blocks <= 0)
+        return 0;
+
+    int ldtg = group*A.nb;
+    size_t size = (size_t)ldtg*ldtg;
+    float *Tg = (float*)malloc(
+        2*blocks*size*sizeof(float));
+    if (Tg == NULL)
+        return 0;
+
+    // Q^T from the left and Q from the right start from the first tile.
+    int forward = (side == PlasmaLeft) == (trans == PlasmaTrans);
+    int kt = imin(A.mt, A.nt);
+    for (int i = 0; i < kt; i++) {
+        int k = forward ? i : kt-1-i;
+        int nblocks = (tiles-1-k+group-1)/group;
+        float *Tk = &Tg[(k%2)*blocks*size];
+        if (forward) {
+            plasma_psormqr_diag(side, trans, A, T, B, k, work,
+                                sequence, request);
+        }
+        for (int j = 0; j < nblocks; j++) {
+            int b = forward ? j : nblocks-1-j;
+            int m0 = k+1+b*group;
+            plasma_psormqr_block(side, trans, A, T, B,
+                                 k, m0, imin(group, tiles-m0),
+                                 &Tk[b*size], ldtg,
+                                 sequence, request);
+        }
+        if (!forward) {
+            plasma_psormqr_diag(side, trans, A, T, B, k, work,
+                                sequence, request);
+        }
+    }
+
+    // Free the merged T factors after their last readers, even if
+    // the sequence cancelled them.
+    #pragma omp taskwait
+    free(Tg);
+    return 1;
+}
+
 /***************************************************************************//**
  *  Parallel application of Q using tile V - QR factorization
+ *  With PlasmaHouseholderGroup above 1, the TS reflectors are applied in
+ *  blocks of tiles, see plasma_psormqr_grouped().
  * @see plasma_omp_sgeqrs
  **/
 void plasma_psormqr(plasma_enum_t side, plasma_enum_t trans,
@@ -35,6 +212,14 @@ void plasma_psormqr(plasma_enum_t side, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Merge the TS reflectors of the tile columns into blocks.
+    plasma_context_t *plasma = plasma_context_self();
+    int group = plasma_householder_group(plasma);
+    if (group > 1 &&
+        plasma_psormqr_grouped(side, trans, A, T, B, group, work,
+                               sequence, request))
+        return;
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
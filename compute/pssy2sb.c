@@ -0,0 +1,244 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzhe2hb.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define T(m, n) (float*)plasma_tile_addr(T, m, n)
+
+/***************************************************************************//**
+ *  Fills the triangle of the tiles of A opposite to uplo, so that both
+ *  triangles of the symmetric matrix are stored.
+ **/
+static void plasma_pssy2sb_fill(plasma_enum_t uplo, plasma_desc_t A,
+                                plasma_sequence_t *sequence)
+{
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        int ldan = plasma_tile_mmain(A, n);
+        float *ann = A(n, n);
+
+        #pragma omp task depend(inout:ann[0:ldan*nvan]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            PLASMA_TRACE_START("zhe2ge", ann);
+            if (PLASMA_TRACE_RUN(sequence)) {
+                for (int j = 0; j < nvan; j++) {
+                    ann[j + j*ldan] = creal(ann[j + j*ldan]);
+                    for (int i = j+1; i < nvan; i++) {
+                        if (uplo == PlasmaLower)
+                            ann[j + i*ldan] = (ann[i + j*ldan]);
+                        else
+                            ann[i + j*ldan] = (ann[j + i*ldan]);
+                    }
+                }
+            }
+            PLASMA_TRACE_STOP("zhe2ge", 1, ann);
+        }
+
+        for (int m = n+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            float *amn = A(m, n);
+            float *anm = A(n, m);
+
+            // A(m, n) = A(n, m)^T, or the other way round.
+            if (uplo == PlasmaLower) {
+                #pragma omp task depend(in:amn[0:ldam*nvan]) \
+                                 depend(out:anm[0:ldan*mvam]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("zhe2ge", anm);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        for (int j = 0; j < nvan; j++)
+                            for (int i = 0; i < mvam; i++)
+                                anm[j + i*ldan] = (amn[i + j*ldam]);
+                    }
+                    PLASMA_TRACE_STOP("zhe2ge", 1, anm, amn);
+                }
+            }
+            else {
+                #pragma omp task depend(in:anm[0:ldan*mvam]) \
+                                 depend(out:amn[0:ldam*nvan]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("zhe2ge", amn);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        for (int j = 0; j < nvan; j++)
+                            for (int i = 0; i < mvam; i++)
+                                amn[i + j*ldam] = (anm[j + i*ldan]);
+                    }
+                    PLASMA_TRACE_STOP("zhe2ge", 1, amn, anm);
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Copies the lower band of tile column k of A, from its diagonal tile and
+ *  the upper triangle of the tile below, to AB in LAPACK band storage.
+ **/
+static void plasma_pssy2sb_copy(plasma_desc_t A, int k, int kd,
+                                float *AB, int ldab,
+                                plasma_sequence_t *sequence)
+{
+    int k1 = imin(k+1, A.mt-1);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldak1 = plasma_tile_mmain(A, k1);
+    float *akk = A(k, k);
+    float *ak1 = A(k1, k);
+    float *abk = &AB[(size_t)k*A.nb*ldab];
+
+    #pragma omp task depend(in:akk[0:ldak*nvak]) \
+                     depend(in:ak1[0:ldak1*nvak]) \
+                     depend(out:abk[0:ldab*nvak]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("slacpy", abk);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            for (int j = 0; j < nvak; j++) {
+                int jg = k*A.nb+j;
+                for (int ig = jg; ig <= imin(A.n-1, jg+kd); ig++) {
+                    int i = ig-k*A.nb;
+                    abk[ig-jg + j*ldab] = i < A.mb ? akk[i + j*ldak]
+                                                   : ak1[i-A.mb + j*ldak1];
+                }
+            }
+        }
+        PLASMA_TRACE_STOP("slacpy", 1, abk, akk, ak1);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel reduction of a symmetric matrix A to band form of bandwidth nb,
+ *  Q^T A Q = B, the first stage of the two-stage reduction to tridiagonal.
+ *
+ *  Both triangles of A are kept up to date, after filling the triangle
+ *  opposite to uplo, so each block of reflectors is applied from both sides
+ *  by the unmqr and tsmqr kernels of the QR factorization. Step k factors
+ *  A(k+1:mt-1, k) as plasma_psgeqrf factors a panel, and applies each block
+ *  of reflectors to the tile rows and the tile columns of A(k+1:mt-1,
+ *  k+1:nt-1) it touches. Row k is not updated, as it is not read again.
+ *
+ *  The reflectors are left below the band, so Q is the Q of the QR
+ *  factorization of A(nb:n-1, 0:n-nb-1), with the tiles of T from the
+ *  second tile row on. The lower band of B is copied to AB in LAPACK band
+ *  storage, with kd = min(nb, n-1), as each tile column is done.
+ * @see plasma_omp_ssy2sb
+ **/
+void plasma_pssy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                    float *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+    int kd = imin(A.nb, A.n-1);
+
+    plasma_pssy2sb_fill(uplo, A, sequence);
+
+    for (int k = 0; k < A.nt-1; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int nvak = plasma_tile_nview(A, k);
+        int mvak1 = plasma_tile_mview(A, k+1);
+        int ldak1 = plasma_tile_mmain(A, k+1);
+        core_omp_sgeqrt(
+            mvak1, nvak, ib,
+            A(k+1, k), ldak1,
+            T(k+1, k), T.mb,
+            work, plasma->panel_blas_threads,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_sormqr(
+                PlasmaLeft, PlasmaTrans,
+                mvak1, nvan, imin(mvak1, nvak), ib,
+                A(k+1, k), ldak1,
+                T(k+1, k), T.mb,
+                A(k+1, n), ldak1,
+                work,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_sormqr(
+                PlasmaRight, PlasmaNoTrans,
+                mvam, mvak1, imin(mvak1, nvak), ib,
+                A(k+1, k), ldak1,
+                T(k+1, k), T.mb,
+                A(m, k+1), ldam,
+                work,
+                sequence, request);
+        }
+
+        for (int m = k+2; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_stsqrt(
+                mvam, nvak, ib,
+                A(k+1, k), ldak1,
+                A(m, k), ldam,
+                T(m, k), T.mb,
+                work,
+                sequence, request);
+
+            // Tile rows k+1 and m.
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k+1, n), ldak1,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+            // Tile columns k+1 and m.
+            for (int j = k+1; j < A.mt; j++) {
+                int mvaj = plasma_tile_mview(A, j);
+                int ldaj = plasma_tile_mmain(A, j);
+                core_omp_stsmqr(
+                    PlasmaRight, PlasmaNoTrans,
+                    mvaj, A.nb, mvaj, mvam, nvak, ib,
+                    A(j, k+1), ldaj,
+                    A(j, m), ldaj,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+        plasma_pssy2sb_copy(A, k, kd, AB, ldab, sequence);
+    }
+    plasma_pssy2sb_copy(A, A.nt-1, kd, AB, ldab, sequence);
+}
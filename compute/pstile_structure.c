@@ -0,0 +1,60 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztile_structure.c, normal z -> s, Thu Oct 15 06:45:04 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tagging of the tiles of A with their structure, one task per
+ *  tile, for A with tags from plasma_desc_tile_structure_create.
+ *  The tasks write the tags when they run, while plasma_pstrsm and
+ *  plasma_psgemm read them when they submit their tasks, so the tasks are
+ *  waited for in between. Packed tiles and tiles of other precisions are
+ *  tagged dense.
+ **/
+void plasma_pstile_structure(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (A.tile_structure == NULL)
+        return;
+
+    for (int m = 0; m < A.mt; m++) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        for (int n = 0; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            if (A.rate > 0 || !plasma_tile_stored(A, m, n) ||
+                !plasma_tile_whole(A, m, n) ||
+                plasma_tile_precision(A, m, n) != A.precision) {
+                plasma_tile_structure_set(A, m, n, PlasmaTileDense);
+                continue;
+            }
+            int mm = m + A.it;
+            int nn = n + A.jt;
+            core_omp_stile_structure(
+                mvam, nvan, A(m, n), ldam,
+                &A.tile_structure[mm + (size_t)A.gmt*nn],
+                sequence, request);
+        }
+    }
+}
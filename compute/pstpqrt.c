@@ -0,0 +1,78 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztpqrt.c, normal z -> s, Thu Oct 15 04:46:20 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define R(m, n) (float*)plasma_tile_addr(R, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define T(m, n) (float*)plasma_tile_addr(T, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile update of the QR factorization R with the rows of B.
+ *  The tile rows of B are eliminated against the diagonal tile of each
+ *  tile column of R in a flat tree, and the reflectors applied to the tiles
+ *  of R and B right of it.
+ * @see plasma_omp_stpqrt
+ **/
+void plasma_pstpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    for (int k = 0; k < R.nt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvrk = plasma_tile_mview(R, k);
+        int nvrk = plasma_tile_nview(R, k);
+        int ldrk = plasma_tile_mmain(R, k);
+        for (int m = 0; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            core_omp_stsqrt(
+                mvbm, nvrk, ib,
+                R(k, k), ldrk,
+                B(m, k), ldbm,
+                T(m, k), T.mb,
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < R.nt; n++) {
+                int nvrn = plasma_tile_nview(R, n);
+                core_omp_stsmqr(
+                    PlasmaLeft, PlasmaTrans,
+                    mvrk, nvrn, mvbm, nvrn, nvrk, ib,
+                    R(k, n), ldrk,
+                    B(m, n), ldbm,
+                    B(m, k), ldbm,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/pztrsm.c, normal z -> s, Mon Feb  6 14:06:23 2017
+ * @generated from compute/pztrsm.c, normal z -> s, Thu Oct 15 06:45:04 2026
  *
  **/
 
@@ -21,20 +21,30 @@
 #define A(m, n) (float*)plasma_tile_addr(A, m, n)
 #define B(m, n) (float*)plasma_tile_addr(B, m, n)
 
+/******************************************************************************/
+// Returns 1 if the update of B(m, n) by the product of two tiles of the
+// structures x and y, scaling B(m, n) by beta, is a no-op, as the product
+// is zero, and beta is 1 or B(m, n) is zero.
+static int plasma_pstrsm_skip(plasma_enum_t x, plasma_enum_t y,
+                              float beta,
+                              plasma_desc_t B, int m, int n)
+{
+    return (x == PlasmaTileZero || y == PlasmaTileZero) &&
+           (beta == 1.0 || plasma_tile_structure(B, m, n) == PlasmaTileZero);
+}
+
 /***************************************************************************//**
- * Parallel tile triangular solve.
- * @see plasma_omp_strsm
+ * Parallel tile triangular solve of all of B, for plasma_pstrsm.
+ * The solves of zero tiles of B, and the updates by zero tiles of A or B,
+ * are skipped, for B with structure tags.
  ******************************************************************************/
-void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
-                   plasma_enum_t trans, plasma_enum_t diag,
-                   float alpha, plasma_desc_t A,
-                                             plasma_desc_t B,
-                   plasma_sequence_t *sequence, plasma_request_t *request)
+static void plasma_pstrsm_panel(plasma_enum_t side, plasma_enum_t uplo,
+                                plasma_enum_t trans, plasma_enum_t diag,
+                                float alpha, plasma_desc_t A,
+                                                          plasma_desc_t B,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
-        return;
-
     if (side == PlasmaLeft) {
         if (uplo == PlasmaUpper) {
             //===========================================
@@ -48,18 +58,29 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     float lalpha = k == 0 ? alpha : 1.0;
                     for (int n = 0; n < B.nt; n++) {
                         int nvbn = plasma_tile_nview(B, n);
+                        if (plasma_tile_structure(B, B.mt-k-1, n) ==
+                            PlasmaTileZero)
+                            continue;
                         core_omp_strsm(
                             side, uplo, trans, diag,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1, n       ), ldbk,
                             sequence, request);
+                        plasma_tile_structure_set(B, B.mt-k-1, n,
+                                                  PlasmaTileDense);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int ldam = plasma_tile_mmain(A, B.mt-1-m);
                         int ldbm = plasma_tile_mmain(B, B.mt-1-m);
                         for (int n = 0; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(A, B.mt-1-m,
+                                                             B.mt-k-1),
+                                    plasma_tile_structure(B, B.mt-k-1, n),
+                                    lalpha, B, B.mt-1-m, n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 B.mb, nvbn, mvbk,
@@ -67,6 +88,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         B(B.mt-k-1, n       ), ldbk,
                                 lalpha, B(B.mt-1-m, n       ), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, B.mt-1-m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -82,18 +105,26 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     float lalpha = k == 0 ? alpha : 1.0;
                     for (int n = 0; n < B.nt; n++) {
                         int nvbn = plasma_tile_nview(B, n);
+                        if (plasma_tile_structure(B, k, n) == PlasmaTileZero)
+                            continue;
                         core_omp_strsm(
                             side, uplo, trans, diag,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
                             sequence, request);
+                        plasma_tile_structure_set(B, k, n, PlasmaTileDense);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm = plasma_tile_mmain(B, m);
                         for (int n = 0; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(A, k, m),
+                                    plasma_tile_structure(B, k, n),
+                                    lalpha, B, m, n))
+                                continue;
                             core_omp_sgemm(
                                 trans, PlasmaNoTrans,
                                 mvbm, nvbn, B.mb,
@@ -101,6 +132,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -118,12 +151,15 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     float lalpha = k == 0 ? alpha : 1.0;
                     for (int n = 0; n < B.nt; n++) {
                         int nvbn = plasma_tile_nview(B, n);
+                        if (plasma_tile_structure(B, k, n) == PlasmaTileZero)
+                            continue;
                         core_omp_strsm(
                             side, uplo, trans, diag,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
                             sequence, request);
+                        plasma_tile_structure_set(B, k, n, PlasmaTileDense);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -131,6 +167,11 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                         int ldbm = plasma_tile_mmain(B, m);
                         for (int n = 0; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(A, m, k),
+                                    plasma_tile_structure(B, k, n),
+                                    lalpha, B, m, n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 mvbm, nvbn, B.mb,
@@ -138,6 +179,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -153,17 +196,28 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     float lalpha = k == 0 ? alpha : 1.0;
                     for (int n = 0; n < B.nt; n++) {
                         int nvbn = plasma_tile_nview(B, n);
+                        if (plasma_tile_structure(B, B.mt-k-1, n) ==
+                            PlasmaTileZero)
+                            continue;
                         core_omp_strsm(
                             side, uplo, trans, diag,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1, n       ), ldbk,
                             sequence, request);
+                        plasma_tile_structure_set(B, B.mt-k-1, n,
+                                                  PlasmaTileDense);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int ldbm = plasma_tile_mmain(B, B.mt-1-m);
                         for (int n = 0; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(A, B.mt-k-1,
+                                                             B.mt-1-m),
+                                    plasma_tile_structure(B, B.mt-k-1, n),
+                                    lalpha, B, B.mt-1-m, n))
+                                continue;
                             core_omp_sgemm(
                                 trans, PlasmaNoTrans,
                                 B.mb, nvbn, mvbk,
@@ -171,6 +225,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         B(B.mt-k-1, n       ), ldbk,
                                 lalpha, B(B.mt-1-m, n       ), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, B.mt-1-m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -190,18 +246,26 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm = plasma_tile_mmain(B, m);
+                        if (plasma_tile_structure(B, m, k) == PlasmaTileZero)
+                            continue;
                         core_omp_strsm(
                             side, uplo, trans, diag,
                             mvbm, nvbk,
                             lalpha, A(k, k), ldak,
                                     B(m, k), ldbm,
                             sequence, request);
+                        plasma_tile_structure_set(B, m, k, PlasmaTileDense);
                     }
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm = plasma_tile_mmain(B, m);
                         for (int n = k+1; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(B, m, k),
+                                    plasma_tile_structure(A, k, n),
+                                    lalpha, B, m, n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 mvbm, nvbn, B.mb,
@@ -209,6 +273,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         A(k, n), ldak,
                                 lalpha, B(m, n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -223,15 +289,26 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm   = plasma_tile_mmain(B, m);
-                        core_omp_strsm(
-                            side, uplo, trans, diag,
-                            mvbm, nvbk,
-                            alpha, A(B.nt-k-1, B.nt-k-1), ldak,
-                                   B(m,        B.nt-k-1), ldbm,
-                            sequence, request);
+                        if (plasma_tile_structure(B, m, B.nt-k-1) !=
+                            PlasmaTileZero) {
+                            core_omp_strsm(
+                                side, uplo, trans, diag,
+                                mvbm, nvbk,
+                                alpha, A(B.nt-k-1, B.nt-k-1), ldak,
+                                       B(m,        B.nt-k-1), ldbm,
+                                sequence, request);
+                            plasma_tile_structure_set(B, m, B.nt-k-1,
+                                                      PlasmaTileDense);
+                        }
 
                         for (int n = k+1; n < B.nt; n++) {
                             int ldan = plasma_tile_mmain(A, B.nt-1-n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(B, m, B.nt-k-1),
+                                    plasma_tile_structure(A, B.nt-1-n,
+                                                             B.nt-k-1),
+                                    1.0, B, m, B.nt-1-n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, trans,
                                 mvbm, B.nb, nvbk,
@@ -239,6 +316,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                             A(B.nt-1-n, B.nt-k-1), ldan,
                                 1.0,        B(m,        B.nt-1-n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, B.nt-1-n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -256,14 +335,25 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm = plasma_tile_mmain(B, m);
-                        core_omp_strsm(
-                            side, uplo, trans, diag,
-                            mvbm, nvbk,
-                            lalpha, A(B.nt-k-1, B.nt-k-1), ldak,
-                                    B(m,        B.nt-k-1), ldbm,
-                            sequence, request);
+                        if (plasma_tile_structure(B, m, B.nt-k-1) !=
+                            PlasmaTileZero) {
+                            core_omp_strsm(
+                                side, uplo, trans, diag,
+                                mvbm, nvbk,
+                                lalpha, A(B.nt-k-1, B.nt-k-1), ldak,
+                                        B(m,        B.nt-k-1), ldbm,
+                                sequence, request);
+                            plasma_tile_structure_set(B, m, B.nt-k-1,
+                                                      PlasmaTileDense);
+                        }
 
                         for (int n = k+1; n < B.nt; n++) {
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(B, m, B.nt-k-1),
+                                    plasma_tile_structure(A, B.nt-1-k,
+                                                             B.nt-1-n),
+                                    lalpha, B, m, B.nt-1-n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 mvbm, B.nb, nvbk,
@@ -271,6 +361,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                         A(B.nt-1-k, B.nt-1-n), ldak,
                                 lalpha, B(m,        B.nt-1-n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, B.nt-1-n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -285,16 +377,25 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
                         int ldbm = plasma_tile_mmain(B, m);
-                        core_omp_strsm(
-                            side, uplo, trans, diag,
-                            mvbm, nvbk,
-                            alpha, A(k, k), ldak,
-                                   B(m, k), ldbm,
-                            sequence, request);
+                        if (plasma_tile_structure(B, m, k) != PlasmaTileZero) {
+                            core_omp_strsm(
+                                side, uplo, trans, diag,
+                                mvbm, nvbk,
+                                alpha, A(k, k), ldak,
+                                       B(m, k), ldbm,
+                                sequence, request);
+                            plasma_tile_structure_set(B, m, k,
+                                                      PlasmaTileDense);
+                        }
 
                         for (int n = k+1; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
                             int ldan = plasma_tile_mmain(A, n);
+                            if (plasma_pstrsm_skip(
+                                    plasma_tile_structure(B, m, k),
+                                    plasma_tile_structure(A, n, k),
+                                    1.0, B, m, n))
+                                continue;
                             core_omp_sgemm(
                                 PlasmaNoTrans, trans,
                                 mvbm, nvbn, B.mb,
@@ -302,6 +403,8 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                                             A(n, k), ldan,
                                 1.0,        B(m, n), ldbm,
                                 sequence, request);
+                            plasma_tile_structure_set(B, m, n,
+                                                      PlasmaTileDense);
                         }
                     }
                 }
@@ -309,3 +412,51 @@ void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
         }
     }
 }
+
+/***************************************************************************//**
+ * Parallel tile triangular solve.
+ * With PlasmaTrsmStream positive, the right-hand sides are solved in panels
+ * of that many tile columns of B (tile rows for side = PlasmaRight), each
+ * submitted completely before the next, so that the panels stream past the
+ * triangular factor, which stays in the caches, rather than each step
+ * sweeping all of B.
+ * Only the tiles of B along A match those of A: for side = PlasmaLeft, the
+ * tile width of B is free, as in the solvers tiling B by
+ * plasma_tile_rhs_nb(), and so is its tile height for PlasmaRight.
+ * @see plasma_omp_strsm
+ ******************************************************************************/
+void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
+                   plasma_enum_t trans, plasma_enum_t diag,
+                   float alpha, plasma_desc_t A,
+                                             plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Stream the panels of B.
+    plasma_context_t *plasma = plasma_context_self();
+    int stream = plasma->trsm_stream;
+    int bt = side == PlasmaLeft ? B.nt : B.mt;
+    if (stream > 0 && stream < bt) {
+        for (int j = 0; j < bt; j += stream) {
+            plasma_desc_t Bj;
+            if (side == PlasmaLeft) {
+                int nj = imin((j+stream)*B.nb, B.n) - j*B.nb;
+                Bj = plasma_desc_view(B, 0, j*B.nb, B.m, nj);
+            }
+            else {
+                int mj = imin((j+stream)*B.mb, B.m) - j*B.mb;
+                Bj = plasma_desc_view(B, j*B.mb, 0, mj, B.n);
+            }
+            plasma_pstrsm_panel(side, uplo, trans, diag,
+                                alpha, A, Bj,
+                                sequence, request);
+        }
+        return;
+    }
+    plasma_pstrsm_panel(side, uplo, trans, diag,
+                        alpha, A, B,
+                        sequence, request);
+}
@@ -0,0 +1,74 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztrsmpl.c, normal z -> s, Thu Oct 15 04:14:01 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define L(m, n) (float*)plasma_tile_addr(L, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define IPIV(m, n) (&ipiv[((size_t)A.mt*(n)+(m))*A.nb])
+
+/***************************************************************************//**
+ *  Parallel forward substitution with the factor L and the row interchanges
+ *  of the tile LU factorization with incremental pivoting -
+ *  dynamic scheduling
+ * @see plasma_omp_sgetrs_incpiv
+ **/
+void plasma_pstrsmpl(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                     plasma_desc_t B,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Set inner blocking from the L tile row-dimension.
+    int ib = L.mb;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        int mvbk = plasma_tile_mview(B, k);
+        int ldbk = plasma_tile_mmain(B, k);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            core_omp_sgessm(
+                mvbk, nvbn, imin(mvak, nvak),
+                IPIV(k, k),
+                A(k, k), ldak,
+                B(k, n), ldbk,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldam = plasma_tile_mmain(A, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            for (int n = 0; n < B.nt; n++) {
+                int nvbn = plasma_tile_nview(B, n);
+                core_omp_sssssm(
+                    mvbm, nvbn, nvak, ib,
+                    B(k, n), ldbk,
+                    B(m, n), ldbm,
+                    L(m, k), L.mb,
+                    A(m, k), ldam,
+                    IPIV(m, k),
+                    sequence, request);
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pztrsyl.c, normal z -> s, Thu Oct 15 05:55:19 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define B(m, n) (float*)plasma_tile_addr(B, m, n)
+#define C(m, n) (float*)plasma_tile_addr(C, m, n)
+
+/***************************************************************************//**
+ * Parallel tile triangular Sylvester solve.
+ * @see plasma_omp_strsyl
+ ******************************************************************************/
+void plasma_pstrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                    plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    float zsgn = -isgn;
+
+    // The tile rows of X are solved from the bottom for op(A) = A, from
+    // the top for A^T, and its tile columns from the left for op(B) = B,
+    // from the right for B^T. Each solved tile updates the right-hand
+    // sides of its tile column and tile row still to solve, so that the
+    // tiles of an antidiagonal are solved concurrently.
+    for (int ii = 0; ii < C.mt; ii++) {
+        int i = transa == PlasmaNoTrans ? C.mt-1-ii : ii;
+        int mvci = plasma_tile_mview(C, i);
+        int ldai = plasma_tile_mmain(A, i);
+        int ldci = plasma_tile_mmain(C, i);
+        for (int jj = 0; jj < C.nt; jj++) {
+            int j = transb == PlasmaNoTrans ? jj : C.nt-1-jj;
+            int nvcj = plasma_tile_nview(C, j);
+            int ldbj = plasma_tile_mmain(B, j);
+
+            // op(A_ii) X_ij + isgn X_ij op(B_jj) = C_ij
+            core_omp_strsyl(
+                transa, transb, isgn,
+                mvci, nvcj,
+                A(i, i), ldai,
+                B(j, j), ldbj,
+                C(i, j), ldci,
+                sequence, request);
+
+            // C_kj -= op(A)_ki X_ij
+            for (int kk = ii+1; kk < C.mt; kk++) {
+                int k = transa == PlasmaNoTrans ? C.mt-1-kk : kk;
+                int mvck = plasma_tile_mview(C, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldck = plasma_tile_mmain(C, k);
+                if (transa == PlasmaNoTrans) {
+                    core_omp_sgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvck, nvcj, mvci,
+                        -1.0, A(k, i), ldak,
+                              C(i, j), ldci,
+                        1.0,  C(k, j), ldck,
+                        sequence, request);
+                }
+                else {
+                    core_omp_sgemm(
+                        transa, PlasmaNoTrans,
+                        mvck, nvcj, mvci,
+                        -1.0, A(i, k), ldai,
+                              C(i, j), ldci,
+                        1.0,  C(k, j), ldck,
+                        sequence, request);
+                }
+            }
+
+            // C_il -= isgn X_ij op(B)_jl
+            for (int ll = jj+1; ll < C.nt; ll++) {
+                int l = transb == PlasmaNoTrans ? ll : C.nt-1-ll;
+                int nvcl = plasma_tile_nview(C, l);
+                int ldbl = plasma_tile_mmain(B, l);
+                if (transb == PlasmaNoTrans) {
+                    core_omp_sgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvci, nvcl, nvcj,
+                        zsgn, C(i, j), ldci,
+                              B(j, l), ldbj,
+                        1.0,  C(i, l), ldci,
+                        sequence, request);
+                }
+                else {
+                    core_omp_sgemm(
+                        PlasmaNoTrans, transb,
+                        mvci, nvcl, nvcj,
+                        zsgn, C(i, j), ldci,
+                              B(l, j), ldbl,
+                        1.0,  C(i, l), ldci,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ * Parallel LU factorization of As, the single precision copy of A, for the
+ * mixed precision solvers, in bfloat16 if bf16, with the infinity norm of A,
+ * for their stopping criterion, in Anorm. The factors are pivoted to the
+ * left, as the refinement needs.
+ * @see plasma_omp_zcgesv
+ ******************************************************************************/
+void plasma_pzcgetrf(plasma_desc_t A, plasma_desc_t As, int *ipiv, int bf16,
+                     double *work, double *Anorm,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    plasma_pzlange(PlasmaInfNorm, A, work, Anorm, sequence, request);
+
+    // Compute the LU factorization of As.
+    #pragma omp taskwait
+    if (bf16)
+        plasma_psbgetrf(As, ipiv, sequence, request);
+    else
+        plasma_pcgetrf(As, ipiv, sequence, request);
+
+    // The refinement, also by GMRES, uses the factors pivoted to the left.
+    if (!bf16 && plasma->left_pivoting == PlasmaLeftPivotingOff)
+        plasma_pcgetrf_left(As, ipiv, sequence, request);
+}
+
+/***************************************************************************//**
+ * Parallel solve of A * X = B by the factors of plasma_pzcgetrf in As and
+ * ipiv and iterative refinement in double precision, with Xs holding B in
+ * single precision on entry and Anorm the infinity norm of A. Sets iter to
+ * the number of iterations, or to -(1+itermax) if the refinement did not
+ * converge, in which case the caller solves again in double precision.
+ * @see plasma_omp_zcgesv
+ ******************************************************************************/
+void plasma_pzcgesv_refine(plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                           int bf16, const double *Anorm,
+                           plasma_desc_t B, plasma_desc_t X,
+                           plasma_desc_t Xs, plasma_desc_t R,
+                           double *work, double *Rnorm, double *Xnorm,
+                           int *iter,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    const int    itermax = 30;
+    const double bwdmax  = 1.0;
+    const plasma_complex64_t zone  =  1.0;
+    *iter = 0;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Workspaces for dzamax
+    double *workX = work;
+    double *workR = &work[X.mt*X.n];
+
+    double cte;
+    double eps = LAPACKE_dlamch_work('E');
+
+    // Solve the system As * Xs = Bs.
+    #pragma omp taskwait
+    plasma_pclaswp(PlasmaRowwise, Xs, ipiv, 1, sequence, request);
+
+    plasma_pctrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, As, Xs, sequence, request);
+
+    plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, As, Xs, sequence, request);
+
+    // Convert Xs to double precision.
+    plasma_pclag2z(Xs, X, sequence, request);
+
+    // Compute R = B - A * X and its norm.
+    plasma_pzgeresid(A, X, B, R, workR, Rnorm, sequence, request);
+
+    // Check whether the nrhs normwise backward error satisfies the
+    // stopping criterion. If yes, set iter=0 and return.
+    plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+    #pragma omp taskwait
+    {
+        cte = (*Anorm) * eps * sqrt((double)A.n) * bwdmax;
+        int flag = 1;
+        for (int n = 0; n < R.n && flag == 1; n++) {
+            if (Rnorm[n] > Xnorm[n] * cte) {
+                flag = 0;
+            }
+        }
+        if (flag == 1) {
+            *iter = 0;
+            return;
+        }
+    }
+
+    // The update of the iterate by the correction in Xs, R = Xs in double
+    // precision and X = X + R, in one pass over the tiles.
+    plasma_zpipeline_t update;
+    plasma_zpipeline_init(&update);
+    if (plasma_zpipeline_clag2z(&update, Xs, R) != PlasmaSuccess ||
+        plasma_zpipeline_geadd(&update, PlasmaNoTrans,
+                               zone, R, zone, X) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Iterative refinement
+    for (int iiter = 0; iiter < itermax; iiter++) {
+        if (plasma->refinement_mode == PlasmaGmresRefinement || bf16) {
+            // Solve the system A * D = R by GMRES preconditioned
+            // by the factors of As and update the current iterate.
+            plasma_pzcgmres(PlasmaGeneral, A, As, ipiv, R, X, Xs,
+                            plasma->gmres_restart, sequence, request);
+        }
+        else {
+            // Convert R from double to single precision, store result in Xs.
+            plasma_pzlag2c(R, Xs, sequence, request);
+
+            // Solve the system As * Xs = Rs.
+            #pragma omp taskwait
+            plasma_pclaswp(PlasmaRowwise, Xs, ipiv, 1, sequence, request);
+
+            plasma_pctrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                          1.0, As, Xs, sequence, request);
+
+            plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans,
+                          PlasmaNonUnit, 1.0, As, Xs, sequence, request);
+
+            // Convert Xs back to double precision
+            // and update the current iterate.
+            plasma_pzpipeline(update, sequence, request);
+        }
+
+        // Compute R = B - A * X and its norm.
+        plasma_pzgeresid(A, X, B, R, workR, Rnorm, sequence, request);
+
+        // Check whether nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter = iiter > 0 and return
+        plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        #pragma omp taskwait
+        {
+            int flag = 1;
+            for (int n = 0; n < R.n && flag == 1; n++) {
+                if (Rnorm[n] > Xnorm[n] * cte) {
+                    flag = 0;
+                }
+            }
+            if (flag == 1) {
+                *iter = iiter+1;
+                return;
+            }
+        }
+    }
+
+
+    // The refinement did not converge in itermax iterations.
+    *iter = -itermax - 1;
+}
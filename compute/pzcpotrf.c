@@ -0,0 +1,139 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define P(m, n) plasma_tile_precision(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization of a matrix with tiles in double or
+ *  single precision, as tagged by plasma_tile_precision. The diagonal tiles
+ *  are in double precision. The mixed kernels compute each update in the
+ *  precision of the tile it updates, and fall back to the double precision
+ *  kernels when all their tiles are in double precision.
+ * @see plasma_omp_zcpotrf
+ ******************************************************************************/
+void plasma_pzcpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (uplo == PlasmaLower) {
+        for (int k = 0; k < A.mt; k++) {
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            core_omp_zpotrf(
+                PlasmaLower, mvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_zctrsm(
+                    PlasmaRight, PlasmaLower,
+                    PlasmaConjTrans, PlasmaNonUnit,
+                    mvam, A.mb,
+                    1.0, A(k, k), ldak,
+                         A(m, k), P(m, k), ldam,
+                    work,
+                    sequence, request);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_zcherk(
+                    PlasmaLower, PlasmaNoTrans,
+                    mvam, A.mb,
+                    -1.0, A(m, k), P(m, k), ldam,
+                     1.0, A(m, m), ldam,
+                    work,
+                    sequence, request);
+
+                for (int n = k+1; n < m; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_zcgemm(
+                        PlasmaNoTrans, PlasmaConjTrans,
+                        mvam, A.mb, A.mb,
+                        -1.0, A(m, k), P(m, k), ldam,
+                              A(n, k), P(n, k), ldan,
+                         1.0, A(m, n), P(m, n), ldam,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int k = 0; k < A.nt; k++) {
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            core_omp_zpotrf(
+                PlasmaUpper, nvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                core_omp_zctrsm(
+                    PlasmaLeft, PlasmaUpper,
+                    PlasmaConjTrans, PlasmaNonUnit,
+                    A.nb, nvam,
+                    1.0, A(k, k), ldak,
+                         A(k, m), P(k, m), ldak,
+                    work,
+                    sequence, request);
+            }
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_zcherk(
+                    PlasmaUpper, PlasmaConjTrans,
+                    nvam, A.mb,
+                    -1.0, A(k, m), P(k, m), ldak,
+                     1.0, A(m, m), ldam,
+                    work,
+                    sequence, request);
+
+                for (int n = k+1; n < m; n++) {
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_zcgemm(
+                        PlasmaConjTrans, PlasmaNoTrans,
+                        A.mb, nvam, A.mb,
+                        -1.0, A(k, n), P(k, n), ldak,
+                              A(k, m), P(k, m), ldak,
+                         1.0, A(n, m), P(n, m), ldan,
+                        work,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+// arguments of the ranks of the team of the bulge chasing
+typedef struct {
+    int n;
+    int kd;
+    plasma_complex64_t *A;
+    int lda;
+    plasma_complex64_t *V;
+    plasma_complex64_t *tau;
+    plasma_complex64_t *work;
+} plasma_pzgbhrd_team_t;
+
+/******************************************************************************/
+// Runs a rank of the team of the bulge chasing.
+static void plasma_pzgbhrd_rank(void *args, int rank, int size,
+                                plasma_barrier_t *barrier)
+{
+    plasma_pzgbhrd_team_t *team = (plasma_pzgbhrd_team_t*)args;
+
+    core_zgbhrd(team->n, team->kd, team->A, team->lda,
+                team->V, team->tau, team->work,
+                rank, size, barrier);
+}
+
+/***************************************************************************//**
+ *  Parallel reduction of an upper Hessenberg matrix of lower bandwidth kd,
+ *  in LAPACK layout, to upper Hessenberg form by bulge chasing, the second
+ *  stage of plasma_zgehrd. Each sweep reads the whole band, so the
+ *  reduction waits for the tasks ahead of it, and then runs on a team of
+ *  PlasmaNumPanelThreads threads, see plasma_team_run() and core_zgbhrd().
+ *  @see plasma_zgehrd
+ ******************************************************************************/
+void plasma_pzgbhrd(int n, int kd, plasma_complex64_t *A, int lda,
+                    plasma_complex64_t *V, plasma_complex64_t *tau,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_complex64_t *work = (plasma_complex64_t*)malloc(
+        (size_t)plasma->num_panel_threads*n*sizeof(plasma_complex64_t));
+    if (work == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    PLASMA_TRACE_START("zgbhrd", A);
+    plasma_pzgbhrd_team_t team = { n, kd, A, lda, V, tau, work };
+    if (PLASMA_TRACE_RUN(sequence))
+        plasma_team_run(plasma->panel_team, plasma->panel_bind,
+                        plasma->num_panel_threads,
+                        plasma_sequence_priority(sequence),
+                        plasma_pzgbhrd_rank, &team);
+    PLASMA_TRACE_FLOPS(PlasmaComplexDouble,
+                       10.0/3.0*n*n*n, (double)n*n);
+    PLASMA_TRACE_STOP("zgbhrd", 1, A);
+
+    free(work);
+}
+
+/***************************************************************************//**
+ *  Parallel formation of the Q of plasma_pzgbhrd, in LAPACK layout, by
+ *  blocks of nb columns: the reflectors are applied from the left to each
+ *  block of columns of the identity, independently of the others.
+ *  @see plasma_zgehrd
+ ******************************************************************************/
+void plasma_pzgbhrd_q(int n, int kd,
+                      const plasma_complex64_t *V,
+                      const plasma_complex64_t *tau,
+                      plasma_complex64_t *Q, int ldq,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    int nb = plasma->nb;
+
+    for (int k = 0; k < (n+nb-1)/nb; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        core_omp_zgbhrd_q(n, kd, V, tau,
+                          k*nb, imin(nb, n-k*nb),
+                          &Q[(size_t)ldq*k*nb], ldq,
+                          work,
+                          sequence, request);
+    }
+}
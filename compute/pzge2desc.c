@@ -18,16 +18,233 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+/******************************************************************************/
+// Translates the row-major array pA, transposing each tile while copying it,
+// one task per tile.
+static void plasma_pzge2desc_rowmajor(plasma_complex64_t *pA, int lda,
+                                      plasma_desc_t A,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    if (A.rate > 0) {
+        plasma_error("packed tiles of a row-major array");
+        plasma_request_fail(sequence, request, PlasmaErrorNotSupported);
+        return;
+    }
+    for (int m = 0; m < A.mt; m++) {
+        int ldt = plasma_tile_mmain(A, m);
+        for (int n = 0; n < A.nt; n++) {
+            if (!plasma_tile_stored(A, m, n))
+                continue;
+
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int y1 = m == 0 ? A.i%A.mb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+            plasma_complex64_t *f77 =
+                &pA[(size_t)A.mb*lda*m + (size_t)A.nb*n];
+            plasma_complex64_t *bdl =
+                (plasma_complex64_t*)plasma_tile_addr(A, m, n);
+
+            plasma_tile_affinity(A, m, n);
+            core_omp_zlacpy_trans(PlasmaTrans,
+                                  y2-y1, x2-x1,
+                                  &(f77[(size_t)y1*lda+x1]), lda,
+                                  &(bdl[(size_t)x1*ldt+y1]), ldt,
+                                  sequence, request);
+        }
+    }
+}
+
 /******************************************************************************/
 void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request)
 {
+    // The tiles are the LAPACK array, translated in place.
+    if (A.translation == PlasmaInplace) {
+        plasma_pge2desc_inplace(A, sequence, request);
+        return;
+    }
+
+    // The tiles are views of the LAPACK array, not translated.
+    if (A.translation == PlasmaNoTranslation)
+        return;
+
+    // The array is in row-major order.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma->array_layout == PlasmaRowMajor) {
+        plasma_pzge2desc_rowmajor(pA, lda, A, sequence, request);
+        return;
+    }
+
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Pack the tiles, one task per tile.
+    if (A.rate > 0) {
+        for (int m = 0; m < A.mt; m++) {
+            int ldt = plasma_tile_mmain(A, m);
+            for (int n = 0; n < A.nt; n++) {
+                int x1 = n == 0 ? A.j%A.nb : 0;
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                plasma_complex64_t *f77 =
+                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                unsigned char *bdl =
+                    (unsigned char*)plasma_tile_addr(A, m, n);
+
+                core_omp_zpack(PlasmaGeneral,
+                               y2-y1, x2-x1,
+                               &(f77[x1*lda+y1]), lda, A.rate,
+                               &(bdl[((size_t)x1*ldt+y1)*A.eltsize]), ldt,
+                               sequence, request);
+            }
+        }
+        return;
+    }
+
+    // Stream the matrices larger than the caches, one task per run of up to
+    // PlasmaStreamTiles stored tiles of a tile column, which copies the
+    // columns of the run one after the other, so that the LAPACK array is
+    // accessed sequentially, storing the tiles past the caches.
+    if (plasma_desc_streamed(A)) {
+        plasma_complex64_t *ftiles[PlasmaStreamTiles];
+        plasma_complex64_t *btiles[PlasmaStreamTiles];
+        for (int n = 0; n < A.nt; n++) {
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int m0 = 0;
+            while (m0 < A.mt) {
+                // the run of stored tiles m0 to m0+count-1
+                int count = 0;
+                int rows = 0;
+                while (m0+count < A.mt && count < PlasmaStreamTiles &&
+                       plasma_tile_stored(A, m0+count, n)) {
+                    int m = m0+count;
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+                    ftiles[count] = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m +
+                                        (size_t)x1*lda+y1];
+                    btiles[count] =
+                        (plasma_complex64_t*)plasma_tile_addr(A, m, n);
+                    rows += y2-y1;
+                    count++;
+                }
+                if (count == 0) {
+                    m0++;
+                    continue;
+                }
+
+                #pragma omp task depend(iterator(int t = 0:count), \
+                                        in:ftiles[t][0]) \
+                                 depend(iterator(int t = 0:count), \
+                                        out:btiles[t][0]) \
+                                 priority(plasma_sequence_priority(sequence))
+                {
+                    PLASMA_TRACE_START("zlacpy_stream", btiles[0]);
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        for (int x = x1; x < x2; x++) {
+                            for (int m = m0; m < m0+count; m++) {
+                                int ldt = plasma_tile_mmain(A, m);
+                                int y1 = m == 0 ? A.i%A.mb : 0;
+                                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1
+                                                     : A.mb;
+                                plasma_complex64_t *f77 =
+                                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                                plasma_complex64_t *bdl = (plasma_complex64_t*)
+                                    plasma_tile_addr(A, m, n);
+                                core_zlacpy_stream(y2-y1, 1,
+                                                   &f77[(size_t)x*lda+y1], lda,
+                                                   &bdl[(size_t)x*ldt+y1], ldt);
+                            }
+                        }
+                        core_stream_fence();
+                    }
+                    PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 0.0,
+                                       2.0*rows*(x2-x1));
+                    PLASMA_TRACE_STOP("zlacpy_stream", 1, btiles[0], ftiles[0]);
+                }
+                m0 += count;
+            }
+        }
+        return;
+    }
+
+    // Submit one task per tile column, translating its tiles
+    // in a taskloop, unless the stored tiles of a column have gaps.
+    if (plasma_column_sweep(plasma, A.mt) && A.layout != PlasmaSparseLayout) {
+        plasma_complex64_t **tiles = (plasma_complex64_t**)
+            malloc((size_t)2*A.mt*sizeof(plasma_complex64_t*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        plasma_complex64_t **ftiles = tiles;
+        plasma_complex64_t **btiles = tiles+A.mt;
+        for (int n = 0; n < A.nt; n++) {
+            // the stored tiles of the column, m0 to m0+count-1
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int m0 = 0;
+            while (m0 < A.mt && !plasma_tile_stored(A, m0, n))
+                m0++;
+            int count = 0;
+            for (int m = m0; m < A.mt && plasma_tile_stored(A, m, n); m++) {
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                ftiles[count] = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m +
+                                    (size_t)x1*lda+y1];
+                btiles[count] =
+                    (plasma_complex64_t*)plasma_tile_addr(A, m, n);
+                count++;
+            }
+            if (count == 0)
+                continue;
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:ftiles[t][0]) \
+                             depend(iterator(int t = 0:count), \
+                                    out:btiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int t = 0; t < count; t++) {
+                    int m = m0+t;
+                    int ldt = plasma_tile_mmain(A, m);
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                    plasma_complex64_t *f77 =
+                        &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                    plasma_complex64_t *bdl = (plasma_complex64_t*)
+                        plasma_tile_addr(A, m, n);
+
+                    PLASMA_TRACE_START("zlacpy", bdl);
+                    if (PLASMA_TRACE_RUN(sequence))
+                        core_zlacpy(PlasmaGeneral,
+                                    y2-y1, x2-x1,
+                                    &(f77[x1*lda+y1]), lda,
+                                    &(bdl[x1*ldt+y1]), ldt);
+                    PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 0.0,
+                                       2.0*(y2-y1)*(x2-x1));
+                    PLASMA_TRACE_STOP("zlacpy", 1, bdl, &(f77[x1*lda+y1]));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
     plasma_complex64_t *f77;
     plasma_complex64_t *bdl;
 
@@ -38,6 +255,9 @@ void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
     for (m = 0; m < A.mt; m++) {
         ldt = plasma_tile_mmain(A, m);
         for (n = 0; n < A.nt; n++) {
+            if (!plasma_tile_stored(A, m, n))
+                continue;
+
             x1 = n == 0 ? A.j%A.nb : 0;
             y1 = m == 0 ? A.i%A.mb : 0;
             x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
@@ -46,11 +266,98 @@ void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
             f77 = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
             bdl = (plasma_complex64_t*)plasma_tile_addr(A, m, n);
 
+            plasma_tile_affinity(A, m, n);
             core_omp_zlacpy(PlasmaGeneral,
                             y2-y1, x2-x1,
                             &(f77[x1*lda+y1]), lda,
-                            &(bdl[x1*A.nb+y1]), ldt,
+                            &(bdl[x1*ldt+y1]), ldt,
                             sequence, request);
         }
     }
 }
+
+/***************************************************************************//**
+ *  Translates to tile layout submitting one task per tile column.
+ *  Each task declares dependencies on the first, the second, and the last
+ *  tile of its column, which are the tile addresses used as dependencies
+ *  by the column-panel algorithms (plasma_pzgetrf, plasma_pzlaswp).
+ *  Therefore, the translation can be submitted in the same parallel region
+ *  as those algorithms, which then start as soon as their columns arrive.
+ * @see plasma_pzge2desc
+ ******************************************************************************/
+void plasma_pzge2desc_colwise(plasma_complex64_t *pA, int lda,
+                              plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // The tiles are the LAPACK array, translated in place.
+    if (A.translation == PlasmaInplace) {
+        plasma_pge2desc_inplace(A, sequence, request);
+        return;
+    }
+
+    // The tiles are views of the LAPACK array, not translated.
+    if (A.translation == PlasmaNoTranslation)
+        return;
+
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    int rowmajor = plasma->array_layout == PlasmaRowMajor;
+
+    for (int n = 0; n < A.nt; n++) {
+        plasma_complex64_t *a0 = (plasma_complex64_t*)
+            plasma_tile_addr(A, 0, n);
+        plasma_complex64_t *a1 = (plasma_complex64_t*)
+            plasma_tile_addr(A, imin(1, A.mt-1), n);
+        plasma_complex64_t *a2 = (plasma_complex64_t*)
+            plasma_tile_addr(A, A.mt-1, n);
+
+        int lda0 = plasma_tile_mmain(A, 0);
+        int lda1 = plasma_tile_mmain(A, imin(1, A.mt-1));
+        int lda2 = plasma_tile_mmain(A, A.mt-1);
+        int nvan = plasma_tile_nview(A, n);
+
+        #pragma omp task depend(out:a0[0:lda0*nvan]) \
+                         depend(out:a1[0:lda1*nvan]) \
+                         depend(out:a2[0:lda2*nvan]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            // The tiles only stand for the column in the dependencies.
+            (void)a0;
+            (void)a1;
+            (void)a2;
+            if (sequence->status == PlasmaSuccess) {
+                for (int m = 0; m < A.mt; m++) {
+                    int ldt = plasma_tile_mmain(A, m);
+                    int x1 = n == 0 ? A.j%A.nb : 0;
+                    int y1 = m == 0 ? A.i%A.mb : 0;
+                    int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                    int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                    plasma_complex64_t *bdl = (plasma_complex64_t*)
+                        plasma_tile_addr(A, m, n);
+
+                    if (rowmajor) {
+                        plasma_complex64_t *f77 =
+                            &pA[(size_t)A.mb*lda*m + (size_t)A.nb*n];
+                        core_zlacpy_trans(PlasmaTrans,
+                                          y2-y1, x2-x1,
+                                          &(f77[(size_t)y1*lda+x1]), lda,
+                                          &(bdl[(size_t)x1*ldt+y1]), ldt);
+                    }
+                    else {
+                        plasma_complex64_t *f77 =
+                            &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                        core_zlacpy(PlasmaGeneral,
+                                    y2-y1, x2-x1,
+                                    &(f77[x1*lda+y1]), lda,
+                                    &(bdl[x1*ldt+y1]), ldt);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -18,9 +18,88 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <omp.h>
+
 #define A(m,n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 #define B(m,n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
 
+/******************************************************************************/
+// Adds the tiles of A to the tiles of B, either packed, with one task per
+// tile of B unpacking them into the scratch of its thread, and packing the
+// tile of B back. The scratch is freed once the tasks are done.
+static void plasma_pzgeadd_packed(plasma_enum_t transa,
+                                  plasma_complex64_t alpha, plasma_desc_t A,
+                                  plasma_complex64_t beta,  plasma_desc_t B,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    size_t lscratch = (size_t)A.mb*A.nb;
+    plasma_workspace_t scratch;
+    int retval = plasma_workspace_create(&scratch, lscratch + B.mb*B.nb,
+                                         B.precision);
+    if (retval != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, retval);
+        return;
+    }
+
+    for (int m = 0; m < B.mt; m++) {
+        int mvbm = plasma_tile_mview(B, m);
+        int ldbm = plasma_tile_mmain(B, m);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+            int am = transa == PlasmaNoTrans ? m : n;
+            int an = transa == PlasmaNoTrans ? n : m;
+            int mva = transa == PlasmaNoTrans ? mvbm : nvbn;
+            int nva = transa == PlasmaNoTrans ? nvbn : mvbm;
+            int lda = plasma_tile_mmain(A, am);
+            unsigned char *a = (unsigned char*)plasma_tile_addr(A, am, an);
+            unsigned char *b = (unsigned char*)plasma_tile_addr(B, m, n);
+
+            #pragma omp task depend(in:a[0]) \
+                             depend(inout:b[0]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("zgeadd", b);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int tid = omp_get_thread_num();
+                    plasma_complex64_t *W =
+                        (plasma_complex64_t*)scratch.spaces[tid];
+                    plasma_complex64_t *pa = (plasma_complex64_t*)a;
+                    plasma_complex64_t *pb = (plasma_complex64_t*)b;
+                    int ldwa = lda;
+                    int ldwb = ldbm;
+                    if (A.rate > 0) {
+                        core_zunpack(PlasmaGeneral, mva, nva,
+                                     a, lda, A.rate, W, mva);
+                        pa = W;
+                        ldwa = mva;
+                    }
+                    if (B.rate > 0) {
+                        pb = &W[lscratch];
+                        ldwb = mvbm;
+                        core_zunpack(PlasmaGeneral, mvbm, nvbn,
+                                     b, ldbm, B.rate, pb, ldwb);
+                    }
+                    int info = core_zgeadd(transa, mvbm, nvbn,
+                                           alpha, pa, ldwa,
+                                           beta,  pb, ldwb);
+                    if (info != PlasmaSuccess) {
+                        plasma_error("core_zgeadd() failed");
+                        plasma_request_fail(sequence, request,
+                                            PlasmaErrorInternal);
+                    }
+                    if (B.rate > 0)
+                        core_zpack(PlasmaGeneral, mvbm, nvbn,
+                                   pb, ldwb, B.rate, b, ldbm);
+                }
+                PLASMA_TRACE_STOP("zgeadd", 1, b, a);
+            }
+        }
+    }
+    #pragma omp taskwait
+    plasma_workspace_destroy(&scratch);
+}
+
 /***************************************************************************//**
  * Parallel tile matrix-matrix addition.
  * @see plasma_omp_zgeadd
@@ -34,6 +113,62 @@ void plasma_pzgeadd(plasma_enum_t transa,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    if (A.rate > 0 || B.rate > 0) {
+        plasma_pzgeadd_packed(transa, alpha, A, beta, B, sequence, request);
+        return;
+    }
+
+    // Submit one task per tile column of B, adding to its tiles
+    // in a taskloop.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_column_sweep(plasma, B.mt)) {
+        plasma_complex64_t **tiles = (plasma_complex64_t**)
+            malloc((size_t)2*B.mt*sizeof(plasma_complex64_t*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        plasma_complex64_t **atiles = tiles;
+        plasma_complex64_t **btiles = tiles+B.mt;
+        for (int n = 0; n < B.nt; n++) {
+            for (int m = 0; m < B.mt; m++) {
+                atiles[m] = transa == PlasmaNoTrans ? A(m, n) : A(n, m);
+                btiles[m] = B(m, n);
+            }
+            int count = B.mt;
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    in:atiles[t][0]) \
+                             depend(iterator(int t = 0:count), \
+                                    inout:btiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int m = 0; m < count; m++) {
+                    int am = transa == PlasmaNoTrans ? m : n;
+                    int an = transa == PlasmaNoTrans ? n : m;
+                    PLASMA_TRACE_START("zgeadd", B(m, n));
+                    if (PLASMA_TRACE_RUN(sequence)) {
+                        int retval = core_zgeadd(
+                            transa,
+                            plasma_tile_mview(B, m), plasma_tile_nview(B, n),
+                            alpha, A(am, an), plasma_tile_mmain(A, am),
+                            beta,  B(m, n),   plasma_tile_mmain(B, m));
+                        if (retval != PlasmaSuccess) {
+                            plasma_error("core_zgeadd() failed");
+                            plasma_request_fail(sequence, request,
+                                                PlasmaErrorInternal);
+                        }
+                    }
+                    PLASMA_TRACE_STOP("zgeadd", 1, B(m, n), A(am, an));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
     //===============
     // PlasmaNoTrans
     //===============
@@ -33,10 +33,17 @@ void plasma_pzgelqf(plasma_desc_t A, plasma_desc_t T,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain(A, k);
@@ -44,7 +51,7 @@ void plasma_pzgelqf(plasma_desc_t A, plasma_desc_t T,
             mvak, nvak, ib,
             A(k, k), ldak,
             T(k, k), T.mb,
-            work,
+            work, plasma->panel_blas_threads,
             sequence, request);
 
         for (int m = k+1; m < A.mt; m++) {
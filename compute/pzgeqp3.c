@@ -0,0 +1,279 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define T(m, n) (plasma_complex64_t*)plasma_tile_addr(T, m, n)
+
+/***************************************************************************//**
+ *  Replaces the candidate columns cand(0:*ncand-1) by the nsel columns
+ *  chosen by the column pivoted QR of A(k*mb:m-1, cand) and
+ *  A(k*mb:m-1, cand2(0:*ncand2-1)), in the order of the pivoting.
+ *  The counts are read in the task, after the tasks updating them.
+ **/
+static void plasma_pzgeqp3_select(plasma_desc_t A, int k,
+                                  int *cand, int *ncand,
+                                  const int *cand2, const int *ncand2,
+                                  int nsel,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    #pragma omp task depend(inout:cand[0]) depend(in:cand2[0]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zgeqp3", cand);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int mk = A.m - k*A.mb;
+            int nu = *ncand + *ncand2;
+            plasma_complex64_t *W = (plasma_complex64_t*)malloc(
+                (size_t)mk*nu*sizeof(plasma_complex64_t));
+            plasma_complex64_t *tau = (plasma_complex64_t*)malloc(
+                (size_t)imin(mk, nu)*sizeof(plasma_complex64_t));
+            int *cols = (int*)malloc((size_t)2*nu*sizeof(int));
+            if (W == NULL || tau == NULL || cols == NULL) {
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                int *jpvt = &cols[nu];
+                for (int j = 0; j < *ncand; j++)
+                    cols[j] = cand[j];
+                for (int j = 0; j < *ncand2; j++)
+                    cols[*ncand+j] = cand2[j];
+
+                // Gather the columns below the factored rows.
+                for (int j = 0; j < nu; j++) {
+                    int n = cols[j]/A.nb;
+                    int jj = cols[j]%A.nb;
+                    int i = 0;
+                    for (int m = k; m < A.mt; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        int ldam = plasma_tile_mmain(A, m);
+                        plasma_complex64_t *amn = A(m, n);
+                        for (int ii = 0; ii < mvam; ii++)
+                            W[i+ii + (size_t)j*mk] =
+                                amn[ii + (size_t)jj*ldam];
+                        i += mvam;
+                    }
+                    jpvt[j] = 0;
+                }
+
+                int info = LAPACKE_zgeqp3(LAPACK_COL_MAJOR, mk, nu,
+                                          W, mk, jpvt, tau);
+                if (info != 0)
+                    plasma_request_fail(sequence, request,
+                                        PlasmaErrorInternal);
+
+                *ncand = imin(nsel, nu);
+                for (int j = 0; j < *ncand; j++)
+                    cand[j] = cols[jpvt[j]-1];
+            }
+            free(W);
+            free(tau);
+            free(cols);
+        }
+        PLASMA_TRACE_STOP("zgeqp3", 1, cand, cand2);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization with column pivoting by tournament
+ *  pivoting, A P = Q R.
+ *
+ *  Each step chooses the nb pivot columns of its panel among the trailing
+ *  columns by a reduction over the tile columns: the candidates of two
+ *  tile columns are merged by the column pivoted QR of their 2*nb columns,
+ *  which keeps the nb first pivots, along the tree of tile QR operations
+ *  of plasma_rh_tree_operations for a column of nt-k tiles. The chosen
+ *  columns are swapped to the front of the trailing matrix, and the panel
+ *  is factored and applied by the flat tile QR kernels of plasma_pzgeqrf.
+ *
+ *  The tournament of a step reads the trailing matrix, so the steps are
+ *  separated by taskwaits, and the column swaps by another.
+ *  jpvt(j) is the column of the original A that is column j of A P, from 1.
+ * @see plasma_omp_zgeqp3
+ **/
+void plasma_pzgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    // the candidates of each tile column, and the column interchanges
+    int *cand = (int*)malloc((size_t)A.nt*A.nb*sizeof(int));
+    int *ncand = (int*)malloc((size_t)A.nt*sizeof(int));
+    int *ipvt = (int*)malloc((size_t)A.n*sizeof(int));
+    if (cand == NULL || ncand == NULL || ipvt == NULL) {
+        free(cand);
+        free(ncand);
+        free(ipvt);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    for (int j = 0; j < A.n; j++)
+        jpvt[j] = j+1;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        // The candidates are read from the updated trailing matrix.
+        #pragma omp taskwait
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        //=====================================
+        // tournament over the tile columns
+        //=====================================
+        int nblk = A.nt-k;
+        int none = 0;
+        for (int b = 0; b < nblk; b++) {
+            int nvan = plasma_tile_nview(A, k+b);
+            ncand[b] = nvan;
+            for (int j = 0; j < nvan; j++)
+                cand[b*A.nb+j] = (k+b)*A.nb+j;
+        }
+        if (nblk == 1) {
+            // Only the order of the pivots within the panel.
+            plasma_pzgeqp3_select(A, k, cand, &ncand[0], cand, &none, nvak,
+                                  sequence, request);
+        }
+        else {
+            int *operations = NULL;
+            int num_operations;
+            plasma_rh_tree_operations(plasma, nblk, 1,
+                                      &operations, &num_operations);
+            for (int iop = 0; iop < num_operations; iop++) {
+                int col, b, bpiv;
+                plasma_enum_t kernel;
+                plasma_rh_tree_get_operation(operations, iop,
+                                             &kernel, &col, &b, &bpiv);
+                if (kernel == PlasmaGeKernel)
+                    continue;
+
+                // The winners of b and bpiv go to bpiv.
+                plasma_pzgeqp3_select(A, k,
+                                      &cand[bpiv*A.nb], &ncand[bpiv],
+                                      &cand[b*A.nb], &ncand[b], nvak,
+                                      sequence, request);
+            }
+            plasma_rh_tree_release(plasma, operations);
+        }
+        #pragma omp taskwait
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        //=============================================
+        // Swap the winners to the front of the panel.
+        //=============================================
+        for (int i = 0; i < nvak; i++) {
+            int p = k*A.nb+i;
+            int c = cand[i];
+            ipvt[p] = c+1;
+
+            int tmp = jpvt[p];
+            jpvt[p] = jpvt[c];
+            jpvt[c] = tmp;
+
+            // The column at p moves to c.
+            for (int l = i+1; l < nvak; l++)
+                if (cand[l] == p)
+                    cand[l] = c;
+        }
+        for (int m = 0; m < A.mt; m++) {
+            #pragma omp task priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("zlaswp", A(m, 0));
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    int mvam = plasma_tile_mview(A, m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, m*A.mb, 0, mvam, A.n);
+                    core_zlaswp(PlasmaColumnwise, view,
+                                k*A.nb+1, k*A.nb+nvak, ipvt, 1);
+                }
+                PLASMA_TRACE_STOP("zlaswp", 1, A(m, 0), &ipvt[k*A.nb]);
+            }
+        }
+        #pragma omp taskwait
+
+        //=====================================
+        // panel and trailing update
+        //=====================================
+        core_omp_zgeqrt(
+            mvak, nvak, ib,
+            A(k, k), ldak,
+            T(k, k), T.mb,
+            work, plasma->panel_blas_threads,
+            sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            core_omp_zunmqr(
+                PlasmaLeft, Plasma_ConjTrans,
+                mvak, nvan, imin(mvak, nvak), ib,
+                A(k, k), ldak,
+                T(k, k), T.mb,
+                A(k, n), ldak,
+                work,
+                sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            core_omp_ztsqrt(
+                mvam, nvak, ib,
+                A(k, k), ldak,
+                A(m, k), ldam,
+                T(m, k), T.mb,
+                work,
+                sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_ztsmqr(
+                    PlasmaLeft, Plasma_ConjTrans,
+                    A.mb, nvan, mvam, nvan, nvak, ib,
+                    A(k, n), ldak,
+                    A(m, n), ldam,
+                    A(m, k), ldam,
+                    T(m, k), T.mb,
+                    work,
+                    sequence, request);
+            }
+        }
+    }
+    // The candidates and interchanges are read by the tasks.
+    #pragma omp taskwait
+
+    free(cand);
+    free(ncand);
+    free(ipvt);
+}
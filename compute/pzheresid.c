@@ -0,0 +1,121 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define X(m, n) (plasma_complex64_t*)plasma_tile_addr(X, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+#define R(m, n) (plasma_complex64_t*)plasma_tile_addr(R, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile residual R = B - A*X of a Hermitian system, with the largest
+ *  absolute value of each column of R in values.
+ *  Each tile of R is updated by the diagonal tile of A first, so that its
+ *  last update is a gemm that also takes the maxima of its columns.
+ *  work is of size R.mt*R.n.
+ ******************************************************************************/
+void plasma_pzheresid(plasma_enum_t uplo,
+                      plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, double *work, double *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int m = 0; m < R.mt; m++) {
+        int mvrm = plasma_tile_mview(R, m);
+        int ldam = plasma_tile_mmain(A, m);
+        int ldbm = plasma_tile_mmain(B, m);
+        int ldxm = plasma_tile_mmain(X, m);
+        int ldrm = plasma_tile_mmain(R, m);
+        for (int n = 0; n < R.nt; n++) {
+            int nvrn = plasma_tile_nview(R, n);
+            double *valuesmn = &work[R.n*m+n*R.nb];
+            core_omp_zlacpy(PlasmaGeneral,
+                            mvrm, nvrn,
+                            B(m, n), ldbm,
+                            R(m, n), ldrm,
+                            sequence, request);
+            core_omp_zhemm(
+                PlasmaLeft, uplo,
+                mvrm, nvrn,
+                -1.0, A(m, m), ldam,
+                      X(m, n), ldxm,
+                1.0,  R(m, n), ldrm,
+                sequence, request);
+            if (R.mt == 1) {
+                core_omp_dzamax(PlasmaColumnwise,
+                                mvrm, nvrn,
+                                R(m, n), ldrm,
+                                valuesmn,
+                                sequence, request);
+                continue;
+            }
+            int klast = m == R.mt-1 ? R.mt-2 : R.mt-1;
+            for (int k = 0; k < R.mt; k++) {
+                if (k == m)
+                    continue;
+
+                int mvrk = plasma_tile_mview(R, k);
+                int ldak = plasma_tile_mmain(A, k);
+                int ldxk = plasma_tile_mmain(X, k);
+                // A(m, k) is stored, or its conjugate transpose A(k, m).
+                plasma_enum_t trans;
+                plasma_complex64_t *Amk;
+                int ldamk;
+                if ((uplo == PlasmaLower) == (k < m)) {
+                    trans = PlasmaNoTrans;
+                    Amk = A(m, k);
+                    ldamk = ldam;
+                }
+                else {
+                    trans = PlasmaConjTrans;
+                    Amk = A(k, m);
+                    ldamk = ldak;
+                }
+                if (k != klast) {
+                    core_omp_zgemm(
+                        trans, PlasmaNoTrans,
+                        mvrm, nvrn, mvrk,
+                        -1.0, Amk,     ldamk,
+                              X(k, n), ldxk,
+                        1.0,  R(m, n), ldrm,
+                        sequence, request);
+                }
+                else {
+                    core_omp_zgemm_dzamax(
+                        trans, PlasmaNoTrans,
+                        mvrm, nvrn, mvrk,
+                        -1.0, Amk,     ldamk,
+                              X(k, n), ldxk,
+                        1.0,  R(m, n), ldrm,
+                        valuesmn,
+                        sequence, request);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+    core_omp_damax(PlasmaRowwise,
+                   R.n, R.mt,
+                   work, R.n,
+                   values,
+                   sequence, request);
+}
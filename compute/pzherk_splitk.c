@@ -0,0 +1,72 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/***************************************************************************//**
+ * Parallel tile Hermitian rank-k update with the inner dimension split into
+ * parts of about the same number of tiles, as plasma_pzgemm_splitk(). Part 0
+ * updates the uplo triangle of C, and part g > 0 computes its update into
+ * the workspace W[g-1], of the size of C, added into C by a binary tree.
+ * @see plasma_gemm_splits
+ ******************************************************************************/
+void plasma_pzherk_splitk(plasma_enum_t uplo, plasma_enum_t trans,
+                          double alpha, plasma_desc_t A,
+                          double beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int kdim = trans == PlasmaNoTrans ? A.n : A.m;
+    int kt = trans == PlasmaNoTrans ? A.nt : A.mt;
+    int kb = trans == PlasmaNoTrans ? A.nb : A.mb;
+
+    for (int g = 0; g < splits; g++) {
+        int k1 = g*kt/splits*kb;
+        int k2 = imin((g+1)*kt/splits*kb, kdim);
+
+        plasma_desc_t Ag = trans == PlasmaNoTrans
+            ? plasma_desc_view(A, 0, k1, A.m, k2-k1)
+            : plasma_desc_view(A, k1, 0, k2-k1, A.n);
+
+        if (g == 0)
+            plasma_pzherk(uplo, trans,
+                          alpha, Ag,
+                          beta,  C,
+                          sequence, request);
+        else
+            plasma_pzherk(uplo, trans,
+                          alpha, Ag,
+                          0.0,   W[g-1],
+                          sequence, request);
+    }
+
+    // Part g accumulates part g+s at the level of stride s.
+    for (int s = 1; s < splits; s *= 2) {
+        for (int g = 0; g+s < splits; g += 2*s) {
+            plasma_desc_t D = g == 0 ? C : W[g-1];
+            plasma_pztradd(uplo, PlasmaNoTrans,
+                           1.0, W[g+s-1],
+                           1.0, D,
+                           sequence, request);
+        }
+    }
+}
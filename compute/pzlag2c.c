@@ -12,6 +12,7 @@
 
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
+#include "plasma_internal.h"
 #include "plasma_types.h"
 #include "plasma_internal_zc.h"
 #include "core_blas_zc.h"
@@ -45,3 +46,50 @@ void plasma_pzlag2c(plasma_desc_t A, plasma_desc_t As,
         }
     }
 }
+
+/***************************************************************************//**
+ * Parallel translation of the LAPACK array pA to the tile matrix A, fused
+ * with its conversion to single complex precision in As, so that pA is read
+ * once for both.
+ * @see plasma_pzge2desc
+ ******************************************************************************/
+void plasma_pzge2desc_lag2c(plasma_complex64_t *pA, int lda,
+                            plasma_desc_t A, plasma_desc_t As,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    // The in-place, view, packed and row-major translations are not fused.
+    plasma_context_t *plasma = plasma_context_self();
+    if (A.translation != PlasmaOutplace || A.rate > 0 ||
+        plasma->array_layout == PlasmaRowMajor) {
+        plasma_pzge2desc(pA, lda, A, sequence, request);
+        plasma_pzlag2c(A, As, sequence, request);
+        return;
+    }
+
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int m = 0; m < A.mt; m++) {
+        int ldt  = plasma_tile_mmain(A,  m);
+        int ldts = plasma_tile_mmain(As, m);
+        for (int n = 0; n < A.nt; n++) {
+            int x1 = n == 0 ? A.j%A.nb : 0;
+            int y1 = m == 0 ? A.i%A.mb : 0;
+            int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+            int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+            plasma_complex64_t *f77 = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+            plasma_complex64_t *bdl = A(m, n);
+            plasma_complex32_t *bdls = As(m, n);
+
+            core_omp_zlacpy_lag2c(
+                y2-y1, x2-x1,
+                &(f77[x1*lda+y1]),   lda,
+                &(bdl[x1*ldt+y1]),   ldt,
+                &(bdls[x1*ldts+y1]), ldts,
+                sequence, request);
+        }
+    }
+}
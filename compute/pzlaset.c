@@ -20,11 +20,65 @@
 
 #define A(m, n) ((plasma_complex64_t*)plasma_tile_addr(A, m, n))
 
+/******************************************************************************/
+// Returns the number of rows of the submatrix in the tile row i.
+static int plasma_pzlaset_rows(plasma_desc_t A, int i)
+{
+    if (i == 0 && i == A.mt-1)
+        return A.m;
+    else if (i == 0)
+        return A.mb-A.i%A.mb;
+    else if (i == A.mt-1)
+        return (A.i+A.m+A.mb-1)%A.mb+1;
+    else
+        return A.mb;
+}
+
+/******************************************************************************/
+// Returns the number of columns of the submatrix in the tile column j.
+static int plasma_pzlaset_cols(plasma_desc_t A, int j)
+{
+    if (j == 0 && j == A.nt-1)
+        return A.n;
+    else if (j == 0)
+        return A.nb-A.j%A.nb;
+    else if (j == A.nt-1)
+        return (A.j+A.n+A.nb-1)%A.nb+1;
+    else
+        return A.nb;
+}
+
+/******************************************************************************/
+// Tags the tile (i, j) of the uplo part of A with the structure laset
+// leaves it in.
+static void plasma_pzlaset_structure(plasma_enum_t uplo,
+                                     plasma_complex64_t alpha,
+                                     plasma_complex64_t beta,
+                                     plasma_desc_t A, int i, int j)
+{
+    // Only the uplo triangle of a diagonal tile is set.
+    plasma_enum_t structure = PlasmaTileDense;
+    if (i != j || uplo == PlasmaGeneral) {
+        if (alpha == 0.0 && (i != j || beta == 0.0))
+            structure = PlasmaTileZero;
+        else if (alpha == 0.0 && beta == 1.0 &&
+                 plasma_tile_mview(A, i) == plasma_tile_nview(A, j))
+            structure = PlasmaTileIdentity;
+    }
+
+    plasma_tile_structure_set(A, i, j, structure);
+}
+
 /***************************************************************************//**
  *  Initializes the matrix A to beta on the diagonal and alpha on the
  *  offdiagonals. Applies alpha correctly for any shape of the submatrix
  *  described by A, but applies beta correctly only for submatrices aligned
  *  with the diagonal of the main matrix (A.i = A.j).
+ *  With PlasmaColumnSweep, submits one task per tile column, setting its
+ *  tiles in a taskloop. With A fresh zero storage and alpha = 0, only the
+ *  diagonal tiles are set, if beta is not 0.
+ *  The tiles of A with structure tags are tagged zero or identity.
+ * @see plasma_desc_general_zero_create
  **/
 void plasma_pzlaset(plasma_enum_t uplo,
                     plasma_complex64_t alpha, plasma_complex64_t beta,
@@ -35,45 +89,78 @@ void plasma_pzlaset(plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
-    int i, j;
-    int m, n;
-
     int lm1 = A.gm/A.mb;
     int ln1 = A.gn/A.nb;
 
-    for (i = 0; i < A.mt; i++) {
-        if (i == 0 && i == A.mt-1)
-            m = A.m;
-        else if (i == 0)
-            m = A.mb-A.i%A.mb;
-        else if (i == A.mt-1)
-            m = (A.i+A.m+A.mb-1)%A.mb+1;
-        else
-            m = A.mb;
+    // The offdiagonal tiles of fresh zero storage are already alpha = 0.
+    int fresh = A.zero && alpha == 0.0;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (!fresh && plasma_column_sweep(plasma, A.mt)) {
+        plasma_complex64_t **tiles = (plasma_complex64_t**)
+            malloc((size_t)A.mt*sizeof(plasma_complex64_t*));
+        if (tiles == NULL) {
+            plasma_error("malloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+        for (int j = 0; j < A.nt; j++) {
+            int i0 = uplo == PlasmaLower ? j : 0;
+            int i1 = uplo == PlasmaUpper ? imin(j+1, A.mt) : A.mt;
+            if (i0 >= i1)
+                continue;
+
+            int count = i1-i0;
+            for (int i = i0; i < i1; i++) {
+                tiles[i-i0] = A(i, j);
+                plasma_pzlaset_structure(uplo, alpha, beta, A, i, j);
+            }
+
+            #pragma omp task depend(iterator(int t = 0:count), \
+                                    out:tiles[t][0]) \
+                                    priority(plasma_sequence_priority(sequence))
+            {
+                #pragma omp taskloop grainsize(1)
+                for (int i = i0; i < i0+count; i++) {
+                    int mb = A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb;
+                    int ioff = i == 0 ? A.i%A.mb : 0;
+                    int joff = j == 0 ? A.j%A.nb : 0;
+                    PLASMA_TRACE_START("zlaset", A(i, j));
+                    core_zlaset(i == j ? uplo : PlasmaGeneral,
+                                plasma_pzlaset_rows(A, i),
+                                plasma_pzlaset_cols(A, j),
+                                alpha, i != j ? alpha : beta,
+                                A(i, j)+ioff+joff*mb, mb);
+                    PLASMA_TRACE_STOP("zlaset", 1, A(i, j));
+                }
+            }
+        }
+        free(tiles);
+        return;
+    }
+
+    for (int i = 0; i < A.mt; i++) {
+        int m = plasma_pzlaset_rows(A, i);
+        for (int j = 0; j < A.nt; j++) {
+            int n = plasma_pzlaset_cols(A, j);
+            if ((uplo == PlasmaLower && i < j) ||
+                (uplo == PlasmaUpper && i > j))
+                continue;
 
-        for (j = 0; j < A.nt; j++) {
-            if (j == 0 && j == A.nt-1)
-                n = A.n;
-            else if (j == 0)
-                n = A.nb-A.j%A.nb;
-            else if (j == A.nt-1)
-                n = (A.j+A.n+A.nb-1)%A.nb+1;
-            else
-                n = A.nb;
+            plasma_pzlaset_structure(uplo, alpha, beta, A, i, j);
+            if (fresh && (i != j || beta == 0.0))
+                continue;
 
-            if (uplo == PlasmaGeneral ||
-                (uplo == PlasmaLower && i >= j) ||
-                (uplo == PlasmaUpper && i <= j))
-                core_omp_zlaset(i == j ? uplo : PlasmaGeneral,
-                                A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb,
-                                A.j/A.nb+j == ln1 ? A.gn-ln1*A.nb : A.nb,
-                                i == 0 ? A.i%A.mb : 0,
-                                j == 0 ? A.j%A.nb : 0,
-                                m,
-                                n,
-                                alpha,
-                                i != j ? alpha : beta,
-                                A(i, j));
+            core_omp_zlaset(i == j ? uplo : PlasmaGeneral,
+                            A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb,
+                            A.j/A.nb+j == ln1 ? A.gn-ln1*A.nb : A.nb,
+                            i == 0 ? A.i%A.mb : 0,
+                            j == 0 ? A.j%A.nb : 0,
+                            m,
+                            n,
+                            alpha,
+                            i != j ? alpha : beta,
+                            A(i, j));
         }
     }
 }
@@ -0,0 +1,161 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+
+/***************************************************************************//**
+ *  Submits step k of plasma_pzlaswp_trsm: the pivots of panel k, the solve
+ *  with the diagonal tile of L and the updates of the rows of B below.
+ *  plasma_pzgesv submits it right after panel k of the factorization.
+ ******************************************************************************/
+void plasma_pzlaswp_trsm_step(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                              int k,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    plasma_complex64_t *a00, *a20;
+    a00 = A(k, k);
+    a20 = A(A.mt-1, k);
+
+    size_t ma00k = (size_t)(A.mt-k-1)*A.mb;
+    int na00k = plasma_tile_nmain(A, k);
+    int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldbk = plasma_tile_mmain(B, k);
+
+    for (int n = 0; n < B.nt; n++) {
+        plasma_complex64_t *b10, *b01, *b11, *b21;
+        b10 = k > 0 ? B(k-1, n) : B(k, n);
+        b01 = B(k, n);
+        b11 = B(imin(k+1, B.mt-1), n);
+        b21 = B(B.mt-1, n);
+
+        int ldb10 = plasma_tile_mmain(B, imax(k-1, 0));
+        int ldb11 = plasma_tile_mmain(B, imin(k+1, B.mt-1));
+        int ldb21 = plasma_tile_mmain(B, B.mt-1);
+
+        int nvbn = plasma_tile_nview(B, n);
+
+        // laswp
+        #pragma omp task depend(in:ipiv[k*A.mb:mvak]) \
+                         depend(inout:b10[0:ldb10*nvbn]) \
+                         depend(inout:b01[0:ldbk*nvbn]) \
+                         depend(inout:b11[0:ldb11*nvbn]) \
+                         depend(inout:b21[0:ldb21*nvbn]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            PLASMA_TRACE_START("zlaswp", b10);
+            if (PLASMA_TRACE_RUN(sequence)) {
+                int k1 = k*A.mb+1;
+                int k2 = imin(k*A.mb+A.mb, A.m);
+                plasma_desc_t view =
+                    plasma_desc_view(B, 0, n*B.nb, B.m, nvbn);
+                core_zlaswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            }
+            PLASMA_TRACE_STOP("zlaswp", 4, b10, b01, b11, b21,
+                              &ipiv[k*A.mb]);
+        }
+
+        // trsm
+        #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                         depend(inout:b01[0:ldbk*nvbn]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            PLASMA_TRACE_START("ztrsm", b01);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_ztrsm(PlasmaLeft, PlasmaLower,
+                           PlasmaNoTrans, PlasmaUnit,
+                           mvak, nvbn,
+                           1.0, A(k, k), ldak,
+                                B(k, n), ldbk);
+            PLASMA_TRACE_FLOPS(PlasmaComplexDouble,
+                               (double)mvak*mvak*nvbn,
+                               0.5*mvak*mvak + 2.0*mvak*nvbn);
+            PLASMA_TRACE_STOP("ztrsm", 1, b01, a00);
+        }
+
+        // gemm
+        for (int m = k+1; m < B.mt; m++) {
+            plasma_complex64_t *amk = A(m, k);
+            plasma_complex64_t *bmn = B(m, n);
+            int mvbm = plasma_tile_mview(B, m);
+            int ldam = plasma_tile_mmain(A, m);
+            int ldbm = plasma_tile_mmain(B, m);
+
+            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                             depend(in:a20[0:lda20*nvak]) \
+                             depend(in:amk[0:ldam*nvak]) \
+                             depend(in:b01[0:ldbk*nvbn]) \
+                             depend(inout:bmn[0:ldbm*nvbn]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("zgemm", bmn);
+                if (PLASMA_TRACE_RUN(sequence))
+                    core_zgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvbm, nvbn, nvak,
+                        -1.0, A(m, k), ldam,
+                              B(k, n), ldbk,
+                        1.0,  B(m, n), ldbm);
+                PLASMA_TRACE_FLOPS(PlasmaComplexDouble,
+                                   2.0*mvbm*nvbn*nvak,
+                                   (double)mvbm*nvak +
+                                   (double)nvak*nvbn + 2.0*mvbm*nvbn);
+                PLASMA_TRACE_STOP("zgemm", 1, bmn, a00, a20, amk, b01);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel forward substitution L X = P B with the factors of plasma_pzgetrf
+ *  without the pivoting to the left. The pivots of panel k are applied to B
+ *  right before the solve with the diagonal tile of L of step k, in the
+ *  order of the factorization, so that L need not be pivoted again.
+ *
+ *  The tasks follow the tile updates of plasma_pzgetrf, one laswp, one trsm
+ *  and one gemm per tile row of each tile column of B. Row k-1 of each
+ *  column marks the gemms of step k-1: they all read it, and the laswp of
+ *  step k, which may touch all the rows below, waits for them through it.
+ *  The columns of L are read through the tiles keyed by the panels of
+ *  plasma_pzgetrf, so the solve can be submitted with the factorization.
+ * @see plasma_omp_zgetrs
+ ******************************************************************************/
+void plasma_pzlaswp_trsm(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        plasma_pzlaswp_trsm_step(A, ipiv, B, k, sequence, request);
+    }
+}
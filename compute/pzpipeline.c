@@ -0,0 +1,117 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_z.h"
+
+/***************************************************************************//**
+ *  Parallel tile element-wise pipeline: the operations are applied in order
+ *  to the tile (m, n) of the updated matrices by a single task, with the
+ *  tile (m, n), or (n, m) if read transposed, of their sources.
+ *
+ *  The task has one depend clause per operand, and the clauses of the
+ *  missing operands repeat the tile of an updated matrix, so that the
+ *  dependencies are those of the tasks of the separate operations.
+ * @see plasma_omp_zpipeline_run
+ ******************************************************************************/
+void plasma_pzpipeline(plasma_zpipeline_t pipeline,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // The tiles of the updated matrices.
+    plasma_desc_t B = pipeline.operands[pipeline.ops[0].b];
+
+    for (int m = 0; m < B.mt; m++) {
+        int mvbm = plasma_tile_mview(B, m);
+        for (int n = 0; n < B.nt; n++) {
+            int nvbn = plasma_tile_nview(B, n);
+
+            void *tile[PlasmaPipelineMaxOperands];
+            int ld[PlasmaPipelineMaxOperands];
+            char *out[PlasmaPipelineMaxOperands];
+            char *in[PlasmaPipelineMaxOperands];
+            size_t lout[PlasmaPipelineMaxOperands];
+            size_t lin[PlasmaPipelineMaxOperands];
+            for (int k = 0; k < pipeline.num_operands; k++) {
+                plasma_desc_t C = pipeline.operands[k];
+                int mc = pipeline.read_trans[k] ? n : m;
+                int nc = pipeline.read_trans[k] ? m : n;
+                ld[k] = plasma_tile_mmain(C, mc);
+                tile[k] = plasma_tile_addr(C, mc, nc);
+                size_t size = plasma_element_size(C.precision) *
+                              ld[k]*plasma_tile_nview(C, nc);
+                if (pipeline.written[k]) {
+                    out[k] = (char*)tile[k];
+                    lout[k] = size;
+                    in[k] = NULL;
+                }
+                else {
+                    out[k] = NULL;
+                    in[k] = (char*)tile[k];
+                    lin[k] = size;
+                }
+            }
+            int b = pipeline.ops[0].b;
+            for (int k = 0; k < PlasmaPipelineMaxOperands; k++) {
+                if (k >= pipeline.num_operands || out[k] == NULL) {
+                    out[k] = (char*)tile[b];
+                    lout[k] = lout[b];
+                }
+                if (k >= pipeline.num_operands || in[k] == NULL) {
+                    in[k] = (char*)tile[b];
+                    lin[k] = lout[b];
+                }
+            }
+            char *out0 = out[0], *out1 = out[1], *out2 = out[2], *out3 = out[3];
+            char *in0 = in[0], *in1 = in[1], *in2 = in[2], *in3 = in[3];
+            size_t lout0 = lout[0], lout1 = lout[1],
+                   lout2 = lout[2], lout3 = lout[3];
+            size_t lin0 = lin[0], lin1 = lin[1], lin2 = lin[2], lin3 = lin[3];
+
+            #pragma omp task depend(inout:out0[0:lout0]) \
+                             depend(inout:out1[0:lout1]) \
+                             depend(inout:out2[0:lout2]) \
+                             depend(inout:out3[0:lout3]) \
+                             depend(in:in0[0:lin0]) \
+                             depend(in:in1[0:lin1]) \
+                             depend(in:in2[0:lin2]) \
+                             depend(in:in3[0:lin3]) \
+                             priority(plasma_sequence_priority(sequence))
+            {
+                PLASMA_TRACE_START("zpipeline", out0);
+                if (PLASMA_TRACE_RUN(sequence)) {
+                    for (int iop = 0; iop < pipeline.num_ops; iop++) {
+                        const plasma_zpipeline_op_t *op = &pipeline.ops[iop];
+                        if ((op->uplo == PlasmaLower && m < n) ||
+                            (op->uplo == PlasmaUpper && m > n))
+                            continue;
+
+                        op->kernel(op, m == n ? op->uplo : PlasmaGeneral,
+                                   m == n, mvbm, nvbn,
+                                   op->a < 0 ? NULL : tile[op->a],
+                                   op->a < 0 ? 0 : ld[op->a],
+                                   tile[op->b], ld[op->b]);
+                    }
+                }
+                PLASMA_TRACE_STOP("zpipeline", 4, out0, out1, out2, out3,
+                                  in0, in1, in2, in3);
+            }
+        }
+    }
+}
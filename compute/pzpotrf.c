@@ -11,42 +11,775 @@
  **/
 
 #include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_blas_threads.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_device.h"
 #include "plasma_internal.h"
+#include "plasma_mpi.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#include <omp.h>
+#include <stdlib.h>
+
+#define COMPLEX
+
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+
+#ifdef COMPLEX
+/******************************************************************************/
+// Splits the tiles of panel k for the 3M trailing updates, each tile as the
+// left operand of the products, in S[2*i], and as the right operand,
+// conjugate transposed, in S[2*i+1], for the tile i of the panel.
+static void plasma_pzpotrf_split(plasma_enum_t uplo, plasma_desc_t A, int k,
+                                 double **S,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    for (int i = k+1; i < A.mt; i++) {
+        int mvai = plasma_tile_mview(A, i);
+        if (uplo == PlasmaLower) {
+            int ldai = plasma_tile_mmain(A, i);
+            if (i > k+1)
+                core_omp_zgemm3m_split(PlasmaNoTrans, mvai, A.mb,
+                                       A(i, k), ldai, &S[2*i],
+                                       sequence, request);
+            if (i < A.mt-1)
+                core_omp_zgemm3m_split(PlasmaConjTrans, A.mb, mvai,
+                                       A(i, k), ldai, &S[2*i+1],
+                                       sequence, request);
+        }
+        else {
+            int ldak = plasma_tile_mmain(A, k);
+            if (i < A.mt-1)
+                core_omp_zgemm3m_split(PlasmaConjTrans, mvai, A.mb,
+                                       A(k, i), ldak, &S[2*i],
+                                       sequence, request);
+            if (i > k+1)
+                core_omp_zgemm3m_split(PlasmaNoTrans, A.mb, mvai,
+                                       A(k, i), ldak, &S[2*i+1],
+                                       sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Frees the split tiles of panel k after the trailing updates reading them.
+static void plasma_pzpotrf_split_free(plasma_desc_t A, int k, double **S,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    for (int i = k+1; i < A.mt; i++) {
+        core_omp_zgemm3m_free(&S[2*i], sequence, request);
+        core_omp_zgemm3m_free(&S[2*i+1], sequence, request);
+    }
+}
+#endif
+
+/******************************************************************************/
+// Applies the update of panel k to the tile (m, n), m > n, of the lower
+// triangle, A(m, n) -= A(m, k)*A(n, k)^H, or to the tile (n, m) of the
+// upper triangle, by the 3M algorithm with the split tiles S of the panel,
+// if not NULL, or emulated by the Ozaki scheme with PlasmaOzakiGemm.
+static void plasma_pzpotrf_gemm(plasma_enum_t uplo, plasma_desc_t A,
+                                int m, int n, int k, double **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    int mvam = plasma_tile_mview(A, m);
+    int ldam = plasma_tile_mmain(A, m);
+    int ldan = plasma_tile_mmain(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    if (uplo == PlasmaLower) {
+        plasma_tile_affinity(A, m, n);
+#ifdef COMPLEX
+        if (S != NULL) {
+            core_omp_zgemm3m(
+                mvam, A.mb, A.mb,
+                -1.0, &S[2*m], &S[2*n+1],
+                 1.0, A(m, n), ldam,
+                sequence, request);
+            return;
+        }
+#endif
+        if (plasma_gemm_ozaki(plasma) > 0) {
+            core_omp_zgemm_emulated(
+                PlasmaNoTrans, PlasmaConjTrans,
+                mvam, A.mb, A.mb, plasma_gemm_ozaki(plasma),
+                -1.0, A(m, k), ldam,
+                      A(n, k), ldan,
+                 1.0, A(m, n), ldam,
+                sequence, request);
+            return;
+        }
+        PLASMA_UPDATE(plasma, core_omp_zgemm)(
+            PlasmaNoTrans, PlasmaConjTrans,
+            mvam, A.mb, A.mb,
+            -1.0, A(m, k), ldam,
+                  A(n, k), ldan,
+             1.0, A(m, n), ldam,
+            sequence, request);
+    }
+    else {
+        plasma_tile_affinity(A, n, m);
+#ifdef COMPLEX
+        if (S != NULL) {
+            core_omp_zgemm3m(
+                A.mb, mvam, A.mb,
+                -1.0, &S[2*n], &S[2*m+1],
+                 1.0, A(n, m), ldan,
+                sequence, request);
+            return;
+        }
+#endif
+        if (plasma_gemm_ozaki(plasma) > 0) {
+            core_omp_zgemm_emulated(
+                PlasmaConjTrans, PlasmaNoTrans,
+                A.mb, mvam, A.mb, plasma_gemm_ozaki(plasma),
+                -1.0, A(k, n), ldak,
+                      A(k, m), ldak,
+                 1.0, A(n, m), ldan,
+                sequence, request);
+            return;
+        }
+        PLASMA_UPDATE(plasma, core_omp_zgemm)(
+            PlasmaConjTrans, PlasmaNoTrans,
+            A.mb, mvam, A.mb,
+            -1.0, A(k, n), ldak,
+                  A(k, m), ldak,
+             1.0, A(n, m), ldan,
+            sequence, request);
+    }
+}
+
+/******************************************************************************/
+// Applies the updates of the columns 0 to kl-1 to the tile (m, n) of the
+// lower triangle, A(m, n) -= A(m, 0:kl-1)*A(n, 0:kl-1)^H, or of their rows
+// to the tile (n, m) of the upper triangle, with one task per group
+// of consecutive tile products.
+static void plasma_pzpotrf_gemm_chain(plasma_enum_t uplo, plasma_desc_t A,
+                                      int m, int n, int kl, int group,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    if (uplo == PlasmaLower) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        int ldan = plasma_tile_mmain(A, n);
+        for (int j0 = 0; j0 < kl; j0 += group) {
+            int count = imin(group, kl-j0);
+            plasma_tile_affinity(A, m, n);
+            if (count == 1) {
+                PLASMA_UPDATE(plasma, core_omp_zgemm)(
+                    PlasmaNoTrans, PlasmaConjTrans,
+                    mvam, A.mb, A.mb,
+                    -1.0, A(m, j0), ldam,
+                          A(n, j0), ldan,
+                     1.0, A(m, n), ldam,
+                    sequence, request);
+                continue;
+            }
+            int kv[PlasmaCoarsenMaxTiles];
+            plasma_complex64_t *a[PlasmaCoarsenMaxTiles];
+            plasma_complex64_t *b[PlasmaCoarsenMaxTiles];
+            int lda[PlasmaCoarsenMaxTiles], ldb[PlasmaCoarsenMaxTiles];
+            for (int i = 0; i < count; i++) {
+                kv[i] = A.mb;
+                a[i] = A(m, j0+i);
+                lda[i] = ldam;
+                b[i] = A(n, j0+i);
+                ldb[i] = ldan;
+            }
+            core_omp_zgemm_chain(
+                PlasmaNoTrans, PlasmaConjTrans,
+                count, mvam, A.mb, kv,
+                -1.0, a, lda,
+                      b, ldb,
+                 1.0, A(m, n), ldam,
+                plasma_prefetch(plasma),
+                sequence, request);
+        }
+    }
+    else {
+        int nvam = plasma_tile_nview(A, m);
+        int ldan = plasma_tile_mmain(A, n);
+        for (int j0 = 0; j0 < kl; j0 += group) {
+            int count = imin(group, kl-j0);
+            plasma_tile_affinity(A, n, m);
+            if (count == 1) {
+                int ldaj = plasma_tile_mmain(A, j0);
+                PLASMA_UPDATE(plasma, core_omp_zgemm)(
+                    PlasmaConjTrans, PlasmaNoTrans,
+                    A.mb, nvam, A.mb,
+                    -1.0, A(j0, n), ldaj,
+                          A(j0, m), ldaj,
+                     1.0, A(n, m), ldan,
+                    sequence, request);
+                continue;
+            }
+            int kv[PlasmaCoarsenMaxTiles];
+            plasma_complex64_t *a[PlasmaCoarsenMaxTiles];
+            plasma_complex64_t *b[PlasmaCoarsenMaxTiles];
+            int lda[PlasmaCoarsenMaxTiles], ldb[PlasmaCoarsenMaxTiles];
+            for (int i = 0; i < count; i++) {
+                int ldaj = plasma_tile_mmain(A, j0+i);
+                kv[i] = A.mb;
+                a[i] = A(j0+i, n);
+                lda[i] = ldaj;
+                b[i] = A(j0+i, m);
+                ldb[i] = ldaj;
+            }
+            core_omp_zgemm_chain(
+                PlasmaConjTrans, PlasmaNoTrans,
+                count, A.mb, nvam, kv,
+                -1.0, a, lda,
+                      b, ldb,
+                 1.0, A(n, m), ldan,
+                plasma_prefetch(plasma),
+                sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// arguments of the ranks of the static Cholesky factorization
+typedef struct {
+    plasma_enum_t uplo;
+    plasma_desc_t A;
+    plasma_progress_t *progress;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pzpotrf_static_t;
+
+/******************************************************************************/
+// Runs the rank of the static Cholesky factorization: factors the tile
+// columns (rows of PlasmaUpper) n = rank, rank+size, ..., left-looking,
+// applying to each the updates of the columns before it as they complete.
+static void plasma_pzpotrf_static_rank(void *args, int rank, int size,
+                                       plasma_barrier_t *barrier)
+{
+    plasma_pzpotrf_static_t *schedule = (plasma_pzpotrf_static_t*)args;
+    plasma_enum_t uplo = schedule->uplo;
+    plasma_desc_t A = schedule->A;
+    plasma_progress_t *progress = schedule->progress;
+    plasma_sequence_t *sequence = schedule->sequence;
+    plasma_request_t *request = schedule->request;
+    // The ranks synchronize by the progress table instead.
+    (void)barrier;
+
+    for (int n = rank; n < A.nt; n += size) {
+        int mvan = plasma_tile_mview(A, n);
+        int ldan = plasma_tile_mmain(A, n);
+        for (int k = 0; k < n; k++) {
+            plasma_progress_wait(progress, k, 1);
+            if (sequence->status != PlasmaSuccess)
+                continue;
+
+            if (uplo == PlasmaLower) {
+                core_zherk(PlasmaLower, PlasmaNoTrans,
+                           mvan, A.mb,
+                           -1.0, A(n, k), ldan,
+                            1.0, A(n, n), ldan);
+                for (int m = n+1; m < A.mt; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    core_zgemm(PlasmaNoTrans, PlasmaConjTrans,
+                               mvam, A.mb, A.mb,
+                               -1.0, A(m, k), ldam,
+                                     A(n, k), ldan,
+                                1.0, A(m, n), ldam);
+                }
+            }
+            else {
+                int ldak = plasma_tile_mmain(A, k);
+                core_zherk(PlasmaUpper, PlasmaConjTrans,
+                           mvan, A.mb,
+                           -1.0, A(k, n), ldak,
+                            1.0, A(n, n), ldan);
+                for (int m = n+1; m < A.nt; m++) {
+                    int nvam = plasma_tile_nview(A, m);
+                    core_zgemm(PlasmaConjTrans, PlasmaNoTrans,
+                               A.mb, nvam, A.mb,
+                               -1.0, A(k, n), ldak,
+                                     A(k, m), ldak,
+                                1.0, A(n, m), ldan);
+                }
+            }
+        }
+        if (sequence->status == PlasmaSuccess) {
+            int info = core_zpotrf(uplo, mvan, A(n, n), ldan);
+            if (info != 0)
+                plasma_request_fail(sequence, request, A.nb*n+info);
+        }
+        if (sequence->status == PlasmaSuccess) {
+            for (int m = n+1; m < A.mt; m++) {
+                if (uplo == PlasmaLower) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    core_ztrsm(PlasmaRight, PlasmaLower,
+                               PlasmaConjTrans, PlasmaNonUnit,
+                               mvam, A.mb,
+                               1.0, A(n, n), ldan,
+                                    A(m, n), ldam);
+                }
+                else {
+                    int nvam = plasma_tile_nview(A, m);
+                    core_ztrsm(PlasmaLeft, PlasmaUpper,
+                               PlasmaConjTrans, PlasmaNonUnit,
+                               A.nb, nvam,
+                               1.0, A(n, n), ldan,
+                                    A(n, m), ldan);
+                }
+            }
+        }
+        // The other ranks wait for the column even if the sequence failed.
+        plasma_progress_set(progress, n, 1);
+    }
+}
 
 /***************************************************************************//**
- *  Parallel tile Cholesky factorization.
- * @see plasma_omp_zpotrf
+ *  Parallel tile Cholesky factorization - static scheduling.
+ *  The schedule is one task, depending on all the tiles of the stored
+ *  triangle, whose ranks run on a nested team of as many threads as the
+ *  team of the call, see plasma_team_run(), so that they all run at the
+ *  same time, whatever the other tasks of the team.
  ******************************************************************************/
-void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+static void plasma_pzpotrf_static(plasma_enum_t uplo, plasma_desc_t A,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int size = omp_get_num_threads();
+    int priority = plasma_sequence_priority(sequence);
+
+    int count = A.nt*(A.nt+1)/2;
+    plasma_complex64_t **tiles = (plasma_complex64_t**)
+        malloc((size_t)count*sizeof(plasma_complex64_t*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    int i = 0;
+    for (int n = 0; n < A.nt; n++)
+        for (int m = n; m < A.nt; m++)
+            tiles[i++] = uplo == PlasmaLower ? A(m, n) : A(n, m);
+
+    #pragma omp task depend(iterator(int t = 0:count), inout:tiles[t][0]) \
+                     priority(priority)
+    {
+        plasma_progress_t progress;
+        if (plasma_progress_init(&progress, A.nt) != PlasmaSuccess) {
+            plasma_error("plasma_progress_init() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        }
+        else {
+            plasma_pzpotrf_static_t schedule = {
+                uplo, A, &progress, sequence, request
+            };
+            plasma_team_run(PlasmaThreadTeam, PlasmaBindNone, size, priority,
+                            plasma_pzpotrf_static_rank, &schedule);
+            plasma_progress_destroy(&progress);
+        }
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+    free(tiles);
+}
+
+/******************************************************************************/
+// Factors the trailing matrix from tile column k0 by one task, depending on
+// all the tiles of its stored triangle, which gathers them in a column-major
+// array, factors it by the kernel with the threads of the BLAS, and scatters
+// the factor back to the tiles.
+static void plasma_pzpotrf_tail(plasma_enum_t uplo, plasma_desc_t A, int k0,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    int num_threads = plasma_num_threads(plasma);
+
+    int nt = A.mt-k0;
+    int count = nt*(nt+1)/2;
+    plasma_complex64_t **tiles = (plasma_complex64_t**)
+        malloc((size_t)count*sizeof(plasma_complex64_t*));
+    if (tiles == NULL) {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    int i = 0;
+    for (int n = k0; n < A.mt; n++)
+        for (int m = n; m < A.mt; m++)
+            tiles[i++] = uplo == PlasmaLower ? A(m, n) : A(n, m);
+
+    #pragma omp task depend(iterator(int t = 0:count), inout:tiles[t][0]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zpotrf_tail", A(k0, k0));
+        int n2 = (nt-1)*A.mb + plasma_tile_mview(A, A.mt-1);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            plasma_complex64_t *W = (plasma_complex64_t*)
+                malloc((size_t)n2*n2*sizeof(plasma_complex64_t));
+            if (W == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                for (int n = k0; n < A.mt; n++) {
+                    for (int m = n; m < A.mt; m++) {
+                        int am = uplo == PlasmaLower ? m : n;
+                        int an = uplo == PlasmaLower ? n : m;
+                        core_zlacpy(PlasmaGeneral,
+                                    plasma_tile_mview(A, am),
+                                    plasma_tile_nview(A, an),
+                                    A(am, an), plasma_tile_mmain(A, am),
+                                    &W[(am-k0)*A.mb + (size_t)n2*(an-k0)*A.nb],
+                                    n2);
+                    }
+                }
+                int blas_threads = plasma_blas_threads_local(num_threads);
+                int info = core_zpotrf(uplo, n2, W, n2);
+                plasma_blas_threads_local(blas_threads);
+                if (info != 0)
+                    plasma_request_fail(sequence, request, A.nb*k0+info);
+
+                for (int n = k0; n < A.mt; n++) {
+                    for (int m = n; m < A.mt; m++) {
+                        int am = uplo == PlasmaLower ? m : n;
+                        int an = uplo == PlasmaLower ? n : m;
+                        core_zlacpy(PlasmaGeneral,
+                                    plasma_tile_mview(A, am),
+                                    plasma_tile_nview(A, an),
+                                    &W[(am-k0)*A.mb + (size_t)n2*(an-k0)*A.nb],
+                                    n2,
+                                    A(am, an), plasma_tile_mmain(A, am));
+                    }
+                }
+                free(W);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, (double)n2*n2*n2/3.0,
+                           (double)n2*(n2+1));
+        PLASMA_TRACE_STOP("zpotrf_tail", 1, A(k0, k0));
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+    free(tiles);
+}
+
+/******************************************************************************/
+// arguments of the ranks of a multithreaded diagonal tile
+typedef struct {
+    plasma_enum_t uplo;
+    int n;
+    plasma_complex64_t *A;
+    int lda;
+    int ib;
+    int info;
+} plasma_pzpotrf_diag_t;
+
+/******************************************************************************/
+// Runs a rank of the team of a multithreaded diagonal tile.
+static void plasma_pzpotrf_diag_rank(void *args, int rank, int size,
+                                     plasma_barrier_t *barrier)
+{
+    plasma_pzpotrf_diag_t *diag = (plasma_pzpotrf_diag_t*)args;
+    core_zpotrf_team(diag->uplo, diag->n, diag->A, diag->lda, diag->ib,
+                     rank, size, &diag->info, barrier);
+}
+
+/******************************************************************************/
+// Submits the factorization of the diagonal tile A, with iinfo the index
+// of its first column. With PlasmaNumPanelThreads above 1, or the
+// PlasmaPanelBind PlasmaBindFast, the tile is factored by core_zpotrf_team()
+// on a team, see plasma_team_run(), to shorten the critical path through
+// the diagonal tiles, and else by core_omp_zpotrf(), also while capturing
+// a task graph.
+static void plasma_pzpotrf_diag(plasma_context_t *plasma,
+                                plasma_enum_t uplo, int n,
+                                plasma_complex64_t *A, int lda, int iinfo,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int num_panel_threads = plasma->num_panel_threads;
+    if ((num_panel_threads <= 1 && plasma->panel_bind != PlasmaBindFast) ||
+        plasma_graph_capture != NULL) {
+        core_omp_zpotrf(uplo, n, A, lda, iinfo, sequence, request);
+        return;
+    }
+
+    plasma_enum_t panel_team = plasma->panel_team;
+    plasma_enum_t panel_bind = plasma->panel_bind;
+    int ib = plasma->ib;
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zpotrf_team", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            plasma_pzpotrf_diag_t diag = { uplo, n, A, lda, ib, 0 };
+            plasma_team_run(panel_team, panel_bind, num_panel_threads, 0,
+                            plasma_pzpotrf_diag_rank, &diag);
+            if (diag.info != 0)
+                plasma_request_fail(sequence, request, iinfo+diag.info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, (double)n*n*n/3.0,
+                           (double)n*(n+1));
+        PLASMA_TRACE_STOP("zpotrf_team", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
+
+/******************************************************************************/
+// Submits the forward substitution of block row k of B, once column k of L
+// (row k of U for PlasmaUpper) is factored: B(k, :) = A(k, k)^{-1} B(k, :),
+// then B(m, :) -= A(m, k) B(k, :), or A(k, m)^H B(k, :), for the rows below.
+static void plasma_pzpotrf_forward(plasma_enum_t uplo, plasma_desc_t A,
+                                   plasma_desc_t B, int k,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldbk = plasma_tile_mmain(B, k);
+    plasma_enum_t trans = uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
+
+    for (int n = 0; n < B.nt; n++) {
+        int nvbn = plasma_tile_nview(B, n);
+        core_omp_ztrsm(
+            PlasmaLeft, uplo,
+            trans, PlasmaNonUnit,
+            mvak, nvbn,
+            1.0, A(k, k), ldak,
+                 B(k, n), ldbk,
+            sequence, request);
+
+        for (int m = k+1; m < B.mt; m++) {
+            int mvbm = plasma_tile_mview(B, m);
+            int ldbm = plasma_tile_mmain(B, m);
+            if (uplo == PlasmaLower) {
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_zgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvbm, nvbn, A.mb,
+                    -1.0, A(m, k), ldam,
+                          B(k, n), ldbk,
+                     1.0, B(m, n), ldbm,
+                    sequence, request);
+            }
+            else {
+                core_omp_zgemm(
+                    PlasmaConjTrans, PlasmaNoTrans,
+                    mvbm, nvbn, A.mb,
+                    -1.0, A(k, m), ldak,
+                          B(k, n), ldbk,
+                     1.0, B(m, n), ldbm,
+                    sequence, request);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization of a block-sparse matrix,
+ *  right-looking over its stored tiles only. The pattern holds the fill-in,
+ *  so that the updates by the stored tiles of each panel land in stored
+ *  tiles, and the empty tiles take no task.
+ **/
+static void plasma_pzpotrf_sparse(plasma_enum_t uplo, plasma_desc_t A,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    for (int k = 0; k < A.mt; k++) {
+        plasma_task_window(plasma, k);
+        if (sequence->status != PlasmaSuccess)
+            break;
+
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+        plasma_pzpotrf_diag(
+            plasma, uplo, mvak,
+            A(k, k), ldak,
+            A.nb*k,
+            sequence, request);
+
+        for (int m = k+1; m < A.mt; m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            if (uplo == PlasmaLower) {
+                if (plasma_tile_stored(A, m, k))
+                    core_omp_ztrsm(
+                        PlasmaRight, PlasmaLower,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        mvam, A.mb,
+                        1.0, A(k, k), ldak,
+                             A(m, k), ldam,
+                        sequence, request);
+            }
+            else {
+                if (plasma_tile_stored(A, k, m))
+                    core_omp_ztrsm(
+                        PlasmaLeft, PlasmaUpper,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        A.nb, mvam,
+                        1.0, A(k, k), ldak,
+                             A(k, m), ldak,
+                        sequence, request);
+            }
+        }
+        for (int n = k+1; n < A.mt; n++) {
+            if (uplo == PlasmaLower ? !plasma_tile_stored(A, n, k)
+                                    : !plasma_tile_stored(A, k, n))
+                continue;
+
+            int mvan = plasma_tile_mview(A, n);
+            int ldan = plasma_tile_mmain(A, n);
+            plasma_tile_affinity(A, n, n);
+            if (uplo == PlasmaLower)
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
+                    PlasmaLower, PlasmaNoTrans,
+                    mvan, A.mb,
+                    -1.0, A(n, k), ldan,
+                     1.0, A(n, n), ldan,
+                    sequence, request);
+            else
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
+                    PlasmaUpper, PlasmaConjTrans,
+                    mvan, A.mb,
+                    -1.0, A(k, n), ldak,
+                     1.0, A(n, n), ldan,
+                    sequence, request);
+
+            for (int m = n+1; m < A.mt; m++) {
+                if (uplo == PlasmaLower ? plasma_tile_stored(A, m, k)
+                                        : plasma_tile_stored(A, k, m))
+                    plasma_pzpotrf_gemm(uplo, A, m, n, k, NULL,
+                                        sequence, request);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization.
+ *  With PlasmaOffloadOn, the herk and gemm updates run on the device,
+ *  and the potrf and trsm of the panels on the host. The updates only read
+ *  the factored panels, which stay in the device tile cache until the end.
+ *  With PlasmaCoarsening, the left-looking gemm updates of a tile are
+ *  grouped by a few per task, while the columns have enough tiles.
+ *  With B, the forward substitution of each block row of B is submitted
+ *  right after its panel, in the same task graph.
+ **/
+static void plasma_pzpotrf_solve(plasma_enum_t uplo, plasma_desc_t A,
+                                 plasma_desc_t *B,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
 {
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int lookahead = plasma->lookahead;
+
+    // block-sparse matrix, over its stored tiles
+    if (A.layout == PlasmaSparseLayout) {
+        plasma_pzpotrf_sparse(uplo, A, sequence, request);
+        return;
+    }
+
+    // matrix of a single process, statically scheduled
+    if (plasma_static_scheduling(plasma) && A.p*A.q <= 1) {
+        plasma_pzpotrf_static(uplo, A, sequence, request);
+        return;
+    }
+
+    // Tile columns factored left-looking, before switching to right-looking.
+    // Left-looking keeps the task graph to one tile column at a time.
+    int kl = 0;
+    if (plasma->cholesky_variant == PlasmaLeftLooking)
+        kl = A.mt;
+    else if (plasma->cholesky_variant == PlasmaHybridLooking)
+        kl = imax(0, A.mt-plasma->cholesky_switch);
+
+    // Trailing tile columns factored by one task with the threads of the
+    // BLAS, once there are too few tiles left to keep the threads busy.
+    int kt = imax(kl, plasma_tail_step(plasma, A.mt));
+
+    // A matrix distributed over MPI processes is factored right-looking.
+    // Each process runs the tasks writing its tiles, and sends the tiles
+    // of each panel to the processes updating their tiles with them.
+    char *ranks = NULL;
+    if (A.p*A.q > 1) {
+        kl = 0;
+        kt = A.mt;
+        ranks = (char*)calloc(A.p*A.q, 1);
+        if (ranks == NULL) {
+            plasma_error("calloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+    }
+
+    // the split tiles of the panels for the 3M trailing updates,
+    // 2*A.mt for each panel, on a single process
+    double **S = NULL;
+#ifdef COMPLEX
+    if (plasma_gemm_3m(plasma) && A.p*A.q <= 1 && A.mt > kl+1) {
+        S = (double**)calloc(2*(size_t)A.mt*A.mt, sizeof(double*));
+        if (S == NULL) {
+            plasma_error("calloc() failed");
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            return;
+        }
+    }
+#endif
+
     //==============
     // PlasmaLower
     //==============
     if (uplo == PlasmaLower) {
-        for (int k = 0; k < A.mt; k++) {
+        for (int k = 0; k < kl; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak = plasma_tile_mview(A, k);
             int ldak = plasma_tile_mmain(A, k);
-            core_omp_zpotrf(
-                PlasmaLower, mvak,
+            // Apply the updates of the previous columns to column k.
+            for (int j = 0; j < k; j++) {
+                plasma_tile_affinity(A, k, k);
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
+                    PlasmaLower, PlasmaNoTrans,
+                    mvak, A.mb,
+                    -1.0, A(k, j), ldak,
+                     1.0, A(k, k), ldak,
+                    sequence, request);
+            }
+            plasma_pzpotrf_diag(
+                plasma, PlasmaLower, mvak,
                 A(k, k), ldak,
                 A.nb*k,
                 sequence, request);
+            // Read ahead the next panel of a mapped matrix.
+            plasma_desc_prefetch(A, k+1, A.mt-1, k+1, k+1, A(k, k));
 
+            int group = plasma_coarsen_tiles(plasma, A.mb, A.mb, A.mb,
+                                             A.mt-k-1);
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
+                plasma_pzpotrf_gemm_chain(PlasmaLower, A, m, k, k, group,
+                                          sequence, request);
                 core_omp_ztrsm(
                     PlasmaRight, PlasmaLower,
                     PlasmaConjTrans, PlasmaNonUnit,
@@ -55,44 +788,160 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                          A(m, k), ldam,
                     sequence, request);
             }
+
+            // forward substitution of block row k of B
+            if (B != NULL)
+                plasma_pzpotrf_forward(uplo, A, *B, k, sequence, request);
+        }
+        // Apply the updates of the left-looking columns
+        // to the trailing matrix factored right-looking.
+        int group = plasma_coarsen_tiles(plasma, A.mb, A.mb, A.mb,
+                                         (A.mt-kl)*(A.mt-kl-1)/2);
+        for (int n = kl; n < A.mt && kl > 0; n++) {
+            int mvan = plasma_tile_mview(A, n);
+            int ldan = plasma_tile_mmain(A, n);
+            for (int j = 0; j < kl; j++) {
+                plasma_tile_affinity(A, n, n);
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
+                    PlasmaLower, PlasmaNoTrans,
+                    mvan, A.mb,
+                    -1.0, A(n, j), ldan,
+                     1.0, A(n, n), ldan,
+                    sequence, request);
+            }
+            for (int m = n+1; m < A.mt; m++)
+                plasma_pzpotrf_gemm_chain(PlasmaLower, A, m, n, kl, group,
+                                          sequence, request);
+        }
+        for (int k = kl; k < kt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            double **Sk = S != NULL ? &S[2*A.mt*k] : NULL;
+            if (plasma_tile_local(A, k, k))
+                plasma_pzpotrf_diag(
+                    plasma, PlasmaLower, mvak,
+                    A(k, k), ldak,
+                    A.nb*k,
+                    sequence, request);
+            // Read ahead the next panel of a mapped matrix.
+            plasma_desc_prefetch(A, k+1, A.mt-1, k+1, k+1, A(k, k));
+
+            plasma_tile_owners(A, k+1, A.mt-1, k, k, ranks);
+            plasma_omp_tile_bcast(A, k, k, plasma_tile_rank(A, k, k), ranks,
+                                  sequence, request);
+
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
-                core_omp_zherk(
-                    PlasmaLower, PlasmaNoTrans,
-                    mvam, A.mb,
-                    -1.0, A(m, k), ldam,
-                     1.0, A(m, m), ldam,
-                    sequence, request);
+                if (plasma_tile_local(A, m, k))
+                    core_omp_ztrsm(
+                        PlasmaRight, PlasmaLower,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        mvam, A.mb,
+                        1.0, A(k, k), ldak,
+                             A(m, k), ldam,
+                        sequence, request);
+
+                // A(m, k) updates row m and column m.
+                plasma_tile_owners(A, m, m, k+1, m, ranks);
+                plasma_tile_owners(A, m, A.mt-1, m, m, ranks);
+                plasma_omp_tile_bcast(A, m, k, plasma_tile_rank(A, m, k),
+                                      ranks, sequence, request);
+            }
+#ifdef COMPLEX
+            if (Sk != NULL)
+                plasma_pzpotrf_split(PlasmaLower, A, k, Sk, sequence, request);
+#endif
+            // forward substitution of block row k of B
+            if (B != NULL)
+                plasma_pzpotrf_forward(uplo, A, *B, k, sequence, request);
 
-                for (int n = k+1; n < m; n++) {
-                    int ldan = plasma_tile_mmain(A, n);
-                    core_omp_zgemm(
-                        PlasmaNoTrans, PlasmaConjTrans,
-                        mvam, A.mb, A.mb,
+            // Update the next lookahead columns first,
+            // so that their panels become ready early.
+            int nla = imin(A.mt, k+1+lookahead);
+            for (int n = k+1; n < nla; n++) {
+                int mvan = plasma_tile_mview(A, n);
+                int ldan = plasma_tile_mmain(A, n);
+                if (plasma_tile_local(A, n, n)) {
+                    plasma_tile_affinity(A, n, n);
+                    PLASMA_UPDATE(plasma, core_omp_zherk)(
+                        PlasmaLower, PlasmaNoTrans,
+                        mvan, A.mb,
+                        -1.0, A(n, k), ldan,
+                         1.0, A(n, n), ldan,
+                        sequence, request);
+                }
+
+                for (int m = n+1; m < A.mt; m++) {
+                    if (plasma_tile_local(A, m, n))
+                        plasma_pzpotrf_gemm(PlasmaLower, A, m, n, k, Sk,
+                                            sequence, request);
+                }
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                if (m >= nla && plasma_tile_local(A, m, m)) {
+                    plasma_tile_affinity(A, m, m);
+                    PLASMA_UPDATE(plasma, core_omp_zherk)(
+                        PlasmaLower, PlasmaNoTrans,
+                        mvam, A.mb,
                         -1.0, A(m, k), ldam,
-                              A(n, k), ldan,
-                         1.0, A(m, n), ldam,
+                         1.0, A(m, m), ldam,
                         sequence, request);
                 }
+                for (int n = nla; n < m; n++) {
+                    if (plasma_tile_local(A, m, n))
+                        plasma_pzpotrf_gemm(PlasmaLower, A, m, n, k, Sk,
+                                            sequence, request);
+                }
             }
+#ifdef COMPLEX
+            if (Sk != NULL)
+                plasma_pzpotrf_split_free(A, k, Sk, sequence, request);
+#endif
         }
     }
     //==============
     // PlasmaUpper
     //==============
     else {
-        for (int k = 0; k < A.nt; k++) {
+        for (int k = 0; k < kl; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int nvak = plasma_tile_nview(A, k);
             int ldak = plasma_tile_mmain(A, k);
-            core_omp_zpotrf(
-                PlasmaUpper, nvak,
+            // Apply the updates of the previous rows to row k.
+            for (int j = 0; j < k; j++) {
+                int ldaj = plasma_tile_mmain(A, j);
+                plasma_tile_affinity(A, k, k);
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
+                    PlasmaUpper, PlasmaConjTrans,
+                    nvak, A.mb,
+                    -1.0, A(j, k), ldaj,
+                     1.0, A(k, k), ldak,
+                    sequence, request);
+            }
+            plasma_pzpotrf_diag(
+                plasma, PlasmaUpper, nvak,
                 A(k, k), ldak,
                 A.nb*k,
                 sequence, request);
+            // Read ahead the next panel of a mapped matrix.
+            plasma_desc_prefetch(A, k+1, k+1, k+1, A.nt-1, A(k, k));
 
+            int group = plasma_coarsen_tiles(plasma, A.mb, A.mb, A.mb,
+                                             A.nt-k-1);
             for (int m = k+1; m < A.nt; m++) {
                 int nvam = plasma_tile_nview(A, m);
+                plasma_pzpotrf_gemm_chain(PlasmaUpper, A, m, k, k, group,
+                                          sequence, request);
                 core_omp_ztrsm(
                     PlasmaLeft, PlasmaUpper,
                     PlasmaConjTrans, PlasmaNonUnit,
@@ -101,27 +950,190 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                          A(k, m), ldak,
                     sequence, request);
             }
-            for (int m = k+1; m < A.nt; m++) {
-                int nvam = plasma_tile_nview(A, m);
-                int ldam = plasma_tile_mmain(A, m);
-                core_omp_zherk(
+
+            // forward substitution of block row k of B
+            if (B != NULL)
+                plasma_pzpotrf_forward(uplo, A, *B, k, sequence, request);
+        }
+        // Apply the updates of the left-looking rows
+        // to the trailing matrix factored right-looking.
+        int group = plasma_coarsen_tiles(plasma, A.mb, A.mb, A.mb,
+                                         (A.nt-kl)*(A.nt-kl-1)/2);
+        for (int n = kl; n < A.nt && kl > 0; n++) {
+            int nvan = plasma_tile_nview(A, n);
+            int ldan = plasma_tile_mmain(A, n);
+            for (int j = 0; j < kl; j++) {
+                int ldaj = plasma_tile_mmain(A, j);
+                plasma_tile_affinity(A, n, n);
+                PLASMA_UPDATE(plasma, core_omp_zherk)(
                     PlasmaUpper, PlasmaConjTrans,
-                    nvam, A.mb,
-                    -1.0, A(k, m), ldak,
-                     1.0, A(m, m), ldam,
+                    nvan, A.mb,
+                    -1.0, A(j, n), ldaj,
+                     1.0, A(n, n), ldan,
                     sequence, request);
+            }
+            for (int m = n+1; m < A.nt; m++)
+                plasma_pzpotrf_gemm_chain(PlasmaUpper, A, m, n, kl, group,
+                                          sequence, request);
+        }
+        for (int k = kl; k < kt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            double **Sk = S != NULL ? &S[2*A.mt*k] : NULL;
+            if (plasma_tile_local(A, k, k))
+                plasma_pzpotrf_diag(
+                    plasma, PlasmaUpper, nvak,
+                    A(k, k), ldak,
+                    A.nb*k,
+                    sequence, request);
+            // Read ahead the next panel of a mapped matrix.
+            plasma_desc_prefetch(A, k+1, k+1, k+1, A.nt-1, A(k, k));
+
+            plasma_tile_owners(A, k, k, k+1, A.nt-1, ranks);
+            plasma_omp_tile_bcast(A, k, k, plasma_tile_rank(A, k, k), ranks,
+                                  sequence, request);
 
-                for (int n = k+1; n < m; n++) {
-                    int ldan = plasma_tile_mmain(A, n);
-                    core_omp_zgemm(
-                        PlasmaConjTrans, PlasmaNoTrans,
-                        A.mb, nvam, A.mb,
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                if (plasma_tile_local(A, k, m))
+                    core_omp_ztrsm(
+                        PlasmaLeft, PlasmaUpper,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        A.nb, nvam,
+                        1.0, A(k, k), ldak,
+                             A(k, m), ldak,
+                        sequence, request);
+
+                // A(k, m) updates column m and row m.
+                plasma_tile_owners(A, k+1, m, m, m, ranks);
+                plasma_tile_owners(A, m, m, m, A.nt-1, ranks);
+                plasma_omp_tile_bcast(A, k, m, plasma_tile_rank(A, k, m),
+                                      ranks, sequence, request);
+            }
+#ifdef COMPLEX
+            if (Sk != NULL)
+                plasma_pzpotrf_split(PlasmaUpper, A, k, Sk, sequence, request);
+#endif
+            // forward substitution of block row k of B
+            if (B != NULL)
+                plasma_pzpotrf_forward(uplo, A, *B, k, sequence, request);
+
+            // Update the next lookahead rows first,
+            // so that their panels become ready early.
+            int nla = imin(A.nt, k+1+lookahead);
+            for (int n = k+1; n < nla; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                int ldan = plasma_tile_mmain(A, n);
+                if (plasma_tile_local(A, n, n)) {
+                    plasma_tile_affinity(A, n, n);
+                    PLASMA_UPDATE(plasma, core_omp_zherk)(
+                        PlasmaUpper, PlasmaConjTrans,
+                        nvan, A.mb,
                         -1.0, A(k, n), ldak,
-                              A(k, m), ldak,
-                         1.0, A(n, m), ldan,
+                         1.0, A(n, n), ldan,
                         sequence, request);
                 }
+
+                for (int m = n+1; m < A.nt; m++) {
+                    if (plasma_tile_local(A, n, m))
+                        plasma_pzpotrf_gemm(PlasmaUpper, A, m, n, k, Sk,
+                                            sequence, request);
+                }
             }
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                if (m >= nla && plasma_tile_local(A, m, m)) {
+                    plasma_tile_affinity(A, m, m);
+                    PLASMA_UPDATE(plasma, core_omp_zherk)(
+                        PlasmaUpper, PlasmaConjTrans,
+                        nvam, A.mb,
+                        -1.0, A(k, m), ldak,
+                         1.0, A(m, m), ldam,
+                        sequence, request);
+                }
+                for (int n = nla; n < m; n++) {
+                    if (plasma_tile_local(A, n, m))
+                        plasma_pzpotrf_gemm(PlasmaUpper, A, m, n, k, Sk,
+                                            sequence, request);
+                }
+            }
+#ifdef COMPLEX
+            if (Sk != NULL)
+                plasma_pzpotrf_split_free(A, k, Sk, sequence, request);
+#endif
         }
     }
+    if (kt < A.mt) {
+        plasma_pzpotrf_tail(uplo, A, kt, sequence, request);
+
+        // forward substitution of the block rows of B of the tail
+        for (int k = kt; k < A.mt && B != NULL; k++)
+            plasma_pzpotrf_forward(uplo, A, *B, k, sequence, request);
+    }
+#if defined(PLASMA_WITH_CUDA)
+    if (plasma->offload == PlasmaOffloadOn) {
+        #pragma omp taskwait
+        plasma_device_cache_clear();
+    }
+#endif
+    if (S != NULL) {
+        #pragma omp taskwait
+        // the split tiles whose freeing task a cancellation discarded
+        for (size_t i = 0; i < 2*(size_t)A.mt*A.mt; i++)
+            free(S[i]);
+        free(S);
+    }
+    free(ranks);
+}
+
+/******************************************************************************/
+void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    plasma_pzpotrf_solve(uplo, A, NULL, sequence, request);
+}
+
+/***************************************************************************//**
+ *  Parallel solve of A X = B by the Cholesky factorization.
+ *  With dynamic scheduling, the forward substitution runs in the task graph
+ *  of the factorization, each block row of B as soon as its panel is done,
+ *  and only the backward substitution is left after it. The statically
+ *  scheduled, distributed and block-sparse factorizations solve in separate
+ *  phases.
+ * @see plasma_omp_zposv
+ ******************************************************************************/
+void plasma_pzposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    plasma_enum_t trans;
+    if (A.p*A.q > 1 || plasma_static_scheduling(plasma) ||
+        A.layout == PlasmaSparseLayout) {
+        plasma_pzpotrf(uplo, A, sequence, request);
+
+        trans = uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
+        plasma_pztrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
+                      1.0, A,
+                           B,
+                      sequence, request);
+    }
+    else {
+        plasma_pzpotrf_solve(uplo, A, &B, sequence, request);
+    }
+
+    trans = uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans;
+    plasma_pztrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
 }
@@ -0,0 +1,232 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile inversion from the Cholesky factor, fusing the steps of
+ *  plasma_pztrtri and plasma_pzlauum. Step k of the inversion completes
+ *  the tile row k of L^{-1} (the tile column k of U^{-1}), which is all
+ *  step k of the product reads besides the tiles completed before, and
+ *  the product only writes the tiles the later steps of the inversion no
+ *  longer read. The product of step k is thus submitted right after the
+ *  inversion of step k, and its tasks start as soon as that row is ready.
+ * @see plasma_omp_zpotri
+ ******************************************************************************/
+void plasma_pzpotri(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (uplo == PlasmaLower) {
+        for (int k = 0; k < A.nt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvak = plasma_tile_mview(A, k);
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+
+            //=============
+            // trtri step
+            //=============
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_ztrsm(
+                    PlasmaRight, PlasmaLower, PlasmaNoTrans, PlasmaNonUnit,
+                    mvam, nvak,
+                    -1.0, A(k, k), ldak,
+                          A(m, k), ldam,
+                    sequence, request);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                for (int n = 0; n < k; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_zgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvam, nvan, imin(nvak, mvak),
+                        1.0, A(m, k), ldam,
+                             A(k, n), ldak,
+                        1.0, A(m, n), ldam,
+                        sequence, request);
+                }
+            }
+            for (int n = 0; n < k; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_ztrsm(
+                    PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaNonUnit,
+                    mvak, nvan,
+                    1.0, A(k, k), ldak,
+                         A(k, n), ldak,
+                    sequence, request);
+            }
+            core_omp_ztrtri(
+                PlasmaLower, PlasmaNonUnit,
+                nvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            //=============
+            // lauum step
+            //=============
+            for (int n = 0; n < k; n++) {
+                int mvan = plasma_tile_mview(A, n);
+                int nvan = plasma_tile_nview(A, n);
+                int ldan = plasma_tile_mmain(A, n);
+                core_omp_zherk(
+                    PlasmaLower, PlasmaConjTrans,
+                    imin(mvan, nvan), imin(mvak, nvan),
+                    1.0, A(k, n), ldak,
+                    1.0, A(n, n), ldan,
+                    sequence, request);
+
+                for (int m = n+1; m < k; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    core_omp_zgemm(
+                        PlasmaConjTrans, PlasmaNoTrans,
+                        mvam, nvan, mvak,
+                        1.0, A(k, m), ldak,
+                             A(k, n), ldak,
+                        1.0, A(m, n), ldam,
+                        sequence, request);
+                }
+            }
+            for (int n = 0; n < k; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_ztrmm(
+                    PlasmaLeft, PlasmaLower, PlasmaConjTrans, PlasmaNonUnit,
+                    mvak, nvan,
+                    1.0, A(k, k), ldak,
+                         A(k, n), ldak,
+                    sequence, request);
+            }
+            core_omp_zlauum(
+                PlasmaLower, imin(mvak, nvak),
+                A(k, k), ldak,
+                sequence, request);
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int k = 0; k < A.mt; k++) {
+            plasma_task_window(plasma, k);
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int mvak = plasma_tile_mview(A, k);
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+
+            //=============
+            // trtri step
+            //=============
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                core_omp_ztrsm(
+                    PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                    mvak, nvan,
+                    -1.0, A(k, k), ldak,
+                          A(k, n), ldak,
+                    sequence, request);
+            }
+            for (int m = 0; m < k; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                for (int n = k+1; n < A.nt; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    core_omp_zgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvam, nvan, imin(nvak, mvak),
+                        1.0, A(m, k), ldam,
+                             A(k, n), ldak,
+                        1.0, A(m, n), ldam,
+                        sequence, request);
+                }
+                core_omp_ztrsm(
+                    PlasmaRight, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                    mvam, nvak,
+                    1.0, A(k, k), ldak,
+                         A(m, k), ldam,
+                    sequence, request);
+            }
+            core_omp_ztrtri(
+                PlasmaUpper, PlasmaNonUnit,
+                mvak,
+                A(k, k), ldak,
+                A.nb*k,
+                sequence, request);
+
+            //=============
+            // lauum step
+            //=============
+            for (int m = 0; m < k; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_zherk(
+                    PlasmaUpper, PlasmaNoTrans,
+                    imin(mvam, nvam), imin(mvam, nvak),
+                    1.0, A(m, k), ldam,
+                    1.0, A(m, m), ldam,
+                    sequence, request);
+
+                for (int n = m+1; n < k; n++) {
+                    int nvan = plasma_tile_nview(A, n);
+                    int ldan = plasma_tile_mmain(A, n);
+                    core_omp_zgemm(
+                        PlasmaNoTrans, PlasmaConjTrans,
+                        mvam, nvan, nvak,
+                        1.0, A(m, k), ldam,
+                             A(n, k), ldan,
+                        1.0, A(m, n), ldam,
+                        sequence, request);
+                }
+            }
+            for (int m = 0; m < k; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_ztrmm(
+                    PlasmaRight, PlasmaUpper, PlasmaConjTrans, PlasmaNonUnit,
+                    mvam, nvak,
+                    1.0, A(k, k), ldak,
+                         A(m, k), ldam,
+                    sequence, request);
+            }
+            core_omp_zlauum(
+                PlasmaUpper, imin(mvak, nvak),
+                A(k, k), ldak,
+                sequence, request);
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define B(m, n) (plasma_complex64_t*)plasma_tile_addr(B, m, n)
+#define C(m, n) (plasma_complex64_t*)plasma_tile_addr(C, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile out-of-place triangular matrix-matrix multiplication.
+ *  Each tile of C only reads tiles of A and B, so that, as in gemm, the
+ *  tiles of C are computed independently, each by a copy of its tile of B
+ *  multiplied by the diagonal tile of A, followed by the gemm updates of
+ *  the off-diagonal tiles of A.
+ *  @see plasma_omp_ztrmm3
+ ******************************************************************************/
+void plasma_pztrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                    plasma_enum_t trans, plasma_enum_t diag,
+                    plasma_complex64_t alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                                              plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // op( A ) is upper triangular if A is upper and not transposed,
+    // or lower and transposed.
+    int upper = (uplo == PlasmaUpper) == (trans == PlasmaNoTrans);
+
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        int ldbm = plasma_tile_mmain(B, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        for (int n = 0; n < C.nt; n++) {
+            int nvcn = plasma_tile_nview(C, n);
+            core_omp_zlacpy(
+                PlasmaGeneral,
+                mvcm, nvcn,
+                B(m, n), ldbm,
+                C(m, n), ldcm,
+                sequence, request);
+
+            //=============
+            // PlasmaLeft
+            //=============
+            if (side == PlasmaLeft) {
+                int ldam = plasma_tile_mmain(A, m);
+                core_omp_ztrmm(
+                    side, uplo, trans, diag,
+                    mvcm, nvcn,
+                    alpha, A(m, m), ldam,
+                           C(m, n), ldcm,
+                    sequence, request);
+
+                int k0 = upper ? m+1  : 0;
+                int k1 = upper ? A.mt : m;
+                for (int k = k0; k < k1; k++) {
+                    int mvbk = plasma_tile_mview(B, k);
+                    int ldak = plasma_tile_mmain(A, k);
+                    int ldbk = plasma_tile_mmain(B, k);
+                    core_omp_zgemm(
+                        trans, PlasmaNoTrans,
+                        mvcm, nvcn, mvbk,
+                        alpha, trans == PlasmaNoTrans ? A(m, k) : A(k, m),
+                               trans == PlasmaNoTrans ? ldam    : ldak,
+                               B(k, n), ldbk,
+                        1.0,   C(m, n), ldcm,
+                        sequence, request);
+                }
+            }
+            //==============
+            // PlasmaRight
+            //==============
+            else {
+                int ldan = plasma_tile_mmain(A, n);
+                core_omp_ztrmm(
+                    side, uplo, trans, diag,
+                    mvcm, nvcn,
+                    alpha, A(n, n), ldan,
+                           C(m, n), ldcm,
+                    sequence, request);
+
+                int k0 = upper ? 0 : n+1;
+                int k1 = upper ? n : A.nt;
+                for (int k = k0; k < k1; k++) {
+                    int nvbk = plasma_tile_nview(B, k);
+                    int ldak = plasma_tile_mmain(A, k);
+                    core_omp_zgemm(
+                        PlasmaNoTrans, trans,
+                        mvcm, nvcn, nvbk,
+                        alpha, B(m, k), ldbm,
+                               trans == PlasmaNoTrans ? A(k, n) : A(n, k),
+                               trans == PlasmaNoTrans ? ldak    : ldan,
+                        1.0,   C(m, n), ldcm,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/dzamax.c, normal z -> s, Mon Feb  6 14:06:11 2017
+ * @generated from compute/dzamax.c, normal z -> s, Thu Oct 15 07:33:59 2026
  *
  **/
 
@@ -79,26 +79,22 @@ int plasma_samax(plasma_enum_t colrow,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_samax(colrow, A, work, values, sequence, &request);
+        plasma_omp_samax(colrow, A, work, values, &sequence, &request);
     }
     // implicit synchronization
 
@@ -108,8 +104,7 @@ int plasma_samax(plasma_enum_t colrow,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
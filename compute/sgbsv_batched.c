@@ -0,0 +1,155 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgbsv_batched.c, normal z -> s, Thu Oct 15 07:31:11 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gbsv
+ *
+ *  Solves a batch of independent band systems A_i X_i = B_i of the same
+ *  order and bandwidths, where X_i and B_i are n-by-nrhs matrices, with the
+ *  LU factorizations with partial pivoting of A_i.
+ *  The batch is stored interleaved: the element j of the system i is at
+ *  j*batch_count + i, so that core_sgbsv_interleaved runs the elimination
+ *  across PLASMA_BATCH_LANES consecutive systems at a time, one per vector
+ *  lane, and the groups of systems are spread across the threads.
+ *  Intended for many small systems of narrow band, such as pentadiagonal
+ *  ones, which the tile band storage of plasma_sgbsv does not suit.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_i. n >= 0.
+ *
+ * @param[in] kl
+ *          The number of subdiagonals within the band of A_i. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of superdiagonals within the band of A_i. ku >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrices B_i. nrhs >= 0.
+ *
+ * @param[in,out] pAB
+ *          Array of ldab*n*batch_count elements, the matrices A_i in the
+ *          LAPACK band storage, the element (j, k) of A_i in the row
+ *          kl+ku+j-k of the column k of the band, at
+ *          (k*ldab + kl+ku+j-k)*batch_count + i. The first kl rows of the
+ *          band need not be set.
+ *          On exit, the factors L_i and U_i, as in LAPACK sgbsv.
+ *
+ * @param[in] ldab
+ *          The number of rows of the band. ldab >= 2*kl+ku+1.
+ *
+ * @param[out] ipiv
+ *          Array of n*batch_count pivot indices; the row j of A_i was
+ *          interchanged with the row ipiv[j*batch_count + i] (1-based).
+ *
+ * @param[in,out] pB
+ *          Array of n*nrhs*batch_count elements, the element (j, k) of B_i
+ *          at (k*n + j)*batch_count + i.
+ *          On entry, the right hand sides B_i.
+ *          On exit, the solutions X_i for info[i] = 0.
+ *
+ * @param[in] batch_count
+ *          The number of systems in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, or j > 0
+ *          if U_i(j,j) is exactly zero, and X_i has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgbsv
+ * @sa plasma_cgbsv_batched
+ * @sa plasma_dgbsv_batched
+ * @sa plasma_sgbsv_batched
+ *
+ ******************************************************************************/
+int plasma_sgbsv_batched(int n, int kl, int ku, int nrhs,
+                         float *pAB, int ldab, int *ipiv,
+                         float *pB,
+                         int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (kl < 0) {
+        plasma_error("illegal value of kl");
+        return -2;
+    }
+    if (ku < 0) {
+        plasma_error("illegal value of ku");
+        return -3;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -4;
+    }
+    if (pAB == NULL && n > 0 && batch_count > 0) {
+        plasma_error("NULL AB");
+        return -5;
+    }
+    if (ldab < 2*kl+ku+1) {
+        plasma_error("illegal value of ldab");
+        return -6;
+    }
+    if (ipiv == NULL && n > 0 && batch_count > 0) {
+        plasma_error("NULL ipiv");
+        return -7;
+    }
+    if (pB == NULL && n > 0 && nrhs > 0 && batch_count > 0) {
+        plasma_error("NULL B");
+        return -8;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -9;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -10;
+    }
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i += PLASMA_BATCH_LANES) {
+        core_sgbsv_interleaved(n, kl, ku, nrhs,
+                               imin(PLASMA_BATCH_LANES, batch_count-i),
+                               batch_count,
+                               pAB+i, ldab, ipiv+i, pB+i, &info[i]);
+    }
+
+    return PlasmaSuccess;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zge2desc.c, normal z -> s, Mon Feb  6 14:06:28 2017
+ * @generated from compute/zge2desc.c, normal z -> s, Thu Oct 15 04:41:23 2026
  *
  **/
 
@@ -21,7 +21,7 @@
     @ingroup plasma_cm2ccrb
 
     Convert column-major (CM) to tiled (CCRB) matrix layout.
-    Out-of-place.
+    Out-of-place. Packs the tiles of a packed A.
 */
 void plasma_omp_sge2desc(float *pA, int lda,
                          plasma_desc_t A,
@@ -0,0 +1,310 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgeexp.c, normal z -> s, Thu Oct 15 11:00:48 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// the degrees of the Pade approximants, and the largest one norms of A
+// for which they are accurate to float precision, from Higham (2005)
+static const int plasma_geexp_degree[] = { 3, 5, 7, 9, 13 };
+static const float plasma_geexp_theta[] = {
+    1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+    2.097847961257068e0,  5.371920351148152e0 };
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geexp
+ *
+ *  Computes the exponential of an n-by-n matrix A,
+ *    \f[ e^A = \sum_{k=0}^{\infty} \frac{A^k}{k!}, \f]
+ *  by the scaling and squaring algorithm of Higham (2005): the exponential
+ *  of 2^{-s} A is approximated by the diagonal Pade approximant
+ *  r_m = (V - U)^{-1} (V + U) of degree m, with U and V the odd and the
+ *  even part of its numerator, and then squared s times. The degree m,
+ *  among 3, 5, 7, 9 and 13, and s are the smallest that keep the backward
+ *  error below the unit roundoff for the one norm of A, the only value
+ *  read back before the computation. Degree 13 evaluates U and V from
+ *  A^2, A^4 and A^6 only, in 6 products.
+ *
+ *  All the intermediate matrices are kept in tile layout, and the products,
+ *  the sums, the LU solve and the squarings are submitted as one task graph,
+ *  with a single wait, for the numerator, before the LU factorization.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the n-by-n matrix A.
+ *          On exit, the n-by-n matrix exponential of A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if V - U is singular, which the degrees and the scaling
+ *         exclude in exact arithmetic
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgesv
+ * @sa plasma_cgeexp
+ * @sa plasma_dgeexp
+ * @sa plasma_sgeexp
+ *
+ ******************************************************************************/
+int plasma_sgeexp(int n, float *pA, int lda)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -3;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    float *work =
+        (float*)malloc(((size_t)A.mt*A.n+A.n)*sizeof(float));
+    if (work == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    float anorm = 0.0;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // ||A||_1
+        plasma_omp_slange(PlasmaOneNorm, A, work, &anorm,
+                          &sequence, &request);
+    }
+    // implicit synchronization
+
+    free(work);
+    if (sequence.status != PlasmaSuccess) {
+        plasma_desc_destroy(&A);
+        return sequence.status;
+    }
+
+    // Choose the degree, and the scaling of A for degree 13.
+    int d = 0;
+    while (d < 4 && !(anorm <= plasma_geexp_theta[d]))
+        d++;
+    int m = plasma_geexp_degree[d];
+    int s = 0;
+    if (m == 13 && isfinite(anorm) && anorm > plasma_geexp_theta[4])
+        s = (int)ceil(log2(anorm/plasma_geexp_theta[4]));
+
+    // coefficients of the numerator of the Pade approximant
+    float b[14];
+    b[0] = 1.0;
+    for (int j = 1; j <= m; j++)
+        b[j] = b[j-1]*(m-j+1)/(j*(2.0*m-j+1));
+
+    // the even powers A^2, A^4, ... of the scaled A, of which degree 13
+    // reads A^6 at most, and reuses the fourth for the odd part,
+    // and U, V and W, for the numerator and the squarings
+    int npow = m == 13 ? 4 : m/2;
+    plasma_desc_t P[4];
+    plasma_desc_t U;
+    plasma_desc_t V;
+    plasma_desc_t W;
+    int ndesc = 0;
+    plasma_desc_t *desc[7];
+    for (int i = 0; i < npow; i++)
+        desc[ndesc++] = &P[i];
+    desc[ndesc++] = &U;
+    desc[ndesc++] = &V;
+    desc[ndesc++] = &W;
+    for (int i = 0; i < ndesc; i++) {
+        retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                            n, n, 0, 0, n, n, desc[i]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            for (int j = 0; j < i; j++)
+                plasma_desc_destroy(desc[j]);
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+    }
+
+    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    if (ipiv == NULL) {
+        plasma_error("malloc() failed");
+        for (int i = 0; i < ndesc; i++)
+            plasma_desc_destroy(desc[i]);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // A = 2^{-s} A
+        if (s > 0)
+            plasma_omp_slascl(PlasmaGeneral, ldexp(1.0, s), 1.0, A,
+                              &sequence, &request);
+
+        // A^2, A^4, ...
+        plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                         1.0, A, A, 0.0, P[0], &sequence, &request);
+        for (int i = 1; i < imin(npow, 3); i++)
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, P[0], P[i-1], 0.0, P[i],
+                             &sequence, &request);
+
+        if (m < 13) {
+            if (npow == 4)
+                plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                                 1.0, P[1], P[1], 0.0, P[3],
+                                 &sequence, &request);
+
+            // W = b_1 I + b_3 A^2 + ..., V = b_0 I + b_2 A^2 + ...
+            plasma_omp_slaset(PlasmaGeneral, 0.0, b[1], W,
+                              &sequence, &request);
+            plasma_omp_slaset(PlasmaGeneral, 0.0, b[0], V,
+                              &sequence, &request);
+            for (int i = 0; i < npow; i++) {
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+3], P[i], 1.0, W,
+                                  &sequence, &request);
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+2], P[i], 1.0, V,
+                                  &sequence, &request);
+            }
+
+            // U = A W
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, A, W, 0.0, U, &sequence, &request);
+        }
+        else {
+            // W = b_13 A^6 + b_11 A^4 + b_9 A^2,
+            // P[3] = A^6 W + b_7 A^6 + b_5 A^4 + b_3 A^2 + b_1 I,
+            // U = A P[3]
+            plasma_omp_slaset(PlasmaGeneral, 0.0, 0.0, W,
+                              &sequence, &request);
+            plasma_omp_slaset(PlasmaGeneral, 0.0, b[1], P[3],
+                              &sequence, &request);
+            for (int i = 0; i < 3; i++) {
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+9], P[i], 1.0, W,
+                                  &sequence, &request);
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+3], P[i], 1.0, P[3],
+                                  &sequence, &request);
+            }
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, P[2], W, 1.0, P[3], &sequence, &request);
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, A, P[3], 0.0, U, &sequence, &request);
+
+            // W = b_12 A^6 + b_10 A^4 + b_8 A^2,
+            // V = A^6 W + b_6 A^6 + b_4 A^4 + b_2 A^2 + b_0 I
+            plasma_omp_slaset(PlasmaGeneral, 0.0, 0.0, W,
+                              &sequence, &request);
+            plasma_omp_slaset(PlasmaGeneral, 0.0, b[0], V,
+                              &sequence, &request);
+            for (int i = 0; i < 3; i++) {
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+8], P[i], 1.0, W,
+                                  &sequence, &request);
+                plasma_omp_sgeadd(PlasmaNoTrans, b[2*i+2], P[i], 1.0, V,
+                                  &sequence, &request);
+            }
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, P[2], W, 1.0, V, &sequence, &request);
+        }
+
+        // (V - U) X = V + U, with V + U in U and V - U in V
+        plasma_omp_sgeadd(PlasmaNoTrans, 1.0, V, 1.0, U,
+                          &sequence, &request);
+        plasma_omp_sgeadd(PlasmaNoTrans, -1.0, U, 2.0, V,
+                          &sequence, &request);
+
+        // The tasks of the LU factorization are keyed on the tile
+        // columns, not on all their tiles.
+        #pragma omp taskwait
+        plasma_omp_sgesv(V, ipiv, U, &sequence, &request);
+
+        // s squarings, from U to V and back
+        plasma_desc_t X = U;
+        plasma_desc_t Y = V;
+        for (int i = 0; i < s; i++) {
+            plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                             1.0, X, X, 0.0, Y, &sequence, &request);
+            plasma_desc_t Z = X;
+            X = Y;
+            Y = Z;
+        }
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(X, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    free(ipiv);
+    for (int i = 0; i < ndesc; i++)
+        plasma_desc_destroy(desc[i]);
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgelqs.c, normal z -> s, Mon Feb  6 14:06:29 2017
+ * @generated from compute/zgelqs.c, normal z -> s, Thu Oct 15 10:29:06 2026
  *
  **/
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -136,30 +137,26 @@ int plasma_sgelqs(int m, int n, int nrhs,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_sgelqs(A, T, B, work, sequence, &request);
+        plasma_omp_sgelqs(A, T, B, work, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -170,8 +167,7 @@ int plasma_sgelqs(int m, int n, int nrhs,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -282,8 +278,16 @@ void plasma_omp_sgelqs(plasma_desc_t A, plasma_desc_t T,
                        plasma_desc_view(B, 0, 0, A.m, B.n),
                   sequence, request);
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    if (plasma_descT_check(A, T, householder_mode,
+                           PlasmaRowwise) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     // Find X = Q^T * Y.
-    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+    if (householder_mode == PlasmaTreeHouseholder) {
         plasma_psormlqrh(PlasmaLeft, PlasmaTrans,
                          A, T, B, work,
                          sequence, request);
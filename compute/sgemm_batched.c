@@ -0,0 +1,503 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgemm_batched.c, normal z -> s, Thu Oct 15 07:38:56 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operations
+ *
+ *          \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  for a batch of independent matrices of the same size.
+ *  Each operation runs sequentially in core_sgemm, and the batch is spread
+ *  across the threads in a single parallel region, without tile layout.
+ *  Intended for many small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i is not transposed,
+ *          - PlasmaTrans:     A_i is transposed,
+ *          - PlasmaConjTrans: A_i is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i is not transposed,
+ *          - PlasmaTrans:     B_i is transposed,
+ *          - PlasmaConjTrans: B_i is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices op( A_i ) and C_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices op( B_i ) and C_i. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of op( A_i ) and rows of op( B_i ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the lda-by-ka matrices A_i,
+ *          where ka is k when transa = PlasmaNoTrans, and is m otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i.
+ *          When transa = PlasmaNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] pB
+ *          Array of batch_count pointers to the ldb-by-kb matrices B_i,
+ *          where kb is n when transb = PlasmaNoTrans, and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B_i.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          Array of batch_count pointers to the ldc-by-n matrices C_i.
+ *          On exit, C_i is overwritten by alpha*op( A_i )*op( B_i ) + beta*C_i.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C_i. ldc >= max(1,m).
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgemm
+ * @sa plasma_cgemm_batched
+ * @sa plasma_dgemm_batched
+ * @sa plasma_sgemm_batched
+ *
+ ******************************************************************************/
+int plasma_sgemm_batched(plasma_enum_t transa, plasma_enum_t transb,
+                         int m, int n, int k,
+                         float alpha,
+                         float **pA, int lda,
+                         float **pB, int ldb,
+                         float beta,
+                         float **pC, int ldc,
+                         int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -5;
+    }
+
+    int am = transa == PlasmaNoTrans ? m : k;
+    int bm = transb == PlasmaNoTrans ? k : n;
+
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -7;
+    }
+    if (lda < imax(1, am)) {
+        plasma_error("illegal value of lda");
+        return -8;
+    }
+    if (pB == NULL && batch_count > 0) {
+        plasma_error("NULL B");
+        return -9;
+    }
+    if (ldb < imax(1, bm)) {
+        plasma_error("illegal value of ldb");
+        return -10;
+    }
+    if (pC == NULL && batch_count > 0) {
+        plasma_error("NULL C");
+        return -12;
+    }
+    if (ldc < imax(1, m)) {
+        plasma_error("illegal value of ldc");
+        return -13;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -14;
+    }
+
+    // quick return
+    if (batch_count == 0 ||
+        m == 0 || n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
+        return PlasmaSuccess;
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i++) {
+        core_sgemm(transa, transb,
+                   m, n, k,
+                   alpha, pA[i], lda,
+                          pB[i], ldb,
+                   beta,  pC[i], ldc);
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operations
+ *
+ *          \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  for a batch of independent matrices of sizes of their own, in a single
+ *  parallel region. The products with a dimension larger than the tile
+ *  size are computed by the tile algorithm across the threads, the
+ *  largest first, and the others sequentially in core_sgemm, packed many
+ *  per task by decreasing cost, so that the small products fill the
+ *  threads left idle by the large ones.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i is not transposed,
+ *          - PlasmaTrans:     A_i is transposed,
+ *          - PlasmaConjTrans: A_i is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i is not transposed,
+ *          - PlasmaTrans:     B_i is transposed,
+ *          - PlasmaConjTrans: B_i is conjugate transposed.
+ *
+ * @param[in] m
+ *          Array of batch_count numbers of rows of the matrices op( A_i )
+ *          and C_i. m[i] >= 0.
+ *
+ * @param[in] n
+ *          Array of batch_count numbers of columns of the matrices
+ *          op( B_i ) and C_i. n[i] >= 0.
+ *
+ * @param[in] k
+ *          Array of batch_count numbers of columns of op( A_i ) and rows
+ *          of op( B_i ). k[i] >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the matrices A_i, as in
+ *          plasma_sgemm_batched.
+ *
+ * @param[in] lda
+ *          Array of batch_count leading dimensions of the arrays A_i.
+ *          When transa = PlasmaNoTrans, lda[i] >= max(1,m[i]),
+ *          otherwise, lda[i] >= max(1,k[i]).
+ *
+ * @param[in] pB
+ *          Array of batch_count pointers to the matrices B_i, as in
+ *          plasma_sgemm_batched.
+ *
+ * @param[in] ldb
+ *          Array of batch_count leading dimensions of the arrays B_i.
+ *          When transb = PlasmaNoTrans, ldb[i] >= max(1,k[i]),
+ *          otherwise, ldb[i] >= max(1,n[i]).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          Array of batch_count pointers to the m[i]-by-n[i] matrices C_i.
+ *          On exit, C_i is overwritten by alpha*op( A_i )*op( B_i ) + beta*C_i.
+ *
+ * @param[in] ldc
+ *          Array of batch_count leading dimensions of the arrays C_i.
+ *          ldc[i] >= max(1,m[i]).
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value, or the error
+ *         of the first product whose tile algorithm failed
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgemm_batched
+ * @sa plasma_cgemm_vbatched
+ * @sa plasma_dgemm_vbatched
+ * @sa plasma_sgemm_vbatched
+ *
+ ******************************************************************************/
+int plasma_sgemm_vbatched(plasma_enum_t transa, plasma_enum_t transb,
+                          const int *m, const int *n, const int *k,
+                          float alpha,
+                          float **pA, const int *lda,
+                          float **pB, const int *ldb,
+                          float beta,
+                          float **pC, const int *ldc,
+                          int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (m == NULL && batch_count > 0) {
+        plasma_error("NULL m");
+        return -3;
+    }
+    if (n == NULL && batch_count > 0) {
+        plasma_error("NULL n");
+        return -4;
+    }
+    if (k == NULL && batch_count > 0) {
+        plasma_error("NULL k");
+        return -5;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -7;
+    }
+    if (lda == NULL && batch_count > 0) {
+        plasma_error("NULL lda");
+        return -8;
+    }
+    if (pB == NULL && batch_count > 0) {
+        plasma_error("NULL B");
+        return -9;
+    }
+    if (ldb == NULL && batch_count > 0) {
+        plasma_error("NULL ldb");
+        return -10;
+    }
+    if (pC == NULL && batch_count > 0) {
+        plasma_error("NULL C");
+        return -12;
+    }
+    if (ldc == NULL && batch_count > 0) {
+        plasma_error("NULL ldc");
+        return -13;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -14;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -3;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -4;
+        }
+        if (k[i] < 0) {
+            plasma_error("illegal value of k");
+            return -5;
+        }
+        int am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        if (lda[i] < imax(1, am)) {
+            plasma_error("illegal value of lda");
+            return -8;
+        }
+        if (ldb[i] < imax(1, bm)) {
+            plasma_error("illegal value of ldb");
+            return -10;
+        }
+        if (ldc[i] < imax(1, m[i])) {
+            plasma_error("illegal value of ldc");
+            return -13;
+        }
+    }
+
+    // quick return
+    if (batch_count == 0 || ((alpha == 0.0) && beta == 1.0))
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Schedule the products by their sizes.
+    plasma_batch_item_t *items = (plasma_batch_item_t*)malloc(
+        batch_count*sizeof(plasma_batch_item_t));
+    int *chunk = (int*)malloc((batch_count+1)*sizeof(int));
+    if (items == NULL || chunk == NULL) {
+        free(items);
+        free(chunk);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        items[i].cost = 2.0*m[i]*n[i]*imax(k[i], 1);
+        items[i].index = i;
+        items[i].large = imax(imax(m[i], n[i]), k[i]) > nb &&
+                         imin(m[i], n[i]) > 0;
+    }
+    int num_chunks = plasma_batch_schedule(items, batch_count, nb,
+                                           plasma_num_threads(plasma), chunk);
+    int num_large = chunk[0];
+
+    // Create the tile matrices and the sequences of the large products.
+    for (int l = 0; l < num_large; l++) {
+        int i = items[l].index;
+        int am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int an = transa == PlasmaNoTrans ? k[i] : m[i];
+        int bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        int bn = transb == PlasmaNoTrans ? n[i] : k[i];
+        int retval;
+        items[l].num_descs = 0;
+        retval = plasma_desc_lapack_view_create(PlasmaRealFloat,
+                                                pA[i], lda[i], nb, nb,
+                                                am, an, &items[l].desc[0]);
+        if (retval == PlasmaSuccess) {
+            items[l].num_descs = 1;
+            retval = plasma_desc_lapack_view_create(PlasmaRealFloat,
+                                                    pB[i], ldb[i], nb, nb,
+                                                    bm, bn, &items[l].desc[1]);
+        }
+        if (retval == PlasmaSuccess) {
+            items[l].num_descs = 2;
+            retval = plasma_desc_lapack_view_create(PlasmaRealFloat,
+                                                    pC[i], ldc[i], nb, nb,
+                                                    m[i], n[i],
+                                                    &items[l].desc[2]);
+        }
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_lapack_view_create() failed");
+            for (int d = 0; d < items[l].num_descs; d++)
+                plasma_desc_destroy(&items[l].desc[d]);
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].num_descs = 3;
+        retval = plasma_sequence_create(&items[l].sequence);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_sequence_create() failed");
+            for (int d = 0; d < items[l].num_descs; d++)
+                plasma_desc_destroy(&items[l].desc[d]);
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].request = PlasmaRequestInitializer;
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // the large products, by the tile algorithm
+        for (int l = 0; l < num_large; l++) {
+            int i = items[l].index;
+            plasma_desc_t A = items[l].desc[0];
+            plasma_desc_t B = items[l].desc[1];
+            plasma_desc_t C = items[l].desc[2];
+            plasma_sequence_t *sequence = items[l].sequence;
+            plasma_request_t *request = &items[l].request;
+            plasma_omp_sge2desc(pA[i], lda[i], A, sequence, request);
+            plasma_omp_sge2desc(pB[i], ldb[i], B, sequence, request);
+            plasma_omp_sge2desc(pC[i], ldc[i], C, sequence, request);
+            plasma_omp_sgemm(transa, transb,
+                             alpha, A,
+                                    B,
+                             beta,  C,
+                             sequence, request);
+            plasma_omp_sdesc2ge(C, pC[i], ldc[i], sequence, request);
+        }
+        // the small products, many per task
+        for (int j = 0; j < num_chunks; j++) {
+            #pragma omp task firstprivate(j)
+            {
+                for (int l = chunk[j]; l < chunk[j+1]; l++) {
+                    int i = items[l].index;
+                    if (m[i] > 0 && n[i] > 0)
+                        core_sgemm(transa, transb,
+                                   m[i], n[i], k[i],
+                                   alpha, pA[i], lda[i],
+                                          pB[i], ldb[i],
+                                   beta,  pC[i], ldc[i]);
+                }
+            }
+        }
+    }
+    // implicit synchronization
+
+    int status = PlasmaSuccess;
+    for (int l = 0; l < num_large && status == PlasmaSuccess; l++)
+        status = items[l].sequence->status;
+
+    plasma_batch_destroy(items, num_large);
+    free(chunk);
+    return status;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgeqrf.c, normal z -> s, Mon Feb  6 14:06:31 2017
+ * @generated from compute/zgeqrf.c, normal z -> s, Thu Oct 15 10:29:06 2026
  *
  **/
 
@@ -15,6 +15,9 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_predict.h"
+#include "plasma_rh_tree.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -98,25 +101,32 @@ int plasma_sgeqrf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "sgeqrf", imax(m, n), &tuning);
+
     // Set tiling parameters.
     int ib = plasma->ib;
     int nb = plasma->nb;
-    int householder_mode = plasma->householder_mode;
 
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_lapack_create(PlasmaRealFloat, pA, lda, nb, nb,
+                                       m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
     // Prepare descriptor T.
-    retval = plasma_descT_create(A, ib, householder_mode, T);
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                         PlasmaColumnwise, T);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_descT_create() failed");
+        plasma_error("plasma_descT_compact_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
@@ -126,32 +136,29 @@ int plasma_sgeqrf(int m, int n,
     retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_workspace_create() failed");
+        plasma_tuning_restore(plasma, &tuning);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_sgeqrf(A, *T, work, sequence, &request);
+        plasma_omp_sgeqrf(A, *T, work, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
@@ -161,11 +168,49 @@ int plasma_sgeqrf(int m, int n,
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
+    plasma_tuning_restore(plasma, &tuning);
     return status;
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Same as plasma_sgeqrf(), with the parameters of the context overridden by
+ *  options for this call only.
+ *
+ *******************************************************************************
+ *
+ * @param[in] options
+ *          The options of the call, initialized by plasma_options_init().
+ *          If NULL, the parameters of the context are used.
+ *
+ ******************************************************************************/
+int plasma_sgeqrf_opts(int m, int n,
+                       float *pA, int lda,
+                       plasma_desc_t *T,
+                       const plasma_options_t *options)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Override the parameters for the call.
+    plasma_options_t saved;
+    int retval = plasma_options_apply(options, &saved);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_sgeqrf(m, n, pA, lda, T);
+
+    plasma_options_restore(&saved);
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_geqrf
@@ -188,6 +233,10 @@ int plasma_sgeqrf(int m, int n,
  *          Descriptor of matrix T.
  *          On exit, auxiliary factorization data, required by plasma_sgeqrs to
  *          solve the system of equations.
+ *          Created for A by plasma_descT_compact_create, with
+ *          PlasmaAutoHouseholder, or the Householder mode the routine
+ *          resolves; the tree mode fails the sequence on a T created for
+ *          the flat mode.
  *
  * @param[in] work
  *          Workspace for the auxiliary arrays needed by some coreblas kernels.
@@ -257,11 +306,217 @@ void plasma_omp_sgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (imin(A.m, A.n) == 0)
         return;
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    if (plasma_descT_check(A, T, householder_mode,
+                           PlasmaColumnwise) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     // Call the parallel function.
-    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+    if (householder_mode == PlasmaTreeHouseholder) {
         plasma_psgeqrfrh(A, T, work, sequence, request);
     }
     else {
         plasma_psgeqrf(A, T, work, sequence, request);
     }
 }
+
+/******************************************************************************/
+// Runs plasma_omp_sgeqrf() on A and T for plasma_predict_sgeqrf(): on a
+// random matrix with the task counters on, to calibrate the model, or else
+// in a dry run, predicting *time.
+static int plasma_sgeqrf_predict_run(plasma_context_t *plasma,
+                                     plasma_desc_t A, plasma_desc_t T,
+                                     int calibrate, plasma_time_t *time)
+{
+    plasma_enum_t stats;
+    plasma_enum_t dry_run;
+    int retval = calibrate ? plasma_predict_calibrate_begin(&stats)
+                           : plasma_predict_run_begin(&dry_run);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = A.nb + plasma->ib*A.nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_set(calibrate ? PlasmaStats : PlasmaDryRun,
+                   calibrate ? stats : dry_run);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    if (calibrate) {
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_splrnt(3172, A, &sequence, &request);
+        }
+
+        // Count the factorization only.
+        plasma_stats_reset();
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_sgeqrf(A, T, work, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    retval = sequence.status;
+    if (calibrate) {
+        if (retval == PlasmaSuccess)
+            return plasma_predict_calibrate_end("sgeqrf", stats);
+        plasma_set(PlasmaStats, stats);
+    }
+    else {
+        int status = plasma_predict_run_end(dry_run, time);
+        if (retval == PlasmaSuccess)
+            retval = status;
+    }
+    return retval;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_predict
+ *
+ *  Predicts the time of plasma_sgeqrf() for an m-by-n matrix, with the
+ *  parameters the call would use, by the performance model of
+ *  plasma_predict.h. On the first prediction at a tile size, calibrates the
+ *  model by factoring a random matrix of at most
+ *  PlasmaPredictCalibrationTiles tiles per dimension. Does not allocate any
+ *  m-by-n matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[out] time
+ *          The predicted time of the call in seconds.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval PlasmaErrorNotSupported if PLASMA was built without
+ *         -DPLASMA_WITH_TRACE
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgeqrf
+ * @sa plasma_predict_cgeqrf
+ * @sa plasma_predict_dgeqrf
+ * @sa plasma_predict_sgeqrf
+ *
+ ******************************************************************************/
+int plasma_predict_sgeqrf(int m, int n, plasma_time_t *time)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (time == NULL) {
+        plasma_error("NULL time");
+        return -3;
+    }
+
+    // quick return
+    *time = 0.0;
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Apply the tuned parameters of the size, if any.
+    plasma_tuning_t tuning;
+    plasma_tuning_apply(plasma, "sgeqrf", imax(m, n), &tuning);
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Calibrate the model on a random matrix of a few tiles.
+    plasma_desc_t A;
+    plasma_desc_t T;
+    int householder_mode;
+    int retval;
+    if (!plasma_predict_calibrated("sgeqrf")) {
+        int mc = imin(m, PlasmaPredictCalibrationTiles*nb);
+        int nc = imin(n, PlasmaPredictCalibrationTiles*nb);
+        retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                            mc, nc, 0, 0, mc, nc, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+        householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+        retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                             PlasmaColumnwise, &T);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_descT_compact_create() failed");
+            plasma_desc_destroy(&A);
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+        retval = plasma_sgeqrf_predict_run(plasma, A, T, 1, time);
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&T);
+        if (retval != PlasmaSuccess) {
+            plasma_tuning_restore(plasma, &tuning);
+            return retval;
+        }
+    }
+
+    // Record and cost the task graph of the call.
+    retval = plasma_predict_desc_create(PlasmaRealFloat, nb, nb,
+                                        m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+    householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_predict_descT_create(A, ib, householder_mode,
+                                         PlasmaColumnwise, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_predict_desc_destroy(&A);
+        plasma_tuning_restore(plasma, &tuning);
+        return retval;
+    }
+    retval = plasma_sgeqrf_predict_run(plasma, A, T, 0, time);
+    plasma_predict_desc_destroy(&A);
+    plasma_predict_desc_destroy(&T);
+
+    plasma_tuning_restore(plasma, &tuning);
+    return retval;
+}
@@ -0,0 +1,137 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgeqrf_batched.c, normal z -> s, Thu Oct 15 04:02:51 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes the QR factorization of a batch of independent m-by-n matrices
+ *  A_i of the same size.
+ *  Each factorization runs sequentially in core_sgeqrt with the inner
+ *  blocking PlasmaIb, and the batch is spread across the threads in a
+ *  single parallel region, without tile layout.
+ *  Intended for many small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A_i. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the m-by-n matrices A_i.
+ *          On exit, R on and above the diagonal, and the elementary
+ *          reflectors of Q below the diagonal, as in LAPACK sgeqrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,m).
+ *
+ * @param[out] ptau
+ *          Array of batch_count pointers to the min(m,n) scalar factors of
+ *          the elementary reflectors of A_i, as in LAPACK sgeqrf.
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgeqrf
+ * @sa plasma_cgeqrf_batched
+ * @sa plasma_dgeqrf_batched
+ * @sa plasma_sgeqrf_batched
+ *
+ ******************************************************************************/
+int plasma_sgeqrf_batched(int m, int n,
+                          float **pA, int lda,
+                          float **ptau,
+                          int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ptau == NULL && batch_count > 0) {
+        plasma_error("NULL tau");
+        return -5;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+
+    // quick return
+    if (batch_count == 0 || imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = 2*ib*n;  // geqrt: T + work
+    int retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i++) {
+        float *T = (float*)
+            work.spaces[omp_get_thread_num()];
+        core_sgeqrt(m, n, ib,
+                    pA[i], lda,
+                    T, ib,
+                    ptau[i],
+                    &T[ib*n]);
+    }
+
+    plasma_workspace_destroy(&work);
+    return PlasmaSuccess;
+}
@@ -0,0 +1,451 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgeqrf_lowrank.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *  Fills a tile with normally distributed random numbers. The seed is taken
+ *  from the position of the tile, so the test matrix is the same for any
+ *  order of the tasks.
+ **/
+static void plasma_sgeqrf_lowrank_random(int i, int j, int mb, int nb,
+                                         float *T, int ldt,
+                                         void *args)
+{
+    int seed[] = {(i/4096)%4096, i%4096, j%4096, 2*((j/4096)%2048)+1};
+    for (int n = 0; n < nb; n++)
+        LAPACKE_slarnv_work(3, seed, mb, &T[n*ldt]);
+}
+
+/***************************************************************************//**
+ *  Q = orth(Y), by the tile QR factorization of Y in the Householder mode
+ *  of the context, the TSQR tree for a tall and skinny Y.
+ **/
+static void plasma_sgeqrf_lowrank_orth(plasma_desc_t Y, plasma_desc_t T,
+                                       plasma_desc_t Q,
+                                       plasma_workspace_t work,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    int householder_mode = plasma_householder_mode(plasma, Y.mt, Y.nt);
+
+    plasma_pslaset(PlasmaGeneral, 0.0, 1.0, Q, sequence, request);
+    if (householder_mode == PlasmaTreeHouseholder) {
+        plasma_psgeqrfrh(Y, T, work, sequence, request);
+        plasma_psorgqrrh(Y, T, Q, work, sequence, request);
+    }
+    else {
+        plasma_psgeqrf(Y, T, work, sequence, request);
+        plasma_psorgqr(Y, T, Q, work, sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes a low-rank factorization of a complex m-by-n matrix A,
+ *    \f[ A \approx Q \times B \f],
+ *  where Q is m-by-l with orthonormal columns, and B = Q^T A is l-by-n,
+ *  by a randomized range finder. Q spans the range of A Omega, for a random
+ *  n-by-l matrix Omega, with l = min(k+p, m, n), after niter power
+ *  iterations by A A^T. Both factors are returned in tile layout.
+ *
+ *  The cost is a few products by A, of O(mnl) flops, and tile QR
+ *  factorizations of tall and skinny matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The target rank. k >= 0.
+ *
+ * @param[in] p
+ *          The oversampling, columns sampled beyond k. p >= 0.
+ *
+ * @param[in] niter
+ *          The number of power iterations. niter >= 0.
+ *          Each sharpens the decay of the singular values of the sample,
+ *          at the price of two products by A.
+ *
+ * @param[in] pA
+ *          The m-by-n matrix A. Not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] Q
+ *          On exit, the m-by-l matrix Q in tile layout.
+ *          Allocated inside this function and needs to be destroyed by
+ *          plasma_desc_destroy.
+ *
+ * @param[out] B
+ *          On exit, the l-by-n matrix B in tile layout.
+ *          Allocated inside this function and needs to be destroyed by
+ *          plasma_desc_destroy.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_sgeqrf_lowrank
+ * @sa plasma_sgesvd_randomized
+ * @sa plasma_cgeqrf_lowrank
+ * @sa plasma_dgeqrf_lowrank
+ * @sa plasma_sgeqrf_lowrank
+ *
+ ******************************************************************************/
+int plasma_sgeqrf_lowrank(int m, int n, int k, int p, int niter,
+                          float *pA, int lda,
+                          plasma_desc_t *Q, plasma_desc_t *B)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -3;
+    }
+    if (p < 0) {
+        plasma_error("illegal value of p");
+        return -4;
+    }
+    if (niter < 0) {
+        plasma_error("illegal value of niter");
+        return -5;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -7;
+    }
+
+    int l = imin(k+p, imin(m, n));
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create the factors.
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        m, l, 0, 0, m, l, Q);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        l, n, 0, 0, l, n, B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(Q);
+        return retval;
+    }
+
+    // quick return
+    if (l == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrices and the samples.
+    plasma_desc_t A;
+    plasma_desc_t Y;
+    plasma_desc_t TY;
+    plasma_desc_t Z;
+    plasma_desc_t TZ;
+    plasma_desc_t W;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        m, l, 0, 0, m, l, &Y);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, l, 0, 0, n, l, &Z);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, l, 0, 0, n, l, &W);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_descT_compact_create(
+        Y, ib, plasma_householder_mode(plasma, Y.mt, Y.nt),
+        PlasmaColumnwise, &TY);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        return retval;
+    }
+    retval = plasma_descT_compact_create(
+        Z, ib, plasma_householder_mode(plasma, Z.mt, Z.nt),
+        PlasmaColumnwise, &TZ);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgeqrf_lowrank(niter, A, *Q, *B, Y, TY, Z, TZ, W,
+                                  work, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&Y);
+    plasma_desc_destroy(&TY);
+    plasma_desc_destroy(&Z);
+    plasma_desc_destroy(&TZ);
+    plasma_desc_destroy(&W);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes a low-rank factorization A = Q B by a randomized range finder.
+ *  Non-blocking tile version of plasma_sgeqrf_lowrank().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  The random tiles of Omega are generated by one task per tile, and
+ *      Q = orth(A Omega),
+ *  then, for each power iteration,
+ *      Q = orth(A orth(A^T Q)),
+ *  and B = Q^T A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] niter
+ *          The number of power iterations. niter >= 0.
+ *
+ * @param[in] A
+ *          Descriptor of the m-by-n matrix A.
+ *
+ * @param[out] Q
+ *          Descriptor of the m-by-l matrix Q, l <= min(m,n).
+ *
+ * @param[out] B
+ *          Descriptor of the l-by-n matrix B.
+ *
+ * @param[out] Y
+ *          Workspace descriptor of an m-by-l matrix.
+ *
+ * @param[out] TY
+ *          Workspace descriptor of the T of the QR factorization of Y,
+ *          created by plasma_descT_create in the Householder mode of Y.
+ *
+ * @param[out] Z
+ *          Workspace descriptor of an n-by-l matrix.
+ *
+ * @param[out] TZ
+ *          Workspace descriptor of the T of the QR factorization of Z,
+ *          created by plasma_descT_create in the Householder mode of Z.
+ *
+ * @param[out] W
+ *          Workspace descriptor of an n-by-l matrix. Holds Omega.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          For QR factorization, contains preallocated space for tau and work
+ *          arrays. Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgeqrf_lowrank
+ * @sa plasma_omp_cgeqrf_lowrank
+ * @sa plasma_omp_dgeqrf_lowrank
+ * @sa plasma_omp_sgeqrf_lowrank
+ *
+ ******************************************************************************/
+void plasma_omp_sgeqrf_lowrank(int niter, plasma_desc_t A,
+                               plasma_desc_t Q, plasma_desc_t B,
+                               plasma_desc_t Y, plasma_desc_t TY,
+                               plasma_desc_t Z, plasma_desc_t TZ,
+                               plasma_desc_t W, plasma_workspace_t work,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (niter < 0) {
+        plasma_error("illegal value of niter");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(Q) != PlasmaSuccess) {
+        plasma_error("invalid Q");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(Y) != PlasmaSuccess ||
+        plasma_desc_check(TY) != PlasmaSuccess ||
+        plasma_desc_check(Z) != PlasmaSuccess ||
+        plasma_desc_check(TZ) != PlasmaSuccess ||
+        plasma_desc_check(W) != PlasmaSuccess) {
+        plasma_error("invalid workspace");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    int l = Q.n;
+    if (Q.m != A.m || l > imin(A.m, A.n) ||
+        B.m != l || B.n != A.n ||
+        Y.m != A.m || Y.n != l ||
+        Z.m != A.n || Z.n != l ||
+        W.m != A.n || W.n != l) {
+        plasma_error("dimensions mismatch");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (l == 0)
+        return;
+
+    // Q = orth(A Omega)
+    plasma_psdesc_generate(plasma_sgeqrf_lowrank_random, NULL, W,
+                           sequence, request);
+    plasma_psgemm(PlasmaNoTrans, PlasmaNoTrans,
+                  1.0, A, W, 0.0, Y,
+                  sequence, request);
+    plasma_sgeqrf_lowrank_orth(Y, TY, Q, work, sequence, request);
+
+    // power iterations
+    for (int iter = 0; iter < niter; iter++) {
+        // W = orth(A^T Q)
+        plasma_psgemm(PlasmaTrans, PlasmaNoTrans,
+                      1.0, A, Q, 0.0, Z,
+                      sequence, request);
+        plasma_sgeqrf_lowrank_orth(Z, TZ, W, work, sequence, request);
+
+        // Q = orth(A W)
+        plasma_psgemm(PlasmaNoTrans, PlasmaNoTrans,
+                      1.0, A, W, 0.0, Y,
+                      sequence, request);
+        plasma_sgeqrf_lowrank_orth(Y, TY, Q, work, sequence, request);
+    }
+
+    // B = Q^T A
+    plasma_psgemm(PlasmaTrans, PlasmaNoTrans,
+                  1.0, Q, A, 0.0, B,
+                  sequence, request);
+}
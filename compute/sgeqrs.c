@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgeqrs.c, normal z -> s, Mon Feb  6 14:06:31 2017
+ * @generated from compute/zgeqrs.c, normal z -> s, Thu Oct 15 10:29:06 2026
  *
  **/
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -109,6 +110,7 @@ int plasma_sgeqrs(int m, int n, int nrhs,
     // Set tiling parameters.
     int ib = plasma->ib;
     int nb = plasma->nb;
+    int nbrhs = plasma_tile_rhs_nb(plasma, nb, nrhs);
 
     // Create tile matrices.
     plasma_desc_t A;
@@ -120,7 +122,7 @@ int plasma_sgeqrs(int m, int n, int nrhs,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nbrhs,
                                         m, nrhs, 0, 0, m, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
@@ -130,37 +132,33 @@ int plasma_sgeqrs(int m, int n, int nrhs,
 
     // Allocate workspace.
     plasma_workspace_t work;
-    size_t lwork = ib*nb;  // unmqr: work
+    size_t lwork = ib*imax(nb, nbrhs);  // unmqr: work
     retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_workspace_create() failed");
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_sgeqrs(A, T, B, work, sequence, &request);
+        plasma_omp_sgeqrs(A, T, B, work, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -171,8 +169,7 @@ int plasma_sgeqrs(int m, int n, int nrhs,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -272,8 +269,16 @@ void plasma_omp_sgeqrs(plasma_desc_t A, plasma_desc_t T,
     if (A.m == 0 || A.n == 0 || B.n == 0)
         return;
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    if (plasma_descT_check(A, T, householder_mode,
+                           PlasmaColumnwise) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     // Find Y = Q^T * B.
-    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+    if (householder_mode == PlasmaTreeHouseholder) {
         plasma_psormqrrh(PlasmaLeft, PlasmaTrans,
                          A, T, B, work,
                          sequence, request);
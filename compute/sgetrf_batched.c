@@ -0,0 +1,337 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrf_batched.c, normal z -> s, Thu Oct 15 07:38:56 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of a batch of
+ *  independent m-by-n matrices A_i of the same size.
+ *  Each factorization runs sequentially in LAPACK, and the batch is spread
+ *  across the threads in a single parallel region, without tile layout.
+ *  Intended for many small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A_i. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the m-by-n matrices A_i.
+ *          On exit, the factors L and U of A_i; the unit diagonal of L is
+ *          not stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,m).
+ *
+ * @param[out] ipiv
+ *          Array of batch_count pointers to the min(m,n) pivot indices of A_i.
+ *          Row i of A_i was interchanged with row ipiv[i].
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, or j > 0
+ *          if U(j,j) of A_i is exactly zero.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrf
+ * @sa plasma_cgetrf_batched
+ * @sa plasma_dgetrf_batched
+ * @sa plasma_sgetrf_batched
+ *
+ ******************************************************************************/
+int plasma_sgetrf_batched(int m, int n,
+                          float **pA, int lda, int **ipiv,
+                          int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ipiv == NULL && batch_count > 0) {
+        plasma_error("NULL ipiv");
+        return -5;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -7;
+    }
+
+    #pragma omp parallel for schedule(static) \
+                         num_threads(plasma_num_threads(plasma))
+    for (int i = 0; i < batch_count; i++) {
+        info[i] = LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, m, n,
+                                      pA[i], lda, ipiv[i]);
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of a batch of
+ *  independent matrices A_i of sizes of their own, in a single parallel
+ *  region. The matrices larger than the tile size are factored by the
+ *  tile algorithm across the threads, the largest first, and the others
+ *  sequentially in LAPACK, packed many per task by decreasing cost, so
+ *  that the small matrices fill the threads left idle by the large ones.
+ *  The large matrices are factored one after the other, as their panels
+ *  share the workspace of the context.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          Array of batch_count numbers of rows of the matrices A_i.
+ *          m[i] >= 0.
+ *
+ * @param[in] n
+ *          Array of batch_count numbers of columns of the matrices A_i.
+ *          n[i] >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the m[i]-by-n[i] matrices A_i.
+ *          On exit, the factors L and U of A_i; the unit diagonal of L is
+ *          not stored.
+ *
+ * @param[in] lda
+ *          Array of batch_count leading dimensions of the arrays A_i.
+ *          lda[i] >= max(1,m[i]).
+ *
+ * @param[out] ipiv
+ *          Array of batch_count pointers to the min(m[i],n[i]) pivot
+ *          indices of A_i. Row j of A_i was interchanged with row
+ *          ipiv[i][j].
+ *
+ * @param[in] batch_count
+ *          The number of matrices in the batch. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count statuses. info[i] = 0 on success, j > 0
+ *          if U(j,j) of A_i is exactly zero, or < 0 if the tile algorithm
+ *          failed on A_i.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrf_batched
+ * @sa plasma_cgetrf_vbatched
+ * @sa plasma_dgetrf_vbatched
+ * @sa plasma_sgetrf_vbatched
+ *
+ ******************************************************************************/
+int plasma_sgetrf_vbatched(const int *m, const int *n,
+                           float **pA, const int *lda,
+                           int **ipiv, int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m == NULL && batch_count > 0) {
+        plasma_error("NULL m");
+        return -1;
+    }
+    if (n == NULL && batch_count > 0) {
+        plasma_error("NULL n");
+        return -2;
+    }
+    if (pA == NULL && batch_count > 0) {
+        plasma_error("NULL A");
+        return -3;
+    }
+    if (lda == NULL && batch_count > 0) {
+        plasma_error("NULL lda");
+        return -4;
+    }
+    if (ipiv == NULL && batch_count > 0) {
+        plasma_error("NULL ipiv");
+        return -5;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+    if (info == NULL && batch_count > 0) {
+        plasma_error("NULL info");
+        return -7;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -1;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, m[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Schedule the matrices by their sizes.
+    plasma_batch_item_t *items = (plasma_batch_item_t*)malloc(
+        batch_count*sizeof(plasma_batch_item_t));
+    int *chunk = (int*)malloc((batch_count+1)*sizeof(int));
+    if (items == NULL || chunk == NULL) {
+        free(items);
+        free(chunk);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int i = 0; i < batch_count; i++) {
+        float mi = m[i];
+        float ni = n[i];
+        float ki = imin(m[i], n[i]);
+        items[i].cost = mi*ni*ki - (mi+ni)*ki*ki/2.0 + ki*ki*ki/3.0;
+        items[i].index = i;
+        items[i].large = imax(m[i], n[i]) > nb && imin(m[i], n[i]) > 0;
+    }
+    int num_chunks = plasma_batch_schedule(items, batch_count, nb,
+                                           plasma_num_threads(plasma), chunk);
+    int num_large = chunk[0];
+
+    // Create the tile matrices and the sequences of the large matrices.
+    for (int l = 0; l < num_large; l++) {
+        int i = items[l].index;
+        int retval = plasma_desc_lapack_create(PlasmaRealFloat,
+                                               pA[i], lda[i], nb, nb,
+                                               m[i], n[i], &items[l].desc[0]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_lapack_create() failed");
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].num_descs = 1;
+        retval = plasma_sequence_create(&items[l].sequence);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_sequence_create() failed");
+            plasma_desc_destroy(&items[l].desc[0]);
+            plasma_batch_destroy(items, l);
+            free(chunk);
+            return retval;
+        }
+        items[l].request = PlasmaRequestInitializer;
+    }
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->num_panel_threads);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        for (int l = 0; l < imax(num_large, 1); l++) {
+            // the large matrices, by the tile algorithm, one at a time
+            if (l > 0) {
+                #pragma omp taskwait
+            }
+            if (l < num_large) {
+                int i = items[l].index;
+                plasma_desc_t A = items[l].desc[0];
+                plasma_psge2desc_colwise(pA[i], lda[i], A,
+                                         items[l].sequence, &items[l].request);
+                plasma_omp_sgetrf(A, ipiv[i],
+                                  items[l].sequence, &items[l].request);
+                plasma_psdesc2ge_getrf(A, pA[i], lda[i],
+                                       items[l].sequence, &items[l].request);
+            }
+            // the small matrices, many per task, along the first large one
+            if (l == 0) {
+                for (int j = 0; j < num_chunks; j++) {
+                    #pragma omp task firstprivate(j)
+                    {
+                        for (int c = chunk[j]; c < chunk[j+1]; c++) {
+                            int i = items[c].index;
+                            info[i] = LAPACKE_sgetrf_work(
+                                LAPACK_COL_MAJOR, m[i], n[i],
+                                pA[i], lda[i], ipiv[i]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    // implicit synchronization
+
+    for (int l = 0; l < num_large; l++)
+        info[items[l].index] = items[l].sequence->status;
+
+    plasma_batch_destroy(items, num_large);
+    free(chunk);
+    return PlasmaSuccess;
+}
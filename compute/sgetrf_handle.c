@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrf_handle.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization of an n-by-n matrix A with partial pivoting
+ *  and keeps it in tile layout, so that plasma_sgetrs_handle solves systems
+ *  with A without translating A again.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] pA
+ *          The n-by-n matrix A. Not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] handle
+ *          On exit, the factors of A and the pivot indices.
+ *          Must be freed by plasma_getrf_handle_destroy, also if A is
+ *          singular.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if U(i,i) is exactly zero, the factorization is done but U is
+ *         singular and the handle cannot solve systems of equations.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrs_handle
+ * @sa plasma_getrf_handle_destroy
+ * @sa plasma_sgetrf
+ *
+ ******************************************************************************/
+int plasma_sgetrf_handle_create(int n, float *pA, int lda,
+                                plasma_getrf_handle_t *handle)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -3;
+    }
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return -4;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Create tile matrix.
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &handle->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    handle->ipiv = (int*)malloc((size_t)imax(1, n)*sizeof(int));
+    if (handle->ipiv == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(&handle->A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    plasma_desc_t A = handle->A;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout by tile columns,
+        // so that the factorization starts as soon as the first column is in.
+        plasma_psge2desc_colwise(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgetrf(A, handle->ipiv, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a system of linear equations A * X = B with the LU factorization
+ *  kept by plasma_sgetrf_handle_create. Only B is translated to tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] handle
+ *          The LU factorization of A.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns of B.
+ *          nrhs >= 0.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, the solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrf_handle_create
+ * @sa plasma_sgetrs
+ *
+ ******************************************************************************/
+int plasma_sgetrs_handle(plasma_getrf_handle_t handle, int nrhs,
+                         float *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    plasma_desc_t A = handle.A;
+    int n = A.n;
+
+    if (A.precision != PlasmaRealFloat || handle.ipiv == NULL) {
+        plasma_error("invalid handle");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -4;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrix with the tiling of the factors.
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, A.mb, A.nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        // B is translated by tile columns to match the row interchanges.
+        plasma_psge2desc_colwise(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgetrs(A, handle.ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix B in tile layout.
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgetri_aux.c, normal z -> s, Mon Feb  6 14:06:33 2017
+ * @generated from compute/zgetri_aux.c, normal z -> s, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -78,7 +78,6 @@ int plasma_sgetri_aux(int n, float *pA, int lda)
 
     // Create tile matrices.
     plasma_desc_t A;
-    plasma_desc_t W;
     int retval;
     retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
                                         n, n, 0, 0, n, n, &A);
@@ -86,47 +85,34 @@ int plasma_sgetri_aux(int n, float *pA, int lda)
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        n, nb, 0, 0, n, nb, &W);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        return retval;
-    }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_sgetri_aux(A, W, sequence, &request);
+        plasma_omp_sgetri_aux(A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
-    plasma_desc_destroy(&W);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -146,9 +132,6 @@ int plasma_sgetri_aux(int n, float *pA, int lda)
  * @param[in] A
  *          Descriptor of the matrix.
  *
- * @param[in] W
- *          Workspace of dimension (n, nb).
- *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
  *          (for completion checks and exception handling purposes).  Check
@@ -172,7 +155,7 @@ int plasma_sgetri_aux(int n, float *pA, int lda)
  * @sa plasma_omp_sgetri
  *
  ******************************************************************************/
-void plasma_omp_sgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_omp_sgetri_aux(plasma_desc_t A,
                            plasma_sequence_t *sequence,
                            plasma_request_t *request)
 {
@@ -190,11 +173,6 @@ void plasma_omp_sgetri_aux(plasma_desc_t A, plasma_desc_t W,
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
         return;
     }
-    if (plasma_desc_check(W) != PlasmaSuccess) {
-        plasma_error("invalid W");
-        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
-        return;
-    }
     if (sequence == NULL) {
         plasma_error("NULL sequence");
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
@@ -211,5 +189,5 @@ void plasma_omp_sgetri_aux(plasma_desc_t A, plasma_desc_t W,
       return;
 
     // Call the parallel function.
-    plasma_psgetri_aux(A, W, sequence, request);
+    plasma_psgetri_aux(A, sequence, request);
 }
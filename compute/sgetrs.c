@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zgetrs.c, normal z -> s, Mon Feb  6 14:06:33 2017
+ * @generated from compute/zgetrs.c, normal z -> s, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -57,6 +57,7 @@ int plasma_sgetrs(int n, int nrhs,
 
     // Set tiling parameters.
     int nb = plasma->nb;
+    int nbrhs = plasma_tile_rhs_nb(plasma, nb, nrhs);
 
     // Initialize barrier.
     int num_panel_threads = plasma->num_panel_threads;
@@ -72,53 +73,43 @@ int plasma_sgetrs(int n, int nrhs,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nbrhs,
                                         n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
-    #pragma omp parallel
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, sequence, &request);
-    }
+        // B is translated by tile columns to match the row interchanges.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_psge2desc_colwise(pB, ldb, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
-        plasma_omp_sgetrs(A, ipiv, B, sequence, &request);
-    }
+        plasma_omp_sgetrs(A, ipiv, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
     }
+    // implicit synchronization
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -164,12 +155,18 @@ void plasma_omp_sgetrs(plasma_desc_t A, int *ipiv,
         return;
 
     // Call the parallel functions.
-    plasma_pslaswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
+    if (plasma->left_pivoting == PlasmaLeftPivotingOn) {
+        plasma_pslaswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
 
-    plasma_pstrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
-                  1.0, A,
-                       B,
-                  sequence, request);
+        plasma_pstrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                      1.0, A,
+                           B,
+                      sequence, request);
+    }
+    else {
+        // The pivots are applied block by block, as L is not pivoted.
+        plasma_pslaswp_trsm(A, ipiv, B, sequence, request);
+    }
 
     plasma_pstrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
                   1.0, A,
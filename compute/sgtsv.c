@@ -0,0 +1,270 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgtsv.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gtsv
+ *
+ *  Computes the solution to a system of linear equations A * X = B,
+ *  where A is an n-by-n tridiagonal matrix and X and B are n-by-nrhs
+ *  matrices, with a partitioned (SPIKE) algorithm: the partitions of nb rows
+ *  of A are factored with partial pivoting in parallel, then a reduced
+ *  system of order 2*ceil(n/nb) couples them.
+ *
+ *  The pivoting does not cross the partitions, so the solver fails if a
+ *  diagonal block of A of a partition is singular, which cannot happen for
+ *  diagonally dominant matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrix B. nrhs >= 0.
+ *
+ * @param[in,out] dl
+ *          On entry, the n-1 subdiagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] du
+ *          On entry, the n-1 superdiagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, U(i,i) of the factorization of a partition or of the
+ *          reduced system is exactly zero, and the solution has not been
+ *          computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_sgtsv
+ * @sa plasma_cgtsv
+ * @sa plasma_dgtsv
+ * @sa plasma_sgtsv
+ *
+ ******************************************************************************/
+int plasma_sgtsv(int n, int nrhs,
+                 float *dl, float *d,
+                 float *du,
+                 float *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix.
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Allocate workspace.
+    float *work = (float*)malloc(
+        (3*(size_t)n + 2*(size_t)B.mt*(7+nrhs))*sizeof(float));
+    int *iwork = (int*)malloc(((size_t)n + 2*B.mt)*sizeof(int));
+    if (work == NULL || iwork == NULL) {
+        free(work);
+        free(iwork);
+        plasma_desc_destroy(&B);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgtsv(dl, d, du, B, work, iwork, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    free(work);
+    free(iwork);
+
+    // Free matrix in tile layout.
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gtsv
+ *
+ *  Solves a tridiagonal system of linear equations with a partitioned
+ *  algorithm, the partitions being the tile rows of B.
+ *  Non-blocking tile version of plasma_sgtsv().
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] dl
+ *          On entry, the B.m-1 subdiagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] d
+ *          On entry, the B.m diagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] du
+ *          On entry, the B.m-1 superdiagonal elements of A.
+ *          On exit, overwritten by the factors of the partitions.
+ *
+ * @param[in,out] B
+ *          Descriptor of the right hand sides B, overwritten by the solution.
+ *
+ * @param[out] work
+ *          Workspace of size 3*B.m + 2*B.mt*(7+B.n).
+ *
+ * @param[out] iwork
+ *          Workspace of size B.m + 2*B.mt.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes). Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values. The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgtsv
+ * @sa plasma_omp_cgtsv
+ * @sa plasma_omp_dgtsv
+ * @sa plasma_omp_sgtsv
+ *
+ ******************************************************************************/
+void plasma_omp_sgtsv(float *dl, float *d,
+                      float *du, plasma_desc_t B,
+                      float *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (dl == NULL || d == NULL || du == NULL) {
+        plasma_error("NULL dl, d or du");
+        plasma_request_fail(sequence, request, PlasmaErrorNullParameter);
+        return;
+    }
+    if (work == NULL || iwork == NULL) {
+        plasma_error("NULL work or iwork");
+        plasma_request_fail(sequence, request, PlasmaErrorNullParameter);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (B.m == 0 || B.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_psgtsv(dl, d, du, B, work, iwork, sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zunglq.c, normal z -> s, Mon Feb  6 14:06:42 2017
+ * @generated from compute/zunglq.c, normal z -> s, Thu Oct 15 10:29:06 2026
  *
  **/
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -121,10 +122,10 @@ int plasma_sorglq(int m, int n, int k,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        m, n, 0, 0, k, n, &Q);
+    retval = plasma_desc_general_zero_create(PlasmaRealFloat, nb, nb,
+                                             m, n, 0, 0, k, n, &Q);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_zero_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -138,30 +139,26 @@ int plasma_sorglq(int m, int n, int k,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pQ, ldq, Q, sequence, &request);
+        // Q is set by plasma_omp_sorglq, from fresh zero storage.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_sorglq(A, T, Q, work, sequence, &request);
+        plasma_omp_sorglq(A, T, Q, work, &sequence, &request);
 
         // Translate Q back to LAPACK layout.
-        plasma_omp_sdesc2ge(Q, pQ, ldq, sequence, &request);
+        plasma_omp_sdesc2ge(Q, pQ, ldq, &sequence, &request);
     }
     // implicit synchronization
 
@@ -172,8 +169,7 @@ int plasma_sorglq(int m, int n, int k,
     plasma_desc_destroy(&Q);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -269,11 +265,19 @@ void plasma_omp_sorglq(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
     if (Q.m <= 0)
         return;
 
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    if (plasma_descT_check(A, T, householder_mode,
+                           PlasmaRowwise) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
     // Set Q to identity.
     plasma_pslaset(PlasmaGeneral, 0.0, 1.0, Q, sequence, request);
 
     // Construct Q.
-    if (plasma->householder_mode == PlasmaTreeHouseholder) {
+    if (householder_mode == PlasmaTreeHouseholder) {
         plasma_psorglqrh(A, T, Q, work, sequence, request);
     }
     else {
@@ -0,0 +1,180 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_sparse.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a symmetric positive definite
+ *  matrix A, as plasma_spotrf, of which many tiles are zero. The tiles of
+ *  the uplo triangle of A that are zero, and stay zero in its factor, are
+ *  neither stored in tile layout nor factored: the zero tiles are found
+ *  first, the tiles filled in by the factorization added to them, and A is
+ *  factored as a block-sparse tile matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric positive definite matrix A, of which
+ *          the strictly other triangle is not referenced.
+ *          On exit, if return value = 0, the factor U or L from the Cholesky
+ *          factorization A = U^T*U or A = L*L^T.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite, so the factorization could not
+ *          be completed, and the solution has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_spotrf
+ * @sa plasma_cpotrf_sparse
+ * @sa plasma_dpotrf_sparse
+ * @sa plasma_spotrf_sparse
+ * @sa plasma_spotrf
+ *
+ ******************************************************************************/
+int plasma_spotrf_sparse(plasma_enum_t uplo,
+                         int n,
+                         float *pA, int lda)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+
+    // quick return
+    if (imax(n, 0) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+    int nt = (n+nb-1)/nb;
+
+    // Allocate the pattern and the structure of the tiles.
+    int *pattern = (int*)calloc((size_t)nt*nt, sizeof(int));
+    plasma_enum_t *structure =
+        (plasma_enum_t*)malloc((size_t)nt*nt*sizeof(plasma_enum_t));
+    if (pattern == NULL || structure == NULL) {
+        plasma_error("malloc() failed");
+        free(pattern);
+        free(structure);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+    int retval;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // Find the zero tiles of the uplo triangle.
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        for (int j = 0; j < nt; j++) {
+            int mi = uplo == PlasmaLower ? j : 0;
+            int ni = uplo == PlasmaLower ? nt : j+1;
+            for (int i = mi; i < ni; i++) {
+                core_omp_stile_structure(
+                    imin(nb, n-i*nb), imin(nb, n-j*nb),
+                    &pA[i*nb + (size_t)lda*j*nb], lda,
+                    &structure[i + (size_t)nt*j],
+                    &sequence, &request);
+            }
+        }
+    }
+    // implicit synchronization
+
+    for (int j = 0; j < nt; j++) {
+        int mi = uplo == PlasmaLower ? j : 0;
+        int ni = uplo == PlasmaLower ? nt : j+1;
+        for (int i = mi; i < ni; i++)
+            pattern[i + (size_t)nt*j] =
+                structure[i + (size_t)nt*j] != PlasmaTileZero;
+    }
+    free(structure);
+    plasma_desc_sparse_fill(uplo, nt, pattern);
+
+    // Create tile matrix of the nonzero tiles and their fill-in.
+    plasma_desc_t A;
+    retval = plasma_desc_sparse_create(PlasmaRealFloat, pattern, nb, nb,
+                                       n, n, 0, 0, n, n, &A);
+    free(pattern);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_sparse_create() failed");
+        return retval;
+    }
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_spotrf(uplo, A, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -0,0 +1,308 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_update.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Updates or downdates the Cholesky factorization of a symmetric positive
+ *  definite matrix A, computed by plasma_spotrf, with the rank-k term
+ *
+ *    \f[ A_+ = A \pm V \times V^T, \f]
+ *
+ *  where V is an n-by-k matrix, in O(n^2 k) flops, rather than the O(n^3)
+ *  of a new factorization. The update applies plane rotations, and the
+ *  downdate hyperbolic rotations, to the columns of [L V].
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] sign
+ *          - 1:  the update,   A_+ = A + V*V^T,
+ *          - -1: the downdate, A_+ = A - V*V^T.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of V. k >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the factor U or L from the Cholesky factorization
+ *          A = U^T*U or A = L*L^T, of which the elements of the other
+ *          triangle are not referenced.
+ *          On exit, if return value = 0, the factor of A_+.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in,out] pV
+ *          On entry, the n-by-k matrix V.
+ *          On exit, destroyed.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the downdated matrix A_+ is not positive definite,
+ *          its leading minor of order i being the first which is not,
+ *          and the factor is left partly downdated.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_spotrf_update
+ * @sa plasma_cpotrf_update
+ * @sa plasma_dpotrf_update
+ * @sa plasma_spotrf_update
+ * @sa plasma_spotrf
+ *
+ ******************************************************************************/
+int plasma_spotrf_update(plasma_enum_t uplo, int sign, int n, int k,
+                         float *pA, int lda,
+                         float *pV, int ldv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (sign != 1 && sign != -1) {
+        plasma_error("illegal value of sign");
+        return -2;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -3;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -4;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -6;
+    }
+    if (ldv < imax(1, n)) {
+        plasma_error("illegal value of ldv");
+        return -8;
+    }
+
+    // quick return
+    if (imin(n, k) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices, with the rotations G of nb-by-2*nb tiles.
+    plasma_desc_t A;
+    plasma_desc_t V;
+    plasma_desc_t G;
+    int retval;
+    retval = plasma_desc_lapack_triangular_create(PlasmaRealFloat, uplo,
+                                                  pA, lda, nb, nb, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_triangular_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, k, 0, 0, n, k, &V);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, 2*nb,
+                                        V.mt*nb, V.nt*2*nb,
+                                        0, 0, V.mt*nb, V.nt*2*nb, &G);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&V);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_sge2desc(pV, ldv, V, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_spotrf_update(uplo, sign, A, V, G, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_sdesc2ge(V, pV, ldv, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&V);
+    plasma_desc_destroy(&G);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Updates or downdates the Cholesky factorization of a symmetric positive
+ *  definite matrix with a rank-k term.
+ *  Non-blocking tile version of plasma_spotrf_update().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] sign
+ *          - 1:  the update,   A_+ = A + V*V^T,
+ *          - -1: the downdate, A_+ = A - V*V^T.
+ *
+ * @param[in,out] A
+ *          On entry, the factor U or L from plasma_omp_spotrf.
+ *          On exit, the factor of A_+.
+ *
+ * @param[in,out] V
+ *          On entry, the n-by-k matrix V, tiled as A.
+ *          On exit, destroyed.
+ *
+ * @param[out] G
+ *          Workspace of the rotations, of the tiles of V, each of
+ *          nb-by-2*nb elements.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_spotrf_update
+ * @sa plasma_omp_cpotrf_update
+ * @sa plasma_omp_dpotrf_update
+ * @sa plasma_omp_spotrf_update
+ * @sa plasma_omp_spotrf
+ *
+ ******************************************************************************/
+void plasma_omp_spotrf_update(plasma_enum_t uplo, int sign,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_desc_t G,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sign != 1 && sign != -1) {
+        plasma_error("illegal value of sign");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess || A.m != A.n) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(V) != PlasmaSuccess ||
+        V.m != A.m || V.mb != A.mb || V.nb != A.nb) {
+        plasma_error("invalid V");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(G) != PlasmaSuccess ||
+        G.mb < A.mb || G.nb < 2*V.nb || G.mt < V.mt || G.nt < V.nt) {
+        plasma_error("invalid G");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || V.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pspotrf_update(uplo, sign, A, V, G, sequence, request);
+}
@@ -0,0 +1,369 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zheev.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_heev
+ *
+ *  Computes all eigenvalues and, optionally, eigenvectors of a
+ *  complex symmetric n-by-n matrix A, by a two-stage reduction to
+ *  tridiagonal form.
+ *
+ *  The first stage reduces A to a band matrix B of bandwidth nb,
+ *  A = Q1 B Q1^T, by tile QR factorizations of the panels applied from
+ *  both sides (plasma_omp_ssy2sb). It runs in parallel over the tiles,
+ *  and holds most of the flops. The band is then reduced to tridiagonal
+ *  form and solved by divide and conquer by LAPACK ssbevd, on n*nb
+ *  elements, and the eigenvectors of B are transformed back by Q1.
+ *
+ *******************************************************************************
+ *
+ * @param[in] jobz
+ *          - PlasmaNoVec: computes eigenvalues only;
+ *          - PlasmaVec:   computes eigenvalues and eigenvectors.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: the upper triangle of A is stored;
+ *          - PlasmaLower: the lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric matrix A. The triangle opposite to uplo
+ *          is not referenced.
+ *          On exit, if jobz = PlasmaVec, the orthonormal eigenvectors of A,
+ *          the j-th column for the eigenvalue W(j).
+ *          If jobz = PlasmaNoVec, the uplo triangle of A is destroyed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] W
+ *          On exit, the eigenvalues in ascending order, of size n.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the tridiagonal solver failed to converge
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_ssy2sb
+ * @sa plasma_cheev
+ * @sa plasma_dsyev
+ * @sa plasma_ssyev
+ *
+ ******************************************************************************/
+int plasma_ssyev(plasma_enum_t jobz, plasma_enum_t uplo, int n,
+                 float *pA, int lda, float *W)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((jobz != PlasmaNoVec) &&
+        (jobz != PlasmaVec)) {
+        plasma_error("illegal value of jobz");
+        return -1;
+    }
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -2;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (W == NULL) {
+        plasma_error("NULL W");
+        return -6;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t T;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_descT_create(A, ib, PlasmaFlatHouseholder, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Allocate the band and the eigenvectors of the band.
+    int kd = imin(nb, n-1);
+    int ldab = kd+1;
+    float *AB = (float*)malloc(
+        (size_t)ldab*n*sizeof(float));
+    float *Z = NULL;
+    if (jobz == PlasmaVec)
+        Z = (float*)malloc(
+            (size_t)n*n*sizeof(float));
+    if (AB == NULL || (jobz == PlasmaVec && Z == NULL)) {
+        plasma_error("malloc() failed");
+        free(AB);
+        free(Z);
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        free(AB);
+        free(Z);
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // Reduce to band.
+        plasma_omp_ssy2sb(uplo, A, T, AB, ldab, work, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Solve the band problem.
+    if (sequence.status == PlasmaSuccess) {
+        int info = LAPACKE_ssbevd(LAPACK_COL_MAJOR,
+                                  lapack_const(jobz), 'L',
+                                  n, kd, AB, ldab, W, Z, n);
+        if (info != 0)
+            plasma_request_fail(&sequence, &request,
+                                info > 0 ? info : PlasmaErrorInternal);
+    }
+
+    // Transform the eigenvectors of B back by Q1, which is the Q of the
+    // QR factorization of A(nb:n-1, 0:n-nb-1).
+    if (jobz == PlasmaVec && sequence.status == PlasmaSuccess) {
+        plasma_desc_t Q;
+        retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                            n, n, 0, 0, n, n, &Q);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_request_fail(&sequence, &request, retval);
+        }
+        else {
+            #pragma omp parallel num_threads(plasma_num_threads(plasma))
+            #pragma omp master
+            #pragma omp taskgroup
+            {
+                plasma_omp_sge2desc(Z, n, Q, &sequence, &request);
+                if (n > nb) {
+                    plasma_desc_t V =
+                        plasma_desc_view(A, nb, 0, n-nb, n-nb);
+                    plasma_desc_t TV =
+                        plasma_desc_view(T, ib, 0, T.m-ib, T.n);
+                    plasma_desc_t QV =
+                        plasma_desc_view(Q, nb, 0, n-nb, n);
+                    plasma_psormqr(PlasmaLeft, PlasmaNoTrans, V, TV, QV,
+                                   work, &sequence, &request);
+                }
+                plasma_omp_sdesc2ge(Q, pA, lda, &sequence, &request);
+            }
+            // implicit synchronization
+
+            plasma_desc_destroy(&Q);
+        }
+    }
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrices.
+    free(AB);
+    free(Z);
+    plasma_desc_destroy(&T);
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_heev
+ *
+ *  Reduces a complex symmetric matrix A to band form B of bandwidth nb,
+ *  A = Q B Q^T, the first stage of plasma_ssyev.
+ *  Non-blocking tile version.
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: the upper triangle of A is stored;
+ *          - PlasmaLower: the lower triangle of A is stored.
+ *
+ * @param[in,out] A
+ *          Descriptor of the n-by-n matrix A, with square tiles.
+ *          On exit, the tiles below the band hold the reflectors of Q,
+ *          which is the Q of the QR factorization of A(nb:n-1, 0:n-nb-1).
+ *          The rest of A is destroyed.
+ *
+ * @param[out] T
+ *          Descriptor of matrix T, created by plasma_descT_create for A
+ *          in the flat Householder mode.
+ *          On exit, auxiliary data of Q from its second tile row on.
+ *
+ * @param[out] AB
+ *          On exit, the lower triangle of B in LAPACK band storage,
+ *          with kd = min(nb, n-1) subdiagonals.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the array AB. ldab >= kd+1.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          Contains preallocated space for tau and work arrays.
+ *          Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ssyev
+ * @sa plasma_omp_csy2sb
+ * @sa plasma_omp_dsy2sb
+ * @sa plasma_omp_ssy2sb
+ *
+ ******************************************************************************/
+void plasma_omp_ssy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                       float *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m != A.n || A.mb != A.nb) {
+        plasma_error("A not square or tiles not square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (AB == NULL) {
+        plasma_error("NULL AB");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ldab < imin(A.nb, A.n-1)+1) {
+        plasma_error("illegal value of ldab");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pssy2sb(uplo, A, T, AB, ldab, work, sequence, request);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zsymm.c, normal z -> s, Mon Feb  6 14:06:39 2017
+ * @generated from compute/zsymm.c, normal z -> s, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -177,35 +177,49 @@ int plasma_ssymm(plasma_enum_t side, plasma_enum_t
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, sequence, &request);
-        plasma_omp_sge2desc(pC, ldc, C, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_sge2desc(pC, ldc, C, &sequence, &request);
 
-        // Call the tile async function.
-        plasma_omp_ssymm(side, uplo,
-                         alpha, A,
-                                B,
-                         beta,  C,
-                         sequence, &request);
+        // Call the tile async function, or expand A, a private copy,
+        // to the full matrix and multiply by gemm.
+        if (plasma_expand_sym(plasma, A.mt)) {
+            plasma_pslacpy_sym(uplo, PlasmaTrans, A, &sequence, &request);
+            if (side == PlasmaLeft)
+                plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                                 alpha, A,
+                                        B,
+                                 beta,  C,
+                                 &sequence, &request);
+            else
+                plasma_omp_sgemm(PlasmaNoTrans, PlasmaNoTrans,
+                                 alpha, B,
+                                        A,
+                                 beta,  C,
+                                 &sequence, &request);
+        }
+        else {
+            plasma_omp_ssymm(side, uplo,
+                             alpha, A,
+                                    B,
+                             beta,  C,
+                             &sequence, &request);
+        }
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(C, pC, ldc, sequence, &request);
+        plasma_omp_sdesc2ge(C, pC, ldc, &sequence, &request);
     }
     // implicit synchronization
 
@@ -215,8 +229,7 @@ int plasma_ssymm(plasma_enum_t side, plasma_enum_t
     plasma_desc_destroy(&C);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from compute/zsyr2k.c, normal z -> s, Mon Feb  6 14:06:40 2017
+ * @generated from compute/zsyr2k.c, normal z -> s, Thu Oct 15 07:33:54 2026
  *
  **/
 
@@ -183,44 +183,40 @@ int plasma_ssyr2k(plasma_enum_t uplo, plasma_enum_t trans,
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        n, n, 0, 0, n, n, &C);
+    retval = plasma_desc_triangular_create(PlasmaRealFloat, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_triangular_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_fatal_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, sequence, &request);
-        plasma_omp_sge2desc(pC, ldc, C, sequence, &request);
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_sge2desc(pC, ldc, C, &sequence, &request);
 
         // Call the tile async function.
         plasma_omp_ssyr2k(uplo, trans,
                           alpha, A,
                                  B,
                           beta,  C,
-                          sequence, &request);
+                          &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(C, pC, ldc, sequence, &request);
+        plasma_omp_sdesc2ge(C, pC, ldc, &sequence, &request);
     }
     // implicit synchronization
 
@@ -230,8 +226,7 @@ int plasma_ssyr2k(plasma_enum_t uplo, plasma_enum_t trans,
     plasma_desc_destroy(&C);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
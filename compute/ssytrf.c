@@ -0,0 +1,348 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zhetrf.c, normal z -> s, Thu Oct 15 07:33:54 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hetrf
+ *
+ *  Factors a symmetric indefinite matrix A by Aasen's algorithm,
+ *    \f[ P A P^T = L T L^T, \f]
+ *  where P is a permutation, L is unit lower triangular, and T is symmetric
+ *  band of bandwidth nb, which is then factored by the band LU
+ *  factorization, T = P2 L2 U2.
+ *
+ *  The factorization of A, which holds nearly all the flops, is tile
+ *  parallel with gemm, trsm and trmm tasks, and the threaded LU panel of
+ *  plasma_sgetrf. It takes about half the flops of plasma_sgetrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the symmetric matrix A, of which the lower triangle
+ *          is referenced.
+ *          On exit, the factor L below the first block of nb columns:
+ *          L(nb:n-1, nb:n-1) is stored in A(nb:n-1, 0:n-nb-1), with its
+ *          unit diagonal not stored. The other elements are destroyed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] ipiv
+ *          The pivot indices of P, of size n; for 1 <= i <= n, the row i
+ *          of the matrix was interchanged with the row ipiv(i).
+ *
+ * @param[out] pT
+ *          On exit, the LU factorization of T in LAPACK band storage, with
+ *          kl = ku = nb, as by LAPACKE_sgbtrf.
+ *
+ * @param[in] ldt
+ *          The leading dimension of the array T. ldt >= 3*nb+1.
+ *
+ * @param[out] ipiv2
+ *          The pivot indices of P2, of size n.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, U2(i,i) is exactly zero, so that T is singular
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_ssytrf
+ * @sa plasma_ssytrs
+ * @sa plasma_ssysv
+ * @sa plasma_chetrf
+ * @sa plasma_dsytrf
+ * @sa plasma_ssytrf
+ *
+ ******************************************************************************/
+int plasma_ssytrf(plasma_enum_t uplo, int n,
+                  float *pA, int lda, int *ipiv,
+                  float *pT, int ldt, int *ipiv2)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Check input arguments.
+    if (uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo, only PlasmaLower supported");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldt < 3*nb+1) {
+        plasma_error("illegal value of ldt");
+        return -7;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t T;
+    plasma_desc_t H;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, 2*nb, 0, 0, n, 2*nb, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
+                                        n, 2*nb, 0, 0, n, 2*nb, &H);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // blocks of T in LAPACK layout
+    float *pTt = (float*)malloc(
+        (size_t)n*2*nb*sizeof(float));
+    if (pTt == NULL) {
+        plasma_error("malloc() failed");
+        plasma_desc_destroy(&H);
+        plasma_desc_destroy(&T);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_ssytrf(uplo, A, ipiv, T, H, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_sdesc2ge(T, pTt, n, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Factor T by band LU.
+    if (sequence.status == PlasmaSuccess) {
+        // T(i, j) is in row 2*nb+i-j of the band.
+        int kd = nb;
+        LAPACKE_slaset_work(LAPACK_COL_MAJOR, 'g', ldt, n, 0.0, 0.0,
+                            pT, ldt);
+        for (int k = 0; k < A.nt; k++) {
+            int k0 = k*nb;
+            int mvak = plasma_tile_mview(A, k);
+            // diagonal block T(k, k)
+            for (int j = 0; j < mvak; j++)
+                for (int i = 0; i < mvak; i++)
+                    pT[2*kd+i-j + (size_t)(k0+j)*ldt] =
+                        pTt[k0+i + (size_t)j*n];
+            if (k == 0)
+                continue;
+            // upper trapezoidal T(k, k-1) and T(k-1, k) = T(k, k-1)^T
+            for (int j = 0; j < nb; j++) {
+                for (int i = 0; i <= imin(j, mvak-1); i++) {
+                    float t = pTt[k0+i + (size_t)(nb+j)*n];
+                    pT[2*kd+nb+i-j + (size_t)(k0-nb+j)*ldt] = t;
+                    pT[2*kd-nb+j-i + (size_t)(k0+i)*ldt] = (t);
+                }
+            }
+        }
+        int info = LAPACKE_sgbtrf(LAPACK_COL_MAJOR, n, n, kd, kd,
+                                  pT, ldt, ipiv2);
+        if (info != 0)
+            plasma_request_fail(&sequence, &request,
+                                info > 0 ? info : PlasmaErrorInternal);
+    }
+
+    // Free matrices in tile layout.
+    free(pTt);
+    plasma_desc_destroy(&H);
+    plasma_desc_destroy(&T);
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hetrf
+ *
+ *  Factors a symmetric indefinite matrix, P A P^T = L T L^T, by Aasen's
+ *  algorithm, leaving T in tile layout.
+ *  Non-blocking tile version of plasma_ssytrf().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in,out] A
+ *          Descriptor of the symmetric matrix A, with square tiles.
+ *          On exit, L(nb:n-1, nb:n-1) in A(nb:n-1, 0:n-nb-1).
+ *
+ * @param[out] ipiv
+ *          The pivot indices of P, of size A.n.
+ *
+ * @param[out] T
+ *          Descriptor of an n-by-2*nb matrix. On exit, the diagonal block
+ *          T(k, k) of T in the tile T(k, 0), and the upper triangular
+ *          subdiagonal block T(k, k-1) in the tile T(k, 1).
+ *
+ * @param[out] H
+ *          Descriptor of an n-by-2*nb workspace.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ssytrf
+ * @sa plasma_omp_chetrf
+ * @sa plasma_omp_dsytrf
+ * @sa plasma_omp_ssytrf
+ *
+ ******************************************************************************/
+void plasma_omp_ssytrf(plasma_enum_t uplo, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t T, plasma_desc_t H,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo, only PlasmaLower supported");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m != A.n || A.mb != A.nb) {
+        plasma_error("A not square or tiles not square");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (ipiv == NULL) {
+        plasma_error("NULL ipiv");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess ||
+        T.m != A.m || T.n < 2*A.nb || T.mb != A.mb) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(H) != PlasmaSuccess ||
+        H.m != A.m || H.n < 2*A.nb || H.mb != A.mb) {
+        plasma_error("invalid H");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pssytrf_aasen(A, ipiv, T, H, sequence, request);
+}
@@ -0,0 +1,462 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Applies Q or Q^H of the single precision QR factorization in As and Ts
+// to Bs from the left.
+static void plasma_zcgels_unmqr(plasma_enum_t trans,
+                                plasma_desc_t As, plasma_desc_t Ts,
+                                plasma_desc_t Bs, plasma_workspace_t work,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+
+    if (plasma_householder_mode(plasma, As.mt, As.nt) ==
+        PlasmaTreeHouseholder) {
+        plasma_pcunmqrrh(PlasmaLeft, trans, As, Ts, Bs,
+                         work, sequence, request);
+    }
+    else {
+        plasma_pcunmqr(PlasmaLeft, trans, As, Ts, Bs,
+                       work, sequence, request);
+    }
+}
+
+/******************************************************************************/
+// Solves the least squares problem min || B - A X || by the QR factorization
+// of As, the single precision copy of A, with Fs holding B in single
+// precision, and refinement of the augmented system in double precision,
+// as plasma_zcgels.
+static void plasma_zcgels_refine(plasma_desc_t A,  plasma_desc_t T,
+                                 plasma_desc_t B,  plasma_desc_t X,
+                                 plasma_desc_t As, plasma_desc_t Ts,
+                                 plasma_desc_t R,  plasma_desc_t F,
+                                 plasma_desc_t G,
+                                 plasma_desc_t Fs, plasma_desc_t Gs,
+                                 plasma_workspace_t work,
+                                 plasma_workspace_t works,
+                                 double *dwork, double *norms, int *iter,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t  *request)
+{
+    const int    itermax = 30;
+    const double bwdmax  = 1.0;
+    const plasma_complex64_t zone  =  1.0;
+    const plasma_complex64_t zmone = -1.0;
+    *iter = 0;
+
+    plasma_context_t *plasma = plasma_context_self();
+
+    // the column maxima of the residuals, the iterates and B
+    double *Fnorm = norms;
+    double *Gnorm = &norms[B.n];
+    double *Rnorm = &norms[2*B.n];
+    double *Xnorm = &norms[3*B.n];
+    double *Bnorm = &norms[4*B.n];
+
+    // Workspaces for zgeresid, dzamax and zlange
+    double *workE = dwork;
+    double *workF = &workE[(size_t)F.mt*F.n];
+    double *workG = &workF[(size_t)F.mt*F.n];
+    double *workR = &workG[(size_t)G.mt*G.n];
+    double *workX = &workR[(size_t)R.mt*R.n];
+    double *workB = &workX[(size_t)X.mt*X.n];
+    double *workA = &workB[(size_t)B.mt*B.n];
+
+    double Anorm;
+    double eps = LAPACKE_dlamch_work('E');
+    double cte = eps * sqrt((double)A.m) * bwdmax;
+
+    // the triangular factor of As, and the first n rows of Fs
+    plasma_desc_t Rs  = plasma_desc_view(As, 0, 0, A.n, A.n);
+    plasma_desc_t Fs1 = plasma_desc_view(Fs, 0, 0, A.n, B.n);
+
+    plasma_pzlange(PlasmaFrobeniusNorm, A, workA, &Anorm, sequence, request);
+    plasma_pdzamax(PlasmaColumnwise, B, workB, Bnorm, sequence, request);
+
+    // Solve min || Bs - As * Xs || in single precision.
+    if (plasma_householder_mode(plasma, As.mt, As.nt) ==
+        PlasmaTreeHouseholder) {
+        plasma_pcgeqrfrh(As, Ts, works, sequence, request);
+    }
+    else {
+        plasma_pcgeqrf(As, Ts, works, sequence, request);
+    }
+    plasma_zcgels_unmqr(Plasma_ConjTrans, As, Ts, Fs, works,
+                        sequence, request);
+    plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, Rs, Fs1, sequence, request);
+
+    // Convert Xs to double precision, and start the residual iterate
+    // from R = B - A * X.
+    plasma_pclag2z(Fs1, X, sequence, request);
+    plasma_pzgeresid(A, X, B, R, workE, Rnorm, sequence, request);
+
+    // The updates of the iterates by the corrections in Fs, through G and
+    // F in double precision, X = X + dx and R = R + dr, each in one pass
+    // over the tiles.
+    plasma_zpipeline_t update_x;
+    plasma_zpipeline_t update_r;
+    plasma_zpipeline_init(&update_x);
+    plasma_zpipeline_init(&update_r);
+    if (plasma_zpipeline_clag2z(&update_x, Fs1, G) != PlasmaSuccess ||
+        plasma_zpipeline_geadd(&update_x, PlasmaNoTrans,
+                               zone, G, zone, X) != PlasmaSuccess ||
+        plasma_zpipeline_clag2z(&update_r, Fs, F) != PlasmaSuccess ||
+        plasma_zpipeline_geadd(&update_r, PlasmaNoTrans,
+                               zone, F, zone, R) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Iterative refinement of the augmented system
+    //   [ I    A ] [ R ]   [ B ]
+    //   [ A^H  0 ] [ X ] = [ 0 ].
+    for (int iiter = 0; iiter <= itermax; iiter++) {
+        // F = B - R - A * X, by the fused residual, and G = -A^H * R.
+        plasma_pzgeresid(A, X, B, F, workE, Fnorm, sequence, request);
+        plasma_pzgeadd(PlasmaNoTrans, zmone, R, zone, F, sequence, request);
+        plasma_pzgemm(Plasma_ConjTrans, PlasmaNoTrans,
+                      zmone, A, R, 0.0, G, sequence, request);
+
+        // Check whether the residuals of both block rows satisfy the
+        // stopping criterion for the nrhs right hand sides. The second one
+        // is not relative to |A| |X|, which would accept the solution in
+        // single precision of an ill-conditioned A as it is.
+        // If yes, set iter = iiter and return.
+        plasma_pdzamax(PlasmaColumnwise, F, workF, Fnorm, sequence, request);
+        plasma_pdzamax(PlasmaColumnwise, G, workG, Gnorm, sequence, request);
+        plasma_pdzamax(PlasmaColumnwise, R, workR, Rnorm, sequence, request);
+        plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        #pragma omp taskwait
+        {
+            if (sequence->status != PlasmaSuccess)
+                return;
+
+            int flag = 1;
+            for (int n = 0; n < B.n && flag == 1; n++) {
+                if (!(Fnorm[n] <= (Anorm*Xnorm[n] + Rnorm[n] + Bnorm[n])*cte) ||
+                    !(Gnorm[n] <= Anorm*(Rnorm[n] + Bnorm[n])*cte)) {
+                    flag = 0;
+                }
+            }
+            if (flag == 1) {
+                *iter = iiter;
+                return;
+            }
+        }
+        if (iiter == itermax)
+            break;
+
+        // Convert F and G from double to single precision.
+        plasma_pzlag2c(F, Fs, sequence, request);
+        plasma_pzlag2c(G, Gs, sequence, request);
+
+        // With Q^H F = [ f1; f2 ], the correction solves R^H h = G,
+        // R dx = f1 - h, and dr = Q [ h; f2 ].
+        plasma_zcgels_unmqr(Plasma_ConjTrans, As, Ts, Fs, works,
+                            sequence, request);
+        plasma_pctrsm(PlasmaLeft, PlasmaUpper, Plasma_ConjTrans, PlasmaNonUnit,
+                      1.0, Rs, Gs, sequence, request);
+        plasma_pcgeadd(PlasmaNoTrans, -1.0, Gs, 1.0, Fs1, sequence, request);
+        plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                      1.0, Rs, Fs1, sequence, request);
+        plasma_pzpipeline(update_x, sequence, request);
+
+        plasma_pclacpy(PlasmaGeneral, Gs, Fs1, sequence, request);
+        plasma_zcgels_unmqr(PlasmaNoTrans, As, Ts, Fs, works,
+                            sequence, request);
+        plasma_pzpipeline(update_r, sequence, request);
+    }
+
+    // The refinement did not converge in itermax iterations,
+    // follow up with the double precision routine.
+    *iter = -itermax - 1;
+
+    plasma_pzlacpy(PlasmaGeneral, B, F, sequence, request);
+    plasma_omp_zgels(PlasmaNoTrans, A, T, F, work, sequence, request);
+    plasma_pzlacpy(PlasmaGeneral, plasma_desc_view(F, 0, 0, X.m, X.n), X,
+                   sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gels
+ *
+ *  Solves the overdetermined least squares problem
+ *    \f[ \min_X || B - A X ||_2, \f]
+ *  where A is an m-by-n matrix of full rank n, m >= n, and X and B are
+ *  n-by-nrhs and m-by-nrhs matrices.
+ *
+ *  plasma_zcgels first factorizes the matrix using plasma_cgeqrf and uses
+ *  this factorization within an iterative refinement procedure to produce a
+ *  solution with COMPLEX*16 normwise backward error quality (see below). If
+ *  the approach fails the method falls back to a COMPLEX*16 factorization and
+ *  solve by plasma_zgels.
+ *
+ *  The refinement is that of Bjorck (1967) on the augmented system
+ *    \f[ \begin{bmatrix} I & A \\ A^H & 0 \end{bmatrix}
+ *        \begin{bmatrix} R \\ X \end{bmatrix} =
+ *        \begin{bmatrix} B \\ 0 \end{bmatrix}, \f]
+ *  with the residual R = B - A X as an iterate of its own. The residuals
+ *  of both block rows, F = B - R - A X and G = -A^H R, are computed in
+ *  COMPLEX*16, the first one by the fused residual kernel of plasma_zcgesv,
+ *  and the corrections by the COMPLEX QR factorization A = Q [Rf; 0]:
+ *  with Q^H F = [f1; f2], Rf^H h = G, Rf dX = f1 - h and dR = Q [h; f2].
+ *  Unlike the refinement of the normal equations, it converges as long as
+ *  the condition number of A, not its square, is below the inverse of the
+ *  COMPLEX epsilon, and whatever the size of the residual.
+ *
+ *  The iterative refinement process is stopped if iter > itermax or
+ *  for all the RHS we have:
+ *    Fnorm <= cte*(Anorm*Xnorm + Rnorm + Bnorm) and
+ *    Gnorm <= cte*(Rnorm + Bnorm)*Anorm,
+ *  with cte = sqrt(m)*eps*BWDmax, where:
+ *
+ *  - iter is the number of the current iteration in the iterative refinement
+ *     process
+ *  - Fnorm, Gnorm, Rnorm, Xnorm and Bnorm are the Infinity-norms of
+ *     F, G, R, X and B
+ *  - Anorm is the Frobenius norm of the matrix A
+ *  - eps is the machine epsilon returned by DLAMCH('Epsilon').
+ *  The values itermax and BWDmax are fixed to 30 and 1.0D+00 respectively.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. m >= n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns of the
+ *          matrices B and X. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          The m-by-n matrix A. This matrix remains unchanged.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] pB
+ *          The m-by-nrhs matrix of right hand side matrix B.
+ *          This matrix remains unchanged.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,m).
+ *
+ * @param[out] pX
+ *          If return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldx
+ *          The leading dimension of the array X. ldx >= max(1,n).
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax), where itermax = 30.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dsgels
+ * @sa plasma_zcgesv
+ * @sa plasma_zgels
+ *
+ ******************************************************************************/
+int plasma_zcgels(int m, int n, int nrhs,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pX, int ldx, int *iter)
+{
+    // Get PLASMA context
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0 || n > m) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, m)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+    if (ldx < imax(1, n)) {
+        plasma_error("illegal value of ldx");
+        return -9;
+    }
+
+    // Quick return
+    *iter = 0;
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrices: A, B and X, the iterate R of the residual,
+    // the residuals F and G, and As, Fs and Gs in single precision.
+    plasma_desc_t A, B, X, R, F, G, As, Fs, Gs;
+    plasma_desc_t *desc[] = { &A, &B, &X, &R, &F, &G, &As, &Fs, &Gs };
+    int descm[] = { m, m,    n,    m,    m,    n,    m, m,    n    };
+    int descn[] = { n, nrhs, nrhs, nrhs, nrhs, nrhs, n, nrhs, nrhs };
+    int ndesc = 9;
+    int retval;
+    for (int i = 0; i < ndesc; i++) {
+        retval = plasma_desc_general_create(
+            i < 6 ? PlasmaComplexDouble : PlasmaComplexFloat, nb, nb,
+            descm[i], descn[i], 0, 0, descm[i], descn[i], desc[i]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            for (int j = 0; j < i; j++)
+                plasma_desc_destroy(desc[j]);
+            return retval;
+        }
+    }
+
+    // Prepare descriptors T and Ts, of the fallback in double precision
+    // and of the factorization in single precision.
+    plasma_desc_t T, Ts;
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                         PlasmaColumnwise, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        for (int i = 0; i < ndesc; i++)
+            plasma_desc_destroy(desc[i]);
+        return retval;
+    }
+    retval = plasma_descT_compact_create(As, ib, householder_mode,
+                                         PlasmaColumnwise, &Ts);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        plasma_desc_destroy(&T);
+        for (int i = 0; i < ndesc; i++)
+            plasma_desc_destroy(desc[i]);
+        return retval;
+    }
+
+    // Allocate workspaces.
+    plasma_workspace_t work;
+    plasma_workspace_t works;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    if (retval == PlasmaSuccess) {
+        retval = plasma_workspace_create(&works, lwork, PlasmaComplexFloat);
+        if (retval != PlasmaSuccess)
+            plasma_workspace_destroy(&work);
+    }
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&Ts);
+        plasma_desc_destroy(&T);
+        for (int i = 0; i < ndesc; i++)
+            plasma_desc_destroy(desc[i]);
+        return retval;
+    }
+
+    // Allocate tiled workspace for the residual, the Infinity norms
+    // and the Frobenius norm of A.
+    size_t ldwork = (size_t)2*F.mt*F.n + (size_t)G.mt*G.n + (size_t)R.mt*R.n +
+                    (size_t)X.mt*X.n + (size_t)B.mt*B.n +
+                    (size_t)2*A.mt*A.nt + 2*A.nt;
+    double *dwork = (double*)malloc(ldwork*sizeof(double));
+    double *norms = (double*)malloc((size_t)5*nrhs*sizeof(double));
+    if (dwork == NULL || norms == NULL) {
+        plasma_error("malloc() failed");
+        free(dwork);
+        free(norms);
+        plasma_workspace_destroy(&works);
+        plasma_workspace_destroy(&work);
+        plasma_desc_destroy(&Ts);
+        plasma_desc_destroy(&T);
+        for (int i = 0; i < ndesc; i++)
+            plasma_desc_destroy(desc[i]);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // Asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate matrices to tile layout, converting A and B
+        // to single precision in As and Fs in the same pass.
+        plasma_pzge2desc_lag2c(pA, lda, A, As, &sequence, &request);
+        plasma_pzge2desc_lag2c(pB, ldb, B, Fs, &sequence, &request);
+
+        // Solve with the converted matrices.
+        plasma_zcgels_refine(A, T, B, X, As, Ts, R, F, G, Fs, Gs,
+                             work, works, dwork, norms, iter,
+                             &sequence, &request);
+
+        // Translate back to LAPACK layout
+        plasma_omp_zdesc2ge(X, pX, ldx, &sequence, &request);
+    }
+    // Implicit synchronization
+
+    // Free matrices in tile layout
+    free(dwork);
+    free(norms);
+    plasma_workspace_destroy(&works);
+    plasma_workspace_destroy(&work);
+    plasma_desc_destroy(&Ts);
+    plasma_desc_destroy(&T);
+    for (int i = 0; i < ndesc; i++)
+        plasma_desc_destroy(desc[i]);
+
+    // Return status
+    int status = sequence.status;
+    return status;
+}
@@ -0,0 +1,145 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+/******************************************************************************/
+static void plasma_zpipeline_zlag2c_kernel(const plasma_zpipeline_op_t *op,
+                                           plasma_enum_t uplo, int diag,
+                                           int m, int n,
+                                           void *A, int lda,
+                                           void *B, int ldb)
+{
+    core_zlag2c(m, n, A, lda, B, ldb);
+}
+
+/******************************************************************************/
+static void plasma_zpipeline_clag2z_kernel(const plasma_zpipeline_op_t *op,
+                                           plasma_enum_t uplo, int diag,
+                                           int m, int n,
+                                           void *A, int lda,
+                                           void *B, int ldb)
+{
+    core_clag2z(m, n, A, lda, B, ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records the conversion of A from complex double to complex single
+ *  precision into As, as plasma_omp_zlag2c.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline, see plasma_zpipeline_init.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A, in complex double precision.
+ *
+ * @param[in] As
+ *          Descriptor of matrix As, in complex single precision.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpipeline_clag2z
+ * @sa plasma_dpipeline_dlag2s
+ *
+ ******************************************************************************/
+int plasma_zpipeline_zlag2c(plasma_zpipeline_t *pipeline,
+                            plasma_desc_t A, plasma_desc_t As)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    if (plasma_desc_check(As) != PlasmaSuccess) {
+        plasma_error("invalid As");
+        return -3;
+    }
+
+    plasma_zpipeline_op_t op = {
+        .kernel = plasma_zpipeline_zlag2c_kernel,
+        .uplo = PlasmaGeneral, .transa = PlasmaNoTrans
+    };
+    return plasma_zpipeline_append(pipeline, op, &A, As);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pipeline
+ *
+ *  Records the conversion of As from complex single to complex double
+ *  precision into A, as plasma_omp_clag2z.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] pipeline
+ *          The pipeline, see plasma_zpipeline_init.
+ *
+ * @param[in] As
+ *          Descriptor of matrix As, in complex single precision.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A, in complex double precision.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpipeline_zlag2c
+ * @sa plasma_dpipeline_slag2d
+ *
+ ******************************************************************************/
+int plasma_zpipeline_clag2z(plasma_zpipeline_t *pipeline,
+                            plasma_desc_t As, plasma_desc_t A)
+{
+    // Check input arguments.
+    if (pipeline == NULL) {
+        plasma_error("NULL pipeline");
+        return -1;
+    }
+    if (plasma_desc_check(As) != PlasmaSuccess) {
+        plasma_error("invalid As");
+        return -2;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -3;
+    }
+
+    plasma_zpipeline_op_t op = {
+        .kernel = plasma_zpipeline_clag2z_kernel,
+        .uplo = PlasmaGeneral, .transa = PlasmaNoTrans
+    };
+    return plasma_zpipeline_append(pipeline, op, &As, A);
+}
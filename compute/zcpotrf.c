@@ -0,0 +1,370 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a Hermitian positive definite
+ *  matrix A with each tile in double or single complex precision.
+ *  The factorization has the form
+ *
+ *    \f[ A = L \times L^H, \f]
+ *    or
+ *    \f[ A = U^H \times U, \f]
+ *
+ *  where U is an upper triangular matrix and L is a lower triangular matrix.
+ *
+ *  An off-diagonal tile A_ij is stored, updated and factored in single complex
+ *  precision when
+ *
+ *    \f[ \|A_{ij}\|_F \times nt \times \epsilon_s \le tol \times \|A\|_F, \f]
+ *
+ *  where nt is the number of tile columns and eps_s the single precision
+ *  machine epsilon, so that the factorization keeps a backward error of
+ *  about tol. For matrices whose entries decay away from the diagonal, such
+ *  as covariance matrices, this halves the memory traffic of the far tiles.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the Hermitian positive definite matrix A.
+ *          If uplo = PlasmaUpper, the leading N-by-N upper triangular part of A
+ *          contains the upper triangular part of the matrix A, and the strictly
+ *          lower triangular part of A is not referenced.
+ *          If uplo = PlasmaLower, the leading N-by-N lower triangular part of A
+ *          contains the lower triangular part of the matrix A, and the strictly
+ *          upper triangular part of A is not referenced.
+ *          On exit, if return value = 0, the factor U or L from the Cholesky
+ *          factorization A = U^H*U or A = L*L^H.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] tol
+ *          The backward error targeted, relative to the norm of A.
+ *          tol >= 0. With tol = 0, all tiles are in double precision.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite, so the factorization could not
+ *          be completed, and the solution has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_zcpotrf
+ * @sa plasma_dspotrf
+ * @sa plasma_zpotrf
+ *
+ ******************************************************************************/
+int plasma_zcpotrf(plasma_enum_t uplo,
+                   int n,
+                   plasma_complex64_t *pA, int lda, double tol)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (tol < 0.0) {
+        plasma_error("illegal value of tol");
+        return -5;
+    }
+
+    // quick return
+    if (imax(n, 0) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrix with its tile precisions.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_tile_precision_create(&A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_tile_precision_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Allocate workspaces.
+    plasma_workspace_t work;
+    retval = plasma_workspace_create(&work, (size_t)2*nb*nb,
+                                     PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    double *norms = (double*)malloc((size_t)A.mt*A.nt*sizeof(double));
+    if (norms == NULL) {
+        plasma_error("malloc() failed");
+        plasma_workspace_destroy(&work);
+        plasma_desc_destroy(&A);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zcpotrf(uplo, A, tol, work, norms, &sequence, &request);
+
+        // Bring the tiles in single precision back to double precision.
+        for (int j = 0; j < A.nt; j++) {
+            int nvaj = plasma_tile_nview(A, j);
+            int ifirst = uplo == PlasmaLower ? j+1 : 0;
+            int ilast  = uplo == PlasmaLower ? A.mt-1 : j-1;
+            for (int i = ifirst; i <= ilast; i++) {
+                if (plasma_tile_precision(A, i, j) == PlasmaComplexFloat)
+                    core_omp_clag2z_inplace(
+                        plasma_tile_mview(A, i), nvaj,
+                        A(i, j), plasma_tile_mmain(A, i),
+                        &sequence, &request);
+            }
+        }
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout and the workspaces.
+    plasma_desc_destroy(&A);
+    plasma_workspace_destroy(&work);
+    free(norms);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a Hermitian positive definite
+ *  matrix with each tile in double or single complex precision.
+ *  Non-blocking tile version of plasma_zcpotrf().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  Chooses the precision of each tile of the uplo triangle from its norm,
+ *  converts the tiles chosen for single precision in place and factors A.
+ *  The factor is left in this mixed storage, as tagged in A.tile_precision.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in,out] A
+ *          On entry, the Hermitian positive definite matrix A in double
+ *          complex precision, with the precisions of its tiles allocated
+ *          by plasma_desc_tile_precision_create.
+ *          On exit, if return value = 0, the factor U or L from the Cholesky
+ *          factorization A = U^H*U or A = L*L^H, each tile of the uplo
+ *          triangle in the precision tagged in A.tile_precision.
+ *
+ * @param[in] tol
+ *          The backward error targeted, relative to the norm of A.
+ *          tol >= 0. With tol = 0, all tiles are in double precision.
+ *
+ * @param[in] work
+ *          Workspace of the mixed precision kernels,
+ *          of size 2*mb*nb per thread.
+ *
+ * @param[out] norms
+ *          Workspace of size mt*nt for the norms of the tiles.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zcpotrf
+ * @sa plasma_omp_dspotrf
+ * @sa plasma_omp_zpotrf
+ *
+ ******************************************************************************/
+void plasma_omp_zcpotrf(plasma_enum_t uplo, plasma_desc_t A, double tol,
+                        plasma_workspace_t work, double *norms,
+                        plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess ||
+        A.tile_precision == NULL) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (tol < 0.0) {
+        plasma_error("illegal value of tol");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0)
+        return;
+
+    // Compute the norms of the tiles of the uplo triangle.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        int mfirst = uplo == PlasmaLower ? n : 0;
+        int mlast  = uplo == PlasmaLower ? A.mt-1 : n;
+        for (int m = mfirst; m <= mlast; m++) {
+            core_omp_zlange(PlasmaFrobeniusNorm,
+                            plasma_tile_mview(A, m), nvan,
+                            A(m, n), plasma_tile_mmain(A, m),
+                            NULL, &norms[m+(size_t)A.mt*n],
+                            sequence, request);
+        }
+    }
+    #pragma omp taskwait
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // The off-diagonal tiles count twice in the norm of A.
+    double sumsq = 0.0;
+    for (int n = 0; n < A.nt; n++) {
+        int mfirst = uplo == PlasmaLower ? n : 0;
+        int mlast  = uplo == PlasmaLower ? A.mt-1 : n;
+        for (int m = mfirst; m <= mlast; m++) {
+            double norm = norms[m+(size_t)A.mt*n];
+            sumsq += m == n ? norm*norm : 2.0*norm*norm;
+        }
+    }
+    double Anorm = sqrt(sumsq);
+    double eps = LAPACKE_slamch_work('E');
+
+    // Tag the tiles and convert the ones in single precision in place.
+    for (int n = 0; n < A.nt; n++) {
+        int nvan = plasma_tile_nview(A, n);
+        int mfirst = uplo == PlasmaLower ? n : 0;
+        int mlast  = uplo == PlasmaLower ? A.mt-1 : n;
+        for (int m = mfirst; m <= mlast; m++) {
+            size_t mn = (m + A.i/A.mb) + (size_t)A.gmt*(n + A.j/A.nb);
+            if (m != n && norms[m+(size_t)A.mt*n]*A.nt*eps <= tol*Anorm) {
+                A.tile_precision[mn] = PlasmaComplexFloat;
+                core_omp_zlag2c_inplace(
+                    plasma_tile_mview(A, m), nvan,
+                    A(m, n), plasma_tile_mmain(A, m),
+                    sequence, request);
+            }
+            else {
+                A.tile_precision[mn] = PlasmaComplexDouble;
+            }
+        }
+    }
+
+    // Call the parallel function.
+    plasma_pzcpotrf(uplo, A, work, sequence, request);
+}
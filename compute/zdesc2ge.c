@@ -21,7 +21,7 @@
     @ingroup plasma_ccrb2cm
 
     Convert tiled (CCRB) to column-major (CM) matrix layout.
-    Out-of-place.
+    Out-of-place. Unpacks the tiles of a packed A.
 */
 void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
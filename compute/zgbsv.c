@@ -18,6 +18,8 @@
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <stdlib.h>
+
 #include "mkl_lapacke.h"
 
 /***************************************************************************//**
@@ -27,6 +29,11 @@
  * Computes the solution to a system of linear equations A * X = B,
  * using the LU factorization computed by plasma_zgbtrf.
  *
+ * A tridiagonal matrix, kl = ku = 1, is factored in compact storage by
+ * LAPACK zgttrf, instead of in tiles of the band. Its LU factorization with
+ * partial pivoting is that of zgbtrf, with the fill of the pivoting in a
+ * second superdiagonal of U, so AB and ipiv are filled as by zgbtrf.
+ *
  *******************************************************************************
  *
  * @param[in] n
@@ -102,6 +109,47 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
     if (imin(n, nrhs) == 0)
        return PlasmaSuccess;
 
+    // tridiagonal fast path
+    if (kl == 1 && ku == 1 && ldab >= 2*kl+ku+1) {
+        plasma_complex64_t *work = (plasma_complex64_t*)malloc(
+            4*(size_t)n*sizeof(plasma_complex64_t));
+        if (work == NULL) {
+            plasma_error("malloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        plasma_complex64_t *dl  = work;
+        plasma_complex64_t *d   = &work[n-1];
+        plasma_complex64_t *du  = &work[2*n-1];
+        plasma_complex64_t *du2 = &work[3*n-2];
+        // A(i, j) is in row kl+ku+i-j of AB.
+        for (int j = 0; j < n; j++) {
+            d[j] = pAB[2 + (size_t)ldab*j];
+            if (j < n-1) {
+                dl[j] = pAB[3 + (size_t)ldab*j];
+                du[j] = pAB[1 + (size_t)ldab*(j+1)];
+            }
+        }
+        int info = LAPACKE_zgttrf_work(n, dl, d, du, du2, ipiv);
+
+        // U(i, j) is in row kl+ku+i-j of AB, the multipliers of column j
+        // in row kl+ku+1.
+        for (int j = 0; j < n; j++) {
+            pAB[2 + (size_t)ldab*j] = d[j];
+            if (j > 0)
+                pAB[1 + (size_t)ldab*j] = du[j-1];
+            if (j > 1)
+                pAB[(size_t)ldab*j] = du2[j-2];
+            if (j < n-1)
+                pAB[3 + (size_t)ldab*j] = dl[j];
+        }
+        if (info == 0) {
+            LAPACKE_zgttrs_work(LAPACK_COL_MAJOR, 'N', n, nrhs,
+                                dl, d, du, du2, ipiv, pB, ldb);
+        }
+        free(work);
+        return info;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -132,38 +180,36 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zpb2desc(pAB, ldab, AB, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Call the tile async function.
-        plasma_omp_zgbsv(AB, ipiv, B, sequence, &request);
+        plasma_omp_zgbsv(AB, ipiv, B, &sequence, &request);
     }
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2pb(AB, pAB, ldab, sequence, &request);
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_zdesc2pb(AB, pAB, ldab, &sequence, &request);
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
     }
 
     // Free matrices  in tile layout.
@@ -171,8 +217,7 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
     plasma_desc_destroy(&AB);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
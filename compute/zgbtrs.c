@@ -152,30 +152,26 @@ int plasma_zgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zpb2desc(pAB, ldab, AB, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_zgbtrs(trans, AB, ipiv, B, sequence, &request);
+        plasma_omp_zgbtrs(trans, AB, ipiv, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -184,8 +180,7 @@ int plasma_zgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -21,7 +21,7 @@
     @ingroup plasma_cm2ccrb
 
     Convert column-major (CM) to tiled (CCRB) matrix layout.
-    Out-of-place.
+    Out-of-place. Packs the tiles of a packed A.
 */
 void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
                          plasma_desc_t A,
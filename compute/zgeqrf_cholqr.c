@@ -0,0 +1,360 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+#define G(m, n) (plasma_complex64_t*)plasma_tile_addr(G, m, n)
+
+// the factor of 1/sqrt(n*eps) bounding the condition number estimate
+// of the fast path, below which the Gram matrix keeps enough digits
+// for the second pass to restore the orthogonality
+#define PLASMA_CHOLQR_COND_FACTOR 0.1
+
+/******************************************************************************/
+// G = A^H A = R^H R, with the inner dimension split in parts for splits > 1.
+static void plasma_zgeqrf_cholqr_pass(plasma_desc_t A, plasma_desc_t G,
+                                      plasma_desc_t *W, int splits,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    if (splits > 1)
+        plasma_pzherk_splitk(PlasmaUpper, Plasma_ConjTrans,
+                             1.0, A,
+                             0.0, G,
+                             W, splits,
+                             sequence, request);
+    else
+        plasma_omp_zherk(PlasmaUpper, Plasma_ConjTrans,
+                         1.0, A,
+                         0.0, G,
+                         sequence, request);
+
+    plasma_omp_zpotrf(PlasmaUpper, G, sequence, request);
+}
+
+/******************************************************************************/
+// The ratio of the largest to the smallest diagonal entry of the triangular
+// factor R in G, a lower bound of the condition number of R and A.
+static double plasma_zgeqrf_cholqr_cond(plasma_desc_t G)
+{
+    double dmax = 0.0;
+    double dmin = 0.0;
+    for (int i = 0; i < G.n; i++) {
+        int k = i/G.nb;
+        int ldgk = plasma_tile_mmain(G, k);
+        plasma_complex64_t *Gkk = G(k, k);
+        double d = cabs(Gkk[(size_t)ldgk*(i%G.nb)+i%G.mb]);
+        if (i == 0 || d > dmax)
+            dmax = d;
+        if (i == 0 || d < dmin)
+            dmin = d;
+    }
+    return dmin > 0.0 ? dmax/dmin : INFINITY;
+}
+
+/******************************************************************************/
+// The Householder QR factorization of A, with Q formed explicitly,
+// translated back to pA and pR.
+static int plasma_zgeqrf_cholqr_householder(
+    plasma_context_t *plasma, plasma_desc_t A, plasma_desc_t R,
+    plasma_complex64_t *pA, int lda, plasma_complex64_t *pR, int ldr,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    plasma_desc_t Q;
+    int retval;
+    retval = plasma_desc_general_zero_create(PlasmaComplexDouble, nb, nb,
+                                             A.m, A.n, 0, 0, A.m, A.n, &Q);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_zero_create() failed");
+        return retval;
+    }
+
+    // Prepare descriptor T.
+    plasma_desc_t T;
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                         PlasmaColumnwise, &T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        plasma_desc_destroy(&Q);
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // geqrt: tau + work, unmqr: work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        plasma_desc_destroy(&Q);
+        plasma_desc_destroy(&T);
+        return retval;
+    }
+
+    plasma_desc_t Ar = plasma_desc_view(A, 0, 0, A.n, A.n);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgeqrf(A, T, work, sequence, request);
+        plasma_omp_zlaset(PlasmaGeneral, 0.0, 0.0, R, sequence, request);
+        plasma_omp_zlacpy(PlasmaUpper, Ar, R, sequence, request);
+        plasma_omp_zungqr(A, T, Q, work, sequence, request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(Q, pA, lda, sequence, request);
+        plasma_omp_zdesc2ge(R, pR, ldr, sequence, request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+    plasma_desc_destroy(&Q);
+    plasma_desc_destroy(&T);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes the QR factorization of a tall and skinny m-by-n matrix A,
+ *  m >= n, with the orthonormal factor Q formed explicitly,
+ *    \f[ A = Q R, \f]
+ *  by the Cholesky QR algorithm applied twice (CholeskyQR2).
+ *
+ *  Each pass forms the Gram matrix A^H A by a Hermitian rank-k update,
+ *  with the rows of A split in parts updating copies of the Gram matrix
+ *  when it has fewer tiles than threads, factors it as R^H R and
+ *  overwrites A with A R^{-1}. The second pass, on the output of the
+ *  first, restores the orthogonality of Q lost to the squared condition
+ *  number of the Gram matrix, and R is the product of the two factors.
+ *  These are all level 3 tile operations, and the Gram matrix is only
+ *  n-by-n, so that for m >> n the routine runs at the speed of the
+ *  rank-k update, well above that of the Householder panels.
+ *
+ *  The first Cholesky factor gives a lower bound of the condition number
+ *  of A, the ratio of its largest to smallest diagonal entry. If the
+ *  Gram matrix is not positive definite, or the bound exceeds
+ *  0.1/sqrt(n*eps), the routine falls back to the Householder QR
+ *  factorization of A by plasma_zgeqrf() and plasma_zungqr(), and the
+ *  diagonal of R may then have entries of any sign.
+ *
+ *  The arrays are column-major, whatever the PlasmaArrayLayout setting.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. 0 <= n <= m.
+ *
+ * @param[in,out] pA
+ *          On entry, the m-by-n matrix A.
+ *          On exit, the m-by-n matrix Q of orthonormal columns.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] pR
+ *          On exit, the n-by-n upper triangular factor R, with zeros below
+ *          the diagonal.
+ *
+ * @param[in] ldr
+ *          The leading dimension of the array R. ldr >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgeqrf
+ * @sa plasma_zungqr
+ * @sa plasma_cgeqrf_cholqr
+ * @sa plasma_dgeqrf_cholqr
+ * @sa plasma_sgeqrf_cholqr
+ *
+ ******************************************************************************/
+int plasma_zgeqrf_cholqr(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_complex64_t *pR, int ldr)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0 || n > m) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldr < imax(1, n)) {
+        plasma_error("illegal value of ldr");
+        return -6;
+    }
+
+    // quick return
+    if (n == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Parts of the rows of A in the rank-k updates, 1 for no split.
+    int nt = (n+nb-1)/nb;
+    int splits = plasma_gemm_splits(plasma, nt, nt, (m+nb-1)/nb);
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t G;
+    plasma_desc_t R;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &G);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_zero_create(PlasmaComplexDouble, nb, nb,
+                                             n, n, 0, 0, n, n, &R);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_zero_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&G);
+        return retval;
+    }
+
+    // Create the copies of G of the split rows of A.
+    plasma_desc_t W[PlasmaGemmMaxSplits];
+    for (int g = 0; g < splits-1; g++) {
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, n, 0, 0, n, n, &W[g]);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            for (int i = 0; i < g; i++)
+                plasma_desc_destroy(&W[i]);
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&G);
+            plasma_desc_destroy(&R);
+            return retval;
+        }
+    }
+
+    // Initialize sequences.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+    plasma_sequence_t cholesky = PlasmaSequenceInitializer;
+
+    // Initialize requests.
+    plasma_request_t request = PlasmaRequestInitializer;
+    plasma_request_t cholesky_request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+
+        // first pass, in a sequence of its own, as the Gram matrix
+        // is not positive definite for A rank deficient
+        plasma_zgeqrf_cholqr_pass(A, G, W, splits,
+                                  &cholesky, &cholesky_request);
+    }
+    // implicit synchronization
+
+    double eps = LAPACKE_dlamch_work('e');
+    double maxcond = PLASMA_CHOLQR_COND_FACTOR/sqrt(n*eps);
+    if (sequence.status == PlasmaSuccess &&
+        cholesky.status == PlasmaSuccess &&
+        plasma_zgeqrf_cholqr_cond(G) <= maxcond) {
+        // asynchronous block
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            // A = Q_1 R_1
+            plasma_omp_zlaset(PlasmaGeneral, 0.0, 0.0, R,
+                              &sequence, &request);
+            plasma_omp_zlacpy(PlasmaUpper, G, R, &sequence, &request);
+            plasma_omp_ztrsm(PlasmaRight, PlasmaUpper,
+                             PlasmaNoTrans, PlasmaNonUnit,
+                             1.0, G, A, &sequence, &request);
+
+            // Q_1 = Q R_2, R = R_2 R_1
+            plasma_zgeqrf_cholqr_pass(A, G, W, splits,
+                                      &sequence, &request);
+            plasma_omp_ztrsm(PlasmaRight, PlasmaUpper,
+                             PlasmaNoTrans, PlasmaNonUnit,
+                             1.0, G, A, &sequence, &request);
+            plasma_omp_ztrmm(PlasmaLeft, PlasmaUpper,
+                             PlasmaNoTrans, PlasmaNonUnit,
+                             1.0, G, R, &sequence, &request);
+
+            // Translate back to LAPACK layout.
+            plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+            plasma_omp_zdesc2ge(R, pR, ldr, &sequence, &request);
+        }
+        // implicit synchronization
+    }
+    else if (sequence.status == PlasmaSuccess) {
+        retval = plasma_zgeqrf_cholqr_householder(plasma, A, R,
+                                                  pA, lda, pR, ldr,
+                                                  &sequence, &request);
+        if (retval != PlasmaSuccess)
+            plasma_request_fail(&sequence, &request, retval);
+    }
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&G);
+    plasma_desc_destroy(&R);
+    for (int g = 0; g < splits-1; g++)
+        plasma_desc_destroy(&W[g]);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
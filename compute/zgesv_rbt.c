@@ -0,0 +1,510 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <omp.h>
+
+// depth of the recursive butterflies
+#define RBT_DEPTH 2
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Computes the solution to a system of linear equations A * X = B, where A is
+ *  an n-by-n matrix and X and B are n-by-nrhs matrices, without pivoting.
+ *
+ *  plasma_zgesv_rbt transforms the matrix by recursive random butterflies,
+ *
+ *    Ar = U^T * A * V,
+ *
+ *  of depth 2, with random values close to 1, which makes the LU factorization
+ *  of Ar without pivoting stable with a high probability. The factorization
+ *  of Ar is then fully tile-parallel, like the Cholesky factorization, with no
+ *  panel spanning a tile column. The solution X = V * Ar^{-1} * U^T * B is
+ *  improved by iterative refinement on A, stopped as in plasma_zcgesv when
+ *  for all the RHS: Rnorm < sqrt(n)*Xnorm*Anorm*eps*BWDmax, with itermax = 30
+ *  and BWDmax = 1.0. If the refinement does not converge, the system is
+ *  solved by the LU factorization with partial pivoting.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The number of linear equations, i.e., the order of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns of the
+ *          matrix B. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          The n-by-n matrix A.
+ *          This matrix remains unchanged.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] pB
+ *          The n-by-nrhs matrix of right hand side matrix B.
+ *          This matrix remains unchanged.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[out] pX
+ *          If return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldx
+ *          The leading dimension of the array X. ldx >= max(1,n).
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax), where itermax = 30.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the i-th pivot of the transformed matrix is exactly zero.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_zgesv_rbt
+ * @sa plasma_cgesv_rbt
+ * @sa plasma_dgesv_rbt
+ * @sa plasma_sgesv_rbt
+ * @sa plasma_zgesv
+ * @sa plasma_zcgesv
+ *
+ ******************************************************************************/
+int plasma_zgesv_rbt(int n, int nrhs,
+                     plasma_complex64_t *pA, int lda,
+                     plasma_complex64_t *pB, int ldb,
+                     plasma_complex64_t *pX, int ldx, int *iter)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -6;
+    }
+    if (ldx < imax(1, n)) {
+        plasma_error("illegal value of ldx");
+        return -8;
+    }
+
+    // quick return
+    *iter = 0;
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A, B, X, Ar, R;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &X);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &Ar);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &R);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Ar);
+        return retval;
+    }
+
+    // Allocate the butterflies, the pivots of the fallback
+    // and the workspaces of the norms.
+    size_t lwork = szmax((size_t)A.nt*A.n+A.n,
+                        (size_t)X.mt*X.n+(size_t)R.mt*R.n);
+    double *U     = (double*)malloc((size_t)2*RBT_DEPTH*n*sizeof(double));
+    int    *ipiv  = (int*)malloc((size_t)n*sizeof(int));
+    double *work  = (double*)malloc(lwork*sizeof(double));
+    double *Rnorm = (double*)malloc((size_t)R.n*sizeof(double));
+    double *Xnorm = (double*)malloc((size_t)X.n*sizeof(double));
+    if (U == NULL || ipiv == NULL || work == NULL ||
+        Rnorm == NULL || Xnorm == NULL) {
+        plasma_error("malloc() failed");
+        free(U);
+        free(ipiv);
+        free(work);
+        free(Rnorm);
+        free(Xnorm);
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&X);
+        plasma_desc_destroy(&Ar);
+        plasma_desc_destroy(&R);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // Initialize barrier, for the panels of the fallback.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zgesv_rbt(A, B, X, Ar, R, U, &U[RBT_DEPTH*n], ipiv,
+                             work, Rnorm, Xnorm, iter,
+                             &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(X, pX, ldx, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&X);
+    plasma_desc_destroy(&Ar);
+    plasma_desc_destroy(&R);
+    free(U);
+    free(ipiv);
+    free(work);
+    free(Rnorm);
+    free(Xnorm);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/******************************************************************************/
+// Solves Ar * Y = U^T * X and overwrites X by V * Y.
+static void plasma_zgesv_rbt_solve(plasma_desc_t Ar,
+                                   const double *U, const double *V,
+                                   plasma_desc_t X,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    plasma_pzgerbt(PlasmaLeft, Plasma_ConjTrans, U, RBT_DEPTH, X,
+                   sequence, request);
+
+    plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, Ar, X, sequence, request);
+
+    plasma_pztrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, Ar, X, sequence, request);
+
+    plasma_pzgerbt(PlasmaLeft, PlasmaNoTrans, V, RBT_DEPTH, X,
+                   sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Solves a general linear system of equations by the random butterfly
+ *  transformation, the LU factorization without pivoting and iterative
+ *  refinement.
+ *  Non-blocking tile version of plasma_zgesv_rbt().
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *          Descriptor of matrix A, of square tiles.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[in,out] X
+ *          Descriptor of matrix X.
+ *
+ * @param[out] Ar
+ *          Descriptor of the auxiliary matrix of the transformed A,
+ *          with the tiles of A.
+ *
+ * @param[out] R
+ *          Descriptor of auxiliary remainder matrix R.
+ *
+ * @param[out] U
+ *          The random values of the butterflies on the left, of size 2*A.n,
+ *          generated here.
+ *
+ * @param[out] V
+ *          The random values of the butterflies on the right, of size 2*A.n,
+ *          generated here.
+ *
+ * @param[out] ipiv
+ *          The pivot indices of the fallback to partial pivoting, of size A.n.
+ *
+ * @param[out] work
+ *          Workspace needed to compute infinity norm of the matrix A.
+ *
+ * @param[out] Rnorm
+ *          Workspace needed to store the max value in each of resudual vectors.
+ *
+ * @param[out] Xnorm
+ *          Workspace needed to store the max value in each of currenct solution
+ *          vectors.
+ *
+ * @param[out] iter
+ *          The number of the iterations in the iterative refinement
+ *          process, needed for the convergence. If failed, it is set
+ *          to be -(1+itermax), where itermax = 30.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgesv_rbt
+ * @sa plasma_omp_cgesv_rbt
+ * @sa plasma_omp_dgesv_rbt
+ * @sa plasma_omp_sgesv_rbt
+ * @sa plasma_omp_zcgesv
+ *
+ ******************************************************************************/
+void plasma_omp_zgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          double *U, double *V, int *ipiv,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    const int    itermax = 30;
+    const double bwdmax  = 1.0;
+    const plasma_complex64_t zone = 1.0;
+    *iter = 0;
+
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess || A.mb != A.nb) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(X) != PlasmaSuccess) {
+        plasma_error("invalid X");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(Ar) != PlasmaSuccess) {
+        plasma_error("invalid Ar");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(R) != PlasmaSuccess) {
+        plasma_error("invalid R");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (U == NULL || V == NULL || ipiv == NULL) {
+        plasma_error("NULL workspace");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Generate the butterflies, with values in (e^{-1/20}, e^{1/20}).
+    int seed[] = {0, 0, 0, 1};
+    LAPACKE_dlarnv_work(2, seed, (size_t)RBT_DEPTH*A.n, U);
+    LAPACKE_dlarnv_work(2, seed, (size_t)RBT_DEPTH*A.n, V);
+    for (size_t i = 0; i < (size_t)RBT_DEPTH*A.n; i++) {
+        U[i] = exp(U[i]/20.0);
+        V[i] = exp(V[i]/20.0);
+    }
+
+    // Workspaces for dzamax
+    double *workX = work;
+    double *workR = &work[X.mt*X.n];
+
+    // Compute some constants.
+    double eps = LAPACKE_dlamch_work('E');
+    double Anorm;
+    plasma_pzlange(PlasmaInfNorm, A, work, &Anorm, sequence, request);
+
+    // Transform and factor A without pivoting.
+    plasma_pzlacpy(PlasmaGeneral, A, Ar, sequence, request);
+    plasma_pzgerbt(PlasmaLeft, Plasma_ConjTrans, U, RBT_DEPTH, Ar,
+                   sequence, request);
+    plasma_pzgerbt(PlasmaRight, PlasmaNoTrans, V, RBT_DEPTH, Ar,
+                   sequence, request);
+    plasma_pzgetrf_nopiv(Ar, sequence, request);
+
+    // Solve the system A * X = B.
+    plasma_pzlacpy(PlasmaGeneral, B, X, sequence, request);
+    plasma_zgesv_rbt_solve(Ar, U, V, X, sequence, request);
+
+    // Iterative refinement
+    for (int iiter = 0; iiter <= itermax; iiter++) {
+        // Compute R = B - A * X and its norm.
+        plasma_pzgeresid(A, X, B, R, workR, Rnorm, sequence, request);
+
+        // Check whether the nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter = iiter and return.
+        plasma_pdzamax(PlasmaColumnwise, X, workX, Xnorm, sequence, request);
+        #pragma omp taskwait
+        if (sequence->status != PlasmaSuccess)
+            return;
+
+        double cte = Anorm * eps * sqrt((double)A.n) * bwdmax;
+        int flag = 1;
+        for (int n = 0; n < R.n && flag == 1; n++) {
+            if (Rnorm[n] > Xnorm[n] * cte) {
+                flag = 0;
+            }
+        }
+        if (flag == 1) {
+            *iter = iiter;
+            return;
+        }
+        if (iiter == itermax)
+            break;
+
+        // Solve the system A * D = R and update the current iterate.
+        plasma_zgesv_rbt_solve(Ar, U, V, R, sequence, request);
+        plasma_pzgeadd(PlasmaNoTrans, zone, R, zone, X, sequence, request);
+    }
+
+    // If we are at this place of the code, this is because we have performed
+    // iter = itermax iterations and never satisfied the stopping criterion,
+    // set up the iter flag accordingly and follow up with partial pivoting.
+    *iter = -itermax - 1;
+
+    // Compute LU factorization of A.
+    plasma_pzlacpy(PlasmaGeneral, A, Ar, sequence, request);
+    #pragma omp taskwait
+    plasma_pzgetrf(Ar, ipiv, sequence, request);
+
+    // Solve the system A * X = B.
+    plasma_pzlacpy(PlasmaGeneral, B, X, sequence, request);
+
+    #pragma omp taskwait
+    if (plasma->left_pivoting == PlasmaLeftPivotingOn) {
+        plasma_pzlaswp(PlasmaRowwise, X, ipiv, 1, sequence, request);
+
+        plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                      1.0, Ar, X, sequence, request);
+    }
+    else {
+        plasma_pzlaswp_trsm(Ar, ipiv, X, sequence, request);
+    }
+
+    plasma_pztrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, Ar, X, sequence, request);
+}
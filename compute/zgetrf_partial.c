@@ -0,0 +1,293 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Performs the partial LU factorization of a general m-by-n matrix A, as
+ *  the frontal matrices of the sparse direct solvers,
+ *
+ *    \f[ \begin{pmatrix} P & 0 \\ 0 & I \end{pmatrix} A =
+ *        \begin{pmatrix} L_{11} & 0 \\ L_{21} & I \end{pmatrix}
+ *        \begin{pmatrix} U_{11} & U_{12} \\ 0 & S \end{pmatrix}, \f]
+ *
+ *  where A_11 is the leading k-by-k block, factored with partial pivoting
+ *  by rows within A_11 only, and A_22 is replaced by its Schur complement
+ *  S = A_22 - L_21 U_12, which is neither pivoted into nor factored.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The order of the block A_11 factored, a multiple of the tile
+ *          size, or m = n. 0 <= k <= min(m,n).
+ *
+ * @param[in,out] pA
+ *          On entry, the m-by-n matrix A.
+ *          On exit, if return value = 0, the factors L_11 and U_11 of A_11,
+ *          as by plasma_zgetrf, L_21, U_12 and the Schur complement S.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of dimension k; for 1 <= i <= k, row i of A
+ *          was interchanged with row ipiv(i) <= k.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, U(i,i) is exactly zero, and U_11 is singular.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_zgetrf_partial
+ * @sa plasma_cgetrf_partial
+ * @sa plasma_dgetrf_partial
+ * @sa plasma_sgetrf_partial
+ * @sa plasma_zgetrf
+ *
+ ******************************************************************************/
+int plasma_zgetrf_partial(int m, int n, int k,
+                          plasma_complex64_t *pA, int lda, int *ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0 || k > imin(m, n) || (k%nb != 0 && (k != m || k != n))) {
+        plasma_error("illegal value of k");
+        return -3;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+
+    // quick return
+    if (k == 0)
+        return PlasmaSuccess;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->num_panel_threads);
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_lapack_create(PlasmaComplexDouble, pA, lda, nb, nb,
+                                       m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_lapack_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+
+        // The panels of A_11 are keyed on a few tiles of their columns only.
+        #pragma omp taskwait
+
+        // Call the tile async function.
+        plasma_omp_zgetrf_partial(k, A, ipiv, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Performs the partial LU factorization of a general matrix.
+ *  Non-blocking tile version of plasma_zgetrf_partial().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  The factorization of A_11, the solves for U_12 and L_21 and the update
+ *  of the Schur complement run in one call, so that a frontal matrix
+ *  assembled in tile layout is factored, and its Schur complement passed
+ *  on in tile layout, without translations. The pivots of A_11 are
+ *  applied to U_12 as by plasma_zgetrs, after the factorization of A_11,
+ *  which the call waits for, as plasma_zgesv does.
+ *
+ *******************************************************************************
+ *
+ * @param[in] k
+ *          The order of the block A_11 factored, a multiple of the tile
+ *          size, or A.m = A.n. 0 <= k <= min(A.m,A.n).
+ *
+ * @param[in,out] A
+ *          On entry, the matrix A.
+ *          On exit, the factors L_11 and U_11 of A_11, as by
+ *          plasma_omp_zgetrf, L_21, U_12 and the Schur complement S.
+ *
+ * @param[out] ipiv
+ *          The pivot indices of A_11, of dimension k.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf_partial
+ * @sa plasma_omp_cgetrf_partial
+ * @sa plasma_omp_dgetrf_partial
+ * @sa plasma_omp_sgetrf_partial
+ * @sa plasma_omp_zgetrf
+ *
+ ******************************************************************************/
+void plasma_omp_zgetrf_partial(int k, plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (k < 0 || k > imin(A.m, A.n) ||
+        ((k%A.mb != 0 || k%A.nb != 0) && (k != A.m || k != A.n))) {
+        plasma_error("illegal value of k");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (k == 0)
+        return;
+
+    // Call the parallel functions.
+    plasma_desc_t A11 = plasma_desc_view(A, 0, 0, k, k);
+    plasma_pzgetrf(A11, ipiv, sequence, request);
+
+    // The solves depend on all the pivots and the left pivoting of L.
+    #pragma omp taskwait
+
+    if (A.n > k) {
+        plasma_desc_t A12 = plasma_desc_view(A, 0, k, k, A.n-k);
+        if (plasma->left_pivoting == PlasmaLeftPivotingOn) {
+            plasma_pzlaswp(PlasmaRowwise, A12, ipiv, 1, sequence, request);
+
+            plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                          1.0, A11,
+                               A12,
+                          sequence, request);
+        }
+        else {
+            // The pivots are applied block by block, as L is not pivoted.
+            plasma_pzlaswp_trsm(A11, ipiv, A12, sequence, request);
+
+            // The solve is keyed on a few tiles of each column of U_12 only.
+            #pragma omp taskwait
+        }
+    }
+    if (A.m > k) {
+        plasma_desc_t A21 = plasma_desc_view(A, k, 0, A.m-k, k);
+        plasma_pztrsm(PlasmaRight, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                      1.0, A11,
+                           A21,
+                      sequence, request);
+        if (A.n > k) {
+            plasma_desc_t A12 = plasma_desc_view(A, 0, k, k, A.n-k);
+            plasma_desc_t A22 = plasma_desc_view(A, k, k, A.m-k, A.n-k);
+            plasma_pzgemm(PlasmaNoTrans, PlasmaNoTrans,
+                          -1.0, A21,
+                                A12,
+                           1.0, A22,
+                          sequence, request);
+        }
+    }
+}
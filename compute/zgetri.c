@@ -25,6 +25,12 @@
  *  Computes the inverse of a matrix A using the LU factorization computed
  *  by plasma_zgetrf.
  *
+ *  By default, U is inverted first, and the product of the inverses of U
+ *  and L is formed after. With PlasmaGetriVariant set to
+ *  PlasmaGaussJordanGetri, the inverse is formed in one Gauss-Jordan sweep
+ *  over the tiles instead: the same flops, but each step only waits for
+ *  its own tile row and tile column, which gives more tasks in flight.
+ *
  *******************************************************************************
  *
  * @param[in] n
@@ -81,7 +87,6 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
 
     // Create tile matrix.
     plasma_desc_t A;
-    plasma_desc_t W;
     int retval;
     retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
                                         n, n, 0, 0, n, n, &A);
@@ -89,47 +94,34 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nb, 0, 0, n, nb, &W);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        return retval;
-    }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // Asynchronous block.
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
 
         // Perform computation.
-        plasma_omp_zgetri(A, ipiv, W, sequence, &request);
+        plasma_omp_zgetri(A, ipiv, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
+        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
     }
     // Implicit synchronization.
 
     // Free matrices in tile layout.
-    plasma_desc_destroy(&W);
     plasma_desc_destroy(&A);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -151,9 +143,6 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
  * @param[in] ipiv
  *          The pivot indices computed by plasma_zgetrf.
  *
- * @param[out] W
- *          Workspace of dimension (n, nb)
- *
  * @param[in] sequence
  *          Identifies the sequence of function calls that this call belongs to
  *          (for completion checks and exception handling purposes).  Check
@@ -178,7 +167,7 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
  * @sa plasma_omp_sgetri
  *
  ******************************************************************************/
-void plasma_omp_zgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
+void plasma_omp_zgetri(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request)
 {
     // Get PLASMA context.
@@ -195,11 +184,6 @@ void plasma_omp_zgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
         return;
     }
-    if (plasma_desc_check(W) != PlasmaSuccess) {
-        plasma_error("invalid W");
-        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
-        return;
-    }
     if (sequence == NULL) {
         plasma_error("NULL sequence");
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
@@ -215,13 +199,27 @@ void plasma_omp_zgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
     if (A.n == 0)
         return;
 
-    // Invert triangular part.
-    plasma_pztrtri(PlasmaUpper, PlasmaNonUnit, A, sequence, request);
+    // Pivot L to the left, if plasma_zgetrf left it to the solvers.
+    // The tasks of the tile columns are not keyed on all their tiles.
+    if (plasma->left_pivoting == PlasmaLeftPivotingOff) {
+        #pragma omp taskwait
+        plasma_pzgetrf_left(A, ipiv, sequence, request);
+        #pragma omp taskwait
+    }
+
+    if (plasma->getri_variant == PlasmaGaussJordanGetri) {
+        // Invert in one sweep.
+        plasma_pzgetri_gj(A, sequence, request);
+    }
+    else {
+        // Invert triangular part.
+        plasma_pztrtri(PlasmaUpper, PlasmaNonUnit, A, sequence, request);
 
-    // Compute product of inverse of the upper and lower triangles.
-    plasma_pzgetri_aux(A, W, sequence, request);
+        // Compute product of inverse of the upper and lower triangles.
+        // The inversion of L runs in the same task graph as the one of U.
+        plasma_pzgetri_aux(A, sequence, request);
+    }
 
-    // Apply pivot.
-    #pragma omp taskwait
+    // Apply pivot. The column interchanges wait for the product.
     plasma_pzlaswp(PlasmaColumnwise, A, ipiv, -1, sequence, request);
 }
@@ -0,0 +1,219 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_hetrs
+ *
+ *  Solves a system of linear equations A X = B with a Hermitian matrix A
+ *  factored by plasma_zhetrf, P A P^T = L T L^H, T = P2 L2 U2.
+ *
+ *  The solves with L and L^H are tile parallel; the band solve with T is
+ *  done by LAPACKE_zgbtrs.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *          Only PlasmaLower is supported.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrix B. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          The factor L, as computed by plasma_zhetrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] ipiv
+ *          The pivot indices of P, as computed by plasma_zhetrf.
+ *
+ * @param[in] pT
+ *          The LU factorization of T in band storage, as computed by
+ *          plasma_zhetrf.
+ *
+ * @param[in] ldt
+ *          The leading dimension of the array T. ldt >= 3*nb+1.
+ *
+ * @param[in] ipiv2
+ *          The pivot indices of P2, as computed by plasma_zhetrf.
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zhetrf
+ * @sa plasma_zhesv
+ * @sa plasma_chetrs
+ * @sa plasma_dsytrs
+ * @sa plasma_ssytrs
+ *
+ ******************************************************************************/
+int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
+                  plasma_complex64_t *pA, int lda, int *ipiv,
+                  plasma_complex64_t *pT, int ldt, int *ipiv2,
+                  plasma_complex64_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Check input arguments.
+    if (uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo, only PlasmaLower supported");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldt < 3*nb+1) {
+        plasma_error("illegal value of ldt");
+        return -8;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -11;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // L(nb:n-1, nb:n-1) is in A(nb:n-1, 0:n-nb-1), and L is the identity
+    // in the first tile column.
+    int nl = imax(n-nb, 0);
+    plasma_desc_t L  = plasma_desc_view(A, nb, 0, nl, nl);
+    plasma_desc_t B1 = plasma_desc_view(B, nb, 0, nl, nrhs);
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // B = L^{-1} P B
+        plasma_pzlaswp(PlasmaRowwise, B, ipiv, 1, &sequence, &request);
+        if (nl > 0) {
+            plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                          1.0, L,
+                               B1,
+                          &sequence, &request);
+        }
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // B = T^{-1} B
+    if (sequence.status == PlasmaSuccess) {
+        int info = LAPACKE_zgbtrs(LAPACK_COL_MAJOR, 'n', n, nb, nb, nrhs,
+                                  pT, ldt, ipiv2, pB, ldb);
+        if (info != 0)
+            plasma_request_fail(&sequence, &request, PlasmaErrorInternal);
+    }
+
+    if (sequence.status == PlasmaSuccess) {
+        // asynchronous block
+        #pragma omp parallel num_threads(plasma_num_threads(plasma))
+        #pragma omp master
+        #pragma omp taskgroup
+        {
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+            // B = P^T L^{-H} B
+            if (nl > 0) {
+                plasma_pztrsm(PlasmaLeft, PlasmaLower,
+                              Plasma_ConjTrans, PlasmaUnit,
+                              1.0, L,
+                                   B1,
+                              &sequence, &request);
+            }
+            plasma_pzlaswp(PlasmaRowwise, B, ipiv, -1, &sequence, &request);
+
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
+    }
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
@@ -124,7 +124,7 @@ double plasma_zlange(plasma_enum_t norm,
     double *work = NULL;
     switch (norm) {
     case PlasmaMaxNorm:
-        work = (double*)malloc((size_t)A.mt*A.nt*sizeof(double));
+        work = (double*)malloc(((size_t)A.mt*A.nt)*sizeof(double));
         break;
     case PlasmaOneNorm:
         work = (double*)malloc(((size_t)A.mt*A.n+A.n)*sizeof(double));
@@ -133,7 +133,7 @@ double plasma_zlange(plasma_enum_t norm,
         work = (double*)malloc(((size_t)A.nt*A.m+A.m)*sizeof(double));
         break;
     case PlasmaFrobeniusNorm:
-        work = (double*)malloc((size_t)2*A.mt*A.nt*sizeof(double));
+        work = (double*)malloc(((size_t)2*A.mt*A.nt)*sizeof(double));
         break;
     }
     if (work == NULL) {
@@ -141,13 +141,8 @@ double plasma_zlange(plasma_enum_t norm,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
@@ -155,14 +150,15 @@ double plasma_zlange(plasma_enum_t norm,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_zlange(norm, A, work, &value, sequence, &request);
+        plasma_omp_zlange(norm, A, work, &value, &sequence, &request);
     }
     // implicit synchronization
 
@@ -171,9 +167,6 @@ double plasma_zlange(plasma_enum_t norm,
     // Free matrix in tile layout.
     plasma_desc_destroy(&A);
 
-    // Destroy sequence.
-    plasma_sequence_destroy(sequence);
-
     // Return the norm.
     return value;
 }
@@ -197,7 +190,8 @@ double plasma_zlange(plasma_enum_t norm,
  *          - PlasmaFrobeniusNorm: Frobenius norm
  *
  * @param[in] A
- *          The descriptor of matrix A.
+ *          The descriptor of matrix A, whose tiles may be packed
+ *          (plasma_desc_general_packed_create).
  *
  * @param[out] work
  *          Workspace of size:
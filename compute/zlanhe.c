@@ -142,13 +142,8 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
         return PlasmaErrorOutOfMemory;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
@@ -156,14 +151,15 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     double value;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
 
         // Call tile async function.
-        plasma_omp_zlanhe(norm, uplo, A, work, &value, sequence, &request);
+        plasma_omp_zlanhe(norm, uplo, A, work, &value, &sequence, &request);
     }
     // implicit synchronization
 
@@ -172,9 +168,6 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     // Free matrix in tile layout.
     plasma_desc_destroy(&A);
 
-    // Destroy sequence.
-    plasma_sequence_destroy(sequence);
-
     // Return the norm.
     return value;
 }
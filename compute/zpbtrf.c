@@ -121,29 +121,25 @@ int plasma_zpbtrf(plasma_enum_t uplo,
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
-    }
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
 
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zpb2desc(pAB, ldab, AB, sequence, &request);
+        plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_zpbtrf(uplo, AB, sequence, &request);
+        plasma_omp_zpbtrf(uplo, AB, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2pb(AB, pAB, ldab, sequence, &request);
+        plasma_omp_zdesc2pb(AB, pAB, ldab, &sequence, &request);
     }
     // implicit synchronization
 
@@ -151,8 +147,7 @@ int plasma_zpbtrf(plasma_enum_t uplo,
     plasma_desc_destroy(&AB);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -0,0 +1,951 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+// Synchronous tile interface: the matrices are passed in tile layout
+// and the routines return when the computation is done, without any
+// translation from or to LAPACK layout.
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operation C = alpha*op(A)*op(B) + beta*C
+ *  on matrices in tile layout. Synchronous tile version of plasma_zgemm,
+ *  by the classic algorithm.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          The operation op(A), as in plasma_zgemm.
+ *
+ * @param[in] transb
+ *          The operation op(B), as in plasma_zgemm.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Descriptor of matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of matrix B.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          Descriptor of matrix C.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgemm
+ * @sa plasma_omp_zgemm
+ *
+ ******************************************************************************/
+int plasma_zgemm_tile(plasma_enum_t transa, plasma_enum_t transb,
+                      plasma_complex64_t alpha, plasma_desc_t A,
+                                                plasma_desc_t B,
+                      plasma_complex64_t beta,  plasma_desc_t C)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgemm(transa, transb,
+                         alpha, A,
+                                B,
+                         beta,  C,
+                         &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Computes the Cholesky factorization of a Hermitian positive definite
+ *  matrix A in tile layout. Synchronous tile version of plasma_zpotrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          PlasmaUpper or PlasmaLower, as in plasma_zpotrf.
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A. On exit, the factor U or L.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ * @retval > 0 if the factorization failed, as in the LAPACK interface
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrf
+ * @sa plasma_omp_zpotrf
+ *
+ ******************************************************************************/
+int plasma_zpotrf_tile(plasma_enum_t uplo, plasma_desc_t A)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zpotrf(uplo, A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pocon
+ *
+ *  Estimates the reciprocal of the condition number of a Hermitian
+ *  positive definite matrix A from its Cholesky factor in tile layout.
+ *  Synchronous tile version of plasma_zpocon.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A = U^H U, with U in the upper triangle;
+ *          - PlasmaLower: A = L L^H, with L in the lower triangle.
+ *
+ * @param[in] A
+ *          Descriptor of the Cholesky factor of A, as computed by
+ *          plasma_zpotrf_tile.
+ *
+ * @param[in] Anorm
+ *          The one norm of the original matrix A.
+ *
+ * @param[out] rcond
+ *          The reciprocal of the condition number estimate.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpocon
+ *
+ ******************************************************************************/
+int plasma_zpocon_tile(plasma_enum_t uplo, plasma_desc_t A,
+                       double Anorm, double *rcond)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess || A.m != A.n) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    if (Anorm < 0.0) {
+        plasma_error("illegal value of Anorm");
+        return -3;
+    }
+    if (rcond == NULL) {
+        plasma_error("NULL rcond");
+        return -4;
+    }
+
+    // quick return
+    *rcond = 0.0;
+    if (A.n == 0) {
+        *rcond = 1.0;
+        return PlasmaSuccess;
+    }
+    if (Anorm == 0.0)
+        return PlasmaSuccess;
+
+    double Ainvnorm;
+    int retval = plasma_zlacon(uplo, PlasmaNoTrans, A, &Ainvnorm);
+    if (retval == PlasmaSuccess && Ainvnorm != 0.0)
+        *rcond = (1.0/Ainvnorm)/Anorm;
+
+    return retval;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrs
+ *
+ *  Solves A * X = B with the Cholesky factorization of A computed by
+ *  plasma_zpotrf_tile. Synchronous tile version of plasma_zpotrs.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          PlasmaUpper or PlasmaLower, as in plasma_zpotrs.
+ *
+ * @param[in] A
+ *          Descriptor of the factor U or L.
+ *
+ * @param[in,out] B
+ *          Descriptor of matrix B. On exit, the solution X.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrs
+ * @sa plasma_omp_zpotrs
+ *
+ ******************************************************************************/
+int plasma_zpotrs_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zpotrs(uplo, A, B, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Solves A * X = B for a Hermitian positive definite matrix A in tile
+ *  layout. Synchronous tile version of plasma_zposv.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          PlasmaUpper or PlasmaLower, as in plasma_zposv.
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A. On exit, the factor U or L.
+ *
+ * @param[in,out] B
+ *          Descriptor of matrix B. On exit, the solution X.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ * @retval > 0 if the factorization failed, as in the LAPACK interface
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zposv
+ * @sa plasma_omp_zposv
+ *
+ ******************************************************************************/
+int plasma_zposv_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zposv(uplo, A, B, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of a matrix A
+ *  in tile layout. Synchronous tile version of plasma_zgetrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A. On exit, the factors L and U.
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of size min(A.m, A.n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ * @retval > 0 if the factorization failed, as in the LAPACK interface
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf
+ * @sa plasma_omp_zgetrf
+ *
+ ******************************************************************************/
+int plasma_zgetrf_tile(plasma_desc_t A, int *ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgetrf(A, ipiv, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves A * X = B with the LU factorization of A computed by
+ *  plasma_zgetrf_tile. Synchronous tile version of plasma_zgetrs.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *          Descriptor of the factors L and U.
+ *
+ * @param[in] ipiv
+ *          The pivot indices from plasma_zgetrf_tile.
+ *
+ * @param[in,out] B
+ *          Descriptor of matrix B. On exit, the solution X.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrs
+ * @sa plasma_omp_zgetrs
+ *
+ ******************************************************************************/
+int plasma_zgetrs_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgetrs(A, ipiv, B, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Solves A * X = B for a general matrix A in tile layout.
+ *  Synchronous tile version of plasma_zgesv.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A. On exit, the factors L and U.
+ *
+ * @param[out] ipiv
+ *          The pivot indices, of size A.n.
+ *
+ * @param[in,out] B
+ *          Descriptor of matrix B. On exit, the solution X.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ * @retval > 0 if the factorization failed, as in the LAPACK interface
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgesv
+ * @sa plasma_omp_zgesv
+ *
+ ******************************************************************************/
+int plasma_zgesv_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize barrier.
+    int num_panel_threads = plasma->num_panel_threads;
+    plasma_barrier_init(&plasma->barrier, num_panel_threads);
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgesv(A, ipiv, B, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gecon
+ *
+ *  Estimates the reciprocal of the condition number of a general matrix A
+ *  from its LU factors in tile layout. Synchronous tile version of
+ *  plasma_zgecon. The estimate of the norm of A^{-1} takes a few steps of
+ *  tile triangular solves on a block of vectors.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          - PlasmaOneNorm: one norm condition number
+ *          - PlasmaInfNorm: infinity norm condition number
+ *
+ * @param[in] A
+ *          Descriptor of the LU factors of A, as computed by
+ *          plasma_zgetrf_tile with left pivoting on.
+ *
+ * @param[in] Anorm
+ *          The norm of the original matrix A, in the same norm.
+ *
+ * @param[out] rcond
+ *          The reciprocal of the condition number estimate.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgecon
+ *
+ ******************************************************************************/
+int plasma_zgecon_tile(plasma_enum_t norm, plasma_desc_t A,
+                       double Anorm, double *rcond)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (norm != PlasmaOneNorm && norm != PlasmaInfNorm) {
+        plasma_error("illegal value of norm");
+        return -1;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess || A.m != A.n) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    if (Anorm < 0.0) {
+        plasma_error("illegal value of Anorm");
+        return -3;
+    }
+    if (rcond == NULL) {
+        plasma_error("NULL rcond");
+        return -4;
+    }
+
+    // quick return
+    *rcond = 0.0;
+    if (A.n == 0) {
+        *rcond = 1.0;
+        return PlasmaSuccess;
+    }
+    if (Anorm == 0.0)
+        return PlasmaSuccess;
+
+    // The infinity norm of A^{-1} is the one norm of A^{-H}.
+    double Ainvnorm;
+    int retval = plasma_zlacon(
+        PlasmaGeneral,
+        norm == PlasmaOneNorm ? PlasmaNoTrans : Plasma_ConjTrans,
+        A, &Ainvnorm);
+    if (retval == PlasmaSuccess && Ainvnorm != 0.0)
+        *rcond = (1.0/Ainvnorm)/Anorm;
+
+    return retval;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes the QR factorization of a matrix A in tile layout.
+ *  Synchronous tile version of plasma_zgeqrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of matrix A. On exit, R and the Householder
+ *          reflectors.
+ *
+ * @param[out] T
+ *          On exit, auxiliary factorization data, as in plasma_zgeqrf.
+ *          Freed by plasma_desc_destroy.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgeqrf
+ * @sa plasma_omp_zgeqrf
+ *
+ ******************************************************************************/
+int plasma_zgeqrf_tile(plasma_desc_t A, plasma_desc_t *T)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // quick return
+    if (imin(A.m, A.n) == 0)
+        return PlasmaSuccess;
+
+    // Prepare descriptor T.
+    int ib = plasma->ib;
+    int householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+    int retval = plasma_descT_compact_create(A, ib, householder_mode,
+                                             PlasmaColumnwise, T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_compact_create() failed");
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = A.nb + ib*A.nb;  // geqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_zgeqrf(A, *T, work, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trsyl
+ *
+ *  Solves the triangular Sylvester equation op(A)*X + isgn*X*op(B) = C
+ *  on matrices in tile layout. Synchronous tile version of plasma_ztrsyl,
+ *  e.g., for the Schur factors of the coefficients kept in tile layout
+ *  over a sequence of equations.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          The operation op(A), as in plasma_ztrsyl.
+ *
+ * @param[in] transb
+ *          The operation op(B), as in plasma_ztrsyl.
+ *
+ * @param[in] isgn
+ *          The sign of the equation, 1 or -1.
+ *
+ * @param[in] A
+ *          Descriptor of the upper triangular matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of the upper triangular matrix B.
+ *
+ * @param[in,out] C
+ *          Descriptor of matrix C. On exit, the solution X.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ * @retval 1 if the solution of a tile would have overflowed
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ztrsyl
+ * @sa plasma_omp_ztrsyl
+ *
+ ******************************************************************************/
+int plasma_ztrsyl_tile(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        plasma_omp_ztrsyl(transa, transb, isgn, A, B, C, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/******************************************************************************/
+// Translates the block of rows i to i+m-1 and columns j to j+n-1
+// between the LAPACK array pA of the whole matrix A and the same block
+// of A, submitting the translation of the tiles of the block only.
+static int block_translate(int ge2desc, int i, int j, int m, int n,
+                          plasma_complex64_t *pA, int lda, plasma_desc_t A)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (A.i != 0 || A.j != 0 || A.translation == PlasmaInplace ||
+        plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return PlasmaErrorIllegalValue;
+    }
+    if (i < 0 || i > A.m) {
+        plasma_error("illegal value of i");
+        return PlasmaErrorIllegalValue;
+    }
+    if (j < 0 || j > A.n) {
+        plasma_error("illegal value of j");
+        return PlasmaErrorIllegalValue;
+    }
+    if (m < 0 || i+m > A.m) {
+        plasma_error("illegal value of m");
+        return PlasmaErrorIllegalValue;
+    }
+    if (n < 0 || j+n > A.n) {
+        plasma_error("illegal value of n");
+        return PlasmaErrorIllegalValue;
+    }
+    if (lda < imax(1, A.m)) {
+        plasma_error("illegal value of lda");
+        return PlasmaErrorIllegalValue;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // The view keeps the tile grid of A, with partial tiles at its edges,
+    // which the parallel translation copies in part. It takes the LAPACK
+    // array from the first element of the first tile of the view.
+    plasma_desc_t B = plasma_desc_view(A, i, j, m, n);
+    plasma_complex64_t *pB = &pA[(size_t)A.nb*lda*(j/A.nb) + A.mb*(i/A.mb)];
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        if (ge2desc)
+            plasma_pzge2desc(pB, lda, B, &sequence, &request);
+        else
+            plasma_pzdesc2ge(B, pB, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_cm2ccrb
+ *
+ *  Copies the block A(i:i+m-1, j:j+n-1) of a matrix in LAPACK layout to the
+ *  same block of its copy in tile layout, translating only the tiles of the
+ *  block, in part for the tiles at its edges. With plasma_zdesc2ge_sub and
+ *  plasma_desc_view, a block of a large matrix kept in tile layout is
+ *  updated by the tile interface, which takes views aligned to the tiles,
+ *  without translating the whole matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] i
+ *          The first row of the block. 0 <= i <= A.m.
+ *
+ * @param[in] j
+ *          The first column of the block. 0 <= j <= A.n.
+ *
+ * @param[in] m
+ *          The number of rows of the block. 0 <= m <= A.m-i.
+ *
+ * @param[in] n
+ *          The number of columns of the block. 0 <= n <= A.n-j.
+ *
+ * @param[in] pA
+ *          The whole matrix A in LAPACK layout.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array pA. lda >= max(1,A.m).
+ *
+ * @param[in,out] A
+ *          Descriptor of the whole matrix A (not a view), in tile layout.
+ *          On exit, the block is copied from pA.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zdesc2ge_sub
+ * @sa plasma_omp_zge2desc
+ *
+ ******************************************************************************/
+int plasma_zge2desc_sub(int i, int j, int m, int n,
+                        plasma_complex64_t *pA, int lda, plasma_desc_t A)
+{
+    return block_translate(1, i, j, m, n, pA, lda, A);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_ccrb2cm
+ *
+ *  Copies the block A(i:i+m-1, j:j+n-1) of a matrix in tile layout back to
+ *  the same block of the matrix in LAPACK layout, translating only the
+ *  tiles of the block.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *          Descriptor of the whole matrix A (not a view), in tile layout.
+ *
+ * @param[in] i
+ *          The first row of the block. 0 <= i <= A.m.
+ *
+ * @param[in] j
+ *          The first column of the block. 0 <= j <= A.n.
+ *
+ * @param[in] m
+ *          The number of rows of the block. 0 <= m <= A.m-i.
+ *
+ * @param[in] n
+ *          The number of columns of the block. 0 <= n <= A.n-j.
+ *
+ * @param[in,out] pA
+ *          The whole matrix A in LAPACK layout. On exit, the block is
+ *          copied from A, the rest of pA is not accessed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array pA. lda >= max(1,A.m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if an argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zge2desc_sub
+ * @sa plasma_omp_zdesc2ge
+ *
+ ******************************************************************************/
+int plasma_zdesc2ge_sub(plasma_desc_t A, int i, int j, int m, int n,
+                        plasma_complex64_t *pA, int lda)
+{
+    return block_translate(0, i, j, m, n, pA, lda, A);
+}
@@ -0,0 +1,487 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Updates the QR factorization of a matrix with a new block of rows.
+ *  Given the n-by-n upper triangular factor R of the rows seen so far and
+ *  the m-by-n block B of the new rows, computes the QR factorization
+ *
+ *    \f[ \begin{bmatrix} R \\ B \end{bmatrix} = Q \times
+ *        \begin{bmatrix} R_+ \\ 0 \end{bmatrix}, \f]
+ *
+ *  and applies Q^H to the right hand sides,
+ *
+ *    \f[ \begin{bmatrix} C_+ \\ D_+ \end{bmatrix} = Q^H \times
+ *        \begin{bmatrix} C \\ D \end{bmatrix}, \f]
+ *
+ *  where C is the n-by-nrhs Q^H*b of the rows seen so far and D holds the
+ *  new rows of b. The update costs O(m*n^2) flops, independently of the
+ *  number of rows seen before, so that a streaming least squares problem
+ *  is solved by updating R and C as the blocks arrive, then solving
+ *  R*X = C. The squared norm of D_+ adds to the squared residual.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of new rows, those of B and D. m >= 0.
+ *
+ * @param[in] n
+ *          The order of R, and the number of columns of B. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, the columns of C and D.
+ *          nrhs >= 0.
+ *
+ * @param[in,out] pR
+ *          On entry, the n-by-n upper triangular matrix R.
+ *          On exit, the upper triangular factor R_+.
+ *          The elements below the diagonal are not referenced.
+ *
+ * @param[in] ldr
+ *          The leading dimension of the array R. ldr >= max(1,n).
+ *
+ * @param[in,out] pB
+ *          On entry, the m-by-n matrix B of the new rows.
+ *          On exit, the reflectors which, with T, represent Q.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,m).
+ *
+ * @param[in,out] pC
+ *          On entry, the n-by-nrhs matrix C. On exit, C_+.
+ *          Not referenced if nrhs = 0.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,n).
+ *
+ * @param[in,out] pD
+ *          On entry, the m-by-nrhs matrix D. On exit, D_+.
+ *          Not referenced if nrhs = 0.
+ *
+ * @param[in] ldd
+ *          The leading dimension of the array D. ldd >= max(1,m).
+ *
+ * @param[out] T
+ *          On exit, auxiliary factorization data, required by
+ *          plasma_omp_ztpmqrt to apply Q to other right hand sides.
+ *          Matrix in T is allocated inside this function and needs to be
+ *          destroyed by plasma_desc_destroy.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_ztpqrt
+ * @sa plasma_omp_ztpmqrt
+ * @sa plasma_ctpqrt
+ * @sa plasma_dtpqrt
+ * @sa plasma_stpqrt
+ * @sa plasma_zgeqrf
+ *
+ ******************************************************************************/
+int plasma_ztpqrt(int m, int n, int nrhs,
+                  plasma_complex64_t *pR, int ldr,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pC, int ldc,
+                  plasma_complex64_t *pD, int ldd,
+                  plasma_desc_t *T)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (ldr < imax(1, n)) {
+        plasma_error("illegal value of ldr");
+        return -5;
+    }
+    if (ldb < imax(1, m)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+    if (nrhs > 0 && ldc < imax(1, n)) {
+        plasma_error("illegal value of ldc");
+        return -9;
+    }
+    if (nrhs > 0 && ldd < imax(1, m)) {
+        plasma_error("illegal value of ldd");
+        return -11;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t R;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    plasma_desc_t D;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &R);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&R);
+        return retval;
+    }
+    if (nrhs > 0) {
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            n, nrhs, 0, 0, n, nrhs, &C);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&R);
+            plasma_desc_destroy(&B);
+            return retval;
+        }
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, nrhs, 0, 0, m, nrhs, &D);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&R);
+            plasma_desc_destroy(&B);
+            plasma_desc_destroy(&C);
+            return retval;
+        }
+    }
+
+    // Prepare descriptor T, of a tile for each tile of B.
+    retval = plasma_descT_create(B, ib, PlasmaFlatHouseholder, T);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_descT_create() failed");
+        return retval;
+    }
+
+    // Allocate workspace.
+    plasma_workspace_t work;
+    size_t lwork = nb + ib*nb;  // tsqrt: tau + work
+    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pR, ldr, R, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+        if (nrhs > 0) {
+            plasma_omp_zge2desc(pC, ldc, C, &sequence, &request);
+            plasma_omp_zge2desc(pD, ldd, D, &sequence, &request);
+        }
+
+        // Call the tile async functions.
+        plasma_omp_ztpqrt(R, B, *T, work, &sequence, &request);
+        if (nrhs > 0) {
+            plasma_omp_ztpmqrt(Plasma_ConjTrans, B, *T, C, D,
+                               work, &sequence, &request);
+        }
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(R, pR, ldr, &sequence, &request);
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        if (nrhs > 0) {
+            plasma_omp_zdesc2ge(C, pC, ldc, &sequence, &request);
+            plasma_omp_zdesc2ge(D, pD, ldd, &sequence, &request);
+        }
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&R);
+    plasma_desc_destroy(&B);
+    if (nrhs > 0) {
+        plasma_desc_destroy(&C);
+        plasma_desc_destroy(&D);
+    }
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Updates the QR factorization of a matrix with a new block of rows.
+ *  Non-blocking tile version of plasma_ztpqrt().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *  Each tile row of B is eliminated against the diagonal tiles of R in
+ *  turn, as the tiles below the diagonal of the QR factorization, so that
+ *  only the tiles of R and B are touched.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] R
+ *          Descriptor of the n-by-n upper triangular matrix R.
+ *          On exit, the upper triangular factor R_+.
+ *
+ * @param[in,out] B
+ *          Descriptor of the m-by-n matrix B, tiled as R.
+ *          On exit, the reflectors which, with T, represent Q.
+ *
+ * @param[out] T
+ *          Descriptor of matrix T, of an ib-by-nb tile for each tile of B.
+ *          On exit, auxiliary factorization data, required by
+ *          plasma_omp_ztpmqrt.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels.
+ *          Contains preallocated space for tau and work arrays, of size
+ *          nb + ib*nb. Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ztpqrt
+ * @sa plasma_omp_ztpmqrt
+ * @sa plasma_omp_zgeqrf
+ *
+ ******************************************************************************/
+void plasma_omp_ztpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(R) != PlasmaSuccess || R.m != R.n) {
+        plasma_error("invalid R");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess ||
+        B.n != R.n || B.mb != R.mb || B.nb != R.nb) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess ||
+        T.mt < B.mt || T.nt < B.nt) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(B.m, B.n) == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pztpqrt(R, B, T, work, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Applies Q or Q^H, of the update of a QR factorization by
+ *  plasma_omp_ztpqrt, to the stacked matrix [C; D] from the left:
+ *
+ *    \f[ \begin{bmatrix} C \\ D \end{bmatrix} = op( Q ) \times
+ *        \begin{bmatrix} C \\ D \end{bmatrix}. \f]
+ *
+ *  Non-blocking tile version.
+ *  May return before the computation is finished.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:    op( Q ) = Q,
+ *          - Plasma_ConjTrans: op( Q ) = Q^H.
+ *
+ * @param[in] B
+ *          Descriptor of the reflectors computed by plasma_omp_ztpqrt.
+ *
+ * @param[in] T
+ *          Descriptor of matrix T computed by plasma_omp_ztpqrt.
+ *
+ * @param[in,out] C
+ *          Descriptor of the n-by-nrhs matrix C, of the rows of R,
+ *          tiled as B.
+ *
+ * @param[in,out] D
+ *          Descriptor of the m-by-nrhs matrix D, of the rows of B,
+ *          tiled as B.
+ *
+ * @param[in] work
+ *          Workspace for the auxiliary arrays needed by some coreblas kernels,
+ *          of size ib*nb. Allocated by the plasma_workspace_create function.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ztpqrt
+ * @sa plasma_omp_ztpqrt
+ * @sa plasma_omp_zunmqr
+ *
+ ******************************************************************************/
+void plasma_omp_ztpmqrt(plasma_enum_t trans,
+                        plasma_desc_t B, plasma_desc_t T,
+                        plasma_desc_t C, plasma_desc_t D,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (trans != Plasma_ConjTrans && trans != PlasmaNoTrans) {
+        plasma_error("illegal value of trans");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(T) != PlasmaSuccess) {
+        plasma_error("invalid T");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(C) != PlasmaSuccess ||
+        C.m != B.n || C.mb != B.nb) {
+        plasma_error("invalid C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(D) != PlasmaSuccess ||
+        D.m != B.m || D.n != C.n || D.mb != B.mb || D.nb != C.nb) {
+        plasma_error("invalid D");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (imin(B.m, B.n) == 0 || C.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pztpmqrt(trans, B, T, C, D, work, sequence, request);
+}
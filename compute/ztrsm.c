@@ -36,6 +36,15 @@
  *  A is a unit or non-unit, upper or lower triangular matrix.
  *  The matrix X overwrites B.
  *
+ *  With PlasmaTileStructure on, the tiles of A and B are tagged zero,
+ *  identity or dense after their translation, and the solves of zero tiles
+ *  of B, and the updates by zero tiles, are skipped, as for an identity B,
+ *  whose tiles above the diagonal stay zero, or a banded A.
+ *
+ *  With PlasmaInplaceOutplace set to PlasmaNoTranslation, the tiles of A
+ *  and B are views of the arrays pA and pB, with their leading dimensions,
+ *  and are not translated to and from the tile layout.
+ *
  *******************************************************************************
  *
  * @param[in] side
@@ -170,47 +179,64 @@ int plasma_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        an, an, 0, 0, an, an, &A);
+    retval = plasma_desc_lapack_view_create(PlasmaComplexDouble, pA, lda,
+                                            nb, nb, an, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_view_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &B);
+    retval = plasma_desc_lapack_view_create(PlasmaComplexDouble, pB, ldb,
+                                            nb, nb, m, n, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_lapack_view_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Create sequence.
-    plasma_sequence_t *sequence = NULL;
-    retval = plasma_sequence_create(&sequence);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_sequence_create() failed");
-        return retval;
+    // Tag the zero and identity tiles, whose products are skipped.
+    int structure = plasma->tile_structure == PlasmaTileStructureOn;
+    if (structure) {
+        retval = plasma_desc_tile_structure_create(&A);
+        if (retval == PlasmaSuccess)
+            retval = plasma_desc_tile_structure_create(&B);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_tile_structure_create() failed");
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&B);
+            return retval;
+        }
     }
 
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
     // asynchronous block
-    #pragma omp parallel
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
     #pragma omp master
+    #pragma omp taskgroup
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+
+        // The tags are read as the tasks are submitted.
+        if (structure) {
+            plasma_pztile_structure(A, &sequence, &request);
+            plasma_pztile_structure(B, &sequence, &request);
+            #pragma omp taskwait
+        }
 
         // Call the tile async function.
         plasma_omp_ztrsm(side, uplo, transa, diag,
                          alpha, A,
                                 B,
-                         sequence, &request);
+                         &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
+        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -219,8 +245,7 @@ int plasma_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
-    int status = sequence->status;
-    plasma_sequence_destroy(sequence);
+    int status = sequence.status;
     return status;
 }
 
@@ -0,0 +1,365 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trsyl
+ *
+ *  Solves the triangular Sylvester equation
+ *
+ *    \f[ op( A ) \times X + isgn X \times op( B ) = C, \f]
+ *
+ *  where op( A ) = A or A^H, op( B ) = B or B^H, A is an m-by-m and B an
+ *  n-by-n upper triangular matrix, e.g., the Schur factors of the
+ *  coefficients of a Sylvester or Lyapunov equation. In real arithmetic,
+ *  A and B are upper quasi-triangular in real Schur form, whose 2-by-2
+ *  diagonal blocks do not straddle the tile boundaries.
+ *  The m-by-n matrix X overwrites C.
+ *
+ *  The tiles of X are solved by a wavefront of recursive tile solves,
+ *  from the corner of the equation where op(A) and op(B) start, each
+ *  updating the right-hand sides of the tiles after it by tile products.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   op(A) = A,
+ *          - PlasmaConjTrans: op(A) = A^H.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   op(B) = B,
+ *          - PlasmaConjTrans: op(B) = B^H.
+ *
+ * @param[in] isgn
+ *          The sign of the equation, 1 or -1.
+ *
+ * @param[in] m
+ *          The order of the matrix A, and the number of rows of C. m >= 0.
+ *
+ * @param[in] n
+ *          The order of the matrix B, and the number of columns of C.
+ *          n >= 0.
+ *
+ * @param[in] pA
+ *          The m-by-m upper triangular matrix A. The strictly lower
+ *          triangular part of A, but for the 2-by-2 diagonal blocks in
+ *          real arithmetic, is not referenced.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] pB
+ *          The n-by-n upper triangular matrix B. The strictly lower
+ *          triangular part of B, but for the 2-by-2 diagonal blocks in
+ *          real arithmetic, is not referenced.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[in,out] pC
+ *          On entry, the m-by-n right-hand side C.
+ *          On exit, if return value = 0, the m-by-n solution X.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval 1 if the solution of a tile would have overflowed without
+ *         the scaling of LAPACK ztrsyl, which the tile solves do not
+ *         apply; common or close eigenvalues of A and -isgn B are
+ *         perturbed as in LAPACK ztrsyl
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_ztrsyl
+ * @sa plasma_ctrsyl
+ * @sa plasma_dtrsyl
+ * @sa plasma_strsyl
+ *
+ ******************************************************************************/
+int plasma_ztrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                  int m, int n,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pC, int ldc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != Plasma_ConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != Plasma_ConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (isgn != 1 && isgn != -1) {
+        plasma_error("illegal value of isgn");
+        return -3;
+    }
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -4;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -5;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -7;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -9;
+    }
+    if (ldc < imax(1, m)) {
+        plasma_error("illegal value of ldc");
+        return -11;
+    }
+
+    // quick return
+    if ((m == 0) || (n == 0))
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+#ifndef COMPLEX
+    // The 2-by-2 diagonal blocks are solved within a tile.
+    for (int k = nb; k < m; k += nb) {
+        if (pA[(size_t)lda*(k-1)+k] != 0.0) {
+            plasma_error("2-by-2 block of A across tiles");
+            return -6;
+        }
+    }
+    for (int k = nb; k < n; k += nb) {
+        if (pB[(size_t)ldb*(k-1)+k] != 0.0) {
+            plasma_error("2-by-2 block of B across tiles");
+            return -8;
+        }
+    }
+#endif
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, m, 0, 0, m, m, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        n, n, 0, 0, n, n, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &C);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence = PlasmaSequenceInitializer;
+
+    // Initialize request.
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    // asynchronous block
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    #pragma omp master
+    #pragma omp taskgroup
+    {
+        // Translate to tile layout.
+        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+        plasma_omp_zge2desc(pC, ldc, C, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_ztrsyl(transa, transb, isgn, A, B, C,
+                          &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_zdesc2ge(C, pC, ldc, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&C);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trsyl
+ *
+ *  Solves the triangular Sylvester equation.
+ *  Non-blocking tile version of plasma_ztrsyl().
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   op(A) = A,
+ *          - PlasmaConjTrans: op(A) = A^H.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   op(B) = B,
+ *          - PlasmaConjTrans: op(B) = B^H.
+ *
+ * @param[in] isgn
+ *          The sign of the equation, 1 or -1.
+ *
+ * @param[in] A
+ *          Descriptor of the upper triangular matrix A.
+ *
+ * @param[in] B
+ *          Descriptor of the upper triangular matrix B.
+ *
+ * @param[in,out] C
+ *          Descriptor of matrix C.
+ *          On exit, the solution X.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_ztrsyl
+ * @sa plasma_omp_ctrsyl
+ * @sa plasma_omp_dtrsyl
+ * @sa plasma_omp_strsyl
+ *
+ ******************************************************************************/
+void plasma_omp_ztrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != Plasma_ConjTrans)) {
+        plasma_error("illegal value of transa");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != Plasma_ConjTrans)) {
+        plasma_error("illegal value of transb");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (isgn != 1 && isgn != -1) {
+        plasma_error("illegal value of isgn");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(C) != PlasmaSuccess) {
+        plasma_error("invalid C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.m != C.m || A.n != C.m || A.mb != C.mb || A.nb != C.mb) {
+        plasma_error("A not matching the rows of C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (B.m != C.n || B.n != C.n || B.mb != C.nb || B.nb != C.nb) {
+        plasma_error("B not matching the columns of C");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if ((C.m == 0) || (C.n == 0))
+        return;
+
+    // Call the parallel function.
+    plasma_pztrsyl(transa, transb, isgn, A, B, C, sequence, request);
+}
@@ -0,0 +1,287 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _GNU_SOURCE
+
+#include "plasma_affinity.h"
+#include "plasma_types.h"
+
+#include <omp.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#if defined(__linux__)
+// CPUs of the affinity mask of the process, in order.
+static cpu_set_t affinity_mask;
+static int affinity_cpus[CPU_SETSIZE];
+static int affinity_num_cpus = 0;
+
+// The same CPUs, the fast cores of a hybrid CPU first, and their mask.
+static int affinity_fast_first[CPU_SETSIZE];
+static cpu_set_t affinity_fast_mask;
+static int affinity_num_fast_cpus = 0;
+
+// Mask of the calling thread before plasma_affinity_fast_enter(), and the
+// depth of its calls.
+static __thread cpu_set_t affinity_saved_mask;
+static __thread int affinity_saved = 0;
+#endif
+
+static pthread_once_t affinity_once = PTHREAD_ONCE_INIT;
+
+#if defined(__linux__)
+/******************************************************************************/
+// Reads the first integer of a file of sysfs, -1 if there is none.
+static long plasma_affinity_read(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        return -1;
+
+    long value;
+    if (fscanf(file, "%ld", &value) != 1)
+        value = -1;
+    fclose(file);
+    return value;
+}
+
+/******************************************************************************/
+// Sets capacity[i] of the CPUs of the process to 1 if listed in the CPU
+// list of a sysfs file, as 0-7,16, and to 0 otherwise. Returns whether the
+// file was read.
+static int plasma_affinity_read_list(const char *path, long *capacity)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        return 0;
+
+    cpu_set_t listed;
+    CPU_ZERO(&listed);
+    int first, last;
+    while (fscanf(file, "%d", &first) == 1) {
+        last = first;
+        int c = fgetc(file);
+        if (c == '-') {
+            if (fscanf(file, "%d", &last) != 1)
+                break;
+            c = fgetc(file);
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+            CPU_SET(cpu, &listed);
+        if (c != ',')
+            break;
+    }
+    fclose(file);
+
+    for (int i = 0; i < affinity_num_cpus; i++)
+        capacity[i] = CPU_ISSET(affinity_cpus[i], &listed) ? 1 : 0;
+    return 1;
+}
+
+/******************************************************************************/
+// Detects the core types of the CPUs of the process, from the capacities
+// the scheduler gives them (big.LITTLE), the PMU of the performance cores
+// (Intel hybrid), or else their largest frequency. The fast cores are the
+// CPUs of at least 3/4 of the largest capacity, all of them if unknown.
+static void plasma_affinity_core_types()
+{
+    long capacity[CPU_SETSIZE];
+    char path[128];
+    int known = 1;
+    for (int i = 0; i < affinity_num_cpus && known; i++) {
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/cpu/cpu%d/cpu_capacity",
+                 affinity_cpus[i]);
+        capacity[i] = plasma_affinity_read(path);
+        known = capacity[i] > 0;
+    }
+    if (!known)
+        known = plasma_affinity_read_list("/sys/devices/cpu_core/cpus",
+                                          capacity);
+    if (!known) {
+        known = 1;
+        for (int i = 0; i < affinity_num_cpus && known; i++) {
+            snprintf(path, sizeof(path),
+                     "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq",
+                     affinity_cpus[i]);
+            capacity[i] = plasma_affinity_read(path);
+            known = capacity[i] > 0;
+        }
+    }
+    if (!known) {
+        for (int i = 0; i < affinity_num_cpus; i++)
+            capacity[i] = 1;
+    }
+
+    long largest = 0;
+    for (int i = 0; i < affinity_num_cpus; i++)
+        if (capacity[i] > largest)
+            largest = capacity[i];
+
+    CPU_ZERO(&affinity_fast_mask);
+    for (int i = 0; i < affinity_num_cpus; i++) {
+        if (4*capacity[i] >= 3*largest) {
+            affinity_fast_first[affinity_num_fast_cpus++] = affinity_cpus[i];
+            CPU_SET(affinity_cpus[i], &affinity_fast_mask);
+        }
+    }
+    int num = affinity_num_fast_cpus;
+    for (int i = 0; i < affinity_num_cpus; i++)
+        if (4*capacity[i] < 3*largest)
+            affinity_fast_first[num++] = affinity_cpus[i];
+}
+#endif
+
+/******************************************************************************/
+static void plasma_affinity_save()
+{
+#if defined(__linux__)
+    if (sched_getaffinity(0, sizeof(affinity_mask), &affinity_mask) != 0)
+        return;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &affinity_mask))
+            affinity_cpus[affinity_num_cpus++] = cpu;
+
+    plasma_affinity_core_types();
+#endif
+}
+
+/***************************************************************************//**
+    Saves the affinity mask of the process, before any thread is pinned,
+    and detects the core types of its CPUs. Called by plasma_init(), once.
+*/
+void plasma_affinity_init()
+{
+    pthread_once(&affinity_once, plasma_affinity_save);
+}
+
+/***************************************************************************//**
+    Returns the number of CPUs of the process, 0 if unknown.
+*/
+int plasma_affinity_num_cpus()
+{
+#if defined(__linux__)
+    return affinity_num_cpus;
+#else
+    return 0;
+#endif
+}
+
+/***************************************************************************//**
+    Returns the number of fast CPUs of the process, the performance cores of
+    a hybrid CPU, all of them on a CPU of a single core type, 0 if unknown.
+*/
+int plasma_affinity_num_fast_cpus()
+{
+#if defined(__linux__)
+    return affinity_num_fast_cpus;
+#else
+    return 0;
+#endif
+}
+
+/***************************************************************************//**
+    Returns the number of the CPU running the calling thread, 0 if unknown.
+*/
+int plasma_affinity_self()
+{
+#if defined(__linux__)
+    int cpu = sched_getcpu();
+    for (int i = 0; i < affinity_num_cpus; i++)
+        if (affinity_cpus[i] == cpu)
+            return i;
+#endif
+    return 0;
+}
+
+/***************************************************************************//**
+    Pins the calling thread, of rank rank in a team of size threads,
+    to its CPU, or lets it run on all the CPUs of the process again with
+    PlasmaBindNone.
+*/
+void plasma_affinity_bind(plasma_enum_t bind, int first, int rank, int size)
+{
+#if defined(__linux__)
+    int num_cpus = affinity_num_cpus;
+    if (num_cpus == 0)
+        return;
+
+    if (bind == PlasmaBindNone) {
+        sched_setaffinity(0, sizeof(affinity_mask), &affinity_mask);
+        return;
+    }
+    int i = bind == PlasmaBindSpread && size < num_cpus
+          ? (int)((long)rank*num_cpus/size)
+          : rank;
+    const int *cpus = bind == PlasmaBindFast ? affinity_fast_first
+                                             : affinity_cpus;
+
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpus[(first+i)%num_cpus], &mask);
+    sched_setaffinity(0, sizeof(mask), &mask);
+#else
+    (void)bind;
+    (void)first;
+    (void)rank;
+    (void)size;
+#endif
+}
+
+/***************************************************************************//**
+    Pins the threads of a parallel region of size threads, the threads the
+    runtime keeps for the next parallel regions of the calling thread.
+    Must be called outside of any parallel region.
+*/
+void plasma_affinity_team(plasma_enum_t bind, int first, int size)
+{
+    #pragma omp parallel num_threads(size)
+    plasma_affinity_bind(bind, first,
+                         omp_get_thread_num(), omp_get_num_threads());
+}
+
+/***************************************************************************//**
+    Moves the calling thread to the fast cores of a hybrid CPU, letting it
+    run on any of them, until plasma_affinity_fast_leave(), for the tasks of
+    the critical path. Does nothing on a CPU of a single core type, where
+    the thread keeps its CPUs.
+*/
+void plasma_affinity_fast_enter()
+{
+#if defined(__linux__)
+    if (affinity_num_fast_cpus == 0 ||
+        affinity_num_fast_cpus == affinity_num_cpus)
+        return;
+
+    // A task may run another one at its scheduling points.
+    if (affinity_saved++ > 0)
+        return;
+
+    if (sched_getaffinity(0, sizeof(affinity_saved_mask),
+                          &affinity_saved_mask) != 0)
+        affinity_saved_mask = affinity_mask;
+    sched_setaffinity(0, sizeof(affinity_fast_mask), &affinity_fast_mask);
+#endif
+}
+
+/***************************************************************************//**
+    Returns the calling thread to the CPUs it ran on before
+    plasma_affinity_fast_enter().
+*/
+void plasma_affinity_fast_leave()
+{
+#if defined(__linux__)
+    if (affinity_saved == 0 || --affinity_saved > 0)
+        return;
+
+    sched_setaffinity(0, sizeof(affinity_saved_mask), &affinity_saved_mask);
+#endif
+}
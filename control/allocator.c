@@ -0,0 +1,160 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _DEFAULT_SOURCE
+
+#include "plasma_allocator.h"
+#include "plasma_types.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/***************************************************************************//**
+    Allocates size bytes with the allocator selected by PlasmaAllocator.
+    Returns NULL if the allocation fails.
+*/
+void *plasma_allocator_alloc(plasma_allocator_t *allocator, size_t size)
+{
+    void *ptr = NULL;
+    switch (allocator->kind) {
+    case PlasmaAlignedAllocator:
+        if (posix_memalign(&ptr, PlasmaAlignment, size) != 0)
+            return NULL;
+        return ptr;
+    case PlasmaHugePageAllocator:
+        // Small allocations would waste most of a huge page.
+        if (size < PlasmaHugePageSize) {
+            if (posix_memalign(&ptr, PlasmaAlignment, size) != 0)
+                return NULL;
+            return ptr;
+        }
+        if (posix_memalign(&ptr, PlasmaHugePageSize, size) != 0)
+            return NULL;
+#if defined(MADV_HUGEPAGE)
+        // Only a hint, the storage is usable if it fails.
+        madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+        return ptr;
+    case PlasmaUserAllocator:
+        return allocator->alloc(size);
+    default:
+        return malloc(size);
+    }
+}
+
+/***************************************************************************//**
+    Allocates size bytes set to zero with the allocator selected by
+    PlasmaAllocator. The default allocator takes large sizes as fresh pages
+    from the system, zero without a pass over them, and faulted in only
+    when first touched. The others set the storage to zero.
+    Returns NULL if the allocation fails.
+*/
+void *plasma_allocator_alloc_zero(plasma_allocator_t *allocator, size_t size)
+{
+    if (allocator->kind == PlasmaMallocAllocator)
+        return calloc(1, size);
+
+    void *ptr = plasma_allocator_alloc(allocator, size);
+    if (ptr != NULL)
+        memset(ptr, 0, size);
+    return ptr;
+}
+
+/***************************************************************************//**
+    Frees storage of size bytes from plasma_allocator_alloc.
+*/
+void plasma_allocator_free(plasma_allocator_t *allocator,
+                           void *ptr, size_t size)
+{
+    if (ptr == NULL)
+        return;
+
+    if (allocator->kind == PlasmaUserAllocator)
+        allocator->dealloc(ptr, size);
+    else
+        free(ptr);
+}
+
+/***************************************************************************//**
+    Maps size bytes of the file path, created if it does not exist and
+    extended to size bytes if shorter. The content of the file is kept, and
+    the changes to the mapping are written back to the file by the system.
+    Returns NULL if the mapping fails.
+*/
+void *plasma_allocator_map_file(const char *path, size_t size)
+{
+    int fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        ((size_t)st.st_size < size && ftruncate(fd, (off_t)size) != 0)) {
+        close(fd);
+        return NULL;
+    }
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping stays valid without the descriptor.
+    close(fd);
+    if (ptr == MAP_FAILED)
+        return NULL;
+
+    return ptr;
+}
+
+/***************************************************************************//**
+    Unmaps a mapping of size bytes from plasma_allocator_map_file.
+*/
+void plasma_allocator_unmap_file(void *ptr, size_t size)
+{
+    if (ptr != NULL)
+        munmap(ptr, size);
+}
+
+/***************************************************************************//**
+    Starts reading the pages holding size bytes at ptr, inside a mapping from
+    plasma_allocator_map_file, without waiting for them.
+*/
+void plasma_allocator_prefetch(void *ptr, size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uintptr_t first = (uintptr_t)ptr & ~(uintptr_t)(page-1);
+    uintptr_t last = (uintptr_t)ptr + size;
+    // Only a hint, nothing to do if it fails.
+    madvise((void*)first, last-first, MADV_WILLNEED);
+}
+
+/***************************************************************************//**
+    Reserves size bytes of address space, without storage and inaccessible,
+    e.g., for tile matrices whose tile addresses are only compared.
+    Returns NULL if the reservation fails.
+*/
+void *plasma_allocator_reserve(size_t size)
+{
+    void *ptr = mmap(NULL, size, PROT_NONE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (ptr == MAP_FAILED)
+        return NULL;
+
+    return ptr;
+}
+
+/***************************************************************************//**
+    Releases a reservation of size bytes from plasma_allocator_reserve.
+*/
+void plasma_allocator_release(void *ptr, size_t size)
+{
+    if (ptr != NULL)
+        munmap(ptr, size);
+}
@@ -32,7 +32,7 @@ int plasma_sequence_create(plasma_sequence_t **sequence)
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
-    (*sequence)->status = PlasmaSuccess;
+    **sequence = PlasmaSequenceInitializer;
     return PlasmaSuccess;
 }
 
@@ -42,3 +42,115 @@ int plasma_sequence_destroy(plasma_sequence_t *sequence)
     free(sequence);
     return PlasmaSuccess;
 }
+
+/******************************************************************************/
+int plasma_sequence_set_callback(plasma_sequence_t *sequence,
+                                 plasma_sequence_callback_t callback,
+                                 void *arg)
+{
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    sequence->callback = callback;
+    sequence->callback_arg = arg;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Sets the priority class of the tasks of the sequence, PlasmaPriorityNormal
+ *  or PlasmaPriorityUrgent, before they are submitted.
+ ******************************************************************************/
+int plasma_sequence_set_priority(plasma_sequence_t *sequence,
+                                 plasma_enum_t priority)
+{
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    if (priority != PlasmaPriorityNormal &&
+        priority != PlasmaPriorityUrgent) {
+        plasma_error("illegal value of priority");
+        return PlasmaErrorIllegalValue;
+    }
+    sequence->priority = priority;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Submits body(sequence, arg), which calls the asynchronous functions of
+ *  the sequence, as a task, and returns without waiting for it. The task
+ *  waits for all its descendants in a taskgroup, then completes the
+ *  sequence. Must be called inside a parallel region; the calling thread
+ *  may do other work and poll the sequence with plasma_sequence_test(),
+ *  wait for it with plasma_sequence_wait(), or get the callback.
+ ******************************************************************************/
+int plasma_sequence_run(plasma_sequence_t *sequence,
+                        void (*body)(plasma_sequence_t *sequence, void *arg),
+                        void *arg)
+{
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    if (body == NULL) {
+        plasma_error("NULL body");
+        return PlasmaErrorIllegalValue;
+    }
+    #pragma omp atomic write
+    sequence->complete = 0;
+
+    #pragma omp task firstprivate(sequence, body, arg) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        #pragma omp taskgroup
+        {
+            body(sequence, arg);
+        }
+        plasma_sequence_complete(sequence);
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Marks the sequence as complete, after calling its callback.
+ *  Called by plasma_sequence_run(), or after a taskwait by callers that
+ *  synchronize themselves. The sequence may be destroyed by a waiting
+ *  thread as soon as it is marked, so it is not touched afterwards.
+ ******************************************************************************/
+int plasma_sequence_complete(plasma_sequence_t *sequence)
+{
+    if (sequence->callback != NULL)
+        sequence->callback(sequence, sequence->callback_arg);
+
+    #pragma omp flush
+    #pragma omp atomic write
+    sequence->complete = 1;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+int plasma_sequence_test(plasma_sequence_t *sequence)
+{
+    int complete;
+    #pragma omp atomic read
+    complete = sequence->complete;
+    #pragma omp flush
+    return complete;
+}
+
+/***************************************************************************//**
+ *  Waits for the sequence to complete and returns its status. The waiting
+ *  thread executes other tasks in the meantime, if any.
+ ******************************************************************************/
+int plasma_sequence_wait(plasma_sequence_t *sequence)
+{
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    while (!plasma_sequence_test(sequence)) {
+        #pragma omp taskyield
+    }
+    return sequence->status;
+}
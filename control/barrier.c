@@ -7,8 +7,94 @@
  *  University of Manchester, UK.
  *
  **/
+#define _DEFAULT_SOURCE
 
+#include "plasma_affinity.h"
 #include "plasma_barrier.h"
+#include "plasma_types.h"
+
+#include <limits.h>
+#include <omp.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Pauses before a waiting thread sleeps, and the longest backoff.
+enum {
+    PlasmaBarrierSpins      = 1 << 12,
+    PlasmaBarrierMaxBackoff = 64
+};
+
+/******************************************************************************/
+static inline void plasma_barrier_pause(int count)
+{
+    for (int i = 0; i < count; i++) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+}
+
+/******************************************************************************/
+// Sleeps while *addr is value, or returns at once if it changed.
+static void plasma_barrier_sleep(volatile int *addr, int value)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (int*)addr, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+#else
+    (void)addr;
+    (void)value;
+    sched_yield();
+#endif
+}
+
+/******************************************************************************/
+static void plasma_barrier_wake(volatile int *addr)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (int*)addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+    (void)addr;
+#endif
+}
+
+/******************************************************************************/
+// Waits for *flag to reach episode, as a signed difference, to allow
+// wrapping around. Spins first, with an exponential backoff, then sleeps.
+static inline int plasma_barrier_reached(int value, int episode)
+{
+    return (int)((unsigned)value - (unsigned)episode) >= 0;
+}
+
+/******************************************************************************/
+static void plasma_barrier_await(plasma_barrier_slot_t *slot,
+                                 volatile int *flag, int episode)
+{
+    int backoff = 1;
+    for (int spins = 0; spins < PlasmaBarrierSpins; spins += backoff) {
+        if (plasma_barrier_reached(__atomic_load_n(flag, __ATOMIC_ACQUIRE),
+                                   episode))
+            return;
+        plasma_barrier_pause(backoff);
+        if (backoff < PlasmaBarrierMaxBackoff)
+            backoff *= 2;
+    }
+    // The signaling thread wakes the thread if it sees it sleeping,
+    // or the thread sees the flag signaled.
+    __atomic_store_n(&slot->s.sleeping, 1, __ATOMIC_SEQ_CST);
+    int value;
+    while (!plasma_barrier_reached(
+               value = __atomic_load_n(flag, __ATOMIC_SEQ_CST), episode))
+        plasma_barrier_sleep(flag, value);
+    __atomic_store_n(&slot->s.sleeping, 0, __ATOMIC_RELAXED);
+}
 
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier, int size)
@@ -16,16 +102,182 @@ void plasma_barrier_init(plasma_barrier_t *barrier, int size)
     barrier->size = size;
     barrier->count = 0;
     barrier->passed = 0;
+
+    barrier->rounds = 0;
+    while ((1 << barrier->rounds) < size)
+        barrier->rounds++;
+
+    for (int i = 0; i < size && i < PlasmaBarrierMaxSize; i++) {
+        for (int r = 0; r < PlasmaBarrierMaxRounds; r++)
+            barrier->slots[i].s.flag[r] = 0;
+        barrier->slots[i].s.episode = 0;
+        barrier->slots[i].s.sleeping = 0;
+    }
 }
 
 /******************************************************************************/
-void plasma_barrier_wait(plasma_barrier_t *barrier)
+void plasma_barrier_wait(plasma_barrier_t *barrier, int rank)
 {
-    int passed_old = barrier->passed;
+    int size = barrier->size;
+    if (size <= 1)
+        return;
+
+    if (size > PlasmaBarrierMaxSize) {
+        int passed_old = barrier->passed;
+
+        __sync_fetch_and_add(&barrier->count, 1);
+        if (__sync_bool_compare_and_swap(&barrier->count, size, 0)) {
+            barrier->passed++;
+        }
+        else {
+            while (barrier->passed == passed_old) {
+                plasma_barrier_pause(1);
+                sched_yield();
+            }
+        }
+        return;
+    }
+
+    plasma_barrier_slot_t *slot = &barrier->slots[rank];
+    int episode = (int)++slot->s.episode;
+    for (int r = 0; r < barrier->rounds; r++) {
+        plasma_barrier_slot_t *partner =
+            &barrier->slots[(rank + (1 << r)) % size];
+
+        __atomic_store_n(&partner->s.flag[r], episode, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&partner->s.sleeping, __ATOMIC_SEQ_CST))
+            plasma_barrier_wake(&partner->s.flag[r]);
+
+        plasma_barrier_await(slot, &slot->s.flag[r], episode);
+    }
+}
+
+/******************************************************************************/
+int plasma_progress_init(plasma_progress_t *progress, int size)
+{
+    progress->size = size;
+    progress->sleeping = 0;
+    progress->value = (volatile int*)calloc(size > 0 ? size : 1, sizeof(int));
+    if (progress->value == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_progress_destroy(plasma_progress_t *progress)
+{
+    free((void*)progress->value);
+    progress->value = NULL;
+}
+
+/******************************************************************************/
+// Sets the counter of entry i to value, releasing the writes before it,
+// and wakes the sleeping threads, if any.
+void plasma_progress_set(plasma_progress_t *progress, int i, int value)
+{
+    __atomic_store_n(&progress->value[i], value, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&progress->sleeping, __ATOMIC_SEQ_CST) > 0)
+        plasma_barrier_wake(&progress->value[i]);
+}
+
+/******************************************************************************/
+// Waits for the counter of entry i to reach value.
+// Spins first, with an exponential backoff, then sleeps.
+void plasma_progress_wait(plasma_progress_t *progress, int i, int value)
+{
+    volatile int *flag = &progress->value[i];
+    int backoff = 1;
+    for (int spins = 0; spins < PlasmaBarrierSpins; spins += backoff) {
+        if (plasma_barrier_reached(__atomic_load_n(flag, __ATOMIC_ACQUIRE),
+                                   value))
+            return;
+        plasma_barrier_pause(backoff);
+        if (backoff < PlasmaBarrierMaxBackoff)
+            backoff *= 2;
+    }
+    // The setting thread wakes the thread if it sees a thread sleeping,
+    // or the thread sees the counter set.
+    __atomic_add_fetch(&progress->sleeping, 1, __ATOMIC_SEQ_CST);
+    int current;
+    while (!plasma_barrier_reached(
+               current = __atomic_load_n(flag, __ATOMIC_SEQ_CST), value))
+        plasma_barrier_sleep(flag, current);
+    __atomic_sub_fetch(&progress->sleeping, 1, __ATOMIC_SEQ_CST);
+}
+
+/***************************************************************************//**
+    Runs func(args, rank, size, barrier) on a team of size ranks, and returns
+    when all of them have returned.
+
+    With PlasmaThreadTeam, the team is a nested parallel region of its own
+    threads, bound close to the calling thread, so that its ranks are
+    guaranteed to run at the same time, and the size is the number of threads
+    the runtime gives it, which may be less than requested, down to the
+    calling thread alone. The threads of ranks 1 to size-1 are pinned next
+    to the CPU of the calling thread, by the bind policy of
+    plasma_affinity_bind(), unless PlasmaBindNone. With PlasmaTaskTeam,
+    the ranks are tasks of the given priority, which meet at the barrier
+    only once the runtime has started all of them, spinning, then sleeping,
+    until then. With PlasmaBindFast, every rank, the calling thread
+    included, runs on the fast cores of a hybrid CPU, as the team is on the
+    critical path, and returns to its CPUs afterwards.
+*/
+void plasma_team_run(plasma_enum_t team, plasma_enum_t bind,
+                     int size, int priority,
+                     plasma_team_func_t func, void *args)
+{
+    plasma_barrier_t barrier;
+
+    int fast = bind == PlasmaBindFast;
+    if (size <= 1) {
+        plasma_barrier_init(&barrier, 1);
+        if (fast)
+            plasma_affinity_fast_enter();
+        func(args, 0, 1, &barrier);
+        if (fast)
+            plasma_affinity_fast_leave();
+        return;
+    }
+
+    if (team == PlasmaThreadTeam) {
+        // Allow the nested team, as deep as the calling task is.
+        int level = omp_get_active_level();
+        if (omp_get_max_active_levels() <= level)
+            omp_set_max_active_levels(level+1);
+
+        int first = plasma_affinity_self();
+
+        #pragma omp parallel num_threads(size) proc_bind(close)
+        {
+            int rank = omp_get_thread_num();
+            int num_threads = omp_get_num_threads();
+
+            #pragma omp single
+            plasma_barrier_init(&barrier, num_threads);
+
+            if (fast)
+                plasma_affinity_fast_enter();
+            else if (bind != PlasmaBindNone && rank > 0)
+                plasma_affinity_bind(bind, first, rank, num_threads);
 
-    __sync_fetch_and_add(&barrier->count, 1);
-    if (__sync_bool_compare_and_swap(&barrier->count, barrier->size, 0))
-        barrier->passed++;
-    else
-        while (barrier->passed == passed_old);
+            func(args, rank, num_threads, &barrier);
+            if (fast)
+                plasma_affinity_fast_leave();
+        }
+    }
+    else {
+        plasma_barrier_init(&barrier, size);
+        for (int rank = 0; rank < size; rank++) {
+            #pragma omp task shared(barrier) priority(priority)
+            {
+                if (fast)
+                    plasma_affinity_fast_enter();
+                func(args, rank, size, &barrier);
+                if (fast)
+                    plasma_affinity_fast_leave();
+            }
+        }
+        #pragma omp taskwait
+    }
 }
@@ -0,0 +1,83 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+// Orders the large problems first, then by decreasing cost, then by position.
+static int batch_compare(const void *a, const void *b)
+{
+    const plasma_batch_item_t *ia = (const plasma_batch_item_t*)a;
+    const plasma_batch_item_t *ib = (const plasma_batch_item_t*)b;
+    if (ia->large != ib->large)
+        return ib->large - ia->large;
+    if (ia->cost != ib->cost)
+        return (ia->cost < ib->cost) - (ia->cost > ib->cost);
+    return (ia->index > ib->index) - (ia->index < ib->index);
+}
+
+/***************************************************************************//**
+ *  Schedules the count problems of a variable-size batch, of the costs and
+ *  kinds set in items, for the tile size nb and num_threads threads.
+ *  Sorts items with the large problems first, each by decreasing cost, so
+ *  that the largest start first and the smallest fill the threads last.
+ *  The small problems are packed into tasks of about the cost of a tile
+ *  product, fewer for a few small problems, so that there are at least
+ *  four tasks per thread. Task j runs the items chunk[j] to chunk[j+1]-1,
+ *  chunk[0] being the number of large problems. chunk holds count+1
+ *  entries. Returns the number of tasks.
+ **/
+int plasma_batch_schedule(plasma_batch_item_t *items, int count,
+                          int nb, int num_threads, int *chunk)
+{
+    qsort(items, count, sizeof(plasma_batch_item_t), batch_compare);
+
+    int num_large = 0;
+    double small_cost = 0.0;
+    for (int l = 0; l < count; l++) {
+        if (items[l].large)
+            num_large++;
+        else
+            small_cost += items[l].cost;
+    }
+    double chunk_cost = fmin(2.0*nb*nb*nb, small_cost/(4*num_threads));
+
+    int num_chunks = 0;
+    double cost = 0.0;
+    chunk[0] = num_large;
+    for (int l = num_large; l < count; l++) {
+        cost += items[l].cost;
+        if (cost >= chunk_cost || l == count-1) {
+            chunk[++num_chunks] = l+1;
+            cost = 0.0;
+        }
+    }
+    return num_chunks;
+}
+
+/***************************************************************************//**
+ *  Destroys the tile matrices and the sequences of the first num_large
+ *  items of a batch, and frees items.
+ **/
+void plasma_batch_destroy(plasma_batch_item_t *items, int num_large)
+{
+    for (int l = 0; l < num_large; l++) {
+        for (int d = 0; d < items[l].num_descs; d++)
+            plasma_desc_destroy(&items[l].desc[d]);
+        plasma_sequence_destroy(items[l].sequence);
+    }
+    free(items);
+}
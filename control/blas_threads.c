@@ -0,0 +1,86 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_blas_threads.h"
+
+#include <omp.h>
+#include <pthread.h>
+
+#if defined(PLASMA_WITH_MKL)
+#include <mkl.h>
+#elif defined(PLASMA_WITH_OPENBLAS)
+int  openblas_get_num_threads(void);
+void openblas_set_num_threads(int num_threads);
+#endif
+
+#if defined(PLASMA_WITH_MKL) || defined(PLASMA_WITH_OPENBLAS)
+// Threads of the BLAS before the first plasma_init(), given back by the
+// last plasma_finalize().
+static int blas_threads_saved = 0;
+#endif
+static int blas_threads_users = 0;
+static pthread_mutex_t blas_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/***************************************************************************//**
+    Makes the BLAS single-threaded, saving its threads at the first call.
+    Called by plasma_init().
+*/
+void plasma_blas_threads_init()
+{
+    pthread_mutex_lock(&blas_threads_lock);
+    if (blas_threads_users++ == 0) {
+#if defined(PLASMA_WITH_MKL)
+        blas_threads_saved = mkl_get_max_threads();
+        mkl_set_num_threads(1);
+#elif defined(PLASMA_WITH_OPENBLAS)
+        blas_threads_saved = openblas_get_num_threads();
+        openblas_set_num_threads(1);
+#endif
+    }
+    pthread_mutex_unlock(&blas_threads_lock);
+}
+
+/***************************************************************************//**
+    Gives the BLAS back its threads at the last call.
+    Called by plasma_finalize().
+*/
+void plasma_blas_threads_finalize()
+{
+    pthread_mutex_lock(&blas_threads_lock);
+    if (blas_threads_users > 0 && --blas_threads_users == 0) {
+#if defined(PLASMA_WITH_MKL)
+        mkl_set_num_threads(blas_threads_saved);
+#elif defined(PLASMA_WITH_OPENBLAS)
+        openblas_set_num_threads(blas_threads_saved);
+#endif
+    }
+    pthread_mutex_unlock(&blas_threads_lock);
+}
+
+/***************************************************************************//**
+    Sets the threads of the BLAS called by the calling thread to num_threads,
+    allowing one more level of nested parallelism, and returns the previous
+    setting, to be restored by passing it back, 0 for the global one.
+    Returns 0 and does nothing unless the BLAS has a per-thread setting.
+*/
+int plasma_blas_threads_local(int num_threads)
+{
+#if defined(PLASMA_WITH_MKL)
+    if (num_threads > 1) {
+        int level = omp_get_active_level();
+        if (omp_get_max_active_levels() <= level)
+            omp_set_max_active_levels(level+1);
+    }
+    return mkl_set_num_threads_local(num_threads);
+#else
+    (void)num_threads;
+    return 0;
+#endif
+}
@@ -8,11 +8,22 @@
  *
  **/
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <omp.h>
 
+#include "core_blas.h"
+#include "plasma_affinity.h"
+#include "plasma_blas_threads.h"
 #include "plasma_context.h"
+#include "plasma_device.h"
 #include "plasma_internal.h"
+#include "plasma_mpi.h"
+#include "plasma_rh_tree.h"
+#include "plasma_starpu.h"
+#include "plasma_trace.h"
+#include "plasma_tuning.h"
 
 static int max_contexts = 1024;
 static int num_contexts = 0;
@@ -20,6 +31,10 @@ static int num_contexts = 0;
 plasma_context_map_t *context_map = NULL;
 pthread_mutex_t context_map_lock = PTHREAD_MUTEX_INITIALIZER;
 
+// Context of the calling thread, cached for lock-free lookup.
+// The context map remains the authority for attach and detach.
+static __thread plasma_context_t *context_self = NULL;
+
 /***************************************************************************//**
     @ingroup plasma_init
     Initializes PLASMA, allocating its context.
@@ -41,17 +56,197 @@ int plasma_init()
     }
     pthread_mutex_unlock(&context_map_lock);
 
+    // CPUs of the process, before PlasmaThreadBind pins any thread.
+    plasma_affinity_init();
+
+    // BLAS single-threaded in the tasks.
+    plasma_blas_threads_init();
+
     plasma_context_attach();
+
+    // Hardware counters of the tasks, if PLASMA_PAPI_EVENTS is set.
+    plasma_trace_papi_init();
+
+    // Annotations of the tasks for VTune and Nsight Systems, if built in.
+    plasma_trace_annotate_init();
+
+    // Tuned parameters of the routines, if PLASMA_TUNING_FILE is set.
+    plasma_tuning_init();
+
+#if defined(PLASMA_WITH_STARPU)
+    // StarPU workers, sized by STARPU_NCPU, next to the OpenMP threads.
+    if (starpu_init(NULL) != 0) {
+        plasma_error("starpu_init() failed");
+        return PlasmaErrorInternal;
+    }
+#endif
+    // Communicator of the distributed matrices, with PLASMA_WITH_MPI.
+    int retval = plasma_mpi_init();
+    if (retval != PlasmaSuccess)
+        return retval;
+
+#if defined(PLASMA_WITH_CUDA)
+    // Streams and cuBLAS handles of the threads, for PlasmaOffloadOn.
+    // The offloaded kernels fall back to the host without them.
+    plasma_device_init();
+#endif
+    // Threads, storage and BLAS warmed up, if PLASMA_WARMUP is set.
+    const char *warmup = getenv("PLASMA_WARMUP");
+    if (warmup != NULL) {
+        int n = 0;
+        int count = 3;
+        if (sscanf(warmup, "%d,%d", &n, &count) >= 1)
+            plasma_warmup(PlasmaRealDouble, n, count);
+    }
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+    @ingroup plasma_init
+    Warms PLASMA up for calls on n-by-n matrices of the given precision,
+    so that the first of them does not pay for starting the threads,
+    faulting in fresh storage, or initializing the BLAS:
+    - starts the threads of the context, pinned with PlasmaThreadBind,
+      and runs a small gemm on each of them,
+    - keeps the storage of count n-by-n tile matrices, first touched by
+      the threads, in the descriptor cache, up to PlasmaDescCacheSize,
+    - grows the per-thread workspace pool to a tile per thread, first
+      touched by its thread.
+    plasma_init() calls it for PLASMA_WARMUP="n[,count]", in double
+    precision, count 3 by default.
+*/
+int plasma_warmup(plasma_enum_t precision, int n, int count)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (precision != PlasmaRealFloat &&
+        precision != PlasmaRealDouble &&
+        precision != PlasmaComplexFloat &&
+        precision != PlasmaComplexDouble) {
+        plasma_error("illegal value of precision");
+        return PlasmaErrorIllegalValue;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return PlasmaErrorIllegalValue;
+    }
+    if (count < 0) {
+        plasma_error("illegal value of count");
+        return PlasmaErrorIllegalValue;
+    }
+    int nb = plasma->nb;
+    int mb = plasma_tile_mb(plasma, nb);
+
+    // Tile matrices, returned to the descriptor cache afterwards.
+    plasma_desc_t A[PlasmaDescCacheMaxSize];
+    int num_descs = n > 0 ? imin(count, plasma->desc_cache_size) : 0;
+    int retval = PlasmaSuccess;
+    for (int i = 0; i < num_descs; i++) {
+        retval = plasma_desc_general_create(precision, mb, nb,
+                                            n, n, 0, 0, n, n, &A[i]);
+        if (retval != PlasmaSuccess) {
+            num_descs = i;
+            break;
+        }
+    }
+    // a tile of workspace per thread
+    plasma_workspace_t work;
+    work.spaces = NULL;
+    work.nthread = 0;
+    work.lwork = 0;
+    if (retval == PlasmaSuccess)
+        retval = plasma_workspace_create(&work, (size_t)mb*nb, precision);
+    size_t lwork = work.lwork*plasma_element_size(precision);
+
+    #pragma omp parallel num_threads(plasma_num_threads(plasma))
+    {
+        int rank = omp_get_thread_num();
+        int size = omp_get_num_threads();
+
+        // a small gemm, initializing the BLAS of the thread
+        plasma_complex64_t a[16] = { 0.0 };
+        plasma_complex64_t c[16] = { 0.0 };
+        switch (precision) {
+        case PlasmaRealFloat:
+            core_sgemm(PlasmaNoTrans, PlasmaNoTrans, 4, 4, 4,
+                       1.0f, (float*)a, 4, (float*)a, 4,
+                       0.0f, (float*)c, 4);
+            break;
+        case PlasmaRealDouble:
+            core_dgemm(PlasmaNoTrans, PlasmaNoTrans, 4, 4, 4,
+                       1.0, (double*)a, 4, (double*)a, 4,
+                       0.0, (double*)c, 4);
+            break;
+        case PlasmaComplexFloat:
+            core_cgemm(PlasmaNoTrans, PlasmaNoTrans, 4, 4, 4,
+                       1.0f, (plasma_complex32_t*)a, 4,
+                             (plasma_complex32_t*)a, 4,
+                       0.0f, (plasma_complex32_t*)c, 4);
+            break;
+        case PlasmaComplexDouble:
+            core_zgemm(PlasmaNoTrans, PlasmaNoTrans, 4, 4, 4,
+                       1.0, a, 4, a, 4, 0.0, c, 4);
+            break;
+        }
+
+        // first touch of a slice of each tile matrix
+        for (int i = 0; i < num_descs; i++) {
+            size_t bytes = plasma_desc_storage_size(A[i]);
+            size_t begin = bytes*rank/size;
+            size_t end = bytes*(rank+1)/size;
+            memset((char*)A[i].matrix+begin, 0, end-begin);
+        }
+        // first touch of the workspace of the thread
+        if (rank < work.nthread)
+            memset(work.spaces[rank], 0, lwork);
+    }
+
+    if (work.spaces != NULL)
+        plasma_workspace_destroy(&work);
+    for (int i = 0; i < num_descs; i++)
+        plasma_desc_destroy(&A[i]);
+
+    return retval;
+}
+
 /***************************************************************************//**
     @ingroup plasma_init
     Finalizes PLASMA, freeing its context.
 */
 int plasma_finalize()
 {
+    // The trace is written before, by plasma_trace_write_svg/csv.
+    plasma_trace_papi_finalize();
+    plasma_trace_annotate_finalize();
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma != NULL && plasma->stats == PlasmaStatsOn)
+        plasma_stats_disable(plasma->stats_threads);
+    if (plasma != NULL && plasma->monitor == PlasmaMonitorOn)
+        plasma_monitor_disable(plasma->monitor_threads);
+    if (plasma != NULL && plasma->dry_run == PlasmaDryRunOn)
+        plasma_trace_dag_finalize();
+    if (plasma != NULL && plasma->trace == PlasmaTraceOn)
+        plasma_trace_finalize();
+
     plasma_context_detach();
+    plasma_blas_threads_finalize();
+
+    // Kernels of the full tiles, if generated by the MKL JIT.
+    core_sgemm_jit_finalize();
+    core_dgemm_jit_finalize();
+    core_cgemm_jit_finalize();
+    core_zgemm_jit_finalize();
+
+#if defined(PLASMA_WITH_STARPU)
+    starpu_shutdown();
+#endif
+#if defined(PLASMA_WITH_CUDA)
+    plasma_device_finalize();
+#endif
+    plasma_mpi_finalize();
     return PlasmaSuccess;
 }
 
@@ -80,20 +275,536 @@ int plasma_set(plasma_enum_t param, int value)
         }
         plasma->ib = value;
         break;
+    case PlasmaInplaceOutplace:
+        if (value != PlasmaInplace && value != PlasmaOutplace &&
+            value != PlasmaNoTranslation) {
+            plasma_error("invalid layout translation mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->inplace_outplace = value;
+        break;
     case PlasmaNumPanelThreads:
         if (value <= 0) {
             plasma_error("invalid number of panel threads");
             return PlasmaErrorIllegalValue;
         }
+        if (value != plasma->panel_work.size) {
+            plasma_panel_workspace_t panel_work;
+            int retval = plasma_panel_workspace_create(&panel_work, value);
+            if (retval != PlasmaSuccess)
+                return retval;
+            plasma_panel_workspace_destroy(&plasma->panel_work);
+            plasma->panel_work = panel_work;
+        }
         plasma->num_panel_threads = value;
         break;
+    case PlasmaPanelMode:
+        if (value != PlasmaIterativePanel &&
+            value != PlasmaRecursivePanel &&
+            value != PlasmaTournamentPanel) {
+            plasma_error("invalid panel mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->panel_mode = value;
+        break;
+    case PlasmaLookahead:
+        if (value < 0) {
+            plasma_error("invalid lookahead depth");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->lookahead = value;
+        break;
+    case PlasmaUpdateMode:
+        if (value != PlasmaColumnUpdate && value != PlasmaTileUpdate) {
+            plasma_error("invalid update mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->update_mode = value;
+        break;
+    case PlasmaLeftPivoting:
+        if (value != PlasmaLeftPivotingOff && value != PlasmaLeftPivotingOn) {
+            plasma_error("invalid left pivoting");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->left_pivoting = value;
+        break;
+    case PlasmaOffload:
+        if (value != PlasmaOffloadOff && value != PlasmaOffloadOn) {
+            plasma_error("invalid offload mode");
+            return PlasmaErrorIllegalValue;
+        }
+#if !defined(PLASMA_WITH_CUDA)
+        if (value == PlasmaOffloadOn) {
+            plasma_error("offload requires PLASMA_WITH_CUDA");
+            return PlasmaErrorNotSupported;
+        }
+#endif
+        plasma->offload = value;
+        break;
+    case PlasmaTuning:
+        if (value != PlasmaTuningOff && value != PlasmaTuningOn) {
+            plasma_error("invalid tuning mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tuning = value;
+        break;
+    case PlasmaCholeskyVariant:
+        if (value != PlasmaRightLooking &&
+            value != PlasmaLeftLooking &&
+            value != PlasmaHybridLooking) {
+            plasma_error("invalid Cholesky variant");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->cholesky_variant = value;
+        break;
+    case PlasmaCholeskySwitch:
+        if (value < 0) {
+            plasma_error("invalid Cholesky switch");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->cholesky_switch = value;
+        break;
+    case PlasmaTaskWindow:
+        if (value < 0) {
+            plasma_error("invalid task window");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->task_window = value;
+        break;
+    case PlasmaTrsmStream:
+        if (value < 0) {
+            plasma_error("invalid trsm stream");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->trsm_stream = value;
+        break;
+    case PlasmaGemmVariant:
+        if (value != PlasmaClassicGemm && value != PlasmaStrassenGemm &&
+            value != PlasmaPackedGemm && value != PlasmaGemm3m &&
+            value != PlasmaOzakiGemm) {
+            plasma_error("invalid gemm variant");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->gemm_variant = value;
+        break;
+    case PlasmaGelsVariant:
+        if (value != PlasmaClassicGels && value != PlasmaFusedGels) {
+            plasma_error("invalid gels variant");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->gels_variant = value;
+        break;
+    case PlasmaGetriVariant:
+        if (value != PlasmaClassicGetri && value != PlasmaGaussJordanGetri) {
+            plasma_error("invalid getri variant");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->getri_variant = value;
+        break;
+    case PlasmaGemmHint:
+        if (value != PlasmaGemmHintAuto && value != PlasmaGemmHintNone &&
+            value != PlasmaGemmHintRankK) {
+            plasma_error("invalid gemm hint");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->gemm_hint = value;
+        break;
+    case PlasmaPrefetch:
+        if (value != PlasmaPrefetchOff && value != PlasmaPrefetchOn) {
+            plasma_error("invalid prefetch mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->prefetch = value;
+        break;
+    case PlasmaTStorage:
+        if (value != PlasmaFullT && value != PlasmaCompactT) {
+            plasma_error("invalid T storage");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->t_storage = value;
+        break;
+    case PlasmaStrassenThreshold:
+        if (value <= 0) {
+            plasma_error("invalid Strassen threshold");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->strassen_threshold = value;
+        break;
+    case PlasmaStrassenLevels:
+        if (value <= 0 || value > PlasmaStrassenMaxLevels) {
+            plasma_error("invalid number of Strassen levels");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->strassen_levels = value;
+        break;
+    case PlasmaRefinementMode:
+        if (value != PlasmaClassicRefinement &&
+            value != PlasmaGmresRefinement) {
+            plasma_error("invalid refinement mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->refinement_mode = value;
+        break;
+    case PlasmaGmresRestart:
+        if (value <= 0) {
+            plasma_error("invalid GMRES restart length");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->gmres_restart = value;
+        break;
+    case PlasmaFactorPrecision:
+        if (value != PlasmaSingleFactor && value != PlasmaBfloat16Factor) {
+            plasma_error("invalid factorization precision");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->factor_precision = value;
+        break;
+    case PlasmaTileIo:
+        if (value != PlasmaBufferedIo && value != PlasmaDirectIo) {
+            plasma_error("invalid tile I/O mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_io = value;
+        break;
+    case PlasmaTrace:
+        if (value != PlasmaTraceOff && value != PlasmaTraceOn) {
+            plasma_error("invalid trace mode");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaTraceOn) {
+            // Restarts the trace.
+            int retval = plasma_trace_enable();
+            if (retval != PlasmaSuccess) {
+                plasma_error("plasma_trace_enable() failed");
+                return retval;
+            }
+        }
+        else {
+            plasma_trace_disable();
+        }
+        plasma->trace = value;
+        break;
+    case PlasmaStats:
+        if (value != PlasmaStatsOff && value != PlasmaStatsOn) {
+            plasma_error("invalid stats mode");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaStatsOn) {
+            // Counts the tasks of this context, from zero.
+            int retval = plasma_stats_enable(&plasma->stats_threads,
+                                             plasma->max_threads);
+            if (retval != PlasmaSuccess) {
+                plasma_error("plasma_stats_enable() failed");
+                return retval;
+            }
+        }
+        else if (plasma->stats == PlasmaStatsOn) {
+            plasma_stats_disable(plasma->stats_threads);
+        }
+        plasma->stats = value;
+        break;
+    case PlasmaDryRun:
+        if (value != PlasmaDryRunOff && value != PlasmaDryRunOn) {
+            plasma_error("invalid dry run mode");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaDryRunOn) {
+            // Restarts the task graph.
+            int retval = plasma_trace_dag_enable();
+            if (retval != PlasmaSuccess) {
+                plasma_error("plasma_trace_dag_enable() failed");
+                return retval;
+            }
+        }
+        else {
+            plasma_trace_dag_disable();
+        }
+        plasma->dry_run = value;
+        break;
+    case PlasmaTilePlacement:
+        if (value != PlasmaNoPlacement &&
+            value != PlasmaInterleavePlacement &&
+            value != PlasmaCyclicPlacement) {
+            plasma_error("invalid tile placement");
+            return PlasmaErrorIllegalValue;
+        }
+        // Cached storage keeps the placement of its first use.
+        plasma_context_cache_clear(plasma);
+        plasma->tile_placement = value;
+        break;
+    case PlasmaTileLayout:
+        if (value != PlasmaColumnMajorLayout &&
+            value != PlasmaMortonLayout) {
+            plasma_error("invalid tile layout");
+            return PlasmaErrorIllegalValue;
+        }
+        // Cached storage keeps the tiles placed in the layout of its
+        // first use.
+        plasma_context_cache_clear(plasma);
+        plasma->tile_layout = value;
+        break;
+    case PlasmaCoarsening:
+        if (value != PlasmaCoarseningOff && value != PlasmaCoarseningOn) {
+            plasma_error("invalid coarsening mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->coarsening = value;
+        break;
+    case PlasmaSweepMode:
+        if (value != PlasmaTileSweep && value != PlasmaColumnSweep) {
+            plasma_error("invalid sweep mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->sweep_mode = value;
+        break;
+    case PlasmaExpansion:
+        if (value != PlasmaExpansionOff && value != PlasmaExpansionOn) {
+            plasma_error("invalid expansion mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->expansion = value;
+        break;
+    case PlasmaTilePadding:
+        if (value < 0) {
+            plasma_error("invalid tile padding");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_padding = value;
+        break;
+    case PlasmaMb:
+        if (value < 0) {
+            plasma_error("invalid tile height");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->mb = value;
+        break;
+    case PlasmaTileBalance:
+        if (value != PlasmaTileBalanceOff && value != PlasmaTileBalanceOn) {
+            plasma_error("invalid tile balance");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_balance = value;
+        break;
+    case PlasmaAccumulation:
+        if (value != PlasmaOrderedAccumulation &&
+            value != PlasmaCommutativeAccumulation) {
+            plasma_error("invalid accumulation mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->accumulation = value;
+        break;
+    case PlasmaScheduling:
+        if (value != PlasmaDynamicScheduling &&
+            value != PlasmaStaticScheduling) {
+            plasma_error("invalid scheduling mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->scheduling = value;
+        break;
+    case PlasmaPanelTeam:
+        if (value != PlasmaThreadTeam &&
+            value != PlasmaTaskTeam) {
+            plasma_error("invalid panel team");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->panel_team = value;
+        break;
+    case PlasmaNumThreads:
+        if (value < 0) {
+            plasma_error("invalid number of threads");
+            return PlasmaErrorIllegalValue;
+        }
+        // Read by plasma_num_threads() of the other contexts.
+        pthread_mutex_lock(&context_map_lock);
+        plasma->num_threads = value;
+        pthread_mutex_unlock(&context_map_lock);
+        break;
+    case PlasmaThreadBind:
+        if (value != PlasmaBindNone &&
+            value != PlasmaBindClose &&
+            value != PlasmaBindSpread &&
+            value != PlasmaBindFast) {
+            plasma_error("invalid thread binding");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->thread_bind = value;
+        plasma->bound_threads = -1;
+        break;
+    case PlasmaPanelBind:
+        if (value != PlasmaBindNone &&
+            value != PlasmaBindClose &&
+            value != PlasmaBindSpread &&
+            value != PlasmaBindFast) {
+            plasma_error("invalid panel binding");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->panel_bind = value;
+        break;
+    case PlasmaFirstCpu:
+        if (value < 0) {
+            plasma_error("invalid first CPU");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->first_cpu = value;
+        plasma->bound_threads = -1;
+        break;
+    case PlasmaPanelBlasThreads:
+        if (value < 1) {
+            plasma_error("invalid number of panel BLAS threads");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->panel_blas_threads = value;
+        break;
+    case PlasmaArrayLayout:
+        if (value != PlasmaColMajor && value != PlasmaRowMajor) {
+            plasma_error("invalid array layout");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->array_layout = value;
+        break;
+    case PlasmaSubNb:
+        if (value < 0) {
+            plasma_error("invalid sub-tile size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->sub_nb = value;
+        break;
+    case PlasmaTailTiles:
+        if (value < 0) {
+            plasma_error("invalid number of tail tiles");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tail_tiles = value;
+        break;
+    case PlasmaGraphReplay:
+        if (value != PlasmaStaticReplay && value != PlasmaStealingReplay) {
+            plasma_error("invalid graph replay");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->graph_replay = value;
+        break;
+    case PlasmaRhsNb:
+        if (value < 0) {
+            plasma_error("invalid right-hand side tile width");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->rhs_nb = value;
+        break;
+    case PlasmaTileStructure:
+        if (value != PlasmaTileStructureOff &&
+            value != PlasmaTileStructureOn) {
+            plasma_error("invalid tile structure mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_structure = value;
+        break;
+    case PlasmaOzakiSlices:
+        if (value < 1 || value > PlasmaOzakiMaxSlices) {
+            plasma_error("invalid number of Ozaki slices");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->ozaki_slices = value;
+        break;
+    case PlasmaSmallPath:
+        if (value != PlasmaSmallPathOff &&
+            value != PlasmaSmallPathOn) {
+            plasma_error("invalid small path mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->small_path = value;
+        break;
+    case PlasmaMonitor:
+        if (value != PlasmaMonitorOff && value != PlasmaMonitorOn) {
+            plasma_error("invalid monitor mode");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaMonitorOn) {
+            // Monitors the tasks of this context, from zero.
+            int retval = plasma_monitor_enable(&plasma->monitor_threads,
+                                               plasma->max_threads);
+            if (retval != PlasmaSuccess) {
+                plasma_error("plasma_monitor_enable() failed");
+                return retval;
+            }
+        }
+        else if (plasma->monitor == PlasmaMonitorOn) {
+            plasma_monitor_disable(plasma->monitor_threads);
+        }
+        plasma->monitor = value;
+        break;
+    case PlasmaAllocator:
+        if (value != PlasmaMallocAllocator &&
+            value != PlasmaAlignedAllocator &&
+            value != PlasmaHugePageAllocator &&
+            value != PlasmaUserAllocator) {
+            plasma_error("invalid allocator");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaUserAllocator && plasma->allocator.alloc == NULL) {
+            plasma_error("user allocator not set");
+            return PlasmaErrorIllegalValue;
+        }
+        // Cached storage must be freed by the allocator that made it.
+        if (plasma->work_pool_lent) {
+            plasma_error("workspace in use");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma_context_cache_clear(plasma);
+        plasma_workspace_pool_clear(&plasma->work_pool, &plasma->allocator);
+        plasma->allocator.kind = value;
+        break;
     case PlasmaHouseholderMode:
-        if (value != PlasmaFlatHouseholder && value != PlasmaTreeHouseholder) {
+        if (value != PlasmaFlatHouseholder &&
+            value != PlasmaTreeHouseholder &&
+            value != PlasmaAutoHouseholder) {
             plasma_error("invalid Householder mode");
             return PlasmaErrorIllegalValue;
         }
         plasma->householder_mode = value;
         break;
+    case PlasmaHouseholderTree:
+        if (value != PlasmaAutoTree &&
+            value != PlasmaFlatTsTree &&
+            value != PlasmaFlatTtTree &&
+            value != PlasmaPlasmaTree &&
+            value != PlasmaGreedyTree &&
+            value != PlasmaAutoForestTree) {
+            plasma_error("invalid Householder tree");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->householder_tree = value;
+        break;
+    case PlasmaTreeDomainSize:
+        if (value <= 0) {
+            plasma_error("invalid tree domain size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tree_domain_size = value;
+        break;
+    case PlasmaTsBlock:
+        if (value < 0) {
+            plasma_error("invalid TS block size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->ts_block = value;
+        break;
+    case PlasmaHouseholderGroup:
+        if (value < 0 || value > PlasmaHouseholderMaxGroup) {
+            plasma_error("invalid Householder group size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->householder_group = value;
+        break;
+    case PlasmaDescCacheSize:
+        if (value < 0 || value > PlasmaDescCacheMaxSize) {
+            plasma_error("invalid descriptor cache size");
+            return PlasmaErrorIllegalValue;
+        }
+        pthread_mutex_lock(&plasma->desc_cache_lock);
+        plasma->desc_cache_size = value;
+        pthread_mutex_unlock(&plasma->desc_cache_lock);
+        plasma_context_cache_clear(plasma);
+        break;
     default:
         plasma_error("unknown parameter");
         return PlasmaErrorIllegalValue;
@@ -120,14 +831,242 @@ int plasma_get(plasma_enum_t param, int *value)
         *value = plasma->ib;
         return PlasmaSuccess;
         break;
+    case PlasmaInplaceOutplace:
+        *value = plasma->inplace_outplace;
+        return PlasmaSuccess;
+        break;
     case PlasmaNumPanelThreads:
         *value = plasma->num_panel_threads;
         return PlasmaSuccess;
         break;
+    case PlasmaPanelMode:
+        *value = plasma->panel_mode;
+        return PlasmaSuccess;
+        break;
+    case PlasmaLookahead:
+        *value = plasma->lookahead;
+        return PlasmaSuccess;
+        break;
+    case PlasmaUpdateMode:
+        *value = plasma->update_mode;
+        return PlasmaSuccess;
+        break;
+    case PlasmaLeftPivoting:
+        *value = plasma->left_pivoting;
+        return PlasmaSuccess;
+        break;
+    case PlasmaOffload:
+        *value = plasma->offload;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTuning:
+        *value = plasma->tuning;
+        return PlasmaSuccess;
+        break;
+    case PlasmaCholeskyVariant:
+        *value = plasma->cholesky_variant;
+        return PlasmaSuccess;
+        break;
+    case PlasmaCholeskySwitch:
+        *value = plasma->cholesky_switch;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTaskWindow:
+        *value = plasma->task_window;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTrsmStream:
+        *value = plasma->trsm_stream;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGemmVariant:
+        *value = plasma->gemm_variant;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGelsVariant:
+        *value = plasma->gels_variant;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGetriVariant:
+        *value = plasma->getri_variant;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGemmHint:
+        *value = plasma->gemm_hint;
+        return PlasmaSuccess;
+        break;
+    case PlasmaPrefetch:
+        *value = plasma->prefetch;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTStorage:
+        *value = plasma->t_storage;
+        return PlasmaSuccess;
+        break;
+    case PlasmaStrassenThreshold:
+        *value = plasma->strassen_threshold;
+        return PlasmaSuccess;
+        break;
+    case PlasmaStrassenLevels:
+        *value = plasma->strassen_levels;
+        return PlasmaSuccess;
+        break;
+    case PlasmaRefinementMode:
+        *value = plasma->refinement_mode;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGmresRestart:
+        *value = plasma->gmres_restart;
+        return PlasmaSuccess;
+        break;
+    case PlasmaFactorPrecision:
+        *value = plasma->factor_precision;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTileIo:
+        *value = plasma->tile_io;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTrace:
+        *value = plasma->trace;
+        return PlasmaSuccess;
+        break;
+    case PlasmaStats:
+        *value = plasma->stats;
+        return PlasmaSuccess;
+        break;
+    case PlasmaDryRun:
+        *value = plasma->dry_run;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTilePlacement:
+        *value = plasma->tile_placement;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTileLayout:
+        *value = plasma->tile_layout;
+        return PlasmaSuccess;
+        break;
+    case PlasmaCoarsening:
+        *value = plasma->coarsening;
+        return PlasmaSuccess;
+        break;
+    case PlasmaSweepMode:
+        *value = plasma->sweep_mode;
+        return PlasmaSuccess;
+        break;
+    case PlasmaExpansion:
+        *value = plasma->expansion;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTilePadding:
+        *value = plasma->tile_padding;
+        return PlasmaSuccess;
+        break;
+    case PlasmaMb:
+        *value = plasma->mb;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTileBalance:
+        *value = plasma->tile_balance;
+        return PlasmaSuccess;
+        break;
+    case PlasmaAccumulation:
+        *value = plasma->accumulation;
+        return PlasmaSuccess;
+        break;
+    case PlasmaScheduling:
+        *value = plasma->scheduling;
+        return PlasmaSuccess;
+        break;
+    case PlasmaPanelTeam:
+        *value = plasma->panel_team;
+        return PlasmaSuccess;
+        break;
+    case PlasmaNumThreads:
+        *value = plasma->num_threads;
+        return PlasmaSuccess;
+        break;
+    case PlasmaThreadBind:
+        *value = plasma->thread_bind;
+        return PlasmaSuccess;
+        break;
+    case PlasmaPanelBind:
+        *value = plasma->panel_bind;
+        return PlasmaSuccess;
+        break;
+    case PlasmaFirstCpu:
+        *value = plasma->first_cpu;
+        return PlasmaSuccess;
+        break;
+    case PlasmaPanelBlasThreads:
+        *value = plasma->panel_blas_threads;
+        return PlasmaSuccess;
+        break;
+    case PlasmaArrayLayout:
+        *value = plasma->array_layout;
+        return PlasmaSuccess;
+        break;
+    case PlasmaSubNb:
+        *value = plasma->sub_nb;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTailTiles:
+        *value = plasma->tail_tiles;
+        return PlasmaSuccess;
+        break;
+    case PlasmaGraphReplay:
+        *value = plasma->graph_replay;
+        return PlasmaSuccess;
+        break;
+    case PlasmaRhsNb:
+        *value = plasma->rhs_nb;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTileStructure:
+        *value = plasma->tile_structure;
+        return PlasmaSuccess;
+        break;
+    case PlasmaOzakiSlices:
+        *value = plasma->ozaki_slices;
+        return PlasmaSuccess;
+        break;
+    case PlasmaSmallPath:
+        *value = plasma->small_path;
+        return PlasmaSuccess;
+        break;
+    case PlasmaMonitor:
+        *value = plasma->monitor;
+        return PlasmaSuccess;
+        break;
+    case PlasmaAllocator:
+        *value = plasma->allocator.kind;
+        return PlasmaSuccess;
+        break;
     case PlasmaHouseholderMode:
         *value = plasma->householder_mode;
         return PlasmaSuccess;
         break;
+    case PlasmaHouseholderTree:
+        *value = plasma->householder_tree;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTreeDomainSize:
+        *value = plasma->tree_domain_size;
+        return PlasmaSuccess;
+        break;
+    case PlasmaTsBlock:
+        *value = plasma->ts_block;
+        return PlasmaSuccess;
+        break;
+    case PlasmaHouseholderGroup:
+        *value = plasma->householder_group;
+        return PlasmaSuccess;
+        break;
+    case PlasmaDescCacheSize:
+        *value = plasma->desc_cache_size;
+        return PlasmaSuccess;
+        break;
     default:
         plasma_error("Unknown parameter");
         return PlasmaErrorIllegalValue;
@@ -135,6 +1074,35 @@ int plasma_get(plasma_enum_t param, int *value)
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+    Sets user callbacks allocating the storage of descriptors and workspaces,
+    and selects them as the PlasmaAllocator.
+    The allocation callback may be called from several threads at once.
+*/
+int plasma_set_allocator(plasma_alloc_t alloc, plasma_dealloc_t dealloc)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (alloc == NULL || dealloc == NULL) {
+        plasma_error("NULL allocator callback");
+        return PlasmaErrorNullParameter;
+    }
+    // Cached storage must be freed by the allocator that made it.
+    if (plasma->work_pool_lent) {
+        plasma_error("workspace in use");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_context_cache_clear(plasma);
+    plasma_workspace_pool_clear(&plasma->work_pool, &plasma->allocator);
+    plasma->allocator.kind = PlasmaUserAllocator;
+    plasma->allocator.alloc = alloc;
+    plasma->allocator.dealloc = dealloc;
+    return PlasmaSuccess;
+}
+
 /******************************************************************************/
 int plasma_context_attach()
 {
@@ -142,14 +1110,18 @@ int plasma_context_attach()
 
     // Reallocate context map if out of space.
     if (num_contexts == max_contexts-1) {
-        max_contexts *= 2;
-        context_map = (plasma_context_map_t*) realloc(
-            &context_map, max_contexts*sizeof(plasma_context_map_t));
-        if (context_map == NULL) {
+        plasma_context_map_t *new_map = (plasma_context_map_t*) realloc(
+            context_map, 2*max_contexts*sizeof(plasma_context_map_t));
+        if (new_map == NULL) {
             pthread_mutex_unlock(&context_map_lock);
             plasma_error("realloc() failed");
             return PlasmaErrorOutOfMemory;
         }
+        // Clear the new slots.
+        for (int i = max_contexts; i < 2*max_contexts; i++)
+            new_map[i].context = NULL;
+        context_map = new_map;
+        max_contexts *= 2;
     }
     // Create the context.
     plasma_context_t *context;
@@ -162,12 +1134,22 @@ int plasma_context_attach()
     // Initialize the context.
     plasma_context_init(context);
 
+    // Allocate the panel scratch for the default number of panel threads.
+    int retval = plasma_panel_workspace_create(&context->panel_work,
+                                               context->num_panel_threads);
+    if (retval != PlasmaSuccess) {
+        free(context);
+        pthread_mutex_unlock(&context_map_lock);
+        return retval;
+    }
+
     // Find and empty slot and insert the context.
     for (int i = 0; i < max_contexts; i++) {
         if (context_map[i].context == NULL) {
             context_map[i].context = context;
             context_map[i].thread_id = pthread_self();
             num_contexts++;
+            context_self = context;
             pthread_mutex_unlock(&context_map_lock);
             return PlasmaSuccess;
         }
@@ -188,9 +1170,19 @@ int plasma_context_detach()
         if (context_map[i].context != NULL &&
             pthread_equal(context_map[i].thread_id, pthread_self())) {
 
+            plasma_context_cache_clear(context_map[i].context);
+            plasma_workspace_pool_clear(&context_map[i].context->work_pool,
+                                        &context_map[i].context->allocator);
+            plasma_panel_workspace_destroy(&context_map[i].context->panel_work);
+            plasma_rh_tree_cache_clear(context_map[i].context);
+            pthread_mutex_destroy(&context_map[i].context->tree_cache_lock);
+            pthread_mutex_destroy(&context_map[i].context->desc_cache_lock);
+            free(context_map[i].context->stats_threads);
+            free(context_map[i].context->monitor_threads);
             free(context_map[i].context);
             context_map[i].context = NULL;
             num_contexts--;
+            context_self = NULL;
             pthread_mutex_unlock(&context_map_lock);
             return PlasmaSuccess;
         }
@@ -203,15 +1195,21 @@ int plasma_context_detach()
 /******************************************************************************/
 plasma_context_t *plasma_context_self()
 {
+    // Fast path: the context cached at attach time.
+    if (context_self != NULL)
+        return context_self;
+
+    // Slow path: search the context map.
     pthread_mutex_lock(&context_map_lock);
 
     // Find the thread and return its context.
-    for (int i = 0; i < max_contexts; i++) {
+    for (int i = 0; context_map != NULL && i < max_contexts; i++) {
         if (context_map[i].context != NULL &&
             pthread_equal(context_map[i].thread_id, pthread_self())) {
 
+            context_self = context_map[i].context;
             pthread_mutex_unlock(&context_map_lock);
-            return context_map[i].context;
+            return context_self;
         }
     }
     pthread_mutex_unlock(&context_map_lock);
@@ -219,13 +1217,223 @@ plasma_context_t *plasma_context_self()
     return NULL;
 }
 
+/***************************************************************************//**
+    Makes the calling thread use the context, without attaching it, so that
+    the threads of a region opened on behalf of another thread, e.g., by a
+    session, see plasma_session_create(), find the context of that thread
+    in plasma_context_self(). NULL makes the thread look up its own again.
+*/
+void plasma_context_share(plasma_context_t *context)
+{
+    context_self = context;
+}
+
+/***************************************************************************//**
+    Returns the number of threads of the parallel regions of the calls of
+    the context. A context with a PlasmaNumThreads of n > 0 takes n threads,
+    and the contexts left at 0 share the threads left by those, evenly,
+    so that the calls of concurrent application threads, each attached to
+    its context, do not oversubscribe the machine. At least one thread.
+    Called outside of any parallel region, before the parallel region of
+    a call, pins its threads first with PlasmaThreadBind, if not done yet
+    for that number of threads.
+*/
+int plasma_num_threads(plasma_context_t *context)
+{
+    int num_threads = context->num_threads;
+    if (num_threads == 0) {
+        int reserved = 0;
+        int sharing = 0;
+        pthread_mutex_lock(&context_map_lock);
+        for (int i = 0; context_map != NULL && i < max_contexts; i++) {
+            plasma_context_t *other = context_map[i].context;
+            if (other == NULL)
+                continue;
+            if (other->num_threads > 0)
+                reserved += other->num_threads;
+            else
+                sharing++;
+        }
+        pthread_mutex_unlock(&context_map_lock);
+        num_threads = imax((context->max_threads-reserved)/imax(sharing, 1), 1);
+    }
+
+    // Pin the threads the runtime keeps for the calling thread.
+    if (!omp_in_parallel()) {
+        if (context->thread_bind != PlasmaBindNone &&
+            context->bound_threads != num_threads) {
+            plasma_affinity_team(context->thread_bind, context->first_cpu,
+                                 num_threads);
+            context->bound_threads = num_threads;
+        }
+        else if (context->thread_bind == PlasmaBindNone &&
+                 context->bound_threads != 0) {
+            plasma_affinity_team(PlasmaBindNone, 0,
+                                 imax(context->bound_threads, num_threads));
+            context->bound_threads = 0;
+        }
+    }
+    return num_threads;
+}
+
 /******************************************************************************/
 void plasma_context_init(plasma_context_t *context)
 {
     context->nb = 256;
+    context->mb = 0;
     context->ib = 64;
     context->inplace_outplace = PlasmaOutplace;
     context->max_threads = omp_get_max_threads();
+    context->num_threads = 0;
     context->num_panel_threads = 1;
-    context->householder_mode = PlasmaFlatHouseholder;
+    context->panel_mode = PlasmaIterativePanel;
+    context->lookahead = 1;
+    context->update_mode = PlasmaColumnUpdate;
+    context->left_pivoting = PlasmaLeftPivotingOn;
+    context->offload = PlasmaOffloadOff;
+    context->tuning = PlasmaTuningOn;
+    context->cholesky_variant = PlasmaRightLooking;
+    context->cholesky_switch = 16;
+    context->task_window = 0;
+    context->trsm_stream = 0;
+    context->gemm_variant = PlasmaClassicGemm;
+    context->gels_variant = PlasmaClassicGels;
+    context->getri_variant = PlasmaClassicGetri;
+    context->gemm_hint = PlasmaGemmHintAuto;
+    context->prefetch = PlasmaPrefetchOff;
+    context->strassen_threshold = 16;
+    context->strassen_levels = 2;
+    context->refinement_mode = PlasmaClassicRefinement;
+    context->gmres_restart = 30;
+    context->factor_precision = PlasmaSingleFactor;
+    context->tile_io = PlasmaBufferedIo;
+    context->trace = PlasmaTraceOff;
+    context->stats = PlasmaStatsOff;
+    context->stats_threads = NULL;
+    context->memory.current = 0;
+    context->memory.peak = 0;
+    context->memory.total = 0;
+    context->memory.allocs = 0;
+    context->dry_run = PlasmaDryRunOff;
+    context->panel_work.max_idx = NULL;
+    context->panel_work.max_val = NULL;
+    context->panel_work.info = 0;
+    context->panel_work.size = 0;
+    context->work_pool.spaces = NULL;
+    context->work_pool.lwork = 0;
+    context->work_pool.nthread = 0;
+    context->work_pool.dtyp = PlasmaByte;
+    context->work_pool.pooled = 0;
+    context->work_pool_lent = 0;
+    context->householder_mode = PlasmaAutoHouseholder;
+    context->householder_tree = PlasmaPlasmaTree;
+    context->t_storage = PlasmaCompactT;
+    context->tree_domain_size = 4;
+    context->ts_block = 0;
+    context->householder_group = 0;
+    context->tile_placement = PlasmaNoPlacement;
+    context->tile_layout = PlasmaColumnMajorLayout;
+    context->coarsening = PlasmaCoarseningOff;
+    context->sweep_mode = PlasmaTileSweep;
+    context->expansion = PlasmaExpansionOff;
+    context->tile_padding = 0;
+    context->tile_balance = PlasmaTileBalanceOff;
+    context->accumulation = PlasmaOrderedAccumulation;
+    context->scheduling = PlasmaDynamicScheduling;
+    context->panel_team = PlasmaThreadTeam;
+    context->thread_bind = PlasmaBindNone;
+    context->panel_bind = PlasmaBindNone;
+    context->first_cpu = 0;
+    context->panel_blas_threads = 1;
+    context->array_layout = PlasmaColMajor;
+    context->sub_nb = 0;
+    context->tail_tiles = 0;
+    context->graph_replay = PlasmaStaticReplay;
+    context->rhs_nb = 0;
+    context->tile_structure = PlasmaTileStructureOff;
+    context->ozaki_slices = 8;
+    context->small_path = PlasmaSmallPathOn;
+    context->monitor = PlasmaMonitorOff;
+    context->monitor_threads = NULL;
+    context->bound_threads = 0;
+    context->allocator.kind = PlasmaMallocAllocator;
+    context->allocator.alloc = NULL;
+    context->allocator.dealloc = NULL;
+    context->desc_cache_size = 4;
+    for (int i = 0; i < PlasmaDescCacheMaxSize; i++) {
+        context->desc_cache[i].matrix = NULL;
+        context->desc_cache[i].size = 0;
+    }
+    pthread_mutex_init(&context->desc_cache_lock, NULL);
+    for (int i = 0; i < PlasmaTreeCacheMaxSize; i++) {
+        context->tree_cache[i].operations = NULL;
+        context->tree_cache[i].users = 0;
+    }
+    context->tree_cache_next = 0;
+    pthread_mutex_init(&context->tree_cache_lock, NULL);
+}
+
+/***************************************************************************//**
+    Returns tile matrix storage of the given size from the descriptor cache,
+    or NULL if no cached buffer matches.
+    Replaces the allocate-and-free cycle of repeated calls of the same size.
+    Safe to call from the threads of the sessions of the context.
+*/
+void *plasma_context_cache_acquire(plasma_context_t *context, size_t size)
+{
+    void *matrix = NULL;
+    pthread_mutex_lock(&context->desc_cache_lock);
+    for (int i = 0; i < context->desc_cache_size; i++) {
+        if (context->desc_cache[i].matrix != NULL &&
+            context->desc_cache[i].size == size) {
+
+            matrix = context->desc_cache[i].matrix;
+            context->desc_cache[i].matrix = NULL;
+            context->desc_cache[i].size = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&context->desc_cache_lock);
+    return matrix;
+}
+
+/***************************************************************************//**
+    Returns tile matrix storage to the descriptor cache.
+    Frees the storage if the cache is full.
+*/
+void plasma_context_cache_release(plasma_context_t *context,
+                                  void *matrix, size_t size)
+{
+    if (matrix == NULL)
+        return;
+
+    pthread_mutex_lock(&context->desc_cache_lock);
+    for (int i = 0; i < context->desc_cache_size; i++) {
+        if (context->desc_cache[i].matrix == NULL) {
+            context->desc_cache[i].matrix = matrix;
+            context->desc_cache[i].size = size;
+            matrix = NULL;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&context->desc_cache_lock);
+    // The cache is full.
+    if (matrix != NULL)
+        plasma_allocator_free(&context->allocator, matrix, size);
+}
+
+/***************************************************************************//**
+    Frees all storage held in the descriptor cache.
+*/
+void plasma_context_cache_clear(plasma_context_t *context)
+{
+    pthread_mutex_lock(&context->desc_cache_lock);
+    for (int i = 0; i < PlasmaDescCacheMaxSize; i++) {
+        plasma_allocator_free(&context->allocator,
+                              context->desc_cache[i].matrix,
+                              context->desc_cache[i].size);
+        context->desc_cache[i].matrix = NULL;
+        context->desc_cache[i].size = 0;
+    }
+    pthread_mutex_unlock(&context->desc_cache_lock);
 }
@@ -0,0 +1,143 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_deque.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+static plasma_deque_buffer_t *plasma_deque_buffer(long size)
+{
+    plasma_deque_buffer_t *buffer = (plasma_deque_buffer_t*)malloc(
+        sizeof(plasma_deque_buffer_t) + (size_t)size*sizeof(int));
+    if (buffer != NULL) {
+        buffer->size = size;
+        buffer->prev = NULL;
+    }
+    return buffer;
+}
+
+/***************************************************************************//**
+    Initializes the empty deque, with room for size tasks before it grows,
+    rounded up to a power of two.
+*/
+int plasma_deque_init(plasma_deque_t *deque, long size)
+{
+    long pow2 = 64;
+    while (pow2 < size)
+        pow2 *= 2;
+
+    deque->s.top = 0;
+    deque->s.bottom = 0;
+    deque->s.buffer = plasma_deque_buffer(pow2);
+    if (deque->s.buffer == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Frees the buffers, once no thread uses the deque.
+void plasma_deque_destroy(plasma_deque_t *deque)
+{
+    plasma_deque_buffer_t *buffer = deque->s.buffer;
+    while (buffer != NULL) {
+        plasma_deque_buffer_t *prev = buffer->prev;
+        free(buffer);
+        buffer = prev;
+    }
+    deque->s.buffer = NULL;
+}
+
+/***************************************************************************//**
+    Pushes the task at the bottom. Called by the owner thread only.
+    Returns PlasmaErrorOutOfMemory if the deque is full and cannot grow.
+*/
+int plasma_deque_push(plasma_deque_t *deque, int task)
+{
+    long b = __atomic_load_n(&deque->s.bottom, __ATOMIC_RELAXED);
+    long t = __atomic_load_n(&deque->s.top, __ATOMIC_ACQUIRE);
+    plasma_deque_buffer_t *buffer =
+        __atomic_load_n(&deque->s.buffer, __ATOMIC_RELAXED);
+
+    if (b-t >= buffer->size) {
+        // Copy the tasks of the deque to a buffer twice as large.
+        plasma_deque_buffer_t *grown = plasma_deque_buffer(2*buffer->size);
+        if (grown == NULL)
+            return PlasmaErrorOutOfMemory;
+
+        for (long i = t; i < b; i++)
+            grown->task[i & (grown->size-1)] =
+                buffer->task[i & (buffer->size-1)];
+        grown->prev = buffer;
+        __atomic_store_n(&deque->s.buffer, grown, __ATOMIC_RELEASE);
+        buffer = grown;
+    }
+    buffer->task[b & (buffer->size-1)] = task;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&deque->s.bottom, b+1, __ATOMIC_RELAXED);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Takes the task at the bottom, the last pushed. Called by the owner
+    thread only. Returns -1 if the deque is empty.
+*/
+int plasma_deque_take(plasma_deque_t *deque)
+{
+    long b = __atomic_load_n(&deque->s.bottom, __ATOMIC_RELAXED)-1;
+    plasma_deque_buffer_t *buffer =
+        __atomic_load_n(&deque->s.buffer, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->s.bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long t = __atomic_load_n(&deque->s.top, __ATOMIC_RELAXED);
+
+    int task = -1;
+    if (t <= b) {
+        task = buffer->task[b & (buffer->size-1)];
+        if (t == b) {
+            // The last task, raced for by the thieves.
+            if (!__atomic_compare_exchange_n(&deque->s.top, &t, t+1, 0,
+                                             __ATOMIC_SEQ_CST,
+                                             __ATOMIC_RELAXED))
+                task = -1;
+            __atomic_store_n(&deque->s.bottom, b+1, __ATOMIC_RELAXED);
+        }
+    }
+    else {
+        __atomic_store_n(&deque->s.bottom, b+1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+/***************************************************************************//**
+    Steals the task at the top, the first pushed. Called by any thread.
+    Returns -1 if the deque is empty, or if another thread took the task
+    first.
+*/
+int plasma_deque_steal(plasma_deque_t *deque)
+{
+    long t = __atomic_load_n(&deque->s.top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long b = __atomic_load_n(&deque->s.bottom, __ATOMIC_ACQUIRE);
+
+    if (t >= b)
+        return -1;
+
+    plasma_deque_buffer_t *buffer =
+        __atomic_load_n(&deque->s.buffer, __ATOMIC_ACQUIRE);
+    int task = buffer->task[t & (buffer->size-1)];
+    if (!__atomic_compare_exchange_n(&deque->s.top, &t, t+1, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        return -1;
+
+    return task;
+}
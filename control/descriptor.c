@@ -11,6 +11,295 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_rh_tree.h"
+#include "plasma_trace.h"
+
+#include <omp.h>
+#include <string.h>
+
+/******************************************************************************/
+// Returns the number of elements of the storage of the tile (m, n) of A,
+// padding included.
+static size_t plasma_desc_tile_size(const plasma_desc_t *A, int m, int n)
+{
+    int mb = m < A->lm1 ? A->mb : A->gm - A->lm1*A->mb;
+    int nb = n < A->ln1 ? A->nb : A->gn - A->ln1*A->nb;
+    return (size_t)(mb + A->ldpad)*nb;
+}
+
+/******************************************************************************/
+// Touches the tiles of A first from the threads bound to their places,
+// so that the operating system maps each tile to the memory of its place.
+static void plasma_desc_first_touch(plasma_desc_t A)
+{
+    // Place the whole storage, in storage coordinates.
+    plasma_desc_t B = A;
+    B.type = PlasmaGeneral;
+    B.i = 0;
+    B.j = 0;
+    B.it = 0;
+    B.jt = 0;
+    size_t eltsize = A.eltsize;
+
+    int *thread_place = (int*)malloc(omp_get_max_threads()*sizeof(int));
+    if (thread_place == NULL)
+        return;
+
+    #pragma omp parallel
+    {
+        int thread = omp_get_thread_num();
+        int num_threads = omp_get_num_threads();
+        int place = omp_get_place_num();
+        thread_place[thread] = place;
+        #pragma omp barrier
+
+        // rank and count of the threads sharing this place
+        int rank = 0;
+        int size = 0;
+        for (int i = 0; i < num_threads; i++) {
+            if (thread_place[i] == place) {
+                if (i < thread)
+                    rank++;
+                size++;
+            }
+        }
+        // Split the tiles of the place among its threads.
+        int count = 0;
+        for (int n = 0; n < B.gnt; n++) {
+            for (int m = 0; m < B.gmt; m++) {
+                if (place >= 0 && plasma_tile_stored_general(B, m, n) &&
+                    plasma_tile_place_general(B, m, n) == place) {
+                    if (count%size == rank) {
+                        memset(plasma_tile_addr_general(B, m, n), 0,
+                               plasma_desc_tile_size(&B, m, n)*eltsize);
+                    }
+                    count++;
+                }
+            }
+        }
+    }
+    free(thread_place);
+}
+
+/******************************************************************************/
+// Sets the offsets of the tiles of the s-by-s block of tiles at (m0, n0)
+// in Morton order, from offset, and returns the offset following them.
+// The quadrants are stored in column-major order, and the quadrants
+// outside of the matrix are empty.
+static size_t plasma_desc_morton_fill(plasma_desc_t *A, int m0, int n0,
+                                      int s, size_t offset)
+{
+    if (m0 >= A->gmt || n0 >= A->gnt)
+        return offset;
+
+    if (s == 1) {
+        A->tile_offset[m0 + (size_t)A->gmt*n0] = offset;
+        return offset + plasma_desc_tile_size(A, m0, n0);
+    }
+    s /= 2;
+    offset = plasma_desc_morton_fill(A, m0,   n0,   s, offset);
+    offset = plasma_desc_morton_fill(A, m0+s, n0,   s, offset);
+    offset = plasma_desc_morton_fill(A, m0,   n0+s, s, offset);
+    return   plasma_desc_morton_fill(A, m0+s, n0+s, s, offset);
+}
+
+/******************************************************************************/
+// Lays out the tiles of A in Morton order, so that the neighboring tiles
+// of the recursive algorithms are close in memory. The storage keeps the
+// size of the column-major layout.
+static int plasma_desc_morton_create(plasma_desc_t *A)
+{
+    A->tile_offset =
+        (size_t*)malloc((size_t)A->gmt*A->gnt*sizeof(size_t));
+    if (A->tile_offset == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    int s = 1;
+    while (s < A->gmt || s < A->gnt)
+        s *= 2;
+
+    plasma_desc_morton_fill(A, 0, 0, s, 0);
+    A->layout = PlasmaMortonLayout;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Lays out the padded tiles of A column by column of tiles.
+static int plasma_desc_padded_create(plasma_desc_t *A)
+{
+    A->tile_offset =
+        (size_t*)malloc((size_t)A->gmt*A->gnt*sizeof(size_t));
+    if (A->tile_offset == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    size_t offset = 0;
+    for (int n = 0; n < A->gnt; n++) {
+        for (int m = 0; m < A->gmt; m++) {
+            A->tile_offset[m + (size_t)A->gmt*n] = offset;
+            offset += plasma_desc_tile_size(A, m, n);
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Packs the tiles of the uplo triangle of the square matrix A column by
+// column. The tiles outside of the triangle alias their transposed tile,
+// so that their addresses stay valid, but are never stored.
+static int plasma_desc_triangular_layout(plasma_desc_t *A)
+{
+    A->tile_offset =
+        (size_t*)malloc((size_t)A->gmt*A->gnt*sizeof(size_t));
+    if (A->tile_offset == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    A->layout = PlasmaTriangularLayout;
+
+    size_t offset = 0;
+    for (int n = 0; n < A->gnt; n++) {
+        for (int m = 0; m < A->gmt; m++) {
+            if (plasma_tile_stored_general(*A, m, n)) {
+                A->tile_offset[m + (size_t)A->gmt*n] = offset;
+                offset += plasma_desc_tile_size(A, m, n);
+            }
+        }
+    }
+    for (int n = 0; n < A->gnt; n++)
+        for (int m = 0; m < A->gmt; m++)
+            if (!plasma_tile_stored_general(*A, m, n))
+                A->tile_offset[m + (size_t)A->gmt*n] =
+                    A->tile_offset[n + (size_t)A->gmt*m];
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Packs the tiles of the pattern of A column by column, followed by the
+// tile of zeros aliased by all of the empty tiles.
+static int plasma_desc_sparse_layout(plasma_desc_t *A, const int *pattern)
+{
+    size_t count = (size_t)A->gmt*A->gnt;
+    A->tile_offset = (size_t*)malloc(count*sizeof(size_t));
+    A->tile_pattern = (int*)malloc(count*sizeof(int));
+    if (A->tile_offset == NULL || A->tile_pattern == NULL) {
+        free(A->tile_offset);
+        A->tile_offset = NULL;
+        free(A->tile_pattern);
+        A->tile_pattern = NULL;
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    A->layout = PlasmaSparseLayout;
+
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        A->tile_pattern[i] = pattern[i] != 0;
+        if (A->tile_pattern[i]) {
+            A->tile_offset[i] = offset;
+            offset += plasma_desc_tile_size(A, i%A->gmt, i/A->gmt);
+        }
+    }
+    for (size_t i = 0; i < count; i++)
+        if (!A->tile_pattern[i])
+            A->tile_offset[i] = offset;
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Allocates the tile storage of A, reusing cached storage if possible.
+// Applies the tile placement and layout of the context to fresh storage,
+// unless A already has its own layout or is packed, and lays out padded
+// tiles. With zero, the storage is set to zero, fresh from the allocator
+// rather than from the descriptor cache.
+static int plasma_desc_matrix_create(plasma_context_t *plasma,
+                                     plasma_desc_t *A, int zero)
+{
+    if (A->tile_offset == NULL && A->rate == 0) {
+        int retval = PlasmaSuccess;
+        if (plasma->tile_layout == PlasmaMortonLayout)
+            retval = plasma_desc_morton_create(A);
+        else if (A->ldpad > 0)
+            retval = plasma_desc_padded_create(A);
+        if (retval != PlasmaSuccess)
+            return retval;
+    }
+    // Placement needs threads bound to at least two places.
+    int num_places = omp_get_num_places();
+    if (plasma->tile_placement != PlasmaNoPlacement &&
+        omp_get_proc_bind() != omp_proc_bind_false && num_places > 1) {
+        A->placement = plasma->tile_placement;
+        A->num_places = num_places;
+        // the most square grid of places
+        A->place_rows = 1;
+        for (int p = 1; p*p <= num_places; p++)
+            if (num_places%p == 0)
+                A->place_rows = p;
+    }
+    size_t size = plasma_desc_storage_size(*A);
+    if (!zero) {
+        A->matrix = plasma_context_cache_acquire(plasma, size);
+        if (A->matrix != NULL) {
+            plasma_stats_memory_acquire(plasma, size);
+            plasma_trace_desc(*A);
+            return PlasmaSuccess;
+        }
+    }
+
+    A->matrix = zero ? plasma_allocator_alloc_zero(&plasma->allocator, size)
+                     : plasma_allocator_alloc(&plasma->allocator, size);
+    if (A->matrix == NULL) {
+        free(A->tile_offset);
+        A->tile_offset = NULL;
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    // A dry run leaves fresh storage untouched, only counting it.
+    if (A->placement != PlasmaNoPlacement &&
+        plasma->dry_run != PlasmaDryRunOn)
+        plasma_desc_first_touch(*A);
+
+    A->zero = zero;
+    plasma_stats_memory_acquire(plasma, size);
+    plasma_trace_desc(*A);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Creates a general tile matrix whose tiles have the leading dimension
+// padding ldpad, set to zero with zero.
+static int plasma_desc_general_pad_create(plasma_context_t *plasma,
+                                          plasma_enum_t precision,
+                                          int mb, int nb, int lm, int ln,
+                                          int i, int j, int m, int n,
+                                          int ldpad, int zero,
+                                          plasma_desc_t *A)
+{
+    // Initialize the descriptor.
+    int retval = plasma_desc_general_init(precision, NULL, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    A->ldpad = ldpad;
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    // Allocate the matrix.
+    retval = plasma_desc_matrix_create(plasma, A, zero);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_matrix_create() failed");
+        return retval;
+    }
+    return PlasmaSuccess;
+}
 
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
@@ -22,6 +311,59 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
+    return plasma_desc_general_pad_create(plasma, precision, mb, nb,
+                                          lm, ln, i, j, m, n,
+                                          plasma->tile_padding, 0, A);
+}
+
+/***************************************************************************//**
+    Creates a general tile matrix as plasma_desc_general_create, with all of
+    its storage zero. The storage is fresh from the allocator, whose zero
+    pages cost nothing until first touched, instead of a pass of laset over
+    reused storage. The descriptor is marked zero, so that plasma_pzlaset
+    with alpha = 0 only sets the diagonal tiles; the routines creating such
+    a descriptor must set it by laset, if at all, before anything else
+    writes it, as the mark is not cleared by the writes.
+*/
+int plasma_desc_general_zero_create(plasma_enum_t precision, int mb, int nb,
+                                    int lm, int ln, int i, int j, int m, int n,
+                                    plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    return plasma_desc_general_pad_create(plasma, precision, mb, nb,
+                                          lm, ln, i, j, m, n,
+                                          plasma->tile_padding, 1, A);
+}
+
+/***************************************************************************//**
+    Creates a square tile matrix storing only the tiles of its uplo triangle,
+    diagonal tiles included, for the routines referencing one triangle of
+    a Hermitian, symmetric or triangular matrix. plasma_pzge2desc and
+    plasma_pzdesc2ge translate only the stored tiles, and the tasks must not
+    touch the other ones.
+*/
+int plasma_desc_triangular_create(plasma_enum_t precision, plasma_enum_t uplo,
+                                  int mb, int nb, int lm, int ln,
+                                  int i, int j, int m, int n,
+                                  plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        plasma_error("illegal value of uplo");
+        return PlasmaErrorIllegalValue;
+    }
+    if (mb != nb || lm != ln) {
+        plasma_error("triangular layout of a non-square matrix");
+        return PlasmaErrorIllegalValue;
+    }
     // Initialize the descriptor.
     int retval = plasma_desc_general_init(precision, NULL, mb, nb,
                                           lm, ln, i, j, m, n, A);
@@ -29,23 +371,179 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
         plasma_error("plasma_desc_general_init() failed");
         return retval;
     }
+    A->uplo = uplo;
+    A->ldpad = plasma->tile_padding;
     // Check the descriptor.
     retval = plasma_desc_check(*A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_check() failed");
         return PlasmaErrorIllegalValue;
     }
-    // Allocate the matrix.
-    size_t size = (size_t)A->gm*A->gn*
-                  plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
+    // Lay out and allocate the matrix.
+    retval = plasma_desc_triangular_layout(A);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_desc_matrix_create(plasma, A, 0);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_matrix_create() failed");
+        return retval;
     }
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+    Creates a block-sparse tile matrix storing only the tiles of pattern,
+    the lmt-by-lnt column-major array, of leading dimension lmt, of the
+    grid of tiles, nonzero for each tile stored. The empty tiles read as
+    zero: plasma_pzgemm and plasma_pzpotrf skip them, the pattern of C in
+    plasma_pzgemm must hold the tiles of the product, checked by
+    plasma_desc_sparse_product, and that of A in plasma_pzpotrf the fill-in
+    of the factorization, added by plasma_desc_sparse_fill. The other
+    routines may read the matrix, but must not write its empty tiles.
+    plasma_pzge2desc and plasma_pzdesc2ge translate only the stored tiles.
+*/
+int plasma_desc_sparse_create(plasma_enum_t precision, const int *pattern,
+                              int mb, int nb, int lm, int ln,
+                              int i, int j, int m, int n,
+                              plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (pattern == NULL) {
+        plasma_error("NULL pattern");
+        return PlasmaErrorNullParameter;
+    }
+    // Initialize the descriptor.
+    int retval = plasma_desc_general_init(precision, NULL, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    A->ldpad = plasma->tile_padding;
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    // Lay out and allocate the matrix.
+    retval = plasma_desc_sparse_layout(A, pattern);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_desc_matrix_create(plasma, A, 0);
+    if (retval != PlasmaSuccess) {
+        free(A->tile_pattern);
+        A->tile_pattern = NULL;
+        plasma_error("plasma_desc_matrix_create() failed");
+        return retval;
+    }
+    // Zero the tile of the empty tiles, after the stored tiles.
+    size_t size = (size_t)(A->mb + A->ldpad)*A->nb*A->eltsize;
+    memset((char*)A->matrix + plasma_desc_storage_size(*A) - size, 0, size);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Adds to pattern, the nt-by-nt column-major array of the grid of tiles of
+    a Hermitian positive definite matrix, nonzero for each nonzero tile, the
+    tiles of its uplo triangle filled in by the Cholesky factorization, and
+    its diagonal tiles. The tile (m, n), m > n, of the lower factor is
+    nonzero if the tiles (m, k) and (n, k) are, for some k < n. Returns the
+    number of tiles added.
+*/
+int plasma_desc_sparse_fill(plasma_enum_t uplo, int nt, int *pattern)
+{
+    int count = 0;
+    for (int k = 0; k < nt; k++) {
+        if (!pattern[k + (size_t)nt*k]) {
+            pattern[k + (size_t)nt*k] = 1;
+            count++;
+        }
+        for (int n = k+1; n < nt; n++) {
+            size_t nk = uplo == PlasmaLower ? n + (size_t)nt*k
+                                            : k + (size_t)nt*n;
+            if (!pattern[nk])
+                continue;
+
+            for (int m = n+1; m < nt; m++) {
+                size_t mk = uplo == PlasmaLower ? m + (size_t)nt*k
+                                                : k + (size_t)nt*m;
+                size_t mn = uplo == PlasmaLower ? m + (size_t)nt*n
+                                                : n + (size_t)nt*m;
+                if (pattern[mk] && !pattern[mn]) {
+                    pattern[mn] = 1;
+                    count++;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/***************************************************************************//**
+    Returns 1 if the tiles of the square matrix A stored hold its Cholesky
+    factor, i.e., its diagonal tiles and the fill-in of its uplo triangle,
+    as added by plasma_desc_sparse_fill, 0 otherwise.
+*/
+int plasma_desc_sparse_filled(plasma_enum_t uplo, plasma_desc_t A)
+{
+    for (int k = 0; k < A.mt; k++) {
+        if (!plasma_tile_stored(A, k, k))
+            return 0;
+
+        for (int n = k+1; n < A.mt; n++) {
+            if (uplo == PlasmaLower ? !plasma_tile_stored(A, n, k)
+                                    : !plasma_tile_stored(A, k, n))
+                continue;
+
+            for (int m = n+1; m < A.mt; m++) {
+                if (uplo == PlasmaLower
+                    ? plasma_tile_stored(A, m, k) &&
+                      !plasma_tile_stored(A, m, n)
+                    : plasma_tile_stored(A, k, m) &&
+                      !plasma_tile_stored(A, n, m))
+                    return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/***************************************************************************//**
+    Returns 1 if the tiles of C stored hold the product op(A)*op(B), i.e.,
+    the tile (m, n) is stored if the tiles (m, k) of op(A) and (k, n) of
+    op(B) are, for some k, 0 otherwise.
+*/
+int plasma_desc_sparse_product(plasma_enum_t transa, plasma_enum_t transb,
+                               plasma_desc_t A, plasma_desc_t B,
+                               plasma_desc_t C)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+    for (int n = 0; n < C.nt; n++) {
+        for (int m = 0; m < C.mt; m++) {
+            if (plasma_tile_stored(C, m, n))
+                continue;
+
+            for (int k = 0; k < kt; k++) {
+                int am = transa == PlasmaNoTrans ? m : k;
+                int an = transa == PlasmaNoTrans ? k : m;
+                int bm = transb == PlasmaNoTrans ? k : n;
+                int bn = transb == PlasmaNoTrans ? n : k;
+                if (plasma_tile_stored(A, am, an) &&
+                    plasma_tile_stored(B, bm, bn))
+                    return 0;
+            }
+        }
+    }
+    return 1;
+}
+
 /******************************************************************************/
 int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
                                     int mb, int nb, int lm, int ln,
@@ -71,16 +569,275 @@ int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
         return PlasmaErrorIllegalValue;
     }
     // Allocate the matrix.
+    retval = plasma_desc_matrix_create(plasma, A, 0);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_matrix_create() failed");
+        return retval;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Creates a general tile matrix stored in the file path, mapped in memory,
+    for matrices larger than the memory: the system pages the tiles in and
+    out, and the factorizations read ahead the tiles of their next panel
+    by plasma_desc_prefetch. The file holds the tile layout of the whole
+    matrix. It is created or extended if needed, and its content is kept,
+    so that a matrix from an earlier run can be reused.
+*/
+int plasma_desc_general_mmap_create(plasma_enum_t precision, int mb, int nb,
+                                    int lm, int ln, int i, int j, int m, int n,
+                                    const char *path, plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (path == NULL) {
+        plasma_error("NULL path");
+        return PlasmaErrorNullParameter;
+    }
+    // Initialize the descriptor.
+    int retval = plasma_desc_general_init(precision, NULL, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    // Map the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    A->matrix = plasma_allocator_map_file(path, size);
     if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
+        plasma_error("mapping the file failed");
         return PlasmaErrorOutOfMemory;
     }
+    A->mapped = 1;
+    plasma_trace_desc(*A);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Creates a general tile matrix whose tiles are packed at the fixed rate
+    of rate bytes per real number, for the memory-bound routines, which then
+    move fewer bytes. core_zpack keeps the sign, the exponent and the leading
+    bits of the significand of each real number, rounded to the nearest,
+    so the relative error of an element is at most 2^(11-8*rate) in double
+    precision, 2^(8-8*rate) in single precision, and none with rate equal
+    to the size of the real type. Rate 2 is bfloat16 in single precision.
+    The fixed rate keeps the tile addressing, with the element size of the
+    packed elements. Only the translations plasma_omp_zge2desc and
+    plasma_omp_zdesc2ge, plasma_omp_zlange, plasma_omp_zlacpy and
+    plasma_omp_zgeadd accept packed tile matrices.
+*/
+int plasma_desc_general_packed_create(plasma_enum_t precision, int rate,
+                                      int mb, int nb, int lm, int ln,
+                                      int i, int j, int m, int n,
+                                      plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    // Initialize the descriptor.
+    int retval = plasma_desc_general_init(precision, NULL, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // real numbers per element
+    int count = precision == PlasmaComplexFloat ||
+                precision == PlasmaComplexDouble ? 2 : 1;
+    size_t realsize = plasma_element_size(precision)/count;
+    if (rate < 2 || (size_t)rate > realsize) {
+        plasma_error("illegal value of rate");
+        return PlasmaErrorIllegalValue;
+    }
+    A->rate = rate;
+    A->eltsize = (size_t)rate*count;
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    // Allocate the matrix.
+    retval = plasma_desc_matrix_create(plasma, A, 0);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_matrix_create() failed");
+        return retval;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Submits a task starting to read the tiles m1 to m2 of the tile columns
+    n1 to n2 of A, if A is mapped from a file, once the tasks submitted before
+    and writing the tile after are done. The task does not wait for the reads.
+    Nothing is read if after is NULL.
+*/
+void plasma_desc_prefetch(plasma_desc_t A, int m1, int m2, int n1, int n2,
+                          void *after)
+{
+    if (!A.mapped || after == NULL)
+        return;
+
+    m2 = imin(m2, A.mt-1);
+    n2 = imin(n2, A.nt-1);
+    if (m1 > m2 || n1 > n2)
+        return;
+
+    size_t eltsize = plasma_element_size(A.precision);
+    char *dep = (char*)after;
+    #pragma omp task depend(in:dep[0])
+    {
+        // The tile only orders the prefetch after its producer.
+        (void)dep;
+        for (int n = n1; n <= n2; n++) {
+            for (int m = m1; m <= m2; m++) {
+                plasma_allocator_prefetch(
+                    plasma_tile_addr(A, m, n),
+                    (size_t)plasma_tile_mmain(A, m)*
+                    plasma_tile_nmain(A, n)*eltsize);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+    Creates the m-by-n tile matrix of the LAPACK interface for the
+    column-major array pA. If PlasmaInplaceOutplace is PlasmaInplace,
+    lda = m and PlasmaArrayLayout is PlasmaColMajor, the tiles are the array
+    pA itself, which plasma_pzge2desc and plasma_pzdesc2ge then translate
+    in place. Otherwise, the tiles are allocated as by
+    plasma_desc_general_create.
+*/
+int plasma_desc_lapack_create(plasma_enum_t precision, void *pA, int lda,
+                              int mb, int nb, int m, int n,
+                              plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->inplace_outplace != PlasmaInplace || lda != m ||
+        plasma->array_layout != PlasmaColMajor ||
+        pA == NULL || m == 0 || n == 0)
+        return plasma_desc_general_create(precision, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+
+    int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    A->translation = PlasmaInplace;
+    plasma_trace_desc(*A);
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+    Creates the m-by-n tile matrix of the LAPACK interface for the
+    column-major array pA, for the routines whose tasks take tiles of any
+    leading dimension, such as gemm and trsm. If PlasmaInplaceOutplace is
+    PlasmaNoTranslation and PlasmaArrayLayout is PlasmaColMajor, the tiles
+    are views of the array pA with its leading dimension lda, in the
+    PlasmaLapackLayout tile layout, which plasma_pzge2desc and
+    plasma_pzdesc2ge then leave as they are, and the tasks keep their
+    dependencies on the tiles. Otherwise, the tiles are
+    allocated as by plasma_desc_general_create, since the routines do not
+    translate their input arrays back from an in-place translation.
+*/
+int plasma_desc_lapack_view_create(plasma_enum_t precision, void *pA, int lda,
+                                   int mb, int nb, int m, int n,
+                                   plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->inplace_outplace != PlasmaNoTranslation ||
+        plasma->array_layout != PlasmaColMajor ||
+        pA == NULL || m == 0 || n == 0)
+        return plasma_desc_general_create(precision, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+
+    return plasma_desc_lapack_view_init(precision, pA, lda, mb, nb, m, n, A);
+}
+
+/***************************************************************************//**
+    Initializes the m-by-n tile matrix whose tiles are views of the
+    column-major array pA, with its leading dimension lda, in the
+    PlasmaLapackLayout tile layout, whatever PlasmaInplaceOutplace.
+*/
+int plasma_desc_lapack_view_init(plasma_enum_t precision, void *pA, int lda,
+                                 int mb, int nb, int m, int n,
+                                 plasma_desc_t *A)
+{
+    int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return PlasmaErrorIllegalValue;
+    }
+    A->layout = PlasmaLapackLayout;
+    A->lda = lda;
+    A->translation = PlasmaNoTranslation;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Creates the tile matrix of the uplo triangle of the n-by-n column-major
+    array pA, for the routines referencing only that triangle. Translates
+    in place as plasma_desc_lapack_create when it applies, since that needs
+    no storage. Otherwise, only the tiles of the triangle are allocated, as
+    by plasma_desc_triangular_create.
+*/
+int plasma_desc_lapack_triangular_create(plasma_enum_t precision,
+                                         plasma_enum_t uplo, void *pA, int lda,
+                                         int mb, int nb, int n,
+                                         plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->inplace_outplace == PlasmaInplace && lda == n &&
+        plasma->array_layout == PlasmaColMajor && pA != NULL && n > 0)
+        return plasma_desc_lapack_create(precision, pA, lda, mb, nb,
+                                         n, n, A);
+
+    return plasma_desc_triangular_create(precision, uplo, mb, nb,
+                                         n, n, 0, 0, n, n, A);
+}
+
 /******************************************************************************/
 int plasma_desc_destroy(plasma_desc_t *A)
 {
@@ -89,7 +846,144 @@ int plasma_desc_destroy(plasma_desc_t *A)
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
-    free(A->matrix);
+    // Mapped storage is never cached.
+    if (A->mapped) {
+        size_t size = (size_t)A->gm*A->gn*
+                      plasma_element_size(A->precision);
+        plasma_allocator_unmap_file(A->matrix, size);
+        A->matrix = NULL;
+        A->mapped = 0;
+        free(A->tile_precision);
+        A->tile_precision = NULL;
+        free(A->tile_lrank);
+        A->tile_lrank = NULL;
+        free(A->tile_structure);
+        A->tile_structure = NULL;
+        free(A->tile_offset);
+        A->tile_offset = NULL;
+        free(A->tile_pattern);
+        A->tile_pattern = NULL;
+        return PlasmaSuccess;
+    }
+    // The storage of an in-place translation or of views of the LAPACK
+    // array belongs to the caller.
+    if (A->translation == PlasmaInplace ||
+        A->translation == PlasmaNoTranslation) {
+        A->matrix = NULL;
+        free(A->tile_precision);
+        A->tile_precision = NULL;
+        free(A->tile_lrank);
+        A->tile_lrank = NULL;
+        free(A->tile_structure);
+        A->tile_structure = NULL;
+        free(A->tile_offset);
+        A->tile_offset = NULL;
+        free(A->tile_pattern);
+        A->tile_pattern = NULL;
+        return PlasmaSuccess;
+    }
+    // Keep the storage for reuse by a descriptor of the same size.
+    size_t size = plasma_desc_storage_size(*A);
+    if (A->matrix != NULL)
+        plasma_stats_memory_release(plasma, size);
+    plasma_context_cache_release(plasma, A->matrix, size);
+    A->matrix = NULL;
+    free(A->tile_precision);
+    A->tile_precision = NULL;
+    free(A->tile_lrank);
+    A->tile_lrank = NULL;
+    free(A->tile_structure);
+    A->tile_structure = NULL;
+    free(A->tile_offset);
+    A->tile_offset = NULL;
+    free(A->tile_pattern);
+    A->tile_pattern = NULL;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Allocates the precision tags of the tiles of A, all set to the precision
+    of A. Freed by plasma_desc_destroy.
+*/
+int plasma_desc_tile_precision_create(plasma_desc_t *A)
+{
+    A->tile_precision =
+        (plasma_enum_t*)malloc((size_t)A->gmt*A->gnt*sizeof(plasma_enum_t));
+    if (A->tile_precision == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (size_t i = 0; i < (size_t)A->gmt*A->gnt; i++)
+        A->tile_precision[i] = A->precision;
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Allocates the rank tags of the tiles of A, all set to -1, dense.
+    Freed by plasma_desc_destroy.
+*/
+int plasma_desc_tile_lrank_create(plasma_desc_t *A)
+{
+    A->tile_lrank = (int*)malloc((size_t)A->gmt*A->gnt*sizeof(int));
+    if (A->tile_lrank == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (size_t i = 0; i < (size_t)A->gmt*A->gnt; i++)
+        A->tile_lrank[i] = -1;
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Allocates the structure tags of the tiles of A, all set to
+    PlasmaTileDense. Freed by plasma_desc_destroy.
+*/
+int plasma_desc_tile_structure_create(plasma_desc_t *A)
+{
+    A->tile_structure =
+        (plasma_enum_t*)malloc((size_t)A->gmt*A->gnt*sizeof(plasma_enum_t));
+    if (A->tile_structure == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (size_t i = 0; i < (size_t)A->gmt*A->gnt; i++)
+        A->tile_structure[i] = PlasmaTileDense;
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Frees an LU factorization from plasma_zgetrf_handle_create.
+*/
+int plasma_getrf_handle_destroy(plasma_getrf_handle_t *handle)
+{
+    int retval = plasma_desc_destroy(&handle->A);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    free(handle->ipiv);
+    handle->ipiv = NULL;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Frees a mixed precision LU factorization from
+    plasma_zcgetrf_handle_create.
+*/
+int plasma_getrf_mixed_handle_destroy(plasma_getrf_mixed_handle_t *handle)
+{
+    int retval = plasma_desc_destroy(&handle->A);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    retval = plasma_desc_destroy(&handle->As);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    free(handle->ipiv);
+    handle->ipiv = NULL;
     return PlasmaSuccess;
 }
 
@@ -98,15 +992,37 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
                              int mb, int nb, int lm, int ln, int i, int j,
                              int m, int n, plasma_desc_t *A)
 {
+    // The element size is needed for the tile addressing below.
+    if (precision != PlasmaRealFloat &&
+        precision != PlasmaRealDouble &&
+        precision != PlasmaComplexFloat &&
+        precision != PlasmaComplexDouble) {
+        plasma_error("invalid matrix type");
+        return PlasmaErrorIllegalValue;
+    }
+
     // type and precision
     A->type = PlasmaGeneral;
+    A->uplo = PlasmaGeneral;
     A->precision = precision;
+    A->tile_precision = NULL;
+    A->tile_lrank = NULL;
+    A->tile_structure = NULL;
+    A->rate = 0;
 
     // pointer and offsets
     A->matrix = matrix;
+    A->layout = PlasmaColumnMajorLayout;
+    A->tile_offset = NULL;
+    A->tile_pattern = NULL;
     A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
     A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
     A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
+    A->translation = PlasmaOutplace;
+    A->mapped = 0;
+    A->zero = 0;
+    A->ldpad = 0;
+    A->lda = 0;
 
     // tile parameters
     A->mb = mb;
@@ -128,6 +1044,23 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
     A->mt = (m == 0) ? 0 : (i+m-1)/mb - i/mb + 1;
     A->nt = (n == 0) ? 0 : (j+n-1)/nb - j/nb + 1;
 
+    // tile addressing
+    A->eltsize = plasma_element_size(precision);
+    A->it = i/mb;
+    A->jt = j/nb;
+    A->lm1 = lm/mb;
+    A->ln1 = ln/nb;
+
+    // no placement unless applied by plasma_desc_*_create
+    A->placement = PlasmaNoPlacement;
+    A->num_places = 0;
+    A->place_rows = 1;
+
+    // not distributed unless applied by plasma_desc_distribute
+    A->p = 1;
+    A->q = 1;
+    A->rank = 0;
+
     return PlasmaSuccess;
 }
 
@@ -297,6 +1230,10 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
     B.mt = (m == 0) ? 0 : (B.i+m-1)/mb - B.i/mb + 1;
     B.nt = (n == 0) ? 0 : (B.j+n-1)/nb - B.j/nb + 1;
 
+    // tile addressing
+    B.it = B.i/mb;
+    B.jt = B.j/nb;
+
     return B;
 }
 
@@ -304,6 +1241,15 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
 int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
                         plasma_desc_t *T)
 {
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    // PlasmaAutoHouseholder takes the mode the routines resolve for A.
+    if (householder_mode == PlasmaAutoHouseholder)
+        householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+
     // T uses tiles ib x nb, typically, ib < nb, and these tiles are
     // rectangular. This dimension is the same for QR and LQ factorizations.
     int mb = ib;
@@ -321,8 +1267,66 @@ int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
     int m = mt*mb;
     int n = nt*nb;
 
-    // Create the descriptor using the standard function.
-    int retval = plasma_desc_general_create(A.precision, mb, nb, m, n,
-                                            0, 0, m, n, T);
+    // Create the descriptor, without padding, as the routines address
+    // the tiles of T with the leading dimension T.mb.
+    int retval = plasma_desc_general_pad_create(plasma, A.precision, mb, nb,
+                                                m, n, 0, 0, m, n, 0, 0, T);
     return retval;
 }
+
+/******************************************************************************/
+int plasma_descT_compact_create(plasma_desc_t A, int ib,
+                                plasma_enum_t householder_mode,
+                                plasma_enum_t storev, plasma_desc_t *T)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->t_storage != PlasmaCompactT)
+        return plasma_descT_create(A, ib, householder_mode, T);
+    if (householder_mode == PlasmaAutoHouseholder)
+        householder_mode = plasma_householder_mode(plasma, A.mt, A.nt);
+
+    // Only the tile columns (QR) or rows (LQ) of the reflectors have T
+    // tiles. The tree reduction keeps its second half of the columns,
+    // which the QR factorization addresses from T.nt/2.
+    int mb = ib;
+    int nb = A.nb;
+    int kt = imin(A.mt, A.nt);
+    int mt = A.mt;
+    int nt = A.nt;
+    if (storev == PlasmaColumnwise)
+        nt = kt;
+    else
+        mt = kt;
+    if (householder_mode == PlasmaTreeHouseholder) {
+        nt = 2*nt;
+    }
+
+    int m = mt*mb;
+    int n = nt*nb;
+    return plasma_desc_general_pad_create(plasma, A.precision, mb, nb,
+                                          m, n, 0, 0, m, n, 0, 0, T);
+}
+
+/***************************************************************************//**
+    Checks that T, created by plasma_descT_create or
+    plasma_descT_compact_create, holds the T factors of the QR
+    (storev = PlasmaColumnwise) or LQ (PlasmaRowwise) factorization of A in
+    householder_mode. The tree mode addresses its second set of factors from
+    T.nt/2, so T created for the flat mode is too small for it, e.g., when
+    PlasmaAutoHouseholder or PlasmaTsBlock resolve to the tree mode for A.
+*/
+int plasma_descT_check(plasma_desc_t A, plasma_desc_t T,
+                       plasma_enum_t householder_mode, plasma_enum_t storev)
+{
+    // tile columns of the factors of one set
+    int nt = storev == PlasmaColumnwise ? imin(A.mt, A.nt) : A.nt;
+    if (householder_mode == PlasmaTreeHouseholder && T.nt < 2*nt) {
+        plasma_error("T not created for the tree Householder mode");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
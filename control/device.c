@@ -0,0 +1,175 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_device.h"
+#include "plasma_internal.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <omp.h>
+
+#if defined(PLASMA_WITH_CUDA)
+
+/******************************************************************************/
+// Cached tile of the device, chained in a bucket of the cache.
+typedef struct plasma_device_tile_s {
+    const void *host;   ///< host address, the key
+    void *dev;          ///< device copy
+    cudaEvent_t ready;  ///< recorded after the copy
+    struct plasma_device_tile_s *next;
+} plasma_device_tile_t;
+
+enum { PlasmaDeviceBuckets = 4096 };
+
+static plasma_device_thread_t *device_threads = NULL;
+static int device_num_threads = 0;
+
+static plasma_device_tile_t *device_cache[PlasmaDeviceBuckets];
+static omp_lock_t device_cache_lock;
+
+/***************************************************************************//**
+ *  Creates the streams and cuBLAS handles of the threads.
+ ******************************************************************************/
+int plasma_device_init(void)
+{
+    if (device_threads != NULL)
+        return PlasmaSuccess;
+
+    device_num_threads = omp_get_max_threads();
+    device_threads = (plasma_device_thread_t*)calloc(
+        device_num_threads, sizeof(plasma_device_thread_t));
+    if (device_threads == NULL) {
+        plasma_error("calloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int i = 0; i < device_num_threads; i++) {
+        if (cudaStreamCreateWithFlags(&device_threads[i].stream,
+                                      cudaStreamNonBlocking) != cudaSuccess ||
+            cublasCreate(&device_threads[i].handle) !=
+                CUBLAS_STATUS_SUCCESS) {
+            plasma_error("CUDA initialization failed");
+            device_num_threads = i;
+            plasma_device_finalize();
+            return PlasmaErrorInternal;
+        }
+        cublasSetStream(device_threads[i].handle, device_threads[i].stream);
+    }
+    omp_init_lock(&device_cache_lock);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_device_finalize(void)
+{
+    if (device_threads == NULL)
+        return;
+
+    plasma_device_cache_clear();
+    for (int i = 0; i < device_num_threads; i++) {
+        cublasDestroy(device_threads[i].handle);
+        cudaStreamDestroy(device_threads[i].stream);
+        cudaFree(device_threads[i].work);
+    }
+    free(device_threads);
+    device_threads = NULL;
+    omp_destroy_lock(&device_cache_lock);
+}
+
+/******************************************************************************/
+plasma_device_thread_t *plasma_device_thread(void)
+{
+    if (device_threads == NULL)
+        return NULL;
+
+    return &device_threads[omp_get_thread_num()%device_num_threads];
+}
+
+/***************************************************************************//**
+ *  Returns the device workspace of the thread, of at least size bytes,
+ *  or NULL if it cannot be allocated.
+ ******************************************************************************/
+void *plasma_device_work(plasma_device_thread_t *thread, size_t size)
+{
+    if (thread->lwork < size) {
+        cudaStreamSynchronize(thread->stream);
+        cudaFree(thread->work);
+        thread->lwork = 0;
+        if (cudaMalloc(&thread->work, size) != cudaSuccess) {
+            thread->work = NULL;
+            return NULL;
+        }
+        thread->lwork = size;
+    }
+    return thread->work;
+}
+
+/***************************************************************************//**
+ *  Returns the device copy of the m-by-n tile A, with leading dimension m,
+ *  for reading on the stream of the thread, or NULL if it cannot be
+ *  allocated. The copy is made by the first caller; the others wait for it.
+ ******************************************************************************/
+const void *plasma_device_tile(plasma_device_thread_t *thread,
+                               const void *A, int lda, int m, int n,
+                               size_t eltsize)
+{
+    size_t bucket = ((uintptr_t)A/eltsize)%PlasmaDeviceBuckets;
+
+    omp_set_lock(&device_cache_lock);
+    plasma_device_tile_t *tile = device_cache[bucket];
+    while (tile != NULL && tile->host != A)
+        tile = tile->next;
+
+    if (tile == NULL) {
+        tile = (plasma_device_tile_t*)malloc(sizeof(plasma_device_tile_t));
+        if (tile == NULL) {
+            omp_unset_lock(&device_cache_lock);
+            return NULL;
+        }
+        if (cudaMalloc(&tile->dev, (size_t)m*n*eltsize) != cudaSuccess) {
+            free(tile);
+            omp_unset_lock(&device_cache_lock);
+            return NULL;
+        }
+        cudaEventCreateWithFlags(&tile->ready, cudaEventDisableTiming);
+        cublasSetMatrixAsync(m, n, eltsize, A, lda, tile->dev, m,
+                             thread->stream);
+        cudaEventRecord(tile->ready, thread->stream);
+        tile->host = A;
+        tile->next = device_cache[bucket];
+        device_cache[bucket] = tile;
+    }
+    else {
+        cudaStreamWaitEvent(thread->stream, tile->ready, 0);
+    }
+    omp_unset_lock(&device_cache_lock);
+    return tile->dev;
+}
+
+/***************************************************************************//**
+ *  Frees the cached tiles, once no task reads them any more.
+ ******************************************************************************/
+void plasma_device_cache_clear(void)
+{
+    omp_set_lock(&device_cache_lock);
+    for (int i = 0; i < PlasmaDeviceBuckets; i++) {
+        plasma_device_tile_t *tile = device_cache[i];
+        while (tile != NULL) {
+            plasma_device_tile_t *next = tile->next;
+            cudaEventDestroy(tile->ready);
+            cudaFree(tile->dev);
+            free(tile);
+            tile = next;
+        }
+        device_cache[i] = NULL;
+    }
+    omp_unset_lock(&device_cache_lock);
+}
+
+#endif // PLASMA_WITH_CUDA
@@ -0,0 +1,640 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _DEFAULT_SOURCE
+
+#include "plasma_graph.h"
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_deque.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+__thread plasma_graph_t *plasma_graph_capture = NULL;
+
+/******************************************************************************/
+// Grows the array *p of *max elements of size bytes to hold count elements.
+static int plasma_graph_grow(void **p, int *max, int count, size_t size)
+{
+    if (count <= *max)
+        return PlasmaSuccess;
+
+    int max_new = *max > 0 ? *max : 256;
+    while (max_new < count)
+        max_new *= 2;
+    void *p_new = realloc(*p, (size_t)max_new*size);
+    if (p_new == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    *p = p_new;
+    *max = max_new;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Frees the tables of the capture.
+static void plasma_graph_capture_free(plasma_graph_t *graph)
+{
+    free(graph->entries);
+    free(graph->readers);
+    graph->entries = NULL;
+    graph->readers = NULL;
+    graph->num_entries = graph->max_entries = 0;
+    graph->num_readers = graph->max_readers = 0;
+}
+
+/******************************************************************************/
+// Returns the entry of the tile in the table of the capture, a free entry
+// holding the tile if it is new, or NULL if the table cannot grow.
+static plasma_graph_tile_t *plasma_graph_tile(plasma_graph_t *graph,
+                                              const void *tile)
+{
+    // Keep the table at most half full.
+    if (2*(graph->num_entries+1) > graph->max_entries) {
+        int max_new = graph->max_entries > 0 ? 2*graph->max_entries : 1024;
+        plasma_graph_tile_t *entries =
+            (plasma_graph_tile_t*)calloc(max_new, sizeof(plasma_graph_tile_t));
+        if (entries == NULL)
+            return NULL;
+
+        for (int i = 0; i < graph->max_entries; i++) {
+            plasma_graph_tile_t *e = &graph->entries[i];
+            if (e->tile == NULL)
+                continue;
+            size_t h = ((uintptr_t)e->tile >> 6)*0x9e3779b97f4a7c15ull;
+            while (entries[h & (max_new-1)].tile != NULL)
+                h++;
+            entries[h & (max_new-1)] = *e;
+        }
+        free(graph->entries);
+        graph->entries = entries;
+        graph->max_entries = max_new;
+    }
+
+    size_t h = ((uintptr_t)tile >> 6)*0x9e3779b97f4a7c15ull;
+    for (;; h++) {
+        plasma_graph_tile_t *e = &graph->entries[h & (graph->max_entries-1)];
+        if (e->tile == tile)
+            return e;
+        if (e->tile == NULL) {
+            e->tile = tile;
+            e->writer = -1;
+            e->reader = -1;
+            graph->num_entries++;
+            return e;
+        }
+    }
+}
+
+/******************************************************************************/
+// Adds the predecessor pred to the last task of the graph.
+static int plasma_graph_pred(plasma_graph_t *graph, int pred)
+{
+    plasma_graph_task_t *task = &graph->tasks[graph->num_tasks-1];
+    for (int i = task->pred; i < graph->num_preds; i++)
+        if (graph->preds[i] == pred)
+            return PlasmaSuccess;
+
+    if (plasma_graph_grow((void**)&graph->preds, &graph->max_preds,
+                          graph->num_preds+1, sizeof(int)) != PlasmaSuccess)
+        return PlasmaErrorOutOfMemory;
+
+    graph->preds[graph->num_preds++] = pred;
+    task->num_preds++;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Lists the successors of each task, from the predecessors of the tasks,
+// in the order of the capture.
+static int plasma_graph_successors(plasma_graph_t *graph)
+{
+    int n = graph->num_tasks;
+    graph->succ_start = (int*)calloc((size_t)n+1, sizeof(int));
+    graph->succs = (int*)malloc(((size_t)graph->num_preds+1)*sizeof(int));
+    int *next = (int*)malloc(((size_t)n+1)*sizeof(int));
+    if (graph->succ_start == NULL || graph->succs == NULL || next == NULL) {
+        free(next);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    for (int t = 0; t < n; t++) {
+        plasma_graph_task_t *task = &graph->tasks[t];
+        for (int i = 0; i < task->num_preds; i++)
+            graph->succ_start[graph->preds[task->pred+i]+1]++;
+    }
+    for (int t = 0; t < n; t++)
+        graph->succ_start[t+1] += graph->succ_start[t];
+
+    memcpy(next, graph->succ_start, ((size_t)n+1)*sizeof(int));
+    for (int t = 0; t < n; t++) {
+        plasma_graph_task_t *task = &graph->tasks[t];
+        for (int i = 0; i < task->num_preds; i++)
+            graph->succs[next[graph->preds[task->pred+i]]++] = t;
+    }
+    free(next);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Starts the capture of the tasks of the calling thread in the graph, on the
+ *  tiles of the num_descs descriptors descs, until plasma_graph_end().
+ *  Called in the parallel region, by the thread calling the plasma_omp_*
+ *  routines captured, after the tasks on the descriptors have completed.
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorNotSupported for matrices distributed over processes,
+ *         or with PlasmaOffloadOn
+ *
+ ******************************************************************************/
+int plasma_graph_begin(plasma_graph_t *graph,
+                       int num_descs, const plasma_desc_t *descs)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (graph == NULL) {
+        plasma_error("NULL graph");
+        return PlasmaErrorNullParameter;
+    }
+    if (num_descs < 1 || num_descs > PlasmaGraphMaxDescs) {
+        plasma_error("invalid number of descriptors");
+        return PlasmaErrorIllegalValue;
+    }
+    if (plasma_graph_capture != NULL) {
+        plasma_error("capture in progress");
+        return PlasmaErrorIllegalValue;
+    }
+    if (plasma->offload == PlasmaOffloadOn) {
+        plasma_error("capture of offloaded tasks not supported");
+        return PlasmaErrorNotSupported;
+    }
+    for (int i = 0; i < num_descs; i++) {
+        if (plasma_desc_check(descs[i]) != PlasmaSuccess) {
+            plasma_error("invalid descriptor");
+            return PlasmaErrorIllegalValue;
+        }
+        if (descs[i].p*descs[i].q > 1) {
+            plasma_error("capture of distributed matrices not supported");
+            return PlasmaErrorNotSupported;
+        }
+    }
+
+    memset(graph, 0, sizeof(plasma_graph_t));
+    graph->num_descs = num_descs;
+    memcpy(graph->descs, descs, num_descs*sizeof(plasma_desc_t));
+    graph->status = PlasmaSuccess;
+    plasma_graph_capture = graph;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Ends the capture started by plasma_graph_begin(). On error, the graph
+ *  is destroyed.
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorIllegalValue if a task used a tile outside of the
+ *         descriptors of the capture
+ * @retval PlasmaErrorOutOfMemory if the graph could not grow
+ *
+ ******************************************************************************/
+int plasma_graph_end(plasma_graph_t *graph)
+{
+    if (graph == NULL || plasma_graph_capture != graph) {
+        plasma_error("graph not capturing");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_graph_capture = NULL;
+    plasma_graph_capture_free(graph);
+
+    int status = graph->status;
+    if (status == PlasmaSuccess)
+        status = plasma_graph_successors(graph);
+    if (status != PlasmaSuccess)
+        plasma_graph_destroy(graph);
+
+    return status;
+}
+
+/******************************************************************************/
+// Frees the tasks of the graph.
+int plasma_graph_destroy(plasma_graph_t *graph)
+{
+    if (graph == NULL) {
+        plasma_error("NULL graph");
+        return PlasmaErrorNullParameter;
+    }
+    if (plasma_graph_capture == graph)
+        plasma_graph_capture = NULL;
+
+    plasma_graph_capture_free(graph);
+    free(graph->tasks);
+    free(graph->preds);
+    free(graph->succ_start);
+    free(graph->succs);
+    graph->tasks = NULL;
+    graph->preds = NULL;
+    graph->succ_start = NULL;
+    graph->succs = NULL;
+    graph->num_tasks = graph->max_tasks = 0;
+    graph->num_preds = graph->max_preds = 0;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Appends the task to the capturing graph, called by the core_omp_* wrappers
+// with PLASMA_GRAPH_ADD(). A task after a task writing one of its tiles, or
+// writing a tile after a task reading it, depends on that task, as with the
+// depend clauses of its OpenMP task.
+void plasma_graph_add(plasma_graph_task_t *task,
+                      int num_out, int num_tiles, const void **tiles)
+{
+    plasma_graph_t *graph = plasma_graph_capture;
+    if (graph->status != PlasmaSuccess)
+        return;
+
+    if (num_tiles > PlasmaGraphMaxTiles) {
+        plasma_error("too many tiles");
+        graph->status = PlasmaErrorNotSupported;
+        return;
+    }
+
+    // Locate the tiles in the descriptors.
+    task->num_tiles = num_tiles;
+    task->num_out = num_out;
+    for (int i = 0; i < num_tiles; i++) {
+        task->desc[i] = -1;
+        for (int d = 0; d < graph->num_descs; d++) {
+            const char *matrix = (const char*)graph->descs[d].matrix;
+            size_t size = plasma_desc_storage_size(graph->descs[d]);
+            const char *tile = (const char*)tiles[i];
+            if (tile >= matrix && tile < matrix+size) {
+                task->desc[i] = d;
+                task->offset[i] = (size_t)(tile-matrix);
+                break;
+            }
+        }
+        if (task->desc[i] < 0) {
+            plasma_error("tile outside of the descriptors of the capture");
+            graph->status = PlasmaErrorIllegalValue;
+            return;
+        }
+    }
+
+    if (plasma_graph_grow((void**)&graph->tasks, &graph->max_tasks,
+                          graph->num_tasks+1,
+                          sizeof(plasma_graph_task_t)) != PlasmaSuccess) {
+        graph->status = PlasmaErrorOutOfMemory;
+        return;
+    }
+    int t = graph->num_tasks++;
+    task->pred = graph->num_preds;
+    task->num_preds = 0;
+    task->writer = -1;
+    graph->tasks[t] = *task;
+
+    // Dependencies on the last accesses to the tiles.
+    for (int i = 0; i < num_tiles; i++) {
+        plasma_graph_tile_t *e = plasma_graph_tile(graph, tiles[i]);
+        if (e == NULL ||
+            plasma_graph_grow((void**)&graph->readers, &graph->max_readers,
+                              graph->num_readers+1,
+                              2*sizeof(int)) != PlasmaSuccess) {
+            graph->status = PlasmaErrorOutOfMemory;
+            return;
+        }
+
+        if (e->writer >= 0 && e->writer != t &&
+            plasma_graph_pred(graph, e->writer) != PlasmaSuccess) {
+            graph->status = PlasmaErrorOutOfMemory;
+            return;
+        }
+        if (i < num_out) {
+            if (i == 0 && e->writer != t)
+                graph->tasks[t].writer = e->writer;
+            for (int r = e->reader; r >= 0; r = graph->readers[2*r+1]) {
+                if (graph->readers[2*r] != t &&
+                    plasma_graph_pred(graph, graph->readers[2*r]) !=
+                    PlasmaSuccess) {
+                    graph->status = PlasmaErrorOutOfMemory;
+                    return;
+                }
+            }
+            e->writer = t;
+            e->reader = -1;
+        }
+        else {
+            int r = graph->num_readers++;
+            graph->readers[2*r] = t;
+            graph->readers[2*r+1] = e->reader;
+            e->reader = r;
+        }
+    }
+}
+
+/******************************************************************************/
+// Runs the tasks rank, rank+size, ... of the graph, each after its
+// predecessors, and marks them done in the progress table.
+static void plasma_graph_replay_rank(plasma_graph_t *graph, char **matrix,
+                                     int rank, int size,
+                                     plasma_progress_t *progress,
+                                     plasma_sequence_t *sequence,
+                                     plasma_request_t *request)
+{
+    for (int t = rank; t < graph->num_tasks; t += size) {
+        plasma_graph_task_t *task = &graph->tasks[t];
+        for (int i = 0; i < task->num_preds; i++)
+            plasma_progress_wait(progress, graph->preds[task->pred+i], 1);
+
+        if (sequence->status == PlasmaSuccess) {
+            void *tiles[PlasmaGraphMaxTiles];
+            for (int i = 0; i < task->num_tiles; i++)
+                tiles[i] = matrix[task->desc[i]] + task->offset[i];
+            task->kernel(task, tiles, sequence, request);
+        }
+        plasma_progress_set(progress, t, 1);
+    }
+}
+
+/******************************************************************************/
+// Mailbox of a thread of the stealing replay: the tasks the other threads
+// released for it, linked through next, on its own cache lines.
+typedef union {
+    int head;
+    char pad[128];
+} plasma_graph_mailbox_t;
+
+// State of the stealing replay, shared by the threads.
+typedef struct {
+    plasma_deque_t *deques;           ///< deque of each thread
+    plasma_graph_mailbox_t *mailbox;  ///< mailbox of each thread
+    int *counters;                    ///< predecessors still to run
+    int *ran;                         ///< thread which ran each task
+    int *next;                        ///< next task in a mailbox
+    int done;                         ///< number of tasks run
+    int aborted;                      ///< nonzero after a failed push
+} plasma_graph_stealing_t;
+
+/******************************************************************************/
+// Moves the tasks of the mailbox of the thread rank to its deque.
+static int plasma_graph_mailbox_drain(plasma_graph_stealing_t *st, int rank)
+{
+    int t = __atomic_exchange_n(&st->mailbox[rank].head, -1,
+                                __ATOMIC_ACQUIRE);
+    for (; t >= 0; t = st->next[t]) {
+        if (plasma_deque_push(&st->deques[rank], t) != PlasmaSuccess)
+            return PlasmaErrorOutOfMemory;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Releases the task t, with no predecessor left to run, by the thread rank:
+// to the thread which ran its writer predecessor, for the locality of the
+// tile they write, and else to the thread rank.
+static int plasma_graph_release(plasma_graph_t *graph,
+                                plasma_graph_stealing_t *st, int t, int rank)
+{
+    int writer = graph->tasks[t].writer;
+    int owner = writer >= 0 ? st->ran[writer] : rank;
+    if (owner == rank)
+        return plasma_deque_push(&st->deques[rank], t);
+
+    int head = __atomic_load_n(&st->mailbox[owner].head, __ATOMIC_RELAXED);
+    do {
+        st->next[t] = head;
+    } while (!__atomic_compare_exchange_n(&st->mailbox[owner].head, &head, t,
+                                          1, __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED));
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Runs the tasks taken from the mailbox and the deque of the thread rank, or
+// stolen from the deques of the other threads, until all the tasks of the
+// graph have run. Each task run decrements the counters of its successors,
+// and releases those with no predecessor left to run.
+static void plasma_graph_steal_rank(plasma_graph_t *graph, char **matrix,
+                                    int rank, int size,
+                                    plasma_graph_stealing_t *st,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    plasma_deque_t *deques = st->deques;
+    while (__atomic_load_n(&st->done, __ATOMIC_ACQUIRE) < graph->num_tasks &&
+           !__atomic_load_n(&st->aborted, __ATOMIC_ACQUIRE)) {
+        if (plasma_graph_mailbox_drain(st, rank) != PlasmaSuccess) {
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+            __atomic_store_n(&st->aborted, 1, __ATOMIC_RELEASE);
+            break;
+        }
+        int t = plasma_deque_take(&deques[rank]);
+        for (int i = 1; t < 0 && i < size; i++)
+            t = plasma_deque_steal(&deques[(rank+i)%size]);
+        if (t < 0) {
+            sched_yield();
+            continue;
+        }
+
+        plasma_graph_task_t *task = &graph->tasks[t];
+        if (sequence->status == PlasmaSuccess) {
+            void *tiles[PlasmaGraphMaxTiles];
+            for (int i = 0; i < task->num_tiles; i++)
+                tiles[i] = matrix[task->desc[i]] + task->offset[i];
+            task->kernel(task, tiles, sequence, request);
+        }
+        st->ran[t] = rank;
+
+        for (int i = graph->succ_start[t]; i < graph->succ_start[t+1]; i++) {
+            int s = graph->succs[i];
+            if (__atomic_sub_fetch(&st->counters[s], 1,
+                                   __ATOMIC_ACQ_REL) == 0 &&
+                plasma_graph_release(graph, st, s, rank) != PlasmaSuccess) {
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+                __atomic_store_n(&st->aborted, 1, __ATOMIC_RELEASE);
+            }
+        }
+        __atomic_add_fetch(&st->done, 1, __ATOMIC_RELEASE);
+    }
+}
+
+/******************************************************************************/
+// Replays the tasks of the graph by work stealing, with the tasks without
+// predecessors dealt to the deques of the threads, the last ones first, so
+// that each thread takes its own in the order of the capture.
+static void plasma_graph_replay_stealing(plasma_graph_t *graph, char **matrix,
+                                         plasma_sequence_t *sequence,
+                                         plasma_request_t *request)
+{
+    int size = omp_get_num_threads();
+    int n = graph->num_tasks;
+    plasma_graph_stealing_t st;
+    st.deques = (plasma_deque_t*)calloc(size, sizeof(plasma_deque_t));
+    st.mailbox = (plasma_graph_mailbox_t*)malloc(
+        size*sizeof(plasma_graph_mailbox_t));
+    st.counters = (int*)malloc(3*(size_t)n*sizeof(int));
+    st.ran = st.counters+n;
+    st.next = st.ran+n;
+    st.done = 0;
+    st.aborted = 0;
+    int retval = st.deques != NULL && st.mailbox != NULL &&
+                 st.counters != NULL ? PlasmaSuccess : PlasmaErrorOutOfMemory;
+    for (int rank = 0; rank < size && retval == PlasmaSuccess; rank++) {
+        st.mailbox[rank].head = -1;
+        retval = plasma_deque_init(&st.deques[rank], n/size+1);
+    }
+
+    for (int t = n-1; t >= 0 && retval == PlasmaSuccess; t--) {
+        st.counters[t] = graph->tasks[t].num_preds;
+        if (st.counters[t] == 0)
+            retval = plasma_deque_push(&st.deques[t%size], t);
+    }
+
+    if (retval == PlasmaSuccess) {
+        // The tasks before on the matrices complete first.
+        #pragma omp taskwait
+        for (int rank = 0; rank < size; rank++) {
+            #pragma omp task shared(st, matrix) \
+                             priority(plasma_sequence_priority(sequence))
+            plasma_graph_steal_rank(graph, matrix, rank, size, &st,
+                                    sequence, request);
+        }
+        #pragma omp taskwait
+    }
+    else {
+        plasma_error("malloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+    }
+
+    for (int rank = 0; rank < size && st.deques != NULL; rank++)
+        plasma_deque_destroy(&st.deques[rank]);
+    free(st.deques);
+    free(st.mailbox);
+    free(st.counters);
+}
+
+/***************************************************************************//**
+ *
+ *  Replays the tasks of the graph on the num_descs descriptors descs,
+ *  of the same shapes as the descriptors of the capture, in the same order.
+ *  Called in the parallel region, as the plasma_omp_* routines, and returns
+ *  when the tasks have completed.
+ *
+ * @param[in] graph
+ *          The graph captured by plasma_graph_begin() and plasma_graph_end().
+ *
+ * @param[in] num_descs
+ *          The number of descriptors, as in the capture.
+ *
+ * @param[in] descs
+ *          The descriptors of the matrices the tasks run on, in place of the
+ *          descriptors of the capture.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ ******************************************************************************/
+void plasma_omp_graph_replay(plasma_graph_t *graph,
+                             int num_descs, const plasma_desc_t *descs,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (graph == NULL || (graph->tasks == NULL && graph->num_tasks > 0)) {
+        plasma_error("invalid graph");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (num_descs != graph->num_descs) {
+        plasma_error("number of descriptors not matching the capture");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    for (int d = 0; d < num_descs; d++) {
+        plasma_desc_t A = descs[d];
+        plasma_desc_t C = graph->descs[d];
+        if (plasma_desc_check(A) != PlasmaSuccess ||
+            A.type != C.type || A.precision != C.precision ||
+            A.layout != C.layout || A.ldpad != C.ldpad ||
+            A.mb != C.mb || A.nb != C.nb || A.gm != C.gm || A.gn != C.gn ||
+            A.i != C.i || A.j != C.j || A.m != C.m || A.n != C.n ||
+            A.kl != C.kl || A.ku != C.ku) {
+            plasma_error("descriptor not matching the capture");
+            plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+            return;
+        }
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (graph->num_tasks == 0 || sequence->status != PlasmaSuccess)
+        return;
+
+    char *matrix[PlasmaGraphMaxDescs];
+    for (int d = 0; d < num_descs; d++)
+        matrix[d] = (char*)descs[d].matrix;
+
+    if (plasma->graph_replay == PlasmaStealingReplay) {
+        plasma_graph_replay_stealing(graph, matrix, sequence, request);
+        return;
+    }
+
+    plasma_progress_t progress;
+    if (plasma_progress_init(&progress, graph->num_tasks) != PlasmaSuccess) {
+        plasma_error("calloc() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    // The tasks before on the matrices complete first.
+    int size = omp_get_num_threads();
+    #pragma omp taskwait
+    for (int rank = 0; rank < size; rank++) {
+        #pragma omp task shared(progress, matrix) \
+                         priority(plasma_sequence_priority(sequence))
+        plasma_graph_replay_rank(graph, matrix, rank, size, &progress,
+                                 sequence, request);
+    }
+    #pragma omp taskwait
+
+    plasma_progress_destroy(&progress);
+}
@@ -0,0 +1,254 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Counters of the monitored context, one context at a time. The readers
+// hold the critical section, so that the counters are not dropped under
+// them.
+static plasma_monitor_thread_t *monitor_threads = NULL;
+static int monitor_num_threads = 0;
+
+/******************************************************************************/
+// Starts monitoring the tasks in the counters *monitor of num_threads
+// threads, allocated on the first call and cleared. Called by plasma_set().
+int plasma_monitor_enable(plasma_monitor_thread_t **monitor, int num_threads)
+{
+    if (*monitor == NULL) {
+        *monitor = (plasma_monitor_thread_t*)
+            malloc(num_threads*sizeof(plasma_monitor_thread_t));
+        if (*monitor == NULL) {
+            plasma_error("malloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+    }
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(0);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    #pragma omp critical(plasma_monitor)
+    {
+        memset(*monitor, 0, num_threads*sizeof(plasma_monitor_thread_t));
+        monitor_threads = *monitor;
+        monitor_num_threads = num_threads;
+    }
+    plasma_trace_on = on | PlasmaTraceMonitor;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Stops monitoring the tasks if they are counted in monitor.
+void plasma_monitor_disable(plasma_monitor_thread_t *monitor)
+{
+    #pragma omp critical(plasma_monitor)
+    {
+        if (monitor == monitor_threads) {
+            plasma_trace_on &= ~PlasmaTraceMonitor;
+            monitor_threads = NULL;
+            monitor_num_threads = 0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Counts a task started by thread. Called by the hooks.
+void plasma_monitor_begin(int thread)
+{
+    plasma_monitor_thread_t *counters = monitor_threads;
+    if (counters == NULL || thread >= monitor_num_threads)
+        return;
+
+    #pragma omp atomic update
+    counters[thread].running++;
+}
+
+/******************************************************************************/
+// Counts a task of thread ending now, busy for time without its nested
+// tasks. Tasks started before the monitor was switched on are counted as
+// completed, without their start. Called by the hooks.
+void plasma_monitor_end(int thread, double time, double flops)
+{
+    plasma_monitor_thread_t *counters = monitor_threads;
+    if (counters == NULL || thread >= monitor_num_threads)
+        return;
+
+    plasma_monitor_thread_t *t = &counters[thread];
+    int running;
+    #pragma omp atomic read
+    running = t->running;
+    if (running > 0) {
+        #pragma omp atomic update
+        t->running--;
+    }
+    #pragma omp atomic update
+    t->tasks++;
+    #pragma omp atomic update
+    t->busy_time += time;
+    #pragma omp atomic update
+    t->flops += flops;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Samples the counters of the monitored context, the one that called
+    plasma_set(PlasmaMonitor, PlasmaMonitorOn), from any thread, e.g.,
+    a thread polling them while a long call runs, without a PLASMA context.
+    The rates are computed against the previous sample passed in, so that
+    several readers can sample at their own pace. Threads that stay idle
+    while a call runs show a computation limited by its task graph, rather
+    than by the throughput of the kernels. The tasks are monitored when
+    PLASMA is built with -DPLASMA_WITH_TRACE.
+
+    OpenMP does not expose its queues of ready tasks; the busy and idle
+    threads stand for their depth.
+
+    @param[in,out] monitor
+        On entry, the previous sample of the caller, or zeroed for the
+        first one. On exit, the new sample, with the gflops and the
+        utilization since the previous one, zero for the first one.
+        Zero counters when no context is monitored.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_monitor_sample(plasma_monitor_t *monitor)
+{
+    if (monitor == NULL) {
+        plasma_error("NULL monitor");
+        return PlasmaErrorNullParameter;
+    }
+    plasma_monitor_t previous = *monitor;
+    plasma_monitor_t sample = {.time = omp_get_wtime()};
+    #pragma omp critical(plasma_monitor)
+    {
+        sample.threads = monitor_num_threads;
+        for (int t = 0; t < monitor_num_threads; t++) {
+            plasma_monitor_thread_t *thread = &monitor_threads[t];
+            int running;
+            long tasks;
+            double busy_time, flops;
+            #pragma omp atomic read
+            running = thread->running;
+            #pragma omp atomic read
+            tasks = thread->tasks;
+            #pragma omp atomic read
+            busy_time = thread->busy_time;
+            #pragma omp atomic read
+            flops = thread->flops;
+            sample.busy += running > 0;
+            sample.tasks += tasks;
+            sample.busy_time += busy_time;
+            sample.flops += flops;
+        }
+    }
+    sample.idle = sample.threads-sample.busy;
+
+    // A previous sample from before the counters were cleared is dropped.
+    if (previous.time > 0.0 && sample.tasks >= previous.tasks) {
+        double elapsed = sample.time-previous.time;
+        if (elapsed > 0.0) {
+            sample.gflops = (sample.flops-previous.flops)/elapsed/1e9;
+            if (sample.threads > 0)
+                sample.utilization = (sample.busy_time-previous.busy_time)/
+                                     (elapsed*sample.threads);
+        }
+    }
+    *monitor = sample;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Samples the counters as plasma_monitor_sample() does and writes them to
+    path in the text format of Prometheus, e.g., for the textfile collector
+    of the node exporter. The file is written next to path, then renamed
+    over it, so that a scrape never reads it half written.
+
+    @param[in] path
+        The file of the metrics.
+
+    @param[in,out] monitor
+        The previous sample of the caller on entry, the new one on exit.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_monitor_write_prometheus(const char *path,
+                                    plasma_monitor_t *monitor)
+{
+    if (path == NULL) {
+        plasma_error("NULL path");
+        return PlasmaErrorNullParameter;
+    }
+    int retval = plasma_monitor_sample(monitor);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    size_t len = strlen(path);
+    char *temp = (char*)malloc(len+5);
+    if (temp == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    memcpy(temp, path, len);
+    memcpy(&temp[len], ".tmp", 5);
+
+    FILE *file = fopen(temp, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        free(temp);
+        return PlasmaErrorFileIo;
+    }
+    fprintf(file,
+            "# HELP plasma_threads Threads of the monitored context.\n"
+            "# TYPE plasma_threads gauge\n"
+            "plasma_threads %d\n"
+            "# HELP plasma_threads_busy Threads running a task.\n"
+            "# TYPE plasma_threads_busy gauge\n"
+            "plasma_threads_busy %d\n"
+            "# HELP plasma_threads_idle Threads without a task.\n"
+            "# TYPE plasma_threads_idle gauge\n"
+            "plasma_threads_idle %d\n"
+            "# HELP plasma_tasks_total Tasks completed.\n"
+            "# TYPE plasma_tasks_total counter\n"
+            "plasma_tasks_total %ld\n"
+            "# HELP plasma_busy_seconds_total Busy time of the tasks.\n"
+            "# TYPE plasma_busy_seconds_total counter\n"
+            "plasma_busy_seconds_total %.9g\n"
+            "# HELP plasma_flops_total Modeled flops of the tasks.\n"
+            "# TYPE plasma_flops_total counter\n"
+            "plasma_flops_total %.17g\n"
+            "# HELP plasma_gflops Gflop/s since the previous sample.\n"
+            "# TYPE plasma_gflops gauge\n"
+            "plasma_gflops %.6g\n"
+            "# HELP plasma_utilization Busy fraction of the threads since "
+            "the previous sample.\n"
+            "# TYPE plasma_utilization gauge\n"
+            "plasma_utilization %.6g\n",
+            monitor->threads, monitor->busy, monitor->idle,
+            monitor->tasks, monitor->busy_time, monitor->flops,
+            monitor->gflops, monitor->utilization);
+
+    retval = PlasmaSuccess;
+    if (fclose(file) != 0 || rename(temp, path) != 0) {
+        plasma_error("writing the metrics failed");
+        remove(temp);
+        retval = PlasmaErrorFileIo;
+    }
+    free(temp);
+    return retval;
+}
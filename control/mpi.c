@@ -0,0 +1,253 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_mpi.h"
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <limits.h>
+#include <string.h>
+#include <omp.h>
+
+#if defined(PLASMA_WITH_MPI)
+#include <mpi.h>
+
+// Communicator of PLASMA, duplicated from MPI_COMM_WORLD.
+static MPI_Comm plasma_mpi_comm = MPI_COMM_NULL;
+
+// 1 if MPI was initialized by plasma_mpi_init.
+static int plasma_mpi_owned = 0;
+
+/******************************************************************************/
+// Completes the request, yielding the thread to other tasks meanwhile.
+static int plasma_mpi_wait(MPI_Request *request)
+{
+    int done = 0;
+    int retval = MPI_Test(request, &done, MPI_STATUS_IGNORE);
+    while (retval == MPI_SUCCESS && !done) {
+        #pragma omp taskyield
+        retval = MPI_Test(request, &done, MPI_STATUS_IGNORE);
+    }
+    return retval;
+}
+#endif
+
+/***************************************************************************//**
+ *  Initializes MPI, if not done by the caller, with MPI_THREAD_MULTIPLE,
+ *  for the transfers from the tasks, and the communicator of PLASMA.
+ *  Called by plasma_init.
+ ******************************************************************************/
+int plasma_mpi_init(void)
+{
+#if defined(PLASMA_WITH_MPI)
+    if (plasma_mpi_comm != MPI_COMM_NULL)
+        return PlasmaSuccess;
+
+    int initialized;
+    int provided;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_MULTIPLE, &provided);
+        plasma_mpi_owned = 1;
+    }
+    else {
+        MPI_Query_thread(&provided);
+    }
+    if (provided < MPI_THREAD_MULTIPLE) {
+        plasma_error("MPI_THREAD_MULTIPLE not provided");
+        return PlasmaErrorNotSupported;
+    }
+    if (MPI_Comm_dup(MPI_COMM_WORLD, &plasma_mpi_comm) != MPI_SUCCESS) {
+        plasma_error("MPI_Comm_dup() failed");
+        return PlasmaErrorInternal;
+    }
+#endif
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_mpi_finalize(void)
+{
+#if defined(PLASMA_WITH_MPI)
+    if (plasma_mpi_comm == MPI_COMM_NULL)
+        return;
+
+    MPI_Comm_free(&plasma_mpi_comm);
+    if (plasma_mpi_owned) {
+        MPI_Finalize();
+        plasma_mpi_owned = 0;
+    }
+#endif
+}
+
+/***************************************************************************//**
+ * @ingroup plasma_descriptor
+ *
+ *  Distributes the tiles of the general matrix A 2D block cyclic over a
+ *  p-by-q grid of the MPI processes, row major. Tile (m, n) belongs to the
+ *  process of rank (m%p)*q + n%q. All the processes call it with the same
+ *  grid, p*q being the number of processes.
+ *
+ *  The tile algorithms then run the tasks writing a tile on its process,
+ *  and transfer the tiles between the processes. Each process initializes
+ *  its own tiles.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          Descriptor of the matrix, created by plasma_desc_general_create.
+ *
+ * @param[in] p
+ *          Number of rows of the grid of processes. p >= 1.
+ *
+ * @param[in] q
+ *          Number of columns of the grid of processes. q >= 1.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_desc_distribute(plasma_desc_t *A, int p, int q)
+{
+    if (p < 1 || q < 1) {
+        plasma_error("illegal grid of processes");
+        return PlasmaErrorIllegalValue;
+    }
+    if (A->type != PlasmaGeneral) {
+        plasma_error("only general matrices are distributed");
+        return PlasmaErrorNotSupported;
+    }
+    if (A->layout == PlasmaSparseLayout && p*q > 1) {
+        plasma_error("block-sparse matrices are not distributed");
+        return PlasmaErrorNotSupported;
+    }
+#if defined(PLASMA_WITH_MPI)
+    if (plasma_mpi_comm == MPI_COMM_NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    int size, rank;
+    MPI_Comm_size(plasma_mpi_comm, &size);
+    MPI_Comm_rank(plasma_mpi_comm, &rank);
+    if (p*q != size) {
+        plasma_error("grid size not the number of processes");
+        return PlasmaErrorIllegalValue;
+    }
+    // The tags of the tiles are their positions.
+    int *tag_ub;
+    int flag;
+    MPI_Comm_get_attr(plasma_mpi_comm, MPI_TAG_UB, &tag_ub, &flag);
+    if (flag && (long)A->gmt*A->gnt-1 > *tag_ub) {
+        plasma_error("too many tiles for the MPI tags");
+        return PlasmaErrorNotSupported;
+    }
+    A->p = p;
+    A->q = q;
+    A->rank = rank;
+#else
+    if (p*q > 1) {
+        plasma_error("distributed matrices require PLASMA_WITH_MPI");
+        return PlasmaErrorNotSupported;
+    }
+#endif
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Marks in ranks the processes owning the tiles (m1:m2, n1:n2) of A.
+ *  ranks is an array of A.p*A.q flags.
+ ******************************************************************************/
+void plasma_tile_owners(plasma_desc_t A, int m1, int m2, int n1, int n2,
+                        char *ranks)
+{
+    if (A.p*A.q <= 1)
+        return;
+
+    // The owners repeat every p tile rows and q tile columns.
+    for (int m = m1; m <= imin(m2, m1+A.p-1); m++)
+        for (int n = n1; n <= imin(n2, n1+A.q-1); n++)
+            ranks[plasma_tile_rank(A, m, n)] = 1;
+}
+
+/***************************************************************************//**
+ *  Sends the tile (m, n) of A from the process root, holding it, to the
+ *  processes marked in ranks, which receive it into their copy of the
+ *  tile. The sends read the tile, and the receives write it, as tasks.
+ *  Clears ranks.
+ ******************************************************************************/
+void plasma_omp_tile_bcast(plasma_desc_t A, int m, int n, int root,
+                           char *ranks,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    if (A.p*A.q <= 1)
+        return;
+
+#if defined(PLASMA_WITH_MPI)
+    char *a = (char*)plasma_tile_addr(A, m, n);
+    int size = plasma_tile_mmain(A, m)*plasma_tile_nmain(A, n)*
+               (int)plasma_element_size(A.precision);
+    int tag = m + A.it + A.gmt*(n + A.jt);
+
+    if (A.rank == root) {
+        for (int dest = 0; dest < A.p*A.q; dest++) {
+            if (!ranks[dest] || dest == root)
+                continue;
+
+            // The receivers wait for the message whatever the sequence.
+            #pragma omp task depend(in:a[0:size]) \
+                             priority(plasma_sequence_priority(sequence)+1)
+            {
+                MPI_Request req;
+                if (MPI_Isend(a, size, MPI_BYTE, dest, tag,
+                              plasma_mpi_comm, &req) != MPI_SUCCESS ||
+                    plasma_mpi_wait(&req) != MPI_SUCCESS) {
+                    plasma_error("MPI_Isend() failed");
+                    plasma_request_fail(sequence, request,
+                                        PlasmaErrorInternal);
+                }
+            }
+        }
+    }
+    else if (ranks[A.rank]) {
+        #pragma omp task depend(out:a[0:size]) \
+                         priority(plasma_sequence_priority(sequence))
+        {
+            MPI_Request req;
+            if (MPI_Irecv(a, size, MPI_BYTE, root, tag,
+                          plasma_mpi_comm, &req) != MPI_SUCCESS ||
+                plasma_mpi_wait(&req) != MPI_SUCCESS) {
+                plasma_error("MPI_Irecv() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+#endif
+    memset(ranks, 0, A.p*A.q);
+}
+
+/***************************************************************************//**
+ *  Broadcasts count elements of the given type from the process root to
+ *  the processes of the grid of A, outside of the tasks.
+ ******************************************************************************/
+void plasma_mpi_bcast(plasma_desc_t A, void *buf, int count,
+                      plasma_enum_t type, int root)
+{
+    if (A.p*A.q <= 1)
+        return;
+
+#if defined(PLASMA_WITH_MPI)
+    MPI_Bcast(buf, count*(int)plasma_element_size(type), MPI_BYTE,
+              root, plasma_mpi_comm);
+#endif
+}
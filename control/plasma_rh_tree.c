@@ -7,6 +7,7 @@
  *  University of Manchester, UK.
  **/
 
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_rh_tree.h"
@@ -19,7 +20,7 @@ void plasma_rh_tree_flat_ts(int mt, int nt,
 void plasma_rh_tree_flat_tt(int mt, int nt,
                             int **operations, int *num_operations);
 
-void plasma_rh_tree_plasmatree(int mt, int nt,
+void plasma_rh_tree_plasmatree(int mt, int nt, int bs,
                                int **operations, int *num_operations);
 
 void plasma_rh_tree_greedy(int mt, int nt,
@@ -29,33 +30,197 @@ void plasma_rh_tree_auto_forest(int mt, int nt,
                                 int **operations, int *num_operations,
                                 int concurrency);
 
+/***************************************************************************//**
+ *  Picks a reduction tree from the shape of the matrix in tiles
+ *  and the number of threads.
+ **/
+static plasma_enum_t plasma_rh_tree_auto(int mt, int nt, int concurrency)
+{
+    if (mt <= 2) {
+        // Nothing to reduce in parallel.
+        return PlasmaFlatTsTree;
+    }
+    else if (nt == 1 || (mt >= 4*nt && nt < concurrency)) {
+        // Tall and skinny: the updates cannot keep the threads busy,
+        // so the shortest critical path wins.
+        return PlasmaGreedyTree;
+    }
+    else if (mt > nt) {
+        // Tall: flat trees sized to the concurrency of each column.
+        return PlasmaAutoForestTree;
+    }
+    else {
+        return PlasmaPlasmaTree;
+    }
+}
+
+/***************************************************************************//**
+ *  Returns the Householder mode of the QR or LQ factorization of an
+ *  mt-by-nt tile matrix, resolving PlasmaAutoHouseholder.
+ *  The flat tree reduces a tall and skinny matrix, or a short and wide one
+ *  for LQ, in a chain of TS kernels down the whole column, with at most
+ *  min(mt, nt) update tasks beside it. Such matrices take the tree mode,
+ *  as in TSQR, as long as there are threads to run the reduction in parallel.
+ *  With a nonzero PlasmaTsBlock, a flat factorization longer than one block
+ *  takes the tree mode, with the blocked tree of plasma_rh_tree_operations.
+ *  The factorization and the application of its Q must see the same context.
+ **/
+plasma_enum_t plasma_householder_mode(plasma_context_t *plasma, int mt, int nt)
+{
+    plasma_enum_t mode = plasma->householder_mode;
+    int kt = imin(mt, nt);
+    int lt = imax(mt, nt);
+    if (mode == PlasmaAutoHouseholder) {
+        if (kt <= 4 && lt >= 8*kt && plasma->max_threads > kt)
+            mode = PlasmaTreeHouseholder;
+        else
+            mode = PlasmaFlatHouseholder;
+    }
+    if (mode == PlasmaFlatHouseholder &&
+        plasma->ts_block > 0 && lt > plasma->ts_block)
+        mode = PlasmaTreeHouseholder;
+
+    return mode;
+}
+
+/******************************************************************************/
+// Generates the list of operations of the given tree.
+static void plasma_rh_tree_generate(plasma_enum_t tree, int mt, int nt,
+                                    int concurrency, int domain_size,
+                                    int **operations, int *num_operations)
+{
+    switch (tree) {
+    case PlasmaFlatTsTree:
+        // Flat tree as in the standard geqrf routine.
+        // Combines only GE and TS kernels.
+        plasma_rh_tree_flat_ts(mt, nt, operations, num_operations);
+        break;
+    case PlasmaFlatTtTree:
+        // Flat tree combining only GE and TT kernels.
+        plasma_rh_tree_flat_tt(mt, nt, operations, num_operations);
+        break;
+    case PlasmaGreedyTree:
+        // Pure Greedy algorithm combining only GE and TT kernels.
+        plasma_rh_tree_greedy(mt, nt, operations, num_operations);
+        break;
+    case PlasmaAutoForestTree:
+        // Binary forest of flat trees.
+        plasma_rh_tree_auto_forest(mt, nt, operations, num_operations,
+                                   concurrency);
+        break;
+    default:
+        // PLASMA-Tree from PLASMA 2.8.0
+        plasma_rh_tree_plasmatree(mt, nt, domain_size,
+                                  operations, num_operations);
+        break;
+    }
+}
+
 /***************************************************************************//**
  *  Routine for precomputing a given order of operations for tile
  *  QR and LQ factorization.
+ *  The tree is chosen by the PlasmaHouseholderTree parameter of the context,
+ *  unless PlasmaTsBlock is set and the tree mode is not: the hybrid of the
+ *  flat mode then reduces blocks of ts_block tiles of each column by TS
+ *  kernels, in place of one long chain, and the heads of the blocks by
+ *  a binary tree of TT kernels, as the PLASMA tree with domains of
+ *  ts_block tiles.
+ *  Q must be applied with the tree used by the factorization, so the thread
+ *  count of the automatic choices is fixed by the context.
+ *
+ *  The list is kept in the context for later calls with the same tree and
+ *  shape, and must be returned with plasma_rh_tree_release.
+ *  Safe to call from tasks running on the threads of the context.
  * @see plasma_omp_zgeqrf
  **/
-void plasma_rh_tree_operations(int mt, int nt,
+void plasma_rh_tree_operations(plasma_context_t *plasma, int mt, int nt,
                                int **operations, int *num_operations)
 {
-    // Different algorithms can be implemented and switched here:
-
-    // Flat tree as in the standard geqrf routine.
-    // Combines only GE and TS kernels. Included mainly for debugging.
-    //plasma_rh_tree_flat_ts(mt, nt, operations, num_operations);
+    int concurrency = plasma->max_threads;
+    plasma_enum_t tree = plasma->householder_tree;
+    if (tree == PlasmaAutoTree)
+        tree = plasma_rh_tree_auto(mt, nt, concurrency);
+    int domain_size = tree == PlasmaPlasmaTree ? plasma->tree_domain_size : 0;
+    if (plasma->ts_block > 0 &&
+        plasma->householder_mode != PlasmaTreeHouseholder) {
+        tree = PlasmaPlasmaTree;
+        domain_size = plasma->ts_block;
+    }
 
-    // Flat tree as in the standard geqrf routine, but this time
-    // combines only GE and TT kernels.
-    //plasma_rh_tree_flat_tt(mt, nt, operations, num_operations);
+    pthread_mutex_lock(&plasma->tree_cache_lock);
+
+    // Look for the list in the cache.
+    for (int i = 0; i < PlasmaTreeCacheMaxSize; i++) {
+        plasma_tree_cache_t *entry = &plasma->tree_cache[i];
+        if (entry->operations != NULL &&
+            entry->tree == tree &&
+            entry->mt == mt && entry->nt == nt &&
+            entry->concurrency == concurrency &&
+            entry->domain_size == domain_size) {
+
+            entry->users++;
+            *operations = entry->operations;
+            *num_operations = entry->num_operations;
+            pthread_mutex_unlock(&plasma->tree_cache_lock);
+            return;
+        }
+    }
 
-    // PLASMA-Tree from PLASMA 2.8.0
-    plasma_rh_tree_plasmatree(mt, nt, operations, num_operations);
+    plasma_rh_tree_generate(tree, mt, nt, concurrency, domain_size,
+                            operations, num_operations);
+
+    // Replace an entry not in use, in round-robin order.
+    // If all entries are in use, the list is not cached.
+    for (int j = 0; j < PlasmaTreeCacheMaxSize; j++) {
+        int i = (plasma->tree_cache_next+j)%PlasmaTreeCacheMaxSize;
+        plasma_tree_cache_t *entry = &plasma->tree_cache[i];
+        if (entry->users == 0) {
+            free(entry->operations);
+            entry->tree = tree;
+            entry->mt = mt;
+            entry->nt = nt;
+            entry->concurrency = concurrency;
+            entry->domain_size = domain_size;
+            entry->operations = *operations;
+            entry->num_operations = *num_operations;
+            entry->users = 1;
+            plasma->tree_cache_next = (i+1)%PlasmaTreeCacheMaxSize;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&plasma->tree_cache_lock);
+}
 
-    // Pure Greedy algorithm combining only GE and TT kernels.
-    //plasma_rh_tree_greedy(mt, nt, operations, num_operations);
+/***************************************************************************//**
+ *  Returns a list of operations from plasma_rh_tree_operations.
+ *  The list stays in the cache, or is freed if it was not cached.
+ **/
+void plasma_rh_tree_release(plasma_context_t *plasma, int *operations)
+{
+    pthread_mutex_lock(&plasma->tree_cache_lock);
+    for (int i = 0; i < PlasmaTreeCacheMaxSize; i++) {
+        if (plasma->tree_cache[i].operations == operations) {
+            plasma->tree_cache[i].users--;
+            pthread_mutex_unlock(&plasma->tree_cache_lock);
+            return;
+        }
+    }
+    pthread_mutex_unlock(&plasma->tree_cache_lock);
+    free(operations);
+}
 
-    // Binary forest of flat trees.
-    //int ncores = omp_get_num_threads();
-    //plasma_rh_tree_auto_forest(mt, nt, operations, num_operations, ncores);
+/***************************************************************************//**
+ *  Frees all lists of operations held in the cache.
+ *  No list may be in use.
+ **/
+void plasma_rh_tree_cache_clear(plasma_context_t *plasma)
+{
+    for (int i = 0; i < PlasmaTreeCacheMaxSize; i++) {
+        assert(plasma->tree_cache[i].users == 0);
+        free(plasma->tree_cache[i].operations);
+        plasma->tree_cache[i].operations = NULL;
+    }
+    plasma->tree_cache_next = 0;
 }
 
 /***************************************************************************//**
@@ -167,11 +332,9 @@ void plasma_rh_tree_flat_tt(int mt, int nt,
  *  a binary-tree fashion.
  * @see plasma_omp_zgeqrf
  **/
-void plasma_rh_tree_plasmatree(int mt, int nt,
+void plasma_rh_tree_plasmatree(int mt, int nt, int BS,
                                int **operations, int *num_operations)
 {
-    static const int BS = 4;
-
     // How many columns to involve?
     int minnt = imin(mt, nt);
 
@@ -0,0 +1,321 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_predict.h"
+#include "plasma_allocator.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_trace.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char name[PlasmaPredictMaxName];
+    int nb;
+    double rate;     // flop/s, 0 for the kernels without modeled flops
+    double seconds;  // time per task
+} plasma_predict_kernel_t;
+
+typedef struct {
+    char routine[PlasmaPredictMaxName];
+    int nb;
+} plasma_predict_routine_t;
+
+// The model is shared by the contexts of all threads.
+static plasma_predict_kernel_t predict_kernels[PlasmaPredictMaxKernels];
+static int predict_num_kernels = 0;
+static plasma_predict_routine_t predict_routines[PlasmaPredictMaxRoutines];
+static int predict_num_routines = 0;
+static pthread_mutex_t predict_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/******************************************************************************/
+// Returns the model of kernel name at the nb closest to nb, NULL if none.
+// Called with predict_lock held.
+static const plasma_predict_kernel_t *plasma_predict_kernel(const char *name,
+                                                            int nb)
+{
+    const plasma_predict_kernel_t *closest = NULL;
+    double distance = INFINITY;
+    for (int i = 0; i < predict_num_kernels; i++) {
+        if (strcmp(predict_kernels[i].name, name) != 0)
+            continue;
+        double d = fabs(log((double)predict_kernels[i].nb/nb));
+        if (d < distance) {
+            distance = d;
+            closest = &predict_kernels[i];
+        }
+    }
+    return closest;
+}
+
+/******************************************************************************/
+// Cost in seconds of a task of kernel name and modeled work, by the model
+// of its kernel, else by the gemm rate of its precision. Called with
+// predict_lock held.
+static double plasma_predict_cost(void *arg, const char *name,
+                                  double flops, double bytes)
+{
+    int nb = *(int*)arg;
+    const plasma_predict_kernel_t *kernel = plasma_predict_kernel(name, nb);
+    if (kernel != NULL && (flops == 0.0 || kernel->rate == 0.0))
+        return kernel->seconds;
+
+    if (kernel == NULL && flops > 0.0 && name[0] != '\0') {
+        char gemm[PlasmaPredictMaxName] = "?gemm";
+        gemm[0] = name[0];
+        kernel = plasma_predict_kernel(gemm, nb);
+    }
+    if (kernel != NULL && kernel->rate > 0.0)
+        return flops/kernel->rate;
+
+    return 0.0;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_predict
+    Records in the model the rates and times per task of the kernels counted
+    since plasma_set(PlasmaStats, PlasmaStatsOn) or plasma_stats_reset(),
+    at the tile size PlasmaNb, replacing those of the same kernels and nb,
+    and marks routine as calibrated at this nb.
+
+    @param[in] routine
+        The name of the calibrated routine, e.g., "zpotrf".
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_predict_record(const char *routine)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (routine == NULL || strlen(routine) >= PlasmaPredictMaxName) {
+        plasma_error("invalid routine name");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_stats_t stats[PlasmaStatsMaxKernels+1];
+    int num_stats = PlasmaStatsMaxKernels+1;
+    int retval = plasma_stats_get(stats, &num_stats);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    int nb = plasma->nb;
+    retval = PlasmaSuccess;
+    pthread_mutex_lock(&predict_lock);
+    for (int s = 0; s < num_stats; s++) {
+        if (stats[s].kind == PlasmaStatsIdle || stats[s].calls == 0 ||
+            strlen(stats[s].name) >= PlasmaPredictMaxName)
+            continue;
+
+        int i;
+        for (i = 0; i < predict_num_kernels; i++)
+            if (predict_kernels[i].nb == nb &&
+                strcmp(predict_kernels[i].name, stats[s].name) == 0)
+                break;
+        if (i == PlasmaPredictMaxKernels) {
+            retval = PlasmaErrorOutOfMemory;
+            break;
+        }
+        if (i == predict_num_kernels)
+            predict_num_kernels++;
+
+        strcpy(predict_kernels[i].name, stats[s].name);
+        predict_kernels[i].nb = nb;
+        predict_kernels[i].rate = stats[s].flops > 0.0 && stats[s].time > 0.0
+                                ? stats[s].flops/stats[s].time : 0.0;
+        predict_kernels[i].seconds = stats[s].time/stats[s].calls;
+    }
+    if (retval == PlasmaSuccess) {
+        int i;
+        for (i = 0; i < predict_num_routines; i++)
+            if (predict_routines[i].nb == nb &&
+                strcmp(predict_routines[i].routine, routine) == 0)
+                break;
+        if (i == PlasmaPredictMaxRoutines) {
+            retval = PlasmaErrorOutOfMemory;
+        }
+        else if (i == predict_num_routines) {
+            strcpy(predict_routines[i].routine, routine);
+            predict_routines[i].nb = nb;
+            predict_num_routines++;
+        }
+    }
+    pthread_mutex_unlock(&predict_lock);
+
+    if (retval != PlasmaSuccess)
+        plasma_error("performance model full");
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_predict
+    Returns whether routine is calibrated at the tile size PlasmaNb.
+*/
+int plasma_predict_calibrated(const char *routine)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL || routine == NULL)
+        return 0;
+
+    int calibrated = 0;
+    pthread_mutex_lock(&predict_lock);
+    for (int i = 0; i < predict_num_routines && !calibrated; i++)
+        calibrated = predict_routines[i].nb == plasma->nb &&
+                     strcmp(predict_routines[i].routine, routine) == 0;
+    pthread_mutex_unlock(&predict_lock);
+    return calibrated;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_predict
+    Clears the model, e.g., after a change of the node or of the BLAS,
+    so that the next predictions calibrate the routines again.
+*/
+void plasma_predict_clear()
+{
+    pthread_mutex_lock(&predict_lock);
+    predict_num_kernels = 0;
+    predict_num_routines = 0;
+    pthread_mutex_unlock(&predict_lock);
+}
+
+/******************************************************************************/
+// Starts the task counters for a calibration run, saving the PlasmaStats
+// of the context in *stats.
+int plasma_predict_calibrate_begin(plasma_enum_t *stats)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+#if !defined(PLASMA_WITH_TRACE)
+    plasma_error("prediction needs PLASMA built with -DPLASMA_WITH_TRACE");
+    return PlasmaErrorNotSupported;
+#endif
+    *stats = plasma->stats;
+    return plasma_set(PlasmaStats, PlasmaStatsOn);
+}
+
+/******************************************************************************/
+// Records the kernels of the calibration run of routine in the model,
+// and restores the PlasmaStats of the context.
+int plasma_predict_calibrate_end(const char *routine, plasma_enum_t stats)
+{
+    int retval = plasma_predict_record(routine);
+    plasma_set(PlasmaStats, stats);
+    return retval;
+}
+
+/******************************************************************************/
+// Starts a dry run recording the task graph of a call, saving the
+// PlasmaDryRun of the context in *dry_run.
+int plasma_predict_run_begin(plasma_enum_t *dry_run)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+#if !defined(PLASMA_WITH_TRACE)
+    plasma_error("prediction needs PLASMA built with -DPLASMA_WITH_TRACE");
+    return PlasmaErrorNotSupported;
+#endif
+    *dry_run = plasma->dry_run;
+    return plasma_set(PlasmaDryRun, PlasmaDryRunOn);
+}
+
+/******************************************************************************/
+// Ends the dry run, restoring the PlasmaDryRun of the context, and predicts
+// the time of the call in seconds from its task graph and the model.
+int plasma_predict_run_end(plasma_enum_t dry_run, plasma_time_t *time)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (dry_run == PlasmaDryRunOff)
+        plasma_set(PlasmaDryRun, PlasmaDryRunOff);
+
+    int nb = plasma->nb;
+    double work;
+    double span;
+    pthread_mutex_lock(&predict_lock);
+    int retval = plasma_trace_dag_eval(plasma_predict_cost, &nb,
+                                       &work, &span);
+    pthread_mutex_unlock(&predict_lock);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    *time = work/plasma_num_threads(plasma) + span;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Creates an m-by-n tile matrix for the dry run of a prediction, which
+// compares the addresses of its tiles but never accesses them, so that its
+// storage is only reserved, whatever its size.
+int plasma_predict_desc_create(plasma_enum_t precision, int mb, int nb,
+                               int m, int n, plasma_desc_t *A)
+{
+    int retval = plasma_desc_general_init(precision, NULL, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    A->matrix = plasma_allocator_reserve(plasma_desc_storage_size(*A));
+    if (A->matrix == NULL) {
+        plasma_error("plasma_allocator_reserve() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Creates the T factors of A for the dry run of a prediction, with the tiles
+// of plasma_descT_compact_create(), on reserved storage.
+int plasma_predict_descT_create(plasma_desc_t A, int ib,
+                                plasma_enum_t householder_mode,
+                                plasma_enum_t storev, plasma_desc_t *T)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    int mt = A.mt;
+    int nt = A.nt;
+    if (plasma->t_storage == PlasmaCompactT) {
+        if (storev == PlasmaColumnwise)
+            nt = imin(A.mt, A.nt);
+        else
+            mt = imin(A.mt, A.nt);
+    }
+    if (householder_mode == PlasmaTreeHouseholder)
+        nt = 2*nt;
+
+    return plasma_predict_desc_create(A.precision, ib, A.nb,
+                                      mt*ib, nt*A.nb, T);
+}
+
+/******************************************************************************/
+void plasma_predict_desc_destroy(plasma_desc_t *A)
+{
+    plasma_allocator_release(A->matrix, plasma_desc_storage_size(*A));
+    A->matrix = NULL;
+}
@@ -0,0 +1,286 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_session.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <omp.h>
+
+/******************************************************************************/
+// a body submitted to the session, queued until its task is created
+typedef struct plasma_session_job_s {
+    plasma_sequence_t *sequence;
+    void (*body)(plasma_sequence_t *sequence, void *arg);
+    void *arg;
+    struct plasma_session_job_s *next;
+} plasma_session_job_t;
+
+struct plasma_session_s {
+    plasma_context_t *plasma;    ///< context of the creating thread
+    pthread_t thread;            ///< thread of the parallel region
+    pthread_mutex_t lock;        ///< protects the queue and closing
+    pthread_cond_t submitted;    ///< signaled on submission and closing
+    pthread_cond_t completed;    ///< broadcast on completion of a sequence
+    plasma_session_job_t *head;  ///< queue of the bodies to submit
+    plasma_session_job_t *tail;
+    int closing;                 ///< set by plasma_session_destroy()
+};
+
+/******************************************************************************/
+// Runs the body of the job in a taskgroup, then completes its sequence and
+// wakes up the threads waiting in plasma_session_wait().
+static void plasma_session_run(plasma_session_t *session,
+                               plasma_session_job_t *job)
+{
+    plasma_sequence_t *sequence = job->sequence;
+
+    #pragma omp task firstprivate(session, job, sequence) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        #pragma omp taskgroup
+        {
+            job->body(sequence, job->arg);
+        }
+        free(job);
+        plasma_sequence_complete(sequence);
+
+        // The waiters test the sequence under the lock.
+        pthread_mutex_lock(&session->lock);
+        pthread_cond_broadcast(&session->completed);
+        pthread_mutex_unlock(&session->lock);
+    }
+}
+
+/******************************************************************************/
+// Thread of the session: opens the parallel region, in which the master
+// creates the tasks of the bodies as they are submitted, and the other
+// threads run them.
+static void *plasma_session_main(void *arg)
+{
+    plasma_session_t *session = (plasma_session_t*)arg;
+    plasma_context_t *plasma = session->plasma;
+
+    plasma_context_share(plasma);
+    #pragma omp parallel num_threads(plasma_num_threads(plasma)+1)
+    {
+        plasma_context_share(plasma);
+
+        #pragma omp master
+        {
+            pthread_mutex_lock(&session->lock);
+            for (;;) {
+                while (session->head == NULL && !session->closing)
+                    pthread_cond_wait(&session->submitted, &session->lock);
+
+                plasma_session_job_t *job = session->head;
+                if (job == NULL)
+                    break;
+                session->head = job->next;
+                if (session->head == NULL)
+                    session->tail = NULL;
+
+                pthread_mutex_unlock(&session->lock);
+                plasma_session_run(session, job);
+                pthread_mutex_lock(&session->lock);
+            }
+            pthread_mutex_unlock(&session->lock);
+        }
+        // Wait for the tasks before leaving the context.
+        #pragma omp barrier
+        plasma_context_share(NULL);
+    }
+    plasma_context_share(NULL);
+    return NULL;
+}
+
+/***************************************************************************//**
+ *  Opens a session on the context of the calling thread, see
+ *  plasma_session.h. Must be called outside of any parallel region.
+ ******************************************************************************/
+int plasma_session_create(plasma_session_t **session)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    if (omp_in_parallel()) {
+        plasma_error("session created inside a parallel region");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_session_t *s = (plasma_session_t*)malloc(sizeof(plasma_session_t));
+    if (s == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    s->plasma = plasma;
+    s->head = NULL;
+    s->tail = NULL;
+    s->closing = 0;
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->submitted, NULL);
+    pthread_cond_init(&s->completed, NULL);
+
+    if (pthread_create(&s->thread, NULL, plasma_session_main, s) != 0) {
+        plasma_error("pthread_create() failed");
+        pthread_cond_destroy(&s->completed);
+        pthread_cond_destroy(&s->submitted);
+        pthread_mutex_destroy(&s->lock);
+        free(s);
+        return PlasmaErrorInternal;
+    }
+    *session = s;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Waits for all the sequences submitted to the session, then closes its
+ *  parallel region and frees it.
+ ******************************************************************************/
+int plasma_session_destroy(plasma_session_t *session)
+{
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    pthread_mutex_lock(&session->lock);
+    session->closing = 1;
+    pthread_cond_signal(&session->submitted);
+    pthread_mutex_unlock(&session->lock);
+
+    pthread_join(session->thread, NULL);
+
+    pthread_cond_destroy(&session->completed);
+    pthread_cond_destroy(&session->submitted);
+    pthread_mutex_destroy(&session->lock);
+    free(session);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Submits body(sequence, arg), which calls the asynchronous functions of
+ *  the sequence, to the session, and returns without waiting for it, as
+ *  plasma_sequence_run() does inside a parallel region. The sequence is not
+ *  shared with other bodies running at the same time; wait for it with
+ *  plasma_session_wait(), or get its callback, which runs on a thread of
+ *  the session.
+ ******************************************************************************/
+int plasma_session_submit(plasma_session_t *session,
+                          plasma_sequence_t *sequence,
+                          void (*body)(plasma_sequence_t *sequence, void *arg),
+                          void *arg)
+{
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    if (body == NULL) {
+        plasma_error("NULL body");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_session_job_t *job =
+        (plasma_session_job_t*)malloc(sizeof(plasma_session_job_t));
+    if (job == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    job->sequence = sequence;
+    job->body = body;
+    job->arg = arg;
+    job->next = NULL;
+
+    #pragma omp atomic write
+    sequence->complete = 0;
+
+    pthread_mutex_lock(&session->lock);
+    if (session->closing) {
+        pthread_mutex_unlock(&session->lock);
+        free(job);
+        plasma_error("session closing");
+        return PlasmaErrorIllegalValue;
+    }
+    if (session->tail == NULL)
+        session->head = job;
+    else
+        session->tail->next = job;
+    session->tail = job;
+    pthread_cond_signal(&session->submitted);
+    pthread_mutex_unlock(&session->lock);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Waits for a sequence submitted to the session to complete, and returns
+ *  its status. The calling thread, outside of the session, sleeps in the
+ *  meantime, while the other sequences go on.
+ ******************************************************************************/
+int plasma_session_wait(plasma_session_t *session,
+                        plasma_sequence_t *sequence)
+{
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorIllegalValue;
+    }
+    pthread_mutex_lock(&session->lock);
+    while (!plasma_sequence_test(sequence))
+        pthread_cond_wait(&session->completed, &session->lock);
+    pthread_mutex_unlock(&session->lock);
+    return sequence->status;
+}
+
+/***************************************************************************//**
+ *  Creates a descriptor of an m-by-n matrix in tile layout, with the square
+ *  tiles of PlasmaNb of the context of the session, for the bodies of its
+ *  sequences, e.g., filled by plasma_omp_zge2desc(). Freed by
+ *  plasma_session_desc_destroy(), once the sequences using it completed.
+ ******************************************************************************/
+int plasma_session_desc_create(plasma_session_t *session,
+                               plasma_enum_t precision, int m, int n,
+                               plasma_desc_t *A)
+{
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    int nb = session->plasma->nb;
+    int retval = plasma_desc_general_create(precision, nb, nb,
+                                            m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess)
+        plasma_error("plasma_desc_general_create() failed");
+    return retval;
+}
+
+/******************************************************************************/
+int plasma_session_desc_destroy(plasma_session_t *session, plasma_desc_t *A)
+{
+    if (session == NULL) {
+        plasma_error("NULL session");
+        return PlasmaErrorIllegalValue;
+    }
+    return plasma_desc_destroy(A);
+}
@@ -0,0 +1,55 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_starpu.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+
+#if defined(PLASMA_WITH_STARPU)
+
+/***************************************************************************//**
+ *  Registers the tiles of A as StarPU matrices in main memory.
+ *  Returns the handles, or NULL if they cannot be allocated.
+ ******************************************************************************/
+starpu_data_handle_t *plasma_starpu_register(plasma_desc_t A)
+{
+    starpu_data_handle_t *handles = (starpu_data_handle_t*)malloc(
+        (size_t)A.mt*A.nt*sizeof(starpu_data_handle_t));
+    if (handles == NULL)
+        return NULL;
+
+    size_t eltsize = plasma_element_size(A.precision);
+    for (int n = 0; n < A.nt; n++) {
+        for (int m = 0; m < A.mt; m++) {
+            starpu_matrix_data_register(
+                &PLASMA_STARPU_TILE(handles, A, m, n), STARPU_MAIN_RAM,
+                (uintptr_t)plasma_tile_addr(A, m, n),
+                plasma_tile_mmain(A, m),
+                plasma_tile_mview(A, m), plasma_tile_nview(A, n),
+                eltsize);
+        }
+    }
+    return handles;
+}
+
+/***************************************************************************//**
+ *  Unregisters the tiles of A, waiting for their tasks and bringing them
+ *  back to main memory, and frees the handles.
+ ******************************************************************************/
+void plasma_starpu_unregister(plasma_desc_t A, starpu_data_handle_t *handles)
+{
+    for (int n = 0; n < A.nt; n++)
+        for (int m = 0; m < A.mt; m++)
+            starpu_data_unregister(PLASMA_STARPU_TILE(handles, A, m, n));
+    free(handles);
+}
+
+#endif // PLASMA_WITH_STARPU
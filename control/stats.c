@@ -0,0 +1,358 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Counters of the context counting the tasks, one context at a time.
+static plasma_stats_thread_t *stats_threads = NULL;
+static int stats_num_threads = 0;
+
+/******************************************************************************/
+// Kinds of the kernels, named without the precisions, e.g., zgemm, dsgemm.
+// Names ending with '_' are prefixes, e.g., getrf_ for zgetrf_panel.
+static const struct {
+    const char *name;
+    plasma_enum_t kind;
+} stats_kinds[] = {
+    {"getrf_update", PlasmaStatsUpdate},
+    {"pbtrf_update", PlasmaStatsUpdate},
+    {"pbtrf_panel",  PlasmaStatsPanel},
+    {"getrf",  PlasmaStatsPanel},       {"getrf_",  PlasmaStatsPanel},
+    {"potrf",  PlasmaStatsPanel},       {"geqrt",   PlasmaStatsPanel},
+    {"gelqt",  PlasmaStatsPanel},       {"tsqrt",   PlasmaStatsPanel},
+    {"tslqt",  PlasmaStatsPanel},       {"ttqrt",   PlasmaStatsPanel},
+    {"ttlqt",  PlasmaStatsPanel},       {"larft_",  PlasmaStatsPanel},
+    {"hegst",  PlasmaStatsPanel},       {"sygst",   PlasmaStatsPanel},
+    {"pstrf",  PlasmaStatsPanel},
+    {"gemm",   PlasmaStatsUpdate},      {"gemm_",   PlasmaStatsUpdate},
+    {"gemmt",  PlasmaStatsUpdate},      {"trsm",    PlasmaStatsUpdate},
+    {"trmm",   PlasmaStatsUpdate},      {"herk",    PlasmaStatsUpdate},
+    {"syrk",   PlasmaStatsUpdate},      {"her2k",   PlasmaStatsUpdate},
+    {"syr2k",  PlasmaStatsUpdate},      {"hemm",    PlasmaStatsUpdate},
+    {"symm",   PlasmaStatsUpdate},      {"tsmqr",   PlasmaStatsUpdate},
+    {"tsmlq",  PlasmaStatsUpdate},      {"ttmqr",   PlasmaStatsUpdate},
+    {"ttmlq",  PlasmaStatsUpdate},      {"unmqr",   PlasmaStatsUpdate},
+    {"unmlq",  PlasmaStatsUpdate},      {"ormqr",   PlasmaStatsUpdate},
+    {"ormlq",  PlasmaStatsUpdate},      {"laswp",   PlasmaStatsUpdate},
+    {"parfb_", PlasmaStatsUpdate},
+    {"geadd",  PlasmaStatsUpdate},      {"tradd",   PlasmaStatsUpdate},
+    {"lacpy",  PlasmaStatsTranslation}, {"lacpy_",  PlasmaStatsTranslation},
+    {"lag2c",  PlasmaStatsTranslation}, {"lag2c_",  PlasmaStatsTranslation},
+    {"lag2s",  PlasmaStatsTranslation}, {"lag2s_",  PlasmaStatsTranslation}
+};
+
+static int stats_match(const char *name, const char *kind)
+{
+    size_t len = strlen(kind);
+    if (kind[len-1] == '_')
+        return strncmp(name, kind, len) == 0;
+    return strcmp(name, kind) == 0;
+}
+
+/******************************************************************************/
+// Returns the kind of the kernel name: PlasmaStatsPanel, PlasmaStatsUpdate,
+// PlasmaStatsTranslation or PlasmaStatsOther.
+plasma_enum_t plasma_stats_kind(const char *name)
+{
+    int num_kinds = sizeof(stats_kinds)/sizeof(stats_kinds[0]);
+    for (int skip = 1; skip <= 2 && name[skip-1] != '\0'; skip++)
+        for (int k = 0; k < num_kinds; k++)
+            if (stats_match(&name[skip], stats_kinds[k].name))
+                return stats_kinds[k].kind;
+    return PlasmaStatsOther;
+}
+
+/******************************************************************************/
+static unsigned stats_hash(const char *name)
+{
+    unsigned h = 5381;
+    for (; *name != '\0'; name++)
+        h = 33*h + (unsigned char)*name;
+    return h & (PlasmaStatsMaxKernels-1);
+}
+
+static void stats_clear(plasma_stats_thread_t *threads, int num_threads)
+{
+    memset(threads, 0, num_threads*sizeof(plasma_stats_thread_t));
+    for (int t = 0; t < num_threads; t++) {
+        threads[t].first = INFINITY;
+        threads[t].last = -INFINITY;
+    }
+}
+
+/******************************************************************************/
+// Starts counting the tasks in the counters *stats of num_threads threads,
+// allocated on the first call and cleared. Called by plasma_set().
+int plasma_stats_enable(plasma_stats_thread_t **stats, int num_threads)
+{
+    if (*stats == NULL) {
+        *stats = (plasma_stats_thread_t*)
+            malloc(num_threads*sizeof(plasma_stats_thread_t));
+        if (*stats == NULL) {
+            plasma_error("malloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+    }
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(0);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    stats_clear(*stats, num_threads);
+    stats_threads = *stats;
+    stats_num_threads = num_threads;
+    plasma_trace_on = on | PlasmaTraceStats;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Stops counting the tasks if they are counted in stats.
+void plasma_stats_disable(plasma_stats_thread_t *stats)
+{
+    if (stats != stats_threads)
+        return;
+
+    plasma_trace_on &= ~PlasmaTraceStats;
+    stats_threads = NULL;
+    stats_num_threads = 0;
+}
+
+/******************************************************************************/
+// Counts a task of thread, started at start and ended at stop,
+// busy for time without its nested tasks. Called by the hooks.
+void plasma_stats_add(int thread, const char *name,
+                      double start, double stop, double time,
+                      double flops, double bytes)
+{
+    plasma_stats_thread_t *counters = stats_threads;
+    if (counters == NULL || thread >= stats_num_threads)
+        return;
+
+    plasma_stats_thread_t *t = &counters[thread];
+    for (unsigned h = stats_hash(name), i = 0; i < PlasmaStatsMaxKernels;
+         h = (h+1) & (PlasmaStatsMaxKernels-1), i++) {
+        plasma_stats_t *kernel = &t->kernels[h];
+        if (kernel->name == NULL) {
+            kernel->name = name;
+            kernel->kind = plasma_stats_kind(name);
+        }
+        else if (kernel->name != name && strcmp(kernel->name, name) != 0) {
+            continue;
+        }
+        kernel->calls++;
+        kernel->time += time;
+        kernel->flops += flops;
+        kernel->bytes += bytes;
+        break;
+    }
+    if (start < t->first)
+        t->first = start;
+    if (stop > t->last)
+        t->last = stop;
+}
+
+/******************************************************************************/
+static int stats_compare(const void *a, const void *b)
+{
+    double ta = ((const plasma_stats_t*)a)->time;
+    double tb = ((const plasma_stats_t*)b)->time;
+    return (ta < tb) - (ta > tb);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Gets the counters of the tasks of the calling context since
+    plasma_set(PlasmaStats, PlasmaStatsOn) or plasma_stats_reset(),
+    one entry per kernel in decreasing busy time, then an entry named "idle"
+    with the time the threads spent without tasks, from the first to the last
+    task counted. The kinds of the entries give the time of the panels,
+    of the updates and of the layout translations. The tasks are counted
+    when PLASMA is built with -DPLASMA_WITH_TRACE.
+
+    @param[out] stats
+        The counters, of dimension *num_stats.
+
+    @param[in,out] num_stats
+        On entry, the dimension of stats.
+        On exit, the number of entries set, at most PlasmaStatsMaxKernels+1.
+        Kernels that do not fit are dropped, the idle entry is kept.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_stats_get(plasma_stats_t *stats, int *num_stats)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (stats == NULL || num_stats == NULL) {
+        plasma_error("NULL stats or num_stats");
+        return PlasmaErrorNullParameter;
+    }
+    if (*num_stats < 1) {
+        plasma_error("illegal value of num_stats");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_stats_thread_t *threads = plasma->stats_threads;
+    int num_threads = threads != NULL ? plasma->max_threads : 0;
+
+    // Merge the kernels of all threads.
+    plasma_stats_t kernels[PlasmaStatsMaxKernels];
+    int num_kernels = 0;
+    double first = INFINITY;
+    double last = -INFINITY;
+    double busy = 0.0;
+    for (int t = 0; t < num_threads; t++) {
+        for (int h = 0; h < PlasmaStatsMaxKernels; h++) {
+            plasma_stats_t *kernel = &threads[t].kernels[h];
+            if (kernel->name == NULL)
+                continue;
+            int k;
+            for (k = 0; k < num_kernels; k++)
+                if (strcmp(kernels[k].name, kernel->name) == 0)
+                    break;
+            if (k == num_kernels) {
+                if (num_kernels == PlasmaStatsMaxKernels)
+                    continue;
+                kernels[k] = *kernel;
+                num_kernels++;
+            }
+            else {
+                kernels[k].calls += kernel->calls;
+                kernels[k].time += kernel->time;
+                kernels[k].flops += kernel->flops;
+                kernels[k].bytes += kernel->bytes;
+            }
+            busy += kernel->time;
+        }
+        first = fmin(first, threads[t].first);
+        last = fmax(last, threads[t].last);
+    }
+    qsort(kernels, num_kernels, sizeof(plasma_stats_t), stats_compare);
+
+    num_kernels = imin(num_kernels, *num_stats-1);
+    memcpy(stats, kernels, num_kernels*sizeof(plasma_stats_t));
+
+    plasma_stats_t idle = {.name = "idle", .kind = PlasmaStatsIdle};
+    if (last > first)
+        idle.time = fmax(0.0, num_threads*(last-first)-busy);
+    stats[num_kernels] = idle;
+    *num_stats = num_kernels+1;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Counts size bytes of storage taken by a tile matrix or workspace of
+// the context. Called by the create functions of the descriptors and
+// workspaces, possibly from tasks.
+void plasma_stats_memory_acquire(plasma_context_t *context, size_t size)
+{
+    plasma_stats_memory_t *memory = &context->memory;
+    #pragma omp critical(plasma_stats_memory)
+    {
+        memory->current += size;
+        memory->total += size;
+        memory->allocs++;
+        if (memory->current > memory->peak)
+            memory->peak = memory->current;
+    }
+}
+
+/******************************************************************************/
+// Counts size bytes of storage given back by a tile matrix or workspace.
+void plasma_stats_memory_release(plasma_context_t *context, size_t size)
+{
+    plasma_stats_memory_t *memory = &context->memory;
+    #pragma omp critical(plasma_stats_memory)
+    {
+        memory->current -= size < memory->current ? size : memory->current;
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Gets the storage of the tile matrices and workspaces of the calling
+    context: the bytes in use, and the peak and the sum of the bytes taken
+    since plasma_init() or plasma_stats_reset(). Calling
+    plasma_stats_reset() before a call gives its own peak and cumulative
+    bytes, e.g., the tile copies of A and B, the T matrices and the
+    workspaces of plasma_zgels, or the single precision copies of
+    plasma_zcgesv. The storage reused from the descriptor cache and the
+    workspace pool is counted as taken.
+
+    Under plasma_set(PlasmaDryRun, PlasmaDryRunOn), with PLASMA built with
+    -DPLASMA_WITH_TRACE, the call skips its kernels and leaves its fresh
+    storage untouched, so that its peak tells the memory it would need,
+    e.g., for admission control, without faulting the memory in.
+
+    @param[out] memory
+        The counters.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_stats_get_memory(plasma_stats_memory_t *memory)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (memory == NULL) {
+        plasma_error("NULL memory");
+        return PlasmaErrorNullParameter;
+    }
+    #pragma omp critical(plasma_stats_memory)
+    {
+        *memory = plasma->memory;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Clears the counters of the tasks of the calling context, e.g., before a
+    call to get its counters after it with plasma_stats_get(), and the peak
+    and the sum of the bytes taken of plasma_stats_get_memory(), the peak
+    starting from the bytes in use.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_stats_reset()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->stats_threads != NULL) {
+        // Keep the hooks off the counters while clearing them.
+        int on = plasma_trace_on;
+        plasma_trace_on = on & ~PlasmaTraceStats;
+        stats_clear(plasma->stats_threads, plasma->max_threads);
+        plasma_trace_on = on;
+    }
+    #pragma omp critical(plasma_stats_memory)
+    {
+        plasma->memory.peak = plasma->memory.current;
+        plasma->memory.total = 0;
+        plasma->memory.allocs = 0;
+    }
+    return PlasmaSuccess;
+}
@@ -0,0 +1,350 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _GNU_SOURCE
+
+#include "plasma_types.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/******************************************************************************/
+// Tile file format, in the byte order of the machine:
+// - the header, padded to PlasmaTileIoAlignment bytes,
+// - the tile storage of the descriptor, tile by tile in memory order,
+// - aux_size bytes of auxiliary data, e.g., the pivots of an LU handle.
+// Offsets and sizes multiple of PlasmaTileIoAlignment allow O_DIRECT.
+enum {
+    PlasmaTileIoAlignment = 4096,
+    PlasmaTileIoVersion   = 1
+};
+
+static const char tile_io_magic[8] = "PLASMAT";
+
+typedef struct {
+    char magic[8];
+    int64_t version;
+    int64_t type;
+    int64_t uplo;
+    int64_t precision;
+    int64_t mb, nb;
+    int64_t gm, gn;
+    int64_t i, j, m, n;
+    int64_t kl, ku;
+    int64_t aux_size;
+} tile_io_header_t;
+
+/******************************************************************************/
+// Reads or writes all the size bytes at offset, retrying short transfers.
+static int tile_io_transfer(int fd, int write, char *buf, size_t size,
+                            off_t offset)
+{
+    while (size > 0) {
+        ssize_t done = write ? pwrite(fd, buf, size, offset)
+                             : pread(fd, buf, size, offset);
+        if (done <= 0)
+            return PlasmaErrorFileIo;
+        buf += done;
+        size -= done;
+        offset += done;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Reads or writes the tiles of A in parallel, one task per tile.
+// Transfers aligned for O_DIRECT go through fd_direct if it is open.
+static int tile_io_tiles(plasma_desc_t A, int fd, int fd_direct, int write)
+{
+    // Transfer the whole storage, in storage coordinates.
+    plasma_desc_t B = A;
+    B.type = PlasmaGeneral;
+    B.i = 0;
+    B.j = 0;
+    B.it = 0;
+    B.jt = 0;
+    // The file holds the tiles in column-major order, whatever their
+    // layout and padding in memory.
+    plasma_desc_t F = B;
+    F.layout = PlasmaColumnMajorLayout;
+    F.tile_offset = NULL;
+    F.ldpad = 0;
+    size_t eltsize = plasma_element_size(A.precision);
+    int status = PlasmaSuccess;
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int n = 0; n < B.gnt; n++) {
+            for (int m = 0; m < B.gmt; m++) {
+                if (!plasma_tile_stored_general(B, m, n))
+                    continue;
+
+                #pragma omp task shared(status)
+                {
+                    int mb = m < B.gm/B.mb ? B.mb : B.gm%B.mb;
+                    int nb = n < B.gn/B.nb ? B.nb : B.gn%B.nb;
+                    char *tile = (char*)plasma_tile_addr_general(B, m, n);
+                    size_t size = (size_t)mb*nb*eltsize;
+                    off_t offset = PlasmaTileIoAlignment +
+                        ((char*)plasma_tile_addr_general(F, m, n) -
+                         (char*)F.matrix);
+
+                    int tfd = fd;
+                    if (fd_direct >= 0 && B.ldpad == 0 &&
+                        (uintptr_t)tile%PlasmaTileIoAlignment == 0 &&
+                        offset%PlasmaTileIoAlignment == 0 &&
+                        size%PlasmaTileIoAlignment == 0)
+                        tfd = fd_direct;
+
+                    // Padded tiles go column by column.
+                    int ld = plasma_tile_mmain(B, m);
+                    int ncols = B.ldpad == 0 ? 1 : nb;
+                    size_t csize = size/ncols;
+                    for (int j = 0; j < ncols; j++) {
+                        if (tile_io_transfer(tfd, write,
+                                             tile + (size_t)j*ld*eltsize,
+                                             csize, offset + j*csize)
+                            != PlasmaSuccess) {
+                            #pragma omp atomic write
+                            status = PlasmaErrorFileIo;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return status;
+}
+
+/******************************************************************************/
+// Opens path with O_DIRECT if PlasmaTileIo is PlasmaDirectIo,
+// returns -1 otherwise or if the file system does not support it.
+static int tile_io_open_direct(plasma_context_t *plasma, const char *path,
+                               int write)
+{
+#if defined(O_DIRECT)
+    if (plasma->tile_io == PlasmaDirectIo)
+        return open(path, (write ? O_WRONLY : O_RDONLY) | O_DIRECT);
+#endif
+    return -1;
+}
+
+/******************************************************************************/
+static int tile_io_write(plasma_desc_t A, const void *aux, size_t aux_size,
+                         const char *path)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (path == NULL) {
+        plasma_error("NULL path");
+        return PlasmaErrorNullParameter;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return PlasmaErrorIllegalValue;
+    }
+    if (A.tile_precision != NULL) {
+        plasma_error("tiles of mixed precisions not supported");
+        return PlasmaErrorNotSupported;
+    }
+    if (A.tile_lrank != NULL) {
+        plasma_error("compressed tiles not supported");
+        return PlasmaErrorNotSupported;
+    }
+    if (A.rate > 0) {
+        plasma_error("packed tiles not supported");
+        return PlasmaErrorNotSupported;
+    }
+    char *block = (char*)calloc(PlasmaTileIoAlignment, 1);
+    if (block == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    tile_io_header_t header = {
+        .version = PlasmaTileIoVersion,
+        .type = A.type, .uplo = A.uplo, .precision = A.precision,
+        .mb = A.mb, .nb = A.nb, .gm = A.gm, .gn = A.gn,
+        .i = A.i, .j = A.j, .m = A.m, .n = A.n,
+        .kl = A.kl, .ku = A.ku,
+        .aux_size = (int64_t)aux_size
+    };
+    memcpy(header.magic, tile_io_magic, sizeof(header.magic));
+    memcpy(block, &header, sizeof(header));
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(block);
+        plasma_error("open() failed");
+        return PlasmaErrorFileIo;
+    }
+    size_t size = (size_t)A.gm*A.gn*plasma_element_size(A.precision);
+    off_t aux_offset = PlasmaTileIoAlignment + size;
+    int retval = PlasmaErrorFileIo;
+    if (ftruncate(fd, aux_offset + aux_size) == 0 &&
+        tile_io_transfer(fd, 1, block, PlasmaTileIoAlignment, 0)
+        == PlasmaSuccess &&
+        tile_io_transfer(fd, 1, (char*)aux, aux_size, aux_offset)
+        == PlasmaSuccess) {
+        int fd_direct = tile_io_open_direct(plasma, path, 1);
+        retval = tile_io_tiles(A, fd, fd_direct, 1);
+        if (fd_direct >= 0)
+            close(fd_direct);
+    }
+    if (close(fd) != 0)
+        retval = PlasmaErrorFileIo;
+
+    free(block);
+    if (retval != PlasmaSuccess)
+        plasma_error("writing the file failed");
+    return retval;
+}
+
+/******************************************************************************/
+static int tile_io_read(const char *path, plasma_desc_t *A,
+                        void **aux, size_t *aux_size)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (path == NULL || A == NULL) {
+        plasma_error("NULL path or A");
+        return PlasmaErrorNullParameter;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        plasma_error("open() failed");
+        return PlasmaErrorFileIo;
+    }
+    tile_io_header_t h;
+    if (tile_io_transfer(fd, 0, (char*)&h, sizeof(h), 0) != PlasmaSuccess ||
+        memcmp(h.magic, tile_io_magic, sizeof(h.magic)) != 0 ||
+        h.version != PlasmaTileIoVersion || h.aux_size < 0) {
+        close(fd);
+        plasma_error("not a tile file");
+        return PlasmaErrorFileIo;
+    }
+    int retval;
+    if (h.type == PlasmaGeneralBand)
+        retval = plasma_desc_general_band_create(
+            h.precision, h.uplo, h.mb, h.nb, h.gm, h.gn,
+            h.i, h.j, h.m, h.n, h.kl, h.ku, A);
+    else
+        retval = plasma_desc_general_create(
+            h.precision, h.mb, h.nb, h.gm, h.gn, h.i, h.j, h.m, h.n, A);
+    if (retval != PlasmaSuccess) {
+        close(fd);
+        plasma_error("descriptor creation failed");
+        return retval;
+    }
+    // Auxiliary data, read only when requested.
+    size_t size = (size_t)A->gm*A->gn*plasma_element_size(A->precision);
+    if (aux != NULL) {
+        *aux = NULL;
+        *aux_size = h.aux_size;
+        if (h.aux_size > 0) {
+            *aux = malloc(h.aux_size);
+            if (*aux == NULL) {
+                close(fd);
+                plasma_desc_destroy(A);
+                plasma_error("malloc() failed");
+                return PlasmaErrorOutOfMemory;
+            }
+            retval = tile_io_transfer(fd, 0, (char*)*aux, h.aux_size,
+                                      PlasmaTileIoAlignment + size);
+        }
+    }
+    if (retval == PlasmaSuccess) {
+        int fd_direct = tile_io_open_direct(plasma, path, 0);
+        retval = tile_io_tiles(*A, fd, fd_direct, 0);
+        if (fd_direct >= 0)
+            close(fd_direct);
+    }
+    close(fd);
+    if (retval != PlasmaSuccess) {
+        plasma_error("reading the file failed");
+        if (aux != NULL) {
+            free(*aux);
+            *aux = NULL;
+        }
+        plasma_desc_destroy(A);
+    }
+    return retval;
+}
+
+/***************************************************************************//**
+    Writes the tile matrix A to the file path, with one task per tile and
+    without translation. With PlasmaTileIo set to PlasmaDirectIo, the tiles
+    aligned to 4096 bytes bypass the page cache (O_DIRECT), e.g., with
+    tile sizes of 4096 bytes multiples and the huge page allocator.
+    The tiles of descriptors with precision or rank tags
+    (plasma_desc_tile_precision_create, plasma_desc_tile_lrank_create),
+    or packed (plasma_desc_general_packed_create), are not supported.
+*/
+int plasma_desc_write(plasma_desc_t A, const char *path)
+{
+    return tile_io_write(A, NULL, 0, path);
+}
+
+/***************************************************************************//**
+    Creates the tile matrix A saved by plasma_desc_write in the file path,
+    with the tile size and the type of the saved matrix, and reads its tiles
+    with one task per tile. A is freed by plasma_desc_destroy.
+*/
+int plasma_desc_read(const char *path, plasma_desc_t *A)
+{
+    return tile_io_read(path, A, NULL, NULL);
+}
+
+/***************************************************************************//**
+    Writes an LU factorization from plasma_zgetrf_handle_create, the factors
+    and the pivots, to the file path, as plasma_desc_write.
+    The QR factorizations are saved by writing the matrices A and T.
+*/
+int plasma_getrf_handle_write(plasma_getrf_handle_t handle, const char *path)
+{
+    return tile_io_write(handle.A, handle.ipiv,
+                         (size_t)imax(1, handle.A.m)*sizeof(int), path);
+}
+
+/***************************************************************************//**
+    Reads an LU factorization saved by plasma_getrf_handle_write,
+    ready for plasma_zgetrs_handle. Freed by plasma_getrf_handle_destroy.
+*/
+int plasma_getrf_handle_read(const char *path, plasma_getrf_handle_t *handle)
+{
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    void *ipiv;
+    size_t size;
+    int retval = tile_io_read(path, &handle->A, &ipiv, &size);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (size != (size_t)imax(1, handle->A.m)*sizeof(int)) {
+        plasma_error("no pivots in the file");
+        free(ipiv);
+        plasma_desc_destroy(&handle->A);
+        return PlasmaErrorFileIo;
+    }
+    handle->ipiv = (int*)ipiv;
+    return PlasmaSuccess;
+}
@@ -0,0 +1,910 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Ring buffer of one thread, written by that thread only, with the start
+// times of its running tasks, padded to keep two threads off a cache line.
+// The events are allocated for the trace only, not for the stats.
+typedef struct {
+    plasma_trace_event_t *events;
+    unsigned long count;  // number of events recorded, the last ones are kept
+    int depth;            // number of running tasks
+    double start[PlasmaTraceMaxDepth];
+    double nested[PlasmaTraceMaxDepth];  // time of the tasks nested in them
+    double flops;         // work of the running task, from plasma_trace_flops
+    double bytes;
+    char pad[64];
+} trace_thread_t;
+
+// Storage of a tile matrix, to turn the tile addresses into coordinates.
+typedef struct {
+    const char *matrix;
+    size_t size;
+    size_t eltsize;
+    int mb, nb, gm, gn;
+    size_t A21, A12, A22;
+    int morton;   // tiles in Morton order
+    int triangle; // uplo of the tiles in triangular order, or PlasmaGeneral
+    int ldpad;    // padding of the leading dimension of the tiles
+    double time;  // creation time, the storage can be reused afterwards
+} trace_desc_t;
+
+volatile int plasma_trace_on = 0;
+
+static trace_thread_t *trace_threads = NULL;
+static int trace_num_threads = 0;
+
+static trace_desc_t trace_descs[PlasmaTraceMaxDescs];
+static unsigned long trace_num_descs = 0;
+
+/******************************************************************************/
+// Allocates the state of the threads for the hooks, with the ring buffers
+// of the events if events is set. Called with the hooks off.
+static int trace_threads_alloc(int events)
+{
+    int num_threads = omp_get_max_threads();
+    if (trace_num_threads < num_threads) {
+        plasma_trace_finalize();
+        trace_threads = (trace_thread_t*)
+            calloc(num_threads, sizeof(trace_thread_t));
+        if (trace_threads == NULL)
+            return PlasmaErrorOutOfMemory;
+        trace_num_threads = num_threads;
+    }
+    for (int t = 0; t < trace_num_threads; t++) {
+        if (events && trace_threads[t].events == NULL) {
+            trace_threads[t].events = (plasma_trace_event_t*)
+                malloc(PlasmaTraceMaxEvents*sizeof(plasma_trace_event_t));
+            if (trace_threads[t].events == NULL)
+                return PlasmaErrorOutOfMemory;
+        }
+        trace_threads[t].depth = 0;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Prepares the hooks of the threads, with the ring buffers if events is set,
+// stopping the hooks (plasma_trace_on) until the caller restarts them.
+int plasma_trace_threads_create(int events)
+{
+    int retval;
+    #pragma omp critical(plasma_trace)
+    {
+        plasma_trace_on = 0;
+        retval = trace_threads_alloc(events);
+    }
+    if (retval != PlasmaSuccess) {
+        plasma_error("malloc() failed");
+        plasma_trace_finalize();
+    }
+    return retval;
+}
+
+/******************************************************************************/
+int plasma_trace_enable()
+{
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(1);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    for (int t = 0; t < trace_num_threads; t++)
+        trace_threads[t].count = 0;
+    trace_num_descs = 0;
+    plasma_trace_on = on | PlasmaTraceEvents;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_trace_disable()
+{
+    plasma_trace_on &= ~PlasmaTraceEvents;
+}
+
+/******************************************************************************/
+void plasma_trace_finalize()
+{
+    plasma_trace_on = 0;
+    for (int t = 0; t < trace_num_threads; t++)
+        free(trace_threads[t].events);
+    free(trace_threads);
+    trace_threads = NULL;
+    trace_num_threads = 0;
+}
+
+/******************************************************************************/
+// Starts a task of the calling thread, of kernel name and output tile.
+void plasma_trace_begin(const char *name, const void *tile)
+{
+    int t = omp_get_thread_num();
+    if (t >= trace_num_threads)
+        return;
+
+    if (plasma_trace_on & PlasmaTraceMonitor)
+        plasma_monitor_begin(t);
+
+    trace_thread_t *thread = &trace_threads[t];
+    if (thread->depth < PlasmaTraceMaxDepth) {
+        thread->start[thread->depth] = omp_get_wtime();
+        thread->nested[thread->depth] = 0.0;
+        if (plasma_trace_on & PlasmaTracePapi)
+            plasma_trace_papi_begin(t, thread->depth);
+        if (plasma_trace_on & PlasmaTraceAnnotate)
+            plasma_trace_annotate_begin(t, thread->depth, name, tile);
+    }
+    thread->depth++;
+}
+
+/******************************************************************************/
+// Sets the work of the task of the calling thread, ending next.
+void plasma_trace_flops(plasma_enum_t precision, double flops, double elements)
+{
+    int t = omp_get_thread_num();
+    if (t >= trace_num_threads)
+        return;
+
+    // A complex multiply-add is four real ones.
+    int is_complex = precision == PlasmaComplexFloat ||
+                     precision == PlasmaComplexDouble;
+    trace_threads[t].flops = is_complex ? 4.0*flops : flops;
+    trace_threads[t].bytes = elements*plasma_element_size(precision);
+}
+
+/******************************************************************************/
+// Records the last task started by the calling thread, which ends now.
+// Tasks started before the trace was switched on are not recorded.
+void plasma_trace_event(const char *name,
+                        int num_out, int num_tiles, const void **tiles)
+{
+    int t = omp_get_thread_num();
+    if (t >= trace_num_threads)
+        return;
+
+    trace_thread_t *thread = &trace_threads[t];
+    if (thread->depth <= 0)
+        return;
+    thread->depth--;
+    if (thread->depth >= PlasmaTraceMaxDepth) {
+        if (plasma_trace_on & PlasmaTraceMonitor)
+            plasma_monitor_end(t, 0.0, 0.0);
+        return;
+    }
+
+    if (plasma_trace_on & PlasmaTraceAnnotate)
+        plasma_trace_annotate_end(t, thread->depth);
+    double start = thread->start[thread->depth];
+    double stop = omp_get_wtime();
+    if (thread->depth > 0)
+        thread->nested[thread->depth-1] += stop-start;
+
+    if (plasma_trace_on & PlasmaTracePapi)
+        plasma_trace_papi_end(t, thread->depth, name,
+                              num_tiles > 0 ? tiles[0] : NULL, start);
+    if (plasma_trace_on & PlasmaTraceDryRun)
+        plasma_trace_dag_add(t, name, num_out, num_tiles, tiles,
+                             thread->flops, thread->bytes);
+    if (plasma_trace_on & PlasmaTraceStats)
+        plasma_stats_add(t, name, start, stop,
+                         stop-start-thread->nested[thread->depth],
+                         thread->flops, thread->bytes);
+    if (plasma_trace_on & PlasmaTraceMonitor)
+        plasma_monitor_end(t, stop-start-thread->nested[thread->depth],
+                           thread->flops);
+    thread->flops = 0.0;
+    thread->bytes = 0.0;
+    if (!(plasma_trace_on & PlasmaTraceEvents) || thread->events == NULL)
+        return;
+
+    plasma_trace_event_t *event =
+        &thread->events[thread->count & (PlasmaTraceMaxEvents-1)];
+    event->name = name;
+    event->num_tiles = imin(num_tiles, PlasmaTraceMaxTiles);
+    event->num_out = imin(num_out, event->num_tiles);
+    for (int i = 0; i < event->num_tiles; i++)
+        event->tiles[i] = tiles[i];
+    event->start = start;
+    event->stop = stop;
+    thread->count++;
+}
+
+/******************************************************************************/
+// Registers the storage of A, so that the events on its tiles are output
+// with the tile coordinates. Called on the creation of tile matrices.
+void plasma_trace_desc(plasma_desc_t A)
+{
+    if (!(plasma_trace_on & (PlasmaTraceEvents | PlasmaTracePapi |
+                             PlasmaTraceDryRun | PlasmaTraceAnnotate)) ||
+        A.matrix == NULL)
+        return;
+
+    trace_desc_t desc = {
+        .matrix = (const char*)A.matrix,
+        .eltsize = A.eltsize,
+        .mb = A.mb, .nb = A.nb, .gm = A.gm, .gn = A.gn,
+        .A21 = A.A21, .A12 = A.A12, .A22 = A.A22,
+        .morton = A.layout == PlasmaMortonLayout,
+        .triangle = A.layout == PlasmaTriangularLayout ?
+                    A.uplo : PlasmaGeneral,
+        .ldpad = A.ldpad,
+        .time = omp_get_wtime()
+    };
+    desc.size = plasma_desc_storage_size(A);
+
+    #pragma omp critical(plasma_trace)
+    {
+        trace_descs[trace_num_descs & (PlasmaTraceMaxDescs-1)] = desc;
+        trace_num_descs++;
+    }
+}
+
+/******************************************************************************/
+// Finds the coordinates of the tile holding the element at offset of a tile
+// matrix in Morton order, by descending the quadrants in the order of
+// plasma_desc_morton_fill.
+static void trace_morton_coords(const trace_desc_t *desc, size_t offset,
+                                int *m, int *n)
+{
+    int gmt = (desc->gm + desc->mb-1)/desc->mb;
+    int gnt = (desc->gn + desc->nb-1)/desc->nb;
+    int s = 1;
+    while (s < gmt || s < gnt)
+        s *= 2;
+
+    int m0 = 0;
+    int n0 = 0;
+    while (s > 1) {
+        s /= 2;
+        for (int q = 0; q < 4; q++) {
+            int mq = m0 + (q%2)*s;
+            int nq = n0 + (q/2)*s;
+            size_t rows = mq*desc->mb < desc->gm ?
+                          imin((mq+s)*desc->mb, desc->gm) - mq*desc->mb +
+                          (size_t)(imin(mq+s, gmt) - mq)*desc->ldpad : 0;
+            size_t cols = nq*desc->nb < desc->gn ?
+                          imin((nq+s)*desc->nb, desc->gn) - nq*desc->nb : 0;
+            if (offset < rows*cols) {
+                m0 = mq;
+                n0 = nq;
+                break;
+            }
+            offset -= rows*cols;
+        }
+    }
+    *m = m0;
+    *n = n0;
+}
+
+/******************************************************************************/
+// Finds the coordinates of the tile holding the element at offset of a tile
+// matrix in triangular order, by skipping the stored columns of tiles.
+static void trace_triangular_coords(const trace_desc_t *desc, size_t offset,
+                                    int *m, int *n)
+{
+    int gnt = (desc->gn + desc->nb-1)/desc->nb;
+    for (int nn = 0; nn < gnt; nn++) {
+        size_t cols = imin((nn+1)*desc->nb, desc->gn) - nn*desc->nb;
+        int m0 = desc->triangle == PlasmaLower ? nn : 0;
+        int tiles = desc->triangle == PlasmaLower ? gnt-nn : nn+1;
+        size_t rows = desc->triangle == PlasmaLower ?
+                      desc->gm - nn*desc->mb :
+                      imin((nn+1)*desc->mb, desc->gm);
+        rows += (size_t)tiles*desc->ldpad;
+        if (offset < rows*cols || nn == gnt-1) {
+            *m = m0 + offset/((size_t)(desc->mb+desc->ldpad)*cols);
+            *n = nn;
+            return;
+        }
+        offset -= rows*cols;
+    }
+}
+
+/******************************************************************************/
+// Finds the coordinates of the tile holding the element at offset of a tile
+// matrix of padded tiles, stored column by column of tiles.
+static void trace_padded_coords(const trace_desc_t *desc, size_t offset,
+                                int *m, int *n)
+{
+    int gmt = (desc->gm + desc->mb-1)/desc->mb;
+    int gnt = (desc->gn + desc->nb-1)/desc->nb;
+    size_t rows = desc->gm + (size_t)gmt*desc->ldpad;
+    for (int nn = 0; nn < gnt; nn++) {
+        size_t cols = imin((nn+1)*desc->nb, desc->gn) - nn*desc->nb;
+        if (offset < rows*cols || nn == gnt-1) {
+            *m = offset/((size_t)(desc->mb+desc->ldpad)*cols);
+            *n = nn;
+            return;
+        }
+        offset -= rows*cols;
+    }
+}
+
+/******************************************************************************/
+// Finds the coordinates of the tile at address tile, in the latest
+// tile matrix created before time, or returns -1 for other addresses.
+static trace_desc_t *trace_tile_coords(const void *tile, double time,
+                                       int *m, int *n)
+{
+    *m = -1;
+    *n = -1;
+    unsigned long first = trace_num_descs > PlasmaTraceMaxDescs ?
+                          trace_num_descs - PlasmaTraceMaxDescs : 0;
+    for (unsigned long d = trace_num_descs; d > first; d--) {
+        trace_desc_t *desc = &trace_descs[(d-1) & (PlasmaTraceMaxDescs-1)];
+        const char *ptr = (const char*)tile;
+        if (desc->time > time ||
+            ptr < desc->matrix || ptr >= desc->matrix + desc->size)
+            continue;
+
+        size_t offset = (ptr - desc->matrix)/desc->eltsize;
+        int lm1 = desc->gm/desc->mb;
+        int ln1 = desc->gn/desc->nb;
+        if (desc->morton) {
+            trace_morton_coords(desc, offset, m, n);
+        }
+        else if (desc->triangle != PlasmaGeneral) {
+            trace_triangular_coords(desc, offset, m, n);
+        }
+        else if (desc->ldpad > 0) {
+            trace_padded_coords(desc, offset, m, n);
+        }
+        else if (offset < desc->A21) {
+            size_t k = offset/((size_t)desc->mb*desc->nb);
+            *m = k%lm1;
+            *n = k/lm1;
+        }
+        else if (offset < desc->A12) {
+            *m = lm1;
+            *n = (offset-desc->A21)/((size_t)desc->nb*(desc->gm%desc->mb));
+        }
+        else if (offset < desc->A22) {
+            *m = (offset-desc->A12)/((size_t)desc->mb*(desc->gn%desc->nb));
+            *n = ln1;
+        }
+        else {
+            *m = lm1;
+            *n = ln1;
+        }
+        return desc;
+    }
+    return NULL;
+}
+
+/******************************************************************************/
+// Finds the coordinates and the dimensions of the tile at address tile,
+// as trace_tile_coords, or returns -1 and 0 for other addresses.
+void plasma_trace_tile(const void *tile, double time,
+                       int *m, int *n, int *mb, int *nb)
+{
+    trace_desc_t *desc = trace_tile_coords(tile, time, m, n);
+    if (desc == NULL) {
+        *mb = 0;
+        *nb = 0;
+        return;
+    }
+    *mb = *m < desc->gm/desc->mb ? desc->mb : desc->gm%desc->mb;
+    *nb = *n < desc->gn/desc->nb ? desc->nb : desc->gn%desc->nb;
+}
+
+/******************************************************************************/
+// Returns the range of the events kept in the ring of thread t.
+static void trace_range(int t, unsigned long *first, unsigned long *last)
+{
+    *last = trace_threads[t].count;
+    *first = *last > PlasmaTraceMaxEvents ? *last - PlasmaTraceMaxEvents : 0;
+}
+
+static plasma_trace_event_t *trace_get(int t, unsigned long e)
+{
+    return &trace_threads[t].events[e & (PlasmaTraceMaxEvents-1)];
+}
+
+/******************************************************************************/
+static double trace_min_time()
+{
+    double min_time = INFINITY;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        if (last > first && trace_get(t, first)->start < min_time)
+            min_time = trace_get(t, first)->start;
+    }
+    return min_time;
+}
+
+/***************************************************************************//**
+    Writes the kept events as comma-separated values: thread, kernel,
+    coordinates of the output tile (-1 outside of tile matrices),
+    start and end times in seconds from the first event.
+    Called after the traced computations.
+*/
+int plasma_trace_write_csv(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorFileIo;
+    }
+    double min_time = trace_min_time();
+    fprintf(file, "thread,kernel,m,n,start,stop\n");
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        for (unsigned long e = first; e < last; e++) {
+            plasma_trace_event_t *event = trace_get(t, e);
+            int m, n;
+            trace_tile_coords(event->tiles[0], event->start, &m, &n);
+            fprintf(file, "%d,%s,%d,%d,%.9lf,%.9lf\n",
+                    t, event->name, m, n,
+                    event->start-min_time, event->stop-min_time);
+        }
+    }
+    return fclose(file) == 0 ? PlasmaSuccess : PlasmaErrorFileIo;
+}
+
+/******************************************************************************/
+// X11 colors of the kernels, in the order of their first appearance.
+static const struct {
+    const char *name;
+    int value;
+} trace_colors[] = {
+    {"LightGoldenrodYellow", 0xFAFAD2}, {"DodgerBlue",   0x1E90FF},
+    {"Orange",               0xFFA500}, {"LimeGreen",    0x32CD32},
+    {"Crimson",              0xDC143C}, {"MediumPurple", 0x9370DB},
+    {"Teal",                 0x008080}, {"HotPink",      0xFF69B4},
+    {"Khaki",                0xF0E68C}, {"SteelBlue",    0x4682B4},
+    {"Sienna",               0xA0522D}, {"Aquamarine",   0x7FFFD4},
+    {"Gold",                 0xFFD700}, {"SlateGray",    0x708090},
+    {"Tomato",               0xFF6347}, {"Plum",         0xDDA0DD}
+};
+
+enum {
+    TraceNumColors = sizeof(trace_colors)/sizeof(trace_colors[0]),
+    TraceImageWidth = 2390,
+    TraceImageHeight = 1000
+};
+
+/***************************************************************************//**
+    Writes the kept events as an SVG image, one row per thread,
+    one rectangle per task, colored by kernel, with a legend.
+    Called after the traced computations.
+*/
+int plasma_trace_write_svg(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorFileIo;
+    }
+    double min_time = trace_min_time();
+    double max_time = min_time;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        for (unsigned long e = first; e < last; e++)
+            if (trace_get(t, e)->stop > max_time)
+                max_time = trace_get(t, e)->stop;
+    }
+    double hscale = max_time > min_time ?
+                    TraceImageWidth/(max_time-min_time) : 0.0;
+    double vscale = TraceImageHeight/(double)imax(1, trace_num_threads);
+
+    const char *names[TraceNumColors];
+    int num_names = 0;
+
+    fprintf(file, "<svg viewBox=\"0 0 %d %d\">\n",
+            TraceImageWidth, TraceImageHeight+200);
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        for (unsigned long e = first; e < last; e++) {
+            plasma_trace_event_t *event = trace_get(t, e);
+            int c;
+            for (c = 0; c < num_names; c++)
+                if (strcmp(names[c], event->name) == 0)
+                    break;
+            if (c == num_names && num_names < TraceNumColors)
+                names[num_names++] = event->name;
+            int m, n;
+            trace_tile_coords(event->tiles[0], event->start, &m, &n);
+            fprintf(file,
+                    "<rect x=\"%lf\" y=\"%lf\" width=\"%lf\" height=\"%lf\" "
+                    "fill=\"#%06x\" stroke=\"#000000\" stroke-width=\"1\">"
+                    "<title>%s (%d, %d)</title></rect>\n",
+                    (event->start-min_time)*hscale,
+                    t*vscale,
+                    (event->stop-event->start)*hscale,
+                    0.9*vscale,
+                    trace_colors[c%TraceNumColors].value,
+                    event->name, m, n);
+        }
+    }
+    int x = 0;
+    int y = TraceImageHeight+50;
+    for (int c = 0; c < num_names; c++) {
+        fprintf(file,
+                "<rect x=\"%d\" y=\"%d\" width=\"50\" height=\"50\" "
+                "fill=\"#%06x\" stroke=\"#000000\" stroke-width=\"1\"/>\n"
+                "<text x=\"%d\" y=\"%d\" "
+                "font-family=\"monospace\" font-size=\"35\" fill=\"black\">"
+                "%s</text>\n",
+                x, y, trace_colors[c].value, x+75, y+36, names[c]);
+        x += 150 + 22*strlen(names[c]);
+        if (x > TraceImageWidth) {
+            x = 0;
+            y += 100;
+        }
+    }
+    fprintf(file, "</svg>\n");
+    return fclose(file) == 0 ? PlasmaSuccess : PlasmaErrorFileIo;
+}
+
+/******************************************************************************/
+// An event and its thread, for the events of all threads in start order.
+typedef struct {
+    plasma_trace_event_t *event;
+    int thread;
+} trace_ref_t;
+
+static int trace_ref_compare(const void *a, const void *b)
+{
+    double sa = ((const trace_ref_t*)a)->event->start;
+    double sb = ((const trace_ref_t*)b)->event->start;
+    return (sa > sb) - (sa < sb);
+}
+
+// Open addressing table from the tile address to its last writer.
+static size_t trace_hash(const void *tile, size_t mask)
+{
+    return ((uintptr_t)tile >> 4)*0x9E3779B97F4A7C15ull & mask;
+}
+
+static size_t *trace_writer(const void **keys, size_t *values, size_t mask,
+                            const void *tile, int insert)
+{
+    for (size_t h = trace_hash(tile, mask);; h = (h+1) & mask) {
+        if (keys[h] == tile)
+            return &values[h];
+        if (keys[h] == NULL) {
+            if (!insert)
+                return NULL;
+            keys[h] = tile;
+            return &values[h];
+        }
+    }
+}
+
+// gaps of a thread shorter than this are not annotated, in seconds
+static const double trace_min_idle = 1e-6;
+
+/***************************************************************************//**
+    Writes the kept events in the Chrome trace event format (JSON), read by
+    Perfetto and chrome://tracing: one slice per task with the coordinates of
+    its output tile, flow arrows from the last task writing a tile to the
+    tasks depending on it (from the depend clauses of the tasks), and idle
+    slices on the threads, naming the dependency the next task waited for
+    when it ended during the gap. Called after the traced computations.
+*/
+int plasma_trace_write_json(const char *path)
+{
+    // Gather the events of all threads in start order.
+    size_t num_events = 0;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        num_events += last-first;
+    }
+    size_t size = 1;
+    while (size < 2*PlasmaTraceMaxTiles*num_events)
+        size *= 2;
+
+    trace_ref_t *refs = (trace_ref_t*)malloc((num_events+1)*sizeof(trace_ref_t));
+    const void **keys = (const void**)calloc(size, sizeof(void*));
+    size_t *values = (size_t*)malloc(size*sizeof(size_t));
+    double *thread_stop = (double*)malloc(
+        (trace_num_threads+1)*sizeof(double));
+    if (refs == NULL || keys == NULL || values == NULL || thread_stop == NULL) {
+        free(refs);
+        free(keys);
+        free(values);
+        free(thread_stop);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    size_t k = 0;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        for (unsigned long e = first; e < last; e++) {
+            refs[k].event = trace_get(t, e);
+            refs[k].thread = t;
+            k++;
+        }
+        thread_stop[t] = -INFINITY;
+    }
+    qsort(refs, num_events, sizeof(trace_ref_t), trace_ref_compare);
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        free(refs);
+        free(keys);
+        free(values);
+        free(thread_stop);
+        plasma_error("fopen() failed");
+        return PlasmaErrorFileIo;
+    }
+    // times in microseconds from the first event
+    double min_time = trace_min_time();
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (int t = 0; t < trace_num_threads; t++)
+        fprintf(file,
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}},\n", t, t);
+
+    size_t flow = 0;
+    for (size_t i = 0; i < num_events; i++) {
+        plasma_trace_event_t *event = refs[i].event;
+        int t = refs[i].thread;
+        double start = (event->start-min_time)*1e6;
+        double stop = (event->stop-min_time)*1e6;
+        int m, n;
+        trace_tile_coords(event->tiles[0], event->start, &m, &n);
+        fprintf(file,
+                "{\"name\":\"%s\",\"cat\":\"task\",\"ph\":\"X\","
+                "\"ts\":%.3lf,\"dur\":%.3lf,\"pid\":0,\"tid\":%d,"
+                "\"args\":{\"m\":%d,\"n\":%d}},\n",
+                event->name, start, stop-start, t, m, n);
+
+        // Draw the dependencies, remembering the last one to end.
+        size_t waited = num_events;
+        size_t producers[PlasmaTraceMaxTiles];
+        int num_producers = 0;
+        for (int d = 0; d < event->num_tiles; d++) {
+            if (event->tiles[d] == NULL)
+                continue;
+            size_t *w = trace_writer(keys, values, size-1,
+                                     event->tiles[d], 0);
+            if (w == NULL || refs[*w].event->stop > event->start)
+                continue;
+            int seen = 0;
+            for (int p = 0; p < num_producers; p++)
+                seen |= producers[p] == *w;
+            if (seen)
+                continue;
+            producers[num_producers++] = *w;
+
+            plasma_trace_event_t *producer = refs[*w].event;
+            fprintf(file,
+                    "{\"name\":\"depend\",\"cat\":\"depend\",\"ph\":\"s\","
+                    "\"id\":%zu,\"ts\":%.3lf,\"pid\":0,\"tid\":%d},\n"
+                    "{\"name\":\"depend\",\"cat\":\"depend\",\"ph\":\"f\","
+                    "\"bp\":\"e\",\"id\":%zu,\"ts\":%.3lf,\"pid\":0,"
+                    "\"tid\":%d},\n",
+                    flow, (producer->start-min_time)*1e6, refs[*w].thread,
+                    flow, start, t);
+            flow++;
+            if (waited == num_events ||
+                producer->stop > refs[waited].event->stop)
+                waited = *w;
+        }
+        // Annotate the idle time of the thread before the task.
+        if (event->start-thread_stop[t] >= trace_min_idle &&
+            thread_stop[t] > -INFINITY) {
+            double idle = (thread_stop[t]-min_time)*1e6;
+            fprintf(file,
+                    "{\"name\":\"idle\",\"cat\":\"idle\",\"ph\":\"X\","
+                    "\"ts\":%.3lf,\"dur\":%.3lf,\"pid\":0,\"tid\":%d,"
+                    "\"args\":{\"next\":\"%s\"",
+                    idle, start-idle, t, event->name);
+            if (waited < num_events &&
+                refs[waited].event->stop > thread_stop[t]) {
+                plasma_trace_event_t *producer = refs[waited].event;
+                int pm, pn;
+                trace_tile_coords(producer->tiles[0], producer->start,
+                                  &pm, &pn);
+                fprintf(file,
+                        ",\"waiting_for\":\"%s\",\"wm\":%d,\"wn\":%d",
+                        producer->name, pm, pn);
+            }
+            fprintf(file, "}},\n");
+        }
+        // Tasks nested in a task end before it.
+        if (event->stop > thread_stop[t])
+            thread_stop[t] = event->stop;
+
+        // The task is the last writer of its outputs.
+        for (int d = 0; d < event->num_out; d++)
+            if (event->tiles[d] != NULL)
+                *trace_writer(keys, values, size-1, event->tiles[d], 1) = i;
+    }
+    fprintf(file, "{\"name\":\"end\",\"ph\":\"i\",\"ts\":0,\"pid\":0,"
+                  "\"tid\":0,\"s\":\"g\"}\n]}\n");
+
+    free(refs);
+    free(keys);
+    free(values);
+    free(thread_stop);
+    return fclose(file) == 0 ? PlasmaSuccess : PlasmaErrorFileIo;
+}
+
+/******************************************************************************/
+static int trace_time_compare(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Computes the overhead of the scheduling of the kept events, e.g., of one
+    call between plasma_set(PlasmaTrace, PlasmaTraceOn) and this function:
+    the number of tasks and their mean duration, the time the master thread
+    spends outside tasks, mostly submitting them, and the histogram of the
+    latencies from the end of the last task each task depends on to its
+    start. Small tasks with long latencies or a busy master call for larger
+    tiles, or fewer tasks.
+
+    The dependencies are those between the depend clauses of the tasks kept,
+    of at most PlasmaTraceMaxTiles tiles each: the last writer of a tile
+    before a reader or a writer, and its readers before the next writer.
+    The tasks without a dependency kept, e.g., the first ones, are not in
+    the histogram.
+
+    @param[out] sched
+        The overhead of the scheduling, zero without events.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_trace_sched(plasma_trace_sched_t *sched)
+{
+    if (sched == NULL) {
+        plasma_error("NULL sched");
+        return PlasmaErrorNullParameter;
+    }
+    memset(sched, 0, sizeof(plasma_trace_sched_t));
+
+    // Gather the events of all threads in start order.
+    size_t num_events = 0;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        num_events += last-first;
+    }
+    if (num_events == 0)
+        return PlasmaSuccess;
+
+    size_t size = 1;
+    while (size < 2*PlasmaTraceMaxTiles*num_events)
+        size *= 2;
+
+    trace_ref_t *refs = (trace_ref_t*)malloc(num_events*sizeof(trace_ref_t));
+    const void **keys = (const void**)calloc(size, sizeof(void*));
+    size_t *writers = (size_t*)malloc(size*sizeof(size_t));
+    double *reads = (double*)malloc(size*sizeof(double));
+    double *latency = (double*)malloc(num_events*sizeof(double));
+    if (refs == NULL || keys == NULL || writers == NULL || reads == NULL ||
+        latency == NULL) {
+        free(refs);
+        free(keys);
+        free(writers);
+        free(reads);
+        free(latency);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    size_t k = 0;
+    for (int t = 0; t < trace_num_threads; t++) {
+        unsigned long first, last;
+        trace_range(t, &first, &last);
+        for (unsigned long e = first; e < last; e++) {
+            refs[k].event = trace_get(t, e);
+            refs[k].thread = t;
+            k++;
+        }
+    }
+    qsort(refs, num_events, sizeof(trace_ref_t), trace_ref_compare);
+
+    // no writer and no reader of the tiles yet
+    for (size_t h = 0; h < size; h++) {
+        writers[h] = num_events;
+        reads[h] = -INFINITY;
+    }
+    double first = refs[0].event->start;
+    double last = first;
+    double busy = 0.0;
+    double master_stop = -INFINITY;  // end of the last task of the master
+    double master_busy = 0.0;        // union of the tasks of the master
+    size_t num_ready = 0;
+    for (size_t i = 0; i < num_events; i++) {
+        plasma_trace_event_t *event = refs[i].event;
+        last = fmax(last, event->stop);
+        busy += event->stop-event->start;
+
+        // The tasks nested in a task of the master are covered by it.
+        if (refs[i].thread == 0) {
+            if (event->start > master_stop) {
+                master_busy += event->stop-event->start;
+                master_stop = event->stop;
+            }
+            else if (event->stop > master_stop) {
+                master_busy += event->stop-master_stop;
+                master_stop = event->stop;
+            }
+        }
+
+        // The task is ready when its last dependency ended before it.
+        double ready = -INFINITY;
+        for (int d = 0; d < event->num_tiles; d++) {
+            if (event->tiles[d] == NULL)
+                continue;
+            size_t h = trace_writer(keys, writers, size-1,
+                                    event->tiles[d], 1) - writers;
+            if (writers[h] < num_events &&
+                refs[writers[h]].event->stop <= event->start)
+                ready = fmax(ready, refs[writers[h]].event->stop);
+            if (d < event->num_out && reads[h] <= event->start)
+                ready = fmax(ready, reads[h]);
+        }
+        if (ready > -INFINITY)
+            latency[num_ready++] = event->start-ready;
+
+        for (int d = 0; d < event->num_tiles; d++) {
+            if (event->tiles[d] == NULL)
+                continue;
+            size_t h = trace_writer(keys, writers, size-1,
+                                    event->tiles[d], 1) - writers;
+            if (d < event->num_out) {
+                writers[h] = i;
+                reads[h] = -INFINITY;
+            }
+            else {
+                reads[h] = fmax(reads[h], event->stop);
+            }
+        }
+    }
+
+    sched->tasks = num_events;
+    sched->task_time = busy/num_events;
+    sched->elapsed = last-first;
+    sched->master = master_stop > -INFINITY ?
+                    fmax(0.0, master_stop-first-master_busy) : last-first;
+    sched->ready = num_ready;
+    if (num_ready > 0) {
+        qsort(latency, num_ready, sizeof(double), trace_time_compare);
+        sched->latency_p50 = latency[(size_t)(0.50*(num_ready-1))];
+        sched->latency_p90 = latency[(size_t)(0.90*(num_ready-1))];
+        sched->latency_p99 = latency[(size_t)(0.99*(num_ready-1))];
+    }
+    for (size_t i = 0; i < num_ready; i++) {
+        double us = latency[i]*1e6;
+        int b = us < 1.0 ? 0 : 1 + (int)floor(log2(us));
+        sched->histogram[imin(b, PlasmaSchedBuckets-1)]++;
+    }
+
+    free(refs);
+    free(keys);
+    free(writers);
+    free(reads);
+    free(latency);
+    return PlasmaSuccess;
+}
@@ -0,0 +1,234 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <omp.h>
+
+#if defined(PLASMA_WITH_ITT)
+#include <ittnotify.h>
+#endif
+#if defined(PLASMA_WITH_NVTX)
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+#if (defined(PLASMA_WITH_ITT) || defined(PLASMA_WITH_NVTX)) && \
+    defined(PLASMA_WITH_TRACE)
+#define ANNOTATE
+
+enum {
+    AnnotateNumKinds   = PlasmaStatsOther+1,
+    AnnotateMaxKernels = 256  // per thread, a power of two
+};
+
+// Domains of the kinds of kernels, in the order of the PlasmaStats kinds.
+static const char *annotate_domain_names[AnnotateNumKinds] = {
+    "plasma.panel", "plasma.update", "plasma.translation", "plasma.other"
+};
+
+#if defined(PLASMA_WITH_NVTX)
+// ARGB colors of the kinds in Nsight Systems.
+static const uint32_t annotate_colors[AnnotateNumKinds] = {
+    0xFFDC143C, 0xFF1E90FF, 0xFF32CD32, 0xFFA0A0A0
+};
+#endif
+
+// Kernel name and its kind, looked up once per thread. The names are
+// the string literals of the wrappers, compared by address.
+typedef struct {
+    const char *name;
+    int kind;
+#if defined(PLASMA_WITH_ITT)
+    __itt_string_handle *handle;
+#endif
+} annotate_kernel_t;
+
+// State of one thread, written by that thread only, with the kinds of
+// its running tasks, padded to keep two threads off a cache line.
+typedef struct {
+    int kind[PlasmaTraceMaxDepth];
+    annotate_kernel_t kernels[AnnotateMaxKernels];
+    char pad[64];
+} annotate_thread_t;
+
+static annotate_thread_t *annotate_threads = NULL;
+static int annotate_num_threads = 0;
+
+#if defined(PLASMA_WITH_ITT)
+static __itt_domain *annotate_itt_domains[AnnotateNumKinds];
+static __itt_string_handle *annotate_itt_tile = NULL;
+#endif
+#if defined(PLASMA_WITH_NVTX)
+static nvtxDomainHandle_t annotate_nvtx_domains[AnnotateNumKinds];
+#endif
+
+/******************************************************************************/
+// Finds the kernel name in the table of the thread, adding it on its first
+// task there. Returns NULL if the table is full.
+static annotate_kernel_t *annotate_kernel(annotate_thread_t *thread,
+                                          const char *name)
+{
+    uintptr_t h = ((uintptr_t)name >> 3)*0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < AnnotateMaxKernels; i++, h++) {
+        annotate_kernel_t *kernel =
+            &thread->kernels[h & (AnnotateMaxKernels-1)];
+        if (kernel->name == name)
+            return kernel;
+        if (kernel->name == NULL) {
+            kernel->name = name;
+            kernel->kind = plasma_stats_kind(name);
+#if defined(PLASMA_WITH_ITT)
+            kernel->handle = __itt_string_handle_create(name);
+#endif
+            return kernel;
+        }
+    }
+    return NULL;
+}
+#endif // ANNOTATE
+
+/******************************************************************************/
+// Creates the domains and switches the annotations on, if built in.
+// Called by plasma_init().
+int plasma_trace_annotate_init()
+{
+#if defined(ANNOTATE)
+    if (annotate_threads != NULL)
+        return PlasmaSuccess;
+
+    int num_threads = omp_get_max_threads();
+    annotate_threads = (annotate_thread_t*)
+        calloc(num_threads, sizeof(annotate_thread_t));
+    if (annotate_threads == NULL) {
+        plasma_error("calloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    annotate_num_threads = num_threads;
+
+    for (int k = 0; k < AnnotateNumKinds; k++) {
+        const char *domain = annotate_domain_names[k];
+#if defined(PLASMA_WITH_ITT)
+        annotate_itt_domains[k] = __itt_domain_create(domain);
+#endif
+#if defined(PLASMA_WITH_NVTX)
+        annotate_nvtx_domains[k] = nvtxDomainCreateA(domain);
+#endif
+    }
+#if defined(PLASMA_WITH_ITT)
+    annotate_itt_tile = __itt_string_handle_create("tile");
+#endif
+
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(0);
+    if (retval != PlasmaSuccess) {
+        plasma_trace_annotate_finalize();
+        return retval;
+    }
+    plasma_trace_on = on | PlasmaTraceAnnotate;
+#endif
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Switches the annotations off. Called by plasma_finalize().
+void plasma_trace_annotate_finalize()
+{
+#if defined(ANNOTATE)
+    if (annotate_threads == NULL)
+        return;
+
+    // The ITT domains live as long as the process.
+    plasma_trace_on &= ~PlasmaTraceAnnotate;
+#if defined(PLASMA_WITH_NVTX)
+    for (int k = 0; k < AnnotateNumKinds; k++)
+        nvtxDomainDestroy(annotate_nvtx_domains[k]);
+#endif
+    free(annotate_threads);
+    annotate_threads = NULL;
+    annotate_num_threads = 0;
+#endif
+}
+
+/******************************************************************************/
+// Opens the range of the task at depth of thread, of kernel name and
+// output tile, in the domain of the kind of the kernel.
+void plasma_trace_annotate_begin(int thread, int depth,
+                                 const char *name, const void *tile)
+{
+#if defined(ANNOTATE)
+    if (thread >= annotate_num_threads)
+        return;
+
+    annotate_thread_t *a = &annotate_threads[thread];
+    annotate_kernel_t *kernel = annotate_kernel(a, name);
+    a->kind[depth] = kernel != NULL ? kernel->kind : PlasmaStatsOther;
+
+    int m = -1, n = -1, mb, nb;
+    if (tile != NULL)
+        plasma_trace_tile(tile, omp_get_wtime(), &m, &n, &mb, &nb);
+
+#if defined(PLASMA_WITH_ITT)
+    // The calls do nothing without a collector attached.
+    __itt_domain *domain = annotate_itt_domains[a->kind[depth]];
+    if (domain != NULL) {
+        __itt_task_begin(domain, __itt_null, __itt_null,
+                         kernel != NULL ? kernel->handle
+                                        : __itt_string_handle_create(name));
+        if (m >= 0) {
+            int coords[2] = {m, n};
+            __itt_metadata_add(domain, __itt_null, annotate_itt_tile,
+                               __itt_metadata_s32, 2, coords);
+        }
+    }
+#endif
+#if defined(PLASMA_WITH_NVTX)
+    char message[64];
+    if (m >= 0)
+        snprintf(message, sizeof(message), "%s (%d, %d)", name, m, n);
+    else
+        snprintf(message, sizeof(message), "%s", name);
+
+    nvtxEventAttributes_t attributes = {0};
+    attributes.version = NVTX_VERSION;
+    attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+    attributes.colorType = NVTX_COLOR_ARGB;
+    attributes.color = annotate_colors[a->kind[depth]];
+    attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+    attributes.message.ascii = message;
+    nvtxDomainRangePushEx(annotate_nvtx_domains[a->kind[depth]],
+                          &attributes);
+#endif
+#endif
+}
+
+/******************************************************************************/
+// Closes the range of the task ending at depth of thread.
+void plasma_trace_annotate_end(int thread, int depth)
+{
+#if defined(ANNOTATE)
+    if (thread >= annotate_num_threads)
+        return;
+
+    int kind = annotate_threads[thread].kind[depth];
+#if defined(PLASMA_WITH_ITT)
+    __itt_domain *domain = annotate_itt_domains[kind];
+    if (domain != NULL)
+        __itt_task_end(domain);
+#endif
+#if defined(PLASMA_WITH_NVTX)
+    nvtxDomainRangePop(annotate_nvtx_domains[kind]);
+#endif
+#endif
+}
@@ -0,0 +1,370 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Task of a dry run. A task ends after the tasks it depends on,
+// so the order of the ends is an order of the graph.
+typedef struct {
+    const char *name;
+    unsigned long order;  // rank of its end among all tasks
+    double time;          // end time, for the coordinates of the tiles
+    int num_tiles;
+    int num_out;
+    const void *tiles[PlasmaTraceMaxTiles];
+    double flops;
+    double bytes;
+} dag_node_t;
+
+// Tasks of one thread, padded to keep two threads off a cache line.
+typedef struct {
+    dag_node_t *nodes;
+    size_t num_nodes;
+    size_t size;
+    char pad[64];
+} dag_thread_t;
+
+static dag_thread_t *dag_threads = NULL;
+static int dag_num_threads = 0;
+static unsigned long dag_order = 0;
+static int dag_lost = 0;  // tasks dropped for lack of memory
+
+/******************************************************************************/
+// Starts a dry run, forgetting the tasks of the previous one.
+int plasma_trace_dag_enable()
+{
+    int num_threads = omp_get_max_threads();
+    if (dag_num_threads < num_threads) {
+        plasma_trace_dag_finalize();
+        dag_threads = (dag_thread_t*)calloc(num_threads, sizeof(dag_thread_t));
+        if (dag_threads == NULL) {
+            plasma_error("calloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        dag_num_threads = num_threads;
+    }
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(0);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    for (int t = 0; t < dag_num_threads; t++)
+        dag_threads[t].num_nodes = 0;
+    dag_order = 0;
+    dag_lost = 0;
+    plasma_trace_on = on | PlasmaTraceDryRun;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Ends the dry run, keeping its tasks for plasma_trace_write_dag().
+void plasma_trace_dag_disable()
+{
+    plasma_trace_on &= ~PlasmaTraceDryRun;
+}
+
+/******************************************************************************/
+void plasma_trace_dag_finalize()
+{
+    plasma_trace_on &= ~PlasmaTraceDryRun;
+    for (int t = 0; t < dag_num_threads; t++)
+        free(dag_threads[t].nodes);
+    free(dag_threads);
+    dag_threads = NULL;
+    dag_num_threads = 0;
+}
+
+/******************************************************************************/
+// Records a task of thread, ending now. Called by the hooks.
+void plasma_trace_dag_add(int thread, const char *name,
+                          int num_out, int num_tiles, const void **tiles,
+                          double flops, double bytes)
+{
+    if (thread >= dag_num_threads)
+        return;
+
+    unsigned long order;
+    #pragma omp atomic capture
+    order = dag_order++;
+
+    dag_thread_t *t = &dag_threads[thread];
+    if (t->num_nodes == t->size) {
+        size_t size = t->size > 0 ? 2*t->size : 4096;
+        dag_node_t *nodes = (dag_node_t*)
+            realloc(t->nodes, size*sizeof(dag_node_t));
+        if (nodes == NULL) {
+            dag_lost = 1;
+            return;
+        }
+        t->nodes = nodes;
+        t->size = size;
+    }
+    dag_node_t *node = &t->nodes[t->num_nodes++];
+    node->name = name;
+    node->order = order;
+    node->time = omp_get_wtime();
+    node->num_tiles = imin(num_tiles, PlasmaTraceMaxTiles);
+    node->num_out = imin(num_out, node->num_tiles);
+    for (int i = 0; i < node->num_tiles; i++)
+        node->tiles[i] = tiles[i];
+    node->flops = flops;
+    node->bytes = bytes;
+}
+
+/******************************************************************************/
+// Last writer of a tile and the readers since, in an open addressing table.
+typedef struct {
+    const void *tile;
+    long writer;
+    long *readers;
+    size_t num_readers;
+    size_t size;
+} dag_tile_t;
+
+static dag_tile_t *dag_tile(dag_tile_t *tiles, size_t mask, const void *tile)
+{
+    for (size_t h = ((uintptr_t)tile >> 4)*0x9E3779B97F4A7C15ull & mask;;
+         h = (h+1) & mask) {
+        if (tiles[h].tile == tile)
+            return &tiles[h];
+        if (tiles[h].tile == NULL) {
+            tiles[h].tile = tile;
+            tiles[h].writer = -1;
+            return &tiles[h];
+        }
+    }
+}
+
+static int dag_compare(const void *a, const void *b)
+{
+    unsigned long oa = (*(dag_node_t* const*)a)->order;
+    unsigned long ob = (*(dag_node_t* const*)b)->order;
+    return (oa > ob) - (oa < ob);
+}
+
+static int dag_compare_long(const void *a, const void *b)
+{
+    long la = *(const long*)a;
+    long lb = *(const long*)b;
+    return (la > lb) - (la < lb);
+}
+
+// Appends value to the array *list of *num entries and *size capacity,
+// returns 1 if out of memory.
+static int dag_push(long **list, size_t *num, size_t *size, long value)
+{
+    if (*num == *size) {
+        size_t new_size = *size > 0 ? 2*(*size) : 8;
+        long *new_list = (long*)realloc(*list, new_size*sizeof(long));
+        if (new_list == NULL)
+            return 1;
+        *list = new_list;
+        *size = new_size;
+    }
+    (*list)[(*num)++] = value;
+    return 0;
+}
+
+/******************************************************************************/
+// Visits a task of the last dry run, numbered i in an order of the graph,
+// with the tasks it depends on. Returns an error to stop the walk.
+typedef int (*dag_visit_t)(void *arg, size_t i, const dag_node_t *node,
+                           const long *deps, size_t num_deps);
+
+// Visits the tasks of the last dry run in an order of the graph, with their
+// dependencies from the depend clauses: the last writer of each of their
+// tiles, and the readers since of each of their outputs.
+static int dag_walk(dag_visit_t visit, void *arg)
+{
+    size_t num_nodes = 0;
+    for (int t = 0; t < dag_num_threads; t++)
+        num_nodes += dag_threads[t].num_nodes;
+    size_t size = 1;
+    while (size < 2*PlasmaTraceMaxTiles*num_nodes)
+        size *= 2;
+
+    dag_node_t **nodes = (dag_node_t**)malloc(
+        (num_nodes+1)*sizeof(dag_node_t*));
+    dag_tile_t *tiles = (dag_tile_t*)calloc(size, sizeof(dag_tile_t));
+    if (nodes == NULL || tiles == NULL) {
+        free(nodes);
+        free(tiles);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    size_t k = 0;
+    for (int t = 0; t < dag_num_threads; t++)
+        for (size_t i = 0; i < dag_threads[t].num_nodes; i++)
+            nodes[k++] = &dag_threads[t].nodes[i];
+    qsort(nodes, num_nodes, sizeof(dag_node_t*), dag_compare);
+
+    if (dag_lost)
+        plasma_warning("tasks of the dry run lost, out of memory");
+
+    int failed = 0;
+    int retval = PlasmaSuccess;
+    long *deps = NULL;
+    size_t num_deps, deps_size = 0;
+    for (size_t i = 0; i < num_nodes && !failed && retval == PlasmaSuccess;
+         i++) {
+        dag_node_t *node = nodes[i];
+        num_deps = 0;
+        for (int d = 0; d < node->num_tiles; d++) {
+            if (node->tiles[d] == NULL)
+                continue;
+            dag_tile_t *tile = dag_tile(tiles, size-1, node->tiles[d]);
+            if (tile->writer >= 0)
+                failed |= dag_push(&deps, &num_deps, &deps_size, tile->writer);
+            if (d < node->num_out)
+                for (size_t r = 0; r < tile->num_readers; r++)
+                    failed |= dag_push(&deps, &num_deps, &deps_size,
+                                       tile->readers[r]);
+        }
+        // The task writes its outputs and reads its inputs.
+        for (int d = 0; d < node->num_tiles; d++) {
+            if (node->tiles[d] == NULL)
+                continue;
+            dag_tile_t *tile = dag_tile(tiles, size-1, node->tiles[d]);
+            if (d < node->num_out) {
+                tile->writer = i;
+                tile->num_readers = 0;
+            }
+            else {
+                failed |= dag_push(&tile->readers, &tile->num_readers,
+                                   &tile->size, i);
+            }
+        }
+        qsort(deps, num_deps, sizeof(long), dag_compare_long);
+        size_t num_unique = 0;
+        for (size_t d = 0; d < num_deps; d++)
+            if (deps[d] != (long)i &&
+                (num_unique == 0 || deps[d] != deps[num_unique-1]))
+                deps[num_unique++] = deps[d];
+
+        if (!failed)
+            retval = visit(arg, i, node, deps, num_unique);
+    }
+    free(deps);
+    for (size_t h = 0; h < size; h++)
+        free(tiles[h].readers);
+    free(tiles);
+    free(nodes);
+
+    if (failed) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    return retval;
+}
+
+/******************************************************************************/
+static int dag_write_node(void *arg, size_t i, const dag_node_t *node,
+                          const long *deps, size_t num_deps)
+{
+    FILE *file = (FILE*)arg;
+    int m, n, mb, nb;
+    plasma_trace_tile(node->tiles[0], node->time, &m, &n, &mb, &nb);
+    fprintf(file, "%zu %s %d %d %.6g %.6g %zu",
+            i, node->name, m, n, node->flops, node->bytes, num_deps);
+    for (size_t d = 0; d < num_deps; d++)
+        fprintf(file, " %ld", deps[d]);
+    return fprintf(file, "\n") < 0 ? PlasmaErrorFileIo : PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Writes the task graph of the last dry run as text, one line per task in
+    an order of the graph, numbered from 0:
+
+        id kernel m n flops bytes num_deps dep ...
+
+    with the coordinates of the output tile (-1 outside of tile matrices),
+    the modeled work of the kernels reporting it (0 otherwise), and the tasks
+    it depends on, from the depend clauses: the last writer of each of its
+    tiles, and the readers since of each of its outputs.
+    Analyzed by tools/dag.c. Called after the calls of the dry run.
+*/
+int plasma_trace_write_dag(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorFileIo;
+    }
+    fprintf(file, "# id kernel m n flops bytes num_deps dep ...\n");
+
+    int retval = dag_walk(dag_write_node, file);
+    if (fclose(file) != 0 && retval == PlasmaSuccess)
+        retval = PlasmaErrorFileIo;
+    return retval;
+}
+
+/******************************************************************************/
+// Costs of the tasks and earliest finish times with unbounded threads.
+typedef struct {
+    plasma_trace_cost_t cost;
+    void *cost_arg;
+    double *finish;
+    double work;
+    double span;
+} dag_eval_t;
+
+static int dag_eval_node(void *arg, size_t i, const dag_node_t *node,
+                         const long *deps, size_t num_deps)
+{
+    dag_eval_t *eval = (dag_eval_t*)arg;
+    double start = 0.0;
+    for (size_t d = 0; d < num_deps; d++)
+        if (eval->finish[deps[d]] > start)
+            start = eval->finish[deps[d]];
+
+    double cost = eval->cost(eval->cost_arg, node->name,
+                             node->flops, node->bytes);
+    eval->finish[i] = start+cost;
+    eval->work += cost;
+    if (eval->finish[i] > eval->span)
+        eval->span = eval->finish[i];
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Evaluates the task graph of the last dry run, with the cost in seconds of
+    each task given by cost from its kernel and its modeled work: the work,
+    the sum of the costs, and the span, the cost of the critical path.
+    Called after the calls of the dry run.
+*/
+int plasma_trace_dag_eval(plasma_trace_cost_t cost, void *cost_arg,
+                          double *work, double *span)
+{
+    size_t num_nodes = 0;
+    for (int t = 0; t < dag_num_threads; t++)
+        num_nodes += dag_threads[t].num_nodes;
+
+    dag_eval_t eval = {.cost = cost, .cost_arg = cost_arg};
+    eval.finish = (double*)malloc((num_nodes+1)*sizeof(double));
+    if (eval.finish == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    int retval = dag_walk(dag_eval_node, &eval);
+    free(eval.finish);
+
+    *work = eval.work;
+    *span = eval.span;
+    return retval;
+}
@@ -0,0 +1,291 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#if defined(PLASMA_WITH_PAPI)
+#include <papi.h>
+#include <pthread.h>
+
+/******************************************************************************/
+// Counters of a kernel on tiles of one size.
+typedef struct {
+    const char *name;
+    int mb, nb;
+    long calls;
+    long long values[PlasmaPapiMaxEvents];
+} papi_kernel_t;
+
+// Event set of one thread, created by that thread on its first task,
+// with the values read at the start of its running tasks.
+typedef struct {
+    int eventset;
+    int state;     // 0 until created, 1 if started, -1 if it failed
+    long long start[PlasmaTraceMaxDepth][PlasmaPapiMaxEvents];
+    long long nested[PlasmaTraceMaxDepth][PlasmaPapiMaxEvents];
+    papi_kernel_t kernels[PlasmaPapiMaxKernels];
+    char pad[64];
+} papi_thread_t;
+
+static char papi_names[PlasmaPapiMaxEvents][PAPI_MAX_STR_LEN];
+static int papi_num_events = 0;
+
+static papi_thread_t *papi_threads = NULL;
+static int papi_num_threads = 0;
+
+static unsigned long papi_thread_id(void)
+{
+    return (unsigned long)pthread_self();
+}
+
+/******************************************************************************/
+// Creates and starts the event set of the calling thread.
+static int papi_thread_start(papi_thread_t *thread)
+{
+    thread->eventset = PAPI_NULL;
+    thread->state = -1;
+    if (PAPI_create_eventset(&thread->eventset) != PAPI_OK)
+        return -1;
+    for (int e = 0; e < papi_num_events; e++)
+        if (PAPI_add_named_event(thread->eventset, papi_names[e]) != PAPI_OK)
+            return -1;
+    if (PAPI_start(thread->eventset) != PAPI_OK)
+        return -1;
+    thread->state = 1;
+    return 0;
+}
+#endif // PLASMA_WITH_PAPI
+
+/******************************************************************************/
+// Switches on the counters listed, separated by commas, in the environment
+// variable PLASMA_PAPI_EVENTS. Does nothing if it is not set.
+// Called by plasma_init().
+int plasma_trace_papi_init()
+{
+    const char *env = getenv("PLASMA_PAPI_EVENTS");
+    if (env == NULL || *env == '\0')
+        return PlasmaSuccess;
+
+#if defined(PLASMA_WITH_PAPI) && defined(PLASMA_WITH_TRACE)
+    if (papi_threads != NULL)
+        return PlasmaSuccess;
+
+    if (PAPI_is_initialized() == PAPI_NOT_INITED &&
+        PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT) {
+        plasma_error("PAPI_library_init() failed");
+        return PlasmaErrorInternal;
+    }
+    if (PAPI_thread_init(papi_thread_id) != PAPI_OK) {
+        plasma_error("PAPI_thread_init() failed");
+        return PlasmaErrorInternal;
+    }
+    // Parse the list of events.
+    papi_num_events = 0;
+    for (const char *p = env; *p != '\0';) {
+        size_t len = strcspn(p, ",");
+        if (len > 0) {
+            if (papi_num_events == PlasmaPapiMaxEvents ||
+                len >= PAPI_MAX_STR_LEN) {
+                plasma_error("too many or too long PAPI events");
+                return PlasmaErrorIllegalValue;
+            }
+            memcpy(papi_names[papi_num_events], p, len);
+            papi_names[papi_num_events][len] = '\0';
+            papi_num_events++;
+        }
+        p += len;
+        if (*p == ',')
+            p++;
+    }
+    int num_threads = omp_get_max_threads();
+    papi_threads = (papi_thread_t*)calloc(num_threads, sizeof(papi_thread_t));
+    if (papi_threads == NULL) {
+        plasma_error("calloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    papi_num_threads = num_threads;
+
+    int on = plasma_trace_on;
+    int retval = plasma_trace_threads_create(0);
+    if (retval != PlasmaSuccess) {
+        plasma_trace_papi_finalize();
+        return retval;
+    }
+    plasma_trace_on = on | PlasmaTracePapi;
+    return PlasmaSuccess;
+#else
+    plasma_error("PLASMA_PAPI_EVENTS set, PLASMA built without PAPI "
+                 "or tracing");
+    return PlasmaErrorNotSupported;
+#endif
+}
+
+/******************************************************************************/
+// Writes the counters to the file in PLASMA_PAPI_FILE, if set, and frees them.
+// Called by plasma_finalize().
+void plasma_trace_papi_finalize()
+{
+#if defined(PLASMA_WITH_PAPI)
+    if (papi_threads == NULL)
+        return;
+
+    const char *path = getenv("PLASMA_PAPI_FILE");
+    if (path != NULL && *path != '\0')
+        plasma_trace_write_papi(path);
+
+    // The event sets are left to the threads, which own them.
+    plasma_trace_on &= ~PlasmaTracePapi;
+    free(papi_threads);
+    papi_threads = NULL;
+    papi_num_threads = 0;
+#endif
+}
+
+/******************************************************************************/
+// Reads the counters at the start of a task at depth of thread.
+void plasma_trace_papi_begin(int thread, int depth)
+{
+#if defined(PLASMA_WITH_PAPI)
+    if (thread >= papi_num_threads)
+        return;
+
+    papi_thread_t *p = &papi_threads[thread];
+    if (p->state == 0 && papi_thread_start(p) != 0)
+        plasma_error("PAPI event set not created");
+    if (p->state != 1)
+        return;
+
+    PAPI_read(p->eventset, p->start[depth]);
+    memset(p->nested[depth], 0, sizeof(p->nested[depth]));
+#endif
+}
+
+/******************************************************************************/
+// Adds the counters of the task ending at depth of thread, without its
+// nested tasks, to its kernel and the size of its output tile.
+void plasma_trace_papi_end(int thread, int depth, const char *name,
+                           const void *tile, double start)
+{
+#if defined(PLASMA_WITH_PAPI)
+    if (thread >= papi_num_threads || papi_threads[thread].state != 1)
+        return;
+
+    papi_thread_t *p = &papi_threads[thread];
+    long long values[PlasmaPapiMaxEvents];
+    if (PAPI_read(p->eventset, values) != PAPI_OK)
+        return;
+
+    for (int e = 0; e < papi_num_events; e++) {
+        values[e] -= p->start[depth][e];
+        if (depth > 0)
+            p->nested[depth-1][e] += values[e];
+        values[e] -= p->nested[depth][e];
+    }
+    int m, n, mb = 0, nb = 0;
+    if (tile != NULL)
+        plasma_trace_tile(tile, start, &m, &n, &mb, &nb);
+
+    unsigned h = 5381;
+    for (const char *c = name; *c != '\0'; c++)
+        h = 33*h + (unsigned char)*c;
+    h = 33*(33*h + mb) + nb;
+    for (int i = 0; i < PlasmaPapiMaxKernels; i++, h++) {
+        papi_kernel_t *kernel = &p->kernels[h & (PlasmaPapiMaxKernels-1)];
+        if (kernel->name == NULL) {
+            kernel->name = name;
+            kernel->mb = mb;
+            kernel->nb = nb;
+        }
+        else if (kernel->mb != mb || kernel->nb != nb ||
+                 strcmp(kernel->name, name) != 0) {
+            continue;
+        }
+        kernel->calls++;
+        for (int e = 0; e < papi_num_events; e++)
+            kernel->values[e] += values[e];
+        break;
+    }
+#endif
+}
+
+/***************************************************************************//**
+    Writes the hardware counters of the tasks as comma-separated values,
+    summed over the threads: kernel, dimensions of the output tile
+    (0 outside of tile matrices), number of tasks, then one column per event
+    of PLASMA_PAPI_EVENTS. The counters of a task exclude its nested tasks.
+    Called after the computations, or by plasma_finalize() if the environment
+    variable PLASMA_PAPI_FILE is set to the path.
+*/
+int plasma_trace_write_papi(const char *path)
+{
+#if defined(PLASMA_WITH_PAPI)
+    if (papi_threads == NULL) {
+        plasma_error("PAPI counters not switched on");
+        return PlasmaErrorNotInitialized;
+    }
+    // Merge the kernels of the threads.
+    papi_kernel_t *sums = (papi_kernel_t*)
+        malloc(papi_num_threads*PlasmaPapiMaxKernels*sizeof(papi_kernel_t));
+    if (sums == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    int num_sums = 0;
+    for (int t = 0; t < papi_num_threads; t++) {
+        for (int k = 0; k < PlasmaPapiMaxKernels; k++) {
+            papi_kernel_t *kernel = &papi_threads[t].kernels[k];
+            if (kernel->name == NULL)
+                continue;
+            int i;
+            for (i = 0; i < num_sums; i++)
+                if (sums[i].mb == kernel->mb && sums[i].nb == kernel->nb &&
+                    strcmp(sums[i].name, kernel->name) == 0)
+                    break;
+            if (i == num_sums) {
+                sums[num_sums++] = *kernel;
+            }
+            else {
+                sums[i].calls += kernel->calls;
+                for (int e = 0; e < papi_num_events; e++)
+                    sums[i].values[e] += kernel->values[e];
+            }
+        }
+    }
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        free(sums);
+        plasma_error("fopen() failed");
+        return PlasmaErrorFileIo;
+    }
+    fprintf(file, "kernel,mb,nb,calls");
+    for (int e = 0; e < papi_num_events; e++)
+        fprintf(file, ",%s", papi_names[e]);
+    fprintf(file, "\n");
+    for (int i = 0; i < num_sums; i++) {
+        fprintf(file, "%s,%d,%d,%ld",
+                sums[i].name, sums[i].mb, sums[i].nb, sums[i].calls);
+        for (int e = 0; e < papi_num_events; e++)
+            fprintf(file, ",%lld", sums[i].values[e]);
+        fprintf(file, "\n");
+    }
+    free(sums);
+    return fclose(file) == 0 ? PlasmaSuccess : PlasmaErrorFileIo;
+#else
+    plasma_error("PLASMA built without PAPI");
+    return PlasmaErrorNotSupported;
+#endif
+}
@@ -0,0 +1,363 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_tuning.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char routine[PlasmaTuningMaxName];
+    int size;
+    int bucket;
+    plasma_tuning_t tuning;
+} plasma_tuning_entry_t;
+
+// The database is shared by the contexts of all threads.
+static plasma_tuning_entry_t tuning_entries[PlasmaTuningMaxEntries];
+static int tuning_num_entries = 0;
+static pthread_mutex_t tuning_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/******************************************************************************/
+// Returns the size bucket of size, its bit length.
+static int plasma_tuning_bucket(int size)
+{
+    int bucket = 0;
+    while (size > 0) {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Sets the tuned parameters of routine for the problems of the size bucket
+    of size, replacing those of the bucket, if any.
+*/
+int plasma_tuning_set(const char *routine, int size,
+                      int nb, int ib, int num_panel_threads, int mb)
+{
+    if (routine == NULL || strlen(routine) >= PlasmaTuningMaxName) {
+        plasma_error("invalid routine name");
+        return PlasmaErrorIllegalValue;
+    }
+    if (size < 0 || nb <= 0 || ib <= 0 || ib > nb || num_panel_threads <= 0 ||
+        mb < 0) {
+        plasma_error("invalid tuning parameters");
+        return PlasmaErrorIllegalValue;
+    }
+    int bucket = plasma_tuning_bucket(size);
+
+    pthread_mutex_lock(&tuning_lock);
+    int i;
+    for (i = 0; i < tuning_num_entries; i++)
+        if (tuning_entries[i].bucket == bucket &&
+            strcmp(tuning_entries[i].routine, routine) == 0)
+            break;
+
+    if (i == PlasmaTuningMaxEntries) {
+        pthread_mutex_unlock(&tuning_lock);
+        plasma_error("tuning database full");
+        return PlasmaErrorOutOfMemory;
+    }
+    if (i == tuning_num_entries)
+        tuning_num_entries++;
+
+    strcpy(tuning_entries[i].routine, routine);
+    tuning_entries[i].size = size;
+    tuning_entries[i].bucket = bucket;
+    tuning_entries[i].tuning.nb = nb;
+    tuning_entries[i].tuning.ib = ib;
+    tuning_entries[i].tuning.num_panel_threads = num_panel_threads;
+    tuning_entries[i].tuning.mb = mb;
+    pthread_mutex_unlock(&tuning_lock);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Gets the tuned parameters of routine of the size bucket closest to that
+    of size. Returns PlasmaErrorIllegalValue if routine has no entry.
+*/
+int plasma_tuning_get(const char *routine, int size, plasma_tuning_t *tuning)
+{
+    int bucket = plasma_tuning_bucket(size);
+    int best = -1;
+    int best_dist = 0;
+
+    pthread_mutex_lock(&tuning_lock);
+    for (int i = 0; i < tuning_num_entries; i++) {
+        if (strcmp(tuning_entries[i].routine, routine) != 0)
+            continue;
+        int dist = abs(tuning_entries[i].bucket - bucket);
+        if (best < 0 || dist < best_dist) {
+            best = i;
+            best_dist = dist;
+        }
+    }
+    if (best >= 0)
+        *tuning = tuning_entries[best].tuning;
+    pthread_mutex_unlock(&tuning_lock);
+
+    return best >= 0 ? PlasmaSuccess : PlasmaErrorIllegalValue;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Removes all entries of the database.
+*/
+void plasma_tuning_clear()
+{
+    pthread_mutex_lock(&tuning_lock);
+    tuning_num_entries = 0;
+    pthread_mutex_unlock(&tuning_lock);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Adds the entries of the file at path to the database, replacing those of
+    the same routines and buckets.
+*/
+int plasma_tuning_load(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    char line[256];
+    int retval = PlasmaSuccess;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char routine[PlasmaTuningMaxName];
+        int size, nb, ib, num_panel_threads;
+        int mb = 0;
+        if (line[0] == '#' || strspn(line, " \t\r\n") == strlen(line))
+            continue;
+        if (sscanf(line, "%31s %d %d %d %d %d",
+                   routine, &size, &nb, &ib, &num_panel_threads, &mb) < 5) {
+            plasma_error("invalid line in tuning file");
+            retval = PlasmaErrorIllegalValue;
+            break;
+        }
+        retval = plasma_tuning_set(routine, size, nb, ib, num_panel_threads,
+                                   mb);
+        if (retval != PlasmaSuccess)
+            break;
+    }
+    fclose(file);
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Writes the database to the file at path.
+*/
+int plasma_tuning_save(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    fprintf(file, "# routine size nb ib num_panel_threads mb\n");
+    pthread_mutex_lock(&tuning_lock);
+    for (int i = 0; i < tuning_num_entries; i++)
+        fprintf(file, "%s %d %d %d %d %d\n",
+                tuning_entries[i].routine,
+                tuning_entries[i].size,
+                tuning_entries[i].tuning.nb,
+                tuning_entries[i].tuning.ib,
+                tuning_entries[i].tuning.num_panel_threads,
+                tuning_entries[i].tuning.mb);
+    pthread_mutex_unlock(&tuning_lock);
+
+    if (fclose(file) != 0) {
+        plasma_error("fclose() failed");
+        return PlasmaErrorInternal;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Loads the database from the file in PLASMA_TUNING_FILE, if set, once.
+// Called by plasma_init().
+int plasma_tuning_init()
+{
+    static int loaded = 0;
+
+    const char *path = getenv("PLASMA_TUNING_FILE");
+    if (path == NULL || *path == '\0')
+        return PlasmaSuccess;
+
+    pthread_mutex_lock(&tuning_lock);
+    int first = !loaded;
+    loaded = 1;
+    pthread_mutex_unlock(&tuning_lock);
+
+    return first ? plasma_tuning_load(path) : PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Sets the parameters of the context, which is that of the calling thread,
+// to the tuned ones of routine for size, if any and PlasmaTuning is on, for
+// the call of a LAPACK-interface driver, and balances nb over size if
+// PlasmaTileBalance is on.
+// The previous parameters are saved for plasma_tuning_restore().
+void plasma_tuning_apply(plasma_context_t *plasma, const char *routine,
+                         int size, plasma_tuning_t *saved)
+{
+    saved->nb = plasma->nb;
+    saved->ib = plasma->ib;
+    saved->num_panel_threads = plasma->num_panel_threads;
+    saved->mb = plasma->mb;
+
+    plasma_tuning_t tuning;
+    if (plasma->tuning == PlasmaTuningOn &&
+        plasma_tuning_get(routine, size, &tuning) == PlasmaSuccess) {
+        plasma->nb = tuning.nb;
+        plasma->ib = tuning.ib;
+        plasma->mb = tuning.mb;
+        // Resizes the panel workspace, or keeps the threads if it fails.
+        plasma_set(PlasmaNumPanelThreads, tuning.num_panel_threads);
+    }
+
+    plasma->nb = plasma_tile_balance(plasma, size, plasma->nb);
+    if (plasma->ib > plasma->nb)
+        plasma->ib = plasma->nb;
+}
+
+/******************************************************************************/
+// Restores the parameters saved by plasma_tuning_apply().
+void plasma_tuning_restore(plasma_context_t *plasma,
+                           const plasma_tuning_t *saved)
+{
+    plasma->nb = saved->nb;
+    plasma->ib = saved->ib;
+    plasma->mb = saved->mb;
+    if (plasma->num_panel_threads != saved->num_panel_threads)
+        plasma_set(PlasmaNumPanelThreads, saved->num_panel_threads);
+}
+
+/******************************************************************************/
+// Parameters of the fields of plasma_options_t, in order.
+static const plasma_enum_t options_params[] = {
+    PlasmaNb,
+    PlasmaIb,
+    PlasmaNumPanelThreads,
+    PlasmaLookahead,
+    PlasmaHouseholderTree,
+    PlasmaTuning,
+    PlasmaMb,
+    PlasmaGemmHint
+};
+
+enum {
+    PlasmaOptionsNum = sizeof(options_params)/sizeof(options_params[0])
+};
+
+/******************************************************************************/
+static void plasma_options_values(const plasma_options_t *options,
+                                  int values[])
+{
+    values[0] = options->nb;
+    values[1] = options->ib;
+    values[2] = options->num_panel_threads;
+    values[3] = options->lookahead;
+    values[4] = options->householder_tree;
+    values[5] = options->tuning;
+    values[6] = options->mb;
+    values[7] = options->gemm_hint;
+}
+
+/******************************************************************************/
+static void plasma_options_set_value(plasma_options_t *options, int i,
+                                     int value)
+{
+    switch (i) {
+    case 0: options->nb = value; break;
+    case 1: options->ib = value; break;
+    case 2: options->num_panel_threads = value; break;
+    case 3: options->lookahead = value; break;
+    case 4: options->householder_tree = value; break;
+    case 5: options->tuning = value; break;
+    case 6: options->mb = value; break;
+    case 7: options->gemm_hint = value; break;
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Sets all the options to PlasmaOptionDefault, the values of the context.
+*/
+void plasma_options_init(plasma_options_t *options)
+{
+    for (int i = 0; i < PlasmaOptionsNum; i++)
+        plasma_options_set_value(options, i, PlasmaOptionDefault);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Sets the parameters of the context of the calling thread to the options
+    given, saving their previous values for plasma_options_restore().
+    On error, the context is left as it was.
+*/
+int plasma_options_apply(const plasma_options_t *options,
+                         plasma_options_t *saved)
+{
+    plasma_options_init(saved);
+    if (options == NULL)
+        return PlasmaSuccess;
+
+    int values[PlasmaOptionsNum];
+    plasma_options_values(options, values);
+
+    // Tiling options given override the tuned ones.
+    if ((values[0] != PlasmaOptionDefault ||
+         values[1] != PlasmaOptionDefault ||
+         values[2] != PlasmaOptionDefault ||
+         values[6] != PlasmaOptionDefault) &&
+        values[5] == PlasmaOptionDefault)
+        values[5] = PlasmaTuningOff;
+
+    for (int i = 0; i < PlasmaOptionsNum; i++) {
+        if (values[i] == PlasmaOptionDefault)
+            continue;
+        int value;
+        int retval = plasma_get(options_params[i], &value);
+        if (retval == PlasmaSuccess)
+            retval = plasma_set(options_params[i], values[i]);
+        if (retval != PlasmaSuccess) {
+            plasma_options_restore(saved);
+            plasma_options_init(saved);
+            return retval;
+        }
+        plasma_options_set_value(saved, i, value);
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Restores the parameters of the context saved by plasma_options_apply().
+*/
+void plasma_options_restore(const plasma_options_t *saved)
+{
+    int values[PlasmaOptionsNum];
+    plasma_options_values(saved, values);
+    for (int i = 0; i < PlasmaOptionsNum; i++)
+        if (values[i] != PlasmaOptionDefault)
+            plasma_set(options_params[i], values[i]);
+}
@@ -8,56 +8,201 @@
  *
  **/
 #include "plasma_workspace.h"
+#include "plasma_context.h"
 #include "plasma_internal.h"
 
 #include <omp.h>
 
 /******************************************************************************/
+// Frees the workspaces of size bytes each.
+static void plasma_workspace_free(plasma_allocator_t *allocator,
+                                  plasma_workspace_t *work, size_t size)
+{
+    if (work->spaces != NULL) {
+        for (int i = 0; i < work->nthread; ++i)
+            plasma_allocator_free(allocator, work->spaces[i], size);
+        free(work->spaces);
+    }
+    work->spaces  = NULL;
+    work->nthread = 0;
+    work->lwork   = 0;
+}
+
+/******************************************************************************/
+// Allocates nthread workspaces of size bytes each.
+static int plasma_workspace_alloc(plasma_allocator_t *allocator,
+                                  plasma_workspace_t *work,
+                                  int nthread, size_t size)
+{
+    work->nthread = nthread;
+    work->spaces = (void**)calloc(nthread, sizeof(void*));
+    if (work->spaces == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int i = 0; i < nthread; i++) {
+        work->spaces[i] = plasma_allocator_alloc(allocator, size);
+        if (work->spaces[i] == NULL) {
+            plasma_workspace_free(allocator, work, size);
+            plasma_error("malloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Provides one workspace of lwork elements for each thread of a parallel
+    region. Borrows the per-thread workspace pool of the context, growing it
+    if needed, so that repeated calls make no allocations. If the pool is
+    already lent, e.g., to another asynchronous call, allocates new storage.
+*/
 int plasma_workspace_create(plasma_workspace_t *work, size_t lwork,
                             plasma_enum_t dtyp)
 {
-    // Allocate array of pointers.
-    #pragma omp parallel
-    #pragma omp master
-    {
-        work->nthread = omp_get_num_threads();
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
     }
+    int nthread = omp_get_max_threads();
+    size_t size = (size_t)lwork * plasma_element_size(dtyp);
+
     work->lwork = lwork;
     work->dtyp  = dtyp;
-    if ((work->spaces = (void**)calloc(work->nthread, sizeof(void*))) == NULL) {
-        free(work->spaces);
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
+    work->pooled = 0;
 
-    // Each thread allocates its workspace.
-    size_t size = (size_t)lwork * plasma_element_size(work->dtyp);
-    int info = PlasmaSuccess;
-    #pragma omp parallel
-    {
-        int tid = omp_get_thread_num();
-        if ((work->spaces[tid] = (void*)malloc(size)) == NULL) {
-            info = PlasmaErrorOutOfMemory;
+    plasma_workspace_t *pool = &plasma->work_pool;
+    if (!plasma->work_pool_lent) {
+        // Grow the pool, never shrink it.
+        if (pool->nthread < nthread || pool->lwork < size) {
+            size_t pool_size = pool->lwork > size ? pool->lwork : size;
+            int pool_nthread = imax(pool->nthread, nthread);
+            plasma_workspace_free(&plasma->allocator, pool, pool->lwork);
+            int retval = plasma_workspace_alloc(&plasma->allocator, pool,
+                                                pool_nthread, pool_size);
+            if (retval != PlasmaSuccess)
+                return retval;
+            pool->lwork = pool_size;
         }
+        plasma->work_pool_lent = 1;
+        work->spaces = pool->spaces;
+        work->nthread = pool->nthread;
+        work->pooled = 1;
+        plasma_stats_memory_acquire(plasma, work->nthread*size);
+        return PlasmaSuccess;
     }
-    if (info != PlasmaSuccess) {
-        plasma_workspace_destroy(work);
-    }
-    return info;
+    int retval = plasma_workspace_alloc(&plasma->allocator, work,
+                                        nthread, size);
+    if (retval == PlasmaSuccess)
+        plasma_stats_memory_acquire(plasma, work->nthread*size);
+    return retval;
 }
 
-/******************************************************************************/
+/***************************************************************************//**
+    Returns the workspaces to the pool of the context, or frees them.
+*/
 int plasma_workspace_destroy(plasma_workspace_t *work)
 {
-    if (work->spaces != NULL) {
-        for (int i = 0; i < work->nthread; ++i) {
-            free(work->spaces[i]);
-            work->spaces[i] = NULL;
-        }
-        free(work->spaces);
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (work->nthread > 0) {
+        size_t size = work->lwork * plasma_element_size(work->dtyp);
+        plasma_stats_memory_release(plasma, work->nthread*size);
+    }
+    if (work->pooled) {
+        plasma->work_pool_lent = 0;
         work->spaces  = NULL;
         work->nthread = 0;
         work->lwork   = 0;
+        work->pooled  = 0;
+    }
+    else {
+        plasma_workspace_free(&plasma->allocator, work,
+                              work->lwork * plasma_element_size(work->dtyp));
     }
     return PlasmaSuccess;
 }
+
+/***************************************************************************//**
+    Frees the per-thread workspace pool of the context.
+    The pool must not be lent.
+*/
+void plasma_workspace_pool_clear(plasma_workspace_t *pool,
+                                 plasma_allocator_t *allocator)
+{
+    plasma_workspace_free(allocator, pool, pool->lwork);
+}
+
+/******************************************************************************/
+int plasma_panel_workspace_create(plasma_panel_workspace_t *work, int size)
+{
+    work->size = size;
+    work->info = 0;
+    work->busy = 0;
+    work->max_idx = (int*)malloc(size*sizeof(int));
+    // Pivot magnitudes are stored in the working precision, at most double.
+    work->max_val = malloc(size*sizeof(double));
+    if (work->max_idx == NULL || work->max_val == NULL) {
+        plasma_panel_workspace_destroy(work);
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+int plasma_panel_workspace_destroy(plasma_panel_workspace_t *work)
+{
+    free(work->max_idx);
+    free(work->max_val);
+    work->max_idx = NULL;
+    work->max_val = NULL;
+    work->size = 0;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Lends the panel workspace of the context to a panel. While a panel of
+    another sequence running in the same region holds it, e.g., in a
+    session, see plasma_session_create(), creates one of the same size for
+    the panel instead. Given back by plasma_panel_workspace_release().
+*/
+plasma_panel_workspace_t *plasma_panel_workspace_acquire(
+    plasma_panel_workspace_t *work)
+{
+    for (;;) {
+        int busy;
+        #pragma omp atomic capture
+        { busy = work->busy; work->busy = 1; }
+        if (!busy)
+            return work;
+
+        plasma_panel_workspace_t *own =
+            (plasma_panel_workspace_t*)malloc(sizeof(plasma_panel_workspace_t));
+        if (own != NULL &&
+            plasma_panel_workspace_create(own, work->size) == PlasmaSuccess)
+            return own;
+
+        // Out of memory: wait for the one of the context.
+        free(own);
+        #pragma omp taskyield
+    }
+}
+
+/******************************************************************************/
+void plasma_panel_workspace_release(plasma_panel_workspace_t *work,
+                                    plasma_panel_workspace_t *lent)
+{
+    if (lent == work) {
+        #pragma omp atomic write
+        work->busy = 0;
+    }
+    else {
+        plasma_panel_workspace_destroy(lent);
+        free(lent);
+    }
+}
@@ -0,0 +1,309 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgbhrd.c, normal z -> c, Thu Oct 15 08:59:52 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_barrier.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <omp.h>
+
+#define A(i_, j_) (&A[(i_) + (size_t)lda*(j_)])
+
+/******************************************************************************/
+// Applies H^H = I - conjf(tau) v v^H to the m-by-n matrix C from the left,
+// with w of size n.
+static void core_cgbhrd_left(int m, int n,
+                             const plasma_complex32_t *v,
+                             plasma_complex32_t tau,
+                             plasma_complex32_t *C, int ldc,
+                             plasma_complex32_t *w)
+{
+    plasma_complex32_t zone  = 1.0;
+    plasma_complex32_t zzero = 0.0;
+    plasma_complex32_t ctau  = -conjf(tau);
+
+    if (tau == 0.0 || m <= 0 || n <= 0)
+        return;
+
+    // w = C^H v, C = C - conjf(tau) v w^H
+    cblas_cgemv(CblasColMajor, (CBLAS_TRANSPOSE)Plasma_ConjTrans, m, n,
+                CBLAS_SADDR(zone), C, ldc, v, 1, CBLAS_SADDR(zzero), w, 1);
+    cblas_cgerc(CblasColMajor, m, n,
+                CBLAS_SADDR(ctau), v, 1, w, 1, C, ldc);
+}
+
+/******************************************************************************/
+// Applies H = I - tau v v^H to the m-by-n matrix C from the right,
+// with w of size m.
+static void core_cgbhrd_right(int m, int n,
+                              const plasma_complex32_t *v,
+                              plasma_complex32_t tau,
+                              plasma_complex32_t *C, int ldc,
+                              plasma_complex32_t *w)
+{
+    plasma_complex32_t zone  = 1.0;
+    plasma_complex32_t zzero = 0.0;
+    plasma_complex32_t mtau  = -tau;
+
+    if (tau == 0.0 || m <= 0 || n <= 0)
+        return;
+
+    // w = C v, C = C - tau w v^H
+    cblas_cgemv(CblasColMajor, CblasNoTrans, m, n,
+                CBLAS_SADDR(zone), C, ldc, v, 1, CBLAS_SADDR(zzero), w, 1);
+    cblas_cgerc(CblasColMajor, m, n,
+                CBLAS_SADDR(mtau), w, 1, v, 1, C, ldc);
+}
+
+/***************************************************************************//**
+ * @ingroup core_gehrd
+ *
+ *  Reduces the n-by-n upper Hessenberg matrix A of lower bandwidth kd, the
+ *  block upper Hessenberg matrix left by plasma_pcge2hb(), to upper
+ *  Hessenberg form H by unitary similarity, A = Q H Q^H, on a team of size
+ *  ranks meeting at the barrier. This is the second stage of the two-stage
+ *  Hessenberg reduction.
+ *
+ *  Sweep j annihilates column j below the first subdiagonal by a reflector
+ *  on rows j+1 to j+kd, and chases the bulge it creates down the band: step
+ *  s > 0 annihilates the first column of the bulge, column j+1+(s-1)*kd, by
+ *  a reflector on the kd rows from j+1+s*kd. The other columns of the bulge
+ *  are left for the later sweeps, which meet them in their own bulges.
+ *
+ *  The reflectors of a sweep only depend on each other through the bulges,
+ *  the blocks of kd rows below the blocks of kd columns they are applied
+ *  to: rank 0 chases them, from the reflector of each step to the bulge of
+ *  the next, and then the ranks apply the sweep to the blocks of kd columns
+ *  above the bulges, dealt cyclically, from the left and then from the
+ *  right. The sweep costs O((n-j)*n) flops in BLAS-2 operations, of which
+ *  only O((n-j)*kd) are on rank 0.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] kd
+ *          The lower bandwidth of A. kd >= 1.
+ *
+ * @param[in,out] A
+ *          On entry, the n-by-n matrix A, of which the entries below the
+ *          kd-th subdiagonal are not referenced.
+ *          On exit, the upper Hessenberg matrix H, with zeros below the
+ *          first subdiagonal.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[out] V
+ *          The reflectors: the one of step s of sweep j, of length kd at
+ *          most, with a unit first entry, at V[(j*ns+s)*kd], with
+ *          ns = ceil((n-2)/kd) the number of steps of sweep 0.
+ *          Of size (n-2)*ns*kd.
+ *
+ * @param[out] tau
+ *          The scalar factors of the reflectors, at tau[j*ns+s],
+ *          zero for the steps not taken. Of size (n-2)*ns.
+ *
+ * @param[out] work
+ *          Workspace of size size*n.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread in the team.
+ *
+ * @param[in] size
+ *          The number of ranks of the team.
+ *
+ * @param[in] barrier
+ *          The barrier of the team.
+ *
+ ******************************************************************************/
+void core_cgbhrd(int n, int kd,
+                 plasma_complex32_t *A, int lda,
+                 plasma_complex32_t *V, plasma_complex32_t *tau,
+                 plasma_complex32_t *work,
+                 int rank, int size, plasma_barrier_t *barrier)
+{
+    if (n <= 2)
+        return;
+
+    int ns = (n-2+kd-1)/kd;
+    plasma_complex32_t *w = &work[(size_t)n*rank];
+
+    // Zero A below the band, by columns dealt cyclically.
+    for (int j = rank; j < n-kd-1; j += size)
+        for (int i = j+kd+1; i < n; i++)
+            *A(i, j) = 0.0;
+
+    for (int j = 0; j < n-2; j++) {
+        plasma_barrier_wait(barrier, rank);
+
+        plasma_complex32_t *Vj = &V[(size_t)j*ns*kd];
+        plasma_complex32_t *tauj = &tau[(size_t)j*ns];
+
+        // Chase the bulge: step s annihilates column c on rows r0 to r1.
+        if (rank == 0) {
+            for (int s = 0; s < ns; s++) {
+                int r0 = j+1+s*kd;
+                if (r0 >= n-1) {
+                    tauj[s] = 0.0;
+                    continue;
+                }
+                int r1 = imin(r0+kd-1, n-1);
+                int c = s == 0 ? j : r0-kd;
+                plasma_complex32_t *v = &Vj[s*kd];
+
+                LAPACKE_clarfg_work(r1-r0+1, A(r0, c), A(r0+1, c), 1,
+                                    &tauj[s]);
+                v[0] = 1.0;
+                for (int i = r0+1; i <= r1; i++) {
+                    v[i-r0] = *A(i, c);
+                    *A(i, c) = 0.0;
+                }
+
+                // the rest of the bulge, from the left
+                if (s > 0)
+                    core_cgbhrd_left(r1-r0+1, r0-c-1, v, tauj[s],
+                                     A(r0, c+1), lda, w);
+
+                // the bulge of the next step, from the right
+                if (r1+1 < n)
+                    core_cgbhrd_right(imin(r1+kd, n-1)-r1, r1-r0+1,
+                                      v, tauj[s],
+                                      A(r1+1, r0), lda, w);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+
+        // Apply the sweep above the bulges, by blocks of kd columns.
+        int nt = (n-1-j+kd-1)/kd;
+        for (int t = rank; t < nt; t += size) {
+            int c0 = j+1+t*kd;
+            int c1 = imin(c0+kd-1, n-1);
+
+            // from the left, by the steps up to t
+            for (int s = 0; s <= imin(t, ns-1); s++) {
+                int r0 = j+1+s*kd;
+                if (r0 >= n-1)
+                    break;
+                int r1 = imin(r0+kd-1, n-1);
+                core_cgbhrd_left(r1-r0+1, c1-c0+1, &Vj[s*kd], tauj[s],
+                                 A(r0, c0), lda, w);
+            }
+            // from the right, by step t
+            if (t < ns)
+                core_cgbhrd_right(c1+1, c1-c0+1, &Vj[t*kd], tauj[t],
+                                  A(0, c0), lda, w);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * @ingroup core_gehrd
+ *
+ *  Applies the reflectors of core_cgbhrd() to the columns jq to jq+nq-1 of
+ *  the identity, which gives these columns of its Q. The reflectors are
+ *  applied from the left, the last one first, so that the reflectors of
+ *  sweep j only update the rows and the columns from j+1 on, the rest of
+ *  the product being the identity.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of Q. n >= 0.
+ *
+ * @param[in] kd
+ *          The lower bandwidth of the reduced matrix. kd >= 1.
+ *
+ * @param[in] V
+ *          The reflectors, as returned by core_cgbhrd().
+ *
+ * @param[in] tau
+ *          The scalar factors of the reflectors, as returned by
+ *          core_cgbhrd().
+ *
+ * @param[in] jq
+ *          The first column of Q to compute.
+ *
+ * @param[in] nq
+ *          The number of columns of Q to compute.
+ *
+ * @param[out] Q
+ *          On exit, the n-by-nq matrix of the columns jq to jq+nq-1 of Q.
+ *
+ * @param[in] ldq
+ *          The leading dimension of the array Q. ldq >= max(1,n).
+ *
+ * @param[out] work
+ *          Workspace of size nq.
+ *
+ ******************************************************************************/
+void core_cgbhrd_q(int n, int kd,
+                   const plasma_complex32_t *V, const plasma_complex32_t *tau,
+                   int jq, int nq,
+                   plasma_complex32_t *Q, int ldq,
+                   plasma_complex32_t *work)
+{
+    LAPACKE_claset_work(LAPACK_COL_MAJOR, 'G', n, nq, 0.0, 0.0, Q, ldq);
+    for (int j = 0; j < nq; j++)
+        Q[jq+j + (size_t)ldq*j] = 1.0;
+
+    if (n <= 2)
+        return;
+
+    int ns = (n-2+kd-1)/kd;
+    for (int j = n-3; j >= 0; j--) {
+        // the columns jq+k0 on of Q, from j+1 on
+        int k0 = imax(0, j+1-jq);
+        if (k0 >= nq)
+            continue;
+
+        for (int s = ns-1; s >= 0; s--) {
+            int r0 = j+1+s*kd;
+            if (r0 >= n-1)
+                continue;
+            int r1 = imin(r0+kd-1, n-1);
+            plasma_complex32_t ctau = conjf(tau[(size_t)j*ns+s]);
+
+            // H applied from the left is H^H with conjf(tau).
+            core_cgbhrd_left(r1-r0+1, nq-k0, &V[((size_t)j*ns+s)*kd], ctau,
+                             &Q[r0 + (size_t)ldq*k0], ldq, work);
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_cgbhrd_q(int n, int kd,
+                       const plasma_complex32_t *V,
+                       const plasma_complex32_t *tau,
+                       int jq, int nq,
+                       plasma_complex32_t *Q, int ldq,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(out:Q[0:ldq*nq]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgbhrd_q", Q);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            // Prepare workspace.
+            int tid = omp_get_thread_num();
+            plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
+
+            core_cgbhrd_q(n, kd, V, tau, jq, nq, Q, ldq, W);
+        }
+        PLASMA_TRACE_STOP("cgbhrd_q", 1, Q);
+    }
+}
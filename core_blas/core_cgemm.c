@@ -6,14 +6,125 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgemm.c, normal z -> c, Mon Feb  6 14:06:46 2017
+ * @generated from core_blas/core_zgemm.c, normal z -> c, Thu Oct 15 09:29:52 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
+#include "plasma_runtime.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
+#define COMPLEX
+
+#if defined(PLASMA_WITH_MKL_JIT)
+#include <mkl.h>
+
+/******************************************************************************/
+// Kernels of the full tiles of the common tile sizes, m = n = k = lda =
+// ldb = ldc = nb, generated by the MKL JIT on first use for each transa,
+// transb, alpha and beta. A null kernel marks a failed generation.
+#define CORE_CGEMM_JIT_MAX 32
+
+static struct {
+    plasma_enum_t transa;
+    plasma_enum_t transb;
+    int nb;
+    plasma_complex32_t alpha;
+    plasma_complex32_t beta;
+    void *jitter;
+    cgemm_jit_kernel_t kernel;
+} core_cgemm_jit[CORE_CGEMM_JIT_MAX];
+
+static volatile int core_cgemm_jit_num = 0;
+
+static cgemm_jit_kernel_t core_cgemm_jit_kernel(
+    plasma_enum_t transa, plasma_enum_t transb, int nb,
+    plasma_complex32_t alpha, plasma_complex32_t beta, void **jitter)
+{
+    // The entries are published by the increment of the count.
+    int num = core_cgemm_jit_num;
+    __sync_synchronize();
+    for (int i = 0; i < num; i++) {
+        if (core_cgemm_jit[i].transa == transa &&
+            core_cgemm_jit[i].transb == transb &&
+            core_cgemm_jit[i].nb == nb &&
+            core_cgemm_jit[i].alpha == alpha &&
+            core_cgemm_jit[i].beta == beta) {
+            *jitter = core_cgemm_jit[i].jitter;
+            return core_cgemm_jit[i].kernel;
+        }
+    }
+    cgemm_jit_kernel_t kernel = NULL;
+    *jitter = NULL;
+    #pragma omp critical(core_cgemm_jit)
+    {
+        int i;
+        for (i = 0; i < core_cgemm_jit_num; i++) {
+            if (core_cgemm_jit[i].transa == transa &&
+                core_cgemm_jit[i].transb == transb &&
+                core_cgemm_jit[i].nb == nb &&
+                core_cgemm_jit[i].alpha == alpha &&
+                core_cgemm_jit[i].beta == beta)
+                break;
+        }
+        if (i < core_cgemm_jit_num) {
+            *jitter = core_cgemm_jit[i].jitter;
+            kernel = core_cgemm_jit[i].kernel;
+        }
+        else if (i < CORE_CGEMM_JIT_MAX) {
+            // The real kernels take the scalars by value.
+#ifdef COMPLEX
+            mkl_jit_status_t status = mkl_jit_create_cgemm(
+                jitter, MKL_COL_MAJOR,
+                (MKL_TRANSPOSE)transa, (MKL_TRANSPOSE)transb,
+                nb, nb, nb,
+                &alpha, nb, nb,
+                &beta,  nb);
+#else
+            mkl_jit_status_t status = mkl_jit_create_cgemm(
+                jitter, MKL_COL_MAJOR,
+                (MKL_TRANSPOSE)transa, (MKL_TRANSPOSE)transb,
+                nb, nb, nb,
+                alpha, nb, nb,
+                beta,  nb);
+#endif
+            if (status != MKL_JIT_ERROR)
+                kernel = mkl_jit_get_cgemm_ptr(*jitter);
+            else
+                *jitter = NULL;
+
+            core_cgemm_jit[i].transa = transa;
+            core_cgemm_jit[i].transb = transb;
+            core_cgemm_jit[i].nb = nb;
+            core_cgemm_jit[i].alpha = alpha;
+            core_cgemm_jit[i].beta = beta;
+            core_cgemm_jit[i].jitter = *jitter;
+            core_cgemm_jit[i].kernel = kernel;
+            __sync_synchronize();
+            core_cgemm_jit_num = i+1;
+        }
+    }
+    return kernel;
+}
+
+/******************************************************************************/
+// Releases the kernels of the full tiles, called by plasma_finalize.
+void core_cgemm_jit_finalize()
+{
+    for (int i = 0; i < core_cgemm_jit_num; i++) {
+        if (core_cgemm_jit[i].jitter != NULL)
+            mkl_jit_destroy(core_cgemm_jit[i].jitter);
+    }
+    core_cgemm_jit_num = 0;
+}
+#else
+void core_cgemm_jit_finalize()
+{
+}
+#endif
+
 /***************************************************************************//**
  *
  * @ingroup core_gemm
@@ -30,6 +141,11 @@
  *  alpha and beta are scalars, and A, B and C  are matrices, with op( A )
  *  an m-by-k matrix, op( B ) a k-by-n matrix and C an m-by-n matrix.
  *
+ *  With PLASMA_WITH_MKL_JIT defined, the full tiles of the tile sizes
+ *  128, 192 and 256, with m = n = k = lda = ldb = ldc, go to kernels
+ *  generated by the MKL JIT for their sizes, transpositions and scalars.
+ *  The other tiles, e.g., the edge tiles, go to cblas_cgemm.
+ *
  *******************************************************************************
  *
  * @param[in] transa
@@ -92,6 +208,18 @@ void core_cgemm(plasma_enum_t transa, plasma_enum_t transb,
                                           const plasma_complex32_t *B, int ldb,
                 plasma_complex32_t beta,        plasma_complex32_t *C, int ldc)
 {
+#if defined(PLASMA_WITH_MKL_JIT)
+    if (m == n && m == k && (m == 128 || m == 192 || m == 256) &&
+        lda == m && ldb == m && ldc == m) {
+        void *jitter;
+        cgemm_jit_kernel_t kernel =
+            core_cgemm_jit_kernel(transa, transb, m, alpha, beta, &jitter);
+        if (kernel != NULL) {
+            kernel(jitter, (plasma_complex32_t*)A, (plasma_complex32_t*)B, C);
+            return;
+        }
+    }
+#endif
     cblas_cgemm(CblasColMajor,
                 (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
                 m, n, k,
@@ -100,6 +228,19 @@ void core_cgemm(plasma_enum_t transa, plasma_enum_t transb,
                 CBLAS_SADDR(beta),  C, ldc);
 }
 
+/******************************************************************************/
+// Runs the gemm of a task replayed from a task graph.
+static void core_cgemm_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_cgemm(task->param[0], task->param[1],
+               task->dim[0], task->dim[1], task->dim[2],
+               task->alpha, tiles[1], task->dim[3],
+                            tiles[2], task->dim[4],
+               task->beta,  tiles[0], task->dim[5]);
+}
+
 /******************************************************************************/
 void core_omp_cgemm(
     plasma_enum_t transa, plasma_enum_t transb,
@@ -108,6 +249,245 @@ void core_omp_cgemm(
                               const plasma_complex32_t *B, int ldb,
     plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_cgemm_replay,
+            .param = {transa, transb},
+            .dim = {m, n, k, lda, ldb, ldc},
+            .alpha = alpha, .beta = beta};
+        PLASMA_GRAPH_ADD(task, 1, C, A, B);
+        return;
+    }
+
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemm", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgemm(transa, transb,
+                       m, n, k,
+                       alpha, A, lda,
+                              B, ldb,
+                       beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*k,
+                           (float)m*k + (float)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgemm", 1, C, A, B);
+    }
+}
+
+/******************************************************************************/
+// Same as core_omp_cgemm, with a commutative dependency on C, for the
+// accumulations into C in any order.
+void core_omp_cgemm_commute(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    PLASMA_TASK(PLASMA_IN(A, 0, lda*ak)
+                PLASMA_IN(B, 0, ldb*bk)
+                PLASMA_COMMUTE(C, 0, ldc*n)
+                PLASMA_PRIORITY(plasma_sequence_priority(sequence)))
+    {
+        PLASMA_TRACE_START("cgemm", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgemm(transa, transb,
+                       m, n, k,
+                       alpha, A, lda,
+                              B, ldb,
+                       beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*k,
+                           (float)m*k + (float)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgemm", 1, C, A, B);
+    }
+}
+
+/******************************************************************************/
+// Computes C = alpha*(op(A[0])*op(B[0]) + ... + op(A[count-1])*op(B[count-1]))
+// + beta*C in one task, for a chain of count <= PlasmaCoarsenMaxTiles tile
+// products of inner dimensions k[0], ..., k[count-1] summed into the same C.
+// The dependences take PlasmaCoarsenMaxTiles tiles of A and B, the missing
+// ones repeating the first tile. With prefetch, the tiles of each product
+// are prefetched while the product before them is computed.
+void core_omp_cgemm_chain(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int count, int m, int n, const int *k,
+    plasma_complex32_t alpha, plasma_complex32_t * const *A, const int *lda,
+                              plasma_complex32_t * const *B, const int *ldb,
+    plasma_complex32_t beta,  plasma_complex32_t *C, int ldc,
+    int prefetch,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int kv[PlasmaCoarsenMaxTiles];
+    plasma_complex32_t *a[PlasmaCoarsenMaxTiles];
+    plasma_complex32_t *b[PlasmaCoarsenMaxTiles];
+    int la[PlasmaCoarsenMaxTiles], lb[PlasmaCoarsenMaxTiles];
+    size_t sa[PlasmaCoarsenMaxTiles], sb[PlasmaCoarsenMaxTiles];
+    int ksum = 0;
+    for (int i = 0; i < PlasmaCoarsenMaxTiles; i++) {
+        int j = i < count ? i : 0;
+        kv[i] = k[j];
+        a[i] = A[j];
+        b[i] = B[j];
+        la[i] = lda[j];
+        lb[i] = ldb[j];
+        sa[i] = (size_t)la[i]*(transa == PlasmaNoTrans ? kv[i] : m);
+        sb[i] = (size_t)lb[i]*(transb == PlasmaNoTrans ? n : kv[i]);
+        if (i < count)
+            ksum += kv[i];
+    }
+    plasma_complex32_t *a0 = a[0], *a1 = a[1], *a2 = a[2], *a3 = a[3];
+    plasma_complex32_t *b0 = b[0], *b1 = b[1], *b2 = b[2], *b3 = b[3];
+    size_t sa0 = sa[0], sa1 = sa[1], sa2 = sa[2], sa3 = sa[3];
+    size_t sb0 = sb[0], sb1 = sb[1], sb2 = sb[2], sb3 = sb[3];
+
+    #pragma omp task depend(in:a0[0:sa0]) \
+                     depend(in:a1[0:sa1]) \
+                     depend(in:a2[0:sa2]) \
+                     depend(in:a3[0:sa3]) \
+                     depend(in:b0[0:sb0]) \
+                     depend(in:b1[0:sb1]) \
+                     depend(in:b2[0:sb2]) \
+                     depend(in:b3[0:sb3]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemm_chain", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            for (int i = 0; i < count; i++) {
+                if (prefetch && i+1 < count) {
+                    int j = i+1;
+                    core_prefetch_tile(
+                        a[j],
+                        transa == PlasmaNoTrans ? m : kv[j],
+                        transa == PlasmaNoTrans ? kv[j] : m,
+                        la[j], sizeof(plasma_complex32_t));
+                    core_prefetch_tile(
+                        b[j],
+                        transb == PlasmaNoTrans ? kv[j] : n,
+                        transb == PlasmaNoTrans ? n : kv[j],
+                        lb[j], sizeof(plasma_complex32_t));
+                }
+                core_cgemm(transa, transb,
+                           m, n, kv[i],
+                           alpha, a[i], la[i],
+                                  b[i], lb[i],
+                           i == 0 ? beta : 1.0, C, ldc);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*ksum,
+                           (float)m*ksum + (float)ksum*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgemm_chain", 1, C, a0, a1, a2, a3,
+                          b0, b1, b2, b3);
+    }
+}
+
+/******************************************************************************/
+// Same as core_omp_cgemm, for a large tile product split into sub-tiles of
+// nb_sub: the task runs nested tasks, one per sub-tile of C, each summing
+// the products of the sub-tiles of op( A ) and op( B ) along k.
+void core_omp_cgemm_nested(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int nb_sub,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemm", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            for (int j = 0; j < n; j += nb_sub) {
+                for (int i = 0; i < m; i += nb_sub) {
+                    #pragma omp task firstprivate(i, j) \
+                        priority(plasma_sequence_priority(sequence))
+                    {
+                        int mb = m-i < nb_sub ? m-i : nb_sub;
+                        int nb = n-j < nb_sub ? n-j : nb_sub;
+                        int l = 0;
+                        do {
+                            int kb = k-l < nb_sub ? k-l : nb_sub;
+                            const plasma_complex32_t *Ail =
+                                transa == PlasmaNoTrans ?
+                                &A[i + (size_t)lda*l] : &A[l + (size_t)lda*i];
+                            const plasma_complex32_t *Blj =
+                                transb == PlasmaNoTrans ?
+                                &B[l + (size_t)ldb*j] : &B[j + (size_t)ldb*l];
+                            core_cgemm(transa, transb,
+                                       mb, nb, kb,
+                                       alpha, Ail, lda,
+                                              Blj, ldb,
+                                       l == 0 ? beta : 1.0,
+                                       &C[i + (size_t)ldc*j], ldc);
+                            l += nb_sub;
+                        } while (l < k);
+                    }
+                }
+            }
+            #pragma omp taskwait
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*k,
+                           (float)m*k + (float)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgemm", 1, C, A, B);
+    }
+}
+
+/******************************************************************************/
+// Computes C = alpha*op(A)*op(B) + beta*C and the largest absolute value
+// of each column of the result while the tile is in cache.
+void core_omp_cgemm_scamax(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    float *values,
+    plasma_sequence_t *sequence, plasma_request_t *request)
 {
     int ak;
     if (transa == PlasmaNoTrans)
@@ -123,13 +503,19 @@ void core_omp_cgemm(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     depend(out:values[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("cgemm_scamax", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
             core_cgemm(transa, transb,
                        m, n, k,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+            core_scamax(PlasmaColumnwise, m, n, C, ldc, values);
+        }
+        PLASMA_TRACE_STOP("cgemm_scamax", 2, C, values, A, B);
     }
 }
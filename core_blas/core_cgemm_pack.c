@@ -0,0 +1,188 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_pack.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+#define COMPLEX
+
+// The MKL packed gemm is only available in real precisions.
+#if defined(PLASMA_WITH_MKL) && defined(REAL)
+#define CORE_CGEMM_PACK
+#include <mkl.h>
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Returns the size in bytes of the packed form of op( A ) (side =
+ *  PlasmaLeft), an m-by-k matrix, or of op( B ) (side = PlasmaRight),
+ *  a k-by-n matrix, of the product op( A )*op( B ). Returns 0 if the BLAS
+ *  has no packed gemm, which is the case unless PLASMA_WITH_MKL is
+ *  defined, in the real precisions.
+ *
+ ******************************************************************************/
+size_t core_cgemm_pack_size(plasma_enum_t side, int m, int n, int k)
+{
+#if defined(CORE_CGEMM_PACK)
+    return cblas_cgemm_pack_get_size(
+        side == PlasmaLeft ? CblasAMatrix : CblasBMatrix, m, n, k);
+#else
+    return 0;
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Packs alpha*op( A ) (side = PlasmaLeft), an m-by-k matrix, or
+ *  alpha*op( B ) (side = PlasmaRight), a k-by-n matrix, into the format
+ *  of the BLAS micro-kernels, for core_cgemm_packed. The packed op( A )
+ *  serves the products of any n, and the packed op( B ) those of any m.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  A is packed,
+ *          - PlasmaRight: B is packed.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans: the matrix is not transposed,
+ *          - PlasmaTrans:   the matrix is transposed.
+ *
+ * @param[in] m
+ *          The number of rows of op( A ) and of C.
+ *
+ * @param[in] n
+ *          The number of columns of op( B ) and of C.
+ *
+ * @param[in] k
+ *          The number of columns of op( A ) and of rows of op( B ).
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The matrix A or B, of leading dimension lda.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *
+ * @param[out] P
+ *          The packed matrix, of core_cgemm_pack_size bytes.
+ *
+ ******************************************************************************/
+void core_cgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                     int m, int n, int k,
+                     plasma_complex32_t alpha,
+                     const plasma_complex32_t *A, int lda,
+                     void *P)
+{
+#if defined(CORE_CGEMM_PACK)
+    cblas_cgemm_pack(CblasColMajor,
+                     side == PlasmaLeft ? CblasAMatrix : CblasBMatrix,
+                     (CBLAS_TRANSPOSE)trans,
+                     m, n, k,
+                     alpha, A, lda,
+                     (plasma_complex32_t*)P);
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Computes C = op( A )*op( B ) + beta*C, with op( A ) and op( B ) packed
+ *  by core_cgemm_pack, alpha included.
+ *
+ ******************************************************************************/
+void core_cgemm_packed(int m, int n, int k,
+                       const void *Ap, const void *Bp,
+                       plasma_complex32_t beta,
+                       plasma_complex32_t *C, int ldc)
+{
+#if defined(CORE_CGEMM_PACK)
+    cblas_cgemm_compute(CblasColMajor,
+                        CblasPacked, CblasPacked,
+                        m, n, k,
+                        (const plasma_complex32_t*)Ap, m,
+                        (const plasma_complex32_t*)Bp, k,
+                        beta, C, ldc);
+#endif
+}
+
+/******************************************************************************/
+void core_omp_cgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                         int m, int n, int k,
+                         plasma_complex32_t alpha,
+                         const plasma_complex32_t *A, int lda,
+                         void **P,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    int ak;
+    if (side == PlasmaLeft)
+        ak = trans == PlasmaNoTrans ? k : m;
+    else
+        ak = trans == PlasmaNoTrans ? n : k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(out:P[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemm_pack", P);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            *P = malloc(core_cgemm_pack_size(side, m, n, k));
+            if (*P == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                core_cgemm_pack(side, trans,
+                                m, n, k,
+                                alpha, A, lda,
+                                *P);
+            }
+        }
+        PLASMA_TRACE_STOP("cgemm_pack", 1, P, A);
+    }
+}
+
+/******************************************************************************/
+void core_omp_cgemm_packed(int m, int n, int k,
+                           void **Ap, void **Bp,
+                           plasma_complex32_t beta,
+                           plasma_complex32_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(in:Ap[0:1]) \
+                     depend(in:Bp[0:1]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemm", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgemm_packed(m, n, k,
+                              *Ap, *Bp,
+                              beta, C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*k,
+                           (float)m*k + (float)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgemm", 1, C, Ap, Bp);
+    }
+}
@@ -0,0 +1,176 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemmt.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+// width of the column blocks of C
+#define GEMMT_BLOCK 32
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemmt
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *    \f[ C = \alpha [op( A )\times op( B )] + \beta C, \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *    \f[ op( X ) = X^H, \f]
+ *
+ *  alpha and beta are scalars, op( A ) is an n-by-k matrix, op( B ) is
+ *  a k-by-n matrix and only the uplo triangle of the n-by-n matrix C
+ *  is computed. C is updated by column blocks: the part of a block outside
+ *  its diagonal block is one gemm, the diagonal block is done by columns.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: the upper triangle of C is computed;
+ *          - PlasmaLower: the lower triangle of C is computed.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] n
+ *          The order of the matrix C. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A ) and the number of rows
+ *          of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          An lda-by-ka matrix, where ka is k when transa = PlasmaNoTrans,
+ *          and is n otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          When transa = PlasmaNoTrans, lda >= max(1,n),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] B
+ *          An ldb-by-kb matrix, where kb is n when transb = PlasmaNoTrans,
+ *          and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          An ldc-by-n matrix. On exit, the uplo triangle is overwritten by
+ *          the uplo triangle of ( alpha*op( A )*op( B ) + beta*C ).
+ *          The other triangle is not referenced.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,n).
+ *
+ ******************************************************************************/
+void core_cgemmt(plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t transb,
+                 int n, int k,
+                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                                           const plasma_complex32_t *B, int ldb,
+                 plasma_complex32_t beta,        plasma_complex32_t *C, int ldc)
+{
+    // strides of the rows of op(A) and of the columns of op(B)
+    int ai = transa == PlasmaNoTrans ? 1 : lda;
+    int bj = transb == PlasmaNoTrans ? ldb : 1;
+
+    for (int j = 0; j < n; j += GEMMT_BLOCK) {
+        int jb = imin(GEMMT_BLOCK, n-j);
+
+        // diagonal block by columns
+        for (int jj = j; jj < j+jb; jj++) {
+            int i0 = uplo == PlasmaLower ? jj : j;
+            int mi = uplo == PlasmaLower ? j+jb-jj : jj-j+1;
+            core_cgemm(transa, transb,
+                       mi, 1, k,
+                       alpha, &A[(size_t)ai*i0], lda,
+                              &B[(size_t)bj*jj], ldb,
+                       beta,  &C[i0+(size_t)ldc*jj], ldc);
+        }
+
+        // rest of the column block
+        if (uplo == PlasmaLower) {
+            if (n-j-jb > 0)
+                core_cgemm(transa, transb,
+                           n-j-jb, jb, k,
+                           alpha, &A[(size_t)ai*(j+jb)], lda,
+                                  &B[(size_t)bj*j], ldb,
+                           beta,  &C[j+jb+(size_t)ldc*j], ldc);
+        }
+        else {
+            if (j > 0)
+                core_cgemm(transa, transb,
+                           j, jb, k,
+                           alpha, A, lda,
+                                  &B[(size_t)bj*j], ldb,
+                           beta,  &C[(size_t)ldc*j], ldc);
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_cgemmt(
+    plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgemmt", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgemmt(uplo, transa, transb,
+                        n, k,
+                        alpha, A, lda,
+                               B, ldb,
+                        beta,  C, ldc);
+        PLASMA_TRACE_STOP("cgemmt", 1, C, A, B);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgeqrt.c, normal z -> c, Mon Feb  6 14:06:47 2017
+ * @generated from core_blas/core_zgeqrt.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -14,6 +14,7 @@
 #include "plasma_types.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
+#include "plasma_blas_threads.h"
 
 #include <omp.h>
 
@@ -171,28 +172,42 @@ int core_cgeqrt(int m, int n, int ib,
 void core_omp_cgeqrt(int m, int n, int ib,
                      plasma_complex32_t *A, int lda,
                      plasma_complex32_t *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(inout:A[0:lda*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("cgeqrt", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *tau = ((plasma_complex32_t*)work.spaces[tid]);
 
-            // Call the kernel.
+            // Call the kernel, with the BLAS of the panel on up to
+            // num_blas_threads threads.
+            int blas_threads = 0;
+            if (num_blas_threads > 1)
+                blas_threads = plasma_blas_threads_local(num_blas_threads);
+
             int info = core_cgeqrt(m, n, ib,
                                    A, lda,
                                    T, ldt,
                                    tau,
                                    tau+n);
 
+            if (num_blas_threads > 1)
+                plasma_blas_threads_local(blas_threads);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_cgeqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 2.0*m*n*n - 2.0*n*n*n/3.0,
+                           2.0*m*n + (float)ib*n);
+        PLASMA_TRACE_STOP("cgeqrt", 2, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -0,0 +1,103 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgessm.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gessm
+ *
+ *  Applies the factor L and the row interchanges P of the LU factorization
+ *  of a diagonal tile, computed by core_cgetrf_incpiv, to the m-by-n tile A
+ *  of its tile row,
+ *
+ *    A = L^{-1} * P * A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A and of L. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of L, and of pivots. m >= k >= 0.
+ *
+ * @param[in] ipiv
+ *          The k pivot indices of core_cgetrf_incpiv.
+ *
+ * @param[in] L
+ *          The m-by-k unit lower trapezoidal factor L, below the diagonal.
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,m).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile A.
+ *          On exit, L^{-1} * P * A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ ******************************************************************************/
+void core_cgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const plasma_complex32_t *L, int ldl,
+                       plasma_complex32_t *A, int lda)
+{
+    if (m == 0 || n == 0 || k == 0)
+        return;
+
+    plasma_complex32_t zone  =  1.0;
+    plasma_complex32_t zmone = -1.0;
+
+    LAPACKE_claswp_work(LAPACK_COL_MAJOR, n, A, lda, 1, k, ipiv, 1);
+
+    cblas_ctrsm(CblasColMajor, CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), L, ldl,
+                                   A, lda);
+    if (m > k) {
+        cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m-k, n, k,
+                    CBLAS_SADDR(zmone), &L[k], ldl,
+                                        A,     lda,
+                    CBLAS_SADDR(zone),  &A[k], lda);
+    }
+}
+
+/******************************************************************************/
+void core_omp_cgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const plasma_complex32_t *L, int ldl,
+                           plasma_complex32_t *A, int lda,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:ipiv[0:k]) \
+                     depend(in:L[0:ldl*k]) \
+                     depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgessm", A);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgessm(m, n, k, ipiv, L, ldl, A, lda);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                           (float)k*k*n + 2.0*(m-k)*k*n,
+                           (float)m*k + 2.0*m*n);
+        PLASMA_TRACE_STOP("cgessm", 1, A, L);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgetrf.c, normal z -> c, Mon Feb  6 14:06:47 2017
+ * @generated from core_blas/core_zgetrf.c, normal z -> c, Thu Oct 15 03:15:53 2026
  *
  **/
 
@@ -16,30 +16,26 @@
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
+#include "plasma_workspace.h"
 
 #include <omp.h>
 #include <assert.h>
 #include <math.h>
 
-static int *max_idx;
-static plasma_complex32_t *max_val;
-static volatile int info;
-
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 
 /******************************************************************************/
 int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier)
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier)
 {
-    // Allocate arrays for parallel max search.
-    if (rank == 0) {
-        max_idx = (int*)malloc(size*sizeof(int));
-        max_val = (plasma_complex32_t*)malloc(size*sizeof(plasma_complex32_t));
-        info = 0;
-    }
-    plasma_barrier_wait(barrier);
-    assert(max_idx != NULL);
-    assert(max_val != NULL);
+    // Arrays for parallel max search, shared by the panel threads.
+    assert(work->size >= size);
+    int *max_idx = work->max_idx;
+    float *max_val = (float*)work->max_val;
+
+    if (rank == 0)
+        work->info = 0;
+    plasma_barrier_wait(barrier, rank);
 
     float sfmin = LAPACKE_slamch_work('S');
 
@@ -55,42 +51,39 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
         // panel factorization
         //======================
         for (int j = k; j < k+kb; j++) {
-            // pivot search
-            max_idx[rank] = 0;
-            max_val[rank] = a0[j+j*lda0];
-
-            for (int l = rank; l < A.mt; l += size) {
-                plasma_complex32_t *al = A(l, 0);
-                int ldal = plasma_tile_mmain(A, l);
-                int mval = plasma_tile_mview(A, l);
-
-                if (l == 0) {
-                    for (int i = 1; i < mva0-j; i++)
-                        if (core_scabs1(a0[j+i+j*lda0]) >
-                            core_scabs1(max_val[rank])) {
-
-                            max_val[rank] = a0[j+i+j*lda0];
-                            max_idx[rank] = i;
-                        }
-                }
-                else {
-                    for (int i = 0; i < mval; i++)
-                        if (core_scabs1(al[i+j*ldal]) >
-                            core_scabs1(max_val[rank])) {
-
-                            max_val[rank] = al[i+j*ldal];
+            // pivot search, done with the update of the previous column
+            // after the first column of the block
+            if (j == k) {
+                max_idx[rank] = 0;
+                max_val[rank] = 0.0;
+
+                for (int l = rank; l < A.mt; l += size) {
+                    plasma_complex32_t *al = A(l, 0);
+                    int ldal = plasma_tile_mmain(A, l);
+                    int mval = plasma_tile_mview(A, l);
+
+                    float val;
+                    if (l == 0) {
+                        int i = core_icamax(mva0-j, &a0[j+j*lda0], &val);
+                        max_val[rank] = val;
+                        max_idx[rank] = i;
+                    }
+                    else if (mval > 0) {
+                        int i = core_icamax(mval, &al[j*ldal], &val);
+                        if (val > max_val[rank]) {
+                            max_val[rank] = val;
                             max_idx[rank] = A.mb*l+i-j;
                         }
+                    }
                 }
             }
 
-            plasma_barrier_wait(barrier);
+            plasma_barrier_wait(barrier, rank);
             if (rank == 0)
             {
                 // max reduction
                 for (int i = 1; i < size; i++) {
-                    if (core_scabs1(max_val[i]) >
-                        core_scabs1(max_val[0])) {
+                    if (max_val[i] > max_val[0]) {
                         max_val[0] = max_val[i];
                         max_idx[0] = max_idx[i];
                     }
@@ -101,8 +94,8 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                 ipiv[j] = jp-k+1;
 
                 // singularity check
-                if (info == 0 && max_val[0] == 0.0) {
-                    info = j+1;
+                if (work->info == 0 && max_val[0] == 0.0) {
+                    work->info = j+1;
                 }
                 else {
                     // pivot swap
@@ -116,61 +109,50 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                     }
                 }
             }
-            plasma_barrier_wait(barrier);
+            plasma_barrier_wait(barrier, rank);
 
-            // column scaling and trailing update (all ranks)
+            // column scaling, update of the next column of the block
+            // with the search of its pivot, and trailing update (all ranks)
+            int next = j+1 < k+kb;
+            max_idx[rank] = 0;
+            max_val[rank] = 0.0;
             for (int l = rank; l < A.mt; l += size) {
                 plasma_complex32_t *al = A(l, 0);
                 int ldal = plasma_tile_mmain(A, l);
                 int mval = plasma_tile_mview(A, l);
 
-                if (info == 0) {
-                    // column scaling
-                    if (cabsf(a0[j+j*lda0]) >= sfmin) {
-                        if (l == 0) {
-                            for (int i = 1; i < mva0-j; i++)
-                                a0[j+i+j*lda0] /= a0[j+j*lda0];
-                        }
-                        else {
-                            for (int i = 0; i < mval; i++)
-                                al[i+j*ldal] /= a0[j+j*lda0];
-                        }
-                    }
-                    else {
-                        plasma_complex32_t scal = 1.0/a0[j+j*lda0];
-                        if (l == 0)
-                            cblas_cscal(mva0-j-1, CBLAS_SADDR(scal),
-                                        &a0[j+1+j*lda0], 1);
-                        else
-                            cblas_cscal(mval, CBLAS_SADDR(scal),
-                                        &al[j*ldal], 1);
-                    }
+                // first row and number of rows below the pivot in this tile
+                int i0 = l == 0 ? j+1 : 0;
+                int mi = l == 0 ? mva0-j-1 : mval;
+
+                float val;
+                int i = core_cgetrf_column(
+                    mi, work->info == 0, a0[j+j*lda0], sfmin,
+                    &al[i0+j*ldal],
+                    next ? a0[j+(j+1)*lda0] : 0.0,
+                    next ? &al[i0+(j+1)*ldal] : NULL, &val);
+                if (next && mi > 0 && val > max_val[rank]) {
+                    max_val[rank] = val;
+                    max_idx[rank] = A.mb*l+i0+i-(j+1);
                 }
 
                 // trailing update
                 plasma_complex32_t zmone = -1.0;
-                if (l == 0) {
+                if (k+kb-j-2 > 0) {
                     cblas_cgeru(CblasColMajor,
-                                mva0-j-1, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &a0[j+1+j*lda0], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &a0[j+1+(j+1)*lda0], lda0);
-                }
-                else {
-                    cblas_cgeru(CblasColMajor,
-                                mval, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &al[+j*ldal], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &al[+(j+1)*ldal], ldal);
+                                mi, k+kb-j-2,
+                                CBLAS_SADDR(zmone), &al[i0+j*ldal], 1,
+                                                    &a0[j+(j+2)*lda0], lda0,
+                                                    &al[i0+(j+2)*ldal], ldal);
                 }
             }
-            plasma_barrier_wait(barrier);
+            plasma_barrier_wait(barrier, rank);
         }
 
         //===================================
         // right pivoting and trsm (rank 0)
         //===================================
-        plasma_barrier_wait(barrier);
+        plasma_barrier_wait(barrier, rank);
         if (rank == 0) {
             // pivot adjustment
             for (int i = k+1; i <= imin(A.m, k+kb); i++)
@@ -195,7 +177,7 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                         CBLAS_SADDR(zone), &a0[k+k*lda0], lda0,
                                            &a0[k+(k+kb)*lda0], lda0);
         }
-        plasma_barrier_wait(barrier);
+        plasma_barrier_wait(barrier, rank);
 
         //===================
         // gemm (all ranks)
@@ -228,7 +210,7 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                             CBLAS_SADDR(zone),  &ai[(k+kb)*ldai], ldai);
             }
         }
-        plasma_barrier_wait(barrier);
+        plasma_barrier_wait(barrier, rank);
     }
 
     //============================
@@ -249,15 +231,9 @@ int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
         }
     }
 
-    // Free arrays for parallel max search.
-    if (rank == 0) {
-        free(max_idx);
-        free(max_val);
-    }
-
     // Only rank 0 returns errors.
     if (rank == 0)
-        return info;
+        return work->info;
     else
         return 0;
 }
@@ -0,0 +1,118 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf_column.c, normal z -> c, Thu Oct 15 03:15:53 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ *  Finishes the column j of the LU factorization of a panel in the rows of
+ *  a tile, and searches the pivot of the column j+1 in the same pass:
+ *  scales the column x(0:m-1) of L below the pivot, then, if y is not NULL,
+ *  updates the next column, y(0:m-1) -= x*u, where u is the entry of U
+ *  right of the pivot, and returns the index of the entry of y of largest
+ *  |real| + |imaginary| part, as core_icamax, with its value in max.
+ *
+ *  The column is multiplied by the reciprocal of the pivot, unless the
+ *  reciprocal overflows, |pivot| < sfmin, where it is divided by the pivot,
+ *  as in cgetf2. It is not scaled if scale is 0, after a zero pivot.
+ *
+ *  The rows are taken by blocks, kept in cache between the scaling,
+ *  the update and the search.
+ *
+ ******************************************************************************/
+CORE_BLAS_MULTIVERSION
+int core_cgetrf_column(int m, int scale, plasma_complex32_t pivot,
+                       float sfmin, plasma_complex32_t *x,
+                       plasma_complex32_t u, plasma_complex32_t *y,
+                       float *max)
+{
+    int reciprocal = scale && cabsf(pivot) >= sfmin;
+    plasma_complex32_t rpivot = reciprocal ? 1.0/pivot : 1.0;
+#ifdef COMPLEX
+    float rr = creal(rpivot), ri = cimag(rpivot);
+    float ur = creal(u), ui = cimag(u);
+#endif
+
+    float amax = -1.0;
+    int imax = 0;
+    for (int i0 = 0; i0 < m; i0 += CoreBlasVectorBlock) {
+        int i1 = imin(m, i0+CoreBlasVectorBlock);
+
+        // scaling
+        if (reciprocal) {
+            #pragma omp simd
+            for (int i = i0; i < i1; i++) {
+#ifdef COMPLEX
+                float xr = creal(x[i]), xi = cimag(x[i]);
+                x[i] = (xr*rr - xi*ri) + (xr*ri + xi*rr)*I;
+#else
+                x[i] *= rpivot;
+#endif
+            }
+        }
+        else if (scale) {
+            for (int i = i0; i < i1; i++)
+                x[i] /= pivot;
+        }
+        if (y == NULL)
+            continue;
+
+        // update and pivot search
+        float bmax = -1.0;
+        #pragma omp simd reduction(max:bmax)
+        for (int i = i0; i < i1; i++) {
+#ifdef COMPLEX
+            float xr = creal(x[i]), xi = cimag(x[i]);
+            float yr = creal(y[i]) - (xr*ur - xi*ui);
+            float yi = cimag(y[i]) - (xr*ui + xi*ur);
+            y[i] = yr + yi*I;
+            float a = fabsf(yr) + fabsf(yi);
+#else
+            y[i] -= x[i]*u;
+            float a = fabsf(y[i]);
+#endif
+            bmax = a > bmax ? a : bmax;
+        }
+        if (bmax > amax) {
+            amax = bmax;
+            for (int i = i0; i < i1; i++) {
+#ifdef COMPLEX
+                float a = fabsf(creal(y[i])) + fabsf(cimag(y[i]));
+#else
+                float a = fabsf(y[i]);
+#endif
+                if (a == bmax) {
+                    imax = i;
+                    break;
+                }
+            }
+        }
+    }
+    if (y == NULL || m <= 0) {
+        *max = 0.0;
+        return 0;
+    }
+#ifdef COMPLEX
+    *max = fabsf(creal(y[imax])) + fabsf(cimag(y[imax]));
+#else
+    *max = fabsf(y[imax]);
+#endif
+    return imax;
+}
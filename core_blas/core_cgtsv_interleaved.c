@@ -0,0 +1,157 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgtsv_interleaved.c, normal z -> c, Thu Oct 15 07:31:12 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+#define COMPLEX
+
+// row i of an interleaved array, the elements of the count systems
+#define DL(i) (&dl[(size_t)(i)*stride])
+#define D(i)  (&d[(size_t)(i)*stride])
+#define DU(i) (&du[(size_t)(i)*stride])
+#define B(i, j) (&B[((size_t)(j)*n + (i))*stride])
+
+/******************************************************************************/
+static inline float cabs1(plasma_complex32_t z)
+{
+#ifdef COMPLEX
+    return fabsf(creal(z)) + fabsf(cimag(z));
+#else
+    return fabsf(z);
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gttrf
+ *
+ *  Solves count independent tridiagonal systems A_s X_s = B_s of order n,
+ *  stored interleaved: the element i of the system s is at i*stride + s,
+ *  so that the elimination runs across the systems, one per vector lane.
+ *  Gaussian elimination with partial pivoting, as in LAPACK cgtsv, with
+ *  the row interchanges done by selections instead of branches.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_s. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B_s. nrhs >= 0.
+ *
+ * @param[in] count
+ *          The number of systems. 0 <= count <= stride.
+ *
+ * @param[in] stride
+ *          The distance between consecutive elements of a system.
+ *
+ * @param[in,out] dl
+ *          On entry, the n-1 subdiagonal elements of A_s.
+ *          On exit, the n-2 elements of the second superdiagonal of U_s.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of A_s.
+ *          On exit, the diagonal of U_s.
+ *
+ * @param[in,out] du
+ *          On entry, the n-1 superdiagonal elements of A_s.
+ *          On exit, the first superdiagonal of U_s.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand sides B_s, the element (i, j)
+ *          of the system s at (j*n + i)*stride + s.
+ *          On exit, the solutions X_s.
+ *
+ * @param[out] info
+ *          Array of count statuses. info[s] = 0 on success, or i > 0 if
+ *          U_s(i,i) is exactly zero, and X_s is not valid.
+ *
+ ******************************************************************************/
+void core_cgtsv_interleaved(int n, int nrhs, int count, int stride,
+                            plasma_complex32_t *dl, plasma_complex32_t *d,
+                            plasma_complex32_t *du, plasma_complex32_t *B,
+                            int *info)
+{
+    for (int s = 0; s < count; s++)
+        info[s] = 0;
+
+    // Eliminate the subdiagonal, interchanging the rows i and i+1 where
+    // dl(i) is the larger. The pivot row goes to the row i, with its fill
+    // into the second superdiagonal, kept in dl.
+    for (int i = 0; i < n-1; i++) {
+        plasma_complex32_t *dli = DL(i);
+        plasma_complex32_t *di  = D(i);
+        plasma_complex32_t *dui = DU(i);
+        plasma_complex32_t *di1 = D(i+1);
+        plasma_complex32_t *du1 = i < n-2 ? DU(i+1) : NULL;
+
+        #pragma omp simd
+        for (int s = 0; s < count; s++) {
+            plasma_complex32_t f = du1 != NULL ? du1[s] : 0.0;
+            int swap = cabs1(di[s]) < cabs1(dli[s]);
+            plasma_complex32_t p0 = swap ? dli[s] : di[s];
+            plasma_complex32_t p1 = swap ? di1[s] : dui[s];
+            plasma_complex32_t p2 = swap ? f      : 0.0;
+            plasma_complex32_t o0 = swap ? di[s]  : dli[s];
+            plasma_complex32_t o1 = swap ? dui[s] : di1[s];
+            plasma_complex32_t o2 = swap ? 0.0    : f;
+            if (p0 == 0.0 && info[s] == 0)
+                info[s] = i+1;
+            plasma_complex32_t fact = o0/p0;
+            di[s]  = p0;
+            dui[s] = p1;
+            dli[s] = p2;
+            di1[s] = o1 - fact*p1;
+            if (du1 != NULL)
+                du1[s] = o2 - fact*p2;
+            for (int j = 0; j < nrhs; j++) {
+                plasma_complex32_t *b0 = B(i, j);
+                plasma_complex32_t *b1 = B(i+1, j);
+                plasma_complex32_t bp = swap ? b1[s] : b0[s];
+                plasma_complex32_t bo = swap ? b0[s] : b1[s];
+                b0[s] = bp;
+                b1[s] = bo - fact*bp;
+            }
+        }
+    }
+    if (n > 0) {
+        plasma_complex32_t *dn = D(n-1);
+        for (int s = 0; s < count; s++)
+            if (dn[s] == 0.0 && info[s] == 0)
+                info[s] = n;
+    }
+
+    // Back substitution with U.
+    for (int j = 0; j < nrhs; j++) {
+        for (int i = n-1; i >= 0; i--) {
+            plasma_complex32_t *bi = B(i, j);
+            plasma_complex32_t *b1 = i < n-1 ? B(i+1, j) : NULL;
+            plasma_complex32_t *b2 = i < n-2 ? B(i+2, j) : NULL;
+            plasma_complex32_t *dli = b2 != NULL ? DL(i) : NULL;
+            plasma_complex32_t *di  = D(i);
+            plasma_complex32_t *dui = b1 != NULL ? DU(i) : NULL;
+
+            #pragma omp simd
+            for (int s = 0; s < count; s++) {
+                plasma_complex32_t x = bi[s];
+                if (b1 != NULL)
+                    x -= dui[s]*b1[s];
+                if (b2 != NULL)
+                    x -= dli[s]*b2[s];
+                bi[s] = x/di[s];
+            }
+        }
+    }
+}
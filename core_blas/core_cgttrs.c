@@ -0,0 +1,84 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgttrs.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gttrf
+ *
+ *  Solves A X = B for a tridiagonal matrix A factored by core_cgttrf_spike().
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of B. nrhs >= 0.
+ *
+ * @param[in] dl
+ *          The multipliers of the factorization.
+ *
+ * @param[in] d
+ *          The diagonal of U.
+ *
+ * @param[in] du
+ *          The first superdiagonal of U.
+ *
+ * @param[in] du2
+ *          The second superdiagonal of U.
+ *
+ * @param[in] ipiv
+ *          The pivot indices of the factorization.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, the solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ ******************************************************************************/
+void core_cgttrs(int n, int nrhs,
+                 const plasma_complex32_t *dl, const plasma_complex32_t *d,
+                 const plasma_complex32_t *du, const plasma_complex32_t *du2,
+                 const int *ipiv,
+                 plasma_complex32_t *B, int ldb)
+{
+    LAPACKE_cgttrs_work(LAPACK_COL_MAJOR, 'N', n, nrhs,
+                        dl, d, du, du2, ipiv, B, ldb);
+}
+
+/******************************************************************************/
+// The factors of the partition are tracked through d.
+void core_omp_cgttrs(int n, int nrhs,
+                     const plasma_complex32_t *dl, const plasma_complex32_t *d,
+                     const plasma_complex32_t *du, const plasma_complex32_t *du2,
+                     const int *ipiv,
+                     plasma_complex32_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:d[0:n]) \
+                     depend(inout:B[0:ldb*nrhs]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cgttrs", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cgttrs(n, nrhs, dl, d, du, du2, ipiv, B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 7.0*n*nrhs,
+                           4.0*n + 2.0*n*nrhs);
+        PLASMA_TRACE_STOP("cgttrs", 1, B, d);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zhegst.c, normal z -> c, Thu Oct 15 08:31:46 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_hegst
+ *
+ *  Reduces a Hermitian-definite generalized eigenproblem to standard form.
+ *
+ *  If itype = 1, the problem is A*x = lambda*B*x,
+ *  and A is overwritten by inv(U^H)*A*inv(U) or inv(L)*A*inv(L^H).
+ *
+ *  If itype = 2 or 3, the problem is A*B*x = lambda*x or
+ *  B*A*x = lambda*x, and A is overwritten by U*A*U^H or L^H*A*L.
+ *
+ *  B must have been previously factorized as U^H*U or L*L^H by potrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in] itype
+ *          - 1: compute inv(U^H)*A*inv(U) or inv(L)*A*inv(L^H);
+ *          - 2 or 3: compute U*A*U^H or L^H*A*L.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored and B is factored
+ *                         as U^H*U;
+ *          - PlasmaLower: Lower triangle of A is stored and B is factored
+ *                         as L*L^H.
+ *
+ * @param[in] n
+ *          The order of the matrices A and B. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the Hermitian matrix A. On exit, the transformed
+ *          matrix, stored in the same format as A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] B
+ *          The triangular factor from the Cholesky factorization of B,
+ *          as returned by potrf.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @retval PlasmaSuccess on successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int core_chegst(int itype, plasma_enum_t uplo,
+                int n,
+                      plasma_complex32_t *A, int lda,
+                const plasma_complex32_t *B, int ldb)
+{
+    return LAPACKE_chegst_work(LAPACK_COL_MAJOR,
+                               itype, lapack_const(uplo),
+                               n, A, lda, B, ldb);
+}
+
+/******************************************************************************/
+void core_omp_chegst(int itype, plasma_enum_t uplo,
+                     int n,
+                           plasma_complex32_t *A, int lda,
+                     const plasma_complex32_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(in:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("chegst", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_chegst(itype, uplo,
+                                   n,
+                                   A, lda,
+                                   B, ldb);
+            if (info != PlasmaSuccess) {
+                coreblas_error("core_chegst() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+        PLASMA_TRACE_STOP("chegst", 1, A, B);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zher2k.c, normal z -> c, Mon Feb  6 14:06:48 2017
+ * @generated from core_blas/core_zher2k.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -122,13 +122,16 @@ void core_omp_cher2k(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("cher2k", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_cher2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        PLASMA_TRACE_STOP("cher2k", 1, C, A, B);
     }
 }
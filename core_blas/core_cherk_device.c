@@ -0,0 +1,97 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zherk_device.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_device.h"
+#include "plasma_types.h"
+
+#if defined(PLASMA_WITH_CUDA)
+
+/***************************************************************************//**
+ *
+ * @ingroup core_herk
+ *
+ *  Performs core_cherk with cuBLAS, on the stream of the calling thread.
+ *  A is read through the device tile cache, and C is copied to the device
+ *  and back, so that C is current on the host on return.
+ *  Falls back to core_cherk if the device memory runs out.
+ *
+ * @see core_cherk
+ * @see plasma_device_tile
+ *
+ ******************************************************************************/
+void core_cherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       float alpha, const plasma_complex32_t *A, int lda,
+                       float beta,        plasma_complex32_t *C, int ldc)
+{
+    size_t eltsize = sizeof(plasma_complex32_t);
+    int am = trans == PlasmaNoTrans ? n : k;
+    int an = trans == PlasmaNoTrans ? k : n;
+
+    plasma_device_thread_t *thread = plasma_device_thread();
+    if (thread != NULL && n > 0 && k > 0) {
+        const void *dA = plasma_device_tile(thread, A, lda, am, an, eltsize);
+        void *dC = plasma_device_work(thread, (size_t)n*n*eltsize);
+        if (dA != NULL && dC != NULL) {
+            cublasSetMatrixAsync(n, n, eltsize, C, ldc, dC, n,
+                                 thread->stream);
+            cublasStatus_t status = cublasCherk(
+                thread->handle,
+                plasma_device_uplo(uplo), plasma_device_trans(trans),
+                n, k,
+                &alpha, dA, am,
+                &beta,  dC, n);
+            cublasGetMatrixAsync(n, n, eltsize, dC, n, C, ldc,
+                                 thread->stream);
+            cudaStreamSynchronize(thread->stream);
+            if (status == CUBLAS_STATUS_SUCCESS)
+                return;
+        }
+    }
+    core_cherk(uplo, trans,
+               n, k,
+               alpha, A, lda,
+               beta,  C, ldc);
+}
+
+/******************************************************************************/
+void core_omp_cherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           float alpha, const plasma_complex32_t *A, int lda,
+                           float beta,        plasma_complex32_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cherk_device", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_cherk_device(uplo, trans,
+                              n, k,
+                              alpha, A, lda,
+                              beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, (float)k*n*(n+1),
+                           (float)n*k + (float)n*(n+1));
+        PLASMA_TRACE_STOP("cherk_device", 1, C, A);
+    }
+}
+
+#endif // PLASMA_WITH_CUDA
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zhessq.c, normal z -> c, Mon Feb  6 14:06:48 2017
+ * @generated from core_blas/core_zhessq.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -60,12 +60,15 @@ void core_omp_chessq(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("chessq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_chessq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("chessq", 2, scale, sumsq, A);
     }
 }
@@ -0,0 +1,180 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlacpy_trans.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Copies the transpose or the conjugate transpose of a two-dimensional
+ *  matrix A to another matrix B, B = op( A ).
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaTrans:     op( A ) = A^T,
+ *          - PlasmaConjTrans: op( A ) = A^H.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix B, and columns of A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix B, and rows of A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The n-by-m matrix to copy.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          lda >= max(1,n).
+ *
+ * @param[out] B
+ *          On exit, the m-by-n matrix op( A ).
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          ldb >= max(1,m).
+ *
+ ******************************************************************************/
+void core_clacpy_trans(plasma_enum_t trans,
+                       int m, int n,
+                       const plasma_complex32_t *A, int lda,
+                             plasma_complex32_t *B, int ldb)
+{
+    // Copy by 32-by-32 blocks, whose rows and columns stay in the cache,
+    // so that both A and B are accessed by whole cache lines.
+    const int bs = 32;
+    for (int jj = 0; jj < n; jj += bs) {
+        int jb = imin(bs, n-jj);
+        for (int ii = 0; ii < m; ii += bs) {
+            int ib = imin(bs, m-ii);
+            if (trans == PlasmaConjTrans) {
+                for (int j = jj; j < jj+jb; j++)
+                    for (int i = ii; i < ii+ib; i++)
+                        B[ldb*j+i] = conjf(A[lda*i+j]);
+            }
+            else {
+                for (int j = jj; j < jj+jb; j++)
+                    for (int i = ii; i < ii+ib; i++)
+                        B[ldb*j+i] = A[lda*i+j];
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_clacpy_trans(plasma_enum_t trans,
+                           int m, int n,
+                           const plasma_complex32_t *A, int lda,
+                                 plasma_complex32_t *B, int ldb,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*m]) \
+                     depend(out:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("clacpy_trans", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_clacpy_trans(trans,
+                              m, n,
+                              A, lda,
+                              B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 0.0, 2.0*m*n);
+        PLASMA_TRACE_STOP("clacpy_trans", 1, B, A);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Completes the n-by-n Hermitian (trans = PlasmaConjTrans) or symmetric
+ *  (trans = PlasmaTrans) matrix A, stored in its uplo triangle, by copying
+ *  op( A ) of that triangle into the other one. For a Hermitian matrix,
+ *  the imaginary parts of the diagonal, assumed to be zero, are set to zero,
+ *  so that A can be used as a general matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A is stored in its upper triangle,
+ *          - PlasmaLower: A is stored in its lower triangle.
+ *
+ * @param[in] trans
+ *          - PlasmaTrans:     A is symmetric,
+ *          - PlasmaConjTrans: A is Hermitian.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the uplo triangle of A.
+ *          On exit, the full matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          lda >= max(1,n).
+ *
+ ******************************************************************************/
+void core_clacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, plasma_complex32_t *A, int lda)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = j+1; i < n; i++) {
+            if (uplo == PlasmaLower)
+                A[lda*i+j] = A[lda*j+i];
+            else
+                A[lda*j+i] = A[lda*i+j];
+#ifdef COMPLEX
+            if (trans == PlasmaConjTrans) {
+                if (uplo == PlasmaLower)
+                    A[lda*i+j] = conjf(A[lda*i+j]);
+                else
+                    A[lda*j+i] = conjf(A[lda*j+i]);
+            }
+#endif
+        }
+#ifdef COMPLEX
+        if (trans == PlasmaConjTrans)
+            A[lda*j+j] = creal(A[lda*j+j]);
+#endif
+    }
+}
+
+/******************************************************************************/
+void core_omp_clacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                         int n, plasma_complex32_t *A, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("clacpy_sym", A);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_clacpy_sym(uplo, trans, n, A, lda);
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 0.0, 1.0*n*n);
+        PLASMA_TRACE_STOP("clacpy_sym", 1, A);
+    }
+}
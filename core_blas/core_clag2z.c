@@ -61,7 +61,9 @@ void core_omp_clag2z(int m, int n,
     #pragma omp task depend(in:As[0:ldas*n]) \
                      depend(out:A[0:lda*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("clag2z", A);
+        if (PLASMA_TRACE_RUN(sequence))
             core_clag2z(m, n, As, ldas, A, lda);
+        PLASMA_TRACE_STOP("clag2z", 1, A, As);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlange.c, normal z -> c, Mon Feb  6 14:06:49 2017
+ * @generated from core_blas/core_zlange.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -45,7 +45,7 @@
  *          The leading dimension of the array A. lda >= max(1,m).
  *
  * @param[in] work
- *          The auxiliary work array.
+ *          Workspace of size m for PlasmaInfNorm, not referenced otherwise.
  *
  * @param[out] value
  *          The specified norm of the given matrix A
@@ -55,9 +55,55 @@ void core_clange(plasma_enum_t norm, int m, int n,
                  const plasma_complex32_t *A, int lda,
                  float *work, float *value)
 {
-    *value = LAPACKE_clange_work(LAPACK_COL_MAJOR,
-                                 lapack_const(norm),
-                                 m, n, A, lda, work);
+    // One pass over A with loops the compiler can vectorize.
+    // A NaN in A is propagated to the value, as LAPACK does.
+    float max = 0.0;
+    int found_nan = 0;
+    switch (norm) {
+    case PlasmaMaxNorm:
+        for (int j = 0; j < n; j++) {
+            #pragma omp simd reduction(max:max) reduction(|:found_nan)
+            for (int i = 0; i < m; i++) {
+                float a = cabsf(A[lda*j+i]);
+                max = a > max ? a : max;
+                found_nan |= isnan(a);
+            }
+        }
+        break;
+    case PlasmaOneNorm:
+        for (int j = 0; j < n; j++) {
+            float sum = 0.0;
+            #pragma omp simd reduction(+:sum)
+            for (int i = 0; i < m; i++)
+                sum += cabsf(A[lda*j+i]);
+
+            max = sum > max ? sum : max;
+            found_nan |= isnan(sum);
+        }
+        break;
+    case PlasmaInfNorm:
+        for (int i = 0; i < m; i++)
+            work[i] = 0.0;
+
+        for (int j = 0; j < n; j++) {
+            #pragma omp simd
+            for (int i = 0; i < m; i++)
+                work[i] += cabsf(A[lda*j+i]);
+        }
+        for (int i = 0; i < m; i++) {
+            max = work[i] > max ? work[i] : max;
+            found_nan |= isnan(work[i]);
+        }
+        break;
+    case PlasmaFrobeniusNorm: {
+        float scale = 0.0;
+        float sumsq = 1.0;
+        core_cgessq(m, n, A, lda, &scale, &sumsq);
+        max = scale*sqrtf(sumsq);
+        break;
+    }
+    }
+    *value = found_nan ? NAN : max;
 }
 
 /******************************************************************************/
@@ -67,10 +113,13 @@ void core_omp_clange(int norm, int m, int n,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("clange", value);
+        if (PLASMA_TRACE_RUN(sequence))
             core_clange(norm, m, n, A, lda, work, value);
+        PLASMA_TRACE_STOP("clange", 1, value, A);
     }
 }
 
@@ -83,32 +132,40 @@ void core_omp_clange_aux(int norm, int m, int n,
     switch (norm) {
     case PlasmaOneNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:n])
+                         depend(out:value[0:n]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("clange_aux", value);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 for (int j = 0; j < n; j++) {
-                    value[j] = cabsf(A[lda*j]);
-                    for (int i = 1; i < m; i++) {
-                        value[j] += cabsf(A[lda*j+i]);
-                    }
+                    float sum = 0.0;
+                    #pragma omp simd reduction(+:sum)
+                    for (int i = 0; i < m; i++)
+                        sum += cabsf(A[lda*j+i]);
+
+                    value[j] = sum;
                 }
             }
+            PLASMA_TRACE_STOP("clange_aux", 1, value, A);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:m])
+                         depend(out:value[0:m]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("clange_aux", value);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
 
                 for (int j = 0; j < n; j++) {
-                    for (int i = 0; i < m; i++) {
+                    #pragma omp simd
+                    for (int i = 0; i < m; i++)
                         value[i] += cabsf(A[lda*j+i]);
-                    }
                 }
             }
+            PLASMA_TRACE_STOP("clange_aux", 1, value, A);
         }
         break;
     }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlantr.c, normal z -> c, Mon Feb  6 14:06:50 2017
+ * @generated from core_blas/core_zlantr.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -44,10 +44,13 @@ void core_omp_clantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("clantr", value);
+        if (PLASMA_TRACE_RUN(sequence))
             core_clantr(norm, uplo, diag, m, n, A, lda, work, value);
+        PLASMA_TRACE_STOP("clantr", 1, value, A);
     }
 }
 
@@ -62,9 +65,11 @@ void core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
     switch (norm) {
     case PlasmaOneNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:n])
+                         depend(out:value[0:n]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("clantr_aux", value);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
                         for (int j = 0; j < n; j++) {
@@ -115,13 +120,16 @@ void core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP("clantr_aux", 1, value, A);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:m])
+                         depend(out:value[0:m]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("clantr_aux", value);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
                         for (int i = 0; i < m; i++)
@@ -181,6 +189,7 @@ void core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP("clantr_aux", 1, value, A);
         }
         break;
     }
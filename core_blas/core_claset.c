@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlaset.c, normal z -> c, Mon Feb  6 14:06:50 2017
+ * @generated from core_blas/core_zlaset.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -77,7 +77,11 @@ void core_omp_claset(plasma_enum_t uplo,
                      plasma_complex32_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    core_claset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        PLASMA_TRACE_START("claset", A);
+        core_claset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        PLASMA_TRACE_STOP("claset", 1, A);
+    }
 }
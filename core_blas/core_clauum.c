@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlauum.c, normal z -> c, Mon Feb  6 14:06:51 2017
+ * @generated from core_blas/core_zlauum.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -68,14 +68,18 @@ void core_omp_clauum(plasma_enum_t uplo,
                      plasma_complex32_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("clauum", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_clauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
                 coreblas_error("core_clauum() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("clauum", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
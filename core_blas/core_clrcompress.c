@@ -0,0 +1,120 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlrcompress.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Compresses the m-by-n tile A in place into the product
+ *
+ *    \f[ A = U \times V^H, \f]
+ *
+ *  of its truncated singular value decomposition, U = U_k S_k and V = V_k,
+ *  where k is the number of singular values above tol. U is stored in the
+ *  first k columns of A, with its leading dimension, and V after it, with
+ *  the leading dimension n. A stays dense when the factors do not fit in
+ *  its storage, k*(lda+n) > lda*n.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] tol
+ *          The singular values not above tol are dropped. tol >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n dense tile A.
+ *          On exit, the factors U and V, or A unchanged if it stays dense.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] rank
+ *          The rank k of the factors, or -1 if A stays dense.
+ *
+ * @param work
+ *          Workspace of size m*n + min(m,n)*(m+n) + 2*min(m,n).
+ *
+ ******************************************************************************/
+void core_clrcompress(int m, int n, float tol,
+                      plasma_complex32_t *A, int lda, int *rank,
+                      plasma_complex32_t *work)
+{
+    int mn = imin(m, n);
+    if (mn == 0) {
+        *rank = 0;
+        return;
+    }
+
+    plasma_complex32_t *W  = work;
+    plasma_complex32_t *U  = &W[(size_t)m*n];
+    plasma_complex32_t *VT = &U[(size_t)m*mn];
+    float *s = (float*)&VT[(size_t)mn*n];
+    float *superb = &s[mn];
+
+    LAPACKE_clacpy_work(LAPACK_COL_MAJOR, 'G', m, n, A, lda, W, m);
+    int info = LAPACKE_cgesvd(LAPACK_COL_MAJOR, 'S', 'S', m, n,
+                              W, m, s, U, m, VT, mn, superb);
+    if (info != 0) {
+        *rank = -1;
+        return;
+    }
+
+    int k = 0;
+    while (k < mn && s[k] > tol)
+        k++;
+    if ((size_t)k*(lda+n) > (size_t)lda*n) {
+        *rank = -1;
+        return;
+    }
+
+    // U = U_k S_k, V = V_k
+    plasma_complex32_t *V = &A[(size_t)lda*k];
+    for (int j = 0; j < k; j++) {
+        for (int i = 0; i < m; i++)
+            A[lda*j+i] = U[m*j+i]*s[j];
+        for (int i = 0; i < n; i++)
+            V[n*j+i] = conjf(VT[mn*i+j]);
+    }
+    *rank = k;
+}
+
+/******************************************************************************/
+void core_omp_clrcompress(int m, int n, float tol,
+                          plasma_complex32_t *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("clrcompress", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
+            core_clrcompress(m, n, tol, A, lda, rank, W);
+        }
+        PLASMA_TRACE_STOP("clrcompress", 1, A);
+    }
+}
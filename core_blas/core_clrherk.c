@@ -0,0 +1,127 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlrherk.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Performs the update of a diagonal tile of the tile low-rank Cholesky
+ *  factorization,
+ *
+ *    \f[ C = C - A \times A^H, \f]
+ *
+ *  in the lower triangle of the dense n-by-n tile C, where A is an n-by-k
+ *  tile, dense or compressed as U*V^H by core_clrcompress. For a compressed
+ *  tile, the product is U*(V^H*V)*U^H, of the cost of its rank.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the tile C, and number of rows of A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tile A. k >= 0.
+ *
+ * @param[in] A
+ *          The n-by-k tile A, dense or compressed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] rank
+ *          The rank of the factors of A, or -1 if A is dense.
+ *
+ * @param[in,out] C
+ *          The n-by-n tile C, of which the lower triangle is updated.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,n).
+ *
+ * @param work
+ *          Workspace of size n*n + k*k + n*k.
+ *
+ ******************************************************************************/
+void core_clrherk(int n, int k,
+                  const plasma_complex32_t *A, int lda, const int *rank,
+                        plasma_complex32_t *C, int ldc,
+                  plasma_complex32_t *work)
+{
+    int r = *rank;
+    if (r < 0) {
+        core_cherk(PlasmaLower, PlasmaNoTrans,
+                   n, k,
+                   -1.0, A, lda,
+                    1.0, C, ldc);
+        return;
+    }
+    if (n == 0 || r == 0)
+        return;
+
+    plasma_complex32_t zzero = 0.0;
+    plasma_complex32_t zone  = 1.0;
+
+    const plasma_complex32_t *U = A;
+    const plasma_complex32_t *V = &A[(size_t)lda*r];
+    plasma_complex32_t *P = work;
+    plasma_complex32_t *G = &P[(size_t)n*n];
+    plasma_complex32_t *T = &G[(size_t)r*r];
+
+    // G = V^H*V, T = U*G, P = T*U^H
+    cblas_cgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                r, r, k,
+                CBLAS_SADDR(zone),  V, k,
+                                    V, k,
+                CBLAS_SADDR(zzero), G, r);
+    cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                n, r, r,
+                CBLAS_SADDR(zone),  U, lda,
+                                    G, r,
+                CBLAS_SADDR(zzero), T, n);
+    cblas_cgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                n, n, r,
+                CBLAS_SADDR(zone),  T, n,
+                                    U, lda,
+                CBLAS_SADDR(zzero), P, n);
+
+    for (int j = 0; j < n; j++)
+        for (int i = j; i < n; i++)
+            C[ldc*j+i] -= P[n*j+i];
+}
+
+/******************************************************************************/
+void core_omp_clrherk(int n, int k,
+                      const plasma_complex32_t *A, int lda, const int *rank,
+                            plasma_complex32_t *C, int ldc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*k]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("clrherk", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
+            core_clrherk(n, k, A, lda, rank, C, ldc, W);
+        }
+        PLASMA_TRACE_STOP("clrherk", 1, C, A);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zpamm.c, normal z -> c, Mon Feb  6 14:06:51 2017
+ * @generated from core_blas/core_zpamm.c, normal z -> c, Thu Oct 15 05:34:47 2026
  *
  **/
 
@@ -320,7 +320,6 @@ static inline int core_cpamm_w(
     // W = A1 + op(V) * A2  or  W = A1 + A2 * op(V)
 
     plasma_complex32_t zone  = 1.0;
-    plasma_complex32_t zzero = 0.0;
 
     //=============
     // PlasmaLeft
@@ -358,21 +357,30 @@ static inline int core_cpamm_w(
                 }
             }
 
-            // W_2 = V_3^H * A2: (ge, bottom M-L rows of V^H)
+            // W_2 = A1_2 + V_3^H * A2: (ge, bottom M-L rows of V^H),
+            // with A1_2 added by the gemm
             if (m > l) {
+                LAPACKE_clacpy_work(LAPACK_COL_MAJOR,
+                                    lapack_const(PlasmaGeneral),
+                                    m-l, n,
+                                    &A1[l], lda1,
+                                    &W[l],  ldw);
+
                 cblas_cgemm(CblasColMajor,
                             (CBLAS_TRANSPOSE)trans, CblasNoTrans,
                             (m-l), n, k,
-                            CBLAS_SADDR(zone),  &V[vi3], ldv,
-                                                 A2,     lda2,
-                            CBLAS_SADDR(zzero), &W[l],   ldw);
+                            CBLAS_SADDR(zone), &V[vi3], ldv,
+                                                A2,     lda2,
+                            CBLAS_SADDR(zone), &W[l],   ldw);
             }
 
-            // W = A1 + W
-            for (int j = 0; j < n; j++) {
-                cblas_caxpy(m, CBLAS_SADDR(zone),
-                            &A1[lda1*j], 1,
-                            &W[ldw*j], 1);
+            // W_1 = A1_1 + W_1
+            if (l > 0) {
+                for (int j = 0; j < n; j++) {
+                    cblas_caxpy(l, CBLAS_SADDR(zone),
+                                &A1[lda1*j], 1,
+                                &W[ldw*j], 1);
+                }
             }
         }
         else {
@@ -420,18 +428,24 @@ static inline int core_cpamm_w(
                 }
             }
 
-            // W = W + A2 * V_3
+            // W_2 = A1_2 + A2 * V_3, with A1_2 added by the gemm
             if (n > l) {
+                LAPACKE_clacpy_work(LAPACK_COL_MAJOR,
+                                    lapack_const(PlasmaGeneral),
+                                    m, n-l,
+                                    &A1[lda1*l], lda1,
+                                    &W[ldw*l],   ldw);
+
                 cblas_cgemm(CblasColMajor,
                             CblasNoTrans, (CBLAS_TRANSPOSE)trans,
                             m, n-l, k,
-                            CBLAS_SADDR(zone),   A2,       lda2,
-                                                &V[vi3],   ldv,
-                            CBLAS_SADDR(zzero), &W[ldw*l], ldw);
+                            CBLAS_SADDR(zone),  A2,       lda2,
+                                               &V[vi3],   ldv,
+                            CBLAS_SADDR(zone), &W[ldw*l], ldw);
             }
 
-            // W = A1 + W
-            for (int j = 0; j < n; j++) {
+            // W_1 = A1_1 + W_1
+            for (int j = 0; j < l; j++) {
                 cblas_caxpy(m, CBLAS_SADDR(zone),
                             &A1[lda1*j], 1,
                             &W[ldw*j],   1);
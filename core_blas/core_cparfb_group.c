@@ -0,0 +1,592 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zparfb_group.c, normal z -> c, Thu Oct 15 08:17:14 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_larft_group
+ *
+ *  Merges the T factors of the reflectors of count tiles, as computed by
+ *  core_ctsqrt (columnwise) or core_ctslqt (rowwise) against the same tile
+ *  of k reflectors, into the T factor of one block reflector of count*k
+ *  reflectors, in the order of the tiles,
+ *
+ *    H(1) H(2) . . . H(count) = I - V T V^H,
+ *
+ *  where V stacks the reflectors of the tiles. The top parts of the
+ *  reflectors of all the tiles are the same k rows of the identity, so
+ *  that V(i)^H V(j) = I for two different tiles, and T is merged from the
+ *  ib-by-ib blocks of the T factors of the tiles as
+ *
+ *    T(1:j, j+1:j+ib) = -T(1:j, 1:j) * V(:, 1:j)^H V(:, j+1:j+ib) * Tj,
+ *
+ *  with gemms, without the division by the scalar factors of clarft.
+ *
+ *******************************************************************************
+ *
+ * @param[in] storev
+ *         Indicates how the reflectors are stored:
+ *         - PlasmaColumnwise: V(i) is l(i)-by-k, from QR;
+ *         - PlasmaRowwise:    V(i) is k-by-l(i), from LQ.
+ *
+ * @param[in] count
+ *         The number of tiles merged. count >= 0.
+ *
+ * @param[in] k
+ *         The number of reflectors of each tile. k >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size of the T factors of the tiles. ib >= 0.
+ *
+ * @param[in] l
+ *         Array of count lengths of the reflectors of the tiles, without
+ *         their top parts.
+ *
+ * @param[in] V
+ *         Array of count tiles of reflectors.
+ *
+ * @param[in] ldv
+ *         Array of count leading dimensions of the tiles of V.
+ *
+ * @param[in] Tb
+ *         Array of count ib-by-k T factors of the tiles.
+ *
+ * @param[in] ldtb
+ *         The leading dimension of the arrays Tb. ldtb >= max(1,ib).
+ *
+ * @param[out] T
+ *         The count*k-by-count*k upper triangular merged T factor.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= max(1,count*k).
+ *
+ ******************************************************************************/
+int core_clarft_group(plasma_enum_t storev, int count, int k, int ib,
+                      const int *l,
+                      plasma_complex32_t * const *V, const int *ldv,
+                      plasma_complex32_t * const *Tb, int ldtb,
+                      plasma_complex32_t *T, int ldt)
+{
+    // Check input arguments.
+    if (storev != PlasmaColumnwise && storev != PlasmaRowwise) {
+        coreblas_error("illegal value of storev");
+        return -1;
+    }
+    if (count < 0) {
+        coreblas_error("illegal value of count");
+        return -2;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -3;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -4;
+    }
+    if (l == NULL) {
+        coreblas_error("NULL l");
+        return -5;
+    }
+    if (V == NULL) {
+        coreblas_error("NULL V");
+        return -6;
+    }
+    if (ldv == NULL) {
+        coreblas_error("NULL ldv");
+        return -7;
+    }
+    if (Tb == NULL) {
+        coreblas_error("NULL Tb");
+        return -8;
+    }
+    if (ldtb < imax(1, ib)) {
+        coreblas_error("illegal value of ldtb");
+        return -9;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -10;
+    }
+    if (ldt < imax(1, count*k)) {
+        coreblas_error("illegal value of ldt");
+        return -11;
+    }
+
+    // quick return
+    if (count == 0 || k == 0 || ib == 0)
+        return PlasmaSuccess;
+
+    plasma_complex32_t zzero = 0.0;
+    plasma_complex32_t zone  = 1.0;
+    plasma_complex32_t zmone = -1.0;
+
+    // V^H V: the identity between two tiles, the products of the
+    // reflectors of a tile in the upper triangle of its diagonal block.
+    int kt = count*k;
+    LAPACKE_claset_work(LAPACK_COL_MAJOR, 'F', kt, kt, zzero, zzero, T, ldt);
+    for (int i = 0; i < count; i++) {
+        for (int j = i+1; j < count; j++)
+            for (int r = 0; r < k; r++)
+                T[i*k+r + (size_t)ldt*(j*k+r)] = zone;
+
+        cblas_cherk(CblasColMajor, CblasUpper,
+                    storev == PlasmaColumnwise ? CblasConjTrans
+                                               : CblasNoTrans,
+                    k, l[i],
+                    1.0, V[i], ldv[i],
+                    0.0, &T[i*k + (size_t)ldt*i*k], ldt);
+    }
+
+    // T(1:j, j+1:j+ib) = -T(1:j, 1:j) * (V^H V)(1:j, j+1:j+ib) * Tj,
+    // by blocks of columns of ib reflectors.
+    for (int i = 0; i < count; i++) {
+        for (int j0 = 0; j0 < k; j0 += ib) {
+            int kb = imin(ib, k-j0);
+            int j = i*k+j0;
+            const plasma_complex32_t *Tj = &Tb[i][(size_t)ldtb*j0];
+            if (j > 0) {
+                cblas_ctrmm(CblasColMajor,
+                            CblasLeft, CblasUpper,
+                            CblasNoTrans, CblasNonUnit,
+                            j, kb,
+                            CBLAS_SADDR(zmone), T, ldt,
+                                                &T[(size_t)ldt*j], ldt);
+                cblas_ctrmm(CblasColMajor,
+                            CblasRight, CblasUpper,
+                            CblasNoTrans, CblasNonUnit,
+                            j, kb,
+                            CBLAS_SADDR(zone), Tj, ldtb,
+                                               &T[(size_t)ldt*j], ldt);
+            }
+            LAPACKE_clacpy_work(LAPACK_COL_MAJOR, 'U', kb, kb,
+                                Tj, ldtb,
+                                &T[j + (size_t)ldt*j], ldt);
+            for (int c = 0; c < kb; c++)
+                for (int r = c+1; r < kb; r++)
+                    T[j+r + (size_t)ldt*(j+c)] = zzero;
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_parfb_group
+ *
+ *  Applies the block reflector H or H^H merged by core_clarft_group from
+ *  the reflectors of count tiles to the matrix formed by the tile A1 and
+ *  the count tiles A2(i), coupled to A1 as the tiles of the reflectors,
+ *
+ *    side = PlasmaLeft:   H * | A1    |     side = PlasmaRight:
+ *                             | A2(1) |
+ *                             |  ...  |     | A1 A2(1) ... | * H
+ *
+ *  W(i) = A1 + op(V(i)) A2(i) is formed for each tile, multiplied by
+ *  op(T) as one block, then A1 -= sum W(i) and A2(i) -= op(V(i)) W(i),
+ *  with gemms of k reflectors and a trmm of count*k, in place of count
+ *  calls to core_cparfb.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - PlasmaLeft  : apply H or H^H from the Left;
+ *         - PlasmaRight : apply H or H^H from the Right.
+ *
+ * @param[in] trans
+ *         - PlasmaNoTrans    : apply H, T;
+ *         - Plasma_ConjTrans : apply H^H, T^H.
+ *
+ * @param[in] storev
+ *         Indicates how the reflectors are stored:
+ *         - PlasmaColumnwise: V(i) is l(i)-by-k, from QR;
+ *         - PlasmaRowwise:    V(i) is k-by-l(i), from LQ.
+ *
+ * @param[in] count
+ *         The number of tiles of A2 and V. count >= 0.
+ *
+ * @param[in] m1
+ *         The number of rows of the tile A1. m1 >= 0.
+ *
+ * @param[in] n1
+ *         The number of columns of the tile A1. n1 >= 0.
+ *
+ * @param[in] l
+ *         Array of count numbers of rows (left) or columns (right) of the
+ *         tiles A2, the lengths of the reflectors without their top parts.
+ *
+ * @param[in] k
+ *         The number of reflectors of each tile.
+ *
+ * @param[in,out] A1
+ *         On entry, the m1-by-n1 tile A1.
+ *         On exit, A1 is overwritten by the application of H.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,m1).
+ *
+ * @param[in,out] A2
+ *         Array of count tiles, l(i)-by-n1 (left) or m1-by-l(i) (right),
+ *         overwritten by the application of H.
+ *
+ * @param[in] lda2
+ *         Array of count leading dimensions of the tiles A2.
+ *
+ * @param[in] V
+ *         Array of count tiles of reflectors.
+ *
+ * @param[in] ldv
+ *         Array of count leading dimensions of the tiles of V.
+ *
+ * @param[in] T
+ *         The count*k-by-count*k merged T factor.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= max(1,count*k).
+ *
+ * @param work
+ *         Auxiliary workspace array of length count*k-by-n1 (left)
+ *         or m1-by-count*k (right).
+ *
+ * @param[in] ldwork
+ *         The leading dimension of the array work:
+ *         - side = PlasmaLeft:  ldwork >= max(1,count*k);
+ *         - side = PlasmaRight: ldwork >= max(1,m1).
+ *
+ ******************************************************************************/
+int core_cparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                      plasma_enum_t storev,
+                      int count, int m1, int n1, const int *l, int k,
+                            plasma_complex32_t *A1, int lda1,
+                      plasma_complex32_t * const *A2, const int *lda2,
+                      plasma_complex32_t * const *V, const int *ldv,
+                      const plasma_complex32_t *T, int ldt,
+                            plasma_complex32_t *work, int ldwork)
+{
+    // Check input arguments.
+    if (side != PlasmaLeft && side != PlasmaRight) {
+        coreblas_error("illegal value of side");
+        return -1;
+    }
+    if (trans != PlasmaNoTrans && trans != Plasma_ConjTrans) {
+        coreblas_error("illegal value of trans");
+        return -2;
+    }
+    if (storev != PlasmaColumnwise && storev != PlasmaRowwise) {
+        coreblas_error("illegal value of storev");
+        return -3;
+    }
+    if (count < 0) {
+        coreblas_error("illegal value of count");
+        return -4;
+    }
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -5;
+    }
+    if (n1 < 0) {
+        coreblas_error("illegal value of n1");
+        return -6;
+    }
+    if (l == NULL) {
+        coreblas_error("NULL l");
+        return -7;
+    }
+    if (k < 0 ||
+        (side == PlasmaLeft  && k > m1) ||
+        (side == PlasmaRight && k > n1)) {
+        coreblas_error("illegal value of k");
+        return -8;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (A2 == NULL || lda2 == NULL) {
+        coreblas_error("NULL A2");
+        return -11;
+    }
+    if (V == NULL || ldv == NULL) {
+        coreblas_error("NULL V");
+        return -13;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -15;
+    }
+    if (ldt < imax(1, count*k)) {
+        coreblas_error("illegal value of ldt");
+        return -16;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -17;
+    }
+    if (ldwork < imax(1, side == PlasmaLeft ? count*k : m1)) {
+        coreblas_error("illegal value of ldwork");
+        return -18;
+    }
+
+    // quick return
+    if (count == 0 || m1 == 0 || n1 == 0 || k == 0)
+        return PlasmaSuccess;
+
+    plasma_complex32_t zone  =  1.0;
+    plasma_complex32_t zmone = -1.0;
+
+    // op(V) in W = A1 + op(V) A2 and in A2 -= op(V) W, left and right.
+    CBLAS_TRANSPOSE form, update;
+    if ((storev == PlasmaColumnwise) == (side == PlasmaLeft)) {
+        form = CblasConjTrans;
+        update = CblasNoTrans;
+    }
+    else {
+        form = CblasNoTrans;
+        update = CblasConjTrans;
+    }
+
+    int kt = count*k;
+    if (side == PlasmaLeft) {
+        // W(i) = A1 + op(V(i)) * A2(i)
+        for (int i = 0; i < count; i++) {
+            plasma_complex32_t *Wi = &work[i*k];
+            LAPACKE_clacpy_work(LAPACK_COL_MAJOR, 'F', k, n1,
+                                A1, lda1, Wi, ldwork);
+            cblas_cgemm(CblasColMajor, form, CblasNoTrans,
+                        k, n1, l[i],
+                        CBLAS_SADDR(zone), V[i],  ldv[i],
+                                           A2[i], lda2[i],
+                        CBLAS_SADDR(zone), Wi,    ldwork);
+        }
+
+        // W = op(T) * W
+        cblas_ctrmm(CblasColMajor,
+                    CblasLeft, CblasUpper,
+                    (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                    kt, n1,
+                    CBLAS_SADDR(zone), T,    ldt,
+                                       work, ldwork);
+
+        // A1 = A1 - sum W(i), A2(i) = A2(i) - op(V(i)) * W(i)
+        for (int i = 0; i < count; i++) {
+            plasma_complex32_t *Wi = &work[i*k];
+            for (int j = 0; j < n1; j++) {
+                cblas_caxpy(k, CBLAS_SADDR(zmone),
+                            &Wi[(size_t)ldwork*j], 1,
+                            &A1[(size_t)lda1*j], 1);
+            }
+            cblas_cgemm(CblasColMajor, update, CblasNoTrans,
+                        l[i], n1, k,
+                        CBLAS_SADDR(zmone), V[i],  ldv[i],
+                                            Wi,    ldwork,
+                        CBLAS_SADDR(zone),  A2[i], lda2[i]);
+        }
+    }
+    else {
+        // W(i) = A1 + A2(i) * op(V(i))
+        for (int i = 0; i < count; i++) {
+            plasma_complex32_t *Wi = &work[(size_t)ldwork*i*k];
+            LAPACKE_clacpy_work(LAPACK_COL_MAJOR, 'F', m1, k,
+                                A1, lda1, Wi, ldwork);
+            cblas_cgemm(CblasColMajor, CblasNoTrans, form,
+                        m1, k, l[i],
+                        CBLAS_SADDR(zone), A2[i], lda2[i],
+                                           V[i],  ldv[i],
+                        CBLAS_SADDR(zone), Wi,    ldwork);
+        }
+
+        // W = W * op(T)
+        cblas_ctrmm(CblasColMajor,
+                    CblasRight, CblasUpper,
+                    (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                    m1, kt,
+                    CBLAS_SADDR(zone), T,    ldt,
+                                       work, ldwork);
+
+        // A1 = A1 - sum W(i), A2(i) = A2(i) - W(i) * op(V(i))
+        for (int i = 0; i < count; i++) {
+            plasma_complex32_t *Wi = &work[(size_t)ldwork*i*k];
+            for (int j = 0; j < k; j++) {
+                cblas_caxpy(m1, CBLAS_SADDR(zmone),
+                            &Wi[(size_t)ldwork*j], 1,
+                            &A1[(size_t)lda1*j], 1);
+            }
+            cblas_cgemm(CblasColMajor, CblasNoTrans, update,
+                        m1, l[i], k,
+                        CBLAS_SADDR(zmone), Wi,    ldwork,
+                                            V[i],  ldv[i],
+                        CBLAS_SADDR(zone),  A2[i], lda2[i]);
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void core_omp_clarft_group(plasma_enum_t storev, int count, int k, int ib,
+                           const int *l,
+                           plasma_complex32_t * const *V, const int *ldv,
+                           plasma_complex32_t * const *Tb, int ldtb,
+                           plasma_complex32_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // The unused slots repeat the first tile.
+    int lv[PlasmaHouseholderMaxGroup], lt[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *v[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *tb[PlasmaHouseholderMaxGroup];
+    size_t sv[PlasmaHouseholderMaxGroup];
+    float length = 0.0;
+    for (int i = 0; i < PlasmaHouseholderMaxGroup; i++) {
+        int j = i < count ? i : 0;
+        lv[i] = l[j];
+        lt[i] = ldv[j];
+        v[i] = V[j];
+        tb[i] = Tb[j];
+        sv[i] = (size_t)lt[i]*(storev == PlasmaColumnwise ? k : lv[i]);
+        if (i < count)
+            length += lv[i];
+    }
+    plasma_complex32_t *v0 = v[0], *v1 = v[1], *v2 = v[2], *v3 = v[3];
+    plasma_complex32_t *t0 = tb[0], *t1 = tb[1], *t2 = tb[2], *t3 = tb[3];
+    size_t sv0 = sv[0], sv1 = sv[1], sv2 = sv[2], sv3 = sv[3];
+    int kt = count*k;
+
+    #pragma omp task depend(in:v0[0:sv0]) \
+                     depend(in:v1[0:sv1]) \
+                     depend(in:v2[0:sv2]) \
+                     depend(in:v3[0:sv3]) \
+                     depend(in:t0[0:ib*k]) \
+                     depend(in:t1[0:ib*k]) \
+                     depend(in:t2[0:ib*k]) \
+                     depend(in:t3[0:ib*k]) \
+                     depend(out:T[0:ldt*kt]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("clarft_group", T);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_clarft_group(storev, count, k, ib,
+                                         lv, v, lt,
+                                         tb, ldtb,
+                                         T, ldt);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_clarft_group() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                           length*k*k + (float)kt*kt*kt/3.0,
+                           length*k + (float)ib*kt + (float)kt*kt);
+        PLASMA_TRACE_STOP("clarft_group", 1, T, v0, v1, v2, v3,
+                          t0, t1, t2, t3);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
+
+/******************************************************************************/
+void core_omp_cparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                           plasma_enum_t storev,
+                           int count, int m1, int n1, const int *l, int k,
+                                 plasma_complex32_t *A1, int lda1,
+                           plasma_complex32_t * const *A2, const int *lda2,
+                           plasma_complex32_t * const *V, const int *ldv,
+                           const plasma_complex32_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // The unused slots repeat the first tile.
+    int lv[PlasmaHouseholderMaxGroup];
+    int la[PlasmaHouseholderMaxGroup], lt[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *a[PlasmaHouseholderMaxGroup];
+    plasma_complex32_t *v[PlasmaHouseholderMaxGroup];
+    size_t sa[PlasmaHouseholderMaxGroup], sv[PlasmaHouseholderMaxGroup];
+    float length = 0.0;
+    for (int i = 0; i < PlasmaHouseholderMaxGroup; i++) {
+        int j = i < count ? i : 0;
+        lv[i] = l[j];
+        la[i] = lda2[j];
+        lt[i] = ldv[j];
+        a[i] = A2[j];
+        v[i] = V[j];
+        sa[i] = (size_t)la[i]*(side == PlasmaLeft ? n1 : lv[i]);
+        sv[i] = (size_t)lt[i]*(storev == PlasmaColumnwise ? k : lv[i]);
+        if (i < count)
+            length += lv[i];
+    }
+    plasma_complex32_t *a0 = a[0], *a1 = a[1], *a2 = a[2], *a3 = a[3];
+    plasma_complex32_t *v0 = v[0], *v1 = v[1], *v2 = v[2], *v3 = v[3];
+    size_t sa0 = sa[0], sa1 = sa[1], sa2 = sa[2], sa3 = sa[3];
+    size_t sv0 = sv[0], sv1 = sv[1], sv2 = sv[2], sv3 = sv[3];
+    int kt = count*k;
+
+    #pragma omp task depend(inout:A1[0:lda1*n1]) \
+                     depend(inout:a0[0:sa0]) \
+                     depend(inout:a1[0:sa1]) \
+                     depend(inout:a2[0:sa2]) \
+                     depend(inout:a3[0:sa3]) \
+                     depend(in:v0[0:sv0]) \
+                     depend(in:v1[0:sv1]) \
+                     depend(in:v2[0:sv2]) \
+                     depend(in:v3[0:sv3]) \
+                     depend(in:T[0:ldt*kt]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cparfb_group", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            // W is count*k-by-n1 (left) or m1-by-count*k (right).
+            int ldwork = side == PlasmaLeft ? kt : m1;
+            plasma_complex32_t *W = (plasma_complex32_t*)malloc(
+                (size_t)kt*(side == PlasmaLeft ? n1 : m1)*
+                sizeof(plasma_complex32_t));
+            if (W == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                int info = core_cparfb_group(side, trans, storev,
+                                             count, m1, n1, lv, k,
+                                             A1, lda1,
+                                             a,  la,
+                                             v,  lt,
+                                             T,  ldt,
+                                             W,  ldwork);
+                free(W);
+                if (info != PlasmaSuccess) {
+                    plasma_error("core_cparfb_group() failed");
+                    plasma_request_fail(sequence, request,
+                                        PlasmaErrorInternal);
+                }
+            }
+        }
+        float other = side == PlasmaLeft ? n1 : m1;
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                           4.0*length*k*other + (float)kt*kt*other,
+                           2.0*m1*n1 + 2.0*length*other +
+                           length*k + (float)kt*kt);
+        PLASMA_TRACE_STOP("cparfb_group", 5, A1, a0, a1, a2, a3,
+                          v0, v1, v2, v3, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
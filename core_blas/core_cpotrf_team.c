@@ -0,0 +1,163 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpotrf_team.c, normal z -> c, Thu Oct 15 06:23:00 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_barrier.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ * @ingroup core_potrf
+ *
+ *  Performs the Cholesky factorization of the Hermitian positive definite
+ *  tile A, as core_cpotrf(), on a team of size ranks meeting at the barrier.
+ *
+ *  The tile is factored right-looking by blocks of ib columns: rank 0
+ *  factors the diagonal block, the ranks solve the rows of the block
+ *  column below it, or the columns of the block row right of it, in equal
+ *  shares, and update the trailing matrix by blocks of ib columns, or
+ *  rows, dealt cyclically, which balances the triangle.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the Hermitian positive definite matrix A.
+ *          On exit, if the return value is 0, the factor U or L from the
+ *          Cholesky factorization A = U^H*U or A = L*L^H.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib > 0.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread in the team.
+ *
+ * @param[in] size
+ *          The number of ranks of the team.
+ *
+ * @param[in,out] info
+ *          Shared by the team, 0 on entry. On exit, as the return value.
+ *
+ * @param[in] barrier
+ *          The barrier of the team.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if i, the leading minor of order i of A is not positive
+ *         definite, and the factorization could not be completed
+ *
+ ******************************************************************************/
+int core_cpotrf_team(plasma_enum_t uplo, int n,
+                     plasma_complex32_t *A, int lda, int ib,
+                     int rank, int size,
+                     int *info, plasma_barrier_t *barrier)
+{
+    plasma_complex32_t zone  =  1.0;
+    plasma_complex32_t zmone = -1.0;
+
+    for (int j = 0; j < n; j += ib) {
+        int jb = imin(ib, n-j);
+        int n2 = n-(j+jb);
+        plasma_complex32_t *A11 = &A[(size_t)lda*j+j];
+
+        // diagonal block
+        if (rank == 0) {
+            int iinfo = LAPACKE_cpotrf_work(LAPACK_COL_MAJOR,
+                                            lapack_const(uplo),
+                                            jb, A11, lda);
+            if (iinfo != 0)
+                *info = j+iinfo;
+        }
+        plasma_barrier_wait(barrier, rank);
+        if (*info != 0 || n2 == 0)
+            break;
+
+        // share of the rank of the block column below, or row right of,
+        // the diagonal block
+        int i0 = j+jb + (int)((long)n2*rank/size);
+        int ni = j+jb + (int)((long)n2*(rank+1)/size) - i0;
+        if (uplo == PlasmaLower) {
+            if (ni > 0)
+                cblas_ctrsm(CblasColMajor,
+                            CblasRight, CblasLower,
+                            (CBLAS_TRANSPOSE)Plasma_ConjTrans, CblasNonUnit,
+                            ni, jb,
+                            CBLAS_SADDR(zone), A11, lda,
+                                               &A[(size_t)lda*j+i0], lda);
+        }
+        else {
+            if (ni > 0)
+                cblas_ctrsm(CblasColMajor,
+                            CblasLeft, CblasUpper,
+                            (CBLAS_TRANSPOSE)Plasma_ConjTrans, CblasNonUnit,
+                            jb, ni,
+                            CBLAS_SADDR(zone), A11, lda,
+                                               &A[(size_t)lda*i0+j], lda);
+        }
+        plasma_barrier_wait(barrier, rank);
+
+        // trailing matrix, by blocks of ib columns, or rows, cyclically
+        for (int i = j+jb + rank*ib; i < n; i += size*ib) {
+            int nb = imin(ib, n-i);
+            if (uplo == PlasmaLower) {
+                // A(i:n, i:i+nb) -= A(i:n, j:j+jb) * A(i:i+nb, j:j+jb)^H
+                cblas_cherk(CblasColMajor,
+                            CblasLower, CblasNoTrans,
+                            nb, jb,
+                            -1.0, &A[(size_t)lda*j+i], lda,
+                             1.0, &A[(size_t)lda*i+i], lda);
+                if (n > i+nb)
+                    cblas_cgemm(CblasColMajor,
+                                CblasNoTrans,
+                                (CBLAS_TRANSPOSE)Plasma_ConjTrans,
+                                n-(i+nb), nb, jb,
+                                CBLAS_SADDR(zmone), &A[(size_t)lda*j+i+nb],
+                                                    lda,
+                                                    &A[(size_t)lda*j+i], lda,
+                                CBLAS_SADDR(zone),  &A[(size_t)lda*i+i+nb],
+                                                    lda);
+            }
+            else {
+                // A(i:i+nb, i:n) -= A(j:j+jb, i:i+nb)^H * A(j:j+jb, i:n)
+                cblas_cherk(CblasColMajor,
+                            CblasUpper, (CBLAS_TRANSPOSE)Plasma_ConjTrans,
+                            nb, jb,
+                            -1.0, &A[(size_t)lda*i+j], lda,
+                             1.0, &A[(size_t)lda*i+i], lda);
+                if (n > i+nb)
+                    cblas_cgemm(CblasColMajor,
+                                (CBLAS_TRANSPOSE)Plasma_ConjTrans,
+                                CblasNoTrans,
+                                nb, n-(i+nb), jb,
+                                CBLAS_SADDR(zmone), &A[(size_t)lda*i+j], lda,
+                                                    &A[(size_t)lda*(i+nb)+j],
+                                                    lda,
+                                CBLAS_SADDR(zone),  &A[(size_t)lda*(i+nb)+i],
+                                                    lda);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+    }
+
+    return *info;
+}
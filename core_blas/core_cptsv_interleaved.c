@@ -0,0 +1,123 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zptsv_interleaved.c, normal z -> c, Thu Oct 15 07:31:12 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+
+#include <complex.h>
+
+#define COMPLEX
+
+// row i of an interleaved array, the elements of the count systems
+#define D(i) (&d[(size_t)(i)*stride])
+#define E(i) (&e[(size_t)(i)*stride])
+#define B(i, j) (&B[((size_t)(j)*n + (i))*stride])
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pttrf
+ *
+ *  Solves count independent Hermitian positive definite tridiagonal systems
+ *  A_s X_s = B_s of order n, stored interleaved: the element i of the system
+ *  s is at i*stride + s, so that the recurrences run across the systems,
+ *  one per vector lane. The matrices are factored as L_s D_s L_s^H, as in
+ *  LAPACK cptsv.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_s. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B_s. nrhs >= 0.
+ *
+ * @param[in] count
+ *          The number of systems. 0 <= count <= stride.
+ *
+ * @param[in] stride
+ *          The distance between consecutive elements of a system.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of A_s.
+ *          On exit, the diagonal of D_s.
+ *
+ * @param[in,out] e
+ *          On entry, the n-1 subdiagonal elements of A_s.
+ *          On exit, the subdiagonal of the unit bidiagonal L_s.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand sides B_s, the element (i, j)
+ *          of the system s at (j*n + i)*stride + s.
+ *          On exit, the solutions X_s.
+ *
+ * @param[out] info
+ *          Array of count statuses. info[s] = 0 on success, or i > 0 if
+ *          the leading minor of order i of A_s is not positive definite,
+ *          and X_s is not valid.
+ *
+ ******************************************************************************/
+void core_cptsv_interleaved(int n, int nrhs, int count, int stride,
+                            float *d, plasma_complex32_t *e,
+                            plasma_complex32_t *B, int *info)
+{
+    for (int s = 0; s < count; s++)
+        info[s] = 0;
+
+    // Factor A = L D L^H.
+    for (int i = 0; i < n; i++) {
+        float *di = D(i);
+        float *d1 = i < n-1 ? D(i+1) : NULL;
+        plasma_complex32_t *ei = i < n-1 ? E(i) : NULL;
+
+        #pragma omp simd
+        for (int s = 0; s < count; s++) {
+            if (di[s] <= 0.0 && info[s] == 0)
+                info[s] = i+1;
+            if (ei != NULL) {
+                plasma_complex32_t f = ei[s];
+                ei[s] = f/di[s];
+#ifdef COMPLEX
+                d1[s] -= (creal(f)*creal(f) + cimag(f)*cimag(f))/di[s];
+#else
+                d1[s] -= f*f/di[s];
+#endif
+            }
+        }
+    }
+
+    // Solve L D L^H X = B.
+    for (int j = 0; j < nrhs; j++) {
+        for (int i = 1; i < n; i++) {
+            plasma_complex32_t *bi = B(i, j);
+            plasma_complex32_t *b0 = B(i-1, j);
+            plasma_complex32_t *e0 = E(i-1);
+
+            #pragma omp simd
+            for (int s = 0; s < count; s++)
+                bi[s] -= e0[s]*b0[s];
+        }
+        for (int i = n-1; i >= 0; i--) {
+            plasma_complex32_t *bi = B(i, j);
+            plasma_complex32_t *b1 = i < n-1 ? B(i+1, j) : NULL;
+            plasma_complex32_t *ei = i < n-1 ? E(i) : NULL;
+            float *di = D(i);
+
+            #pragma omp simd
+            for (int s = 0; s < count; s++) {
+                plasma_complex32_t x = bi[s]/di[s];
+                if (b1 != NULL)
+                    x -= conjf(ei[s])*b1[s];
+                bi[s] = x;
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpttrf.c, normal z -> c, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pttrf
+ *
+ *  Computes the L D L^H factorization of an n-by-n Hermitian positive definite
+ *  tridiagonal partition A of a larger tridiagonal matrix, and its spikes:
+ *  the solutions V and W of
+ *
+ *    \f[ A V = dun e_n, \qquad A W = dl0 e_1, \f]
+ *
+ *  where dun and dl0 are the elements coupling the partition to the next and
+ *  to the previous one.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the partition A. n >= 0.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of A.
+ *          On exit, the n diagonal elements of D.
+ *
+ * @param[in,out] e
+ *          On entry, the n-1 subdiagonal elements of A.
+ *          On exit, the n-1 subdiagonal elements of the unit bidiagonal L.
+ *
+ * @param[in] dl0
+ *          The element of the matrix left of the first row of A.
+ *
+ * @param[in] dun
+ *          The element of the matrix right of the last row of A.
+ *
+ * @param[out] VW
+ *          The n-by-2 matrix of the spikes, V then W.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if the leading minor of order i of A is not positive definite,
+ *         for i the return value
+ *
+ ******************************************************************************/
+int core_cpttrf_spike(int n, float *d, plasma_complex32_t *e,
+                      plasma_complex32_t dl0, plasma_complex32_t dun,
+                      plasma_complex32_t *VW)
+{
+    int info = LAPACKE_cpttrf_work(n, d, e);
+    if (info != 0)
+        return info;
+
+    for (int i = 0; i < 2*n; i++)
+        VW[i] = 0.0;
+    VW[n-1] = dun;
+    VW[n]   = dl0;
+    core_cpttrs(n, 2, d, e, VW, n);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// The factors of the partition are tracked through d.
+void core_omp_cpttrf_spike(int n, float *d, plasma_complex32_t *e,
+                           plasma_complex32_t dl0, plasma_complex32_t dun,
+                           plasma_complex32_t *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(inout:d[0:n]) \
+                     depend(out:VW[0:2*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("cpttrf_spike", d);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_cpttrf_spike(n, d, e, dl0, dun, VW);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat, 13.0*n, 4.0*n);
+        PLASMA_TRACE_STOP("cpttrf_spike", 2, d, VW);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
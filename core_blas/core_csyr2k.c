@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsyr2k.c, normal z -> c, Mon Feb  6 14:06:54 2017
+ * @generated from core_blas/core_zsyr2k.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -118,13 +118,16 @@ void core_omp_csyr2k(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("csyr2k", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_csyr2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        PLASMA_TRACE_STOP("csyr2k", 1, C, A, B);
     }
 }
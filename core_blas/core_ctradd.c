@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztradd.c, normal z -> c, Mon Feb  6 14:06:56 2017
+ * @generated from core_blas/core_ztradd.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -192,9 +192,11 @@ void core_omp_ctradd(
     int k = (transa == PlasmaNoTrans) ? n : m;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ctradd", B);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int retval = core_ctradd(uplo, transa,
                                      m, n,
                                      alpha, A, lda,
@@ -204,5 +206,7 @@ void core_omp_ctradd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("ctradd", 1, B, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztslqt.c, normal z -> c, Mon Feb  6 14:06:58 2017
+ * @generated from core_blas/core_ztslqt.c, normal z -> c, Thu Oct 15 10:25:43 2026
  *
  **/
 
@@ -228,12 +228,14 @@ void core_omp_ctslqt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // T should be mxib, but is stored as ibxm.
     #pragma omp task depend(inout:A1[0:lda1*m]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*m]) // T should be mxib, but is stored
-                                           // as ibxm
+                     depend(out:T[0:ib*m]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ctslqt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *tau = ((plasma_complex32_t*)work.spaces[tid]);
@@ -251,5 +253,7 @@ void core_omp_ctslqt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("ctslqt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
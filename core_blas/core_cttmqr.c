@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zttmqr.c, normal z -> c, Mon Feb  6 14:07:00 2017
+ * @generated from core_blas/core_zttmqr.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -266,9 +266,11 @@ void core_omp_cttmqr(plasma_enum_t side, plasma_enum_t trans,
     #pragma omp task depend(inout:A1[0:lda1*n1]) \
                      depend(inout:A2[0:lda2*n2]) \
                      depend(in:V[0:ldv*k]) \
-                     depend(in:T[0:ib*k])
+                     depend(in:T[0:ib*k]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("cttmqr", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
@@ -288,5 +290,7 @@ void core_omp_cttmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("cttmqr", 2, A1, A2, V, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
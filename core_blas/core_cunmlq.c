@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zunmlq.c, normal z -> c, Mon Feb  6 14:07:01 2017
+ * @generated from core_blas/core_zunmlq.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -251,9 +251,11 @@ void core_omp_cunmlq(plasma_enum_t side, plasma_enum_t trans,
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("cunmlq", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
@@ -272,5 +274,7 @@ void core_omp_cunmlq(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("cunmlq", 1, C, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
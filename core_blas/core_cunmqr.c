@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zunmqr.c, normal z -> c, Mon Feb  6 14:07:01 2017
+ * @generated from core_blas/core_zunmqr.c, normal z -> c, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -242,9 +242,11 @@ void core_omp_cunmqr(plasma_enum_t side, plasma_enum_t trans,
 {
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("cunmqr", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
@@ -263,5 +265,12 @@ void core_omp_cunmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaComplexFloat,
+                           side == PlasmaLeft ? 4.0*m*n*k - 2.0*n*k*k
+                                              : 4.0*m*n*k - 2.0*m*k*k,
+                           2.0*m*n +
+                           ((side == PlasmaLeft ? m : n) + ib)*(float)k);
+        PLASMA_TRACE_STOP("cunmqr", 1, C, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
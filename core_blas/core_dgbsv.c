@@ -0,0 +1,68 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgbsv.c, normal z -> d, Wed Oct 14 19:29:17 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gttrf
+ *
+ *  Solves A X = B for a small band matrix A in LAPACK band storage,
+ *  using LU factorization with partial pivoting, e.g., the reduced system
+ *  of the partitioned tridiagonal solvers.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of A. n >= 0.
+ *
+ * @param[in] kl
+ *          The number of subdiagonals within the band of A. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of superdiagonals within the band of A. ku >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of B. nrhs >= 0.
+ *
+ * @param[in,out] AB
+ *          On entry, A in rows kl to 2*kl+ku; the first kl rows are
+ *          workspace. On exit, its LU factorization.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the array AB. ldab >= 2*kl+ku+1.
+ *
+ * @param[out] ipiv
+ *          The n pivot indices.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, the solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if U(i,i) is exactly zero, for i the return value
+ *
+ ******************************************************************************/
+int core_dgbsv(int n, int kl, int ku, int nrhs,
+               double *AB, int ldab, int *ipiv,
+               double *B, int ldb)
+{
+    return LAPACKE_dgbsv_work(LAPACK_COL_MAJOR, n, kl, ku, nrhs,
+                              AB, ldab, ipiv, B, ldb);
+}
@@ -0,0 +1,114 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_device.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_device.h"
+#include "plasma_types.h"
+
+#if defined(PLASMA_WITH_CUDA)
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs core_dgemm with cuBLAS, on the stream of the calling thread.
+ *  A and B are read through the device tile cache, and C is copied to the
+ *  device and back, so that C is current on the host on return.
+ *  Falls back to core_dgemm if the device memory runs out.
+ *
+ * @see core_dgemm
+ * @see plasma_device_tile
+ *
+ ******************************************************************************/
+void core_dgemm_device(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       double alpha,
+                       const double *A, int lda,
+                       const double *B, int ldb,
+                       double beta,
+                       double *C, int ldc)
+{
+    size_t eltsize = sizeof(double);
+    int am = transa == PlasmaNoTrans ? m : k;
+    int an = transa == PlasmaNoTrans ? k : m;
+    int bm = transb == PlasmaNoTrans ? k : n;
+    int bn = transb == PlasmaNoTrans ? n : k;
+
+    plasma_device_thread_t *thread = plasma_device_thread();
+    if (thread != NULL && m > 0 && n > 0 && k > 0) {
+        const void *dA = plasma_device_tile(thread, A, lda, am, an, eltsize);
+        const void *dB = plasma_device_tile(thread, B, ldb, bm, bn, eltsize);
+        void *dC = plasma_device_work(thread, (size_t)m*n*eltsize);
+        if (dA != NULL && dB != NULL && dC != NULL) {
+            cublasSetMatrixAsync(m, n, eltsize, C, ldc, dC, m,
+                                 thread->stream);
+            cublasStatus_t status = cublasDgemm(
+                thread->handle,
+                plasma_device_trans(transa), plasma_device_trans(transb),
+                m, n, k,
+                (const void*)&alpha, dA, am,
+                                     dB, bm,
+                (const void*)&beta,  dC, m);
+            cublasGetMatrixAsync(m, n, eltsize, dC, m, C, ldc,
+                                 thread->stream);
+            cudaStreamSynchronize(thread->stream);
+            if (status == CUBLAS_STATUS_SUCCESS)
+                return;
+        }
+    }
+    core_dgemm(transa, transb,
+               m, n, k,
+               alpha, A, lda,
+                      B, ldb,
+               beta,  C, ldc);
+}
+
+/******************************************************************************/
+void core_omp_dgemm_device(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dgemm_device", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dgemm_device(transa, transb,
+                              m, n, k,
+                              alpha, A, lda,
+                                     B, ldb,
+                              beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 2.0*m*n*k,
+                           (double)m*k + (double)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("dgemm_device", 1, C, A, B);
+    }
+}
+
+#endif // PLASMA_WITH_CUDA
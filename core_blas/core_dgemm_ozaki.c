@@ -0,0 +1,421 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_ozaki.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define REAL
+
+#ifdef COMPLEX
+#define PLANES 2
+#else
+#define PLANES 1
+#endif
+
+/******************************************************************************/
+// Returns the size in bytes of the exponents of nv vectors, rounded up
+// to the alignment of the slices following them.
+static size_t core_dgemm_ozaki_exp_size(int nv)
+{
+    return ((size_t)nv*sizeof(int)+15)/16*16;
+}
+
+/******************************************************************************/
+// Returns the integer dot product of the int8 vectors a and b of length k,
+// exact for any k, as the partial sums of 65536 products fit in int32.
+static int64_t core_dgemm_ozaki_dot(const int8_t *a, const int8_t *b, int k)
+{
+    int64_t sum = 0;
+    for (int l0 = 0; l0 < k; l0 += 65536) {
+        int l1 = imin(l0+65536, k);
+        int32_t part = 0;
+        for (int l = l0; l < l1; l++)
+            part += (int32_t)a[l]*b[l];
+        sum += part;
+    }
+    return sum;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Returns the size in bytes of the split form of an m-by-n matrix for
+ *  core_dgemm_ozaki, of the given number of slices: the exponents of
+ *  its rows, or columns, followed by the int8 slices of its real part,
+ *  and of its imaginary part.
+ *
+ ******************************************************************************/
+size_t core_dgemm_ozaki_split_size(plasma_enum_t side, int m, int n,
+                                   int slices)
+{
+    int nv = side == PlasmaLeft ? m : n;
+    return core_dgemm_ozaki_exp_size(nv) +
+           (size_t)PLANES*slices*m*n*sizeof(int8_t);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Splits op( A ), an m-by-n matrix, into slices of int8 integers by the
+ *  Ozaki scheme, for core_dgemm_ozaki. As the left operand of a product,
+ *  each row of op( A ) is scaled by a power of two 2^e into (-1, 1), and
+ *
+ *    \f[ op( A )_{ij} = 2^{e_i} \sum_{s=1}^{slices} A^{(s)}_{ij} 2^{-7s}
+ *        + r_{ij}, \quad |A^{(s)}_{ij}| \le 127,
+ *        \quad |r_{ij}| < 2^{e_i - 7 slices}, \f]
+ *
+ *  each slice holding the next 7 bits of the elements, exactly.
+ *  As the right operand, the columns of op( A ) are scaled instead.
+ *  The slices of the left operand are stored by rows and those of the
+ *  right operand by columns, so that their products run along contiguous
+ *  integers. The real and imaginary parts share the exponents.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  op( A ) is the left operand, split by rows,
+ *          - PlasmaRight: op( A ) is the right operand, split by columns.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of op( A ).
+ *
+ * @param[in] n
+ *          The number of columns of op( A ).
+ *
+ * @param[in] A
+ *          The matrix A, of leading dimension lda.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *
+ * @param[in] slices
+ *          The number of slices. slices > 0.
+ *
+ * @param[out] S
+ *          The split matrix, of core_dgemm_ozaki_split_size bytes.
+ *
+ ******************************************************************************/
+void core_dgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                            int m, int n,
+                            const double *A, int lda,
+                            int slices, void *S)
+{
+    // nv vectors of length len, the rows or the columns of op( A )
+    int nv  = side == PlasmaLeft ? m : n;
+    int len = side == PlasmaLeft ? n : m;
+    int *e = (int*)S;
+    int8_t *P = (int8_t*)S + core_dgemm_ozaki_exp_size(nv);
+    size_t plane = (size_t)m*n;
+
+    for (int v = 0; v < nv; v++) {
+        // the element l of vector v
+        #define OP_A(l) (side == PlasmaLeft ? \
+            (trans == PlasmaNoTrans ? A[v+(size_t)lda*(l)] \
+                                    : A[(l)+(size_t)lda*v]) : \
+            (trans == PlasmaNoTrans ? A[(l)+(size_t)lda*v] \
+                                    : A[v+(size_t)lda*(l)]))
+
+        double amax = 0.0;
+        for (int l = 0; l < len; l++) {
+            double a = OP_A(l);
+#ifdef COMPLEX
+            amax = fmax(amax, fmax(fabs(creal(a)), fabs(cimag(a))));
+#else
+            amax = fmax(amax, fabs(a));
+#endif
+        }
+        // amax < 2^e, so that the scaled elements are in (-1, 1).
+        e[v] = 0;
+        if (amax > 0.0)
+            frexp(amax, &e[v]);
+
+        for (int l = 0; l < len; l++) {
+            double a = OP_A(l);
+#ifdef COMPLEX
+            if (trans == PlasmaConjTrans)
+                a = (a);
+            double t[PLANES] = {ldexp(creal(a), -e[v]),
+                                ldexp(cimag(a), -e[v])};
+#else
+            double t[PLANES] = {ldexp(a, -e[v])};
+#endif
+            for (int p = 0; p < PLANES; p++) {
+                for (int s = 0; s < slices; s++) {
+                    // the next 7 bits, with no rounding error
+                    double d = trunc(t[p]*128.0);
+                    t[p] = t[p]*128.0 - d;
+                    P[(p*slices+s)*plane + (size_t)len*v + l] = (int8_t)d;
+                }
+            }
+        }
+        #undef OP_A
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Computes C = alpha*op( A )*op( B ) + beta*C by the Ozaki scheme, with
+ *  op( A ) and op( B ) split by core_dgemm_ozaki_split, as the sum of the
+ *  products of their slices,
+ *
+ *    \f[ op( A ) op( B ) \approx \sum_{s+t \le slices+1}
+ *        2^{e_i + f_j - 7(s+t)} A^{(s)} B^{(t)}, \f]
+ *
+ *  each of which is an integer product, exact in 32-bit integers, summed
+ *  exactly in 64-bit integers by the diagonals s+t before their scaling.
+ *  The products of the higher slices, below the precision of the sum,
+ *  are skipped. With 7 bits a slice, 8 slices give the accuracy of the
+ *  double precision gemm, normwise by the rows of op( A ) and the columns
+ *  of op( B ), and 4 slices that of the single precision.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of op( A ) and of C.
+ *
+ * @param[in] n
+ *          The number of columns of op( B ) and of C.
+ *
+ * @param[in] k
+ *          The number of columns of op( A ) and of rows of op( B ).
+ *
+ * @param[in] slices
+ *          The number of slices of op( A ) and op( B ).
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The split op( A ), m-by-k, as the left operand.
+ *
+ * @param[in] B
+ *          The split op( B ), k-by-n, as the right operand.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          The m-by-n matrix C.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ ******************************************************************************/
+void core_dgemm_ozaki(int m, int n, int k, int slices,
+                      double alpha, const void *A, const void *B,
+                      double beta, double *C, int ldc)
+{
+    const int *ea = (const int*)A;
+    const int *eb = (const int*)B;
+    const int8_t *Pa = (const int8_t*)A + core_dgemm_ozaki_exp_size(m);
+    const int8_t *Pb = (const int8_t*)B + core_dgemm_ozaki_exp_size(n);
+    size_t mk = (size_t)m*k;
+    size_t kn = (size_t)k*n;
+
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            // Sum the diagonals from the smallest up.
+            double tr = 0.0;
+            double ti = 0.0;
+            for (int g = slices-1; g >= 0; g--) {
+                int64_t rr = 0;
+#ifdef COMPLEX
+                int64_t ri = 0;
+#endif
+                for (int s = 0; s <= g; s++) {
+                    const int8_t *ar = &Pa[s*mk + (size_t)k*i];
+                    const int8_t *br = &Pb[(g-s)*kn + (size_t)k*j];
+#ifdef COMPLEX
+                    const int8_t *ai = &Pa[(slices+s)*mk + (size_t)k*i];
+                    const int8_t *bi = &Pb[(slices+g-s)*kn + (size_t)k*j];
+                    rr += core_dgemm_ozaki_dot(ar, br, k) -
+                          core_dgemm_ozaki_dot(ai, bi, k);
+                    ri += core_dgemm_ozaki_dot(ar, bi, k) +
+                          core_dgemm_ozaki_dot(ai, br, k);
+#else
+                    rr += core_dgemm_ozaki_dot(ar, br, k);
+#endif
+                }
+                tr += ldexp((double)rr, -7*(g+2));
+#ifdef COMPLEX
+                ti += ldexp((double)ri, -7*(g+2));
+#endif
+            }
+#ifdef COMPLEX
+            double t = ldexp(tr, ea[i]+eb[j]) +
+                                   ldexp(ti, ea[i]+eb[j])*I;
+#else
+            double t = ldexp(tr, ea[i]+eb[j]);
+            (void)ti;
+#endif
+            double *c = &C[i+(size_t)ldc*j];
+            *c = beta == 0.0 ? alpha*t : alpha*t + beta*(*c);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Computes C = alpha*op( A )*op( B ) + beta*C as core_dgemm, by the
+ *  Ozaki scheme, splitting op( A ) and op( B ) for this product only.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorOutOfMemory if the split operands were not allocated
+ *
+ ******************************************************************************/
+int core_dgemm_emulated(plasma_enum_t transa, plasma_enum_t transb,
+                        int m, int n, int k, int slices,
+                        double alpha,
+                        const double *A, int lda,
+                        const double *B, int ldb,
+                        double beta,
+                        double *C, int ldc)
+{
+    void *As = malloc(core_dgemm_ozaki_split_size(PlasmaLeft, m, k, slices));
+    void *Bs = malloc(core_dgemm_ozaki_split_size(PlasmaRight, k, n, slices));
+    if (As == NULL || Bs == NULL) {
+        free(As);
+        free(Bs);
+        return PlasmaErrorOutOfMemory;
+    }
+    core_dgemm_ozaki_split(PlasmaLeft, transa, m, k, A, lda, slices, As);
+    core_dgemm_ozaki_split(PlasmaRight, transb, k, n, B, ldb, slices, Bs);
+    core_dgemm_ozaki(m, n, k, slices,
+                     alpha, As, Bs,
+                     beta, C, ldc);
+    free(As);
+    free(Bs);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void core_omp_dgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                                int m, int n,
+                                const double *A, int lda,
+                                int slices, void **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int an = trans == PlasmaNoTrans ? n : m;
+
+    #pragma omp task depend(in:A[0:lda*an]) \
+                     depend(out:S[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dgemm_ozaki_split", S);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            *S = malloc(core_dgemm_ozaki_split_size(side, m, n, slices));
+            if (*S == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                core_dgemm_ozaki_split(side, trans, m, n, A, lda,
+                                       slices, *S);
+            }
+        }
+        PLASMA_TRACE_STOP("dgemm_ozaki_split", 1, S, A);
+    }
+}
+
+/******************************************************************************/
+void core_omp_dgemm_ozaki(int m, int n, int k, int slices,
+                          double alpha, void **A, void **B,
+                          double beta,
+                          double *C, int ldc,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:1]) \
+                     depend(in:B[0:1]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dgemm_ozaki", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dgemm_ozaki(m, n, k, slices,
+                             alpha, *A, *B,
+                             beta, C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 2.0*m*n*k,
+                           (double)m*k + (double)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("dgemm_ozaki", 1, C, A, B);
+    }
+}
+
+/******************************************************************************/
+// Frees the split matrix S after the products reading it.
+void core_omp_dgemm_ozaki_free(void **S,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    #pragma omp task depend(inout:S[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        free(*S);
+        *S = NULL;
+    }
+}
+
+/******************************************************************************/
+void core_omp_dgemm_emulated(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int slices,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak = transa == PlasmaNoTrans ? k : m;
+    int bk = transb == PlasmaNoTrans ? n : k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dgemm_emulated", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int retval = core_dgemm_emulated(transa, transb,
+                                             m, n, k, slices,
+                                             alpha, A, lda,
+                                                    B, ldb,
+                                             beta,  C, ldc);
+            if (retval != PlasmaSuccess) {
+                plasma_error("core_dgemm_emulated() failed");
+                plasma_request_fail(sequence, request, retval);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 2.0*m*n*k,
+                           (double)m*k + (double)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("dgemm_emulated", 1, C, A, B);
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgeqrt_panel.c, normal z -> d, Thu Oct 15 06:19:52 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_barrier.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define T(m, n) (double*)plasma_tile_addr(T, m, n)
+
+/***************************************************************************//**
+ * @ingroup core_geqrt
+ *
+ *  Factors the tile column A, of its top tile and the tiles below it, as the
+ *  chain of core_dgeqrt() on the top tile and core_dtsqrt() on each tile
+ *  below it, on a team of size ranks meeting at the barrier.
+ *
+ *  The chain is taken by blocks of ib columns: rank 0 factors the block of
+ *  columns down the whole panel, with the reflectors of the top tile and
+ *  of each tile below it, then the ranks apply them to their share of the
+ *  columns right of the block, each column by all the reflectors of the
+ *  block in the order of the chain. The reflectors of the tiles below
+ *  the top tile touch only the rows of the block in the top tile, so the
+ *  result is that of the chain, with the same T factors.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          On entry, the tile column, of width A.n, of which the top tile
+ *          has at least A.n rows, unless it is the only one.
+ *          On exit, R in the upper triangle of the top tile and the
+ *          reflectors below, as by core_dgeqrt() and core_dtsqrt().
+ *
+ * @param[out] T
+ *          The tile column of the ib-by-A.n triangular factors of the block
+ *          reflectors of the tiles of A, T.mb >= ib.
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib > 0.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread in the team.
+ *
+ * @param[in] size
+ *          The number of ranks of the team.
+ *
+ * @param work
+ *          Workspace of size*(ib+1)*A.n elements, a slice for each rank.
+ *
+ * @param[in] barrier
+ *          The barrier of the team.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value, in rank 0
+ *
+ ******************************************************************************/
+int core_dgeqrt_panel(plasma_desc_t A, plasma_desc_t T, int ib,
+                      int rank, int size,
+                      double *work, plasma_barrier_t *barrier)
+{
+    int n = A.n;
+    int mva0 = plasma_tile_mview(A, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    double *A0 = A(0, 0);
+    double *T0 = T(0, 0);
+    double *W = &work[(size_t)rank*(ib+1)*n];
+
+    int info = PlasmaSuccess;
+    for (int ii = 0; ii < imin(mva0, n); ii += ib) {
+        int sb = imin(ib, n-ii);
+
+        // factorization of the block of columns down the panel
+        if (rank == 0) {
+            double *tau = W;
+            info |= LAPACKE_dgeqr2_work(LAPACK_COL_MAJOR,
+                                        mva0-ii, sb,
+                                        &A0[(size_t)lda0*ii+ii], lda0,
+                                        tau, tau+sb);
+            info |= LAPACKE_dlarft_work(LAPACK_COL_MAJOR,
+                                        lapack_const(PlasmaForward),
+                                        lapack_const(PlasmaColumnwise),
+                                        mva0-ii, sb,
+                                        &A0[(size_t)lda0*ii+ii], lda0,
+                                        tau,
+                                        &T0[(size_t)T.mb*ii], T.mb);
+            for (int m = 1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                double *Am = A(m, 0);
+                double *Tm = T(m, 0);
+                info |= core_dtpqrt(mvam, sb, 0, sb,
+                                    &A0[(size_t)lda0*ii+ii], lda0,
+                                    &Am[(size_t)ldam*ii], ldam,
+                                    &Tm[(size_t)T.mb*ii], T.mb,
+                                    W);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+
+        // update of the share of the rank of the columns right of the block
+        int nr = n-(ii+sb);
+        int j0 = ii+sb + (int)((long)nr*rank/size);
+        int nc = ii+sb + (int)((long)nr*(rank+1)/size) - j0;
+        if (nc > 0) {
+            info |= LAPACKE_dlarfb_work(LAPACK_COL_MAJOR,
+                                        lapack_const(PlasmaLeft),
+                                        lapack_const(PlasmaTrans),
+                                        lapack_const(PlasmaForward),
+                                        lapack_const(PlasmaColumnwise),
+                                        mva0-ii, nc, sb,
+                                        &A0[(size_t)lda0*ii+ii], lda0,
+                                        &T0[(size_t)T.mb*ii], T.mb,
+                                        &A0[(size_t)lda0*j0+ii], lda0,
+                                        W, nc);
+            for (int m = 1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                double *Am = A(m, 0);
+                double *Tm = T(m, 0);
+                info |= core_dparfb(PlasmaLeft, PlasmaTrans,
+                                    PlasmaForward, PlasmaColumnwise,
+                                    sb, nc, mvam, nc, sb, 0,
+                                    &A0[(size_t)lda0*j0+ii], lda0,
+                                    &Am[(size_t)ldam*j0], ldam,
+                                    &Am[(size_t)ldam*ii], ldam,
+                                    &Tm[(size_t)T.mb*ii], T.mb,
+                                    W, sb);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+    }
+
+    return info;
+}
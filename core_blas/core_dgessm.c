@@ -0,0 +1,103 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgessm.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gessm
+ *
+ *  Applies the factor L and the row interchanges P of the LU factorization
+ *  of a diagonal tile, computed by core_dgetrf_incpiv, to the m-by-n tile A
+ *  of its tile row,
+ *
+ *    A = L^{-1} * P * A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A and of L. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of L, and of pivots. m >= k >= 0.
+ *
+ * @param[in] ipiv
+ *          The k pivot indices of core_dgetrf_incpiv.
+ *
+ * @param[in] L
+ *          The m-by-k unit lower trapezoidal factor L, below the diagonal.
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,m).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile A.
+ *          On exit, L^{-1} * P * A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ ******************************************************************************/
+void core_dgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const double *L, int ldl,
+                       double *A, int lda)
+{
+    if (m == 0 || n == 0 || k == 0)
+        return;
+
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    LAPACKE_dlaswp_work(LAPACK_COL_MAJOR, n, A, lda, 1, k, ipiv, 1);
+
+    cblas_dtrsm(CblasColMajor, CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                k, n,
+                (zone), L, ldl,
+                                   A, lda);
+    if (m > k) {
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m-k, n, k,
+                    (zmone), &L[k], ldl,
+                                        A,     lda,
+                    (zone),  &A[k], lda);
+    }
+}
+
+/******************************************************************************/
+void core_omp_dgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const double *L, int ldl,
+                           double *A, int lda,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:ipiv[0:k]) \
+                     depend(in:L[0:ldl*k]) \
+                     depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dgessm", A);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dgessm(m, n, k, ipiv, L, ldl, A, lda);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           (double)k*k*n + 2.0*(m-k)*k*n,
+                           (double)m*k + 2.0*m*n);
+        PLASMA_TRACE_STOP("dgessm", 1, A, L);
+    }
+}
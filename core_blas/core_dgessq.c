@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgessq.c, normal z -> d, Mon Feb  6 14:06:47 2017
+ * @generated from core_blas/core_zgessq.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -16,14 +16,74 @@
 #include "plasma_types.h"
 #include "core_lapack.h"
 
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/******************************************************************************/
+// Adds the sum of squares sumsq2*scale2^2 to sumsq*scale^2.
+static inline void core_dgessq_add(double scale2, double sumsq2,
+                                 double *scale, double *sumsq)
+{
+    if (scale2 == 0.0)
+        return;
+
+    if (*scale < scale2) {
+        *sumsq = sumsq2 + (*sumsq)*((*scale/scale2)*(*scale/scale2));
+        *scale = scale2;
+    }
+    else {
+        *sumsq = *sumsq + sumsq2*((scale2/(*scale))*(scale2/(*scale)));
+    }
+}
+
 /******************************************************************************/
+CORE_BLAS_MULTIVERSION
 void core_dgessq(int m, int n,
                  const double *A, int lda,
                  double *scale, double *sumsq)
 {
+    // Sum the plain squares in one vectorizable pass, with the largest
+    // entry. The sum is exact up to rounding unless it may overflow,
+    // or the largest entry is so small that the squares underflow.
+    double amax = 0.0;
+    double ssq = 0.0;
+    for (int j = 0; j < n; j++) {
+        #pragma omp simd reduction(max:amax) reduction(+:ssq)
+        for (int i = 0; i < m; i++) {
+#ifdef COMPLEX
+            double re = fabs(creal(A[lda*j+i]));
+            double im = fabs(cimag(A[lda*j+i]));
+            amax = re > amax ? re : amax;
+            amax = im > amax ? im : amax;
+            ssq += re*re + im*im;
+#else
+            double a = fabs(A[lda*j+i]);
+            amax = a > amax ? a : amax;
+            ssq += a*a;
+#endif
+        }
+    }
+    if (isnan(ssq)) {
+        *scale = ssq;
+        *sumsq = 1.0;
+        return;
+    }
+    if (amax == 0.0)
+        return;
+
+    double sfmin = LAPACKE_dlamch_work('S');
+    double eps = LAPACKE_dlamch_work('E');
+    double amin_safe = sqrt(sfmin)/eps;
+    double amax_safe = sqrt(LAPACKE_dlamch_work('O')/(2.0*m*n));
+    if (amax >= amin_safe && amax <= amax_safe) {
+        core_dgessq_add(amax, (ssq/amax)/amax, scale, sumsq);
+        return;
+    }
+
+    // Scale column by column otherwise.
     int ione = 1;
     for (int j = 0; j < n; j++)
-        // TODO: Inline this operation.
         LAPACK_dlassq(&m, &A[j*lda], &ione, scale, sumsq);
 }
 
@@ -35,13 +95,16 @@ void core_omp_dgessq(int m, int n,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dgessq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_dgessq(m, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("dgessq", 2, scale, sumsq, A);
     }
 }
 
@@ -53,21 +116,18 @@ void core_omp_dgessq_aux(int n,
 {
     #pragma omp task depend(in:scale[0:n]) \
                      depend(in:sumsq[0:n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dgessq_aux", value);
+        if (PLASMA_TRACE_RUN(sequence)) {
             double scl = 0.0;
             double sum = 1.0;
-            for (int i = 0; i < n; i++) {
-                if (scl < scale[i]) {
-                    sum = sumsq[i] + sum*((scl/scale[i])*(scl/scale[i]));
-                    scl = scale[i];
-                }
-                else {
-                    sum = sum + sumsq[i]*(scale[i]/scl)*(scale[i]/scl);
-                }
-            }
+            for (int i = 0; i < n; i++)
+                core_dgessq_add(scale[i], sumsq[i], &scl, &sum);
+
             *value = scl*sqrt(sum);
         }
+        PLASMA_TRACE_STOP("dgessq_aux", 1, value, scale, sumsq);
     }
 }
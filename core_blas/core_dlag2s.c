@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlag2c.c, mixed zc -> ds, Mon Feb  6 14:06:48 2017
+ * @generated from core_blas/core_zlag2c.c, mixed zc -> ds, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -59,9 +59,88 @@ void core_omp_dlag2s(int m, int n,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:As[0:ldas*n])
+                     depend(out:As[0:ldas*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dlag2s", As);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dlag2s(m, n, A, lda, As, ldas);
+        PLASMA_TRACE_STOP("dlag2s", 1, As, A);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Copies m-by-n matrix A to B and converts it to single complex precision
+ *  in As, in one pass over A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in double complex precision to copy.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] B
+ *          On exit, the copy of A.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the matrix B.
+ *          ldb >= max(1,m).
+ *
+ * @param[out] As
+ *          On exit, A converted to single complex precision.
+ *
+ * @param[in] ldas
+ *          The leading dimension of the matrix As.
+ *          ldas >= max(1,m).
+ *
+ ******************************************************************************/
+void core_dlacpy_lag2c(int m, int n,
+                       const double *A,  int lda,
+                             double *B,  int ldb,
+                             float *As, int ldas)
+{
+    for (int j = 0; j < n; j++) {
+        const double *a = &A[(size_t)lda*j];
+        double *b = &B[(size_t)ldb*j];
+        float *as = &As[(size_t)ldas*j];
+        for (int i = 0; i < m; i++) {
+            b[i] = a[i];
+            as[i] = (float)a[i];
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_dlacpy_lag2c(int m, int n,
+                           const double *A,  int lda,
+                                 double *B,  int ldb,
+                                 float *As, int ldas,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:B[0:ldb*n]) \
+                     depend(out:As[0:ldas*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dlacpy_lag2c", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dlacpy_lag2c(m, n, A, lda, B, ldb, As, ldas);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 0.0, 2.5*m*n);
+        PLASMA_TRACE_STOP("dlacpy_lag2c", 1, B, A);
     }
 }
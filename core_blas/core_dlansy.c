@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlansy.c, normal z -> d, Mon Feb  6 14:06:49 2017
+ * @generated from core_blas/core_zlansy.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -36,10 +36,13 @@ void core_omp_dlansy(plasma_enum_t norm, plasma_enum_t uplo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dlansy", value);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dlansy(norm, uplo, n, A, lda, work, value);
+        PLASMA_TRACE_STOP("dlansy", 1, value, A);
     }
 }
 
@@ -54,9 +57,11 @@ void core_omp_dlansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
     case PlasmaOneNorm:
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:n])
+                         depend(out:value[0:n]) \
+                         priority(plasma_sequence_priority(sequence))
         {
-            if (sequence->status == PlasmaSuccess) {
+            PLASMA_TRACE_START("dlansy_aux", value);
+            if (PLASMA_TRACE_RUN(sequence)) {
                 if (uplo == PlasmaUpper) {
                     for (int i = 0; i < n; i++)
                         value[i] = 0.0;
@@ -82,6 +87,7 @@ void core_omp_dlansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP("dlansy_aux", 1, value, A);
         }
         break;
     }
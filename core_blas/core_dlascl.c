@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlascl.c, normal z -> d, Mon Feb  6 14:06:50 2017
+ * @generated from core_blas/core_zlascl.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -39,12 +39,15 @@ void core_omp_dlascl(plasma_enum_t uplo,
                      double *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dlascl", A);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dlascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+        PLASMA_TRACE_STOP("dlascl", 1, A);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlaset.c, normal z -> d, Mon Feb  6 14:06:51 2017
+ * @generated from core_blas/core_zlaset.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -77,7 +77,11 @@ void core_omp_dlaset(plasma_enum_t uplo,
                      double *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    core_dlaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        PLASMA_TRACE_START("dlaset", A);
+        core_dlaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        PLASMA_TRACE_STOP("dlaset", 1, A);
+    }
 }
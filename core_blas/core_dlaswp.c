@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlaswp.c, normal z -> d, Mon Feb  6 14:06:51 2017
+ * @generated from core_blas/core_zlaswp.c, normal z -> d, Thu Oct 15 01:37:13 2026
  *
  **/
 
@@ -90,3 +90,51 @@ void core_dlaswp(plasma_enum_t colrow,
         }
     }
 }
+
+/******************************************************************************/
+// Applies the permutation listed by core_laswp_cycles to the rows
+// (columns) of A, moving each row (column) once through work,
+// of size A.n (A.m). Like core_dlaswp, A is one tile column (row).
+void core_dlaswp_cycles(plasma_enum_t colrow,
+                        plasma_desc_t A, const int *cycles, int len,
+                        double *work)
+{
+    //================
+    // PlasmaRowwise
+    //================
+    if (colrow == PlasmaRowwise) {
+        for (int i = 0; i < len; i++) {
+            int m1 = cycles[i];
+            int lda1 = plasma_tile_mmain(A, m1/A.mb);
+            cblas_dcopy(A.n, A(m1/A.mb, 0) + m1%A.mb, lda1, work, 1);
+            for (; cycles[i+1] >= 0; i++) {
+                int m2 = cycles[i+1];
+                int lda2 = plasma_tile_mmain(A, m2/A.mb);
+                cblas_dcopy(A.n, A(m2/A.mb, 0) + m2%A.mb, lda2,
+                                 A(m1/A.mb, 0) + m1%A.mb, lda1);
+                m1 = m2;
+                lda1 = lda2;
+            }
+            cblas_dcopy(A.n, work, 1, A(m1/A.mb, 0) + m1%A.mb, lda1);
+            i++;
+        }
+    }
+    //===================
+    // PlasmaColumnwise
+    //===================
+    else {
+        int lda0 = plasma_tile_mmain(A, 0);
+        for (int i = 0; i < len; i++) {
+            int n1 = cycles[i];
+            cblas_dcopy(A.m, A(0, n1/A.nb) + (n1%A.nb)*lda0, 1, work, 1);
+            for (; cycles[i+1] >= 0; i++) {
+                int n2 = cycles[i+1];
+                cblas_dcopy(A.m, A(0, n2/A.nb) + (n2%A.nb)*lda0, 1,
+                                 A(0, n1/A.nb) + (n1%A.nb)*lda0, 1);
+                n1 = n2;
+            }
+            cblas_dcopy(A.m, work, 1, A(0, n1/A.nb) + (n1%A.nb)*lda0, 1);
+            i++;
+        }
+    }
+}
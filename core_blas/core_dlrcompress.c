@@ -0,0 +1,120 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlrcompress.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Compresses the m-by-n tile A in place into the product
+ *
+ *    \f[ A = U \times V^T, \f]
+ *
+ *  of its truncated singular value decomposition, U = U_k S_k and V = V_k,
+ *  where k is the number of singular values above tol. U is stored in the
+ *  first k columns of A, with its leading dimension, and V after it, with
+ *  the leading dimension n. A stays dense when the factors do not fit in
+ *  its storage, k*(lda+n) > lda*n.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] tol
+ *          The singular values not above tol are dropped. tol >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n dense tile A.
+ *          On exit, the factors U and V, or A unchanged if it stays dense.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] rank
+ *          The rank k of the factors, or -1 if A stays dense.
+ *
+ * @param work
+ *          Workspace of size m*n + min(m,n)*(m+n) + 2*min(m,n).
+ *
+ ******************************************************************************/
+void core_dlrcompress(int m, int n, double tol,
+                      double *A, int lda, int *rank,
+                      double *work)
+{
+    int mn = imin(m, n);
+    if (mn == 0) {
+        *rank = 0;
+        return;
+    }
+
+    double *W  = work;
+    double *U  = &W[(size_t)m*n];
+    double *VT = &U[(size_t)m*mn];
+    double *s = (double*)&VT[(size_t)mn*n];
+    double *superb = &s[mn];
+
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'G', m, n, A, lda, W, m);
+    int info = LAPACKE_dgesvd(LAPACK_COL_MAJOR, 'S', 'S', m, n,
+                              W, m, s, U, m, VT, mn, superb);
+    if (info != 0) {
+        *rank = -1;
+        return;
+    }
+
+    int k = 0;
+    while (k < mn && s[k] > tol)
+        k++;
+    if ((size_t)k*(lda+n) > (size_t)lda*n) {
+        *rank = -1;
+        return;
+    }
+
+    // U = U_k S_k, V = V_k
+    double *V = &A[(size_t)lda*k];
+    for (int j = 0; j < k; j++) {
+        for (int i = 0; i < m; i++)
+            A[lda*j+i] = U[m*j+i]*s[j];
+        for (int i = 0; i < n; i++)
+            V[n*j+i] = (VT[mn*i+j]);
+    }
+    *rank = k;
+}
+
+/******************************************************************************/
+void core_omp_dlrcompress(int m, int n, double tol,
+                          double *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dlrcompress", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            double *W = (double*)work.spaces[tid];
+            core_dlrcompress(m, n, tol, A, lda, rank, W);
+        }
+        PLASMA_TRACE_STOP("dlrcompress", 1, A);
+    }
+}
@@ -0,0 +1,297 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlrgemm.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Performs the update of an off-diagonal tile of the tile low-rank
+ *  Cholesky factorization,
+ *
+ *    \f[ C = C - A \times B^T, \f]
+ *
+ *  where A, B and C are each dense or compressed as U*V^T by
+ *  core_dlrcompress. When A or B is compressed, the product is formed as
+ *  X*Y^T, of the lower of their ranks. A dense C is updated by it. A
+ *  compressed C is recompressed as [Uc X]*[Vc -Y]^T: the QR factorizations
+ *  of both blocks reduce it to the singular value decomposition of the
+ *  product of their R factors, truncated at tol. C is expanded when the
+ *  ranks add up to its size, or both A and B are dense, and compressed
+ *  again, or left dense when the truncated factors do not fit in its
+ *  storage.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tiles A and C. m >= 0.
+ *
+ * @param[in] n
+ *          The number of rows of the tile B, and columns of C. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tiles A and B. k >= 0.
+ *
+ * @param[in] tol
+ *          The singular values not above tol are dropped. tol >= 0.
+ *
+ * @param[in] A
+ *          The m-by-k tile A, dense or compressed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] ranka
+ *          The rank of the factors of A, or -1 if A is dense.
+ *
+ * @param[in] B
+ *          The n-by-k tile B, dense or compressed.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[in] rankb
+ *          The rank of the factors of B, or -1 if B is dense.
+ *
+ * @param[in,out] C
+ *          On entry, the m-by-n tile C, dense or compressed.
+ *          On exit, C - A*B^T, dense or compressed.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param[in,out] rankc
+ *          The rank of the factors of C, or -1 if C is dense.
+ *
+ * @param work
+ *          Workspace of size 9*b*b + 3*b, where b = max(m,n,k).
+ *
+ ******************************************************************************/
+void core_dlrgemm(int m, int n, int k, double tol,
+                  const double *A, int lda, const int *ranka,
+                  const double *B, int ldb, const int *rankb,
+                        double *C, int ldc, int *rankc,
+                  double *work)
+{
+    if (m == 0 || n == 0)
+        return;
+
+    double zzero =  0.0;
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    int ra = *ranka;
+    int rb = *rankb;
+    int rc = *rankc;
+
+    double *XY = work;
+    double *G  = &XY[(size_t)imax(m, n)*k];
+    double *w  = &G[(size_t)k*k];
+
+    //============================================
+    // Form A*B^T as X*Y^T, unless both are dense.
+    //============================================
+    const double *X = A;
+    const double *Y = B;
+    int ldx = lda;
+    int ldy = ldb;
+    int r = -1;
+    if (ra >= 0 && rb >= 0) {
+        // G = Va^T*Vb, then X*Y^T = Ua*(Ub*G^T)^T or (Ua*G)*Ub^T
+        cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                    ra, rb, k,
+                    (zone),  &A[(size_t)lda*ra], k,
+                                        &B[(size_t)ldb*rb], k,
+                    (zzero), G, imax(1, ra));
+        if (ra <= rb) {
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                        n, ra, rb,
+                        (zone),  B, ldb,
+                                            G, imax(1, ra),
+                        (zzero), XY, n);
+            Y = XY;
+            ldy = n;
+            r = ra;
+        }
+        else {
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, rb, ra,
+                        (zone),  A, lda,
+                                            G, ra,
+                        (zzero), XY, m);
+            X = XY;
+            ldx = m;
+            r = rb;
+        }
+    }
+    else if (ra >= 0) {
+        // Y = B*Va
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    n, ra, k,
+                    (zone),  B, ldb,
+                                        &A[(size_t)lda*ra], k,
+                    (zzero), XY, n);
+        Y = XY;
+        ldy = n;
+        r = ra;
+    }
+    else if (rb >= 0) {
+        // X = A*Vb
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m, rb, k,
+                    (zone),  A, lda,
+                                        &B[(size_t)ldb*rb], k,
+                    (zzero), XY, m);
+        X = XY;
+        ldx = m;
+        r = rb;
+    }
+    if (r == 0)
+        return;
+    int kr = r < 0 ? k : r;
+
+    //============================================
+    // dense C
+    //============================================
+    if (rc < 0) {
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                    m, n, kr,
+                    (zmone), X, ldx,
+                                        Y, ldy,
+                    (zone),  C, ldc);
+        return;
+    }
+
+    //============================================
+    // compressed C, expanded and compressed again
+    //============================================
+    int mn = imin(m, n);
+    int s = rc + r;
+    if (r < 0 || s >= mn) {
+        core_dlrdecompress(m, n, C, ldc, rankc, w);
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                    m, n, kr,
+                    (zmone), X, ldx,
+                                        Y, ldy,
+                    (zone),  C, ldc);
+        core_dlrcompress(m, n, tol, C, ldc, rankc, w);
+        return;
+    }
+
+    //============================================
+    // compressed C, recompressed
+    //============================================
+    double *Qu  = w;
+    double *Qv  = &Qu[(size_t)m*s];
+    double *Ru  = &Qv[(size_t)n*s];
+    double *Rv  = &Ru[(size_t)s*s];
+    double *M   = &Rv[(size_t)s*s];
+    double *P   = &M[(size_t)s*s];
+    double *QT  = &P[(size_t)s*s];
+    double *tau = &QT[(size_t)s*s];
+    double *sv = (double*)&tau[s];
+    double *superb = &sv[s];
+
+    // Qu = [Uc X], Qv = [Vc -Y]
+    const double *Vc = &C[(size_t)ldc*rc];
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'G', m, rc, C, ldc, Qu, m);
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'G', m, r, X, ldx,
+                        &Qu[(size_t)m*rc], m);
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'G', n, rc, Vc, n, Qv, n);
+    for (int j = 0; j < r; j++)
+        for (int i = 0; i < n; i++)
+            Qv[(size_t)n*(rc+j)+i] = -Y[(size_t)ldy*j+i];
+
+    // Qu*Ru and Qv*Rv
+    LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, s, Qu, m, tau);
+    LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', s, s, zzero, zzero, Ru, s);
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'U', s, s, Qu, m, Ru, s);
+    LAPACKE_dorgqr(LAPACK_COL_MAJOR, m, s, s, Qu, m, tau);
+
+    LAPACKE_dgeqrf(LAPACK_COL_MAJOR, n, s, Qv, n, tau);
+    LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', s, s, zzero, zzero, Rv, s);
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'U', s, s, Qv, n, Rv, s);
+    LAPACKE_dorgqr(LAPACK_COL_MAJOR, n, s, s, Qv, n, tau);
+
+    // M = Ru*Rv^T = P*S*QT
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                s, s, s,
+                (zone),  Ru, s,
+                                    Rv, s,
+                (zzero), M, s);
+    int info = LAPACKE_dgesvd(LAPACK_COL_MAJOR, 'S', 'S', s, s,
+                              M, s, sv, P, s, QT, s, superb);
+
+    int kc = 0;
+    while (kc < s && sv[kc] > tol)
+        kc++;
+    if (info != 0 || (size_t)kc*(ldc+n) > (size_t)ldc*n) {
+        // Expand C, whose factors are still in place.
+        core_dlrdecompress(m, n, C, ldc, rankc, w);
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                    m, n, r,
+                    (zmone), X, ldx,
+                                        Y, ldy,
+                    (zone),  C, ldc);
+        return;
+    }
+
+    // Uc = Qu*P_k*S_k, Vc = Qv*QT_k^T
+    for (int j = 0; j < kc; j++)
+        for (int i = 0; i < s; i++)
+            P[(size_t)s*j+i] *= sv[j];
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                m, kc, s,
+                (zone),  Qu, m,
+                                    P, s,
+                (zzero), C, ldc);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                n, kc, s,
+                (zone),  Qv, n,
+                                    QT, s,
+                (zzero), &C[(size_t)ldc*kc], n);
+    *rankc = kc;
+}
+
+/******************************************************************************/
+void core_omp_dlrgemm(int m, int n, int k, double tol,
+                      const double *A, int lda, const int *ranka,
+                      const double *B, int ldb, const int *rankb,
+                            double *C, int ldc, int *rankc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*k]) \
+                     depend(in:B[0:ldb*k]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dlrgemm", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            double *W = (double*)work.spaces[tid];
+            core_dlrgemm(m, n, k, tol,
+                         A, lda, ranka,
+                         B, ldb, rankb,
+                         C, ldc, rankc,
+                         W);
+        }
+        PLASMA_TRACE_STOP("dlrgemm", 1, C, A, B);
+    }
+}
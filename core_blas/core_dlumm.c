@@ -0,0 +1,78 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlumm.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lumm
+ *
+ *  Computes the product U * L, where the upper triangular factor U is
+ *  stored in the upper triangular part of the array A, and the unit
+ *  lower triangular factor L is stored in the strictly lower triangular
+ *  part of A. The product overwrites A, without workspace.
+ *
+ *  Column j of the product is U(:, j:n) * L(j:n, j). The rows above the
+ *  diagonal only read the column of L, and the rows below the diagonal
+ *  are the triangular product U(j+1:n, j+1:n) * L(j+1:n, j), computed in
+ *  place. The columns on the left of j are not read any more.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the factors U and L.
+ *          On exit, the product U * L.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ ******************************************************************************/
+void core_dlumm(int n, double *A, int lda)
+{
+    double zone = 1.0;
+
+    for (int j = 0; j < n-1; j++) {
+        // A(0:j, j) += A(0:j, j+1:n) * L(j+1:n, j)
+        cblas_dgemv(CblasColMajor, CblasNoTrans,
+                    j+1, n-j-1,
+                    (zone), &A[(j+1)*lda], lda,
+                                       &A[j+1 + j*lda], 1,
+                    (zone), &A[j*lda], 1);
+
+        // L(j+1:n, j) = U(j+1:n, j+1:n) * L(j+1:n, j)
+        cblas_dtrmv(CblasColMajor, CblasUpper, CblasNoTrans, CblasNonUnit,
+                    n-j-1,
+                    &A[j+1 + (j+1)*lda], lda,
+                    &A[j+1 + j*lda], 1);
+    }
+}
+
+/******************************************************************************/
+void core_omp_dlumm(int n, double *A, int lda,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dlumm", A);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dlumm(n, A, lda);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           2.0/3.0*n*n*n, 2.0*n*n);
+        PLASMA_TRACE_STOP("dlumm", 1, A);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zunmqr.c, normal z -> d, Mon Feb  6 14:07:02 2017
+ * @generated from core_blas/core_zunmqr.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -240,14 +240,13 @@ void core_omp_dormqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-#if defined(USE_OMPEXT)
-omp_set_task_name("dormqr");
-#endif
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dormqr", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             double *W = (double*)work.spaces[tid];
@@ -266,5 +265,12 @@ omp_set_task_name("dormqr");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           side == PlasmaLeft ? 4.0*m*n*k - 2.0*n*k*k
+                                              : 4.0*m*n*k - 2.0*m*k*k,
+                           2.0*m*n +
+                           ((side == PlasmaLeft ? m : n) + ib)*(double)k);
+        PLASMA_TRACE_STOP("dormqr", 1, C, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
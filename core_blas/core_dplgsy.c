@@ -0,0 +1,104 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zplgsy.c, normal z -> d, Thu Oct 15 05:12:54 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#define REAL
+
+#ifdef COMPLEX
+#define NBELEM 2
+#else
+#define NBELEM 1
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_plrnt
+ *
+ *  Generates the m-by-n block at rows m0 and columns n0 of a random
+ *  symmetric matrix of order bigm, with bump added to its diagonal.
+ *  The elements (i, j) with i >= j are those of core_dplrnt, and the
+ *  elements (i, j) with i < j are copied from (j, i), so that, as with
+ *  core_dplrnt, the matrix does not depend on the blocks it is generated by.
+ *  With |bump| >= bigm, the matrix is diagonally dominant.
+ *
+ *******************************************************************************
+ *
+ * @param[in] bump
+ *          The scalar added to the diagonal.
+ *
+ * @param[in] m
+ *          The number of rows of the block A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the block A. n >= 0.
+ *
+ * @param[out] A
+ *          The m-by-n block.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] bigm
+ *          The order of the matrix the block is part of.
+ *
+ * @param[in] m0
+ *          The row of the matrix of the first row of the block.
+ *
+ * @param[in] n0
+ *          The column of the matrix of the first column of the block.
+ *
+ * @param[in] seed
+ *          The seed of the random numbers.
+ *
+ ******************************************************************************/
+void core_dplgsy(double bump,
+                 int m, int n, double *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed)
+{
+    // the lower triangle and the diagonal, down the columns
+    for (int j = 0; j < n; j++) {
+        int i0 = imax(0, n0+j-m0);
+        if (i0 >= m)
+            continue;
+        unsigned long long ran = core_rnd64_jump(
+            NBELEM*(m0+i0+(unsigned long long)bigm*(n0+j)), seed);
+        for (int i = i0; i < m; i++) {
+            double a = core_rnd64_real(ran);
+            ran = core_rnd64_next(ran);
+#ifdef COMPLEX
+            a += core_rnd64_real(ran)*I;
+            ran = core_rnd64_next(ran);
+#endif
+            A[i+(size_t)lda*j] = m0+i == n0+j ? a+bump : a;
+        }
+    }
+    // the upper triangle, along the rows, from the columns of the lower
+    for (int i = 0; i < m; i++) {
+        int j0 = imax(0, m0+i+1-n0);
+        if (j0 >= n)
+            continue;
+        unsigned long long ran = core_rnd64_jump(
+            NBELEM*(n0+j0+(unsigned long long)bigm*(m0+i)), seed);
+        for (int j = j0; j < n; j++) {
+            double a = core_rnd64_real(ran);
+            ran = core_rnd64_next(ran);
+#ifdef COMPLEX
+            a += core_rnd64_real(ran)*I;
+            ran = core_rnd64_next(ran);
+#endif
+            A[i+(size_t)lda*j] = a;
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpstrf.c, normal z -> d, Thu Oct 15 08:37:15 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_barrier.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <assert.h>
+#include <math.h>
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define E(i, j) core_dpstrf_elem(A, i, j)
+
+/******************************************************************************/
+// Returns the address of the element (i, j) of the tile matrix A.
+static inline double *core_dpstrf_elem(plasma_desc_t A,
+                                                   int i, int j)
+{
+    double *a = A(i/A.mb, j/A.nb);
+    return &a[i%A.mb + (size_t)plasma_tile_mmain(A, i/A.mb)*(j%A.nb)];
+}
+
+/***************************************************************************//**
+ * @ingroup core_pstrf
+ *
+ *  Performs the Cholesky factorization with complete pivoting of the
+ *  symmetric positive semidefinite matrix A, of which the lower triangle is
+ *  referenced,
+ *
+ *    \f[ P^T A P = L \times L^T, \f]
+ *
+ *  on a team of size ranks meeting at the barrier, and stops once the
+ *  largest remaining diagonal element falls to the tolerance.
+ *
+ *  The factorization is left-looking, as LAPACK zpstf2: column j of L is
+ *  computed from the columns left of it only, and the remaining diagonal
+ *  is kept up to date in diag, so that the trailing matrix is never
+ *  updated and a factor of rank r costs O(n r^2). The ranks compute the
+ *  column in the tile rows dealt to them cyclically and search their
+ *  largest diagonal element on the way, as in core_dgetrf(); rank 0
+ *  reduces the candidates and swaps the pivot into place.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          On entry, the symmetric positive semidefinite matrix A, of which
+ *          the lower triangle is referenced.
+ *          On exit, the columns 0 to r-1 of the lower triangle hold the
+ *          factor L, with r the return value. The trailing r:n, r:n block
+ *          holds the permuted entries of A, not updated.
+ *
+ * @param[out] piv
+ *          The permutation P, 1-based: row k of P^T A P is row piv[k]
+ *          of A. Of size n.
+ *
+ * @param[in] tol
+ *          The factorization stops at the first pivot lower than or equal
+ *          to tol. If tol < 0, n*eps*max(diag(A)) is used.
+ *
+ * @param[out] diag
+ *          Workspace of size n, shared by the team.
+ *
+ * @param[out] x
+ *          Workspace of size n, shared by the team.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread in the team.
+ *
+ * @param[in] size
+ *          The number of ranks of the team.
+ *
+ * @param[in] work
+ *          The workspace of the max reduction, of size at least size.
+ *
+ * @param[in] barrier
+ *          The barrier of the team.
+ *
+ *******************************************************************************
+ *
+ * @return On rank 0, the number of columns of L, that is the rank of A
+ *         within the tolerance; 0 on the other ranks.
+ *
+ ******************************************************************************/
+int core_dpstrf(plasma_desc_t A, int *piv, double tol,
+                double *diag, double *x,
+                int rank, int size,
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier)
+{
+    // Arrays for parallel max search, shared by the team.
+    assert(work->size >= size);
+    int *max_idx = work->max_idx;
+    double *max_val = (double*)work->max_val;
+
+    // The rank of A, set by rank 0 once the factorization stops.
+    if (rank == 0)
+        work->info = -1;
+
+    // diagonal and its largest element
+    max_idx[rank] = 0;
+    max_val[rank] = -1.0;
+    for (int l = rank; l < A.mt; l += size) {
+        int mval = plasma_tile_mview(A, l);
+        for (int i = l*A.mb; i < l*A.mb+mval; i++) {
+            diag[i] = creal(*E(i, i));
+            piv[i] = i+1;
+            if (diag[i] > max_val[rank]) {
+                max_val[rank] = diag[i];
+                max_idx[rank] = i;
+            }
+        }
+    }
+
+    double dstop = tol;
+    for (int j = 0; j < A.n; j++) {
+        plasma_barrier_wait(barrier, rank);
+        if (rank == 0) {
+            // max reduction
+            for (int i = 1; i < size; i++) {
+                if (max_val[i] > max_val[0]) {
+                    max_val[0] = max_val[i];
+                    max_idx[0] = max_idx[i];
+                }
+            }
+            int p = max_idx[0];
+            double ajj = diag[p];
+            if (j == 0 && tol < 0.0)
+                dstop = A.n*LAPACKE_dlamch_work('E')*ajj;
+
+            // stop at a small pivot
+            if (ajj <= dstop || isnan(ajj)) {
+                work->info = j;
+            }
+            else {
+                // symmetric pivot swap in the lower triangle
+                if (p != j) {
+                    double ztmp;
+                    ztmp = *E(j, j); *E(j, j) = *E(p, p); *E(p, p) = ztmp;
+                    for (int c = 0; c < j; c++) {
+                        ztmp = *E(j, c); *E(j, c) = *E(p, c); *E(p, c) = ztmp;
+                    }
+                    for (int i = p+1; i < A.n; i++) {
+                        ztmp = *E(i, j); *E(i, j) = *E(i, p); *E(i, p) = ztmp;
+                    }
+                    for (int i = j+1; i < p; i++) {
+                        ztmp = (*E(i, j));
+                        *E(i, j) = (*E(p, i));
+                        *E(p, i) = ztmp;
+                    }
+                    *E(p, j) = (*E(p, j));
+
+                    double dtmp = diag[j]; diag[j] = diag[p]; diag[p] = dtmp;
+                    int itmp = piv[j]; piv[j] = piv[p]; piv[p] = itmp;
+                }
+                *E(j, j) = sqrt(ajj);
+
+                // row j of L, conjugated, for the update of column j
+                for (int c = 0; c < j; c++)
+                    x[c] = (*E(j, c));
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+        if (work->info >= 0)
+            break;
+
+        // column j of L, the remaining diagonal, and the search of
+        // the next pivot (all ranks)
+        double rajj = 1.0/creal(*E(j, j));
+        int jt = j/A.mb;
+        max_idx[rank] = j+1;
+        max_val[rank] = -1.0;
+        for (int l = rank; l < A.mt; l += size) {
+            if (l < jt)
+                continue;
+
+            double *al = A(l, jt);
+            int ldal = plasma_tile_mmain(A, l);
+            int i0 = l == jt ? j%A.mb+1 : 0;
+            int mi = plasma_tile_mview(A, l)-i0;
+            if (mi <= 0)
+                continue;
+
+            double *aj = &al[i0+(size_t)ldal*(j%A.nb)];
+            double zone  =  1.0;
+            double zmone = -1.0;
+            for (int c = 0; c <= jt; c++) {
+                int nc = c < jt ? plasma_tile_nview(A, c) : j%A.nb;
+                if (nc > 0)
+                    cblas_dgemv(CblasColMajor, CblasNoTrans,
+                                mi, nc,
+                                (zmone), &(A(l, c))[i0], ldal,
+                                                    &x[c*A.nb], 1,
+                                (zone),  aj, 1);
+            }
+            cblas_dscal(mi, rajj, aj, 1);
+
+            for (int i = 0; i < mi; i++) {
+                int row = l*A.mb+i0+i;
+                double a = fabs(aj[i]);
+                diag[row] -= a*a;
+                if (diag[row] > max_val[rank]) {
+                    max_val[rank] = diag[row];
+                    max_idx[rank] = row;
+                }
+            }
+        }
+    }
+
+    // Only rank 0 returns the rank.
+    if (rank == 0)
+        return work->info >= 0 ? work->info : A.n;
+    else
+        return 0;
+}
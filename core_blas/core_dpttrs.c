@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpttrs.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pttrf
+ *
+ *  Solves A X = B for a symmetric positive definite tridiagonal matrix A
+ *  factored by core_dpttrf_spike().
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of B. nrhs >= 0.
+ *
+ * @param[in] d
+ *          The n diagonal elements of D.
+ *
+ * @param[in] e
+ *          The n-1 subdiagonal elements of the unit bidiagonal L.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, the solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ ******************************************************************************/
+void core_dpttrs(int n, int nrhs,
+                 const double *d, const double *e,
+                 double *B, int ldb)
+{
+#ifdef COMPLEX
+    LAPACKE_dpttrs_work(LAPACK_COL_MAJOR, 'L', n, nrhs, d, e, B, ldb);
+#else
+    LAPACKE_dpttrs_work(LAPACK_COL_MAJOR, n, nrhs, d, e, B, ldb);
+#endif
+}
+
+/******************************************************************************/
+// The factors of the partition are tracked through d.
+void core_omp_dpttrs(int n, int nrhs,
+                     const double *d, const double *e,
+                     double *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:d[0:n]) \
+                     depend(inout:B[0:ldb*nrhs]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dpttrs", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dpttrs(n, nrhs, d, e, B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 5.0*n*nrhs,
+                           2.0*n + 2.0*n*nrhs);
+        PLASMA_TRACE_STOP("dpttrs", 1, B, d);
+    }
+}
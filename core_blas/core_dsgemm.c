@@ -0,0 +1,210 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zcgemm.c, mixed zc -> ds, Thu Oct 15 08:00:08 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *    \f[ C = \alpha [op( A )\times op( B )] + \beta C, \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *    \f[ op( X ) = X^H, \f]
+ *
+ *  on tiles each stored in double or single complex precision. A tile in
+ *  single precision is held at the beginning of its double precision storage,
+ *  with the same leading dimension. The product is computed in the precision
+ *  of C, after converting the operands in the other precision into work.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B is not transposed,
+ *          - PlasmaTrans:     B is transposed,
+ *          - PlasmaConjTrans: B is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( A ) and of the matrix C.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix op( B ) and of the matrix C.
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A ) and the number of rows
+ *          of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          An lda-by-ka matrix, where ka is k when transa = PlasmaNoTrans,
+ *          and is m otherwise.
+ *
+ * @param[in] preca
+ *          The precision of A, PlasmaRealDouble or PlasmaRealFloat.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          When transa = PlasmaNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] B
+ *          An ldb-by-kb matrix, where kb is n when transb = PlasmaNoTrans,
+ *          and is k otherwise.
+ *
+ * @param[in] precb
+ *          The precision of B, PlasmaRealDouble or PlasmaRealFloat.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          An ldc-by-n matrix. On exit, the array is overwritten by the m-by-n
+ *          matrix ( alpha*op( A )*op( B ) + beta*C ).
+ *
+ * @param[in] precc
+ *          The precision of C, PlasmaRealDouble or PlasmaRealFloat.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *          Workspace of size m*k + k*n.
+ *
+ ******************************************************************************/
+void core_dsgemm(plasma_enum_t transa, plasma_enum_t transb,
+                 int m, int n, int k,
+                 double alpha,
+                 const double *A, plasma_enum_t preca, int lda,
+                 const double *B, plasma_enum_t precb, int ldb,
+                 double beta,
+                       double *C, plasma_enum_t precc, int ldc,
+                 double *work)
+{
+    int am = transa == PlasmaNoTrans ? m : k;
+    int an = transa == PlasmaNoTrans ? k : m;
+    int bm = transb == PlasmaNoTrans ? k : n;
+    int bn = transb == PlasmaNoTrans ? n : k;
+    double *Aw = work;
+    double *Bw = &work[(size_t)am*an];
+
+    if (precc == PlasmaRealDouble) {
+        const double *pA = A;
+        const double *pB = B;
+        int ldpa = lda;
+        int ldpb = ldb;
+        if (preca == PlasmaRealFloat) {
+            core_slag2d(am, an, (float*)A, lda, Aw, am);
+            pA = Aw;
+            ldpa = imax(1, am);
+        }
+        if (precb == PlasmaRealFloat) {
+            core_slag2d(bm, bn, (float*)B, ldb, Bw, bm);
+            pB = Bw;
+            ldpb = imax(1, bm);
+        }
+        core_dgemm(transa, transb,
+                   m, n, k,
+                   alpha, pA, ldpa,
+                          pB, ldpb,
+                   beta,  C, ldc);
+    }
+    else {
+        const float *pA = (const float*)A;
+        const float *pB = (const float*)B;
+        int ldpa = lda;
+        int ldpb = ldb;
+        if (preca == PlasmaRealDouble) {
+            core_dlag2s(am, an, (double*)A, lda,
+                        (float*)Aw, am);
+            pA = (float*)Aw;
+            ldpa = imax(1, am);
+        }
+        if (precb == PlasmaRealDouble) {
+            core_dlag2s(bm, bn, (double*)B, ldb,
+                        (float*)Bw, bm);
+            pB = (float*)Bw;
+            ldpb = imax(1, bm);
+        }
+        core_sgemm(transa, transb,
+                   m, n, k,
+                   (float)alpha, pA, ldpa,
+                                              pB, ldpb,
+                   (float)beta,  (float*)C, ldc);
+    }
+}
+
+/******************************************************************************/
+void core_omp_dsgemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha,
+    const double *A, plasma_enum_t preca, int lda,
+    const double *B, plasma_enum_t precb, int ldb,
+    double beta,
+          double *C, plasma_enum_t precc, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dsgemm", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            double *W = (double*)work.spaces[tid];
+            core_dsgemm(transa, transb,
+                        m, n, k,
+                        alpha, A, preca, lda,
+                               B, precb, ldb,
+                        beta,  C, precc, ldc,
+                        W);
+        }
+        PLASMA_TRACE_STOP("dsgemm", 1, C, A, B);
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zssssm.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ssssm
+ *
+ *  Applies the transformations of core_dtstrf, which factored an upper
+ *  triangular tile coupled with a tile below it, to the tile A1 coupled
+ *  with the m2-by-n tile A2 below it, block of ib columns of the factors
+ *  by block of ib columns. For the block of the columns j to j+sb-1:
+ *
+ *    | A1(j:j+sb-1, :) | = | L1  0 |^{-1} * P * | A1(j:j+sb-1, :) |
+ *    | A2              |   | L2  I |            | A2              |
+ *
+ *  where P interchanges the rows of A1(j:j+sb-1, :) and A2, L1 is the
+ *  sb-by-sb unit lower triangular block of L, and L2 the columns j to
+ *  j+sb-1 of the factored tile below.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m2
+ *          The number of rows of the tile A2. m2 >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the factors, and rows of A1 updated.
+ *          k >= 0.
+ *
+ * @param[in] ib
+ *          The inner-blocking size of core_dtstrf. ib > 0.
+ *
+ * @param[in,out] A1
+ *          On entry, the tile A1, of at least k rows.
+ *          On exit, updated by the transformations.
+ *
+ * @param[in] lda1
+ *          The leading dimension of the array A1. lda1 >= max(1,k).
+ *
+ * @param[in,out] A2
+ *          On entry, the m2-by-n tile A2.
+ *          On exit, updated by the transformations.
+ *
+ * @param[in] lda2
+ *          The leading dimension of the array A2. lda2 >= max(1,m2).
+ *
+ * @param[in] L1
+ *          The ib-by-k blocks L1 of core_dtstrf.
+ *
+ * @param[in] ldl1
+ *          The leading dimension of the array L1. ldl1 >= max(1,ib).
+ *
+ * @param[in] L2
+ *          The m2-by-k factors L2 of core_dtstrf.
+ *
+ * @param[in] ldl2
+ *          The leading dimension of the array L2. ldl2 >= max(1,m2).
+ *
+ * @param[in] ipiv
+ *          The k pivot indices of core_dtstrf.
+ *
+ ******************************************************************************/
+void core_dssssm(int m2, int n, int k, int ib,
+                       double *A1, int lda1,
+                       double *A2, int lda2,
+                 const double *L1, int ldl1,
+                 const double *L2, int ldl2,
+                 const int *ipiv)
+{
+    if (n == 0 || k == 0)
+        return;
+
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    for (int j = 0; j < k; j += ib) {
+        int sb = imin(ib, k-j);
+
+        // Interchange the rows of the block and of A2, in order.
+        for (int i = 0; i < sb; i++) {
+            int p = ipiv[j+i]-1;
+            if (p < sb) {
+                if (p != i)
+                    cblas_dswap(n, &A1[j+i], lda1, &A1[j+p], lda1);
+            }
+            else {
+                cblas_dswap(n, &A1[j+i], lda1, &A2[p-sb], lda2);
+            }
+        }
+        cblas_dtrsm(CblasColMajor, CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    sb, n,
+                    (zone), &L1[ldl1*j], ldl1,
+                                       &A1[j],      lda1);
+        if (m2 > 0) {
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m2, n, sb,
+                        (zmone), &L2[ldl2*j], ldl2,
+                                            &A1[j],      lda1,
+                        (zone),  A2,          lda2);
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_dssssm(int m2, int n, int k, int ib,
+                           double *A1, int lda1,
+                           double *A2, int lda2,
+                     const double *L1, int ldl1,
+                     const double *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A1[0:lda1*n]) \
+                     depend(inout:A2[0:lda2*n]) \
+                     depend(in:L1[0:ldl1*k]) \
+                     depend(in:L2[0:ldl2*k]) \
+                     depend(in:ipiv[0:k]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dssssm", A1);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dssssm(m2, n, k, ib,
+                        A1, lda1,
+                        A2, lda2,
+                        L1, ldl1,
+                        L2, ldl2,
+                        ipiv);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           (double)ib*k*n + 2.0*m2*k*n,
+                           2.0*k*n + 2.0*m2*n + (double)m2*k + (double)ib*k);
+        PLASMA_TRACE_STOP("dssssm", 2, A1, A2, L1, L2);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zhegst.c, normal z -> d, Thu Oct 15 08:31:46 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_hegst
+ *
+ *  Reduces a symmetric-definite generalized eigenproblem to standard form.
+ *
+ *  If itype = 1, the problem is A*x = lambda*B*x,
+ *  and A is overwritten by inv(U^T)*A*inv(U) or inv(L)*A*inv(L^T).
+ *
+ *  If itype = 2 or 3, the problem is A*B*x = lambda*x or
+ *  B*A*x = lambda*x, and A is overwritten by U*A*U^T or L^T*A*L.
+ *
+ *  B must have been previously factorized as U^T*U or L*L^T by potrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in] itype
+ *          - 1: compute inv(U^T)*A*inv(U) or inv(L)*A*inv(L^T);
+ *          - 2 or 3: compute U*A*U^T or L^T*A*L.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored and B is factored
+ *                         as U^T*U;
+ *          - PlasmaLower: Lower triangle of A is stored and B is factored
+ *                         as L*L^T.
+ *
+ * @param[in] n
+ *          The order of the matrices A and B. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the symmetric matrix A. On exit, the transformed
+ *          matrix, stored in the same format as A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] B
+ *          The triangular factor from the Cholesky factorization of B,
+ *          as returned by potrf.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @retval PlasmaSuccess on successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int core_dsygst(int itype, plasma_enum_t uplo,
+                int n,
+                      double *A, int lda,
+                const double *B, int ldb)
+{
+    return LAPACKE_dsygst_work(LAPACK_COL_MAJOR,
+                               itype, lapack_const(uplo),
+                               n, A, lda, B, ldb);
+}
+
+/******************************************************************************/
+void core_omp_dsygst(int itype, plasma_enum_t uplo,
+                     int n,
+                           double *A, int lda,
+                     const double *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(in:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dsygst", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_dsygst(itype, uplo,
+                                   n,
+                                   A, lda,
+                                   B, ldb);
+            if (info != PlasmaSuccess) {
+                coreblas_error("core_dsygst() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+        PLASMA_TRACE_STOP("dsygst", 1, A, B);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
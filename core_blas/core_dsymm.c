@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsymm.c, normal z -> d, Mon Feb  6 14:06:54 2017
+ * @generated from core_blas/core_zsymm.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -108,13 +108,16 @@ void core_omp_dsymm(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*n]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dsymm", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dsymm(side, uplo,
                        m, n,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+        PLASMA_TRACE_STOP("dsymm", 1, C, A, B);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsyr2k.c, normal z -> d, Mon Feb  6 14:06:55 2017
+ * @generated from core_blas/core_zsyr2k.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -118,13 +118,16 @@ void core_omp_dsyr2k(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dsyr2k", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dsyr2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        PLASMA_TRACE_STOP("dsyr2k", 1, C, A, B);
     }
 }
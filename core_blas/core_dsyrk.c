@@ -6,11 +6,13 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsyrk.c, normal z -> d, Sat Feb  4 20:58:59 2017
+ * @generated from core_blas/core_zsyrk.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
+#include "plasma_runtime.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -82,6 +84,18 @@ void core_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 (beta),  C, ldc);
 }
 
+/******************************************************************************/
+// Runs the syrk of a task replayed from a task graph.
+static void core_dsyrk_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_dsyrk(task->param[0], task->param[1],
+               task->dim[0], task->dim[1],
+               task->alpha, tiles[1], task->dim[2],
+               task->beta,  tiles[0], task->dim[3]);
+}
+
 /******************************************************************************/
 void core_omp_dsyrk(
     plasma_enum_t uplo, plasma_enum_t trans,
@@ -90,22 +104,66 @@ void core_omp_dsyrk(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_dsyrk_replay,
+            .param = {uplo, trans},
+            .dim = {n, k, lda, ldc},
+            .alpha = alpha, .beta = beta};
+        PLASMA_GRAPH_ADD(task, 1, C, A);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
     else
         ak = n;
 
-#if defined(USE_OMPEXT)
-omp_set_task_name("dsyrk");
-#endif
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dsyrk", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dsyrk(uplo, trans,
+                       n, k,
+                       alpha, A, lda,
+                       beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, (double)k*n*(n+1),
+                           (double)n*k + (double)n*(n+1));
+        PLASMA_TRACE_STOP("dsyrk", 1, C, A);
+    }
+}
+
+/******************************************************************************/
+// Same as core_omp_dsyrk, with a commutative dependency on C, for the
+// accumulations into C in any order.
+void core_omp_dsyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    double alpha, const double *A, int lda,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    PLASMA_TASK(PLASMA_IN(A, 0, lda*ak)
+                PLASMA_COMMUTE(C, 0, ldc*n)
+                PLASMA_PRIORITY(plasma_sequence_priority(sequence)))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dsyrk", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dsyrk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, (double)k*n*(n+1),
+                           (double)n*k + (double)n*(n+1));
+        PLASMA_TRACE_STOP("dsyrk", 1, C, A);
     }
 }
@@ -0,0 +1,97 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zherk_device.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_device.h"
+#include "plasma_types.h"
+
+#if defined(PLASMA_WITH_CUDA)
+
+/***************************************************************************//**
+ *
+ * @ingroup core_herk
+ *
+ *  Performs core_dsyrk with cuBLAS, on the stream of the calling thread.
+ *  A is read through the device tile cache, and C is copied to the device
+ *  and back, so that C is current on the host on return.
+ *  Falls back to core_dsyrk if the device memory runs out.
+ *
+ * @see core_dsyrk
+ * @see plasma_device_tile
+ *
+ ******************************************************************************/
+void core_dsyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       double alpha, const double *A, int lda,
+                       double beta,        double *C, int ldc)
+{
+    size_t eltsize = sizeof(double);
+    int am = trans == PlasmaNoTrans ? n : k;
+    int an = trans == PlasmaNoTrans ? k : n;
+
+    plasma_device_thread_t *thread = plasma_device_thread();
+    if (thread != NULL && n > 0 && k > 0) {
+        const void *dA = plasma_device_tile(thread, A, lda, am, an, eltsize);
+        void *dC = plasma_device_work(thread, (size_t)n*n*eltsize);
+        if (dA != NULL && dC != NULL) {
+            cublasSetMatrixAsync(n, n, eltsize, C, ldc, dC, n,
+                                 thread->stream);
+            cublasStatus_t status = cublasDsyrk(
+                thread->handle,
+                plasma_device_uplo(uplo), plasma_device_trans(trans),
+                n, k,
+                &alpha, dA, am,
+                &beta,  dC, n);
+            cublasGetMatrixAsync(n, n, eltsize, dC, n, C, ldc,
+                                 thread->stream);
+            cudaStreamSynchronize(thread->stream);
+            if (status == CUBLAS_STATUS_SUCCESS)
+                return;
+        }
+    }
+    core_dsyrk(uplo, trans,
+               n, k,
+               alpha, A, lda,
+               beta,  C, ldc);
+}
+
+/******************************************************************************/
+void core_omp_dsyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           double alpha, const double *A, int lda,
+                           double beta,        double *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dsyrk_device", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_dsyrk_device(uplo, trans,
+                              n, k,
+                              alpha, A, lda,
+                              beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, (double)k*n*(n+1),
+                           (double)n*k + (double)n*(n+1));
+        PLASMA_TRACE_STOP("dsyrk_device", 1, C, A);
+    }
+}
+
+#endif // PLASMA_WITH_CUDA
@@ -0,0 +1,261 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztpqrt.c, normal z -> d, Thu Oct 15 05:28:00 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+// Factors the n columns of a panel of the triangle A1 on top of the
+// pentagon A2, whose column j has its rows 0 to m-l+j, recursively on
+// halves of the columns, with T12 as the workspace of the update of the
+// right half, as in LAPACK dgeqrt3. The work is in the products of the
+// block reflectors, so runs at the speed of gemm but in the leaves.
+static void core_dtpqrt_rec(int m, int n, int l,
+                            double *A1, int lda1,
+                            double *A2, int lda2,
+                            double *T,  int ldt)
+{
+    if (n == 1) {
+        // Generate the reflector annihilating A2(0:m-l, 0).
+        LAPACKE_dlarfg_work(imin(m-l+1, m)+1, A1, A2, 1, T);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    // Rows of the left half, of which the last l1 in its triangle.
+    int m1 = imin(m, m-l+n1);
+    int l1 = m1-(m-l);
+
+    // Factor the left half.
+    core_dtpqrt_rec(m1, n1, l1, A1, lda1, A2, lda2, T, ldt);
+
+    // Apply its block reflector to the right half from the left,
+    // with T12 as the workspace.
+    core_dparfb(PlasmaLeft, PlasmaTrans,
+                PlasmaForward, PlasmaColumnwise,
+                n1, n2, m1, n2, n1, l1,
+                &A1[lda1*n1], lda1,
+                &A2[lda2*n1], lda2,
+                A2, lda2,
+                T, ldt,
+                &T[ldt*n1], ldt);
+
+    // Factor the right half.
+    core_dtpqrt_rec(m, n2, imax(0, l-n1),
+                    &A1[lda1*n1+n1], lda1,
+                    &A2[lda2*n1],    lda2,
+                    &T[ldt*n1+n1],   ldt);
+
+    // T12 = -T11 * V1^T * V2 * T22, with V1 nonzero in its rows 0 to m1-1
+    // only, the last l1 in the upper trapezoid of V1.
+    double zzero =  0.0;
+    double zone  =  1.0;
+    double zmone = -1.0;
+    int r1 = m1-l1;
+    double *T12 = &T[ldt*n1];
+    if (l1 > 0) {
+        core_dlacpy(PlasmaGeneral,
+                    l1, n2,
+                    &A2[lda2*n1+r1], lda2,
+                    T12, ldt);
+        cblas_dtrmm(CblasColMajor,
+                    CblasLeft, CblasUpper,
+                    (CBLAS_TRANSPOSE)PlasmaTrans, CblasNonUnit,
+                    l1, n2,
+                    (zone), &A2[r1], lda2,
+                                       T12, ldt);
+    }
+    if (n1 > l1) {
+        cblas_dgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)PlasmaTrans, CblasNoTrans,
+                    n1-l1, n2, l1,
+                    (zone),  &A2[lda2*l1+r1], lda2,
+                                        &A2[lda2*n1+r1], lda2,
+                    (zzero), &T12[l1], ldt);
+    }
+    if (r1 > 0) {
+        cblas_dgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)PlasmaTrans, CblasNoTrans,
+                    n1, n2, r1,
+                    (zone), A2, lda2,
+                                       &A2[lda2*n1], lda2,
+                    (zone), T12, ldt);
+    }
+    cblas_dtrmm(CblasColMajor,
+                CblasLeft, CblasUpper,
+                CblasNoTrans, CblasNonUnit,
+                n1, n2,
+                (zmone), T, ldt,
+                                    T12, ldt);
+    cblas_dtrmm(CblasColMajor,
+                CblasRight, CblasUpper,
+                CblasNoTrans, CblasNonUnit,
+                n1, n2,
+                (zone), &T[ldt*n1+n1], ldt,
+                                   T12, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ * Computes a QR factorization of the matrix formed by coupling an n-by-n
+ * upper triangular tile A1 on top of an m-by-n pentagonal tile A2, made of
+ * m-l full rows on top of an l-by-n upper trapezoid:
+ *
+ *    | A1 | = Q * R
+ *    | A2 |
+ *
+ * l = 0 is the factorization of core_dtsqrt, of two tiles, and l = m = n
+ * that of core_dttqrt, of two triangles. The columns are factored by
+ * blocks of ib, each factored recursively, so that its reflectors are
+ * generated and applied by matrix-matrix products, and the blocks are
+ * applied to the columns to their right by core_dparfb.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2. m >= 0.
+ *
+ * @param[in] n
+ *         The number of rows of the tile A1.
+ *         The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] l
+ *         The number of rows of the upper trapezoidal part of A2.
+ *         min(m, n) >= l >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the n-by-n tile A1.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the n-by-n upper trapezoidal tile R;
+ *         the elements below the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,n).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n pentagonal tile A2.
+ *         On exit, the reflectors of Q, of the same shape; the elements
+ *         below the upper trapezoid are not referenced.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*n.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int core_dtpqrt(int m, int n, int l, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *work)
+{
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (l < 0 || l > imin(m, n)) {
+        coreblas_error("illegal value of l");
+        return -3;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -4;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -5;
+    }
+    if (lda1 < imax(1, n) && n > 0) {
+        coreblas_error("illegal value of lda1");
+        return -6;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -7;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -8;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -9;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return PlasmaSuccess;
+
+    for (int ii = 0; ii < n; ii += ib) {
+        int sb = imin(n-ii, ib);
+
+        // Rows of the columns of the block, of which the last lb
+        // in its triangle.
+        int mb = imin(m, m-l+ii+sb);
+        int lb = mb-imin(m, m-l+ii);
+
+        core_dtpqrt_rec(mb, sb, lb,
+                        &A1[lda1*ii+ii], lda1,
+                        &A2[lda2*ii],    lda2,
+                        &T[ldt*ii],      ldt);
+
+        // Apply Q^T to the rest of the matrix from the left.
+        if (n > ii+sb) {
+            core_dparfb(PlasmaLeft, PlasmaTrans,
+                        PlasmaForward, PlasmaColumnwise,
+                        sb, n-(ii+sb), mb, n-(ii+sb), sb, lb,
+                        &A1[lda1*(ii+sb)+ii], lda1,
+                        &A2[lda2*(ii+sb)],    lda2,
+                        &A2[lda2*ii],         lda2,
+                        &T[ldt*ii],           ldt,
+                        work, sb);
+        }
+    }
+
+    return PlasmaSuccess;
+}
@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztrsm.c, normal z -> d, Sat Feb  4 20:59:01 2017
+ * @generated from core_blas/core_ztrsm.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -98,6 +99,19 @@ void core_dtrsm(plasma_enum_t side, plasma_enum_t uplo,
                                     B, ldb);
 }
 
+/******************************************************************************/
+// Runs the trsm of a task replayed from a task graph.
+static void core_dtrsm_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_dtrsm(task->param[0], task->param[1],
+               task->param[2], task->param[3],
+               task->dim[0], task->dim[1],
+               task->alpha, tiles[1], task->dim[2],
+                            tiles[0], task->dim[3]);
+}
+
 /******************************************************************************/
 void core_omp_dtrsm(
     plasma_enum_t side, plasma_enum_t uplo,
@@ -107,23 +121,36 @@ void core_omp_dtrsm(
                                     double *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_dtrsm_replay,
+            .param = {side, uplo, transa, diag},
+            .dim = {m, n, lda, ldb},
+            .alpha = alpha};
+        PLASMA_GRAPH_ADD(task, 1, B, A);
+        return;
+    }
+
     int ak;
     if (side == PlasmaLeft)
         ak = m;
     else
         ak = n;
 
-#if defined(USE_OMPEXT)
-omp_set_task_name("dtrsm");
-#endif
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("dtrsm", B);
+        if (PLASMA_TRACE_RUN(sequence))
             core_dtrsm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           side == PlasmaLeft ? (double)m*m*n : (double)m*n*n,
+                           (side == PlasmaLeft ? 0.5*m*m : 0.5*n*n) + 2.0*m*n);
+        PLASMA_TRACE_STOP("dtrsm", 1, B, A);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztrssq.c, normal z -> d, Mon Feb  6 14:06:57 2017
+ * @generated from core_blas/core_ztrssq.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -94,12 +94,15 @@ void core_omp_dtrssq(plasma_enum_t uplo, plasma_enum_t diag,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dtrssq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_dtrssq(uplo, diag, m, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("dtrssq", 2, scale, sumsq, A);
     }
 }
@@ -0,0 +1,316 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztrsyl.c, normal z -> d, Thu Oct 15 08:00:07 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#undef REAL
+#define REAL
+
+/******************************************************************************/
+// Scales the m-by-n matrix C by s.
+static void core_dtrsyl_scale(int m, int n, double s,
+                              double *C, int ldc)
+{
+    if (s == 1.0)
+        return;
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            C[ldc*j+i] *= s;
+}
+
+/******************************************************************************/
+// Splits the quasi-triangular matrix A of order n in two halves, without
+// splitting a 2-by-2 diagonal block of its real Schur form.
+static int core_dtrsyl_split(int n, const double *A, int lda)
+{
+    int n1 = n/2;
+#ifndef COMPLEX
+    if (A[lda*(n1-1)+n1] != 0.0)
+        n1++;
+#endif
+    return n1;
+}
+
+/******************************************************************************/
+// Solves the equation recursively on halves of the larger of A and B,
+// as in recsy, updating the right-hand side of the other half by a gemm,
+// down to the LAPACK solver at 32 rows and columns.
+static int core_dtrsyl_rec(plasma_enum_t transa, plasma_enum_t transb,
+                           int isgn, int m, int n,
+                           const double *A, int lda,
+                           const double *B, int ldb,
+                                 double *C, int ldc,
+                           double *scale)
+{
+    if (m <= 32 && n <= 32) {
+        return LAPACKE_dtrsyl_work(LAPACK_COL_MAJOR,
+                                   lapack_const(transa),
+                                   lapack_const(transb),
+                                   isgn, m, n,
+                                   A, lda,
+                                   B, ldb,
+                                   C, ldc, scale);
+    }
+
+    double zmone = -1.0;
+    double zsgn = -isgn;
+    double scale1;
+    double scale2;
+    int info1;
+    int info2;
+    if (m >= n) {
+        int m1 = core_dtrsyl_split(m, A, lda);
+        int m2 = m-m1;
+        const double *A12 = &A[lda*m1];
+        const double *A22 = &A[lda*m1+m1];
+        double *C1 = C;
+        double *C2 = &C[m1];
+        double dscale;
+        if (transa == PlasmaNoTrans) {
+            // A22 X2 + isgn X2 op(B) = scale1 C2
+            info1 = core_dtrsyl_rec(transa, transb, isgn, m2, n,
+                                    A22, lda, B, ldb, C2, ldc, &scale1);
+            // C1 = scale1 C1 - A12 X2
+            dscale = scale1;
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m1, n, m2,
+                        (zmone),  A12, lda,
+                                             C2,  ldc,
+                        (dscale), C1,  ldc);
+            info2 = core_dtrsyl_rec(transa, transb, isgn, m1, n,
+                                    A, lda, B, ldb, C1, ldc, &scale2);
+            core_dtrsyl_scale(m2, n, scale2, C2, ldc);
+        }
+        else {
+            // A11^T X1 + isgn X1 op(B) = scale1 C1
+            info1 = core_dtrsyl_rec(transa, transb, isgn, m1, n,
+                                    A, lda, B, ldb, C1, ldc, &scale1);
+            // C2 = scale1 C2 - A12^T X1
+            dscale = scale1;
+            cblas_dgemm(CblasColMajor, (CBLAS_TRANSPOSE)transa, CblasNoTrans,
+                        m2, n, m1,
+                        (zmone),  A12, lda,
+                                             C1,  ldc,
+                        (dscale), C2,  ldc);
+            info2 = core_dtrsyl_rec(transa, transb, isgn, m2, n,
+                                    A22, lda, B, ldb, C2, ldc, &scale2);
+            core_dtrsyl_scale(m1, n, scale2, C1, ldc);
+        }
+    }
+    else {
+        int n1 = core_dtrsyl_split(n, B, ldb);
+        int n2 = n-n1;
+        const double *B12 = &B[ldb*n1];
+        const double *B22 = &B[ldb*n1+n1];
+        double *C1 = C;
+        double *C2 = &C[ldc*n1];
+        double dscale;
+        if (transb == PlasmaNoTrans) {
+            // op(A) X1 + isgn X1 B11 = scale1 C1
+            info1 = core_dtrsyl_rec(transa, transb, isgn, m, n1,
+                                    A, lda, B, ldb, C1, ldc, &scale1);
+            // C2 = scale1 C2 - isgn X1 B12
+            dscale = scale1;
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, n2, n1,
+                        (zsgn),   C1,  ldc,
+                                             B12, ldb,
+                        (dscale), C2,  ldc);
+            info2 = core_dtrsyl_rec(transa, transb, isgn, m, n2,
+                                    A, lda, B22, ldb, C2, ldc, &scale2);
+            core_dtrsyl_scale(m, n1, scale2, C1, ldc);
+        }
+        else {
+            // op(A) X2 + isgn X2 B22^T = scale1 C2
+            info1 = core_dtrsyl_rec(transa, transb, isgn, m, n2,
+                                    A, lda, B22, ldb, C2, ldc, &scale1);
+            // C1 = scale1 C1 - isgn X2 B12^T
+            dscale = scale1;
+            cblas_dgemm(CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)transb,
+                        m, n1, n2,
+                        (zsgn),   C2,  ldc,
+                                             B12, ldb,
+                        (dscale), C1,  ldc);
+            info2 = core_dtrsyl_rec(transa, transb, isgn, m, n1,
+                                    A, lda, B, ldb, C1, ldc, &scale2);
+            core_dtrsyl_scale(m, n2, scale2, C2, ldc);
+        }
+    }
+    *scale = scale1*scale2;
+    return imax(info1, info2);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_trsyl
+ *
+ *  Solves the triangular Sylvester equation
+ *
+ *    \f[ op(A) X + isgn X op(B) = scale C, \f]
+ *
+ *  where op(A) = A or A^T, op(B) = B or B^T, A and B are upper triangular,
+ *  or quasi-triangular in real Schur form in real arithmetic, and scale
+ *  <= 1 is chosen to avoid the overflow of X. The equation is split
+ *  recursively on halves of A or B, as in recsy, so that most of the work
+ *  is in matrix-matrix products, and the leaves are solved by LAPACK
+ *  dtrsyl.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   op(A) = A,
+ *          - PlasmaConjTrans: op(A) = A^T.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   op(B) = B,
+ *          - PlasmaConjTrans: op(B) = B^T.
+ *
+ * @param[in] isgn
+ *          The sign of the equation, 1 or -1.
+ *
+ * @param[in] m
+ *          The order of the matrix A, and the number of rows of C. m >= 0.
+ *
+ * @param[in] n
+ *          The order of the matrix B, and the number of columns of C.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-m upper triangular matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] B
+ *          The n-by-n upper triangular matrix B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ * @param[in,out] C
+ *          On entry, the m-by-n right-hand side C.
+ *          On exit, the m-by-n solution X.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param[out] scale
+ *          The scale factor, scale <= 1, of the right-hand side.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval 1 if A and -isgn B have common or close eigenvalues,
+ *         perturbed to solve the equation
+ *
+ ******************************************************************************/
+int core_dtrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                int isgn, int m, int n,
+                const double *A, int lda,
+                const double *B, int ldb,
+                      double *C, int ldc,
+                double *scale)
+{
+    // Check input arguments.
+    if (transa != PlasmaNoTrans && transa != PlasmaTrans) {
+        coreblas_error("illegal value of transa");
+        return -1;
+    }
+    if (transb != PlasmaNoTrans && transb != PlasmaTrans) {
+        coreblas_error("illegal value of transb");
+        return -2;
+    }
+    if (isgn != 1 && isgn != -1) {
+        coreblas_error("illegal value of isgn");
+        return -3;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -4;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -5;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -6;
+    }
+    if (lda < imax(1, m)) {
+        coreblas_error("illegal value of lda");
+        return -7;
+    }
+    if (B == NULL) {
+        coreblas_error("NULL B");
+        return -8;
+    }
+    if (ldb < imax(1, n)) {
+        coreblas_error("illegal value of ldb");
+        return -9;
+    }
+    if (C == NULL) {
+        coreblas_error("NULL C");
+        return -10;
+    }
+    if (ldc < imax(1, m)) {
+        coreblas_error("illegal value of ldc");
+        return -11;
+    }
+    if (scale == NULL) {
+        coreblas_error("NULL scale");
+        return -12;
+    }
+
+    // quick return
+    *scale = 1.0;
+    if (m == 0 || n == 0)
+        return PlasmaSuccess;
+
+    return core_dtrsyl_rec(transa, transb, isgn, m, n,
+                           A, lda, B, ldb, C, ldc, scale);
+}
+
+/******************************************************************************/
+void core_omp_dtrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                     int isgn, int m, int n,
+                     const double *A, int lda,
+                     const double *B, int ldb,
+                           double *C, int ldc,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*m]) \
+                     depend(in:B[0:ldb*n]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("dtrsyl", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            // The scale of a tile cannot be applied to the others,
+            // being solved concurrently.
+            double scale;
+            core_dtrsyl(transa, transb, isgn, m, n,
+                        A, lda, B, ldb, C, ldc, &scale);
+            if (scale != 1.0)
+                plasma_request_fail(sequence, request, 1);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble,
+                           (double)m*n*(m+n),
+                           0.5*m*m + 0.5*n*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("dtrsyl", 1, C, A, B);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
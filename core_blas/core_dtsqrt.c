@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztsqrt.c, normal z -> d, Mon Feb  6 14:06:59 2017
+ * @generated from core_blas/core_ztsqrt.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -106,7 +106,7 @@ int core_dtsqrt(int m, int n, int ib,
         coreblas_error("NULL A1");
         return -4;
     }
-    if (lda1 < imax(1, m) && m > 0) {
+    if (lda1 < imax(1, n) && n > 0) {
         coreblas_error("illegal value of lda1");
         return -5;
     }
@@ -135,77 +135,12 @@ int core_dtsqrt(int m, int n, int ib,
         return -11;
     }
 
-    // quick return
-    if (m == 0 || n == 0 || ib == 0)
-        return PlasmaSuccess;
-
-    static double zone  = 1.0;
-    static double zzero = 0.0;
-
-    for (int ii = 0; ii < n; ii += ib) {
-        int sb = imin(n-ii, ib);
-        for (int i = 0; i < sb; i++) {
-            // Generate elementary reflector H( II*IB+I ) to annihilate
-            // A( II*IB+I:M, II*IB+I ).
-            LAPACKE_dlarfg_work(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,
-                                &tau[ii+i]);
-
-            if (ii+i+1 < n) {
-                // Apply H( II*IB+I ) to A( II*IB+I:M, II*IB+I+1:II*IB+IB )
-                // from the left.
-                double alpha = -(tau[ii+i]);
-                cblas_dcopy(sb-i-1, &A1[lda1*(ii+i+1)+(ii+i)], lda1, work, 1);
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_dgemv(CblasColMajor, (CBLAS_TRANSPOSE)PlasmaTrans,
-                            m, sb-i-1,
-                            (zone), &A2[lda2*(ii+i+1)], lda2,
-                            &A2[lda2*(ii+i)], 1,
-                            (zone), work, 1);
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_daxpy(sb-i-1, (alpha), work, 1,
-                            &A1[lda1*(ii+i+1)+ii+i], lda1);
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_dger(CblasColMajor,
-                            m, sb-i-1,
-                            (alpha), &A2[lda2*(ii+i)], 1,
-                            work, 1,
-                            &A2[lda2*(ii+i+1)], lda2);
-            }
-            // Calculate T.
-            double alpha = -tau[ii+i];
-            cblas_dgemv(CblasColMajor, (CBLAS_TRANSPOSE)PlasmaTrans,
-                        m, i,
-                        (alpha), &A2[lda2*ii], lda2,
-                        &A2[lda2*(ii+i)], 1,
-                        (zzero), &T[ldt*(ii+i)], 1);
-
-            cblas_dtrmv(CblasColMajor, (CBLAS_UPLO)PlasmaUpper,
-                        (CBLAS_TRANSPOSE)PlasmaNoTrans,
-                        (CBLAS_DIAG)PlasmaNonUnit,
-                        i,
-                        &T[ldt*ii], ldt,
-                        &T[ldt*(ii+i)], 1);
-
-            T[ldt*(ii+i)+i] = tau[ii+i];
-        }
-        if (n > ii+sb) {
-            core_dtsmqr(PlasmaLeft, PlasmaTrans,
-                        sb, n-(ii+sb), m, n-(ii+sb), ib, ib,
-                        &A1[lda1*(ii+sb)+ii], lda1,
-                        &A2[lda2*(ii+sb)], lda2,
-                        &A2[lda2*ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, sb);
-        }
-    }
-
-    return PlasmaSuccess;
+    // Factor by blocks of ib columns, each recursively.
+    return core_dtpqrt(m, n, 0, ib,
+                       A1, lda1,
+                       A2, lda2,
+                       T,  ldt,
+                       work);
 }
 
 /******************************************************************************/
@@ -216,14 +151,13 @@ void core_omp_dtsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-#if defined(USE_OMPEXT)
-omp_set_task_name("dtsqrt");
-#endif
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dtsqrt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             double *tau = ((double*)work.spaces[tid]);
@@ -241,5 +175,9 @@ omp_set_task_name("dtsqrt");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaRealDouble, 2.0*m*n*n,
+                           (double)n*(n+1) + 2.0*m*n + (double)ib*n);
+        PLASMA_TRACE_STOP("dtsqrt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
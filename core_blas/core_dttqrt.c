@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zttqrt.c, normal z -> d, Mon Feb  6 14:07:01 2017
+ * @generated from core_blas/core_zttqrt.c, normal z -> d, Thu Oct 15 08:00:07 2026
  *
  **/
 
@@ -135,103 +135,15 @@ int core_dttqrt(int m, int n, int ib,
         return -11;
     }
 
-    // quick return
-    if ((m == 0) || (n == 0) || (ib == 0))
-        return PlasmaSuccess;
-
-    // TODO: Need to check why some cases require this to avoid
-    // uninitialized values
-    //core_dlaset(PlasmaGeneral, ib, n, 0.0, 0.0, T, ldt);
-
-    for (int ii = 0; ii < n; ii += ib) {
-        int sb = imin(n-ii, ib);
-        for (int i = 0; i < sb; i++) {
-            int j  = ii + i;
-            int mi = imin(j+1, m);
-            int ni = sb-i-1;
-
-            // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
-            LAPACKE_dlarfg_work(
-                    mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
-
-            if (ni > 0) {
-                // Apply H(j-1) to A(j:m, j+1:ii+ib) from the left.
-                cblas_dcopy(
-                    ni,
-                    &A1[lda1*(j+1)+j], lda1,
-                    work, 1);
-
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(ni, work, 1);
-#endif
-                double zone  = 1.0;
-                cblas_dgemv(
-                    CblasColMajor, (CBLAS_TRANSPOSE)PlasmaTrans,
-                    mi, ni,
-                    (zone), &A2[lda2*(j+1)], lda2,
-                                       &A2[lda2*j],     1,
-                    (zone), work,            1);
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(ni, work, 1);
-#endif
-                double alpha = -(tau[j]);
-                cblas_daxpy(
-                    ni, (alpha),
-                    work, 1,
-                    &A1[lda1*(j+1)+j], lda1);
-#ifdef COMPLEX
-                LAPACKE_dlacgv_work(ni, work, 1);
-#endif
-                cblas_dger(
-                    CblasColMajor, mi, ni,
-                    (alpha), &A2[lda2*j], 1,
-                    work, 1,
-                    &A2[lda2*(j+1)], lda2);
-            }
-
-            // Calculate T.
-            // T(0:i-1, j) = alpha * A2(0:m-1, ii:j-1)^T * A2(0:m-1, j)
-            if (i > 0) {
-                int l = imin(i, imax(0, m-ii));
-                double alpha = -(tau[j]);
-
-                core_dpemv(
-                        PlasmaTrans, PlasmaColumnwise,
-                        imin(j, m), i, l,
-                        alpha, &A2[lda2*ii], lda2,
-                               &A2[lda2*j],  1,
-                        0.0, &T[ldt*j],    1,
-                        work);
-
-                // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-                cblas_dtrmv(
-                        CblasColMajor, (CBLAS_UPLO)PlasmaUpper,
-                        (CBLAS_TRANSPOSE)PlasmaNoTrans,
-                        (CBLAS_DIAG)PlasmaNonUnit,
-                        i, &T[ldt*ii], ldt,
-                           &T[ldt*j], 1);
-            }
-            T[ldt*j+i] = tau[j];
-        }
-
-        // Apply Q^T to the rest of the matrix from the left.
-        if (n > ii+sb) {
-            int mi = imin(ii+sb, m);
-            int ni = n-(ii+sb);
-            int l  = imin(sb, imax(0, mi-ii));
-            core_dparfb(
-                PlasmaLeft, PlasmaTrans,
-                PlasmaForward, PlasmaColumnwise,
-                ib, ni, mi, ni, sb, l,             //replaced sb by ib
-                &A1[lda1*(ii+sb)+ii], lda1,
-                &A2[lda2*(ii+sb)], lda2,
-                &A2[lda2*ii], lda2,
-                &T[ldt*ii], ldt,
-                work, sb);
-        }
-    }
-
-    return PlasmaSuccess;
+    // Only the rows 0 to j of the column j of A2 are referenced, so A2
+    // is the upper trapezoid of core_dtpqrt, factored by blocks of ib
+    // columns, each recursively.
+    int mt = imin(m, n);
+    return core_dtpqrt(mt, n, mt, ib,
+                       A1, lda1,
+                       A2, lda2,
+                       T,  ldt,
+                       work);
 }
 
 /******************************************************************************/
@@ -244,9 +156,11 @@ void core_omp_dttqrt(int m, int n, int ib,
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("dttqrt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             double *tau = ((double*)work.spaces[tid]);
@@ -264,5 +178,7 @@ void core_omp_dttqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("dttqrt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
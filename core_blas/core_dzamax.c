@@ -16,6 +16,37 @@
 
 #include <math.h>
 
+/******************************************************************************/
+void core_dzamax(int colrow, int m, int n,
+                 const plasma_complex64_t *A, int lda,
+                 double *values)
+{
+    switch (colrow) {
+    case PlasmaColumnwise:
+        for (int j = 0; j < n; j++) {
+            values[j] = core_dcabs1(A[lda*j]);
+            for (int i = 1; i < m; i++) {
+                double tmp = core_dcabs1(A[lda*j+i]);
+                if (tmp > values[j])
+                    values[j] = tmp;
+            }
+        }
+        break;
+    case PlasmaRowwise:
+        for (int i = 0; i < m; i++)
+            values[i] = core_dcabs1(A[i]);
+
+        for (int j = 1; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                double tmp = core_dcabs1(A[lda*j+i]);
+                if (tmp > values[i])
+                    values[i] = tmp;
+            }
+        }
+        break;
+    }
+}
+
 /******************************************************************************/
 void core_omp_dzamax(int colrow, int m, int n,
                      const plasma_complex64_t *A, int lda,
@@ -27,34 +58,20 @@ void core_omp_dzamax(int colrow, int m, int n,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:n])
         {
-            if (sequence->status == PlasmaSuccess) {
-                for (int j = 0; j < n; j++) {
-                    values[j] = core_dcabs1(A[lda*j]);
-                    for (int i = 1; i < m; i++) {
-                        double tmp = core_dcabs1(A[lda*j+i]);
-                        if (tmp > values[j])
-                            values[j] = tmp;
-                    }
-                }
-            }
+            PLASMA_TRACE_START("dzamax", values);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_dzamax(colrow, m, n, A, lda, values);
+            PLASMA_TRACE_STOP("dzamax", 1, values, A);
         }
         break;
     case PlasmaRowwise:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:m])
         {
-            if (sequence->status == PlasmaSuccess) {
-                for (int i = 0; i < m; i++)
-                    values[i] = core_dcabs1(A[i]);
-
-                for (int j = 1; j < n; j++) {
-                    for (int i = 0; i < m; i++) {
-                        double tmp = core_dcabs1(A[lda*j+i]);
-                        if (tmp > values[i])
-                            values[i] = tmp;
-                    }
-                }
-            }
+            PLASMA_TRACE_START("dzamax", values);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_dzamax(colrow, m, n, A, lda, values);
+            PLASMA_TRACE_STOP("dzamax", 1, values, A);
         }
         break;
     }
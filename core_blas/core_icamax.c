@@ -0,0 +1,73 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_izamax.c, normal z -> c, Thu Oct 15 03:15:53 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ *  Returns the index of the first entry of x(0:n-1) of largest
+ *  |real| + |imaginary| part, the pivot of the partial pivoting,
+ *  and the value of the entry in max. n >= 1.
+ *
+ *  The entries are taken by blocks: the largest value of a block is found
+ *  by a vectorized reduction, and its index is looked for, in the block
+ *  still in cache, only if it is larger than the previous blocks.
+ *
+ ******************************************************************************/
+CORE_BLAS_MULTIVERSION
+int core_icamax(int n, const plasma_complex32_t *x, float *max)
+{
+    float amax = -1.0;
+    int imax = 0;
+    for (int i0 = 0; i0 < n; i0 += CoreBlasVectorBlock) {
+        int i1 = imin(n, i0+CoreBlasVectorBlock);
+
+        float bmax = -1.0;
+        #pragma omp simd reduction(max:bmax)
+        for (int i = i0; i < i1; i++) {
+#ifdef COMPLEX
+            float a = fabsf(creal(x[i])) + fabsf(cimag(x[i]));
+#else
+            float a = fabsf(x[i]);
+#endif
+            bmax = a > bmax ? a : bmax;
+        }
+        if (bmax > amax) {
+            amax = bmax;
+            for (int i = i0; i < i1; i++) {
+#ifdef COMPLEX
+                float a = fabsf(creal(x[i])) + fabsf(cimag(x[i]));
+#else
+                float a = fabsf(x[i]);
+#endif
+                if (a == bmax) {
+                    imax = i;
+                    break;
+                }
+            }
+        }
+    }
+#ifdef COMPLEX
+    *max = fabsf(creal(x[imax])) + fabsf(cimag(x[imax]));
+#else
+    *max = fabsf(x[imax]);
+#endif
+    return imax;
+}
@@ -0,0 +1,70 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_precision.h"
+#include "plasma_types.h"
+
+#include <string.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Defines core_<from>lag2<to>_inplace, converting the m-by-n matrix A from
+ *  the precision from to the precision to in place, and its task
+ *  core_omp_<from>lag2<to>_inplace. A is stored in the wider precision wide,
+ *  with the leading dimension lda, and the beginning of its storage holds
+ *  the matrix in the narrower precision, on exit after a narrowing, on entry
+ *  before a widening, with the same leading dimension.
+ *
+ *  The elements are converted in storage order when narrowing, in reverse
+ *  storage order when widening, so that each one is read before it can be
+ *  overwritten.
+ *
+ ******************************************************************************/
+#define CORE_LAG2_INPLACE(from, to, wide) \
+CORE_BLAS_MULTIVERSION \
+void PLASMA_NAME(core_, from, lag2##to##_inplace)( \
+    int m, int n, PLASMA_TYPE(wide) *A, int lda) \
+{ \
+    int widen = sizeof(PLASMA_TYPE(to)) > sizeof(PLASMA_TYPE(from)); \
+    char *p = (char*)A; \
+    for (size_t jj = 0; jj < (size_t)n; jj++) { \
+        size_t j = widen ? n-1-jj : jj; \
+        for (size_t ii = 0; ii < (size_t)m; ii++) { \
+            size_t i = widen ? m-1-ii : ii; \
+            size_t ij = i + lda*j; \
+            PLASMA_TYPE(from) a; \
+            memcpy(&a, &p[ij*sizeof(a)], sizeof(a)); \
+            PLASMA_TYPE(to) b = (PLASMA_TYPE(to))a; \
+            memcpy(&p[ij*sizeof(b)], &b, sizeof(b)); \
+        } \
+    } \
+} \
+\
+void PLASMA_NAME(core_omp_, from, lag2##to##_inplace)( \
+    int m, int n, PLASMA_TYPE(wide) *A, int lda, \
+    plasma_sequence_t *sequence, plasma_request_t *request) \
+{ \
+    PLASMA_PRAGMA(omp task depend(inout:A[0:lda*n])) \
+    { \
+        PLASMA_TRACE_START(#from "lag2" #to "_inplace", A); \
+        if (PLASMA_TRACE_RUN(sequence)) \
+            PLASMA_NAME(core_, from, lag2##to##_inplace)(m, n, A, lda); \
+        PLASMA_TRACE_STOP(#from "lag2" #to "_inplace", 1, A); \
+    } \
+}
+
+/******************************************************************************/
+CORE_LAG2_INPLACE(z, c, z)
+CORE_LAG2_INPLACE(c, z, z)
+CORE_LAG2_INPLACE(d, s, d)
+CORE_LAG2_INPLACE(s, d, d)
@@ -0,0 +1,95 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_laswp
+ *
+ *  Computes the permutation of the row interchanges ipiv(k1:k2:incx),
+ *  as applied by core_zlaswp, and lists its cycles. Each cycle is
+ *  listed as the rows r(0), r(1), ..., r(l-1) followed by -1, where,
+ *  after the interchanges, row r(i) holds the original row r(i+1), and
+ *  row r(l-1) holds the original row r(0). The rows not moved are not
+ *  listed. core_zlaswp_cycles then moves each row once, instead of
+ *  swapping the rows once per interchange.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows (columns) permuted, at least k2 and the
+ *          largest entry of ipiv(k1:k2).
+ *
+ * @param[in] k1
+ *          The first element of ipiv for which an interchange is done.
+ *
+ * @param[in] k2
+ *          The last element of ipiv for which an interchange is done.
+ *
+ * @param[in] ipiv
+ *          The vector of pivot indices, one-based.
+ *
+ * @param[in] incx
+ *          The increment between elements of ipiv, 1 or -1.
+ *          If incx is negative, the interchanges are applied in reverse
+ *          order.
+ *
+ * @param perm
+ *          Workspace of size m.
+ *
+ * @param[out] cycles
+ *          The cycles of the permutation, of size at least 3*m/2.
+ *
+ *******************************************************************************
+ *
+ * @return The length of the list of cycles.
+ *
+ ******************************************************************************/
+int core_laswp_cycles(int m, int k1, int k2, const int *ipiv, int incx,
+                      int *perm, int *cycles)
+{
+    // perm(i) is the original row held by row i.
+    for (int i = 0; i < m; i++)
+        perm[i] = i;
+
+    if (incx > 0) {
+        for (int i = k1-1; i <= k2-1; i += incx) {
+            int ip = ipiv[i]-1;
+            int tmp = perm[i];
+            perm[i] = perm[ip];
+            perm[ip] = tmp;
+        }
+    }
+    else {
+        for (int i = k2-1; i >= k1-1; i += incx) {
+            int ip = ipiv[i]-1;
+            int tmp = perm[i];
+            perm[i] = perm[ip];
+            perm[ip] = tmp;
+        }
+    }
+
+    // Follow each cycle from its smallest row, marking the rows listed.
+    int len = 0;
+    for (int i = 0; i < m; i++) {
+        if (perm[i] == i || perm[i] < 0)
+            continue;
+        int r = i;
+        do {
+            int next = perm[r];
+            cycles[len++] = r;
+            perm[r] = -1;
+            r = next;
+        } while (r != i);
+        cycles[len++] = -1;
+    }
+    return len;
+}
@@ -0,0 +1,196 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_precision.h"
+#include "plasma_types.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pack
+ *
+ *  Defines the kernels of the tiles packed at the fixed rate of rate bytes
+ *  per real number, for the precision p:
+ *
+ *  - core_<p>pack(uplo, m, n, A, lda, rate, B, ldb) packs the uplo part of
+ *    the m-by-n matrix A to B, with the leading dimension ldb in elements,
+ *  - core_<p>unpack(uplo, m, n, B, ldb, rate, A, lda) unpacks it back,
+ *  - core_<p>repack(uplo, m, n, A, lda, ratea, B, ldb, rateb) packs again
+ *    the packed A at the rate of B, copying the bytes if the rates match,
+ *
+ *  and their tasks core_omp_<p>pack, ... Each real number keeps its sign,
+ *  its exponent and the leading bits of its significand, rounded to the
+ *  nearest, as an unsigned integer of rate bytes, stored least significant
+ *  byte first. The rounding carries into the exponent when the significand
+ *  overflows. With rate equal to the size of the real type, nothing is
+ *  dropped.
+ *
+ ******************************************************************************/
+#define CORE_PACK(p) \
+static inline void PLASMA_NAME(core_, p, pack_real)( \
+    const PLASMA_REAL(p) *a, int rate, unsigned char *b) \
+{ \
+    int size = (int)sizeof(PLASMA_REAL(p)); \
+    int drop = 8*(size-rate); \
+    uint64_t u; \
+    if (size == 8) { \
+        memcpy(&u, a, 8); \
+    } \
+    else { \
+        uint32_t v; \
+        memcpy(&v, a, 4); \
+        u = v; \
+    } \
+    if (drop > 0) \
+        u = (u + ((uint64_t)1 << (drop-1))) >> drop; \
+    for (int k = 0; k < rate; k++) \
+        b[k] = (unsigned char)(u >> 8*k); \
+} \
+\
+static inline void PLASMA_NAME(core_, p, unpack_real)( \
+    const unsigned char *b, int rate, PLASMA_REAL(p) *a) \
+{ \
+    int size = (int)sizeof(PLASMA_REAL(p)); \
+    uint64_t u = 0; \
+    for (int k = 0; k < rate; k++) \
+        u |= (uint64_t)b[k] << 8*k; \
+    u <<= 8*(size-rate); \
+    if (size == 8) { \
+        memcpy(a, &u, 8); \
+    } \
+    else { \
+        uint32_t v = (uint32_t)u; \
+        memcpy(a, &v, 4); \
+    } \
+} \
+\
+void PLASMA_NAME(core_, p, pack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const PLASMA_TYPE(p) *A, int lda, int rate, \
+    unsigned char *B, int ldb) \
+{ \
+    int count = PLASMA_COMPLEX(p) ? 2 : 1; \
+    const PLASMA_REAL(p) *a = (const PLASMA_REAL(p)*)A; \
+    for (int j = 0; j < n; j++) { \
+        int i1 = uplo == PlasmaLower ? imin(j, m) : 0; \
+        int i2 = uplo == PlasmaUpper ? imin(j+1, m) : m; \
+        for (int i = i1; i < i2; i++) { \
+            for (int c = 0; c < count; c++) { \
+                PLASMA_NAME(core_, p, pack_real)( \
+                    &a[count*(i+(size_t)lda*j)+c], rate, \
+                    &B[(count*(i+(size_t)ldb*j)+c)*rate]); \
+            } \
+        } \
+    } \
+} \
+\
+void PLASMA_NAME(core_, p, unpack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const unsigned char *B, int ldb, int rate, \
+    PLASMA_TYPE(p) *A, int lda) \
+{ \
+    int count = PLASMA_COMPLEX(p) ? 2 : 1; \
+    PLASMA_REAL(p) *a = (PLASMA_REAL(p)*)A; \
+    for (int j = 0; j < n; j++) { \
+        int i1 = uplo == PlasmaLower ? imin(j, m) : 0; \
+        int i2 = uplo == PlasmaUpper ? imin(j+1, m) : m; \
+        for (int i = i1; i < i2; i++) { \
+            for (int c = 0; c < count; c++) { \
+                PLASMA_NAME(core_, p, unpack_real)( \
+                    &B[(count*(i+(size_t)ldb*j)+c)*rate], rate, \
+                    &a[count*(i+(size_t)lda*j)+c]); \
+            } \
+        } \
+    } \
+} \
+\
+void PLASMA_NAME(core_, p, repack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const unsigned char *A, int lda, int ratea, \
+    unsigned char *B, int ldb, int rateb) \
+{ \
+    int count = PLASMA_COMPLEX(p) ? 2 : 1; \
+    for (int j = 0; j < n; j++) { \
+        int i1 = uplo == PlasmaLower ? imin(j, m) : 0; \
+        int i2 = uplo == PlasmaUpper ? imin(j+1, m) : m; \
+        if (i1 >= i2) \
+            continue; \
+        const unsigned char *a = &A[count*(i1+(size_t)lda*j)*ratea]; \
+        unsigned char *b = &B[count*(i1+(size_t)ldb*j)*rateb]; \
+        if (ratea == rateb) { \
+            memcpy(b, a, (size_t)count*(i2-i1)*ratea); \
+            continue; \
+        } \
+        for (int k = 0; k < count*(i2-i1); k++) { \
+            PLASMA_REAL(p) x; \
+            PLASMA_NAME(core_, p, unpack_real)(&a[k*ratea], ratea, &x); \
+            PLASMA_NAME(core_, p, pack_real)(&x, rateb, &b[k*rateb]); \
+        } \
+    } \
+} \
+\
+void PLASMA_NAME(core_omp_, p, pack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const PLASMA_TYPE(p) *A, int lda, int rate, \
+    unsigned char *B, int ldb, \
+    plasma_sequence_t *sequence, plasma_request_t *request) \
+{ \
+    PLASMA_PRAGMA(omp task depend(in:A[0:lda*n]) \
+                           depend(out:B[0:ldb*n])) \
+    { \
+        PLASMA_TRACE_START(#p "pack", B); \
+        if (PLASMA_TRACE_RUN(sequence)) \
+            PLASMA_NAME(core_, p, pack)(uplo, m, n, A, lda, rate, B, ldb); \
+        PLASMA_TRACE_STOP(#p "pack", 1, B, A); \
+    } \
+} \
+\
+void PLASMA_NAME(core_omp_, p, unpack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const unsigned char *B, int ldb, int rate, \
+    PLASMA_TYPE(p) *A, int lda, \
+    plasma_sequence_t *sequence, plasma_request_t *request) \
+{ \
+    PLASMA_PRAGMA(omp task depend(in:B[0:ldb*n]) \
+                           depend(out:A[0:lda*n])) \
+    { \
+        PLASMA_TRACE_START(#p "unpack", A); \
+        if (PLASMA_TRACE_RUN(sequence)) \
+            PLASMA_NAME(core_, p, unpack)(uplo, m, n, B, ldb, rate, A, lda); \
+        PLASMA_TRACE_STOP(#p "unpack", 1, A, B); \
+    } \
+} \
+\
+void PLASMA_NAME(core_omp_, p, repack)( \
+    plasma_enum_t uplo, int m, int n, \
+    const unsigned char *A, int lda, int ratea, \
+    unsigned char *B, int ldb, int rateb, \
+    plasma_sequence_t *sequence, plasma_request_t *request) \
+{ \
+    PLASMA_PRAGMA(omp task depend(in:A[0:lda*n]) \
+                           depend(out:B[0:ldb*n])) \
+    { \
+        PLASMA_TRACE_START(#p "repack", B); \
+        if (PLASMA_TRACE_RUN(sequence)) \
+            PLASMA_NAME(core_, p, repack)(uplo, m, n, A, lda, ratea, \
+                                          B, ldb, rateb); \
+        PLASMA_TRACE_STOP(#p "repack", 1, B, A); \
+    } \
+}
+
+/******************************************************************************/
+CORE_PACK(z)
+CORE_PACK(c)
+CORE_PACK(d)
+CORE_PACK(s)
@@ -0,0 +1,43 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_plrnt
+ *
+ *  Returns the number at position n of the sequence of core_rnd64_next
+ *  started from seed, in O(log n) steps, by squaring the affine map
+ *  ran -> a*ran + c of the generator.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The position in the sequence.
+ *
+ * @param[in] seed
+ *          The first number of the sequence.
+ *
+ ******************************************************************************/
+unsigned long long core_rnd64_jump(unsigned long long n,
+                                   unsigned long long seed)
+{
+    unsigned long long a_k = 6364136223846793005ULL;
+    unsigned long long c_k = 1ULL;
+    unsigned long long ran = seed;
+    for (; n != 0; n >>= 1) {
+        if (n & 1)
+            ran = a_k*ran + c_k;
+        c_k *= a_k + 1;
+        a_k *= a_k;
+    }
+    return ran;
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_dzamax.c, normal z -> s, Mon Feb  6 14:06:46 2017
+ * @generated from core_blas/core_dzamax.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -16,6 +16,37 @@
 
 #include <math.h>
 
+/******************************************************************************/
+void core_samax(int colrow, int m, int n,
+                 const float *A, int lda,
+                 float *values)
+{
+    switch (colrow) {
+    case PlasmaColumnwise:
+        for (int j = 0; j < n; j++) {
+            values[j] = fabsf(A[lda*j]);
+            for (int i = 1; i < m; i++) {
+                float tmp = fabsf(A[lda*j+i]);
+                if (tmp > values[j])
+                    values[j] = tmp;
+            }
+        }
+        break;
+    case PlasmaRowwise:
+        for (int i = 0; i < m; i++)
+            values[i] = fabsf(A[i]);
+
+        for (int j = 1; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                float tmp = fabsf(A[lda*j+i]);
+                if (tmp > values[i])
+                    values[i] = tmp;
+            }
+        }
+        break;
+    }
+}
+
 /******************************************************************************/
 void core_omp_samax(int colrow, int m, int n,
                      const float *A, int lda,
@@ -27,34 +58,20 @@ void core_omp_samax(int colrow, int m, int n,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:n])
         {
-            if (sequence->status == PlasmaSuccess) {
-                for (int j = 0; j < n; j++) {
-                    values[j] = fabsf(A[lda*j]);
-                    for (int i = 1; i < m; i++) {
-                        float tmp = fabsf(A[lda*j+i]);
-                        if (tmp > values[j])
-                            values[j] = tmp;
-                    }
-                }
-            }
+            PLASMA_TRACE_START("samax", values);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_samax(colrow, m, n, A, lda, values);
+            PLASMA_TRACE_STOP("samax", 1, values, A);
         }
         break;
     case PlasmaRowwise:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:m])
         {
-            if (sequence->status == PlasmaSuccess) {
-                for (int i = 0; i < m; i++)
-                    values[i] = fabsf(A[i]);
-
-                for (int j = 1; j < n; j++) {
-                    for (int i = 0; i < m; i++) {
-                        float tmp = fabsf(A[lda*j+i]);
-                        if (tmp > values[i])
-                            values[i] = tmp;
-                    }
-                }
-            }
+            PLASMA_TRACE_START("samax", values);
+            if (PLASMA_TRACE_RUN(sequence))
+                core_samax(colrow, m, n, A, lda, values);
+            PLASMA_TRACE_STOP("samax", 1, values, A);
         }
         break;
     }
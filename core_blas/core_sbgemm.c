@@ -0,0 +1,192 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <string.h>
+
+/******************************************************************************/
+// Widens the m-by-n bfloat16 matrix A into the m-by-n single matrix W.
+static void core_sbf2lag(int m, int n,
+                         const plasma_bfloat16_t *A, int lda, float *W)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            uint32_t u = (uint32_t)A[i+(size_t)lda*j] << 16;
+            memcpy(&W[i+(size_t)m*j], &u, sizeof(u));
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *    \f[ C = \alpha [op( A )\times op( B )] + \beta C, \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *
+ *  alpha and beta are scalars, and A, B and C are matrices, with op( A )
+ *  an m-by-k matrix, op( B ) a k-by-n matrix and C an m-by-n matrix.
+ *  A and B are in bfloat16, C is in single precision, and the products
+ *  are accumulated in single precision.
+ *
+ *  With PLASMA_WITH_BF16 defined, calls the bfloat16 gemm of the BLAS,
+ *  cblas_gemm_bf16bf16f32 of MKL or cblas_sbgemm of OpenBLAS. Otherwise
+ *  widens A and B to single precision in work and calls cblas_sgemm,
+ *  which gives the same numbers at the speed of single precision.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans: A is not transposed,
+ *          - PlasmaTrans:   A is transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans: B is not transposed,
+ *          - PlasmaTrans:   B is transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( A ) and of the matrix C.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix op( B ) and of the matrix C.
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A ) and the number of rows
+ *          of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          An lda-by-ka bfloat16 matrix, where ka is k when
+ *          transa = PlasmaNoTrans, and is m otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          When transa = PlasmaNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] B
+ *          An ldb-by-kb bfloat16 matrix, where kb is n when
+ *          transb = PlasmaNoTrans, and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          An ldc-by-n matrix. On exit, the array is overwritten by the m-by-n
+ *          matrix ( alpha*op( A )*op( B ) + beta*C ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *          Workspace of size m*k + k*n, not referenced
+ *          with PLASMA_WITH_BF16 defined.
+ *
+ ******************************************************************************/
+void core_sbgemm(plasma_enum_t transa, plasma_enum_t transb,
+                 int m, int n, int k,
+                 float alpha, const plasma_bfloat16_t *A, int lda,
+                              const plasma_bfloat16_t *B, int ldb,
+                 float beta,        float *C, int ldc,
+                 float *work)
+{
+#if defined(PLASMA_WITH_BF16)
+#if defined(PLASMA_WITH_MKL)
+    cblas_gemm_bf16bf16f32(CblasColMajor,
+                           (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                           m, n, k,
+                           alpha, (const MKL_BF16*)A, lda,
+                                  (const MKL_BF16*)B, ldb,
+                           beta,  C, ldc);
+#else
+    cblas_sbgemm(CblasColMajor,
+                 (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                 m, n, k,
+                 alpha, (const bfloat16*)A, lda,
+                        (const bfloat16*)B, ldb,
+                 beta,  C, ldc);
+#endif
+#else
+    int am = transa == PlasmaNoTrans ? m : k;
+    int an = transa == PlasmaNoTrans ? k : m;
+    int bm = transb == PlasmaNoTrans ? k : n;
+    int bn = transb == PlasmaNoTrans ? n : k;
+    float *Aw = work;
+    float *Bw = &work[(size_t)am*an];
+    core_sbf2lag(am, an, A, lda, Aw);
+    core_sbf2lag(bm, bn, B, ldb, Bw);
+    cblas_sgemm(CblasColMajor,
+                (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                m, n, k,
+                alpha, Aw, imax(1, am),
+                       Bw, imax(1, bm),
+                beta,  C, ldc);
+#endif
+}
+
+/******************************************************************************/
+void core_omp_sbgemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const plasma_bfloat16_t *A, int lda,
+                 const plasma_bfloat16_t *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (transa == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = m;
+
+    int bk;
+    if (transb == PlasmaNoTrans)
+        bk = n;
+    else
+        bk = k;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(in:B[0:ldb*bk]) \
+                     depend(inout:C[0:ldc*n])
+    {
+        PLASMA_TRACE_START("sbgemm", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            float *W = (float*)work.spaces[tid];
+            core_sbgemm(transa, transb,
+                        m, n, k,
+                        alpha, A, lda,
+                               B, ldb,
+                        beta,  C, ldc,
+                        W);
+        }
+        PLASMA_TRACE_STOP("sbgemm", 1, C, A, B);
+    }
+}
@@ -0,0 +1,336 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zchud.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+
+#include <math.h>
+
+/******************************************************************************/
+// Applies the rotation (c, s) to the m rows of a column a of L, of stride
+// inca, conjugated for PlasmaUpper, and a column b of V.
+static inline void core_schud_rot(plasma_enum_t uplo, int sign, int m,
+                                  float c, float s,
+                                  float *a, size_t inca,
+                                  float *b)
+{
+    for (int i = 0; i < m; i++) {
+        float x = a[i*inca];
+        if (uplo == PlasmaUpper)
+            x = (x);
+        float y = b[i];
+        if (sign > 0) {
+            b[i] = c*y - s*x;
+            x = c*x + (s)*y;
+        }
+        else {
+            x = c*x - (s)*y;
+            b[i] = (y - s*x)/c;
+        }
+        a[i*inca] = uplo == PlasmaUpper ? (x) : x;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_chud
+ *
+ *  Updates or downdates the Cholesky factor of a diagonal tile with a tile
+ *  of the rank-k term, as the first step of the tile column of
+ *  plasma_pspotrf_update. For each column c of the factor L, and each
+ *  column q of V, a plane rotation, for the update, or hyperbolic rotation,
+ *  for the downdate, of the columns L(:,c) and V(:,q) zeroes V(c,q), so
+ *  that with the n-by-n factor L of the tile,
+ *
+ *    \f[ L_+ L_+^T = L L^T \pm V V^T. \f]
+ *
+ *  The rotations are kept in G to be applied to the tiles below by
+ *  core_schudm. The downdate applies its rotations in the mixed form,
+ *  which is stable.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: the tile A holds L,
+ *          - PlasmaUpper: the tile A holds L^T.
+ *
+ * @param[in] sign
+ *          1 for the update, -1 for the downdate.
+ *
+ * @param[in] n
+ *          The order of the tile A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tile V. k >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the triangular factor of the tile, with a positive
+ *          diagonal. On exit, the triangular factor of the update.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in,out] V
+ *          On entry, the n-by-k tile V. On exit, zero.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,n).
+ *
+ * @param[out] G
+ *          The n-by-2k rotations: the cosines in the first k columns,
+ *          the sines in the last k.
+ *
+ * @param[in] ldg
+ *          The leading dimension of the array G. ldg >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ * @retval > 0 if i, the downdated matrix is not positive definite
+ *         from its order i on.
+ *
+ ******************************************************************************/
+int core_schud(plasma_enum_t uplo, int sign, int n, int k,
+               float *A, int lda,
+               float *V, int ldv,
+               float *G, int ldg)
+{
+    // Check input arguments.
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        coreblas_error("illegal value of uplo");
+        return -1;
+    }
+    if (sign != 1 && sign != -1) {
+        coreblas_error("illegal value of sign");
+        return -2;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -3;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -4;
+    }
+    if (lda < imax(1, n)) {
+        coreblas_error("illegal value of lda");
+        return -6;
+    }
+    if (ldv < imax(1, n)) {
+        coreblas_error("illegal value of ldv");
+        return -8;
+    }
+    if (ldg < imax(1, n)) {
+        coreblas_error("illegal value of ldg");
+        return -10;
+    }
+
+    // strides of the rows and columns of L in A
+    size_t rs = uplo == PlasmaLower ? 1 : lda;
+    size_t cs = uplo == PlasmaLower ? lda : 1;
+
+    for (int c = 0; c < n; c++) {
+        for (int q = 0; q < k; q++) {
+            float l = creal(A[c*rs+c*cs]);
+            float v = V[c+(size_t)ldv*q];
+            float r;
+            if (sign > 0) {
+                r = hypot(l, fabsf(v));
+            }
+            else {
+                float d = (l-fabsf(v))*(l+fabsf(v));
+                if (!(d > 0.0))
+                    return c+1;
+                r = sqrtf(d);
+            }
+            float gc = r == 0.0 ? 1.0 : l/r;
+            float gs = r == 0.0 ? 0.0 : v/r;
+            G[c+(size_t)ldg*q] = gc;
+            G[c+(size_t)ldg*(k+q)] = gs;
+
+            A[c*rs+c*cs] = r;
+            V[c+(size_t)ldv*q] = 0.0;
+            core_schud_rot(uplo, sign, n-c-1, gc, gs,
+                           &A[(c+1)*rs+c*cs], rs,
+                           &V[c+1+(size_t)ldv*q]);
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void core_omp_schud(plasma_enum_t uplo, int sign, int n, int k,
+                    float *A, int lda,
+                    float *V, int ldv,
+                    float *G, int ldg,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(inout:V[0:ldv*k]) \
+                     depend(out:G[0:ldg*2*k]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("schud", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_schud(uplo, sign, n, k, A, lda, V, ldv, G, ldg);
+            if (info < 0) {
+                plasma_error("core_schud() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+            else if (info > 0) {
+                plasma_request_fail(sequence, request, iinfo+info);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, 3.0*n*n*k,
+                           (float)n*(n+1) + 4.0*n*k);
+        PLASMA_TRACE_STOP("schud", 3, A, V, G);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_chud
+ *
+ *  Applies the rotations of core_schud, of a diagonal tile of the factor L
+ *  and a tile of V, to the tiles of the same tile columns below them: the
+ *  m-by-n tile of L, or its conjugate transpose for PlasmaUpper, and the
+ *  m-by-k tile of V.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaLower: the tile A holds the m-by-n tile of L,
+ *          - PlasmaUpper: the tile A holds the n-by-m tile of L^T.
+ *
+ * @param[in] sign
+ *          1 for the update, -1 for the downdate.
+ *
+ * @param[in] m
+ *          The number of rows of the tiles of L and V. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile of L. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tile V. k >= 0.
+ *
+ * @param[in] G
+ *          The n-by-2k rotations computed by core_schud.
+ *
+ * @param[in] ldg
+ *          The leading dimension of the array G. ldg >= max(1,n).
+ *
+ * @param[in,out] A
+ *          The tile of L, or L^T, on exit with the rotations applied.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          lda >= max(1,m) for PlasmaLower, lda >= max(1,n) for PlasmaUpper.
+ *
+ * @param[in,out] V
+ *          The m-by-k tile V, on exit with the rotations applied.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+int core_schudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                const float *G, int ldg,
+                      float *A, int lda,
+                      float *V, int ldv)
+{
+    // Check input arguments.
+    if (uplo != PlasmaUpper && uplo != PlasmaLower) {
+        coreblas_error("illegal value of uplo");
+        return -1;
+    }
+    if (sign != 1 && sign != -1) {
+        coreblas_error("illegal value of sign");
+        return -2;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (ldg < imax(1, n)) {
+        coreblas_error("illegal value of ldg");
+        return -7;
+    }
+    if (lda < imax(1, uplo == PlasmaLower ? m : n)) {
+        coreblas_error("illegal value of lda");
+        return -9;
+    }
+    if (ldv < imax(1, m)) {
+        coreblas_error("illegal value of ldv");
+        return -11;
+    }
+
+    // strides of the rows and columns of L in A
+    size_t rs = uplo == PlasmaLower ? 1 : lda;
+    size_t cs = uplo == PlasmaLower ? lda : 1;
+
+    for (int c = 0; c < n; c++) {
+        for (int q = 0; q < k; q++) {
+            core_schud_rot(uplo, sign, m,
+                           creal(G[c+(size_t)ldg*q]), G[c+(size_t)ldg*(k+q)],
+                           &A[c*cs], rs,
+                           &V[(size_t)ldv*q]);
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void core_omp_schudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                     const float *G, int ldg,
+                           float *A, int lda,
+                           float *V, int ldv,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int na = uplo == PlasmaLower ? n : m;
+    #pragma omp task depend(in:G[0:ldg*2*k]) \
+                     depend(inout:A[0:lda*na]) \
+                     depend(inout:V[0:ldv*k]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("schudm", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_schudm(uplo, sign, m, n, k, G, ldg,
+                                   A, lda, V, ldv);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_schudm() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, 6.0*m*n*k,
+                           2.0*(m*n + m*k) + 4.0*n*k);
+        PLASMA_TRACE_STOP("schudm", 3, A, V, G);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
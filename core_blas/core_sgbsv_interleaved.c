@@ -0,0 +1,230 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgbsv_interleaved.c, normal z -> s, Thu Oct 15 07:31:11 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+#define REAL
+
+// row of an interleaved array, the elements of the count systems
+#define AB(i, j) (&AB[((size_t)(j)*ldab + (i))*stride])
+#define IPIV(j)  (&ipiv[(size_t)(j)*stride])
+#define B(i, j)  (&B[((size_t)(j)*n + (i))*stride])
+
+/******************************************************************************/
+static inline float cabs1(float z)
+{
+#ifdef COMPLEX
+    return fabsf(creal(z)) + fabsf(cimag(z));
+#else
+    return fabsf(z);
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gttrf
+ *
+ *  Solves count independent band systems A_s X_s = B_s of order n, with kl
+ *  subdiagonals and ku superdiagonals, stored interleaved: the element i of
+ *  the system s is at i*stride + s, so that the elimination runs across the
+ *  systems, one per vector lane. LU factorization with partial pivoting, as
+ *  in LAPACK sgbsv, with the row interchanges done by selections over the
+ *  kl candidate rows instead of branches, and the updates carried over the
+ *  widest band the fill can reach in any of the systems.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_s. n >= 0.
+ *
+ * @param[in] kl
+ *          The number of subdiagonals within the band of A_s. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of superdiagonals within the band of A_s. ku >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B_s. nrhs >= 0.
+ *
+ * @param[in] count
+ *          The number of systems. 0 <= count <= stride.
+ *
+ * @param[in] stride
+ *          The distance between consecutive elements of a system.
+ *
+ * @param[in,out] AB
+ *          On entry, the matrices A_s in the LAPACK band storage, the element
+ *          A_s(i, j) in the row kl+ku+i-j of the column j of the band, at
+ *          (j*ldab + kl+ku+i-j)*stride + s; the first kl rows need not be
+ *          set. On exit, the factors L_s and U_s, as in LAPACK sgbsv.
+ *
+ * @param[in] ldab
+ *          The number of rows of the band. ldab >= 2*kl+ku+1.
+ *
+ * @param[out] ipiv
+ *          The n pivot indices of the systems, interleaved; the row i of A_s
+ *          was interchanged with the row ipiv[i*stride + s] (1-based).
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand sides B_s, the element (i, j)
+ *          of the system s at (j*n + i)*stride + s.
+ *          On exit, the solutions X_s.
+ *
+ * @param[out] info
+ *          Array of count statuses. info[s] = 0 on success, or i > 0 if
+ *          U_s(i,i) is exactly zero, and X_s is not valid.
+ *
+ ******************************************************************************/
+void core_sgbsv_interleaved(int n, int kl, int ku, int nrhs,
+                            int count, int stride,
+                            float *AB, int ldab, int *ipiv,
+                            float *B, int *info)
+{
+    int kv = kl+ku;
+
+    for (int s = 0; s < count; s++)
+        info[s] = 0;
+
+    // Zero the fill-in of the first columns.
+    for (int j = ku+1; j < imin(kv, n); j++) {
+        for (int i = kv-j; i < kl; i++) {
+            float *ab = AB(i, j);
+            for (int s = 0; s < count; s++)
+                ab[s] = 0.0;
+        }
+    }
+
+    for (int j = 0; j < n; j++) {
+        int km = imin(kl, n-1-j);
+        int ju = imin(j+kv, n-1);
+
+        // Zero the fill-in of the column j+kv.
+        if (j+kv < n) {
+            for (int i = 0; i < kl; i++) {
+                float *ab = AB(i, j+kv);
+                for (int s = 0; s < count; s++)
+                    ab[s] = 0.0;
+            }
+        }
+
+        // Find the pivots.
+        int *pj = IPIV(j);
+        float *ajj = AB(kv, j);
+        #pragma omp simd
+        for (int s = 0; s < count; s++) {
+            float amax = cabs1(ajj[s]);
+            int p = 0;
+            for (int i = 1; i <= km; i++) {
+                float a = cabs1(AB(kv+i, j)[s]);
+                if (a > amax) {
+                    amax = a;
+                    p = i;
+                }
+            }
+            pj[s] = p;
+        }
+
+        // Interchange the rows j and j+p over the columns j to ju.
+        for (int i = 1; i <= km; i++) {
+            for (int k = 0; k <= ju-j; k++) {
+                float *a0 = AB(kv-k, j+k);
+                float *ai = AB(kv+i-k, j+k);
+
+                #pragma omp simd
+                for (int s = 0; s < count; s++) {
+                    float t0 = a0[s];
+                    float ti = ai[s];
+                    a0[s] = pj[s] == i ? ti : t0;
+                    ai[s] = pj[s] == i ? t0 : ti;
+                }
+            }
+        }
+
+        #pragma omp simd
+        for (int s = 0; s < count; s++) {
+            if (ajj[s] == 0.0 && info[s] == 0)
+                info[s] = j+1;
+            pj[s] += j+1;
+        }
+
+        // Compute the multipliers and update the trailing band.
+        for (int i = 1; i <= km; i++) {
+            float *aij = AB(kv+i, j);
+
+            #pragma omp simd
+            for (int s = 0; s < count; s++)
+                aij[s] /= ajj[s];
+        }
+        for (int k = 1; k <= ju-j; k++) {
+            float *ajk = AB(kv-k, j+k);
+            for (int i = 1; i <= km; i++) {
+                float *aij = AB(kv+i, j);
+                float *aik = AB(kv+i-k, j+k);
+
+                #pragma omp simd
+                for (int s = 0; s < count; s++)
+                    aik[s] -= aij[s]*ajk[s];
+            }
+        }
+    }
+
+    for (int r = 0; r < nrhs; r++) {
+        // Solve L Y = P B.
+        for (int j = 0; j < n-1; j++) {
+            int lm = imin(kl, n-1-j);
+            int *pj = IPIV(j);
+            float *bj = B(j, r);
+            for (int i = 1; i <= lm; i++) {
+                float *bi = B(j+i, r);
+
+                #pragma omp simd
+                for (int s = 0; s < count; s++) {
+                    float t0 = bj[s];
+                    float ti = bi[s];
+                    bj[s] = pj[s] == j+i+1 ? ti : t0;
+                    bi[s] = pj[s] == j+i+1 ? t0 : ti;
+                }
+            }
+            for (int i = 1; i <= lm; i++) {
+                float *aij = AB(kv+i, j);
+                float *bi = B(j+i, r);
+
+                #pragma omp simd
+                for (int s = 0; s < count; s++)
+                    bi[s] -= aij[s]*bj[s];
+            }
+        }
+
+        // Solve U X = Y.
+        for (int j = n-1; j >= 0; j--) {
+            float *ajj = AB(kv, j);
+            float *bj = B(j, r);
+
+            #pragma omp simd
+            for (int s = 0; s < count; s++)
+                bj[s] /= ajj[s];
+
+            for (int i = imax(0, j-kv); i < j; i++) {
+                float *aij = AB(kv+i-j, j);
+                float *bi = B(i, r);
+
+                #pragma omp simd
+                for (int s = 0; s < count; s++)
+                    bi[s] -= aij[s]*bj[s];
+            }
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgeadd.c, normal z -> s, Mon Feb  6 14:06:46 2017
+ * @generated from core_blas/core_zgeadd.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -146,9 +146,11 @@ void core_omp_sgeadd(
     int k = (transa == PlasmaNoTrans) ? n : m;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("sgeadd", B);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int retval = core_sgeadd(transa,
                                      m, n,
                                      alpha, A, lda,
@@ -158,5 +160,7 @@ void core_omp_sgeadd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("sgeadd", 1, B, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
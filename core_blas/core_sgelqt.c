@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zgelqt.c, normal z -> s, Mon Feb  6 14:06:46 2017
+ * @generated from core_blas/core_zgelqt.c, normal z -> s, Thu Oct 15 10:25:42 2026
  *
  **/
 
@@ -14,6 +14,7 @@
 #include "plasma_types.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
+#include "plasma_blas_threads.h"
 
 #include <omp.h>
 
@@ -171,29 +172,41 @@ int core_sgelqt(int m, int n, int ib,
 void core_omp_sgelqt(int m, int n, int ib,
                      float *A, int lda,
                      float *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // T should be mxib, but is stored as ibxm.
     #pragma omp task depend(inout:A[0:lda*n]) \
-                     depend(out:T[0:ib*m]) // T should be mxib, but is stored
-                                           // as ibxm
+                     depend(out:T[0:ib*m]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("sgelqt", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *tau = (float*)work.spaces[tid];
 
-            // Call the kernel.
+            // Call the kernel, with the BLAS of the panel on up to
+            // num_blas_threads threads.
+            int blas_threads = 0;
+            if (num_blas_threads > 1)
+                blas_threads = plasma_blas_threads_local(num_blas_threads);
+
             int info = core_sgelqt(m, n, ib,
                                    A, lda,
                                    T, ldt,
                                    tau,
                                    tau+m);
 
+            if (num_blas_threads > 1)
+                plasma_blas_threads_local(blas_threads);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_sgelqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("sgelqt", 2, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
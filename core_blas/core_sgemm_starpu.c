@@ -0,0 +1,93 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_starpu.c, normal z -> s, Thu Oct 15 01:52:13 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_starpu.h"
+#include "plasma_types.h"
+
+#if defined(PLASMA_WITH_STARPU)
+
+/******************************************************************************/
+static void core_sgemm_starpu_cpu(void *buffers[], void *cl_arg)
+{
+    plasma_enum_t transa, transb;
+    int m, n, k;
+    float alpha, beta;
+    plasma_sequence_t *sequence;
+    starpu_codelet_unpack_args(cl_arg, &transa, &transb, &m, &n, &k,
+                               &alpha, &beta, &sequence);
+
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    core_sgemm(transa, transb,
+               m, n, k,
+               alpha,
+               (float*)STARPU_MATRIX_GET_PTR(buffers[0]),
+               STARPU_MATRIX_GET_LD(buffers[0]),
+               (float*)STARPU_MATRIX_GET_PTR(buffers[1]),
+               STARPU_MATRIX_GET_LD(buffers[1]),
+               beta,
+               (float*)STARPU_MATRIX_GET_PTR(buffers[2]),
+               STARPU_MATRIX_GET_LD(buffers[2]));
+}
+
+/******************************************************************************/
+static struct starpu_perfmodel core_sgemm_model = {
+    .type = STARPU_HISTORY_BASED,
+    .symbol = "core_sgemm",
+};
+
+static struct starpu_codelet core_sgemm_codelet = {
+    .cpu_funcs = {core_sgemm_starpu_cpu},
+    .nbuffers = 3,
+    .modes = {STARPU_R, STARPU_R, STARPU_RW},
+    .model = &core_sgemm_model,
+    .name = "sgemm",
+};
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Inserts core_sgemm on the tiles A, B and C as a StarPU task.
+ *  The sequence is checked when the task runs.
+ *
+ ******************************************************************************/
+void core_starpu_sgemm(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       float alpha, starpu_data_handle_t A,
+                                                 starpu_data_handle_t B,
+                       float beta,  starpu_data_handle_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int retval = starpu_task_insert(
+        &core_sgemm_codelet,
+        STARPU_VALUE, &transa,   sizeof(plasma_enum_t),
+        STARPU_VALUE, &transb,   sizeof(plasma_enum_t),
+        STARPU_VALUE, &m,        sizeof(int),
+        STARPU_VALUE, &n,        sizeof(int),
+        STARPU_VALUE, &k,        sizeof(int),
+        STARPU_VALUE, &alpha,    sizeof(float),
+        STARPU_VALUE, &beta,     sizeof(float),
+        STARPU_VALUE, &sequence, sizeof(plasma_sequence_t*),
+        STARPU_R,  A,
+        STARPU_R,  B,
+        STARPU_RW, C,
+        0);
+    if (retval != 0) {
+        coreblas_error("starpu_task_insert() failed");
+        plasma_request_fail(sequence, request, PlasmaErrorInternal);
+    }
+}
+
+#endif // PLASMA_WITH_STARPU
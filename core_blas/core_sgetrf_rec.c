@@ -0,0 +1,294 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf_rec.c, normal z -> s, Thu Oct 15 03:15:52 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_barrier.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#include <omp.h>
+#include <assert.h>
+#include <math.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// Swaps rows k1 to k2-1 with their pivots in columns n1 to n2-1 (rank 0).
+static void core_sgetrf_rec_swap(plasma_desc_t A, int *ipiv,
+                                 int k1, int k2, int n1, int n2)
+{
+    if (n2 <= n1)
+        return;
+
+    for (int i = k1; i < k2; i++) {
+        int ip = ipiv[i]-1;
+        if (ip != i) {
+            float *ai = A(i/A.mb, 0);
+            float *ap = A(ip/A.mb, 0);
+            int ldai = plasma_tile_mmain(A, i/A.mb);
+            int ldap = plasma_tile_mmain(A, ip/A.mb);
+
+            cblas_sswap(n2-n1,
+                        &ai[i%A.mb+n1*ldai], ldai,
+                        &ap[ip%A.mb+n1*ldap], ldap);
+        }
+    }
+}
+
+/******************************************************************************/
+// Factors columns k to k+n-1 column by column, with the parallel pivot search.
+static void core_sgetrf_rec_leaf(plasma_desc_t A, int *ipiv, int k, int n,
+                                 int rank, int size,
+                                 plasma_panel_workspace_t *work,
+                                 plasma_barrier_t *barrier)
+{
+    int *max_idx = work->max_idx;
+    float *max_val = (float*)work->max_val;
+
+    float sfmin = LAPACKE_slamch_work('S');
+
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int mva0 = plasma_tile_mview(A, 0);
+
+    for (int j = k; j < k+n; j++) {
+        // pivot search, done with the update of the previous column
+        // after the first column of the block
+        if (j == k) {
+            max_idx[rank] = 0;
+            max_val[rank] = 0.0;
+
+            for (int l = rank; l < A.mt; l += size) {
+                float *al = A(l, 0);
+                int ldal = plasma_tile_mmain(A, l);
+                int mval = plasma_tile_mview(A, l);
+
+                float val;
+                if (l == 0) {
+                    int i = core_isamax(mva0-j, &a0[j+j*lda0], &val);
+                    max_val[rank] = val;
+                    max_idx[rank] = i;
+                }
+                else if (mval > 0) {
+                    int i = core_isamax(mval, &al[j*ldal], &val);
+                    if (val > max_val[rank]) {
+                        max_val[rank] = val;
+                        max_idx[rank] = A.mb*l+i-j;
+                    }
+                }
+            }
+        }
+
+        plasma_barrier_wait(barrier, rank);
+        if (rank == 0) {
+            // max reduction
+            for (int i = 1; i < size; i++) {
+                if (max_val[i] > max_val[0]) {
+                    max_val[0] = max_val[i];
+                    max_idx[0] = max_idx[i];
+                }
+            }
+
+            int jp = j+max_idx[0];
+            ipiv[j] = jp+1;
+
+            // singularity check
+            if (work->info == 0 && max_val[0] == 0.0) {
+                work->info = j+1;
+            }
+            else {
+                // pivot swap within the leaf
+                core_sgetrf_rec_swap(A, ipiv, j, j+1, k, k+n);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+
+        // column scaling, update of the next column of the leaf with the
+        // search of its pivot, and update within the leaf (all ranks)
+        int next = j+1 < k+n;
+        max_idx[rank] = 0;
+        max_val[rank] = 0.0;
+        for (int l = rank; l < A.mt; l += size) {
+            float *al = A(l, 0);
+            int ldal = plasma_tile_mmain(A, l);
+            int mval = plasma_tile_mview(A, l);
+
+            // first row and number of rows below the pivot in this tile
+            int i0 = l == 0 ? j+1 : 0;
+            int mi = l == 0 ? mva0-j-1 : mval;
+
+            float val;
+            int i = core_sgetrf_column(
+                mi, work->info == 0, a0[j+j*lda0], sfmin,
+                &al[i0+j*ldal],
+                next ? a0[j+(j+1)*lda0] : 0.0,
+                next ? &al[i0+(j+1)*ldal] : NULL, &val);
+            if (next && mi > 0 && val > max_val[rank]) {
+                max_val[rank] = val;
+                max_idx[rank] = A.mb*l+i0+i-(j+1);
+            }
+
+            float zmone = -1.0;
+            if (k+n-j-2 > 0) {
+                cblas_sger(CblasColMajor,
+                            mi, k+n-j-2,
+                            (zmone), &al[i0+j*ldal], 1,
+                                                &a0[j+(j+2)*lda0], lda0,
+                                                &al[i0+(j+2)*ldal], ldal);
+            }
+        }
+        plasma_barrier_wait(barrier, rank);
+    }
+}
+
+/******************************************************************************/
+// Factors columns k to k+n-1 of the panel by splitting them in halves.
+static void core_sgetrf_rec_step(plasma_desc_t A, int *ipiv, int ib,
+                                 int k, int n, int rank, int size,
+                                 plasma_panel_workspace_t *work,
+                                 plasma_barrier_t *barrier)
+{
+    if (n <= ib) {
+        core_sgetrf_rec_leaf(A, ipiv, k, n, rank, size, work, barrier);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    // left half
+    core_sgetrf_rec_step(A, ipiv, ib, k, n1, rank, size, work, barrier);
+
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int mva0 = plasma_tile_mview(A, 0);
+
+    // right pivoting and trsm (rank 0)
+    if (rank == 0) {
+        core_sgetrf_rec_swap(A, ipiv, k, k+n1, k+n1, k+n);
+
+        float zone = 1.0;
+        cblas_strsm(CblasColMajor,
+                    PlasmaLeft, PlasmaLower,
+                    PlasmaNoTrans, PlasmaUnit,
+                    n1, n2,
+                    (zone), &a0[k+k*lda0], lda0,
+                                       &a0[k+(k+n1)*lda0], lda0);
+    }
+    plasma_barrier_wait(barrier, rank);
+
+    // gemm (all ranks)
+    float zone = 1.0;
+    float zmone = -1.0;
+    for (int l = rank; l < A.mt; l += size) {
+        float *al = A(l, 0);
+        int ldal = plasma_tile_mmain(A, l);
+        int mval = plasma_tile_mview(A, l);
+
+        int i0 = l == 0 ? k+n1 : 0;
+        int mi = l == 0 ? mva0-k-n1 : mval;
+
+        cblas_sgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    mi, n2, n1,
+                    (zmone), &al[i0+k*ldal], ldal,
+                                        &a0[k+(k+n1)*lda0], lda0,
+                    (zone),  &al[i0+(k+n1)*ldal], ldal);
+    }
+    plasma_barrier_wait(barrier, rank);
+
+    // right half
+    core_sgetrf_rec_step(A, ipiv, ib, k+n1, n2, rank, size, work, barrier);
+
+    // left pivoting (rank 0)
+    if (rank == 0)
+        core_sgetrf_rec_swap(A, ipiv, k+n1, k+n, k, k+n1);
+    plasma_barrier_wait(barrier, rank);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Computes the LU factorization of a panel of tile rows, using a recursive
+ *  splitting of the columns in halves. The updates between the halves are
+ *  BLAS-3 trsm and gemm, and the parallel pivot search with its barriers is
+ *  only used in the leaves of at most ib columns.
+ *  Returns the same factorization and pivots as core_sgetrf.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *          The panel of tile rows to factor.
+ *
+ * @param[out] ipiv
+ *          The pivot indices, relative to the first row of the panel.
+ *
+ * @param[in] ib
+ *          The largest number of columns factored without recursion.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread among the panel threads.
+ *
+ * @param[in] size
+ *          The number of panel threads.
+ *
+ * @param[in,out] work
+ *          The pivot search scratch shared by the panel threads.
+ *
+ * @param[in] barrier
+ *          The barrier synchronizing the panel threads.
+ *
+ *******************************************************************************
+ *
+ * @retval 0 on success, or on ranks other than 0.
+ * @retval > 0 if U(i,i) is exactly zero, the index i of the first zero pivot.
+ *
+ ******************************************************************************/
+int core_sgetrf_rec(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                    plasma_panel_workspace_t *work, plasma_barrier_t *barrier)
+{
+    assert(work->size >= size);
+
+    if (rank == 0)
+        work->info = 0;
+    plasma_barrier_wait(barrier, rank);
+
+    int minmn = imin(A.m, A.n);
+    core_sgetrf_rec_step(A, ipiv, imax(ib, 1), 0, minmn, rank, size,
+                         work, barrier);
+
+    // columns right of the square part (rank 0)
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int nva0 = plasma_tile_nview(A, 0);
+    if (rank == 0 && nva0 > minmn) {
+        core_sgetrf_rec_swap(A, ipiv, 0, minmn, minmn, nva0);
+
+        float zone = 1.0;
+        cblas_strsm(CblasColMajor,
+                    PlasmaLeft, PlasmaLower,
+                    PlasmaNoTrans, PlasmaUnit,
+                    minmn, nva0-minmn,
+                    (zone), a0, lda0,
+                                       &a0[minmn*lda0], lda0);
+    }
+
+    // Only rank 0 returns errors.
+    if (rank == 0)
+        return work->info;
+    else
+        return 0;
+}
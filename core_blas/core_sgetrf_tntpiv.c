@@ -0,0 +1,266 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf_tntpiv.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Selects the pivot candidates of one tile for tournament pivoting.
+ *  Factors a copy of the m-by-n tile A with partial pivoting and returns
+ *  the original rows chosen as the min(m, n) pivots, in pivot order.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A.
+ *
+ * @param[in] A
+ *          The m-by-n tile. Not modified.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] row0
+ *          The index of the first row of A in the panel.
+ *
+ * @param[out] C
+ *          On exit, the min(m, n) candidate rows of A.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= min(m, n).
+ *
+ * @param[out] rows
+ *          On exit, the panel indices of the candidate rows.
+ *
+ * @param[out] W
+ *          Workspace of size m*n.
+ *
+ * @param[out] iwork
+ *          Workspace of size m+min(m, n).
+ *
+ *******************************************************************************
+ *
+ * @return The number of candidate rows, min(m, n).
+ *
+ ******************************************************************************/
+int core_sgetrf_tntpiv_leaf(int m, int n,
+                            const float *A, int lda, int row0,
+                            float *C, int ldc, int *rows,
+                            float *W, int *iwork)
+{
+    int c = imin(m, n);
+    if (c == 0)
+        return 0;
+
+    // Factor a copy of the tile.
+    LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                        lapack_const(PlasmaGeneral),
+                        m, n, A, lda, W, m);
+    int *perm = iwork;
+    int *ipiv = &iwork[m];
+    LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, m, n, W, m, ipiv);
+
+    // Apply the pivots to the row order.
+    for (int i = 0; i < m; i++)
+        perm[i] = i;
+    for (int i = 0; i < c; i++) {
+        int tmp = perm[i];
+        perm[i] = perm[ipiv[i]-1];
+        perm[ipiv[i]-1] = tmp;
+    }
+
+    // Gather the original rows.
+    for (int i = 0; i < c; i++) {
+        rows[i] = row0+perm[i];
+        cblas_scopy(n, &A[perm[i]], lda, &C[i], ldc);
+    }
+    return c;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Merges two sets of pivot candidates for tournament pivoting.
+ *  Factors a copy of the stacked candidates with partial pivoting and keeps
+ *  the original rows chosen as the min(c1+c2, n) pivots, in pivot order.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The number of columns of the candidates.
+ *
+ * @param[in,out] C1
+ *          On entry, the c1 candidate rows of the first set.
+ *          On exit, the merged candidate rows.
+ *
+ * @param[in,out] rows1
+ *          On entry, the panel indices of the first set.
+ *          On exit, the panel indices of the merged set.
+ *
+ * @param[in] c1
+ *          The number of candidates of the first set.
+ *
+ * @param[in] C2
+ *          The c2 candidate rows of the second set.
+ *
+ * @param[in] rows2
+ *          The panel indices of the second set.
+ *
+ * @param[in] c2
+ *          The number of candidates of the second set.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C1 and C2. ldc >= min(n, c1+c2).
+ *
+ * @param[out] W
+ *          Workspace of size 2*(c1+c2)*n.
+ *
+ * @param[out] iwork
+ *          Workspace of size 2*(c1+c2)+min(c1+c2, n).
+ *
+ *******************************************************************************
+ *
+ * @return The number of merged candidate rows, min(c1+c2, n).
+ *
+ ******************************************************************************/
+int core_sgetrf_tntpiv_merge(int n,
+                             float *C1, int *rows1, int c1,
+                             const float *C2, const int *rows2,
+                             int c2, int ldc,
+                             float *W, int *iwork)
+{
+    int m = c1+c2;
+    int c = imin(m, n);
+    if (c2 == 0)
+        return c1;
+
+    // Stack the candidates and keep a copy of the original rows.
+    float *S = &W[m*n];
+    LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                        lapack_const(PlasmaGeneral),
+                        c1, n, C1, ldc, S, m);
+    LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                        lapack_const(PlasmaGeneral),
+                        c2, n, C2, ldc, &S[c1], m);
+    LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                        lapack_const(PlasmaGeneral),
+                        m, n, S, m, W, m);
+
+    int *perm = iwork;
+    int *rows = &iwork[m];
+    int *ipiv = &iwork[2*m];
+    for (int i = 0; i < c1; i++)
+        rows[i] = rows1[i];
+    for (int i = 0; i < c2; i++)
+        rows[c1+i] = rows2[i];
+
+    // Factor the stacked candidates.
+    LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, m, n, W, m, ipiv);
+
+    // Apply the pivots to the row order.
+    for (int i = 0; i < m; i++)
+        perm[i] = i;
+    for (int i = 0; i < c; i++) {
+        int tmp = perm[i];
+        perm[i] = perm[ipiv[i]-1];
+        perm[ipiv[i]-1] = tmp;
+    }
+
+    // Gather the winning rows.
+    for (int i = 0; i < c; i++) {
+        rows1[i] = rows[perm[i]];
+        cblas_scopy(n, &S[perm[i]], m, &C1[i], ldc);
+    }
+    return c;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Computes the LU factorization of an m-by-n tile without pivoting.
+ *  Used on the top tile of the panel once tournament pivoting has moved
+ *  the selected rows into place.
+ *
+ *******************************************************************************
+ *
+ * @return 0 on success, or i > 0 if U(i,i) is exactly zero.
+ *         After a zero pivot, the columns are updated but not scaled.
+ *
+ ******************************************************************************/
+int core_sgetrf_nopiv(int m, int n, float *A, int lda)
+{
+    int info = 0;
+    float sfmin = LAPACKE_slamch_work('S');
+
+    for (int j = 0; j < imin(m, n); j++) {
+        if (info == 0 && A[j+j*lda] == 0.0)
+            info = j+1;
+
+        if (info == 0) {
+            // column scaling
+            if (fabsf(A[j+j*lda]) >= sfmin) {
+                for (int i = j+1; i < m; i++)
+                    A[i+j*lda] /= A[j+j*lda];
+            }
+            else {
+                float scal = 1.0/A[j+j*lda];
+                cblas_sscal(m-j-1, (scal), &A[j+1+j*lda], 1);
+            }
+        }
+
+        // trailing update
+        float zmone = -1.0;
+        cblas_sger(CblasColMajor,
+                    m-j-1, n-j-1,
+                    (zmone), &A[j+1+j*lda], 1,
+                                        &A[j+(j+1)*lda], lda,
+                                        &A[j+1+(j+1)*lda], lda);
+    }
+    return info;
+}
+
+/******************************************************************************/
+void core_omp_sgetrf_nopiv(int m, int n,
+                           float *A, int lda,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("sgetrf_nopiv", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_sgetrf_nopiv(m, n, A, lda);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat,
+                           (float)m*n*imin(m, n) -
+                           (float)(m+n)*imin(m, n)*imin(m, n)/2.0 +
+                           (float)imin(m, n)*imin(m, n)*imin(m, n)/3.0,
+                           2.0*m*n);
+        PLASMA_TRACE_STOP("sgetrf_nopiv", 1, A);
+    }
+}
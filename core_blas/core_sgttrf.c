@@ -0,0 +1,114 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgttrf.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gttrf
+ *
+ *  Computes the LU factorization, with partial pivoting, of an n-by-n
+ *  tridiagonal partition A of a larger tridiagonal matrix, and its spikes:
+ *  the solutions V and W of
+ *
+ *    \f[ A V = dun e_n, \qquad A W = dl0 e_1, \f]
+ *
+ *  where dun and dl0 are the elements coupling the partition to the next and
+ *  to the previous one.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the partition A. n >= 0.
+ *
+ * @param[in,out] dl
+ *          On entry, the n-1 subdiagonal elements of A.
+ *          On exit, the multipliers of the factorization, as in LAPACK sgttrf.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of A.
+ *          On exit, the diagonal of U.
+ *
+ * @param[in,out] du
+ *          On entry, the n-1 superdiagonal elements of A.
+ *          On exit, the first superdiagonal of U.
+ *
+ * @param[out] du2
+ *          The n-2 elements of the second superdiagonal of U.
+ *
+ * @param[out] ipiv
+ *          The n pivot indices of the factorization.
+ *
+ * @param[in] dl0
+ *          The element of the matrix left of the first row of A.
+ *
+ * @param[in] dun
+ *          The element of the matrix right of the last row of A.
+ *
+ * @param[out] VW
+ *          The n-by-2 matrix of the spikes, V then W.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if U(i,i) is exactly zero, for i the return value
+ *
+ ******************************************************************************/
+int core_sgttrf_spike(int n,
+                      float *dl, float *d,
+                      float *du, float *du2,
+                      int *ipiv,
+                      float dl0, float dun,
+                      float *VW)
+{
+    int info = LAPACKE_sgttrf_work(n, dl, d, du, du2, ipiv);
+    if (info != 0)
+        return info;
+
+    for (int i = 0; i < 2*n; i++)
+        VW[i] = 0.0;
+    VW[n-1] = dun;
+    VW[n]   = dl0;
+    return LAPACKE_sgttrs_work(LAPACK_COL_MAJOR, 'N', n, 2,
+                               dl, d, du, du2, ipiv, VW, n);
+}
+
+/******************************************************************************/
+// The factors of the partition are tracked through d.
+void core_omp_sgttrf_spike(int n,
+                           float *dl, float *d,
+                           float *du, float *du2,
+                           int *ipiv,
+                           float dl0, float dun,
+                           float *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(inout:d[0:n]) \
+                     depend(out:VW[0:2*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("sgttrf_spike", d);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_sgttrf_spike(n, dl, d, du, du2, ipiv,
+                                         dl0, dun, VW);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, 18.0*n, 6.0*n);
+        PLASMA_TRACE_STOP("sgttrf_spike", 2, d, VW);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
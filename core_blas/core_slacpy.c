@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlacpy.c, normal z -> s, Mon Feb  6 14:06:48 2017
+ * @generated from core_blas/core_zlacpy.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -71,12 +71,55 @@ void core_omp_slacpy(plasma_enum_t uplo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:B[0:ldb*n])
+                     depend(out:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("slacpy", B);
+        if (PLASMA_TRACE_RUN(sequence))
             core_slacpy(uplo,
                         m, n,
                         A, lda,
                         B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, 0.0, 2.0*m*n);
+        PLASMA_TRACE_STOP("slacpy", 1, B, A);
     }
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Copies the m-by-n matrix A to B by core_stream_copy(), column by column,
+ *  storing B past the caches, for the translations of matrices larger than
+ *  the caches. The copy is visible to the other threads after
+ *  core_stream_fence().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A and B. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A and B. n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-n matrix to copy.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] B
+ *          The m-by-n copy of the matrix A.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,m).
+ *
+ ******************************************************************************/
+void core_slacpy_stream(int m, int n,
+                        const float *A, int lda,
+                              float *B, int ldb)
+{
+    for (int j = 0; j < n; j++)
+        core_stream_copy(&B[(size_t)ldb*j], &A[(size_t)lda*j],
+                         (size_t)m*sizeof(float));
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlacpy_band.c, normal z -> s, Mon Feb  6 14:06:48 2017
+ * @generated from core_blas/core_zlacpy_band.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -15,6 +15,25 @@
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
+#include <string.h>
+
+/******************************************************************************/
+// Zeroes the m-by-n block B, by a single memset if its columns are contiguous.
+static inline void core_slacpy_band_zero(int m, int n,
+                                         float *B, int ldb)
+{
+    if (m <= 0 || n <= 0)
+        return;
+
+    if (ldb == m) {
+        memset(B, 0, (size_t)m*n*sizeof(float));
+    }
+    else {
+        for (int j = 0; j < n; j++)
+            memset(&B[(size_t)j*ldb], 0, m*sizeof(float));
+    }
+}
+
 /*******************************************************************************
  *
  * @ingroup core_float
@@ -50,13 +69,14 @@
  *          The leading dimension of the array B. ldb >= max(1,M).
  *
  ******************************************************************************/
+CORE_BLAS_MULTIVERSION
 void core_slacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
                                   const float *A, int lda,
                                         float *B, int ldb)
 {
-    int i, j;
+    int j;
     int j_start, j_end;
     if (uplo == PlasmaGeneral) {
         j_start = 0; // pivot back and could fill in
@@ -71,11 +91,12 @@ void core_slacpy_lapack2tile_band(plasma_enum_t uplo,
         j_end = n;
     }
 
-    for (j = 0; j < j_start; j++) {
-        for (i = 0; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-    }
+    j_start = imin(j_start, n);
+    j_end = imax(j_start, j_end);
+
+    // Columns left of the band, zeroed at once if contiguous.
+    core_slacpy_band_zero(m, j_start, &B[0], ldb);
+
     for (j = j_start; j < j_end; j++) {
         int i_start, i_end;
         if (uplo == PlasmaGeneral) {
@@ -92,22 +113,19 @@ void core_slacpy_lapack2tile_band(plasma_enum_t uplo,
             i_start = imax(0, (jt-it)*nb+j);
             i_end = imin(m, (jt-it)*nb+j+kl+1);
         }
+        i_start = imin(i_start, m);
+        i_end = imax(i_start, i_end);
 
-        for (i = 0; i < i_start; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-        for (i = i_start; i < i_end; i++) {
-            B[i + j*ldb] = A[i + j*lda];
-        }
-        for (i = i_end; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-    }
-    for (j = j_end; j < n; j++) {
-        for (i = 0; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
+        // Zeros above the band, the band, zeros below, in one pass.
+        float *Bj = &B[j*ldb];
+        memset(Bj, 0, i_start*sizeof(float));
+        memcpy(&Bj[i_start], &A[i_start + j*lda],
+               (i_end-i_start)*sizeof(float));
+        memset(&Bj[i_end], 0, (m-i_end)*sizeof(float));
     }
+
+    // Columns right of the band.
+    core_slacpy_band_zero(m, n-j_end, &B[j_end*ldb], ldb);
 }
 
 /******************************************************************************/
@@ -119,10 +137,14 @@ void core_omp_slacpy_lapack2tile_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
-    core_slacpy_lapack2tile_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 A, lda,
-                                 B, ldb);
+    {
+        PLASMA_TRACE_START("slacpy_lapack2tile_band", B);
+        core_slacpy_lapack2tile_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     A, lda,
+                                     B, ldb);
+        PLASMA_TRACE_STOP("slacpy_lapack2tile_band", 1, B, A);
+    }
 }
 
 /*******************************************************************************
@@ -160,13 +182,14 @@ void core_omp_slacpy_lapack2tile_band(plasma_enum_t uplo,
  *          The leading dimension of the array B. ldb >= max(1, m).
  *
  ******************************************************************************/
+CORE_BLAS_MULTIVERSION
 void core_slacpy_tile2lapack_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
                                   const float *B, int ldb,
                                         float *A, int lda)
 {
-    int i, j;
+    int j;
     int j_start, j_end;
 
     if (uplo == PlasmaGeneral) {
@@ -200,9 +223,9 @@ void core_slacpy_tile2lapack_band(plasma_enum_t uplo,
             i_end = imin(m, (jt-it)*nb+j+kl+1);
         }
 
-        for (i = i_start; i < i_end; i++) {
-            A[i + j*lda] = B[i + j*ldb];
-        }
+        if (i_end > i_start)
+            memcpy(&A[i_start + j*lda], &B[i_start + j*ldb],
+                   (i_end-i_start)*sizeof(float));
     }
 }
 
@@ -215,8 +238,12 @@ void core_omp_slacpy_tile2lapack_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:B[0:ldb*n]) \
                      depend(out:A[0:lda*n])
-    core_slacpy_tile2lapack_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 B, ldb,
-                                 A, lda);
+    {
+        PLASMA_TRACE_START("slacpy_tile2lapack_band", A);
+        core_slacpy_tile2lapack_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     B, ldb,
+                                     A, lda);
+        PLASMA_TRACE_STOP("slacpy_tile2lapack_band", 1, A, B);
+    }
 }
@@ -0,0 +1,84 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+
+#include <string.h>
+
+/******************************************************************************/
+// Rounds x to the nearest bfloat16, ties to even; NaNs stay quiet NaNs.
+static inline plasma_bfloat16_t core_sbfloat16(float x)
+{
+    uint32_t u;
+    memcpy(&u, &x, sizeof(u));
+    if ((u & 0x7fffffff) > 0x7f800000)
+        return (plasma_bfloat16_t)((u >> 16) | 0x0040);
+
+    u += 0x7fff + ((u >> 16) & 1);
+    return (plasma_bfloat16_t)(u >> 16);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix A from single precision to bfloat16,
+ *  rounding to nearest.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in single precision to convert.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] Ab
+ *          On exit, the converted ldab-by-n matrix in bfloat16.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the matrix Ab.
+ *          ldab >= max(1,m).
+ *
+ ******************************************************************************/
+void core_slag2bf(int m, int n,
+                  const float *A, int lda,
+                  plasma_bfloat16_t *Ab, int ldab)
+{
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            Ab[i+(size_t)ldab*j] = core_sbfloat16(A[i+(size_t)lda*j]);
+}
+
+/******************************************************************************/
+void core_omp_slag2bf(int m, int n,
+                      const float *A, int lda,
+                      plasma_bfloat16_t *Ab, int ldab,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:Ab[0:ldab*n])
+    {
+        PLASMA_TRACE_START("slag2bf", Ab);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_slag2bf(m, n, A, lda, Ab, ldab);
+        PLASMA_TRACE_STOP("slag2bf", 1, Ab, A);
+    }
+}
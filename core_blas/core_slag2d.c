@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_clag2z.c, mixed zc -> ds, Mon Feb  6 14:06:45 2017
+ * @generated from core_blas/core_clag2z.c, mixed zc -> ds, Thu Oct 15 08:00:08 2026
  *
  **/
 
@@ -61,7 +61,9 @@ void core_omp_slag2d(int m, int n,
     #pragma omp task depend(in:As[0:ldas*n]) \
                      depend(out:A[0:lda*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("slag2d", A);
+        if (PLASMA_TRACE_RUN(sequence))
             core_slag2d(m, n, As, ldas, A, lda);
+        PLASMA_TRACE_STOP("slag2d", 1, A, As);
     }
 }
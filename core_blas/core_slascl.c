@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlascl.c, normal z -> s, Mon Feb  6 14:06:50 2017
+ * @generated from core_blas/core_zlascl.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -39,12 +39,15 @@ void core_omp_slascl(plasma_enum_t uplo,
                      float *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("slascl", A);
+        if (PLASMA_TRACE_RUN(sequence))
             core_slascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+        PLASMA_TRACE_STOP("slascl", 1, A);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zlaset.c, normal z -> s, Mon Feb  6 14:06:51 2017
+ * @generated from core_blas/core_zlaset.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -77,7 +77,11 @@ void core_omp_slaset(plasma_enum_t uplo,
                      float *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    core_slaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        PLASMA_TRACE_START("slaset", A);
+        core_slaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        PLASMA_TRACE_STOP("slaset", 1, A);
+    }
 }
@@ -0,0 +1,90 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlrdecompress.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Expands in place the m-by-n tile A compressed by core_slrcompress,
+ *  A = U*V^T. A dense tile is left unchanged.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the factors U and V of rank *rank, or the dense tile.
+ *          On exit, the m-by-n dense tile.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in,out] rank
+ *          On entry, the rank of the factors, or -1 if A is dense.
+ *          On exit, -1.
+ *
+ * @param work
+ *          Workspace of size m*n.
+ *
+ ******************************************************************************/
+void core_slrdecompress(int m, int n,
+                        float *A, int lda, int *rank,
+                        float *work)
+{
+    int k = *rank;
+    if (k < 0)
+        return;
+
+    if (m > 0 && n > 0) {
+        float zzero = 0.0;
+        float zone  = 1.0;
+
+        cblas_sgemm(CblasColMajor, CblasNoTrans, CblasConjTrans,
+                    m, n, k,
+                    (zone),  A,                  lda,
+                                        &A[(size_t)lda*k], n,
+                    (zzero), work,               m);
+        LAPACKE_slacpy_work(LAPACK_COL_MAJOR, 'G', m, n, work, m, A, lda);
+    }
+    *rank = -1;
+}
+
+/******************************************************************************/
+void core_omp_slrdecompress(int m, int n,
+                            float *A, int lda, int *rank,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("slrdecompress", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            float *W = (float*)work.spaces[tid];
+            core_slrdecompress(m, n, A, lda, rank, W);
+        }
+        PLASMA_TRACE_STOP("slrdecompress", 1, A);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zparfb.c, normal z -> s, Mon Feb  6 14:06:52 2017
+ * @generated from core_blas/core_zparfb.c, normal z -> s, Thu Oct 15 05:34:47 2026
  *
  **/
 
@@ -15,6 +15,18 @@
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
+/******************************************************************************/
+// Columns (left) or rows (right) of A1 and A2 updated per pass of
+// core_sparfb, so that their blocks, of W and of the m-by-k reflectors
+// fit in CoreParfbCacheBytes, e.g., the L2 cache of a core.
+static inline int core_sparfb_block(int k, int m)
+{
+    enum { CoreParfbCacheBytes = 512*1024 };
+    int block = (CoreParfbCacheBytes/(int)sizeof(float)
+                 - m*k)/(m+2*k);
+    return imax(16, block);
+}
+
 /***************************************************************************//**
  *
  * @ingroup core_parfb
@@ -232,37 +244,46 @@ int core_sparfb(plasma_enum_t side, plasma_enum_t trans,
             // Form  H * A  or  H^T * A  where  A = ( A1 )
             //                                      ( A2 )
 
-            // W = A1 + op(V) * A2
-            core_spamm(PlasmaW, PlasmaLeft, storev,
-                       k, n1, m2, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+            // Update by blocks of columns, so that the block of W stays
+            // in the cache through the four steps, with V and T.
+            int nc = core_sparfb_block(k, m2);
+            for (int j0 = 0; j0 < n1; j0 += nc) {
+                int nj = imin(nc, n1-j0);
+                float *A1j = &A1[lda1*j0];
+                float *A2j = &A2[lda2*j0];
 
-            // W = op(T) * W
-            cblas_strmm(CblasColMajor,
-                        CblasLeft, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        k, n2,
-                        (zone), T,    ldt,
-                                           work, ldwork);
+                // W = A1 + op(V) * A2
+                core_spamm(PlasmaW, PlasmaLeft, storev,
+                           k, nj, m2, l,
+                           A1j,  lda1,
+                           A2j,  lda2,
+                           V,    ldv,
+                           work, ldwork);
 
-            // A1 = A1 - W
-            for (int j = 0; j < n1; j++) {
-                cblas_saxpy(k, (zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            }
+                // W = op(T) * W
+                cblas_strmm(CblasColMajor,
+                            CblasLeft, CblasUpper,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            k, nj,
+                            (zone), T,    ldt,
+                                               work, ldwork);
+
+                // A1 = A1 - W
+                for (int j = 0; j < nj; j++) {
+                    cblas_saxpy(k, (zmone),
+                                &work[ldwork*j], 1,
+                                &A1j[lda1*j], 1);
+                }
 
-            // A2 = A2 - op(V) * W
-            // W = V * W, A2 = A2 - W
-            core_spamm(PlasmaA2, PlasmaLeft, storev,
-                       m2, n2, k, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+                // A2 = A2 - op(V) * W
+                // W = V * W, A2 = A2 - W
+                core_spamm(PlasmaA2, PlasmaLeft, storev,
+                           m2, nj, k, l,
+                           A1j,  lda1,
+                           A2j,  lda2,
+                           V,    ldv,
+                           work, ldwork);
+            }
         }
         //==============================
         // PlasmaForward / PlasmaRight
@@ -270,37 +291,46 @@ int core_sparfb(plasma_enum_t side, plasma_enum_t trans,
         else {
             // Form  H * A  or  H^T * A  where A  = ( A1 A2 )
 
-            // W = A1 + A2 * op(V)
-            core_spamm(PlasmaW, PlasmaRight, storev,
-                       m1, k, n2, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+            // Update by blocks of rows, so that the block of W stays
+            // in the cache through the four steps, with V and T.
+            int mc = core_sparfb_block(k, n2);
+            for (int i0 = 0; i0 < m1; i0 += mc) {
+                int mi = imin(mc, m1-i0);
+                float *A1i = &A1[i0];
+                float *A2i = &A2[i0];
 
-            // W = W * op(T)
-            cblas_strmm(CblasColMajor,
-                        CblasRight, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        m2, k,
-                        (zone), T,    ldt,
-                                           work, ldwork);
+                // W = A1 + A2 * op(V)
+                core_spamm(PlasmaW, PlasmaRight, storev,
+                           mi, k, n2, l,
+                           A1i,  lda1,
+                           A2i,  lda2,
+                           V,    ldv,
+                           work, ldwork);
 
-            // A1 = A1 - W
-            for (int j = 0; j < k; j++) {
-                cblas_saxpy(m1, (zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            }
+                // W = W * op(T)
+                cblas_strmm(CblasColMajor,
+                            CblasRight, CblasUpper,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            mi, k,
+                            (zone), T,    ldt,
+                                               work, ldwork);
 
-            // A2 = A2 - W * op(V)
-            // W = W * V^T, A2 = A2 - W
-            core_spamm(PlasmaA2, PlasmaRight, storev,
-                       m2, n2, k, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+                // A1 = A1 - W
+                for (int j = 0; j < k; j++) {
+                    cblas_saxpy(mi, (zmone),
+                                &work[ldwork*j], 1,
+                                &A1i[lda1*j], 1);
+                }
+
+                // A2 = A2 - W * op(V)
+                // W = W * V^T, A2 = A2 - W
+                core_spamm(PlasmaA2, PlasmaRight, storev,
+                           mi, n2, k, l,
+                           A1i,  lda1,
+                           A2i,  lda2,
+                           V,    ldv,
+                           work, ldwork);
+            }
         }
     }
     else {
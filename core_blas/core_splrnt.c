@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zplrnt.c, normal z -> s, Thu Oct 15 05:12:53 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+
+#define REAL
+
+#ifdef COMPLEX
+#define NBELEM 2
+#else
+#define NBELEM 1
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_plrnt
+ *
+ *  Generates the m-by-n block at rows m0 and columns n0 of a random matrix
+ *  with bigm rows, of elements uniform in (-0.5, 0.5], or with real and
+ *  imaginary parts uniform in (-0.5, 0.5] in the complex precisions.
+ *  The elements depend only on their place in the matrix and on the seed,
+ *  not on the blocks the matrix is generated by.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the block A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the block A. n >= 0.
+ *
+ * @param[out] A
+ *          The m-by-n block.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] bigm
+ *          The number of rows of the matrix the block is part of.
+ *
+ * @param[in] m0
+ *          The row of the matrix of the first row of the block.
+ *
+ * @param[in] n0
+ *          The column of the matrix of the first column of the block.
+ *
+ * @param[in] seed
+ *          The seed of the random numbers.
+ *
+ ******************************************************************************/
+void core_splrnt(int m, int n, float *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed)
+{
+    for (int j = 0; j < n; j++) {
+        unsigned long long ran = core_rnd64_jump(
+            NBELEM*(m0+(unsigned long long)bigm*(n0+j)), seed);
+        for (int i = 0; i < m; i++) {
+            float a = core_rnd64_real(ran);
+            ran = core_rnd64_next(ran);
+#ifdef COMPLEX
+            a += core_rnd64_real(ran)*I;
+            ran = core_rnd64_next(ran);
+#endif
+            A[i+(size_t)lda*j] = a;
+        }
+    }
+}
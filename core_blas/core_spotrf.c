@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zpotrf.c, normal z -> s, Mon Feb  6 14:06:54 2017
+ * @generated from core_blas/core_zpotrf.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -61,6 +62,19 @@ int core_spotrf(plasma_enum_t uplo,
                           A, lda);
 }
 
+/******************************************************************************/
+// Runs the potrf of a task replayed from a task graph.
+static void core_spotrf_replay(const plasma_graph_task_t *task, void **tiles,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    int info = core_spotrf(task->param[0],
+                           task->dim[0],
+                           tiles[0], task->dim[1]);
+    if (info != 0)
+        plasma_request_fail(sequence, request, task->dim[2]+info);
+}
+
 /******************************************************************************/
 void core_omp_spotrf(plasma_enum_t uplo,
                      int n,
@@ -68,14 +82,29 @@ void core_omp_spotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_spotrf_replay,
+            .param = {uplo},
+            .dim = {n, lda, iinfo}};
+        PLASMA_GRAPH_ADD(task, 1, A);
+        return;
+    }
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("spotrf", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_spotrf(uplo,
                                    n,
                                    A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, (float)n*n*n/3.0,
+                           (float)n*(n+1));
+        PLASMA_TRACE_STOP("spotrf", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
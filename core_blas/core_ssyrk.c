@@ -6,11 +6,13 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsyrk.c, normal z -> s, Mon Feb  6 14:06:55 2017
+ * @generated from core_blas/core_zsyrk.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
+#include "plasma_runtime.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -82,6 +84,18 @@ void core_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 (beta),  C, ldc);
 }
 
+/******************************************************************************/
+// Runs the syrk of a task replayed from a task graph.
+static void core_ssyrk_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_ssyrk(task->param[0], task->param[1],
+               task->dim[0], task->dim[1],
+               task->alpha, tiles[1], task->dim[2],
+               task->beta,  tiles[0], task->dim[3]);
+}
+
 /******************************************************************************/
 void core_omp_ssyrk(
     plasma_enum_t uplo, plasma_enum_t trans,
@@ -90,6 +104,16 @@ void core_omp_ssyrk(
     float beta,        float *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_ssyrk_replay,
+            .param = {uplo, trans},
+            .dim = {n, k, lda, ldc},
+            .alpha = alpha, .beta = beta};
+        PLASMA_GRAPH_ADD(task, 1, C, A);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
@@ -97,12 +121,49 @@ void core_omp_ssyrk(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("ssyrk", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_ssyrk(uplo, trans,
+                       n, k,
+                       alpha, A, lda,
+                       beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, (float)k*n*(n+1),
+                           (float)n*k + (float)n*(n+1));
+        PLASMA_TRACE_STOP("ssyrk", 1, C, A);
+    }
+}
+
+/******************************************************************************/
+// Same as core_omp_ssyrk, with a commutative dependency on C, for the
+// accumulations into C in any order.
+void core_omp_ssyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    float alpha, const float *A, int lda,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    PLASMA_TASK(PLASMA_IN(A, 0, lda*ak)
+                PLASMA_COMMUTE(C, 0, ldc*n)
+                PLASMA_PRIORITY(plasma_sequence_priority(sequence)))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("ssyrk", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_ssyrk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, (float)k*n*(n+1),
+                           (float)n*k + (float)n*(n+1));
+        PLASMA_TRACE_STOP("ssyrk", 1, C, A);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_zsyssq.c, normal z -> s, Mon Feb  6 14:06:56 2017
+ * @generated from core_blas/core_zsyssq.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -60,13 +60,16 @@ void core_omp_ssyssq(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ssyssq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_ssyssq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("ssyssq", 2, scale, sumsq, A);
     }
 }
 
@@ -78,9 +81,11 @@ void core_omp_ssyssq_aux(int m, int n,
 {
     #pragma omp task depend(in:scale[0:n]) \
                      depend(in:sumsq[0:n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ssyssq_aux", value);
+        if (PLASMA_TRACE_RUN(sequence)) {
             float scl = 0.0;
             float sum = 1.0;
             for (int j = 0; j < n; j++) {
@@ -110,5 +115,6 @@ void core_omp_ssyssq_aux(int m, int n,
             }
             *value = scl*sqrtf(sum);
         }
+        PLASMA_TRACE_STOP("ssyssq_aux", 1, value, scale, sumsq);
     }
 }
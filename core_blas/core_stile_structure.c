@@ -0,0 +1,83 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztile_structure.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tile_structure
+ *
+ *  Returns the structure of the tile A: PlasmaTileZero if all of its
+ *  elements are zero, PlasmaTileIdentity if it is a square identity, and
+ *  PlasmaTileDense otherwise. The scan stops at the first element ruling
+ *  out both, the first element of a dense tile as a rule.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-n tile A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ ******************************************************************************/
+plasma_enum_t core_stile_structure(int m, int n,
+                                   const float *A, int lda)
+{
+    int zero = 1;
+    int identity = m == n;
+    for (int j = 0; j < n && (zero || identity); j++) {
+        for (int i = 0; i < m; i++) {
+            float a = A[(size_t)lda*j+i];
+            if (a != 0.0) {
+                zero = 0;
+                if (i != j || a != 1.0)
+                    identity = 0;
+            }
+            else if (i == j) {
+                identity = 0;
+            }
+        }
+    }
+    if (zero)
+        return PlasmaTileZero;
+    if (identity)
+        return PlasmaTileIdentity;
+
+    return PlasmaTileDense;
+}
+
+/******************************************************************************/
+void core_omp_stile_structure(int m, int n,
+                              const float *A, int lda,
+                              plasma_enum_t *structure,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:structure[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("stile_structure", structure);
+        if (PLASMA_TRACE_RUN(sequence))
+            *structure = core_stile_structure(m, n, A, lda);
+        PLASMA_TRACE_STOP("stile_structure", 1, structure, A);
+    }
+}
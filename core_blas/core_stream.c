@@ -0,0 +1,119 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core_blas.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// distance in bytes of the prefetches ahead of the source,
+// and size of the cache lines of core_prefetch_tile()
+enum {
+    CoreStreamPrefetch = 512,
+    CoreCacheLine = 64
+};
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Copies size bytes from src to dst, storing the aligned 16-byte blocks of
+ *  dst past the caches, with SSE2, so that a copy larger than the caches
+ *  neither evicts their data nor reads dst before writing it, and
+ *  prefetching src ahead. Elsewhere, a plain memcpy. The stores are ordered
+ *  with respect to those of the other threads only after
+ *  core_stream_fence().
+ *
+ ******************************************************************************/
+void core_stream_copy(void *dst, const void *src, size_t size)
+{
+#if defined(__SSE2__)
+    char *d = (char*)dst;
+    const char *s = (const char*)src;
+
+    // bytes up to the first aligned block of dst
+    size_t head = (16 - ((uintptr_t)d & 15)) & 15;
+    if (head > size)
+        head = size;
+    memcpy(d, s, head);
+
+    size_t k = head;
+    for (; k+64 <= size; k += 64) {
+        __builtin_prefetch(&s[k+CoreStreamPrefetch], 0, 0);
+        __m128i x0 = _mm_loadu_si128((const __m128i*)&s[k]);
+        __m128i x1 = _mm_loadu_si128((const __m128i*)&s[k+16]);
+        __m128i x2 = _mm_loadu_si128((const __m128i*)&s[k+32]);
+        __m128i x3 = _mm_loadu_si128((const __m128i*)&s[k+48]);
+        _mm_stream_si128((__m128i*)&d[k],    x0);
+        _mm_stream_si128((__m128i*)&d[k+16], x1);
+        _mm_stream_si128((__m128i*)&d[k+32], x2);
+        _mm_stream_si128((__m128i*)&d[k+48], x3);
+    }
+    for (; k+16 <= size; k += 16) {
+        _mm_stream_si128((__m128i*)&d[k],
+                         _mm_loadu_si128((const __m128i*)&s[k]));
+    }
+    memcpy(&d[k], &s[k], size-k);
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Orders the stores of core_stream_copy() before the following ones,
+ *  so that the copies are visible to the tasks reading them next.
+ *
+ ******************************************************************************/
+void core_stream_fence()
+{
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lacpy
+ *
+ *  Prefetches the m-by-n tile A, of elements of size bytes and leading
+ *  dimension lda, into the outer caches of the core, one request per cache
+ *  line, to be read by the next kernel of the calling thread. The requests
+ *  return at once, and the lines arrive while the thread computes.
+ *
+ ******************************************************************************/
+void core_prefetch_tile(const void *A, int m, int n, int lda, size_t size)
+{
+#if defined(__GNUC__)
+    if (m <= 0 || n <= 0)
+        return;
+
+    const char *a = (const char*)A;
+    size_t column = (size_t)m*size;
+    for (int j = 0; j < n; j++) {
+        const char *aj = &a[(size_t)lda*j*size];
+        for (size_t k = 0; k < column; k += CoreCacheLine)
+            __builtin_prefetch(&aj[k], 0, 2);
+        __builtin_prefetch(&aj[column-1], 0, 2);
+    }
+#else
+    (void)A;
+    (void)m;
+    (void)n;
+    (void)lda;
+    (void)size;
+#endif
+}
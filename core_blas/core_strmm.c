@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztrmm.c, normal z -> s, Mon Feb  6 14:06:57 2017
+ * @generated from core_blas/core_ztrmm.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -124,13 +124,16 @@ void core_omp_strmm(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*m])
+                     depend(inout:B[0:ldb*m]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("strmm", B);
+        if (PLASMA_TRACE_RUN(sequence))
             core_strmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        PLASMA_TRACE_STOP("strmm", 1, B, A);
     }
 }
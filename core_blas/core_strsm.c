@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztrsm.c, normal z -> s, Mon Feb  6 14:06:57 2017
+ * @generated from core_blas/core_ztrsm.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -98,6 +99,19 @@ void core_strsm(plasma_enum_t side, plasma_enum_t uplo,
                                     B, ldb);
 }
 
+/******************************************************************************/
+// Runs the trsm of a task replayed from a task graph.
+static void core_strsm_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_strsm(task->param[0], task->param[1],
+               task->param[2], task->param[3],
+               task->dim[0], task->dim[1],
+               task->alpha, tiles[1], task->dim[2],
+                            tiles[0], task->dim[3]);
+}
+
 /******************************************************************************/
 void core_omp_strsm(
     plasma_enum_t side, plasma_enum_t uplo,
@@ -107,6 +121,16 @@ void core_omp_strsm(
                                     float *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_strsm_replay,
+            .param = {side, uplo, transa, diag},
+            .dim = {m, n, lda, ldb},
+            .alpha = alpha};
+        PLASMA_GRAPH_ADD(task, 1, B, A);
+        return;
+    }
+
     int ak;
     if (side == PlasmaLeft)
         ak = m;
@@ -114,13 +138,19 @@ void core_omp_strsm(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("strsm", B);
+        if (PLASMA_TRACE_RUN(sequence))
             core_strsm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat,
+                           side == PlasmaLeft ? (float)m*m*n : (float)m*n*n,
+                           (side == PlasmaLeft ? 0.5*m*m : 0.5*n*n) + 2.0*m*n);
+        PLASMA_TRACE_STOP("strsm", 1, B, A);
     }
 }
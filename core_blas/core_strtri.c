@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztrtri.c, normal z -> s, Mon Feb  6 14:06:58 2017
+ * @generated from core_blas/core_ztrtri.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -71,13 +71,17 @@ void core_omp_strtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("strtri", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_strtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_STOP("strtri", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from core_blas/core_ztsqrt.c, normal z -> s, Mon Feb  6 14:07:00 2017
+ * @generated from core_blas/core_ztsqrt.c, normal z -> s, Thu Oct 15 08:00:06 2026
  *
  **/
 
@@ -106,7 +106,7 @@ int core_stsqrt(int m, int n, int ib,
         coreblas_error("NULL A1");
         return -4;
     }
-    if (lda1 < imax(1, m) && m > 0) {
+    if (lda1 < imax(1, n) && n > 0) {
         coreblas_error("illegal value of lda1");
         return -5;
     }
@@ -135,77 +135,12 @@ int core_stsqrt(int m, int n, int ib,
         return -11;
     }
 
-    // quick return
-    if (m == 0 || n == 0 || ib == 0)
-        return PlasmaSuccess;
-
-    static float zone  = 1.0;
-    static float zzero = 0.0;
-
-    for (int ii = 0; ii < n; ii += ib) {
-        int sb = imin(n-ii, ib);
-        for (int i = 0; i < sb; i++) {
-            // Generate elementary reflector H( II*IB+I ) to annihilate
-            // A( II*IB+I:M, II*IB+I ).
-            LAPACKE_slarfg_work(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,
-                                &tau[ii+i]);
-
-            if (ii+i+1 < n) {
-                // Apply H( II*IB+I ) to A( II*IB+I:M, II*IB+I+1:II*IB+IB )
-                // from the left.
-                float alpha = -(tau[ii+i]);
-                cblas_scopy(sb-i-1, &A1[lda1*(ii+i+1)+(ii+i)], lda1, work, 1);
-#ifdef COMPLEX
-                LAPACKE_slacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_sgemv(CblasColMajor, (CBLAS_TRANSPOSE)PlasmaTrans,
-                            m, sb-i-1,
-                            (zone), &A2[lda2*(ii+i+1)], lda2,
-                            &A2[lda2*(ii+i)], 1,
-                            (zone), work, 1);
-#ifdef COMPLEX
-                LAPACKE_slacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_saxpy(sb-i-1, (alpha), work, 1,
-                            &A1[lda1*(ii+i+1)+ii+i], lda1);
-#ifdef COMPLEX
-                LAPACKE_slacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_sger(CblasColMajor,
-                            m, sb-i-1,
-                            (alpha), &A2[lda2*(ii+i)], 1,
-                            work, 1,
-                            &A2[lda2*(ii+i+1)], lda2);
-            }
-            // Calculate T.
-            float alpha = -tau[ii+i];
-            cblas_sgemv(CblasColMajor, (CBLAS_TRANSPOSE)PlasmaTrans,
-                        m, i,
-                        (alpha), &A2[lda2*ii], lda2,
-                        &A2[lda2*(ii+i)], 1,
-                        (zzero), &T[ldt*(ii+i)], 1);
-
-            cblas_strmv(CblasColMajor, (CBLAS_UPLO)PlasmaUpper,
-                        (CBLAS_TRANSPOSE)PlasmaNoTrans,
-                        (CBLAS_DIAG)PlasmaNonUnit,
-                        i,
-                        &T[ldt*ii], ldt,
-                        &T[ldt*(ii+i)], 1);
-
-            T[ldt*(ii+i)+i] = tau[ii+i];
-        }
-        if (n > ii+sb) {
-            core_stsmqr(PlasmaLeft, PlasmaTrans,
-                        sb, n-(ii+sb), m, n-(ii+sb), ib, ib,
-                        &A1[lda1*(ii+sb)+ii], lda1,
-                        &A2[lda2*(ii+sb)], lda2,
-                        &A2[lda2*ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, sb);
-        }
-    }
-
-    return PlasmaSuccess;
+    // Factor by blocks of ib columns, each recursively.
+    return core_stpqrt(m, n, 0, ib,
+                       A1, lda1,
+                       A2, lda2,
+                       T,  ldt,
+                       work);
 }
 
 /******************************************************************************/
@@ -218,9 +153,11 @@ void core_omp_stsqrt(int m, int n, int ib,
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("stsqrt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *tau = ((float*)work.spaces[tid]);
@@ -238,5 +175,9 @@ void core_omp_stsqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat, 2.0*m*n*n,
+                           (float)n*(n+1) + 2.0*m*n + (float)ib*n);
+        PLASMA_TRACE_STOP("stsqrt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -0,0 +1,167 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztstrf.c, normal z -> s, Thu Oct 15 08:00:06 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tstrf
+ *
+ *  Computes the LU factorization of a matrix formed by coupling an n-by-n
+ *  upper triangular tile U on top of an m-by-n tile A, with partial
+ *  pivoting between the rows of U and A, the incremental pivoting of
+ *  the TS (triangle on top of square) LU,
+ *
+ *    P * | U | = | L1  0 | * | U' |
+ *        | A |   | L2  I |   | 0  |
+ *
+ *  by blocks of ib columns: the block of the columns j to j+sb-1 interchanges
+ *  the rows j to j+sb-1 of U with the rows of A only, so that L1 is block
+ *  diagonal, its sb-by-sb unit lower triangular blocks stored in L.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The order of the tile U, and number of columns of A. n >= 0.
+ *
+ * @param[in] ib
+ *          The inner-blocking size. ib > 0.
+ *
+ * @param[in,out] U
+ *          On entry, the n-by-n upper triangular tile U.
+ *          On exit, the upper triangular factor U'.
+ *          The elements below the diagonal are not referenced.
+ *
+ * @param[in] ldu
+ *          The leading dimension of the array U. ldu >= max(1,n).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile A.
+ *          On exit, the factor L2.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] L
+ *          The ib-by-n blocks L1, below their unit diagonals.
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,ib).
+ *
+ * @param[out] ipiv
+ *          The n pivot indices, relative to each block: in the block of
+ *          the columns j to j+sb-1, i in 1 to sb is the row j+i of U,
+ *          i > sb the row i-sb of A.
+ *
+ * @param work
+ *          Workspace of size ldwork*ib.
+ *
+ * @param[in] ldwork
+ *          The leading dimension of the array work. ldwork >= ib+m.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if i, U'(i,i) is exactly zero.
+ *
+ ******************************************************************************/
+int core_ststrf(int m, int n, int ib,
+                float *U, int ldu,
+                float *A, int lda,
+                float *L, int ldl,
+                int *ipiv,
+                float *work, int ldwork)
+{
+    int info = 0;
+    for (int j = 0; j < n; j += ib) {
+        int sb = imin(ib, n-j);
+
+        // work = [ triangle of U(j:j+sb-1, j:j+sb-1); A(:, j:j+sb-1) ]
+        for (int jj = 0; jj < sb; jj++) {
+            for (int ii = 0; ii < sb; ii++)
+                work[ldwork*jj+ii] = ii <= jj ? U[ldu*(j+jj)+j+ii] : 0.0;
+            for (int ii = 0; ii < m; ii++)
+                work[ldwork*jj+sb+ii] = A[lda*(j+jj)+ii];
+        }
+
+        int iinfo = LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, sb+m, sb,
+                                        work, ldwork, &ipiv[j]);
+        if (iinfo > 0 && info == 0)
+            info = j+iinfo;
+
+        LAPACKE_slacpy_work(LAPACK_COL_MAJOR, 'U', sb, sb,
+                            work, ldwork, &U[ldu*j+j], ldu);
+        LAPACKE_slacpy_work(LAPACK_COL_MAJOR, 'L', sb, sb,
+                            work, ldwork, &L[ldl*j], ldl);
+        LAPACKE_slacpy_work(LAPACK_COL_MAJOR, 'A', m, sb,
+                            &work[sb], ldwork, &A[lda*j], lda);
+
+        // Apply the block to the columns on its right.
+        if (j+sb < n) {
+            core_sssssm(m, n-(j+sb), sb, sb,
+                        &U[ldu*(j+sb)+j], ldu,
+                        &A[lda*(j+sb)],   lda,
+                        &L[ldl*j],        ldl,
+                        &A[lda*j],        lda,
+                        &ipiv[j]);
+        }
+    }
+    return info;
+}
+
+/******************************************************************************/
+void core_omp_ststrf(int m, int n, int ib,
+                     float *U, int ldu,
+                     float *A, int lda,
+                     float *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:U[0:ldu*n]) \
+                     depend(inout:A[0:lda*n]) \
+                     depend(out:L[0:ldl*n]) \
+                     depend(out:ipiv[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("ststrf", U);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            // Prepare workspaces.
+            int tid = omp_get_thread_num();
+            float *W = (float*)work.spaces[tid];
+
+            // Call the kernel.
+            int info = core_ststrf(m, n, ib,
+                                   U, ldu,
+                                   A, lda,
+                                   L, ldl,
+                                   ipiv,
+                                   W, ib+m);
+            if (info != 0 && iinfo >= 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaRealFloat,
+                           (float)m*n*n + (float)ib*n*n/2.0,
+                           (float)n*(n+1) + 2.0*m*n + (float)ib*n);
+        PLASMA_TRACE_STOP("ststrf", 3, U, A, L);
+        PLASMA_SEQUENCE_CANCEL(sequence);
+    }
+}
@@ -0,0 +1,141 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_herk
+ *
+ *  Performs one of the Hermitian rank k operations
+ *
+ *    \f[ C = \alpha A \times A^H + \beta C, \f]
+ *    or
+ *    \f[ C = \alpha A^H \times A + \beta C, \f]
+ *
+ *  where alpha and beta are real scalars, C is an n-by-n Hermitian
+ *  matrix, and A is an n-by-k matrix in the first case and a k-by-n
+ *  matrix in the second case.
+ *  C is in double complex precision and A in double or single complex
+ *  precision. A tile A in single precision is held at the beginning of its
+ *  double precision storage, with the same leading dimension, and is
+ *  converted into work.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of C is stored;
+ *          - PlasmaLower: Lower triangle of C is stored.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:   \f[ C = \alpha A \times A^H + \beta C; \f]
+ *          - PlasmaConjTrans: \f[ C = \alpha A^H \times A + \beta C. \f]
+ *
+ * @param[in] n
+ *          The order of the matrix C. n >= 0.
+ *
+ * @param[in] k
+ *          If trans = PlasmaNoTrans, number of columns of the A matrix;
+ *          if trans = PlasmaConjTrans, number of rows of the A matrix.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          A is an lda-by-ka matrix.
+ *          If trans = PlasmaNoTrans,   ka = k;
+ *          if trans = PlasmaConjTrans, ka = n.
+ *
+ * @param[in] preca
+ *          The precision of A, PlasmaComplexDouble or PlasmaComplexFloat.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          If trans = PlasmaNoTrans,   lda >= max(1, n);
+ *          if trans = PlasmaConjTrans, lda >= max(1, k).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          C is an ldc-by-n matrix.
+ *          On exit, the uplo part of the matrix is overwritten
+ *          by the uplo part of the updated matrix.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1, n).
+ *
+ * @param work
+ *          Workspace of size n*k.
+ *
+ ******************************************************************************/
+void core_zcherk(plasma_enum_t uplo, plasma_enum_t trans,
+                 int n, int k,
+                 double alpha,
+                 const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+                 double beta, plasma_complex64_t *C, int ldc,
+                 plasma_complex64_t *work)
+{
+    if (preca == PlasmaComplexFloat) {
+        int am = trans == PlasmaNoTrans ? n : k;
+        int an = trans == PlasmaNoTrans ? k : n;
+        core_clag2z(am, an, (plasma_complex32_t*)A, lda, work, am);
+        core_zherk(uplo, trans,
+                   n, k,
+                   alpha, work, imax(1, am),
+                   beta,  C, ldc);
+    }
+    else {
+        core_zherk(uplo, trans,
+                   n, k,
+                   alpha, A, lda,
+                   beta,  C, ldc);
+    }
+}
+
+/******************************************************************************/
+void core_omp_zcherk(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, int k,
+                     double alpha,
+                     const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+                     double beta, plasma_complex64_t *C, int ldc,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zcherk", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            core_zcherk(uplo, trans,
+                        n, k,
+                        alpha, A, preca, lda,
+                        beta,  C, ldc,
+                        W);
+        }
+        PLASMA_TRACE_STOP("zcherk", 1, C, A);
+    }
+}
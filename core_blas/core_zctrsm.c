@@ -0,0 +1,149 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_trsm
+ *
+ *  Solves one of the matrix equations
+ *
+ *    \f[ op( A )\times X  = \alpha B, \f] or
+ *    \f[ X \times op( A ) = \alpha B, \f]
+ *
+ *  where op( A ) is one of:
+ *    \f[ op( A ) = A,   \f]
+ *    \f[ op( A ) = A^T, \f]
+ *    \f[ op( A ) = A^H, \f]
+ *
+ *  alpha is a scalar, X and B are m-by-n matrices, and
+ *  A is a unit or non-unit, upper or lower triangular matrix.
+ *  A is in double complex precision and B in double or single complex
+ *  precision. A tile B in single precision is held at the beginning of its
+ *  double precision storage, with the same leading dimension, and is solved
+ *  in single precision with A converted into work.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  op(A)*X = B,
+ *          - PlasmaRight: X*op(A) = B.
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A is upper triangular,
+ *          - PlasmaLower: A is lower triangular.
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] diag
+ *          - PlasmaNonUnit: A has non-unit diagonal,
+ *          - PlasmaUnit:    A has unit diagonal.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix B. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix B. n >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The lda-by-ka triangular matrix,
+ *          where ka = m if side = PlasmaLeft,
+ *            and ka = n if side = PlasmaRight.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,ka).
+ *
+ * @param[in,out] B
+ *          On entry, the ldb-by-n right hand side matrix B.
+ *          On exit, if return value = 0, the ldb-by-n solution matrix X.
+ *
+ * @param[in] precb
+ *          The precision of B, PlasmaComplexDouble or PlasmaComplexFloat.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,m).
+ *
+ * @param work
+ *          Workspace of size ka*ka.
+ *
+ ******************************************************************************/
+void core_zctrsm(plasma_enum_t side, plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t diag,
+                 int m, int n,
+                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                       plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+                 plasma_complex64_t *work)
+{
+    if (precb == PlasmaComplexDouble) {
+        core_ztrsm(side, uplo,
+                   transa, diag,
+                   m, n,
+                   alpha, A, lda,
+                          B, ldb);
+    }
+    else {
+        int ka = side == PlasmaLeft ? m : n;
+        plasma_complex32_t *As = (plasma_complex32_t*)work;
+        core_zlag2c(ka, ka, (plasma_complex64_t*)A, lda, As, ka);
+        core_ctrsm(side, uplo,
+                   transa, diag,
+                   m, n,
+                   (plasma_complex32_t)alpha, As, ka,
+                                              (plasma_complex32_t*)B, ldb);
+    }
+}
+
+/******************************************************************************/
+void core_omp_zctrsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+          plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak;
+    if (side == PlasmaLeft)
+        ak = m;
+    else
+        ak = n;
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zctrsm", B);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            core_zctrsm(side, uplo,
+                        transa, diag,
+                        m, n,
+                        alpha, A, lda,
+                               B, precb, ldb,
+                        W);
+        }
+        PLASMA_TRACE_STOP("zctrsm", 1, B, A);
+    }
+}
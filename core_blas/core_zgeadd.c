@@ -146,9 +146,11 @@ void core_omp_zgeadd(
     int k = (transa == PlasmaNoTrans) ? n : m;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zgeadd", B);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int retval = core_zgeadd(transa,
                                      m, n,
                                      alpha, A, lda,
@@ -158,5 +160,7 @@ void core_omp_zgeadd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("zgeadd", 1, B, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
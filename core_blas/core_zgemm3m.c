@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Returns the size in bytes of the split form of an m-by-n matrix
+ *  for core_zgemm3m: its real part, its imaginary part and their sum,
+ *  each an m-by-n real matrix.
+ *
+ ******************************************************************************/
+size_t core_zgemm3m_split_size(int m, int n)
+{
+    return 3*(size_t)m*n*sizeof(double);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Splits op( A ), an m-by-n matrix, into its real part, its imaginary
+ *  part and their sum, for core_zgemm3m. The transposition and the
+ *  conjugation are applied here, so the split matrix serves the products
+ *  of op( A ) as the left or the right operand.
+ *
+ *******************************************************************************
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:   A is not transposed,
+ *          - PlasmaTrans:     A is transposed,
+ *          - PlasmaConjTrans: A is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of op( A ).
+ *
+ * @param[in] n
+ *          The number of columns of op( A ).
+ *
+ * @param[in] A
+ *          The matrix A, of leading dimension lda.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *
+ * @param[out] S
+ *          The split matrix, of core_zgemm3m_split_size bytes.
+ *
+ ******************************************************************************/
+void core_zgemm3m_split(plasma_enum_t trans, int m, int n,
+                        const plasma_complex64_t *A, int lda,
+                        double *S)
+{
+    double *Sr = S;
+    double *Si = &S[(size_t)m*n];
+    double *Ss = &S[2*(size_t)m*n];
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            plasma_complex64_t a = trans == PlasmaNoTrans
+                ? A[i+(size_t)lda*j] : A[j+(size_t)lda*i];
+            if (trans == PlasmaConjTrans)
+                a = conj(a);
+            size_t ij = i+(size_t)m*j;
+            Sr[ij] = creal(a);
+            Si[ij] = cimag(a);
+            Ss[ij] = creal(a)+cimag(a);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Computes C = alpha*op( A )*op( B ) + beta*C by the 3M algorithm, with
+ *  op( A ) and op( B ) split by core_zgemm3m_split, in three real products
+ *
+ *    \f[ T_1 = A_r B_r, \quad T_2 = A_i B_i, \quad
+ *        T_3 = (A_r + A_i)(B_r + B_i), \f]
+ *
+ *  of which op( A )*op( B ) = T_1 - T_2 + i (T_3 - T_1 - T_2). This saves
+ *  a quarter of the flops of the complex product, at the price of a
+ *  normwise, rather than componentwise, bound on the imaginary part.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of op( A ) and of C.
+ *
+ * @param[in] n
+ *          The number of columns of op( B ) and of C.
+ *
+ * @param[in] k
+ *          The number of columns of op( A ) and of rows of op( B ).
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The split op( A ), m-by-k.
+ *
+ * @param[in] B
+ *          The split op( B ), k-by-n.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          The m-by-n matrix C.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *          Workspace of size 3*m*n.
+ *
+ ******************************************************************************/
+void core_zgemm3m(int m, int n, int k,
+                  plasma_complex64_t alpha, const double *A, const double *B,
+                  plasma_complex64_t beta, plasma_complex64_t *C, int ldc,
+                  double *work)
+{
+    size_t mk = (size_t)m*k;
+    size_t kn = (size_t)k*n;
+    size_t mn = (size_t)m*n;
+    double *T1 = work;
+    double *T2 = &work[mn];
+    double *T3 = &work[2*mn];
+
+    int ldm = imax(1, m);
+    int ldk = imax(1, k);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, A, ldm, B, ldk, 0.0, T1, ldm);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, &A[mk], ldm, &B[kn], ldk, 0.0, T2, ldm);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, &A[2*mk], ldm, &B[2*kn], ldk, 0.0, T3, ldm);
+
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            size_t ij = i+(size_t)m*j;
+            plasma_complex64_t t =
+                (T1[ij]-T2[ij]) + (T3[ij]-T1[ij]-T2[ij])*I;
+            plasma_complex64_t *c = &C[i+(size_t)ldc*j];
+            *c = beta == 0.0 ? alpha*t : alpha*t + beta*(*c);
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_zgemm3m_split(plasma_enum_t trans, int m, int n,
+                            const plasma_complex64_t *A, int lda,
+                            double **S,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    int an = trans == PlasmaNoTrans ? n : m;
+
+    #pragma omp task depend(in:A[0:lda*an]) \
+                     depend(out:S[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zgemm3m_split", S);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            *S = (double*)malloc(core_zgemm3m_split_size(m, n));
+            if (*S == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                core_zgemm3m_split(trans, m, n, A, lda, *S);
+            }
+        }
+        PLASMA_TRACE_STOP("zgemm3m_split", 1, S, A);
+    }
+}
+
+/******************************************************************************/
+void core_omp_zgemm3m(int m, int n, int k,
+                      plasma_complex64_t alpha, double **A, double **B,
+                      plasma_complex64_t beta, plasma_complex64_t *C, int ldc,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:1]) \
+                     depend(in:B[0:1]) \
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zgemm3m", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            double *W = (double*)malloc(3*(size_t)m*n*sizeof(double));
+            if (W == NULL) {
+                plasma_error("malloc() failed");
+                plasma_request_fail(sequence, request,
+                                    PlasmaErrorOutOfMemory);
+            }
+            else {
+                core_zgemm3m(m, n, k,
+                             alpha, *A, *B,
+                             beta, C, ldc,
+                             W);
+                free(W);
+            }
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 2.0*m*n*k,
+                           (double)m*k + (double)k*n + 2.0*m*n);
+        PLASMA_TRACE_STOP("zgemm3m", 1, C, A, B);
+    }
+}
+
+/******************************************************************************/
+// Frees the split matrix S after the products reading it.
+void core_omp_zgemm3m_free(double **S,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(inout:S[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        free(*S);
+        *S = NULL;
+    }
+}
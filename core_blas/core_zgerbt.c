@@ -0,0 +1,136 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gerbt
+ *
+ *  Applies one level of a random butterfly transformation to the pair of
+ *  blocks A1 and A2,
+ *
+ *    W = 1/sqrt(2) * | D1  D2 |
+ *                    | D1 -D2 |,
+ *
+ *  where D1 and D2 are the diagonal matrices of the random values u1 and u2.
+ *  The rows or columns of A1 beyond those of A2 have no partner, and are
+ *  only scaled by u1/sqrt(2), as if A2 were padded with zeros.
+ *
+ *    side = PlasmaLeft,  trans = PlasmaNoTrans:    | A1; A2 | = W   * | A1; A2 |
+ *    side = PlasmaLeft,  trans = Plasma_ConjTrans: | A1; A2 | = W^T * | A1; A2 |
+ *    side = PlasmaRight, trans = PlasmaNoTrans:    | A1  A2 | = | A1  A2 | * W
+ *    side = PlasmaRight, trans = Plasma_ConjTrans: | A1  A2 | = | A1  A2 | * W^T
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          - PlasmaLeft:  the butterfly combines the rows of A1 and A2,
+ *          - PlasmaRight: the butterfly combines the columns of A1 and A2.
+ *
+ * @param[in] trans
+ *          - PlasmaNoTrans:    W is applied,
+ *          - Plasma_ConjTrans: W^T is applied.
+ *
+ * @param[in] m1
+ *          The number of rows of the block A1. m1 >= 0.
+ *
+ * @param[in] n1
+ *          The number of columns of the block A1. n1 >= 0.
+ *
+ * @param[in] m2
+ *          The number of rows of the block A2.
+ *          If side = PlasmaLeft, m1 >= m2 >= 0, else m2 = m1.
+ *
+ * @param[in] n2
+ *          The number of columns of the block A2.
+ *          If side = PlasmaRight, n1 >= n2 >= 0, else n2 = n1.
+ *
+ * @param[in,out] A1
+ *          The m1-by-n1 block A1.
+ *
+ * @param[in] lda1
+ *          The leading dimension of the array A1. lda1 >= max(1,m1).
+ *
+ * @param[in,out] A2
+ *          The m2-by-n2 block A2.
+ *
+ * @param[in] lda2
+ *          The leading dimension of the array A2. lda2 >= max(1,m2).
+ *
+ * @param[in] u1
+ *          The random values of D1, m1 of them if side = PlasmaLeft,
+ *          n1 otherwise.
+ *
+ * @param[in] u2
+ *          The random values of D2, m2 of them if side = PlasmaLeft,
+ *          n2 otherwise.
+ *
+ ******************************************************************************/
+void core_zgerbt(plasma_enum_t side, plasma_enum_t trans,
+                 int m1, int n1, int m2, int n2,
+                 plasma_complex64_t *A1, int lda1,
+                 plasma_complex64_t *A2, int lda2,
+                 const double *u1, const double *u2)
+{
+    double r = 1.0/sqrt(2.0);
+
+    // W^T on the left and W on the right add the pairs before scaling,
+    // W on the left and W^T on the right scale them before adding.
+    int scale_sum = (side == PlasmaLeft) == (trans == PlasmaNoTrans);
+
+    if (side == PlasmaLeft) {
+        for (int j = 0; j < n1; j++) {
+            for (int i = 0; i < m2; i++) {
+                plasma_complex64_t a = A1[i+(size_t)lda1*j];
+                plasma_complex64_t b = A2[i+(size_t)lda2*j];
+                if (scale_sum) {
+                    a *= u1[i];
+                    b *= u2[i];
+                    A1[i+(size_t)lda1*j] = r*(a+b);
+                    A2[i+(size_t)lda2*j] = r*(a-b);
+                }
+                else {
+                    A1[i+(size_t)lda1*j] = r*u1[i]*(a+b);
+                    A2[i+(size_t)lda2*j] = r*u2[i]*(a-b);
+                }
+            }
+            for (int i = m2; i < m1; i++)
+                A1[i+(size_t)lda1*j] *= r*u1[i];
+        }
+    }
+    else {
+        for (int j = 0; j < n2; j++) {
+            for (int i = 0; i < m1; i++) {
+                plasma_complex64_t a = A1[i+(size_t)lda1*j];
+                plasma_complex64_t b = A2[i+(size_t)lda2*j];
+                if (scale_sum) {
+                    a *= u1[j];
+                    b *= u2[j];
+                    A1[i+(size_t)lda1*j] = r*(a+b);
+                    A2[i+(size_t)lda2*j] = r*(a-b);
+                }
+                else {
+                    A1[i+(size_t)lda1*j] = r*u1[j]*(a+b);
+                    A2[i+(size_t)lda2*j] = r*u2[j]*(a-b);
+                }
+            }
+        }
+        for (int j = n2; j < n1; j++)
+            for (int i = 0; i < m1; i++)
+                A1[i+(size_t)lda1*j] *= r*u1[j];
+    }
+}
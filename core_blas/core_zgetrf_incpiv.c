@@ -0,0 +1,84 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "plasma_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf_incpiv
+ *
+ *  Computes the LU factorization of the m-by-n diagonal tile A of the
+ *  incremental pivoting LU, with partial pivoting within the tile,
+ *
+ *    P * A = L * U,
+ *
+ *  where L is unit lower trapezoidal and U upper trapezoidal.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile to be factored.
+ *          On exit, the factors L and U, without the unit diagonal of L.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] ipiv
+ *          The min(m,n) pivot indices, relative to the tile; row i of
+ *          the tile was interchanged with row ipiv(i).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if i, U(i,i) is exactly zero.
+ *
+ ******************************************************************************/
+int core_zgetrf_incpiv(int m, int n,
+                       plasma_complex64_t *A, int lda, int *ipiv)
+{
+    return LAPACKE_zgetrf_work(LAPACK_COL_MAJOR, m, n, A, lda, ipiv);
+}
+
+/******************************************************************************/
+void core_omp_zgetrf_incpiv(int m, int n,
+                            plasma_complex64_t *A, int lda, int *ipiv,
+                            int iinfo,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(out:ipiv[0:imin(m, n)]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zgetrf_incpiv", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
+            int info = core_zgetrf_incpiv(m, n, A, lda, ipiv);
+            if (info != 0 && iinfo >= 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble,
+                           (double)m*n*imin(m, n) -
+                           (double)(m+n)*imin(m, n)*imin(m, n)/2.0 +
+                           (double)imin(m, n)*imin(m, n)*imin(m, n)/3.0,
+                           2.0*m*n);
+        PLASMA_TRACE_STOP("zgetrf_incpiv", 1, A);
+    }
+}
@@ -108,13 +108,16 @@ void core_omp_zhemm(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*n]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("zhemm", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_zhemm(side, uplo,
                        m, n,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+        PLASMA_TRACE_STOP("zhemm", 1, C, A, B);
     }
 }
@@ -122,13 +122,16 @@ void core_omp_zher2k(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("zher2k", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_zher2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        PLASMA_TRACE_STOP("zher2k", 1, C, A, B);
     }
 }
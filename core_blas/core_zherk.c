@@ -11,6 +11,8 @@
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
+#include "plasma_runtime.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -82,6 +84,18 @@ void core_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                 beta,  C, ldc);
 }
 
+/******************************************************************************/
+// Runs the herk of a task replayed from a task graph.
+static void core_zherk_replay(const plasma_graph_task_t *task, void **tiles,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    core_zherk(task->param[0], task->param[1],
+               task->dim[0], task->dim[1],
+               creal(task->alpha), tiles[1], task->dim[2],
+               creal(task->beta),  tiles[0], task->dim[3]);
+}
+
 /******************************************************************************/
 void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                     int n, int k,
@@ -89,6 +103,16 @@ void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                     double beta,        plasma_complex64_t *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_zherk_replay,
+            .param = {uplo, trans},
+            .dim = {n, k, lda, ldc},
+            .alpha = alpha, .beta = beta};
+        PLASMA_GRAPH_ADD(task, 1, C, A);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
@@ -96,12 +120,49 @@ void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zherk", C);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_zherk(uplo, trans,
+                       n, k,
+                       alpha, A, lda,
+                       beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, (double)k*n*(n+1),
+                           (double)n*k + (double)n*(n+1));
+        PLASMA_TRACE_STOP("zherk", 1, C, A);
+    }
+}
+
+/******************************************************************************/
+// Same as core_omp_zherk, with a commutative dependency on C, for the
+// accumulations into C in any order.
+void core_omp_zherk_commute(plasma_enum_t uplo, plasma_enum_t trans,
+                            int n, int k,
+                            double alpha, const plasma_complex64_t *A, int lda,
+                            double beta,        plasma_complex64_t *C, int ldc,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    int ak;
+    if (trans == PlasmaNoTrans)
+        ak = k;
+    else
+        ak = n;
+
+    PLASMA_TASK(PLASMA_IN(A, 0, lda*ak)
+                PLASMA_COMMUTE(C, 0, ldc*n)
+                PLASMA_PRIORITY(plasma_sequence_priority(sequence)))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("zherk", C);
+        if (PLASMA_TRACE_RUN(sequence))
             core_zherk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, (double)k*n*(n+1),
+                           (double)n*k + (double)n*(n+1));
+        PLASMA_TRACE_STOP("zherk", 1, C, A);
     }
 }
@@ -60,12 +60,15 @@ void core_omp_zhessq(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zhessq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_zhessq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("zhessq", 2, scale, sumsq, A);
     }
 }
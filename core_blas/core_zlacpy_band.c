@@ -15,6 +15,25 @@
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
+#include <string.h>
+
+/******************************************************************************/
+// Zeroes the m-by-n block B, by a single memset if its columns are contiguous.
+static inline void core_zlacpy_band_zero(int m, int n,
+                                         plasma_complex64_t *B, int ldb)
+{
+    if (m <= 0 || n <= 0)
+        return;
+
+    if (ldb == m) {
+        memset(B, 0, (size_t)m*n*sizeof(plasma_complex64_t));
+    }
+    else {
+        for (int j = 0; j < n; j++)
+            memset(&B[(size_t)j*ldb], 0, m*sizeof(plasma_complex64_t));
+    }
+}
+
 /*******************************************************************************
  *
  * @ingroup core_plasma_complex64_t
@@ -50,13 +69,14 @@
  *          The leading dimension of the array B. ldb >= max(1,M).
  *
  ******************************************************************************/
+CORE_BLAS_MULTIVERSION
 void core_zlacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
                                   const plasma_complex64_t *A, int lda,
                                         plasma_complex64_t *B, int ldb)
 {
-    int i, j;
+    int j;
     int j_start, j_end;
     if (uplo == PlasmaGeneral) {
         j_start = 0; // pivot back and could fill in
@@ -71,11 +91,12 @@ void core_zlacpy_lapack2tile_band(plasma_enum_t uplo,
         j_end = n;
     }
 
-    for (j = 0; j < j_start; j++) {
-        for (i = 0; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-    }
+    j_start = imin(j_start, n);
+    j_end = imax(j_start, j_end);
+
+    // Columns left of the band, zeroed at once if contiguous.
+    core_zlacpy_band_zero(m, j_start, &B[0], ldb);
+
     for (j = j_start; j < j_end; j++) {
         int i_start, i_end;
         if (uplo == PlasmaGeneral) {
@@ -92,22 +113,19 @@ void core_zlacpy_lapack2tile_band(plasma_enum_t uplo,
             i_start = imax(0, (jt-it)*nb+j);
             i_end = imin(m, (jt-it)*nb+j+kl+1);
         }
+        i_start = imin(i_start, m);
+        i_end = imax(i_start, i_end);
 
-        for (i = 0; i < i_start; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-        for (i = i_start; i < i_end; i++) {
-            B[i + j*ldb] = A[i + j*lda];
-        }
-        for (i = i_end; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
-    }
-    for (j = j_end; j < n; j++) {
-        for (i = 0; i < m; i++) {
-            B[i + j*ldb] = 0.0;
-        }
+        // Zeros above the band, the band, zeros below, in one pass.
+        plasma_complex64_t *Bj = &B[j*ldb];
+        memset(Bj, 0, i_start*sizeof(plasma_complex64_t));
+        memcpy(&Bj[i_start], &A[i_start + j*lda],
+               (i_end-i_start)*sizeof(plasma_complex64_t));
+        memset(&Bj[i_end], 0, (m-i_end)*sizeof(plasma_complex64_t));
     }
+
+    // Columns right of the band.
+    core_zlacpy_band_zero(m, n-j_end, &B[j_end*ldb], ldb);
 }
 
 /******************************************************************************/
@@ -119,10 +137,14 @@ void core_omp_zlacpy_lapack2tile_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
-    core_zlacpy_lapack2tile_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 A, lda,
-                                 B, ldb);
+    {
+        PLASMA_TRACE_START("zlacpy_lapack2tile_band", B);
+        core_zlacpy_lapack2tile_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     A, lda,
+                                     B, ldb);
+        PLASMA_TRACE_STOP("zlacpy_lapack2tile_band", 1, B, A);
+    }
 }
 
 /*******************************************************************************
@@ -160,13 +182,14 @@ void core_omp_zlacpy_lapack2tile_band(plasma_enum_t uplo,
  *          The leading dimension of the array B. ldb >= max(1, m).
  *
  ******************************************************************************/
+CORE_BLAS_MULTIVERSION
 void core_zlacpy_tile2lapack_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
                                   const plasma_complex64_t *B, int ldb,
                                         plasma_complex64_t *A, int lda)
 {
-    int i, j;
+    int j;
     int j_start, j_end;
 
     if (uplo == PlasmaGeneral) {
@@ -200,9 +223,9 @@ void core_zlacpy_tile2lapack_band(plasma_enum_t uplo,
             i_end = imin(m, (jt-it)*nb+j+kl+1);
         }
 
-        for (i = i_start; i < i_end; i++) {
-            A[i + j*lda] = B[i + j*ldb];
-        }
+        if (i_end > i_start)
+            memcpy(&A[i_start + j*lda], &B[i_start + j*ldb],
+                   (i_end-i_start)*sizeof(plasma_complex64_t));
     }
 }
 
@@ -215,8 +238,12 @@ void core_omp_zlacpy_tile2lapack_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:B[0:ldb*n]) \
                      depend(out:A[0:lda*n])
-    core_zlacpy_tile2lapack_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 B, ldb,
-                                 A, lda);
+    {
+        PLASMA_TRACE_START("zlacpy_tile2lapack_band", A);
+        core_zlacpy_tile2lapack_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     B, ldb,
+                                     A, lda);
+        PLASMA_TRACE_STOP("zlacpy_tile2lapack_band", 1, A, B);
+    }
 }
@@ -59,9 +59,88 @@ void core_omp_zlag2c(int m, int n,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:As[0:ldas*n])
+                     depend(out:As[0:ldas*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("zlag2c", As);
+        if (PLASMA_TRACE_RUN(sequence))
             core_zlag2c(m, n, A, lda, As, ldas);
+        PLASMA_TRACE_STOP("zlag2c", 1, As, A);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Copies m-by-n matrix A to B and converts it to single complex precision
+ *  in As, in one pass over A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in double complex precision to copy.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] B
+ *          On exit, the copy of A.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the matrix B.
+ *          ldb >= max(1,m).
+ *
+ * @param[out] As
+ *          On exit, A converted to single complex precision.
+ *
+ * @param[in] ldas
+ *          The leading dimension of the matrix As.
+ *          ldas >= max(1,m).
+ *
+ ******************************************************************************/
+void core_zlacpy_lag2c(int m, int n,
+                       const plasma_complex64_t *A,  int lda,
+                             plasma_complex64_t *B,  int ldb,
+                             plasma_complex32_t *As, int ldas)
+{
+    for (int j = 0; j < n; j++) {
+        const plasma_complex64_t *a = &A[(size_t)lda*j];
+        plasma_complex64_t *b = &B[(size_t)ldb*j];
+        plasma_complex32_t *as = &As[(size_t)ldas*j];
+        for (int i = 0; i < m; i++) {
+            b[i] = a[i];
+            as[i] = (plasma_complex32_t)a[i];
+        }
+    }
+}
+
+/******************************************************************************/
+void core_omp_zlacpy_lag2c(int m, int n,
+                           const plasma_complex64_t *A,  int lda,
+                                 plasma_complex64_t *B,  int ldb,
+                                 plasma_complex32_t *As, int ldas,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:B[0:ldb*n]) \
+                     depend(out:As[0:ldas*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zlacpy_lag2c", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_zlacpy_lag2c(m, n, A, lda, B, ldb, As, ldas);
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 0.0, 2.5*m*n);
+        PLASMA_TRACE_STOP("zlacpy_lag2c", 1, B, A);
     }
 }
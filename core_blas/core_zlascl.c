@@ -39,12 +39,15 @@ void core_omp_zlascl(plasma_enum_t uplo,
                      plasma_complex64_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("zlascl", A);
+        if (PLASMA_TRACE_RUN(sequence))
             core_zlascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+        PLASMA_TRACE_STOP("zlascl", 1, A);
     }
 }
@@ -77,7 +77,11 @@ void core_omp_zlaset(plasma_enum_t uplo,
                      plasma_complex64_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    core_zlaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        PLASMA_TRACE_START("zlaset", A);
+        core_zlaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        PLASMA_TRACE_STOP("zlaset", 1, A);
+    }
 }
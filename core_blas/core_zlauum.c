@@ -68,14 +68,18 @@ void core_omp_zlauum(plasma_enum_t uplo,
                      plasma_complex64_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zlauum", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_zlauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
                 coreblas_error("core_zlauum() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("zlauum", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
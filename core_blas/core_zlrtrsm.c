@@ -0,0 +1,95 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lr
+ *
+ *  Solves the triangular system of the panel of the tile low-rank Cholesky
+ *  factorization,
+ *
+ *    \f[ A = A \times L^{-H}, \f]
+ *
+ *  where L is the lower triangular factor of a diagonal tile and A an
+ *  off-diagonal tile, dense or compressed as U*V^H by core_zlrcompress.
+ *  For a compressed tile, only V is solved for, V = L^{-1} V.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The order of L, and number of columns of the tile A. n >= 0.
+ *
+ * @param[in] L
+ *          The n-by-n lower triangular factor L.
+ *
+ * @param[in] ldl
+ *          The leading dimension of the array L. ldl >= max(1,n).
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile A, dense or compressed.
+ *          On exit, A*L^{-H}, in the same form.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] rank
+ *          The rank of the factors of A, or -1 if A is dense.
+ *
+ ******************************************************************************/
+void core_zlrtrsm(int m, int n,
+                  const plasma_complex64_t *L, int ldl,
+                        plasma_complex64_t *A, int lda,
+                  const int *rank)
+{
+    int k = *rank;
+    if (k < 0) {
+        core_ztrsm(PlasmaRight, PlasmaLower,
+                   PlasmaConjTrans, PlasmaNonUnit,
+                   m, n,
+                   1.0, L, ldl,
+                        A, lda);
+    }
+    else if (k > 0 && n > 0) {
+        core_ztrsm(PlasmaLeft, PlasmaLower,
+                   PlasmaNoTrans, PlasmaNonUnit,
+                   n, k,
+                   1.0, L, ldl,
+                        &A[(size_t)lda*k], n);
+    }
+}
+
+/******************************************************************************/
+void core_omp_zlrtrsm(int m, int n,
+                      const plasma_complex64_t *L, int ldl,
+                            plasma_complex64_t *A, int lda,
+                      const int *rank,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request)
+{
+    #pragma omp task depend(in:L[0:ldl*n]) \
+                     depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zlrtrsm", A);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_zlrtrsm(m, n, L, ldl, A, lda, rank);
+        PLASMA_TRACE_STOP("zlrtrsm", 1, A, L);
+    }
+}
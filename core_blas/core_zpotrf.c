@@ -11,6 +11,7 @@
  **/
 
 #include "core_blas.h"
+#include "plasma_graph.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -61,6 +62,19 @@ int core_zpotrf(plasma_enum_t uplo,
                           A, lda);
 }
 
+/******************************************************************************/
+// Runs the potrf of a task replayed from a task graph.
+static void core_zpotrf_replay(const plasma_graph_task_t *task, void **tiles,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    int info = core_zpotrf(task->param[0],
+                           task->dim[0],
+                           tiles[0], task->dim[1]);
+    if (info != 0)
+        plasma_request_fail(sequence, request, task->dim[2]+info);
+}
+
 /******************************************************************************/
 void core_omp_zpotrf(plasma_enum_t uplo,
                      int n,
@@ -68,14 +82,29 @@ void core_omp_zpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    if (plasma_graph_capture != NULL) {
+        plasma_graph_task_t task = {
+            .kernel = core_zpotrf_replay,
+            .param = {uplo},
+            .dim = {n, lda, iinfo}};
+        PLASMA_GRAPH_ADD(task, 1, A);
+        return;
+    }
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zpotrf", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_zpotrf(uplo,
                                    n,
                                    A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, (double)n*n*n/3.0,
+                           (double)n*(n+1));
+        PLASMA_TRACE_STOP("zpotrf", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
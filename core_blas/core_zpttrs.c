@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include "core_blas.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pttrf
+ *
+ *  Solves A X = B for a Hermitian positive definite tridiagonal matrix A
+ *  factored by core_zpttrf_spike().
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of A. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of B. nrhs >= 0.
+ *
+ * @param[in] d
+ *          The n diagonal elements of D.
+ *
+ * @param[in] e
+ *          The n-1 subdiagonal elements of the unit bidiagonal L.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, the solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ ******************************************************************************/
+void core_zpttrs(int n, int nrhs,
+                 const double *d, const plasma_complex64_t *e,
+                 plasma_complex64_t *B, int ldb)
+{
+#ifdef COMPLEX
+    LAPACKE_zpttrs_work(LAPACK_COL_MAJOR, 'L', n, nrhs, d, e, B, ldb);
+#else
+    LAPACKE_zpttrs_work(LAPACK_COL_MAJOR, n, nrhs, d, e, B, ldb);
+#endif
+}
+
+/******************************************************************************/
+// The factors of the partition are tracked through d.
+void core_omp_zpttrs(int n, int nrhs,
+                     const double *d, const plasma_complex64_t *e,
+                     plasma_complex64_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:d[0:n]) \
+                     depend(inout:B[0:ldb*nrhs]) \
+                     priority(plasma_sequence_priority(sequence))
+    {
+        PLASMA_TRACE_START("zpttrs", B);
+        if (PLASMA_TRACE_RUN(sequence))
+            core_zpttrs(n, nrhs, d, e, B, ldb);
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 5.0*n*nrhs,
+                           2.0*n + 2.0*n*nrhs);
+        PLASMA_TRACE_STOP("zpttrs", 1, B, d);
+    }
+}
@@ -60,13 +60,16 @@ void core_omp_zsyssq(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zsyssq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_zsyssq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("zsyssq", 2, scale, sumsq, A);
     }
 }
 
@@ -78,9 +81,11 @@ void core_omp_zsyssq_aux(int m, int n,
 {
     #pragma omp task depend(in:scale[0:n]) \
                      depend(in:sumsq[0:n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zsyssq_aux", value);
+        if (PLASMA_TRACE_RUN(sequence)) {
             double scl = 0.0;
             double sum = 1.0;
             for (int j = 0; j < n; j++) {
@@ -110,5 +115,6 @@ void core_omp_zsyssq_aux(int m, int n,
             }
             *value = scl*sqrt(sum);
         }
+        PLASMA_TRACE_STOP("zsyssq_aux", 1, value, scale, sumsq);
     }
 }
@@ -192,9 +192,11 @@ void core_omp_ztradd(
     int k = (transa == PlasmaNoTrans) ? n : m;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ztradd", B);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int retval = core_ztradd(uplo, transa,
                                      m, n,
                                      alpha, A, lda,
@@ -204,5 +206,7 @@ void core_omp_ztradd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("ztradd", 1, B, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -124,13 +124,16 @@ void core_omp_ztrmm(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*m])
+                     depend(inout:B[0:ldb*m]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess)
+        PLASMA_TRACE_START("ztrmm", B);
+        if (PLASMA_TRACE_RUN(sequence))
             core_ztrmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        PLASMA_TRACE_STOP("ztrmm", 1, B, A);
     }
 }
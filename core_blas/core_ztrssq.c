@@ -94,12 +94,15 @@ void core_omp_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:scale[0:n]) \
-                     depend(out:sumsq[0:n])
+                     depend(out:sumsq[0:n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ztrssq", scale);
+        if (PLASMA_TRACE_RUN(sequence)) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_ztrssq(uplo, diag, m, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP("ztrssq", 2, scale, sumsq, A);
     }
 }
@@ -71,13 +71,17 @@ void core_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ztrtri", A);
+        if (PLASMA_TRACE_RUN(sequence)) {
             int info = core_ztrtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_STOP("ztrtri", 1, A);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -106,7 +106,7 @@ int core_ztsqrt(int m, int n, int ib,
         coreblas_error("NULL A1");
         return -4;
     }
-    if (lda1 < imax(1, m) && m > 0) {
+    if (lda1 < imax(1, n) && n > 0) {
         coreblas_error("illegal value of lda1");
         return -5;
     }
@@ -135,77 +135,12 @@ int core_ztsqrt(int m, int n, int ib,
         return -11;
     }
 
-    // quick return
-    if (m == 0 || n == 0 || ib == 0)
-        return PlasmaSuccess;
-
-    static plasma_complex64_t zone  = 1.0;
-    static plasma_complex64_t zzero = 0.0;
-
-    for (int ii = 0; ii < n; ii += ib) {
-        int sb = imin(n-ii, ib);
-        for (int i = 0; i < sb; i++) {
-            // Generate elementary reflector H( II*IB+I ) to annihilate
-            // A( II*IB+I:M, II*IB+I ).
-            LAPACKE_zlarfg_work(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,
-                                &tau[ii+i]);
-
-            if (ii+i+1 < n) {
-                // Apply H( II*IB+I ) to A( II*IB+I:M, II*IB+I+1:II*IB+IB )
-                // from the left.
-                plasma_complex64_t alpha = -conj(tau[ii+i]);
-                cblas_zcopy(sb-i-1, &A1[lda1*(ii+i+1)+(ii+i)], lda1, work, 1);
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)Plasma_ConjTrans,
-                            m, sb-i-1,
-                            CBLAS_SADDR(zone), &A2[lda2*(ii+i+1)], lda2,
-                            &A2[lda2*(ii+i)], 1,
-                            CBLAS_SADDR(zone), work, 1);
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_zaxpy(sb-i-1, CBLAS_SADDR(alpha), work, 1,
-                            &A1[lda1*(ii+i+1)+ii+i], lda1);
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(sb-i-1, work, 1);
-#endif
-                cblas_zgerc(CblasColMajor,
-                            m, sb-i-1,
-                            CBLAS_SADDR(alpha), &A2[lda2*(ii+i)], 1,
-                            work, 1,
-                            &A2[lda2*(ii+i+1)], lda2);
-            }
-            // Calculate T.
-            plasma_complex64_t alpha = -tau[ii+i];
-            cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)Plasma_ConjTrans,
-                        m, i,
-                        CBLAS_SADDR(alpha), &A2[lda2*ii], lda2,
-                        &A2[lda2*(ii+i)], 1,
-                        CBLAS_SADDR(zzero), &T[ldt*(ii+i)], 1);
-
-            cblas_ztrmv(CblasColMajor, (CBLAS_UPLO)PlasmaUpper,
-                        (CBLAS_TRANSPOSE)PlasmaNoTrans,
-                        (CBLAS_DIAG)PlasmaNonUnit,
-                        i,
-                        &T[ldt*ii], ldt,
-                        &T[ldt*(ii+i)], 1);
-
-            T[ldt*(ii+i)+i] = tau[ii+i];
-        }
-        if (n > ii+sb) {
-            core_ztsmqr(PlasmaLeft, Plasma_ConjTrans,
-                        sb, n-(ii+sb), m, n-(ii+sb), ib, ib,
-                        &A1[lda1*(ii+sb)+ii], lda1,
-                        &A2[lda2*(ii+sb)], lda2,
-                        &A2[lda2*ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, sb);
-        }
-    }
-
-    return PlasmaSuccess;
+    // Factor by blocks of ib columns, each recursively.
+    return core_ztpqrt(m, n, 0, ib,
+                       A1, lda1,
+                       A2, lda2,
+                       T,  ldt,
+                       work);
 }
 
 /******************************************************************************/
@@ -218,9 +153,11 @@ void core_omp_ztsqrt(int m, int n, int ib,
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("ztsqrt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
@@ -238,5 +175,9 @@ void core_omp_ztsqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_FLOPS(PlasmaComplexDouble, 2.0*m*n*n,
+                           (double)n*(n+1) + 2.0*m*n + (double)ib*n);
+        PLASMA_TRACE_STOP("ztsqrt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
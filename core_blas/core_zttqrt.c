@@ -135,103 +135,15 @@ int core_zttqrt(int m, int n, int ib,
         return -11;
     }
 
-    // quick return
-    if ((m == 0) || (n == 0) || (ib == 0))
-        return PlasmaSuccess;
-
-    // TODO: Need to check why some cases require this to avoid
-    // uninitialized values
-    //core_zlaset(PlasmaGeneral, ib, n, 0.0, 0.0, T, ldt);
-
-    for (int ii = 0; ii < n; ii += ib) {
-        int sb = imin(n-ii, ib);
-        for (int i = 0; i < sb; i++) {
-            int j  = ii + i;
-            int mi = imin(j+1, m);
-            int ni = sb-i-1;
-
-            // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
-            LAPACKE_zlarfg_work(
-                    mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
-
-            if (ni > 0) {
-                // Apply H(j-1) to A(j:m, j+1:ii+ib) from the left.
-                cblas_zcopy(
-                    ni,
-                    &A1[lda1*(j+1)+j], lda1,
-                    work, 1);
-
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(ni, work, 1);
-#endif
-                plasma_complex64_t zone  = 1.0;
-                cblas_zgemv(
-                    CblasColMajor, (CBLAS_TRANSPOSE)Plasma_ConjTrans,
-                    mi, ni,
-                    CBLAS_SADDR(zone), &A2[lda2*(j+1)], lda2,
-                                       &A2[lda2*j],     1,
-                    CBLAS_SADDR(zone), work,            1);
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(ni, work, 1);
-#endif
-                plasma_complex64_t alpha = -conj(tau[j]);
-                cblas_zaxpy(
-                    ni, CBLAS_SADDR(alpha),
-                    work, 1,
-                    &A1[lda1*(j+1)+j], lda1);
-#ifdef COMPLEX
-                LAPACKE_zlacgv_work(ni, work, 1);
-#endif
-                cblas_zgerc(
-                    CblasColMajor, mi, ni,
-                    CBLAS_SADDR(alpha), &A2[lda2*j], 1,
-                    work, 1,
-                    &A2[lda2*(j+1)], lda2);
-            }
-
-            // Calculate T.
-            // T(0:i-1, j) = alpha * A2(0:m-1, ii:j-1)^H * A2(0:m-1, j)
-            if (i > 0) {
-                int l = imin(i, imax(0, m-ii));
-                plasma_complex64_t alpha = -(tau[j]);
-
-                core_zpemv(
-                        Plasma_ConjTrans, PlasmaColumnwise,
-                        imin(j, m), i, l,
-                        alpha, &A2[lda2*ii], lda2,
-                               &A2[lda2*j],  1,
-                        0.0, &T[ldt*j],    1,
-                        work);
-
-                // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-                cblas_ztrmv(
-                        CblasColMajor, (CBLAS_UPLO)PlasmaUpper,
-                        (CBLAS_TRANSPOSE)PlasmaNoTrans,
-                        (CBLAS_DIAG)PlasmaNonUnit,
-                        i, &T[ldt*ii], ldt,
-                           &T[ldt*j], 1);
-            }
-            T[ldt*j+i] = tau[j];
-        }
-
-        // Apply Q^H to the rest of the matrix from the left.
-        if (n > ii+sb) {
-            int mi = imin(ii+sb, m);
-            int ni = n-(ii+sb);
-            int l  = imin(sb, imax(0, mi-ii));
-            core_zparfb(
-                PlasmaLeft, Plasma_ConjTrans,
-                PlasmaForward, PlasmaColumnwise,
-                ib, ni, mi, ni, sb, l,             //replaced sb by ib
-                &A1[lda1*(ii+sb)+ii], lda1,
-                &A2[lda2*(ii+sb)], lda2,
-                &A2[lda2*ii], lda2,
-                &T[ldt*ii], ldt,
-                work, sb);
-        }
-    }
-
-    return PlasmaSuccess;
+    // Only the rows 0 to j of the column j of A2 are referenced, so A2
+    // is the upper trapezoid of core_ztpqrt, factored by blocks of ib
+    // columns, each recursively.
+    int mt = imin(m, n);
+    return core_ztpqrt(mt, n, mt, ib,
+                       A1, lda1,
+                       A2, lda2,
+                       T,  ldt,
+                       work);
 }
 
 /******************************************************************************/
@@ -244,9 +156,11 @@ void core_omp_zttqrt(int m, int n, int ib,
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zttqrt", A1);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
@@ -264,5 +178,7 @@ void core_omp_zttqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("zttqrt", 3, A1, A2, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -251,9 +251,11 @@ void core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_sequence_priority(sequence))
     {
-        if (sequence->status == PlasmaSuccess) {
+        PLASMA_TRACE_START("zunmlq", C);
+        if (PLASMA_TRACE_RUN(sequence)) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
@@ -272,5 +274,7 @@ void core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP("zunmlq", 1, C, A, T);
+        PLASMA_SEQUENCE_CANCEL(sequence);
     }
 }
@@ -71,6 +71,10 @@ static const char *lapack_constants[] = {
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
+    "", "", "", "", "", "", "", "",
+    "NoVec",                               ///< 301: PlasmaNoVec
+    "Vec",                                 ///< 302: PlasmaVec
+    "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
@@ -79,8 +83,6 @@ static const char *lapack_constants[] = {
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
     "", "", "", "", "", "", "", "", "", "",
-    "", "", "", "", "", "", "", "", "", "",
-    "", "", "", "", "", "", "", "",
     "Forward",                             ///< 391: PlasmaForward
     "Backward",                            ///< 392: PlasmaBackward
     "", "", "", "", "", "", "", "",
@@ -96,6 +98,29 @@ static inline char lapack_const(int plasma_const) {
     return lapack_constants[plasma_const][0];
 }
 
+/***************************************************************************//**
+ *  Compiles the vector loops of the kernels not calling the BLAS for several
+ *  instruction sets, with -DPLASMA_WITH_MULTIVERSION, so that one binary runs
+ *  the widest vectors of each processor. The dynamic loader picks the
+ *  version, when the library is loaded, before plasma_init.
+ ******************************************************************************/
+#if defined(PLASMA_WITH_MULTIVERSION) && defined(__x86_64__)
+#define CORE_BLAS_MULTIVERSION \
+        __attribute__((target_clones("default", "arch=haswell", \
+                                     "arch=skylake-avx512")))
+#elif defined(PLASMA_WITH_MULTIVERSION) && defined(__aarch64__)
+#define CORE_BLAS_MULTIVERSION \
+        __attribute__((target_clones("default", "sve")))
+#else
+#define CORE_BLAS_MULTIVERSION
+#endif
+
+// number of rows of the blocks of the vectorized loops over a column,
+// kept in the L1 cache between the passes over a block
+enum {
+    CoreBlasVectorBlock = 256
+};
+
 #define coreblas_error(msg) \
         coreblas_error_func_line_file(__func__, __LINE__, __FILE__, msg)
 
@@ -107,13 +132,47 @@ static inline void coreblas_error_func_line_file(
             line, func, file, msg);
 }
 
+/******************************************************************************/
+void core_stream_copy(void *dst, const void *src, size_t size);
+void core_stream_fence();
+void core_prefetch_tile(const void *A, int m, int n, int lda, size_t size);
+
+/******************************************************************************/
+int core_laswp_cycles(int m, int k1, int k2, const int *ipiv, int incx,
+                      int *perm, int *cycles);
+
+/***************************************************************************//**
+ *  Linear congruential generator of the random matrix generators,
+ *  core_zplrnt, core_zplghe and core_zplgsy. Element (i, j) of an m-by-n
+ *  matrix takes the numbers at position i+j*m of the sequence of the seed,
+ *  one for a real and two for a complex element, which core_rnd64_jump
+ *  reaches in O(log) steps, so that the matrix does not depend on how it
+ *  is tiled nor on the order of the tiles.
+ ******************************************************************************/
+static inline unsigned long long core_rnd64_next(unsigned long long ran)
+{
+    return 6364136223846793005ULL*ran + 1ULL;
+}
+
+// Maps the number ran of the sequence to the interval (-0.5, 0.5].
+static inline double core_rnd64_real(unsigned long long ran)
+{
+    return 0.5 - ran*5.4210108624275222e-20;
+}
+
+unsigned long long core_rnd64_jump(unsigned long long n,
+                                   unsigned long long seed);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
 
+#include "plasma_trace.h"
+
 #include "core_blas_s.h"
 #include "core_blas_d.h"
 #include "core_blas_ds.h"
+#include "core_blas_sb.h"
 #include "core_blas_c.h"
 #include "core_blas_z.h"
 #include "core_blas_zc.h"
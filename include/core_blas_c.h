@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/core_blas_z.h, normal z -> c, Mon Feb  6 14:06:44 2017
+ * @generated from include/core_blas_z.h, normal z -> c, Thu Oct 15 09:29:52 2026
  *
  **/
 #ifndef ICL_CORE_BLAS_C_H
@@ -30,6 +30,48 @@ extern "C" {
 float core_scabs1(plasma_complex32_t alpha);
 #endif
 
+void core_scamax(int colrow, int m, int n,
+                 const plasma_complex32_t *A, int lda,
+                 float *values);
+
+int core_icamax(int n, const plasma_complex32_t *x, float *max);
+
+int core_cgetrf_column(int m, int scale, plasma_complex32_t pivot,
+                       float sfmin, plasma_complex32_t *x,
+                       plasma_complex32_t u, plasma_complex32_t *y,
+                       float *max);
+
+int core_cchud(plasma_enum_t uplo, int sign, int n, int k,
+               plasma_complex32_t *A, int lda,
+               plasma_complex32_t *V, int ldv,
+               plasma_complex32_t *G, int ldg);
+
+int core_cchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                const plasma_complex32_t *G, int ldg,
+                      plasma_complex32_t *A, int lda,
+                      plasma_complex32_t *V, int ldv);
+
+int core_cgbsv(int n, int kl, int ku, int nrhs,
+               plasma_complex32_t *AB, int ldab, int *ipiv,
+               plasma_complex32_t *B, int ldb);
+
+void core_cgbsv_interleaved(int n, int kl, int ku, int nrhs,
+                            int count, int stride,
+                            plasma_complex32_t *AB, int ldab, int *ipiv,
+                            plasma_complex32_t *B, int *info);
+
+void core_cgbhrd(int n, int kd,
+                 plasma_complex32_t *A, int lda,
+                 plasma_complex32_t *V, plasma_complex32_t *tau,
+                 plasma_complex32_t *work,
+                 int rank, int size, plasma_barrier_t *barrier);
+
+void core_cgbhrd_q(int n, int kd,
+                   const plasma_complex32_t *V, const plasma_complex32_t *tau,
+                   int jq, int nq,
+                   plasma_complex32_t *Q, int ldq,
+                   plasma_complex32_t *work);
+
 int core_cgeadd(plasma_enum_t transa,
                 int m, int n,
                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
@@ -47,18 +89,138 @@ void core_cgemm(plasma_enum_t transa, plasma_enum_t transb,
                                           const plasma_complex32_t *B, int ldb,
                 plasma_complex32_t beta,        plasma_complex32_t *C, int ldc);
 
+void core_cgemm_jit_finalize(void);
+
+void core_cgemm_device(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex32_t alpha,
+                       const plasma_complex32_t *A, int lda,
+                       const plasma_complex32_t *B, int ldb,
+                       plasma_complex32_t beta,
+                       plasma_complex32_t *C, int ldc);
+
+size_t core_cgemm_pack_size(plasma_enum_t side, int m, int n, int k);
+
+void core_cgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                     int m, int n, int k,
+                     plasma_complex32_t alpha,
+                     const plasma_complex32_t *A, int lda,
+                     void *P);
+
+void core_cgemm_packed(int m, int n, int k,
+                       const void *Ap, const void *Bp,
+                       plasma_complex32_t beta,
+                       plasma_complex32_t *C, int ldc);
+
+size_t core_cgemm_ozaki_split_size(plasma_enum_t side, int m, int n,
+                                   int slices);
+
+void core_cgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                            int m, int n,
+                            const plasma_complex32_t *A, int lda,
+                            int slices, void *S);
+
+void core_cgemm_ozaki(int m, int n, int k, int slices,
+                      plasma_complex32_t alpha, const void *A, const void *B,
+                      plasma_complex32_t beta, plasma_complex32_t *C, int ldc);
+
+int core_cgemm_emulated(plasma_enum_t transa, plasma_enum_t transb,
+                        int m, int n, int k, int slices,
+                        plasma_complex32_t alpha,
+                        const plasma_complex32_t *A, int lda,
+                        const plasma_complex32_t *B, int ldb,
+                        plasma_complex32_t beta,
+                        plasma_complex32_t *C, int ldc);
+
+#ifdef COMPLEX
+size_t core_cgemm3m_split_size(int m, int n);
+
+void core_cgemm3m_split(plasma_enum_t trans, int m, int n,
+                        const plasma_complex32_t *A, int lda,
+                        float *S);
+
+void core_cgemm3m(int m, int n, int k,
+                  plasma_complex32_t alpha, const float *A, const float *B,
+                  plasma_complex32_t beta, plasma_complex32_t *C, int ldc,
+                  float *work);
+#endif
+
+void core_cgemmt(plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t transb,
+                 int n, int k,
+                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                                           const plasma_complex32_t *B, int ldb,
+                 plasma_complex32_t beta,        plasma_complex32_t *C, int ldc);
+
 int core_cgeqrt(int m, int n, int ib,
                 plasma_complex32_t *A, int lda,
                 plasma_complex32_t *T, int ldt,
                 plasma_complex32_t *tau,
                 plasma_complex32_t *work);
 
+int core_cgeqrt_panel(plasma_desc_t A, plasma_desc_t T, int ib,
+                      int rank, int size,
+                      plasma_complex32_t *work, plasma_barrier_t *barrier);
+
+void core_cgerbt(plasma_enum_t side, plasma_enum_t trans,
+                 int m1, int n1, int m2, int n2,
+                 plasma_complex32_t *A1, int lda1,
+                 plasma_complex32_t *A2, int lda2,
+                 const float *u1, const float *u2);
+
+void core_cgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const plasma_complex32_t *L, int ldl,
+                       plasma_complex32_t *A, int lda);
+
 void core_cgessq(int m, int n,
                  const plasma_complex32_t *A, int lda,
                  float *scale, float *sumsq);
 
 int core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier);
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_cgetrf_rec(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                    plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_cgetrf_incpiv(int m, int n,
+                       plasma_complex32_t *A, int lda, int *ipiv);
+
+int core_cgetrf_nopiv(int m, int n, plasma_complex32_t *A, int lda);
+
+int core_cgetrf_tntpiv_leaf(int m, int n,
+                            const plasma_complex32_t *A, int lda, int row0,
+                            plasma_complex32_t *C, int ldc, int *rows,
+                            plasma_complex32_t *W, int *iwork);
+
+int core_cgetrf_tntpiv_merge(int n,
+                             plasma_complex32_t *C1, int *rows1, int c1,
+                             const plasma_complex32_t *C2, const int *rows2,
+                             int c2, int ldc,
+                             plasma_complex32_t *W, int *iwork);
+
+int core_cgttrf_spike(int n,
+                      plasma_complex32_t *dl, plasma_complex32_t *d,
+                      plasma_complex32_t *du, plasma_complex32_t *du2,
+                      int *ipiv,
+                      plasma_complex32_t dl0, plasma_complex32_t dun,
+                      plasma_complex32_t *VW);
+
+void core_cgttrs(int n, int nrhs,
+                 const plasma_complex32_t *dl, const plasma_complex32_t *d,
+                 const plasma_complex32_t *du, const plasma_complex32_t *du2,
+                 const int *ipiv,
+                 plasma_complex32_t *B, int ldb);
+
+void core_cgtsv_interleaved(int n, int nrhs, int count, int stride,
+                            plasma_complex32_t *dl, plasma_complex32_t *d,
+                            plasma_complex32_t *du, plasma_complex32_t *B,
+                            int *info);
+
+int core_chegst(int itype, plasma_enum_t uplo,
+                int n,
+                      plasma_complex32_t *A, int lda,
+                const plasma_complex32_t *B, int ldb);
 
 void core_chemm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
@@ -77,6 +239,11 @@ void core_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                 float alpha, const plasma_complex32_t *A, int lda,
                 float beta,        plasma_complex32_t *C, int ldc);
 
+void core_cherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       float alpha, const plasma_complex32_t *A, int lda,
+                       float beta,        plasma_complex32_t *C, int ldc);
+
 void core_chessq(plasma_enum_t uplo,
                  int n,
                  const plasma_complex32_t *A, int lda,
@@ -92,6 +259,18 @@ void core_clacpy(plasma_enum_t uplo,
                  const plasma_complex32_t *A, int lda,
                        plasma_complex32_t *B, int ldb);
 
+void core_clacpy_stream(int m, int n,
+                        const plasma_complex32_t *A, int lda,
+                              plasma_complex32_t *B, int ldb);
+
+void core_clacpy_trans(plasma_enum_t trans,
+                       int m, int n,
+                       const plasma_complex32_t *A, int lda,
+                             plasma_complex32_t *B, int ldb);
+
+void core_clacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, plasma_complex32_t *A, int lda);
+
 void core_clacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
@@ -124,6 +303,12 @@ void core_clantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
                  const plasma_complex32_t *A, int lda,
                  float *work, float *value);
 
+int core_clarft_group(plasma_enum_t storev, int count, int k, int ib,
+                      const int *l,
+                      plasma_complex32_t * const *V, const int *ldv,
+                      plasma_complex32_t * const *Tb, int ldtb,
+                      plasma_complex32_t *T, int ldt);
+
 void core_clascl(plasma_enum_t uplo,
                  float cfrom, float cto,
                  int m, int n,
@@ -137,10 +322,44 @@ void core_claset(plasma_enum_t uplo,
 void core_claswp(plasma_enum_t colrow,
                  plasma_desc_t A, int k1, int k2, const int *ipiv, int incx);
 
+void core_claswp_cycles(plasma_enum_t colrow,
+                        plasma_desc_t A, const int *cycles, int len,
+                        plasma_complex32_t *work);
+
 int core_clauum(plasma_enum_t uplo,
                 int n,
                 plasma_complex32_t *A, int lda);
 
+void core_clrcompress(int m, int n, float tol,
+                      plasma_complex32_t *A, int lda, int *rank,
+                      plasma_complex32_t *work);
+
+void core_clrdecompress(int m, int n,
+                        plasma_complex32_t *A, int lda, int *rank,
+                        plasma_complex32_t *work);
+
+void core_clrgemm(int m, int n, int k, float tol,
+                  const plasma_complex32_t *A, int lda, const int *ranka,
+                  const plasma_complex32_t *B, int ldb, const int *rankb,
+                        plasma_complex32_t *C, int ldc, int *rankc,
+                  plasma_complex32_t *work);
+
+void core_clrherk(int n, int k,
+                  const plasma_complex32_t *A, int lda, const int *rank,
+                        plasma_complex32_t *C, int ldc,
+                  plasma_complex32_t *work);
+
+void core_clrtrsm(int m, int n,
+                  const plasma_complex32_t *L, int ldl,
+                        plasma_complex32_t *A, int lda,
+                  const int *rank);
+
+void core_clumm(int n, plasma_complex32_t *A, int lda);
+
+void core_cpack(plasma_enum_t uplo, int m, int n,
+                const plasma_complex32_t *A, int lda, int rate,
+                unsigned char *B, int ldb);
+
 int core_cpamm(int op, plasma_enum_t side, plasma_enum_t storev,
                int m, int n, int k, int l,
                const plasma_complex32_t *A1, int lda1,
@@ -157,6 +376,15 @@ int core_cparfb(plasma_enum_t side, plasma_enum_t trans, plasma_enum_t direct,
                 const plasma_complex32_t *T,    int ldt,
                       plasma_complex32_t *work, int ldwork);
 
+int core_cparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                      plasma_enum_t storev,
+                      int count, int m1, int n1, const int *l, int k,
+                            plasma_complex32_t *A1, int lda1,
+                      plasma_complex32_t * const *A2, const int *lda2,
+                      plasma_complex32_t * const *V, const int *ldv,
+                      const plasma_complex32_t *T, int ldt,
+                            plasma_complex32_t *work, int ldwork);
+
 int core_cpemv(plasma_enum_t trans, int storev,
                int m, int n, int l,
                plasma_complex32_t alpha,
@@ -166,10 +394,56 @@ int core_cpemv(plasma_enum_t trans, int storev,
                plasma_complex32_t *Y, int incy,
                plasma_complex32_t *work);
 
+#ifdef COMPLEX
+void core_cplghe(float bump,
+                 int m, int n, plasma_complex32_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+#endif
+
+void core_cplgsy(plasma_complex32_t bump,
+                 int m, int n, plasma_complex32_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
+void core_cplrnt(int m, int n, plasma_complex32_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
 int core_cpotrf(plasma_enum_t uplo,
                 int n,
                 plasma_complex32_t *A, int lda);
 
+int core_cpotrf_team(plasma_enum_t uplo, int n,
+                     plasma_complex32_t *A, int lda, int ib,
+                     int rank, int size,
+                     int *info, plasma_barrier_t *barrier);
+
+int core_cpstrf(plasma_desc_t A, int *piv, float tol,
+                float *diag, plasma_complex32_t *x,
+                int rank, int size,
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_cpttrf_spike(int n, float *d, plasma_complex32_t *e,
+                      plasma_complex32_t dl0, plasma_complex32_t dun,
+                      plasma_complex32_t *VW);
+
+void core_cpttrs(int n, int nrhs,
+                 const float *d, const plasma_complex32_t *e,
+                 plasma_complex32_t *B, int ldb);
+
+void core_cptsv_interleaved(int n, int nrhs, int count, int stride,
+                            float *d, plasma_complex32_t *e,
+                            plasma_complex32_t *B, int *info);
+
+void core_crepack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *A, int lda, int ratea,
+                  unsigned char *B, int ldb, int rateb);
+
+void core_cssssm(int m2, int n, int k, int ib,
+                       plasma_complex32_t *A1, int lda1,
+                       plasma_complex32_t *A2, int lda2,
+                 const plasma_complex32_t *L1, int ldl1,
+                 const plasma_complex32_t *L2, int ldl2,
+                 const int *ipiv);
+
 void core_csymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
@@ -188,6 +462,9 @@ void core_csyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
                 plasma_complex32_t beta,        plasma_complex32_t *C, int ldc);
 
+plasma_enum_t core_ctile_structure(int m, int n,
+                                   const plasma_complex32_t *A, int lda);
+
 int core_ctradd(plasma_enum_t uplo, plasma_enum_t transa,
                 int m, int n,
                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
@@ -210,6 +487,13 @@ void core_ctrssq(plasma_enum_t uplo, plasma_enum_t diag,
                  const plasma_complex32_t *A, int lda,
                  float *scale, float *sumsq);
 
+int core_ctrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                int isgn, int m, int n,
+                const plasma_complex32_t *A, int lda,
+                const plasma_complex32_t *B, int ldb,
+                      plasma_complex32_t *C, int ldc,
+                float *scale);
+
 int core_ctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                 int n,
                 plasma_complex32_t *A, int lda);
@@ -237,6 +521,12 @@ int core_ctsmqr(plasma_enum_t side, plasma_enum_t trans,
                 const plasma_complex32_t *T,    int ldt,
                       plasma_complex32_t *work, int ldwork);
 
+int core_ctpqrt(int m, int n, int l, int ib,
+                plasma_complex32_t *A1, int lda1,
+                plasma_complex32_t *A2, int lda2,
+                plasma_complex32_t *T,  int ldt,
+                plasma_complex32_t *work);
+
 int core_ctsqrt(int m, int n, int ib,
                 plasma_complex32_t *A1, int lda1,
                 plasma_complex32_t *A2, int lda2,
@@ -244,6 +534,13 @@ int core_ctsqrt(int m, int n, int ib,
                 plasma_complex32_t *tau,
                 plasma_complex32_t *work);
 
+int core_ctstrf(int m, int n, int ib,
+                plasma_complex32_t *U, int ldu,
+                plasma_complex32_t *A, int lda,
+                plasma_complex32_t *L, int ldl,
+                int *ipiv,
+                plasma_complex32_t *work, int ldwork);
+
 int core_cttlqt(int m, int n, int ib,
                 plasma_complex32_t *A1, int lda1,
                 plasma_complex32_t *A2, int lda2,
@@ -288,12 +585,37 @@ int core_cunmqr(plasma_enum_t side, plasma_enum_t trans,
                       plasma_complex32_t *C,    int ldc,
                       plasma_complex32_t *work, int ldwork);
 
+void core_cunpack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *B, int ldb, int rate,
+                  plasma_complex32_t *A, int lda);
+
 /******************************************************************************/
 void core_omp_scamax(int colrow, int m, int n,
                      const plasma_complex32_t *A, int lda,
                      float *values,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_cchud(plasma_enum_t uplo, int sign, int n, int k,
+                    plasma_complex32_t *A, int lda,
+                    plasma_complex32_t *V, int ldv,
+                    plasma_complex32_t *G, int ldg,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                     const plasma_complex32_t *G, int ldg,
+                           plasma_complex32_t *A, int lda,
+                           plasma_complex32_t *V, int ldv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgbhrd_q(int n, int kd,
+                       const plasma_complex32_t *V,
+                       const plasma_complex32_t *tau,
+                       int jq, int nq,
+                       plasma_complex32_t *Q, int ldq,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_cgeadd(
     plasma_enum_t transa, int m, int n,
     plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
@@ -303,7 +625,7 @@ void core_omp_cgeadd(
 void core_omp_cgelqt(int m, int n, int ib,
                      plasma_complex32_t *A, int lda,
                      plasma_complex32_t *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_cgemm(
@@ -314,10 +636,125 @@ void core_omp_cgemm(
     plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_cgemm_commute(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemm_chain(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int count, int m, int n, const int *k,
+    plasma_complex32_t alpha, plasma_complex32_t * const *A, const int *lda,
+                              plasma_complex32_t * const *B, const int *ldb,
+    plasma_complex32_t beta,  plasma_complex32_t *C, int ldc,
+    int prefetch,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemm_nested(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int nb_sub,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemm_device(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                         int m, int n, int k,
+                         plasma_complex32_t alpha,
+                         const plasma_complex32_t *A, int lda,
+                         void **P,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void core_omp_cgemm_packed(int m, int n, int k,
+                           void **Ap, void **Bp,
+                           plasma_complex32_t beta,
+                           plasma_complex32_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_cgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                                int m, int n,
+                                const plasma_complex32_t *A, int lda,
+                                int slices, void **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
+void core_omp_cgemm_ozaki(int m, int n, int k, int slices,
+                          plasma_complex32_t alpha, void **A, void **B,
+                          plasma_complex32_t beta,
+                          plasma_complex32_t *C, int ldc,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_cgemm_ozaki_free(void **S,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void core_omp_cgemm_emulated(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int slices,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef COMPLEX
+void core_omp_cgemm3m_split(plasma_enum_t trans, int m, int n,
+                            const plasma_complex32_t *A, int lda,
+                            float **S,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_cgemm3m(int m, int n, int k,
+                      plasma_complex32_t alpha, float **A, float **B,
+                      plasma_complex32_t beta, plasma_complex32_t *C, int ldc,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemm3m_free(float **S,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+#endif
+
+void core_omp_cgemm_scamax(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    float *values,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgemmt(
+    plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_cgeqrt(int m, int n, int ib,
                      plasma_complex32_t *A, int lda,
                      plasma_complex32_t *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const plasma_complex32_t *L, int ldl,
+                           plasma_complex32_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_cgessq(int m, int n,
@@ -331,6 +768,41 @@ void core_omp_cgessq_aux(int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_cgetrf_incpiv(int m, int n,
+                            plasma_complex32_t *A, int lda, int *ipiv,
+                            int iinfo,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_cgetrf_nopiv(int m, int n,
+                           plasma_complex32_t *A, int lda,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_cgttrf_spike(int n,
+                           plasma_complex32_t *dl, plasma_complex32_t *d,
+                           plasma_complex32_t *du, plasma_complex32_t *du2,
+                           int *ipiv,
+                           plasma_complex32_t dl0, plasma_complex32_t dun,
+                           plasma_complex32_t *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_cgttrs(int n, int nrhs,
+                     const plasma_complex32_t *dl, const plasma_complex32_t *d,
+                     const plasma_complex32_t *du, const plasma_complex32_t *du2,
+                     const int *ipiv,
+                     plasma_complex32_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_chegst(int itype, plasma_enum_t uplo,
+                     int n,
+                           plasma_complex32_t *A, int lda,
+                     const plasma_complex32_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_chemm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -353,6 +825,20 @@ void core_omp_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                     float beta,        plasma_complex32_t *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_cherk_commute(plasma_enum_t uplo, plasma_enum_t trans,
+                            int n, int k,
+                            float alpha, const plasma_complex32_t *A, int lda,
+                            float beta,        plasma_complex32_t *C, int ldc,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_cherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           float alpha, const plasma_complex32_t *A, int lda,
+                           float beta,        plasma_complex32_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_chessq(plasma_enum_t uplo,
                      int n,
                      const plasma_complex32_t *A, int lda,
@@ -377,6 +863,18 @@ void core_omp_clacpy(plasma_enum_t uplo,
                            plasma_complex32_t *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_clacpy_trans(plasma_enum_t trans,
+                           int m, int n,
+                           const plasma_complex32_t *A, int lda,
+                                 plasma_complex32_t *B, int ldb,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_clacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                         int n, plasma_complex32_t *A, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void core_omp_clacpy_lapack2tile_band(plasma_enum_t uplo,
                                       int it, int jt,
                                       int m, int n, int nb, int kl, int ku,
@@ -442,6 +940,14 @@ void core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_clarft_group(plasma_enum_t storev, int count, int k, int ib,
+                           const int *l,
+                           plasma_complex32_t * const *V, const int *ldv,
+                           plasma_complex32_t * const *Tb, int ldtb,
+                           plasma_complex32_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_clascl(plasma_enum_t uplo,
                      float cfrom, float cto,
                      int m, int n,
@@ -460,12 +966,89 @@ void core_omp_clauum(plasma_enum_t uplo,
                      plasma_complex32_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_clrcompress(int m, int n, float tol,
+                          plasma_complex32_t *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_clrdecompress(int m, int n,
+                            plasma_complex32_t *A, int lda, int *rank,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_clrgemm(int m, int n, int k, float tol,
+                      const plasma_complex32_t *A, int lda, const int *ranka,
+                      const plasma_complex32_t *B, int ldb, const int *rankb,
+                            plasma_complex32_t *C, int ldc, int *rankc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_clrherk(int n, int k,
+                      const plasma_complex32_t *A, int lda, const int *rank,
+                            plasma_complex32_t *C, int ldc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_clrtrsm(int m, int n,
+                      const plasma_complex32_t *L, int ldl,
+                            plasma_complex32_t *A, int lda,
+                      const int *rank,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_clumm(int n, plasma_complex32_t *A, int lda,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cpack(plasma_enum_t uplo, int m, int n,
+                    const plasma_complex32_t *A, int lda, int rate,
+                    unsigned char *B, int ldb,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                           plasma_enum_t storev,
+                           int count, int m1, int n1, const int *l, int k,
+                                 plasma_complex32_t *A1, int lda1,
+                           plasma_complex32_t * const *A2, const int *lda2,
+                           plasma_complex32_t * const *V, const int *ldv,
+                           const plasma_complex32_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_cpotrf(plasma_enum_t uplo,
                      int n,
                      plasma_complex32_t *A, int lda,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_cpttrf_spike(int n, float *d, plasma_complex32_t *e,
+                           plasma_complex32_t dl0, plasma_complex32_t dun,
+                           plasma_complex32_t *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_cpttrs(int n, int nrhs,
+                     const float *d, const plasma_complex32_t *e,
+                     plasma_complex32_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_crepack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *A, int lda, int ratea,
+                      unsigned char *B, int ldb, int rateb,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_cssssm(int m2, int n, int k, int ib,
+                           plasma_complex32_t *A1, int lda1,
+                           plasma_complex32_t *A2, int lda2,
+                     const plasma_complex32_t *L1, int ldl1,
+                     const plasma_complex32_t *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_csymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -489,6 +1072,19 @@ void core_omp_csyrk(
     plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_csyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_ctile_structure(int m, int n,
+                              const plasma_complex32_t *A, int lda,
+                              plasma_enum_t *structure,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void core_omp_ctradd(
     plasma_enum_t uplo, plasma_enum_t transa,
     int m, int n,
@@ -518,6 +1114,13 @@ void core_omp_ctrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      float *scale, float *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ctrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                     int isgn, int m, int n,
+                     const plasma_complex32_t *A, int lda,
+                     const plasma_complex32_t *B, int ldb,
+                           plasma_complex32_t *C, int ldc,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_ctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int n,
                      plasma_complex32_t *A, int lda,
@@ -556,6 +1159,15 @@ void core_omp_ctsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ctstrf(int m, int n, int ib,
+                     plasma_complex32_t *U, int ldu,
+                     plasma_complex32_t *A, int lda,
+                     plasma_complex32_t *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_cttlqt(int m, int n, int ib,
                      plasma_complex32_t *A1, int lda1,
                      plasma_complex32_t *A2, int lda2,
@@ -604,6 +1216,11 @@ void core_omp_cunmqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_cunpack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *B, int ldb, int rate,
+                      plasma_complex32_t *A, int lda,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 #undef COMPLEX
 
 #ifdef __cplusplus
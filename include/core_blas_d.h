@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/core_blas_z.h, normal z -> d, Mon Feb  6 14:06:44 2017
+ * @generated from include/core_blas_z.h, normal z -> d, Thu Oct 15 09:29:52 2026
  *
  **/
 #ifndef ICL_CORE_BLAS_D_H
@@ -30,6 +30,48 @@ extern "C" {
 double fabs(double alpha);
 #endif
 
+void core_damax(int colrow, int m, int n,
+                 const double *A, int lda,
+                 double *values);
+
+int core_idamax(int n, const double *x, double *max);
+
+int core_dgetrf_column(int m, int scale, double pivot,
+                       double sfmin, double *x,
+                       double u, double *y,
+                       double *max);
+
+int core_dchud(plasma_enum_t uplo, int sign, int n, int k,
+               double *A, int lda,
+               double *V, int ldv,
+               double *G, int ldg);
+
+int core_dchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                const double *G, int ldg,
+                      double *A, int lda,
+                      double *V, int ldv);
+
+int core_dgbsv(int n, int kl, int ku, int nrhs,
+               double *AB, int ldab, int *ipiv,
+               double *B, int ldb);
+
+void core_dgbsv_interleaved(int n, int kl, int ku, int nrhs,
+                            int count, int stride,
+                            double *AB, int ldab, int *ipiv,
+                            double *B, int *info);
+
+void core_dgbhrd(int n, int kd,
+                 double *A, int lda,
+                 double *V, double *tau,
+                 double *work,
+                 int rank, int size, plasma_barrier_t *barrier);
+
+void core_dgbhrd_q(int n, int kd,
+                   const double *V, const double *tau,
+                   int jq, int nq,
+                   double *Q, int ldq,
+                   double *work);
+
 int core_dgeadd(plasma_enum_t transa,
                 int m, int n,
                 double alpha, const double *A, int lda,
@@ -47,18 +89,138 @@ void core_dgemm(plasma_enum_t transa, plasma_enum_t transb,
                                           const double *B, int ldb,
                 double beta,        double *C, int ldc);
 
+void core_dgemm_jit_finalize(void);
+
+void core_dgemm_device(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       double alpha,
+                       const double *A, int lda,
+                       const double *B, int ldb,
+                       double beta,
+                       double *C, int ldc);
+
+size_t core_dgemm_pack_size(plasma_enum_t side, int m, int n, int k);
+
+void core_dgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                     int m, int n, int k,
+                     double alpha,
+                     const double *A, int lda,
+                     void *P);
+
+void core_dgemm_packed(int m, int n, int k,
+                       const void *Ap, const void *Bp,
+                       double beta,
+                       double *C, int ldc);
+
+size_t core_dgemm_ozaki_split_size(plasma_enum_t side, int m, int n,
+                                   int slices);
+
+void core_dgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                            int m, int n,
+                            const double *A, int lda,
+                            int slices, void *S);
+
+void core_dgemm_ozaki(int m, int n, int k, int slices,
+                      double alpha, const void *A, const void *B,
+                      double beta, double *C, int ldc);
+
+int core_dgemm_emulated(plasma_enum_t transa, plasma_enum_t transb,
+                        int m, int n, int k, int slices,
+                        double alpha,
+                        const double *A, int lda,
+                        const double *B, int ldb,
+                        double beta,
+                        double *C, int ldc);
+
+#ifdef COMPLEX
+size_t core_dgemm3m_split_size(int m, int n);
+
+void core_dgemm3m_split(plasma_enum_t trans, int m, int n,
+                        const double *A, int lda,
+                        double *S);
+
+void core_dgemm3m(int m, int n, int k,
+                  double alpha, const double *A, const double *B,
+                  double beta, double *C, int ldc,
+                  double *work);
+#endif
+
+void core_dgemmt(plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t transb,
+                 int n, int k,
+                 double alpha, const double *A, int lda,
+                                           const double *B, int ldb,
+                 double beta,        double *C, int ldc);
+
 int core_dgeqrt(int m, int n, int ib,
                 double *A, int lda,
                 double *T, int ldt,
                 double *tau,
                 double *work);
 
+int core_dgeqrt_panel(plasma_desc_t A, plasma_desc_t T, int ib,
+                      int rank, int size,
+                      double *work, plasma_barrier_t *barrier);
+
+void core_dgerbt(plasma_enum_t side, plasma_enum_t trans,
+                 int m1, int n1, int m2, int n2,
+                 double *A1, int lda1,
+                 double *A2, int lda2,
+                 const double *u1, const double *u2);
+
+void core_dgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const double *L, int ldl,
+                       double *A, int lda);
+
 void core_dgessq(int m, int n,
                  const double *A, int lda,
                  double *scale, double *sumsq);
 
 int core_dgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier);
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_dgetrf_rec(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                    plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_dgetrf_incpiv(int m, int n,
+                       double *A, int lda, int *ipiv);
+
+int core_dgetrf_nopiv(int m, int n, double *A, int lda);
+
+int core_dgetrf_tntpiv_leaf(int m, int n,
+                            const double *A, int lda, int row0,
+                            double *C, int ldc, int *rows,
+                            double *W, int *iwork);
+
+int core_dgetrf_tntpiv_merge(int n,
+                             double *C1, int *rows1, int c1,
+                             const double *C2, const int *rows2,
+                             int c2, int ldc,
+                             double *W, int *iwork);
+
+int core_dgttrf_spike(int n,
+                      double *dl, double *d,
+                      double *du, double *du2,
+                      int *ipiv,
+                      double dl0, double dun,
+                      double *VW);
+
+void core_dgttrs(int n, int nrhs,
+                 const double *dl, const double *d,
+                 const double *du, const double *du2,
+                 const int *ipiv,
+                 double *B, int ldb);
+
+void core_dgtsv_interleaved(int n, int nrhs, int count, int stride,
+                            double *dl, double *d,
+                            double *du, double *B,
+                            int *info);
+
+int core_dsygst(int itype, plasma_enum_t uplo,
+                int n,
+                      double *A, int lda,
+                const double *B, int ldb);
 
 void core_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
@@ -77,6 +239,11 @@ void core_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 double alpha, const double *A, int lda,
                 double beta,        double *C, int ldc);
 
+void core_dsyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       double alpha, const double *A, int lda,
+                       double beta,        double *C, int ldc);
+
 void core_dsyssq(plasma_enum_t uplo,
                  int n,
                  const double *A, int lda,
@@ -92,6 +259,18 @@ void core_dlacpy(plasma_enum_t uplo,
                  const double *A, int lda,
                        double *B, int ldb);
 
+void core_dlacpy_stream(int m, int n,
+                        const double *A, int lda,
+                              double *B, int ldb);
+
+void core_dlacpy_trans(plasma_enum_t trans,
+                       int m, int n,
+                       const double *A, int lda,
+                             double *B, int ldb);
+
+void core_dlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, double *A, int lda);
+
 void core_dlacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
@@ -124,6 +303,12 @@ void core_dlantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
                  const double *A, int lda,
                  double *work, double *value);
 
+int core_dlarft_group(plasma_enum_t storev, int count, int k, int ib,
+                      const int *l,
+                      double * const *V, const int *ldv,
+                      double * const *Tb, int ldtb,
+                      double *T, int ldt);
+
 void core_dlascl(plasma_enum_t uplo,
                  double cfrom, double cto,
                  int m, int n,
@@ -137,10 +322,44 @@ void core_dlaset(plasma_enum_t uplo,
 void core_dlaswp(plasma_enum_t colrow,
                  plasma_desc_t A, int k1, int k2, const int *ipiv, int incx);
 
+void core_dlaswp_cycles(plasma_enum_t colrow,
+                        plasma_desc_t A, const int *cycles, int len,
+                        double *work);
+
 int core_dlauum(plasma_enum_t uplo,
                 int n,
                 double *A, int lda);
 
+void core_dlrcompress(int m, int n, double tol,
+                      double *A, int lda, int *rank,
+                      double *work);
+
+void core_dlrdecompress(int m, int n,
+                        double *A, int lda, int *rank,
+                        double *work);
+
+void core_dlrgemm(int m, int n, int k, double tol,
+                  const double *A, int lda, const int *ranka,
+                  const double *B, int ldb, const int *rankb,
+                        double *C, int ldc, int *rankc,
+                  double *work);
+
+void core_dlrsyrk(int n, int k,
+                  const double *A, int lda, const int *rank,
+                        double *C, int ldc,
+                  double *work);
+
+void core_dlrtrsm(int m, int n,
+                  const double *L, int ldl,
+                        double *A, int lda,
+                  const int *rank);
+
+void core_dlumm(int n, double *A, int lda);
+
+void core_dpack(plasma_enum_t uplo, int m, int n,
+                const double *A, int lda, int rate,
+                unsigned char *B, int ldb);
+
 int core_dpamm(int op, plasma_enum_t side, plasma_enum_t storev,
                int m, int n, int k, int l,
                const double *A1, int lda1,
@@ -157,6 +376,15 @@ int core_dparfb(plasma_enum_t side, plasma_enum_t trans, plasma_enum_t direct,
                 const double *T,    int ldt,
                       double *work, int ldwork);
 
+int core_dparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                      plasma_enum_t storev,
+                      int count, int m1, int n1, const int *l, int k,
+                            double *A1, int lda1,
+                      double * const *A2, const int *lda2,
+                      double * const *V, const int *ldv,
+                      const double *T, int ldt,
+                            double *work, int ldwork);
+
 int core_dpemv(plasma_enum_t trans, int storev,
                int m, int n, int l,
                double alpha,
@@ -166,10 +394,56 @@ int core_dpemv(plasma_enum_t trans, int storev,
                double *Y, int incy,
                double *work);
 
+#ifdef COMPLEX
+void core_dplgsy(double bump,
+                 int m, int n, double *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+#endif
+
+void core_dplgsy(double bump,
+                 int m, int n, double *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
+void core_dplrnt(int m, int n, double *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
 int core_dpotrf(plasma_enum_t uplo,
                 int n,
                 double *A, int lda);
 
+int core_dpotrf_team(plasma_enum_t uplo, int n,
+                     double *A, int lda, int ib,
+                     int rank, int size,
+                     int *info, plasma_barrier_t *barrier);
+
+int core_dpstrf(plasma_desc_t A, int *piv, double tol,
+                double *diag, double *x,
+                int rank, int size,
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_dpttrf_spike(int n, double *d, double *e,
+                      double dl0, double dun,
+                      double *VW);
+
+void core_dpttrs(int n, int nrhs,
+                 const double *d, const double *e,
+                 double *B, int ldb);
+
+void core_dptsv_interleaved(int n, int nrhs, int count, int stride,
+                            double *d, double *e,
+                            double *B, int *info);
+
+void core_drepack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *A, int lda, int ratea,
+                  unsigned char *B, int ldb, int rateb);
+
+void core_dssssm(int m2, int n, int k, int ib,
+                       double *A1, int lda1,
+                       double *A2, int lda2,
+                 const double *L1, int ldl1,
+                 const double *L2, int ldl2,
+                 const int *ipiv);
+
 void core_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 double alpha, const double *A, int lda,
@@ -188,6 +462,9 @@ void core_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 double alpha, const double *A, int lda,
                 double beta,        double *C, int ldc);
 
+plasma_enum_t core_dtile_structure(int m, int n,
+                                   const double *A, int lda);
+
 int core_dtradd(plasma_enum_t uplo, plasma_enum_t transa,
                 int m, int n,
                 double alpha, const double *A, int lda,
@@ -210,6 +487,13 @@ void core_dtrssq(plasma_enum_t uplo, plasma_enum_t diag,
                  const double *A, int lda,
                  double *scale, double *sumsq);
 
+int core_dtrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                int isgn, int m, int n,
+                const double *A, int lda,
+                const double *B, int ldb,
+                      double *C, int ldc,
+                double *scale);
+
 int core_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
                 int n,
                 double *A, int lda);
@@ -237,6 +521,12 @@ int core_dtsmqr(plasma_enum_t side, plasma_enum_t trans,
                 const double *T,    int ldt,
                       double *work, int ldwork);
 
+int core_dtpqrt(int m, int n, int l, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *work);
+
 int core_dtsqrt(int m, int n, int ib,
                 double *A1, int lda1,
                 double *A2, int lda2,
@@ -244,6 +534,13 @@ int core_dtsqrt(int m, int n, int ib,
                 double *tau,
                 double *work);
 
+int core_dtstrf(int m, int n, int ib,
+                double *U, int ldu,
+                double *A, int lda,
+                double *L, int ldl,
+                int *ipiv,
+                double *work, int ldwork);
+
 int core_dttlqt(int m, int n, int ib,
                 double *A1, int lda1,
                 double *A2, int lda2,
@@ -288,12 +585,37 @@ int core_dormqr(plasma_enum_t side, plasma_enum_t trans,
                       double *C,    int ldc,
                       double *work, int ldwork);
 
+void core_dunpack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *B, int ldb, int rate,
+                  double *A, int lda);
+
 /******************************************************************************/
 void core_omp_damax(int colrow, int m, int n,
                      const double *A, int lda,
                      double *values,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dchud(plasma_enum_t uplo, int sign, int n, int k,
+                    double *A, int lda,
+                    double *V, int ldv,
+                    double *G, int ldg,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                     const double *G, int ldg,
+                           double *A, int lda,
+                           double *V, int ldv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgbhrd_q(int n, int kd,
+                       const double *V,
+                       const double *tau,
+                       int jq, int nq,
+                       double *Q, int ldq,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dgeadd(
     plasma_enum_t transa, int m, int n,
     double alpha, const double *A, int lda,
@@ -303,7 +625,7 @@ void core_omp_dgeadd(
 void core_omp_dgelqt(int m, int n, int ib,
                      double *A, int lda,
                      double *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_dgemm(
@@ -314,10 +636,125 @@ void core_omp_dgemm(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dgemm_commute(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemm_chain(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int count, int m, int n, const int *k,
+    double alpha, double * const *A, const int *lda,
+                              double * const *B, const int *ldb,
+    double beta,  double *C, int ldc,
+    int prefetch,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemm_nested(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int nb_sub,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemm_device(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                         int m, int n, int k,
+                         double alpha,
+                         const double *A, int lda,
+                         void **P,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void core_omp_dgemm_packed(int m, int n, int k,
+                           void **Ap, void **Bp,
+                           double beta,
+                           double *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_dgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                                int m, int n,
+                                const double *A, int lda,
+                                int slices, void **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
+void core_omp_dgemm_ozaki(int m, int n, int k, int slices,
+                          double alpha, void **A, void **B,
+                          double beta,
+                          double *C, int ldc,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_dgemm_ozaki_free(void **S,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void core_omp_dgemm_emulated(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int slices,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef COMPLEX
+void core_omp_dgemm3m_split(plasma_enum_t trans, int m, int n,
+                            const double *A, int lda,
+                            double **S,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_dgemm3m(int m, int n, int k,
+                      double alpha, double **A, double **B,
+                      double beta, double *C, int ldc,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemm3m_free(double **S,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+#endif
+
+void core_omp_dgemm_damax(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    double *values,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgemmt(
+    plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dgeqrt(int m, int n, int ib,
                      double *A, int lda,
                      double *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const double *L, int ldl,
+                           double *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_dgessq(int m, int n,
@@ -331,6 +768,41 @@ void core_omp_dgessq_aux(int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_dgetrf_incpiv(int m, int n,
+                            double *A, int lda, int *ipiv,
+                            int iinfo,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_dgetrf_nopiv(int m, int n,
+                           double *A, int lda,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_dgttrf_spike(int n,
+                           double *dl, double *d,
+                           double *du, double *du2,
+                           int *ipiv,
+                           double dl0, double dun,
+                           double *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_dgttrs(int n, int nrhs,
+                     const double *dl, const double *d,
+                     const double *du, const double *du2,
+                     const int *ipiv,
+                     double *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dsygst(int itype, plasma_enum_t uplo,
+                     int n,
+                           double *A, int lda,
+                     const double *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -353,6 +825,20 @@ void core_omp_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                     double beta,        double *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dsyrk_commute(plasma_enum_t uplo, plasma_enum_t trans,
+                            int n, int k,
+                            double alpha, const double *A, int lda,
+                            double beta,        double *C, int ldc,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_dsyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           double alpha, const double *A, int lda,
+                           double beta,        double *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_dsyssq(plasma_enum_t uplo,
                      int n,
                      const double *A, int lda,
@@ -377,6 +863,18 @@ void core_omp_dlacpy(plasma_enum_t uplo,
                            double *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dlacpy_trans(plasma_enum_t trans,
+                           int m, int n,
+                           const double *A, int lda,
+                                 double *B, int ldb,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_dlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                         int n, double *A, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void core_omp_dlacpy_lapack2tile_band(plasma_enum_t uplo,
                                       int it, int jt,
                                       int m, int n, int nb, int kl, int ku,
@@ -442,6 +940,14 @@ void core_omp_dlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_dlarft_group(plasma_enum_t storev, int count, int k, int ib,
+                           const int *l,
+                           double * const *V, const int *ldv,
+                           double * const *Tb, int ldtb,
+                           double *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_dlascl(plasma_enum_t uplo,
                      double cfrom, double cto,
                      int m, int n,
@@ -460,12 +966,89 @@ void core_omp_dlauum(plasma_enum_t uplo,
                      double *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dlrcompress(int m, int n, double tol,
+                          double *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_dlrdecompress(int m, int n,
+                            double *A, int lda, int *rank,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_dlrgemm(int m, int n, int k, double tol,
+                      const double *A, int lda, const int *ranka,
+                      const double *B, int ldb, const int *rankb,
+                            double *C, int ldc, int *rankc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_dlrsyrk(int n, int k,
+                      const double *A, int lda, const int *rank,
+                            double *C, int ldc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_dlrtrsm(int m, int n,
+                      const double *L, int ldl,
+                            double *A, int lda,
+                      const int *rank,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_dlumm(int n, double *A, int lda,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dpack(plasma_enum_t uplo, int m, int n,
+                    const double *A, int lda, int rate,
+                    unsigned char *B, int ldb,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                           plasma_enum_t storev,
+                           int count, int m1, int n1, const int *l, int k,
+                                 double *A1, int lda1,
+                           double * const *A2, const int *lda2,
+                           double * const *V, const int *ldv,
+                           const double *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_dpotrf(plasma_enum_t uplo,
                      int n,
                      double *A, int lda,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dpttrf_spike(int n, double *d, double *e,
+                           double dl0, double dun,
+                           double *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_dpttrs(int n, int nrhs,
+                     const double *d, const double *e,
+                     double *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_drepack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *A, int lda, int ratea,
+                      unsigned char *B, int ldb, int rateb,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dssssm(int m2, int n, int k, int ib,
+                           double *A1, int lda1,
+                           double *A2, int lda2,
+                     const double *L1, int ldl1,
+                     const double *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -489,6 +1072,19 @@ void core_omp_dsyrk(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dsyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    double alpha, const double *A, int lda,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dtile_structure(int m, int n,
+                              const double *A, int lda,
+                              plasma_enum_t *structure,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void core_omp_dtradd(
     plasma_enum_t uplo, plasma_enum_t transa,
     int m, int n,
@@ -518,6 +1114,13 @@ void core_omp_dtrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      double *scale, double *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dtrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                     int isgn, int m, int n,
+                     const double *A, int lda,
+                     const double *B, int ldb,
+                           double *C, int ldc,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int n,
                      double *A, int lda,
@@ -556,6 +1159,15 @@ void core_omp_dtsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dtstrf(int m, int n, int ib,
+                     double *U, int ldu,
+                     double *A, int lda,
+                     double *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_dttlqt(int m, int n, int ib,
                      double *A1, int lda1,
                      double *A2, int lda2,
@@ -604,6 +1216,11 @@ void core_omp_dormqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dunpack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *B, int ldb, int rate,
+                      double *A, int lda,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 #undef REAL
 
 #ifdef __cplusplus
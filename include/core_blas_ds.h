@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/core_blas_zc.h, mixed zc -> ds, Mon Feb  6 14:06:44 2017
+ * @generated from include/core_blas_zc.h, mixed zc -> ds, Thu Oct 15 05:43:37 2026
  *
  **/
 #ifndef ICL_CORE_BLAS_DS_H
@@ -29,6 +29,38 @@ void core_slag2d(int m, int n,
                  float *As, int ldas,
                  double *A,  int lda);
 
+void core_dlag2s_inplace(int m, int n, double *A, int lda);
+
+void core_dlacpy_lag2c(int m, int n,
+                       const double *A,  int lda,
+                             double *B,  int ldb,
+                             float *As, int ldas);
+
+void core_slag2d_inplace(int m, int n, double *A, int lda);
+
+void core_dsgemm(plasma_enum_t transa, plasma_enum_t transb,
+                 int m, int n, int k,
+                 double alpha,
+                 const double *A, plasma_enum_t preca, int lda,
+                 const double *B, plasma_enum_t precb, int ldb,
+                 double beta,
+                       double *C, plasma_enum_t precc, int ldc,
+                 double *work);
+
+void core_dssyrk(plasma_enum_t uplo, plasma_enum_t trans,
+                 int n, int k,
+                 double alpha,
+                 const double *A, plasma_enum_t preca, int lda,
+                 double beta, double *C, int ldc,
+                 double *work);
+
+void core_dstrsm(plasma_enum_t side, plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t diag,
+                 int m, int n,
+                 double alpha, const double *A, int lda,
+                       double *B, plasma_enum_t precb, int ldb,
+                 double *work);
+
 /******************************************************************************/
 void core_omp_dlag2s(int m, int n,
                      double *A,  int lda,
@@ -40,6 +72,49 @@ void core_omp_slag2d(int m, int n,
                      double *A,  int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_dlag2s_inplace(int m, int n, double *A, int lda,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void core_omp_dlacpy_lag2c(int m, int n,
+                           const double *A,  int lda,
+                                 double *B,  int ldb,
+                                 float *As, int ldas,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_slag2d_inplace(int m, int n, double *A, int lda,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void core_omp_dsgemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha,
+    const double *A, plasma_enum_t preca, int lda,
+    const double *B, plasma_enum_t precb, int ldb,
+    double beta,
+          double *C, plasma_enum_t precc, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dssyrk(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, int k,
+                     double alpha,
+                     const double *A, plasma_enum_t preca, int lda,
+                     double beta, double *C, int ldc,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_dstrsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    double alpha, const double *A, int lda,
+          double *B, plasma_enum_t precb, int ldb,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
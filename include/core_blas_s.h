@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/core_blas_z.h, normal z -> s, Mon Feb  6 14:06:44 2017
+ * @generated from include/core_blas_z.h, normal z -> s, Thu Oct 15 09:29:51 2026
  *
  **/
 #ifndef ICL_CORE_BLAS_S_H
@@ -30,6 +30,48 @@ extern "C" {
 float fabsf(float alpha);
 #endif
 
+void core_samax(int colrow, int m, int n,
+                 const float *A, int lda,
+                 float *values);
+
+int core_isamax(int n, const float *x, float *max);
+
+int core_sgetrf_column(int m, int scale, float pivot,
+                       float sfmin, float *x,
+                       float u, float *y,
+                       float *max);
+
+int core_schud(plasma_enum_t uplo, int sign, int n, int k,
+               float *A, int lda,
+               float *V, int ldv,
+               float *G, int ldg);
+
+int core_schudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                const float *G, int ldg,
+                      float *A, int lda,
+                      float *V, int ldv);
+
+int core_sgbsv(int n, int kl, int ku, int nrhs,
+               float *AB, int ldab, int *ipiv,
+               float *B, int ldb);
+
+void core_sgbsv_interleaved(int n, int kl, int ku, int nrhs,
+                            int count, int stride,
+                            float *AB, int ldab, int *ipiv,
+                            float *B, int *info);
+
+void core_sgbhrd(int n, int kd,
+                 float *A, int lda,
+                 float *V, float *tau,
+                 float *work,
+                 int rank, int size, plasma_barrier_t *barrier);
+
+void core_sgbhrd_q(int n, int kd,
+                   const float *V, const float *tau,
+                   int jq, int nq,
+                   float *Q, int ldq,
+                   float *work);
+
 int core_sgeadd(plasma_enum_t transa,
                 int m, int n,
                 float alpha, const float *A, int lda,
@@ -47,18 +89,138 @@ void core_sgemm(plasma_enum_t transa, plasma_enum_t transb,
                                           const float *B, int ldb,
                 float beta,        float *C, int ldc);
 
+void core_sgemm_jit_finalize(void);
+
+void core_sgemm_device(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       float alpha,
+                       const float *A, int lda,
+                       const float *B, int ldb,
+                       float beta,
+                       float *C, int ldc);
+
+size_t core_sgemm_pack_size(plasma_enum_t side, int m, int n, int k);
+
+void core_sgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                     int m, int n, int k,
+                     float alpha,
+                     const float *A, int lda,
+                     void *P);
+
+void core_sgemm_packed(int m, int n, int k,
+                       const void *Ap, const void *Bp,
+                       float beta,
+                       float *C, int ldc);
+
+size_t core_sgemm_ozaki_split_size(plasma_enum_t side, int m, int n,
+                                   int slices);
+
+void core_sgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                            int m, int n,
+                            const float *A, int lda,
+                            int slices, void *S);
+
+void core_sgemm_ozaki(int m, int n, int k, int slices,
+                      float alpha, const void *A, const void *B,
+                      float beta, float *C, int ldc);
+
+int core_sgemm_emulated(plasma_enum_t transa, plasma_enum_t transb,
+                        int m, int n, int k, int slices,
+                        float alpha,
+                        const float *A, int lda,
+                        const float *B, int ldb,
+                        float beta,
+                        float *C, int ldc);
+
+#ifdef COMPLEX
+size_t core_sgemm3m_split_size(int m, int n);
+
+void core_sgemm3m_split(plasma_enum_t trans, int m, int n,
+                        const float *A, int lda,
+                        float *S);
+
+void core_sgemm3m(int m, int n, int k,
+                  float alpha, const float *A, const float *B,
+                  float beta, float *C, int ldc,
+                  float *work);
+#endif
+
+void core_sgemmt(plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t transb,
+                 int n, int k,
+                 float alpha, const float *A, int lda,
+                                           const float *B, int ldb,
+                 float beta,        float *C, int ldc);
+
 int core_sgeqrt(int m, int n, int ib,
                 float *A, int lda,
                 float *T, int ldt,
                 float *tau,
                 float *work);
 
+int core_sgeqrt_panel(plasma_desc_t A, plasma_desc_t T, int ib,
+                      int rank, int size,
+                      float *work, plasma_barrier_t *barrier);
+
+void core_sgerbt(plasma_enum_t side, plasma_enum_t trans,
+                 int m1, int n1, int m2, int n2,
+                 float *A1, int lda1,
+                 float *A2, int lda2,
+                 const float *u1, const float *u2);
+
+void core_sgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const float *L, int ldl,
+                       float *A, int lda);
+
 void core_sgessq(int m, int n,
                  const float *A, int lda,
                  float *scale, float *sumsq);
 
 int core_sgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier);
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_sgetrf_rec(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                    plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_sgetrf_incpiv(int m, int n,
+                       float *A, int lda, int *ipiv);
+
+int core_sgetrf_nopiv(int m, int n, float *A, int lda);
+
+int core_sgetrf_tntpiv_leaf(int m, int n,
+                            const float *A, int lda, int row0,
+                            float *C, int ldc, int *rows,
+                            float *W, int *iwork);
+
+int core_sgetrf_tntpiv_merge(int n,
+                             float *C1, int *rows1, int c1,
+                             const float *C2, const int *rows2,
+                             int c2, int ldc,
+                             float *W, int *iwork);
+
+int core_sgttrf_spike(int n,
+                      float *dl, float *d,
+                      float *du, float *du2,
+                      int *ipiv,
+                      float dl0, float dun,
+                      float *VW);
+
+void core_sgttrs(int n, int nrhs,
+                 const float *dl, const float *d,
+                 const float *du, const float *du2,
+                 const int *ipiv,
+                 float *B, int ldb);
+
+void core_sgtsv_interleaved(int n, int nrhs, int count, int stride,
+                            float *dl, float *d,
+                            float *du, float *B,
+                            int *info);
+
+int core_ssygst(int itype, plasma_enum_t uplo,
+                int n,
+                      float *A, int lda,
+                const float *B, int ldb);
 
 void core_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
@@ -77,6 +239,11 @@ void core_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 float alpha, const float *A, int lda,
                 float beta,        float *C, int ldc);
 
+void core_ssyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       float alpha, const float *A, int lda,
+                       float beta,        float *C, int ldc);
+
 void core_ssyssq(plasma_enum_t uplo,
                  int n,
                  const float *A, int lda,
@@ -92,6 +259,18 @@ void core_slacpy(plasma_enum_t uplo,
                  const float *A, int lda,
                        float *B, int ldb);
 
+void core_slacpy_stream(int m, int n,
+                        const float *A, int lda,
+                              float *B, int ldb);
+
+void core_slacpy_trans(plasma_enum_t trans,
+                       int m, int n,
+                       const float *A, int lda,
+                             float *B, int ldb);
+
+void core_slacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, float *A, int lda);
+
 void core_slacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
@@ -124,6 +303,12 @@ void core_slantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
                  const float *A, int lda,
                  float *work, float *value);
 
+int core_slarft_group(plasma_enum_t storev, int count, int k, int ib,
+                      const int *l,
+                      float * const *V, const int *ldv,
+                      float * const *Tb, int ldtb,
+                      float *T, int ldt);
+
 void core_slascl(plasma_enum_t uplo,
                  float cfrom, float cto,
                  int m, int n,
@@ -137,10 +322,44 @@ void core_slaset(plasma_enum_t uplo,
 void core_slaswp(plasma_enum_t colrow,
                  plasma_desc_t A, int k1, int k2, const int *ipiv, int incx);
 
+void core_slaswp_cycles(plasma_enum_t colrow,
+                        plasma_desc_t A, const int *cycles, int len,
+                        float *work);
+
 int core_slauum(plasma_enum_t uplo,
                 int n,
                 float *A, int lda);
 
+void core_slrcompress(int m, int n, float tol,
+                      float *A, int lda, int *rank,
+                      float *work);
+
+void core_slrdecompress(int m, int n,
+                        float *A, int lda, int *rank,
+                        float *work);
+
+void core_slrgemm(int m, int n, int k, float tol,
+                  const float *A, int lda, const int *ranka,
+                  const float *B, int ldb, const int *rankb,
+                        float *C, int ldc, int *rankc,
+                  float *work);
+
+void core_slrsyrk(int n, int k,
+                  const float *A, int lda, const int *rank,
+                        float *C, int ldc,
+                  float *work);
+
+void core_slrtrsm(int m, int n,
+                  const float *L, int ldl,
+                        float *A, int lda,
+                  const int *rank);
+
+void core_slumm(int n, float *A, int lda);
+
+void core_spack(plasma_enum_t uplo, int m, int n,
+                const float *A, int lda, int rate,
+                unsigned char *B, int ldb);
+
 int core_spamm(int op, plasma_enum_t side, plasma_enum_t storev,
                int m, int n, int k, int l,
                const float *A1, int lda1,
@@ -157,6 +376,15 @@ int core_sparfb(plasma_enum_t side, plasma_enum_t trans, plasma_enum_t direct,
                 const float *T,    int ldt,
                       float *work, int ldwork);
 
+int core_sparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                      plasma_enum_t storev,
+                      int count, int m1, int n1, const int *l, int k,
+                            float *A1, int lda1,
+                      float * const *A2, const int *lda2,
+                      float * const *V, const int *ldv,
+                      const float *T, int ldt,
+                            float *work, int ldwork);
+
 int core_spemv(plasma_enum_t trans, int storev,
                int m, int n, int l,
                float alpha,
@@ -166,10 +394,56 @@ int core_spemv(plasma_enum_t trans, int storev,
                float *Y, int incy,
                float *work);
 
+#ifdef COMPLEX
+void core_splgsy(float bump,
+                 int m, int n, float *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+#endif
+
+void core_splgsy(float bump,
+                 int m, int n, float *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
+void core_splrnt(int m, int n, float *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
 int core_spotrf(plasma_enum_t uplo,
                 int n,
                 float *A, int lda);
 
+int core_spotrf_team(plasma_enum_t uplo, int n,
+                     float *A, int lda, int ib,
+                     int rank, int size,
+                     int *info, plasma_barrier_t *barrier);
+
+int core_spstrf(plasma_desc_t A, int *piv, float tol,
+                float *diag, float *x,
+                int rank, int size,
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_spttrf_spike(int n, float *d, float *e,
+                      float dl0, float dun,
+                      float *VW);
+
+void core_spttrs(int n, int nrhs,
+                 const float *d, const float *e,
+                 float *B, int ldb);
+
+void core_sptsv_interleaved(int n, int nrhs, int count, int stride,
+                            float *d, float *e,
+                            float *B, int *info);
+
+void core_srepack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *A, int lda, int ratea,
+                  unsigned char *B, int ldb, int rateb);
+
+void core_sssssm(int m2, int n, int k, int ib,
+                       float *A1, int lda1,
+                       float *A2, int lda2,
+                 const float *L1, int ldl1,
+                 const float *L2, int ldl2,
+                 const int *ipiv);
+
 void core_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 float alpha, const float *A, int lda,
@@ -188,6 +462,9 @@ void core_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 float alpha, const float *A, int lda,
                 float beta,        float *C, int ldc);
 
+plasma_enum_t core_stile_structure(int m, int n,
+                                   const float *A, int lda);
+
 int core_stradd(plasma_enum_t uplo, plasma_enum_t transa,
                 int m, int n,
                 float alpha, const float *A, int lda,
@@ -210,6 +487,13 @@ void core_strssq(plasma_enum_t uplo, plasma_enum_t diag,
                  const float *A, int lda,
                  float *scale, float *sumsq);
 
+int core_strsyl(plasma_enum_t transa, plasma_enum_t transb,
+                int isgn, int m, int n,
+                const float *A, int lda,
+                const float *B, int ldb,
+                      float *C, int ldc,
+                float *scale);
+
 int core_strtri(plasma_enum_t uplo, plasma_enum_t diag,
                 int n,
                 float *A, int lda);
@@ -237,6 +521,12 @@ int core_stsmqr(plasma_enum_t side, plasma_enum_t trans,
                 const float *T,    int ldt,
                       float *work, int ldwork);
 
+int core_stpqrt(int m, int n, int l, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *work);
+
 int core_stsqrt(int m, int n, int ib,
                 float *A1, int lda1,
                 float *A2, int lda2,
@@ -244,6 +534,13 @@ int core_stsqrt(int m, int n, int ib,
                 float *tau,
                 float *work);
 
+int core_ststrf(int m, int n, int ib,
+                float *U, int ldu,
+                float *A, int lda,
+                float *L, int ldl,
+                int *ipiv,
+                float *work, int ldwork);
+
 int core_sttlqt(int m, int n, int ib,
                 float *A1, int lda1,
                 float *A2, int lda2,
@@ -288,12 +585,37 @@ int core_sormqr(plasma_enum_t side, plasma_enum_t trans,
                       float *C,    int ldc,
                       float *work, int ldwork);
 
+void core_sunpack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *B, int ldb, int rate,
+                  float *A, int lda);
+
 /******************************************************************************/
 void core_omp_samax(int colrow, int m, int n,
                      const float *A, int lda,
                      float *values,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_schud(plasma_enum_t uplo, int sign, int n, int k,
+                    float *A, int lda,
+                    float *V, int ldv,
+                    float *G, int ldg,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_schudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                     const float *G, int ldg,
+                           float *A, int lda,
+                           float *V, int ldv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgbhrd_q(int n, int kd,
+                       const float *V,
+                       const float *tau,
+                       int jq, int nq,
+                       float *Q, int ldq,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_sgeadd(
     plasma_enum_t transa, int m, int n,
     float alpha, const float *A, int lda,
@@ -303,7 +625,7 @@ void core_omp_sgeadd(
 void core_omp_sgelqt(int m, int n, int ib,
                      float *A, int lda,
                      float *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_sgemm(
@@ -314,10 +636,125 @@ void core_omp_sgemm(
     float beta,        float *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_sgemm_commute(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemm_chain(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int count, int m, int n, const int *k,
+    float alpha, float * const *A, const int *lda,
+                              float * const *B, const int *ldb,
+    float beta,  float *C, int ldc,
+    int prefetch,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemm_nested(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int nb_sub,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemm_device(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                         int m, int n, int k,
+                         float alpha,
+                         const float *A, int lda,
+                         void **P,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void core_omp_sgemm_packed(int m, int n, int k,
+                           void **Ap, void **Bp,
+                           float beta,
+                           float *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_sgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                                int m, int n,
+                                const float *A, int lda,
+                                int slices, void **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
+void core_omp_sgemm_ozaki(int m, int n, int k, int slices,
+                          float alpha, void **A, void **B,
+                          float beta,
+                          float *C, int ldc,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_sgemm_ozaki_free(void **S,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void core_omp_sgemm_emulated(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int slices,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef COMPLEX
+void core_omp_sgemm3m_split(plasma_enum_t trans, int m, int n,
+                            const float *A, int lda,
+                            float **S,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_sgemm3m(int m, int n, int k,
+                      float alpha, float **A, float **B,
+                      float beta, float *C, int ldc,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemm3m_free(float **S,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+#endif
+
+void core_omp_sgemm_samax(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    float *values,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgemmt(
+    plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_sgeqrt(int m, int n, int ib,
                      float *A, int lda,
                      float *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const float *L, int ldl,
+                           float *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_sgessq(int m, int n,
@@ -331,6 +768,41 @@ void core_omp_sgessq_aux(int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_sgetrf_incpiv(int m, int n,
+                            float *A, int lda, int *ipiv,
+                            int iinfo,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_sgetrf_nopiv(int m, int n,
+                           float *A, int lda,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_sgttrf_spike(int n,
+                           float *dl, float *d,
+                           float *du, float *du2,
+                           int *ipiv,
+                           float dl0, float dun,
+                           float *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_sgttrs(int n, int nrhs,
+                     const float *dl, const float *d,
+                     const float *du, const float *du2,
+                     const int *ipiv,
+                     float *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_ssygst(int itype, plasma_enum_t uplo,
+                     int n,
+                           float *A, int lda,
+                     const float *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_ssymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -353,6 +825,20 @@ void core_omp_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                     float beta,        float *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ssyrk_commute(plasma_enum_t uplo, plasma_enum_t trans,
+                            int n, int k,
+                            float alpha, const float *A, int lda,
+                            float beta,        float *C, int ldc,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_ssyrk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           float alpha, const float *A, int lda,
+                           float beta,        float *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_ssyssq(plasma_enum_t uplo,
                      int n,
                      const float *A, int lda,
@@ -377,6 +863,18 @@ void core_omp_slacpy(plasma_enum_t uplo,
                            float *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_slacpy_trans(plasma_enum_t trans,
+                           int m, int n,
+                           const float *A, int lda,
+                                 float *B, int ldb,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_slacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                         int n, float *A, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void core_omp_slacpy_lapack2tile_band(plasma_enum_t uplo,
                                       int it, int jt,
                                       int m, int n, int nb, int kl, int ku,
@@ -442,6 +940,14 @@ void core_omp_slantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_slarft_group(plasma_enum_t storev, int count, int k, int ib,
+                           const int *l,
+                           float * const *V, const int *ldv,
+                           float * const *Tb, int ldtb,
+                           float *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_slascl(plasma_enum_t uplo,
                      float cfrom, float cto,
                      int m, int n,
@@ -460,12 +966,89 @@ void core_omp_slauum(plasma_enum_t uplo,
                      float *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_slrcompress(int m, int n, float tol,
+                          float *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_slrdecompress(int m, int n,
+                            float *A, int lda, int *rank,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_slrgemm(int m, int n, int k, float tol,
+                      const float *A, int lda, const int *ranka,
+                      const float *B, int ldb, const int *rankb,
+                            float *C, int ldc, int *rankc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_slrsyrk(int n, int k,
+                      const float *A, int lda, const int *rank,
+                            float *C, int ldc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_slrtrsm(int m, int n,
+                      const float *L, int ldl,
+                            float *A, int lda,
+                      const int *rank,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_slumm(int n, float *A, int lda,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_spack(plasma_enum_t uplo, int m, int n,
+                    const float *A, int lda, int rate,
+                    unsigned char *B, int ldb,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                           plasma_enum_t storev,
+                           int count, int m1, int n1, const int *l, int k,
+                                 float *A1, int lda1,
+                           float * const *A2, const int *lda2,
+                           float * const *V, const int *ldv,
+                           const float *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_spotrf(plasma_enum_t uplo,
                      int n,
                      float *A, int lda,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_spttrf_spike(int n, float *d, float *e,
+                           float dl0, float dun,
+                           float *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_spttrs(int n, int nrhs,
+                     const float *d, const float *e,
+                     float *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_srepack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *A, int lda, int ratea,
+                      unsigned char *B, int ldb, int rateb,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sssssm(int m2, int n, int k, int ib,
+                           float *A1, int lda1,
+                           float *A2, int lda2,
+                     const float *L1, int ldl1,
+                     const float *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_ssymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -489,6 +1072,19 @@ void core_omp_ssyrk(
     float beta,        float *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ssyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    float alpha, const float *A, int lda,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_stile_structure(int m, int n,
+                              const float *A, int lda,
+                              plasma_enum_t *structure,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void core_omp_stradd(
     plasma_enum_t uplo, plasma_enum_t transa,
     int m, int n,
@@ -518,6 +1114,13 @@ void core_omp_strssq(plasma_enum_t uplo, plasma_enum_t diag,
                      float *scale, float *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_strsyl(plasma_enum_t transa, plasma_enum_t transb,
+                     int isgn, int m, int n,
+                     const float *A, int lda,
+                     const float *B, int ldb,
+                           float *C, int ldc,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_strtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int n,
                      float *A, int lda,
@@ -556,6 +1159,15 @@ void core_omp_stsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ststrf(int m, int n, int ib,
+                     float *U, int ldu,
+                     float *A, int lda,
+                     float *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_sttlqt(int m, int n, int ib,
                      float *A1, int lda1,
                      float *A2, int lda2,
@@ -604,6 +1216,11 @@ void core_omp_sormqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_sunpack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *B, int ldb, int rate,
+                      float *A, int lda,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 #undef REAL
 
 #ifdef __cplusplus
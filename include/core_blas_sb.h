@@ -0,0 +1,52 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_CORE_BLAS_SB_H
+#define ICL_CORE_BLAS_SB_H
+
+#include "plasma_async.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void core_slag2bf(int m, int n,
+                  const float *A, int lda,
+                  plasma_bfloat16_t *Ab, int ldab);
+
+void core_sbgemm(plasma_enum_t transa, plasma_enum_t transb,
+                 int m, int n, int k,
+                 float alpha, const plasma_bfloat16_t *A, int lda,
+                              const plasma_bfloat16_t *B, int ldb,
+                 float beta,        float *C, int ldc,
+                 float *work);
+
+/******************************************************************************/
+void core_omp_slag2bf(int m, int n,
+                      const float *A, int lda,
+                      plasma_bfloat16_t *Ab, int ldab,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_sbgemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const plasma_bfloat16_t *A, int lda,
+                 const plasma_bfloat16_t *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_CORE_BLAS_SB_H
@@ -30,6 +30,48 @@ extern "C" {
 double core_dcabs1(plasma_complex64_t alpha);
 #endif
 
+void core_dzamax(int colrow, int m, int n,
+                 const plasma_complex64_t *A, int lda,
+                 double *values);
+
+int core_izamax(int n, const plasma_complex64_t *x, double *max);
+
+int core_zgetrf_column(int m, int scale, plasma_complex64_t pivot,
+                       double sfmin, plasma_complex64_t *x,
+                       plasma_complex64_t u, plasma_complex64_t *y,
+                       double *max);
+
+int core_zchud(plasma_enum_t uplo, int sign, int n, int k,
+               plasma_complex64_t *A, int lda,
+               plasma_complex64_t *V, int ldv,
+               plasma_complex64_t *G, int ldg);
+
+int core_zchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                const plasma_complex64_t *G, int ldg,
+                      plasma_complex64_t *A, int lda,
+                      plasma_complex64_t *V, int ldv);
+
+int core_zgbsv(int n, int kl, int ku, int nrhs,
+               plasma_complex64_t *AB, int ldab, int *ipiv,
+               plasma_complex64_t *B, int ldb);
+
+void core_zgbsv_interleaved(int n, int kl, int ku, int nrhs,
+                            int count, int stride,
+                            plasma_complex64_t *AB, int ldab, int *ipiv,
+                            plasma_complex64_t *B, int *info);
+
+void core_zgbhrd(int n, int kd,
+                 plasma_complex64_t *A, int lda,
+                 plasma_complex64_t *V, plasma_complex64_t *tau,
+                 plasma_complex64_t *work,
+                 int rank, int size, plasma_barrier_t *barrier);
+
+void core_zgbhrd_q(int n, int kd,
+                   const plasma_complex64_t *V, const plasma_complex64_t *tau,
+                   int jq, int nq,
+                   plasma_complex64_t *Q, int ldq,
+                   plasma_complex64_t *work);
+
 int core_zgeadd(plasma_enum_t transa,
                 int m, int n,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -47,18 +89,138 @@ void core_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                                           const plasma_complex64_t *B, int ldb,
                 plasma_complex64_t beta,        plasma_complex64_t *C, int ldc);
 
+void core_zgemm_jit_finalize(void);
+
+void core_zgemm_device(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex64_t alpha,
+                       const plasma_complex64_t *A, int lda,
+                       const plasma_complex64_t *B, int ldb,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t *C, int ldc);
+
+size_t core_zgemm_pack_size(plasma_enum_t side, int m, int n, int k);
+
+void core_zgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                     int m, int n, int k,
+                     plasma_complex64_t alpha,
+                     const plasma_complex64_t *A, int lda,
+                     void *P);
+
+void core_zgemm_packed(int m, int n, int k,
+                       const void *Ap, const void *Bp,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t *C, int ldc);
+
+size_t core_zgemm_ozaki_split_size(plasma_enum_t side, int m, int n,
+                                   int slices);
+
+void core_zgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                            int m, int n,
+                            const plasma_complex64_t *A, int lda,
+                            int slices, void *S);
+
+void core_zgemm_ozaki(int m, int n, int k, int slices,
+                      plasma_complex64_t alpha, const void *A, const void *B,
+                      plasma_complex64_t beta, plasma_complex64_t *C, int ldc);
+
+int core_zgemm_emulated(plasma_enum_t transa, plasma_enum_t transb,
+                        int m, int n, int k, int slices,
+                        plasma_complex64_t alpha,
+                        const plasma_complex64_t *A, int lda,
+                        const plasma_complex64_t *B, int ldb,
+                        plasma_complex64_t beta,
+                        plasma_complex64_t *C, int ldc);
+
+#ifdef COMPLEX
+size_t core_zgemm3m_split_size(int m, int n);
+
+void core_zgemm3m_split(plasma_enum_t trans, int m, int n,
+                        const plasma_complex64_t *A, int lda,
+                        double *S);
+
+void core_zgemm3m(int m, int n, int k,
+                  plasma_complex64_t alpha, const double *A, const double *B,
+                  plasma_complex64_t beta, plasma_complex64_t *C, int ldc,
+                  double *work);
+#endif
+
+void core_zgemmt(plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t transb,
+                 int n, int k,
+                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                           const plasma_complex64_t *B, int ldb,
+                 plasma_complex64_t beta,        plasma_complex64_t *C, int ldc);
+
 int core_zgeqrt(int m, int n, int ib,
                 plasma_complex64_t *A, int lda,
                 plasma_complex64_t *T, int ldt,
                 plasma_complex64_t *tau,
                 plasma_complex64_t *work);
 
+int core_zgeqrt_panel(plasma_desc_t A, plasma_desc_t T, int ib,
+                      int rank, int size,
+                      plasma_complex64_t *work, plasma_barrier_t *barrier);
+
+void core_zgerbt(plasma_enum_t side, plasma_enum_t trans,
+                 int m1, int n1, int m2, int n2,
+                 plasma_complex64_t *A1, int lda1,
+                 plasma_complex64_t *A2, int lda2,
+                 const double *u1, const double *u2);
+
+void core_zgessm(int m, int n, int k,
+                 const int *ipiv,
+                 const plasma_complex64_t *L, int ldl,
+                       plasma_complex64_t *A, int lda);
+
 void core_zgessq(int m, int n,
                  const plasma_complex64_t *A, int lda,
                  double *scale, double *sumsq);
 
 int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier);
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_zgetrf_rec(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                    plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_zgetrf_incpiv(int m, int n,
+                       plasma_complex64_t *A, int lda, int *ipiv);
+
+int core_zgetrf_nopiv(int m, int n, plasma_complex64_t *A, int lda);
+
+int core_zgetrf_tntpiv_leaf(int m, int n,
+                            const plasma_complex64_t *A, int lda, int row0,
+                            plasma_complex64_t *C, int ldc, int *rows,
+                            plasma_complex64_t *W, int *iwork);
+
+int core_zgetrf_tntpiv_merge(int n,
+                             plasma_complex64_t *C1, int *rows1, int c1,
+                             const plasma_complex64_t *C2, const int *rows2,
+                             int c2, int ldc,
+                             plasma_complex64_t *W, int *iwork);
+
+int core_zgttrf_spike(int n,
+                      plasma_complex64_t *dl, plasma_complex64_t *d,
+                      plasma_complex64_t *du, plasma_complex64_t *du2,
+                      int *ipiv,
+                      plasma_complex64_t dl0, plasma_complex64_t dun,
+                      plasma_complex64_t *VW);
+
+void core_zgttrs(int n, int nrhs,
+                 const plasma_complex64_t *dl, const plasma_complex64_t *d,
+                 const plasma_complex64_t *du, const plasma_complex64_t *du2,
+                 const int *ipiv,
+                 plasma_complex64_t *B, int ldb);
+
+void core_zgtsv_interleaved(int n, int nrhs, int count, int stride,
+                            plasma_complex64_t *dl, plasma_complex64_t *d,
+                            plasma_complex64_t *du, plasma_complex64_t *B,
+                            int *info);
+
+int core_zhegst(int itype, plasma_enum_t uplo,
+                int n,
+                      plasma_complex64_t *A, int lda,
+                const plasma_complex64_t *B, int ldb);
 
 void core_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
@@ -77,6 +239,11 @@ void core_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                 double alpha, const plasma_complex64_t *A, int lda,
                 double beta,        plasma_complex64_t *C, int ldc);
 
+void core_zherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                       int n, int k,
+                       double alpha, const plasma_complex64_t *A, int lda,
+                       double beta,        plasma_complex64_t *C, int ldc);
+
 void core_zhessq(plasma_enum_t uplo,
                  int n,
                  const plasma_complex64_t *A, int lda,
@@ -92,6 +259,18 @@ void core_zlacpy(plasma_enum_t uplo,
                  const plasma_complex64_t *A, int lda,
                        plasma_complex64_t *B, int ldb);
 
+void core_zlacpy_stream(int m, int n,
+                        const plasma_complex64_t *A, int lda,
+                              plasma_complex64_t *B, int ldb);
+
+void core_zlacpy_trans(plasma_enum_t trans,
+                       int m, int n,
+                       const plasma_complex64_t *A, int lda,
+                             plasma_complex64_t *B, int ldb);
+
+void core_zlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, plasma_complex64_t *A, int lda);
+
 void core_zlacpy_lapack2tile_band(plasma_enum_t uplo,
                                   int it, int jt,
                                   int m, int n, int nb, int kl, int ku,
@@ -124,6 +303,12 @@ void core_zlantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
                  const plasma_complex64_t *A, int lda,
                  double *work, double *value);
 
+int core_zlarft_group(plasma_enum_t storev, int count, int k, int ib,
+                      const int *l,
+                      plasma_complex64_t * const *V, const int *ldv,
+                      plasma_complex64_t * const *Tb, int ldtb,
+                      plasma_complex64_t *T, int ldt);
+
 void core_zlascl(plasma_enum_t uplo,
                  double cfrom, double cto,
                  int m, int n,
@@ -137,10 +322,44 @@ void core_zlaset(plasma_enum_t uplo,
 void core_zlaswp(plasma_enum_t colrow,
                  plasma_desc_t A, int k1, int k2, const int *ipiv, int incx);
 
+void core_zlaswp_cycles(plasma_enum_t colrow,
+                        plasma_desc_t A, const int *cycles, int len,
+                        plasma_complex64_t *work);
+
 int core_zlauum(plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda);
 
+void core_zlrcompress(int m, int n, double tol,
+                      plasma_complex64_t *A, int lda, int *rank,
+                      plasma_complex64_t *work);
+
+void core_zlrdecompress(int m, int n,
+                        plasma_complex64_t *A, int lda, int *rank,
+                        plasma_complex64_t *work);
+
+void core_zlrgemm(int m, int n, int k, double tol,
+                  const plasma_complex64_t *A, int lda, const int *ranka,
+                  const plasma_complex64_t *B, int ldb, const int *rankb,
+                        plasma_complex64_t *C, int ldc, int *rankc,
+                  plasma_complex64_t *work);
+
+void core_zlrherk(int n, int k,
+                  const plasma_complex64_t *A, int lda, const int *rank,
+                        plasma_complex64_t *C, int ldc,
+                  plasma_complex64_t *work);
+
+void core_zlrtrsm(int m, int n,
+                  const plasma_complex64_t *L, int ldl,
+                        plasma_complex64_t *A, int lda,
+                  const int *rank);
+
+void core_zlumm(int n, plasma_complex64_t *A, int lda);
+
+void core_zpack(plasma_enum_t uplo, int m, int n,
+                const plasma_complex64_t *A, int lda, int rate,
+                unsigned char *B, int ldb);
+
 int core_zpamm(int op, plasma_enum_t side, plasma_enum_t storev,
                int m, int n, int k, int l,
                const plasma_complex64_t *A1, int lda1,
@@ -157,6 +376,15 @@ int core_zparfb(plasma_enum_t side, plasma_enum_t trans, plasma_enum_t direct,
                 const plasma_complex64_t *T,    int ldt,
                       plasma_complex64_t *work, int ldwork);
 
+int core_zparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                      plasma_enum_t storev,
+                      int count, int m1, int n1, const int *l, int k,
+                            plasma_complex64_t *A1, int lda1,
+                      plasma_complex64_t * const *A2, const int *lda2,
+                      plasma_complex64_t * const *V, const int *ldv,
+                      const plasma_complex64_t *T, int ldt,
+                            plasma_complex64_t *work, int ldwork);
+
 int core_zpemv(plasma_enum_t trans, int storev,
                int m, int n, int l,
                plasma_complex64_t alpha,
@@ -166,10 +394,56 @@ int core_zpemv(plasma_enum_t trans, int storev,
                plasma_complex64_t *Y, int incy,
                plasma_complex64_t *work);
 
+#ifdef COMPLEX
+void core_zplghe(double bump,
+                 int m, int n, plasma_complex64_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+#endif
+
+void core_zplgsy(plasma_complex64_t bump,
+                 int m, int n, plasma_complex64_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
+void core_zplrnt(int m, int n, plasma_complex64_t *A, int lda,
+                 int bigm, int m0, int n0, unsigned long long seed);
+
 int core_zpotrf(plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda);
 
+int core_zpotrf_team(plasma_enum_t uplo, int n,
+                     plasma_complex64_t *A, int lda, int ib,
+                     int rank, int size,
+                     int *info, plasma_barrier_t *barrier);
+
+int core_zpstrf(plasma_desc_t A, int *piv, double tol,
+                double *diag, plasma_complex64_t *x,
+                int rank, int size,
+                plasma_panel_workspace_t *work, plasma_barrier_t *barrier);
+
+int core_zpttrf_spike(int n, double *d, plasma_complex64_t *e,
+                      plasma_complex64_t dl0, plasma_complex64_t dun,
+                      plasma_complex64_t *VW);
+
+void core_zpttrs(int n, int nrhs,
+                 const double *d, const plasma_complex64_t *e,
+                 plasma_complex64_t *B, int ldb);
+
+void core_zptsv_interleaved(int n, int nrhs, int count, int stride,
+                            double *d, plasma_complex64_t *e,
+                            plasma_complex64_t *B, int *info);
+
+void core_zrepack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *A, int lda, int ratea,
+                  unsigned char *B, int ldb, int rateb);
+
+void core_zssssm(int m2, int n, int k, int ib,
+                       plasma_complex64_t *A1, int lda1,
+                       plasma_complex64_t *A2, int lda2,
+                 const plasma_complex64_t *L1, int ldl1,
+                 const plasma_complex64_t *L2, int ldl2,
+                 const int *ipiv);
+
 void core_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -188,6 +462,9 @@ void core_zsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
                 plasma_complex64_t beta,        plasma_complex64_t *C, int ldc);
 
+plasma_enum_t core_ztile_structure(int m, int n,
+                                   const plasma_complex64_t *A, int lda);
+
 int core_ztradd(plasma_enum_t uplo, plasma_enum_t transa,
                 int m, int n,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -210,6 +487,13 @@ void core_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
                  const plasma_complex64_t *A, int lda,
                  double *scale, double *sumsq);
 
+int core_ztrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                int isgn, int m, int n,
+                const plasma_complex64_t *A, int lda,
+                const plasma_complex64_t *B, int ldb,
+                      plasma_complex64_t *C, int ldc,
+                double *scale);
+
 int core_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                 int n,
                 plasma_complex64_t *A, int lda);
@@ -237,6 +521,12 @@ int core_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                 const plasma_complex64_t *T,    int ldt,
                       plasma_complex64_t *work, int ldwork);
 
+int core_ztpqrt(int m, int n, int l, int ib,
+                plasma_complex64_t *A1, int lda1,
+                plasma_complex64_t *A2, int lda2,
+                plasma_complex64_t *T,  int ldt,
+                plasma_complex64_t *work);
+
 int core_ztsqrt(int m, int n, int ib,
                 plasma_complex64_t *A1, int lda1,
                 plasma_complex64_t *A2, int lda2,
@@ -244,6 +534,13 @@ int core_ztsqrt(int m, int n, int ib,
                 plasma_complex64_t *tau,
                 plasma_complex64_t *work);
 
+int core_ztstrf(int m, int n, int ib,
+                plasma_complex64_t *U, int ldu,
+                plasma_complex64_t *A, int lda,
+                plasma_complex64_t *L, int ldl,
+                int *ipiv,
+                plasma_complex64_t *work, int ldwork);
+
 int core_zttlqt(int m, int n, int ib,
                 plasma_complex64_t *A1, int lda1,
                 plasma_complex64_t *A2, int lda2,
@@ -288,12 +585,37 @@ int core_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                       plasma_complex64_t *C,    int ldc,
                       plasma_complex64_t *work, int ldwork);
 
+void core_zunpack(plasma_enum_t uplo, int m, int n,
+                  const unsigned char *B, int ldb, int rate,
+                  plasma_complex64_t *A, int lda);
+
 /******************************************************************************/
 void core_omp_dzamax(int colrow, int m, int n,
                      const plasma_complex64_t *A, int lda,
                      double *values,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zchud(plasma_enum_t uplo, int sign, int n, int k,
+                    plasma_complex64_t *A, int lda,
+                    plasma_complex64_t *V, int ldv,
+                    plasma_complex64_t *G, int ldg,
+                    int iinfo,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zchudm(plasma_enum_t uplo, int sign, int m, int n, int k,
+                     const plasma_complex64_t *G, int ldg,
+                           plasma_complex64_t *A, int lda,
+                           plasma_complex64_t *V, int ldv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgbhrd_q(int n, int kd,
+                       const plasma_complex64_t *V,
+                       const plasma_complex64_t *tau,
+                       int jq, int nq,
+                       plasma_complex64_t *Q, int ldq,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_zgeadd(
     plasma_enum_t transa, int m, int n,
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -303,7 +625,7 @@ void core_omp_zgeadd(
 void core_omp_zgelqt(int m, int n, int ib,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zgemm(
@@ -314,10 +636,125 @@ void core_omp_zgemm(
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zgemm_commute(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemm_chain(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int count, int m, int n, const int *k,
+    plasma_complex64_t alpha, plasma_complex64_t * const *A, const int *lda,
+                              plasma_complex64_t * const *B, const int *ldb,
+    plasma_complex64_t beta,  plasma_complex64_t *C, int ldc,
+    int prefetch,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemm_nested(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int nb_sub,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemm_device(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemm_pack(plasma_enum_t side, plasma_enum_t trans,
+                         int m, int n, int k,
+                         plasma_complex64_t alpha,
+                         const plasma_complex64_t *A, int lda,
+                         void **P,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void core_omp_zgemm_packed(int m, int n, int k,
+                           void **Ap, void **Bp,
+                           plasma_complex64_t beta,
+                           plasma_complex64_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_zgemm_ozaki_split(plasma_enum_t side, plasma_enum_t trans,
+                                int m, int n,
+                                const plasma_complex64_t *A, int lda,
+                                int slices, void **S,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
+void core_omp_zgemm_ozaki(int m, int n, int k, int slices,
+                          plasma_complex64_t alpha, void **A, void **B,
+                          plasma_complex64_t beta,
+                          plasma_complex64_t *C, int ldc,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_zgemm_ozaki_free(void **S,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void core_omp_zgemm_emulated(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k, int slices,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef COMPLEX
+void core_omp_zgemm3m_split(plasma_enum_t trans, int m, int n,
+                            const plasma_complex64_t *A, int lda,
+                            double **S,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_zgemm3m(int m, int n, int k,
+                      plasma_complex64_t alpha, double **A, double **B,
+                      plasma_complex64_t beta, plasma_complex64_t *C, int ldc,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemm3m_free(double **S,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+#endif
+
+void core_omp_zgemm_dzamax(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    double *values,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgemmt(
+    plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t transb,
+    int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_zgeqrt(int m, int n, int ib,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *T, int ldt,
-                     plasma_workspace_t work,
+                     plasma_workspace_t work, int num_blas_threads,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zgessm(int m, int n, int k,
+                     const int *ipiv,
+                     const plasma_complex64_t *L, int ldl,
+                           plasma_complex64_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zgessq(int m, int n,
@@ -331,6 +768,41 @@ void core_omp_zgessq_aux(int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_zgetrf_incpiv(int m, int n,
+                            plasma_complex64_t *A, int lda, int *ipiv,
+                            int iinfo,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_zgetrf_nopiv(int m, int n,
+                           plasma_complex64_t *A, int lda,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_zgttrf_spike(int n,
+                           plasma_complex64_t *dl, plasma_complex64_t *d,
+                           plasma_complex64_t *du, plasma_complex64_t *du2,
+                           int *ipiv,
+                           plasma_complex64_t dl0, plasma_complex64_t dun,
+                           plasma_complex64_t *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_zgttrs(int n, int nrhs,
+                     const plasma_complex64_t *dl, const plasma_complex64_t *d,
+                     const plasma_complex64_t *du, const plasma_complex64_t *du2,
+                     const int *ipiv,
+                     plasma_complex64_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zhegst(int itype, plasma_enum_t uplo,
+                     int n,
+                           plasma_complex64_t *A, int lda,
+                     const plasma_complex64_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_zhemm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -353,6 +825,20 @@ void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                     double beta,        plasma_complex64_t *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zherk_commute(plasma_enum_t uplo, plasma_enum_t trans,
+                            int n, int k,
+                            double alpha, const plasma_complex64_t *A, int lda,
+                            double beta,        plasma_complex64_t *C, int ldc,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_zherk_device(plasma_enum_t uplo, plasma_enum_t trans,
+                           int n, int k,
+                           double alpha, const plasma_complex64_t *A, int lda,
+                           double beta,        plasma_complex64_t *C, int ldc,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_zhessq(plasma_enum_t uplo,
                      int n,
                      const plasma_complex64_t *A, int lda,
@@ -377,6 +863,18 @@ void core_omp_zlacpy(plasma_enum_t uplo,
                            plasma_complex64_t *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zlacpy_trans(plasma_enum_t trans,
+                           int m, int n,
+                           const plasma_complex64_t *A, int lda,
+                                 plasma_complex64_t *B, int ldb,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_zlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                         int n, plasma_complex64_t *A, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void core_omp_zlacpy_lapack2tile_band(plasma_enum_t uplo,
                                       int it, int jt,
                                       int m, int n, int nb, int kl, int ku,
@@ -442,6 +940,14 @@ void core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void core_omp_zlarft_group(plasma_enum_t storev, int count, int k, int ib,
+                           const int *l,
+                           plasma_complex64_t * const *V, const int *ldv,
+                           plasma_complex64_t * const *Tb, int ldtb,
+                           plasma_complex64_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_zlascl(plasma_enum_t uplo,
                      double cfrom, double cto,
                      int m, int n,
@@ -460,12 +966,89 @@ void core_omp_zlauum(plasma_enum_t uplo,
                      plasma_complex64_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zlrcompress(int m, int n, double tol,
+                          plasma_complex64_t *A, int lda, int *rank,
+                          plasma_workspace_t work,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void core_omp_zlrdecompress(int m, int n,
+                            plasma_complex64_t *A, int lda, int *rank,
+                            plasma_workspace_t work,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void core_omp_zlrgemm(int m, int n, int k, double tol,
+                      const plasma_complex64_t *A, int lda, const int *ranka,
+                      const plasma_complex64_t *B, int ldb, const int *rankb,
+                            plasma_complex64_t *C, int ldc, int *rankc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_zlrherk(int n, int k,
+                      const plasma_complex64_t *A, int lda, const int *rank,
+                            plasma_complex64_t *C, int ldc,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_zlrtrsm(int m, int n,
+                      const plasma_complex64_t *L, int ldl,
+                            plasma_complex64_t *A, int lda,
+                      const int *rank,
+                      plasma_sequence_t *sequence,
+                      plasma_request_t *request);
+
+void core_omp_zlumm(int n, plasma_complex64_t *A, int lda,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zpack(plasma_enum_t uplo, int m, int n,
+                    const plasma_complex64_t *A, int lda, int rate,
+                    unsigned char *B, int ldb,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zparfb_group(plasma_enum_t side, plasma_enum_t trans,
+                           plasma_enum_t storev,
+                           int count, int m1, int n1, const int *l, int k,
+                                 plasma_complex64_t *A1, int lda1,
+                           plasma_complex64_t * const *A2, const int *lda2,
+                           plasma_complex64_t * const *V, const int *ldv,
+                           const plasma_complex64_t *T, int ldt,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void core_omp_zpotrf(plasma_enum_t uplo,
                      int n,
                      plasma_complex64_t *A, int lda,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zpttrf_spike(int n, double *d, plasma_complex64_t *e,
+                           plasma_complex64_t dl0, plasma_complex64_t dun,
+                           plasma_complex64_t *VW,
+                           int iinfo,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_zpttrs(int n, int nrhs,
+                     const double *d, const plasma_complex64_t *e,
+                     plasma_complex64_t *B, int ldb,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zrepack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *A, int lda, int ratea,
+                      unsigned char *B, int ldb, int rateb,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zssssm(int m2, int n, int k, int ib,
+                           plasma_complex64_t *A1, int lda1,
+                           plasma_complex64_t *A2, int lda2,
+                     const plasma_complex64_t *L1, int ldl1,
+                     const plasma_complex64_t *L2, int ldl2,
+                     const int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_zsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -489,6 +1072,19 @@ void core_omp_zsyrk(
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zsyrk_commute(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_ztile_structure(int m, int n,
+                              const plasma_complex64_t *A, int lda,
+                              plasma_enum_t *structure,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void core_omp_ztradd(
     plasma_enum_t uplo, plasma_enum_t transa,
     int m, int n,
@@ -518,6 +1114,13 @@ void core_omp_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      double *scale, double *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ztrsyl(plasma_enum_t transa, plasma_enum_t transb,
+                     int isgn, int m, int n,
+                     const plasma_complex64_t *A, int lda,
+                     const plasma_complex64_t *B, int ldb,
+                           plasma_complex64_t *C, int ldc,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                      int n,
                      plasma_complex64_t *A, int lda,
@@ -556,6 +1159,15 @@ void core_omp_ztsqrt(int m, int n, int ib,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_ztstrf(int m, int n, int ib,
+                     plasma_complex64_t *U, int ldu,
+                     plasma_complex64_t *A, int lda,
+                     plasma_complex64_t *L, int ldl,
+                     int *ipiv,
+                     plasma_workspace_t work,
+                     int iinfo,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 void core_omp_zttlqt(int m, int n, int ib,
                      plasma_complex64_t *A1, int lda1,
                      plasma_complex64_t *A2, int lda2,
@@ -604,6 +1216,11 @@ void core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                      plasma_workspace_t work,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zunpack(plasma_enum_t uplo, int m, int n,
+                      const unsigned char *B, int ldb, int rate,
+                      plasma_complex64_t *A, int lda,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 #undef COMPLEX
 
 #ifdef __cplusplus
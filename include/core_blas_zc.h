@@ -29,6 +29,38 @@ void core_clag2z(int m, int n,
                  plasma_complex32_t *As, int ldas,
                  plasma_complex64_t *A,  int lda);
 
+void core_zlag2c_inplace(int m, int n, plasma_complex64_t *A, int lda);
+
+void core_zlacpy_lag2c(int m, int n,
+                       const plasma_complex64_t *A,  int lda,
+                             plasma_complex64_t *B,  int ldb,
+                             plasma_complex32_t *As, int ldas);
+
+void core_clag2z_inplace(int m, int n, plasma_complex64_t *A, int lda);
+
+void core_zcgemm(plasma_enum_t transa, plasma_enum_t transb,
+                 int m, int n, int k,
+                 plasma_complex64_t alpha,
+                 const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+                 const plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+                 plasma_complex64_t beta,
+                       plasma_complex64_t *C, plasma_enum_t precc, int ldc,
+                 plasma_complex64_t *work);
+
+void core_zcherk(plasma_enum_t uplo, plasma_enum_t trans,
+                 int n, int k,
+                 double alpha,
+                 const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+                 double beta, plasma_complex64_t *C, int ldc,
+                 plasma_complex64_t *work);
+
+void core_zctrsm(plasma_enum_t side, plasma_enum_t uplo,
+                 plasma_enum_t transa, plasma_enum_t diag,
+                 int m, int n,
+                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                       plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+                 plasma_complex64_t *work);
+
 /******************************************************************************/
 void core_omp_zlag2c(int m, int n,
                      plasma_complex64_t *A,  int lda,
@@ -40,6 +72,49 @@ void core_omp_clag2z(int m, int n,
                      plasma_complex64_t *A,  int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zlag2c_inplace(int m, int n, plasma_complex64_t *A, int lda,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void core_omp_zlacpy_lag2c(int m, int n,
+                           const plasma_complex64_t *A,  int lda,
+                                 plasma_complex64_t *B,  int ldb,
+                                 plasma_complex32_t *As, int ldas,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void core_omp_clag2z_inplace(int m, int n, plasma_complex64_t *A, int lda,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void core_omp_zcgemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha,
+    const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+    const plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+    plasma_complex64_t beta,
+          plasma_complex64_t *C, plasma_enum_t precc, int ldc,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zcherk(plasma_enum_t uplo, plasma_enum_t trans,
+                     int n, int k,
+                     double alpha,
+                     const plasma_complex64_t *A, plasma_enum_t preca, int lda,
+                     double beta, plasma_complex64_t *C, int ldc,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_omp_zctrsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+          plasma_complex64_t *B, plasma_enum_t precb, int ldb,
+    plasma_workspace_t work,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -13,6 +13,11 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_context.h"
+#include "plasma_graph.h"
+#include "plasma_predict.h"
+#include "plasma_session.h"
+#include "plasma_trace.h"
+#include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
 #include "plasma_s.h"
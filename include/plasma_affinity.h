@@ -0,0 +1,44 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_AFFINITY_H
+#define ICL_PLASMA_AFFINITY_H
+
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    Pinning of the threads to the CPUs the process may run on, numbered
+    from 0 in the order of the affinity mask of the process at
+    plasma_init(), for the PlasmaThreadBind and PlasmaPanelBind policies:
+    - PlasmaBindNone:   left to the runtime, OMP_PLACES and OMP_PROC_BIND,
+    - PlasmaBindClose:  rank r on CPU first+r, compactly,
+    - PlasmaBindSpread: the ranks spread evenly over the CPUs, from first.
+    - PlasmaBindFast:   as PlasmaBindClose, the fast cores of a hybrid CPU
+                        numbered first; for the panel teams, the ranks and
+                        the calling thread on any of the fast cores.
+    Does nothing where the affinity of a thread cannot be set.
+*/
+void plasma_affinity_init();
+int  plasma_affinity_num_cpus();
+int  plasma_affinity_num_fast_cpus();
+int  plasma_affinity_self();
+void plasma_affinity_bind(plasma_enum_t bind, int first, int rank, int size);
+void plasma_affinity_team(plasma_enum_t bind, int first, int size);
+void plasma_affinity_fast_enter();
+void plasma_affinity_fast_leave();
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_AFFINITY_H
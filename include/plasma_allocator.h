@@ -0,0 +1,56 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_ALLOCATOR_H
+#define ICL_PLASMA_ALLOCATOR_H
+
+#include "plasma_types.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+enum {
+    PlasmaAlignment    = 64,         ///< alignment of aligned storage in bytes
+    PlasmaHugePageSize = 2*1024*1024 ///< size of a transparent huge page
+};
+
+/// User allocation callback. Must be thread safe.
+typedef void *(*plasma_alloc_t)(size_t size);
+
+/// User deallocation callback, given the size of the allocation.
+typedef void (*plasma_dealloc_t)(void *ptr, size_t size);
+
+typedef struct {
+    plasma_enum_t kind;       ///< PlasmaAllocator
+    plasma_alloc_t alloc;     ///< user allocation callback
+    plasma_dealloc_t dealloc; ///< user deallocation callback
+} plasma_allocator_t;
+
+/******************************************************************************/
+void *plasma_allocator_alloc(plasma_allocator_t *allocator, size_t size);
+void *plasma_allocator_alloc_zero(plasma_allocator_t *allocator, size_t size);
+void plasma_allocator_free(plasma_allocator_t *allocator,
+                           void *ptr, size_t size);
+
+void *plasma_allocator_map_file(const char *path, size_t size);
+void plasma_allocator_unmap_file(void *ptr, size_t size);
+void plasma_allocator_prefetch(void *ptr, size_t size);
+
+void *plasma_allocator_reserve(size_t size);
+void plasma_allocator_release(void *ptr, size_t size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_ALLOCATOR_H
@@ -12,6 +12,8 @@
 
 #include "plasma_types.h"
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,10 +25,52 @@ typedef struct {
 
 static const plasma_request_t PlasmaRequestInitializer = {PlasmaSuccess};
 
-typedef struct {
+typedef struct plasma_sequence_s plasma_sequence_t;
+
+typedef void (*plasma_sequence_callback_t)(plasma_sequence_t *sequence,
+                                           void *arg);
+
+struct plasma_sequence_s {
     plasma_enum_t status;      ///< error code
     plasma_request_t *request; ///< failed request
-} plasma_sequence_t;
+    int complete;              ///< set once all the tasks have completed
+    plasma_sequence_callback_t callback; ///< called on completion
+    void *callback_arg;        ///< argument of the callback
+    plasma_enum_t priority;    ///< PlasmaPriorityNormal or PlasmaPriorityUrgent
+};
+
+// A sequence on the stack, in place of plasma_sequence_create(), for the
+// calls that wait for their tasks before returning.
+static const plasma_sequence_t PlasmaSequenceInitializer =
+    {PlasmaSuccess, NULL, 0, NULL, NULL, PlasmaPriorityNormal};
+
+/******************************************************************************/
+// The OpenMP task priority of the tasks of the sequence. The urgent class
+// is above the priorities of 1 and 2 that the factorizations give to their
+// panels, so that the tasks of an urgent sequence overtake those of the
+// normal ones submitted into the same parallel region, e.g., through
+// plasma_sequence_run(). Effective when OMP_MAX_TASK_PRIORITY >= 5.
+static inline int plasma_sequence_priority(const plasma_sequence_t *sequence)
+{
+    return sequence->priority == PlasmaPriorityUrgent ? 3 : 0;
+}
+
+/******************************************************************************/
+// Discards the remaining tasks of the innermost taskgroup, e.g., the one of
+// plasma_sequence_run(), once the sequence has failed, instead of scheduling
+// them only to skip their kernels. Used at the end of the task constructs
+// that may fail the sequence; active with OMP_CANCELLATION=true.
+// OpenMP requires the taskgroup, so the synchronous drivers open one in
+// their master region. A discarded task does not run at all, so the
+// buffers of the tasks are freed after a taskwait, at the latest.
+// OmpSs-2 has no cancellation; the tasks only skip their kernels.
+#define PLASMA_PRAGMA(x) _Pragma(#x)
+#if defined(PLASMA_WITH_OMPSS2)
+#define PLASMA_SEQUENCE_CANCEL(sequence)
+#else
+#define PLASMA_SEQUENCE_CANCEL(sequence) \
+    PLASMA_PRAGMA(omp cancel taskgroup if ((sequence)->status != PlasmaSuccess))
+#endif
 
 /******************************************************************************/
 int plasma_request_fail(plasma_sequence_t *sequence,
@@ -36,6 +80,18 @@ int plasma_request_fail(plasma_sequence_t *sequence,
 int plasma_sequence_create(plasma_sequence_t **sequence);
 int plasma_sequence_destroy(plasma_sequence_t *sequence);
 
+int plasma_sequence_set_callback(plasma_sequence_t *sequence,
+                                 plasma_sequence_callback_t callback,
+                                 void *arg);
+int plasma_sequence_set_priority(plasma_sequence_t *sequence,
+                                 plasma_enum_t priority);
+int plasma_sequence_run(plasma_sequence_t *sequence,
+                        void (*body)(plasma_sequence_t *sequence, void *arg),
+                        void *arg);
+int plasma_sequence_complete(plasma_sequence_t *sequence);
+int plasma_sequence_test(plasma_sequence_t *sequence);
+int plasma_sequence_wait(plasma_sequence_t *sequence);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
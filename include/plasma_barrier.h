@@ -10,20 +10,82 @@
 #ifndef ICL_PLASMA_BARRIER_H
 #define ICL_PLASMA_BARRIER_H
 
+#include "plasma_types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/******************************************************************************/
+enum {
+    PlasmaBarrierMaxSize   = 128, ///< threads of the dissemination barrier
+    PlasmaBarrierMaxRounds = 7    ///< log2(PlasmaBarrierMaxSize)
+};
+
+/***************************************************************************//**
+    Flags of one thread of the dissemination barrier, on their own cache
+    line. flag[r] is the last episode signaled to the thread in round r,
+    by a single other thread.
+*/
+typedef union {
+    struct {
+        volatile int flag[PlasmaBarrierMaxRounds];
+        unsigned episode;       ///< episodes passed by the thread
+        volatile int sleeping;  ///< 1 while the thread waits in the kernel
+    } s;
+    char pad[64];
+} plasma_barrier_slot_t;
+
+/***************************************************************************//**
+    Barrier of the threads of a multithreaded panel, identified by their
+    ranks 0 to size-1.
+
+    Up to PlasmaBarrierMaxSize threads, it is a dissemination barrier:
+    in round r, thread i signals thread (i + 2^r) % size and waits for
+    the signal of thread (i - 2^r) % size, each on a flag no other thread
+    writes in that round. The threads spin with a pause and backoff, then
+    sleep on a futex (Linux), so that they leave the cores to the other
+    threads when oversubscribed. Larger teams share one counter.
+*/
 typedef struct {
     int size;
+    int rounds;
     int count;
     volatile int passed;
+    plasma_barrier_slot_t slots[PlasmaBarrierMaxSize];
 } plasma_barrier_t;
 
+/***************************************************************************//**
+    Progress table of the statically scheduled tile algorithms, with one
+    counter per entry, e.g., per tile column. The thread completing a step
+    of an entry sets its counter, and the threads needing the step wait for
+    the counter to reach it, spinning, then sleeping as at the barrier.
+*/
+typedef struct {
+    int size;
+    volatile int *value;
+    volatile int sleeping;  ///< threads waiting in the kernel
+} plasma_progress_t;
+
+/***************************************************************************//**
+    Rank of a team of threads running a multithreaded kernel, such as
+    a panel factorization, whose ranks 0 to size-1 meet at the barrier
+    and so must all run at the same time, see plasma_team_run().
+*/
+typedef void (*plasma_team_func_t)(void *args, int rank, int size,
+                                   plasma_barrier_t *barrier);
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier, int size);
-void plasma_barrier_wait(plasma_barrier_t *barrier);
+void plasma_barrier_wait(plasma_barrier_t *barrier, int rank);
+
+int plasma_progress_init(plasma_progress_t *progress, int size);
+void plasma_progress_destroy(plasma_progress_t *progress);
+void plasma_progress_set(plasma_progress_t *progress, int i, int value);
+void plasma_progress_wait(plasma_progress_t *progress, int i, int value);
+
+void plasma_team_run(plasma_enum_t team, plasma_enum_t bind,
+                     int size, int priority,
+                     plasma_team_func_t func, void *args);
 
 #ifdef __cplusplus
 }  // extern "C"
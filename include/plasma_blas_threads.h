@@ -0,0 +1,34 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_BLAS_THREADS_H
+#define ICL_PLASMA_BLAS_THREADS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    Threads of the BLAS called by the kernels. The kernels of the tasks call
+    the BLAS on their own thread, so plasma_init() makes a multithreaded BLAS
+    single-threaded, for MKL with -DPLASMA_WITH_MKL and for OpenBLAS with
+    -DPLASMA_WITH_OPENBLAS, and the last plasma_finalize() gives it back its
+    threads. The QR and LQ panels, with MKL only, run their BLAS on up to
+    PlasmaPanelBlasThreads threads, set for the thread of the panel task.
+    Does nothing for the other BLAS.
+*/
+void plasma_blas_threads_init();
+void plasma_blas_threads_finalize();
+int  plasma_blas_threads_local(int num_threads);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_BLAS_THREADS_H
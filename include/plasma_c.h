@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from include/plasma_z.h, normal z -> c, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_z.h, normal z -> c, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_C_H
@@ -16,12 +16,88 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/***************************************************************************//**
+ *  Generator of the mb-by-nb block T, with leading dimension ldt,
+ *  starting at the element (i, j) of a matrix in tile layout.
+ **/
+typedef void (*plasma_cgenerator_t)(int i, int j, int mb, int nb,
+                                    plasma_complex32_t *T, int ldt,
+                                    void *args);
+
+/***************************************************************************//**
+ *  Element-wise operation of a fused pipeline, applied to the m-by-n tile B
+ *  with the tile A of the source, if any. uplo is the part of the tile
+ *  to update and diag tells whether the tile is on the diagonal.
+ **/
+typedef struct plasma_cpipeline_op_s plasma_cpipeline_op_t;
+
+typedef void (*plasma_cpipeline_kernel_t)(const plasma_cpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb);
+
+struct plasma_cpipeline_op_s {
+    plasma_cpipeline_kernel_t kernel;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_complex32_t alpha;
+    plasma_complex32_t beta;
+    float cfrom;
+    float cto;
+    int a;  ///< operand of the source, or -1
+    int b;  ///< operand updated
+};
+
+/***************************************************************************//**
+ *  Sequence of element-wise tile operations run as one task per tile,
+ *  recorded by the plasma_cpipeline_* functions.
+ **/
+typedef struct {
+    int num_ops;
+    int num_operands;
+    plasma_cpipeline_op_t ops[PlasmaPipelineMaxOps];
+    plasma_desc_t operands[PlasmaPipelineMaxOperands];
+    int written[PlasmaPipelineMaxOperands];
+    int read_trans[PlasmaPipelineMaxOperands];
+} plasma_cpipeline_t;
+
+/***************************************************************************//**
+ *  Element-wise function of a gemm epilogue, applied to the m-by-n block C,
+ *  with leading dimension ldc, starting at the element (i, j) of the
+ *  product.
+ **/
+typedef void (*plasma_cepilogue_func_t)(int i, int j, int m, int n,
+                                        plasma_complex32_t *C, int ldc,
+                                        void *args);
+
+/***************************************************************************//**
+ *  Epilogue of plasma_cgemm_epilogue, applied to each tile of C by the task
+ *  of its last product,
+ *
+ *    C(i,j) = func( act( row_scale(i)*col_scale(j)*C(i,j)
+ *                        + row_bias(i) + col_bias(j) ) ).
+ *
+ *  The NULL vectors and function are skipped, so that an epilogue
+ *  initialized to zero leaves the product as is.
+ **/
+typedef struct {
+    const plasma_complex32_t *row_scale;  ///< of length m, or NULL
+    const plasma_complex32_t *col_scale;  ///< of length n, or NULL
+    const plasma_complex32_t *row_bias;   ///< of length m, or NULL
+    const plasma_complex32_t *col_bias;   ///< of length n, or NULL
+    plasma_enum_t activation;             ///< PlasmaActivation*
+    plasma_cepilogue_func_t func;
+    void *args;
+} plasma_cepilogue_t;
+
 /***************************************************************************//**
  *  Standard interface.
  **/
@@ -33,6 +109,11 @@ int plasma_cgbsv(int n, int kl, int ku, int nrhs,
                  plasma_complex32_t *pAB, int ldab, int *ipiv,
                  plasma_complex32_t *pB,  int ldb);
 
+int plasma_cgbsv_batched(int n, int kl, int ku, int nrhs,
+                         plasma_complex32_t *pAB, int ldab, int *ipiv,
+                         plasma_complex32_t *pB,
+                         int batch_count, int *info);
+
 int plasma_cgbtrf(int m, int n, int kl, int ku,
                   plasma_complex32_t *pA, int lda, int *ipiv);
 
@@ -46,6 +127,16 @@ int plasma_cgeadd(plasma_enum_t transa,
                   plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
                   plasma_complex32_t beta,  plasma_complex32_t *pB, int ldb);
 
+int plasma_cgecon(plasma_enum_t norm, int n,
+                  plasma_complex32_t *pA, int lda,
+                  float Anorm, float *rcond);
+
+int plasma_cgeexp(int n, plasma_complex32_t *pA, int lda);
+
+int plasma_cgehrd(plasma_enum_t jobq, int n,
+                  plasma_complex32_t *pA, int lda,
+                  plasma_complex32_t *pQ, int ldq);
+
 int plasma_cgelqf(int m, int n,
                   plasma_complex32_t *pA, int lda,
                   plasma_desc_t *T);
@@ -67,10 +158,77 @@ int plasma_cgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            plasma_complex32_t *pB, int ldb,
                  plasma_complex32_t beta,  plasma_complex32_t *pC, int ldc);
 
+int plasma_cgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                          int m, int n, int k,
+                          plasma_complex32_t alpha,
+                          plasma_complex32_t *pA, int lda,
+                          plasma_complex32_t *pB, int ldb,
+                          plasma_complex32_t beta,
+                          plasma_complex32_t *pC, int ldc,
+                          const plasma_cepilogue_t *epilogue);
+
+int plasma_cgemm_opts(plasma_enum_t transa, plasma_enum_t transb,
+                      int m, int n, int k,
+                      plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
+                                                plasma_complex32_t *pB, int ldb,
+                      plasma_complex32_t beta,  plasma_complex32_t *pC, int ldc,
+                      const plasma_options_t *options);
+
+int plasma_cgemm_batched(plasma_enum_t transa, plasma_enum_t transb,
+                         int m, int n, int k,
+                         plasma_complex32_t alpha,
+                         plasma_complex32_t **pA, int lda,
+                         plasma_complex32_t **pB, int ldb,
+                         plasma_complex32_t beta,
+                         plasma_complex32_t **pC, int ldc,
+                         int batch_count);
+
+int plasma_cgemm_vbatched(plasma_enum_t transa, plasma_enum_t transb,
+                          const int *m, const int *n, const int *k,
+                          plasma_complex32_t alpha,
+                          plasma_complex32_t **pA, const int *lda,
+                          plasma_complex32_t **pB, const int *ldb,
+                          plasma_complex32_t beta,
+                          plasma_complex32_t **pC, const int *ldc,
+                          int batch_count);
+
+int plasma_cgemmt(plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t transb,
+                  int n, int k,
+                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
+                                            plasma_complex32_t *pB, int ldb,
+                  plasma_complex32_t beta,  plasma_complex32_t *pC, int ldc);
+
+int plasma_cgepolar(int m, int n,
+                    plasma_complex32_t *pA, int lda,
+                    plasma_complex32_t *pH, int ldh);
+
+int plasma_cgeqp3(int m, int n,
+                  plasma_complex32_t *pA, int lda, int *jpvt,
+                  plasma_desc_t *T);
+
 int plasma_cgeqrf(int m, int n,
                   plasma_complex32_t *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_cgeqrf_opts(int m, int n,
+                       plasma_complex32_t *pA, int lda,
+                       plasma_desc_t *T,
+                       const plasma_options_t *options);
+
+int plasma_cgeqrf_batched(int m, int n,
+                          plasma_complex32_t **pA, int lda,
+                          plasma_complex32_t **ptau,
+                          int batch_count);
+
+int plasma_cgeqrf_cholqr(int m, int n,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_complex32_t *pR, int ldr);
+
+int plasma_cgeqrf_lowrank(int m, int n, int k, int p, int niter,
+                          plasma_complex32_t *pA, int lda,
+                          plasma_desc_t *Q, plasma_desc_t *B);
+
 int plasma_cgeqrs(int m, int n, int nrhs,
                   plasma_complex32_t *pA, int lda,
                   plasma_desc_t T,
@@ -80,9 +238,46 @@ int plasma_cgesv(int n, int nrhs,
                  plasma_complex32_t *pA, int lda, int *ipiv,
                  plasma_complex32_t *pB, int ldb);
 
+int plasma_cgesv_rbt(int n, int nrhs,
+                     plasma_complex32_t *pA, int lda,
+                     plasma_complex32_t *pB, int ldb,
+                     plasma_complex32_t *pX, int ldx, int *iter);
+
+int plasma_cgesvd(plasma_enum_t jobu, plasma_enum_t jobvt, int m, int n,
+                  plasma_complex32_t *pA, int lda, float *S,
+                  plasma_complex32_t *pU, int ldu,
+                  plasma_complex32_t *pVT, int ldvt);
+
+int plasma_cgesvd_randomized(int m, int n, int k, int p, int niter,
+                             plasma_complex32_t *pA, int lda, float *S,
+                             plasma_complex32_t *pU, int ldu,
+                             plasma_complex32_t *pVT, int ldvt);
+
 int plasma_cgetrf(int m, int n,
                   plasma_complex32_t *pA, int lda, int *ipiv);
 
+int plasma_cgetrf_incpiv(int m, int n,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_desc_t *L, int **ipiv);
+
+int plasma_cgetrf_opts(int m, int n,
+                       plasma_complex32_t *pA, int lda, int *ipiv,
+                       const plasma_options_t *options);
+
+int plasma_cgetrf_batched(int m, int n,
+                          plasma_complex32_t **pA, int lda, int **ipiv,
+                          int batch_count, int *info);
+
+int plasma_cgetrf_vbatched(const int *m, const int *n,
+                           plasma_complex32_t **pA, const int *lda,
+                           int **ipiv, int batch_count, int *info);
+
+int plasma_cgetrf_partial(int m, int n, int k,
+                          plasma_complex32_t *pA, int lda, int *ipiv);
+
+int plasma_cgetrf_handle_create(int n, plasma_complex32_t *pA, int lda,
+                                plasma_getrf_handle_t *handle);
+
 int plasma_cgetri(int n, plasma_complex32_t *pA, int lda, int *ipiv);
 
 int plasma_cgetri_aux(int n, plasma_complex32_t *pA, int lda);
@@ -91,6 +286,37 @@ int plasma_cgetrs(int n, int nrhs,
                   plasma_complex32_t *pA, int lda, int *ipiv,
                   plasma_complex32_t *pB, int ldb);
 
+int plasma_cgetrs_incpiv(int n, int nrhs,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         plasma_complex32_t *pB, int ldb);
+
+int plasma_cgetrs_handle(plasma_getrf_handle_t handle, int nrhs,
+                         plasma_complex32_t *pB, int ldb);
+
+int plasma_cgtsv(int n, int nrhs,
+                 plasma_complex32_t *dl, plasma_complex32_t *d,
+                 plasma_complex32_t *du,
+                 plasma_complex32_t *pB, int ldb);
+
+int plasma_cgtsv_batched(int n, int nrhs,
+                         plasma_complex32_t *dl, plasma_complex32_t *d,
+                         plasma_complex32_t *du, plasma_complex32_t *pB,
+                         int batch_count, int *info);
+
+int plasma_cheev(plasma_enum_t jobz, plasma_enum_t uplo, int n,
+                 plasma_complex32_t *pA, int lda, float *W);
+
+int plasma_chesv(plasma_enum_t uplo, int n, int nrhs,
+                 plasma_complex32_t *pA, int lda, int *ipiv,
+                 plasma_complex32_t *pT, int ldt, int *ipiv2,
+                 plasma_complex32_t *pB, int ldb);
+
+int plasma_chegst(int itype, plasma_enum_t uplo,
+                  int n,
+                  plasma_complex32_t *pA, int lda,
+                  plasma_complex32_t *pB, int ldb);
+
 int plasma_chemm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
@@ -108,6 +334,15 @@ int plasma_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                  float alpha, plasma_complex32_t *pA, int lda,
                  float beta,  plasma_complex32_t *pC, int ldc);
 
+int plasma_chetrf(plasma_enum_t uplo, int n,
+                  plasma_complex32_t *pA, int lda, int *ipiv,
+                  plasma_complex32_t *pT, int ldt, int *ipiv2);
+
+int plasma_chetrs(plasma_enum_t uplo, int n, int nrhs,
+                  plasma_complex32_t *pA, int lda, int *ipiv,
+                  plasma_complex32_t *pT, int ldt, int *ipiv2,
+                  plasma_complex32_t *pB, int ldb);
+
 int plasma_clacpy(plasma_enum_t uplo,
                   int m, int n,
                   plasma_complex32_t *pA, int lda,
@@ -147,6 +382,8 @@ int plasma_claswp(plasma_enum_t colrow,
 int plasma_clauum(plasma_enum_t uplo, int n,
                   plasma_complex32_t *pA, int lda);
 
+int plasma_clrpotrf(int n, plasma_complex32_t *pA, int lda, float tol);
+
 int plasma_cpbsv(plasma_enum_t uplo,
                  int n, int kd, int nrhs,
                  plasma_complex32_t *pAB, int ldab,
@@ -161,6 +398,22 @@ int plasma_cpbtrs(plasma_enum_t uplo,
                   plasma_complex32_t *pAB, int ldab,
                   plasma_complex32_t *pB,  int ldb);
 
+int plasma_cplghe(float bump, int n,
+                  plasma_complex32_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_cplgsy(plasma_complex32_t bump, int n,
+                  plasma_complex32_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_cplrnt(int m, int n,
+                  plasma_complex32_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_cpocon(plasma_enum_t uplo, int n,
+                  plasma_complex32_t *pA, int lda,
+                  float Anorm, float *rcond);
+
 int plasma_cposv(plasma_enum_t uplo,
                  int n, int nrhs,
                  plasma_complex32_t *pA, int lda,
@@ -170,6 +423,30 @@ int plasma_cpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex32_t *pA, int lda);
 
+int plasma_cpotrf_opts(plasma_enum_t uplo,
+                       int n,
+                       plasma_complex32_t *pA, int lda,
+                       const plasma_options_t *options);
+
+int plasma_cpotrf_update(plasma_enum_t uplo, int sign, int n, int k,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_complex32_t *pV, int ldv);
+
+int plasma_cpotrf_partial(plasma_enum_t uplo, int n, int k,
+                          plasma_complex32_t *pA, int lda);
+
+int plasma_cpotrf_sparse(plasma_enum_t uplo,
+                         int n,
+                         plasma_complex32_t *pA, int lda);
+
+int plasma_cpotrf_batched(plasma_enum_t uplo, int n,
+                          plasma_complex32_t **pA, int lda,
+                          int batch_count, int *info);
+
+int plasma_cpotrf_vbatched(plasma_enum_t uplo, const int *n,
+                           plasma_complex32_t **pA, const int *lda,
+                           int batch_count, int *info);
+
 int plasma_cpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex32_t *pA, int lda);
@@ -179,6 +456,18 @@ int plasma_cpotrs(plasma_enum_t uplo,
                   plasma_complex32_t *pA, int lda,
                   plasma_complex32_t *pB, int ldb);
 
+int plasma_cpstrf(int n, plasma_complex32_t *pA, int lda,
+                  int *piv, int *rank, float tol);
+
+int plasma_cptsv(int n, int nrhs,
+                 float *d, plasma_complex32_t *e,
+                 plasma_complex32_t *pB, int ldb);
+
+int plasma_cptsv_batched(int n, int nrhs,
+                         float *d, plasma_complex32_t *e,
+                         plasma_complex32_t *pB,
+                         int batch_count, int *info);
+
 int plasma_csymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
@@ -196,23 +485,48 @@ int plasma_csyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
                  plasma_complex32_t beta,  plasma_complex32_t *pC, int ldc);
 
+int plasma_ctpqrt(int m, int n, int nrhs,
+                  plasma_complex32_t *pR, int ldr,
+                  plasma_complex32_t *pB, int ldb,
+                  plasma_complex32_t *pC, int ldc,
+                  plasma_complex32_t *pD, int ldd,
+                  plasma_desc_t *T);
+
 int plasma_ctradd(plasma_enum_t uplo, plasma_enum_t transa,
                   int m, int n,
                   plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
                   plasma_complex32_t beta,  plasma_complex32_t *pB, int ldb);
 
+int plasma_ctranspose(plasma_enum_t trans,
+                      int m, int n,
+                      plasma_complex32_t *pA, int lda,
+                      plasma_complex32_t *pB, int ldb);
+
 int plasma_ctrmm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
                                            plasma_complex32_t *pB, int ldb);
 
+int plasma_ctrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t diag,
+                  int m, int n,
+                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
+                                            plasma_complex32_t *pB, int ldb,
+                                            plasma_complex32_t *pC, int ldc);
+
 int plasma_ctrsm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  plasma_complex32_t alpha, plasma_complex32_t *pA, int lda,
                                            plasma_complex32_t *pB, int ldb);
 
+int plasma_ctrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                  int m, int n,
+                  plasma_complex32_t *pA, int lda,
+                  plasma_complex32_t *pB, int ldb,
+                  plasma_complex32_t *pC, int ldc);
+
 int plasma_ctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                   int n, plasma_complex32_t *pA, int lda);
 
@@ -238,6 +552,70 @@ int plasma_cunmqr(plasma_enum_t side, plasma_enum_t trans,
                   plasma_desc_t T,
                   plasma_complex32_t *pC, int ldc);
 
+/***************************************************************************//**
+ *  Tile synchronous interface.
+ **/
+int plasma_cdesc_create(int m, int n,
+                        plasma_cgenerator_t generator, void *args,
+                        plasma_desc_t *A);
+
+int plasma_cdesc2ge_sub(plasma_desc_t A, int i, int j, int m, int n,
+                        plasma_complex32_t *pA, int lda);
+
+int plasma_cge2desc_sub(int i, int j, int m, int n,
+                        plasma_complex32_t *pA, int lda, plasma_desc_t A);
+
+int plasma_cgecon_tile(plasma_enum_t norm, plasma_desc_t A,
+                       float Anorm, float *rcond);
+
+int plasma_cgemm_tile(plasma_enum_t transa, plasma_enum_t transb,
+                      plasma_complex32_t alpha, plasma_desc_t A,
+                                                plasma_desc_t B,
+                      plasma_complex32_t beta,  plasma_desc_t C);
+
+int plasma_cgeqrf_tile(plasma_desc_t A, plasma_desc_t *T);
+
+int plasma_cgesv_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+int plasma_cgetrf_tile(plasma_desc_t A, int *ipiv);
+
+int plasma_cgetrs_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+void plasma_cpipeline_init(plasma_cpipeline_t *pipeline);
+
+int plasma_cpipeline_geadd(plasma_cpipeline_t *pipeline, plasma_enum_t transa,
+                           plasma_complex32_t alpha, plasma_desc_t A,
+                           plasma_complex32_t beta,  plasma_desc_t B);
+
+int plasma_cpipeline_lacpy(plasma_cpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_desc_t A, plasma_desc_t B);
+
+int plasma_cpipeline_lascl(plasma_cpipeline_t *pipeline, plasma_enum_t uplo,
+                           float cfrom, float cto, plasma_desc_t A);
+
+int plasma_cpipeline_laset(plasma_cpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_complex32_t alpha, plasma_complex32_t beta,
+                           plasma_desc_t A);
+
+int plasma_cpipeline_run(plasma_cpipeline_t *pipeline);
+
+int plasma_cpipeline_tradd(plasma_cpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_enum_t transa,
+                           plasma_complex32_t alpha, plasma_desc_t A,
+                           plasma_complex32_t beta,  plasma_desc_t B);
+
+int plasma_cpocon_tile(plasma_enum_t uplo, plasma_desc_t A,
+                       float Anorm, float *rcond);
+
+int plasma_cposv_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_cpotrf_tile(plasma_enum_t uplo, plasma_desc_t A);
+
+int plasma_cpotrs_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_ctrsyl_tile(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C);
+
 /***************************************************************************//**
  *  Tile asynchronous interface.
  **/
@@ -260,6 +638,11 @@ void plasma_omp_cdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_cdesc_generate(plasma_cgenerator_t generator, void *args,
+                               plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_cdesc2pb(plasma_desc_t A,
                          plasma_complex32_t *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -270,6 +653,15 @@ void plasma_omp_cge2desc(plasma_complex32_t *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_cge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                       plasma_complex32_t *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_cge2hb(plasma_desc_t A, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_cgeadd(plasma_enum_t transa,
                        plasma_complex32_t alpha, plasma_desc_t A,
                        plasma_complex32_t beta,  plasma_desc_t B,
@@ -294,10 +686,37 @@ void plasma_omp_cgemm(plasma_enum_t transa, plasma_enum_t transb,
                       plasma_complex32_t beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                               plasma_complex32_t alpha, plasma_desc_t A,
+                                                         plasma_desc_t B,
+                               plasma_complex32_t beta,  plasma_desc_t C,
+                               const plasma_cepilogue_t *epilogue,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_cgemmt(plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t transb,
+                       plasma_complex32_t alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                       plasma_complex32_t beta,  plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_cgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_cgeqrf(plasma_desc_t A, plasma_desc_t T,
                        plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cgeqrf_lowrank(int niter, plasma_desc_t A,
+                               plasma_desc_t Q, plasma_desc_t B,
+                               plasma_desc_t Y, plasma_desc_t TY,
+                               plasma_desc_t Z, plasma_desc_t TZ,
+                               plasma_desc_t W, plasma_workspace_t work,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_cgeqrs(plasma_desc_t A, plasma_desc_t T,
                        plasma_desc_t B, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -306,19 +725,55 @@ void plasma_omp_cgesv(plasma_desc_t A, int *ipiv,
                       plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          float *U, float *V, int *ipiv,
+                          float *work, float *Rnorm, float *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_cgetrf(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_cgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
+void plasma_omp_cgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_cgetrf_partial(int k, plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_cgetri(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_cgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_omp_cgetri_aux(plasma_desc_t A,
                            plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_cgetrs(plasma_desc_t A, int *ipiv,
                        plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_cgtsv(plasma_complex32_t *dl, plasma_complex32_t *d,
+                      plasma_complex32_t *du, plasma_desc_t B,
+                      plasma_complex32_t *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_che2hb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                       plasma_complex32_t *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_chegst(int itype, plasma_enum_t uplo,
+                       plasma_desc_t A, plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_chemm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_complex32_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -336,6 +791,10 @@ void plasma_omp_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                       float beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_chetrf(plasma_enum_t uplo, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t T, plasma_desc_t H,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_clacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -375,6 +834,11 @@ void plasma_omp_clauum(plasma_enum_t uplo,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_clrpotrf(plasma_desc_t A, float tol,
+                         plasma_workspace_t work, float *norms,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_omp_cpb2desc(plasma_complex32_t *pA, int lda,
                          plasma_desc_t A,
                          plasma_sequence_t *sequence,
@@ -389,18 +853,50 @@ void plasma_omp_cpbtrf(plasma_enum_t uplo, plasma_desc_t AB,
 void plasma_omp_cpbtrs(plasma_enum_t uplo, plasma_desc_t AB, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cpipeline_run(plasma_cpipeline_t *pipeline,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_cplghe(float bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_cplgsy(plasma_complex32_t bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_cplrnt(unsigned long long seed, plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_cposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_cpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cpotrf_partial(plasma_enum_t uplo, int k, plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_cpotrf_update(plasma_enum_t uplo, int sign,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_desc_t G,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_cpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_cpotrs(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cpstrf(plasma_desc_t A, int *piv, int *rank, float tol,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_cptsv(float *d, plasma_complex32_t *e, plasma_desc_t B,
+                      plasma_complex32_t *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_csymm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_complex32_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -418,23 +914,49 @@ void plasma_omp_csyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       plasma_complex32_t beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ctpmqrt(plasma_enum_t trans,
+                        plasma_desc_t B, plasma_desc_t T,
+                        plasma_desc_t C, plasma_desc_t D,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_ctpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ctradd(plasma_enum_t uplo, plasma_enum_t transa,
                        plasma_complex32_t alpha, plasma_desc_t A,
                        plasma_complex32_t beta,  plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t  *request);
 
+void plasma_omp_ctranspose(plasma_enum_t trans, plasma_desc_t A,
+                           plasma_desc_t B,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_omp_ctrmm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       plasma_complex32_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ctrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t diag,
+                       plasma_complex32_t alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                                                 plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ctrsm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       plasma_complex32_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ctrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -457,6 +979,15 @@ void plasma_omp_cunmqr(plasma_enum_t side, plasma_enum_t trans,
                        plasma_desc_t C, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+/***************************************************************************//**
+ *  Performance prediction.
+ **/
+int plasma_predict_cgeqrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_cgetrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_cpotrf(plasma_enum_t uplo, int n, plasma_time_t *time);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -10,24 +10,123 @@
 #ifndef ICL_PLASMA_CONTEXT_H
 #define ICL_PLASMA_CONTEXT_H
 
+#include "plasma_allocator.h"
 #include "plasma_barrier.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "plasma_types.h"
+#include "plasma_workspace.h"
 
 #include <pthread.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /******************************************************************************/
+typedef struct {
+    void *matrix; ///< tile matrix storage kept for reuse
+    size_t size;  ///< size of the storage in bytes
+} plasma_desc_cache_t;
+
+typedef struct {
+    plasma_enum_t tree;  ///< reduction tree, resolved from PlasmaAutoTree
+    int mt;              ///< number of tile rows
+    int nt;              ///< number of tile columns
+    int concurrency;     ///< number of threads
+    int domain_size;     ///< PlasmaTreeDomainSize, 0 if unused by the tree
+    int *operations;     ///< list of operations
+    int num_operations;  ///< number of operations
+    int users;           ///< number of callers holding the list
+} plasma_tree_cache_t;
+
 typedef struct {
     int nb;                         ///< PlasmaNb
+    int mb;                         ///< PlasmaMb, 0 for square tiles
     int ib;                         ///< PlasmaIb
     plasma_enum_t inplace_outplace; ///< PlasmaInplaceOutplace
     int max_threads;                ///< the value of OMP_NUM_THREADS
+    int num_threads;                ///< PlasmaNumThreads, 0 for a fair share
     int num_panel_threads;          ///< no. threads for panel factorization
+    plasma_enum_t panel_mode;       ///< PlasmaPanelMode
+    int lookahead;                  ///< PlasmaLookahead
+    plasma_enum_t update_mode;      ///< PlasmaUpdateMode
+    plasma_enum_t left_pivoting;    ///< PlasmaLeftPivoting
+    plasma_enum_t offload;          ///< PlasmaOffload
+    plasma_enum_t tuning;           ///< PlasmaTuning
+    plasma_enum_t cholesky_variant; ///< PlasmaCholeskyVariant
+    int cholesky_switch;            ///< PlasmaCholeskySwitch
+    int task_window;                ///< PlasmaTaskWindow
+    int trsm_stream;                ///< PlasmaTrsmStream
+    plasma_enum_t gemm_variant;     ///< PlasmaGemmVariant
+    plasma_enum_t gels_variant;     ///< PlasmaGelsVariant
+    plasma_enum_t getri_variant;    ///< PlasmaGetriVariant
+    plasma_enum_t gemm_hint;        ///< PlasmaGemmHint
+    plasma_enum_t prefetch;         ///< PlasmaPrefetch
+    int strassen_threshold;         ///< PlasmaStrassenThreshold
+    int strassen_levels;            ///< PlasmaStrassenLevels
+    plasma_enum_t refinement_mode;  ///< PlasmaRefinementMode
+    int gmres_restart;              ///< PlasmaGmresRestart
+    plasma_enum_t factor_precision; ///< PlasmaFactorPrecision
+    plasma_enum_t tile_io;          ///< PlasmaTileIo
+    plasma_enum_t trace;            ///< PlasmaTrace
+    plasma_enum_t stats;            ///< PlasmaStats
+    plasma_stats_thread_t *stats_threads;
+                                    ///< per-thread counters of the tasks
+    plasma_stats_memory_t memory;   ///< storage of descriptors and workspaces
+    plasma_enum_t dry_run;          ///< PlasmaDryRun
     plasma_barrier_t barrier;       ///< thread barrier for multithreaded tasks
+    plasma_panel_workspace_t panel_work;
+                                    ///< pivot search scratch for panel tasks
+    plasma_workspace_t work_pool;   ///< per-thread workspaces kept for reuse,
+                                    ///  with lwork in bytes
+    int work_pool_lent;             ///< work_pool borrowed by a workspace
     plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+    plasma_enum_t householder_tree; ///< PlasmaHouseholderTree
+    plasma_enum_t t_storage;        ///< PlasmaTStorage
+    int tree_domain_size;           ///< PlasmaTreeDomainSize
+    int ts_block;                   ///< PlasmaTsBlock
+    int householder_group;          ///< PlasmaHouseholderGroup
+    plasma_enum_t tile_placement;   ///< PlasmaTilePlacement
+    plasma_enum_t tile_layout;      ///< PlasmaTileLayout
+    plasma_enum_t coarsening;       ///< PlasmaCoarsening
+    plasma_enum_t sweep_mode;       ///< PlasmaSweepMode
+    plasma_enum_t expansion;        ///< PlasmaExpansion
+    int tile_padding;               ///< PlasmaTilePadding
+    plasma_enum_t tile_balance;     ///< PlasmaTileBalance
+    plasma_enum_t accumulation;     ///< PlasmaAccumulation
+    plasma_enum_t scheduling;       ///< PlasmaScheduling
+    plasma_enum_t panel_team;       ///< PlasmaPanelTeam
+    plasma_enum_t thread_bind;      ///< PlasmaThreadBind
+    plasma_enum_t panel_bind;       ///< PlasmaPanelBind
+    int first_cpu;                  ///< PlasmaFirstCpu
+    int panel_blas_threads;         ///< PlasmaPanelBlasThreads
+    plasma_enum_t array_layout;     ///< PlasmaArrayLayout
+    int sub_nb;                     ///< PlasmaSubNb
+    int tail_tiles;                 ///< PlasmaTailTiles
+    plasma_enum_t graph_replay;     ///< PlasmaGraphReplay
+    int rhs_nb;                     ///< PlasmaRhsNb, 0 to fit nrhs
+    plasma_enum_t tile_structure;   ///< PlasmaTileStructure
+    int ozaki_slices;               ///< PlasmaOzakiSlices
+    plasma_enum_t small_path;       ///< PlasmaSmallPath
+    plasma_enum_t monitor;          ///< PlasmaMonitor
+    plasma_monitor_thread_t *monitor_threads;
+                                    ///< per-thread live counters of the tasks
+    int bound_threads;              ///< threads pinned by thread_bind,
+                                    ///  -1 to pin them again
+    plasma_allocator_t allocator;   ///< PlasmaAllocator
+    int desc_cache_size;            ///< PlasmaDescCacheSize
+    plasma_desc_cache_t desc_cache[PlasmaDescCacheMaxSize];
+                                    ///< storage of destroyed descriptors
+    pthread_mutex_t desc_cache_lock;
+                                    ///< lock of desc_cache, shared with the
+                                    ///  threads of the sessions
+    plasma_tree_cache_t tree_cache[PlasmaTreeCacheMaxSize];
+                                    ///< lists of reduction tree operations
+    int tree_cache_next;            ///< next tree_cache entry to replace
+    pthread_mutex_t tree_cache_lock;
+                                    ///< lock of tree_cache, shared with tasks
 } plasma_context_t;
 
 typedef struct {
@@ -38,14 +137,345 @@ typedef struct {
 /******************************************************************************/
 int plasma_init();
 int plasma_finalize();
+int plasma_warmup(plasma_enum_t precision, int n, int count);
 int plasma_set(plasma_enum_t param, int value);
 int plasma_get(plasma_enum_t param, int *value);
+int plasma_set_allocator(plasma_alloc_t alloc, plasma_dealloc_t dealloc);
 
 int plasma_context_attach();
 int plasma_context_detach();
 plasma_context_t *plasma_context_self();
+void plasma_context_share(plasma_context_t *context);
+int plasma_num_threads(plasma_context_t *context);
 void plasma_context_init(plasma_context_t *context);
 
+void *plasma_context_cache_acquire(plasma_context_t *context, size_t size);
+void plasma_context_cache_release(plasma_context_t *context,
+                                  void *matrix, size_t size);
+void plasma_context_cache_clear(plasma_context_t *context);
+
+void plasma_stats_memory_acquire(plasma_context_t *context, size_t size);
+void plasma_stats_memory_release(plasma_context_t *context, size_t size);
+
+/***************************************************************************//**
+    Throttles the task submission of a tile algorithm, called by the master
+    thread before submitting step k. With a PlasmaTaskWindow of w > 0,
+    waits for all submitted tasks before every w-th step, so the runtime
+    never holds the task graph of more than w steps.
+*/
+static inline void plasma_task_window(plasma_context_t *context, int k)
+{
+    int window = context->task_window;
+    if (window > 0 && k > 0 && k%window == 0) {
+        #pragma omp taskwait
+    }
+}
+
+/***************************************************************************//**
+    Returns the number of Strassen-Winograd levels of an m-by-n-by-k product
+    with tiles of size nb, 0 for the classic algorithm.
+    Each level halves the largest part of the dimensions made of an even
+    number of tiles, and is only taken while m, n and k are at least
+    PlasmaStrassenThreshold tiles. Not while capturing a task graph.
+*/
+static inline int plasma_strassen_levels(plasma_context_t *context,
+                                         int m, int n, int k, int nb)
+{
+    if (context->gemm_variant != PlasmaStrassenGemm ||
+        plasma_graph_capture != NULL)
+        return 0;
+
+    int threshold = context->strassen_threshold*nb;
+    if (threshold < 2*nb)
+        threshold = 2*nb;
+
+    int levels = 0;
+    while (levels < context->strassen_levels &&
+           m >= threshold && n >= threshold && k >= threshold) {
+        m = m/(2*nb)*nb;
+        n = n/(2*nb)*nb;
+        k = k/(2*nb)*nb;
+        levels++;
+    }
+    return levels;
+}
+
+/***************************************************************************//**
+    Returns whether the complex tile products use the 3M algorithm, with
+    the PlasmaGemmVariant PlasmaGemm3m. Each tile read by several products
+    is split once into its real and imaginary parts. Not while capturing
+    a task graph, the split tiles being workspace.
+*/
+static inline int plasma_gemm_3m(plasma_context_t *context)
+{
+    return context->gemm_variant == PlasmaGemm3m &&
+           plasma_graph_capture == NULL;
+}
+
+/***************************************************************************//**
+    Returns the number of slices of the tile products emulated by the Ozaki
+    scheme, with the PlasmaGemmVariant PlasmaOzakiGemm, 0 for the products
+    of the BLAS. Not while capturing a task graph, the split tiles being
+    workspace.
+*/
+static inline int plasma_gemm_ozaki(plasma_context_t *context)
+{
+    if (context->gemm_variant != PlasmaOzakiGemm ||
+        plasma_graph_capture != NULL)
+        return 0;
+
+    return context->ozaki_slices;
+}
+
+/***************************************************************************//**
+    Returns the number of parts the inner dimension of a product is split
+    into, for a C of mt-by-nt tiles and an inner dimension of kt tiles,
+    1 for no split. When C has fewer tiles than threads, the parts give
+    the idle threads products into copies of C, reduced afterwards.
+    Each part keeps at least two tiles of the inner dimension.
+    Not while capturing a task graph, the copies being workspace.
+*/
+static inline int plasma_gemm_splits(plasma_context_t *context,
+                                     int mt, int nt, int kt)
+{
+    if (context->gemm_variant != PlasmaClassicGemm ||
+        plasma_graph_capture != NULL)
+        return 1;
+
+    int tiles = mt*nt;
+    int num_threads = plasma_num_threads(context);
+    if (tiles == 0 || tiles >= num_threads)
+        return 1;
+
+    int splits = num_threads/tiles;
+    if (splits > kt/2)
+        splits = kt/2;
+    if (splits > PlasmaGemmMaxSplits)
+        splits = PlasmaGemmMaxSplits;
+    return splits > 1 ? splits : 1;
+}
+
+/***************************************************************************//**
+    Returns the number of consecutive tile products of a chain summed into
+    the same tile of C by one task, for tile products of m-by-n-by-k and
+    chains independent tasks, 1 for one task per product.
+    With PlasmaCoarsening on, products of less than about 2M multiply-adds
+    are grouped up to PlasmaCoarsenMaxTiles per task, as long as there are
+    at least as many chains as threads, and not while capturing a task graph.
+*/
+static inline int plasma_coarsen_tiles(plasma_context_t *context,
+                                       int m, int n, int k, int chains)
+{
+    if (context->coarsening != PlasmaCoarseningOn ||
+        context->offload == PlasmaOffloadOn ||
+        plasma_graph_capture != NULL ||
+        chains < plasma_num_threads(context))
+        return 1;
+
+    long long cost = (long long)m*n*k;
+    if (cost <= 0)
+        return 1;
+
+    long long tiles = (2097152+cost-1)/cost;
+    if (tiles > PlasmaCoarsenMaxTiles)
+        tiles = PlasmaCoarsenMaxTiles;
+    return tiles > 1 ? (int)tiles : 1;
+}
+
+/***************************************************************************//**
+    Returns whether the tasks of chains of tile products prefetch the tiles
+    of the next product of the chain while computing the current one, with
+    PlasmaPrefetch on, so that the next product does not start on cold
+    tiles. Not with offload, and not while capturing a task graph.
+*/
+static inline int plasma_prefetch(plasma_context_t *context)
+{
+    return context->prefetch == PlasmaPrefetchOn &&
+           context->offload != PlasmaOffloadOn &&
+           plasma_graph_capture == NULL;
+}
+
+/***************************************************************************//**
+    Returns the number of consecutive TS tiles of a tile column (QR) or row
+    (LQ) whose reflectors are merged into one block, with its T factor
+    merged once, and applied to each tile of the updated matrix by a few
+    gemms, 1 for one core_omp_ztsmqr() or core_omp_ztsmlq() per tile.
+    Set by PlasmaHouseholderGroup, up to PlasmaHouseholderMaxGroup, as the
+    flops of the merged T factor grow with the square of the group; not
+    with offload and not while capturing a task graph.
+*/
+static inline int plasma_householder_group(plasma_context_t *context)
+{
+    if (context->householder_group <= 1 ||
+        context->offload == PlasmaOffloadOn ||
+        plasma_graph_capture != NULL)
+        return 1;
+
+    return context->householder_group;
+}
+
+/***************************************************************************//**
+    Returns the size of the sub-tiles the tile products of m-by-n-by-k are
+    split into, each product running as a task of nested tasks, one per
+    sub-tile of C, so that the operands of a nested task fit in the L2
+    cache while the tiles stay large enough to amortize the outer tasks.
+    Returns 0, for one task per product, if PlasmaSubNb is 0 or not smaller
+    than the tiles, with offload, and while capturing a task graph.
+*/
+static inline int plasma_subtile_nb(plasma_context_t *context,
+                                    int m, int n, int k)
+{
+    int sub_nb = context->sub_nb;
+    if (sub_nb <= 0 || (sub_nb >= m && sub_nb >= n && sub_nb >= k) ||
+        context->offload == PlasmaOffloadOn ||
+        plasma_graph_capture != NULL)
+        return 0;
+
+    return sub_nb;
+}
+
+/***************************************************************************//**
+    Returns the step of a factorization of mt tile columns from which the
+    trailing matrix, down to at most PlasmaTailTiles tile columns, is
+    factored by one task calling the kernel on all of it with the threads
+    of the BLAS, as its few tiles no longer keep the threads busy.
+    Returns mt, for the tile tasks to the end, if PlasmaTailTiles is 0,
+    with offload, and while capturing a task graph.
+*/
+static inline int plasma_tail_step(plasma_context_t *context, int mt)
+{
+    if (context->tail_tiles <= 0 ||
+        context->offload == PlasmaOffloadOn ||
+        plasma_graph_capture != NULL)
+        return mt;
+
+    return mt > context->tail_tiles ? mt-context->tail_tiles : 0;
+}
+
+/***************************************************************************//**
+    Returns 1 if a sweep over the tiles of a matrix of mt tile rows, with
+    no dependences between its tiles, is submitted as one task per tile
+    column, whose tiles are spread over the threads by a taskloop,
+    0 for one task per tile submitted by the master thread.
+    The column tasks depend on all the tiles of their columns.
+*/
+static inline int plasma_column_sweep(plasma_context_t *context, int mt)
+{
+    return context->sweep_mode == PlasmaColumnSweep && mt > 1;
+}
+
+/***************************************************************************//**
+    Returns 1 if a Hermitian or symmetric matrix of mt tile rows, multiplied
+    by a general one, is first expanded to the full matrix in its tile
+    storage, so that all the tile products are plain gemm, 0 for the tile
+    products of its stored triangle, with hemm or symm on the diagonal.
+*/
+static inline int plasma_expand_sym(plasma_context_t *context, int mt)
+{
+    return context->expansion == PlasmaExpansionOn && mt > 1;
+}
+
+/***************************************************************************//**
+    Returns the tile size of the routines tiling a dimension n with tiles
+    of at most nb, if PlasmaTileBalance is on, the smallest multiple of 8
+    giving the same number of tiles, so that the tiles are balanced instead
+    of leaving a thin last tile, else nb.
+*/
+static inline int plasma_tile_balance(plasma_context_t *context,
+                                      int n, int nb)
+{
+    if (context->tile_balance == PlasmaTileBalanceOff || n <= nb)
+        return nb;
+
+    int nt = (n+nb-1)/nb;
+    int bb = ((n+nt-1)/nt+7)/8*8;
+    return bb < nb ? bb : nb;
+}
+
+/***************************************************************************//**
+    Returns 1 if the successive updates accumulated into a tile, such as the
+    gemm updates of the trailing matrix, run in any order, each as soon as
+    its inputs are ready, with commutative dependencies on the tile,
+    0 for their submission order. The sums are then not reproducible
+    bitwise from run to run. The offloaded updates, and the updates captured
+    in a task graph, keep their order.
+*/
+static inline int plasma_commute_updates(plasma_context_t *context)
+{
+    return context->accumulation == PlasmaCommutativeAccumulation &&
+           context->offload == PlasmaOffloadOff &&
+           plasma_graph_capture == NULL;
+}
+
+/***************************************************************************//**
+    Returns 1 if the routines with a static schedule, potrf, getrf, geqrf
+    and gemm, run it instead of their tasks with dependencies, 0 otherwise.
+    In the static schedule, each thread of the team owns tile columns, or
+    tiles of C in gemm, in a cyclic distribution, and waits for the panels
+    it needs in a progress table, without the runtime tracking the
+    dependencies, which costs more than the kernels for small and medium
+    matrices. It applies to the matrices of a single process, without
+    offload, and not while capturing a task graph.
+*/
+static inline int plasma_static_scheduling(plasma_context_t *context)
+{
+    return context->scheduling == PlasmaStaticScheduling &&
+           context->offload == PlasmaOffloadOff &&
+           plasma_graph_capture == NULL;
+}
+
+/***************************************************************************//**
+    Returns 1 if the LAPACK interface of gemm, potrf and getrf calls the
+    kernel directly on the arrays of the caller for a problem of the largest
+    dimension size, 0 otherwise. With PlasmaSmallPath on, a problem fitting
+    a single tile skips the tile layout, the sequence and the tasks, which
+    cost more than the kernel itself for small sizes. It does not apply with
+    the traces, the statistics, the monitor or the dry runs, which account
+    for the tasks, with offload, or while capturing a task graph.
+*/
+static inline int plasma_small_path(plasma_context_t *context, int size)
+{
+    return context->small_path == PlasmaSmallPathOn &&
+           size <= context->nb &&
+           context->trace == PlasmaTraceOff &&
+           context->stats == PlasmaStatsOff &&
+           context->monitor == PlasmaMonitorOff &&
+           context->dry_run == PlasmaDryRunOff &&
+           context->offload == PlasmaOffloadOff &&
+           plasma_graph_capture == NULL;
+}
+
+/***************************************************************************//**
+    Returns the tile height of the routines tiling their rows with tiles of
+    PlasmaMb rows, for the tile width nb, nb if PlasmaMb is 0.
+*/
+static inline int plasma_tile_mb(plasma_context_t *context, int nb)
+{
+    return context->mb > 0 ? context->mb : nb;
+}
+
+/***************************************************************************//**
+    Returns the tile width of the right-hand sides B of the solvers, for
+    nrhs columns and the tile size nb of A, PlasmaRhsNb unless it is 0.
+    Up to nb columns make a single tile column, without empty columns.
+    More columns are cut into tiles of nb columns, widened up to
+    PlasmaRhsMaxWiden times as long as there are tile columns left for
+    every thread, so that the solves of many columns run in larger tasks.
+*/
+static inline int plasma_tile_rhs_nb(plasma_context_t *context,
+                                     int nb, int nrhs)
+{
+    if (context->rhs_nb > 0)
+        return context->rhs_nb;
+    if (nrhs <= nb)
+        return nrhs > 0 ? nrhs : 1;
+
+    int widen = (nrhs+nb-1)/nb/plasma_num_threads(context);
+    if (widen > PlasmaRhsMaxWiden)
+        widen = PlasmaRhsMaxWiden;
+    return widen > 1 ? widen*nb : nb;
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
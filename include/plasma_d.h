@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from include/plasma_z.h, normal z -> d, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_z.h, normal z -> d, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_D_H
@@ -16,12 +16,88 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/***************************************************************************//**
+ *  Generator of the mb-by-nb block T, with leading dimension ldt,
+ *  starting at the element (i, j) of a matrix in tile layout.
+ **/
+typedef void (*plasma_dgenerator_t)(int i, int j, int mb, int nb,
+                                    double *T, int ldt,
+                                    void *args);
+
+/***************************************************************************//**
+ *  Element-wise operation of a fused pipeline, applied to the m-by-n tile B
+ *  with the tile A of the source, if any. uplo is the part of the tile
+ *  to update and diag tells whether the tile is on the diagonal.
+ **/
+typedef struct plasma_dpipeline_op_s plasma_dpipeline_op_t;
+
+typedef void (*plasma_dpipeline_kernel_t)(const plasma_dpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb);
+
+struct plasma_dpipeline_op_s {
+    plasma_dpipeline_kernel_t kernel;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    double alpha;
+    double beta;
+    double cfrom;
+    double cto;
+    int a;  ///< operand of the source, or -1
+    int b;  ///< operand updated
+};
+
+/***************************************************************************//**
+ *  Sequence of element-wise tile operations run as one task per tile,
+ *  recorded by the plasma_dpipeline_* functions.
+ **/
+typedef struct {
+    int num_ops;
+    int num_operands;
+    plasma_dpipeline_op_t ops[PlasmaPipelineMaxOps];
+    plasma_desc_t operands[PlasmaPipelineMaxOperands];
+    int written[PlasmaPipelineMaxOperands];
+    int read_trans[PlasmaPipelineMaxOperands];
+} plasma_dpipeline_t;
+
+/***************************************************************************//**
+ *  Element-wise function of a gemm epilogue, applied to the m-by-n block C,
+ *  with leading dimension ldc, starting at the element (i, j) of the
+ *  product.
+ **/
+typedef void (*plasma_depilogue_func_t)(int i, int j, int m, int n,
+                                        double *C, int ldc,
+                                        void *args);
+
+/***************************************************************************//**
+ *  Epilogue of plasma_dgemm_epilogue, applied to each tile of C by the task
+ *  of its last product,
+ *
+ *    C(i,j) = func( act( row_scale(i)*col_scale(j)*C(i,j)
+ *                        + row_bias(i) + col_bias(j) ) ).
+ *
+ *  The NULL vectors and function are skipped, so that an epilogue
+ *  initialized to zero leaves the product as is.
+ **/
+typedef struct {
+    const double *row_scale;  ///< of length m, or NULL
+    const double *col_scale;  ///< of length n, or NULL
+    const double *row_bias;   ///< of length m, or NULL
+    const double *col_bias;   ///< of length n, or NULL
+    plasma_enum_t activation;             ///< PlasmaActivation*
+    plasma_depilogue_func_t func;
+    void *args;
+} plasma_depilogue_t;
+
 /***************************************************************************//**
  *  Standard interface.
  **/
@@ -33,6 +109,11 @@ int plasma_dgbsv(int n, int kl, int ku, int nrhs,
                  double *pAB, int ldab, int *ipiv,
                  double *pB,  int ldb);
 
+int plasma_dgbsv_batched(int n, int kl, int ku, int nrhs,
+                         double *pAB, int ldab, int *ipiv,
+                         double *pB,
+                         int batch_count, int *info);
+
 int plasma_dgbtrf(int m, int n, int kl, int ku,
                   double *pA, int lda, int *ipiv);
 
@@ -46,6 +127,16 @@ int plasma_dgeadd(plasma_enum_t transa,
                   double alpha, double *pA, int lda,
                   double beta,  double *pB, int ldb);
 
+int plasma_dgecon(plasma_enum_t norm, int n,
+                  double *pA, int lda,
+                  double Anorm, double *rcond);
+
+int plasma_dgeexp(int n, double *pA, int lda);
+
+int plasma_dgehrd(plasma_enum_t jobq, int n,
+                  double *pA, int lda,
+                  double *pQ, int ldq);
+
 int plasma_dgelqf(int m, int n,
                   double *pA, int lda,
                   plasma_desc_t *T);
@@ -67,10 +158,77 @@ int plasma_dgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            double *pB, int ldb,
                  double beta,  double *pC, int ldc);
 
+int plasma_dgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                          int m, int n, int k,
+                          double alpha,
+                          double *pA, int lda,
+                          double *pB, int ldb,
+                          double beta,
+                          double *pC, int ldc,
+                          const plasma_depilogue_t *epilogue);
+
+int plasma_dgemm_opts(plasma_enum_t transa, plasma_enum_t transb,
+                      int m, int n, int k,
+                      double alpha, double *pA, int lda,
+                                                double *pB, int ldb,
+                      double beta,  double *pC, int ldc,
+                      const plasma_options_t *options);
+
+int plasma_dgemm_batched(plasma_enum_t transa, plasma_enum_t transb,
+                         int m, int n, int k,
+                         double alpha,
+                         double **pA, int lda,
+                         double **pB, int ldb,
+                         double beta,
+                         double **pC, int ldc,
+                         int batch_count);
+
+int plasma_dgemm_vbatched(plasma_enum_t transa, plasma_enum_t transb,
+                          const int *m, const int *n, const int *k,
+                          double alpha,
+                          double **pA, const int *lda,
+                          double **pB, const int *ldb,
+                          double beta,
+                          double **pC, const int *ldc,
+                          int batch_count);
+
+int plasma_dgemmt(plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t transb,
+                  int n, int k,
+                  double alpha, double *pA, int lda,
+                                            double *pB, int ldb,
+                  double beta,  double *pC, int ldc);
+
+int plasma_dgepolar(int m, int n,
+                    double *pA, int lda,
+                    double *pH, int ldh);
+
+int plasma_dgeqp3(int m, int n,
+                  double *pA, int lda, int *jpvt,
+                  plasma_desc_t *T);
+
 int plasma_dgeqrf(int m, int n,
                   double *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_dgeqrf_opts(int m, int n,
+                       double *pA, int lda,
+                       plasma_desc_t *T,
+                       const plasma_options_t *options);
+
+int plasma_dgeqrf_batched(int m, int n,
+                          double **pA, int lda,
+                          double **ptau,
+                          int batch_count);
+
+int plasma_dgeqrf_cholqr(int m, int n,
+                         double *pA, int lda,
+                         double *pR, int ldr);
+
+int plasma_dgeqrf_lowrank(int m, int n, int k, int p, int niter,
+                          double *pA, int lda,
+                          plasma_desc_t *Q, plasma_desc_t *B);
+
 int plasma_dgeqrs(int m, int n, int nrhs,
                   double *pA, int lda,
                   plasma_desc_t T,
@@ -80,9 +238,46 @@ int plasma_dgesv(int n, int nrhs,
                  double *pA, int lda, int *ipiv,
                  double *pB, int ldb);
 
+int plasma_dgesv_rbt(int n, int nrhs,
+                     double *pA, int lda,
+                     double *pB, int ldb,
+                     double *pX, int ldx, int *iter);
+
+int plasma_dgesvd(plasma_enum_t jobu, plasma_enum_t jobvt, int m, int n,
+                  double *pA, int lda, double *S,
+                  double *pU, int ldu,
+                  double *pVT, int ldvt);
+
+int plasma_dgesvd_randomized(int m, int n, int k, int p, int niter,
+                             double *pA, int lda, double *S,
+                             double *pU, int ldu,
+                             double *pVT, int ldvt);
+
 int plasma_dgetrf(int m, int n,
                   double *pA, int lda, int *ipiv);
 
+int plasma_dgetrf_incpiv(int m, int n,
+                         double *pA, int lda,
+                         plasma_desc_t *L, int **ipiv);
+
+int plasma_dgetrf_opts(int m, int n,
+                       double *pA, int lda, int *ipiv,
+                       const plasma_options_t *options);
+
+int plasma_dgetrf_batched(int m, int n,
+                          double **pA, int lda, int **ipiv,
+                          int batch_count, int *info);
+
+int plasma_dgetrf_vbatched(const int *m, const int *n,
+                           double **pA, const int *lda,
+                           int **ipiv, int batch_count, int *info);
+
+int plasma_dgetrf_partial(int m, int n, int k,
+                          double *pA, int lda, int *ipiv);
+
+int plasma_dgetrf_handle_create(int n, double *pA, int lda,
+                                plasma_getrf_handle_t *handle);
+
 int plasma_dgetri(int n, double *pA, int lda, int *ipiv);
 
 int plasma_dgetri_aux(int n, double *pA, int lda);
@@ -91,6 +286,37 @@ int plasma_dgetrs(int n, int nrhs,
                   double *pA, int lda, int *ipiv,
                   double *pB, int ldb);
 
+int plasma_dgetrs_incpiv(int n, int nrhs,
+                         double *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         double *pB, int ldb);
+
+int plasma_dgetrs_handle(plasma_getrf_handle_t handle, int nrhs,
+                         double *pB, int ldb);
+
+int plasma_dgtsv(int n, int nrhs,
+                 double *dl, double *d,
+                 double *du,
+                 double *pB, int ldb);
+
+int plasma_dgtsv_batched(int n, int nrhs,
+                         double *dl, double *d,
+                         double *du, double *pB,
+                         int batch_count, int *info);
+
+int plasma_dsyev(plasma_enum_t jobz, plasma_enum_t uplo, int n,
+                 double *pA, int lda, double *W);
+
+int plasma_dsysv(plasma_enum_t uplo, int n, int nrhs,
+                 double *pA, int lda, int *ipiv,
+                 double *pT, int ldt, int *ipiv2,
+                 double *pB, int ldb);
+
+int plasma_dsygst(int itype, plasma_enum_t uplo,
+                  int n,
+                  double *pA, int lda,
+                  double *pB, int ldb);
+
 int plasma_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  double alpha, double *pA, int lda,
@@ -108,6 +334,15 @@ int plasma_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  double alpha, double *pA, int lda,
                  double beta,  double *pC, int ldc);
 
+int plasma_dsytrf(plasma_enum_t uplo, int n,
+                  double *pA, int lda, int *ipiv,
+                  double *pT, int ldt, int *ipiv2);
+
+int plasma_dsytrs(plasma_enum_t uplo, int n, int nrhs,
+                  double *pA, int lda, int *ipiv,
+                  double *pT, int ldt, int *ipiv2,
+                  double *pB, int ldb);
+
 int plasma_dlacpy(plasma_enum_t uplo,
                   int m, int n,
                   double *pA, int lda,
@@ -147,6 +382,8 @@ int plasma_dlaswp(plasma_enum_t colrow,
 int plasma_dlauum(plasma_enum_t uplo, int n,
                   double *pA, int lda);
 
+int plasma_dlrpotrf(int n, double *pA, int lda, double tol);
+
 int plasma_dpbsv(plasma_enum_t uplo,
                  int n, int kd, int nrhs,
                  double *pAB, int ldab,
@@ -161,6 +398,22 @@ int plasma_dpbtrs(plasma_enum_t uplo,
                   double *pAB, int ldab,
                   double *pB,  int ldb);
 
+int plasma_dplgsy(double bump, int n,
+                  double *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_dplgsy(double bump, int n,
+                  double *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_dplrnt(int m, int n,
+                  double *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_dpocon(plasma_enum_t uplo, int n,
+                  double *pA, int lda,
+                  double Anorm, double *rcond);
+
 int plasma_dposv(plasma_enum_t uplo,
                  int n, int nrhs,
                  double *pA, int lda,
@@ -170,6 +423,30 @@ int plasma_dpotrf(plasma_enum_t uplo,
                   int n,
                   double *pA, int lda);
 
+int plasma_dpotrf_opts(plasma_enum_t uplo,
+                       int n,
+                       double *pA, int lda,
+                       const plasma_options_t *options);
+
+int plasma_dpotrf_update(plasma_enum_t uplo, int sign, int n, int k,
+                         double *pA, int lda,
+                         double *pV, int ldv);
+
+int plasma_dpotrf_partial(plasma_enum_t uplo, int n, int k,
+                          double *pA, int lda);
+
+int plasma_dpotrf_sparse(plasma_enum_t uplo,
+                         int n,
+                         double *pA, int lda);
+
+int plasma_dpotrf_batched(plasma_enum_t uplo, int n,
+                          double **pA, int lda,
+                          int batch_count, int *info);
+
+int plasma_dpotrf_vbatched(plasma_enum_t uplo, const int *n,
+                           double **pA, const int *lda,
+                           int batch_count, int *info);
+
 int plasma_dpotri(plasma_enum_t uplo,
                   int n,
                   double *pA, int lda);
@@ -179,6 +456,18 @@ int plasma_dpotrs(plasma_enum_t uplo,
                   double *pA, int lda,
                   double *pB, int ldb);
 
+int plasma_dpstrf(int n, double *pA, int lda,
+                  int *piv, int *rank, double tol);
+
+int plasma_dptsv(int n, int nrhs,
+                 double *d, double *e,
+                 double *pB, int ldb);
+
+int plasma_dptsv_batched(int n, int nrhs,
+                         double *d, double *e,
+                         double *pB,
+                         int batch_count, int *info);
+
 int plasma_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  double alpha, double *pA, int lda,
@@ -196,23 +485,48 @@ int plasma_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  double alpha, double *pA, int lda,
                  double beta,  double *pC, int ldc);
 
+int plasma_dtpqrt(int m, int n, int nrhs,
+                  double *pR, int ldr,
+                  double *pB, int ldb,
+                  double *pC, int ldc,
+                  double *pD, int ldd,
+                  plasma_desc_t *T);
+
 int plasma_dtradd(plasma_enum_t uplo, plasma_enum_t transa,
                   int m, int n,
                   double alpha, double *pA, int lda,
                   double beta,  double *pB, int ldb);
 
+int plasma_dtranspose(plasma_enum_t trans,
+                      int m, int n,
+                      double *pA, int lda,
+                      double *pB, int ldb);
+
 int plasma_dtrmm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  double alpha, double *pA, int lda,
                                            double *pB, int ldb);
 
+int plasma_dtrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t diag,
+                  int m, int n,
+                  double alpha, double *pA, int lda,
+                                            double *pB, int ldb,
+                                            double *pC, int ldc);
+
 int plasma_dtrsm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  double alpha, double *pA, int lda,
                                            double *pB, int ldb);
 
+int plasma_dtrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                  int m, int n,
+                  double *pA, int lda,
+                  double *pB, int ldb,
+                  double *pC, int ldc);
+
 int plasma_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
                   int n, double *pA, int lda);
 
@@ -238,6 +552,70 @@ int plasma_dormqr(plasma_enum_t side, plasma_enum_t trans,
                   plasma_desc_t T,
                   double *pC, int ldc);
 
+/***************************************************************************//**
+ *  Tile synchronous interface.
+ **/
+int plasma_ddesc_create(int m, int n,
+                        plasma_dgenerator_t generator, void *args,
+                        plasma_desc_t *A);
+
+int plasma_ddesc2ge_sub(plasma_desc_t A, int i, int j, int m, int n,
+                        double *pA, int lda);
+
+int plasma_dge2desc_sub(int i, int j, int m, int n,
+                        double *pA, int lda, plasma_desc_t A);
+
+int plasma_dgecon_tile(plasma_enum_t norm, plasma_desc_t A,
+                       double Anorm, double *rcond);
+
+int plasma_dgemm_tile(plasma_enum_t transa, plasma_enum_t transb,
+                      double alpha, plasma_desc_t A,
+                                                plasma_desc_t B,
+                      double beta,  plasma_desc_t C);
+
+int plasma_dgeqrf_tile(plasma_desc_t A, plasma_desc_t *T);
+
+int plasma_dgesv_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+int plasma_dgetrf_tile(plasma_desc_t A, int *ipiv);
+
+int plasma_dgetrs_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+void plasma_dpipeline_init(plasma_dpipeline_t *pipeline);
+
+int plasma_dpipeline_geadd(plasma_dpipeline_t *pipeline, plasma_enum_t transa,
+                           double alpha, plasma_desc_t A,
+                           double beta,  plasma_desc_t B);
+
+int plasma_dpipeline_lacpy(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_desc_t A, plasma_desc_t B);
+
+int plasma_dpipeline_lascl(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           double cfrom, double cto, plasma_desc_t A);
+
+int plasma_dpipeline_laset(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           double alpha, double beta,
+                           plasma_desc_t A);
+
+int plasma_dpipeline_run(plasma_dpipeline_t *pipeline);
+
+int plasma_dpipeline_tradd(plasma_dpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_enum_t transa,
+                           double alpha, plasma_desc_t A,
+                           double beta,  plasma_desc_t B);
+
+int plasma_dpocon_tile(plasma_enum_t uplo, plasma_desc_t A,
+                       double Anorm, double *rcond);
+
+int plasma_dposv_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_dpotrf_tile(plasma_enum_t uplo, plasma_desc_t A);
+
+int plasma_dpotrs_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_dtrsyl_tile(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C);
+
 /***************************************************************************//**
  *  Tile asynchronous interface.
  **/
@@ -260,6 +638,11 @@ void plasma_omp_ddesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_ddesc_generate(plasma_dgenerator_t generator, void *args,
+                               plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_ddesc2pb(plasma_desc_t A,
                          double *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -270,6 +653,15 @@ void plasma_omp_dge2desc(double *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_dge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                       double *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dge2hb(plasma_desc_t A, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dgeadd(plasma_enum_t transa,
                        double alpha, plasma_desc_t A,
                        double beta,  plasma_desc_t B,
@@ -294,10 +686,37 @@ void plasma_omp_dgemm(plasma_enum_t transa, plasma_enum_t transb,
                       double beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                               double alpha, plasma_desc_t A,
+                                                         plasma_desc_t B,
+                               double beta,  plasma_desc_t C,
+                               const plasma_depilogue_t *epilogue,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_dgemmt(plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t transb,
+                       double alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                       double beta,  plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dgeqrf(plasma_desc_t A, plasma_desc_t T,
                        plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dgeqrf_lowrank(int niter, plasma_desc_t A,
+                               plasma_desc_t Q, plasma_desc_t B,
+                               plasma_desc_t Y, plasma_desc_t TY,
+                               plasma_desc_t Z, plasma_desc_t TZ,
+                               plasma_desc_t W, plasma_workspace_t work,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_dgeqrs(plasma_desc_t A, plasma_desc_t T,
                        plasma_desc_t B, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -306,19 +725,55 @@ void plasma_omp_dgesv(plasma_desc_t A, int *ipiv,
                       plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          double *U, double *V, int *ipiv,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_dgetrf(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_dgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
+void plasma_omp_dgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_dgetrf_partial(int k, plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_dgetri(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_dgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_omp_dgetri_aux(plasma_desc_t A,
                            plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_dgetrs(plasma_desc_t A, int *ipiv,
                        plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_dgtsv(double *dl, double *d,
+                      double *du, plasma_desc_t B,
+                      double *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dsy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                       double *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dsygst(int itype, plasma_enum_t uplo,
+                       plasma_desc_t A, plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                       double alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -336,6 +791,10 @@ void plasma_omp_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       double beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dsytrf(plasma_enum_t uplo, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t T, plasma_desc_t H,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dlacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -375,6 +834,11 @@ void plasma_omp_dlauum(plasma_enum_t uplo,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dlrpotrf(plasma_desc_t A, double tol,
+                         plasma_workspace_t work, double *norms,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_omp_dpb2desc(double *pA, int lda,
                          plasma_desc_t A,
                          plasma_sequence_t *sequence,
@@ -389,18 +853,50 @@ void plasma_omp_dpbtrf(plasma_enum_t uplo, plasma_desc_t AB,
 void plasma_omp_dpbtrs(plasma_enum_t uplo, plasma_desc_t AB, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dpipeline_run(plasma_dpipeline_t *pipeline,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_dplgsy(double bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dplgsy(double bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dplrnt(unsigned long long seed, plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_dpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dpotrf_partial(plasma_enum_t uplo, int k, plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_dpotrf_update(plasma_enum_t uplo, int sign,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_desc_t G,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_dpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_dpotrs(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dptsv(double *d, double *e, plasma_desc_t B,
+                      double *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                       double alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -418,23 +914,49 @@ void plasma_omp_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       double beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dtpmqrt(plasma_enum_t trans,
+                        plasma_desc_t B, plasma_desc_t T,
+                        plasma_desc_t C, plasma_desc_t D,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_dtpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dtradd(plasma_enum_t uplo, plasma_enum_t transa,
                        double alpha, plasma_desc_t A,
                        double beta,  plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t  *request);
 
+void plasma_omp_dtranspose(plasma_enum_t trans, plasma_desc_t A,
+                           plasma_desc_t B,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_omp_dtrmm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       double alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dtrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t diag,
+                       double alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                                                 plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dtrsm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       double alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dtrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -457,6 +979,15 @@ void plasma_omp_dormqr(plasma_enum_t side, plasma_enum_t trans,
                        plasma_desc_t C, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+/***************************************************************************//**
+ *  Performance prediction.
+ **/
+int plasma_predict_dgeqrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_dgetrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_dpotrf(plasma_enum_t uplo, int n, plasma_time_t *time);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,56 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_DEQUE_H
+#define ICL_PLASMA_DEQUE_H
+
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    Circular buffer of a deque. The buffers a deque outgrew stay linked
+    through prev until the deque is destroyed, as a thief may still read
+    a task from the previous buffer.
+*/
+typedef struct plasma_deque_buffer_s {
+    long size;                            ///< a power of two
+    struct plasma_deque_buffer_s *prev;
+    int task[];
+} plasma_deque_buffer_t;
+
+/***************************************************************************//**
+    Work-stealing deque of task indices (Chase and Lev), on its own cache
+    lines. Its owner thread pushes and takes the tasks at the bottom, last
+    in first out, without locks; the other threads steal them at the top,
+    first in first out, by a compare-and-swap. The buffer grows as needed.
+*/
+typedef union {
+    struct {
+        volatile long top;
+        volatile long bottom;
+        plasma_deque_buffer_t *volatile buffer;
+    } s;
+    char pad[128];
+} plasma_deque_t;
+
+/******************************************************************************/
+int  plasma_deque_init(plasma_deque_t *deque, long size);
+void plasma_deque_destroy(plasma_deque_t *deque);
+int  plasma_deque_push(plasma_deque_t *deque, int task);
+int  plasma_deque_take(plasma_deque_t *deque);
+int  plasma_deque_steal(plasma_deque_t *deque);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_DEQUE_H
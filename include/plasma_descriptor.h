@@ -36,18 +36,64 @@ extern "C" {
  *     m2  |    A21   |A22|
  *         +----------+---+
  *
+ * With the PlasmaMortonLayout tile layout, the tiles are stored instead in
+ * the recursive order of the quadrants of the grid of tiles, A11, A21, A12,
+ * A22, down to single tiles, and tile_offset holds the offset of each tile.
+ *
+ * With the PlasmaTriangularLayout tile layout of a square matrix, only the
+ * tiles of the uplo triangle, diagonal tiles included, are stored, column
+ * by column. The tiles outside of the triangle are not stored; their
+ * tile_offset aliases the storage of the transposed tile.
+ *
+ * With the PlasmaSparseLayout tile layout of a block-sparse matrix, only the
+ * tiles of the pattern tile_pattern are stored, column by column. The empty
+ * tiles all alias a single tile of zeros after them, so that they read as
+ * zero, but must never be written.
+ *
+ * With a padding ldpad > 0, each tile has the leading dimension of its
+ * height plus ldpad, so that the rows of the large power-of-two tiles do
+ * not map to the same cache sets. The tiles are then stored column by
+ * column of tiles, unless in Morton or triangular order, and tile_offset
+ * holds the offset of each tile.
+ *
+ * With the PlasmaLapackLayout tile layout, the matrix is the column-major
+ * array of the LAPACK interface itself, with its leading dimension lda, and
+ * each tile is a view of the array with that leading dimension.
+ *
  **/
 typedef struct {
     // matrix properties
     plasma_enum_t type;      ///< general, general band, etc.
     plasma_enum_t uplo;      ///< upper, lower, etc.
     plasma_enum_t precision; ///< precision of the matrix
+    plasma_enum_t *tile_precision; ///< precision of each tile, or NULL
+                                   ///  if all tiles are in precision
+    int *tile_lrank; ///< rank of each tile compressed as U*V^H, -1 if dense,
+                     ///  or NULL if all tiles are dense
+    plasma_enum_t *tile_structure; ///< PlasmaTileZero, PlasmaTileIdentity
+                                   ///  or PlasmaTileDense of each tile,
+                                   ///  or NULL if all tiles are dense
+    int rate;        ///< bytes kept of each real number of packed tiles,
+                     ///  or 0 if the tiles are not packed
 
     // pointer and offsets
     void *matrix; ///< pointer to the beginning of the matrix
     size_t A21;   ///< pointer to the beginning of A21
     size_t A12;   ///< pointer to the beginning of A12
     size_t A22;   ///< pointer to the beginning of A22
+    plasma_enum_t layout; ///< column-major, Morton, triangular order of
+                          ///  the tiles, or views of a LAPACK array
+    size_t *tile_offset;  ///< offset of each tile in Morton or triangular
+                          ///  order, or NULL in column-major order
+    int *tile_pattern;    ///< 1 for each tile stored in the sparse layout,
+                          ///  0 for each empty tile, or NULL
+    plasma_enum_t translation; ///< PlasmaInplace if the matrix is
+                               ///  the LAPACK array translated in place
+    int mapped;   ///< 1 if the matrix is a file mapped in memory
+    int zero;     ///< 1 if the matrix is fresh zero storage, not yet written
+    int ldpad;    ///< padding of the leading dimension of the tiles
+    int lda;      ///< leading dimension of the LAPACK array holding the
+                  ///  tiles in PlasmaLapackLayout, 0 otherwise
 
     // tile parameters
     int mb; ///< number of rows in a tile
@@ -67,14 +113,59 @@ typedef struct {
     int mt; ///< number of tile rows of the submatrix
     int nt; ///< number of tile columns of the submatrix
 
+    // tile addressing, derived from the parameters above, so that the
+    // address of a tile takes no division
+    size_t eltsize; ///< size of an element in bytes
+    int it;  ///< tile row of the beginning of the submatrix, i/mb
+    int jt;  ///< tile column of the beginning of the submatrix, j/nb
+    int lm1; ///< number of full tile rows of the entire matrix, gm/mb
+    int ln1; ///< number of full tile columns of the entire matrix, gn/nb
+
     // submatrix parameters for a band matrix
     int kl;  ///< number of rows below the diagonal
     int ku;  ///< number of rows above the diagonal
     int klt; ///< number of tile rows below the diagonal tile
     int kut; ///< number of tile rows above the diagonal tile
              ///  includes the space for potential fills, i.e., kl+ku
+
+    // placement of the tiles in memory
+    plasma_enum_t placement; ///< none, interleaved, or 2D block cyclic
+    int num_places; ///< number of OpenMP places holding the tiles
+    int place_rows; ///< number of rows of the grid of places (2D cyclic)
+
+    // distribution of the tiles over MPI processes (2D block cyclic)
+    int p;    ///< number of rows of the grid of processes, 1 if not
+              ///  distributed
+    int q;    ///< number of columns of the grid of processes
+    int rank; ///< rank of the calling process in the grid
 } plasma_desc_t;
 
+/***************************************************************************//**
+ * @ingroup plasma_descriptor
+ *
+ * LU factorization kept in tile layout for repeated solves.
+ *
+ **/
+typedef struct {
+    plasma_desc_t A; ///< L and U factors in tile layout
+    int *ipiv;       ///< pivot indices
+} plasma_getrf_handle_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_descriptor
+ *
+ * Mixed precision LU factorization kept in tile layout for repeated solves
+ * by iterative refinement.
+ *
+ **/
+typedef struct {
+    plasma_desc_t A;  ///< A in tile layout, for the residuals
+    plasma_desc_t As; ///< L and U factors of A in single precision
+    int *ipiv;        ///< pivot indices
+    double Anorm;     ///< infinity norm of A
+    int bf16;         ///< whether As is factored in bfloat16
+} plasma_getrf_mixed_handle_t;
+
 /******************************************************************************/
 static inline size_t plasma_element_size(int type)
 {
@@ -92,26 +183,30 @@ static inline size_t plasma_element_size(int type)
 /******************************************************************************/
 static inline void *plasma_tile_addr_general(plasma_desc_t A, int m, int n)
 {
-    int mm = m + A.i/A.mb;
-    int nn = n + A.j/A.nb;
-    size_t eltsize = plasma_element_size(A.precision);
-    size_t offset = 0;
+    int mm = m + A.it;
+    int nn = n + A.jt;
+
+    if (A.layout == PlasmaLapackLayout)
+        return (void*)((char*)A.matrix +
+                       ((size_t)A.mb*mm + (size_t)A.nb*A.lda*nn)*A.eltsize);
 
-    int lm1 = A.gm/A.mb;
-    int ln1 = A.gn/A.nb;
+    if (A.tile_offset != NULL)
+        return (void*)((char*)A.matrix +
+                       A.tile_offset[mm + (size_t)A.gmt*nn]*A.eltsize);
 
-    if (mm < lm1)
-        if (nn < ln1)
-            offset = A.mb*A.nb*(mm + (size_t)lm1 * nn);
+    size_t offset;
+    if (mm < A.lm1)
+        if (nn < A.ln1)
+            offset = (size_t)A.mb*A.nb*(mm + (size_t)A.lm1*nn);
         else
-            offset = A.A12 + ((size_t)A.mb * (A.gn%A.nb) * mm);
+            offset = A.A12 + (size_t)A.mb*(A.gn - A.ln1*A.nb)*mm;
     else
-        if (nn < ln1)
-            offset = A.A21 + ((size_t)A.nb * (A.gm%A.mb) * nn);
+        if (nn < A.ln1)
+            offset = A.A21 + (size_t)A.nb*(A.gm - A.lm1*A.mb)*nn;
         else
             offset = A.A22;
 
-    return (void*)((char*)A.matrix + (offset*eltsize));
+    return (void*)((char*)A.matrix + offset*A.eltsize);
 }
 
 /******************************************************************************/
@@ -137,15 +232,19 @@ static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 
 /***************************************************************************//**
  *
- *  Returns the height of the tile with vertical position k.
+ *  Returns the leading dimension of the tile with vertical position k,
+ *  its height plus the padding of A, or the leading dimension of the
+ *  LAPACK array holding the tiles.
  *
  */
 static inline int plasma_tile_mmain(plasma_desc_t A, int k)
 {
-    if (A.i/A.mb+k < A.gm/A.mb)
-        return A.mb;
+    if (A.layout == PlasmaLapackLayout)
+        return A.lda;
+    else if (A.it+k < A.lm1)
+        return A.mb + A.ldpad;
     else
-        return A.gm%A.mb;
+        return A.gm - A.lm1*A.mb + A.ldpad;
 }
 
 /***************************************************************************//**
@@ -155,10 +254,10 @@ static inline int plasma_tile_mmain(plasma_desc_t A, int k)
  */
 static inline int plasma_tile_nmain(plasma_desc_t A, int k)
 {
-    if (A.j/A.nb+k < A.gn/A.nb)
+    if (A.jt+k < A.ln1)
         return A.nb;
     else
-        return A.gn%A.nb;
+        return A.gn - A.ln1*A.nb;
 }
 
 /***************************************************************************//**
@@ -195,24 +294,347 @@ static inline int plasma_tile_nview(plasma_desc_t A, int k)
             return (A.j+A.n)%A.nb;
 }
 
+/***************************************************************************//**
+ *
+ *  Returns the precision of the tile at position (m, n). A tile tagged with
+ *  a lower precision than the matrix holds its elements in that precision
+ *  at the beginning of its storage, with the same leading dimension.
+ *
+ */
+static inline plasma_enum_t plasma_tile_precision(plasma_desc_t A,
+                                                  int m, int n)
+{
+    if (A.tile_precision == NULL)
+        return A.precision;
+
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    return A.tile_precision[mm + (size_t)A.gmt*nn];
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the address of the rank tag of the tile at position (m, n) of a
+ *  tile low-rank matrix. A tile of rank k holds the m-by-k factor U at the
+ *  beginning of its storage, with its leading dimension, and the n-by-k
+ *  factor V after it, with the leading dimension n. The tags change with
+ *  the recompression of the tiles, so the kernels read them in their tasks.
+ *
+ */
+static inline int *plasma_tile_lrank(plasma_desc_t A, int m, int n)
+{
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    return &A.tile_lrank[mm + (size_t)A.gmt*nn];
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the structure of the tile at position (m, n), PlasmaTileZero,
+ *  PlasmaTileIdentity or PlasmaTileDense. The tags describe the tiles as
+ *  the tasks submitted so far leave them, so the loops submitting the tasks
+ *  read them, not the kernels. Only the tiles of submatrices aligned with
+ *  the tiles are tagged, and the part of an identity tile in the submatrix
+ *  is the identity only if it is square. The empty tiles of a block-sparse
+ *  matrix are zero, tagged or not.
+ *
+ */
+static inline plasma_enum_t plasma_tile_structure(plasma_desc_t A,
+                                                  int m, int n)
+{
+    if (A.layout == PlasmaSparseLayout &&
+        !A.tile_pattern[m+A.it + (size_t)A.gmt*(n+A.jt)])
+        return PlasmaTileZero;
+
+    if (A.tile_structure == NULL || A.i%A.mb != 0 || A.j%A.nb != 0)
+        return PlasmaTileDense;
+
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    plasma_enum_t structure = A.tile_structure[mm + (size_t)A.gmt*nn];
+    if (structure == PlasmaTileIdentity &&
+        plasma_tile_mview(A, m) != plasma_tile_nview(A, n))
+        return PlasmaTileDense;
+
+    return structure;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns 1 if the tile at position (m, n) of the submatrix is the entire
+ *  tile of the matrix, 0 otherwise.
+ *
+ */
+static inline int plasma_tile_whole(plasma_desc_t A, int m, int n)
+{
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    return A.i%A.mb == 0 && A.j%A.nb == 0 &&
+           plasma_tile_mview(A, m) == (mm == A.gmt-1 ? A.gm-mm*A.mb : A.mb) &&
+           plasma_tile_nview(A, n) == (nn == A.gnt-1 ? A.gn-nn*A.nb : A.nb);
+}
+
+/***************************************************************************//**
+ *
+ *  Tags the tile at position (m, n) with the structure the tasks submitted
+ *  so far leave it in. The part of a tile outside of the submatrix keeps
+ *  its elements, so a tile not entirely in the submatrix is tagged
+ *  PlasmaTileDense.
+ *
+ */
+static inline void plasma_tile_structure_set(plasma_desc_t A, int m, int n,
+                                             plasma_enum_t structure)
+{
+    if (A.tile_structure == NULL)
+        return;
+
+    if (!plasma_tile_whole(A, m, n))
+        structure = PlasmaTileDense;
+
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    A.tile_structure[mm + (size_t)A.gmt*nn] = structure;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns 1 if the tile at position (m, n) of the entire matrix is stored,
+ *  i.e., unless A has the triangular layout and the tile is outside of its
+ *  uplo triangle, or A has the sparse layout and the tile is empty.
+ *
+ */
+static inline int plasma_tile_stored_general(plasma_desc_t A, int m, int n)
+{
+    if (A.layout == PlasmaSparseLayout)
+        return A.tile_pattern[m + (size_t)A.gmt*n];
+
+    if (A.layout != PlasmaTriangularLayout)
+        return 1;
+
+    return A.uplo == PlasmaLower ? m >= n : m <= n;
+}
+
+/******************************************************************************/
+static inline int plasma_tile_stored(plasma_desc_t A, int m, int n)
+{
+    return plasma_tile_stored_general(A, m + A.it, n + A.jt);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns 1 if the translations of A from and to the LAPACK layout store
+ *  past the caches, for A of at least PlasmaStreamMinMiB MiB, which would
+ *  not stay in the caches anyway, 0 otherwise.
+ *
+ */
+static inline int plasma_desc_streamed(plasma_desc_t A)
+{
+    return A.rate == 0 &&
+           (double)A.m*A.n*A.eltsize >= PlasmaStreamMinMiB*1048576.0;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the size in bytes of the tile storage of A.
+ *
+ */
+static inline size_t plasma_desc_storage_size(plasma_desc_t A)
+{
+    if (A.layout == PlasmaLapackLayout)
+        return ((size_t)A.lda*(A.gn-1) + A.gm)*A.eltsize;
+
+    if (A.layout == PlasmaSparseLayout) {
+        // the stored tiles and the tile of zeros
+        size_t size = (size_t)(A.mb + A.ldpad)*A.nb;
+        for (int n = 0; n < A.gnt; n++) {
+            int nb = n < A.ln1 ? A.nb : A.gn - A.ln1*A.nb;
+            for (int m = 0; m < A.gmt; m++) {
+                int mb = m < A.lm1 ? A.mb : A.gm - A.lm1*A.mb;
+                if (A.tile_pattern[m + (size_t)A.gmt*n])
+                    size += (size_t)(mb + A.ldpad)*nb;
+            }
+        }
+        return size*A.eltsize;
+    }
+
+    if (A.layout != PlasmaTriangularLayout)
+        return ((size_t)A.gm + (size_t)A.gmt*A.ldpad)*A.gn*A.eltsize;
+
+    size_t size = 0;
+    for (int n = 0; n < A.gnt; n++) {
+        int nb = n < A.ln1 ? A.nb : A.gn - A.ln1*A.nb;
+        int rows = A.uplo == PlasmaLower ? A.gm - n*A.mb
+                 : ((n+1)*A.mb < A.gm ? (n+1)*A.mb : A.gm);
+        int tiles = A.uplo == PlasmaLower ? A.gmt - n : n+1;
+        size += (size_t)nb*(rows + (size_t)tiles*A.ldpad);
+    }
+    return size*A.eltsize;
+}
+
 /******************************************************************************/
 static inline int plasma_tile_mmain_band(plasma_desc_t A, int m, int n)
 {
     return plasma_tile_mmain(A, (A.kut-1)+m-n);
 }
 
+/***************************************************************************//**
+ *
+ *  Returns the OpenMP place whose memory holds the tile at position (m, n),
+ *  or -1 if the tiles are not placed.
+ *
+ */
+static inline int plasma_tile_place_general(plasma_desc_t A, int m, int n)
+{
+    int mm = m + A.it;
+    int nn = n + A.jt;
+
+    if (A.placement == PlasmaInterleavePlacement)
+        return (int)((mm + (size_t)A.gmt*nn) % A.num_places);
+    else if (A.placement == PlasmaCyclicPlacement)
+        return (mm%A.place_rows)*(A.num_places/A.place_rows) +
+               nn%(A.num_places/A.place_rows);
+    else
+        return -1;
+}
+
+/******************************************************************************/
+static inline int plasma_tile_place(plasma_desc_t A, int m, int n)
+{
+    if (A.type == PlasmaGeneralBand)
+        return plasma_tile_place_general(A, (A.kut-1)+m-n, n);
+    else
+        return plasma_tile_place_general(A, m, n);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the rank of the MPI process owning the tile at position (m, n)
+ *  of a matrix distributed 2D block cyclic over a p-by-q grid, row major.
+ *  A matrix not distributed is owned by the calling process.
+ *
+ */
+static inline int plasma_tile_rank_general(plasma_desc_t A, int m, int n)
+{
+    if (A.p*A.q <= 1)
+        return A.rank;
+
+    int mm = m + A.it;
+    int nn = n + A.jt;
+    return (mm%A.p)*A.q + nn%A.q;
+}
+
+/******************************************************************************/
+static inline int plasma_tile_rank(plasma_desc_t A, int m, int n)
+{
+    if (A.type == PlasmaGeneralBand)
+        return plasma_tile_rank_general(A, (A.kut-1)+m-n, n);
+    else
+        return plasma_tile_rank_general(A, m, n);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns 1 if the calling process owns the tile at position (m, n),
+ *  i.e., runs the tasks writing it.
+ *
+ */
+static inline int plasma_tile_local(plasma_desc_t A, int m, int n)
+{
+    return plasma_tile_rank(A, m, n) == A.rank;
+}
+
+/***************************************************************************//**
+ *
+ *  Hints the runtime to run the next task on the place holding the tile
+ *  at position (m, n). Uses the task affinity of the OpenMP extensions.
+ *
+ */
+#if defined(USE_OMPEXT)
+#define plasma_tile_affinity(A, m, n) \
+    do { \
+        if (plasma_tile_place(A, m, n) >= 0) \
+            omp_set_task_affinity(2, plasma_tile_place(A, m, n), 1); \
+    } while (0)
+#else
+#define plasma_tile_affinity(A, m, n) do { } while (0)
+#endif
+
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t dtyp, int mb, int nb,
                                int lm, int ln, int i, int j, int m, int n,
                                plasma_desc_t *A);
 
+int plasma_desc_general_zero_create(plasma_enum_t precision, int mb, int nb,
+                                    int lm, int ln, int i, int j, int m, int n,
+                                    plasma_desc_t *A);
+
 int plasma_desc_general_band_create(plasma_enum_t dtyp, plasma_enum_t uplo,
                                     int mb, int nb, int lm, int ln,
                                     int i, int j, int m, int n, int kl, int ku,
                                     plasma_desc_t *A);
 
+int plasma_desc_triangular_create(plasma_enum_t precision, plasma_enum_t uplo,
+                                  int mb, int nb, int lm, int ln,
+                                  int i, int j, int m, int n,
+                                  plasma_desc_t *A);
+
+int plasma_desc_sparse_create(plasma_enum_t precision, const int *pattern,
+                              int mb, int nb, int lm, int ln,
+                              int i, int j, int m, int n,
+                              plasma_desc_t *A);
+
+int plasma_desc_sparse_fill(plasma_enum_t uplo, int nt, int *pattern);
+
+int plasma_desc_sparse_filled(plasma_enum_t uplo, plasma_desc_t A);
+
+int plasma_desc_sparse_product(plasma_enum_t transa, plasma_enum_t transb,
+                               plasma_desc_t A, plasma_desc_t B,
+                               plasma_desc_t C);
+
+int plasma_desc_general_mmap_create(plasma_enum_t precision, int mb, int nb,
+                                    int lm, int ln, int i, int j, int m, int n,
+                                    const char *path, plasma_desc_t *A);
+
+int plasma_desc_general_packed_create(plasma_enum_t precision, int rate,
+                                      int mb, int nb, int lm, int ln,
+                                      int i, int j, int m, int n,
+                                      plasma_desc_t *A);
+
+void plasma_desc_prefetch(plasma_desc_t A, int m1, int m2, int n1, int n2,
+                          void *after);
+
+int plasma_desc_lapack_create(plasma_enum_t precision, void *pA, int lda,
+                              int mb, int nb, int m, int n,
+                              plasma_desc_t *A);
+
+int plasma_desc_lapack_view_create(plasma_enum_t precision, void *pA, int lda,
+                                   int mb, int nb, int m, int n,
+                                   plasma_desc_t *A);
+
+int plasma_desc_lapack_view_init(plasma_enum_t precision, void *pA, int lda,
+                                 int mb, int nb, int m, int n,
+                                 plasma_desc_t *A);
+
+int plasma_desc_lapack_triangular_create(plasma_enum_t precision,
+                                         plasma_enum_t uplo, void *pA, int lda,
+                                         int mb, int nb, int n,
+                                         plasma_desc_t *A);
+
 int plasma_desc_destroy(plasma_desc_t *A);
 
+int plasma_desc_distribute(plasma_desc_t *A, int p, int q);
+
+int plasma_desc_tile_precision_create(plasma_desc_t *A);
+int plasma_desc_tile_lrank_create(plasma_desc_t *A);
+int plasma_desc_tile_structure_create(plasma_desc_t *A);
+int plasma_getrf_handle_destroy(plasma_getrf_handle_t *handle);
+int plasma_getrf_mixed_handle_destroy(plasma_getrf_mixed_handle_t *handle);
+
+int plasma_desc_write(plasma_desc_t A, const char *path);
+int plasma_desc_read(const char *path, plasma_desc_t *A);
+int plasma_getrf_handle_write(plasma_getrf_handle_t handle, const char *path);
+int plasma_getrf_handle_read(const char *path, plasma_getrf_handle_t *handle);
+
 int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
                              int mb, int nb, int lm, int ln, int i, int j,
                              int m, int n, plasma_desc_t *A);
@@ -231,6 +653,13 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n);
 int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
                         plasma_desc_t *T);
 
+int plasma_descT_compact_create(plasma_desc_t A, int ib,
+                                plasma_enum_t householder_mode,
+                                plasma_enum_t storev, plasma_desc_t *T);
+
+int plasma_descT_check(plasma_desc_t A, plasma_desc_t T,
+                       plasma_enum_t householder_mode, plasma_enum_t storev);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
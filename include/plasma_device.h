@@ -0,0 +1,104 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_DEVICE_H
+#define ICL_PLASMA_DEVICE_H
+
+#include "plasma_async.h"
+#include "plasma_types.h"
+
+#include <stddef.h>
+
+#if defined(PLASMA_WITH_CUDA)
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    Device offload of the trailing updates, with -DPLASMA_WITH_CUDA and
+    plasma_set(PlasmaOffload, PlasmaOffloadOn).
+
+    Each thread has its own stream, cuBLAS handle and device tile of
+    workspace. The tiles an update reads are kept in a device cache, keyed
+    by their host address, and copied once, on the stream of the first
+    task reading them; the other tasks wait for the copy through its event.
+    The tile an update writes is copied to the device and back by the task,
+    so the host copy is current when the task completes, and the tile
+    dependencies keep the host and the device coherent. The copies of one
+    thread overlap the computation of the others.
+
+    A tile algorithm offloads only the updates reading tiles that stay
+    unchanged until its end, and clears the cache after waiting for its
+    tasks.
+*/
+typedef struct {
+    cudaStream_t stream;
+    cublasHandle_t handle;
+    void *work;    ///< device workspace of the written tile
+    size_t lwork;  ///< size of work in bytes
+} plasma_device_thread_t;
+
+int plasma_device_init(void);
+void plasma_device_finalize(void);
+
+plasma_device_thread_t *plasma_device_thread(void);
+void *plasma_device_work(plasma_device_thread_t *thread, size_t size);
+const void *plasma_device_tile(plasma_device_thread_t *thread,
+                               const void *A, int lda, int m, int n,
+                               size_t eltsize);
+void plasma_device_cache_clear(void);
+
+/******************************************************************************/
+static inline cublasOperation_t plasma_device_trans(plasma_enum_t trans)
+{
+    if (trans == PlasmaNoTrans)
+        return CUBLAS_OP_N;
+    else if (trans == PlasmaTrans)
+        return CUBLAS_OP_T;
+    else
+        return CUBLAS_OP_C;
+}
+
+/******************************************************************************/
+static inline cublasFillMode_t plasma_device_uplo(plasma_enum_t uplo)
+{
+    if (uplo == PlasmaUpper)
+        return CUBLAS_FILL_MODE_UPPER;
+    else
+        return CUBLAS_FILL_MODE_LOWER;
+}
+
+/***************************************************************************//**
+    The kernel f, or its device version f_device with PlasmaOffloadOn.
+*/
+#define PLASMA_OFFLOAD(plasma, f) \
+    ((plasma)->offload == PlasmaOffloadOn ? f##_device : f)
+
+/***************************************************************************//**
+    The update kernel f, its version f_commute with commutative updates,
+    see plasma_commute_updates(), or its device version f_device.
+*/
+#define PLASMA_UPDATE(plasma, f) \
+    (plasma_commute_updates(plasma) ? f##_commute : \
+     PLASMA_OFFLOAD(plasma, f))
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#else
+#define PLASMA_OFFLOAD(plasma, f) ((void)(plasma), f)
+#define PLASMA_UPDATE(plasma, f) \
+    (plasma_commute_updates(plasma) ? f##_commute : f)
+#endif // PLASMA_WITH_CUDA
+
+#endif // ICL_PLASMA_DEVICE_H
@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from include/plasma_zc.h, mixed zc -> ds, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_zc.h, mixed zc -> ds, Thu Oct 15 09:16:24 2026
  *
  **/
 #ifndef ICL_PLASMA_DS_H
@@ -16,6 +16,7 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_workspace.h"
+#include "plasma_d.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,11 +30,27 @@ int plasma_dsgesv(int n, int nrhs,
                   double *pB, int ldb,
                   double *pX, int ldx, int *iter);
 
+int plasma_dsgels(int m, int n, int nrhs,
+                  double *pA, int lda,
+                  double *pB, int ldb,
+                  double *pX, int ldx, int *iter);
+
+int plasma_dsgetrf_handle_create(int n, double *pA, int lda,
+                                 plasma_getrf_mixed_handle_t *handle);
+
+int plasma_dsgetrs_handle(plasma_getrf_mixed_handle_t handle, int nrhs,
+                          double *pB, int ldb,
+                          double *pX, int ldx, int *iter);
+
 int plasma_dsposv(plasma_enum_t uplo, int n, int nrhs,
                   double *pA, int lda,
                   double *pB, int ldb,
                   double *pX, int ldx, int *iter);
 
+int plasma_dspotrf(plasma_enum_t uplo,
+                   int n,
+                   double *pA, int lda, double tol);
+
 int plasma_dlag2s(int m, int n,
                   double *pA,  int lda,
                   float *pAs, int ldas);
@@ -42,6 +59,15 @@ int plasma_slag2d(int m, int n,
                   float *pAs, int ldas,
                   double *pA,  int lda);
 
+/***************************************************************************//**
+ *  Tile synchronous interface
+ **/
+int plasma_dpipeline_slag2d(plasma_dpipeline_t *pipeline,
+                            plasma_desc_t As, plasma_desc_t A);
+
+int plasma_dpipeline_dlag2s(plasma_dpipeline_t *pipeline,
+                            plasma_desc_t A, plasma_desc_t As);
+
 /***************************************************************************//**
  *  Tile asynchronous interface
  **/
@@ -59,6 +85,10 @@ void plasma_omp_dsposv(plasma_enum_t uplo,
                        plasma_sequence_t *sequence,
                        plasma_request_t  *request);
 
+void plasma_omp_dspotrf(plasma_enum_t uplo, plasma_desc_t A, double tol,
+                        plasma_workspace_t work, double *norms,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_dlag2s(plasma_desc_t A, plasma_desc_t As,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -0,0 +1,146 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_GRAPH_H
+#define ICL_PLASMA_GRAPH_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Task graphs captured from plasma_omp_* calls, and replayed on other
+ *  matrices of the same shapes, without running the loops of the tile
+ *  algorithms nor the dependency tracking of the runtime again.
+ *
+ *  Between plasma_graph_begin() and plasma_graph_end(), the core_omp_*
+ *  wrappers supporting the capture record their kernel, its arguments and
+ *  its tiles, as offsets in the storage of the descriptors of the capture,
+ *  instead of creating their tasks, and the dependencies between them from
+ *  the tiles they read and write. plasma_omp_graph_replay() runs the tasks
+ *  in the order of the capture, each thread of the team taking every size-th
+ *  task, and waiting for its predecessors in a progress table.
+ *
+ *  With PlasmaGraphReplay set to PlasmaStealingReplay, the replay is instead
+ *  driven by the counters of predecessors still to run of the tasks: a task
+ *  completing decrements the counters of its successors without locks, and
+ *  pushes those reaching zero to the work-stealing deque of its thread,
+ *  from which the idle threads steal, see plasma_deque_t. A task writing
+ *  the tile its writer predecessor wrote, as the k-loop of updates of a
+ *  tile of C in gemm or of the trailing matrix in potrf, is pushed instead
+ *  to the thread that ran that predecessor, through its mailbox, so that
+ *  the tile stays in the caches of the core that last wrote it.
+ *
+ *  The wrappers of potrf, trsm, herk, syrk and gemm support the capture,
+ *  so that, e.g., plasma_omp_zpotrf(), plasma_omp_zpotrs(), plasma_omp_zposv()
+ *  and plasma_omp_zgemm() are captured. The calls of a capture do not compute
+ *  anything, and commutative updates, static scheduling and coarsening are
+ *  off while capturing.
+ **/
+enum {
+    PlasmaGraphMaxDescs = 8,  // descriptors of a capture
+    PlasmaGraphMaxTiles = 4   // tiles of a task
+};
+
+typedef struct plasma_graph_task_s plasma_graph_task_t;
+
+// Runs the kernel of the task on its tiles, outputs first.
+typedef void (*plasma_graph_kernel_t)(const plasma_graph_task_t *task,
+                                      void **tiles,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request);
+
+struct plasma_graph_task_s {
+    plasma_graph_kernel_t kernel;  ///< kernel of the task
+    plasma_enum_t param[4];        ///< side, uplo, trans, diag of the kernel
+    int dim[8];                    ///< dimensions and leading dimensions
+    plasma_complex64_t alpha;      ///< scalars, in the widest precision
+    plasma_complex64_t beta;
+    int num_tiles;                 ///< number of tiles
+    int num_out;                   ///< number of output tiles, first
+    int desc[PlasmaGraphMaxTiles];       ///< descriptor of each tile
+    size_t offset[PlasmaGraphMaxTiles];  ///< offset of each tile, in bytes
+    int pred;                      ///< first predecessor in preds
+    int num_preds;                 ///< number of predecessors
+    int writer;                    ///< last task writing its first output
+                                   ///  tile before it, or -1
+};
+
+// Last accesses to a tile during the capture.
+typedef struct {
+    const void *tile;  ///< address of the tile, NULL if the entry is free
+    int writer;        ///< last task writing the tile, or -1
+    int reader;        ///< last reader since, in the list of readers, or -1
+} plasma_graph_tile_t;
+
+typedef struct {
+    int num_descs;
+    plasma_desc_t descs[PlasmaGraphMaxDescs];  ///< descriptors captured
+
+    int num_tasks;
+    int max_tasks;
+    plasma_graph_task_t *tasks;  ///< tasks in the order of the capture
+
+    int num_preds;
+    int max_preds;
+    int *preds;                  ///< predecessors of the tasks
+    int *succ_start;             ///< first successor of each task in succs,
+                                 ///  num_tasks+1 entries
+    int *succs;                  ///< successors of the tasks
+
+    // capture only
+    int status;                  ///< first error of the capture
+    int num_entries;
+    int max_entries;             ///< a power of two
+    plasma_graph_tile_t *entries;
+    int num_readers;
+    int max_readers;
+    int *readers;                ///< lists of readers of the tiles,
+                                 ///  pairs of a task and the next reader
+} plasma_graph_t;
+
+// Graph capturing the tasks of the calling thread, or NULL.
+extern __thread plasma_graph_t *plasma_graph_capture;
+
+/******************************************************************************/
+// Records the task in the graph capturing the calling thread. The variable
+// arguments are the addresses of its tiles, the num_out outputs first.
+#define PLASMA_GRAPH_ADD(task, num_out, ...) \
+    do { \
+        const void *plasma_graph_tiles[] = {__VA_ARGS__}; \
+        plasma_graph_add(&(task), num_out, \
+                         sizeof(plasma_graph_tiles)/sizeof(void*), \
+                         plasma_graph_tiles); \
+    } while (0)
+
+/******************************************************************************/
+int  plasma_graph_begin(plasma_graph_t *graph,
+                        int num_descs, const plasma_desc_t *descs);
+int  plasma_graph_end(plasma_graph_t *graph);
+int  plasma_graph_destroy(plasma_graph_t *graph);
+
+void plasma_graph_add(plasma_graph_task_t *task,
+                      int num_out, int num_tiles, const void **tiles);
+
+void plasma_omp_graph_replay(plasma_graph_t *graph,
+                             int num_descs, const plasma_desc_t *descs,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_GRAPH_H
@@ -10,6 +10,10 @@
 #ifndef ICL_PLASMA_INTERNAL_H
 #define ICL_PLASMA_INTERNAL_H
 
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_runtime.h"
+
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -35,6 +39,85 @@ static inline int imax(int a, int b)
         return b;
 }
 
+/******************************************************************************/
+static inline size_t szmax(size_t a, size_t b)
+{
+    if (a > b)
+        return a;
+    else
+        return b;
+}
+
+/******************************************************************************/
+/***************************************************************************//**
+    Returns the number of bits of the tile indices 0 to mt-1, the smallest
+    b with mt <= 2^b.
+*/
+static inline int plasma_morton_bits(int mt)
+{
+    int bits = 0;
+    while ((1 << bits) < mt)
+        bits++;
+    return bits;
+}
+
+/***************************************************************************//**
+    Returns the tile (m, n) at position z of the Morton (Z) order of a grid
+    of 2^mbits-by-2^nbits tiles. The low bits of m and n alternate in z,
+    those of m first, and the high bits of the longer dimension follow, so
+    that the grid is covered by a row or column of Morton squares. Tiles
+    close in the order are close in the grid, at all scales.
+*/
+static inline void plasma_morton_tile(int z, int mbits, int nbits,
+                                      int *m, int *n)
+{
+    int bits = imin(mbits, nbits);
+    *m = 0;
+    *n = 0;
+    for (int b = 0; b < bits; b++) {
+        *m |= ((z >> (2*b))   & 1) << b;
+        *n |= ((z >> (2*b+1)) & 1) << b;
+    }
+    if (mbits > nbits)
+        *m |= (z >> (2*bits)) << bits;
+    else
+        *n |= (z >> (2*bits)) << bits;
+}
+
+/***************************************************************************//**
+    A problem of a variable-size batch. The large problems are tiled across
+    the threads, with their tile matrices and sequence, and the small ones
+    are packed into tasks running them sequentially.
+*/
+typedef struct {
+    double cost;                 ///< flops of the problem
+    int index;                   ///< position of the problem in the batch
+    int large;                   ///< 1 for the tile algorithm
+    int num_descs;               ///< number of tile matrices in desc
+    plasma_desc_t desc[3];       ///< tile matrices of a large problem
+    plasma_sequence_t *sequence; ///< sequence of a large problem
+    plasma_request_t request;    ///< request of a large problem
+} plasma_batch_item_t;
+
+int plasma_batch_schedule(plasma_batch_item_t *items, int count,
+                          int nb, int num_threads, int *chunk);
+
+void plasma_batch_destroy(plasma_batch_item_t *items, int num_large);
+
+/***************************************************************************//**
+    The number of systems of an interleaved batch solved together, one per
+    vector lane, by the batched tridiagonal and band solvers.
+*/
+#define PLASMA_BATCH_LANES 64
+
+void plasma_pge2desc_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pdesc2ge_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -45,5 +128,6 @@ static inline int imax(int a, int b)
 #include "plasma_internal_c.h"
 #include "plasma_internal_z.h"
 #include "plasma_internal_zc.h"
+#include "plasma_internal_sb.h"
 
 #endif // ICL_PLASMA_INTERNAL_H
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/plasma_internal_z.h, normal z -> c, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_internal_z.h, normal z -> c, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_INTERNAL_C_H
@@ -16,6 +16,7 @@
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "plasma_c.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,21 +30,56 @@ void plasma_pscamax(plasma_enum_t colrow,
 void plasma_pcgbtrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcdesc_generate(plasma_cgenerator_t generator, void *args,
+                            plasma_desc_t A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pcdesc2ge(plasma_desc_t A,
                       plasma_complex32_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pcdesc2ge_getrf(plasma_desc_t A,
+                            plasma_complex32_t *pA, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pcdesc2pb(plasma_desc_t A,
                       plasma_complex32_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pcgbhrd(int n, int kd, plasma_complex32_t *A, int lda,
+                    plasma_complex32_t *V, plasma_complex32_t *tau,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgbhrd_q(int n, int kd,
+                      const plasma_complex32_t *V,
+                      const plasma_complex32_t *tau,
+                      plasma_complex32_t *Q, int ldq,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcge2desc(plasma_complex32_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pcge2desc_colwise(plasma_complex32_t *pA, int lda,
+                              plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_pcge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                    plasma_complex32_t *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcge2hb(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcgeadd(plasma_enum_t transa,
                     plasma_complex32_t alpha,  plasma_desc_t A,
                     plasma_complex32_t beta,   plasma_desc_t B,
@@ -63,26 +99,127 @@ void plasma_pcgemm(plasma_enum_t transa, plasma_enum_t transb,
                    plasma_complex32_t beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex32_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex32_t beta,  plasma_desc_t C,
+                            const plasma_cepilogue_t *epilogue,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pcgemm_strassen(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex32_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex32_t beta,  plasma_desc_t C,
+                            plasma_desc_t *W, int levels,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pcgemm_splitk(plasma_enum_t transa, plasma_enum_t transb,
+                          plasma_complex32_t alpha, plasma_desc_t A,
+                                                    plasma_desc_t B,
+                          plasma_complex32_t beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pcgemmt(plasma_enum_t uplo,
+                    plasma_enum_t transa, plasma_enum_t transb,
+                    plasma_complex32_t alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                    plasma_complex32_t beta,  plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcgeqrf_rhs(plasma_desc_t A, plasma_desc_t T, plasma_desc_t B,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcgeqrfrh(plasma_desc_t A, plasma_desc_t T,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_pcgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_pcgerbt(plasma_enum_t side, plasma_enum_t trans,
+                    const float *U, int depth, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgeresid(plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, float *work, float *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgesv(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgetri_gj(plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgetri_aux(plasma_desc_t A,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pcgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pcgetrf_left(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+int plasma_pcgetrf_panel(plasma_desc_t A, int *ipiv, int ib,
+                         plasma_enum_t panel_mode,
+                         plasma_enum_t team, plasma_enum_t bind,
+                         int num_threads, int priority,
+                         plasma_panel_workspace_t *work);
+
+void plasma_pcgtsv(plasma_complex32_t *dl, plasma_complex32_t *d,
+                   plasma_complex32_t *du, plasma_desc_t B,
+                   plasma_complex32_t *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcgtsv_reduced(plasma_desc_t B, const plasma_complex32_t *VW,
+                           plasma_complex32_t *work, int *iwork,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pche2hb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                    plasma_complex32_t *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pchegst(int itype, plasma_enum_t uplo,
+                    plasma_desc_t A, plasma_desc_t B,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pchemm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_complex32_t beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pchetrf_aasen(plasma_desc_t A, int *ipiv,
+                          plasma_desc_t T, plasma_desc_t H,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pcheresid(plasma_enum_t uplo,
+                      plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, float *work, float *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcher2k(plasma_enum_t uplo, plasma_enum_t trans,
                     plasma_complex32_t alpha, plasma_desc_t A,
                                               plasma_desc_t B,
@@ -94,9 +231,20 @@ void plasma_pcherk(plasma_enum_t uplo, plasma_enum_t trans,
                    float beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcherk_splitk(plasma_enum_t uplo, plasma_enum_t trans,
+                          float alpha, plasma_desc_t A,
+                          float beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pclacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pclacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                        plasma_desc_t A,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pclange(plasma_enum_t norm,
                     plasma_desc_t A, float *work, float *value,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -127,9 +275,22 @@ void plasma_pclaswp(plasma_enum_t colrow,
                     plasma_desc_t A, int *ipiv, int incx,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pclaswp_trsm(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void plasma_pclaswp_trsm_step(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                              int k,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pclauum(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pclrpotrf(plasma_desc_t A, float tol,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcpb2desc(plasma_complex32_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
@@ -138,9 +299,41 @@ void plasma_pcpb2desc(plasma_complex32_t *pA, int lda,
 void plasma_pcpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcpipeline(plasma_cpipeline_t pipeline,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcplghe(float bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcplgsy(plasma_complex32_t bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcplrnt(unsigned long long seed, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcpotrf_update(plasma_enum_t uplo, int sign,
+                           plasma_desc_t A, plasma_desc_t V, plasma_desc_t G,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pcpotri(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcpstrf(plasma_desc_t A, int *piv, int *rank, float tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pcptsv(float *d, plasma_complex32_t *e, plasma_desc_t B,
+                   plasma_complex32_t *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pcsymm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -165,27 +358,64 @@ void plasma_pctbsm(plasma_enum_t side, plasma_enum_t uplo,
                    const int *ipiv,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pctile_structure(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pctpmqrt(plasma_enum_t trans,
+                     plasma_desc_t B, plasma_desc_t T,
+                     plasma_desc_t C, plasma_desc_t D,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pctpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pctradd(plasma_enum_t uplo, plasma_enum_t transa,
                     plasma_complex32_t alpha,  plasma_desc_t A,
                     plasma_complex32_t beta,   plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pctranspose(plasma_enum_t trans, plasma_desc_t A, plasma_desc_t B,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pctrmm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pctrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                    plasma_enum_t trans, plasma_enum_t diag,
+                    plasma_complex32_t alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                                              plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pctrsm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pctrsmpl(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                     plasma_desc_t B,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pctrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                    plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pctrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pctrtri_work(plasma_enum_t uplo, plasma_enum_t diag,
+                         plasma_desc_t A, plasma_desc_t W,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pcunglq(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -222,6 +452,14 @@ void plasma_pcunmqrrh(plasma_enum_t side, plasma_enum_t trans,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+/******************************************************************************/
+int plasma_clacon(plasma_enum_t uplo, plasma_enum_t trans,
+                  plasma_desc_t A, float *est);
+
+int plasma_cpipeline_append(plasma_cpipeline_t *pipeline,
+                            plasma_cpipeline_op_t op,
+                            const plasma_desc_t *A, plasma_desc_t B);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
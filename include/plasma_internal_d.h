@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/plasma_internal_z.h, normal z -> d, Mon Feb  6 14:06:44 2017
+ * @generated from include/plasma_internal_z.h, normal z -> d, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_INTERNAL_D_H
@@ -16,6 +16,7 @@
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "plasma_d.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,21 +30,56 @@ void plasma_pdamax(plasma_enum_t colrow,
 void plasma_pdgbtrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pddesc_generate(plasma_dgenerator_t generator, void *args,
+                            plasma_desc_t A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pddesc2ge(plasma_desc_t A,
                       double *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pddesc2ge_getrf(plasma_desc_t A,
+                            double *pA, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pddesc2pb(plasma_desc_t A,
                       double *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pdgbhrd(int n, int kd, double *A, int lda,
+                    double *V, double *tau,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgbhrd_q(int n, int kd,
+                      const double *V,
+                      const double *tau,
+                      double *Q, int ldq,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdge2desc(double *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pdge2desc_colwise(double *pA, int lda,
+                              plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_pdge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                    double *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdge2hb(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdgeadd(plasma_enum_t transa,
                     double alpha,  plasma_desc_t A,
                     double beta,   plasma_desc_t B,
@@ -63,26 +99,127 @@ void plasma_pdgemm(plasma_enum_t transa, plasma_enum_t transb,
                    double beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            double beta,  plasma_desc_t C,
+                            const plasma_depilogue_t *epilogue,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pdgemm_strassen(plasma_enum_t transa, plasma_enum_t transb,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            double beta,  plasma_desc_t C,
+                            plasma_desc_t *W, int levels,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pdgemm_splitk(plasma_enum_t transa, plasma_enum_t transb,
+                          double alpha, plasma_desc_t A,
+                                                    plasma_desc_t B,
+                          double beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pdgemmt(plasma_enum_t uplo,
+                    plasma_enum_t transa, plasma_enum_t transb,
+                    double alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                    double beta,  plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdgeqrf_rhs(plasma_desc_t A, plasma_desc_t T, plasma_desc_t B,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdgeqrfrh(plasma_desc_t A, plasma_desc_t T,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_pdgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_pdgerbt(plasma_enum_t side, plasma_enum_t trans,
+                    const double *U, int depth, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgeresid(plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, double *work, double *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgesv(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgetri_gj(plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgetri_aux(plasma_desc_t A,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pdgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pdgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pdgetrf_left(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+int plasma_pdgetrf_panel(plasma_desc_t A, int *ipiv, int ib,
+                         plasma_enum_t panel_mode,
+                         plasma_enum_t team, plasma_enum_t bind,
+                         int num_threads, int priority,
+                         plasma_panel_workspace_t *work);
+
+void plasma_pdgtsv(double *dl, double *d,
+                   double *du, plasma_desc_t B,
+                   double *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdgtsv_reduced(plasma_desc_t B, const double *VW,
+                           double *work, int *iwork,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pdsy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                    double *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdsygst(int itype, plasma_enum_t uplo,
+                    plasma_desc_t A, plasma_desc_t B,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdsymm(plasma_enum_t side, plasma_enum_t uplo,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    double beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdsytrf_aasen(plasma_desc_t A, int *ipiv,
+                          plasma_desc_t T, plasma_desc_t H,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pdsyresid(plasma_enum_t uplo,
+                      plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, double *work, double *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                     double alpha, plasma_desc_t A,
                                               plasma_desc_t B,
@@ -94,9 +231,20 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                    double beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdsyrk_splitk(plasma_enum_t uplo, plasma_enum_t trans,
+                          double alpha, plasma_desc_t A,
+                          double beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pdlacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                        plasma_desc_t A,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdlange(plasma_enum_t norm,
                     plasma_desc_t A, double *work, double *value,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -127,9 +275,22 @@ void plasma_pdlaswp(plasma_enum_t colrow,
                     plasma_desc_t A, int *ipiv, int incx,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdlaswp_trsm(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void plasma_pdlaswp_trsm_step(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                              int k,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pdlauum(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdlrpotrf(plasma_desc_t A, double tol,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdpb2desc(double *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
@@ -138,9 +299,41 @@ void plasma_pdpb2desc(double *pA, int lda,
 void plasma_pdpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdpipeline(plasma_dpipeline_t pipeline,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdplgsy(double bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdplgsy(double bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdplrnt(unsigned long long seed, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdpotrf_update(plasma_enum_t uplo, int sign,
+                           plasma_desc_t A, plasma_desc_t V, plasma_desc_t G,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pdpotri(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdptsv(double *d, double *e, plasma_desc_t B,
+                   double *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdsymm(plasma_enum_t side, plasma_enum_t uplo,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -165,27 +358,64 @@ void plasma_pdtbsm(plasma_enum_t side, plasma_enum_t uplo,
                    const int *ipiv,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdtile_structure(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pdtpmqrt(plasma_enum_t trans,
+                     plasma_desc_t B, plasma_desc_t T,
+                     plasma_desc_t C, plasma_desc_t D,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdtpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdtradd(plasma_enum_t uplo, plasma_enum_t transa,
                     double alpha,  plasma_desc_t A,
                     double beta,   plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdtranspose(plasma_enum_t trans, plasma_desc_t A, plasma_desc_t B,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdtrmm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdtrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                    plasma_enum_t trans, plasma_enum_t diag,
+                    double alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                                              plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdtrsm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdtrsmpl(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                     plasma_desc_t B,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdtrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                    plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pdtrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdtrtri_work(plasma_enum_t uplo, plasma_enum_t diag,
+                         plasma_desc_t A, plasma_desc_t W,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pdorglq(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -222,6 +452,14 @@ void plasma_pdormqrrh(plasma_enum_t side, plasma_enum_t trans,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+/******************************************************************************/
+int plasma_dlacon(plasma_enum_t uplo, plasma_enum_t trans,
+                  plasma_desc_t A, double *est);
+
+int plasma_dpipeline_append(plasma_dpipeline_t *pipeline,
+                            plasma_dpipeline_op_t op,
+                            const plasma_desc_t *A, plasma_desc_t B);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/plasma_internal_zc.h, mixed zc -> ds, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_internal_zc.h, mixed zc -> ds, Thu Oct 15 05:47:15 2026
  *
  **/
 #ifndef ICL_PLASMA_INTERNAL_DS_H
@@ -25,9 +25,37 @@ extern "C" {
 void plasma_pdlag2s(plasma_desc_t A, plasma_desc_t As,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdge2desc_lag2c(double *pA, int lda,
+                            plasma_desc_t A, plasma_desc_t As,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pslag2d(plasma_desc_t As, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdsgetrf(plasma_desc_t A, plasma_desc_t As, int *ipiv, int bf16,
+                     double *work, double *Anorm,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdsgesv_refine(plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                           int bf16, const double *Anorm,
+                           plasma_desc_t B, plasma_desc_t X,
+                           plasma_desc_t Xs, plasma_desc_t R,
+                           double *work, double *Rnorm, double *Xnorm,
+                           int *iter,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pdspotrf(plasma_enum_t uplo, plasma_desc_t A,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pdsgmres(plasma_enum_t uplo,
+                     plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                     plasma_desc_t R, plasma_desc_t X, plasma_desc_t Xs,
+                     int restart,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from include/plasma_internal_z.h, normal z -> s, Mon Feb  6 14:06:44 2017
+ * @generated from include/plasma_internal_z.h, normal z -> s, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_INTERNAL_S_H
@@ -16,6 +16,7 @@
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "plasma_s.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,21 +30,56 @@ void plasma_psamax(plasma_enum_t colrow,
 void plasma_psgbtrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_psdesc_generate(plasma_sgenerator_t generator, void *args,
+                            plasma_desc_t A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_psdesc2ge(plasma_desc_t A,
                       float *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_psdesc2ge_getrf(plasma_desc_t A,
+                            float *pA, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_psdesc2pb(plasma_desc_t A,
                       float *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_psgbhrd(int n, int kd, float *A, int lda,
+                    float *V, float *tau,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgbhrd_q(int n, int kd,
+                      const float *V,
+                      const float *tau,
+                      float *Q, int ldq,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_psge2desc(float *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_psge2desc_colwise(float *pA, int lda,
+                              plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_psge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                    float *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psge2hb(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_psgeadd(plasma_enum_t transa,
                     float alpha,  plasma_desc_t A,
                     float beta,   plasma_desc_t B,
@@ -63,26 +99,127 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                    float beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_psgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            float beta,  plasma_desc_t C,
+                            const plasma_sepilogue_t *epilogue,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_psgemm_strassen(plasma_enum_t transa, plasma_enum_t transb,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            float beta,  plasma_desc_t C,
+                            plasma_desc_t *W, int levels,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_psgemm_splitk(plasma_enum_t transa, plasma_enum_t transb,
+                          float alpha, plasma_desc_t A,
+                                                    plasma_desc_t B,
+                          float beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_psgemmt(plasma_enum_t uplo,
+                    plasma_enum_t transa, plasma_enum_t transb,
+                    float alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                    float beta,  plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_psgeqrf_rhs(plasma_desc_t A, plasma_desc_t T, plasma_desc_t B,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_psgeqrfrh(plasma_desc_t A, plasma_desc_t T,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_psgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_psgerbt(plasma_enum_t side, plasma_enum_t trans,
+                    const float *U, int depth, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgeresid(plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, float *work, float *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgesv(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgetri_gj(plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgetri_aux(plasma_desc_t A,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_psgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_psgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_psgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_psgetrf_left(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+int plasma_psgetrf_panel(plasma_desc_t A, int *ipiv, int ib,
+                         plasma_enum_t panel_mode,
+                         plasma_enum_t team, plasma_enum_t bind,
+                         int num_threads, int priority,
+                         plasma_panel_workspace_t *work);
+
+void plasma_psgtsv(float *dl, float *d,
+                   float *du, plasma_desc_t B,
+                   float *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psgtsv_reduced(plasma_desc_t B, const float *VW,
+                           float *work, int *iwork,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pssy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                    float *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pssygst(int itype, plasma_enum_t uplo,
+                    plasma_desc_t A, plasma_desc_t B,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pssymm(plasma_enum_t side, plasma_enum_t uplo,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    float beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pssytrf_aasen(plasma_desc_t A, int *ipiv,
+                          plasma_desc_t T, plasma_desc_t H,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pssyresid(plasma_enum_t uplo,
+                      plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, float *work, float *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pssyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                     float alpha, plasma_desc_t A,
                                               plasma_desc_t B,
@@ -94,9 +231,20 @@ void plasma_pssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                    float beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pssyrk_splitk(plasma_enum_t uplo, plasma_enum_t trans,
+                          float alpha, plasma_desc_t A,
+                          float beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pslacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pslacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                        plasma_desc_t A,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pslange(plasma_enum_t norm,
                     plasma_desc_t A, float *work, float *value,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -127,9 +275,22 @@ void plasma_pslaswp(plasma_enum_t colrow,
                     plasma_desc_t A, int *ipiv, int incx,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pslaswp_trsm(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void plasma_pslaswp_trsm_step(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                              int k,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pslauum(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pslrpotrf(plasma_desc_t A, float tol,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pspb2desc(float *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
@@ -138,9 +299,41 @@ void plasma_pspb2desc(float *pA, int lda,
 void plasma_pspbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pspipeline(plasma_spipeline_t pipeline,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psplgsy(float bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psplgsy(float bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psplrnt(unsigned long long seed, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pspotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pspotrf_update(plasma_enum_t uplo, int sign,
+                           plasma_desc_t A, plasma_desc_t V, plasma_desc_t G,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pspotri(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pspstrf(plasma_desc_t A, int *piv, int *rank, float tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psptsv(float *d, float *e, plasma_desc_t B,
+                   float *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pssymm(plasma_enum_t side, plasma_enum_t uplo,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -165,27 +358,64 @@ void plasma_pstbsm(plasma_enum_t side, plasma_enum_t uplo,
                    const int *ipiv,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pstile_structure(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pstpmqrt(plasma_enum_t trans,
+                     plasma_desc_t B, plasma_desc_t T,
+                     plasma_desc_t C, plasma_desc_t D,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pstpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pstradd(plasma_enum_t uplo, plasma_enum_t transa,
                     float alpha,  plasma_desc_t A,
                     float beta,   plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pstranspose(plasma_enum_t trans, plasma_desc_t A, plasma_desc_t B,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pstrmm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pstrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                    plasma_enum_t trans, plasma_enum_t diag,
+                    float alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                                              plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pstrsm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pstrsmpl(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                     plasma_desc_t B,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pstrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                    plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pstrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pstrtri_work(plasma_enum_t uplo, plasma_enum_t diag,
+                         plasma_desc_t A, plasma_desc_t W,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_psorglq(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -222,6 +452,14 @@ void plasma_psormqrrh(plasma_enum_t side, plasma_enum_t trans,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+/******************************************************************************/
+int plasma_slacon(plasma_enum_t uplo, plasma_enum_t trans,
+                  plasma_desc_t A, float *est);
+
+int plasma_spipeline_append(plasma_spipeline_t *pipeline,
+                            plasma_spipeline_op_t op,
+                            const plasma_desc_t *A, plasma_desc_t B);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,32 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_INTERNAL_SB_H
+#define ICL_PLASMA_INTERNAL_SB_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void plasma_psbgetrf(plasma_desc_t A, int *ipiv,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_psbpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_INTERNAL_SB_H
@@ -16,6 +16,7 @@
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "plasma_z.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,21 +30,56 @@ void plasma_pdzamax(plasma_enum_t colrow,
 void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzdesc_generate(plasma_zgenerator_t generator, void *args,
+                            plasma_desc_t A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pzdesc2ge(plasma_desc_t A,
                       plasma_complex64_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pzdesc2ge_getrf(plasma_desc_t A,
+                            plasma_complex64_t *pA, int lda,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pzdesc2pb(plasma_desc_t A,
                       plasma_complex64_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pzgbhrd(int n, int kd, plasma_complex64_t *A, int lda,
+                    plasma_complex64_t *V, plasma_complex64_t *tau,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgbhrd_q(int n, int kd,
+                      const plasma_complex64_t *V,
+                      const plasma_complex64_t *tau,
+                      plasma_complex64_t *Q, int ldq,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pzge2desc_colwise(plasma_complex64_t *pA, int lda,
+                              plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_pzge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                    plasma_complex64_t *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzge2hb(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzgeadd(plasma_enum_t transa,
                     plasma_complex64_t alpha,  plasma_desc_t A,
                     plasma_complex64_t beta,   plasma_desc_t B,
@@ -63,26 +99,127 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                    plasma_complex64_t beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex64_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex64_t beta,  plasma_desc_t C,
+                            const plasma_zepilogue_t *epilogue,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pzgemm_strassen(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex64_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex64_t beta,  plasma_desc_t C,
+                            plasma_desc_t *W, int levels,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_pzgemm_splitk(plasma_enum_t transa, plasma_enum_t transb,
+                          plasma_complex64_t alpha, plasma_desc_t A,
+                                                    plasma_desc_t B,
+                          plasma_complex64_t beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pzgemmt(plasma_enum_t uplo,
+                    plasma_enum_t transa, plasma_enum_t transb,
+                    plasma_complex64_t alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                    plasma_complex64_t beta,  plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzgeqrf_rhs(plasma_desc_t A, plasma_desc_t T, plasma_desc_t B,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzgeqrfrh(plasma_desc_t A, plasma_desc_t T,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_pzgerbt(plasma_enum_t side, plasma_enum_t trans,
+                    const double *U, int depth, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgeresid(plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, double *work, double *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgesv(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgetri_gj(plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgetri_aux(plasma_desc_t A,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzgetrf_nopiv(plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pzgetrf_left(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+int plasma_pzgetrf_panel(plasma_desc_t A, int *ipiv, int ib,
+                         plasma_enum_t panel_mode,
+                         plasma_enum_t team, plasma_enum_t bind,
+                         int num_threads, int priority,
+                         plasma_panel_workspace_t *work);
+
+void plasma_pzgtsv(plasma_complex64_t *dl, plasma_complex64_t *d,
+                   plasma_complex64_t *du, plasma_desc_t B,
+                   plasma_complex64_t *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgtsv_reduced(plasma_desc_t B, const plasma_complex64_t *VW,
+                           plasma_complex64_t *work, int *iwork,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzhe2hb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                    plasma_complex64_t *AB, int ldab,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzhegst(int itype, plasma_enum_t uplo,
+                    plasma_desc_t A, plasma_desc_t B,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_complex64_t beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzhetrf_aasen(plasma_desc_t A, int *ipiv,
+                          plasma_desc_t T, plasma_desc_t H,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
+void plasma_pzheresid(plasma_enum_t uplo,
+                      plasma_desc_t A, plasma_desc_t X, plasma_desc_t B,
+                      plasma_desc_t R, double *work, double *values,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzher2k(plasma_enum_t uplo, plasma_enum_t trans,
                     plasma_complex64_t alpha, plasma_desc_t A,
                                               plasma_desc_t B,
@@ -94,9 +231,20 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                    double beta,  plasma_desc_t C,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzherk_splitk(plasma_enum_t uplo, plasma_enum_t trans,
+                          double alpha, plasma_desc_t A,
+                          double beta,  plasma_desc_t C,
+                          plasma_desc_t *W, int splits,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pzlacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzlacpy_sym(plasma_enum_t uplo, plasma_enum_t trans,
+                        plasma_desc_t A,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzlange(plasma_enum_t norm,
                     plasma_desc_t A, double *work, double *value,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -127,9 +275,22 @@ void plasma_pzlaswp(plasma_enum_t colrow,
                     plasma_desc_t A, int *ipiv, int incx,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzlaswp_trsm(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
+void plasma_pzlaswp_trsm_step(plasma_desc_t A, int *ipiv, plasma_desc_t B,
+                              int k,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pzlauum(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzlrpotrf(plasma_desc_t A, double tol,
+                      plasma_workspace_t work,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzpb2desc(plasma_complex64_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
@@ -138,9 +299,41 @@ void plasma_pzpb2desc(plasma_complex64_t *pA, int lda,
 void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzpipeline(plasma_zpipeline_t pipeline,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzplghe(double bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzplgsy(plasma_complex64_t bump, unsigned long long seed,
+                    plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzplrnt(unsigned long long seed, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzpotrf_update(plasma_enum_t uplo, int sign,
+                           plasma_desc_t A, plasma_desc_t V, plasma_desc_t G,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzpotri(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzptsv(double *d, plasma_complex64_t *e, plasma_desc_t B,
+                   plasma_complex64_t *work, int *iwork,
+                   plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pzsymm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -165,27 +358,64 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                    const int *ipiv,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztile_structure(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pztpmqrt(plasma_enum_t trans,
+                     plasma_desc_t B, plasma_desc_t T,
+                     plasma_desc_t C, plasma_desc_t D,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pztpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pztradd(plasma_enum_t uplo, plasma_enum_t transa,
                     plasma_complex64_t alpha,  plasma_desc_t A,
                     plasma_complex64_t beta,   plasma_desc_t B,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztranspose(plasma_enum_t trans, plasma_desc_t A, plasma_desc_t B,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                    plasma_enum_t trans, plasma_enum_t diag,
+                    plasma_complex64_t alpha, plasma_desc_t A,
+                                              plasma_desc_t B,
+                                              plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_enum_t trans, plasma_enum_t diag,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
                    plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztrsmpl(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                     plasma_desc_t B,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pztrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                    plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pztrtri_work(plasma_enum_t uplo, plasma_enum_t diag,
+                         plasma_desc_t A, plasma_desc_t W,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pzunglq(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
@@ -222,6 +452,14 @@ void plasma_pzunmqrrh(plasma_enum_t side, plasma_enum_t trans,
                       plasma_workspace_t work,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+/******************************************************************************/
+int plasma_zlacon(plasma_enum_t uplo, plasma_enum_t trans,
+                  plasma_desc_t A, double *est);
+
+int plasma_zpipeline_append(plasma_zpipeline_t *pipeline,
+                            plasma_zpipeline_op_t op,
+                            const plasma_desc_t *A, plasma_desc_t B);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -25,9 +25,37 @@ extern "C" {
 void plasma_pzlag2c(plasma_desc_t A, plasma_desc_t As,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzge2desc_lag2c(plasma_complex64_t *pA, int lda,
+                            plasma_desc_t A, plasma_desc_t As,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
 void plasma_pclag2z(plasma_desc_t As, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pzcgetrf(plasma_desc_t A, plasma_desc_t As, int *ipiv, int bf16,
+                     double *work, double *Anorm,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzcgesv_refine(plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                           int bf16, const double *Anorm,
+                           plasma_desc_t B, plasma_desc_t X,
+                           plasma_desc_t Xs, plasma_desc_t R,
+                           double *work, double *Rnorm, double *Xnorm,
+                           int *iter,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_pzcpotrf(plasma_enum_t uplo, plasma_desc_t A,
+                     plasma_workspace_t work,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzcgmres(plasma_enum_t uplo,
+                     plasma_desc_t A, plasma_desc_t As, int *ipiv,
+                     plasma_desc_t R, plasma_desc_t X, plasma_desc_t Xs,
+                     int restart,
+                     plasma_sequence_t *sequence, plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
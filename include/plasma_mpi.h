@@ -0,0 +1,57 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_MPI_H
+#define ICL_PLASMA_MPI_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    Tile communication of the matrices distributed over MPI processes, with
+    -DPLASMA_WITH_MPI and plasma_desc_distribute.
+
+    Every process submits the same tasks of a tile algorithm, and runs the
+    ones writing its tiles. The tiles its tasks read from other processes
+    are received into its copy of the matrix, by tasks writing them, and
+    sent by tasks of the owner reading them, so the transfers follow the
+    tile dependencies. Each transfer is a point-to-point message, tagged
+    by the position of the tile, on a communicator of PLASMA; the receiving
+    tasks wait for their message, yielding the thread.
+
+    Each process allocates the whole matrix, of which it keeps its tiles
+    and the copies of the tiles received.
+
+    Without PLASMA_WITH_MPI, or for a matrix not distributed, the functions
+    do nothing.
+*/
+int plasma_mpi_init(void);
+void plasma_mpi_finalize(void);
+
+void plasma_tile_owners(plasma_desc_t A, int m1, int m2, int n1, int n2,
+                        char *ranks);
+
+void plasma_omp_tile_bcast(plasma_desc_t A, int m, int n, int root,
+                           char *ranks,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
+void plasma_mpi_bcast(plasma_desc_t A, void *buf, int count,
+                      plasma_enum_t type, int root);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_MPI_H
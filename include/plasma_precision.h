@@ -0,0 +1,66 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_PRECISION_H
+#define ICL_PLASMA_PRECISION_H
+
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ *  Precision layer of the kernels written once for several precisions,
+ *  in the preprocessor instead of by tools/codegen.py.
+ *
+ *  A kernel is written as a macro of the precision prefixes s, d, c or z
+ *  it works on, e.g. CORE_LAG2_INPLACE(from, to, wide), using:
+ *
+ *  - PLASMA_TYPE(p), the element type of the precision p,
+ *  - PLASMA_REAL(p), the real type of the precision p,
+ *  - PLASMA_PRECISION(p), the PlasmaRealFloat, ... constant of p,
+ *  - PLASMA_COMPLEX(p), 1 for the complex precisions c and z, else 0,
+ *  - PLASMA_NAME(prefix, p, name), the name of the routine of precision p,
+ *    e.g. PLASMA_NAME(core_, z, gemm) is core_zgemm,
+ *
+ *  and instantiated for each combination in one source file. The branches
+ *  on sizeof(), PLASMA_COMPLEX(), ... are constants folded by the compiler,
+ *  so each instance gets the inner loops of its own precisions, and mixed
+ *  combinations only need one more instantiation.
+ *
+ ******************************************************************************/
+#define PLASMA_CAT(a, b) PLASMA_CAT_(a, b)
+#define PLASMA_CAT_(a, b) a##b
+
+#define PLASMA_TYPE_s float
+#define PLASMA_TYPE_d double
+#define PLASMA_TYPE_c plasma_complex32_t
+#define PLASMA_TYPE_z plasma_complex64_t
+
+#define PLASMA_REAL_s float
+#define PLASMA_REAL_d double
+#define PLASMA_REAL_c float
+#define PLASMA_REAL_z double
+
+#define PLASMA_PRECISION_s PlasmaRealFloat
+#define PLASMA_PRECISION_d PlasmaRealDouble
+#define PLASMA_PRECISION_c PlasmaComplexFloat
+#define PLASMA_PRECISION_z PlasmaComplexDouble
+
+#define PLASMA_COMPLEX_s 0
+#define PLASMA_COMPLEX_d 0
+#define PLASMA_COMPLEX_c 1
+#define PLASMA_COMPLEX_z 1
+
+#define PLASMA_TYPE(p)      PLASMA_CAT(PLASMA_TYPE_, p)
+#define PLASMA_REAL(p)      PLASMA_CAT(PLASMA_REAL_, p)
+#define PLASMA_PRECISION(p) PLASMA_CAT(PLASMA_PRECISION_, p)
+#define PLASMA_COMPLEX(p)   PLASMA_CAT(PLASMA_COMPLEX_, p)
+
+#define PLASMA_NAME(prefix, p, name) PLASMA_CAT(PLASMA_CAT(prefix, p), name)
+
+#endif // ICL_PLASMA_PRECISION_H
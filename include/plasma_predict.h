@@ -0,0 +1,71 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_PREDICT_H
+#define ICL_PLASMA_PREDICT_H
+
+#include "plasma_context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Performance model predicting the time of a call before running it, for
+ *  PLASMA built with -DPLASMA_WITH_TRACE, e.g., by plasma_predict_zpotrf().
+ *
+ *  The model holds, by kernel name, e.g., "zgemm", and tile size nb, the
+ *  rate of the kernel in flop/s and its time per task, measured by the task
+ *  counters of plasma_stats_get() over calibration runs. The routines are
+ *  calibrated on their first prediction at an nb, by a call on at most
+ *  PlasmaPredictCalibrationTiles tiles per dimension.
+ *
+ *  A prediction records the task graph of the call in a dry run, costs each
+ *  task by the model of its kernel at the closest nb, or at the rate of the
+ *  gemm of its precision if its kernel was not calibrated, and bounds the
+ *  time of the call on P threads by
+ *
+ *      work/P + span,
+ *
+ *  with the work the sum of the costs of the tasks and the span the cost of
+ *  the critical path. The layout translations of the LAPACK interface are
+ *  not counted.
+ *
+ *  The model is shared by the contexts of all threads. A prediction starts
+ *  the task counters and a dry run anew, forgetting those of the caller.
+ **/
+enum {
+    PlasmaPredictMaxKernels = 512,
+    PlasmaPredictMaxRoutines = 128,
+    PlasmaPredictMaxName = 32,
+    PlasmaPredictCalibrationTiles = 8
+};
+
+/******************************************************************************/
+int plasma_predict_record(const char *routine);
+int plasma_predict_calibrated(const char *routine);
+void plasma_predict_clear();
+
+int plasma_predict_calibrate_begin(plasma_enum_t *stats);
+int plasma_predict_calibrate_end(const char *routine, plasma_enum_t stats);
+int plasma_predict_run_begin(plasma_enum_t *dry_run);
+int plasma_predict_run_end(plasma_enum_t dry_run, plasma_time_t *time);
+
+int plasma_predict_desc_create(plasma_enum_t precision, int mb, int nb,
+                               int m, int n, plasma_desc_t *A);
+int plasma_predict_descT_create(plasma_desc_t A, int ib,
+                                plasma_enum_t householder_mode,
+                                plasma_enum_t storev, plasma_desc_t *T);
+void plasma_predict_desc_destroy(plasma_desc_t *A);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_PREDICT_H
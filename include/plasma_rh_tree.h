@@ -10,6 +10,9 @@
 #ifndef ICL_PLASMA_RH_TREE_H
 #define ICL_PLASMA_RH_TREE_H
 
+#include "plasma_context.h"
+#include "plasma_types.h"
+
 enum {
     PlasmaGeKernel = 1,
     PlasmaTtKernel = 2,
@@ -55,7 +58,10 @@ static inline void plasma_rh_tree_get_operation(int *operations,
     *rowpiv = operations[ind_op*4+3];
 }
 
-void plasma_rh_tree_operations(int mt, int nt,
+plasma_enum_t plasma_householder_mode(plasma_context_t *plasma, int mt, int nt);
+void plasma_rh_tree_operations(plasma_context_t *plasma, int mt, int nt,
                                int **operations, int *num_operations);
+void plasma_rh_tree_release(plasma_context_t *plasma, int *operations);
+void plasma_rh_tree_cache_clear(plasma_context_t *plasma);
 
 #endif // ICL_PLASMA_RH_TREE_H
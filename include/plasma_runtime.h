@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_RUNTIME_H
+#define ICL_PLASMA_RUNTIME_H
+
+#include "plasma_async.h"
+
+/***************************************************************************//**
+    Task submission of the nested tile algorithms, for the runtime backends.
+
+    The default backend is OpenMP. An outer task holds the dependencies of
+    its nested tasks until its taskwait, and the weak dependencies are
+    plain ones.
+
+    With PLASMA_WITH_OMPSS2 (OmpSs-2 over nanos6, mcc --ompss-2), the
+    dependencies of a task are released when its nested tasks complete, so
+    the nested taskwaits go away. A weak dependency only connects the
+    nested tasks to the outer ones, so those may start before the outer
+    task's strong dependencies on other data are satisfied.
+
+    A commutative dependency orders the task after the previous tasks
+    writing the data and before the next ones, but only excludes, without
+    ordering, the other tasks of consecutive commutative dependencies on the
+    same data, as for accumulations in any order. It is the OmpSs-2
+    commutative, the OpenMP 5.0 mutexinoutset, also in GCC 9 and later,
+    or a plain inout in older compilers.
+
+    Dependencies are given as (array, first element, number of elements):
+
+        PLASMA_TASK(PLASMA_IN(a, 0, lda*n) PLASMA_INOUT(b, 0, ldb*n)
+                    PLASMA_PRIORITY(p))
+        {
+            ...
+            PLASMA_TASKWAIT_NESTED();
+        }
+*/
+#define PLASMA_PRAGMA_EXPAND(x) PLASMA_PRAGMA(x)
+
+#if defined(PLASMA_WITH_OMPSS2)
+#define PLASMA_TASK(clauses)      PLASMA_PRAGMA_EXPAND(oss task clauses)
+#define PLASMA_TASKWAIT()         PLASMA_PRAGMA(oss taskwait)
+#define PLASMA_TASKWAIT_NESTED()
+
+#define PLASMA_IN(a, i, n)        in(a[i;n])
+#define PLASMA_OUT(a, i, n)       out(a[i;n])
+#define PLASMA_INOUT(a, i, n)     inout(a[i;n])
+#define PLASMA_WEAK_IN(a, i, n)   weakin(a[i;n])
+#define PLASMA_WEAK_INOUT(a, i, n) weakinout(a[i;n])
+#define PLASMA_COMMUTE(a, i, n)   commutative(a[i;n])
+#define PLASMA_PRIORITY(p)        priority(p)
+#else
+#define PLASMA_TASK(clauses)      PLASMA_PRAGMA_EXPAND(omp task clauses)
+#define PLASMA_TASKWAIT()         PLASMA_PRAGMA(omp taskwait)
+#define PLASMA_TASKWAIT_NESTED()  PLASMA_PRAGMA(omp taskwait)
+
+#define PLASMA_IN(a, i, n)        depend(in:a[i:n])
+#define PLASMA_OUT(a, i, n)       depend(out:a[i:n])
+#define PLASMA_INOUT(a, i, n)     depend(inout:a[i:n])
+#define PLASMA_WEAK_IN(a, i, n)   depend(in:a[i:n])
+#define PLASMA_WEAK_INOUT(a, i, n) depend(inout:a[i:n])
+#if _OPENMP >= 201811 || (defined(__GNUC__) && !defined(__clang__) && \
+                          __GNUC__ >= 9)
+#define PLASMA_COMMUTE(a, i, n)   depend(mutexinoutset:a[i:n])
+#else
+#define PLASMA_COMMUTE(a, i, n)   depend(inout:a[i:n])
+#endif
+#define PLASMA_PRIORITY(p)        priority(p)
+#endif
+
+#endif // ICL_PLASMA_RUNTIME_H
@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from include/plasma_z.h, normal z -> s, Mon Feb  6 14:06:45 2017
+ * @generated from include/plasma_z.h, normal z -> s, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef ICL_PLASMA_S_H
@@ -16,12 +16,88 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/***************************************************************************//**
+ *  Generator of the mb-by-nb block T, with leading dimension ldt,
+ *  starting at the element (i, j) of a matrix in tile layout.
+ **/
+typedef void (*plasma_sgenerator_t)(int i, int j, int mb, int nb,
+                                    float *T, int ldt,
+                                    void *args);
+
+/***************************************************************************//**
+ *  Element-wise operation of a fused pipeline, applied to the m-by-n tile B
+ *  with the tile A of the source, if any. uplo is the part of the tile
+ *  to update and diag tells whether the tile is on the diagonal.
+ **/
+typedef struct plasma_spipeline_op_s plasma_spipeline_op_t;
+
+typedef void (*plasma_spipeline_kernel_t)(const plasma_spipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb);
+
+struct plasma_spipeline_op_s {
+    plasma_spipeline_kernel_t kernel;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    float alpha;
+    float beta;
+    float cfrom;
+    float cto;
+    int a;  ///< operand of the source, or -1
+    int b;  ///< operand updated
+};
+
+/***************************************************************************//**
+ *  Sequence of element-wise tile operations run as one task per tile,
+ *  recorded by the plasma_spipeline_* functions.
+ **/
+typedef struct {
+    int num_ops;
+    int num_operands;
+    plasma_spipeline_op_t ops[PlasmaPipelineMaxOps];
+    plasma_desc_t operands[PlasmaPipelineMaxOperands];
+    int written[PlasmaPipelineMaxOperands];
+    int read_trans[PlasmaPipelineMaxOperands];
+} plasma_spipeline_t;
+
+/***************************************************************************//**
+ *  Element-wise function of a gemm epilogue, applied to the m-by-n block C,
+ *  with leading dimension ldc, starting at the element (i, j) of the
+ *  product.
+ **/
+typedef void (*plasma_sepilogue_func_t)(int i, int j, int m, int n,
+                                        float *C, int ldc,
+                                        void *args);
+
+/***************************************************************************//**
+ *  Epilogue of plasma_sgemm_epilogue, applied to each tile of C by the task
+ *  of its last product,
+ *
+ *    C(i,j) = func( act( row_scale(i)*col_scale(j)*C(i,j)
+ *                        + row_bias(i) + col_bias(j) ) ).
+ *
+ *  The NULL vectors and function are skipped, so that an epilogue
+ *  initialized to zero leaves the product as is.
+ **/
+typedef struct {
+    const float *row_scale;  ///< of length m, or NULL
+    const float *col_scale;  ///< of length n, or NULL
+    const float *row_bias;   ///< of length m, or NULL
+    const float *col_bias;   ///< of length n, or NULL
+    plasma_enum_t activation;             ///< PlasmaActivation*
+    plasma_sepilogue_func_t func;
+    void *args;
+} plasma_sepilogue_t;
+
 /***************************************************************************//**
  *  Standard interface.
  **/
@@ -33,6 +109,11 @@ int plasma_sgbsv(int n, int kl, int ku, int nrhs,
                  float *pAB, int ldab, int *ipiv,
                  float *pB,  int ldb);
 
+int plasma_sgbsv_batched(int n, int kl, int ku, int nrhs,
+                         float *pAB, int ldab, int *ipiv,
+                         float *pB,
+                         int batch_count, int *info);
+
 int plasma_sgbtrf(int m, int n, int kl, int ku,
                   float *pA, int lda, int *ipiv);
 
@@ -46,6 +127,16 @@ int plasma_sgeadd(plasma_enum_t transa,
                   float alpha, float *pA, int lda,
                   float beta,  float *pB, int ldb);
 
+int plasma_sgecon(plasma_enum_t norm, int n,
+                  float *pA, int lda,
+                  float Anorm, float *rcond);
+
+int plasma_sgeexp(int n, float *pA, int lda);
+
+int plasma_sgehrd(plasma_enum_t jobq, int n,
+                  float *pA, int lda,
+                  float *pQ, int ldq);
+
 int plasma_sgelqf(int m, int n,
                   float *pA, int lda,
                   plasma_desc_t *T);
@@ -67,10 +158,77 @@ int plasma_sgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            float *pB, int ldb,
                  float beta,  float *pC, int ldc);
 
+int plasma_sgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                          int m, int n, int k,
+                          float alpha,
+                          float *pA, int lda,
+                          float *pB, int ldb,
+                          float beta,
+                          float *pC, int ldc,
+                          const plasma_sepilogue_t *epilogue);
+
+int plasma_sgemm_opts(plasma_enum_t transa, plasma_enum_t transb,
+                      int m, int n, int k,
+                      float alpha, float *pA, int lda,
+                                                float *pB, int ldb,
+                      float beta,  float *pC, int ldc,
+                      const plasma_options_t *options);
+
+int plasma_sgemm_batched(plasma_enum_t transa, plasma_enum_t transb,
+                         int m, int n, int k,
+                         float alpha,
+                         float **pA, int lda,
+                         float **pB, int ldb,
+                         float beta,
+                         float **pC, int ldc,
+                         int batch_count);
+
+int plasma_sgemm_vbatched(plasma_enum_t transa, plasma_enum_t transb,
+                          const int *m, const int *n, const int *k,
+                          float alpha,
+                          float **pA, const int *lda,
+                          float **pB, const int *ldb,
+                          float beta,
+                          float **pC, const int *ldc,
+                          int batch_count);
+
+int plasma_sgemmt(plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t transb,
+                  int n, int k,
+                  float alpha, float *pA, int lda,
+                                            float *pB, int ldb,
+                  float beta,  float *pC, int ldc);
+
+int plasma_sgepolar(int m, int n,
+                    float *pA, int lda,
+                    float *pH, int ldh);
+
+int plasma_sgeqp3(int m, int n,
+                  float *pA, int lda, int *jpvt,
+                  plasma_desc_t *T);
+
 int plasma_sgeqrf(int m, int n,
                   float *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_sgeqrf_opts(int m, int n,
+                       float *pA, int lda,
+                       plasma_desc_t *T,
+                       const plasma_options_t *options);
+
+int plasma_sgeqrf_batched(int m, int n,
+                          float **pA, int lda,
+                          float **ptau,
+                          int batch_count);
+
+int plasma_sgeqrf_cholqr(int m, int n,
+                         float *pA, int lda,
+                         float *pR, int ldr);
+
+int plasma_sgeqrf_lowrank(int m, int n, int k, int p, int niter,
+                          float *pA, int lda,
+                          plasma_desc_t *Q, plasma_desc_t *B);
+
 int plasma_sgeqrs(int m, int n, int nrhs,
                   float *pA, int lda,
                   plasma_desc_t T,
@@ -80,9 +238,46 @@ int plasma_sgesv(int n, int nrhs,
                  float *pA, int lda, int *ipiv,
                  float *pB, int ldb);
 
+int plasma_sgesv_rbt(int n, int nrhs,
+                     float *pA, int lda,
+                     float *pB, int ldb,
+                     float *pX, int ldx, int *iter);
+
+int plasma_sgesvd(plasma_enum_t jobu, plasma_enum_t jobvt, int m, int n,
+                  float *pA, int lda, float *S,
+                  float *pU, int ldu,
+                  float *pVT, int ldvt);
+
+int plasma_sgesvd_randomized(int m, int n, int k, int p, int niter,
+                             float *pA, int lda, float *S,
+                             float *pU, int ldu,
+                             float *pVT, int ldvt);
+
 int plasma_sgetrf(int m, int n,
                   float *pA, int lda, int *ipiv);
 
+int plasma_sgetrf_incpiv(int m, int n,
+                         float *pA, int lda,
+                         plasma_desc_t *L, int **ipiv);
+
+int plasma_sgetrf_opts(int m, int n,
+                       float *pA, int lda, int *ipiv,
+                       const plasma_options_t *options);
+
+int plasma_sgetrf_batched(int m, int n,
+                          float **pA, int lda, int **ipiv,
+                          int batch_count, int *info);
+
+int plasma_sgetrf_vbatched(const int *m, const int *n,
+                           float **pA, const int *lda,
+                           int **ipiv, int batch_count, int *info);
+
+int plasma_sgetrf_partial(int m, int n, int k,
+                          float *pA, int lda, int *ipiv);
+
+int plasma_sgetrf_handle_create(int n, float *pA, int lda,
+                                plasma_getrf_handle_t *handle);
+
 int plasma_sgetri(int n, float *pA, int lda, int *ipiv);
 
 int plasma_sgetri_aux(int n, float *pA, int lda);
@@ -91,6 +286,37 @@ int plasma_sgetrs(int n, int nrhs,
                   float *pA, int lda, int *ipiv,
                   float *pB, int ldb);
 
+int plasma_sgetrs_incpiv(int n, int nrhs,
+                         float *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         float *pB, int ldb);
+
+int plasma_sgetrs_handle(plasma_getrf_handle_t handle, int nrhs,
+                         float *pB, int ldb);
+
+int plasma_sgtsv(int n, int nrhs,
+                 float *dl, float *d,
+                 float *du,
+                 float *pB, int ldb);
+
+int plasma_sgtsv_batched(int n, int nrhs,
+                         float *dl, float *d,
+                         float *du, float *pB,
+                         int batch_count, int *info);
+
+int plasma_ssyev(plasma_enum_t jobz, plasma_enum_t uplo, int n,
+                 float *pA, int lda, float *W);
+
+int plasma_ssysv(plasma_enum_t uplo, int n, int nrhs,
+                 float *pA, int lda, int *ipiv,
+                 float *pT, int ldt, int *ipiv2,
+                 float *pB, int ldb);
+
+int plasma_ssygst(int itype, plasma_enum_t uplo,
+                  int n,
+                  float *pA, int lda,
+                  float *pB, int ldb);
+
 int plasma_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  float alpha, float *pA, int lda,
@@ -108,6 +334,15 @@ int plasma_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  float alpha, float *pA, int lda,
                  float beta,  float *pC, int ldc);
 
+int plasma_ssytrf(plasma_enum_t uplo, int n,
+                  float *pA, int lda, int *ipiv,
+                  float *pT, int ldt, int *ipiv2);
+
+int plasma_ssytrs(plasma_enum_t uplo, int n, int nrhs,
+                  float *pA, int lda, int *ipiv,
+                  float *pT, int ldt, int *ipiv2,
+                  float *pB, int ldb);
+
 int plasma_slacpy(plasma_enum_t uplo,
                   int m, int n,
                   float *pA, int lda,
@@ -147,6 +382,8 @@ int plasma_slaswp(plasma_enum_t colrow,
 int plasma_slauum(plasma_enum_t uplo, int n,
                   float *pA, int lda);
 
+int plasma_slrpotrf(int n, float *pA, int lda, float tol);
+
 int plasma_spbsv(plasma_enum_t uplo,
                  int n, int kd, int nrhs,
                  float *pAB, int ldab,
@@ -161,6 +398,22 @@ int plasma_spbtrs(plasma_enum_t uplo,
                   float *pAB, int ldab,
                   float *pB,  int ldb);
 
+int plasma_splgsy(float bump, int n,
+                  float *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_splgsy(float bump, int n,
+                  float *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_splrnt(int m, int n,
+                  float *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_spocon(plasma_enum_t uplo, int n,
+                  float *pA, int lda,
+                  float Anorm, float *rcond);
+
 int plasma_sposv(plasma_enum_t uplo,
                  int n, int nrhs,
                  float *pA, int lda,
@@ -170,6 +423,30 @@ int plasma_spotrf(plasma_enum_t uplo,
                   int n,
                   float *pA, int lda);
 
+int plasma_spotrf_opts(plasma_enum_t uplo,
+                       int n,
+                       float *pA, int lda,
+                       const plasma_options_t *options);
+
+int plasma_spotrf_update(plasma_enum_t uplo, int sign, int n, int k,
+                         float *pA, int lda,
+                         float *pV, int ldv);
+
+int plasma_spotrf_partial(plasma_enum_t uplo, int n, int k,
+                          float *pA, int lda);
+
+int plasma_spotrf_sparse(plasma_enum_t uplo,
+                         int n,
+                         float *pA, int lda);
+
+int plasma_spotrf_batched(plasma_enum_t uplo, int n,
+                          float **pA, int lda,
+                          int batch_count, int *info);
+
+int plasma_spotrf_vbatched(plasma_enum_t uplo, const int *n,
+                           float **pA, const int *lda,
+                           int batch_count, int *info);
+
 int plasma_spotri(plasma_enum_t uplo,
                   int n,
                   float *pA, int lda);
@@ -179,6 +456,18 @@ int plasma_spotrs(plasma_enum_t uplo,
                   float *pA, int lda,
                   float *pB, int ldb);
 
+int plasma_spstrf(int n, float *pA, int lda,
+                  int *piv, int *rank, float tol);
+
+int plasma_sptsv(int n, int nrhs,
+                 float *d, float *e,
+                 float *pB, int ldb);
+
+int plasma_sptsv_batched(int n, int nrhs,
+                         float *d, float *e,
+                         float *pB,
+                         int batch_count, int *info);
+
 int plasma_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  float alpha, float *pA, int lda,
@@ -196,23 +485,48 @@ int plasma_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  float alpha, float *pA, int lda,
                  float beta,  float *pC, int ldc);
 
+int plasma_stpqrt(int m, int n, int nrhs,
+                  float *pR, int ldr,
+                  float *pB, int ldb,
+                  float *pC, int ldc,
+                  float *pD, int ldd,
+                  plasma_desc_t *T);
+
 int plasma_stradd(plasma_enum_t uplo, plasma_enum_t transa,
                   int m, int n,
                   float alpha, float *pA, int lda,
                   float beta,  float *pB, int ldb);
 
+int plasma_stranspose(plasma_enum_t trans,
+                      int m, int n,
+                      float *pA, int lda,
+                      float *pB, int ldb);
+
 int plasma_strmm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  float alpha, float *pA, int lda,
                                            float *pB, int ldb);
 
+int plasma_strmm3(plasma_enum_t side, plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t diag,
+                  int m, int n,
+                  float alpha, float *pA, int lda,
+                                            float *pB, int ldb,
+                                            float *pC, int ldc);
+
 int plasma_strsm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  float alpha, float *pA, int lda,
                                            float *pB, int ldb);
 
+int plasma_strsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                  int m, int n,
+                  float *pA, int lda,
+                  float *pB, int ldb,
+                  float *pC, int ldc);
+
 int plasma_strtri(plasma_enum_t uplo, plasma_enum_t diag,
                   int n, float *pA, int lda);
 
@@ -238,6 +552,70 @@ int plasma_sormqr(plasma_enum_t side, plasma_enum_t trans,
                   plasma_desc_t T,
                   float *pC, int ldc);
 
+/***************************************************************************//**
+ *  Tile synchronous interface.
+ **/
+int plasma_sdesc_create(int m, int n,
+                        plasma_sgenerator_t generator, void *args,
+                        plasma_desc_t *A);
+
+int plasma_sdesc2ge_sub(plasma_desc_t A, int i, int j, int m, int n,
+                        float *pA, int lda);
+
+int plasma_sge2desc_sub(int i, int j, int m, int n,
+                        float *pA, int lda, plasma_desc_t A);
+
+int plasma_sgecon_tile(plasma_enum_t norm, plasma_desc_t A,
+                       float Anorm, float *rcond);
+
+int plasma_sgemm_tile(plasma_enum_t transa, plasma_enum_t transb,
+                      float alpha, plasma_desc_t A,
+                                                plasma_desc_t B,
+                      float beta,  plasma_desc_t C);
+
+int plasma_sgeqrf_tile(plasma_desc_t A, plasma_desc_t *T);
+
+int plasma_sgesv_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+int plasma_sgetrf_tile(plasma_desc_t A, int *ipiv);
+
+int plasma_sgetrs_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+void plasma_spipeline_init(plasma_spipeline_t *pipeline);
+
+int plasma_spipeline_geadd(plasma_spipeline_t *pipeline, plasma_enum_t transa,
+                           float alpha, plasma_desc_t A,
+                           float beta,  plasma_desc_t B);
+
+int plasma_spipeline_lacpy(plasma_spipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_desc_t A, plasma_desc_t B);
+
+int plasma_spipeline_lascl(plasma_spipeline_t *pipeline, plasma_enum_t uplo,
+                           float cfrom, float cto, plasma_desc_t A);
+
+int plasma_spipeline_laset(plasma_spipeline_t *pipeline, plasma_enum_t uplo,
+                           float alpha, float beta,
+                           plasma_desc_t A);
+
+int plasma_spipeline_run(plasma_spipeline_t *pipeline);
+
+int plasma_spipeline_tradd(plasma_spipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_enum_t transa,
+                           float alpha, plasma_desc_t A,
+                           float beta,  plasma_desc_t B);
+
+int plasma_spocon_tile(plasma_enum_t uplo, plasma_desc_t A,
+                       float Anorm, float *rcond);
+
+int plasma_sposv_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_spotrf_tile(plasma_enum_t uplo, plasma_desc_t A);
+
+int plasma_spotrs_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_strsyl_tile(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C);
+
 /***************************************************************************//**
  *  Tile asynchronous interface.
  **/
@@ -260,6 +638,11 @@ void plasma_omp_sdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_sdesc_generate(plasma_sgenerator_t generator, void *args,
+                               plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_sdesc2pb(plasma_desc_t A,
                          float *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -270,6 +653,15 @@ void plasma_omp_sge2desc(float *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_sge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                       float *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_sge2hb(plasma_desc_t A, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_sgeadd(plasma_enum_t transa,
                        float alpha, plasma_desc_t A,
                        float beta,  plasma_desc_t B,
@@ -294,10 +686,37 @@ void plasma_omp_sgemm(plasma_enum_t transa, plasma_enum_t transb,
                       float beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_sgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                               float alpha, plasma_desc_t A,
+                                                         plasma_desc_t B,
+                               float beta,  plasma_desc_t C,
+                               const plasma_sepilogue_t *epilogue,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_sgemmt(plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t transb,
+                       float alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                       float beta,  plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_sgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_sgeqrf(plasma_desc_t A, plasma_desc_t T,
                        plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_sgeqrf_lowrank(int niter, plasma_desc_t A,
+                               plasma_desc_t Q, plasma_desc_t B,
+                               plasma_desc_t Y, plasma_desc_t TY,
+                               plasma_desc_t Z, plasma_desc_t TZ,
+                               plasma_desc_t W, plasma_workspace_t work,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_sgeqrs(plasma_desc_t A, plasma_desc_t T,
                        plasma_desc_t B, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -306,19 +725,55 @@ void plasma_omp_sgesv(plasma_desc_t A, int *ipiv,
                       plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_sgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          float *U, float *V, int *ipiv,
+                          float *work, float *Rnorm, float *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_sgetrf(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_sgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
+void plasma_omp_sgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_sgetrf_partial(int k, plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_sgetri(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_sgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_omp_sgetri_aux(plasma_desc_t A,
                            plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_sgetrs(plasma_desc_t A, int *ipiv,
                        plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_sgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_sgtsv(float *dl, float *d,
+                      float *du, plasma_desc_t B,
+                      float *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_ssy2sb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                       float *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_ssygst(int itype, plasma_enum_t uplo,
+                       plasma_desc_t A, plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                       float alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -336,6 +791,10 @@ void plasma_omp_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       float beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ssytrf(plasma_enum_t uplo, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t T, plasma_desc_t H,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_slacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -375,6 +834,11 @@ void plasma_omp_slauum(plasma_enum_t uplo,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_slrpotrf(plasma_desc_t A, float tol,
+                         plasma_workspace_t work, float *norms,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_omp_spb2desc(float *pA, int lda,
                          plasma_desc_t A,
                          plasma_sequence_t *sequence,
@@ -389,18 +853,50 @@ void plasma_omp_spbtrf(plasma_enum_t uplo, plasma_desc_t AB,
 void plasma_omp_spbtrs(plasma_enum_t uplo, plasma_desc_t AB, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_spipeline_run(plasma_spipeline_t *pipeline,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_splgsy(float bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_splgsy(float bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_splrnt(unsigned long long seed, plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_sposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_spotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_spotrf_partial(plasma_enum_t uplo, int k, plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_spotrf_update(plasma_enum_t uplo, int sign,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_desc_t G,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_spotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_spotrs(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_spstrf(plasma_desc_t A, int *piv, int *rank, float tol,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_sptsv(float *d, float *e, plasma_desc_t B,
+                      float *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                       float alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -418,23 +914,49 @@ void plasma_omp_ssyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       float beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_stpmqrt(plasma_enum_t trans,
+                        plasma_desc_t B, plasma_desc_t T,
+                        plasma_desc_t C, plasma_desc_t D,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_stpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_stradd(plasma_enum_t uplo, plasma_enum_t transa,
                        float alpha, plasma_desc_t A,
                        float beta,  plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t  *request);
 
+void plasma_omp_stranspose(plasma_enum_t trans, plasma_desc_t A,
+                           plasma_desc_t B,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_omp_strmm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       float alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_strmm3(plasma_enum_t side, plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t diag,
+                       float alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                                                 plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_strsm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       float alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_strsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_strtri(plasma_enum_t uplo, plasma_enum_t diag,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -457,6 +979,15 @@ void plasma_omp_sormqr(plasma_enum_t side, plasma_enum_t trans,
                        plasma_desc_t C, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+/***************************************************************************//**
+ *  Performance prediction.
+ **/
+int plasma_predict_sgeqrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_sgetrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_spotrf(plasma_enum_t uplo, int n, plasma_time_t *time);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,66 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_SESSION_H
+#define ICL_PLASMA_SESSION_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Sessions: one persistent parallel region, into which the application
+ *  submits independent sequences of plasma_omp_* calls, from outside any
+ *  parallel region, and waits for each of them later, so that the tasks
+ *  of small or poorly parallel problems fill the idle threads of the
+ *  others, instead of each call forking and joining its own region.
+ *
+ *  plasma_session_create() starts a thread, which opens the region with
+ *  the threads of plasma_num_threads() of the context of the caller, plus
+ *  itself, which sleeps until a body is submitted. Each body submitted by
+ *  plasma_session_submit() runs as a task, as in plasma_sequence_run(),
+ *  with the settings of that context, on any thread of the region. The
+ *  tasks of the bodies are scheduled together, in one task graph, and
+ *  ordered by the dependencies on their tiles only, and by the priority of
+ *  their sequences, see plasma_sequence_set_priority(). A taskwait in a
+ *  body, e.g., between a translation to tile layout and a factorization,
+ *  waits for the tasks of that body only.
+ *
+ *  The bodies call only the plasma_omp_* functions, on descriptors created
+ *  beforehand, e.g., by plasma_session_desc_create(), and on workspaces
+ *  created beforehand; the calls of the LAPACK interface, or plasma_set(),
+ *  are not made on the context while the session is open.
+ **/
+typedef struct plasma_session_s plasma_session_t;
+
+int plasma_session_create(plasma_session_t **session);
+int plasma_session_destroy(plasma_session_t *session);
+
+int plasma_session_submit(plasma_session_t *session,
+                          plasma_sequence_t *sequence,
+                          void (*body)(plasma_sequence_t *sequence, void *arg),
+                          void *arg);
+int plasma_session_wait(plasma_session_t *session,
+                        plasma_sequence_t *sequence);
+
+int plasma_session_desc_create(plasma_session_t *session,
+                               plasma_enum_t precision, int m, int n,
+                               plasma_desc_t *A);
+int plasma_session_desc_destroy(plasma_session_t *session,
+                                plasma_desc_t *A);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_SESSION_H
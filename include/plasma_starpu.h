@@ -0,0 +1,73 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_STARPU_H
+#define ICL_PLASMA_STARPU_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#if defined(PLASMA_WITH_STARPU)
+#include <starpu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+    StarPU runtime layer, with -DPLASMA_WITH_STARPU.
+
+    The tiles of a descriptor are registered as StarPU matrices for the
+    duration of a tile algorithm. The core_starpu_* functions insert the
+    codelets of the core_blas kernels, which StarPU schedules with its
+    history-based performance models (e.g., STARPU_SCHED=dmda) and moves
+    the tiles they access. Unregistering the tiles waits for the tasks.
+*/
+#define PLASMA_STARPU_TILE(handles, A, m, n) ((handles)[(size_t)(A).mt*(n)+(m)])
+
+starpu_data_handle_t *plasma_starpu_register(plasma_desc_t A);
+void plasma_starpu_unregister(plasma_desc_t A, starpu_data_handle_t *handles);
+
+/******************************************************************************/
+void core_starpu_zgemm(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex64_t alpha, starpu_data_handle_t A,
+                                                 starpu_data_handle_t B,
+                       plasma_complex64_t beta,  starpu_data_handle_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_starpu_cgemm(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex32_t alpha, starpu_data_handle_t A,
+                                                 starpu_data_handle_t B,
+                       plasma_complex32_t beta,  starpu_data_handle_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_starpu_dgemm(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       double alpha, starpu_data_handle_t A,
+                                     starpu_data_handle_t B,
+                       double beta,  starpu_data_handle_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void core_starpu_sgemm(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       float alpha, starpu_data_handle_t A,
+                                    starpu_data_handle_t B,
+                       float beta,  starpu_data_handle_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_WITH_STARPU
+
+#endif // ICL_PLASMA_STARPU_H
@@ -0,0 +1,311 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_TRACE_H
+#define ICL_PLASMA_TRACE_H
+
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#include <omp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Tracing of the tasks of the core_omp_* wrappers, built in with
+ *  -DPLASMA_WITH_TRACE and switched on by plasma_set(PlasmaTrace, PlasmaTraceOn).
+ *  Each thread records its tasks in its own ring buffer, which keeps the
+ *  last PlasmaTraceMaxEvents tasks of the thread. Tasks may nest, e.g.,
+ *  a task running another task at its taskwait.
+ **/
+enum {
+    PlasmaTraceMaxEvents = 65536,  // per thread, a power of two
+    PlasmaTraceMaxDescs  = 1024,   // a power of two
+    PlasmaTraceMaxTiles  = 4,      // depend clauses of a task
+    PlasmaTraceMaxDepth  = 16      // tasks nested on a thread
+};
+
+typedef struct {
+    const char *name;  ///< name of the kernel
+    double start;      ///< start time, from omp_get_wtime()
+    double stop;       ///< end time, from omp_get_wtime()
+    int num_tiles;     ///< number of tiles
+    int num_out;       ///< number of output tiles, first in tiles
+    const void *tiles[PlasmaTraceMaxTiles];
+                       ///< depend addresses, tiles[0] output with coordinates
+} plasma_trace_event_t;
+
+/***************************************************************************//**
+ *  Overhead of the scheduling of the tasks kept in the trace, computed by
+ *  plasma_trace_sched(). A task is ready when the last task it depends on
+ *  ends, following the depend clauses of the tasks kept, and its latency
+ *  is the time from then to its start, spent resolving its dependencies,
+ *  queued, or waiting for its submission. The latencies are counted in
+ *  buckets of powers of two from 1 microsecond.
+ **/
+enum {
+    PlasmaSchedBuckets = 16  // [0, 1us), [1us, 2us), ..., [16ms, inf)
+};
+
+typedef struct {
+    long tasks;          ///< number of tasks kept
+    double task_time;    ///< mean duration of the tasks, in seconds
+    double elapsed;      ///< from the first start to the last end of the tasks
+    double master;       ///< time of the master thread, which submits the
+                         ///< tasks, outside tasks until its last one ends
+    long ready;          ///< tasks with a dependency kept, in the histogram
+    double latency_p50;  ///< median ready to start latency, in seconds
+    double latency_p90;
+    double latency_p99;
+    long histogram[PlasmaSchedBuckets];  ///< tasks per bucket of latency
+} plasma_trace_sched_t;
+
+/***************************************************************************//**
+ *  Counters of the tasks of the core_omp_* wrappers, per kernel, built on the
+ *  same hooks and switched on by plasma_set(PlasmaStats, PlasmaStatsOn).
+ *  The busy time of a task excludes the tasks nested in it. The flops and
+ *  bytes are modeled from the dimensions of the kernels which report them.
+ **/
+enum {
+    PlasmaStatsMaxKernels = 128  // per thread, a power of two
+};
+
+enum {
+    PlasmaStatsPanel,        // panel factorizations
+    PlasmaStatsUpdate,       // trailing matrix updates
+    PlasmaStatsTranslation,  // copies and layout translation
+    PlasmaStatsOther,        // norms, scaling, ...
+    PlasmaStatsIdle          // idle time of the threads
+};
+
+typedef struct {
+    const char *name;    ///< name of the kernel
+    plasma_enum_t kind;  ///< PlasmaStatsPanel, PlasmaStatsUpdate, ...
+    long calls;          ///< number of tasks
+    double time;         ///< busy time in seconds, summed over the threads
+    double flops;        ///< modeled floating point operations
+    double bytes;        ///< modeled bytes read and written
+} plasma_stats_t;
+
+// Counters of one thread, padded to keep two threads off a cache line.
+typedef struct {
+    plasma_stats_t kernels[PlasmaStatsMaxKernels];
+    double first;  ///< start of the first task counted
+    double last;   ///< end of the last task counted
+    char pad[64];
+} plasma_stats_thread_t;
+
+/***************************************************************************//**
+ *  Live counters of the tasks of the core_omp_* wrappers, built on the same
+ *  hooks and switched on by plasma_set(PlasmaMonitor, PlasmaMonitorOn).
+ *  Each thread updates its own counters, which plasma_monitor_sample() reads
+ *  from any thread, e.g., a monitoring thread without a PLASMA context,
+ *  while the calls run.
+ **/
+typedef struct {
+    double time;         ///< time of the sample, from omp_get_wtime()
+    int threads;         ///< threads of the monitored context
+    int busy;            ///< threads running a task at the time of the sample
+    int idle;            ///< threads without a task
+    long tasks;          ///< tasks completed since the monitor was switched on
+    double busy_time;    ///< busy time of the completed tasks, in seconds
+    double flops;        ///< modeled floating point operations of the tasks
+    double gflops;       ///< rate of the flops since the previous sample
+    double utilization;  ///< busy fraction of the threads, idem
+} plasma_monitor_t;
+
+// Counters of one thread, padded to keep two threads off a cache line.
+typedef struct {
+    int running;         ///< number of running tasks, nested ones included
+    long tasks;
+    double busy_time;
+    double flops;
+    char pad[64];
+} plasma_monitor_thread_t;
+
+/***************************************************************************//**
+ *  Storage of the tile matrices and workspaces of the calls, counted when
+ *  a descriptor or workspace is created or destroyed, whether its storage
+ *  is fresh or reused from the descriptor cache or the workspace pool.
+ *  Counted in all builds, and cleared by plasma_stats_reset().
+ **/
+typedef struct {
+    size_t current;  ///< bytes in use
+    size_t peak;     ///< most bytes in use at once
+    size_t total;    ///< bytes taken, summed over the creations
+    long allocs;     ///< number of creations
+} plasma_stats_memory_t;
+
+/***************************************************************************//**
+ *  Hardware counters of the tasks, read with PAPI at the start and the end
+ *  of the tasks, built in with -DPLASMA_WITH_PAPI and -DPLASMA_WITH_TRACE.
+ *  Switched on by plasma_init() when the environment variable
+ *  PLASMA_PAPI_EVENTS lists PAPI events, e.g., PAPI_L2_TCM,PAPI_RES_STL.
+ *  The counters are summed per kernel and size of the output tile.
+ **/
+enum {
+    PlasmaPapiMaxEvents  = 8,
+    PlasmaPapiMaxKernels = 256  // per thread, a power of two
+};
+
+/***************************************************************************//**
+ *  Dry runs, switched on by plasma_set(PlasmaDryRun, PlasmaDryRunOn):
+ *  the tasks skip their kernels and record the task graph, their kernels,
+ *  tiles and modeled work, written by plasma_trace_write_dag() and
+ *  analyzed by tools/dag.c. The results of the calls are not computed.
+ **/
+
+/***************************************************************************//**
+ *  Annotations of the tasks for the timelines of VTune, with the ITT API,
+ *  and of Nsight Systems, with NVTX, built in with -DPLASMA_WITH_ITT or
+ *  -DPLASMA_WITH_NVTX, and -DPLASMA_WITH_TRACE, and switched on by
+ *  plasma_init(). Each task is a range named by its kernel and the
+ *  coordinates of its output tile, e.g., zgemm (3, 5), in one domain per
+ *  kind of kernel: panel, update, translation and other. Without these
+ *  options, the annotations compile out.
+ **/
+
+// Bits of plasma_trace_on, the hooks run when any is set.
+enum {
+    PlasmaTraceEvents   = 1,
+    PlasmaTraceStats    = 2,
+    PlasmaTracePapi     = 4,
+    PlasmaTraceDryRun   = 8,
+    PlasmaTraceMonitor  = 16,
+    PlasmaTraceAnnotate = 32
+};
+
+extern volatile int plasma_trace_on;
+
+/******************************************************************************/
+#if defined(PLASMA_WITH_TRACE)
+// The arguments are the name of the kernel and the address of the output
+// tile of the task, the first of its depend clauses, or NULL.
+#define PLASMA_TRACE_START(name, tile) \
+    do { \
+        if (plasma_trace_on) \
+            plasma_trace_begin(name, tile); \
+    } while (0)
+
+// The variable arguments are the addresses of the depend clauses of the task,
+// the num_out outputs (out and inout) first, then the inputs.
+#define PLASMA_TRACE_STOP(name, num_out, ...) \
+    do { \
+        if (plasma_trace_on) { \
+            const void *plasma_trace_tiles[] = {__VA_ARGS__}; \
+            plasma_trace_event(name, num_out, \
+                               sizeof(plasma_trace_tiles)/sizeof(void*), \
+                               plasma_trace_tiles); \
+        } \
+    } while (0)
+
+// Models the work of the task, called before PLASMA_TRACE_STOP: flops counted
+// as in real arithmetic, e.g., 2*m*n*k for gemm, and elements read and written,
+// scaled by the precision.
+#define PLASMA_TRACE_FLOPS(precision, flops, elements) \
+    do { \
+        if (plasma_trace_on & \
+            (PlasmaTraceStats | PlasmaTraceDryRun | PlasmaTraceMonitor)) \
+            plasma_trace_flops(precision, flops, elements); \
+    } while (0)
+
+// Whether the task runs its kernel: not after an error nor in a dry run.
+#define PLASMA_TRACE_RUN(sequence) \
+    ((sequence)->status == PlasmaSuccess && \
+     !(plasma_trace_on & PlasmaTraceDryRun))
+#else
+// The tiles are still referenced, as they are often only named otherwise
+// in the depend clauses of the task.
+#define PLASMA_TRACE_START(name, tile) ((void)(tile))
+#define PLASMA_TRACE_STOP(name, num_out, ...) \
+    do { \
+        const void *plasma_trace_tiles[] = {__VA_ARGS__}; \
+        (void)plasma_trace_tiles; \
+    } while (0)
+// The counts, often computed for the trace only, are referenced but not
+// evaluated.
+#define PLASMA_TRACE_FLOPS(precision, flops, elements) \
+    ((void)sizeof((flops) + (elements)))
+#define PLASMA_TRACE_RUN(sequence) ((sequence)->status == PlasmaSuccess)
+#endif
+
+/******************************************************************************/
+int  plasma_trace_enable(void);
+void plasma_trace_disable(void);
+void plasma_trace_finalize(void);
+int  plasma_trace_threads_create(int events);
+
+void plasma_trace_begin(const char *name, const void *tile);
+void plasma_trace_event(const char *name,
+                        int num_out, int num_tiles, const void **tiles);
+void plasma_trace_flops(plasma_enum_t precision,
+                        double flops, double elements);
+void plasma_trace_desc(plasma_desc_t A);
+void plasma_trace_tile(const void *tile, double time,
+                       int *m, int *n, int *mb, int *nb);
+
+int  plasma_trace_papi_init(void);
+void plasma_trace_papi_finalize(void);
+void plasma_trace_papi_begin(int thread, int depth);
+void plasma_trace_papi_end(int thread, int depth, const char *name,
+                           const void *tile, double start);
+
+int  plasma_trace_annotate_init(void);
+void plasma_trace_annotate_finalize(void);
+void plasma_trace_annotate_begin(int thread, int depth,
+                                 const char *name, const void *tile);
+void plasma_trace_annotate_end(int thread, int depth);
+
+plasma_enum_t plasma_stats_kind(const char *name);
+int  plasma_stats_enable(plasma_stats_thread_t **stats, int num_threads);
+void plasma_stats_disable(plasma_stats_thread_t *stats);
+void plasma_stats_add(int thread, const char *name,
+                      double start, double stop, double time,
+                      double flops, double bytes);
+
+int plasma_stats_get(plasma_stats_t *stats, int *num_stats);
+int plasma_stats_get_memory(plasma_stats_memory_t *memory);
+int plasma_stats_reset(void);
+
+int  plasma_monitor_enable(plasma_monitor_thread_t **monitor, int num_threads);
+void plasma_monitor_disable(plasma_monitor_thread_t *monitor);
+void plasma_monitor_begin(int thread);
+void plasma_monitor_end(int thread, double time, double flops);
+
+int plasma_monitor_sample(plasma_monitor_t *monitor);
+int plasma_monitor_write_prometheus(const char *path,
+                                    plasma_monitor_t *monitor);
+
+int plasma_trace_write_svg(const char *path);
+int plasma_trace_write_csv(const char *path);
+int plasma_trace_write_json(const char *path);
+int plasma_trace_sched(plasma_trace_sched_t *sched);
+int plasma_trace_write_papi(const char *path);
+
+int  plasma_trace_dag_enable(void);
+void plasma_trace_dag_disable(void);
+void plasma_trace_dag_finalize(void);
+void plasma_trace_dag_add(int thread, const char *name,
+                          int num_out, int num_tiles, const void **tiles,
+                          double flops, double bytes);
+int  plasma_trace_write_dag(const char *path);
+
+// Cost in seconds of a task of kernel name and modeled work.
+typedef double (*plasma_trace_cost_t)(void *arg, const char *name,
+                                      double flops, double bytes);
+int  plasma_trace_dag_eval(plasma_trace_cost_t cost, void *cost_arg,
+                           double *work, double *span);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_TRACE_H
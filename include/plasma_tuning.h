@@ -0,0 +1,92 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_TUNING_H
+#define ICL_PLASMA_TUNING_H
+
+#include "plasma_context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Database of the tuned nb, ib, num_panel_threads and mb of the routines, by
+ *  routine name, e.g., "dgetrf", and size bucket, the bit length of the
+ *  size of the problem. The LAPACK-interface drivers with entries for
+ *  their name use, for the call, those of the bucket closest to their size,
+ *  unless PlasmaTuning is PlasmaTuningOff. The parameters set by plasma_set
+ *  remain the defaults of the other routines and sizes.
+ *
+ *  The database is loaded by plasma_init() from the file in the environment
+ *  variable PLASMA_TUNING_FILE, if set, or by plasma_tuning_load(), and is
+ *  filled by the tester with --tune=file. The file has one entry per line:
+ *
+ *      routine size nb ib num_panel_threads [mb]
+ *  where mb, the tile height of the routines with rectangular tiles,
+ *  is 0 for square tiles, if omitted.
+ **/
+enum {
+    PlasmaTuningMaxEntries = 1024,
+    PlasmaTuningMaxName    = 32
+};
+
+typedef struct {
+    int nb;                 ///< PlasmaNb
+    int ib;                 ///< PlasmaIb
+    int num_panel_threads;  ///< PlasmaNumPanelThreads
+    int mb;                 ///< PlasmaMb
+} plasma_tuning_t;
+
+/***************************************************************************//**
+ *  Options of a single call of the plasma_*_opts() drivers, which override
+ *  the parameters of the context for the call only, and leave the context
+ *  as it was. The fields left PlasmaOptionDefault by plasma_options_init()
+ *  keep the values of the context. Giving nb, ib, num_panel_threads or mb
+ *  switches off the tuning database for the call.
+ **/
+enum {
+    PlasmaOptionDefault = -1
+};
+
+typedef struct {
+    int nb;                         ///< PlasmaNb
+    int ib;                         ///< PlasmaIb
+    int num_panel_threads;          ///< PlasmaNumPanelThreads
+    int lookahead;                  ///< PlasmaLookahead
+    plasma_enum_t householder_tree; ///< PlasmaHouseholderTree
+    plasma_enum_t tuning;           ///< PlasmaTuning
+    int mb;                         ///< PlasmaMb
+    plasma_enum_t gemm_hint;        ///< PlasmaGemmHint
+} plasma_options_t;
+
+/******************************************************************************/
+int plasma_tuning_load(const char *path);
+int plasma_tuning_save(const char *path);
+int plasma_tuning_set(const char *routine, int size,
+                      int nb, int ib, int num_panel_threads, int mb);
+int plasma_tuning_get(const char *routine, int size, plasma_tuning_t *tuning);
+void plasma_tuning_clear();
+
+void plasma_options_init(plasma_options_t *options);
+int plasma_options_apply(const plasma_options_t *options,
+                         plasma_options_t *saved);
+void plasma_options_restore(const plasma_options_t *saved);
+
+int plasma_tuning_init();
+void plasma_tuning_apply(plasma_context_t *plasma, const char *routine,
+                         int size, plasma_tuning_t *saved);
+void plasma_tuning_restore(plasma_context_t *plasma,
+                           const plasma_tuning_t *saved);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_TUNING_H
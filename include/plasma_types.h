@@ -11,6 +11,7 @@
 #define ICL_PLASMA_TYPES_H
 
 #include <complex.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -83,6 +84,9 @@ enum {
     PlasmaMaxNorm       = 177,
     PlasmaRealMaxNorm   = 178,
 
+    PlasmaNoVec         = 301,
+    PlasmaVec           = 302,
+
     PlasmaForward       = 391,
     PlasmaBackward      = 392,
 
@@ -101,17 +105,230 @@ enum {
     PlasmaErrorOutOfMemory,
     PlasmaErrorNullParameter,
     PlasmaErrorInternal,
-    PlasmaErrorSequence
+    PlasmaErrorSequence,
+    PlasmaErrorFileIo
 };
 
 enum {
     PlasmaInplace,
-    PlasmaOutplace
+    PlasmaOutplace,
+    PlasmaNoTranslation
 };
 
 enum {
     PlasmaFlatHouseholder,
-    PlasmaTreeHouseholder
+    PlasmaTreeHouseholder,
+    PlasmaAutoHouseholder
+};
+
+enum {
+    PlasmaAutoTree,
+    PlasmaFlatTsTree,
+    PlasmaFlatTtTree,
+    PlasmaPlasmaTree,
+    PlasmaGreedyTree,
+    PlasmaAutoForestTree
+};
+
+enum {
+    PlasmaIterativePanel,
+    PlasmaRecursivePanel,
+    PlasmaTournamentPanel
+};
+
+enum {
+    PlasmaNoPlacement,
+    PlasmaInterleavePlacement,
+    PlasmaCyclicPlacement
+};
+
+enum {
+    PlasmaColumnMajorLayout,
+    PlasmaMortonLayout,
+    PlasmaTriangularLayout,
+    PlasmaLapackLayout,
+    PlasmaSparseLayout
+};
+
+enum {
+    PlasmaMallocAllocator,
+    PlasmaAlignedAllocator,
+    PlasmaHugePageAllocator,
+    PlasmaUserAllocator
+};
+
+enum {
+    PlasmaColumnUpdate,
+    PlasmaTileUpdate
+};
+
+enum {
+    PlasmaLeftPivotingOff,
+    PlasmaLeftPivotingOn
+};
+
+enum {
+    PlasmaOffloadOff,
+    PlasmaOffloadOn
+};
+
+enum {
+    PlasmaTuningOff,
+    PlasmaTuningOn
+};
+
+enum {
+    PlasmaRightLooking,
+    PlasmaLeftLooking,
+    PlasmaHybridLooking
+};
+
+enum {
+    PlasmaClassicGemm,
+    PlasmaStrassenGemm,
+    PlasmaPackedGemm,
+    PlasmaGemm3m,
+    PlasmaOzakiGemm
+};
+
+enum {
+    PlasmaFullT,
+    PlasmaCompactT
+};
+
+enum {
+    PlasmaClassicGels,
+    PlasmaFusedGels
+};
+
+enum {
+    PlasmaClassicGetri,
+    PlasmaGaussJordanGetri
+};
+
+enum {
+    PlasmaGemmHintAuto,
+    PlasmaGemmHintNone,
+    PlasmaGemmHintRankK
+};
+
+enum {
+    PlasmaClassicRefinement,
+    PlasmaGmresRefinement
+};
+
+enum {
+    PlasmaSingleFactor,
+    PlasmaBfloat16Factor
+};
+
+enum {
+    PlasmaBufferedIo,
+    PlasmaDirectIo
+};
+
+enum {
+    PlasmaTraceOff,
+    PlasmaTraceOn
+};
+
+enum {
+    PlasmaStatsOff,
+    PlasmaStatsOn
+};
+
+enum {
+    PlasmaMonitorOff,
+    PlasmaMonitorOn
+};
+
+enum {
+    PlasmaDryRunOff,
+    PlasmaDryRunOn
+};
+
+enum {
+    PlasmaCoarseningOff,
+    PlasmaCoarseningOn
+};
+
+enum {
+    PlasmaPrefetchOff,
+    PlasmaPrefetchOn
+};
+
+enum {
+    PlasmaTileSweep,
+    PlasmaColumnSweep
+};
+
+enum {
+    PlasmaExpansionOff,
+    PlasmaExpansionOn
+};
+
+enum {
+    PlasmaTileBalanceOff,
+    PlasmaTileBalanceOn
+};
+
+enum {
+    PlasmaTileStructureOff,
+    PlasmaTileStructureOn
+};
+
+enum {
+    PlasmaSmallPathOff,
+    PlasmaSmallPathOn
+};
+
+enum {
+    PlasmaPriorityNormal,
+    PlasmaPriorityUrgent
+};
+
+enum {
+    PlasmaTileDense,
+    PlasmaTileZero,
+    PlasmaTileIdentity
+};
+
+enum {
+    PlasmaActivationNone,
+    PlasmaActivationRelu,
+    PlasmaActivationTanh
+};
+
+enum {
+    PlasmaOrderedAccumulation,
+    PlasmaCommutativeAccumulation
+};
+
+enum {
+    PlasmaDynamicScheduling,
+    PlasmaStaticScheduling
+};
+
+enum {
+    PlasmaStaticReplay,
+    PlasmaStealingReplay
+};
+
+enum {
+    PlasmaThreadTeam,
+    PlasmaTaskTeam
+};
+
+enum {
+    PlasmaBindNone,
+    PlasmaBindClose,
+    PlasmaBindSpread,
+    PlasmaBindFast
+};
+
+enum {
+    PlasmaColMajor,
+    PlasmaRowMajor
 };
 
 enum {
@@ -119,7 +336,78 @@ enum {
     PlasmaIb,
     PlasmaInplaceOutplace,
     PlasmaNumPanelThreads,
-    PlasmaHouseholderMode
+    PlasmaHouseholderMode,
+    PlasmaDescCacheSize,
+    PlasmaPanelMode,
+    PlasmaLookahead,
+    PlasmaUpdateMode,
+    PlasmaTilePlacement,
+    PlasmaAllocator,
+    PlasmaHouseholderTree,
+    PlasmaTreeDomainSize,
+    PlasmaCholeskyVariant,
+    PlasmaCholeskySwitch,
+    PlasmaTaskWindow,
+    PlasmaTrsmStream,
+    PlasmaGemmVariant,
+    PlasmaStrassenThreshold,
+    PlasmaStrassenLevels,
+    PlasmaRefinementMode,
+    PlasmaGmresRestart,
+    PlasmaFactorPrecision,
+    PlasmaTileIo,
+    PlasmaTrace,
+    PlasmaStats,
+    PlasmaDryRun,
+    PlasmaLeftPivoting,
+    PlasmaOffload,
+    PlasmaTuning,
+    PlasmaGelsVariant,
+    PlasmaTStorage,
+    PlasmaTsBlock,
+    PlasmaTileLayout,
+    PlasmaCoarsening,
+    PlasmaSweepMode,
+    PlasmaExpansion,
+    PlasmaTilePadding,
+    PlasmaMb,
+    PlasmaTileBalance,
+    PlasmaAccumulation,
+    PlasmaScheduling,
+    PlasmaPanelTeam,
+    PlasmaNumThreads,
+    PlasmaThreadBind,
+    PlasmaPanelBind,
+    PlasmaFirstCpu,
+    PlasmaPanelBlasThreads,
+    PlasmaArrayLayout,
+    PlasmaSubNb,
+    PlasmaTailTiles,
+    PlasmaGraphReplay,
+    PlasmaRhsNb,
+    PlasmaTileStructure,
+    PlasmaOzakiSlices,
+    PlasmaSmallPath,
+    PlasmaMonitor,
+    PlasmaHouseholderGroup,
+    PlasmaGetriVariant,
+    PlasmaGemmHint,
+    PlasmaPrefetch
+};
+
+enum {
+    PlasmaDescCacheMaxSize = 16,
+    PlasmaTreeCacheMaxSize = 16,
+    PlasmaStrassenMaxLevels = 4,
+    PlasmaGemmMaxSplits = 32,
+    PlasmaPipelineMaxOps = 8,
+    PlasmaPipelineMaxOperands = 4,
+    PlasmaCoarsenMaxTiles = 4,
+    PlasmaStreamTiles = 8,
+    PlasmaStreamMinMiB = 256,
+    PlasmaRhsMaxWiden = 4,
+    PlasmaOzakiMaxSlices = 16,
+    PlasmaHouseholderMaxGroup = 4
 };
 
 /******************************************************************************/
@@ -128,6 +416,11 @@ typedef int plasma_enum_t;
 typedef float  _Complex plasma_complex32_t;
 typedef double _Complex plasma_complex64_t;
 
+// hiding double from precision translation when used for taking time
+typedef double plasma_time_t;
+
+typedef uint16_t plasma_bfloat16_t; ///< bfloat16 bit pattern
+
 /******************************************************************************/
 plasma_enum_t plasma_diag_const(char lapack_char);
 plasma_enum_t plasma_direct_const(char lapack_char);
@@ -10,6 +10,7 @@
 #ifndef ICL_PLASMA_WORKSPACE_H
 #define ICL_PLASMA_WORKSPACE_H
 
+#include "plasma_allocator.h"
 #include "plasma_types.h"
 
 #include <stdlib.h>
@@ -24,14 +25,36 @@ typedef struct {
     size_t lwork;       ///< length in elements of workspace on each core
     int nthread;        ///< number of threads
     plasma_enum_t dtyp; ///< precision of the workspace
+    int pooled;         ///< borrowed from the pool of the context
 } plasma_workspace_t;
 
+typedef struct {
+    int *max_idx;      ///< array of size local pivot indices
+    void *max_val;     ///< array of size local pivot magnitudes
+    volatile int info; ///< singularity status shared by the panel threads
+    int size;          ///< number of panel threads
+    int busy;          ///< lent to a panel, see plasma_panel_workspace_acquire
+} plasma_panel_workspace_t;
+
 /******************************************************************************/
 int plasma_workspace_create(plasma_workspace_t *work, size_t lwork,
                            plasma_enum_t dtyp);
 
 int plasma_workspace_destroy(plasma_workspace_t *work);
 
+void plasma_workspace_pool_clear(plasma_workspace_t *pool,
+                                 plasma_allocator_t *allocator);
+
+int plasma_panel_workspace_create(plasma_panel_workspace_t *work, int size);
+
+int plasma_panel_workspace_destroy(plasma_panel_workspace_t *work);
+
+plasma_panel_workspace_t *plasma_panel_workspace_acquire(
+    plasma_panel_workspace_t *work);
+
+void plasma_panel_workspace_release(plasma_panel_workspace_t *work,
+                                    plasma_panel_workspace_t *lent);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
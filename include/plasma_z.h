@@ -16,12 +16,88 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/***************************************************************************//**
+ *  Generator of the mb-by-nb block T, with leading dimension ldt,
+ *  starting at the element (i, j) of a matrix in tile layout.
+ **/
+typedef void (*plasma_zgenerator_t)(int i, int j, int mb, int nb,
+                                    plasma_complex64_t *T, int ldt,
+                                    void *args);
+
+/***************************************************************************//**
+ *  Element-wise operation of a fused pipeline, applied to the m-by-n tile B
+ *  with the tile A of the source, if any. uplo is the part of the tile
+ *  to update and diag tells whether the tile is on the diagonal.
+ **/
+typedef struct plasma_zpipeline_op_s plasma_zpipeline_op_t;
+
+typedef void (*plasma_zpipeline_kernel_t)(const plasma_zpipeline_op_t *op,
+                                          plasma_enum_t uplo, int diag,
+                                          int m, int n,
+                                          void *A, int lda,
+                                          void *B, int ldb);
+
+struct plasma_zpipeline_op_s {
+    plasma_zpipeline_kernel_t kernel;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_complex64_t alpha;
+    plasma_complex64_t beta;
+    double cfrom;
+    double cto;
+    int a;  ///< operand of the source, or -1
+    int b;  ///< operand updated
+};
+
+/***************************************************************************//**
+ *  Sequence of element-wise tile operations run as one task per tile,
+ *  recorded by the plasma_zpipeline_* functions.
+ **/
+typedef struct {
+    int num_ops;
+    int num_operands;
+    plasma_zpipeline_op_t ops[PlasmaPipelineMaxOps];
+    plasma_desc_t operands[PlasmaPipelineMaxOperands];
+    int written[PlasmaPipelineMaxOperands];
+    int read_trans[PlasmaPipelineMaxOperands];
+} plasma_zpipeline_t;
+
+/***************************************************************************//**
+ *  Element-wise function of a gemm epilogue, applied to the m-by-n block C,
+ *  with leading dimension ldc, starting at the element (i, j) of the
+ *  product.
+ **/
+typedef void (*plasma_zepilogue_func_t)(int i, int j, int m, int n,
+                                        plasma_complex64_t *C, int ldc,
+                                        void *args);
+
+/***************************************************************************//**
+ *  Epilogue of plasma_zgemm_epilogue, applied to each tile of C by the task
+ *  of its last product,
+ *
+ *    C(i,j) = func( act( row_scale(i)*col_scale(j)*C(i,j)
+ *                        + row_bias(i) + col_bias(j) ) ).
+ *
+ *  The NULL vectors and function are skipped, so that an epilogue
+ *  initialized to zero leaves the product as is.
+ **/
+typedef struct {
+    const plasma_complex64_t *row_scale;  ///< of length m, or NULL
+    const plasma_complex64_t *col_scale;  ///< of length n, or NULL
+    const plasma_complex64_t *row_bias;   ///< of length m, or NULL
+    const plasma_complex64_t *col_bias;   ///< of length n, or NULL
+    plasma_enum_t activation;             ///< PlasmaActivation*
+    plasma_zepilogue_func_t func;
+    void *args;
+} plasma_zepilogue_t;
+
 /***************************************************************************//**
  *  Standard interface.
  **/
@@ -33,6 +109,11 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
                  plasma_complex64_t *pAB, int ldab, int *ipiv,
                  plasma_complex64_t *pB,  int ldb);
 
+int plasma_zgbsv_batched(int n, int kl, int ku, int nrhs,
+                         plasma_complex64_t *pAB, int ldab, int *ipiv,
+                         plasma_complex64_t *pB,
+                         int batch_count, int *info);
+
 int plasma_zgbtrf(int m, int n, int kl, int ku,
                   plasma_complex64_t *pA, int lda, int *ipiv);
 
@@ -46,6 +127,16 @@ int plasma_zgeadd(plasma_enum_t transa,
                   plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
                   plasma_complex64_t beta,  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgecon(plasma_enum_t norm, int n,
+                  plasma_complex64_t *pA, int lda,
+                  double Anorm, double *rcond);
+
+int plasma_zgeexp(int n, plasma_complex64_t *pA, int lda);
+
+int plasma_zgehrd(plasma_enum_t jobq, int n,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pQ, int ldq);
+
 int plasma_zgelqf(int m, int n,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t *T);
@@ -67,10 +158,77 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            plasma_complex64_t *pB, int ldb,
                  plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc);
 
+int plasma_zgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                          int m, int n, int k,
+                          plasma_complex64_t alpha,
+                          plasma_complex64_t *pA, int lda,
+                          plasma_complex64_t *pB, int ldb,
+                          plasma_complex64_t beta,
+                          plasma_complex64_t *pC, int ldc,
+                          const plasma_zepilogue_t *epilogue);
+
+int plasma_zgemm_opts(plasma_enum_t transa, plasma_enum_t transb,
+                      int m, int n, int k,
+                      plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
+                                                plasma_complex64_t *pB, int ldb,
+                      plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc,
+                      const plasma_options_t *options);
+
+int plasma_zgemm_batched(plasma_enum_t transa, plasma_enum_t transb,
+                         int m, int n, int k,
+                         plasma_complex64_t alpha,
+                         plasma_complex64_t **pA, int lda,
+                         plasma_complex64_t **pB, int ldb,
+                         plasma_complex64_t beta,
+                         plasma_complex64_t **pC, int ldc,
+                         int batch_count);
+
+int plasma_zgemm_vbatched(plasma_enum_t transa, plasma_enum_t transb,
+                          const int *m, const int *n, const int *k,
+                          plasma_complex64_t alpha,
+                          plasma_complex64_t **pA, const int *lda,
+                          plasma_complex64_t **pB, const int *ldb,
+                          plasma_complex64_t beta,
+                          plasma_complex64_t **pC, const int *ldc,
+                          int batch_count);
+
+int plasma_zgemmt(plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t transb,
+                  int n, int k,
+                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
+                                            plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc);
+
+int plasma_zgepolar(int m, int n,
+                    plasma_complex64_t *pA, int lda,
+                    plasma_complex64_t *pH, int ldh);
+
+int plasma_zgeqp3(int m, int n,
+                  plasma_complex64_t *pA, int lda, int *jpvt,
+                  plasma_desc_t *T);
+
 int plasma_zgeqrf(int m, int n,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_zgeqrf_opts(int m, int n,
+                       plasma_complex64_t *pA, int lda,
+                       plasma_desc_t *T,
+                       const plasma_options_t *options);
+
+int plasma_zgeqrf_batched(int m, int n,
+                          plasma_complex64_t **pA, int lda,
+                          plasma_complex64_t **ptau,
+                          int batch_count);
+
+int plasma_zgeqrf_cholqr(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_complex64_t *pR, int ldr);
+
+int plasma_zgeqrf_lowrank(int m, int n, int k, int p, int niter,
+                          plasma_complex64_t *pA, int lda,
+                          plasma_desc_t *Q, plasma_desc_t *B);
+
 int plasma_zgeqrs(int m, int n, int nrhs,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t T,
@@ -80,9 +238,46 @@ int plasma_zgesv(int n, int nrhs,
                  plasma_complex64_t *pA, int lda, int *ipiv,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgesv_rbt(int n, int nrhs,
+                     plasma_complex64_t *pA, int lda,
+                     plasma_complex64_t *pB, int ldb,
+                     plasma_complex64_t *pX, int ldx, int *iter);
+
+int plasma_zgesvd(plasma_enum_t jobu, plasma_enum_t jobvt, int m, int n,
+                  plasma_complex64_t *pA, int lda, double *S,
+                  plasma_complex64_t *pU, int ldu,
+                  plasma_complex64_t *pVT, int ldvt);
+
+int plasma_zgesvd_randomized(int m, int n, int k, int p, int niter,
+                             plasma_complex64_t *pA, int lda, double *S,
+                             plasma_complex64_t *pU, int ldu,
+                             plasma_complex64_t *pVT, int ldvt);
+
 int plasma_zgetrf(int m, int n,
                   plasma_complex64_t *pA, int lda, int *ipiv);
 
+int plasma_zgetrf_incpiv(int m, int n,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t *L, int **ipiv);
+
+int plasma_zgetrf_opts(int m, int n,
+                       plasma_complex64_t *pA, int lda, int *ipiv,
+                       const plasma_options_t *options);
+
+int plasma_zgetrf_batched(int m, int n,
+                          plasma_complex64_t **pA, int lda, int **ipiv,
+                          int batch_count, int *info);
+
+int plasma_zgetrf_vbatched(const int *m, const int *n,
+                           plasma_complex64_t **pA, const int *lda,
+                           int **ipiv, int batch_count, int *info);
+
+int plasma_zgetrf_partial(int m, int n, int k,
+                          plasma_complex64_t *pA, int lda, int *ipiv);
+
+int plasma_zgetrf_handle_create(int n, plasma_complex64_t *pA, int lda,
+                                plasma_getrf_handle_t *handle);
+
 int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv);
 
 int plasma_zgetri_aux(int n, plasma_complex64_t *pA, int lda);
@@ -91,6 +286,37 @@ int plasma_zgetrs(int n, int nrhs,
                   plasma_complex64_t *pA, int lda, int *ipiv,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zgetrs_incpiv(int n, int nrhs,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_desc_t L, int *ipiv,
+                         plasma_complex64_t *pB, int ldb);
+
+int plasma_zgetrs_handle(plasma_getrf_handle_t handle, int nrhs,
+                         plasma_complex64_t *pB, int ldb);
+
+int plasma_zgtsv(int n, int nrhs,
+                 plasma_complex64_t *dl, plasma_complex64_t *d,
+                 plasma_complex64_t *du,
+                 plasma_complex64_t *pB, int ldb);
+
+int plasma_zgtsv_batched(int n, int nrhs,
+                         plasma_complex64_t *dl, plasma_complex64_t *d,
+                         plasma_complex64_t *du, plasma_complex64_t *pB,
+                         int batch_count, int *info);
+
+int plasma_zheev(plasma_enum_t jobz, plasma_enum_t uplo, int n,
+                 plasma_complex64_t *pA, int lda, double *W);
+
+int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
+                 plasma_complex64_t *pA, int lda, int *ipiv,
+                 plasma_complex64_t *pT, int ldt, int *ipiv2,
+                 plasma_complex64_t *pB, int ldb);
+
+int plasma_zhegst(int itype, plasma_enum_t uplo,
+                  int n,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pB, int ldb);
+
 int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -108,6 +334,15 @@ int plasma_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                  double alpha, plasma_complex64_t *pA, int lda,
                  double beta,  plasma_complex64_t *pC, int ldc);
 
+int plasma_zhetrf(plasma_enum_t uplo, int n,
+                  plasma_complex64_t *pA, int lda, int *ipiv,
+                  plasma_complex64_t *pT, int ldt, int *ipiv2);
+
+int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
+                  plasma_complex64_t *pA, int lda, int *ipiv,
+                  plasma_complex64_t *pT, int ldt, int *ipiv2,
+                  plasma_complex64_t *pB, int ldb);
+
 int plasma_zlacpy(plasma_enum_t uplo,
                   int m, int n,
                   plasma_complex64_t *pA, int lda,
@@ -147,6 +382,8 @@ int plasma_zlaswp(plasma_enum_t colrow,
 int plasma_zlauum(plasma_enum_t uplo, int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zlrpotrf(int n, plasma_complex64_t *pA, int lda, double tol);
+
 int plasma_zpbsv(plasma_enum_t uplo,
                  int n, int kd, int nrhs,
                  plasma_complex64_t *pAB, int ldab,
@@ -161,6 +398,22 @@ int plasma_zpbtrs(plasma_enum_t uplo,
                   plasma_complex64_t *pAB, int ldab,
                   plasma_complex64_t *pB,  int ldb);
 
+int plasma_zplghe(double bump, int n,
+                  plasma_complex64_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_zplgsy(plasma_complex64_t bump, int n,
+                  plasma_complex64_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_zplrnt(int m, int n,
+                  plasma_complex64_t *pA, int lda,
+                  unsigned long long seed);
+
+int plasma_zpocon(plasma_enum_t uplo, int n,
+                  plasma_complex64_t *pA, int lda,
+                  double Anorm, double *rcond);
+
 int plasma_zposv(plasma_enum_t uplo,
                  int n, int nrhs,
                  plasma_complex64_t *pA, int lda,
@@ -170,6 +423,30 @@ int plasma_zpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zpotrf_opts(plasma_enum_t uplo,
+                       int n,
+                       plasma_complex64_t *pA, int lda,
+                       const plasma_options_t *options);
+
+int plasma_zpotrf_update(plasma_enum_t uplo, int sign, int n, int k,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_complex64_t *pV, int ldv);
+
+int plasma_zpotrf_partial(plasma_enum_t uplo, int n, int k,
+                          plasma_complex64_t *pA, int lda);
+
+int plasma_zpotrf_sparse(plasma_enum_t uplo,
+                         int n,
+                         plasma_complex64_t *pA, int lda);
+
+int plasma_zpotrf_batched(plasma_enum_t uplo, int n,
+                          plasma_complex64_t **pA, int lda,
+                          int batch_count, int *info);
+
+int plasma_zpotrf_vbatched(plasma_enum_t uplo, const int *n,
+                           plasma_complex64_t **pA, const int *lda,
+                           int batch_count, int *info);
+
 int plasma_zpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
@@ -179,6 +456,18 @@ int plasma_zpotrs(plasma_enum_t uplo,
                   plasma_complex64_t *pA, int lda,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zpstrf(int n, plasma_complex64_t *pA, int lda,
+                  int *piv, int *rank, double tol);
+
+int plasma_zptsv(int n, int nrhs,
+                 double *d, plasma_complex64_t *e,
+                 plasma_complex64_t *pB, int ldb);
+
+int plasma_zptsv_batched(int n, int nrhs,
+                         double *d, plasma_complex64_t *e,
+                         plasma_complex64_t *pB,
+                         int batch_count, int *info);
+
 int plasma_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -196,23 +485,48 @@ int plasma_zsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
                  plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc);
 
+int plasma_ztpqrt(int m, int n, int nrhs,
+                  plasma_complex64_t *pR, int ldr,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pC, int ldc,
+                  plasma_complex64_t *pD, int ldd,
+                  plasma_desc_t *T);
+
 int plasma_ztradd(plasma_enum_t uplo, plasma_enum_t transa,
                   int m, int n,
                   plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
                   plasma_complex64_t beta,  plasma_complex64_t *pB, int ldb);
 
+int plasma_ztranspose(plasma_enum_t trans,
+                      int m, int n,
+                      plasma_complex64_t *pA, int lda,
+                      plasma_complex64_t *pB, int ldb);
+
 int plasma_ztrmm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
                                            plasma_complex64_t *pB, int ldb);
 
+int plasma_ztrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                  plasma_enum_t transa, plasma_enum_t diag,
+                  int m, int n,
+                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
+                                            plasma_complex64_t *pB, int ldb,
+                                            plasma_complex64_t *pC, int ldc);
+
 int plasma_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
                  plasma_enum_t transa, plasma_enum_t diag,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
                                            plasma_complex64_t *pB, int ldb);
 
+int plasma_ztrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                  int m, int n,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pC, int ldc);
+
 int plasma_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                   int n, plasma_complex64_t *pA, int lda);
 
@@ -238,6 +552,70 @@ int plasma_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                   plasma_desc_t T,
                   plasma_complex64_t *pC, int ldc);
 
+/***************************************************************************//**
+ *  Tile synchronous interface.
+ **/
+int plasma_zdesc_create(int m, int n,
+                        plasma_zgenerator_t generator, void *args,
+                        plasma_desc_t *A);
+
+int plasma_zdesc2ge_sub(plasma_desc_t A, int i, int j, int m, int n,
+                        plasma_complex64_t *pA, int lda);
+
+int plasma_zge2desc_sub(int i, int j, int m, int n,
+                        plasma_complex64_t *pA, int lda, plasma_desc_t A);
+
+int plasma_zgecon_tile(plasma_enum_t norm, plasma_desc_t A,
+                       double Anorm, double *rcond);
+
+int plasma_zgemm_tile(plasma_enum_t transa, plasma_enum_t transb,
+                      plasma_complex64_t alpha, plasma_desc_t A,
+                                                plasma_desc_t B,
+                      plasma_complex64_t beta,  plasma_desc_t C);
+
+int plasma_zgeqrf_tile(plasma_desc_t A, plasma_desc_t *T);
+
+int plasma_zgesv_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+int plasma_zgetrf_tile(plasma_desc_t A, int *ipiv);
+
+int plasma_zgetrs_tile(plasma_desc_t A, int *ipiv, plasma_desc_t B);
+
+void plasma_zpipeline_init(plasma_zpipeline_t *pipeline);
+
+int plasma_zpipeline_geadd(plasma_zpipeline_t *pipeline, plasma_enum_t transa,
+                           plasma_complex64_t alpha, plasma_desc_t A,
+                           plasma_complex64_t beta,  plasma_desc_t B);
+
+int plasma_zpipeline_lacpy(plasma_zpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_desc_t A, plasma_desc_t B);
+
+int plasma_zpipeline_lascl(plasma_zpipeline_t *pipeline, plasma_enum_t uplo,
+                           double cfrom, double cto, plasma_desc_t A);
+
+int plasma_zpipeline_laset(plasma_zpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_complex64_t alpha, plasma_complex64_t beta,
+                           plasma_desc_t A);
+
+int plasma_zpipeline_run(plasma_zpipeline_t *pipeline);
+
+int plasma_zpipeline_tradd(plasma_zpipeline_t *pipeline, plasma_enum_t uplo,
+                           plasma_enum_t transa,
+                           plasma_complex64_t alpha, plasma_desc_t A,
+                           plasma_complex64_t beta,  plasma_desc_t B);
+
+int plasma_zpocon_tile(plasma_enum_t uplo, plasma_desc_t A,
+                       double Anorm, double *rcond);
+
+int plasma_zposv_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_zpotrf_tile(plasma_enum_t uplo, plasma_desc_t A);
+
+int plasma_zpotrs_tile(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B);
+
+int plasma_ztrsyl_tile(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C);
+
 /***************************************************************************//**
  *  Tile asynchronous interface.
  **/
@@ -260,6 +638,11 @@ void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_zdesc_generate(plasma_zgenerator_t generator, void *args,
+                               plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_zdesc2pb(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -270,6 +653,15 @@ void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_zge2gb(plasma_desc_t A, plasma_desc_t TU, plasma_desc_t TV,
+                       plasma_complex64_t *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zge2hb(plasma_desc_t A, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zgeadd(plasma_enum_t transa,
                        plasma_complex64_t alpha, plasma_desc_t A,
                        plasma_complex64_t beta,  plasma_desc_t B,
@@ -294,10 +686,37 @@ void plasma_omp_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                       plasma_complex64_t beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgemm_epilogue(plasma_enum_t transa, plasma_enum_t transb,
+                               plasma_complex64_t alpha, plasma_desc_t A,
+                                                         plasma_desc_t B,
+                               plasma_complex64_t beta,  plasma_desc_t C,
+                               const plasma_zepilogue_t *epilogue,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_zgemmt(plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t transb,
+                       plasma_complex64_t alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                       plasma_complex64_t beta,  plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zgeqp3(plasma_desc_t A, int *jpvt, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zgeqrf(plasma_desc_t A, plasma_desc_t T,
                        plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgeqrf_lowrank(int niter, plasma_desc_t A,
+                               plasma_desc_t Q, plasma_desc_t B,
+                               plasma_desc_t Y, plasma_desc_t TY,
+                               plasma_desc_t Z, plasma_desc_t TZ,
+                               plasma_desc_t W, plasma_workspace_t work,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void plasma_omp_zgeqrs(plasma_desc_t A, plasma_desc_t T,
                        plasma_desc_t B, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -306,19 +725,55 @@ void plasma_omp_zgesv(plasma_desc_t A, int *ipiv,
                       plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgesv_rbt(plasma_desc_t A, plasma_desc_t B, plasma_desc_t X,
+                          plasma_desc_t Ar, plasma_desc_t R,
+                          double *U, double *V, int *ipiv,
+                          double *work, double *Rnorm, double *Xnorm,
+                          int *iter,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_omp_zgetrf(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_zgetri(plasma_desc_t A, int *ipiv, plasma_desc_t W,
+void plasma_omp_zgetrf_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_workspace_t work,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_zgetrf_partial(int k, plasma_desc_t A, int *ipiv,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_zgetri(plasma_desc_t A, int *ipiv,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_omp_zgetri_aux(plasma_desc_t A, plasma_desc_t W,
+void plasma_omp_zgetri_aux(plasma_desc_t A,
                            plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_zgetrs(plasma_desc_t A, int *ipiv,
                        plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zgetrs_incpiv(plasma_desc_t A, plasma_desc_t L, int *ipiv,
+                              plasma_desc_t B,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_zgtsv(plasma_complex64_t *dl, plasma_complex64_t *d,
+                      plasma_complex64_t *du, plasma_desc_t B,
+                      plasma_complex64_t *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zhe2hb(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t T,
+                       plasma_complex64_t *AB, int ldab,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zhegst(int itype, plasma_enum_t uplo,
+                       plasma_desc_t A, plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_complex64_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -336,6 +791,10 @@ void plasma_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                       double beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zhetrf(plasma_enum_t uplo, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t T, plasma_desc_t H,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zlacpy(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -375,6 +834,11 @@ void plasma_omp_zlauum(plasma_enum_t uplo,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zlrpotrf(plasma_desc_t A, double tol,
+                         plasma_workspace_t work, double *norms,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_omp_zpb2desc(plasma_complex64_t *pA, int lda,
                          plasma_desc_t A,
                          plasma_sequence_t *sequence,
@@ -389,18 +853,50 @@ void plasma_omp_zpbtrf(plasma_enum_t uplo, plasma_desc_t AB,
 void plasma_omp_zpbtrs(plasma_enum_t uplo, plasma_desc_t AB, plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zpipeline_run(plasma_zpipeline_t *pipeline,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_zplghe(double bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zplgsy(plasma_complex64_t bump, unsigned long long seed,
+                       plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zplrnt(unsigned long long seed, plasma_desc_t A,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_zpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zpotrf_partial(plasma_enum_t uplo, int k, plasma_desc_t A,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_zpotrf_update(plasma_enum_t uplo, int sign,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_desc_t G,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_omp_zpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_omp_zpotrs(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zpstrf(plasma_desc_t A, int *piv, int *rank, double tol,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_zptsv(double *d, plasma_complex64_t *e, plasma_desc_t B,
+                      plasma_complex64_t *work, int *iwork,
+                      plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_complex64_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
@@ -418,23 +914,49 @@ void plasma_omp_zsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                       plasma_complex64_t beta,  plasma_desc_t C,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ztpmqrt(plasma_enum_t trans,
+                        plasma_desc_t B, plasma_desc_t T,
+                        plasma_desc_t C, plasma_desc_t D,
+                        plasma_workspace_t work,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_omp_ztpqrt(plasma_desc_t R, plasma_desc_t B, plasma_desc_t T,
+                       plasma_workspace_t work,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ztradd(plasma_enum_t uplo, plasma_enum_t transa,
                        plasma_complex64_t alpha, plasma_desc_t A,
                        plasma_complex64_t beta,  plasma_desc_t B,
                        plasma_sequence_t *sequence, plasma_request_t  *request);
 
+void plasma_omp_ztranspose(plasma_enum_t trans, plasma_desc_t A,
+                           plasma_desc_t B,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_omp_ztrmm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       plasma_complex64_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ztrmm3(plasma_enum_t side, plasma_enum_t uplo,
+                       plasma_enum_t transa, plasma_enum_t diag,
+                       plasma_complex64_t alpha, plasma_desc_t A,
+                                                 plasma_desc_t B,
+                                                 plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
                       plasma_enum_t transa, plasma_enum_t diag,
                       plasma_complex64_t alpha, plasma_desc_t A,
                                                 plasma_desc_t B,
                       plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_ztrsyl(plasma_enum_t transa, plasma_enum_t transb, int isgn,
+                       plasma_desc_t A, plasma_desc_t B, plasma_desc_t C,
+                       plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                        plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
@@ -457,6 +979,15 @@ void plasma_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                        plasma_desc_t C, plasma_workspace_t work,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+/***************************************************************************//**
+ *  Performance prediction.
+ **/
+int plasma_predict_zgeqrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_zgetrf(int m, int n, plasma_time_t *time);
+
+int plasma_predict_zpotrf(plasma_enum_t uplo, int n, plasma_time_t *time);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
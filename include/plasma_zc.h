@@ -16,6 +16,7 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_workspace.h"
+#include "plasma_z.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,11 +30,27 @@ int plasma_zcgesv(int n, int nrhs,
                   plasma_complex64_t *pB, int ldb,
                   plasma_complex64_t *pX, int ldx, int *iter);
 
+int plasma_zcgels(int m, int n, int nrhs,
+                  plasma_complex64_t *pA, int lda,
+                  plasma_complex64_t *pB, int ldb,
+                  plasma_complex64_t *pX, int ldx, int *iter);
+
+int plasma_zcgetrf_handle_create(int n, plasma_complex64_t *pA, int lda,
+                                 plasma_getrf_mixed_handle_t *handle);
+
+int plasma_zcgetrs_handle(plasma_getrf_mixed_handle_t handle, int nrhs,
+                          plasma_complex64_t *pB, int ldb,
+                          plasma_complex64_t *pX, int ldx, int *iter);
+
 int plasma_zcposv(plasma_enum_t uplo, int n, int nrhs,
                   plasma_complex64_t *pA, int lda,
                   plasma_complex64_t *pB, int ldb,
                   plasma_complex64_t *pX, int ldx, int *iter);
 
+int plasma_zcpotrf(plasma_enum_t uplo,
+                   int n,
+                   plasma_complex64_t *pA, int lda, double tol);
+
 int plasma_zlag2c(int m, int n,
                   plasma_complex64_t *pA,  int lda,
                   plasma_complex32_t *pAs, int ldas);
@@ -42,6 +59,15 @@ int plasma_clag2z(int m, int n,
                   plasma_complex32_t *pAs, int ldas,
                   plasma_complex64_t *pA,  int lda);
 
+/***************************************************************************//**
+ *  Tile synchronous interface
+ **/
+int plasma_zpipeline_clag2z(plasma_zpipeline_t *pipeline,
+                            plasma_desc_t As, plasma_desc_t A);
+
+int plasma_zpipeline_zlag2c(plasma_zpipeline_t *pipeline,
+                            plasma_desc_t A, plasma_desc_t As);
+
 /***************************************************************************//**
  *  Tile asynchronous interface
  **/
@@ -59,6 +85,10 @@ void plasma_omp_zcposv(plasma_enum_t uplo,
                        plasma_sequence_t *sequence,
                        plasma_request_t  *request);
 
+void plasma_omp_zcpotrf(plasma_enum_t uplo, plasma_desc_t A, double tol,
+                        plasma_workspace_t work, double *norms,
+                        plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_omp_zlag2c(plasma_desc_t A, plasma_desc_t As,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -102,6 +102,25 @@ static double  flops_dgemm(double m, double n, double k)
 static double  flops_sgemm(double m, double n, double k)
     { return    fmuls_gemm(m, n, k) +    fadds_gemm(m, n, k); }
 
+//------------------------------------------------------------ gemmt
+static double fmuls_gemmt(double n, double k)
+    { return 0.5*k*n*(n + 1); }
+
+static double fadds_gemmt(double n, double k)
+    { return 0.5*k*n*(n + 1); }
+
+static double  flops_zgemmt(double n, double k)
+    { return 6.*fmuls_gemmt(n, k) + 2.*fadds_gemmt(n, k); }
+
+static double  flops_cgemmt(double n, double k)
+    { return 6.*fmuls_gemmt(n, k) + 2.*fadds_gemmt(n, k); }
+
+static double  flops_dgemmt(double n, double k)
+    { return    fmuls_gemmt(n, k) +    fadds_gemmt(n, k); }
+
+static double  flops_sgemmt(double n, double k)
+    { return    fmuls_gemmt(n, k) +    fadds_gemmt(n, k); }
+
 //------------------------------------------------------------ symm/hemm
 static double fmuls_symm(plasma_enum_t side, double m, double n)
 {
@@ -325,6 +344,25 @@ static double  flops_dgetrs(double n, double nrhs)
 static double  flops_sgetrs(double n, double nrhs)
     { return    fmuls_getrs(n, nrhs) +    fadds_getrs(n, nrhs); }
 
+//------------------------------------------------------------ hegst
+static double fmuls_hegst(double n)
+    { return 0.5*n*n*n + 0.5*n*n; }
+
+static double fadds_hegst(double n)
+    { return 0.5*n*n*n - 0.5*n*n; }
+
+static double  flops_zhegst(double n)
+    { return 6.*fmuls_hegst(n) + 2.*fadds_hegst(n); }
+
+static double  flops_chegst(double n)
+    { return 6.*fmuls_hegst(n) + 2.*fadds_hegst(n); }
+
+static double  flops_dsygst(double n)
+    { return    fmuls_hegst(n) +    fadds_hegst(n); }
+
+static double  flops_ssygst(double n)
+    { return    fmuls_hegst(n) +    fadds_hegst(n); }
+
 //------------------------------------------------------------ potrf
 static double fmuls_potrf(double n)
     { return 1./6.*n*n*n + 0.5*n*n + 1./3.*n; }
@@ -344,6 +382,44 @@ static double  flops_dpotrf(double n)
 static double  flops_spotrf(double n)
     { return    fmuls_potrf(n) +    fadds_potrf(n); }
 
+//------------------------------------------------------------ potrf_update
+static double fmuls_potrf_update(double n, double k)
+    { return n*n*k + 2.*n*k; }
+
+static double fadds_potrf_update(double n, double k)
+    { return 0.5*n*n*k; }
+
+static double  flops_zpotrf_update(double n, double k)
+    { return 6.*fmuls_potrf_update(n, k) + 2.*fadds_potrf_update(n, k); }
+
+static double  flops_cpotrf_update(double n, double k)
+    { return 6.*fmuls_potrf_update(n, k) + 2.*fadds_potrf_update(n, k); }
+
+static double  flops_dpotrf_update(double n, double k)
+    { return    fmuls_potrf_update(n, k) +    fadds_potrf_update(n, k); }
+
+static double  flops_spotrf_update(double n, double k)
+    { return    fmuls_potrf_update(n, k) +    fadds_potrf_update(n, k); }
+
+//------------------------------------------------------------ pstrf
+static double fmuls_pstrf(double n, double r)
+    { return r*r*(0.5*n - 1./3.*r) + 2.*n*r; }
+
+static double fadds_pstrf(double n, double r)
+    { return r*r*(0.5*n - 1./3.*r) + n*r; }
+
+static double  flops_zpstrf(double n, double r)
+    { return 6.*fmuls_pstrf(n, r) + 2.*fadds_pstrf(n, r); }
+
+static double  flops_cpstrf(double n, double r)
+    { return 6.*fmuls_pstrf(n, r) + 2.*fadds_pstrf(n, r); }
+
+static double  flops_dpstrf(double n, double r)
+    { return    fmuls_pstrf(n, r) +    fadds_pstrf(n, r); }
+
+static double  flops_spstrf(double n, double r)
+    { return    fmuls_pstrf(n, r) +    fadds_pstrf(n, r); }
+
 //------------------------------------------------------------ potri
 static double fmuls_potri(double n)
     { return 1./3.*n*n*n + n*n + 2./3.*n; }
@@ -428,6 +504,27 @@ static double  flops_dgeqrt(double m, double n)
 static double  flops_sgeqrt(double m, double n)
     { return    fmuls_geqrt(m, n) +    fadds_geqrt(m, n); }
 
+//------------------------------------------------------------ tpqrt
+// QR update of an n-by-n triangular R with m new rows,
+// applied to nrhs right hand sides
+static double fmuls_tpqrt(double m, double n, double nrhs)
+    { return m*n*n + 2.*m*n*nrhs; }
+
+static double fadds_tpqrt(double m, double n, double nrhs)
+    { return m*n*n + 2.*m*n*nrhs; }
+
+static double  flops_ztpqrt(double m, double n, double nrhs)
+    { return 6.*fmuls_tpqrt(m, n, nrhs) + 2.*fadds_tpqrt(m, n, nrhs); }
+
+static double  flops_ctpqrt(double m, double n, double nrhs)
+    { return 6.*fmuls_tpqrt(m, n, nrhs) + 2.*fadds_tpqrt(m, n, nrhs); }
+
+static double  flops_dtpqrt(double m, double n, double nrhs)
+    { return    fmuls_tpqrt(m, n, nrhs) +    fadds_tpqrt(m, n, nrhs); }
+
+static double  flops_stpqrt(double m, double n, double nrhs)
+    { return    fmuls_tpqrt(m, n, nrhs) +    fadds_tpqrt(m, n, nrhs); }
+
 //------------------------------------------------------------ geqlf
 static double fmuls_geqlf(double m, double n)
     { return fmuls_geqrf(m, n); }
@@ -871,6 +968,121 @@ static double flops_dlansy(double n, plasma_enum_t norm)
 static double flops_slansy(double n, plasma_enum_t norm)
     { return    fmuls_lanhe(n, norm) +    fadds_lanhe(n, norm); }
 
+//==============================================================================
+// Memory traffic
+//==============================================================================
+// Compulsory traffic in bytes between the memory and the last level cache:
+// each element read or written once, without the write allocations.
+// The achieved GB/s of a routine is compared to the STREAM triad bandwidth
+// by the roofline of the tester.
+
+//------------------------------------------------------------ gemm
+static double elems_gemm(double m, double n, double k)
+    { return m*k + k*n + 2*m*n; }
+
+static double bytes_zgemm(double m, double n, double k)
+    { return 16.*elems_gemm(m, n, k); }
+
+static double bytes_cgemm(double m, double n, double k)
+    { return  8.*elems_gemm(m, n, k); }
+
+static double bytes_dgemm(double m, double n, double k)
+    { return  8.*elems_gemm(m, n, k); }
+
+static double bytes_sgemm(double m, double n, double k)
+    { return  4.*elems_gemm(m, n, k); }
+
+//------------------------------------------------------------ geadd
+static double elems_geadd(double m, double n)
+    { return 3*m*n; }
+
+static double bytes_zgeadd(double m, double n)
+    { return 16.*elems_geadd(m, n); }
+
+static double bytes_cgeadd(double m, double n)
+    { return  8.*elems_geadd(m, n); }
+
+static double bytes_dgeadd(double m, double n)
+    { return  8.*elems_geadd(m, n); }
+
+static double bytes_sgeadd(double m, double n)
+    { return  4.*elems_geadd(m, n); }
+
+//------------------------------------------------------------ lacpy
+static double elems_lacpy(plasma_enum_t uplo, double m, double n)
+{
+    double k = m < n ? m : n;
+    if (uplo == PlasmaGeneral)
+        return 2*m*n;
+    else if (uplo == PlasmaLower)
+        return 2*(k*(k+1)/2 + (m-k)*n);
+    else
+        return 2*(k*(k+1)/2 + (n-k)*m);
+}
+
+static double bytes_zlacpy(plasma_enum_t uplo, double m, double n)
+    { return 16.*elems_lacpy(uplo, m, n); }
+
+static double bytes_clacpy(plasma_enum_t uplo, double m, double n)
+    { return  8.*elems_lacpy(uplo, m, n); }
+
+static double bytes_dlacpy(plasma_enum_t uplo, double m, double n)
+    { return  8.*elems_lacpy(uplo, m, n); }
+
+static double bytes_slacpy(plasma_enum_t uplo, double m, double n)
+    { return  4.*elems_lacpy(uplo, m, n); }
+
+//------------------------------------------------------------ lange
+static double elems_lange(double m, double n)
+    { return m*n; }
+
+static double bytes_zlange(double m, double n)
+    { return 16.*elems_lange(m, n); }
+
+static double bytes_clange(double m, double n)
+    { return  8.*elems_lange(m, n); }
+
+static double bytes_dlange(double m, double n)
+    { return  8.*elems_lange(m, n); }
+
+static double bytes_slange(double m, double n)
+    { return  4.*elems_lange(m, n); }
+
+//------------------------------------------------------------ laswp
+// All the rows (columns) are read and written once when the interchanges
+// cover the whole matrix, as with random pivots.
+static double elems_laswp(double m, double n)
+    { return 2*m*n; }
+
+static double bytes_zlaswp(double m, double n)
+    { return 16.*elems_laswp(m, n); }
+
+static double bytes_claswp(double m, double n)
+    { return  8.*elems_laswp(m, n); }
+
+static double bytes_dlaswp(double m, double n)
+    { return  8.*elems_laswp(m, n); }
+
+static double bytes_slaswp(double m, double n)
+    { return  4.*elems_laswp(m, n); }
+
+//------------------------------------------------------------ plrnt
+// The matrix is written once.
+static double elems_plrnt(double m, double n)
+    { return m*n; }
+
+static double bytes_zplrnt(double m, double n)
+    { return 16.*elems_plrnt(m, n); }
+
+static double bytes_cplrnt(double m, double n)
+    { return  8.*elems_plrnt(m, n); }
+
+static double bytes_dplrnt(double m, double n)
+    { return  8.*elems_plrnt(m, n); }
+
+static double bytes_splrnt(double m, double n)
+    { return  4.*elems_plrnt(m, n); }
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
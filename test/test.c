@@ -11,6 +11,7 @@
 #include "plasma.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -45,6 +46,10 @@ struct routines_t routines[] =
     { "dgbsv",  test_dgbsv },
     { "cgbsv",  test_cgbsv },
     { "sgbsv",  test_sgbsv },
+    { "zgbsv_batched", test_zgbsv_batched },
+    { "dgbsv_batched", test_dgbsv_batched },
+    { "cgbsv_batched", test_cgbsv_batched },
+    { "sgbsv_batched", test_sgbsv_batched },
 
     { "zgbtrf", test_zgbtrf },
     { "dgbtrf", test_dgbtrf },
@@ -56,6 +61,11 @@ struct routines_t routines[] =
     { "cgeadd", test_cgeadd },
     { "sgeadd", test_sgeadd },
 
+    { "zgecon", test_zgecon },
+    { "dgecon", test_dgecon },
+    { "cgecon", test_cgecon },
+    { "sgecon", test_sgecon },
+
     { "zgelqf", test_zgelqf },
     { "dgelqf", test_dgelqf },
     { "cgelqf", test_cgelqf },
@@ -76,11 +86,60 @@ struct routines_t routines[] =
     { "cgemm", test_cgemm },
     { "sgemm", test_sgemm },
 
+    { "zgemmt", test_zgemmt },
+    { "dgemmt", test_dgemmt },
+    { "cgemmt", test_cgemmt },
+    { "sgemmt", test_sgemmt },
+
+    { "zgemm_batched", test_zgemm_batched },
+    { "dgemm_batched", test_dgemm_batched },
+    { "cgemm_batched", test_cgemm_batched },
+    { "sgemm_batched", test_sgemm_batched },
+    { "zgemm_vbatched", test_zgemm_vbatched },
+    { "dgemm_vbatched", test_dgemm_vbatched },
+    { "cgemm_vbatched", test_cgemm_vbatched },
+    { "sgemm_vbatched", test_sgemm_vbatched },
+
+    { "zgemm_epilogue", test_zgemm_epilogue },
+    { "dgemm_epilogue", test_dgemm_epilogue },
+    { "cgemm_epilogue", test_cgemm_epilogue },
+    { "sgemm_epilogue", test_sgemm_epilogue },
+
+    { "zgepolar", test_zgepolar },
+    { "dgepolar", test_dgepolar },
+    { "cgepolar", test_cgepolar },
+    { "sgepolar", test_sgepolar },
+
+    { "zgeexp", test_zgeexp },
+    { "dgeexp", test_dgeexp },
+    { "cgeexp", test_cgeexp },
+    { "sgeexp", test_sgeexp },
+
+    { "zgehrd", test_zgehrd },
+    { "dgehrd", test_dgehrd },
+    { "cgehrd", test_cgehrd },
+    { "sgehrd", test_sgehrd },
+
+    { "zgeqp3", test_zgeqp3 },
+    { "dgeqp3", test_dgeqp3 },
+    { "cgeqp3", test_cgeqp3 },
+    { "sgeqp3", test_sgeqp3 },
+
     { "zgeqrf", test_zgeqrf },
     { "dgeqrf", test_dgeqrf },
     { "cgeqrf", test_cgeqrf },
     { "sgeqrf", test_sgeqrf },
 
+    { "zgeqrf_batched", test_zgeqrf_batched },
+    { "dgeqrf_batched", test_dgeqrf_batched },
+    { "cgeqrf_batched", test_cgeqrf_batched },
+    { "sgeqrf_batched", test_sgeqrf_batched },
+
+    { "zgeqrf_cholqr", test_zgeqrf_cholqr },
+    { "dgeqrf_cholqr", test_dgeqrf_cholqr },
+    { "cgeqrf_cholqr", test_cgeqrf_cholqr },
+    { "sgeqrf_cholqr", test_sgeqrf_cholqr },
+
     { "zgeqrs", test_zgeqrs },
     { "dgeqrs", test_dgeqrs },
     { "cgeqrs", test_cgeqrs },
@@ -89,16 +148,51 @@ struct routines_t routines[] =
     { "zcgesv", test_zcgesv },
     { "dsgesv", test_dsgesv },
 
+    { "zcgels", test_zcgels },
+    { "dsgels", test_dsgels },
+
+    { "zcgetrs_handle", test_zcgetrs_handle },
+    { "dsgetrs_handle", test_dsgetrs_handle },
+
     { "zgesv", test_zgesv },
     { "dgesv", test_dgesv },
     { "cgesv", test_cgesv },
     { "sgesv", test_sgesv },
 
+    { "zgesv_rbt", test_zgesv_rbt },
+    { "dgesv_rbt", test_dgesv_rbt },
+    { "cgesv_rbt", test_cgesv_rbt },
+    { "sgesv_rbt", test_sgesv_rbt },
+
+    { "zgesvd", test_zgesvd },
+    { "dgesvd", test_dgesvd },
+    { "cgesvd", test_cgesvd },
+    { "sgesvd", test_sgesvd },
+
+    { "zgesvd_randomized", test_zgesvd_randomized },
+    { "dgesvd_randomized", test_dgesvd_randomized },
+    { "cgesvd_randomized", test_cgesvd_randomized },
+    { "sgesvd_randomized", test_sgesvd_randomized },
+
     { "zgetrf", test_zgetrf },
     { "dgetrf", test_dgetrf },
     { "cgetrf", test_cgetrf },
     { "sgetrf", test_sgetrf },
 
+    { "zgetrf_batched", test_zgetrf_batched },
+    { "dgetrf_batched", test_dgetrf_batched },
+    { "cgetrf_batched", test_cgetrf_batched },
+    { "sgetrf_batched", test_sgetrf_batched },
+    { "zgetrf_vbatched", test_zgetrf_vbatched },
+    { "dgetrf_vbatched", test_dgetrf_vbatched },
+    { "cgetrf_vbatched", test_cgetrf_vbatched },
+    { "sgetrf_vbatched", test_sgetrf_vbatched },
+
+    { "zgetrf_partial", test_zgetrf_partial },
+    { "dgetrf_partial", test_dgetrf_partial },
+    { "cgetrf_partial", test_cgetrf_partial },
+    { "sgetrf_partial", test_sgetrf_partial },
+
     { "zgetri", test_zgetri },
     { "dgetri", test_dgetri },
     { "cgetri", test_cgetri },
@@ -114,11 +208,45 @@ struct routines_t routines[] =
     { "cgetrs", test_cgetrs },
     { "sgetrs", test_sgetrs },
 
+    { "zgetrs_incpiv", test_zgetrs_incpiv },
+    { "dgetrs_incpiv", test_dgetrs_incpiv },
+    { "cgetrs_incpiv", test_cgetrs_incpiv },
+    { "sgetrs_incpiv", test_sgetrs_incpiv },
+
+    { "zgetrs_handle", test_zgetrs_handle },
+    { "dgetrs_handle", test_dgetrs_handle },
+    { "cgetrs_handle", test_cgetrs_handle },
+    { "sgetrs_handle", test_sgetrs_handle },
+
+    { "zgtsv", test_zgtsv },
+    { "dgtsv", test_dgtsv },
+    { "cgtsv", test_cgtsv },
+    { "sgtsv", test_sgtsv },
+    { "zgtsv_batched", test_zgtsv_batched },
+    { "dgtsv_batched", test_dgtsv_batched },
+    { "cgtsv_batched", test_cgtsv_batched },
+    { "sgtsv_batched", test_sgtsv_batched },
+
+    { "zheev", test_zheev },
+    { "dsyev", test_dsyev },
+    { "cheev", test_cheev },
+    { "ssyev", test_ssyev },
+
+    { "zhegst", test_zhegst },
+    { "dsygst", test_dsygst },
+    { "chegst", test_chegst },
+    { "ssygst", test_ssygst },
+
     { "zhemm", test_zhemm },
     { "", NULL },
     { "chemm", test_chemm },
     { "", NULL },
 
+    { "zhesv", test_zhesv },
+    { "dsysv", test_dsysv },
+    { "chesv", test_chesv },
+    { "ssysv", test_ssysv },
+
     { "zher2k", test_zher2k },
     { "", NULL },
     { "cher2k", test_cher2k },
@@ -189,6 +317,21 @@ struct routines_t routines[] =
     { "cpbtrf", test_cpbtrf },
     { "spbtrf", test_spbtrf },
 
+    { "zpipeline", test_zpipeline },
+    { "dpipeline", test_dpipeline },
+    { "cpipeline", test_cpipeline },
+    { "spipeline", test_spipeline },
+
+    { "zplrnt", test_zplrnt },
+    { "dplrnt", test_dplrnt },
+    { "cplrnt", test_cplrnt },
+    { "splrnt", test_splrnt },
+
+    { "zpocon", test_zpocon },
+    { "dpocon", test_dpocon },
+    { "cpocon", test_cpocon },
+    { "spocon", test_spocon },
+
     { "zposv", test_zposv },
     { "dposv", test_dposv },
     { "cposv", test_cposv },
@@ -199,6 +342,38 @@ struct routines_t routines[] =
     { "cpotrf", test_cpotrf },
     { "spotrf", test_spotrf },
 
+    { "zcpotrf", test_zcpotrf },
+    { "dspotrf", test_dspotrf },
+
+    { "zlrpotrf", test_zlrpotrf },
+    { "dlrpotrf", test_dlrpotrf },
+    { "clrpotrf", test_clrpotrf },
+    { "slrpotrf", test_slrpotrf },
+
+    { "zpotrf_batched", test_zpotrf_batched },
+    { "dpotrf_batched", test_dpotrf_batched },
+    { "cpotrf_batched", test_cpotrf_batched },
+    { "spotrf_batched", test_spotrf_batched },
+    { "zpotrf_vbatched", test_zpotrf_vbatched },
+    { "dpotrf_vbatched", test_dpotrf_vbatched },
+    { "cpotrf_vbatched", test_cpotrf_vbatched },
+    { "spotrf_vbatched", test_spotrf_vbatched },
+
+    { "zpotrf_partial", test_zpotrf_partial },
+    { "dpotrf_partial", test_dpotrf_partial },
+    { "cpotrf_partial", test_cpotrf_partial },
+    { "spotrf_partial", test_spotrf_partial },
+
+    { "zpotrf_sparse", test_zpotrf_sparse },
+    { "dpotrf_sparse", test_dpotrf_sparse },
+    { "cpotrf_sparse", test_cpotrf_sparse },
+    { "spotrf_sparse", test_spotrf_sparse },
+
+    { "zpotrf_update", test_zpotrf_update },
+    { "dpotrf_update", test_dpotrf_update },
+    { "cpotrf_update", test_cpotrf_update },
+    { "spotrf_update", test_spotrf_update },
+
     { "zpotri", test_zpotri },
     { "dpotri", test_dpotri },
     { "cpotri", test_cpotri },
@@ -209,6 +384,20 @@ struct routines_t routines[] =
     { "cpotrs", test_cpotrs },
     { "spotrs", test_spotrs },
 
+    { "zpstrf", test_zpstrf },
+    { "dpstrf", test_dpstrf },
+    { "cpstrf", test_cpstrf },
+    { "spstrf", test_spstrf },
+
+    { "zptsv", test_zptsv },
+    { "dptsv", test_dptsv },
+    { "cptsv", test_cptsv },
+    { "sptsv", test_sptsv },
+    { "zptsv_batched", test_zptsv_batched },
+    { "dptsv_batched", test_dptsv_batched },
+    { "cptsv_batched", test_cptsv_batched },
+    { "sptsv_batched", test_sptsv_batched },
+
     { "zsymm", test_zsymm },
     { "dsymm", test_dsymm },
     { "csymm", test_csymm },
@@ -224,21 +413,41 @@ struct routines_t routines[] =
     { "csyrk", test_csyrk },
     { "ssyrk", test_ssyrk },
 
+    { "ztpqrt", test_ztpqrt },
+    { "dtpqrt", test_dtpqrt },
+    { "ctpqrt", test_ctpqrt },
+    { "stpqrt", test_stpqrt },
+
     { "ztradd", test_ztradd },
     { "dtradd", test_dtradd },
     { "ctradd", test_ctradd },
     { "stradd", test_stradd },
 
+    { "ztranspose", test_ztranspose },
+    { "dtranspose", test_dtranspose },
+    { "ctranspose", test_ctranspose },
+    { "stranspose", test_stranspose },
+
     { "ztrmm", test_ztrmm },
     { "dtrmm", test_dtrmm },
     { "ctrmm", test_ctrmm },
     { "strmm", test_strmm },
 
+    { "ztrmm3", test_ztrmm3 },
+    { "dtrmm3", test_dtrmm3 },
+    { "ctrmm3", test_ctrmm3 },
+    { "strmm3", test_strmm3 },
+
     { "ztrsm", test_ztrsm },
     { "dtrsm", test_dtrsm },
     { "ctrsm", test_ctrsm },
     { "strsm", test_strsm },
 
+    { "ztrsyl", test_ztrsyl },
+    { "dtrsyl", test_dtrsyl },
+    { "ctrsyl", test_ctrsyl },
+    { "strsyl", test_strsyl },
+
     { "ztrtri", test_ztrtri },
     { "dtrtri", test_dtrtri },
     { "ctrtri", test_ctrtri },
@@ -257,6 +466,120 @@ struct routines_t routines[] =
     { NULL, NULL }  // last entry
 };
 
+/******************************************************************************/
+// Fastest nb, ib and ntpf of each size, with --tune.
+typedef struct {
+    int size;
+    double time;
+    int nb;
+    int ib;
+    int ntpf;
+} tune_entry_t;
+
+static const char *tune_path = NULL;
+static tune_entry_t tune_entries[PlasmaTuningMaxEntries];
+static int tune_num_entries = 0;
+
+/******************************************************************************/
+// GFLOPS of each parameter set with the first thread count of --threads.
+static int scale_threads0 = 0;    // first thread count, 0 without --threads
+static int scale_first = 0;       // if true, sweeping the first thread count
+static int scale_set = 0;         // index of the parameter set
+static int scale_num_sets = 0;
+static double *scale_gflops = NULL;
+
+/***************************************************************************//**
+ *
+ * @brief Returns the parallel efficiency of a parameter set, the GFLOPS per
+ *        thread relative to those with the first thread count of --threads,
+ *        which are recorded during the sweep of the first thread count.
+ *
+ * @param[in]  gflops  - median GFLOPS of the parameter set
+ * @param[out] speedup - ratio of the GFLOPS to those of the first count
+ *
+ ******************************************************************************/
+double scale_efficiency(double gflops, double *speedup)
+{
+    if (scale_first) {
+        if (scale_set >= scale_num_sets) {
+            scale_num_sets = 2*scale_set+1;
+            scale_gflops = (double*)realloc(scale_gflops,
+                                            scale_num_sets*sizeof(double));
+            assert(scale_gflops != NULL);
+        }
+        scale_gflops[scale_set] = gflops;
+    }
+    double base = scale_set < scale_num_sets ? scale_gflops[scale_set] : 0.0;
+    *speedup = base > 0.0 ? gflops/base : 0.0;
+    return *speedup*scale_threads0/omp_get_max_threads();
+}
+
+/***************************************************************************//**
+ *
+ * @brief Records the time of a run, if it is the fastest of its size.
+ *        The size is the largest of M, N and K.
+ *
+ * @param[in] test - if true, only successful runs are recorded
+ * @param[in] pval - array of parameter values of the run
+ *
+ ******************************************************************************/
+void tune_record(int test, param_value_t pval[])
+{
+    if (test && !pval[PARAM_SUCCESS].i)
+        return;
+
+    int size = imax(pval[PARAM_DIM].dim.m,
+                    imax(pval[PARAM_DIM].dim.n, pval[PARAM_DIM].dim.k));
+    int i;
+    for (i = 0; i < tune_num_entries; i++)
+        if (tune_entries[i].size == size)
+            break;
+    if (i == PlasmaTuningMaxEntries)
+        return;
+    if (i == tune_num_entries)
+        tune_num_entries++;
+    else if (tune_entries[i].time <= pval[PARAM_TIME].d)
+        return;
+
+    tune_entries[i].size = size;
+    tune_entries[i].time = pval[PARAM_TIME].d;
+    tune_entries[i].nb = pval[PARAM_NB].i;
+    tune_entries[i].ib = pval[PARAM_IB].i;
+    tune_entries[i].ntpf = pval[PARAM_NTPF].i;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Stores the fastest parameters of each size in the file of --tune,
+ *        keeping its entries of the other routines and sizes.
+ *
+ * @param[in] routine - routine name
+ *
+ * @retval 1 - failure
+ * @retval 0 - success
+ *
+ ******************************************************************************/
+int tune_save(const char *routine)
+{
+    FILE *file = fopen(tune_path, "r");
+    if (file != NULL) {
+        fclose(file);
+        if (plasma_tuning_load(tune_path) != PlasmaSuccess)
+            return 1;
+    }
+    for (int i = 0; i < tune_num_entries; i++) {
+        printf("tuned %s %d: nb %d ib %d ntpf %d, %.4lf s\n",
+               routine, tune_entries[i].size,
+               tune_entries[i].nb, tune_entries[i].ib, tune_entries[i].ntpf,
+               tune_entries[i].time);
+        if (plasma_tuning_set(routine, tune_entries[i].size,
+                              tune_entries[i].nb, tune_entries[i].ib,
+                              tune_entries[i].ntpf, 0) != PlasmaSuccess)
+            return 1;
+    }
+    return plasma_tuning_save(tune_path) != PlasmaSuccess;
+}
+
 /***************************************************************************//**
  *
  * @brief Tests and times a PLASMA routine.
@@ -281,6 +604,8 @@ int main(int argc, char **argv)
     }
 
     const char *routine = argv[1];
+    if (strcmp(routine, "perf") == 0)
+        return perf_run(argc, argv);
 
     // Ensure that ParamUsage has an entry for every param_label_t value.
     assert(PARAM_SIZEOF == sizeof(ParamUsage)/(2*sizeof(char*)));
@@ -297,35 +622,58 @@ int main(int argc, char **argv)
     // Print labels.
     //test_routine(test, routine, NULL);
 
-    plasma_init();
-    if (outer) {
-        // outer product iteration
-        do {
-            param_snap(param, pval);
-            for (int i = 0; i < iter; i++) {
-                err += test_routine(test, routine, pval);
-            }
-            if (iter > 1) {
-                printf("\n");
-            }
+    // The thread counts are swept here, outside of the parameter iteration.
+    param_t threads = param[PARAM_THREADS];
+    param[PARAM_THREADS].num = 0;
+    int weak = param[PARAM_SCALING].val[0].c == 'w';
+    if (threads.num > 0)
+        scale_threads0 = threads.val[0].i;
+
+    for (int t = 0; t < imax(1, threads.num); t++) {
+        if (threads.num > 0) {
+            omp_set_num_threads(threads.val[t].i);
+            // The binding is set by OMP_PROC_BIND and OMP_PLACES.
+            static const char *bind[] =
+                { "false", "true", "master", "close", "spread" };
+            int b = (int)omp_get_proc_bind();
+            if (param[PARAM_OUTPUT].val[0].c == 't')
+                printf("threads %d, binding %s, places %d\n",
+                       threads.val[t].i, b >= 0 && b <= 4 ? bind[b] : "?",
+                       omp_get_num_places());
         }
-        while (param_step_outer(param, 0));
-    }
-    else {
-        // inner product iteration
+        scale_first = t == 0;
+        scale_set = 0;
+        for (int i = 0; i < PARAM_SIZEOF; i++)
+            param[i].pos = 0;
+
+        // Re-initialize for the workspaces to match the number of threads.
+        plasma_init();
+
+        // Tune with the parameters given, not those of the tuning file.
+        if (tune_path != NULL)
+            plasma_set(PlasmaTuning, PlasmaTuningOff);
+
         do {
             param_snap(param, pval);
-            for (int i = 0; i < iter; i++) {
-                err += test_routine(test, routine, pval);
-            }
-            if (iter > 1) {
-                printf("\n");
+            if (weak && threads.num > 0) {
+                // Keep the cubic work per thread of the first thread count.
+                double scale = cbrt((double)threads.val[t].i/scale_threads0);
+                pval[PARAM_DIM].dim.m = (int)(scale*pval[PARAM_DIM].dim.m+0.5);
+                pval[PARAM_DIM].dim.n = (int)(scale*pval[PARAM_DIM].dim.n+0.5);
+                pval[PARAM_DIM].dim.k = (int)(scale*pval[PARAM_DIM].dim.k+0.5);
             }
+            err += bench_routine(test, routine, pval, iter);
+            scale_set++;
         }
-        while (param_step_inner(param));
+        while (outer ? param_step_outer(param, 0) : param_step_inner(param));
+
+        plasma_finalize();
     }
-    plasma_finalize();
-    printf("\n");
+    if (tune_path != NULL)
+        err += tune_save(routine);
+
+    if (param[PARAM_OUTPUT].val[0].c == 't')
+        printf("\n");
     return err;
 }
 
@@ -340,6 +688,9 @@ void print_main_usage()
            "\ttest [-h|--help]\n"
            "\ttest routine [-h|--help]\n"
            "\ttest routine [parameter1, parameter2, ...]\n"
+           "\ttest perf --baseline=file --machine=tag [--tolerance=0.1]"
+           " [--iter=3]\n"
+           "\t          [--warmup=1] [--record=y|n]\n"
            "\n"
            "Available routines:");
     for (int i = 0; routines[i].name != NULL; ++i) {
@@ -368,6 +719,17 @@ void print_routine_usage(const char *name)
            name, name,
            DescriptionIndent, "-h --help");
     print_usage(PARAM_ITER);
+    print_usage(PARAM_TUNE);
+    print_usage(PARAM_WARMUP);
+    print_usage(PARAM_FLUSH);
+    print_usage(PARAM_OUTPUT);
+    print_usage(PARAM_ROOFLINE);
+    print_usage(PARAM_MEMORY);
+    print_usage(PARAM_ENERGY);
+    print_usage(PARAM_COMPARE);
+    print_usage(PARAM_SCHED);
+    print_usage(PARAM_THREADS);
+    print_usage(PARAM_SCALING);
     print_usage(PARAM_OUTER);
     print_usage(PARAM_DIM_OUTER);
     print_usage(PARAM_TEST);
@@ -441,6 +803,911 @@ int test_routine(int test, const char *name, param_value_t pval[])
     }
 }
 
+/******************************************************************************/
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/******************************************************************************/
+static double bench_median(const double *x, int n, double *work)
+{
+    memcpy(work, x, n*sizeof(double));
+    qsort(work, n, sizeof(double), bench_compare);
+    return n%2 == 1 ? work[n/2] : 0.5*(work[n/2-1]+work[n/2]);
+}
+
+/******************************************************************************/
+static int bench_split(char *str, char *tok[])
+{
+    int num = 0;
+    for (char *t = strtok(str, " "); t != NULL; t = strtok(NULL, " "))
+        tok[num++] = t;
+    return num;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Runs a routine for a set of parameter values.
+ *        Performs the warm-up runs of --warmup, untimed and unprinted,
+ *        then the iter runs of --iter. With --output=t, prints each run,
+ *        followed by the statistics of the times and GFLOPS if iter > 1,
+ *        by the roofline with --roofline=y, and by the storage of the
+ *        tile matrices and workspaces of the runs with --memory=y, by
+ *        their energy with --energy=y, by the vendor call with
+ *        --compare=y, and by the scheduling of the tasks with --sched=y.
+ *        Otherwise, prints only the statistics, as one CSV row or one
+ *        JSON line.
+ *
+ * @param[in]    test - if true, tests routine, else only times routine
+ * @param[in]    name - routine name
+ * @param[inout] pval - array of parameter values
+ * @param[in]    iter - number of runs
+ *
+ * @return The number of runs that failed.
+ *
+ ******************************************************************************/
+int bench_routine(int test, const char *name, param_value_t pval[], int iter)
+{
+    char info[InfoLen];
+    int text = pval[PARAM_OUTPUT].c == 't';
+    int flush = pval[PARAM_FLUSH].c == 'y';
+    int roofline = pval[PARAM_ROOFLINE].c == 'y';
+    int memory = pval[PARAM_MEMORY].c == 'y';
+    int energy = pval[PARAM_ENERGY].c == 'y' && bench_energy() >= 0.0;
+    int compare = pval[PARAM_COMPARE].c == 'y';
+    int sched = pval[PARAM_SCHED].c == 'y';
+    int scaling = scale_threads0 > 0;
+
+    // Only the routines with a model of their memory traffic set the GB/s,
+    // and only those with a vendor equivalent its time.
+    pval[PARAM_GBYTES].d = 0.0;
+    pval[PARAM_VTIME].d = 0.0;
+
+    for (int i = 0; i < pval[PARAM_WARMUP].i; i++) {
+        if (flush)
+            bench_flush();
+        run_routine(name, pval, info);
+    }
+
+    double *time = (double*)malloc(6*iter*sizeof(double));
+    assert(time != NULL);
+    double *gflops = &time[iter];
+    double *gbytes = &time[2*iter];
+    double *watts = &time[4*iter];
+    double *vtime = &time[5*iter];
+
+    // the storage of the runs, not of the warm-up runs
+    plasma_stats_memory_t memory_stats;
+    if (memory)
+        plasma_stats_reset();
+
+    // the scheduling of the last run, traced from its start
+    plasma_trace_sched_t sched_stats;
+
+    int num_failed = 0;
+    double error = 0.0;
+    for (int i = 0; i < iter; i++) {
+        if (flush)
+            bench_flush();
+        if (sched)
+            plasma_set(PlasmaTrace, PlasmaTraceOn);
+        // The energy counters cover the whole run, with the generation and
+        // the check of the matrices: its average power is charged to the
+        // timed section.
+        double joules = energy ? bench_energy() : 0.0;
+        double start = omp_get_wtime();
+        if (text) {
+            num_failed += test_routine(test, name, pval);
+        }
+        else {
+            run_routine(name, pval, info);
+            num_failed += test && !pval[PARAM_SUCCESS].i;
+        }
+        if (energy) {
+            double elapsed = omp_get_wtime()-start;
+            joules = bench_energy()-joules;
+            watts[i] = elapsed > 0.0 ? joules/elapsed : 0.0;
+        }
+        if (sched)
+            plasma_trace_sched(&sched_stats);
+        if (test && pval[PARAM_ERROR].d > error)
+            error = pval[PARAM_ERROR].d;
+        time[i] = pval[PARAM_TIME].d;
+        gflops[i] = pval[PARAM_GFLOPS].d;
+        gbytes[i] = pval[PARAM_GBYTES].d;
+        vtime[i] = pval[PARAM_VTIME].d;
+        if (tune_path != NULL)
+            tune_record(test, pval);
+    }
+    if (memory)
+        plasma_stats_get_memory(&memory_stats);
+    if (sched)
+        plasma_set(PlasmaTrace, PlasmaTraceOff);
+    if (!text || iter > 1 || roofline || memory || energy || compare ||
+        sched || scaling)
+        bench_print(test, name, pval, info, iter, num_failed, error,
+                    time, gflops, gbytes, memory ? &memory_stats : NULL,
+                    energy ? watts : NULL, compare ? vtime : NULL,
+                    sched ? &sched_stats : NULL);
+
+    free(time);
+    return num_failed;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Flushes the caches before a run, writing a buffer of FlushSize
+ *        bytes from all the threads.
+ *
+ ******************************************************************************/
+void bench_flush()
+{
+    static char *buffer = NULL;
+    static int count = 0;
+
+    if (buffer == NULL) {
+        buffer = (char*)malloc(FlushSize);
+        assert(buffer != NULL);
+    }
+    count++;
+    #pragma omp parallel for
+    for (size_t i = 0; i < FlushSize; i += 64)
+        buffer[i] = (char)(count+i);
+}
+
+/******************************************************************************/
+// RAPL zones of the packages and their DRAM, with --energy: the counter file
+// of each, the energy at which it wraps around and its last reading.
+typedef struct {
+    char path[128];
+    double range;
+    double last;
+} energy_zone_t;
+
+static energy_zone_t energy_zones[EnergyMaxZones];
+static int energy_num_zones = -1;  // -1 until the zones are looked up
+static double energy_total = 0.0;
+
+/******************************************************************************/
+static int energy_read(const char *path, double *value)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        return -1;
+    unsigned long long microjoules;
+    int num = fscanf(file, "%llu", &microjoules);
+    fclose(file);
+    if (num != 1)
+        return -1;
+    *value = microjoules*1e-6;
+    return 0;
+}
+
+/******************************************************************************/
+// Adds the zone of directory dir if its name starts with prefix and its
+// counter is readable, e.g., not restricted to root.
+static void energy_add_zone(const char *dir, const char *prefix)
+{
+    char path[128];
+    char zone_name[64];
+    snprintf(path, sizeof(path), "%s/name", dir);
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        return;
+    int num = fscanf(file, "%63s", zone_name);
+    fclose(file);
+    if (num != 1 || strncmp(zone_name, prefix, strlen(prefix)) != 0 ||
+        energy_num_zones == EnergyMaxZones)
+        return;
+
+    energy_zone_t *zone = &energy_zones[energy_num_zones];
+    snprintf(path, sizeof(path), "%s/max_energy_range_uj", dir);
+    if (energy_read(path, &zone->range) != 0)
+        return;
+    snprintf(zone->path, sizeof(zone->path), "%s/energy_uj", dir);
+    if (energy_read(zone->path, &zone->last) != 0)
+        return;
+    energy_num_zones++;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Returns the energy in joules consumed since the first call by the
+ *        packages and their DRAM, from the RAPL counters of the powercap
+ *        interface, accumulated over their wrap-arounds. The platform zone
+ *        (psys), which includes the packages, is left out.
+ *
+ * @retval The energy, or -1 without a readable zone, reported on the
+ *         first call.
+ *
+ ******************************************************************************/
+double bench_energy()
+{
+    if (energy_num_zones < 0) {
+        energy_num_zones = 0;
+        for (int p = 0; p < EnergyMaxZones; p++) {
+            char dir[96];
+            snprintf(dir, sizeof(dir), "%s/intel-rapl:%d", PowercapPath, p);
+            energy_add_zone(dir, "package");
+            for (int d = 0; d < EnergyMaxZones; d++) {
+                // the directory, "/intel-rapl:" and two indices
+                char sub[sizeof(dir)+12+2*11+1];
+                snprintf(sub, sizeof(sub), "%s/intel-rapl:%d:%d", dir, p, d);
+                energy_add_zone(sub, "dram");
+            }
+        }
+        if (energy_num_zones == 0)
+            fprintf(stderr, "no readable RAPL zone in %s, "
+                    "the energy is not reported\n", PowercapPath);
+    }
+    if (energy_num_zones == 0)
+        return -1.0;
+
+    for (int z = 0; z < energy_num_zones; z++) {
+        energy_zone_t *zone = &energy_zones[z];
+        double value;
+        if (energy_read(zone->path, &value) != 0)
+            continue;
+        double delta = value-zone->last;
+        if (delta < 0.0)
+            delta += zone->range;
+        energy_total += delta;
+        zone->last = value;
+    }
+    return energy_total;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Measures the peaks of the roofline, once per precision: the
+ *        bandwidth of the STREAM triad on arrays of FlushSize bytes, and
+ *        the GFLOPS of plasma_dgemm, or plasma_sgemm for the single
+ *        precision routines, of order RooflineGemmSize. Each is the best
+ *        of RooflineRuns runs.
+ *
+ * @param[in]  name        - routine name, whose first letter is the precision
+ * @param[out] peak_gflops - GFLOPS of the gemm
+ * @param[out] peak_gbytes - GB/s of the triad
+ *
+ ******************************************************************************/
+void bench_peaks(const char *name, double *peak_gflops, double *peak_gbytes)
+{
+    static double gbytes = 0.0;
+    static double gflops_double = 0.0;
+    static double gflops_single = 0.0;
+
+    if (gbytes == 0.0) {
+        size_t len = FlushSize/(3*sizeof(double));
+        double *a = (double*)malloc(3*len*sizeof(double));
+        assert(a != NULL);
+        double *b = &a[len];
+        double *c = &a[2*len];
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < len; i++) {
+            a[i] = 0.0;
+            b[i] = 1.0;
+            c[i] = 2.0;
+        }
+        for (int run = 0; run < RooflineRuns; run++) {
+            double start = omp_get_wtime();
+            #pragma omp parallel for schedule(static)
+            for (size_t i = 0; i < len; i++)
+                a[i] = b[i] + 3.0*c[i];
+            double time = omp_get_wtime()-start;
+            gbytes = fmax(gbytes, 3.0*len*sizeof(double)/time/1e9);
+        }
+        free(a);
+    }
+
+    int single = name[0] == 's' || name[0] == 'c';
+    double *gflops = single ? &gflops_single : &gflops_double;
+    if (*gflops == 0.0) {
+        int n = RooflineGemmSize;
+        size_t size = single ? sizeof(float) : sizeof(double);
+        void *A = calloc((size_t)3*n*n, size);
+        assert(A != NULL);
+        char *B = (char*)A + (size_t)n*n*size;
+        char *C = (char*)A + (size_t)2*n*n*size;
+        // The first run is a warm-up.
+        for (int run = 0; run <= RooflineRuns; run++) {
+            double start = omp_get_wtime();
+            if (single)
+                plasma_sgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                             1.0f, (float*)A, n, (float*)B, n,
+                             0.0f, (float*)C, n);
+            else
+                plasma_dgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                             1.0, (double*)A, n, (double*)B, n,
+                             0.0, (double*)C, n);
+            double time = omp_get_wtime()-start;
+            if (run > 0)
+                *gflops = fmax(*gflops, 2.0*n*n*n/time/1e9);
+        }
+        free(A);
+    }
+
+    *peak_gflops = *gflops;
+    *peak_gbytes = gbytes;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Prints the statistics of the runs of a set of parameter values:
+ *        minimum, median, mean and standard deviation of the times, and
+ *        maximum and median of the GFLOPS, and median of the GB/s. With
+ *        --roofline=y, also prints the peaks, the bound of the routine -
+ *        memory if its arithmetic intensity is below the ratio of the
+ *        peaks or it has no flops, else compute - and the percentage of
+ *        the peak of its bound reached. With --memory=y, also prints the
+ *        peak bytes of the tile matrices and workspaces of the runs, and
+ *        the bytes taken per run. With --energy=y, also prints the joules of
+ *        the timed section of a median run, from the average power of the
+ *        runs, the watts and the GFLOPS per watt. With --compare=y, also
+ *        prints the median time and GFLOPS of the vendor LAPACK or BLAS
+ *        call on the same input, and the speedup of PLASMA over it, the
+ *        ratio of the median times. With --sched=y, also prints the
+ *        overhead of the scheduling of the tasks of the last run, from
+ *        the generation of its matrices to their check. With --output=c,
+ *        prints them
+ *        as a CSV row, after the column labels for the first set. With
+ *        --output=j, prints them as a JSON object on one line, with the
+ *        parameter values as members of "params".
+ *
+ * @param[in] test       - if true, prints the success and largest error
+ * @param[in] name       - routine name
+ * @param[in] pval       - array of parameter values
+ * @param[in] info       - column values of the last run
+ * @param[in] iter       - number of runs
+ * @param[in] num_failed - number of runs that failed
+ * @param[in] error      - largest error of the runs
+ * @param[in] time       - times of the runs
+ * @param[in] gflops     - GFLOPS of the runs
+ * @param[in] gbytes     - GB/s of the runs, 0 without a traffic model
+ * @param[in] memory     - storage of the runs, NULL without --memory=y
+ * @param[in] watts      - average power of the runs, NULL without
+ *                         --energy=y
+ * @param[in] vtime      - times of the vendor call, 0 for the routines
+ *                         without one, NULL without --compare=y
+ * @param[in] sched      - scheduling of the last run, NULL without
+ *                         --sched=y
+ *
+ ******************************************************************************/
+void bench_print(int test, const char *name, param_value_t pval[],
+                 const char *info, int iter, int num_failed,
+                 double error, double *time, double *gflops,
+                 double *gbytes, plasma_stats_memory_t *memory,
+                 double *watts, double *vtime,
+                 plasma_trace_sched_t *sched)
+{
+    static int header = 0;
+    char output = pval[PARAM_OUTPUT].c;
+    int roofline = pval[PARAM_ROOFLINE].c == 'y';
+    int scaling = scale_threads0 > 0;
+
+    double time_min = time[0];
+    double gflops_max = gflops[0];
+    double time_mean = 0.0;
+    for (int i = 0; i < iter; i++) {
+        time_min = time[i] < time_min ? time[i] : time_min;
+        gflops_max = gflops[i] > gflops_max ? gflops[i] : gflops_max;
+        time_mean += time[i];
+    }
+    time_mean /= iter;
+    double time_stddev = 0.0;
+    for (int i = 0; i < iter; i++)
+        time_stddev += (time[i]-time_mean)*(time[i]-time_mean);
+    time_stddev = iter > 1 ? sqrt(time_stddev/(iter-1)) : 0.0;
+
+    double *work = &time[3*iter];
+    double time_median = bench_median(time, iter, work);
+    double gflops_median = bench_median(gflops, iter, work);
+    double gbytes_median = bench_median(gbytes, iter, work);
+
+    double peak_gflops = 0.0;
+    double peak_gbytes = 0.0;
+    int memory_bound = 0;
+    double percent = 0.0;
+    if (roofline) {
+        bench_peaks(name, &peak_gflops, &peak_gbytes);
+        memory_bound = gbytes_median > 0.0 &&
+            (gflops_median == 0.0 ||
+             gflops_median/gbytes_median < peak_gflops/peak_gbytes);
+        percent = memory_bound ? 100.0*gbytes_median/peak_gbytes
+                               : 100.0*gflops_median/peak_gflops;
+    }
+    double mem_peak = 0.0;
+    double mem_run = 0.0;
+    if (memory != NULL) {
+        mem_peak = memory->peak/1048576.0;
+        mem_run = memory->total/1048576.0/iter;
+    }
+    // the energy of the timed section of a median run
+    double watts_median = 0.0;
+    double joules = 0.0;
+    double gflops_watt = 0.0;
+    if (watts != NULL) {
+        watts_median = bench_median(watts, iter, work);
+        joules = watts_median*time_median;
+        if (watts_median > 0.0)
+            gflops_watt = gflops_median/watts_median;
+    }
+    // the vendor call on the same input, at the flops of the routine
+    double vtime_median = 0.0;
+    double vgflops = 0.0;
+    double vspeedup = 0.0;
+    if (vtime != NULL) {
+        vtime_median = bench_median(vtime, iter, work);
+        if (vtime_median > 0.0 && time_median > 0.0) {
+            vgflops = gflops_median*time_median/vtime_median;
+            vspeedup = vtime_median/time_median;
+        }
+    }
+    double speedup = 0.0;
+    double efficiency = 0.0;
+    if (scaling)
+        efficiency = scale_efficiency(gflops_median, &speedup);
+
+    if (output == 't') {
+        if (iter > 1)
+            printf("%*s time min %.4lf median %.4lf mean %.4lf stddev %.4lf,"
+                   " GFLOPS max %.4lf median %.4lf\n",
+                   InfoSpacing, "stats:",
+                   time_min, time_median, time_mean, time_stddev,
+                   gflops_max, gflops_median);
+        if (roofline) {
+            printf("%*s %.4lf GFLOPS of %.4lf", InfoSpacing, "roofline:",
+                   gflops_median, peak_gflops);
+            if (gbytes_median > 0.0)
+                printf(", %.4lf GB/s of %.4lf", gbytes_median, peak_gbytes);
+            printf(", %s bound, %.1lf%% of peak\n",
+                   memory_bound ? "memory" : "compute", percent);
+        }
+        if (memory != NULL)
+            printf("%*s peak %.2lf MiB, %.2lf MiB taken per run\n",
+                   InfoSpacing, "memory:", mem_peak, mem_run);
+        if (watts != NULL)
+            printf("%*s %.4lf J, %.2lf W, %.4lf GFLOPS/W\n",
+                   InfoSpacing, "energy:", joules, watts_median, gflops_watt);
+        if (vtime != NULL) {
+            if (vtime_median > 0.0)
+                printf("%*s vendor time %.4lf, GFLOPS %.4lf,"
+                       " speedup %.2lf\n", InfoSpacing, "compare:",
+                       vtime_median, vgflops, vspeedup);
+            else
+                printf("%*s no vendor call\n", InfoSpacing, "compare:");
+        }
+        if (sched != NULL && sched->tasks == 0) {
+            printf("%*s no tasks traced, built without -DPLASMA_WITH_TRACE\n",
+                   InfoSpacing, "sched:");
+        }
+        else if (sched != NULL) {
+            printf("%*s tasks %ld, mean task %.2lf us, master outside tasks"
+                   " %.4lf of %.4lf s, ready to start latency p50 %.2lf"
+                   " p90 %.2lf p99 %.2lf us\n",
+                   InfoSpacing, "sched:", sched->tasks,
+                   1e6*sched->task_time, sched->master, sched->elapsed,
+                   1e6*sched->latency_p50, 1e6*sched->latency_p90,
+                   1e6*sched->latency_p99);
+            // the nonempty buckets, by their upper bound, the last by its
+            // lower bound
+            printf("%*s", InfoSpacing, "latency:");
+            for (int b = 0; b < PlasmaSchedBuckets; b++) {
+                int open = b == PlasmaSchedBuckets-1;
+                if (sched->histogram[b] > 0)
+                    printf(" %s%d us %ld", open ? ">=" : "<",
+                           open ? 1 << (b-1) : 1 << b, sched->histogram[b]);
+            }
+            printf("\n");
+        }
+        if (scaling)
+            printf("%*s threads %d, speedup %.2lf, efficiency %.1lf%%\n",
+                   InfoSpacing, "scaling:", omp_get_max_threads(),
+                   speedup, 100.0*efficiency);
+        if (iter > 1)
+            printf("\n");
+        return;
+    }
+
+    // The labels and values of the routine are separated by spaces.
+    char labels[InfoLen];
+    char values[InfoLen];
+    char *label[InfoLen/2];
+    char *value[InfoLen/2];
+    run_routine(name, NULL, labels);
+    strcpy(values, info);
+    int num_labels = bench_split(labels, label);
+    int num_values = bench_split(values, value);
+    int num = num_labels < num_values ? num_labels : num_values;
+
+    if (output == 'c') {
+        if (!header) {
+            printf("routine,threads");
+            for (int i = 0; i < num; i++)
+                printf(",%s", label[i]);
+            if (test)
+                printf(",success,error");
+            printf(",runs,time_min,time_median,time_mean,time_stddev"
+                   ",gflops_max,gflops_median,gbytes_median");
+            if (roofline)
+                printf(",peak_gflops,peak_gbytes,bound,percent");
+            if (memory != NULL)
+                printf(",mem_peak_mib,mem_run_mib");
+            if (watts != NULL)
+                printf(",joules,watts,gflops_per_watt");
+            if (vtime != NULL)
+                printf(",vendor_time,vendor_gflops,vendor_speedup");
+            if (sched != NULL)
+                printf(",tasks,task_us,master,elapsed"
+                       ",latency_p50_us,latency_p90_us,latency_p99_us");
+            if (scaling)
+                printf(",speedup,efficiency");
+            printf("\n");
+            header = 1;
+        }
+        printf("%s,%d", name, omp_get_max_threads());
+        for (int i = 0; i < num; i++)
+            printf(",%s", value[i]);
+        if (test)
+            printf(",%s,%.2le", num_failed == 0 ? "pass" : "FAILED", error);
+        printf(",%d,%.6lf,%.6lf,%.6lf,%.6lf,%.4lf,%.4lf,%.4lf",
+               iter, time_min, time_median, time_mean, time_stddev,
+               gflops_max, gflops_median, gbytes_median);
+        if (roofline)
+            printf(",%.4lf,%.4lf,%s,%.1lf",
+                   peak_gflops, peak_gbytes,
+                   memory_bound ? "memory" : "compute", percent);
+        if (memory != NULL)
+            printf(",%.2lf,%.2lf", mem_peak, mem_run);
+        if (watts != NULL)
+            printf(",%.4lf,%.2lf,%.4lf", joules, watts_median, gflops_watt);
+        if (vtime != NULL)
+            printf(",%.6lf,%.4lf,%.4lf", vtime_median, vgflops, vspeedup);
+        if (sched != NULL)
+            printf(",%ld,%.2lf,%.6lf,%.6lf,%.2lf,%.2lf,%.2lf",
+                   sched->tasks, 1e6*sched->task_time,
+                   sched->master, sched->elapsed,
+                   1e6*sched->latency_p50, 1e6*sched->latency_p90,
+                   1e6*sched->latency_p99);
+        if (scaling)
+            printf(",%.4lf,%.4lf", speedup, efficiency);
+        printf("\n");
+    }
+    else {
+        printf("{\"routine\": \"%s\", \"threads\": %d, \"params\": {",
+               name, omp_get_max_threads());
+        for (int i = 0; i < num; i++) {
+            // Numbers are printed as such, characters as strings.
+            char *end;
+            strtod(value[i], &end);
+            if (*end == '\0')
+                printf("%s\"%s\": %s", i > 0 ? ", " : "", label[i], value[i]);
+            else
+                printf("%s\"%s\": \"%s\"", i > 0 ? ", " : "",
+                       label[i], value[i]);
+        }
+        printf("}, ");
+        if (test)
+            printf("\"success\": %s, \"error\": %.2le, ",
+                   num_failed == 0 ? "true" : "false", error);
+        printf("\"runs\": %d, "
+               "\"time\": {\"min\": %.6lf, \"median\": %.6lf, "
+               "\"mean\": %.6lf, \"stddev\": %.6lf}, "
+               "\"gflops\": {\"max\": %.4lf, \"median\": %.4lf}, "
+               "\"gbytes\": {\"median\": %.4lf}",
+               iter, time_min, time_median, time_mean, time_stddev,
+               gflops_max, gflops_median, gbytes_median);
+        if (roofline)
+            printf(", \"roofline\": {\"peak_gflops\": %.4lf, "
+                   "\"peak_gbytes\": %.4lf, \"bound\": \"%s\", "
+                   "\"percent\": %.1lf}",
+                   peak_gflops, peak_gbytes,
+                   memory_bound ? "memory" : "compute", percent);
+        if (memory != NULL)
+            printf(", \"memory\": {\"peak_mib\": %.2lf, \"run_mib\": %.2lf}",
+                   mem_peak, mem_run);
+        if (watts != NULL)
+            printf(", \"energy\": {\"joules\": %.4lf, \"watts\": %.2lf, "
+                   "\"gflops_per_watt\": %.4lf}",
+                   joules, watts_median, gflops_watt);
+        if (vtime != NULL)
+            printf(", \"vendor\": {\"time\": %.6lf, \"gflops\": %.4lf, "
+                   "\"speedup\": %.4lf}", vtime_median, vgflops, vspeedup);
+        if (sched != NULL) {
+            printf(", \"sched\": {\"tasks\": %ld, \"task_us\": %.2lf, "
+                   "\"master\": %.6lf, \"elapsed\": %.6lf, "
+                   "\"latency_us\": {\"p50\": %.2lf, \"p90\": %.2lf, "
+                   "\"p99\": %.2lf}, \"histogram\": [",
+                   sched->tasks, 1e6*sched->task_time,
+                   sched->master, sched->elapsed,
+                   1e6*sched->latency_p50, 1e6*sched->latency_p90,
+                   1e6*sched->latency_p99);
+            for (int b = 0; b < PlasmaSchedBuckets; b++)
+                printf("%s%ld", b > 0 ? ", " : "", sched->histogram[b]);
+            printf("]}");
+        }
+        if (scaling)
+            printf(", \"scaling\": {\"speedup\": %.4lf, "
+                   "\"efficiency\": %.4lf}", speedup, efficiency);
+        printf("}\n");
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @brief Appends the translation and compute times of a run of the tile
+ *        interface, with --tile=y, to the column values of a routine,
+ *        or dashes for a run of the LAPACK interface.
+ *
+ * @param[inout] info      - string of column values; length InfoLen
+ * @param[in]    tile      - if true, the run was on the tile interface
+ * @param[in]    translate - time of the translations and allocations
+ * @param[in]    compute   - time of the tile interface
+ *
+ ******************************************************************************/
+void bench_tile_info(char *info, int tile, double translate, double compute)
+{
+    size_t len = strlen(info);
+    if (tile)
+        snprintf(&info[len], InfoLen-len, " %*.4lf %*.4lf",
+                 InfoSpacing, translate,
+                 InfoSpacing, compute);
+    else
+        snprintf(&info[len], InfoLen-len, " %*s %*s",
+                 InfoSpacing, "-",
+                 InfoSpacing, "-");
+}
+
+/******************************************************************************/
+// Line of the baseline file of the perf mode: a comment, kept as it is,
+// or a case "machine routine gflops arguments...", the machine * for the
+// workloads run.
+typedef struct {
+    char *text;         // the line, without its newline
+    char *args;         // the arguments of the case, NULL for a comment
+    char machine[64];
+    char routine[64];
+    double gflops;
+} perf_line_t;
+
+/******************************************************************************/
+static char *perf_copy(const char *str)
+{
+    char *copy = (char*)malloc(strlen(str)+1);
+    assert(copy != NULL);
+    return strcpy(copy, str);
+}
+
+/******************************************************************************/
+// Parses a line of the baseline file, with its arguments separated by
+// single spaces, so that the cases of the machines match those of *.
+static void perf_parse(char *text, perf_line_t *line)
+{
+    line->text = text;
+    line->args = NULL;
+    int pos = 0;
+    if (sscanf(text, "%63s %63s %lf %n", line->machine, line->routine,
+               &line->gflops, &pos) != 3 || line->machine[0] == '#')
+        return;
+
+    line->args = (char*)malloc(strlen(text)+1);
+    assert(line->args != NULL);
+    line->args[0] = '\0';
+    char *copy = perf_copy(&text[pos]);
+    for (char *t = strtok(copy, " \t"); t != NULL; t = strtok(NULL, " \t")) {
+        if (line->args[0] != '\0')
+            strcat(line->args, " ");
+        strcat(line->args, t);
+    }
+    free(copy);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Runs a case of the perf mode, a single set of parameter values,
+ *        without checking the solution unless the arguments ask for it.
+ *
+ * @param[in]  routine - routine name
+ * @param[in]  args    - arguments of the tester, separated by spaces
+ * @param[in]  warmup  - number of untimed runs
+ * @param[in]  iter    - number of timed runs
+ *
+ * @return The median GFLOPS of the runs.
+ *
+ ******************************************************************************/
+double perf_case(const char *routine, const char *args, int warmup, int iter)
+{
+    char buffer[InfoLen];
+    char *argv[InfoLen/2];
+    int argc = 0;
+    argv[argc++] = "test";
+    argv[argc++] = (char*)routine;
+    snprintf(buffer, InfoLen, "%s", args);
+    for (char *t = strtok(buffer, " "); t != NULL; t = strtok(NULL, " "))
+        argv[argc++] = t;
+    if (strstr(args, "--test=") == NULL)
+        argv[argc++] = "--test=n";
+
+    param_t param[PARAM_SIZEOF];
+    param_value_t pval[PARAM_SIZEOF];
+    param_init(param);
+    param_read(argc, argv, param);
+    param_snap(param, pval);
+
+    char info[InfoLen];
+    double *gflops = (double*)malloc(2*iter*sizeof(double));
+    assert(gflops != NULL);
+    plasma_init();
+    for (int i = 0; i < warmup; i++)
+        run_routine(routine, pval, info);
+    for (int i = 0; i < iter; i++) {
+        run_routine(routine, pval, info);
+        gflops[i] = pval[PARAM_GFLOPS].d;
+    }
+    plasma_finalize();
+
+    double median = bench_median(gflops, iter, &gflops[iter]);
+    free(gflops);
+    for (int i = 0; i < PARAM_SIZEOF; i++)
+        free(param[i].val);
+    return median;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Performance regression mode, test perf: runs the workloads of the
+ *        baseline file, the cases of the machine *, and compares their
+ *        median GFLOPS to those of the cases of the same routine and
+ *        arguments recorded for the machine of --machine. A case fails
+ *        when its GFLOPS fall below the baseline by more than --tolerance.
+ *        With --record=y, stores the GFLOPS of the runs as the baselines
+ *        of the machine instead, rewriting the file.
+ *
+ * @param[in] argc
+ * @param[in] argv
+ *
+ * @return The number of cases that failed.
+ *
+ ******************************************************************************/
+int perf_run(int argc, char **argv)
+{
+    const char *path = NULL;
+    const char *machine = NULL;
+    double tolerance = 0.1;
+    int iter = 3;
+    int warmup = 1;
+    int record = 0;
+    for (int i = 2; i < argc; i++) {
+        const char *value = strchr(argv[i], '=');
+        if (param_starts_with(argv[i], "--baseline="))
+            path = value+1;
+        else if (param_starts_with(argv[i], "--machine="))
+            machine = value+1;
+        else if (param_starts_with(argv[i], "--tolerance="))
+            tolerance = atof(value+1);
+        else if (param_starts_with(argv[i], "--iter="))
+            iter = atoi(value+1);
+        else if (param_starts_with(argv[i], "--warmup="))
+            warmup = atoi(value+1);
+        else if (param_starts_with(argv[i], "--record="))
+            record = value[1] == 'y';
+        else {
+            printf("unknown argument: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (path == NULL || machine == NULL || strcmp(machine, "*") == 0 ||
+        iter < 1 || warmup < 0 || tolerance < 0.0) {
+        print_main_usage();
+        return EXIT_FAILURE;
+    }
+
+    // Read the lines of the baseline file.
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        printf("cannot read the baseline file %s\n", path);
+        return EXIT_FAILURE;
+    }
+    int num_lines = 0;
+    int max_lines = 0;
+    perf_line_t *lines = NULL;
+    char text[InfoLen];
+    while (fgets(text, InfoLen, file) != NULL) {
+        text[strcspn(text, "\n")] = '\0';
+        if (num_lines == max_lines) {
+            max_lines = 2*max_lines+16;
+            lines = (perf_line_t*)realloc(lines,
+                                          max_lines*sizeof(perf_line_t));
+            assert(lines != NULL);
+        }
+        perf_parse(perf_copy(text), &lines[num_lines++]);
+    }
+    fclose(file);
+
+    int num_cases = 0;
+    int num_failed = 0;
+    int num_missing = 0;
+    for (int l = 0; l < num_lines; l++) {
+        perf_line_t *line = &lines[l];
+        if (line->args == NULL || strcmp(line->machine, "*") != 0)
+            continue;
+
+        // the baseline of the case on this machine
+        int b;
+        for (b = 0; b < num_lines; b++)
+            if (lines[b].args != NULL &&
+                strcmp(lines[b].machine, machine) == 0 &&
+                strcmp(lines[b].routine, line->routine) == 0 &&
+                strcmp(lines[b].args, line->args) == 0)
+                break;
+
+        double gflops = perf_case(line->routine, line->args, warmup, iter);
+        num_cases++;
+        printf("%-8s %-40s %10.2lf GFLOPS", line->routine, line->args,
+               gflops);
+        if (record) {
+            if (b == num_lines) {
+                if (num_lines == max_lines) {
+                    max_lines = 2*max_lines+16;
+                    lines = (perf_line_t*)realloc(
+                        lines, max_lines*sizeof(perf_line_t));
+                    assert(lines != NULL);
+                    line = &lines[l];
+                }
+                lines[b] = *line;
+                lines[b].args = perf_copy(line->args);
+                snprintf(lines[b].machine, sizeof(lines[b].machine), "%s",
+                         machine);
+                num_lines++;
+            }
+            else {
+                free(lines[b].text);
+            }
+            lines[b].gflops = gflops;
+            lines[b].text = (char*)malloc(InfoLen);
+            assert(lines[b].text != NULL);
+            snprintf(lines[b].text, InfoLen, "%s %s %.2lf %s",
+                     machine, line->routine, gflops, line->args);
+            printf(", recorded\n");
+        }
+        else if (b == num_lines) {
+            num_missing++;
+            printf(", no baseline\n");
+        }
+        else {
+            double ratio = gflops/lines[b].gflops;
+            int failed = ratio < 1.0-tolerance;
+            num_failed += failed;
+            printf(", baseline %.2lf, %5.1lf%% %s\n",
+                   lines[b].gflops, 100.0*ratio, failed ? "FAILED" : "pass");
+        }
+    }
+    printf("perf: %d cases, %d failed, %d without baseline for %s\n",
+           num_cases, num_failed, num_missing, machine);
+
+    if (record) {
+        file = fopen(path, "w");
+        if (file == NULL) {
+            printf("cannot write the baseline file %s\n", path);
+            num_failed++;
+        }
+        else {
+            for (int l = 0; l < num_lines; l++)
+                fprintf(file, "%s\n", lines[l].text);
+            if (fclose(file) != 0)
+                num_failed++;
+        }
+    }
+    for (int l = 0; l < num_lines; l++) {
+        free(lines[l].text);
+        free(lines[l].args);
+    }
+    free(lines);
+    return num_failed;
+}
+
 /***************************************************************************//**
  *
  * @brief Invokes a specific routine.
@@ -548,15 +1815,50 @@ int param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--colrow="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_COLROW]);
+        else if (param_starts_with(argv[i], "--jobz="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_JOBZ]);
+        else if (param_starts_with(argv[i], "--itype="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ITYPE]);
 
         else if (param_starts_with(argv[i], "--norm="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_NORM]);
 
+        else if (param_starts_with(argv[i], "--flush="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_FLUSH]);
+        else if (param_starts_with(argv[i], "--output="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_OUTPUT]);
+        else if (param_starts_with(argv[i], "--roofline="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_ROOFLINE]);
+        else if (param_starts_with(argv[i], "--memory="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_MEMORY]);
+        else if (param_starts_with(argv[i], "--energy="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_ENERGY]);
+        else if (param_starts_with(argv[i], "--compare="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_COMPARE]);
+        else if (param_starts_with(argv[i], "--sched="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_SCHED]);
+        else if (param_starts_with(argv[i], "--scaling="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_SCALING]);
+
         //--------------------------------------------------
         // Scan integer parameters.
         //--------------------------------------------------
         else if (param_starts_with(argv[i], "--iter="))
             iter = strtol(strchr(argv[i], '=')+1, NULL, 10);
+        else if (param_starts_with(argv[i], "--tune="))
+            tune_path = strchr(argv[i], '=')+1;
+        else if (param_starts_with(argv[i], "--warmup="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_WARMUP]);
+        else if (param_starts_with(argv[i], "--threads="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_THREADS]);
 
         else if (param_starts_with(argv[i], "--dim")) {
             bool outer = param[PARAM_DIM_OUTER].val[0].c == 'y';
@@ -570,6 +1872,13 @@ int param_read(int argc, char **argv, param_t param[])
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_KU]);
         else if (param_starts_with(argv[i], "--nrhs="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NRHS]);
+        else if (param_starts_with(argv[i], "--batch="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_BATCH]);
+        else if (param_starts_with(argv[i], "--oversample="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_OVERSAMPLE]);
+        else if (param_starts_with(argv[i], "--power="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_POWER]);
 
         else if (param_starts_with(argv[i], "--nb="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NB]);
@@ -579,6 +1888,17 @@ int param_read(int argc, char **argv, param_t param[])
         else if (param_starts_with(argv[i], "--hmode="))
             err = param_scan_char(strchr(argv[i], '=')+1,
                     &param[PARAM_HMODE]);
+        else if (param_starts_with(argv[i], "--tree="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_TREE]);
+        else if (param_starts_with(argv[i], "--tbs="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_TBS]);
+        else if (param_starts_with(argv[i], "--tsblock="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_TSBLOCK]);
+        else if (param_starts_with(argv[i], "--hhgroup="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_HHGROUP]);
 
         else if (param_starts_with(argv[i], "--pada="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_PADA]);
@@ -589,10 +1909,77 @@ int param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--ntpf="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NTPF]);
+        else if (param_starts_with(argv[i], "--pmode="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_PMODE]);
+        else if (param_starts_with(argv[i], "--umode="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_UMODE]);
+        else if (param_starts_with(argv[i], "--lpiv="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_LPIV]);
+        else if (param_starts_with(argv[i], "--cvar="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_CVAR]);
+        else if (param_starts_with(argv[i], "--cswitch="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_CSWITCH]);
+        else if (param_starts_with(argv[i], "--tail="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_TAIL]);
+        else if (param_starts_with(argv[i], "--window="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_WINDOW]);
+        else if (param_starts_with(argv[i], "--tstream="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_TSTREAM]);
+        else if (param_starts_with(argv[i], "--gvar="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_GVAR]);
+        else if (param_starts_with(argv[i], "--gelsvar="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_GELSVAR]);
+        else if (param_starts_with(argv[i], "--getrivar="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_GETRIVAR]);
+        else if (param_starts_with(argv[i], "--ghint="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_GHINT]);
+        else if (param_starts_with(argv[i], "--slevels="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_SLEVELS]);
+        else if (param_starts_with(argv[i], "--sthresh="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_STHRESH]);
+        else if (param_starts_with(argv[i], "--subnb="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                    &param[PARAM_SUBNB]);
+        else if (param_starts_with(argv[i], "--rmode="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_RMODE]);
+        else if (param_starts_with(argv[i], "--fprec="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_FPREC]);
+        else if (param_starts_with(argv[i], "--ptol="))
+            err = param_scan_double(strchr(argv[i], '=')+1,
+                    &param[PARAM_PTOL]);
+        else if (param_starts_with(argv[i], "--rate="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_RATE]);
+        else if (param_starts_with(argv[i], "--inplace="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_INPLACE]);
+        else if (param_starts_with(argv[i], "--layout="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_LAYOUT]);
+        else if (param_starts_with(argv[i], "--tile="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                    &param[PARAM_TILE]);
         else if (param_starts_with(argv[i], "--zerocol="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ZEROCOL]);
         else if (param_starts_with(argv[i], "--incx="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_INCX]);
+        else if (param_starts_with(argv[i], "--isgn="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ISGN]);
 
         //--------------------------------------------------
         // Scan double precision parameters.
@@ -640,6 +2027,24 @@ int param_read(int argc, char **argv, param_t param[])
         param_add_char('y', &param[PARAM_OUTER]);
     if (param[PARAM_TEST].num == 0)
         param_add_char('y', &param[PARAM_TEST]);
+    if (param[PARAM_WARMUP].num == 0)
+        param_add_int(0, &param[PARAM_WARMUP]);
+    if (param[PARAM_FLUSH].num == 0)
+        param_add_char('n', &param[PARAM_FLUSH]);
+    if (param[PARAM_OUTPUT].num == 0)
+        param_add_char('t', &param[PARAM_OUTPUT]);
+    if (param[PARAM_ROOFLINE].num == 0)
+        param_add_char('n', &param[PARAM_ROOFLINE]);
+    if (param[PARAM_MEMORY].num == 0)
+        param_add_char('n', &param[PARAM_MEMORY]);
+    if (param[PARAM_ENERGY].num == 0)
+        param_add_char('n', &param[PARAM_ENERGY]);
+    if (param[PARAM_COMPARE].num == 0)
+        param_add_char('n', &param[PARAM_COMPARE]);
+    if (param[PARAM_SCHED].num == 0)
+        param_add_char('n', &param[PARAM_SCHED]);
+    if (param[PARAM_SCALING].num == 0)
+        param_add_char('s', &param[PARAM_SCALING]);
 
     if (param[PARAM_SIDE].num == 0)
         param_add_char('l', &param[PARAM_SIDE]);
@@ -655,6 +2060,10 @@ int param_read(int argc, char **argv, param_t param[])
         param_add_char('n', &param[PARAM_DIAG]);
     if (param[PARAM_COLROW].num == 0)
         param_add_char('c', &param[PARAM_COLROW]);
+    if (param[PARAM_JOBZ].num == 0)
+        param_add_char('v', &param[PARAM_JOBZ]);
+    if (param[PARAM_ITYPE].num == 0)
+        param_add_int(1, &param[PARAM_ITYPE]);
     if (param[PARAM_NORM].num == 0)
         param_add_char('o', &param[PARAM_NORM]);
 
@@ -671,6 +2080,12 @@ int param_read(int argc, char **argv, param_t param[])
         param_add_int(200, &param[PARAM_KU]);
     if (param[PARAM_NRHS].num == 0)
         param_add_int(1000, &param[PARAM_NRHS]);
+    if (param[PARAM_BATCH].num == 0)
+        param_add_int(1000, &param[PARAM_BATCH]);
+    if (param[PARAM_OVERSAMPLE].num == 0)
+        param_add_int(10, &param[PARAM_OVERSAMPLE]);
+    if (param[PARAM_POWER].num == 0)
+        param_add_int(2, &param[PARAM_POWER]);
 
     if (param[PARAM_NB].num == 0)
         param_add_int(256, &param[PARAM_NB]);
@@ -678,7 +2093,15 @@ int param_read(int argc, char **argv, param_t param[])
         param_add_int(64, &param[PARAM_IB]);
 
     if (param[PARAM_HMODE].num == 0)
-        param_add_char('f', &param[PARAM_HMODE]);
+        param_add_char('a', &param[PARAM_HMODE]);
+    if (param[PARAM_TREE].num == 0)
+        param_add_char('p', &param[PARAM_TREE]);
+    if (param[PARAM_TBS].num == 0)
+        param_add_int(4, &param[PARAM_TBS]);
+    if (param[PARAM_TSBLOCK].num == 0)
+        param_add_int(0, &param[PARAM_TSBLOCK]);
+    if (param[PARAM_HHGROUP].num == 0)
+        param_add_int(0, &param[PARAM_HHGROUP]);
 
     if (param[PARAM_PADA].num == 0)
         param_add_int(0, &param[PARAM_PADA]);
@@ -689,10 +2112,57 @@ int param_read(int argc, char **argv, param_t param[])
 
     if (param[PARAM_NTPF].num == 0)
         param_add_int(1, &param[PARAM_NTPF]);
+
+    if (param[PARAM_PMODE].num == 0)
+        param_add_char('i', &param[PARAM_PMODE]);
+    if (param[PARAM_UMODE].num == 0)
+        param_add_char('c', &param[PARAM_UMODE]);
+    if (param[PARAM_LPIV].num == 0)
+        param_add_char('y', &param[PARAM_LPIV]);
+    if (param[PARAM_CVAR].num == 0)
+        param_add_char('r', &param[PARAM_CVAR]);
+    if (param[PARAM_CSWITCH].num == 0)
+        param_add_int(16, &param[PARAM_CSWITCH]);
+    if (param[PARAM_TAIL].num == 0)
+        param_add_int(0, &param[PARAM_TAIL]);
+    if (param[PARAM_WINDOW].num == 0)
+        param_add_int(0, &param[PARAM_WINDOW]);
+    if (param[PARAM_TSTREAM].num == 0)
+        param_add_int(0, &param[PARAM_TSTREAM]);
+    if (param[PARAM_GVAR].num == 0)
+        param_add_char('c', &param[PARAM_GVAR]);
+    if (param[PARAM_GELSVAR].num == 0)
+        param_add_char('c', &param[PARAM_GELSVAR]);
+    if (param[PARAM_GETRIVAR].num == 0)
+        param_add_char('c', &param[PARAM_GETRIVAR]);
+    if (param[PARAM_GHINT].num == 0)
+        param_add_char('a', &param[PARAM_GHINT]);
+    if (param[PARAM_SLEVELS].num == 0)
+        param_add_int(2, &param[PARAM_SLEVELS]);
+    if (param[PARAM_STHRESH].num == 0)
+        param_add_int(16, &param[PARAM_STHRESH]);
+    if (param[PARAM_SUBNB].num == 0)
+        param_add_int(0, &param[PARAM_SUBNB]);
+    if (param[PARAM_RMODE].num == 0)
+        param_add_char('c', &param[PARAM_RMODE]);
+    if (param[PARAM_FPREC].num == 0)
+        param_add_char('s', &param[PARAM_FPREC]);
+    if (param[PARAM_PTOL].num == 0)
+        param_add_double(1e-9, &param[PARAM_PTOL]);
+    if (param[PARAM_RATE].num == 0)
+        param_add_int(0, &param[PARAM_RATE]);
+    if (param[PARAM_INPLACE].num == 0)
+        param_add_char('n', &param[PARAM_INPLACE]);
+    if (param[PARAM_LAYOUT].num == 0)
+        param_add_char('c', &param[PARAM_LAYOUT]);
+    if (param[PARAM_TILE].num == 0)
+        param_add_char('n', &param[PARAM_TILE]);
     if (param[PARAM_ZEROCOL].num == 0)
         param_add_int(-1, &param[PARAM_ZEROCOL]);
     if (param[PARAM_INCX].num == 0)
         param_add_int(1, &param[PARAM_INCX]);
+    if (param[PARAM_ISGN].num == 0)
+        param_add_int(1, &param[PARAM_ISGN]);
 
     //--------------------------------------------------
     // Set double precision parameters.
@@ -11,8 +11,10 @@
 #define TEST_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "plasma_types.h"
+#include "plasma_trace.h"
 
 //==============================================================================
 // parameter labels
@@ -22,6 +24,17 @@ typedef enum {
     // input parameters
     //------------------------------------------------------
     PARAM_ITER,    // outer product iteration?
+    PARAM_TUNE,    // file of the fastest nb, ib and ntpf of each size
+    PARAM_WARMUP,  // untimed runs before the iterations
+    PARAM_FLUSH,   // flush the caches before each run?
+    PARAM_OUTPUT,  // output format - text, CSV or JSON
+    PARAM_ROOFLINE, // compare the rates to the measured peaks?
+    PARAM_MEMORY,  // report the storage of the tile matrices and workspaces?
+    PARAM_ENERGY,  // report the energy of the runs?
+    PARAM_COMPARE, // time the vendor LAPACK or BLAS call too?
+    PARAM_SCHED,   // report the overhead of the scheduling of the tasks?
+    PARAM_THREADS, // thread counts swept in one run
+    PARAM_SCALING, // strong or weak scaling over the thread counts
     PARAM_OUTER,   // outer product iteration?
     PARAM_DIM_OUTER, // outer product iteration for dimensions M, N, K?
     PARAM_TEST,    // test the solution?
@@ -33,22 +46,54 @@ typedef enum {
     PARAM_UPLO,    // general rectangular or upper or lower triangular
     PARAM_DIAG,    // non-unit or unit diagonal
     PARAM_COLROW,  // columnwise or rowwise operation
+    PARAM_JOBZ,    // eigenvalues only or with the eigenvectors
+    PARAM_ITYPE,   // type of the generalized eigenproblem
     PARAM_DIM,     // M, N, K dimensions
     PARAM_KL,      // lower bandwidth
     PARAM_KU,      // upper bandwidth
     PARAM_NRHS,    // number of RHS
+    PARAM_BATCH,   // number of matrices in a batch
+    PARAM_OVERSAMPLE, // columns sampled beyond the rank K
+    PARAM_POWER,   // power iterations of the randomized range finder
     PARAM_NB,      // tile size NBxNB
     PARAM_IB,      // inner blocking size
-    PARAM_HMODE,   // Householder mode - tree or flat
+    PARAM_HMODE,   // Householder mode - tree, flat or automatic
+    PARAM_TREE,    // Householder reduction tree for the tree mode
+    PARAM_TBS,     // domain size of the PLASMA tree
+    PARAM_TSBLOCK, // tiles per TS block of the flat QR/LQ, 0 for none
+    PARAM_HHGROUP, // TS tiles applied as one block by unmqr/unmlq
     PARAM_ALPHA,   // scalar alpha
     PARAM_BETA,    // scalar beta
     PARAM_PADA,    // padding of A
     PARAM_PADB,    // padding of B
     PARAM_PADC,    // padding of C
     PARAM_NTPF,    // number of threads for panel factorization
+    PARAM_PMODE,   // panel mode - iterative, recursive or tournament
+    PARAM_UMODE,   // update mode - column or tile tasks
+    PARAM_LPIV,    // LU pivoting to the left - by getrf or left to getrs
+    PARAM_CVAR,    // Cholesky variant - right-looking, left-looking or hybrid
+    PARAM_CSWITCH, // tile columns factored right-looking by the hybrid
+    PARAM_TAIL,    // trailing tile columns factored by one task, 0 for none
+    PARAM_WINDOW,  // steps submitted before waiting for the tasks, 0 for all
+    PARAM_TSTREAM, // tile columns (rows) of B per streamed trsm panel
+    PARAM_GVAR,    // gemm variant - classic, Strassen-Winograd, packed or 3M
+    PARAM_GELSVAR, // gels variant - classic or fused
+    PARAM_GETRIVAR, // getri variant - classic or Gauss-Jordan
+    PARAM_GHINT,   // gemm hint - auto, none or rank-k, B = A with s or r
+    PARAM_SLEVELS, // largest number of Strassen-Winograd levels
+    PARAM_STHRESH, // smallest dimension in tiles of a Strassen-Winograd level
+    PARAM_SUBNB,   // sub-tile size of the nested tasks, 0 for none
+    PARAM_RMODE,   // refinement mode - classic or GMRES
+    PARAM_FPREC,   // factorization precision - single or bfloat16
+    PARAM_PTOL,    // backward error targeted by the adaptive precision
+    PARAM_RATE,    // bytes kept of each real number of packed tiles
+    PARAM_INPLACE, // translation to tile layout in place or out of place
+    PARAM_LAYOUT,  // column-major or row-major LAPACK arrays
+    PARAM_TILE,    // time the tile interface apart from the translations
     PARAM_NORM,    // type of matrix norm
     PARAM_ZEROCOL, // if positive, a column of zeros inserted at that index
     PARAM_INCX,    // 1 to pivot forward, -1 to pivot backward
+    PARAM_ISGN,    // sign of the Sylvester equation, 1 or -1
 
     //------------------------------------------------------
     // output parameters
@@ -58,6 +103,8 @@ typedef enum {
     PARAM_ORTHO,   // orthogonality error
     PARAM_TIME,    // time to solution
     PARAM_GFLOPS,  // GFLOPS rate
+    PARAM_GBYTES,  // GB/s rate of the compulsory memory traffic
+    PARAM_VTIME,   // time of the vendor call, with --compare=y
 
     //------------------------------------------------------
     // Keep at the end!
@@ -73,6 +120,36 @@ static const char * const ParamUsage[][2] = {
     // input parameters
     //------------------------------------------------------
     {"--iter=", "number of iterations per set of parameters [default: 1]"},
+    {"--tune=", "file of tuned parameters, where the fastest nb, ib and ntpf"
+                " of each size are stored"},
+    {"--warmup=", "untimed runs per set of parameters, before the iterations"
+                  " [default: 0]"},
+    {"--flush=[y|n]", "flush the caches before each run [default: n]"},
+    {"--output=[t|c|j]",
+        "output - text, one CSV row or one JSON line per set of parameters,"
+        " with the statistics of the iterations [default: t]"},
+    {"--roofline=[y|n]",
+        "compare the median GB/s and GFLOPS to the STREAM triad bandwidth"
+        " and the gemm rate, measured once [default: n]"},
+    {"--memory=[y|n]",
+        "report the peak and the sum of the bytes of the tile matrices"
+        " and workspaces of the runs [default: n]"},
+    {"--energy=[y|n]",
+        "report the joules, watts and GFLOPS per watt of the runs, from the"
+        " RAPL counters of the packages and their DRAM [default: n]"},
+    {"--compare=[y|n]",
+        "time the vendor LAPACK or BLAS call on the same input too, with the"
+        " speedup of PLASMA over it [default: n]"},
+    {"--sched=[y|n]",
+        "report the tasks, their mean duration, the time of the master"
+        " outside tasks and the histogram of the ready to start latencies"
+        " of the tasks of the runs, with -DPLASMA_WITH_TRACE [default: n]"},
+    {"--threads=",
+        "thread counts swept in one run, re-initializing PLASMA for each,"
+        " with the speedup and efficiency over the first"},
+    {"--scaling=[s|w]",
+        "scaling over --threads - strong, or weak with the dimensions"
+        " scaled for cubic work per thread [default: s]"},
     {"--outer=[y|n]", "outer product iteration [default: y]"},
     {"--dim-outer=[y|n]", "outer product iteration of M x N x K"
                           " in subsequent --dim [default: n]"},
@@ -86,26 +163,106 @@ static const char * const ParamUsage[][2] = {
         "general rectangular or upper or lower triangular matrix [default: l]"},
     {"--diag=[n|u]", "not unit triangular or unit matrix [default: n]"},
     {"--colrow=[c|r]", "columnwise or rowwise [default: c]"},
+    {"--jobz=[n|v]", "eigenvalues only or with eigenvectors [default: v]"},
+    {"--itype=[1|2|3]", "generalized eigenproblem A x = l B x, A B x = l x,"
+                        " or B A x = l x [default: 1]"},
     {"--dim=", "M x N x K dimensions. N and K are optional;"
                " if not given, N=M and K=N [default: 1000x1000x1000]"},
     {"--kl=", "Lower bandwidth [default: 200]"},
     {"--ku=", "Upper bandwidth [default: 200]"},
     {"--nrhs=", "NHRS dimension (number of columns) [default: 1000]"},
+    {"--batch=", "number of matrices in a batch [default: 1000]"},
+    {"--oversample=",
+        "columns sampled beyond the rank K by randomized methods [default: 10]"},
+    {"--power=", "power iterations of randomized methods [default: 2]"},
     {"--nb=", "NB size of tile (NB by NB) [default: 256]"},
     {"--ib=", "IB inner blocking size [default: 64]"},
-    {"--hmode=[f|t]", "Householder mode for QR/LQ - flat or tree [default: f]"},
+    {"--hmode=[f|t|a]",
+        "Householder mode for QR/LQ - flat, tree or automatic [default: a]"},
+    {"--tree=[a|s|t|p|g|f]",
+        "reduction tree for tree QR/LQ - auto, flat TS, flat TT, PLASMA,"
+        " greedy or forest [default: p]"},
+    {"--tbs=", "domain size of the PLASMA tree [default: 4]"},
+    {"--tsblock=",
+        "tiles per TS block of flat QR/LQ, reduced by a TT tree [default: 0]"},
+    {"--hhgroup=",
+        "TS tiles applied as one merged block by unmqr/unmlq [default: 0]"},
     {"--alpha=", "scalar alpha"},
     {"--beta=", "scalar beta"},
     {"--pada=", "padding added to lda [default: 0]"},
     {"--padb=", "padding added to ldb [default: 0]"},
     {"--padc=", "padding added to ldc [default: 0]"},
     {"--ntpf=", "number of threads for panel factorization [default: 1]"},
+    {"--pmode=[i|r|t]",
+        "panel mode for LU - iterative, recursive or tournament [default: i]"},
+    {"--umode=[c|t]",
+        "update mode for LU and band Cholesky - column or tile tasks"
+        " [default: c]"},
+    {"--lpiv=[y|n]",
+        "LU pivoting to the left - by getrf, or left to getrs applying"
+        " the pivots block by block [default: y]"},
+    {"--cvar=[r|l|h]",
+        "Cholesky variant - right-looking, left-looking or hybrid"
+        " [default: r]"},
+    {"--cswitch=",
+        "tile columns factored right-looking by the hybrid Cholesky"
+        " [default: 16]"},
+    {"--tail=",
+        "trailing tile columns factored by one task with the threads of"
+        " the BLAS, 0 for none [default: 0]"},
+    {"--window=",
+        "steps submitted before waiting for their tasks, 0 for all"
+        " [default: 0]"},
+    {"--tstream=",
+        "tile columns (rows) of B per panel streamed by trsm, 0 for all"
+        " [default: 0]"},
+    {"--gvar=[c|s|p|m|o]",
+        "gemm variant - classic, Strassen-Winograd, packed, 3M or Ozaki"
+        " [default: c]"},
+    {"--gelsvar=[c|f]",
+        "gels variant - classic, or Q^H B fused with the QR factorization"
+        " [default: c]"},
+    {"--getrivar=[c|g]",
+        "getri variant - classic, or one Gauss-Jordan sweep [default: c]"},
+    {"--ghint=[a|n|s|r]",
+        "gemm hint - auto, none, auto with B = A, or rank-k with B = A"
+        " [default: a]"},
+    {"--slevels=", "largest number of Strassen-Winograd levels [default: 2]"},
+    {"--sthresh=",
+        "smallest dimension in tiles of a Strassen-Winograd level"
+        " [default: 16]"},
+    {"--subnb=",
+        "sub-tile size of the nested tasks of large tiles, 0 for none"
+        " [default: 0]"},
+    {"--rmode=[c|g]",
+        "refinement mode for mixed precision - classic or GMRES [default: c]"},
+    {"--fprec=[s|b]",
+        "factorization precision for mixed precision - single or bfloat16"
+        " [default: s]"},
+    {"--ptol=",
+        "backward error targeted by the adaptive precision"
+        " and tile low-rank factorizations [default: 1e-9]"},
+    {"--rate=",
+        "bytes kept of each real number of packed tiles, 0 for unpacked"
+        " [default: 0]"},
+    {"--inplace=[y|n|v]",
+        "translate the LAPACK arrays to tile layout in place, or take the"
+        " tiles of gemm and trsm as views of them, not translated"
+        " [default: n]"},
+    {"--layout=[c|r]",
+        "layout of the LAPACK arrays, column-major or row-major"
+        " [default: c]"},
+    {"--tile=[y|n]",
+        "time the tile interface on matrices translated beforehand, with the"
+        " translation and compute times as columns [default: n]"},
     {"--norm=[m|o|i|f]",
         "type of matrix norm (max, one, inf, frobenius) [default: o]"},
     {"--zerocol=",
         "if positive, a column of zeros inserted at that index [default: -1]"},
     {"--incx=",
         "1 to pivot forward, -1 to pivot backward [default: 1]"},
+    {"--isgn=",
+        "sign of the Sylvester equation, 1 or -1 [default: 1]"},
 
     //------------------------------------------------------
     // output parameters
@@ -115,7 +272,9 @@ static const char * const ParamUsage[][2] = {
     {"error", "numerical error"},
     {"ortho", "orthogonality error"},
     {"time", "time to solution"},
-    {"gflops", "GFLOPS rate"}
+    {"gflops", "GFLOPS rate"},
+    {"gbytes", "GB/s rate"},
+    {"vtime", "time of the vendor call"}
 };
 
 //==============================================================================
@@ -142,9 +301,6 @@ typedef struct {
     param_value_t *val; // array of values for a parameter
 } param_t;
 
-// hiding double from precision translation when used for taking time
-typedef double plasma_time_t;
-
 // initial size of values array
 static const int InitValArraySize = 1024;
 
@@ -158,11 +314,40 @@ static const int InfoLen = 1024;
 // each column is InfoSpacing wide + 1 space between columns
 static const int InfoSpacing = 11;
 
+// size of the buffer written to flush the caches, above the last level cache
+static const size_t FlushSize = (size_t)256*1024*1024;
+
+// RAPL zones of the powercap interface, read for the energy of the runs
+static const char * const PowercapPath = "/sys/class/powercap";
+enum { EnergyMaxZones = 16 };
+
+// order of the gemm and runs of the probes of the roofline peaks
+static const int RooflineGemmSize = 2048;
+static const int RooflineRuns = 3;
+
 // function declarations
 void print_main_usage();
 void print_routine_usage(const char *name);
 void print_usage(int label);
 int  test_routine(int test, const char *name, param_value_t param[]);
+int  bench_routine(int test, const char *name, param_value_t pval[],
+                   int iter);
+void bench_flush();
+double bench_energy();
+double scale_efficiency(double gflops, double *speedup);
+void bench_peaks(const char *name, double *peak_gflops, double *peak_gbytes);
+void bench_print(int test, const char *name, param_value_t pval[],
+                 const char *info, int iter, int num_failed,
+                 double error, double *time, double *gflops,
+                 double *gbytes, plasma_stats_memory_t *memory,
+                 double *watts, double *vtime,
+                 plasma_trace_sched_t *sched);
+void bench_tile_info(char *info, int tile, double translate,
+                     double compute);
+void tune_record(int test, param_value_t pval[]);
+double perf_case(const char *routine, const char *args, int warmup, int iter);
+int  perf_run(int argc, char **argv);
+int  tune_save(const char *routine);
 void run_routine(const char *name, param_value_t pval[], char *info);
 void param_init(param_t param[]);
 int  param_read(int argc, char **argv, param_t param[]);
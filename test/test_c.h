@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_z.h, normal z -> c, Mon Feb  6 14:07:18 2017
+ * @generated from test/test_z.h, normal z -> c, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef TEST_C_H
@@ -19,20 +19,45 @@
 //==============================================================================
 void test_scamax(param_value_t param[], char *info);
 void test_cgbsv(param_value_t param[], char *info);
+void test_cgbsv_batched(param_value_t param[], char *info);
 void test_cgbtrf(param_value_t param[], char *info);
 void test_cgeadd(param_value_t param[], char *info);
+void test_cgecon(param_value_t param[], char *info);
 void test_cgelqf(param_value_t param[], char *info);
 void test_cgelqs(param_value_t param[], char *info);
 void test_cgels(param_value_t param[], char *info);
 void test_cgemm(param_value_t param[], char *info);
+void test_cgemm_batched(param_value_t param[], char *info);
+void test_cgemm_vbatched(param_value_t param[], char *info);
+void test_cgemm_epilogue(param_value_t param[], char *info);
+void test_cgemmt(param_value_t param[], char *info);
+void test_cgepolar(param_value_t param[], char *info);
+void test_cgeexp(param_value_t param[], char *info);
+void test_cgehrd(param_value_t param[], char *info);
+void test_cgeqp3(param_value_t param[], char *info);
 void test_cgeqrf(param_value_t param[], char *info);
+void test_cgeqrf_batched(param_value_t param[], char *info);
+void test_cgeqrf_cholqr(param_value_t param[], char *info);
 void test_cgeqrs(param_value_t param[], char *info);
 void test_cgesv(param_value_t param[], char *info);
+void test_cgesv_rbt(param_value_t param[], char *info);
+void test_cgesvd(param_value_t param[], char *info);
+void test_cgesvd_randomized(param_value_t param[], char *info);
 void test_cgetrf(param_value_t param[], char *info);
+void test_cgetrf_batched(param_value_t param[], char *info);
+void test_cgetrf_vbatched(param_value_t param[], char *info);
+void test_cgetrf_partial(param_value_t param[], char *info);
 void test_cgetri(param_value_t param[], char *info);
 void test_cgetri_aux(param_value_t param[], char *info);
 void test_cgetrs(param_value_t param[], char *info);
+void test_cgetrs_handle(param_value_t param[], char *info);
+void test_cgetrs_incpiv(param_value_t param[], char *info);
+void test_cgtsv(param_value_t param[], char *info);
+void test_cgtsv_batched(param_value_t param[], char *info);
+void test_cheev(param_value_t param[], char *info);
+void test_chegst(param_value_t param[], char *info);
 void test_chemm(param_value_t param[], char *info);
+void test_chesv(param_value_t param[], char *info);
 void test_cher2k(param_value_t param[], char *info);
 void test_cherk(param_value_t param[], char *info);
 void test_clacpy(param_value_t param[], char *info);
@@ -45,18 +70,34 @@ void test_clascl(param_value_t param[], char *info);
 void test_claset(param_value_t param[], char *info);
 void test_claswp(param_value_t param[], char *info);
 void test_clauum(param_value_t param[], char *info);
+void test_clrpotrf(param_value_t param[], char *info);
 void test_cpbsv(param_value_t param[], char *info);
 void test_cpbtrf(param_value_t param[], char *info);
+void test_cplrnt(param_value_t param[], char *info);
+void test_cpocon(param_value_t param[], char *info);
 void test_cposv(param_value_t param[], char *info);
+void test_cpipeline(param_value_t param[], char *info);
 void test_cpotrf(param_value_t param[], char *info);
+void test_cpotrf_batched(param_value_t param[], char *info);
+void test_cpotrf_vbatched(param_value_t param[], char *info);
+void test_cpotrf_partial(param_value_t param[], char *info);
+void test_cpotrf_sparse(param_value_t param[], char *info);
+void test_cpotrf_update(param_value_t param[], char *info);
 void test_cpotri(param_value_t param[], char *info);
 void test_cpotrs(param_value_t param[], char *info);
+void test_cpstrf(param_value_t param[], char *info);
+void test_cptsv(param_value_t param[], char *info);
+void test_cptsv_batched(param_value_t param[], char *info);
 void test_csymm(param_value_t param[], char *info);
 void test_csyr2k(param_value_t param[], char *info);
 void test_csyrk(param_value_t param[], char *info);
+void test_ctpqrt(param_value_t param[], char *info);
 void test_ctradd(param_value_t param[], char *info);
+void test_ctranspose(param_value_t param[], char *info);
 void test_ctrmm(param_value_t param[], char *info);
+void test_ctrmm3(param_value_t param[], char *info);
 void test_ctrsm(param_value_t param[], char *info);
+void test_ctrsyl(param_value_t param[], char *info);
 void test_ctrtri(param_value_t param[], char *info);
 void test_cunmlq(param_value_t param[], char *info);
 void test_cunmqr(param_value_t param[], char *info);
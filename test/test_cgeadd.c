@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgeadd.c, normal z -> c, Mon Feb  6 14:07:03 2017
+ * @generated from test/test_zgeadd.c, normal z -> c, Thu Oct 15 02:22:02 2026
  *
  **/
 
@@ -174,6 +174,7 @@ void test_cgeadd(param_value_t param[], char *info)
         plasma_time_t time    = stop-start;
         param[PARAM_TIME].d   = time;
         param[PARAM_GFLOPS].d = flops_cgeadd(m, n) / time / 1e9;
+        param[PARAM_GBYTES].d = bytes_cgeadd(m, n) / time / 1e9;
     }
 
     //==================================================================
@@ -0,0 +1,148 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgecon.c, normal z -> c, Thu Oct 15 02:55:22 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGECON.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgecon(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_NORM);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_NTPF);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "Norm",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "NTPF");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_NORM].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t norm = plasma_norm_const(param[PARAM_NORM].c);
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n+param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+    plasma_set(PlasmaLeftPivoting, PlasmaLeftPivotingOn);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    assert(ipiv != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    char normc = norm == PlasmaOneNorm ? '1' : 'I';
+    float Anorm = LAPACKE_clange(LAPACK_COL_MAJOR, normc, n, n, A, lda);
+
+    // The factorization is not timed.
+    plasma_cgetrf(n, n, A, lda, ipiv);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    float rcond;
+    plasma_time_t start = omp_get_wtime();
+    plasma_cgecon(norm, n, A, lda, Anorm, &rcond);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+
+    //================================================================
+    // Test results by comparing to the LAPACK estimate. Both are lower
+    // bounds of the norm of the inverse, so they should agree within
+    // the usual factor of the estimators.
+    //================================================================
+    if (test) {
+        float rcondref;
+        LAPACKE_cgecon(LAPACK_COL_MAJOR, normc, n, A, lda, Anorm, &rcondref);
+
+        float error = fabsf(rcond-rcondref)/rcondref;
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = rcond <= 10.0*rcondref &&
+                                 rcond >= 0.1*rcondref;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(ipiv);
+}
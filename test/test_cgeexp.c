@@ -0,0 +1,172 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgeexp.c, normal z -> c, Thu Oct 15 08:46:54 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGEEXP.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgeexp(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    // entries uniform in (-1, 1), over the square root of n, for a
+    // spectral radius of about 1, and a one norm growing as the square
+    // root of n, to exercise both the low degrees and the squarings
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(2, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+    for (size_t i = 0; i < (size_t)lda*n; i++)
+        A[i] /= sqrtf((float)n);
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cgeexp(n, A, lda);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    // The degree and the number of squarings depend on the norm of A.
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+
+    //================================================================
+    // Test results by checking e^A e^{-A} = I,
+    // |I - e^A e^{-A}|_1 / (|e^A|_1 |e^{-A}|_1).
+    //================================================================
+    if (test) {
+        plasma_complex32_t zone  =  1.0;
+        plasma_complex32_t zmone = -1.0;
+
+        // e^{-A}, in Aref
+        for (size_t i = 0; i < (size_t)lda*n; i++)
+            Aref[i] = -Aref[i];
+        int plainfo_neg = plasma_cgeexp(n, Aref, lda);
+
+        float *work = (float*)malloc((size_t)n*sizeof(float));
+        assert(work != NULL);
+
+        float Enorm = LAPACKE_clange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                           A, lda, work);
+        float Fnorm = LAPACKE_clange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                           Aref, lda, work);
+
+        plasma_complex32_t *Id =
+            (plasma_complex32_t*)malloc((size_t)n*n*
+                                        sizeof(plasma_complex32_t));
+        assert(Id != NULL);
+
+        LAPACKE_claset_work(LAPACK_COL_MAJOR, 'g', n, n, 0.0, 1.0, Id, n);
+        cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    n, n, n,
+                    CBLAS_SADDR(zmone), A,    lda,
+                                        Aref, lda,
+                    CBLAS_SADDR(zone),  Id,   n);
+
+        float error = LAPACKE_clange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                           Id, n, work);
+        if (Enorm*Fnorm != 0)
+            error /= Enorm*Fnorm;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess &&
+                                 plainfo_neg == PlasmaSuccess &&
+                                 error < tol;
+
+        free(Id);
+        free(work);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    if (test)
+        free(Aref);
+}
@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgehrd.c, normal z -> c, Thu Oct 15 08:59:52 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGEHRD.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgehrd(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_JOBZ);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_NTPF);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "JobQ",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_JOBZ].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t jobq = param[PARAM_JOBZ].c == 'n' ? PlasmaNoVec : PlasmaVec;
+
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldq = lda;
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *Q = NULL;
+    if (jobq == PlasmaVec) {
+        Q = (plasma_complex32_t*)malloc(
+            (size_t)ldq*n*sizeof(plasma_complex32_t));
+        assert(Q != NULL);
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cgehrd(jobq, n, A, lda, Q, ldq);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_cgehrd(n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking that H is upper Hessenberg, and
+    // A Q = Q H and the orthogonality of Q, or that H keeps the
+    // Frobenius norm of A.
+    //================================================================
+    if (test) {
+        float *work = (float*)malloc((size_t)n*sizeof(float));
+        assert(work != NULL);
+
+        // entries of H below the first subdiagonal
+        int hess = 1;
+        for (int j = 0; j < n; j++)
+            for (int i = j+2; i < n; i++)
+                if (A[i + (size_t)lda*j] != 0.0)
+                    hess = 0;
+
+        float error;
+        if (jobq == PlasmaVec) {
+            // |A|_1
+            float normA = LAPACKE_clange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                               Aref, lda, work);
+
+            // Build the identity matrix.
+            plasma_complex32_t *Id =
+                (plasma_complex32_t*)malloc((size_t)n*n*
+                                            sizeof(plasma_complex32_t));
+            assert(Id != NULL);
+            LAPACKE_claset_work(LAPACK_COL_MAJOR, 'g', n, n,
+                                0.0, 1.0, Id, n);
+
+            // |Id - Q^H * Q|_oo / n
+            cblas_cherk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                        -1.0, Q, ldq, 1.0, Id, n);
+            param[PARAM_ORTHO].d =
+                LAPACKE_clanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    n, Id, n, work) / n;
+
+            // R = A * Q - Q * H
+            plasma_complex32_t *R = Id;
+            plasma_complex32_t zone  =  1.0;
+            plasma_complex32_t zzero =  0.0;
+            plasma_complex32_t zmone = -1.0;
+            cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        CBLAS_SADDR(zone),  Q, ldq,
+                                            A, lda,
+                        CBLAS_SADDR(zzero), R, n);
+            cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        CBLAS_SADDR(zone),  Aref, lda,
+                                            Q,    ldq,
+                        CBLAS_SADDR(zmone), R,    n);
+
+            // |A * Q - Q * H|_1 / (|A|_1 * n)
+            error = LAPACKE_clange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                        R, n, work);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            free(Id);
+        }
+        else {
+            // ||H|_F - |A|_F| / (|A|_F * n)
+            float normA = LAPACKE_clange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               Aref, lda, work);
+            float normH = LAPACKE_clange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               A, lda, work);
+            error = fabsf(normH-normA);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            param[PARAM_ORTHO].d = 0.0;
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess && hess &&
+                                 error < tol && param[PARAM_ORTHO].d < tol;
+
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Q);
+    if (test)
+        free(Aref);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgelqf.c, normal z -> c, Mon Feb  6 14:07:04 2017
+ * @generated from test/test_zgelqf.c, normal z -> c, Thu Oct 15 02:28:52 2026
  *
  **/
 #include "test.h"
@@ -49,17 +49,23 @@ void test_cgelqf(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_HMODE);
+            print_usage(PARAM_TREE);
+            print_usage(PARAM_TBS);
+            print_usage(PARAM_TSBLOCK);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "M",
                      InfoSpacing, "N",
                      InfoSpacing, "PadA",
                      InfoSpacing, "NB",
                      InfoSpacing, "IB",
                      InfoSpacing, "Hous. mode",
+                     InfoSpacing, "Tree",
+                     InfoSpacing, "TBS",
+                     InfoSpacing, "TS block",
                      InfoSpacing, "Ortho.");
         }
         return;
@@ -67,13 +73,16 @@ void test_cgelqf(param_value_t param[], char *info)
     // Return column values.
     // ortho. column appended later.
     snprintf(info, InfoLen,
-             "%*d %*d %*d %*d %*d %*c",
+             "%*d %*d %*d %*d %*d %*c %*c %*d %*d",
              InfoSpacing, param[PARAM_DIM].dim.m,
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_NB].i,
              InfoSpacing, param[PARAM_IB].i,
-             InfoSpacing, param[PARAM_HMODE].c);
+             InfoSpacing, param[PARAM_HMODE].c,
+             InfoSpacing, param[PARAM_TREE].c,
+             InfoSpacing, param[PARAM_TBS].i,
+             InfoSpacing, param[PARAM_TSBLOCK].i);
 
     //================================================================
     // Set parameters.
@@ -94,9 +103,22 @@ void test_cgelqf(param_value_t param[], char *info)
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
+    switch (param[PARAM_TREE].c) {
+    case 'a': plasma_set(PlasmaHouseholderTree, PlasmaAutoTree);       break;
+    case 's': plasma_set(PlasmaHouseholderTree, PlasmaFlatTsTree);     break;
+    case 't': plasma_set(PlasmaHouseholderTree, PlasmaFlatTtTree);     break;
+    case 'g': plasma_set(PlasmaHouseholderTree, PlasmaGreedyTree);     break;
+    case 'f': plasma_set(PlasmaHouseholderTree, PlasmaAutoForestTree); break;
+    default:  plasma_set(PlasmaHouseholderTree, PlasmaPlasmaTree);     break;
+    }
+    plasma_set(PlasmaTreeDomainSize, param[PARAM_TBS].i);
+    plasma_set(PlasmaTsBlock, param[PARAM_TSBLOCK].i);
 
     //================================================================
     // Allocate and initialize arrays.
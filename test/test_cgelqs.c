@@ -100,6 +100,9 @@ void test_cgelqs(param_value_t param[], char *info)
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
@@ -0,0 +1,274 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgemm_batched.c, normal z -> c, Wed Oct 14 17:43:10 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGEMM_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgemm_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_TRANSA);
+            print_usage(PARAM_TRANSB);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_ALPHA);
+            print_usage(PARAM_BETA);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_PADC);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*d %*.4f %*.4f %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+    int batch = param[PARAM_BATCH].i;
+
+    int Am, An;
+    int Bm, Bn;
+    int Cm, Cn;
+
+    if (transa == PlasmaNoTrans) {
+        Am = m;
+        An = k;
+    }
+    else {
+        Am = k;
+        An = m;
+    }
+    if (transb == PlasmaNoTrans) {
+        Bm = k;
+        Bn = n;
+    }
+    else {
+        Bm = n;
+        Bn = k;
+    }
+    Cm = m;
+    Cn = n;
+
+    int lda = imax(1, Am + param[PARAM_PADA].i);
+    int ldb = imax(1, Bm + param[PARAM_PADB].i);
+    int ldc = imax(1, Cm + param[PARAM_PADC].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float eps = LAPACKE_slamch('E');
+
+#ifdef COMPLEX
+    plasma_complex32_t alpha = param[PARAM_ALPHA].z;
+    plasma_complex32_t beta  = param[PARAM_BETA].z;
+#else
+    float alpha = creal(param[PARAM_ALPHA].z);
+    float beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    size_t sizeA = (size_t)lda*An;
+    size_t sizeB = (size_t)ldb*Bn;
+    size_t sizeC = (size_t)ldc*Cn;
+
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc(batch*sizeA*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *B =
+        (plasma_complex32_t*)malloc(batch*sizeB*sizeof(plasma_complex32_t));
+    assert(B != NULL);
+
+    plasma_complex32_t *C =
+        (plasma_complex32_t*)malloc(batch*sizeC*sizeof(plasma_complex32_t));
+    assert(C != NULL);
+
+    plasma_complex32_t **pA =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pA != NULL);
+
+    plasma_complex32_t **pB =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pB != NULL);
+
+    plasma_complex32_t **pC =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pC != NULL);
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pB[i] = &B[i*sizeB];
+        pC[i] = &C[i*sizeC];
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, batch*sizeA, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_clarnv(1, seed, batch*sizeB, B);
+    assert(retval == 0);
+
+    retval = LAPACKE_clarnv(1, seed, batch*sizeC, C);
+    assert(retval == 0);
+
+    plasma_complex32_t *Cref = NULL;
+    if (test) {
+        Cref = (plasma_complex32_t*)malloc(
+            batch*sizeC*sizeof(plasma_complex32_t));
+        assert(Cref != NULL);
+
+        memcpy(Cref, C, batch*sizeC*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    plasma_cgemm_batched(
+        transa, transb,
+        m, n, k,
+        alpha, pA, lda,
+               pB, ldb,
+         beta, pC, ldc,
+        batch);
+
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = batch * flops_cgemm(m, n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        // |R - R_ref|_p < gamma_{k+2} * |alpha| * |A|_p * |B|_p +
+        //                 gamma_2 * |beta| * |C|_p
+        // holds component-wise or with |.|_p as 1, inf, or Frobenius norm.
+        // gamma_k = k*eps / (1 - k*eps), but we use
+        // gamma_k = sqrtf(k)*eps as a statistical average case.
+        // Using 3*eps covers complex arithmetic.
+        // See Higham, Accuracy and Stability of Numerical Algorithms, ch 2-3.
+        // The largest error of the batch is reported.
+        float error = 0.0;
+        for (int i = 0; i < batch; i++) {
+            float work[1];
+            float Anorm = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', Am, An, pA[i], lda, work);
+            float Bnorm = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', Bm, Bn, pB[i], ldb, work);
+            float Cnorm = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', Cm, Cn, &Cref[i*sizeC], ldc, work);
+
+            cblas_cgemm(
+                CblasColMajor,
+                (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                m, n, k,
+                CBLAS_SADDR(alpha), pA[i], lda,
+                                    pB[i], ldb,
+                 CBLAS_SADDR(beta), &Cref[i*sizeC], ldc);
+
+            plasma_complex32_t zmone = -1.0;
+            cblas_caxpy(sizeC, CBLAS_SADDR(zmone), &Cref[i*sizeC], 1, pC[i], 1);
+
+            float err = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', Cm, Cn, pC[i], ldc, work);
+            float normalize = sqrtf((float)k+2) * cabsf(alpha) * Anorm * Bnorm
+                             + 2 * cabsf(beta) * Cnorm;
+            if (normalize != 0)
+                err /= normalize;
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(pA);
+    free(pB);
+    free(pC);
+    if (test)
+        free(Cref);
+}
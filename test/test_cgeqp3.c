@@ -0,0 +1,223 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgeqp3.c, normal z -> c, Thu Oct 15 02:59:26 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGEQP3.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgeqp3(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_TREE);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Tree");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*c",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_TREE].c);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    // The tree of the tournament over the tile columns.
+    switch (param[PARAM_TREE].c) {
+    case 'a': plasma_set(PlasmaHouseholderTree, PlasmaAutoTree);       break;
+    case 's': plasma_set(PlasmaHouseholderTree, PlasmaFlatTsTree);     break;
+    case 't': plasma_set(PlasmaHouseholderTree, PlasmaFlatTtTree);     break;
+    case 'g': plasma_set(PlasmaHouseholderTree, PlasmaGreedyTree);     break;
+    case 'f': plasma_set(PlasmaHouseholderTree, PlasmaAutoForestTree); break;
+    default:  plasma_set(PlasmaHouseholderTree, PlasmaPlasmaTree);     break;
+    }
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    int *jpvt = (int*)malloc((size_t)imax(1, n)*sizeof(int));
+    assert(jpvt != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Prepare the descriptor for matrix T.
+    //================================================================
+    plasma_desc_t T;
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_cgeqp3(m, n, A, lda, jpvt, &T);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_cgeqrf(m, n) / time / 1e9;
+
+    //=================================================================
+    // Test results by checking that R^H R = (A P)^H (A P).
+    //=================================================================
+    if (test) {
+        int minmn = imin(m, n);
+
+        // Check that jpvt is a permutation.
+        int perm = 1;
+        int *seen = (int*)calloc((size_t)imax(1, n), sizeof(int));
+        assert(seen != NULL);
+        for (int j = 0; j < n; j++) {
+            if (jpvt[j] < 1 || jpvt[j] > n || seen[jpvt[j]-1])
+                perm = 0;
+            else
+                seen[jpvt[j]-1] = 1;
+        }
+        free(seen);
+
+        float error = 1.0;
+        if (perm) {
+            // Permute the columns of A.
+            plasma_complex32_t *AP =
+                (plasma_complex32_t*)malloc((size_t)m*n*
+                                            sizeof(plasma_complex32_t));
+            assert(AP != NULL);
+            for (int j = 0; j < n; j++)
+                memcpy(&AP[(size_t)j*m], &Aref[(size_t)(jpvt[j]-1)*lda],
+                       (size_t)m*sizeof(plasma_complex32_t));
+
+            // Extract the R.
+            plasma_complex32_t *R =
+                (plasma_complex32_t*)malloc((size_t)minmn*n*
+                                            sizeof(plasma_complex32_t));
+            assert(R != NULL);
+            LAPACKE_claset_work(LAPACK_COL_MAJOR, 'l', minmn, n,
+                                0.0, 0.0, R, minmn);
+            LAPACKE_clacpy_work(LAPACK_COL_MAJOR, 'u', minmn, n,
+                                A, lda, R, minmn);
+
+            // C = (A P)^H (A P) - R^H R
+            int ldc = imax(1, n);
+            plasma_complex32_t *C =
+                (plasma_complex32_t*)malloc((size_t)ldc*n*
+                                            sizeof(plasma_complex32_t));
+            assert(C != NULL);
+            cblas_cherk(CblasColMajor, CblasLower, CblasConjTrans, n, m,
+                        1.0, AP, m, 0.0, C, ldc);
+            cblas_cherk(CblasColMajor, CblasLower, CblasConjTrans, n, minmn,
+                        -1.0, R, minmn, 1.0, C, ldc);
+
+            float *work = (float*)malloc((size_t)imax(1, n)*sizeof(float));
+            assert(work != NULL);
+
+            // |A|_F
+            float normA = LAPACKE_clange_work(LAPACK_COL_MAJOR, 'F', m, n,
+                                               Aref, lda, work);
+
+            // |(A P)^H (A P) - R^H R|_F / (|A|_F^2 * n)
+            error = LAPACKE_clanhe_work(LAPACK_COL_MAJOR, 'F', 'l', n,
+                                        C, ldc, work);
+            if (normA > 0.0)
+                error /= normA*normA*n;
+
+            free(work);
+            free(AP);
+            free(R);
+            free(C);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = (perm && error < tol);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_desc_destroy(&T);
+    free(A);
+    free(jpvt);
+    if (test)
+        free(Aref);
+}
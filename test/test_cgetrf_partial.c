@@ -0,0 +1,208 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgetrf_partial.c, normal z -> c, Thu Oct 15 06:56:37 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGETRF_PARTIAL.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgetrf_partial(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int nb = param[PARAM_NB].i;
+
+    // The order of the block factored, a multiple of the tile size,
+    // unless it is the whole square matrix.
+    int k = imin(param[PARAM_DIM].dim.k, imin(m, n));
+    if (k < m || k < n)
+        k -= k%nb;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, m,
+             InfoSpacing, n,
+             InfoSpacing, k,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, nb);
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, nb);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc((size_t)imax(1, k)*sizeof(int));
+    assert(ipiv != NULL);
+
+    int retval;
+    retval = plasma_cplrnt(m, n, A, lda, 3172);
+    assert(retval == 0);
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cgetrf_partial(m, n, k, A, lda, ipiv);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = (flops_cgetrf(k, k) +
+                             flops_ctrsm(PlasmaLeft, k, n-k) +
+                             flops_ctrsm(PlasmaRight, m-k, k) +
+                             flops_cgemm(m-k, n-k, k)) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation,
+    // the factorization of A_11, the solves and the update of A_22.
+    // This will give spurious failures if LAPACK picks different pivots
+    // than PLASMA.
+    //================================================================
+    if (test) {
+        int *ipivref = (int*)malloc((size_t)imax(1, k)*sizeof(int));
+        assert(ipivref != NULL);
+
+        int lapinfo = LAPACKE_cgetrf(LAPACK_COL_MAJOR, k, k,
+                                     Aref, lda, ipivref);
+        if (lapinfo == 0) {
+            plasma_complex32_t zone  =  1.0;
+            plasma_complex32_t zmone = -1.0;
+            plasma_complex32_t *A11 = Aref;
+            plasma_complex32_t *A12 = &Aref[(size_t)lda*k];
+            plasma_complex32_t *A21 = &Aref[k];
+            plasma_complex32_t *A22 = &Aref[k + (size_t)lda*k];
+            if (n > k) {
+                LAPACKE_claswp_work(LAPACK_COL_MAJOR, n-k, A12, lda,
+                                    1, k, ipivref, 1);
+                cblas_ctrsm(CblasColMajor, CblasLeft, CblasLower,
+                            CblasNoTrans, CblasUnit,
+                            k, n-k,
+                            CBLAS_SADDR(zone), A11, lda,
+                                               A12, lda);
+            }
+            if (m > k) {
+                cblas_ctrsm(CblasColMajor, CblasRight, CblasUpper,
+                            CblasNoTrans, CblasNonUnit,
+                            m-k, k,
+                            CBLAS_SADDR(zone), A11, lda,
+                                               A21, lda);
+            }
+            if (m > k && n > k) {
+                cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                            m-k, n-k, k,
+                            CBLAS_SADDR(zmone), A21, lda,
+                                                A12, lda,
+                            CBLAS_SADDR(zone),  A22, lda);
+            }
+            cblas_caxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+            float work[1];
+            float Anorm = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+            float error = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, A, lda, work);
+            if (Anorm != 0.0)
+                error /= Anorm;
+            error /= sqrtf((float)m*n);
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            if (plainfo == lapinfo) {
+                param[PARAM_ERROR].d = 0.0;
+                param[PARAM_SUCCESS].i = 1;
+            }
+            else {
+                param[PARAM_ERROR].d = INFINITY;
+                param[PARAM_SUCCESS].i = 0;
+            }
+        }
+        free(ipivref);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(ipiv);
+    if (test)
+        free(Aref);
+}
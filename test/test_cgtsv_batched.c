@@ -0,0 +1,187 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgtsv_batched.c, normal z -> c, Thu Oct 15 07:31:12 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+// the element i of the system l, and (i, j) of its right hand sides
+#define V(v_, i_, l_)     v_[(size_t)(i_)*batch + (l_)]
+#define M(m_, i_, j_, l_) m_[((size_t)(j_)*n + (i_))*batch + (l_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGTSV_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cgtsv_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_BATCH);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "NRHS",
+                     InfoSpacing, "Batch");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_BATCH].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The systems are interleaved, and the diagonals of A are kept in
+    // A for the check. The diagonals are not dominant, so that the rows
+    // are interchanged.
+    //================================================================
+    size_t sizeD = (size_t)n*batch;
+    size_t sizeB = (size_t)n*nrhs*batch;
+
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc(6*sizeD*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+    plasma_complex32_t *dl = &A[0];
+    plasma_complex32_t *d  = &A[sizeD];
+    plasma_complex32_t *du = &A[2*sizeD];
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, 3*sizeD, A);
+    assert(retval == 0);
+    memcpy(&A[3*sizeD], A, 3*sizeD*sizeof(plasma_complex32_t));
+    plasma_complex32_t *dlref = &A[3*sizeD];
+    plasma_complex32_t *dref  = &A[4*sizeD];
+    plasma_complex32_t *duref = &A[5*sizeD];
+
+    plasma_complex32_t *X =
+        (plasma_complex32_t*)malloc(sizeB*sizeof(plasma_complex32_t));
+    assert(X != NULL);
+
+    retval = LAPACKE_clarnv(1, seed, sizeB, X);
+    assert(retval == 0);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    plasma_complex32_t *B = NULL;
+    if (test) {
+        B = (plasma_complex32_t*)malloc(sizeB*sizeof(plasma_complex32_t));
+        assert(B != NULL);
+        memcpy(B, X, sizeB*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_cgtsv_batched(n, nrhs, dl, d, du, X, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0 / time / 1e9;
+
+    //================================================================
+    // Test results by computing residual norms.
+    // The largest residual of the batch is reported.
+    //================================================================
+    if (test) {
+        float error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            if (plainfo[l] != 0) {
+                error = INFINITY;
+                continue;
+            }
+            float Anorm = 0.0;
+            float Xnorm = 0.0;
+            float Rnorm = 0.0;
+            for (int i = 0; i < n; i++) {
+                float asum = cabsf(V(dref, i, l));
+                if (i > 0)
+                    asum += cabsf(V(dlref, i-1, l));
+                if (i < n-1)
+                    asum += cabsf(V(duref, i, l));
+                Anorm = fmax(Anorm, asum);
+
+                float xsum = 0.0;
+                float rsum = 0.0;
+                for (int j = 0; j < nrhs; j++) {
+                    plasma_complex32_t r =
+                        M(B, i, j, l) - V(dref, i, l)*M(X, i, j, l);
+                    if (i > 0)
+                        r -= V(dlref, i-1, l)*M(X, i-1, j, l);
+                    if (i < n-1)
+                        r -= V(duref, i, l)*M(X, i+1, j, l);
+                    xsum += cabsf(M(X, i, j, l));
+                    rsum += cabsf(r);
+                }
+                Xnorm = fmax(Xnorm, xsum);
+                Rnorm = fmax(Rnorm, rsum);
+            }
+            if (Anorm*Xnorm != 0.0)
+                error = fmax(error, Rnorm/(n*Anorm*Xnorm));
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+        free(B);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(X);
+    free(plainfo);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zherk.c, normal z -> c, Mon Feb  6 14:07:08 2017
+ * @generated from test/test_zherk.c, normal z -> c, Thu Oct 15 05:03:01 2026
  *
  **/
 #include "test.h"
@@ -53,11 +53,12 @@ void test_cherk(param_value_t param[], char *info)
             print_usage(PARAM_PADA);
             print_usage(PARAM_PADC);
             print_usage(PARAM_NB);
+            print_usage(PARAM_GVAR);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "Uplo",
                      InfoSpacing, "Trans",
                      InfoSpacing, "N",
@@ -66,13 +67,14 @@ void test_cherk(param_value_t param[], char *info)
                      InfoSpacing, "beta",
                      InfoSpacing, "PadA",
                      InfoSpacing, "PadC",
-                     InfoSpacing, "NB");
+                     InfoSpacing, "NB",
+                     InfoSpacing, "GVar");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*c %*c %*d %*d %*.4f %*.4f %*d %*d %*d",
+             "%*c %*c %*d %*d %*.4f %*.4f %*d %*d %*d %*c",
              InfoSpacing, param[PARAM_UPLO].c,
              InfoSpacing, param[PARAM_TRANS].c,
              InfoSpacing, param[PARAM_DIM].dim.n,
@@ -81,7 +83,8 @@ void test_cherk(param_value_t param[], char *info)
              InfoSpacing, creal(param[PARAM_BETA].z),
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_PADC].i,
-             InfoSpacing, param[PARAM_NB].i);
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_GVAR].c);
 
     //================================================================
     // Set parameters.
@@ -119,6 +122,10 @@ void test_cherk(param_value_t param[], char *info)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_GVAR].c == 'm')
+        plasma_set(PlasmaGemmVariant, PlasmaGemm3m);
+    else
+        plasma_set(PlasmaGemmVariant, PlasmaClassicGemm);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zlaswp.c, normal z -> c, Mon Feb  6 14:07:12 2017
+ * @generated from test/test_zlaswp.c, normal z -> c, Thu Oct 15 02:22:02 2026
  *
  **/
 
@@ -139,6 +139,7 @@ void test_claswp(param_value_t param[], char *info)
 
     param[PARAM_TIME].d = stop-start;
     param[PARAM_GFLOPS].d = 0.0;
+    param[PARAM_GBYTES].d = bytes_claswp(m, n) / param[PARAM_TIME].d / 1e9;
 
     //================================================================
     // Test results by comparing to result of core_clacpy function
@@ -0,0 +1,135 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zplrnt.c, normal z -> c, Thu Oct 15 05:12:54 2026
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPLRNT.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cplrnt(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    unsigned long long seed = 5489;
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cplrnt(m, n, A, lda, seed);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+    param[PARAM_GBYTES].d = bytes_cplrnt(m, n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to the matrix generated as one block,
+    // which the tiles must not change.
+    //================================================================
+    if (test) {
+        plasma_complex32_t *Aref =
+            (plasma_complex32_t*)malloc(
+                (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+        core_cplrnt(m, n, Aref, lda, m, 0, 0, seed);
+
+        float error = 0.0;
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                error = fmax(error, cabsf(A[i+(size_t)lda*j] -
+                                         Aref[i+(size_t)lda*j]));
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess && error == 0.0;
+
+        free(Aref);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+}
@@ -0,0 +1,142 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpocon.c, normal z -> c, Thu Oct 15 02:55:22 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPOCON.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cpocon(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n+param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    // Make A Hermitian positive definite.
+    for (int j = 0; j < n; j++) {
+        A[j + (size_t)j*lda] = creal(A[j + (size_t)j*lda]) + n;
+        for (int i = 0; i < j; i++)
+            A[i + (size_t)j*lda] = conjf(A[j + (size_t)i*lda]);
+    }
+
+    char uploc = uplo == PlasmaLower ? 'L' : 'U';
+    float Anorm = LAPACKE_clange(LAPACK_COL_MAJOR, '1', n, n, A, lda);
+
+    // The factorization is not timed.
+    plasma_cpotrf(uplo, n, A, lda);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    float rcond;
+    plasma_time_t start = omp_get_wtime();
+    plasma_cpocon(uplo, n, A, lda, Anorm, &rcond);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+
+    //================================================================
+    // Test results by comparing to the LAPACK estimate. Both are lower
+    // bounds of the norm of the inverse, so they should agree within
+    // the usual factor of the estimators.
+    //================================================================
+    if (test) {
+        float rcondref;
+        LAPACKE_cpocon(LAPACK_COL_MAJOR, uploc, n, A, lda, Anorm, &rcondref);
+
+        float error = fabsf(rcond-rcondref)/rcondref;
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = rcond <= 10.0*rcondref &&
+                                 rcond >= 0.1*rcondref;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zpotrf.c, normal z -> c, Mon Feb  6 14:07:14 2017
+ * @generated from test/test_zpotrf.c, normal z -> c, Thu Oct 15 07:57:13 2026
  *
  **/
 #include "test.h"
@@ -26,8 +26,6 @@
 
 #define COMPLEX
 
-#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
-
 /***************************************************************************//**
  *
  * @brief Tests CPOTRF.
@@ -52,28 +50,51 @@ void test_cpotrf(param_value_t param[], char *info)
             print_usage(PARAM_DIM);
             print_usage(PARAM_PADA);
             print_usage(PARAM_NB);
+            print_usage(PARAM_CVAR);
+            print_usage(PARAM_CSWITCH);
+            print_usage(PARAM_TAIL);
+            print_usage(PARAM_NTPF);
+            print_usage(PARAM_WINDOW);
             print_usage(PARAM_ZEROCOL);
+            print_usage(PARAM_INPLACE);
+            print_usage(PARAM_TILE);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "Uplo",
                      InfoSpacing, "N",
                      InfoSpacing, "PadA",
                      InfoSpacing, "NB",
-                     InfoSpacing, "ZeroCol");
+                     InfoSpacing, "CVar",
+                     InfoSpacing, "CSwitch",
+                     InfoSpacing, "Tail",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "Window",
+                     InfoSpacing, "ZeroCol",
+                     InfoSpacing, "Inplace",
+                     InfoSpacing, "Tile",
+                     InfoSpacing, "Translate",
+                     InfoSpacing, "Compute");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*c %*d %*d %*d %*d",
+             "%*c %*d %*d %*d %*c %*d %*d %*d %*d %*d %*c %*c",
              InfoSpacing, param[PARAM_UPLO].c,
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_NB].i,
-             InfoSpacing, param[PARAM_ZEROCOL].i);
+             InfoSpacing, param[PARAM_CVAR].c,
+             InfoSpacing, param[PARAM_CSWITCH].i,
+             InfoSpacing, param[PARAM_TAIL].i,
+             InfoSpacing, param[PARAM_NTPF].i,
+             InfoSpacing, param[PARAM_WINDOW].i,
+             InfoSpacing, param[PARAM_ZEROCOL].i,
+             InfoSpacing, param[PARAM_INPLACE].c,
+             InfoSpacing, param[PARAM_TILE].c);
 
     //================================================================
     // Set parameters.
@@ -85,12 +106,27 @@ void test_cpotrf(param_value_t param[], char *info)
     int lda = imax(1, n + param[PARAM_PADA].i);
 
     int test = param[PARAM_TEST].c == 'y';
+    int tile = param[PARAM_TILE].c == 'y';
     float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
 
     //================================================================
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_CVAR].c == 'l')
+        plasma_set(PlasmaCholeskyVariant, PlasmaLeftLooking);
+    else if (param[PARAM_CVAR].c == 'h')
+        plasma_set(PlasmaCholeskyVariant, PlasmaHybridLooking);
+    else
+        plasma_set(PlasmaCholeskyVariant, PlasmaRightLooking);
+    plasma_set(PlasmaCholeskySwitch, param[PARAM_CSWITCH].i);
+    plasma_set(PlasmaTailTiles, param[PARAM_TAIL].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+    plasma_set(PlasmaTaskWindow, param[PARAM_WINDOW].i);
+    if (param[PARAM_INPLACE].c == 'y')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -99,23 +135,13 @@ void test_cpotrf(param_value_t param[], char *info)
         (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
     assert(A != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
-    assert(retval == 0);
-
     //================================================================
-    // Make the A matrix symmetric/Hermitian positive definite.
-    // It increases diagonal by n, and makes it real.
-    // It sets Aji = conjf( Aij ) for j < i, that is, copy lower
-    // triangle to upper triangle.
+    // Generate a symmetric/Hermitian positive definite A matrix,
+    // its diagonal increased by n.
     //================================================================
-    for (int i = 0; i < n; i++) {
-        A(i, i) = creal(A(i, i)) + n;
-        for (int j = 0; j < i; j++) {
-            A(j, i) = conjf(A(i, j));
-        }
-    }
+    int retval;
+    retval = plasma_cplghe((float)n, n, A, lda, 3172);
+    assert(retval == 0);
 
     int zerocol = param[PARAM_ZEROCOL].i;
     if (zerocol >= 0 && zerocol < n)
@@ -130,16 +156,76 @@ void test_cpotrf(param_value_t param[], char *info)
         memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
     }
 
+    //================================================================
+    // Time the vendor LAPACK on the same input, with --compare=y.
+    //================================================================
+    if (param[PARAM_COMPARE].c == 'y') {
+        plasma_complex32_t *Avend = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Avend != NULL);
+
+        memcpy(Avend, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+        plasma_time_t start = omp_get_wtime();
+        LAPACKE_cpotrf(LAPACK_COL_MAJOR, lapack_const(uplo), n, Avend, lda);
+        param[PARAM_VTIME].d = omp_get_wtime()-start;
+        free(Avend);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    int plainfo;
+    plasma_time_t compute = 0.0;
     plasma_time_t start = omp_get_wtime();
-    int plainfo = plasma_cpotrf(uplo, n, A, lda);
+
+    if (tile) {
+        // Time the tile interface apart from the translations.
+        int nb = param[PARAM_NB].i;
+        plasma_desc_t descA;
+        int status;
+        status = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                            n, n, 0, 0, n, n, &descA);
+        assert(status == PlasmaSuccess);
+
+        plasma_sequence_t *sequence = NULL;
+        status = plasma_sequence_create(&sequence);
+        assert(status == PlasmaSuccess);
+        plasma_request_t request = PlasmaRequestInitializer;
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_cge2desc(A, lda, descA, sequence, &request);
+        }
+        plasma_time_t start_compute = omp_get_wtime();
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_cpotrf(uplo, descA, sequence, &request);
+        }
+        compute = omp_get_wtime()-start_compute;
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_cdesc2ge(descA, A, lda, sequence, &request);
+        }
+
+        plasma_desc_destroy(&descA);
+        plainfo = sequence->status;
+        plasma_sequence_destroy(sequence);
+    }
+    else {
+        plainfo = plasma_cpotrf(uplo, n, A, lda);
+    }
+
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_cpotrf(n) / time / 1e9;
+    bench_tile_info(info, tile, time-compute, compute);
 
     //================================================================
     // Test results by comparing to a reference implementation.
@@ -0,0 +1,164 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_sparse.c, normal z -> c, Thu Oct 15 06:52:01 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPOTRF_SPARSE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cpotrf_sparse(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int nb = param[PARAM_NB].i;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, nb);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    //================================================================
+    // Generate a symmetric/Hermitian positive definite A matrix,
+    // its diagonal increased by n, and zero its off-diagonal tiles (i, j)
+    // with i-j not a multiple of 3, which keeps it diagonally dominant.
+    //================================================================
+    int retval;
+    retval = plasma_cplghe((float)n, n, A, lda, 3172);
+    assert(retval == 0);
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            if ((i/nb - j/nb)%3 != 0)
+                A[i + (size_t)lda*j] = 0.0;
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cpotrf_sparse(uplo, n, A, lda);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_cpotrf(n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        int lapinfo = LAPACKE_cpotrf(LAPACK_COL_MAJOR,
+                                     lapack_const(uplo), n,
+                                     Aref, lda);
+        if (lapinfo == 0 && plainfo == 0) {
+            plasma_complex32_t zmone = -1.0;
+            cblas_caxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+            float work[1];
+            float Anorm = LAPACKE_clanhe_work(
+                LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, Aref, lda, work);
+            float error = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', n, n, A, lda, work);
+            if (Anorm != 0)
+                error /= Anorm;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    if (test)
+        free(Aref);
+}
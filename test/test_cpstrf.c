@@ -0,0 +1,196 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpstrf.c, normal z -> c, Thu Oct 15 08:37:15 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define A(i_, j_)    A[(i_) + (size_t)lda*(j_)]
+#define Aref(i_, j_) Aref[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPSTRF.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_cpstrf(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_NTPF);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "NTPF");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int k = imin(param[PARAM_DIM].dim.k, n);
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    int *piv = (int*)malloc((size_t)imax(1, n)*sizeof(int));
+    assert(piv != NULL);
+
+    // A = G * G^H, positive semidefinite of rank k.
+    plasma_complex32_t *G =
+        (plasma_complex32_t*)malloc((size_t)imax(1, n)*imax(1, k)*
+                                    sizeof(plasma_complex32_t));
+    assert(G != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)n*k, G);
+    assert(retval == 0);
+
+    cblas_cherk(CblasColMajor, CblasLower, CblasNoTrans,
+                n, k,
+                1.0, G, imax(1, n),
+                0.0, A, lda);
+    free(G);
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    int rank;
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cpstrf(n, A, lda, piv, &rank, -1.0);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_cpstrf(n, rank) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the rank and the backward error
+    // of the factor, |P^T A P - L L^H|_F / |A|_F.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            float work[1];
+            float Anorm = LAPACKE_clanhe_work(
+                LAPACK_COL_MAJOR, 'F', 'L', n, Aref, lda, work);
+
+            // P^T A P, in its lower triangle
+            plasma_complex32_t *PAP =
+                (plasma_complex32_t*)malloc(
+                    (size_t)lda*n*sizeof(plasma_complex32_t));
+            assert(PAP != NULL);
+            for (int j = 0; j < n; j++) {
+                for (int i = j; i < n; i++) {
+                    int pi = piv[i]-1;
+                    int pj = piv[j]-1;
+                    PAP[i + (size_t)lda*j] =
+                        pi >= pj ? Aref(pi, pj) : conjf(Aref(pj, pi));
+                }
+            }
+
+            // Zero all but the lower trapezoid of the first rank columns,
+            // and compute P^T A P - L*L^H.
+            plasma_complex32_t zzero = 0.0;
+            LAPACKE_claset_work(LAPACK_COL_MAJOR, 'U', n-1, n-1,
+                                zzero, zzero, &A(0, 1), lda);
+            cblas_cherk(CblasColMajor, CblasLower, CblasNoTrans,
+                        n, rank,
+                        -1.0, A, lda,
+                         1.0, PAP, lda);
+
+            float error = LAPACKE_clanhe_work(
+                LAPACK_COL_MAJOR, 'F', 'L', n, PAP, lda, work);
+            if (Anorm != 0)
+                error /= Anorm;
+            free(PAP);
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = rank == k && error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(piv);
+    if (test)
+        free(Aref);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zunmlq.c, normal z -> c, Mon Feb  6 14:07:17 2017
+ * @generated from test/test_zunmlq.c, normal z -> c, Thu Oct 15 08:17:57 2026
  *
  **/
 #include "test.h"
@@ -53,11 +53,12 @@ void test_cunmlq(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_HMODE);
+            print_usage(PARAM_HHGROUP);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "side",
                      InfoSpacing, "trans",
                      InfoSpacing, "M",
@@ -67,13 +68,14 @@ void test_cunmlq(param_value_t param[], char *info)
                      InfoSpacing, "PadB",
                      InfoSpacing, "NB",
                      InfoSpacing, "IB",
-                     InfoSpacing, "Hous. mode");
+                     InfoSpacing, "Hous. mode",
+                     InfoSpacing, "HH group");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*c %*c %*d %*d %*d %*d %*d %*d %*d %*c",
+             "%*c %*c %*d %*d %*d %*d %*d %*d %*d %*c %*d",
              InfoSpacing, param[PARAM_SIDE].c,
              InfoSpacing, param[PARAM_TRANS].c,
              InfoSpacing, param[PARAM_DIM].dim.m,
@@ -83,7 +85,8 @@ void test_cunmlq(param_value_t param[], char *info)
              InfoSpacing, param[PARAM_PADB].i,
              InfoSpacing, param[PARAM_NB].i,
              InfoSpacing, param[PARAM_IB].i,
-             InfoSpacing, param[PARAM_HMODE].i);
+             InfoSpacing, param[PARAM_HMODE].i,
+             InfoSpacing, param[PARAM_HHGROUP].i);
 
     //================================================================
     // Set parameters.
@@ -136,9 +139,13 @@ void test_cunmlq(param_value_t param[], char *info)
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
+    plasma_set(PlasmaHouseholderGroup, param[PARAM_HHGROUP].i);
 
     //================================================================
     // Allocate and initialize array A for construction of matrix Q as
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_z.h, normal z -> d, Mon Feb  6 14:07:18 2017
+ * @generated from test/test_z.h, normal z -> d, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef TEST_D_H
@@ -19,20 +19,45 @@
 //==============================================================================
 void test_damax(param_value_t param[], char *info);
 void test_dgbsv(param_value_t param[], char *info);
+void test_dgbsv_batched(param_value_t param[], char *info);
 void test_dgbtrf(param_value_t param[], char *info);
 void test_dgeadd(param_value_t param[], char *info);
+void test_dgecon(param_value_t param[], char *info);
 void test_dgelqf(param_value_t param[], char *info);
 void test_dgelqs(param_value_t param[], char *info);
 void test_dgels(param_value_t param[], char *info);
 void test_dgemm(param_value_t param[], char *info);
+void test_dgemm_batched(param_value_t param[], char *info);
+void test_dgemm_vbatched(param_value_t param[], char *info);
+void test_dgemm_epilogue(param_value_t param[], char *info);
+void test_dgemmt(param_value_t param[], char *info);
+void test_dgepolar(param_value_t param[], char *info);
+void test_dgeexp(param_value_t param[], char *info);
+void test_dgehrd(param_value_t param[], char *info);
+void test_dgeqp3(param_value_t param[], char *info);
 void test_dgeqrf(param_value_t param[], char *info);
+void test_dgeqrf_batched(param_value_t param[], char *info);
+void test_dgeqrf_cholqr(param_value_t param[], char *info);
 void test_dgeqrs(param_value_t param[], char *info);
 void test_dgesv(param_value_t param[], char *info);
+void test_dgesv_rbt(param_value_t param[], char *info);
+void test_dgesvd(param_value_t param[], char *info);
+void test_dgesvd_randomized(param_value_t param[], char *info);
 void test_dgetrf(param_value_t param[], char *info);
+void test_dgetrf_batched(param_value_t param[], char *info);
+void test_dgetrf_vbatched(param_value_t param[], char *info);
+void test_dgetrf_partial(param_value_t param[], char *info);
 void test_dgetri(param_value_t param[], char *info);
 void test_dgetri_aux(param_value_t param[], char *info);
 void test_dgetrs(param_value_t param[], char *info);
+void test_dgetrs_handle(param_value_t param[], char *info);
+void test_dgetrs_incpiv(param_value_t param[], char *info);
+void test_dgtsv(param_value_t param[], char *info);
+void test_dgtsv_batched(param_value_t param[], char *info);
+void test_dsyev(param_value_t param[], char *info);
+void test_dsygst(param_value_t param[], char *info);
 void test_dsymm(param_value_t param[], char *info);
+void test_dsysv(param_value_t param[], char *info);
 void test_dsyr2k(param_value_t param[], char *info);
 void test_dsyrk(param_value_t param[], char *info);
 void test_dlacpy(param_value_t param[], char *info);
@@ -45,18 +70,34 @@ void test_dlascl(param_value_t param[], char *info);
 void test_dlaset(param_value_t param[], char *info);
 void test_dlaswp(param_value_t param[], char *info);
 void test_dlauum(param_value_t param[], char *info);
+void test_dlrpotrf(param_value_t param[], char *info);
 void test_dpbsv(param_value_t param[], char *info);
 void test_dpbtrf(param_value_t param[], char *info);
+void test_dplrnt(param_value_t param[], char *info);
+void test_dpocon(param_value_t param[], char *info);
 void test_dposv(param_value_t param[], char *info);
+void test_dpipeline(param_value_t param[], char *info);
 void test_dpotrf(param_value_t param[], char *info);
+void test_dpotrf_batched(param_value_t param[], char *info);
+void test_dpotrf_vbatched(param_value_t param[], char *info);
+void test_dpotrf_partial(param_value_t param[], char *info);
+void test_dpotrf_sparse(param_value_t param[], char *info);
+void test_dpotrf_update(param_value_t param[], char *info);
 void test_dpotri(param_value_t param[], char *info);
 void test_dpotrs(param_value_t param[], char *info);
+void test_dpstrf(param_value_t param[], char *info);
+void test_dptsv(param_value_t param[], char *info);
+void test_dptsv_batched(param_value_t param[], char *info);
 void test_dsymm(param_value_t param[], char *info);
 void test_dsyr2k(param_value_t param[], char *info);
 void test_dsyrk(param_value_t param[], char *info);
+void test_dtpqrt(param_value_t param[], char *info);
 void test_dtradd(param_value_t param[], char *info);
+void test_dtranspose(param_value_t param[], char *info);
 void test_dtrmm(param_value_t param[], char *info);
+void test_dtrmm3(param_value_t param[], char *info);
 void test_dtrsm(param_value_t param[], char *info);
+void test_dtrsyl(param_value_t param[], char *info);
 void test_dtrtri(param_value_t param[], char *info);
 void test_dormlq(param_value_t param[], char *info);
 void test_dormqr(param_value_t param[], char *info);
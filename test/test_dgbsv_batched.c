@@ -0,0 +1,193 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgbsv_batched.c, normal z -> d, Thu Oct 15 07:31:11 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+// the element i of the system l, and (i, j) of its right hand sides
+#define V(v_, i_, l_)     v_[(size_t)(i_)*batch + (l_)]
+#define M(m_, i_, j_, l_) m_[((size_t)(j_)*n + (i_))*batch + (l_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests DGBSV_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dgbsv_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_KL);
+            print_usage(PARAM_KU);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_BATCH);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "KL",
+                     InfoSpacing, "KU",
+                     InfoSpacing, "NRHS",
+                     InfoSpacing, "Batch");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_KL].i,
+             InfoSpacing, param[PARAM_KU].i,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_BATCH].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int kl = param[PARAM_KL].i;
+    int ku = param[PARAM_KU].i;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The systems are interleaved, and the bands of A are kept in ABref
+    // for the check. The diagonals are not dominant, so that the rows are
+    // interchanged.
+    //================================================================
+    int ldab = 2*kl+ku+1;
+    size_t sizeAB = (size_t)ldab*n*batch;
+    size_t sizeB = (size_t)n*nrhs*batch;
+
+    double *AB =
+        (double*)malloc(2*sizeAB*sizeof(double));
+    assert(AB != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, sizeAB, AB);
+    assert(retval == 0);
+    double *ABref = &AB[sizeAB];
+    memcpy(ABref, AB, sizeAB*sizeof(double));
+
+    int *ipiv = (int*)malloc((size_t)n*batch*sizeof(int));
+    assert(ipiv != NULL);
+
+    double *X =
+        (double*)malloc(sizeB*sizeof(double));
+    assert(X != NULL);
+
+    retval = LAPACKE_dlarnv(1, seed, sizeB, X);
+    assert(retval == 0);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    double *B = NULL;
+    if (test) {
+        B = (double*)malloc(sizeB*sizeof(double));
+        assert(B != NULL);
+        memcpy(B, X, sizeB*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dgbsv_batched(n, kl, ku, nrhs, AB, ldab, ipiv, X, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0 / time / 1e9;
+
+    //================================================================
+    // Test results by computing residual norms.
+    // The largest residual of the batch is reported.
+    //================================================================
+    if (test) {
+        double error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            if (plainfo[l] != 0) {
+                error = INFINITY;
+                continue;
+            }
+            double Anorm = 0.0;
+            double Xnorm = 0.0;
+            double Rnorm = 0.0;
+            for (int i = 0; i < n; i++) {
+                int k0 = imax(0, i-kl);
+                int k1 = imin(n-1, i+ku);
+                double asum = 0.0;
+                for (int k = k0; k <= k1; k++)
+                    asum += fabs(V(ABref, (size_t)k*ldab + kl+ku+i-k, l));
+                Anorm = fmax(Anorm, asum);
+
+                double xsum = 0.0;
+                double rsum = 0.0;
+                for (int j = 0; j < nrhs; j++) {
+                    double r = M(B, i, j, l);
+                    for (int k = k0; k <= k1; k++)
+                        r -= V(ABref, (size_t)k*ldab + kl+ku+i-k, l)
+                             *M(X, k, j, l);
+                    xsum += fabs(M(X, i, j, l));
+                    rsum += fabs(r);
+                }
+                Xnorm = fmax(Xnorm, xsum);
+                Rnorm = fmax(Rnorm, rsum);
+            }
+            if (Anorm*Xnorm != 0.0)
+                error = fmax(error, Rnorm/(n*Anorm*Xnorm));
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+        free(B);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(AB);
+    free(ipiv);
+    free(X);
+    free(plainfo);
+}
@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgehrd.c, normal z -> d, Thu Oct 15 08:59:52 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests DGEHRD.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dgehrd(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_JOBZ);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_NTPF);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "JobQ",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_JOBZ].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t jobq = param[PARAM_JOBZ].c == 'n' ? PlasmaNoVec : PlasmaVec;
+
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldq = lda;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    double *Q = NULL;
+    if (jobq == PlasmaVec) {
+        Q = (double*)malloc(
+            (size_t)ldq*n*sizeof(double));
+        assert(Q != NULL);
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dgehrd(jobq, n, A, lda, Q, ldq);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dgehrd(n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking that H is upper Hessenberg, and
+    // A Q = Q H and the orthogonality of Q, or that H keeps the
+    // Frobenius norm of A.
+    //================================================================
+    if (test) {
+        double *work = (double*)malloc((size_t)n*sizeof(double));
+        assert(work != NULL);
+
+        // entries of H below the first subdiagonal
+        int hess = 1;
+        for (int j = 0; j < n; j++)
+            for (int i = j+2; i < n; i++)
+                if (A[i + (size_t)lda*j] != 0.0)
+                    hess = 0;
+
+        double error;
+        if (jobq == PlasmaVec) {
+            // |A|_1
+            double normA = LAPACKE_dlange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                               Aref, lda, work);
+
+            // Build the identity matrix.
+            double *Id =
+                (double*)malloc((size_t)n*n*
+                                            sizeof(double));
+            assert(Id != NULL);
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'g', n, n,
+                                0.0, 1.0, Id, n);
+
+            // |Id - Q^T * Q|_oo / n
+            cblas_dsyrk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                        -1.0, Q, ldq, 1.0, Id, n);
+            param[PARAM_ORTHO].d =
+                LAPACKE_dlansy_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    n, Id, n, work) / n;
+
+            // R = A * Q - Q * H
+            double *R = Id;
+            double zone  =  1.0;
+            double zzero =  0.0;
+            double zmone = -1.0;
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        (zone),  Q, ldq,
+                                            A, lda,
+                        (zzero), R, n);
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        (zone),  Aref, lda,
+                                            Q,    ldq,
+                        (zmone), R,    n);
+
+            // |A * Q - Q * H|_1 / (|A|_1 * n)
+            error = LAPACKE_dlange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                        R, n, work);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            free(Id);
+        }
+        else {
+            // ||H|_F - |A|_F| / (|A|_F * n)
+            double normA = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               Aref, lda, work);
+            double normH = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               A, lda, work);
+            error = fabs(normH-normA);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            param[PARAM_ORTHO].d = 0.0;
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess && hess &&
+                                 error < tol && param[PARAM_ORTHO].d < tol;
+
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Q);
+    if (test)
+        free(Aref);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgemm.c, normal z -> d, Mon Feb  6 14:07:04 2017
+ * @generated from test/test_zgemm.c, normal z -> d, Thu Oct 15 09:23:21 2026
  *
  **/
 #include "test.h"
@@ -54,39 +54,64 @@ void test_dgemm(param_value_t param[], char *info)
             print_usage(PARAM_PADB);
             print_usage(PARAM_PADC);
             print_usage(PARAM_NB);
+            print_usage(PARAM_GVAR);
+            print_usage(PARAM_GHINT);
+            print_usage(PARAM_SLEVELS);
+            print_usage(PARAM_STHRESH);
+            print_usage(PARAM_SUBNB);
+            print_usage(PARAM_INPLACE);
+            print_usage(PARAM_TILE);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s",
-                     "TransA",
-                     "TransB",
-                     "M",
-                     "N",
-                     "K",
-                     "alpha",
-                     "beta",
-                     "PadA",
-                     "PadB",
-                     "PadC",
-                     "NB");
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s "
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "GVar",
+                     InfoSpacing, "GHint",
+                     InfoSpacing, "SLevels",
+                     InfoSpacing, "SThresh",
+                     InfoSpacing, "SubNB",
+                     InfoSpacing, "Inplace",
+                     InfoSpacing, "Tile",
+                     InfoSpacing, "Translate",
+                     InfoSpacing, "Compute");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%c,%c,%d,%d,%d,%.4f,%.4f,%d,%d,%d,%d",
-             param[PARAM_TRANSA].c,
-             param[PARAM_TRANSB].c,
-             param[PARAM_DIM].dim.m,
-             param[PARAM_DIM].dim.n,
-             param[PARAM_DIM].dim.k,
-             creal(param[PARAM_ALPHA].z),
-             creal(param[PARAM_BETA].z),
-             param[PARAM_PADA].i,
-             param[PARAM_PADB].i,
-             param[PARAM_PADC].i,
-             param[PARAM_NB].i);
+             "%*c %*c %*d %*d %*d %*.4f %*.4f %*d %*d %*d %*d %*c %*c %*d "
+             "%*d %*d %*c %*c",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_GVAR].c,
+             InfoSpacing, param[PARAM_GHINT].c,
+             InfoSpacing, param[PARAM_SLEVELS].i,
+             InfoSpacing, param[PARAM_STHRESH].i,
+             InfoSpacing, param[PARAM_SUBNB].i,
+             InfoSpacing, param[PARAM_INPLACE].c,
+             InfoSpacing, param[PARAM_TILE].c);
 
     //================================================================
     // Set parameters.
@@ -123,9 +148,16 @@ void test_dgemm(param_value_t param[], char *info)
 
     int lda = imax(1, Am + param[PARAM_PADA].i);
     int ldb = imax(1, Bm + param[PARAM_PADB].i);
+
+    // With --ghint=s or r, B is A itself, for op( A ) op( A )^T.
+    int self = (param[PARAM_GHINT].c == 's' || param[PARAM_GHINT].c == 'r') &&
+               Am == Bm && An == Bn;
+    if (self)
+        ldb = lda;
     int ldc = imax(1, Cm + param[PARAM_PADC].i);
 
     int test = param[PARAM_TEST].c == 'y';
+    int tile = param[PARAM_TILE].c == 'y';
     double eps = LAPACKE_dlamch('E');
 
 #ifdef COMPLEX
@@ -140,6 +172,29 @@ void test_dgemm(param_value_t param[], char *info)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_GVAR].c == 's')
+        plasma_set(PlasmaGemmVariant, PlasmaStrassenGemm);
+    else if (param[PARAM_GVAR].c == 'p')
+        plasma_set(PlasmaGemmVariant, PlasmaPackedGemm);
+    else if (param[PARAM_GVAR].c == 'm')
+        plasma_set(PlasmaGemmVariant, PlasmaGemm3m);
+    else if (param[PARAM_GVAR].c == 'o')
+        plasma_set(PlasmaGemmVariant, PlasmaOzakiGemm);
+    else
+        plasma_set(PlasmaGemmVariant, PlasmaClassicGemm);
+    if (param[PARAM_GHINT].c == 'n')
+        plasma_set(PlasmaGemmHint, PlasmaGemmHintNone);
+    else if (param[PARAM_GHINT].c == 'r' && self)
+        plasma_set(PlasmaGemmHint, PlasmaGemmHintRankK);
+    else
+        plasma_set(PlasmaGemmHint, PlasmaGemmHintAuto);
+    plasma_set(PlasmaStrassenLevels, param[PARAM_SLEVELS].i);
+    plasma_set(PlasmaStrassenThreshold, param[PARAM_STHRESH].i);
+    plasma_set(PlasmaSubNb, param[PARAM_SUBNB].i);
+    if (param[PARAM_INPLACE].c == 'v')
+        plasma_set(PlasmaInplaceOutplace, PlasmaNoTranslation);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -148,25 +203,42 @@ void test_dgemm(param_value_t param[], char *info)
         (double*)malloc((size_t)lda*An*sizeof(double));
     assert(A != NULL);
 
-    double *B =
-        (double*)malloc((size_t)ldb*Bn*sizeof(double));
-    assert(B != NULL);
+    double *B = A;
+    if (!self) {
+        B = (double*)malloc(
+            (size_t)ldb*Bn*sizeof(double));
+        assert(B != NULL);
+    }
 
     double *C =
         (double*)malloc((size_t)ldc*Cn*sizeof(double));
     assert(C != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*An, A);
+    int retval;
+    retval = plasma_dplrnt(Am, An, A, lda, 3172);
     assert(retval == 0);
 
-    retval = LAPACKE_dlarnv(1, seed, (size_t)ldb*Bn, B);
-    assert(retval == 0);
+    if (!self) {
+        retval = plasma_dplrnt(Bm, Bn, B, ldb, 2873);
+        assert(retval == 0);
+    }
 
-    retval = LAPACKE_dlarnv(1, seed, (size_t)ldc*Cn, C);
+    retval = plasma_dplrnt(Cm, Cn, C, ldc, 4613);
     assert(retval == 0);
 
+    // The rank-k hint asserts C symmetric (symmetric with PlasmaTrans).
+    if (self && param[PARAM_GHINT].c == 'r') {
+        int herm = transa == PlasmaConjTrans || transb == PlasmaConjTrans;
+        for (int j = 0; j < Cn; j++) {
+            for (int i = 0; i < j; i++) {
+                double cji = C[j + (size_t)i*ldc];
+                C[i + (size_t)j*ldc] = herm ? (cji) : cji;
+            }
+            if (herm)
+                C[j + (size_t)j*ldc] = creal(C[j + (size_t)j*ldc]);
+        }
+    }
+
     double *Cref = NULL;
     if (test) {
         Cref = (double*)malloc(
@@ -176,23 +248,100 @@ void test_dgemm(param_value_t param[], char *info)
         memcpy(Cref, C, (size_t)ldc*Cn*sizeof(double));
     }
 
+    //================================================================
+    // Time the vendor BLAS on the same input, with --compare=y.
+    //================================================================
+    if (param[PARAM_COMPARE].c == 'y') {
+        double *Cvend = (double*)malloc(
+            (size_t)ldc*Cn*sizeof(double));
+        assert(Cvend != NULL);
+
+        memcpy(Cvend, C, (size_t)ldc*Cn*sizeof(double));
+        plasma_time_t start = omp_get_wtime();
+        cblas_dgemm(
+            CblasColMajor,
+            (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+            m, n, k,
+            (alpha), A, lda,
+                                B, ldb,
+            (beta),  Cvend, ldc);
+        param[PARAM_VTIME].d = omp_get_wtime()-start;
+        free(Cvend);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    plasma_time_t compute = 0.0;
     plasma_time_t start = omp_get_wtime();
 
-    plasma_dgemm(
-        transa, transb,
-        m, n, k,
-        alpha, A, lda,
-               B, ldb,
-         beta, C, ldc);
+    if (tile) {
+        // Time the tile interface apart from the translations.
+        int nb = param[PARAM_NB].i;
+        plasma_desc_t descA, descB, descC;
+        int status;
+        status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            Am, An, 0, 0, Am, An, &descA);
+        assert(status == PlasmaSuccess);
+        status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            Bm, Bn, 0, 0, Bm, Bn, &descB);
+        assert(status == PlasmaSuccess);
+        status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                            Cm, Cn, 0, 0, Cm, Cn, &descC);
+        assert(status == PlasmaSuccess);
+
+        plasma_sequence_t *sequence = NULL;
+        status = plasma_sequence_create(&sequence);
+        assert(status == PlasmaSuccess);
+        plasma_request_t request = PlasmaRequestInitializer;
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_dge2desc(A, lda, descA, sequence, &request);
+            plasma_omp_dge2desc(B, ldb, descB, sequence, &request);
+            plasma_omp_dge2desc(C, ldc, descC, sequence, &request);
+        }
+        plasma_time_t start_compute = omp_get_wtime();
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_dgemm(transa, transb,
+                             alpha, descA,
+                                    descB,
+                             beta,  descC,
+                             sequence, &request);
+        }
+        compute = omp_get_wtime()-start_compute;
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_ddesc2ge(descC, C, ldc, sequence, &request);
+        }
+
+        plasma_desc_destroy(&descA);
+        plasma_desc_destroy(&descB);
+        plasma_desc_destroy(&descC);
+        plasma_sequence_destroy(sequence);
+    }
+    else {
+        plasma_dgemm(
+            transa, transb,
+            m, n, k,
+            alpha, A, lda,
+                   B, ldb,
+             beta, C, ldc);
+    }
 
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_dgemm(m, n, k) / time / 1e9;
+    param[PARAM_GBYTES].d = bytes_dgemm(m, n, k) / time / 1e9;
+    bench_tile_info(info, tile, time-compute, compute);
 
     //================================================================
     // Test results by comparing to a reference implementation.
@@ -239,7 +388,8 @@ void test_dgemm(param_value_t param[], char *info)
     // Free arrays.
     //================================================================
     free(A);
-    free(B);
+    if (!self)
+        free(B);
     free(C);
     if (test)
         free(Cref);
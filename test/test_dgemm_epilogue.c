@@ -0,0 +1,265 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgemm_epilogue.c, normal z -> d, Thu Oct 15 07:11:06 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <complex.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/******************************************************************************/
+// Adds one to the block, as the function of the epilogue.
+static void test_depilogue_func(int i, int j, int m, int n,
+                                double *C, int ldc, void *args)
+{
+    for (int jj = 0; jj < n; jj++)
+        for (int ii = 0; ii < m; ii++)
+            C[(size_t)ldc*jj+ii] += 1.0;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests DGEMM_EPILOGUE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dgemm_epilogue(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_TRANSA);
+            print_usage(PARAM_TRANSB);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_ALPHA);
+            print_usage(PARAM_BETA);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_PADC);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*.4f %*.4f %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+
+    int Am = transa == PlasmaNoTrans ? m : k;
+    int An = transa == PlasmaNoTrans ? k : m;
+    int Bm = transb == PlasmaNoTrans ? k : n;
+    int Bn = transb == PlasmaNoTrans ? n : k;
+
+    int lda = imax(1, Am + param[PARAM_PADA].i);
+    int ldb = imax(1, Bm + param[PARAM_PADB].i);
+    int ldc = imax(1, m + param[PARAM_PADC].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double eps = LAPACKE_dlamch('E');
+
+#ifdef COMPLEX
+    double alpha = param[PARAM_ALPHA].z;
+    double beta  = param[PARAM_BETA].z;
+#else
+    double alpha = creal(param[PARAM_ALPHA].z);
+    double beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*An*sizeof(double));
+    assert(A != NULL);
+
+    double *B =
+        (double*)malloc((size_t)ldb*Bn*sizeof(double));
+    assert(B != NULL);
+
+    double *C =
+        (double*)malloc((size_t)ldc*n*sizeof(double));
+    assert(C != NULL);
+
+    // row scale, column scale, row bias and column bias
+    double *V = (double*)malloc(
+        (size_t)2*(m+n)*sizeof(double));
+    assert(V != NULL);
+
+    int retval;
+    retval = plasma_dplrnt(Am, An, A, lda, 3172);
+    assert(retval == 0);
+
+    retval = plasma_dplrnt(Bm, Bn, B, ldb, 2873);
+    assert(retval == 0);
+
+    retval = plasma_dplrnt(m, n, C, ldc, 4613);
+    assert(retval == 0);
+
+    retval = plasma_dplrnt(2*(m+n), 1, V, imax(1, 2*(m+n)), 1371);
+    assert(retval == 0);
+
+    plasma_depilogue_t epilogue = {
+        .row_scale = &V[0],
+        .col_scale = &V[m],
+        .row_bias = &V[m+n],
+        .col_bias = &V[2*m+n],
+        .activation = PlasmaActivationTanh,
+        .func = test_depilogue_func,
+        .args = NULL};
+
+    double *Cref = NULL;
+    if (test) {
+        Cref = (double*)malloc(
+            (size_t)ldc*n*sizeof(double));
+        assert(Cref != NULL);
+
+        memcpy(Cref, C, (size_t)ldc*n*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    retval = plasma_dgemm_epilogue(
+        transa, transb,
+        m, n, k,
+        alpha, A, lda,
+               B, ldb,
+         beta, C, ldc,
+        &epilogue);
+
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dgemm(m, n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        // The epilogue scales by at most one in magnitude and tanh is a
+        // contraction, so that the error bound of the gemm holds.
+        double work[1];
+        double Anorm = LAPACKE_dlange_work(
+                           LAPACK_COL_MAJOR, 'F', Am, An, A,    lda, work);
+        double Bnorm = LAPACKE_dlange_work(
+                           LAPACK_COL_MAJOR, 'F', Bm, Bn, B,    ldb, work);
+        double Cnorm = LAPACKE_dlange_work(
+                           LAPACK_COL_MAJOR, 'F', m,  n,  Cref, ldc, work);
+
+        cblas_dgemm(
+            CblasColMajor,
+            (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+            m, n, k,
+            (alpha), A, lda,
+                                B, ldb,
+             (beta), Cref, ldc);
+
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                double z = Cref[(size_t)ldc*j+i];
+                z = z*epilogue.row_scale[i]*epilogue.col_scale[j]
+                  + epilogue.row_bias[i] + epilogue.col_bias[j];
+#ifdef COMPLEX
+                Cref[(size_t)ldc*j+i] = ctanh(z) + 1.0;
+#else
+                Cref[(size_t)ldc*j+i] = tanh(z) + 1.0;
+#endif
+            }
+        }
+
+        double zmone = -1.0;
+        cblas_daxpy((size_t)ldc*n, (zmone), Cref, 1, C, 1);
+
+        double error = LAPACKE_dlange_work(
+                           LAPACK_COL_MAJOR, 'F', m, n, C, ldc, work);
+        double normalize = sqrt((double)k+2) * fabs(alpha) * Anorm * Bnorm
+                         + 2 * fabs(beta) * Cnorm + sqrt((double)m*n);
+        if (normalize != 0)
+            error /= normalize;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = retval == PlasmaSuccess && error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(V);
+    if (test)
+        free(Cref);
+}
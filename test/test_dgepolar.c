@@ -0,0 +1,199 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgepolar.c, normal z -> d, Thu Oct 15 05:51:01 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DGEPOLAR.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dgepolar(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = imin(param[PARAM_DIM].dim.n, m);
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldh = imax(1, n);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    double *H =
+        (double*)malloc((size_t)ldh*n*sizeof(double));
+    assert(H != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dgepolar(m, n, A, lda, H, ldh);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    // The number of iterations depends on the conditioning of A.
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+
+    //================================================================
+    // Test results by checking A = U_p H and the orthogonality of U_p.
+    //================================================================
+    if (test) {
+        double zone  =  1.0;
+        double zmone = -1.0;
+
+        double *work = (double*)malloc((size_t)m*sizeof(double));
+        assert(work != NULL);
+
+        // |A|_1
+        double normA = LAPACKE_dlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                           Aref, lda, work);
+
+        // |Id - U_p^T * U_p|_oo / m
+        double *Id =
+            (double*)malloc((size_t)n*n*
+                                        sizeof(double));
+        assert(Id != NULL);
+
+        LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'g', n, n, 0.0, 1.0, Id, n);
+        cblas_dsyrk(CblasColMajor, CblasUpper, CblasConjTrans, n, m,
+                    -1.0, A, lda, 1.0, Id, n);
+        param[PARAM_ORTHO].d = LAPACKE_dlansy_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                                   n, Id, n, work) / m;
+
+        // |A - U_p * H|_1 / (|A|_1 * m)
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m, n, n,
+                    (zmone), A,    lda,
+                                        H,    ldh,
+                    (zone),  Aref, lda);
+
+        double error = LAPACKE_dlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                           Aref, lda, work);
+        if (normA != 0)
+            error /= normA;
+        error /= m;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess &&
+                                 error < tol && param[PARAM_ORTHO].d < tol;
+
+        free(Id);
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(H);
+    if (test)
+        free(Aref);
+}
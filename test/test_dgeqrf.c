@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgeqrf.c, normal z -> d, Mon Feb  6 14:07:05 2017
+ * @generated from test/test_zgeqrf.c, normal z -> d, Thu Oct 15 07:57:13 2026
  *
  **/
 #include "test.h"
@@ -24,7 +24,6 @@
 
 #define REAL
 
-extern double _dgeqrf_time;
 /***************************************************************************//**
  *
  * @brief Tests DGEQRF.
@@ -50,31 +49,43 @@ void test_dgeqrf(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_HMODE);
+            print_usage(PARAM_TREE);
+            print_usage(PARAM_TBS);
+            print_usage(PARAM_TSBLOCK);
+            print_usage(PARAM_NTPF);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%s,%s,%s,%s,%s,%s,%s",
-                     "M",
-                     "N",
-                     "PadA",
-                     "NB",
-                     "IB",
-                     "Hous. mode",
-                     "Ortho.");
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Hous. mode",
+                     InfoSpacing, "Tree",
+                     InfoSpacing, "TBS",
+                     InfoSpacing, "TS block",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "Ortho.");
         }
         return;
     }
     // Return column values.
     // ortho. column appended later.
     snprintf(info, InfoLen,
-             "%d,%d,%d,%d,%d,%c",
-             param[PARAM_DIM].dim.m,
-             param[PARAM_DIM].dim.n,
-             param[PARAM_PADA].i,
-             param[PARAM_NB].i,
-             param[PARAM_IB].i,
-             param[PARAM_HMODE].c);
+             "%*d %*d %*d %*d %*d %*c %*c %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_HMODE].c,
+             InfoSpacing, param[PARAM_TREE].c,
+             InfoSpacing, param[PARAM_TBS].i,
+             InfoSpacing, param[PARAM_TSBLOCK].i,
+             InfoSpacing, param[PARAM_NTPF].i);
 
     //================================================================
     // Set parameters.
@@ -95,9 +106,23 @@ void test_dgeqrf(param_value_t param[], char *info)
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
+    switch (param[PARAM_TREE].c) {
+    case 'a': plasma_set(PlasmaHouseholderTree, PlasmaAutoTree);       break;
+    case 's': plasma_set(PlasmaHouseholderTree, PlasmaFlatTsTree);     break;
+    case 't': plasma_set(PlasmaHouseholderTree, PlasmaFlatTtTree);     break;
+    case 'g': plasma_set(PlasmaHouseholderTree, PlasmaGreedyTree);     break;
+    case 'f': plasma_set(PlasmaHouseholderTree, PlasmaAutoForestTree); break;
+    default:  plasma_set(PlasmaHouseholderTree, PlasmaPlasmaTree);     break;
+    }
+    plasma_set(PlasmaTreeDomainSize, param[PARAM_TBS].i);
+    plasma_set(PlasmaTsBlock, param[PARAM_TSBLOCK].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -106,9 +131,8 @@ void test_dgeqrf(param_value_t param[], char *info)
         (double*)malloc((size_t)lda*n*sizeof(double));
     assert(A != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    int retval;
+    retval = plasma_dplrnt(m, n, A, lda, 3172);
     assert(retval == 0);
 
     double *Aref = NULL;
@@ -125,6 +149,25 @@ void test_dgeqrf(param_value_t param[], char *info)
     //================================================================
     plasma_desc_t T;
 
+    //================================================================
+    // Time the vendor LAPACK on the same input, with --compare=y.
+    //================================================================
+    if (param[PARAM_COMPARE].c == 'y') {
+        double *Avend = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Avend != NULL);
+        double *tau = (double*)malloc(
+            (size_t)imax(1, imin(m, n))*sizeof(double));
+        assert(tau != NULL);
+
+        memcpy(Avend, A, (size_t)lda*n*sizeof(double));
+        plasma_time_t start = omp_get_wtime();
+        LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, n, Avend, lda, tau);
+        param[PARAM_VTIME].d = omp_get_wtime()-start;
+        free(Avend);
+        free(tau);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
@@ -133,9 +176,7 @@ void test_dgeqrf(param_value_t param[], char *info)
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
-    //param[PARAM_TIME].d = time;
-    param[PARAM_TIME].d = (plasma_time_t)_dgeqrf_time;
-    time = (plasma_time_t)_dgeqrf_time;
+    param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_dgeqrf(m, n) / time / 1e9;
 
     //=================================================================
@@ -222,15 +263,15 @@ void test_dgeqrf(param_value_t param[], char *info)
         // Return ortho. column value.
         int len = strlen(info);
         snprintf(&info[len], imax(0, InfoLen - len),
-                 ",%.2e",
-                 param[PARAM_ORTHO].d);
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
     }
     else {
         // No ortho. test.
         int len = strlen(info);
         snprintf(&info[len], imax(0, InfoLen - len),
-                 ",%s",
-                  "---");
+                 " %*s",
+                 InfoSpacing, "---");
     }
 
     //================================================================
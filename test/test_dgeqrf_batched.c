@@ -0,0 +1,192 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgeqrf_batched.c, normal z -> d, Wed Oct 14 17:43:11 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DGEQRF_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dgeqrf_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "IB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+    int minmn = imax(1, imin(m, n));
+
+    double *A =
+        (double*)malloc(batch*sizeA*sizeof(double));
+    assert(A != NULL);
+
+    double *tau =
+        (double*)malloc(batch*minmn*sizeof(double));
+    assert(tau != NULL);
+
+    double **pA =
+        (double**)malloc(batch*sizeof(double*));
+    assert(pA != NULL);
+
+    double **ptau =
+        (double**)malloc(batch*sizeof(double*));
+    assert(ptau != NULL);
+
+    for (int l = 0; l < batch; l++) {
+        pA[l] = &A[l*sizeA];
+        ptau[l] = &tau[l*minmn];
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, batch*sizeA, A);
+    assert(retval == 0);
+
+    double *Aref = NULL;
+    double *tauref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            batch*sizeA*sizeof(double));
+        assert(Aref != NULL);
+
+        tauref = (double*)malloc(
+            minmn*sizeof(double));
+        assert(tauref != NULL);
+
+        memcpy(Aref, A, batch*sizeA*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dgeqrf_batched(m, n, pA, lda, ptau, batch);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = batch * flops_dgeqrf(m, n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing the factors and the scalar factors of
+    // the reflectors to LAPACK.
+    // The largest error of the batch is reported.
+    //================================================================
+    if (test) {
+        double error = 0.0;
+        for (int l = 0; l < batch; l++) {
+            double *Al = &Aref[l*sizeA];
+            double work[1];
+            double Anorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Al, lda, work);
+
+            LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, n, Al, lda, tauref);
+
+            double zmone = -1.0;
+            cblas_daxpy(sizeA, (zmone), Al, 1, pA[l], 1);
+            cblas_daxpy(imin(m, n), (zmone), tauref, 1, ptau[l], 1);
+
+            double err = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, pA[l], lda, work);
+            if (Anorm != 0)
+                err /= Anorm;
+            err += cblas_dnrm2(imin(m, n), ptau[l], 1);
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(tau);
+    free(pA);
+    free(ptau);
+    if (test) {
+        free(Aref);
+        free(tauref);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgetrf.c, normal z -> d, Mon Feb  6 14:07:06 2017
+ * @generated from test/test_zgetrf.c, normal z -> d, Thu Oct 15 07:57:13 2026
  *
  **/
 #include "test.h"
@@ -26,8 +26,6 @@
 
 #define REAL
 
-extern double _dgetrf_time;
-
 /***************************************************************************//**
  *
  * @brief Tests DPOTRF.
@@ -53,32 +51,47 @@ void test_dgetrf(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_NTPF);
+            print_usage(PARAM_PMODE);
+            print_usage(PARAM_UMODE);
+            print_usage(PARAM_WINDOW);
             print_usage(PARAM_ZEROCOL);
+            print_usage(PARAM_INPLACE);
+            print_usage(PARAM_LAYOUT);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%s,%s,%s,%s,%s,%s,%s",
-                     "M",
-                     "N",
-                     "PadA",
-                     "NB",
-                     "IB",
-                     "NTPF",
-                     "ZeroCol");
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "PMode",
+                     InfoSpacing, "UMode",
+                     InfoSpacing, "Window",
+                     InfoSpacing, "ZeroCol",
+                     InfoSpacing, "Inplace",
+                     InfoSpacing, "Layout");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%d,%d,%d,%d,%d,%d,%d",
-             param[PARAM_DIM].dim.m,
-             param[PARAM_DIM].dim.n,
-             param[PARAM_PADA].i,
-             param[PARAM_NB].i,
-             param[PARAM_IB].i,
-             param[PARAM_NTPF].i,
-             param[PARAM_ZEROCOL].i);
+             "%*d %*d %*d %*d %*d %*d %*c %*c %*d %*d %*c %*c",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_NTPF].i,
+             InfoSpacing, param[PARAM_PMODE].c,
+             InfoSpacing, param[PARAM_UMODE].c,
+             InfoSpacing, param[PARAM_WINDOW].i,
+             InfoSpacing, param[PARAM_ZEROCOL].i,
+             InfoSpacing, param[PARAM_INPLACE].c,
+             InfoSpacing, param[PARAM_LAYOUT].c);
 
     //================================================================
     // Set parameters.
@@ -88,6 +101,11 @@ void test_dgetrf(param_value_t param[], char *info)
 
     int lda = imax(1, m+param[PARAM_PADA].i);
 
+    // The row-major array of A, which is also the column-major array of
+    // its transpose.
+    int rowmajor = param[PARAM_LAYOUT].c == 'r';
+    int ldar = imax(1, imax(m, n)+param[PARAM_PADA].i);
+
     int test = param[PARAM_TEST].c == 'y';
     double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
 
@@ -97,6 +115,24 @@ void test_dgetrf(param_value_t param[], char *info)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+    if (param[PARAM_PMODE].c == 'r') {
+        plasma_set(PlasmaPanelMode, PlasmaRecursivePanel);
+    }
+    else if (param[PARAM_PMODE].c == 't') {
+        plasma_set(PlasmaPanelMode, PlasmaTournamentPanel);
+    }
+    else {
+        plasma_set(PlasmaPanelMode, PlasmaIterativePanel);
+    }
+    if (param[PARAM_UMODE].c == 't')
+        plasma_set(PlasmaUpdateMode, PlasmaTileUpdate);
+    else
+        plasma_set(PlasmaUpdateMode, PlasmaColumnUpdate);
+    plasma_set(PlasmaTaskWindow, param[PARAM_WINDOW].i);
+    if (param[PARAM_INPLACE].c == 'y')
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -108,9 +144,8 @@ void test_dgetrf(param_value_t param[], char *info)
     int *ipiv = (int*)malloc((size_t)m*sizeof(int));
     assert(ipiv != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    int retval;
+    retval = plasma_dplrnt(m, n, A, lda, 3172);
     assert(retval == 0);
 
     int zerocol = param[PARAM_ZEROCOL].i;
@@ -126,17 +161,47 @@ void test_dgetrf(param_value_t param[], char *info)
         memcpy(Aref, A, (size_t)lda*n*sizeof(double));
     }
 
+    //================================================================
+    // Time the vendor LAPACK on the same input, with --compare=y.
+    //================================================================
+    if (param[PARAM_COMPARE].c == 'y') {
+        double *Avend = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Avend != NULL);
+
+        memcpy(Avend, A, (size_t)lda*n*sizeof(double));
+        plasma_time_t start = omp_get_wtime();
+        LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n, Avend, lda, ipiv);
+        param[PARAM_VTIME].d = omp_get_wtime()-start;
+        free(Avend);
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    double *Ar = NULL;
+    if (rowmajor) {
+        Ar = (double*)malloc(
+            (size_t)ldar*m*sizeof(double));
+        assert(Ar != NULL);
+
+        plasma_dtranspose(PlasmaTrans, m, n, A, lda, Ar, ldar);
+        plasma_set(PlasmaArrayLayout, PlasmaRowMajor);
+    }
+
     plasma_time_t start = omp_get_wtime();
-    int plainfo = plasma_dgetrf(m, n, A, lda, ipiv);
+    int plainfo = rowmajor ? plasma_dgetrf(m, n, Ar, ldar, ipiv)
+                           : plasma_dgetrf(m, n, A, lda, ipiv);
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
-    //param[PARAM_TIME].d = time;
-    param[PARAM_TIME].d = (plasma_time_t)_dgetrf_time;
-    time = (plasma_time_t)_dgetrf_time;
+    if (rowmajor) {
+        plasma_set(PlasmaArrayLayout, PlasmaColMajor);
+        plasma_dtranspose(PlasmaTrans, n, m, Ar, ldar, A, lda);
+        free(Ar);
+    }
+
+    param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_dgetrf(m, n) / time / 1e9;
 
     //================================================================
@@ -144,7 +209,72 @@ void test_dgetrf(param_value_t param[], char *info)
     // This will give spurious failures if LAPACK picks different pivots
     // than PLASMA. Should test solve or ||PA - LU||.
     //================================================================
-    if (test) {
+    if (test && param[PARAM_PMODE].c == 't') {
+        // Tournament pivoting picks different pivots than LAPACK,
+        // so check the backward error ||PA - LU|| / ||A|| instead.
+        int lapinfo = 0;
+        if (plainfo != 0) {
+            lapinfo = LAPACKE_dgetrf(
+                LAPACK_COL_MAJOR,
+                m, n,
+                Aref, lda, ipiv);
+        }
+        if (plainfo == 0 && lapinfo == 0) {
+            int k = imin(m, n);
+            double *L = (double*)malloc(
+                (size_t)m*k*sizeof(double));
+            assert(L != NULL);
+            double *U = (double*)malloc(
+                (size_t)k*n*sizeof(double));
+            assert(U != NULL);
+
+            double zzero = 0.0;
+            double zone  = 1.0;
+            double zmone = -1.0;
+            LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'L', m, k, A, lda, L, m);
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'U', m, k, zzero, zone,
+                                L, m);
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', k, n, zzero, zzero,
+                                U, k);
+            LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'U', k, n, A, lda, U, k);
+
+            LAPACKE_dlaswp_work(LAPACK_COL_MAJOR, n, Aref, lda, 1, k, ipiv, 1);
+
+            double work[1];
+            double Anorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, n, k,
+                        (zmone), L, m,
+                                            U, k,
+                        (zone),  Aref, lda);
+
+            double error = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
+
+            if (Anorm != 0.0)
+                error /= Anorm;
+            error /= sqrt((double)m*n);
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+
+            free(L);
+            free(U);
+        }
+        else {
+            if (plainfo == lapinfo) {
+                param[PARAM_ERROR].d = 0.0;
+                param[PARAM_SUCCESS].i = 1;
+            }
+            else {
+                param[PARAM_ERROR].d = INFINITY;
+                param[PARAM_SUCCESS].i = 0;
+            }
+        }
+    }
+    else if (test) {
         int lapinfo = LAPACKE_dgetrf(
             LAPACK_COL_MAJOR,
             m, n,
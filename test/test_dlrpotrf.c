@@ -0,0 +1,165 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zlrpotrf.c, normal z -> d, Thu Oct 15 04:35:24 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests DLRPOTRF.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dlrpotrf(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_PTOL);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "PTol");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*.0e",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_PTOL].d);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double ptol = param[PARAM_PTOL].d;
+    double tol = param[PARAM_TOL].d * fmax(ptol, LAPACKE_dlamch('E'));
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    //================================================================
+    // Make A an exponential covariance matrix, whose entries decay
+    // away from the diagonal with a correlation length of n/16, and
+    // whose off-diagonal tiles are of rank one.
+    //================================================================
+    double length = imax(1, n/16);
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            A(i, j) = exp(-abs(i-j)/length);
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dlrpotrf(n, A, lda, ptol);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dpotrf(n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the backward error of the factor.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            double work[1];
+            double Anorm = LAPACKE_dlansy_work(
+                LAPACK_COL_MAJOR, 'F', 'L', n, Aref, lda, work);
+
+            // Zero the upper triangle and compute Aref - L*L^T,
+            // in the lower triangle of Aref.
+            double zzero = 0.0;
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'U', n-1, n-1,
+                                zzero, zzero, &A(0, 1), lda);
+            cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans,
+                        n, n,
+                        -1.0, A, lda,
+                         1.0, Aref, lda);
+
+            double error = LAPACKE_dlansy_work(
+                LAPACK_COL_MAJOR, 'F', 'L', n, Aref, lda, work);
+            if (Anorm != 0)
+                error /= Anorm;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    if (test)
+        free(Aref);
+}
@@ -0,0 +1,241 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpipeline.c, normal z -> d, Thu Oct 15 03:05:52 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZPIPELINE by the fused operations A = (cto/cfrom) A,
+ *        B = alpha A + beta B and C = B in the uplo part.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dpipeline(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_ALPHA);
+            print_usage(PARAM_BETA);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "UpLo",
+                     InfoSpacing, "m",
+                     InfoSpacing, "n",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "nb");
+        }
+        return;
+    }
+    // Return column values
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*.4f %*.4f %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int    test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    double cfrom = 1.234;
+    double cto = 5.678;
+
+#ifdef COMPLEX
+    double alpha = param[PARAM_ALPHA].z;
+    double beta  = param[PARAM_BETA].z;
+#else
+    double alpha = creal(param[PARAM_ALPHA].z);
+    double beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Set tuning parameters
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    int nb = param[PARAM_NB].i;
+
+    //================================================================
+    // Allocate and initialize arrays
+    //================================================================
+    size_t size = (size_t)lda*n;
+    double *A =
+        (double*)malloc(3*size*sizeof(double));
+    assert(A != NULL);
+    double *B = &A[size];
+    double *C = &A[2*size];
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, 3*size, A);
+    assert(retval == 0);
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            3*size*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, 3*size*sizeof(double));
+    }
+
+    plasma_desc_t descA, descB, descC;
+    int status;
+    status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &descA);
+    assert(status == PlasmaSuccess);
+    status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &descB);
+    assert(status == PlasmaSuccess);
+    status = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &descC);
+    assert(status == PlasmaSuccess);
+
+    plasma_dpipeline_t pipeline;
+    plasma_dpipeline_init(&pipeline);
+    status = plasma_dpipeline_lascl(&pipeline, uplo, cfrom, cto, descA);
+    assert(status == PlasmaSuccess);
+    status = plasma_dpipeline_geadd(&pipeline, PlasmaNoTrans,
+                                    alpha, descA, beta, descB);
+    assert(status == PlasmaSuccess);
+    status = plasma_dpipeline_lacpy(&pipeline, uplo, descB, descC);
+    assert(status == PlasmaSuccess);
+
+    plasma_sequence_t *sequence = NULL;
+    status = plasma_sequence_create(&sequence);
+    assert(status == PlasmaSuccess);
+    plasma_request_t request = PlasmaRequestInitializer;
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        plasma_omp_dge2desc(A, lda, descA, sequence, &request);
+        plasma_omp_dge2desc(B, lda, descB, sequence, &request);
+        plasma_omp_dge2desc(C, lda, descC, sequence, &request);
+    }
+
+    //================================================================
+    // Run and time PLASMA
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dpipeline_run(&pipeline);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0;
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        plasma_omp_ddesc2ge(descA, A, lda, sequence, &request);
+        plasma_omp_ddesc2ge(descB, B, lda, sequence, &request);
+        plasma_omp_ddesc2ge(descC, C, lda, sequence, &request);
+    }
+
+    plasma_desc_destroy(&descA);
+    plasma_desc_destroy(&descB);
+    plasma_desc_destroy(&descC);
+    plasma_sequence_destroy(sequence);
+
+    //================================================================
+    // Test results by comparing to the operations one by one
+    //================================================================
+    if (test) {
+        double *Bref = &Aref[size];
+        double *Cref = &Aref[2*size];
+
+        char type = lapack_const(uplo);
+        int iinfo;
+        int kl = 0;  // unused
+        int ku = 0;  // unused
+        LAPACK_dlascl(&type, &kl, &ku, &cfrom, &cto, &m, &n,
+                      Aref, &lda, &iinfo);
+
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                Bref[lda*j+i] = alpha*Aref[lda*j+i] + beta*Bref[lda*j+i];
+
+        LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, type, m, n,
+                            Bref, lda, Cref, lda);
+
+        double zmone = -1.0;
+        cblas_daxpy(3*size, (zmone), Aref, 1, A, 1);
+
+        double work[1];
+        double error = 0.0;
+        for (int k = 0; k < 3; k++) {
+            double norm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, &Aref[k*size], lda, work);
+            double diff = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, &A[k*size], lda, work);
+            if (norm != 0)
+                diff /= norm;
+            error = fmax(error, diff);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays
+    //================================================================
+    free(A);
+    if (test)
+        free(Aref);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zposv.c, normal z -> d, Mon Feb  6 14:07:13 2017
+ * @generated from test/test_zposv.c, normal z -> d, Thu Oct 15 05:12:54 2026
  *
  **/
 #include "test.h"
@@ -25,8 +25,6 @@
 
 #define REAL
 
-#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
-
 /***************************************************************************//**
  *
  * @brief Tests DPOSV.
@@ -109,27 +107,17 @@ void test_dposv(param_value_t param[], char *info)
                                     *sizeof(double));
     assert(B != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    //================================================================
+    // Generate a symmetric/symmetric positive definite A matrix,
+    // its diagonal increased by n.
+    //================================================================
+    int retval;
+    retval = plasma_dplgsy((double)n, n, A, lda, 3172);
     assert(retval == 0);
 
-    retval = LAPACKE_dlarnv(1, seed, (size_t)ldb*nrhs, B);
+    retval = plasma_dplrnt(n, nrhs, B, ldb, 2873);
     assert(retval == 0);
 
-    //================================================================
-    // Make the A matrix symmetric/symmetric positive definite.
-    // It increases diagonal by n, and makes it real.
-    // It sets Aji = ( Aij ) for j < i, that is, copy lower
-    // triangle to upper triangle.
-    //================================================================
-    for (int i = 0; i < n; ++i) {
-        A(i,i) = creal(A(i,i)) + n;
-        for (int j = 0; j < i; ++j) {
-            A(j,i) = (A(i,j));
-        }
-    }
-
     double *Aref = NULL;
     double *Bref = NULL;
     double *work = NULL;
@@ -0,0 +1,186 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_batched.c, normal z -> d, Wed Oct 14 17:43:11 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPOTRF_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dpotrf_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_PADA);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "PadA");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, param[PARAM_PADA].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+
+    double *A =
+        (double*)malloc(batch*sizeA*sizeof(double));
+    assert(A != NULL);
+
+    double **pA =
+        (double**)malloc(batch*sizeof(double*));
+    assert(pA != NULL);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, batch*sizeA, A);
+    assert(retval == 0);
+
+    //================================================================
+    // Make the A matrices symmetric/symmetric positive definite.
+    // It increases diagonal by n, and makes it real.
+    // It sets Aji = ( Aij ) for j < i, that is, copy lower
+    // triangle to upper triangle.
+    //================================================================
+    for (int l = 0; l < batch; l++) {
+        pA[l] = &A[l*sizeA];
+        for (int i = 0; i < n; i++) {
+            pA[l][i+i*lda] = creal(pA[l][i+i*lda]) + n;
+            for (int j = 0; j < i; j++) {
+                pA[l][j+i*lda] = (pA[l][i+j*lda]);
+            }
+        }
+    }
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            batch*sizeA*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, batch*sizeA*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dpotrf_batched(uplo, n, pA, lda, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = batch * flops_dpotrf(n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    // The largest error of the batch is reported.
+    //================================================================
+    if (test) {
+        double error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            double *Al = &Aref[l*sizeA];
+            int lapinfo = LAPACKE_dpotrf(LAPACK_COL_MAJOR,
+                                         lapack_const(uplo), n,
+                                         Al, lda);
+            if (lapinfo == 0) {
+                double zmone = -1.0;
+                cblas_daxpy(sizeA, (zmone), Al, 1, pA[l], 1);
+
+                double work[1];
+                double Anorm = LAPACKE_dlansy_work(
+                    LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, Al, lda,
+                    work);
+                double err = LAPACKE_dlange_work(
+                    LAPACK_COL_MAJOR, 'F', n, n, pA[l], lda, work);
+                if (Anorm != 0)
+                    err /= Anorm;
+                error = fmax(error, err);
+            }
+            else if (plainfo[l] != lapinfo) {
+                error = INFINITY;
+            }
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(pA);
+    free(plainfo);
+    if (test)
+        free(Aref);
+}
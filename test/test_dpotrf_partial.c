@@ -0,0 +1,204 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_partial.c, normal z -> d, Thu Oct 15 06:56:37 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPOTRF_PARTIAL.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dpotrf_partial(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int nb = param[PARAM_NB].i;
+
+    // The order of the block factored, a multiple of the tile size,
+    // unless it is the whole matrix.
+    int k = imin(param[PARAM_DIM].dim.k, n);
+    if (k < n)
+        k -= k%nb;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, n,
+             InfoSpacing, k,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, nb);
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, nb);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    //================================================================
+    // Generate a symmetric/symmetric positive definite A matrix,
+    // its diagonal increased by n.
+    //================================================================
+    int retval;
+    retval = plasma_dplgsy((double)n, n, A, lda, 3172);
+    assert(retval == 0);
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dpotrf_partial(uplo, n, k, A, lda);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = (flops_dpotrf(k) +
+                             flops_dtrsm(PlasmaRight, n-k, k) +
+                             flops_dsyrk(n-k, k)) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation,
+    // the factorization of A_11, the solve and the update of A_22.
+    //================================================================
+    if (test) {
+        int lapinfo = LAPACKE_dpotrf(LAPACK_COL_MAJOR,
+                                     lapack_const(uplo), k,
+                                     Aref, lda);
+        if (lapinfo == 0 && k < n) {
+            double zone = 1.0;
+            double *A11 = Aref;
+            double *A22 = &Aref[k + (size_t)lda*k];
+            if (uplo == PlasmaLower) {
+                double *A21 = &Aref[k];
+                cblas_dtrsm(CblasColMajor, CblasRight, CblasLower,
+                            CblasConjTrans, CblasNonUnit,
+                            n-k, k,
+                            (zone), A11, lda,
+                                               A21, lda);
+                cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans,
+                            n-k, k,
+                            -1.0, A21, lda,
+                             1.0, A22, lda);
+            }
+            else {
+                double *A12 = &Aref[(size_t)lda*k];
+                cblas_dtrsm(CblasColMajor, CblasLeft, CblasUpper,
+                            CblasConjTrans, CblasNonUnit,
+                            k, n-k,
+                            (zone), A11, lda,
+                                               A12, lda);
+                cblas_dsyrk(CblasColMajor, CblasUpper, CblasConjTrans,
+                            n-k, k,
+                            -1.0, A12, lda,
+                             1.0, A22, lda);
+            }
+        }
+        if (lapinfo == 0) {
+            double zmone = -1.0;
+            cblas_daxpy((size_t)lda*n, (zmone), Aref, 1, A, 1);
+
+            double work[1];
+            double Anorm = LAPACKE_dlansy_work(
+                LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, Aref, lda, work);
+            double error = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', n, n, A, lda, work);
+            if (Anorm != 0)
+                error /= Anorm;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            if (plainfo == lapinfo) {
+                param[PARAM_ERROR].d = 0.0;
+                param[PARAM_SUCCESS].i = 1;
+            }
+            else {
+                param[PARAM_ERROR].d = INFINITY;
+                param[PARAM_SUCCESS].i = 0;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    if (test)
+        free(Aref);
+}
@@ -0,0 +1,236 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_update.c, normal z -> d, Thu Oct 15 04:54:14 2026
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPOTRF_UPDATE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dpotrf_update(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+    char lapack_uplo = param[PARAM_UPLO].c == 'u' ? 'U' : 'L';
+
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldv = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    double *V =
+        (double*)malloc((size_t)ldv*k*sizeof(double));
+    assert(V != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldv*k, V);
+    assert(retval == 0);
+
+    // Make A symmetric positive definite, as in test_dpotrf.
+    for (int i = 0; i < n; i++) {
+        A(i, i) = creal(A(i, i)) + n;
+        for (int j = 0; j < i; j++) {
+            A(j, i) = (A(i, j));
+        }
+    }
+
+    double *Aref = NULL;
+    double *Vref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            (size_t)lda*n*sizeof(double));
+        assert(Aref != NULL);
+        memcpy(Aref, A, (size_t)lda*n*sizeof(double));
+
+        Vref = (double*)malloc(
+            (size_t)ldv*k*sizeof(double));
+        assert(Vref != NULL);
+        memcpy(Vref, V, (size_t)ldv*k*sizeof(double));
+    }
+
+    // Factor A by LAPACK, to be updated by PLASMA.
+    retval = LAPACKE_dpotrf(LAPACK_COL_MAJOR, lapack_uplo, n, A, lda);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dpotrf_update(uplo, 1, n, k, A, lda, V, ldv);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dpotrf_update(n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual of the updated factor
+    //
+    // || A + V*V^T - L*L^T || / ( ||A + V*V^T|| ),
+    //
+    // and, after the downdate by the same V, of the factor of A again.
+    //================================================================
+    if (test) {
+        double work[1];
+        double error = 0.0;
+
+        // A + V*V^T in the uplo triangle
+        double *Aupd =
+            (double*)malloc(
+                (size_t)lda*n*sizeof(double));
+        assert(Aupd != NULL);
+        memcpy(Aupd, Aref, (size_t)lda*n*sizeof(double));
+        cblas_dsyrk(CblasColMajor, (CBLAS_UPLO)uplo, CblasNoTrans, n, k,
+                    1.0, Vref, ldv, 1.0, Aupd, lda);
+
+        for (int pass = 0; pass < 2 && plainfo == 0; pass++) {
+            double *B = pass == 0 ? Aupd : Aref;
+
+            // L*L^T or U^T*U, with the other triangle of the factor zeroed
+            double *L =
+                (double*)malloc(
+                    (size_t)lda*n*sizeof(double));
+            assert(L != NULL);
+            memcpy(L, A, (size_t)lda*n*sizeof(double));
+            double zzero = 0.0;
+            if (n > 1) {
+                if (uplo == PlasmaLower)
+                    LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'U', n-1, n-1,
+                                        zzero, zzero, &L[lda], lda);
+                else
+                    LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                                        zzero, zzero, &L[1], lda);
+            }
+
+            double *R =
+                (double*)malloc(
+                    (size_t)lda*n*sizeof(double));
+            assert(R != NULL);
+            memcpy(R, B, (size_t)lda*n*sizeof(double));
+            if (uplo == PlasmaLower)
+                cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans, n, n,
+                            -1.0, L, lda, 1.0, R, lda);
+            else
+                cblas_dsyrk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                            -1.0, L, lda, 1.0, R, lda);
+
+            double Bnorm = LAPACKE_dlansy_work(
+                LAPACK_COL_MAJOR, 'F', lapack_uplo, n, B, lda, work);
+            double pass_error = LAPACKE_dlansy_work(
+                LAPACK_COL_MAJOR, 'F', lapack_uplo, n, R, lda, work);
+            if (Bnorm != 0.0)
+                pass_error /= Bnorm;
+            error = fmax(error, pass_error);
+
+            free(L);
+            free(R);
+
+            // Downdate back to the factor of A.
+            if (pass == 0) {
+                memcpy(V, Vref, (size_t)ldv*k*sizeof(double));
+                plainfo = plasma_dpotrf_update(uplo, -1, n, k,
+                                               A, lda, V, ldv);
+            }
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == 0 && error < tol;
+
+        free(Aupd);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(V);
+    if (test) {
+        free(Aref);
+        free(Vref);
+    }
+}
@@ -0,0 +1,212 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_vbatched.c, normal z -> d, Thu Oct 15 07:26:02 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPOTRF_VBATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ *
+ * Matrix l of the batch is of order n/2^(l%8), from n down to n/128.
+ ******************************************************************************/
+void test_dpotrf_vbatched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int batch = param[PARAM_BATCH].i;
+
+    int *n = (int*)malloc(batch*sizeof(int));
+    assert(n != NULL);
+
+    int *lda = (int*)malloc(batch*sizeof(int));
+    assert(lda != NULL);
+
+    size_t sizeA = 0;
+    double flops = 0.0;
+    for (int l = 0; l < batch; l++) {
+        n[l] = param[PARAM_DIM].dim.n >> (l%8);
+        lda[l] = imax(1, n[l] + param[PARAM_PADA].i);
+        sizeA += (size_t)lda[l]*n[l];
+        flops += flops_dpotrf(n[l]);
+    }
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    double *A =
+        (double*)malloc(
+            imax(1, sizeA)*sizeof(double));
+    assert(A != NULL);
+
+    double **pA =
+        (double**)malloc(batch*sizeof(double*));
+    assert(pA != NULL);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, sizeA, A);
+    assert(retval == 0);
+
+    //================================================================
+    // Make the A matrices symmetric/symmetric positive definite.
+    // It increases diagonal by n, and makes it real.
+    // It sets Aji = ( Aij ) for j < i, that is, copy lower
+    // triangle to upper triangle.
+    //================================================================
+    size_t offset = 0;
+    for (int l = 0; l < batch; l++) {
+        pA[l] = &A[offset];
+        offset += (size_t)lda[l]*n[l];
+        for (int i = 0; i < n[l]; i++) {
+            pA[l][i+i*lda[l]] = creal(pA[l][i+i*lda[l]]) + n[l];
+            for (int j = 0; j < i; j++) {
+                pA[l][j+i*lda[l]] = (pA[l][i+j*lda[l]]);
+            }
+        }
+    }
+
+    double *Aref = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            imax(1, sizeA)*sizeof(double));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, sizeA*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dpotrf_vbatched(uplo, n, pA, lda, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    // The largest error of the batch is reported.
+    //================================================================
+    if (test) {
+        double error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            double *Al = &Aref[pA[l]-A];
+            size_t sizeAl = (size_t)lda[l]*n[l];
+            int lapinfo = LAPACKE_dpotrf(LAPACK_COL_MAJOR,
+                                         lapack_const(uplo), n[l],
+                                         Al, lda[l]);
+            if (lapinfo == 0) {
+                double zmone = -1.0;
+                cblas_daxpy(sizeAl, (zmone), Al, 1, pA[l], 1);
+
+                double work[1];
+                double Anorm = LAPACKE_dlansy_work(
+                    LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n[l],
+                    Al, lda[l], work);
+                double err = LAPACKE_dlange_work(
+                    LAPACK_COL_MAJOR, 'F', n[l], n[l], pA[l], lda[l], work);
+                if (Anorm != 0)
+                    err /= Anorm;
+                error = fmax(error, err);
+            }
+            else if (plainfo[l] != lapinfo) {
+                error = INFINITY;
+            }
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(pA);
+    free(n);
+    free(lda);
+    free(plainfo);
+    if (test)
+        free(Aref);
+}
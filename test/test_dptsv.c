@@ -0,0 +1,195 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zptsv.c, normal z -> d, Wed Oct 14 19:29:19 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define B(i_, j_) B[(i_) + (size_t)ldb*(j_)]
+#define X(i_, j_) X[(i_) + (size_t)ldx*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPTSV.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dptsv(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                "%*s %*s %*s %*s ",
+                InfoSpacing, "N",
+                InfoSpacing, "NRHS",
+                InfoSpacing, "PadB",
+                InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+        "%*d %*d %*d %*d ",
+        InfoSpacing, param[PARAM_DIM].dim.n,
+        InfoSpacing, param[PARAM_NRHS].i,
+        InfoSpacing, param[PARAM_PADB].i,
+        InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n    = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int ldx  = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    // diagonals of A, kept in Aref for the check
+    double *d = (double*)malloc(2*(size_t)n*sizeof(double));
+    assert(d != NULL);
+    double *e =
+        (double*)malloc(2*(size_t)n*sizeof(double));
+    assert(e != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, n, d);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, n, e);
+    assert(retval == 0);
+    // make it diagonally dominant, hence positive definite
+    for (int i = 0; i < n; i++)
+        d[i] += 3.0;
+    double *dref = &d[n];
+    double *eref = &e[n];
+    memcpy(dref, d, (size_t)n*sizeof(double));
+    memcpy(eref, e, (size_t)n*sizeof(double));
+
+    double *X = (double*)malloc(
+        (size_t)ldx*nrhs*sizeof(double));
+    assert(X != NULL);
+
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldx*nrhs, X);
+    assert(retval == 0);
+
+    // copy B to X
+    int ldb = ldx;
+    double *B = NULL;
+    if (test) {
+        B = (double*)malloc(
+            (size_t)ldb*nrhs*sizeof(double));
+        assert(B != NULL);
+        LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'F', n, nrhs, X, ldx, B, ldb);
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dptsv(n, nrhs, d, e, X, ldx);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0 / time / 1e9;
+
+    //================================================================
+    // Test results by computing residual norm.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            // compute residual vector B - A*X
+            for (int j = 0; j < nrhs; j++) {
+                for (int i = 0; i < n; i++) {
+                    B(i, j) -= dref[i]*X(i, j);
+                    if (i > 0)
+                        B(i, j) -= eref[i-1]*X(i-1, j);
+                    if (i < n-1)
+                        B(i, j) -= (eref[i])*X(i+1, j);
+                }
+            }
+
+            // compute various norms
+            double Anorm = 0.0;
+            for (int i = 0; i < n; i++) {
+                double sum = fabs(dref[i]);
+                if (i > 0)
+                    sum += fabs(eref[i-1]);
+                if (i < n-1)
+                    sum += fabs(eref[i]);
+                Anorm = fmax(Anorm, sum);
+            }
+            double *work = NULL;
+            work = (double*)malloc((size_t)n*sizeof(double));
+            assert(work != NULL);
+
+            double Xnorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, X, ldx, work);
+            double Rnorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, B, ldb, work);
+            double residual = Rnorm/(n*Anorm*Xnorm);
+
+            param[PARAM_ERROR].d = residual;
+            param[PARAM_SUCCESS].i = residual < tol;
+
+            free(work);
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+        free(B);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(X);
+    free(d);
+    free(e);
+}
@@ -0,0 +1,191 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zptsv_batched.c, normal z -> d, Thu Oct 15 07:31:11 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+// the element i of the system l, and (i, j) of its right hand sides
+#define V(v_, i_, l_)     v_[(size_t)(i_)*batch + (l_)]
+#define M(m_, i_, j_, l_) m_[((size_t)(j_)*n + (i_))*batch + (l_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPTSV_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dptsv_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_BATCH);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "NRHS",
+                     InfoSpacing, "Batch");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_BATCH].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The systems are interleaved, and the diagonals of A are kept in
+    // dref and eref for the check.
+    //================================================================
+    size_t sizeD = (size_t)n*batch;
+    size_t sizeB = (size_t)n*nrhs*batch;
+
+    double *d = (double*)malloc(2*sizeD*sizeof(double));
+    assert(d != NULL);
+    double *e =
+        (double*)malloc(2*sizeD*sizeof(double));
+    assert(e != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, sizeD, d);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, sizeD, e);
+    assert(retval == 0);
+    // make it diagonally dominant, hence positive definite
+    for (size_t i = 0; i < sizeD; i++)
+        d[i] += 3.0;
+    double *dref = &d[sizeD];
+    double *eref = &e[sizeD];
+    memcpy(dref, d, sizeD*sizeof(double));
+    memcpy(eref, e, sizeD*sizeof(double));
+
+    double *X =
+        (double*)malloc(sizeB*sizeof(double));
+    assert(X != NULL);
+
+    retval = LAPACKE_dlarnv(1, seed, sizeB, X);
+    assert(retval == 0);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    double *B = NULL;
+    if (test) {
+        B = (double*)malloc(sizeB*sizeof(double));
+        assert(B != NULL);
+        memcpy(B, X, sizeB*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_dptsv_batched(n, nrhs, d, e, X, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0 / time / 1e9;
+
+    //================================================================
+    // Test results by computing residual norms.
+    // The largest residual of the batch is reported.
+    //================================================================
+    if (test) {
+        double error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            if (plainfo[l] != 0) {
+                error = INFINITY;
+                continue;
+            }
+            double Anorm = 0.0;
+            double Xnorm = 0.0;
+            double Rnorm = 0.0;
+            for (int i = 0; i < n; i++) {
+                double asum = fabs(V(dref, i, l));
+                if (i > 0)
+                    asum += fabs(V(eref, i-1, l));
+                if (i < n-1)
+                    asum += fabs(V(eref, i, l));
+                Anorm = fmax(Anorm, asum);
+
+                double xsum = 0.0;
+                double rsum = 0.0;
+                for (int j = 0; j < nrhs; j++) {
+                    double r =
+                        M(B, i, j, l) - V(dref, i, l)*M(X, i, j, l);
+                    if (i > 0)
+                        r -= V(eref, i-1, l)*M(X, i-1, j, l);
+                    if (i < n-1)
+                        r -= (V(eref, i, l))*M(X, i+1, j, l);
+                    xsum += fabs(M(X, i, j, l));
+                    rsum += fabs(r);
+                }
+                Xnorm = fmax(Xnorm, xsum);
+                Rnorm = fmax(Rnorm, rsum);
+            }
+            if (Anorm*Xnorm != 0.0)
+                error = fmax(error, Rnorm/(n*Anorm*Xnorm));
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+        free(B);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(d);
+    free(e);
+    free(X);
+    free(plainfo);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zc.h, mixed zc -> ds, Mon Feb  6 14:07:18 2017
+ * @generated from test/test_zc.h, mixed zc -> ds, Thu Oct 15 09:16:24 2026
  *
  **/
 #ifndef TEST_DS_H
@@ -18,7 +18,10 @@
 // test routines
 //==============================================================================
 void test_dsgesv(param_value_t param[], char *info);
+void test_dsgels(param_value_t param[], char *info);
+void test_dsgetrs_handle(param_value_t param[], char *info);
 void test_dsposv(param_value_t param[], char *info);
+void test_dspotrf(param_value_t param[], char *info);
 void test_dlag2s(param_value_t param[], char *info);
 void test_slag2d(param_value_t param[], char *info);
 
@@ -0,0 +1,204 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zcgels.c, mixed zc -> ds, Thu Oct 15 09:16:24 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "flops.h"
+#include "plasma.h"
+#include "test.h"
+
+#include <assert.h>
+#include <math.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DSGELS
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL, print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dsgels(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_HMODE);
+        }
+        else {
+            // Return column labels
+            snprintf(info, InfoLen,
+                "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                InfoSpacing, "m",
+                InfoSpacing, "n",
+                InfoSpacing, "nrhs",
+                InfoSpacing, "PadA",
+                InfoSpacing, "PadB",
+                InfoSpacing, "nb",
+                InfoSpacing, "ib",
+                InfoSpacing, "Hous. mode",
+                InfoSpacing, "iter");
+        }
+        return;
+    }
+
+    //================================================================
+    // Set parameters
+    //================================================================
+    int m    = param[PARAM_DIM].dim.m;
+    int n    = imin(param[PARAM_DIM].dim.n, m);
+    int nrhs = param[PARAM_NRHS].i;
+    int lda  = imax(1, m + param[PARAM_PADA].i);
+    int ldb  = imax(1, m + param[PARAM_PADB].i);
+    int ldx  = imax(1, n + param[PARAM_PADB].i);
+    int ITER = 0;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    if (param[PARAM_HMODE].c == 't') {
+        plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
+    }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
+    else {
+        plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
+    }
+
+    //================================================================
+    // Allocate and initialize arrays
+    //================================================================
+    double *A = (double *)malloc(
+        (size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    double *B = (double *)malloc(
+        (size_t)ldb*nrhs*sizeof(double));
+    assert(B != NULL);
+
+    double *X = (double *)malloc(
+        (size_t)ldx*nrhs*sizeof(double));
+    assert(X != NULL);
+
+    // Initialize random A and B
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldb*nrhs, B);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dsgels(m, n, nrhs, A, lda, B, ldb, X, ldx, &ITER);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+    double flops = flops_dgeqrf(m, n) + flops_dgeqrs(m, n, nrhs);
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    // Return column values
+    snprintf(info, InfoLen,
+        "%*d %*d %*d %*d %*d %*d %*d %*c %*d",
+        InfoSpacing, m,
+        InfoSpacing, n,
+        InfoSpacing, nrhs,
+        InfoSpacing, param[PARAM_PADA].i,
+        InfoSpacing, param[PARAM_PADB].i,
+        InfoSpacing, param[PARAM_NB].i,
+        InfoSpacing, param[PARAM_IB].i,
+        InfoSpacing, param[PARAM_HMODE].c,
+        InfoSpacing, ITER);
+
+    //================================================================
+    // Test results by checking the normal equations
+    //
+    //              || A^H (B - AX) ||_F
+    //     ------------------------------------- < epsilon
+    //      || A ||_F (|| A ||_F || X ||_F + || B ||_F) N
+    //
+    // which the solution in single precision does not satisfy.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            double zone  =  1.0;
+            double zmone = -1.0;
+            double zzero =  0.0;
+
+            double work[1];
+            double Anorm = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F', m, n,
+                                               A, lda, work);
+            double Bnorm = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F',
+                                               m, nrhs, B, ldb, work);
+            double Xnorm = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F',
+                                               n, nrhs, X, ldx, work);
+
+            // B = B - A*X, then X = A^H*B
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, nrhs, n,
+                        (zmone), A, lda,
+                                            X, ldx,
+                        (zone),  B, ldb);
+            cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, m,
+                        (zone),  A, lda,
+                                            B, ldb,
+                        (zzero), X, ldx);
+
+            double Rnorm = LAPACKE_dlange_work(LAPACK_COL_MAJOR, 'F',
+                                               n, nrhs, X, ldx, work);
+            double residual = Rnorm / (Anorm*(Anorm*Xnorm+Bnorm)*n);
+
+            param[PARAM_ERROR].d   = residual;
+            param[PARAM_SUCCESS].i = residual < tol;
+        }
+        else {
+            param[PARAM_ERROR].d   = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays
+    //================================================================
+    free(A); free(B); free(X);
+}
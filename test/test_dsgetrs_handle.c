@@ -0,0 +1,186 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zcgetrs_handle.c, mixed zc -> ds, Thu Oct 15 05:47:14 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DSGETRS_HANDLE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dsgetrs_handle(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_RMODE);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Nrhs",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "RMode");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*c",
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_RMODE].c);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+
+    int lda = imax(1, n+param[PARAM_PADA].i);
+    int ldb = imax(1, n+param[PARAM_PADB].i);
+    int ldx = ldb;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_RMODE].c == 'g')
+        plasma_set(PlasmaRefinementMode, PlasmaGmresRefinement);
+    else
+        plasma_set(PlasmaRefinementMode, PlasmaClassicRefinement);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A =
+        (double*)malloc((size_t)lda*n*sizeof(double));
+    assert(A != NULL);
+
+    double *B =
+        (double*)malloc(
+            (size_t)ldb*nrhs*sizeof(double));
+    assert(B != NULL);
+
+    double *X =
+        (double*)malloc(
+            (size_t)ldx*nrhs*sizeof(double));
+    assert(X != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldb*nrhs, B);
+    assert(retval == 0);
+
+    //================================================================
+    // Run GETRF
+    //================================================================
+    plasma_getrf_mixed_handle_t handle;
+    plasma_dsgetrf_handle_create(n, A, lda, &handle);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    int iter;
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_dsgetrs_handle(handle, nrhs, B, ldb, X, ldx, &iter);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dgetrs(n, nrhs) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual
+    //
+    //                      || B - AX ||_I
+    //                --------------------------- < epsilon
+    //                 || A ||_I * || X ||_I * N
+    //
+    //================================================================
+    if (test) {
+        double zone  =  1.0;
+        double zmone = -1.0;
+
+        double *work = (double*)malloc((size_t)n*sizeof(double));
+        assert(work != NULL);
+
+        double Anorm = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'I', n, n, A, lda, work);
+        double Xnorm = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'I', n, nrhs, X, ldx, work);
+
+        // B -= A*X
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, nrhs, n,
+                    (zmone), A, lda,
+                                        X, ldx,
+                    (zone),  B, ldb);
+
+        double Rnorm = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'I', n, nrhs, B, ldb, work);
+        double residual = Rnorm/(n*Anorm*Xnorm);
+
+        param[PARAM_ERROR].d = residual;
+        param[PARAM_SUCCESS].i = plainfo == 0 && residual < tol;
+
+        free(work);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_getrf_mixed_handle_destroy(&handle);
+    free(A);
+    free(B);
+    free(X);
+}
@@ -0,0 +1,275 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_ztpqrt.c, normal z -> d, Thu Oct 15 04:47:19 2026
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DTPQRT.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_dtpqrt(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "NRHS",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    // m new rows B and D below the n-by-n R and the n-by-nrhs C
+    int m    = param[PARAM_DIM].dim.m;
+    int n    = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+
+    int ldr = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, m + param[PARAM_PADA].i);
+    int ldc = imax(1, n + param[PARAM_PADB].i);
+    int ldd = imax(1, m + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *R =
+        (double*)malloc((size_t)ldr*n*sizeof(double));
+    assert(R != NULL);
+
+    double *B =
+        (double*)malloc((size_t)ldb*n*sizeof(double));
+    assert(B != NULL);
+
+    double *C =
+        (double*)malloc(
+            (size_t)ldc*nrhs*sizeof(double));
+    assert(C != NULL);
+
+    double *D =
+        (double*)malloc(
+            (size_t)ldd*nrhs*sizeof(double));
+    assert(D != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldr*n, R);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldb*n, B);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldc*nrhs, C);
+    assert(retval == 0);
+    retval = LAPACKE_dlarnv(1, seed, (size_t)ldd*nrhs, D);
+    assert(retval == 0);
+
+    // R is upper triangular.
+    double zzero = 0.0;
+    if (n > 1) {
+        LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                            zzero, zzero, &R[1], ldr);
+    }
+
+    double *Rref = NULL;
+    double *Bref = NULL;
+    double *Cref = NULL;
+    double *Dref = NULL;
+    if (test) {
+        Rref = (double*)malloc(
+            (size_t)ldr*n*sizeof(double));
+        assert(Rref != NULL);
+        memcpy(Rref, R, (size_t)ldr*n*sizeof(double));
+
+        Bref = (double*)malloc(
+            (size_t)ldb*n*sizeof(double));
+        assert(Bref != NULL);
+        memcpy(Bref, B, (size_t)ldb*n*sizeof(double));
+
+        Cref = (double*)malloc(
+            (size_t)ldc*nrhs*sizeof(double));
+        assert(Cref != NULL);
+        memcpy(Cref, C, (size_t)ldc*nrhs*sizeof(double));
+
+        Dref = (double*)malloc(
+            (size_t)ldd*nrhs*sizeof(double));
+        assert(Dref != NULL);
+        memcpy(Dref, D, (size_t)ldd*nrhs*sizeof(double));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_desc_t T;
+    plasma_time_t start = omp_get_wtime();
+    plasma_dtpqrt(m, n, nrhs, R, ldr, B, ldb, C, ldc, D, ldd, &T);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_dtpqrt(m, n, nrhs) / time / 1e9;
+
+    //================================================================
+    // Test results by checking that the update preserves the products
+    // [R; B]^T*[R; B] = R_+^T*R_+ and [R; B]^T*[C; D] = R_+^T*C_+.
+    //================================================================
+    if (test) {
+        double zone  =  1.0;
+        double zmone = -1.0;
+
+        if (n > 1) {
+            LAPACKE_dlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                                zzero, zzero, &R[1], ldr);
+        }
+
+        // G = R^T*R + B^T*B - R_+^T*R_+
+        double *G =
+            (double*)malloc(
+                (size_t)imax(1, n)*imax(n, nrhs)*sizeof(double));
+        assert(G != NULL);
+        cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, n,
+                    (zone),  Rref, ldr,
+                                        Rref, ldr,
+                    (zzero), G, n);
+        cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, m,
+                    (zone), Bref, ldb,
+                                       Bref, ldb,
+                    (zone), G, n);
+        cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, n,
+                    (zmone), R, ldr,
+                                        R, ldr,
+                    (zone),  G, n);
+
+        double work[1];
+        double Rnorm = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'F', n, n, Rref, ldr, work);
+        double Bnorm = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'F', m, n, Bref, ldb, work);
+        double Anorm2 = Rnorm*Rnorm + Bnorm*Bnorm;
+
+        double error = LAPACKE_dlange_work(
+            LAPACK_COL_MAJOR, 'F', n, n, G, n, work);
+        if (Anorm2 != 0.0)
+            error /= Anorm2;
+
+        // G = R^T*C + B^T*D - R_+^T*C_+
+        if (nrhs > 0) {
+            cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, n,
+                        (zone),  Rref, ldr,
+                                            Cref, ldc,
+                        (zzero), G, n);
+            cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, m,
+                        (zone), Bref, ldb,
+                                           Dref, ldd,
+                        (zone), G, n);
+            cblas_dgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, n,
+                        (zmone), R, ldr,
+                                            C, ldc,
+                        (zone),  G, n);
+
+            double Cnorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', n, nrhs, Cref, ldc, work);
+            double Dnorm = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', m, nrhs, Dref, ldd, work);
+            double Xnorm = sqrt(Anorm2)*sqrt(Cnorm*Cnorm + Dnorm*Dnorm);
+
+            double rhs_error = LAPACKE_dlange_work(
+                LAPACK_COL_MAJOR, 'F', n, nrhs, G, n, work);
+            if (Xnorm != 0.0)
+                rhs_error /= Xnorm;
+            error = fmax(error, rhs_error);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+
+        free(G);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    if (imin(m, n) > 0)
+        plasma_desc_destroy(&T);
+    free(R);
+    free(B);
+    free(C);
+    free(D);
+    if (test) {
+        free(Rref);
+        free(Bref);
+        free(Cref);
+        free(Dref);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_ztrsm.c, normal z -> d, Mon Feb  6 14:07:16 2017
+ * @generated from test/test_ztrsm.c, normal z -> d, Thu Oct 15 05:58:07 2026
  *
  **/
 #include "test.h"
@@ -56,11 +56,13 @@ void test_dtrsm(param_value_t param[], char *info)
             print_usage(PARAM_PADA);
             print_usage(PARAM_PADB);
             print_usage(PARAM_NB);
+            print_usage(PARAM_TSTREAM);
+            print_usage(PARAM_INPLACE);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "side",
                      InfoSpacing, "uplo",
                      InfoSpacing, "TransA",
@@ -70,13 +72,15 @@ void test_dtrsm(param_value_t param[], char *info)
                      InfoSpacing, "alpha",
                      InfoSpacing, "PadA",
                      InfoSpacing, "PadB",
-                     InfoSpacing, "NB");
+                     InfoSpacing, "NB",
+                     InfoSpacing, "TStream",
+                     InfoSpacing, "Inplace");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*c %*c %*c %*c %*d %*d %*.4f %*d %*d %*d",
+             "%*c %*c %*c %*c %*d %*d %*.4f %*d %*d %*d %*d %*c",
              InfoSpacing, param[PARAM_SIDE].c,
              InfoSpacing, param[PARAM_UPLO].c,
              InfoSpacing, param[PARAM_TRANSA].c,
@@ -86,7 +90,9 @@ void test_dtrsm(param_value_t param[], char *info)
              InfoSpacing, creal(param[PARAM_ALPHA].z),
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_PADB].i,
-             InfoSpacing, param[PARAM_NB].i);
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_TSTREAM].i,
+             InfoSpacing, param[PARAM_INPLACE].c);
 
     //================================================================
     // Set parameters.
@@ -123,6 +129,11 @@ void test_dtrsm(param_value_t param[], char *info)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaTrsmStream, param[PARAM_TSTREAM].i);
+    if (param[PARAM_INPLACE].c == 'v')
+        plasma_set(PlasmaInplaceOutplace, PlasmaNoTranslation);
+    else
+        plasma_set(PlasmaInplaceOutplace, PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
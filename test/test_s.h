@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_z.h, normal z -> s, Mon Feb  6 14:07:17 2017
+ * @generated from test/test_z.h, normal z -> s, Thu Oct 15 08:59:52 2026
  *
  **/
 #ifndef TEST_S_H
@@ -19,20 +19,45 @@
 //==============================================================================
 void test_samax(param_value_t param[], char *info);
 void test_sgbsv(param_value_t param[], char *info);
+void test_sgbsv_batched(param_value_t param[], char *info);
 void test_sgbtrf(param_value_t param[], char *info);
 void test_sgeadd(param_value_t param[], char *info);
+void test_sgecon(param_value_t param[], char *info);
 void test_sgelqf(param_value_t param[], char *info);
 void test_sgelqs(param_value_t param[], char *info);
 void test_sgels(param_value_t param[], char *info);
 void test_sgemm(param_value_t param[], char *info);
+void test_sgemm_batched(param_value_t param[], char *info);
+void test_sgemm_vbatched(param_value_t param[], char *info);
+void test_sgemm_epilogue(param_value_t param[], char *info);
+void test_sgemmt(param_value_t param[], char *info);
+void test_sgepolar(param_value_t param[], char *info);
+void test_sgeexp(param_value_t param[], char *info);
+void test_sgehrd(param_value_t param[], char *info);
+void test_sgeqp3(param_value_t param[], char *info);
 void test_sgeqrf(param_value_t param[], char *info);
+void test_sgeqrf_batched(param_value_t param[], char *info);
+void test_sgeqrf_cholqr(param_value_t param[], char *info);
 void test_sgeqrs(param_value_t param[], char *info);
 void test_sgesv(param_value_t param[], char *info);
+void test_sgesv_rbt(param_value_t param[], char *info);
+void test_sgesvd(param_value_t param[], char *info);
+void test_sgesvd_randomized(param_value_t param[], char *info);
 void test_sgetrf(param_value_t param[], char *info);
+void test_sgetrf_batched(param_value_t param[], char *info);
+void test_sgetrf_vbatched(param_value_t param[], char *info);
+void test_sgetrf_partial(param_value_t param[], char *info);
 void test_sgetri(param_value_t param[], char *info);
 void test_sgetri_aux(param_value_t param[], char *info);
 void test_sgetrs(param_value_t param[], char *info);
+void test_sgetrs_handle(param_value_t param[], char *info);
+void test_sgetrs_incpiv(param_value_t param[], char *info);
+void test_sgtsv(param_value_t param[], char *info);
+void test_sgtsv_batched(param_value_t param[], char *info);
+void test_ssyev(param_value_t param[], char *info);
+void test_ssygst(param_value_t param[], char *info);
 void test_ssymm(param_value_t param[], char *info);
+void test_ssysv(param_value_t param[], char *info);
 void test_ssyr2k(param_value_t param[], char *info);
 void test_ssyrk(param_value_t param[], char *info);
 void test_slacpy(param_value_t param[], char *info);
@@ -45,18 +70,34 @@ void test_slascl(param_value_t param[], char *info);
 void test_slaset(param_value_t param[], char *info);
 void test_slaswp(param_value_t param[], char *info);
 void test_slauum(param_value_t param[], char *info);
+void test_slrpotrf(param_value_t param[], char *info);
 void test_spbsv(param_value_t param[], char *info);
 void test_spbtrf(param_value_t param[], char *info);
+void test_splrnt(param_value_t param[], char *info);
+void test_spocon(param_value_t param[], char *info);
 void test_sposv(param_value_t param[], char *info);
+void test_spipeline(param_value_t param[], char *info);
 void test_spotrf(param_value_t param[], char *info);
+void test_spotrf_batched(param_value_t param[], char *info);
+void test_spotrf_vbatched(param_value_t param[], char *info);
+void test_spotrf_partial(param_value_t param[], char *info);
+void test_spotrf_sparse(param_value_t param[], char *info);
+void test_spotrf_update(param_value_t param[], char *info);
 void test_spotri(param_value_t param[], char *info);
 void test_spotrs(param_value_t param[], char *info);
+void test_spstrf(param_value_t param[], char *info);
+void test_sptsv(param_value_t param[], char *info);
+void test_sptsv_batched(param_value_t param[], char *info);
 void test_ssymm(param_value_t param[], char *info);
 void test_ssyr2k(param_value_t param[], char *info);
 void test_ssyrk(param_value_t param[], char *info);
+void test_stpqrt(param_value_t param[], char *info);
 void test_stradd(param_value_t param[], char *info);
+void test_stranspose(param_value_t param[], char *info);
 void test_strmm(param_value_t param[], char *info);
+void test_strmm3(param_value_t param[], char *info);
 void test_strsm(param_value_t param[], char *info);
+void test_strsyl(param_value_t param[], char *info);
 void test_strtri(param_value_t param[], char *info);
 void test_sormlq(param_value_t param[], char *info);
 void test_sormqr(param_value_t param[], char *info);
@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgehrd.c, normal z -> s, Thu Oct 15 08:59:52 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGEHRD.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_sgehrd(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_JOBZ);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_NTPF);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "JobQ",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_JOBZ].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t jobq = param[PARAM_JOBZ].c == 'n' ? PlasmaNoVec : PlasmaVec;
+
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldq = lda;
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    float *A =
+        (float*)malloc((size_t)lda*n*sizeof(float));
+    assert(A != NULL);
+
+    float *Q = NULL;
+    if (jobq == PlasmaVec) {
+        Q = (float*)malloc(
+            (size_t)ldq*n*sizeof(float));
+        assert(Q != NULL);
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    float *Aref = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            (size_t)lda*n*sizeof(float));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_sgehrd(jobq, n, A, lda, Q, ldq);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_sgehrd(n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking that H is upper Hessenberg, and
+    // A Q = Q H and the orthogonality of Q, or that H keeps the
+    // Frobenius norm of A.
+    //================================================================
+    if (test) {
+        float *work = (float*)malloc((size_t)n*sizeof(float));
+        assert(work != NULL);
+
+        // entries of H below the first subdiagonal
+        int hess = 1;
+        for (int j = 0; j < n; j++)
+            for (int i = j+2; i < n; i++)
+                if (A[i + (size_t)lda*j] != 0.0)
+                    hess = 0;
+
+        float error;
+        if (jobq == PlasmaVec) {
+            // |A|_1
+            float normA = LAPACKE_slange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                               Aref, lda, work);
+
+            // Build the identity matrix.
+            float *Id =
+                (float*)malloc((size_t)n*n*
+                                            sizeof(float));
+            assert(Id != NULL);
+            LAPACKE_slaset_work(LAPACK_COL_MAJOR, 'g', n, n,
+                                0.0, 1.0, Id, n);
+
+            // |Id - Q^T * Q|_oo / n
+            cblas_ssyrk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                        -1.0, Q, ldq, 1.0, Id, n);
+            param[PARAM_ORTHO].d =
+                LAPACKE_slansy_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    n, Id, n, work) / n;
+
+            // R = A * Q - Q * H
+            float *R = Id;
+            float zone  =  1.0;
+            float zzero =  0.0;
+            float zmone = -1.0;
+            cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        (zone),  Q, ldq,
+                                            A, lda,
+                        (zzero), R, n);
+            cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        (zone),  Aref, lda,
+                                            Q,    ldq,
+                        (zmone), R,    n);
+
+            // |A * Q - Q * H|_1 / (|A|_1 * n)
+            error = LAPACKE_slange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                        R, n, work);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            free(Id);
+        }
+        else {
+            // ||H|_F - |A|_F| / (|A|_F * n)
+            float normA = LAPACKE_slange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               Aref, lda, work);
+            float normH = LAPACKE_slange_work(LAPACK_COL_MAJOR, 'F', n, n,
+                                               A, lda, work);
+            error = fabsf(normH-normA);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            param[PARAM_ORTHO].d = 0.0;
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess && hess &&
+                                 error < tol && param[PARAM_ORTHO].d < tol;
+
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Q);
+    if (test)
+        free(Aref);
+}
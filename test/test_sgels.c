@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgels.c, normal z -> s, Mon Feb  6 14:07:04 2017
+ * @generated from test/test_zgels.c, normal z -> s, Thu Oct 15 02:24:50 2026
  *
  **/
 #include "test.h"
@@ -51,11 +51,12 @@ void test_sgels(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_HMODE);
+            print_usage(PARAM_GELSVAR);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "M",
                      InfoSpacing, "N",
                      InfoSpacing, "NRHS",
@@ -63,13 +64,14 @@ void test_sgels(param_value_t param[], char *info)
                      InfoSpacing, "PadB",
                      InfoSpacing, "NB",
                      InfoSpacing, "IB",
-                     InfoSpacing, "Hous. mode");
+                     InfoSpacing, "Hous. mode",
+                     InfoSpacing, "GelsVar");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*d %*d %*d %*d %*d %*d %*d %*c",
+             "%*d %*d %*d %*d %*d %*d %*d %*c %*c",
              InfoSpacing, param[PARAM_DIM].dim.m,
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_NRHS].i,
@@ -77,7 +79,8 @@ void test_sgels(param_value_t param[], char *info)
              InfoSpacing, param[PARAM_PADB].i,
              InfoSpacing, param[PARAM_NB].i,
              InfoSpacing, param[PARAM_IB].i,
-             InfoSpacing, param[PARAM_HMODE].c);
+             InfoSpacing, param[PARAM_HMODE].c,
+             InfoSpacing, param[PARAM_GELSVAR].c);
 
     //================================================================
     // Set parameters.
@@ -100,9 +103,16 @@ void test_sgels(param_value_t param[], char *info)
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
     else {
         plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
     }
+    if (param[PARAM_GELSVAR].c == 'f')
+        plasma_set(PlasmaGelsVariant, PlasmaFusedGels);
+    else
+        plasma_set(PlasmaGelsVariant, PlasmaClassicGels);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -0,0 +1,265 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgemm_epilogue.c, normal z -> s, Thu Oct 15 07:11:05 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <complex.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/******************************************************************************/
+// Adds one to the block, as the function of the epilogue.
+static void test_sepilogue_func(int i, int j, int m, int n,
+                                float *C, int ldc, void *args)
+{
+    for (int jj = 0; jj < n; jj++)
+        for (int ii = 0; ii < m; ii++)
+            C[(size_t)ldc*jj+ii] += 1.0;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGEMM_EPILOGUE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_sgemm_epilogue(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_TRANSA);
+            print_usage(PARAM_TRANSB);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_ALPHA);
+            print_usage(PARAM_BETA);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_PADC);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*.4f %*.4f %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+
+    int Am = transa == PlasmaNoTrans ? m : k;
+    int An = transa == PlasmaNoTrans ? k : m;
+    int Bm = transb == PlasmaNoTrans ? k : n;
+    int Bn = transb == PlasmaNoTrans ? n : k;
+
+    int lda = imax(1, Am + param[PARAM_PADA].i);
+    int ldb = imax(1, Bm + param[PARAM_PADB].i);
+    int ldc = imax(1, m + param[PARAM_PADC].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float eps = LAPACKE_slamch('E');
+
+#ifdef COMPLEX
+    float alpha = param[PARAM_ALPHA].z;
+    float beta  = param[PARAM_BETA].z;
+#else
+    float alpha = creal(param[PARAM_ALPHA].z);
+    float beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    float *A =
+        (float*)malloc((size_t)lda*An*sizeof(float));
+    assert(A != NULL);
+
+    float *B =
+        (float*)malloc((size_t)ldb*Bn*sizeof(float));
+    assert(B != NULL);
+
+    float *C =
+        (float*)malloc((size_t)ldc*n*sizeof(float));
+    assert(C != NULL);
+
+    // row scale, column scale, row bias and column bias
+    float *V = (float*)malloc(
+        (size_t)2*(m+n)*sizeof(float));
+    assert(V != NULL);
+
+    int retval;
+    retval = plasma_splrnt(Am, An, A, lda, 3172);
+    assert(retval == 0);
+
+    retval = plasma_splrnt(Bm, Bn, B, ldb, 2873);
+    assert(retval == 0);
+
+    retval = plasma_splrnt(m, n, C, ldc, 4613);
+    assert(retval == 0);
+
+    retval = plasma_splrnt(2*(m+n), 1, V, imax(1, 2*(m+n)), 1371);
+    assert(retval == 0);
+
+    plasma_sepilogue_t epilogue = {
+        .row_scale = &V[0],
+        .col_scale = &V[m],
+        .row_bias = &V[m+n],
+        .col_bias = &V[2*m+n],
+        .activation = PlasmaActivationTanh,
+        .func = test_sepilogue_func,
+        .args = NULL};
+
+    float *Cref = NULL;
+    if (test) {
+        Cref = (float*)malloc(
+            (size_t)ldc*n*sizeof(float));
+        assert(Cref != NULL);
+
+        memcpy(Cref, C, (size_t)ldc*n*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    retval = plasma_sgemm_epilogue(
+        transa, transb,
+        m, n, k,
+        alpha, A, lda,
+               B, ldb,
+         beta, C, ldc,
+        &epilogue);
+
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_sgemm(m, n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        // The epilogue scales by at most one in magnitude and tanh is a
+        // contraction, so that the error bound of the gemm holds.
+        float work[1];
+        float Anorm = LAPACKE_slange_work(
+                           LAPACK_COL_MAJOR, 'F', Am, An, A,    lda, work);
+        float Bnorm = LAPACKE_slange_work(
+                           LAPACK_COL_MAJOR, 'F', Bm, Bn, B,    ldb, work);
+        float Cnorm = LAPACKE_slange_work(
+                           LAPACK_COL_MAJOR, 'F', m,  n,  Cref, ldc, work);
+
+        cblas_sgemm(
+            CblasColMajor,
+            (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+            m, n, k,
+            (alpha), A, lda,
+                                B, ldb,
+             (beta), Cref, ldc);
+
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                float z = Cref[(size_t)ldc*j+i];
+                z = z*epilogue.row_scale[i]*epilogue.col_scale[j]
+                  + epilogue.row_bias[i] + epilogue.col_bias[j];
+#ifdef COMPLEX
+                Cref[(size_t)ldc*j+i] = ctanh(z) + 1.0;
+#else
+                Cref[(size_t)ldc*j+i] = tanh(z) + 1.0;
+#endif
+            }
+        }
+
+        float zmone = -1.0;
+        cblas_saxpy((size_t)ldc*n, (zmone), Cref, 1, C, 1);
+
+        float error = LAPACKE_slange_work(
+                           LAPACK_COL_MAJOR, 'F', m, n, C, ldc, work);
+        float normalize = sqrtf((float)k+2) * fabsf(alpha) * Anorm * Bnorm
+                         + 2 * fabsf(beta) * Cnorm + sqrtf((float)m*n);
+        if (normalize != 0)
+            error /= normalize;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = retval == PlasmaSuccess && error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(V);
+    if (test)
+        free(Cref);
+}
@@ -0,0 +1,283 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgemm_vbatched.c, normal z -> s, Thu Oct 15 07:26:02 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGEMM_VBATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ *
+ * Product l of the batch is of dimensions m, n and k divided by 2^(l%8).
+ ******************************************************************************/
+void test_sgemm_vbatched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_TRANSA);
+            print_usage(PARAM_TRANSB);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_ALPHA);
+            print_usage(PARAM_BETA);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_PADC);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "alpha",
+                     InfoSpacing, "beta",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*d %*.4f %*.4f %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, creal(param[PARAM_ALPHA].z),
+             InfoSpacing, creal(param[PARAM_BETA].z),
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int batch = param[PARAM_BATCH].i;
+
+    int *m = (int*)malloc(6*batch*sizeof(int));
+    assert(m != NULL);
+    int *n   = &m[batch];
+    int *k   = &m[2*batch];
+    int *lda = &m[3*batch];
+    int *ldb = &m[4*batch];
+    int *ldc = &m[5*batch];
+
+    size_t sizeA = 0;
+    size_t sizeB = 0;
+    size_t sizeC = 0;
+    float flops = 0.0;
+    for (int i = 0; i < batch; i++) {
+        m[i] = param[PARAM_DIM].dim.m >> (i%8);
+        n[i] = param[PARAM_DIM].dim.n >> (i%8);
+        k[i] = param[PARAM_DIM].dim.k >> (i%8);
+        int Am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int An = transa == PlasmaNoTrans ? k[i] : m[i];
+        int Bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        int Bn = transb == PlasmaNoTrans ? n[i] : k[i];
+        lda[i] = imax(1, Am + param[PARAM_PADA].i);
+        ldb[i] = imax(1, Bm + param[PARAM_PADB].i);
+        ldc[i] = imax(1, m[i] + param[PARAM_PADC].i);
+        sizeA += (size_t)lda[i]*An;
+        sizeB += (size_t)ldb[i]*Bn;
+        sizeC += (size_t)ldc[i]*n[i];
+        flops += flops_sgemm(m[i], n[i], k[i]);
+    }
+
+    int test = param[PARAM_TEST].c == 'y';
+    float eps = LAPACKE_slamch('E');
+
+#ifdef COMPLEX
+    float alpha = param[PARAM_ALPHA].z;
+    float beta  = param[PARAM_BETA].z;
+#else
+    float alpha = creal(param[PARAM_ALPHA].z);
+    float beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    float *A =
+        (float*)malloc(
+            imax(1, sizeA)*sizeof(float));
+    assert(A != NULL);
+
+    float *B =
+        (float*)malloc(
+            imax(1, sizeB)*sizeof(float));
+    assert(B != NULL);
+
+    float *C =
+        (float*)malloc(
+            imax(1, sizeC)*sizeof(float));
+    assert(C != NULL);
+
+    float **pA =
+        (float**)malloc(3*batch*sizeof(float*));
+    assert(pA != NULL);
+    float **pB = &pA[batch];
+    float **pC = &pA[2*batch];
+
+    size_t offA = 0;
+    size_t offB = 0;
+    size_t offC = 0;
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[offA];
+        pB[i] = &B[offB];
+        pC[i] = &C[offC];
+        offA += (size_t)lda[i]*(transa == PlasmaNoTrans ? k[i] : m[i]);
+        offB += (size_t)ldb[i]*(transb == PlasmaNoTrans ? n[i] : k[i]);
+        offC += (size_t)ldc[i]*n[i];
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, sizeA, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_slarnv(1, seed, sizeB, B);
+    assert(retval == 0);
+
+    retval = LAPACKE_slarnv(1, seed, sizeC, C);
+    assert(retval == 0);
+
+    float *Cref = NULL;
+    if (test) {
+        Cref = (float*)malloc(
+            imax(1, sizeC)*sizeof(float));
+        assert(Cref != NULL);
+
+        memcpy(Cref, C, sizeC*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    plasma_sgemm_vbatched(
+        transa, transb,
+        m, n, k,
+        alpha, pA, lda,
+               pB, ldb,
+         beta, pC, ldc,
+        batch);
+
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        // |R - R_ref|_p < gamma_{k+2} * |alpha| * |A|_p * |B|_p +
+        //                 gamma_2 * |beta| * |C|_p
+        // as in test_sgemm_batched.
+        // The largest error of the batch is reported.
+        float error = 0.0;
+        for (int i = 0; i < batch; i++) {
+            int Am = transa == PlasmaNoTrans ? m[i] : k[i];
+            int An = transa == PlasmaNoTrans ? k[i] : m[i];
+            int Bm = transb == PlasmaNoTrans ? k[i] : n[i];
+            int Bn = transb == PlasmaNoTrans ? n[i] : k[i];
+            float *Cl = &Cref[pC[i]-C];
+            size_t sizeCl = (size_t)ldc[i]*n[i];
+            float work[1];
+            float Anorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', Am, An, pA[i], lda[i], work);
+            float Bnorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', Bm, Bn, pB[i], ldb[i], work);
+            float Cnorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m[i], n[i], Cl, ldc[i], work);
+
+            cblas_sgemm(
+                CblasColMajor,
+                (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                m[i], n[i], k[i],
+                (alpha), pA[i], lda[i],
+                                    pB[i], ldb[i],
+                 (beta), Cl, ldc[i]);
+
+            float zmone = -1.0;
+            cblas_saxpy(sizeCl, (zmone), Cl, 1, pC[i], 1);
+
+            float err = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m[i], n[i], pC[i], ldc[i], work);
+            float normalize = sqrtf((float)k[i]+2) * fabsf(alpha) * Anorm *
+                               Bnorm + 2 * fabsf(beta) * Cnorm;
+            if (normalize != 0)
+                err /= normalize;
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(pA);
+    free(m);
+    if (test)
+        free(Cref);
+}
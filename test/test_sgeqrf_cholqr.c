@@ -0,0 +1,216 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgeqrf_cholqr.c, normal z -> s, Thu Oct 15 06:29:01 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGEQRF_CHOLQR.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_sgeqrf_cholqr(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_ZEROCOL);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "ZeroCol",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i,
+             InfoSpacing, param[PARAM_ZEROCOL].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = imin(param[PARAM_DIM].dim.n, m);
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldr = imax(1, n);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    float *A =
+        (float*)malloc((size_t)lda*n*sizeof(float));
+    assert(A != NULL);
+
+    float *R =
+        (float*)malloc((size_t)ldr*n*sizeof(float));
+    assert(R != NULL);
+
+    int retval;
+    retval = plasma_splrnt(m, n, A, lda, 3172);
+    assert(retval == 0);
+
+    // A rank deficient A takes the Householder fallback.
+    int zerocol = param[PARAM_ZEROCOL].i;
+    if (zerocol >= 0 && zerocol < n)
+        memset(&A[(size_t)zerocol*lda], 0, m*sizeof(float));
+
+    float *Aref = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            (size_t)lda*n*sizeof(float));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_sgeqrf_cholqr(m, n, A, lda, R, ldr);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    // the rate of the Householder factorization forming Q
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d =
+        (flops_sgeqrf(m, n) + flops_sorgqr(m, n, n)) / time / 1e9;
+
+    //================================================================
+    // Test results by checking A = Q R and the orthogonality of Q.
+    //================================================================
+    if (test) {
+        float zone  =  1.0;
+
+        float *work = (float*)malloc((size_t)m*sizeof(float));
+        assert(work != NULL);
+
+        // |Id - Q^T * Q|_oo / n
+        float *Id =
+            (float*)malloc((size_t)n*n*
+                                        sizeof(float));
+        assert(Id != NULL);
+
+        LAPACKE_slaset_work(LAPACK_COL_MAJOR, 'g', n, n, 0.0, 1.0, Id, n);
+        cblas_ssyrk(CblasColMajor, CblasUpper, CblasConjTrans, n, m,
+                    -1.0, A, lda, 1.0, Id, n);
+        float ortho = LAPACKE_slansy_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                           n, Id, n, work);
+        if (n > 0)
+            ortho /= n;
+        param[PARAM_ORTHO].d = ortho;
+
+        // |A|_oo
+        float normA = LAPACKE_slange_work(LAPACK_COL_MAJOR, 'I', m, n,
+                                           Aref, lda, work);
+
+        // |A - Q*R|_oo / (|A|_oo * n)
+        cblas_strmm(CblasColMajor, CblasRight, CblasUpper, CblasNoTrans,
+                    CblasNonUnit, m, n, (zone), R, ldr, A, lda);
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                Aref[(size_t)j*lda+i] -= A[(size_t)j*lda+i];
+
+        float error = LAPACKE_slange_work(LAPACK_COL_MAJOR, 'I', m, n,
+                                           Aref, lda, work);
+        if (normA != 0)
+            error /= normA;
+        if (n > 0)
+            error /= n;
+
+        // R is upper triangular.
+        int lower = 0;
+        for (int j = 0; j < n; j++)
+            for (int i = j+1; i < n; i++)
+                lower |= R[(size_t)j*ldr+i] != 0.0;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess &&
+                                 error < tol && ortho < tol && !lower;
+
+        free(Id);
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(R);
+    if (test)
+        free(Aref);
+}
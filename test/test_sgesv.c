@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgesv.c, normal z -> s, Mon Feb  6 14:07:05 2017
+ * @generated from test/test_zgesv.c, normal z -> s, Thu Oct 15 05:12:54 2026
  *
  **/
 #include "test.h"
@@ -54,31 +54,34 @@ void test_sgesv(param_value_t param[], char *info)
             print_usage(PARAM_NB);
             print_usage(PARAM_IB);
             print_usage(PARAM_NTPF);
+            print_usage(PARAM_LPIV);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "N",
                      InfoSpacing, "Nrhs",
                      InfoSpacing, "PadA",
                      InfoSpacing, "PadB",
                      InfoSpacing, "NB",
                      InfoSpacing, "IB",
-                     InfoSpacing, "NTPF");
+                     InfoSpacing, "NTPF",
+                     InfoSpacing, "LPiv");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*d %*d %*d %*d %*d %*d %*d",
+             "%*d %*d %*d %*d %*d %*d %*d %*c",
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_NRHS].i,
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_PADB].i,
              InfoSpacing, param[PARAM_NB].i,
              InfoSpacing, param[PARAM_IB].i,
-             InfoSpacing, param[PARAM_NTPF].i);
+             InfoSpacing, param[PARAM_NTPF].i,
+             InfoSpacing, param[PARAM_LPIV].c);
 
     //================================================================
     // Set parameters.
@@ -98,6 +101,10 @@ void test_sgesv(param_value_t param[], char *info)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_NTPF].i);
+    if (param[PARAM_LPIV].c == 'n')
+        plasma_set(PlasmaLeftPivoting, PlasmaLeftPivotingOff);
+    else
+        plasma_set(PlasmaLeftPivoting, PlasmaLeftPivotingOn);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -114,12 +121,11 @@ void test_sgesv(param_value_t param[], char *info)
     int *ipiv = (int*)malloc((size_t)n*sizeof(int));
     assert(ipiv != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_slarnv(1, seed, (size_t)lda*n, A);
+    int retval;
+    retval = plasma_splrnt(n, n, A, lda, 3172);
     assert(retval == 0);
 
-    retval = LAPACKE_slarnv(1, seed, (size_t)ldb*nrhs, B);
+    retval = plasma_splrnt(n, nrhs, B, ldb, 2873);
     assert(retval == 0);
 
     float *Aref = NULL;
@@ -0,0 +1,188 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgetrf_batched.c, normal z -> s, Wed Oct 14 17:43:11 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGETRF_BATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_sgetrf_batched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_PADA);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "PadA");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, param[PARAM_PADA].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+    int minmn = imin(m, n);
+
+    float *A =
+        (float*)malloc(batch*sizeA*sizeof(float));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc(batch*imax(1, minmn)*sizeof(int));
+    assert(ipiv != NULL);
+
+    float **pA =
+        (float**)malloc(batch*sizeof(float*));
+    assert(pA != NULL);
+
+    int **pipiv = (int**)malloc(batch*sizeof(int*));
+    assert(pipiv != NULL);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    for (int l = 0; l < batch; l++) {
+        pA[l] = &A[l*sizeA];
+        pipiv[l] = &ipiv[l*imax(1, minmn)];
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, batch*sizeA, A);
+    assert(retval == 0);
+
+    float *Aref = NULL;
+    int *ipivref = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            batch*sizeA*sizeof(float));
+        assert(Aref != NULL);
+
+        ipivref = (int*)malloc(imax(1, minmn)*sizeof(int));
+        assert(ipivref != NULL);
+
+        memcpy(Aref, A, batch*sizeA*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_sgetrf_batched(m, n, pA, lda, pipiv, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = batch * flops_sgetrf(m, n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    // The largest error of the batch is reported.
+    //================================================================
+    if (test) {
+        float error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            float *Al = &Aref[l*sizeA];
+            float work[1];
+            float Anorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, Al, lda, work);
+
+            int lapinfo = LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n,
+                                         Al, lda, ipivref);
+            if (lapinfo != plainfo[l] ||
+                memcmp(ipivref, pipiv[l], minmn*sizeof(int)) != 0) {
+                error = INFINITY;
+                break;
+            }
+
+            float zmone = -1.0;
+            cblas_saxpy(sizeA, (zmone), Al, 1, pA[l], 1);
+
+            float err = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m, n, pA[l], lda, work);
+            if (Anorm != 0)
+                err /= Anorm;
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(ipiv);
+    free(pA);
+    free(pipiv);
+    free(plainfo);
+    if (test) {
+        free(Aref);
+        free(ipivref);
+    }
+}
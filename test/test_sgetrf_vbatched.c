@@ -0,0 +1,221 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgetrf_vbatched.c, normal z -> s, Thu Oct 15 07:26:02 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGETRF_VBATCHED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ *
+ * Matrix l of the batch is of size m/2^(l%8) by n/2^(l%8).
+ ******************************************************************************/
+void test_sgetrf_vbatched(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_BATCH);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "Batch",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_BATCH].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int batch = param[PARAM_BATCH].i;
+
+    int *m = (int*)malloc(batch*sizeof(int));
+    assert(m != NULL);
+
+    int *n = (int*)malloc(batch*sizeof(int));
+    assert(n != NULL);
+
+    int *lda = (int*)malloc(batch*sizeof(int));
+    assert(lda != NULL);
+
+    size_t sizeA = 0;
+    size_t sizeipiv = 0;
+    float flops = 0.0;
+    for (int l = 0; l < batch; l++) {
+        m[l] = param[PARAM_DIM].dim.m >> (l%8);
+        n[l] = param[PARAM_DIM].dim.n >> (l%8);
+        lda[l] = imax(1, m[l] + param[PARAM_PADA].i);
+        sizeA += (size_t)lda[l]*n[l];
+        sizeipiv += imax(1, imin(m[l], n[l]));
+        flops += flops_sgetrf(m[l], n[l]);
+    }
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    // The matrices of the batch are stored one after the other.
+    //================================================================
+    float *A =
+        (float*)malloc(
+            imax(1, sizeA)*sizeof(float));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc(sizeipiv*sizeof(int));
+    assert(ipiv != NULL);
+
+    float **pA =
+        (float**)malloc(batch*sizeof(float*));
+    assert(pA != NULL);
+
+    int **pipiv = (int**)malloc(batch*sizeof(int*));
+    assert(pipiv != NULL);
+
+    int *plainfo = (int*)malloc(batch*sizeof(int));
+    assert(plainfo != NULL);
+
+    size_t offset = 0;
+    size_t offipiv = 0;
+    for (int l = 0; l < batch; l++) {
+        pA[l] = &A[offset];
+        pipiv[l] = &ipiv[offipiv];
+        offset += (size_t)lda[l]*n[l];
+        offipiv += imax(1, imin(m[l], n[l]));
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, sizeA, A);
+    assert(retval == 0);
+
+    float *Aref = NULL;
+    int *ipivref = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            imax(1, sizeA)*sizeof(float));
+        assert(Aref != NULL);
+
+        ipivref = (int*)malloc(sizeipiv*sizeof(int));
+        assert(ipivref != NULL);
+
+        memcpy(Aref, A, sizeA*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_sgetrf_vbatched(m, n, pA, lda, pipiv, batch, plainfo);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    // The largest error of the batch is reported.
+    //================================================================
+    if (test) {
+        float error = 0.0;
+        for (int l = 0; l < batch && error < INFINITY; l++) {
+            float *Al = &Aref[pA[l]-A];
+            size_t sizeAl = (size_t)lda[l]*n[l];
+            int minmn = imin(m[l], n[l]);
+            float work[1];
+            float Anorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m[l], n[l], Al, lda[l], work);
+
+            int lapinfo = LAPACKE_sgetrf(LAPACK_COL_MAJOR, m[l], n[l],
+                                         Al, lda[l], ipivref);
+            if (lapinfo != plainfo[l] ||
+                memcmp(ipivref, pipiv[l], minmn*sizeof(int)) != 0) {
+                error = INFINITY;
+                break;
+            }
+
+            float zmone = -1.0;
+            cblas_saxpy(sizeAl, (zmone), Al, 1, pA[l], 1);
+
+            float err = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'F', m[l], n[l], pA[l], lda[l], work);
+            if (Anorm != 0)
+                err /= Anorm;
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(ipiv);
+    free(pA);
+    free(pipiv);
+    free(m);
+    free(n);
+    free(lda);
+    free(plainfo);
+    if (test) {
+        free(Aref);
+        free(ipivref);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zgetri.c, normal z -> s, Mon Feb  6 14:07:07 2017
+ * @generated from test/test_zgetri.c, normal z -> s, Thu Oct 15 08:42:01 2026
  *
  **/
 #include "test.h"
@@ -52,25 +52,28 @@ void test_sgetri(param_value_t param[], char *info)
             print_usage(PARAM_PADA);
             print_usage(PARAM_NB);
             print_usage(PARAM_ZEROCOL);
+            print_usage(PARAM_GETRIVAR);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s",
                      InfoSpacing, "N",
                      InfoSpacing, "PadA",
                      InfoSpacing, "NB",
-                     InfoSpacing, "ZeroCol");
+                     InfoSpacing, "ZeroCol",
+                     InfoSpacing, "GetriVar");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*d %*d %*d %*d",
+             "%*d %*d %*d %*d %*c",
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_PADA].i,
              InfoSpacing, param[PARAM_NB].i,
-             InfoSpacing, param[PARAM_ZEROCOL].i);
+             InfoSpacing, param[PARAM_ZEROCOL].i,
+             InfoSpacing, param[PARAM_GETRIVAR].c);
 
     //================================================================
     // Set parameters.
@@ -85,6 +88,10 @@ void test_sgetri(param_value_t param[], char *info)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_GETRIVAR].c == 'g')
+        plasma_set(PlasmaGetriVariant, PlasmaGaussJordanGetri);
+    else
+        plasma_set(PlasmaGetriVariant, PlasmaClassicGetri);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -0,0 +1,193 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgtsv.c, normal z -> s, Wed Oct 14 19:29:19 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define B(i_, j_) B[(i_) + (size_t)ldb*(j_)]
+#define X(i_, j_) X[(i_) + (size_t)ldx*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGTSV.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_sgtsv(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                "%*s %*s %*s %*s ",
+                InfoSpacing, "N",
+                InfoSpacing, "NRHS",
+                InfoSpacing, "PadB",
+                InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+        "%*d %*d %*d %*d ",
+        InfoSpacing, param[PARAM_DIM].dim.n,
+        InfoSpacing, param[PARAM_NRHS].i,
+        InfoSpacing, param[PARAM_PADB].i,
+        InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n    = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int ldx  = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    // diagonals of A, kept in A for the check
+    float *A =
+        (float*)malloc(6*(size_t)n*sizeof(float));
+    assert(A != NULL);
+    float *dl = &A[0];
+    float *d  = &A[n];
+    float *du = &A[2*n];
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, 3*(size_t)n, A);
+    assert(retval == 0);
+    // make it diagonally dominant
+    for (int i = 0; i < n; i++)
+        d[i] += 3.0;
+    memcpy(&A[3*n], A, 3*(size_t)n*sizeof(float));
+    float *dlref = &A[3*n];
+    float *dref  = &A[4*n];
+    float *duref = &A[5*n];
+
+    float *X = (float*)malloc(
+        (size_t)ldx*nrhs*sizeof(float));
+    assert(X != NULL);
+
+    retval = LAPACKE_slarnv(1, seed, (size_t)ldx*nrhs, X);
+    assert(retval == 0);
+
+    // copy B to X
+    int ldb = ldx;
+    float *B = NULL;
+    if (test) {
+        B = (float*)malloc(
+            (size_t)ldb*nrhs*sizeof(float));
+        assert(B != NULL);
+        LAPACKE_slacpy_work(LAPACK_COL_MAJOR, 'F', n, nrhs, X, ldx, B, ldb);
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_sgtsv(n, nrhs, dl, d, du, X, ldx);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = 0.0 / time / 1e9;
+
+    //================================================================
+    // Test results by computing residual norm.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            // compute residual vector B - A*X
+            for (int j = 0; j < nrhs; j++) {
+                for (int i = 0; i < n; i++) {
+                    B(i, j) -= dref[i]*X(i, j);
+                    if (i > 0)
+                        B(i, j) -= dlref[i-1]*X(i-1, j);
+                    if (i < n-1)
+                        B(i, j) -= duref[i]*X(i+1, j);
+                }
+            }
+
+            // compute various norms
+            float Anorm = 0.0;
+            for (int i = 0; i < n; i++) {
+                float sum = fabsf(dref[i]);
+                if (i > 0)
+                    sum += fabsf(dlref[i-1]);
+                if (i < n-1)
+                    sum += fabsf(duref[i]);
+                Anorm = fmax(Anorm, sum);
+            }
+            float *work = NULL;
+            work = (float*)malloc((size_t)n*sizeof(float));
+            assert(work != NULL);
+
+            float Xnorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, X, ldx, work);
+            float Rnorm = LAPACKE_slange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, B, ldb, work);
+            float residual = Rnorm/(n*Anorm*Xnorm);
+
+            param[PARAM_ERROR].d = residual;
+            param[PARAM_SUCCESS].i = residual < tol;
+
+            free(work);
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+        free(B);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(X);
+    free(A);
+}
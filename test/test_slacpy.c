@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zlacpy.c, normal z -> s, Mon Feb  6 14:07:08 2017
+ * @generated from test/test_zlacpy.c, normal z -> s, Thu Oct 15 02:22:02 2026
  *
  **/
 
@@ -160,6 +160,8 @@ void test_slacpy(param_value_t param[], char *info)
     }
     else {
         param[PARAM_TIME].d = stop-start;
+        param[PARAM_GBYTES].d =
+            bytes_slacpy(uplo, m, n) / param[PARAM_TIME].d / 1e9;
     }
 
     //================================================================
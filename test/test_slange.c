@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zlange.c, normal z -> s, Mon Feb  6 14:07:09 2017
+ * @generated from test/test_zlange.c, normal z -> s, Thu Oct 15 11:00:48 2026
  *
  **/
 
@@ -51,27 +51,30 @@ void test_slange(param_value_t param[], char *info)
             print_usage(PARAM_DIM);
             print_usage(PARAM_PADA);
             print_usage(PARAM_NB);
+            print_usage(PARAM_RATE);
         }
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                     "%*s %*s %*s %*s %*s",
+                     "%*s %*s %*s %*s %*s %*s",
                      InfoSpacing, "Norm",
                      InfoSpacing, "M",
                      InfoSpacing, "N",
                      InfoSpacing, "PadA",
-                     InfoSpacing, "NB");
+                     InfoSpacing, "NB",
+                     InfoSpacing, "Rate");
         }
         return;
     }
     // Return column values.
     snprintf(info, InfoLen,
-             "%*c %*d %*d %*d %*d",
+             "%*c %*d %*d %*d %*d %*d",
              InfoSpacing, param[PARAM_NORM].c,
              InfoSpacing, param[PARAM_DIM].dim.m,
              InfoSpacing, param[PARAM_DIM].dim.n,
              InfoSpacing, param[PARAM_PADA].i,
-             InfoSpacing, param[PARAM_NB].i);
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_RATE].i);
 
     //================================================================
     // Set parameters.
@@ -82,6 +85,7 @@ void test_slange(param_value_t param[], char *info)
     int n = param[PARAM_DIM].dim.n;
 
     int lda = imax(1, m + param[PARAM_PADA].i);
+    int rate = param[PARAM_RATE].i;
 
     int test = param[PARAM_TEST].c == 'y';
     float eps = LAPACKE_slamch('E');
@@ -115,13 +119,69 @@ void test_slange(param_value_t param[], char *info)
     //================================================================
     // Run and time PLASMA.
     //================================================================
-    plasma_time_t start = omp_get_wtime();
-    float value = plasma_slange(norm, m, n, A, lda);
-    plasma_time_t stop = omp_get_wtime();
-    plasma_time_t time = stop-start;
+    float value;
+    plasma_time_t time;
+    if (rate == 0) {
+        plasma_time_t start = omp_get_wtime();
+        value = plasma_slange(norm, m, n, A, lda);
+        plasma_time_t stop = omp_get_wtime();
+        time = stop-start;
+    }
+    else {
+        // Norm of the tiles packed at the rate, without the translation.
+        int nb = param[PARAM_NB].i;
+        plasma_desc_t Adesc;
+        retval = plasma_desc_general_packed_create(PlasmaRealFloat, rate,
+                                                   nb, nb, m, n, 0, 0, m, n,
+                                                   &Adesc);
+        assert(retval == PlasmaSuccess);
+
+        float *work = NULL;
+        switch (norm) {
+        case PlasmaMaxNorm:
+            work = (float*)malloc(
+                ((size_t)Adesc.mt*Adesc.nt)*sizeof(float));
+            break;
+        case PlasmaOneNorm:
+            work = (float*)malloc(
+                ((size_t)Adesc.mt*Adesc.n+Adesc.n)*sizeof(float));
+            break;
+        case PlasmaInfNorm:
+            work = (float*)malloc(
+                ((size_t)Adesc.nt*Adesc.m+Adesc.m)*sizeof(float));
+            break;
+        case PlasmaFrobeniusNorm:
+            work = (float*)malloc(
+                ((size_t)2*Adesc.mt*Adesc.nt)*sizeof(float));
+            break;
+        }
+        assert(work != NULL);
+
+        plasma_sequence_t *sequence = NULL;
+        retval = plasma_sequence_create(&sequence);
+        assert(retval == PlasmaSuccess);
+        plasma_request_t request = PlasmaRequestInitializer;
+
+        #pragma omp parallel
+        #pragma omp master
+        plasma_omp_sge2desc(A, lda, Adesc, sequence, &request);
+
+        plasma_time_t start = omp_get_wtime();
+        #pragma omp parallel
+        #pragma omp master
+        plasma_omp_slange(norm, Adesc, work, &value, sequence, &request);
+        plasma_time_t stop = omp_get_wtime();
+        time = stop-start;
+
+        assert(sequence->status == PlasmaSuccess);
+        plasma_sequence_destroy(sequence);
+        plasma_desc_destroy(&Adesc);
+        free(work);
+    }
 
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_slange(m, n, norm) / time / 1e9;
+    param[PARAM_GBYTES].d = bytes_slange(m, n) / time / 1e9;
 
     //================================================================
     // Test results by comparing to a reference implementation.
@@ -136,6 +196,10 @@ void test_slange(param_value_t param[], char *info)
         if (valueRef != 0)
             error /= valueRef;
         float tol = eps;
+        if (rate > 0) {
+            // Each real number is rounded to rate bytes.
+            tol += ldexp(eps, 8*((int)sizeof(eps)-rate));
+        }
         float normalize = 1;
         switch (norm) {
             case PlasmaInfNorm:
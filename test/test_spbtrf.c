@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zpbtrf.c, normal z -> s, Mon Feb  6 14:07:12 2017
+ * @generated from test/test_zpbtrf.c, normal z -> s, Wed Oct 14 19:34:57 2026
  *
  **/
 #include "test.h"
@@ -55,6 +55,7 @@ void test_spbtrf(param_value_t param[], char *info)
             print_usage(PARAM_KL);
             print_usage(PARAM_PADA);
             print_usage(PARAM_NB);
+            print_usage(PARAM_UMODE);
             //  gbtrs params for check
             print_usage(PARAM_NRHS);
             print_usage(PARAM_PADB);
@@ -63,12 +64,13 @@ void test_spbtrf(param_value_t param[], char *info)
         else {
             // Return column labels.
             snprintf(info, InfoLen,
-                "%*s %*s %*s %*s %*s %*s %*s %*s ",
+                "%*s %*s %*s %*s %*s %*s %*s %*s %*s ",
                 InfoSpacing, "UpLo",
                 InfoSpacing, "N",
                 InfoSpacing, "KD",
                 InfoSpacing, "PadA",
                 InfoSpacing, "NB",
+                InfoSpacing, "UMode",
                 InfoSpacing, "NRHS",
                 InfoSpacing, "PadB",
                 InfoSpacing, "ZeroCol");
@@ -94,12 +96,13 @@ void test_spbtrf(param_value_t param[], char *info)
     // Return column values.
     //================================================================
     snprintf(info, InfoLen,
-        "%*c %*d %*d %*d %*d %*d %*d %*d",
+        "%*c %*d %*d %*d %*d %*c %*d %*d %*d",
         InfoSpacing, param[PARAM_UPLO].c,
         InfoSpacing, param[PARAM_DIM].dim.n,
         InfoSpacing, kd,
         InfoSpacing, param[PARAM_PADA].i,
         InfoSpacing, param[PARAM_NB].i,
+        InfoSpacing, param[PARAM_UMODE].c,
         InfoSpacing, param[PARAM_NRHS].i,
         InfoSpacing, param[PARAM_PADB].i,
         InfoSpacing, param[PARAM_ZEROCOL].i);
@@ -108,6 +111,10 @@ void test_spbtrf(param_value_t param[], char *info)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_UMODE].c == 't')
+        plasma_set(PlasmaUpdateMode, PlasmaTileUpdate);
+    else
+        plasma_set(PlasmaUpdateMode, PlasmaColumnUpdate);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from test/test_zposv.c, normal z -> s, Mon Feb  6 14:07:13 2017
+ * @generated from test/test_zposv.c, normal z -> s, Thu Oct 15 05:12:54 2026
  *
  **/
 #include "test.h"
@@ -25,8 +25,6 @@
 
 #define REAL
 
-#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
-
 /***************************************************************************//**
  *
  * @brief Tests SPOSV.
@@ -109,27 +107,17 @@ void test_sposv(param_value_t param[], char *info)
                                     *sizeof(float));
     assert(B != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_slarnv(1, seed, (size_t)lda*n, A);
+    //================================================================
+    // Generate a symmetric/symmetric positive definite A matrix,
+    // its diagonal increased by n.
+    //================================================================
+    int retval;
+    retval = plasma_splgsy((float)n, n, A, lda, 3172);
     assert(retval == 0);
 
-    retval = LAPACKE_slarnv(1, seed, (size_t)ldb*nrhs, B);
+    retval = plasma_splrnt(n, nrhs, B, ldb, 2873);
     assert(retval == 0);
 
-    //================================================================
-    // Make the A matrix symmetric/symmetric positive definite.
-    // It increases diagonal by n, and makes it real.
-    // It sets Aji = ( Aij ) for j < i, that is, copy lower
-    // triangle to upper triangle.
-    //================================================================
-    for (int i = 0; i < n; ++i) {
-        A(i,i) = creal(A(i,i)) + n;
-        for (int j = 0; j < i; ++j) {
-            A(j,i) = (A(i,j));
-        }
-    }
-
     float *Aref = NULL;
     float *Bref = NULL;
     float *work = NULL;
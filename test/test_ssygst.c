@@ -0,0 +1,189 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zhegst.c, normal z -> s, Thu Oct 15 08:31:46 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+#define B(i_, j_) B[(i_) + (size_t)ldb*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests SSYGST.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_ssygst(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_ITYPE);
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "IType",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_ITYPE].i,
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int itype = param[PARAM_ITYPE].i;
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    float *A =
+        (float*)malloc((size_t)lda*n*sizeof(float));
+    assert(A != NULL);
+
+    float *B =
+        (float*)malloc((size_t)ldb*n*sizeof(float));
+    assert(B != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_slarnv(1, seed, (size_t)ldb*n, B);
+    assert(retval == 0);
+
+    // Make A symmetric and B symmetric positive definite by diagonal
+    // dominance, and factor B.
+    for (int j = 0; j < n; j++) {
+        A(j, j) = creal(A(j, j));
+        B(j, j) = creal(B(j, j)) + n;
+        for (int i = 0; i < j; i++) {
+            A(j, i) = (A(i, j));
+            B(j, i) = (B(i, j));
+        }
+    }
+    retval = LAPACKE_spotrf(LAPACK_COL_MAJOR, lapack_const(uplo), n, B, ldb);
+    assert(retval == 0);
+
+    float *Aref = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            (size_t)lda*n*sizeof(float));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(float));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    plasma_ssygst(itype, uplo, n, A, lda, B, ldb);
+
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_ssygst(n) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to the reduction by LAPACK,
+    // ||A - Aref|| / ||Aref||.
+    //================================================================
+    if (test) {
+        float zmone = -1.0;
+        float work[1];
+
+        retval = LAPACKE_ssygst(LAPACK_COL_MAJOR, itype, lapack_const(uplo),
+                                n, Aref, lda, B, ldb);
+        assert(retval == 0);
+
+        float Anorm = LAPACKE_slansy_work(
+               LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, Aref, lda, work);
+
+        // A -= Aref
+        cblas_saxpy((size_t)lda*n, (zmone), Aref, 1, A, 1);
+
+        float error = LAPACKE_slansy_work(
+               LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, A, lda, work);
+
+        if (Anorm != 0.0)
+            error /= Anorm;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    if (test)
+        free(Aref);
+}
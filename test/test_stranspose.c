@@ -0,0 +1,164 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_ztranspose.c, normal z -> s, Thu Oct 15 06:03:19 2026
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "flops.h"
+#include "plasma.h"
+#include "test.h"
+
+#include <assert.h>
+#include <math.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests STRANSPOSE
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_stranspose(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info
+            print_usage(PARAM_TRANS);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "Trans",
+                     InfoSpacing, "m",
+                     InfoSpacing, "n",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "nb");
+        }
+        return;
+    }
+    // Return column values
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANS].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters
+    //================================================================
+    // The default trans = n stands for the plain transpose.
+    plasma_enum_t trans = plasma_trans_const(param[PARAM_TRANS].c);
+    if (trans == PlasmaNoTrans)
+        trans = PlasmaTrans;
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    //================================================================
+    // Set tuning parameters
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays
+    //================================================================
+    float *A =
+        (float*)malloc((size_t)lda*n*sizeof(float));
+    assert(A != NULL);
+
+    float *B =
+        (float*)malloc((size_t)ldb*m*sizeof(float));
+    assert(B != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_slarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+    retval = LAPACKE_slarnv(1, seed, (size_t)ldb*m, B);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    retval = plasma_stranspose(trans, m, n, A, lda, B, ldb);
+
+    plasma_time_t stop = omp_get_wtime();
+
+    param[PARAM_GFLOPS].d = 0.0;
+
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_stranspose() failed");
+        param[PARAM_TIME].d    = 0.0;
+        param[PARAM_ERROR].d   = 1.0;
+        param[PARAM_SUCCESS].i = false;
+        return;
+    }
+    else {
+        param[PARAM_TIME].d = stop-start;
+        param[PARAM_GBYTES].d =
+            bytes_slacpy(PlasmaGeneral, m, n) / param[PARAM_TIME].d / 1e9;
+    }
+
+    //================================================================
+    // Test results by comparing elementwise to op( A )
+    //================================================================
+    if (test) {
+        // The copy is exact, so any difference is an error.
+        float error = 0.0;
+        for (int j = 0; j < m; j++) {
+            for (int i = 0; i < n; i++) {
+                float aji = A[(size_t)lda*i+j];
+                if (trans == PlasmaConjTrans)
+                    aji = (aji);
+                error = fmax(error, fabsf(B[(size_t)ldb*j+i] - aji));
+            }
+        }
+
+        param[PARAM_ERROR].d   = error;
+        param[PARAM_SUCCESS].i = error == 0.0;
+    }
+
+    //================================================================
+    // Free arrays
+    //================================================================
+    free(A);
+    free(B);
+}
@@ -19,20 +19,45 @@
 //==============================================================================
 void test_dzamax(param_value_t param[], char *info);
 void test_zgbsv(param_value_t param[], char *info);
+void test_zgbsv_batched(param_value_t param[], char *info);
 void test_zgbtrf(param_value_t param[], char *info);
 void test_zgeadd(param_value_t param[], char *info);
+void test_zgecon(param_value_t param[], char *info);
 void test_zgelqf(param_value_t param[], char *info);
 void test_zgelqs(param_value_t param[], char *info);
 void test_zgels(param_value_t param[], char *info);
 void test_zgemm(param_value_t param[], char *info);
+void test_zgemm_batched(param_value_t param[], char *info);
+void test_zgemm_vbatched(param_value_t param[], char *info);
+void test_zgemm_epilogue(param_value_t param[], char *info);
+void test_zgemmt(param_value_t param[], char *info);
+void test_zgepolar(param_value_t param[], char *info);
+void test_zgeexp(param_value_t param[], char *info);
+void test_zgehrd(param_value_t param[], char *info);
+void test_zgeqp3(param_value_t param[], char *info);
 void test_zgeqrf(param_value_t param[], char *info);
+void test_zgeqrf_batched(param_value_t param[], char *info);
+void test_zgeqrf_cholqr(param_value_t param[], char *info);
 void test_zgeqrs(param_value_t param[], char *info);
 void test_zgesv(param_value_t param[], char *info);
+void test_zgesv_rbt(param_value_t param[], char *info);
+void test_zgesvd(param_value_t param[], char *info);
+void test_zgesvd_randomized(param_value_t param[], char *info);
 void test_zgetrf(param_value_t param[], char *info);
+void test_zgetrf_batched(param_value_t param[], char *info);
+void test_zgetrf_vbatched(param_value_t param[], char *info);
+void test_zgetrf_partial(param_value_t param[], char *info);
 void test_zgetri(param_value_t param[], char *info);
 void test_zgetri_aux(param_value_t param[], char *info);
 void test_zgetrs(param_value_t param[], char *info);
+void test_zgetrs_handle(param_value_t param[], char *info);
+void test_zgetrs_incpiv(param_value_t param[], char *info);
+void test_zgtsv(param_value_t param[], char *info);
+void test_zgtsv_batched(param_value_t param[], char *info);
+void test_zheev(param_value_t param[], char *info);
+void test_zhegst(param_value_t param[], char *info);
 void test_zhemm(param_value_t param[], char *info);
+void test_zhesv(param_value_t param[], char *info);
 void test_zher2k(param_value_t param[], char *info);
 void test_zherk(param_value_t param[], char *info);
 void test_zlacpy(param_value_t param[], char *info);
@@ -45,18 +70,34 @@ void test_zlascl(param_value_t param[], char *info);
 void test_zlaset(param_value_t param[], char *info);
 void test_zlaswp(param_value_t param[], char *info);
 void test_zlauum(param_value_t param[], char *info);
+void test_zlrpotrf(param_value_t param[], char *info);
 void test_zpbsv(param_value_t param[], char *info);
 void test_zpbtrf(param_value_t param[], char *info);
+void test_zplrnt(param_value_t param[], char *info);
+void test_zpocon(param_value_t param[], char *info);
 void test_zposv(param_value_t param[], char *info);
+void test_zpipeline(param_value_t param[], char *info);
 void test_zpotrf(param_value_t param[], char *info);
+void test_zpotrf_batched(param_value_t param[], char *info);
+void test_zpotrf_vbatched(param_value_t param[], char *info);
+void test_zpotrf_partial(param_value_t param[], char *info);
+void test_zpotrf_sparse(param_value_t param[], char *info);
+void test_zpotrf_update(param_value_t param[], char *info);
 void test_zpotri(param_value_t param[], char *info);
 void test_zpotrs(param_value_t param[], char *info);
+void test_zpstrf(param_value_t param[], char *info);
+void test_zptsv(param_value_t param[], char *info);
+void test_zptsv_batched(param_value_t param[], char *info);
 void test_zsymm(param_value_t param[], char *info);
 void test_zsyr2k(param_value_t param[], char *info);
 void test_zsyrk(param_value_t param[], char *info);
+void test_ztpqrt(param_value_t param[], char *info);
 void test_ztradd(param_value_t param[], char *info);
+void test_ztranspose(param_value_t param[], char *info);
 void test_ztrmm(param_value_t param[], char *info);
+void test_ztrmm3(param_value_t param[], char *info);
 void test_ztrsm(param_value_t param[], char *info);
+void test_ztrsyl(param_value_t param[], char *info);
 void test_ztrtri(param_value_t param[], char *info);
 void test_zunmlq(param_value_t param[], char *info);
 void test_zunmqr(param_value_t param[], char *info);
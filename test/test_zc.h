@@ -18,7 +18,10 @@
 // test routines
 //==============================================================================
 void test_zcgesv(param_value_t param[], char *info);
+void test_zcgels(param_value_t param[], char *info);
+void test_zcgetrs_handle(param_value_t param[], char *info);
 void test_zcposv(param_value_t param[], char *info);
+void test_zcpotrf(param_value_t param[], char *info);
 void test_zlag2c(param_value_t param[], char *info);
 void test_clag2z(param_value_t param[], char *info);
 
@@ -0,0 +1,204 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "flops.h"
+#include "plasma.h"
+#include "test.h"
+
+#include <assert.h>
+#include <math.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZCGELS
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL, print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_zcgels(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+            print_usage(PARAM_HMODE);
+        }
+        else {
+            // Return column labels
+            snprintf(info, InfoLen,
+                "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                InfoSpacing, "m",
+                InfoSpacing, "n",
+                InfoSpacing, "nrhs",
+                InfoSpacing, "PadA",
+                InfoSpacing, "PadB",
+                InfoSpacing, "nb",
+                InfoSpacing, "ib",
+                InfoSpacing, "Hous. mode",
+                InfoSpacing, "iter");
+        }
+        return;
+    }
+
+    //================================================================
+    // Set parameters
+    //================================================================
+    int m    = param[PARAM_DIM].dim.m;
+    int n    = imin(param[PARAM_DIM].dim.n, m);
+    int nrhs = param[PARAM_NRHS].i;
+    int lda  = imax(1, m + param[PARAM_PADA].i);
+    int ldb  = imax(1, m + param[PARAM_PADB].i);
+    int ldx  = imax(1, n + param[PARAM_PADB].i);
+    int ITER = 0;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    if (param[PARAM_HMODE].c == 't') {
+        plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
+    }
+    else if (param[PARAM_HMODE].c == 'a') {
+        plasma_set(PlasmaHouseholderMode, PlasmaAutoHouseholder);
+    }
+    else {
+        plasma_set(PlasmaHouseholderMode, PlasmaFlatHouseholder);
+    }
+
+    //================================================================
+    // Allocate and initialize arrays
+    //================================================================
+    plasma_complex64_t *A = (plasma_complex64_t *)malloc(
+        (size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B = (plasma_complex64_t *)malloc(
+        (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *X = (plasma_complex64_t *)malloc(
+        (size_t)ldx*nrhs*sizeof(plasma_complex64_t));
+    assert(X != NULL);
+
+    // Initialize random A and B
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_zcgels(m, n, nrhs, A, lda, B, ldb, X, ldx, &ITER);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+    double flops = flops_zgeqrf(m, n) + flops_zgeqrs(m, n, nrhs);
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    // Return column values
+    snprintf(info, InfoLen,
+        "%*d %*d %*d %*d %*d %*d %*d %*c %*d",
+        InfoSpacing, m,
+        InfoSpacing, n,
+        InfoSpacing, nrhs,
+        InfoSpacing, param[PARAM_PADA].i,
+        InfoSpacing, param[PARAM_PADB].i,
+        InfoSpacing, param[PARAM_NB].i,
+        InfoSpacing, param[PARAM_IB].i,
+        InfoSpacing, param[PARAM_HMODE].c,
+        InfoSpacing, ITER);
+
+    //================================================================
+    // Test results by checking the normal equations
+    //
+    //              || A^H (B - AX) ||_F
+    //     ------------------------------------- < epsilon
+    //      || A ||_F (|| A ||_F || X ||_F + || B ||_F) N
+    //
+    // which the solution in single precision does not satisfy.
+    //================================================================
+    if (test) {
+        if (plainfo == 0) {
+            plasma_complex64_t zone  =  1.0;
+            plasma_complex64_t zmone = -1.0;
+            plasma_complex64_t zzero =  0.0;
+
+            double work[1];
+            double Anorm = LAPACKE_zlange_work(LAPACK_COL_MAJOR, 'F', m, n,
+                                               A, lda, work);
+            double Bnorm = LAPACKE_zlange_work(LAPACK_COL_MAJOR, 'F',
+                                               m, nrhs, B, ldb, work);
+            double Xnorm = LAPACKE_zlange_work(LAPACK_COL_MAJOR, 'F',
+                                               n, nrhs, X, ldx, work);
+
+            // B = B - A*X, then X = A^H*B
+            cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, nrhs, n,
+                        CBLAS_SADDR(zmone), A, lda,
+                                            X, ldx,
+                        CBLAS_SADDR(zone),  B, ldb);
+            cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, m,
+                        CBLAS_SADDR(zone),  A, lda,
+                                            B, ldb,
+                        CBLAS_SADDR(zzero), X, ldx);
+
+            double Rnorm = LAPACKE_zlange_work(LAPACK_COL_MAJOR, 'F',
+                                               n, nrhs, X, ldx, work);
+            double residual = Rnorm / (Anorm*(Anorm*Xnorm+Bnorm)*n);
+
+            param[PARAM_ERROR].d   = residual;
+            param[PARAM_SUCCESS].i = residual < tol;
+        }
+        else {
+            param[PARAM_ERROR].d   = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays
+    //================================================================
+    free(A); free(B); free(X);
+}
@@ -55,29 +55,35 @@ void test_zcgesv(param_value_t param[], char *info)
             print_usage(PARAM_PADB);
             print_usage(PARAM_NB);
             print_usage(PARAM_ZEROCOL);
+            print_usage(PARAM_RMODE);
+            print_usage(PARAM_FPREC);
         }
         else {
             // Return column labels
             snprintf(info, InfoLen,
-                "%*s %*s %*s %*s %*s %*s",
+                "%*s %*s %*s %*s %*s %*s %*s %*s",
                 InfoSpacing, "n",
                 InfoSpacing, "nrhs",
                 InfoSpacing, "PadA",
                 InfoSpacing, "PadB",
                 InfoSpacing, "nb",
-                InfoSpacing, "ZeroCol");
+                InfoSpacing, "ZeroCol",
+                InfoSpacing, "RMode",
+                InfoSpacing, "FPrec");
         }
         return;
     }
     // Return column values
     snprintf(info, InfoLen,
-        "%*d %*d %*d %*d %*d %*d",
+        "%*d %*d %*d %*d %*d %*d %*c %*c",
         InfoSpacing, param[PARAM_DIM].dim.n,
         InfoSpacing, param[PARAM_NRHS].i,
         InfoSpacing, param[PARAM_PADA].i,
         InfoSpacing, param[PARAM_PADB].i,
         InfoSpacing, param[PARAM_NB].i,
-        InfoSpacing, param[PARAM_ZEROCOL].i);
+        InfoSpacing, param[PARAM_ZEROCOL].i,
+        InfoSpacing, param[PARAM_RMODE].c,
+        InfoSpacing, param[PARAM_FPREC].c);
 
     //================================================================
     // Set parameters
@@ -96,6 +102,14 @@ void test_zcgesv(param_value_t param[], char *info)
     // Set tuning parameters
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    if (param[PARAM_RMODE].c == 'g')
+        plasma_set(PlasmaRefinementMode, PlasmaGmresRefinement);
+    else
+        plasma_set(PlasmaRefinementMode, PlasmaClassicRefinement);
+    if (param[PARAM_FPREC].c == 'b')
+        plasma_set(PlasmaFactorPrecision, PlasmaBfloat16Factor);
+    else
+        plasma_set(PlasmaFactorPrecision, PlasmaSingleFactor);
 
     //================================================================
     // Allocate and initialize arrays
@@ -174,6 +174,7 @@ void test_zgeadd(param_value_t param[], char *info)
         plasma_time_t time    = stop-start;
         param[PARAM_TIME].d   = time;
         param[PARAM_GFLOPS].d = flops_zgeadd(m, n) / time / 1e9;
+        param[PARAM_GBYTES].d = bytes_zgeadd(m, n) / time / 1e9;
     }
 
     //==================================================================
@@ -0,0 +1,261 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGESVD.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_zgesvd(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_JOBZ);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "JobZ",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_JOBZ].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t job = param[PARAM_JOBZ].c == 'n' ? PlasmaNoVec : PlasmaVec;
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int minmn = imin(m, n);
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldu = imax(1, m);
+    int ldvt = imax(1, minmn);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    double *S = (double*)malloc((size_t)imax(1, minmn)*sizeof(double));
+    assert(S != NULL);
+
+    plasma_complex64_t *U = NULL;
+    plasma_complex64_t *VT = NULL;
+    if (job == PlasmaVec) {
+        U = (plasma_complex64_t*)malloc(
+            (size_t)ldu*minmn*sizeof(plasma_complex64_t));
+        assert(U != NULL);
+        VT = (plasma_complex64_t*)malloc(
+            (size_t)ldvt*n*sizeof(plasma_complex64_t));
+        assert(VT != NULL);
+    }
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    plasma_complex64_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_zgesvd(job, job, m, n, A, lda, S, U, ldu, VT, ldvt);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zgebrd(m, n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking A = U diag(S) V^H and the orthogonality
+    // of U and V, or by comparing S to the singular values from LAPACK.
+    //================================================================
+    if (test) {
+        double *work = (double*)malloc((size_t)imax(m, n)*sizeof(double));
+        assert(work != NULL);
+
+        // |A|_1
+        double normA = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                           Aref, lda, work);
+        double error;
+        if (job == PlasmaVec) {
+            // Build the identity matrix.
+            plasma_complex64_t *Id =
+                (plasma_complex64_t*)malloc((size_t)minmn*minmn*
+                                            sizeof(plasma_complex64_t));
+            assert(Id != NULL);
+
+            // |Id - U^H * U|_oo / m
+            LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'g', minmn, minmn,
+                                0.0, 1.0, Id, minmn);
+            cblas_zherk(CblasColMajor, CblasUpper, CblasConjTrans, minmn, m,
+                        -1.0, U, ldu, 1.0, Id, minmn);
+            double orthoU =
+                LAPACKE_zlanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    minmn, Id, minmn, work) / m;
+
+            // |Id - VT * VT^H|_oo / n
+            LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'g', minmn, minmn,
+                                0.0, 1.0, Id, minmn);
+            cblas_zherk(CblasColMajor, CblasUpper, CblasNoTrans, minmn, n,
+                        -1.0, VT, ldvt, 1.0, Id, minmn);
+            double orthoV =
+                LAPACKE_zlanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    minmn, Id, minmn, work) / n;
+            param[PARAM_ORTHO].d = fmax(orthoU, orthoV);
+
+            // A - U * diag(S) * VT
+            for (int j = 0; j < minmn; j++)
+                for (int i = 0; i < m; i++)
+                    U[i + j*ldu] *= S[j];
+
+            plasma_complex64_t zone  =  1.0;
+            plasma_complex64_t zmone = -1.0;
+            cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        m, n, minmn,
+                        CBLAS_SADDR(zmone), U,    ldu,
+                                            VT,   ldvt,
+                        CBLAS_SADDR(zone),  Aref, lda);
+
+            // |A - U * diag(S) * VT|_1 / (|A|_1 * max(m, n))
+            error = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                        Aref, lda, work);
+            if (normA != 0)
+                error /= normA;
+            error /= imax(m, n);
+
+            free(Id);
+        }
+        else {
+            double *Sref = (double*)malloc((size_t)minmn*sizeof(double));
+            assert(Sref != NULL);
+            double *superb = (double*)malloc((size_t)minmn*sizeof(double));
+            assert(superb != NULL);
+            retval = LAPACKE_zgesvd(LAPACK_COL_MAJOR, 'N', 'N', m, n,
+                                    Aref, lda, Sref, NULL, 1, NULL, 1,
+                                    superb);
+            assert(retval == 0);
+
+            // max |S - Sref| / (|A|_1 * max(m, n))
+            error = 0.0;
+            for (int i = 0; i < minmn; i++)
+                error = fmax(error, fabs(S[i]-Sref[i]));
+            if (normA != 0)
+                error /= normA;
+            error /= imax(m, n);
+
+            param[PARAM_ORTHO].d = 0.0;
+            free(Sref);
+            free(superb);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = (error < tol && param[PARAM_ORTHO].d < tol);
+
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(S);
+    if (job == PlasmaVec) {
+        free(U);
+        free(VT);
+    }
+    if (test)
+        free(Aref);
+}
@@ -0,0 +1,255 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGESVD_RANDOMIZED.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_zgesvd_randomized(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_OVERSAMPLE);
+            print_usage(PARAM_POWER);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "Oversample",
+                     InfoSpacing, "Power",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_OVERSAMPLE].i,
+             InfoSpacing, param[PARAM_POWER].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = imin(param[PARAM_DIM].dim.k, imin(m, n));
+    int p = param[PARAM_OVERSAMPLE].i;
+    int niter = param[PARAM_POWER].i;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldu = imax(1, m);
+    int ldvt = imax(1, k);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    double *S = (double*)malloc((size_t)imax(1, k)*sizeof(double));
+    assert(S != NULL);
+
+    plasma_complex64_t *U =
+        (plasma_complex64_t*)malloc((size_t)ldu*k*sizeof(plasma_complex64_t));
+    assert(U != NULL);
+
+    plasma_complex64_t *VT =
+        (plasma_complex64_t*)malloc((size_t)ldvt*n*sizeof(plasma_complex64_t));
+    assert(VT != NULL);
+
+    // A = X * Y of rank k, so that the approximation is exact.
+    plasma_complex64_t *X =
+        (plasma_complex64_t*)malloc((size_t)m*k*sizeof(plasma_complex64_t));
+    assert(X != NULL);
+    plasma_complex64_t *Y =
+        (plasma_complex64_t*)malloc((size_t)k*n*sizeof(plasma_complex64_t));
+    assert(Y != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)m*k, X);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)k*n, Y);
+    assert(retval == 0);
+
+    plasma_complex64_t zzero =  0.0;
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+    cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                m, n, k,
+                CBLAS_SADDR(zone),  X, m,
+                                    Y, k,
+                CBLAS_SADDR(zzero), A, lda);
+    free(X);
+    free(Y);
+
+    plasma_complex64_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_zgesvd_randomized(m, n, k, p, niter, A, lda, S, U, ldu, VT, ldvt);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    // products by A and by B
+    int l = imin(k+p, imin(m, n));
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d =
+        ((2*niter+2)*flops_zgemm(m, l, n) + flops_zgemm(m, k, l)) /
+        time / 1e9;
+
+    //================================================================
+    // Test results by checking A = U diag(S) V^H, exact for A of rank k,
+    // and the orthogonality of U and V.
+    //================================================================
+    if (test) {
+        double *work = (double*)malloc((size_t)imax(m, n)*sizeof(double));
+        assert(work != NULL);
+
+        // |A|_1
+        double normA = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                           Aref, lda, work);
+
+        // Build the identity matrix.
+        plasma_complex64_t *Id =
+            (plasma_complex64_t*)malloc((size_t)k*k*
+                                        sizeof(plasma_complex64_t));
+        assert(Id != NULL);
+
+        // |Id - U^H * U|_oo / m
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'g', k, k, 0.0, 1.0, Id, k);
+        cblas_zherk(CblasColMajor, CblasUpper, CblasConjTrans, k, m,
+                    -1.0, U, ldu, 1.0, Id, k);
+        double orthoU = LAPACKE_zlanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                            k, Id, k, work) / m;
+
+        // |Id - VT * VT^H|_oo / n
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'g', k, k, 0.0, 1.0, Id, k);
+        cblas_zherk(CblasColMajor, CblasUpper, CblasNoTrans, k, n,
+                    -1.0, VT, ldvt, 1.0, Id, k);
+        double orthoV = LAPACKE_zlanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                            k, Id, k, work) / n;
+        param[PARAM_ORTHO].d = fmax(orthoU, orthoV);
+
+        // A - U * diag(S) * VT
+        for (int j = 0; j < k; j++)
+            for (int i = 0; i < m; i++)
+                U[i + j*ldu] *= S[j];
+
+        cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                    m, n, k,
+                    CBLAS_SADDR(zmone), U,    ldu,
+                                        VT,   ldvt,
+                    CBLAS_SADDR(zone),  Aref, lda);
+
+        // |A - U * diag(S) * VT|_1 / (|A|_1 * max(m, n))
+        double error = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', m, n,
+                                           Aref, lda, work);
+        if (normA != 0)
+            error /= normA;
+        error /= imax(m, n);
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = (error < tol && param[PARAM_ORTHO].d < tol);
+
+        free(Id);
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(S);
+    free(U);
+    free(VT);
+    if (test)
+        free(Aref);
+}
@@ -0,0 +1,238 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZHEEV.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_zheev(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_JOBZ);
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "JobZ",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB",
+                     InfoSpacing, "Ortho.");
+        }
+        return;
+    }
+    // Return column values.
+    // ortho. column appended later.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_JOBZ].c,
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t jobz = param[PARAM_JOBZ].c == 'n' ? PlasmaNoVec : PlasmaVec;
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    double *W = (double*)malloc((size_t)n*sizeof(double));
+    assert(W != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    // Make A Hermitian.
+    for (int j = 0; j < n; j++) {
+        A[j + j*lda] = creal(A[j + j*lda]);
+        for (int i = j+1; i < n; i++)
+            A[j + i*lda] = conj(A[i + j*lda]);
+    }
+
+    plasma_complex64_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    plasma_zheev(jobz, uplo, n, A, lda, W);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zhetrd(n) / time / 1e9;
+
+    //================================================================
+    // Test results by checking A Z = Z diag(W) and the orthogonality
+    // of Z, or by comparing W to the eigenvalues from LAPACK.
+    //================================================================
+    if (test) {
+        double *work = (double*)malloc((size_t)n*sizeof(double));
+        assert(work != NULL);
+
+        // |A|_1
+        double normA = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                           Aref, lda, work);
+        double error;
+        if (jobz == PlasmaVec) {
+            // Build the identity matrix.
+            plasma_complex64_t *Id =
+                (plasma_complex64_t*)malloc((size_t)n*n*
+                                            sizeof(plasma_complex64_t));
+            assert(Id != NULL);
+            LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'g', n, n,
+                                0.0, 1.0, Id, n);
+
+            // |Id - Z^H * Z|_oo / n
+            cblas_zherk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                        -1.0, A, lda, 1.0, Id, n);
+            param[PARAM_ORTHO].d =
+                LAPACKE_zlanhe_work(LAPACK_COL_MAJOR, 'I', 'u',
+                                    n, Id, n, work) / n;
+
+            // R = A * Z - Z * diag(W)
+            plasma_complex64_t *R = Id;
+            for (int j = 0; j < n; j++)
+                for (int i = 0; i < n; i++)
+                    R[i + j*n] = A[i + j*lda]*W[j];
+
+            plasma_complex64_t zone  =  1.0;
+            plasma_complex64_t zmone = -1.0;
+            cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n, n, n,
+                        CBLAS_SADDR(zone),  Aref, lda,
+                                            A,    lda,
+                        CBLAS_SADDR(zmone), R,    n);
+
+            // |A * Z - Z * diag(W)|_1 / (|A|_1 * n)
+            error = LAPACKE_zlange_work(LAPACK_COL_MAJOR, '1', n, n,
+                                        R, n, work);
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            free(Id);
+        }
+        else {
+            double *Wref = (double*)malloc((size_t)n*sizeof(double));
+            assert(Wref != NULL);
+            retval = LAPACKE_zheev(LAPACK_COL_MAJOR, 'N',
+                                   lapack_const(uplo), n, Aref, lda, Wref);
+            assert(retval == 0);
+
+            // max |W - Wref| / (|A|_1 * n)
+            error = 0.0;
+            for (int i = 0; i < n; i++)
+                error = fmax(error, fabs(W[i]-Wref[i]));
+            if (normA != 0)
+                error /= normA;
+            error /= n;
+
+            param[PARAM_ORTHO].d = 0.0;
+            free(Wref);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = (error < tol && param[PARAM_ORTHO].d < tol);
+
+        free(work);
+
+        // Return ortho. column value.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*.2e",
+                 InfoSpacing, param[PARAM_ORTHO].d);
+    }
+    else {
+        // No ortho. test.
+        int len = strlen(info);
+        snprintf(&info[len], imax(0, InfoLen - len),
+                 " %*s",
+                 InfoSpacing, "---");
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(W);
+    if (test)
+        free(Aref);
+}
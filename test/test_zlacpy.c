@@ -160,6 +160,8 @@ void test_zlacpy(param_value_t param[], char *info)
     }
     else {
         param[PARAM_TIME].d = stop-start;
+        param[PARAM_GBYTES].d =
+            bytes_zlacpy(uplo, m, n) / param[PARAM_TIME].d / 1e9;
     }
 
     //================================================================
@@ -139,6 +139,7 @@ void test_zlaswp(param_value_t param[], char *info)
 
     param[PARAM_TIME].d = stop-start;
     param[PARAM_GFLOPS].d = 0.0;
+    param[PARAM_GBYTES].d = bytes_zlaswp(m, n) / param[PARAM_TIME].d / 1e9;
 
     //================================================================
     // Test results by comparing to result of core_zlacpy function
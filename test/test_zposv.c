@@ -25,8 +25,6 @@
 
 #define COMPLEX
 
-#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
-
 /***************************************************************************//**
  *
  * @brief Tests ZPOSV.
@@ -109,27 +107,17 @@ void test_zposv(param_value_t param[], char *info)
                                     *sizeof(plasma_complex64_t));
     assert(B != NULL);
 
-    int seed[] = {0, 0, 0, 1};
-    lapack_int retval;
-    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    //================================================================
+    // Generate a symmetric/Hermitian positive definite A matrix,
+    // its diagonal increased by n.
+    //================================================================
+    int retval;
+    retval = plasma_zplghe((double)n, n, A, lda, 3172);
     assert(retval == 0);
 
-    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
+    retval = plasma_zplrnt(n, nrhs, B, ldb, 2873);
     assert(retval == 0);
 
-    //================================================================
-    // Make the A matrix symmetric/Hermitian positive definite.
-    // It increases diagonal by n, and makes it real.
-    // It sets Aji = conj( Aij ) for j < i, that is, copy lower
-    // triangle to upper triangle.
-    //================================================================
-    for (int i = 0; i < n; ++i) {
-        A(i,i) = creal(A(i,i)) + n;
-        for (int j = 0; j < i; ++j) {
-            A(j,i) = conj(A(i,j));
-        }
-    }
-
     plasma_complex64_t *Aref = NULL;
     plasma_complex64_t *Bref = NULL;
     double *work = NULL;
@@ -0,0 +1,236 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZPOTRF_UPDATE.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_zpotrf_update(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_UPLO);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s",
+                     InfoSpacing, "Uplo",
+                     InfoSpacing, "N",
+                     InfoSpacing, "K",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_UPLO].c,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_DIM].dim.k,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+    char lapack_uplo = param[PARAM_UPLO].c == 'u' ? 'U' : 'L';
+
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldv = imax(1, n + param[PARAM_PADA].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *V =
+        (plasma_complex64_t*)malloc((size_t)ldv*k*sizeof(plasma_complex64_t));
+    assert(V != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldv*k, V);
+    assert(retval == 0);
+
+    // Make A Hermitian positive definite, as in test_zpotrf.
+    for (int i = 0; i < n; i++) {
+        A(i, i) = creal(A(i, i)) + n;
+        for (int j = 0; j < i; j++) {
+            A(j, i) = conj(A(i, j));
+        }
+    }
+
+    plasma_complex64_t *Aref = NULL;
+    plasma_complex64_t *Vref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+
+        Vref = (plasma_complex64_t*)malloc(
+            (size_t)ldv*k*sizeof(plasma_complex64_t));
+        assert(Vref != NULL);
+        memcpy(Vref, V, (size_t)ldv*k*sizeof(plasma_complex64_t));
+    }
+
+    // Factor A by LAPACK, to be updated by PLASMA.
+    retval = LAPACKE_zpotrf(LAPACK_COL_MAJOR, lapack_uplo, n, A, lda);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_zpotrf_update(uplo, 1, n, k, A, lda, V, ldv);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zpotrf_update(n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual of the updated factor
+    //
+    // || A + V*V^H - L*L^H || / ( ||A + V*V^H|| ),
+    //
+    // and, after the downdate by the same V, of the factor of A again.
+    //================================================================
+    if (test) {
+        double work[1];
+        double error = 0.0;
+
+        // A + V*V^H in the uplo triangle
+        plasma_complex64_t *Aupd =
+            (plasma_complex64_t*)malloc(
+                (size_t)lda*n*sizeof(plasma_complex64_t));
+        assert(Aupd != NULL);
+        memcpy(Aupd, Aref, (size_t)lda*n*sizeof(plasma_complex64_t));
+        cblas_zherk(CblasColMajor, (CBLAS_UPLO)uplo, CblasNoTrans, n, k,
+                    1.0, Vref, ldv, 1.0, Aupd, lda);
+
+        for (int pass = 0; pass < 2 && plainfo == 0; pass++) {
+            plasma_complex64_t *B = pass == 0 ? Aupd : Aref;
+
+            // L*L^H or U^H*U, with the other triangle of the factor zeroed
+            plasma_complex64_t *L =
+                (plasma_complex64_t*)malloc(
+                    (size_t)lda*n*sizeof(plasma_complex64_t));
+            assert(L != NULL);
+            memcpy(L, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+            plasma_complex64_t zzero = 0.0;
+            if (n > 1) {
+                if (uplo == PlasmaLower)
+                    LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'U', n-1, n-1,
+                                        zzero, zzero, &L[lda], lda);
+                else
+                    LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                                        zzero, zzero, &L[1], lda);
+            }
+
+            plasma_complex64_t *R =
+                (plasma_complex64_t*)malloc(
+                    (size_t)lda*n*sizeof(plasma_complex64_t));
+            assert(R != NULL);
+            memcpy(R, B, (size_t)lda*n*sizeof(plasma_complex64_t));
+            if (uplo == PlasmaLower)
+                cblas_zherk(CblasColMajor, CblasLower, CblasNoTrans, n, n,
+                            -1.0, L, lda, 1.0, R, lda);
+            else
+                cblas_zherk(CblasColMajor, CblasUpper, CblasConjTrans, n, n,
+                            -1.0, L, lda, 1.0, R, lda);
+
+            double Bnorm = LAPACKE_zlanhe_work(
+                LAPACK_COL_MAJOR, 'F', lapack_uplo, n, B, lda, work);
+            double pass_error = LAPACKE_zlanhe_work(
+                LAPACK_COL_MAJOR, 'F', lapack_uplo, n, R, lda, work);
+            if (Bnorm != 0.0)
+                pass_error /= Bnorm;
+            error = fmax(error, pass_error);
+
+            free(L);
+            free(R);
+
+            // Downdate back to the factor of A.
+            if (pass == 0) {
+                memcpy(V, Vref, (size_t)ldv*k*sizeof(plasma_complex64_t));
+                plainfo = plasma_zpotrf_update(uplo, -1, n, k,
+                                               A, lda, V, ldv);
+            }
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == 0 && error < tol;
+
+        free(Aupd);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(V);
+    if (test) {
+        free(Aref);
+        free(Vref);
+    }
+}
@@ -0,0 +1,275 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZTPQRT.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_ztpqrt(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_NRHS);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+            print_usage(PARAM_IB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "NRHS",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "NB",
+                     InfoSpacing, "IB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*d %*d %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_NRHS].i,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i,
+             InfoSpacing, param[PARAM_IB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    // m new rows B and D below the n-by-n R and the n-by-nrhs C
+    int m    = param[PARAM_DIM].dim.m;
+    int n    = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+
+    int ldr = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, m + param[PARAM_PADA].i);
+    int ldc = imax(1, n + param[PARAM_PADB].i);
+    int ldd = imax(1, m + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *R =
+        (plasma_complex64_t*)malloc((size_t)ldr*n*sizeof(plasma_complex64_t));
+    assert(R != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc((size_t)ldb*n*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *C =
+        (plasma_complex64_t*)malloc(
+            (size_t)ldc*nrhs*sizeof(plasma_complex64_t));
+    assert(C != NULL);
+
+    plasma_complex64_t *D =
+        (plasma_complex64_t*)malloc(
+            (size_t)ldd*nrhs*sizeof(plasma_complex64_t));
+    assert(D != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldr*n, R);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*n, B);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldc*nrhs, C);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldd*nrhs, D);
+    assert(retval == 0);
+
+    // R is upper triangular.
+    plasma_complex64_t zzero = 0.0;
+    if (n > 1) {
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                            zzero, zzero, &R[1], ldr);
+    }
+
+    plasma_complex64_t *Rref = NULL;
+    plasma_complex64_t *Bref = NULL;
+    plasma_complex64_t *Cref = NULL;
+    plasma_complex64_t *Dref = NULL;
+    if (test) {
+        Rref = (plasma_complex64_t*)malloc(
+            (size_t)ldr*n*sizeof(plasma_complex64_t));
+        assert(Rref != NULL);
+        memcpy(Rref, R, (size_t)ldr*n*sizeof(plasma_complex64_t));
+
+        Bref = (plasma_complex64_t*)malloc(
+            (size_t)ldb*n*sizeof(plasma_complex64_t));
+        assert(Bref != NULL);
+        memcpy(Bref, B, (size_t)ldb*n*sizeof(plasma_complex64_t));
+
+        Cref = (plasma_complex64_t*)malloc(
+            (size_t)ldc*nrhs*sizeof(plasma_complex64_t));
+        assert(Cref != NULL);
+        memcpy(Cref, C, (size_t)ldc*nrhs*sizeof(plasma_complex64_t));
+
+        Dref = (plasma_complex64_t*)malloc(
+            (size_t)ldd*nrhs*sizeof(plasma_complex64_t));
+        assert(Dref != NULL);
+        memcpy(Dref, D, (size_t)ldd*nrhs*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_desc_t T;
+    plasma_time_t start = omp_get_wtime();
+    plasma_ztpqrt(m, n, nrhs, R, ldr, B, ldb, C, ldc, D, ldd, &T);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_ztpqrt(m, n, nrhs) / time / 1e9;
+
+    //================================================================
+    // Test results by checking that the update preserves the products
+    // [R; B]^H*[R; B] = R_+^H*R_+ and [R; B]^H*[C; D] = R_+^H*C_+.
+    //================================================================
+    if (test) {
+        plasma_complex64_t zone  =  1.0;
+        plasma_complex64_t zmone = -1.0;
+
+        if (n > 1) {
+            LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'L', n-1, n-1,
+                                zzero, zzero, &R[1], ldr);
+        }
+
+        // G = R^H*R + B^H*B - R_+^H*R_+
+        plasma_complex64_t *G =
+            (plasma_complex64_t*)malloc(
+                (size_t)imax(1, n)*imax(n, nrhs)*sizeof(plasma_complex64_t));
+        assert(G != NULL);
+        cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, n,
+                    CBLAS_SADDR(zone),  Rref, ldr,
+                                        Rref, ldr,
+                    CBLAS_SADDR(zzero), G, n);
+        cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, m,
+                    CBLAS_SADDR(zone), Bref, ldb,
+                                       Bref, ldb,
+                    CBLAS_SADDR(zone), G, n);
+        cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, n, n, n,
+                    CBLAS_SADDR(zmone), R, ldr,
+                                        R, ldr,
+                    CBLAS_SADDR(zone),  G, n);
+
+        double work[1];
+        double Rnorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', n, n, Rref, ldr, work);
+        double Bnorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', m, n, Bref, ldb, work);
+        double Anorm2 = Rnorm*Rnorm + Bnorm*Bnorm;
+
+        double error = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', n, n, G, n, work);
+        if (Anorm2 != 0.0)
+            error /= Anorm2;
+
+        // G = R^H*C + B^H*D - R_+^H*C_+
+        if (nrhs > 0) {
+            cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, n,
+                        CBLAS_SADDR(zone),  Rref, ldr,
+                                            Cref, ldc,
+                        CBLAS_SADDR(zzero), G, n);
+            cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, m,
+                        CBLAS_SADDR(zone), Bref, ldb,
+                                           Dref, ldd,
+                        CBLAS_SADDR(zone), G, n);
+            cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans,
+                        n, nrhs, n,
+                        CBLAS_SADDR(zmone), R, ldr,
+                                            C, ldc,
+                        CBLAS_SADDR(zone),  G, n);
+
+            double Cnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', n, nrhs, Cref, ldc, work);
+            double Dnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', m, nrhs, Dref, ldd, work);
+            double Xnorm = sqrt(Anorm2)*sqrt(Cnorm*Cnorm + Dnorm*Dnorm);
+
+            double rhs_error = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', n, nrhs, G, n, work);
+            if (Xnorm != 0.0)
+                rhs_error /= Xnorm;
+            error = fmax(error, rhs_error);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+
+        free(G);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    if (imin(m, n) > 0)
+        plasma_desc_destroy(&T);
+    free(R);
+    free(B);
+    free(C);
+    free(D);
+    if (test) {
+        free(Rref);
+        free(Bref);
+        free(Cref);
+        free(Dref);
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "flops.h"
+#include "plasma.h"
+#include "test.h"
+
+#include <assert.h>
+#include <math.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZTRANSPOSE
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_ztranspose(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info
+            print_usage(PARAM_TRANS);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "Trans",
+                     InfoSpacing, "m",
+                     InfoSpacing, "n",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "nb");
+        }
+        return;
+    }
+    // Return column values
+    snprintf(info, InfoLen,
+             "%*c %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANS].c,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters
+    //================================================================
+    // The default trans = n stands for the plain transpose.
+    plasma_enum_t trans = plasma_trans_const(param[PARAM_TRANS].c);
+    if (trans == PlasmaNoTrans)
+        trans = PlasmaTrans;
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+
+    //================================================================
+    // Set tuning parameters
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc((size_t)ldb*m*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*m, B);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+
+    retval = plasma_ztranspose(trans, m, n, A, lda, B, ldb);
+
+    plasma_time_t stop = omp_get_wtime();
+
+    param[PARAM_GFLOPS].d = 0.0;
+
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_ztranspose() failed");
+        param[PARAM_TIME].d    = 0.0;
+        param[PARAM_ERROR].d   = 1.0;
+        param[PARAM_SUCCESS].i = false;
+        return;
+    }
+    else {
+        param[PARAM_TIME].d = stop-start;
+        param[PARAM_GBYTES].d =
+            bytes_zlacpy(PlasmaGeneral, m, n) / param[PARAM_TIME].d / 1e9;
+    }
+
+    //================================================================
+    // Test results by comparing elementwise to op( A )
+    //================================================================
+    if (test) {
+        // The copy is exact, so any difference is an error.
+        double error = 0.0;
+        for (int j = 0; j < m; j++) {
+            for (int i = 0; i < n; i++) {
+                plasma_complex64_t aji = A[(size_t)lda*i+j];
+                if (trans == PlasmaConjTrans)
+                    aji = conj(aji);
+                error = fmax(error, cabs(B[(size_t)ldb*j+i] - aji));
+            }
+        }
+
+        param[PARAM_ERROR].d   = error;
+        param[PARAM_SUCCESS].i = error == 0.0;
+    }
+
+    //================================================================
+    // Free arrays
+    //================================================================
+    free(A);
+    free(B);
+}
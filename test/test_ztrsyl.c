@@ -0,0 +1,222 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZTRSYL.
+ *
+ * @param[in]  param - array of parameters
+ * @param[out] info  - string of column labels or column values; length InfoLen
+ *
+ * If param is NULL and info is NULL,     print usage and return.
+ * If param is NULL and info is non-NULL, set info to column labels and return.
+ * If param is non-NULL and info is non-NULL, set info to column values
+ * and run test.
+ ******************************************************************************/
+void test_ztrsyl(param_value_t param[], char *info)
+{
+    //================================================================
+    // Print usage info or return column labels or values.
+    //================================================================
+    if (param == NULL) {
+        if (info == NULL) {
+            // Print usage info.
+            print_usage(PARAM_TRANSA);
+            print_usage(PARAM_TRANSB);
+            print_usage(PARAM_ISGN);
+            print_usage(PARAM_DIM);
+            print_usage(PARAM_PADA);
+            print_usage(PARAM_PADB);
+            print_usage(PARAM_PADC);
+            print_usage(PARAM_NB);
+        }
+        else {
+            // Return column labels.
+            snprintf(info, InfoLen,
+                     "%*s %*s %*s %*s %*s %*s %*s %*s %*s",
+                     InfoSpacing, "TransA",
+                     InfoSpacing, "TransB",
+                     InfoSpacing, "isgn",
+                     InfoSpacing, "M",
+                     InfoSpacing, "N",
+                     InfoSpacing, "PadA",
+                     InfoSpacing, "PadB",
+                     InfoSpacing, "PadC",
+                     InfoSpacing, "NB");
+        }
+        return;
+    }
+    // Return column values.
+    snprintf(info, InfoLen,
+             "%*c %*c %*d %*d %*d %*d %*d %*d %*d",
+             InfoSpacing, param[PARAM_TRANSA].c,
+             InfoSpacing, param[PARAM_TRANSB].c,
+             InfoSpacing, param[PARAM_ISGN].i,
+             InfoSpacing, param[PARAM_DIM].dim.m,
+             InfoSpacing, param[PARAM_DIM].dim.n,
+             InfoSpacing, param[PARAM_PADA].i,
+             InfoSpacing, param[PARAM_PADB].i,
+             InfoSpacing, param[PARAM_PADC].i,
+             InfoSpacing, param[PARAM_NB].i);
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    // A^T and A^H are the same operation in real arithmetic.
+    plasma_enum_t transa =
+        plasma_trans_const(param[PARAM_TRANSA].c) == PlasmaNoTrans ?
+        PlasmaNoTrans : Plasma_ConjTrans;
+    plasma_enum_t transb =
+        plasma_trans_const(param[PARAM_TRANSB].c) == PlasmaNoTrans ?
+        PlasmaNoTrans : Plasma_ConjTrans;
+    int isgn = param[PARAM_ISGN].i;
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+    int ldc = imax(1, m + param[PARAM_PADC].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc((size_t)lda*m*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc((size_t)ldb*n*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *C =
+        (plasma_complex64_t*)malloc((size_t)ldc*n*sizeof(plasma_complex64_t));
+    assert(C != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, (size_t)lda*m, A);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*n, B);
+    assert(retval == 0);
+    retval = LAPACKE_zlarnv(1, seed, (size_t)ldc*n, C);
+    assert(retval == 0);
+
+    // Upper triangular A and B, with the eigenvalues of A around m and
+    // those of -isgn B around -n, far from each other.
+    if (m > 1)
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'l', m-1, m-1, 0.0, 0.0,
+                            &A[1], lda);
+    if (n > 1)
+        LAPACKE_zlaset_work(LAPACK_COL_MAJOR, 'l', n-1, n-1, 0.0, 0.0,
+                            &B[1], ldb);
+    for (int i = 0; i < m; i++)
+        A[(size_t)lda*i+i] += m;
+    for (int i = 0; i < n; i++)
+        B[(size_t)ldb*i+i] += isgn*n;
+
+    plasma_complex64_t *Cref = NULL;
+    if (test) {
+        Cref = (plasma_complex64_t*)malloc(
+            (size_t)ldc*n*sizeof(plasma_complex64_t));
+        assert(Cref != NULL);
+
+        memcpy(Cref, C, (size_t)ldc*n*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_ztrsyl(transa, transb, isgn, m, n,
+                                A, lda, B, ldb, C, ldc);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = (flops_ztrsm(PlasmaLeft, m, n) +
+                             flops_ztrsm(PlasmaRight, m, n)) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual
+    // ||op(A)*X + isgn*X*op(B) - C|| / ((||A|| + ||B||)*||X||)
+    //================================================================
+    if (test) {
+        plasma_complex64_t zone  =  1.0;
+        plasma_complex64_t zmone = -1.0;
+        plasma_complex64_t zsgn  = isgn;
+        double work[1];
+
+        double Anorm = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', m, m, A, lda, work);
+        double Bnorm = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', n, n, B, ldb, work);
+        double Xnorm = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', m, n, C, ldc, work);
+
+        // Cref = op(A)*X - Cref
+        cblas_zgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, CblasNoTrans,
+                    m, n, m,
+                    CBLAS_SADDR(zone),  A,    lda,
+                                        C,    ldc,
+                    CBLAS_SADDR(zmone), Cref, ldc);
+
+        // Cref += isgn*X*op(B)
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, (CBLAS_TRANSPOSE)transb,
+                    m, n, n,
+                    CBLAS_SADDR(zsgn), C,    ldc,
+                                       B,    ldb,
+                    CBLAS_SADDR(zone), Cref, ldc);
+
+        double error = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', m, n, Cref, ldc, work);
+        if ((Anorm + Bnorm) * Xnorm != 0)
+            error /= ((Anorm + Bnorm) * Xnorm);
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = plainfo == PlasmaSuccess && error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    if (test)
+        free(Cref);
+}
@@ -0,0 +1,297 @@
+// Analyzes the task graph of a dry run of PLASMA, written by
+// plasma_trace_write_dag(). Compile this file to a program, e.g.:
+//
+//     gcc -O2 -o dag dag.c
+//
+// Record the graph with PLASMA built with -DPLASMA_WITH_TRACE, e.g.:
+//
+//     plasma_set(PlasmaDryRun, PlasmaDryRunOn);
+//     plasma_zgeqrf(m, n, pA, lda, T);
+//     plasma_set(PlasmaDryRun, PlasmaDryRunOff);
+//     plasma_trace_write_dag("geqrf.dag");
+//
+// Then run:
+//
+//     ./dag [-f gflops] [-b gbytes] [-o overhead] geqrf.dag [cores ...]
+//
+// The cost of a task is its flops at gflops Gflop/s per core (default 10),
+// plus its bytes at gbytes GB/s per core (default 5), plus overhead
+// microseconds (default 1), which is the whole cost of the tasks without
+// a modeled work. The program prints the total work, the length of the
+// critical path, the average parallelism, the kernels on the critical path,
+// and for each number of cores (default 1 2 4 8 16 32 64), the makespan of
+// a list schedule giving priority to the tasks on the longest paths.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char kernel[64];
+    int m, n;
+    double cost;
+    double bottom;  // longest path from the start of the task to the end
+    int num_deps;
+    long *deps;
+    int num_succs;
+    long *succs;
+    long path;      // predecessor on the longest path to the task
+    double finish;  // earliest finish time with unbounded cores
+} task_t;
+
+static task_t *tasks = NULL;
+static long num_tasks = 0;
+
+//------------------------------------------------------------------------------
+static void read_dag(const char *path, double gflops, double gbytes,
+                     double overhead)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    long size = 0;
+    for (;;) {
+        // Skip the comments.
+        int c;
+        while ((c = fgetc(file)) == '#' || c == '\n') {
+            if (c == '#')
+                while ((c = fgetc(file)) != '\n' && c != EOF)
+                    ;
+        }
+        if (c == EOF)
+            break;
+        ungetc(c, file);
+
+        if (num_tasks == size) {
+            size = size > 0 ? 2*size : 4096;
+            tasks = (task_t*)realloc(tasks, size*sizeof(task_t));
+            if (tasks == NULL) {
+                fprintf(stderr, "out of memory\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+        task_t *task = &tasks[num_tasks];
+        long id;
+        double flops, bytes;
+        if (fscanf(file, "%ld %63s %d %d %lf %lf %d", &id, task->kernel,
+                   &task->m, &task->n, &flops, &bytes, &task->num_deps) != 7 ||
+            id != num_tasks || task->num_deps < 0) {
+            fprintf(stderr, "%s: bad task %ld\n", path, num_tasks);
+            exit(EXIT_FAILURE);
+        }
+        task->cost = flops/(gflops*1e9) + bytes/(gbytes*1e9) + overhead*1e-6;
+        task->deps = (long*)malloc((task->num_deps+1)*sizeof(long));
+        for (int d = 0; d < task->num_deps; d++) {
+            if (fscanf(file, "%ld", &task->deps[d]) != 1 ||
+                task->deps[d] < 0 || task->deps[d] >= id) {
+                fprintf(stderr, "%s: bad dependency of task %ld\n", path, id);
+                exit(EXIT_FAILURE);
+            }
+        }
+        task->num_succs = 0;
+        task->succs = NULL;
+        num_tasks++;
+    }
+    fclose(file);
+}
+
+//------------------------------------------------------------------------------
+static void link_tasks()
+{
+    for (long i = 0; i < num_tasks; i++)
+        for (int d = 0; d < tasks[i].num_deps; d++)
+            tasks[tasks[i].deps[d]].num_succs++;
+    for (long i = 0; i < num_tasks; i++) {
+        tasks[i].succs = (long*)malloc((tasks[i].num_succs+1)*sizeof(long));
+        tasks[i].num_succs = 0;
+    }
+    for (long i = 0; i < num_tasks; i++) {
+        for (int d = 0; d < tasks[i].num_deps; d++) {
+            task_t *pred = &tasks[tasks[i].deps[d]];
+            pred->succs[pred->num_succs++] = i;
+        }
+    }
+    // Longest paths, the tasks being in an order of the graph.
+    for (long i = 0; i < num_tasks; i++) {
+        double start = 0.0;
+        tasks[i].path = -1;
+        for (int d = 0; d < tasks[i].num_deps; d++) {
+            long p = tasks[i].deps[d];
+            if (tasks[p].finish > start) {
+                start = tasks[p].finish;
+                tasks[i].path = p;
+            }
+        }
+        tasks[i].finish = start + tasks[i].cost;
+    }
+    for (long i = num_tasks-1; i >= 0; i--) {
+        double bottom = 0.0;
+        for (int s = 0; s < tasks[i].num_succs; s++)
+            if (tasks[tasks[i].succs[s]].bottom > bottom)
+                bottom = tasks[tasks[i].succs[s]].bottom;
+        tasks[i].bottom = bottom + tasks[i].cost;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Binary heaps of tasks: ready tasks by decreasing bottom level,
+// running tasks by increasing finish time.
+typedef struct {
+    long *ids;
+    double *keys;
+    long num;
+} heap_t;
+
+static void heap_push(heap_t *heap, long id, double key)
+{
+    long i = heap->num++;
+    while (i > 0 && heap->keys[(i-1)/2] > key) {
+        heap->ids[i] = heap->ids[(i-1)/2];
+        heap->keys[i] = heap->keys[(i-1)/2];
+        i = (i-1)/2;
+    }
+    heap->ids[i] = id;
+    heap->keys[i] = key;
+}
+
+static long heap_pop(heap_t *heap, double *key)
+{
+    long id = heap->ids[0];
+    *key = heap->keys[0];
+    long last = --heap->num;
+    long i = 0;
+    for (;;) {
+        long c = 2*i+1;
+        if (c >= last)
+            break;
+        if (c+1 < last && heap->keys[c+1] < heap->keys[c])
+            c++;
+        if (heap->keys[c] >= heap->keys[last])
+            break;
+        heap->ids[i] = heap->ids[c];
+        heap->keys[i] = heap->keys[c];
+        i = c;
+    }
+    heap->ids[i] = heap->ids[last];
+    heap->keys[i] = heap->keys[last];
+    return id;
+}
+
+//------------------------------------------------------------------------------
+static double schedule(int cores)
+{
+    heap_t ready = {
+        (long*)malloc(num_tasks*sizeof(long)),
+        (double*)malloc(num_tasks*sizeof(double)), 0 };
+    heap_t running = {
+        (long*)malloc(num_tasks*sizeof(long)),
+        (double*)malloc(num_tasks*sizeof(double)), 0 };
+    int *waiting = (int*)malloc((num_tasks+1)*sizeof(int));
+    for (long i = 0; i < num_tasks; i++) {
+        waiting[i] = tasks[i].num_deps;
+        if (waiting[i] == 0)
+            heap_push(&ready, i, -tasks[i].bottom);
+    }
+    double time = 0.0;
+    int idle = cores;
+    while (ready.num > 0 || running.num > 0) {
+        while (idle > 0 && ready.num > 0) {
+            double key;
+            long i = heap_pop(&ready, &key);
+            heap_push(&running, i, time + tasks[i].cost);
+            idle--;
+        }
+        long i = heap_pop(&running, &time);
+        idle++;
+        for (int s = 0; s < tasks[i].num_succs; s++) {
+            long j = tasks[i].succs[s];
+            if (--waiting[j] == 0)
+                heap_push(&ready, j, -tasks[j].bottom);
+        }
+    }
+    free(ready.ids);
+    free(ready.keys);
+    free(running.ids);
+    free(running.keys);
+    free(waiting);
+    return time;
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    double gflops = 10.0;
+    double gbytes = 5.0;
+    double overhead = 1.0;
+    int arg = 1;
+    for (; arg+1 < argc && argv[arg][0] == '-'; arg += 2) {
+        if (strcmp(argv[arg], "-f") == 0)
+            gflops = atof(argv[arg+1]);
+        else if (strcmp(argv[arg], "-b") == 0)
+            gbytes = atof(argv[arg+1]);
+        else if (strcmp(argv[arg], "-o") == 0)
+            overhead = atof(argv[arg+1]);
+        else
+            break;
+    }
+    if (arg >= argc || gflops <= 0.0 || gbytes <= 0.0 || overhead < 0.0) {
+        fprintf(stderr, "usage: %s [-f gflops] [-b gbytes] [-o overhead] "
+                        "file.dag [cores ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    read_dag(argv[arg], gflops, gbytes, overhead);
+    if (num_tasks == 0) {
+        fprintf(stderr, "%s: no tasks\n", argv[arg]);
+        return EXIT_FAILURE;
+    }
+    link_tasks();
+
+    double work = 0.0;
+    long last = 0;
+    for (long i = 0; i < num_tasks; i++) {
+        work += tasks[i].cost;
+        if (tasks[i].finish > tasks[last].finish)
+            last = i;
+    }
+    double span = tasks[last].finish;
+    printf("tasks              %ld\n", num_tasks);
+    printf("work               %.6lf s\n", work);
+    printf("critical path      %.6lf s\n", span);
+    printf("parallelism        %.2lf\n", work/span);
+
+    // Kernels on the critical path, in order of their time on it.
+    printf("critical path by kernel:\n");
+    for (long i = last; i >= 0; i = tasks[i].path) {
+        if (tasks[i].kernel[0] == '\0')
+            continue;
+        int count = 0;
+        double time = 0.0;
+        char kernel[64];
+        strcpy(kernel, tasks[i].kernel);
+        for (long j = i; j >= 0; j = tasks[j].path) {
+            if (strcmp(tasks[j].kernel, kernel) == 0) {
+                count++;
+                time += tasks[j].cost;
+                tasks[j].kernel[0] = '\0';
+            }
+        }
+        printf("    %-24s %6d tasks %10.6lf s\n", kernel, count, time);
+    }
+
+    printf("%8s %14s %10s %10s\n", "cores", "makespan (s)", "speedup",
+           "efficiency");
+    static const int default_cores[] = {1, 2, 4, 8, 16, 32, 64};
+    int num_cores = argc-arg-1 > 0 ?
+                    argc-arg-1 : sizeof(default_cores)/sizeof(int);
+    for (int c = 0; c < num_cores; c++) {
+        int cores = argc-arg-1 > 0 ? atoi(argv[arg+1+c]) : default_cores[c];
+        if (cores <= 0)
+            continue;
+        double makespan = schedule(cores);
+        printf("%8d %14.6lf %10.2lf %10.2lf\n", cores, makespan,
+               work/makespan, work/makespan/cores);
+    }
+    return EXIT_SUCCESS;
+}
@@ -73,14 +73,24 @@ blas_mixed = [
     # ----- mixed "zc" routines
     ('dsposv',               'zcposv'              ),
     ('dsgesv',               'zcgesv'              ),
+    ('dsgels',               'zcgels'              ),
+    ('dsgetrf',              'zcgetrf'             ),
+    ('dsgetrs',              'zcgetrs'             ),
+    ('dsgmres',              'zcgmres'             ),
+    ('dsgemm',               'zcgemm'              ),
+    ('dspotrf',              'zcpotrf'             ),
+    ('dssyrk',               'zcherk'              ),
+    ('dstrsm',               'zctrsm'              ),
 
     # ----- regular routines
     ('daxpy',                'zaxpy'               ),
     ('ddot',                 'zdotc'               ),
     ('dgeadd',               'zgeadd'              ),
+    ('dgels',                'zgels'               ),
     ('dgemm',                'zgemm'               ),
     ('dgeqrf',               'zgeqrf'              ),
     ('dgeqrs',               'zgeqrs'              ),
+    ('dgeresid',             'zgeresid'            ),
     ('dgesv',                'zgesv'               ),
     ('dgetrf',               'zgetrf'              ),
     ('dgetrs',               'zgetrs'              ),
@@ -100,16 +110,22 @@ blas_mixed = [
     ('dpotrs',               'zpotrs'              ),
     ('dsymm',                'zhemm'               ),
     ('dsymv',                'zhemv'               ),
+    ('dsyresid',             'zheresid'            ),
     ('dsyrk',                'zherk'               ),
     ('dtrmm',                'ztrmm'               ),
     ('dtrsm',                'ztrsm'               ),
     ('dtrsv',                'ztrsv'               ),
     ('damax',                'dzamax'              ),
     ('idamax',               'izamax'              ),
+    ('sgeadd',               'cgeadd'              ),
+    ('sgemm',                'cgemm'               ),
+    ('sgeqrf',               'cgeqrf'              ),
     ('sgetrf',               'cgetrf',             ),
+    ('slacpy',               'clacpy'              ),
     ('slag2d',               'clag2z'              ),
     ('slansy',               'clanhe'              ),
     ('slaswp',               'claswp'              ),
+    ('sormqr',               'cunmqr'              ),
     ('slat2d',               'clat2z'              ),
     ('spotrf',               'cpotrf'              ),
     ('strmm',                'ctrmm'               ),
@@ -137,6 +153,7 @@ blas = [
     ('sdot',                 'ddot',                 'cdotu',                'zdotu'               ),
     ('sgeadd',               'dgeadd',               'cgeadd',               'zgeadd'              ),
     ('sgemm',                'dgemm',                'cgemm',                'zgemm'               ),
+    ('cblas_sgemm',          'cblas_dgemm',          'cblas_sgemm',          'cblas_dgemm'         ),
     ('sgemv',                'dgemv',                'cgemv',                'zgemv'               ),
     ('sger',                 'dger',                 'cgerc',                'zgerc'               ),
     ('sger',                 'dger',                 'cgeru',                'zgeru'               ),
@@ -156,6 +173,7 @@ blas = [
     ('ssyr',                 'dsyr',                 'csyr',                 'zsyr'                ),  # also does zsyrk, zsyr2k
     ('stbsm',                'dtbsm',                'ctbsm',                'ztbsm'               ),
     ('stradd',               'dtradd',               'ctradd',               'ztradd'              ),
+    ('stranspose',           'dtranspose',           'ctranspose',           'ztranspose'          ),
     ('strmm',                'dtrmm',                'ctrmm',                'ztrmm'               ),
     ('strmv',                'dtrmv',                'ctrmv',                'ztrmv'               ),
     ('strsm',                'dtrsm',                'ctrsm',                'ztrsm'               ),
@@ -171,9 +189,11 @@ lapack = [
     ('sbdsdc',               'dbdsdc',               'sbdsdc',               'dbdsdc'              ),
     ('sbdsqr',               'dbdsqr',               'cbdsqr',               'zbdsqr'              ),
     ('sbdt01',               'dbdt01',               'cbdt01',               'zbdt01'              ),
+    ('schud',                'dchud',                'cchud',                'zchud'               ),
     ('sgbbrd',               'dgbbrd',               'cgbbrd',               'zgbbrd'              ),
     ('sgbsv',                'dgbsv',                'cgbsv',                'zgbsv'               ),
     ('sgbtrf',               'dgbtrf',               'cgbtrf',               'zgbtrf'              ),
+    ('sgbhrd',               'dgbhrd',               'cgbhrd',               'zgbhrd'              ),
     ('sgbtrs',               'dgbtrs',               'cgbtrs',               'zgbtrs'              ),
     ('sgebak',               'dgebak',               'cgebak',               'zgebak'              ),
     ('sgebal',               'dgebal',               'cgebal',               'zgebal'              ),
@@ -181,20 +201,25 @@ lapack = [
     ('sgebrd',               'dgebrd',               'cgebrd',               'zgebrd'              ),
     ('sgeev',                'dgeev',                'cgeev',                'zgeev'               ),
     ('sgegqr',               'dgegqr',               'cgegqr',               'zgegqr'              ),
+    ('sgecon',               'dgecon',               'cgecon',               'zgecon'              ),
     ('sgehd2',               'dgehd2',               'cgehd2',               'zgehd2'              ),
     ('sgehrd',               'dgehrd',               'cgehrd',               'zgehrd'              ),
+    ('sgeexp',               'dgeexp',               'cgeexp',               'zgeexp'              ),
     ('sgelq2',               'dgelq2',               'cgelq2',               'zgelq2'              ),
     ('sgelqf',               'dgelqf',               'cgelqf',               'zgelqf'              ),
     ('sgelqs',               'dgelqs',               'cgelqs',               'zgelqs'              ),
     ('sgelqt',               'dgelqt',               'cgelqt',               'zgelqt'              ),
     ('sgels',                'dgels',                'cgels',                'zgels'               ),
+    ('sgepolar',             'dgepolar',             'cgepolar',             'zgepolar'            ),
     ('sgeqlf',               'dgeqlf',               'cgeqlf',               'zgeqlf'              ),
     ('sgeqp3',               'dgeqp3',               'cgeqp3',               'zgeqp3'              ),
     ('sgeqr2',               'dgeqr2',               'cgeqr2',               'zgeqr2'              ),
     ('sgeqrf',               'dgeqrf',               'cgeqrf',               'zgeqrf'              ),
     ('sgeqrs',               'dgeqrs',               'cgeqrs',               'zgeqrs'              ),
     ('sgeqrt',               'dgeqrt',               'cgeqrt',               'zgeqrt'              ),
+    ('sgerbt',               'dgerbt',               'cgerbt',               'zgerbt'              ),
     ('sgerfs',               'dgerfs',               'cgerfs',               'zgerfs'              ),
+    ('sgeresid',             'dgeresid',             'cgeresid',             'zgeresid'            ),
     ('sgesdd',               'dgesdd',               'cgesdd',               'zgesdd'              ),
     ('sgessm',               'dgessm',               'cgessm',               'zgessm'              ),
     ('sgessq',               'dgessq',               'cgessq',               'zgessq'              ),
@@ -207,6 +232,9 @@ lapack = [
     ('sgetrf',               'dgetrf',               'cgetrf',               'zgetrf'              ),
     ('sgetri',               'dgetri',               'cgetri',               'zgetri'              ),
     ('sgetrs',               'dgetrs',               'cgetrs',               'zgetrs'              ),
+    ('sgtsv',                'dgtsv',                'cgtsv',                'zgtsv'               ),
+    ('sgttrf',               'dgttrf',               'cgttrf',               'zgttrf'              ),
+    ('sgttrs',               'dgttrs',               'cgttrs',               'zgttrs'              ),
     ('spbtrf',               'dpbtrf',               'cpbtrf',               'zpbtrf'              ),
     ('spbtrs',               'dpbtrs',               'cpbtrs',               'zpbtrs'              ),
     ('shseqr',               'dhseqr',               'chseqr',               'zhseqr'              ),
@@ -214,6 +242,7 @@ lapack = [
     ('slabad',               'dlabad',               'slabad',               'dlabad'              ),
     ('slabrd',               'dlabrd',               'clabrd',               'zlabrd'              ),
     ('slacgv',               'dlacgv',               'clacgv',               'zlacgv'              ),
+    ('slacon',               'dlacon',               'clacon',               'zlacon'              ),
     ('slacp2',               'dlacp2',               'clacp2',               'zlacp2'              ),
     ('slacpy',               'dlacpy',               'clacpy',               'zlacpy'              ),
     ('slacrm',               'dlacrm',               'clacrm',               'zlacrm'              ),
@@ -256,6 +285,13 @@ lapack = [
     ('slatrs',               'dlatrs',               'clatrs',               'zlatrs'              ),
     ('slauum',               'dlauum',               'clauum',               'zlauum'              ),
     ('slavsy',               'dlavsy',               'clavhe',               'zlavhe'              ),
+    ('slrcompress',          'dlrcompress',          'clrcompress',          'zlrcompress'         ),
+    ('slrdecompress',        'dlrdecompress',        'clrdecompress',        'zlrdecompress'       ),
+    ('slrgemm',              'dlrgemm',              'clrgemm',              'zlrgemm'             ),
+    ('slrsyrk',              'dlrsyrk',              'clrherk',              'zlrherk'             ),
+    ('slrpotrf',             'dlrpotrf',             'clrpotrf',             'zlrpotrf'            ),
+    ('slrtrsm',              'dlrtrsm',              'clrtrsm',              'zlrtrsm'             ),
+    ('slumm',                'dlumm',                'clumm',                'zlumm'               ),
     ('sorg2r',               'dorg2r',               'cung2r',               'zung2r'              ),
     ('sorgbr',               'dorgbr',               'cungbr',               'zungbr'              ),
     ('sorghr',               'dorghr',               'cunghr',               'zunghr'              ),
@@ -283,11 +319,18 @@ lapack = [
     ('splrnt',               'dplrnt',               'cplrnt',               'zplrnt'              ),
     ('sposv',                'dposv',                'cposv',                'zposv'               ),
     ('spotf2',               'dpotf2',               'cpotf2',               'zpotf2'              ),
+    ('spocon',               'dpocon',               'cpocon',               'zpocon'              ),
     ('spotrf',               'dpotrf',               'cpotrf',               'zpotrf'              ),
     ('spotri',               'dpotri',               'cpotri',               'zpotri'              ),
     ('spotrs',               'dpotrs',               'cpotrs',               'zpotrs'              ),
+    ('spstrf',               'dpstrf',               'cpstrf',               'zpstrf'              ),
+    ('sptsv',                'dptsv',                'cptsv',                'zptsv'               ),
+    ('spttrf',               'dpttrf',               'cpttrf',               'zpttrf'              ),
+    ('spttrs',               'dpttrs',               'cpttrs',               'zpttrs'              ),
     ('sqpt01',               'dqpt01',               'cqpt01',               'zqpt01'              ),
     ('sqrt02',               'dqrt02',               'cqrt02',               'zqrt02'              ),
+    ('srepack',              'drepack',              'crepack',              'zrepack'             ),
+    ('ssbevd',               'dsbevd',               'chbevd',               'zhbevd'              ),
     ('ssbtrd',               'dsbtrd',               'chbtrd',               'zhbtrd'              ),
     ('sshift',               'dshift',               'cshift',               'zshift'              ),
     ('sssssm',               'dssssm',               'cssssm',               'zssssm'              ),
@@ -302,6 +345,9 @@ lapack = [
     ('ssterf',               'dsterf',               'ssterf',               'dsterf'              ),
     ('ssterm',               'dsterm',               'csterm',               'zsterm'              ),
     ('sstt21',               'dstt21',               'cstt21',               'zstt21'              ),
+    ('ssy2sb',               'dsy2sb',               'che2hb',               'zhe2hb'              ),
+    ('sge2gb',               'dge2gb',               'cge2gb',               'zge2gb'              ),
+    ('sge2hb',               'dge2hb',               'cge2hb',               'zge2hb'              ),
     ('ssyev',                'dsyev',                'cheev',                'zheev'               ),
     ('ssyevd',               'dsyevd',               'cheevd',               'zheevd'              ),
     ('ssygs2',               'dsygs2',               'chegs2',               'zhegs2'              ),
@@ -321,9 +367,12 @@ lapack = [
     ('ssytrf',               'dsytrf',               'csytrf',               'zsytrf'              ),
     ('ssytrs',               'dsytrs',               'chetrs',               'zhetrs'              ),
     ('ssytrs',               'dsytrs',               'csytrs',               'zsytrs'              ),
+    ('stpmqrt',              'dtpmqrt',              'ctpmqrt',              'ztpmqrt'             ),
+    ('stpqrt',               'dtpqrt',               'ctpqrt',               'ztpqrt'              ),
     ('strevc',               'dtrevc',               'ctrevc',               'ztrevc'              ),
     ('strsmpl',              'dtrsmpl',              'ctrsmpl',              'ztrsmpl'             ),
     ('strssq',               'dtrssq',               'ctrssq',               'ztrssq'              ),
+    ('strsyl',               'dtrsyl',               'ctrsyl',               'ztrsyl'              ),
     ('strtri',               'dtrtri',               'ctrtri',               'ztrtri'              ),
     ('stsmqr',               'dtsmqr',               'ctsmqr',               'ztsmqr'              ),
     ('stsmlq',               'dtsmlq',               'ctsmlq',               'ztsmlq'              ),
@@ -334,6 +383,7 @@ lapack = [
     ('sttmlq',               'dttmlq',               'cttmlq',               'zttmlq'              ),
     ('sttqrt',               'dttqrt',               'cttqrt',               'zttqrt'              ),
     ('sttlqt',               'dttlqt',               'cttlqt',               'zttlqt'              ),
+    ('sunpack',              'dunpack',              'cunpack',              'zunpack'             ),
 ]
 
 
@@ -369,6 +419,7 @@ subs = {
     # ----- Complex numbers
     # See note in "normal" section below about regexps
     (r'',                   r'\bconj\b'            ),
+    (r'\bfabs\b',           r'\bcabs\b'            ),
 
     # ----- Constants
     # See note in "normal" section below about ConjTrans
@@ -395,6 +446,8 @@ subs = {
     ('dge2desc',             'zge2desc'            ),
     ('sdesc2ge',             'cdesc2ge'            ),
     ('sge2desc',             'cge2desc'            ),
+    ('dspipeline',           'zcpipeline'          ),
+    ('dpipeline',            'zpipeline'           ),
 
     # ----- header files
     (r'_ds\.h\b',           r'_zc\.h\b'            ),
@@ -489,6 +542,14 @@ subs = {
     ('sdesc2pb',             'ddesc2pb',             'cdesc2pb',             'zdesc2pb'            ),
     ('spb2desc',             'dpb2desc',             'cpb2desc',             'zpb2desc'            ),
 
+    ('psdesc_generate',      'pddesc_generate',      'pcdesc_generate',      'pzdesc_generate'     ),
+    ('sdesc_generate',       'ddesc_generate',       'cdesc_generate',       'zdesc_generate'      ),
+    ('sdesc_create',         'ddesc_create',         'cdesc_create',         'zdesc_create'        ),
+    ('sepilogue',            'depilogue',            'cepilogue',            'zepilogue'           ),
+    ('sgenerator_t',         'dgenerator_t',         'cgenerator_t',         'zgenerator_t'        ),
+    ('spipeline',            'dpipeline',            'cpipeline',            'zpipeline'           ),
+    ('stile',                'dtile',                'ctile',                'ztile'               ),
+
     # ----- header files
     (r'_s\.h\b',            r'_d\.h\b',             r'_c\.h\b',             r'_z\.h\b'             ),
     (r'_S_H\b',             r'_D_H\b',              r'_C_H\b',              r'_Z_H\b'              ),